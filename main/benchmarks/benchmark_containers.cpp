@@ -0,0 +1,323 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmark_containers.cpp
+ * @brief Benchmarks of the lock-free ring buffers, the sync containers, the memory pipe and the allocator.
+ *
+ * Every container benchmark times an uncontended push followed by a pop (or an add followed by a find), so the
+ * numbers compare the cost of the data structures and of their locks, not the scheduling of concurrent threads.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ */
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "benchmarks/benchmarks.hpp"
+#include "tools/lock_free_mpmc_ring_buffer.hpp"
+#include "tools/lock_free_ring_buffer.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/rcu_sync_dictionary.hpp"
+#include "tools/sharded_sync_dictionary.hpp"
+#include "tools/sync_dictionary.hpp"
+#include "tools/sync_lane_queue.hpp"
+#include "tools/sync_multi_priority_queue.hpp"
+#include "tools/sync_priority_queue.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/sync_ring_buffer.hpp"
+#include "tools/sync_ring_vector.hpp"
+#include "tools/sync_time_list.hpp"
+
+namespace
+{
+    constexpr std::size_t samples = 200U;
+    constexpr std::size_t ops_per_sample = 500U;
+    constexpr std::size_t container_capacity = 1024U;
+    constexpr int dictionary_keys = 256;
+
+    /**
+     * @brief Times push + front_pop on a sync container holding a few elements.
+     */
+    template <typename Queue>
+    benchmarks::benchmark_result push_front_pop(const char* name, Queue& queue)
+    {
+        return benchmarks::measure_batched(name, samples, ops_per_sample,
+            [&queue](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    queue.push(static_cast<int>(index));
+                    benchmarks::keep(static_cast<std::uintptr_t>(queue.front_pop().value_or(0)));
+                }
+            });
+    }
+
+    /**
+     * @brief Times push + pop(T&) on a lock-free ring buffer.
+     */
+    template <typename Ring>
+    benchmarks::benchmark_result push_pop(const char* name, Ring& ring)
+    {
+        return benchmarks::measure_batched(name, samples, ops_per_sample,
+            [&ring](std::size_t count)
+            {
+                int value = 0;
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    static_cast<void>(ring.push(static_cast<int>(index)));
+                    static_cast<void>(ring.pop(value));
+                    benchmarks::keep(static_cast<std::uintptr_t>(value));
+                }
+            });
+    }
+
+    /**
+     * @brief Times find on a dictionary filled with dictionary_keys entries.
+     */
+    template <typename Dictionary>
+    benchmarks::benchmark_result find(const char* name, Dictionary& dictionary)
+    {
+        return benchmarks::measure_batched(name, samples, ops_per_sample,
+            [&dictionary](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    const int key = static_cast<int>(index) % dictionary_keys;
+                    benchmarks::keep(static_cast<std::uintptr_t>(dictionary.find(key).value_or(0)));
+                }
+            });
+    }
+
+    /**
+     * @brief Times add (update of an existing key) on a dictionary filled with dictionary_keys entries.
+     */
+    template <typename Dictionary>
+    benchmarks::benchmark_result add(const char* name, Dictionary& dictionary, std::size_t ops)
+    {
+        return benchmarks::measure_batched(name, samples, ops,
+            [&dictionary](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    const int key = static_cast<int>(index) % dictionary_keys;
+                    dictionary.add(key, key + 1);
+                }
+            });
+    }
+
+    template <typename Dictionary>
+    void fill(Dictionary& dictionary)
+    {
+        for (int key = 0; key < dictionary_keys; ++key)
+        {
+            dictionary.add(key, key);
+        }
+    }
+
+    void run_ring_benchmarks(benchmarks::benchmark_reporter& reporter)
+    {
+        auto spsc = std::make_unique<tools::lock_free_ring_buffer<int, 10U>>();
+        reporter.report(push_pop("lock_free_ring_buffer_push_pop", *spsc));
+
+        auto padded = std::make_unique<tools::padded_lock_free_ring_buffer<int, 10U>>();
+        reporter.report(push_pop("padded_lock_free_ring_buffer_push_pop", *padded));
+
+        auto mpmc = std::make_unique<tools::lock_free_mpmc_ring_buffer<int, 10U>>();
+        reporter.report(push_pop("lock_free_mpmc_ring_buffer_push_pop", *mpmc));
+    }
+
+    void run_queue_benchmarks(benchmarks::benchmark_reporter& reporter)
+    {
+        tools::sync_queue<int> queue;
+        reporter.report(push_front_pop("sync_queue_push_pop", queue));
+
+        tools::adaptive_sync_queue<int> adaptive_queue;
+        reporter.report(push_front_pop("adaptive_sync_queue_push_pop", adaptive_queue));
+
+        tools::bounded_sync_queue<int> bounded_queue(container_capacity);
+        reporter.report(push_front_pop("bounded_sync_queue_push_pop", bounded_queue));
+
+        auto ring_buffer = std::make_unique<tools::sync_ring_buffer<int, container_capacity>>();
+        reporter.report(push_front_pop("sync_ring_buffer_push_pop", *ring_buffer));
+
+        tools::sync_ring_vector<int> ring_vector(container_capacity);
+        reporter.report(push_front_pop("sync_ring_vector_push_pop", ring_vector));
+
+        tools::sync_priority_queue<int> priority_queue;
+        reporter.report(push_front_pop("sync_priority_queue_push_pop", priority_queue));
+
+        tools::sync_dary_priority_queue<int> dary_priority_queue;
+        reporter.report(push_front_pop("sync_dary_priority_queue_push_pop", dary_priority_queue));
+
+        tools::sync_multi_priority_queue<int> multi_priority_queue;
+        reporter.report(benchmarks::measure_batched("sync_multi_priority_queue_push_pop", samples, ops_per_sample,
+            [&multi_priority_queue](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    multi_priority_queue.push(static_cast<int>(index));
+                    benchmarks::keep(static_cast<std::uintptr_t>(multi_priority_queue.top_pop().value_or(0)));
+                }
+            }));
+
+        tools::sync_lane_queue<int, 4U> lane_queue;
+        reporter.report(benchmarks::measure_batched("sync_lane_queue_push_pop", samples, ops_per_sample,
+            [&lane_queue](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    lane_queue.push(index % 4U, static_cast<int>(index));
+                    benchmarks::keep(static_cast<std::uintptr_t>(lane_queue.pop().value_or(0)));
+                }
+            }));
+
+        tools::sync_time_list<std::uint64_t, int> time_list;
+        reporter.report(benchmarks::measure_batched("sync_time_list_push_pop_until", samples, ops_per_sample,
+            [&time_list](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    time_list.push(static_cast<std::uint64_t>(index), static_cast<int>(index));
+                    benchmarks::keep(time_list.pop_until(static_cast<std::uint64_t>(index)));
+                }
+            }));
+    }
+
+    void run_dictionary_benchmarks(benchmarks::benchmark_reporter& reporter)
+    {
+        tools::sync_dictionary<int, int> dictionary;
+        fill(dictionary);
+        reporter.report(find("sync_dictionary_find", dictionary));
+        reporter.report(add("sync_dictionary_add", dictionary, ops_per_sample));
+
+        tools::sharded_sync_dictionary<int, int> sharded_dictionary;
+        fill(sharded_dictionary);
+        reporter.report(find("sharded_sync_dictionary_find", sharded_dictionary));
+        reporter.report(add("sharded_sync_dictionary_add", sharded_dictionary, ops_per_sample));
+
+        // every add copies the whole map: fewer operations per sample
+        constexpr std::size_t rcu_add_ops = 10U;
+        tools::rcu_sync_dictionary<int, int> rcu_dictionary;
+        fill(rcu_dictionary);
+        reporter.report(find("rcu_sync_dictionary_find", rcu_dictionary));
+        reporter.report(add("rcu_sync_dictionary_add", rcu_dictionary, rcu_add_ops));
+    }
+
+    void run_memory_pipe_benchmark(benchmarks::benchmark_reporter& reporter)
+    {
+        constexpr std::size_t pipe_size = 4096U;
+        constexpr std::size_t message_size = 64U;
+        const auto no_wait = std::chrono::duration<std::uint64_t, std::milli>(0U);
+
+        tools::memory_pipe pipe(pipe_size);
+        std::array<std::uint8_t, message_size> message = {};
+        reporter.report(benchmarks::measure_batched("memory_pipe_send_receive_64", samples, ops_per_sample,
+            [&pipe, &message, &no_wait](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    benchmarks::keep(pipe.send(message.data(), message.size(), no_wait));
+                    benchmarks::keep(pipe.receive(message.data(), message.size(), no_wait));
+                }
+            }));
+    }
+
+    void run_allocator_benchmarks(benchmarks::benchmark_reporter& reporter)
+    {
+        constexpr std::size_t block_size = 64U;
+        constexpr std::size_t max_block_size = 512U;
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+        constexpr const char* new_delete_name = "mem_pool_new_delete_64";
+        constexpr const char* new_delete_mixed_name = "mem_pool_new_delete_mixed";
+#else
+        constexpr const char* new_delete_name = "heap_new_delete_64";
+        constexpr const char* new_delete_mixed_name = "heap_new_delete_mixed";
+#endif
+
+        reporter.report(benchmarks::measure_batched(new_delete_name, samples, ops_per_sample,
+            [](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    void* block = ::operator new(block_size);
+                    benchmarks::keep(reinterpret_cast<std::uintptr_t>(block)); // NOLINT address as a value
+                    ::operator delete(block);
+                }
+            }));
+
+        reporter.report(benchmarks::measure_batched("malloc_free_64", samples, ops_per_sample,
+            [](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    void* block = std::malloc(block_size);                     // NOLINT raw allocation measured
+                    benchmarks::keep(reinterpret_cast<std::uintptr_t>(block)); // NOLINT address as a value
+                    std::free(block);                                          // NOLINT raw allocation measured
+                }
+            }));
+
+        reporter.report(benchmarks::measure_batched(new_delete_mixed_name, samples, ops_per_sample,
+            [](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    void* block = ::operator new((index % max_block_size) + 1U);
+                    benchmarks::keep(reinterpret_cast<std::uintptr_t>(block)); // NOLINT address as a value
+                    ::operator delete(block);
+                }
+            }));
+
+        reporter.report(benchmarks::measure_batched("malloc_free_mixed", samples, ops_per_sample,
+            [](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    void* block = std::malloc((index % max_block_size) + 1U);  // NOLINT raw allocation measured
+                    benchmarks::keep(reinterpret_cast<std::uintptr_t>(block)); // NOLINT address as a value
+                    std::free(block);                                          // NOLINT raw allocation measured
+                }
+            }));
+    }
+}
+
+namespace benchmarks
+{
+    void run_container_benchmarks(benchmark_reporter& reporter)
+    {
+        run_ring_benchmarks(reporter);
+        run_queue_benchmarks(reporter);
+        run_dictionary_benchmarks(reporter);
+        run_memory_pipe_benchmark(reporter);
+        run_allocator_benchmarks(reporter);
+    }
+}
@@ -0,0 +1,346 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmark_harness.hpp
+ * @brief Timing loop, latency percentiles and JSON Lines report of the microbenchmark suite.
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ */
+
+#pragma once
+
+#if !defined(BENCHMARK_HARNESS_HPP_)
+#define BENCHMARK_HARNESS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/hdr_histogram.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+#endif
+
+namespace benchmarks
+{
+    /**
+     * @brief Measured throughput and per-operation latency of one benchmark.
+     */
+    struct benchmark_result
+    {
+        const char* name = "";
+        std::uint64_t operations = 0U;
+        double ops_per_sec = 0.0;
+        std::uint64_t p50_ns = 0U;
+        std::uint64_t p99_ns = 0U;
+    };
+
+    /**
+     * @brief Current time of the benchmark clock in nanoseconds.
+     *
+     * @return esp_timer time on ESP32 (microsecond resolution), tick count elsewhere on FreeRTOS, steady_clock on PC.
+     */
+    inline std::uint64_t now_ns()
+    {
+#if defined(ESP_PLATFORM)
+        constexpr std::uint64_t ns_per_us = 1000U;
+        return static_cast<std::uint64_t>(esp_timer_get_time()) * ns_per_us;
+#elif defined(FREERTOS_PLATFORM)
+        constexpr std::uint64_t ns_per_ms = 1000000U;
+        return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * ns_per_ms;
+#else
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    /**
+     * @brief Name of the platform the results were measured on.
+     */
+    constexpr const char* platform_name()
+    {
+#if defined(ESP_PLATFORM)
+        return "esp32";
+#elif defined(FREERTOS_PLATFORM)
+        return "freertos";
+#elif defined(__linux__)
+        return "linux";
+#elif defined(_WIN32)
+        return "windows";
+#else
+        return "pc";
+#endif
+    }
+
+    /**
+     * @brief Throughputs of a previous run, read back from its JSON lines to gate the next runs.
+     */
+    class benchmark_baseline
+    {
+    public:
+        /**
+         * @brief Loads the results measured on this platform from a benchmark_reporter output.
+         *
+         * Lines of other platforms and lines that are not results are skipped, the last line of a benchmark wins.
+         *
+         * @param path The JSON lines file.
+         * @return false if the file cannot be read.
+         */
+        bool load(const char* path)
+        {
+            std::FILE* input = std::fopen(path, "r");
+            if (nullptr == input)
+            {
+                return false;
+            }
+
+            char line[512] = {};       // NOLINT C array handed to fgets
+            char name[128] = {};       // NOLINT C array handed to sscanf
+            char platform[32] = {};    // NOLINT C array handed to sscanf
+            unsigned long long operations = 0U;
+            double ops_per_sec = 0.0;
+            while (nullptr != std::fgets(line, sizeof(line), input))
+            {
+                const int fields = std::sscanf(line,
+                    "{\"benchmark\":\"%127[^\"]\",\"platform\":\"%31[^\"]\",\"operations\":%llu,\"ops_per_sec\":%lf",
+                    name, platform, &operations, &ops_per_sec);
+                if ((4 == fields) && (0 == std::strcmp(platform, platform_name())))
+                {
+                    set(name, ops_per_sec);
+                }
+            }
+            std::fclose(input);
+            return true;
+        }
+
+        /**
+         * @brief Sets the reference throughput of a benchmark.
+         *
+         * @param name The benchmark name.
+         * @param ops_per_sec The reference throughput.
+         */
+        void set(const char* name, double ops_per_sec)
+        {
+            for (auto& entry : m_entries)
+            {
+                if (entry.first == name)
+                {
+                    entry.second = ops_per_sec;
+                    return;
+                }
+            }
+            m_entries.emplace_back(name, ops_per_sec);
+        }
+
+        /**
+         * @brief Gets the reference throughput of a benchmark.
+         *
+         * @param name The benchmark name.
+         * @return The throughput, 0 when the baseline does not know the benchmark.
+         */
+        [[nodiscard]] double ops_per_sec(const char* name) const
+        {
+            for (const auto& entry : m_entries)
+            {
+                if (entry.first == name)
+                {
+                    return entry.second;
+                }
+            }
+            return 0.0;
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+    private:
+        std::vector<std::pair<std::string, double>> m_entries;
+    };
+
+    /**
+     * @brief Writes one JSON object per benchmark and per line, so that two runs can be diffed or loaded as JSONL.
+     *
+     * With a baseline, each line also carries the reference throughput, the ratio to it and a pass/regressed
+     * status: a benchmark regresses when its throughput falls below (1 - tolerance) times the reference.
+     */
+    class benchmark_reporter
+    {
+    public:
+        explicit benchmark_reporter(std::FILE* output)
+            : m_output(output)
+        {
+        }
+
+        /**
+         * @brief Compares the next results with a baseline.
+         *
+         * @param baseline The reference throughputs, must outlive the reporter.
+         * @param tolerance The accepted throughput loss, e.g. 0.25 for 25 %.
+         */
+        void set_baseline(const benchmark_baseline* baseline, double tolerance)
+        {
+            m_baseline = baseline;
+            m_tolerance = tolerance;
+        }
+
+        /**
+         * @brief Writes a result line.
+         *
+         * @param result The measured benchmark.
+         */
+        void report(const benchmark_result& result)
+        {
+            std::fprintf(m_output,
+                "{\"benchmark\":\"%s\",\"platform\":\"%s\",\"operations\":%llu,\"ops_per_sec\":%.1f,\"p50_ns\":%llu,"
+                "\"p99_ns\":%llu",
+                result.name, platform_name(), static_cast<unsigned long long>(result.operations), result.ops_per_sec,
+                static_cast<unsigned long long>(result.p50_ns), static_cast<unsigned long long>(result.p99_ns));
+
+            const double reference = (nullptr != m_baseline) ? m_baseline->ops_per_sec(result.name) : 0.0;
+            if (reference > 0.0)
+            {
+                const double ratio = result.ops_per_sec / reference;
+                const bool regressed = ratio < (1.0 - m_tolerance);
+                m_regressions += regressed ? 1U : 0U;
+                std::fprintf(m_output, ",\"baseline_ops_per_sec\":%.1f,\"ratio\":%.3f,\"status\":\"%s\"", reference,
+                    ratio, regressed ? "regressed" : "pass");
+            }
+            else if (nullptr != m_baseline)
+            {
+                std::fprintf(m_output, ",\"status\":\"no_baseline\"");
+            }
+
+            std::fprintf(m_output, "}\n");
+            std::fflush(m_output);
+        }
+
+        /**
+         * @brief Gets the number of results that regressed against the baseline.
+         *
+         * @return The regression count, 0 without a baseline.
+         */
+        [[nodiscard]] std::size_t regressions() const
+        {
+            return m_regressions;
+        }
+
+    private:
+        std::FILE* m_output;
+        const benchmark_baseline* m_baseline = nullptr;
+        double m_tolerance = 0.0;
+        std::size_t m_regressions = 0U;
+    };
+
+    /**
+     * @brief Keeps the compiler from optimizing away a value computed by a benchmark.
+     *
+     * @param value The value to consume.
+     */
+    inline void keep(std::uintptr_t value)
+    {
+        static volatile std::uintptr_t sink = 0U;
+        sink = sink ^ value;
+    }
+
+    /**
+     * @brief Measures a batched operation: body(ops_per_sample) runs ops_per_sample operations.
+     *
+     * One sample is the time of a batch divided by its size: the percentiles are those of the per-operation cost
+     * averaged over a batch, which keeps the clock resolution out of the results of nanosecond operations. A first
+     * batch warms the caches up and is not recorded.
+     *
+     * @tparam Body A callable taking the number of operations to run.
+     * @param name The benchmark name, with static storage.
+     * @param samples The number of timed batches.
+     * @param ops_per_sample The number of operations of each batch.
+     * @param body The measured operations.
+     * @return The result.
+     */
+    template <typename Body>
+    benchmark_result measure_batched(const char* name, std::size_t samples, std::size_t ops_per_sample, Body&& body)
+    {
+        tools::hdr_histogram<> latencies;
+        body(ops_per_sample);
+
+        std::uint64_t total_ns = 0U;
+        for (std::size_t sample = 0U; sample < samples; ++sample)
+        {
+            const std::uint64_t start = now_ns();
+            body(ops_per_sample);
+            const std::uint64_t elapsed = now_ns() - start;
+            total_ns += elapsed;
+            latencies.add(elapsed / ops_per_sample);
+        }
+
+        benchmark_result result;
+        result.name = name;
+        result.operations = static_cast<std::uint64_t>(samples) * ops_per_sample;
+        result.ops_per_sec = (0U == total_ns)
+            ? 0.0
+            : (static_cast<double>(result.operations) * 1e9) / static_cast<double>(total_ns); // NOLINT ns per s
+        result.p50_ns = latencies.percentile(0.5);  // NOLINT median
+        result.p99_ns = latencies.percentile(0.99); // NOLINT 99th percentile
+        return result;
+    }
+
+    /**
+     * @brief Measures a round trip: each body() call is one timed sample.
+     *
+     * @tparam Body A callable performing one round trip.
+     * @param name The benchmark name, with static storage.
+     * @param samples The number of timed round trips, after one untimed warm-up.
+     * @param body The measured round trip.
+     * @return The result.
+     */
+    template <typename Body>
+    benchmark_result measure_round_trip(const char* name, std::size_t samples, Body&& body)
+    {
+        return measure_batched(name, samples, 1U,
+            [&body](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    body();
+                }
+            });
+    }
+}
+
+#endif //  BENCHMARK_HARNESS_HPP_
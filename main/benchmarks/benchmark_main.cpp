@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmark_main.cpp
+ * @brief Desktop entry point of the microbenchmark suite and of the performance regression gate.
+ *
+ * Usage: publish_subscribe_benchmarks [results.jsonl] [--suite micro|regression|all] [--baseline baseline.jsonl]
+ * [--tolerance 0.25]. The results go to stdout without a results file, the micro suite runs by default. With a
+ * baseline, the exit code is 1 when a benchmark lost more throughput than the tolerance, 2 on a usage error.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "benchmarks/benchmarks.hpp"
+#include "tools/mem_pool_allocator.hpp"
+
+int main(int argc, char* argv[])
+{
+    const char* output_path = nullptr;
+    const char* baseline_path = nullptr;
+    const char* suite = "micro";
+    constexpr double default_tolerance = 0.25;
+    double tolerance = default_tolerance;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        const char* arg = argv[index];                                      // NOLINT argv access
+        const char* value = (index + 1 < argc) ? argv[index + 1] : nullptr; // NOLINT argv access
+        if ((0 == std::strcmp(arg, "--suite")) && (nullptr != value))
+        {
+            suite = value;
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--baseline")) && (nullptr != value))
+        {
+            baseline_path = value;
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--tolerance")) && (nullptr != value))
+        {
+            tolerance = std::strtod(value, nullptr);
+            ++index;
+        }
+        else if (('-' != arg[0]) && (nullptr == output_path)) // NOLINT first character
+        {
+            output_path = arg;
+        }
+        else
+        {
+            std::fprintf(stderr, "unknown argument %s\n", arg);
+            return 2;
+        }
+    }
+
+    const bool run_micro = (0 == std::strcmp(suite, "micro")) || (0 == std::strcmp(suite, "all"));
+    const bool run_regression = (0 == std::strcmp(suite, "regression")) || (0 == std::strcmp(suite, "all"));
+    if (!run_micro && !run_regression)
+    {
+        std::fprintf(stderr, "unknown suite %s\n", suite);
+        return 2;
+    }
+
+    benchmarks::benchmark_baseline baseline;
+    if ((nullptr != baseline_path) && !baseline.load(baseline_path))
+    {
+        std::fprintf(stderr, "cannot read baseline %s\n", baseline_path);
+        return 2;
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+    init_mem_pool_allocator();
+#endif
+
+    std::FILE* output = (nullptr != output_path) ? std::fopen(output_path, "w") : stdout;
+    if (nullptr == output)
+    {
+        std::fprintf(stderr, "cannot open %s\n", output_path);
+        return 2;
+    }
+
+    benchmarks::benchmark_reporter reporter(output);
+    if (nullptr != baseline_path)
+    {
+        reporter.set_baseline(&baseline, tolerance);
+    }
+
+    if (run_micro)
+    {
+        benchmarks::run_container_benchmarks(reporter);
+        benchmarks::run_task_benchmarks(reporter);
+    }
+    if (run_regression)
+    {
+        benchmarks::run_regression_benchmarks(reporter);
+    }
+
+    if (stdout != output)
+    {
+        static_cast<void>(std::fclose(output));
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+    destroy_mem_pool_allocator();
+#endif
+
+    if (0U != reporter.regressions())
+    {
+        std::fprintf(stderr, "%u benchmark(s) regressed beyond %.0f %% of the baseline\n",
+            static_cast<unsigned>(reporter.regressions()), tolerance * 100.0); // NOLINT percent
+        return 1;
+    }
+
+    return 0;
+}
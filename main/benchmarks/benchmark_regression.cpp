@@ -0,0 +1,228 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmark_regression.cpp
+ * @brief Fixed workloads of the performance regression gate.
+ * @author Laurent Lardinois
+ * @date 2026-10-15
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmarks/benchmarks.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/lock_free_ring_buffer.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/timer_scheduler.hpp"
+
+namespace
+{
+    // each workload is split in a few timed batches, the totals are the fixed workload sizes
+    constexpr std::size_t ring_samples = 10U;
+    constexpr std::size_t ring_transfers = 100000U; // 1M transfers
+    constexpr std::size_t publish_samples = 10U;
+    constexpr std::size_t publish_events = 10000U; // 100k publishes
+    constexpr std::size_t publish_observers = 10U;
+    constexpr std::size_t timer_samples = 5U;
+    constexpr std::size_t timer_count = 10000U;
+    constexpr std::size_t gzip_samples = 5U;
+    constexpr std::size_t gzip_corpus_size = 1024U * 1024U;
+    constexpr std::size_t ring_pow2 = 10U;
+
+    /** @brief Synchronous observer summing the events it receives. */
+    class summing_observer : public tools::sync_observer<int, int>
+    {
+    public:
+        void inform(const int& topic, const int& event, const std::string& origin) override
+        {
+            (void)topic;
+            (void)origin;
+            m_sum += static_cast<std::uintptr_t>(event);
+        }
+
+        [[nodiscard]] std::uintptr_t sum() const
+        {
+            return m_sum;
+        }
+
+    private:
+        std::uintptr_t m_sum = 0U;
+    };
+
+    benchmarks::benchmark_result spsc_ring_transfers()
+    {
+        tools::lock_free_ring_buffer<std::uint32_t, ring_pow2> ring;
+
+        // a producer thread per batch, the calling thread consumes
+        return benchmarks::measure_batched("regression_spsc_ring_1m", ring_samples, ring_transfers,
+            [&ring](std::size_t count)
+            {
+                std::thread producer(
+                    [&ring, count]()
+                    {
+                        for (std::size_t index = 0U; index < count; ++index)
+                        {
+                            while (!ring.push(static_cast<std::uint32_t>(index)))
+                            {
+                                std::this_thread::yield();
+                            }
+                        }
+                    });
+
+                std::uint32_t value = 0U;
+                std::uintptr_t sum = 0U;
+                for (std::size_t received = 0U; received < count;)
+                {
+                    if (ring.pop(value))
+                    {
+                        sum += value;
+                        ++received;
+                    }
+                    else
+                    {
+                        // leave the core to the producer on machines with fewer cores than threads
+                        std::this_thread::yield();
+                    }
+                }
+                producer.join();
+                benchmarks::keep(sum);
+            });
+    }
+
+    benchmarks::benchmark_result publish_to_observers()
+    {
+        tools::sync_subject<int, int> subject("regression_subject");
+        std::vector<std::shared_ptr<summing_observer>> observers;
+        for (std::size_t index = 0U; index < publish_observers; ++index)
+        {
+            observers.push_back(std::make_shared<summing_observer>());
+            subject.subscribe(0, observers.back());
+        }
+
+        auto result = benchmarks::measure_batched("regression_publish_100k_10_observers", publish_samples,
+            publish_events,
+            [&subject](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    subject.publish(0, static_cast<int>(index));
+                }
+            });
+
+        for (const auto& observer : observers)
+        {
+            benchmarks::keep(observer->sum());
+        }
+        return result;
+    }
+
+    benchmarks::benchmark_result add_remove_timers()
+    {
+        tools::timer_scheduler scheduler;
+        std::vector<tools::timer_handle> handles;
+        handles.reserve(timer_count);
+
+        // one hour one-shot timers: the batch measures the scheduler bookkeeping, none fires
+        constexpr std::uint64_t never_ms = 3600U * 1000U;
+        return benchmarks::measure_batched("regression_timers_10k", timer_samples, timer_count,
+            [&scheduler, &handles](std::size_t count)
+            {
+                handles.clear();
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    handles.push_back(scheduler.add(
+                        "regression_timer", never_ms, [](tools::timer_handle /*hnd*/) {}, tools::timer_type::one_shot));
+                }
+                for (const auto handle : handles)
+                {
+                    benchmarks::keep(static_cast<std::uintptr_t>(scheduler.remove(handle)));
+                }
+            });
+    }
+
+    /**
+     * @brief Builds a deterministic text-like corpus: words of a small vocabulary picked by a linear congruential
+     * generator, compressible like logs or JSON payloads.
+     */
+    std::vector<std::uint8_t> make_corpus(std::size_t size)
+    {
+        static constexpr const char* words[] = { "sensor", "temperature", "value", "timestamp", "topic", "event",
+            "publish", "observer", "status", "ok", "warning", "{", "}", "\"", ":", ",", "0", "1", "42", "3.14" };
+        constexpr std::size_t word_count = sizeof(words) / sizeof(words[0]);
+        constexpr std::uint32_t lcg_multiplier = 1664525U;
+        constexpr std::uint32_t lcg_increment = 1013904223U;
+        constexpr std::uint32_t lcg_shift = 16U;
+
+        std::vector<std::uint8_t> corpus;
+        corpus.reserve(size);
+        std::uint32_t state = 1U;
+        while (corpus.size() < size)
+        {
+            state = (state * lcg_multiplier) + lcg_increment;
+            for (const char* letter = words[(state >> lcg_shift) % word_count]; // NOLINT bounded index
+                 ('\0' != *letter) && (corpus.size() < size); ++letter) // NOLINT pointer arithmetic
+            {
+                corpus.push_back(static_cast<std::uint8_t>(*letter));
+            }
+            if (corpus.size() < size)
+            {
+                corpus.push_back(static_cast<std::uint8_t>(' '));
+            }
+        }
+        return corpus;
+    }
+
+    benchmarks::benchmark_result gzip_corpus()
+    {
+        const auto corpus = make_corpus(gzip_corpus_size);
+        tools::gzip_wrapper compressor;
+
+        return benchmarks::measure_batched("regression_gzip_1mb", gzip_samples, 1U,
+            [&compressor, &corpus](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    benchmarks::keep(compressor.pack(corpus).size());
+                }
+            });
+    }
+}
+
+namespace benchmarks
+{
+    void run_regression_benchmarks(benchmark_reporter& reporter)
+    {
+        reporter.report(spsc_ring_transfers());
+        reporter.report(publish_to_observers());
+        reporter.report(add_remove_timers());
+        reporter.report(gzip_corpus());
+    }
+}
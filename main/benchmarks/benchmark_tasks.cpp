@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmark_tasks.cpp
+ * @brief Benchmarks of sync_subject::publish fan-out and of the data_task and worker_task round trips.
+ *
+ * A round trip is timed from the submission of an item by the caller to the caller waking up on the sync_object
+ * signaled by the task once the item has been processed: it includes both task wake-ups.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmarks.hpp"
+#include "tools/base_task.hpp"
+#include "tools/data_task.hpp"
+#include "tools/sync_object.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/worker_task.hpp"
+
+namespace
+{
+    constexpr std::size_t publish_samples = 200U;
+    constexpr std::size_t publish_events = 1000U;
+    constexpr std::size_t round_trip_samples = 1000U;
+    constexpr std::size_t task_stack_size = 4096U;
+    constexpr std::size_t data_queue_depth = 16U;
+
+    /** @brief Synchronous observer counting the events it receives. */
+    class counting_observer : public tools::sync_observer<int, int>
+    {
+    public:
+        void inform(const int& topic, const int& event, const std::string& origin) override
+        {
+            (void)topic;
+            (void)origin;
+            m_sum += static_cast<std::uintptr_t>(event);
+        }
+
+        [[nodiscard]] std::uintptr_t sum() const
+        {
+            return m_sum;
+        }
+
+    private:
+        std::uintptr_t m_sum = 0U;
+    };
+
+    /** @brief Context of the round-trip tasks: the signal waking the caller up. */
+    struct round_trip_context
+    {
+        tools::sync_object processed;
+    };
+
+    benchmarks::benchmark_result publish(const char* name, std::size_t subscriber_count)
+    {
+        tools::sync_subject<int, int> subject("benchmark_subject");
+        std::vector<std::shared_ptr<counting_observer>> observers;
+        for (std::size_t index = 0U; index < subscriber_count; ++index)
+        {
+            observers.push_back(std::make_shared<counting_observer>());
+            subject.subscribe(0, observers.back());
+        }
+
+        // keep the sample duration comparable whatever the fan-out
+        const std::size_t events = (publish_events / subscriber_count) + 1U;
+        auto result = benchmarks::measure_batched(name, publish_samples, events,
+            [&subject](std::size_t count)
+            {
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    subject.publish(0, static_cast<int>(index));
+                }
+            });
+
+        for (const auto& observer : observers)
+        {
+            benchmarks::keep(observer->sum());
+        }
+        return result;
+    }
+
+    benchmarks::benchmark_result data_task_round_trip()
+    {
+        auto context = std::make_shared<round_trip_context>();
+        tools::data_task<round_trip_context, int> task(
+            [](const std::shared_ptr<round_trip_context>& ctx, const std::string& task_name)
+            {
+                (void)ctx;
+                (void)task_name;
+            },
+            [](const std::shared_ptr<round_trip_context>& ctx, const int& data, const std::string& task_name)
+            {
+                (void)data;
+                (void)task_name;
+                ctx->processed.signal();
+            },
+            context, data_queue_depth, "benchmark_data_task", task_stack_size);
+
+        int value = 0;
+        return benchmarks::measure_round_trip("data_task_round_trip", round_trip_samples,
+            [&task, &context, &value]()
+            {
+                static_cast<void>(task.submit(++value));
+                context->processed.wait_for_signal();
+            });
+    }
+
+    benchmarks::benchmark_result worker_task_round_trip()
+    {
+        auto context = std::make_shared<round_trip_context>();
+        tools::worker_task<round_trip_context> task(
+            [](const std::shared_ptr<round_trip_context>& ctx, const std::string& task_name)
+            {
+                (void)ctx;
+                (void)task_name;
+            },
+            context, "benchmark_worker_task", task_stack_size, tools::base_task::run_on_all_cores,
+            tools::base_task::default_priority);
+
+        return benchmarks::measure_round_trip("worker_task_round_trip", round_trip_samples,
+            [&task, &context]()
+            {
+                task.delegate(
+                    [](const std::shared_ptr<round_trip_context>& ctx, const std::string& task_name)
+                    {
+                        (void)task_name;
+                        ctx->processed.signal();
+                    });
+                context->processed.wait_for_signal();
+            });
+    }
+}
+
+namespace benchmarks
+{
+    void run_task_benchmarks(benchmark_reporter& reporter)
+    {
+        reporter.report(publish("sync_subject_publish_1", 1U));
+        reporter.report(publish("sync_subject_publish_10", 10U));
+        reporter.report(publish("sync_subject_publish_100", 100U));
+        reporter.report(data_task_round_trip());
+        reporter.report(worker_task_round_trip());
+    }
+}
@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file benchmarks.hpp
+ * @brief Entry points of the microbenchmark suite of the tools containers and of the pub/sub and task paths.
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ */
+
+#pragma once
+
+#if !defined(BENCHMARKS_HPP_)
+#define BENCHMARKS_HPP_
+
+#include <cstdio>
+
+#include "benchmarks/benchmark_harness.hpp"
+
+namespace benchmarks
+{
+    /**
+     * @brief Runs the lock-free ring buffer, sync container, memory pipe and allocator benchmarks.
+     *
+     * @param reporter The output of the results.
+     */
+    void run_container_benchmarks(benchmark_reporter& reporter);
+
+    /**
+     * @brief Runs the sync_subject publish and the data_task/worker_task round-trip benchmarks.
+     *
+     * @param reporter The output of the results.
+     */
+    void run_task_benchmarks(benchmark_reporter& reporter);
+
+    /**
+     * @brief Runs the fixed regression workloads: 1M SPSC ring transfers, 100k publishes to 10 observers, 10k timers
+     * and the gzip compression of a 1 MB corpus (desktop only).
+     *
+     * @param reporter The output of the results.
+     */
+    void run_regression_benchmarks(benchmark_reporter& reporter);
+
+    /**
+     * @brief Runs the whole suite, one JSON line per benchmark.
+     *
+     * @param output The stream receiving the results (stdout, the console UART on ESP32).
+     */
+    void run_benchmarks(std::FILE* output);
+}
+
+#endif //  BENCHMARKS_HPP_
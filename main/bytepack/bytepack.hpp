@@ -19,6 +19,8 @@
  */
 
 // modified to pass clang-tidy checks
+// modified to byte-swap multibyte arrays and vectors in bulk (SSE2/NEON blocks, word-wise fallback)
+// modified to encode integers and length prefixes as LEB128 varints, zigzag-mapped when signed, on request
 
 #pragma once
 
@@ -35,10 +37,20 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BYTEPACK_SWAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BYTEPACK_SWAP_NEON
+#endif
+
 namespace bytepack
 {
 
@@ -192,6 +204,288 @@ namespace bytepack
     template <typename T>
     concept IntegralType = std::is_integral_v<T>;
 
+    /** @brief Tag selecting an unsigned LEB128 varint length prefix in place of a fixed width `SizeType`. */
+    struct varint_size
+    {
+    };
+
+    template <typename T>
+    concept SizePrefixType = IntegralType<T> || std::same_as<T, varint_size>;
+
+    template <typename T>
+    concept VarintEncodable = std::is_integral_v<T> && !std::same_as<T, bool>;
+
+    namespace detail
+    {
+        /**
+         * @brief Byte-reverses one element of 2, 4 or 8 bytes held in an unsigned word.
+         */
+        template <typename Word>
+        constexpr Word byteswap_word(Word value) noexcept
+        {
+            if constexpr (sizeof(Word) == 2)
+            {
+                return static_cast<Word>((value << 8U) | (value >> 8U));
+            }
+            else if constexpr (sizeof(Word) == 4)
+            {
+                value = ((value & 0x00ff00ffU) << 8U) | ((value >> 8U) & 0x00ff00ffU);
+                return (value << 16U) | (value >> 16U);
+            }
+            else
+            {
+                value = ((value & 0x00ff00ff00ff00ffULL) << 8U) | ((value >> 8U) & 0x00ff00ff00ff00ffULL);
+                value = ((value & 0x0000ffff0000ffffULL) << 16U) | ((value >> 16U) & 0x0000ffff0000ffffULL);
+                return (value << 32U) | (value >> 32U);
+            }
+        }
+
+        template <std::size_t ElementSize>
+        struct swap_word;
+
+        template <>
+        struct swap_word<2>
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct swap_word<4>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct swap_word<8>
+        {
+            using type = std::uint64_t;
+        };
+
+#if defined(BYTEPACK_SWAP_SSE2)
+        /**
+         * @brief Byte-reverses every element of a 16-byte block (SSE2: swap the bytes of each 16-bit word,
+         * then reverse the word order inside each element).
+         */
+        template <std::size_t ElementSize>
+        inline __m128i byteswap_block(__m128i block) noexcept
+        {
+            block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+            if constexpr (ElementSize == 4)
+            {
+                block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+                block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+            }
+            else if constexpr (ElementSize == 8)
+            {
+                block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+                block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+            return block;
+        }
+#elif defined(BYTEPACK_SWAP_NEON)
+        /**
+         * @brief Byte-reverses every element of a 16-byte block (NEON vrev).
+         */
+        template <std::size_t ElementSize>
+        inline uint8x16_t byteswap_block(uint8x16_t block) noexcept
+        {
+            if constexpr (ElementSize == 2)
+            {
+                return vrev16q_u8(block);
+            }
+            else if constexpr (ElementSize == 4)
+            {
+                return vrev32q_u8(block);
+            }
+            else
+            {
+                return vrev64q_u8(block);
+            }
+        }
+#endif
+
+        /**
+         * @brief Copies count elements of ElementSize bytes from src to dst, reversing the bytes of each one.
+         *
+         * 2, 4 and 8-byte elements go through 16-byte SSE2/NEON blocks when available, then word-wise swaps
+         * for the tail (or for the whole range on other targets, e.g. Xtensa). Other sizes are reversed byte
+         * by byte. The buffers may be unaligned but must not overlap.
+         */
+        template <std::size_t ElementSize>
+        inline void copy_byteswapped(void* dst, const void* src, std::size_t count) noexcept
+        {
+            auto* out = static_cast<std::uint8_t*>(dst);
+            const auto* in = static_cast<const std::uint8_t*>(src);
+
+            if constexpr ((ElementSize == 2) || (ElementSize == 4) || (ElementSize == 8))
+            {
+                const std::size_t bytes = count * ElementSize;
+                std::size_t offset = 0U;
+#if defined(BYTEPACK_SWAP_SSE2)
+                for (; (offset + 16U) <= bytes; offset += 16U)
+                {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset)); // NOLINT
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + offset), // NOLINT
+                        byteswap_block<ElementSize>(block));
+                }
+#elif defined(BYTEPACK_SWAP_NEON)
+                for (; (offset + 16U) <= bytes; offset += 16U)
+                {
+                    vst1q_u8(out + offset, byteswap_block<ElementSize>(vld1q_u8(in + offset))); // NOLINT
+                }
+#endif
+                using word_type = typename swap_word<ElementSize>::type;
+                for (; offset < bytes; offset += ElementSize)
+                {
+                    word_type word {};
+                    std::memcpy(&word, in + offset, ElementSize); // NOLINT pointer arithmetic
+                    word = byteswap_word(word);
+                    std::memcpy(out + offset, &word, ElementSize); // NOLINT pointer arithmetic
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::uint8_t* element = in + (i * ElementSize); // NOLINT pointer arithmetic
+                    std::reverse_copy(element, element + ElementSize, out + (i * ElementSize)); // NOLINT
+                }
+            }
+        }
+
+        /** @brief Longest LEB128 encoding of a 64-bit value. */
+        constexpr std::size_t varint_max_length = 10U;
+
+        /** @brief Maps signed values to unsigned ones, small magnitudes first (0, -1, 1, -2...); unsigned values pass. */
+        template <VarintEncodable T>
+        constexpr std::uint64_t zigzag_encode(const T value) noexcept
+        {
+            using Unsigned = std::make_unsigned_t<T>;
+            if constexpr (std::is_signed_v<T>)
+            {
+                const auto sign = static_cast<Unsigned>(value >> std::numeric_limits<T>::digits);
+                return static_cast<Unsigned>(static_cast<Unsigned>(static_cast<Unsigned>(value) << 1U) ^ sign);
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+        /** @brief Inverse of zigzag_encode(), the bits being known to fit in T. */
+        template <VarintEncodable T>
+        constexpr T zigzag_decode(const std::uint64_t bits) noexcept
+        {
+            using Unsigned = std::make_unsigned_t<T>;
+            if constexpr (std::is_signed_v<T>)
+            {
+                return static_cast<T>(static_cast<Unsigned>((bits >> 1U) ^ (0U - (bits & 1U))));
+            }
+            else
+            {
+                return static_cast<T>(bits);
+            }
+        }
+
+        /** @brief Whether decoded varint bits fit the unsigned counterpart of T. */
+        template <VarintEncodable T>
+        constexpr bool varint_fits(const std::uint64_t bits) noexcept
+        {
+            constexpr int digits = std::numeric_limits<std::make_unsigned_t<T>>::digits;
+            if constexpr (digits >= 64)
+            {
+                return true;
+            }
+            else
+            {
+                return (bits >> static_cast<unsigned>(digits)) == 0U;
+            }
+        }
+
+        constexpr std::size_t varint_length(const std::uint64_t bits) noexcept
+        {
+            return (static_cast<std::size_t>(std::bit_width(bits | 1U)) + 6U) / 7U;
+        }
+
+        /** @brief Writes varint_length(bits) bytes, least significant group first, to a large enough output. */
+        inline std::size_t encode_varint(std::uint64_t bits, std::uint8_t* output) noexcept
+        {
+            std::size_t length = 0U;
+            while (bits >= 0x80U)
+            {
+                output[length++] = static_cast<std::uint8_t>(bits | 0x80U); // NOLINT pointer arithmetic
+                bits >>= 7U;
+            }
+            output[length++] = static_cast<std::uint8_t>(bits); // NOLINT pointer arithmetic
+            return length;
+        }
+
+        /**
+         * @brief Reads a varint of up to 64 bits.
+         *
+         * One byte values return at once. Otherwise, when 8 bytes are readable, the terminating byte is found with
+         * one count of trailing zeros over a word and the 7-bit groups are packed with three shift-and-mask steps;
+         * only 9 and 10 byte values and the end of the buffer take the byte loop.
+         *
+         * @return Encoded length, 0 if the varint is truncated or longer than 64 bits.
+         */
+        inline std::size_t decode_varint(const std::uint8_t* input, const std::size_t available,
+            std::uint64_t& bits) noexcept
+        {
+            if ((available > 0U) && (input[0] < 0x80U)) // NOLINT pointer arithmetic
+            {
+                bits = input[0]; // NOLINT pointer arithmetic
+                return 1U;
+            }
+
+            if (available >= sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0U;
+                std::memcpy(&word, input, sizeof(word));
+                if constexpr (std::endian::native == std::endian::big)
+                {
+                    word = byteswap_word(word);
+                }
+                const std::uint64_t ends = ~word & 0x8080808080808080ULL;
+                if (ends != 0U)
+                {
+                    const auto length = static_cast<std::size_t>(std::countr_zero(ends) + 1) / 8U;
+                    const std::uint64_t keep = (length == 8U) ? ~0ULL : ((1ULL << (length * 8U)) - 1U);
+                    std::uint64_t packed = word & keep & 0x7f7f7f7f7f7f7f7fULL;
+                    packed = ((packed & 0x7f007f007f007f00ULL) >> 1U) | (packed & 0x007f007f007f007fULL);
+                    packed = ((packed & 0x3fff00003fff0000ULL) >> 2U) | (packed & 0x00003fff00003fffULL);
+                    packed = ((packed & 0x0fffffff00000000ULL) >> 4U) | (packed & 0x000000000fffffffULL);
+                    bits = packed;
+                    return length;
+                }
+            }
+
+            std::uint64_t value = 0U;
+            const std::size_t limit = std::min(available, varint_max_length);
+            for (std::size_t index = 0U; index < limit; ++index)
+            {
+                const std::uint64_t byte = input[index]; // NOLINT pointer arithmetic
+                if ((index == (varint_max_length - 1U)) && (byte > 1U))
+                {
+                    return 0U; // beyond 64 bits
+                }
+                value |= (byte & 0x7fU) << (7U * index);
+                if (byte < 0x80U)
+                {
+                    bits = value;
+                    return index + 1U;
+                }
+            }
+            return 0U;
+        }
+    } // namespace detail
+
+    enum class IntegerMode : std::uint8_t
+    {
+        Fixed, // Integers are written at full width in the stream endianness (default)
+        Varint // Integers are LEB128 varints, signed ones zigzag-mapped first; so are default length prefixes
+    };
+
     enum class StringMode : std::uint8_t
     {
         Default, // String length is serialized as metadata before the string data (default)
@@ -205,11 +499,17 @@ namespace bytepack
      *
      * @tparam BufferEndian The endianness to use for serialization and deserialization.
      *                      Defaults to big-endian (network byte order).
+     * @tparam Encoding The encoding of integers wider than one byte and of default length prefixes. Varint shrinks
+     *                  small counters and lengths to one or two bytes; arrays and vectors of integers keep their
+     *                  fixed width elements. `write<IntegerMode>()` and `read<IntegerMode>()` select it per field.
      */
-    template <std::endian BufferEndian = std::endian::big>
+    template <std::endian BufferEndian = std::endian::big, IntegerMode Encoding = IntegerMode::Fixed>
     class binary_stream final
     {
     public:
+        /** @brief Length prefix of containers and strings written without an explicit `SizeType`. */
+        using default_size_type = std::conditional_t<Encoding == IntegerMode::Varint, varint_size, std::uint32_t>;
+
         explicit binary_stream(const std::size_t buffer_size) noexcept
             : buffer_ { new std::uint8_t[buffer_size] {}, buffer_size } // NOLINT keep original implementation
             , owns_buffer_ { true }
@@ -253,26 +553,27 @@ namespace bytepack
         template <NetworkSerializableBasic T>
         bool write(const T& value) noexcept
         {
-            if (buffer_.size() < (write_index_ + sizeof(T)))
+            if constexpr ((Encoding == IntegerMode::Varint) && VarintEncodable<T> && (sizeof(T) > 1))
             {
-                return false;
+                return write_varint(value);
             }
-
-            std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &value, sizeof(T));
-
-            if constexpr (BufferEndian != std::endian::native && sizeof(T) > 1)
+            else
             {
-                // TODO: htonl/htons/ntohl/ntohs performs better for endianness conversion. However, it
-                // requires platform-specific headers. It is possible to implement hton/ntoh like functions
-                // in the library in a platform-independent way using bit shifts.
-                // Benchmark link: https://quick-bench.com/q/va-kzUk1J1BfvSgR05Z1YPnrJhg
-                std::ranges::reverse(
-                    buffer_.as<std::uint8_t>() + write_index_, buffer_.as<std::uint8_t>() + write_index_ + sizeof(T));
+                return write_fixed(value);
             }
+        }
 
-            write_index_ += sizeof(T);
-
-            return true;
+        template <IntegerMode Mode, VarintEncodable T>
+        bool write(const T& value) noexcept
+        {
+            if constexpr (Mode == IntegerMode::Varint)
+            {
+                return write_varint(value);
+            }
+            else
+            {
+                return write_fixed(value);
+            }
         }
 
         template <NetworkSerializableBasicArray T>
@@ -297,14 +598,9 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < numElements; ++i)
-                {
-                    std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &value[i], elementSize);
-                    std::ranges::reverse(buffer_.as<std::uint8_t>() + write_index_,
-                        buffer_.as<std::uint8_t>() + write_index_ + elementSize);
-                    write_index_ += elementSize;
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<elementSize>(buffer_.as<std::uint8_t>() + write_index_, value, numElements);
+                write_index_ += numElements * elementSize;
             }
 
             return true;
@@ -329,41 +625,29 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < N; ++i)
-                {
-                    std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &array[i], sizeof(T));
-                    std::ranges::reverse(buffer_.as<std::uint8_t>() + write_index_,
-                        buffer_.as<std::uint8_t>() + write_index_ + sizeof(T));
-                    write_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(buffer_.as<std::uint8_t>() + write_index_, array.data(), N);
+                write_index_ += N * sizeof(T);
             }
             return true;
         }
 
-        template <IntegralType SizeType = std::uint32_t, typename T>
+        template <SizePrefixType SizeType = default_size_type, typename T>
             requires NetworkSerializableBasic<T>
         bool write(const std::vector<T>& vector) noexcept
         {
             // When serializing dynamic size containers (if fixed size is not given), always include the container's
             // size as metadata before the container data. This is crucial even for empty containers, as it allows the
             // deserializer to accurately determine if the container is empty or contains data.
-            if (buffer_.size() < (write_index_ + sizeof(SizeType) + (vector.size() * sizeof(T))))
+            if (buffer_.size()
+                < (write_index_ + size_prefix_length<SizeType>(vector.size()) + (vector.size() * sizeof(T))))
             {
                 // Vector size field and its elements cannot fit in the remaining buffer space
                 return false;
             }
 
-            const auto size_custom = static_cast<SizeType>(vector.size());
-            if ((std::is_signed_v<SizeType> && size_custom < 0)
-                || static_cast<std::size_t>(size_custom) != vector.size())
-            {
-                // Overflow or incorrect size type
-                return false;
-            }
-
             // Write vector size field first (before the vector data)
-            if (!write(size_custom))
+            if (!write_size_prefix<SizeType>(vector.size()))
             {
                 return false;
             }
@@ -377,14 +661,10 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < vector.size(); ++i)
-                {
-                    std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &vector[i], sizeof(T));
-                    std::ranges::reverse(buffer_.as<std::uint8_t>() + write_index_,
-                        buffer_.as<std::uint8_t>() + write_index_ + sizeof(T));
-                    write_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(
+                    buffer_.as<std::uint8_t>() + write_index_, vector.data(), vector.size());
+                write_index_ += vector.size() * sizeof(T);
             }
             return true;
         }
@@ -407,37 +687,53 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < N; ++i)
-                {
-                    std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &vector[i], sizeof(T));
-                    std::ranges::reverse(buffer_.as<std::uint8_t>() + write_index_,
-                        buffer_.as<std::uint8_t>() + write_index_ + sizeof(T));
-                    write_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(buffer_.as<std::uint8_t>() + write_index_, vector.data(), N);
+                write_index_ += N * sizeof(T);
             }
             return true;
         }
 
-        template <IntegralType SizeType = std::uint32_t, NetworkSerializableString StringType>
-        bool write(const StringType& value) noexcept
+        template <SizePrefixType SizeType = default_size_type, typename T>
+            requires NetworkSerializableBasic<T>
+        bool write(std::span<const T> elements) noexcept
         {
-            const auto str_length = static_cast<SizeType>(value.length());
-            if ((std::is_signed_v<SizeType> && str_length < 0)
-                || static_cast<std::size_t>(str_length) != value.length())
+            // Same layout as a vector: size prefix, then the elements, so either can read it back
+            if (buffer_.size()
+                < (write_index_ + size_prefix_length<SizeType>(elements.size()) + (elements.size() * sizeof(T))))
             {
-                // Overflow or incorrect size type
                 return false;
             }
 
-            if (buffer_.size() < (write_index_ + sizeof(SizeType) + value.length()))
+            if (!write_size_prefix<SizeType>(elements.size()))
+            {
+                return false;
+            }
+
+            if constexpr (BufferEndian == std::endian::native || sizeof(T) == 1)
+            {
+                std::memcpy(buffer_.as<std::uint8_t>() + write_index_, elements.data(), elements.size() * sizeof(T));
+            }
+            else
+            {
+                detail::copy_byteswapped<sizeof(T)>(
+                    buffer_.as<std::uint8_t>() + write_index_, elements.data(), elements.size());
+            }
+            write_index_ += elements.size() * sizeof(T);
+            return true;
+        }
+
+        template <SizePrefixType SizeType = default_size_type, NetworkSerializableString StringType>
+        bool write(const StringType& value) noexcept
+        {
+            if (buffer_.size() < (write_index_ + size_prefix_length<SizeType>(value.length()) + value.length()))
             {
                 // String data and its length field cannot fit in the remaining buffer space
                 return false;
             }
 
-            // Write string length field first (before the string data)
-            if (!write(str_length))
+            // Write string length field first (before the string data), failing on overflow of SizeType
+            if (!write_size_prefix<SizeType>(value.length()))
             {
                 return false;
             }
@@ -514,25 +810,27 @@ namespace bytepack
         template <NetworkSerializableBasic T>
         bool read(T& value) noexcept
         {
-            if (buffer_.size() < (read_index_ + sizeof(T)))
+            if constexpr ((Encoding == IntegerMode::Varint) && VarintEncodable<T> && (sizeof(T) > 1))
             {
-                return false;
+                return read_varint(value);
             }
-
-            std::memcpy(&value, buffer_.as<std::uint8_t>() + read_index_, sizeof(T));
-
-            if constexpr (BufferEndian != std::endian::native && sizeof(T) > 1)
+            else
             {
-                // Using reinterpret_cast to treat 'value' as an array of bytes is safe here because:
-                // The `NetworkSerializableBasic` concept ensures 'T' is a non-class, fundamental type, making
-                // it trivially copyable and ensuring a consistent, predictable memory layout across systems.
-                std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&value), // NOLINT keep original implementation
-                    reinterpret_cast<std::uint8_t*>(&value) + sizeof(T));     // NOLINT keep original implementation
+                return read_fixed(value);
             }
+        }
 
-            read_index_ += sizeof(T);
-
-            return true;
+        template <IntegerMode Mode, VarintEncodable T>
+        bool read(T& value) noexcept
+        {
+            if constexpr (Mode == IntegerMode::Varint)
+            {
+                return read_varint(value);
+            }
+            else
+            {
+                return read_fixed(value);
+            }
         }
 
         template <NetworkSerializableBasicArray T>
@@ -557,14 +855,9 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (size_t i = 0; i < numElements; ++i)
-                {
-                    std::memcpy(&value[i], buffer_.as<std::uint8_t>() + read_index_, elementSize);
-                    std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&value[i]), // NOLINT
-                        reinterpret_cast<std::uint8_t*>(&value[i]) + elementSize);   // NOLINT
-                    read_index_ += elementSize;
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<elementSize>(value, buffer_.as<std::uint8_t>() + read_index_, numElements);
+                read_index_ += numElements * elementSize;
             }
 
             return true;
@@ -589,36 +882,28 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (size_t i = 0; i < N; ++i)
-                {
-                    std::memcpy(&array[i], buffer_.as<std::uint8_t>() + read_index_, sizeof(T));
-                    std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&array[i]), // NOLINT
-                        reinterpret_cast<std::uint8_t*>(&array[i]) + sizeof(T));     // NOLINT
-                    read_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(array.data(), buffer_.as<std::uint8_t>() + read_index_, N);
+                read_index_ += N * sizeof(T);
             }
 
             return true;
         }
 
-        template <IntegralType SizeType = std::uint32_t, typename T>
+        template <SizePrefixType SizeType = default_size_type, typename T>
             requires NetworkSerializableBasic<T>
         bool read(std::vector<T>& vector) noexcept
         {
-            SizeType size_custom {};
             // vector size cannot be negative, so it's treated as an error. Zero size is well-defined for dynamic
             // containers if they are not serialized with a given fixed size because it indicates an empty container.
-            if (!read(size_custom) || size_custom < 0)
-            {
-                return false;
-            }
-            const auto size = static_cast<std::size_t>(size_custom);
-
-            if (buffer_.size() < (read_index_ + (size * sizeof(T))))
+            std::size_t size = 0U;
+            std::size_t prefix_length = 0U;
+            if (!peek_size_prefix<SizeType>(size, prefix_length)
+                || (size > ((buffer_.size() - read_index_ - prefix_length) / sizeof(T))))
             {
                 return false;
             }
+            read_index_ += prefix_length;
 
             vector.resize(size);
 
@@ -631,14 +916,9 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < size; ++i)
-                {
-                    std::memcpy(&vector[i], buffer_.as<std::uint8_t>() + read_index_, sizeof(T));
-                    std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&vector[i]), // NOLINT
-                        reinterpret_cast<std::uint8_t*>(&vector[i]) + sizeof(T));     // NOLINT
-                    read_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(vector.data(), buffer_.as<std::uint8_t>() + read_index_, size);
+                read_index_ += size * sizeof(T);
             }
             return true;
         }
@@ -663,54 +943,57 @@ namespace bytepack
             }
             else
             {
-                // For multibyte types with differing endianness, handle each element individually
-                for (std::size_t i = 0; i < N; ++i)
-                {
-                    std::memcpy(&vector[i], buffer_.as<std::uint8_t>() + read_index_, sizeof(T));
-                    std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&vector[i]), // NOLINT
-                        reinterpret_cast<std::uint8_t*>(&vector[i]) + sizeof(T));     // NOLINT
-                    read_index_ += sizeof(T);
-                }
+                // For multibyte types with differing endianness, swap the elements in bulk
+                detail::copy_byteswapped<sizeof(T)>(vector.data(), buffer_.as<std::uint8_t>() + read_index_, N);
+                read_index_ += N * sizeof(T);
             }
             return true;
         }
 
-        template <IntegralType SizeType = std::uint32_t>
-        bool read(std::string& value) noexcept
+        template <SizePrefixType SizeType = default_size_type, typename T>
+            requires NetworkSerializableBasic<T> && (BufferEndian == std::endian::native || sizeof(T) == 1)
+        bool read(std::span<const T>& view) noexcept
         {
-            if (buffer_.size() < (read_index_ + sizeof(SizeType)))
+            // Zero-copy: the view points into the stream buffer, so it is only valid as long as the buffer is, and
+            // the elements must be stored in native order at their alignment
+            std::size_t size = 0U;
+            std::size_t prefix_length = 0U;
+            if (!peek_size_prefix<SizeType>(size, prefix_length)
+                || (size > ((buffer_.size() - read_index_ - prefix_length) / sizeof(T))))
             {
                 return false;
             }
 
-            // Temporarily read string length without incrementing deserialize index
-            SizeType str_length {};
-            std::memcpy(&str_length, buffer_.as<std::uint8_t>() + read_index_, sizeof(SizeType));
-
-            // Handle endianness for the string length
-            if constexpr (BufferEndian != std::endian::native && sizeof(SizeType) > 1)
-            {
-                std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&str_length),    // NOLINT
-                    reinterpret_cast<std::uint8_t*>(&str_length) + sizeof(SizeType)); // NOLINT
-            }
-
-            // String length cannot be negative, so it's treated as an error. Zero length is well-defined for dynamic
-            // strings if they are not serialized with a given fixed length because it indicates an empty string.
-            if (str_length < 0)
+            const std::uint8_t* first = buffer_.as<std::uint8_t>() + read_index_ + prefix_length;
+            if (0U != (reinterpret_cast<std::uintptr_t>(first) % alignof(T)))
             {
                 return false;
             }
 
-            if (buffer_.size() < (read_index_ + sizeof(SizeType) + static_cast<std::size_t>(str_length)))
+            view = std::span<const T>(reinterpret_cast<const T*>(first), size);
+            read_index_ += prefix_length + (size * sizeof(T));
+            return true;
+        }
+
+        template <SizePrefixType SizeType = default_size_type>
+        bool read(std::string& value) noexcept
+        {
+            // Temporarily read string length without incrementing deserialize index. String length cannot be
+            // negative, so it's treated as an error. Zero length is well-defined for dynamic strings if they are not
+            // serialized with a given fixed length because it indicates an empty string.
+            std::size_t str_length = 0U;
+            std::size_t prefix_length = 0U;
+            if (!peek_size_prefix<SizeType>(str_length, prefix_length)
+                || (str_length > (buffer_.size() - read_index_ - prefix_length)))
             {
                 return false;
             }
 
             // Alternative approach in case of performance issues: first resize the string to the required size
             // using `value.resize(str_length)` and then copy the string data using `std::memcpy(value.data(), ...)`
-            value.assign(buffer_.as<char>() + sizeof(SizeType) + read_index_, static_cast<std::size_t>(str_length));
+            value.assign(buffer_.as<char>() + prefix_length + read_index_, str_length);
 
-            read_index_ += sizeof(SizeType) + static_cast<std::size_t>(str_length);
+            read_index_ += prefix_length + str_length;
 
             return true;
         }
@@ -779,6 +1062,164 @@ namespace bytepack
         }
 
     private:
+        template <NetworkSerializableBasic T>
+        bool write_fixed(const T& value) noexcept
+        {
+            if (buffer_.size() < (write_index_ + sizeof(T)))
+            {
+                return false;
+            }
+
+            std::memcpy(buffer_.as<std::uint8_t>() + write_index_, &value, sizeof(T));
+
+            if constexpr (BufferEndian != std::endian::native && sizeof(T) > 1)
+            {
+                // TODO: htonl/htons/ntohl/ntohs performs better for endianness conversion. However, it
+                // requires platform-specific headers. It is possible to implement hton/ntoh like functions
+                // in the library in a platform-independent way using bit shifts.
+                // Benchmark link: https://quick-bench.com/q/va-kzUk1J1BfvSgR05Z1YPnrJhg
+                std::ranges::reverse(
+                    buffer_.as<std::uint8_t>() + write_index_, buffer_.as<std::uint8_t>() + write_index_ + sizeof(T));
+            }
+
+            write_index_ += sizeof(T);
+
+            return true;
+        }
+
+        template <NetworkSerializableBasic T>
+        bool read_fixed(T& value) noexcept
+        {
+            if (buffer_.size() < (read_index_ + sizeof(T)))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, buffer_.as<std::uint8_t>() + read_index_, sizeof(T));
+
+            if constexpr (BufferEndian != std::endian::native && sizeof(T) > 1)
+            {
+                // Using reinterpret_cast to treat 'value' as an array of bytes is safe here because:
+                // The `NetworkSerializableBasic` concept ensures 'T' is a non-class, fundamental type, making
+                // it trivially copyable and ensuring a consistent, predictable memory layout across systems.
+                std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&value), // NOLINT keep original implementation
+                    reinterpret_cast<std::uint8_t*>(&value) + sizeof(T));     // NOLINT keep original implementation
+            }
+
+            read_index_ += sizeof(T);
+
+            return true;
+        }
+
+        template <VarintEncodable T>
+        bool write_varint(const T& value) noexcept
+        {
+            return write_varint_bits(detail::zigzag_encode(value));
+        }
+
+        bool write_varint_bits(const std::uint64_t bits) noexcept
+        {
+            if (buffer_.size() < (write_index_ + detail::varint_length(bits)))
+            {
+                return false;
+            }
+            write_index_ += detail::encode_varint(bits, buffer_.as<std::uint8_t>() + write_index_);
+            return true;
+        }
+
+        template <VarintEncodable T>
+        bool read_varint(T& value) noexcept
+        {
+            std::uint64_t bits = 0U;
+            const std::size_t length
+                = detail::decode_varint(buffer_.as<std::uint8_t>() + read_index_, buffer_.size() - read_index_, bits);
+            if ((length == 0U) || !detail::varint_fits<T>(bits))
+            {
+                return false;
+            }
+            value = detail::zigzag_decode<T>(bits);
+            read_index_ += length;
+            return true;
+        }
+
+        template <SizePrefixType SizeType>
+        static constexpr std::size_t size_prefix_length(const std::size_t size) noexcept
+        {
+            if constexpr (std::same_as<SizeType, varint_size>)
+            {
+                return detail::varint_length(size);
+            }
+            else
+            {
+                return sizeof(SizeType);
+            }
+        }
+
+        template <SizePrefixType SizeType>
+        bool write_size_prefix(const std::size_t size) noexcept
+        {
+            if constexpr (std::same_as<SizeType, varint_size>)
+            {
+                return write_varint_bits(size);
+            }
+            else
+            {
+                const auto size_custom = static_cast<SizeType>(size);
+                if ((std::is_signed_v<SizeType> && size_custom < 0) || static_cast<std::size_t>(size_custom) != size)
+                {
+                    // Overflow or incorrect size type
+                    return false;
+                }
+                return write_fixed(size_custom);
+            }
+        }
+
+        // Decodes the length prefix at the read index without consuming it
+        template <SizePrefixType SizeType>
+        bool peek_size_prefix(std::size_t& size, std::size_t& prefix_length) const noexcept
+        {
+            if constexpr (std::same_as<SizeType, varint_size>)
+            {
+                std::uint64_t bits = 0U;
+                prefix_length = detail::decode_varint(
+                    buffer_.as<std::uint8_t>() + read_index_, buffer_.size() - read_index_, bits);
+                if (prefix_length == 0U)
+                {
+                    return false;
+                }
+                if constexpr (sizeof(std::size_t) < sizeof(std::uint64_t))
+                {
+                    if (bits > std::numeric_limits<std::size_t>::max())
+                    {
+                        return false;
+                    }
+                }
+                size = static_cast<std::size_t>(bits);
+            }
+            else
+            {
+                if (buffer_.size() < (read_index_ + sizeof(SizeType)))
+                {
+                    return false;
+                }
+
+                SizeType size_custom {};
+                std::memcpy(&size_custom, buffer_.as<std::uint8_t>() + read_index_, sizeof(SizeType));
+                if constexpr (BufferEndian != std::endian::native && sizeof(SizeType) > 1)
+                {
+                    std::ranges::reverse(reinterpret_cast<std::uint8_t*>(&size_custom),    // NOLINT
+                        reinterpret_cast<std::uint8_t*>(&size_custom) + sizeof(SizeType)); // NOLINT
+                }
+                if (size_custom < 0)
+                {
+                    return false;
+                }
+                size = static_cast<std::size_t>(size_custom);
+                prefix_length = sizeof(SizeType);
+            }
+            return true;
+        }
+
         bytepack::buffer_view buffer_;
 
         // Flag to indicate buffer ownership
@@ -57,6 +57,7 @@
 #endif
 
 #include "cJSON.h"
+#include "cJSON_number.h"
 
 /* define our own boolean type */
 #ifdef true
@@ -312,6 +313,7 @@ static cJSON_bool parse_number(cJSON* const item, parse_buffer* const input_buff
     unsigned char number_c_string[64];
     unsigned char decimal_point = get_decimal_point();
     size_t i = 0;
+    size_t consumed = 0;
 
     if ((input_buffer == NULL) || (input_buffer->content == NULL))
     {
@@ -353,7 +355,16 @@ static cJSON_bool parse_number(cJSON* const item, parse_buffer* const input_buff
 loop_end:
     number_c_string[i] = '\0';
 
-    number = strtod((const char*)number_c_string, (char**)&after_end);
+    /* the usual short decimals are read without strtod() */
+    consumed = (decimal_point == '.') ? cJSON_fast_parse_number(number_c_string, i, &number) : 0;
+    if (consumed != 0)
+    {
+        after_end = number_c_string + consumed;
+    }
+    else
+    {
+        number = strtod((const char*)number_c_string, (char**)&after_end);
+    }
     if (number_c_string == after_end)
     {
         return false; /* parse_error */
@@ -558,7 +569,7 @@ static cJSON_bool print_number(const cJSON* const item, printbuffer* const outpu
     double d = item->valuedouble;
     int length = 0;
     size_t i = 0;
-    unsigned char number_buffer[26] = { 0 }; /* temporary buffer to print the number into */
+    unsigned char number_buffer[CJSON_NUMBER_BUFFER_SIZE] = { 0 }; /* temporary buffer to print the number into */
     unsigned char decimal_point = get_decimal_point();
     double test = 0.0;
 
@@ -574,9 +585,9 @@ static cJSON_bool print_number(const cJSON* const item, printbuffer* const outpu
     }
     else if (d == (double)item->valueint)
     {
-        length = sprintf((char*)number_buffer, "%d", item->valueint);
+        length = cJSON_fast_print_int(item->valueint, number_buffer);
     }
-    else
+    else if ((length = cJSON_fast_print_number(d, number_buffer)) < 0)
     {
         /* Try 15 decimal places of precision to avoid nonsignificant nonzero digits */
         length = sprintf((char*)number_buffer, "%1.15g", d);
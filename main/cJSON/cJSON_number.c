@@ -0,0 +1,550 @@
+/*
+  Copyright (c) 2009-2017 Dave Gamble and cJSON contributors
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* Printing: for d = m * 2^e and a precision of P digits, the digits are
+   D = round(d / 10^(k - P + 1)) with k = floor(log10(d)), i.e. the quotient
+   of N / Dn where one side carries m and 2^|e| and the other 5^|q|: both fit
+   128 bits for the magnitudes handled, so the rounding (and a tie) is
+   decided on the exact remainder. k is estimated from the binary exponent
+   and corrected once when D gets a digit too many.
+
+   Parsing and the read-back check of the 15 digits use Clinger's fast path:
+   a mantissa below 2^53 and a power of ten up to 10^22 are both exact
+   doubles, so their IEEE product or quotient is the correctly rounded
+   value. This needs double arithmetic without excess precision. */
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cJSON_number.h"
+
+/* 16 (ISO/IEC TS 18661-3, _Float16 hardware) still evaluates double as double */
+#if defined(FLT_EVAL_METHOD) && ((FLT_EVAL_METHOD == 0) || (FLT_EVAL_METHOD == 16))
+#define CJSON_FAST_NUMBER_EXACT 1
+#else
+#define CJSON_FAST_NUMBER_EXACT 0
+#endif
+
+#define CJSON_MAX_EXACT_POW10 22
+#define CJSON_MAX_POW5 27
+#define CJSON_MAX_MANTISSA_DIGITS 19
+#define CJSON_MIN_FAST_EXPONENT (-8)
+#define CJSON_MAX_FAST_EXPONENT 36
+
+typedef struct
+{
+    uint64_t hi;
+    uint64_t lo;
+} cjson_u128;
+
+static const double exact_pow10[CJSON_MAX_EXACT_POW10 + 1] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static const uint64_t pow10_u64[19] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL };
+
+static const uint64_t pow5_u64[CJSON_MAX_POW5 + 1] = { 1ULL, 5ULL, 25ULL, 125ULL, 625ULL, 3125ULL, 15625ULL,
+    78125ULL, 390625ULL, 1953125ULL, 9765625ULL, 48828125ULL, 244140625ULL, 1220703125ULL, 6103515625ULL,
+    30517578125ULL, 152587890625ULL, 762939453125ULL, 3814697265625ULL, 19073486328125ULL, 95367431640625ULL,
+    476837158203125ULL, 2384185791015625ULL, 11920928955078125ULL, 59604644775390625ULL, 298023223876953125ULL,
+    1490116119384765625ULL, 7450580596923828125ULL };
+
+static cjson_u128 u128_from(uint64_t value)
+{
+    cjson_u128 result;
+    result.hi = 0;
+    result.lo = value;
+    return result;
+}
+
+/* 64 x 64 -> 128 bits multiply from 32-bit halves, for targets without a 128-bit type */
+static cjson_u128 u128_multiply(uint64_t lhs, uint64_t rhs)
+{
+    const uint64_t lhs_lo = lhs & 0xffffffffULL;
+    const uint64_t lhs_hi = lhs >> 32;
+    const uint64_t rhs_lo = rhs & 0xffffffffULL;
+    const uint64_t rhs_hi = rhs >> 32;
+    const uint64_t low = lhs_lo * rhs_lo;
+    const uint64_t cross1 = lhs_lo * rhs_hi;
+    const uint64_t cross2 = lhs_hi * rhs_lo;
+    const uint64_t middle = (low >> 32) + (cross1 & 0xffffffffULL) + (cross2 & 0xffffffffULL);
+    cjson_u128 result;
+
+    result.lo = (middle << 32) | (low & 0xffffffffULL);
+    result.hi = (lhs_hi * rhs_hi) + (cross1 >> 32) + (cross2 >> 32) + (middle >> 32);
+    return result;
+}
+
+static int u64_bits(uint64_t value)
+{
+    int bits = 0;
+    while (value != 0)
+    {
+        ++bits;
+        value >>= 1;
+    }
+    return bits;
+}
+
+static int u128_bits(cjson_u128 value)
+{
+    return (value.hi != 0) ? (64 + u64_bits(value.hi)) : u64_bits(value.lo);
+}
+
+static cjson_u128 u128_shift_left(cjson_u128 value, int shift)
+{
+    if (shift >= 64)
+    {
+        value.hi = value.lo << (shift - 64);
+        value.lo = 0;
+    }
+    else if (shift > 0)
+    {
+        value.hi = (value.hi << shift) | (value.lo >> (64 - shift));
+        value.lo <<= shift;
+    }
+    return value;
+}
+
+static int u128_compare(cjson_u128 lhs, cjson_u128 rhs)
+{
+    if (lhs.hi != rhs.hi)
+    {
+        return (lhs.hi < rhs.hi) ? -1 : 1;
+    }
+    if (lhs.lo != rhs.lo)
+    {
+        return (lhs.lo < rhs.lo) ? -1 : 1;
+    }
+    return 0;
+}
+
+/* long division, the quotient being known to fit 64 bits */
+static uint64_t u128_divide(cjson_u128 numerator, cjson_u128 denominator, cjson_u128* remainder)
+{
+    uint64_t quotient = 0;
+    int shift = u128_bits(numerator) - u128_bits(denominator);
+
+    if ((denominator.hi == 0) && ((denominator.lo & (denominator.lo - 1)) == 0))
+    {
+        /* a power of two, for the magnitudes below 10^15: a shift */
+        shift = u64_bits(denominator.lo) - 1;
+        if (shift == 0)
+        {
+            remainder->hi = 0;
+            remainder->lo = 0;
+            return numerator.lo;
+        }
+        remainder->hi = 0;
+        remainder->lo = numerator.lo & (denominator.lo - 1);
+        return (numerator.lo >> shift) | (numerator.hi << (64 - shift));
+    }
+
+    if (shift > 0)
+    {
+        denominator = u128_shift_left(denominator, shift);
+    }
+    for (; shift >= 0; --shift)
+    {
+        quotient <<= 1;
+        if (u128_compare(numerator, denominator) >= 0)
+        {
+            numerator.hi = numerator.hi - denominator.hi - ((numerator.lo < denominator.lo) ? 1 : 0);
+            numerator.lo -= denominator.lo;
+            quotient |= 1;
+        }
+        denominator.lo = (denominator.lo >> 1) | (denominator.hi << 63);
+        denominator.hi >>= 1;
+    }
+
+    *remainder = numerator;
+    return quotient;
+}
+
+/* rounds m * 2^e to precision significant digits; returns 0, or -1 on a tie or out of range */
+static int decimal_digits(uint64_t mantissa, int exponent, int precision, int* decimal_exponent, uint64_t* digits)
+{
+    int attempt = 0;
+
+    for (attempt = 0; attempt < 2; ++attempt)
+    {
+        const int scale = precision - 1 - *decimal_exponent; /* digits = m * 2^e * 10^scale */
+        const int shift = exponent + scale;
+        cjson_u128 numerator;
+        cjson_u128 denominator;
+        cjson_u128 remainder;
+        uint64_t quotient = 0;
+        int rounding = 0;
+
+        if ((scale > CJSON_MAX_POW5) || (-scale > CJSON_MAX_POW5))
+        {
+            return -1;
+        }
+        if (scale >= 0)
+        {
+            numerator = u128_multiply(mantissa, pow5_u64[scale]);
+            denominator = u128_from(1);
+        }
+        else
+        {
+            numerator = u128_from(mantissa);
+            denominator = u128_from(pow5_u64[-scale]);
+        }
+        if (shift >= 0)
+        {
+            if ((u128_bits(numerator) + shift) > 127)
+            {
+                return -1;
+            }
+            numerator = u128_shift_left(numerator, shift);
+        }
+        else
+        {
+            if ((u128_bits(denominator) - shift) > 127)
+            {
+                return -1;
+            }
+            denominator = u128_shift_left(denominator, -shift);
+        }
+
+        if ((u128_bits(numerator) - u128_bits(denominator)) > 63)
+        {
+            return -1;
+        }
+        quotient = u128_divide(numerator, denominator, &remainder);
+        if (quotient >= pow10_u64[precision])
+        {
+            /* the estimate was one decade low */
+            ++*decimal_exponent;
+            continue;
+        }
+
+        rounding = u128_compare(u128_shift_left(remainder, 1), denominator);
+        if (rounding == 0)
+        {
+            return -1; /* the C library rounds ties by its own rule */
+        }
+        if (rounding > 0)
+        {
+            ++quotient;
+            if (quotient == pow10_u64[precision])
+            {
+                quotient = pow10_u64[precision - 1];
+                ++*decimal_exponent;
+            }
+        }
+
+        *digits = quotient;
+        return 0;
+    }
+
+    return -1;
+}
+
+/* writes the digits as "%.<precision>g" does, without trailing zeros */
+static int format_general(int negative, uint64_t digits, int decimal_exponent, int precision, unsigned char* buffer)
+{
+    char text[17];
+    int count = precision;
+    int length = 0;
+    int i = 0;
+
+    for (i = precision - 1; i >= 0; --i)
+    {
+        text[i] = (char)('0' + (int)(digits % 10));
+        digits /= 10;
+    }
+    while ((count > 1) && (text[count - 1] == '0'))
+    {
+        --count;
+    }
+
+    if (negative)
+    {
+        buffer[length++] = '-';
+    }
+
+    if ((decimal_exponent < -4) || (decimal_exponent >= precision))
+    {
+        const int magnitude = (decimal_exponent < 0) ? -decimal_exponent : decimal_exponent;
+        buffer[length++] = (unsigned char)text[0];
+        if (count > 1)
+        {
+            buffer[length++] = '.';
+            for (i = 1; i < count; ++i)
+            {
+                buffer[length++] = (unsigned char)text[i];
+            }
+        }
+        buffer[length++] = 'e';
+        buffer[length++] = (decimal_exponent < 0) ? '-' : '+';
+        if (magnitude >= 100)
+        {
+            buffer[length++] = (unsigned char)('0' + (magnitude / 100));
+        }
+        buffer[length++] = (unsigned char)('0' + ((magnitude / 10) % 10));
+        buffer[length++] = (unsigned char)('0' + (magnitude % 10));
+    }
+    else if (decimal_exponent >= 0)
+    {
+        for (i = 0; i <= decimal_exponent; ++i)
+        {
+            buffer[length++] = (unsigned char)text[i];
+        }
+        if (count > (decimal_exponent + 1))
+        {
+            buffer[length++] = '.';
+            for (i = decimal_exponent + 1; i < count; ++i)
+            {
+                buffer[length++] = (unsigned char)text[i];
+            }
+        }
+    }
+    else
+    {
+        buffer[length++] = '0';
+        buffer[length++] = '.';
+        for (i = 1; i < -decimal_exponent; ++i)
+        {
+            buffer[length++] = '0';
+        }
+        for (i = 0; i < count; ++i)
+        {
+            buffer[length++] = (unsigned char)text[i];
+        }
+    }
+
+    buffer[length] = '\0';
+    return length;
+}
+
+/* the comparison of print_number() */
+static int compare_double(double lhs, double rhs)
+{
+    const double max_value = (fabs(lhs) > fabs(rhs)) ? fabs(lhs) : fabs(rhs);
+    return (fabs(lhs - rhs) <= (max_value * DBL_EPSILON));
+}
+
+int cJSON_fast_print_number(double number, unsigned char* buffer)
+{
+#if CJSON_FAST_NUMBER_EXACT
+    uint64_t bits = 0;
+    uint64_t mantissa = 0;
+    uint64_t digits = 0;
+    int biased_exponent = 0;
+    int binary_exponent = 0;
+    int decimal_exponent = 0;
+    int estimate = 0;
+    long scaled = 0;
+    double test = 0.0;
+
+    memcpy(&bits, &number, sizeof(bits));
+    biased_exponent = (int)((bits >> 52) & 0x7ff);
+    if ((biased_exponent == 0) || (biased_exponent == 0x7ff))
+    {
+        return -1; /* zero, subnormal, infinity or NaN */
+    }
+    mantissa = (bits & ((1ULL << 52) - 1)) | (1ULL << 52);
+    binary_exponent = biased_exponent - 1075;
+
+    /* floor((biased_exponent - 1023) * log10(2)), one decade low at most */
+    scaled = (long)(biased_exponent - 1023) * 78913L;
+    estimate = (int)((scaled >= 0) ? (scaled / 262144L) : -((-scaled + 262143L) / 262144L));
+    if ((estimate < (CJSON_MIN_FAST_EXPONENT - 1)) || (estimate > CJSON_MAX_FAST_EXPONENT))
+    {
+        return -1;
+    }
+
+    /* try 15 digits of precision to avoid nonsignificant nonzero digits */
+    decimal_exponent = estimate;
+    if ((decimal_digits(mantissa, binary_exponent, 15, &decimal_exponent, &digits) != 0)
+        || (decimal_exponent < CJSON_MIN_FAST_EXPONENT) || (decimal_exponent > CJSON_MAX_FAST_EXPONENT))
+    {
+        return -1;
+    }
+
+    /* read them back as sscanf() would: digits < 10^15 < 2^53 and |decimal_exponent - 14| <= 22 */
+    test = (decimal_exponent >= 14) ? ((double)digits * exact_pow10[decimal_exponent - 14])
+                                    : ((double)digits / exact_pow10[14 - decimal_exponent]);
+    if (compare_double(test, fabs(number)))
+    {
+        return format_general((int)(bits >> 63), digits, decimal_exponent, 15, buffer);
+    }
+
+    /* otherwise print with 17 digits of precision */
+    decimal_exponent = estimate;
+    if (decimal_digits(mantissa, binary_exponent, 17, &decimal_exponent, &digits) != 0)
+    {
+        return -1;
+    }
+    return format_general((int)(bits >> 63), digits, decimal_exponent, 17, buffer);
+#else
+    (void)number;
+    (void)buffer;
+    return -1;
+#endif
+}
+
+int cJSON_fast_print_int(int number, unsigned char* buffer)
+{
+    char text[12];
+    unsigned int magnitude = (number < 0) ? (0U - (unsigned int)number) : (unsigned int)number;
+    int count = 0;
+    int length = 0;
+
+    do
+    {
+        text[count++] = (char)('0' + (int)(magnitude % 10U));
+        magnitude /= 10U;
+    } while (magnitude != 0U);
+
+    if (number < 0)
+    {
+        buffer[length++] = '-';
+    }
+    while (count > 0)
+    {
+        buffer[length++] = (unsigned char)text[--count];
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t cJSON_fast_parse_number(const unsigned char* text, size_t length, double* number)
+{
+#if CJSON_FAST_NUMBER_EXACT
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    int negative = 0;
+    int has_digits = 0;
+    size_t position = 0;
+    double value = 0.0;
+
+    if ((position < length) && ((text[position] == '-') || (text[position] == '+')))
+    {
+        negative = (text[position] == '-');
+        ++position;
+    }
+
+    for (; (position < length) && (text[position] >= '0') && (text[position] <= '9'); ++position)
+    {
+        has_digits = 1;
+        if ((mantissa != 0) || (text[position] != '0'))
+        {
+            if (significant_digits == CJSON_MAX_MANTISSA_DIGITS)
+            {
+                return 0;
+            }
+            mantissa = (mantissa * 10) + (uint64_t)(text[position] - '0');
+            ++significant_digits;
+        }
+    }
+
+    if ((position < length) && (text[position] == '.'))
+    {
+        for (++position; (position < length) && (text[position] >= '0') && (text[position] <= '9'); ++position)
+        {
+            has_digits = 1;
+            if ((mantissa != 0) || (text[position] != '0'))
+            {
+                if (significant_digits == CJSON_MAX_MANTISSA_DIGITS)
+                {
+                    return 0;
+                }
+                mantissa = (mantissa * 10) + (uint64_t)(text[position] - '0');
+                ++significant_digits;
+            }
+            --exponent;
+        }
+    }
+
+    if (!has_digits)
+    {
+        return 0;
+    }
+
+    /* an exponent is only taken with at least one digit, as strtod() does */
+    if ((position < length) && ((text[position] == 'e') || (text[position] == 'E')))
+    {
+        size_t exponent_position = position + 1;
+        int exponent_negative = 0;
+        int exponent_value = 0;
+
+        if ((exponent_position < length) && ((text[exponent_position] == '-') || (text[exponent_position] == '+')))
+        {
+            exponent_negative = (text[exponent_position] == '-');
+            ++exponent_position;
+        }
+        if ((exponent_position < length) && (text[exponent_position] >= '0') && (text[exponent_position] <= '9'))
+        {
+            for (; (exponent_position < length) && (text[exponent_position] >= '0') && (text[exponent_position] <= '9');
+                 ++exponent_position)
+            {
+                if (exponent_value < 10000)
+                {
+                    exponent_value = (exponent_value * 10) + (text[exponent_position] - '0');
+                }
+            }
+            exponent += exponent_negative ? -exponent_value : exponent_value;
+            position = exponent_position;
+        }
+    }
+
+    if (mantissa == 0)
+    {
+        value = 0.0;
+    }
+    else if (mantissa > (1ULL << 53))
+    {
+        return 0;
+    }
+    else if ((exponent >= -CJSON_MAX_EXACT_POW10) && (exponent <= CJSON_MAX_EXACT_POW10))
+    {
+        value = (exponent < 0) ? ((double)mantissa / exact_pow10[-exponent])
+                               : ((double)mantissa * exact_pow10[exponent]);
+    }
+    else if ((exponent > CJSON_MAX_EXACT_POW10) && (exponent <= (CJSON_MAX_EXACT_POW10 + 15))
+        && (mantissa <= ((1ULL << 53) / pow10_u64[exponent - CJSON_MAX_EXACT_POW10])))
+    {
+        /* 1.5e30: the extra zeros still leave an exact mantissa */
+        mantissa *= pow10_u64[exponent - CJSON_MAX_EXACT_POW10];
+        value = (double)mantissa * exact_pow10[CJSON_MAX_EXACT_POW10];
+    }
+    else
+    {
+        return 0;
+    }
+
+    *number = negative ? -value : value;
+    return position;
+#else
+    (void)text;
+    (void)length;
+    (void)number;
+    return 0;
+#endif
+}
@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2009-2017 Dave Gamble and cJSON contributors
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* Fast number conversions of the cJSON print and parse paths.
+
+   Both functions handle the common cases without the C library and report
+   the others, so that the caller falls back to sprintf()/strtod() and the
+   result is always the one of the original code:
+   - cJSON_fast_print_number() renders "%1.15g", or "%1.17g" when the 15
+     digits do not read back within DBL_EPSILON, like print_number() does.
+     The digits are computed exactly with 128-bit integer arithmetic for
+     magnitudes in [1e-8, 1e37), and read back with the exact Clinger fast
+     path instead of sscanf(); exact ties are left to sprintf().
+   - cJSON_fast_parse_number() reads decimal numbers of at most 19
+     significant digits whose value is an exactly rounded product or
+     quotient of two doubles (Clinger's fast path, as in fast_float).
+
+   Neither takes the locale into account: the decimal point is always '.'. */
+
+#ifndef cJSON_number__h
+#define cJSON_number__h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Size of the buffer given to cJSON_fast_print_number() and cJSON_fast_print_int(). */
+#define CJSON_NUMBER_BUFFER_SIZE 26
+
+/* Renders a finite double as print_number() does; returns the length, or -1 to fall back to sprintf(). */
+int cJSON_fast_print_number(double number, unsigned char* buffer);
+
+/* Renders an int as "%d"; returns the length. */
+int cJSON_fast_print_int(int number, unsigned char* buffer);
+
+/* Reads the number at the start of text[0, length) as strtod() does; returns the number of characters read,
+   or 0 to fall back to strtod(). */
+size_t cJSON_fast_parse_number(const unsigned char* text, size_t length, double* number);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
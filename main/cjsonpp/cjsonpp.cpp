@@ -14,9 +14,11 @@
  */
 
 #include <array>
+#include <climits>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <set>
 #include <string>
 #include <utility>
@@ -27,6 +29,7 @@
 
 #include "cJSON/cJSON.h"
 #include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_arena.hpp"
 
 // modified for clang-tidy checks
 
@@ -83,12 +86,31 @@ namespace cjsonpp
 
     std::string JSONObject::print(bool formatted) const
     {
+        // the growing print buffer is temporary, keep it out of any arena
+        const json_arena_scope heap_only(nullptr);
         char* json = formatted ? cJSON_Print(obj_->o) : cJSON_PrintUnformatted(obj_->o);
         std::string retval(json);
-        std::free(json); // NOLINT allocated from C with malloc
+        cJSON_free(json); // allocated through the cJSON hooks
         return retval;
     }
 
+    cjsonpp_result<std::size_t> JSONObject::print(char* buffer, std::size_t size, bool formatted) const
+    {
+        if ((nullptr == buffer) || (0U == size) || (size > static_cast<std::size_t>(INT_MAX)))
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, 0, "Invalid print buffer") };
+        }
+
+        if (0 == cJSON_PrintPreallocated(obj_->o, buffer, static_cast<int>(size), formatted ? 1 : 0))
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, static_cast<int>(size), "Print buffer too small") };
+        }
+
+        return std::strlen(buffer);
+    }
+
     // necessary for holding references in the set
     bool JSONObject::operator<(const JSONObject& other) const
     {
@@ -306,6 +328,19 @@ namespace cjsonpp
         return parse_result(str.c_str());
     }
 
+    // parse from C string into an arena without throwing
+    cjsonpp_result<JSONObject> parse_result(const char* str, json_arena& arena)
+    {
+        const json_arena_scope scope(arena);
+        return parse_result(str);
+    }
+
+    // parse from std::string into an arena without throwing
+    cjsonpp_result<JSONObject> parse_result(const std::string& str, json_arena& arena)
+    {
+        return parse_result(str.c_str(), arena);
+    }
+
     // create null object
     JSONObject nullObject()
     {
@@ -18,6 +18,7 @@
 #ifndef CJSONPP_H
 #define CJSONPP_H
 
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -138,6 +139,18 @@ namespace cjsonpp
             return print(true);
         }
 
+        /**
+         * @brief Prints the JSON object into a caller buffer, without any allocation.
+         *
+         * cJSON may underestimate the space it needs by a few bytes: keep a small margin.
+         *
+         * @param buffer Destination, receives a NUL-terminated string.
+         * @param size Size of the destination in bytes.
+         * @param formatted If true, the JSON string will be formatted with indentation.
+         * @return Length of the printed string, or invalid_argument if the buffer is too small.
+         */
+        [[nodiscard]] cjsonpp_result<std::size_t> print(char* buffer, std::size_t size, bool formatted) const;
+
         /**
          * @brief Necessary for holding references in the set.
          *
@@ -467,6 +480,22 @@ namespace cjsonpp
      */
     cjsonpp_result<JSONObject> parse_result(const std::string& str);
 
+    class json_arena;
+
+    /**
+     * @brief Parses a JSON string with every node and string allocated from an arena (see json_arena.hpp).
+     *
+     * The returned object must be destroyed before the arena is reset or destroyed.
+     */
+    cjsonpp_result<JSONObject> parse_result(const char* str, json_arena& arena);
+
+    /**
+     * @brief Parses a JSON string with every node and string allocated from an arena (see json_arena.hpp).
+     *
+     * The returned object must be destroyed before the arena is reset or destroyed.
+     */
+    cjsonpp_result<JSONObject> parse_result(const std::string& str, json_arena& arena);
+
     /**
      * @brief create null object
      *
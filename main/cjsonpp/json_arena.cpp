@@ -0,0 +1,189 @@
+/**
+ * @file json_arena.cpp
+ * @brief Bump arena serving the cJSON allocations of whole documents.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+#include "cJSON/cJSON.h"
+#include "cjsonpp/json_arena.hpp"
+#include "tools/critical_section.hpp"
+
+namespace cjsonpp
+{
+    namespace
+    {
+        constexpr std::size_t block_alignment = alignof(std::max_align_t);
+
+        thread_local json_arena* t_current_arena = nullptr; // NOLINT per-thread routing is the purpose
+
+        /**
+         * @brief Live arenas, searched when a block is freed outside the scope that allocated it.
+         */
+        struct arena_registry
+        {
+            tools::critical_section mutex;
+            json_arena* head = nullptr;
+            std::atomic<std::size_t> count { 0U };
+        };
+
+        arena_registry& registry()
+        {
+            static arena_registry instance;
+            return instance;
+        }
+    } // namespace
+
+    json_arena::json_arena(std::size_t capacity)
+        : m_owned(std::make_unique<unsigned char[]>(capacity)) // NOLINT owned raw buffer
+        , m_buffer(m_owned.get())
+        , m_size(capacity)
+    {
+        enroll();
+    }
+
+    json_arena::json_arena(void* buffer, std::size_t size)
+        : m_buffer(static_cast<unsigned char*>(buffer))
+        , m_size((nullptr == buffer) ? 0U : size)
+    {
+        enroll();
+    }
+
+    json_arena::~json_arena()
+    {
+        auto& arenas = registry();
+        std::scoped_lock<tools::critical_section> guard(arenas.mutex);
+        for (json_arena** link = &arenas.head; nullptr != *link; link = &(*link)->m_next)
+        {
+            if (this == *link)
+            {
+                *link = m_next;
+                arenas.count.fetch_sub(1U, std::memory_order_release);
+                break;
+            }
+        }
+    }
+
+    void json_arena::enroll()
+    {
+        static const bool installed = []()
+        {
+            cJSON_Hooks hooks { &json_arena::hook_allocate, &json_arena::hook_free };
+            cJSON_InitHooks(&hooks);
+            return true;
+        }();
+        static_cast<void>(installed);
+
+        auto& arenas = registry();
+        std::scoped_lock<tools::critical_section> guard(arenas.mutex);
+        m_next = arenas.head;
+        arenas.head = this;
+        arenas.count.fetch_add(1U, std::memory_order_release);
+    }
+
+    bool json_arena::reset()
+    {
+        if (0U != m_live.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        m_used = 0U;
+        return true;
+    }
+
+    bool json_arena::owns(const void* ptr) const noexcept
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        const auto first = reinterpret_cast<std::uintptr_t>(m_buffer);
+        return (address >= first) && (address < (first + m_size));
+    }
+
+    void* json_arena::allocate(std::size_t size) noexcept
+    {
+        const auto base = reinterpret_cast<std::uintptr_t>(m_buffer);
+        const std::uintptr_t aligned = (base + m_used + block_alignment - 1U) & ~(block_alignment - 1U);
+        const std::size_t start = static_cast<std::size_t>(aligned - base);
+        if ((0U == size) || (start > m_size) || (size > (m_size - start)))
+        {
+            return nullptr;
+        }
+
+        m_used = start + size;
+        m_high_water = (m_used > m_high_water) ? m_used : m_high_water;
+        m_live.fetch_add(1U, std::memory_order_relaxed);
+        return m_buffer + start; // NOLINT pointer arithmetic
+    }
+
+    void* json_arena::hook_allocate(std::size_t size)
+    {
+        json_arena* arena = t_current_arena;
+        if (nullptr != arena)
+        {
+            void* block = arena->allocate(size);
+            if (nullptr != block)
+            {
+                return block;
+            }
+            ++arena->m_fallbacks;
+        }
+        return std::malloc(size); // NOLINT cJSON blocks are released through hook_free
+    }
+
+    void json_arena::hook_free(void* ptr)
+    {
+        if (nullptr == ptr)
+        {
+            return;
+        }
+
+        json_arena* arena = t_current_arena;
+        if ((nullptr != arena) && arena->owns(ptr))
+        {
+            arena->m_live.fetch_sub(1U, std::memory_order_release);
+            return;
+        }
+
+        auto& arenas = registry();
+        if (0U != arenas.count.load(std::memory_order_acquire))
+        {
+            std::scoped_lock<tools::critical_section> guard(arenas.mutex);
+            for (json_arena* owner = arenas.head; nullptr != owner; owner = owner->m_next)
+            {
+                if (owner->owns(ptr))
+                {
+                    owner->m_live.fetch_sub(1U, std::memory_order_release);
+                    return;
+                }
+            }
+        }
+
+        std::free(ptr); // NOLINT allocated by hook_allocate with malloc
+    }
+
+    json_arena* json_arena::current() noexcept
+    {
+        return t_current_arena;
+    }
+
+    void json_arena::set_current(json_arena* arena) noexcept
+    {
+        t_current_arena = arena;
+    }
+
+    json_arena_scope::json_arena_scope(json_arena* arena) noexcept
+        : m_previous(json_arena::current())
+    {
+        json_arena::set_current(arena);
+    }
+
+    json_arena_scope::~json_arena_scope()
+    {
+        json_arena::set_current(m_previous);
+    }
+
+} // namespace cjsonpp
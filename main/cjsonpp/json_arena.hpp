@@ -0,0 +1,181 @@
+/**
+ * @file json_arena.hpp
+ * @brief Bump arena serving the cJSON allocations of whole documents.
+ *
+ * cJSON allocates every node and every string separately. While a json_arena_scope is active on a thread, the
+ * cJSON allocation hooks carve those blocks out of one json_arena instead; freeing them is a no-op and the
+ * arena is rewound in one reset() once its documents are gone.
+ */
+
+#pragma once
+
+#ifndef CJSONPP_JSON_ARENA_HPP_
+#define CJSONPP_JSON_ARENA_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace cjsonpp
+{
+
+    /**
+     * @brief Fixed-size bump arena for cJSON documents.
+     *
+     * The arena owns its buffer, or uses one provided by the caller. Constructing the first arena installs
+     * cJSON allocation hooks for the rest of the program: outside a json_arena_scope they forward to
+     * malloc/free, so documents built without an arena are unaffected. Requests the arena cannot satisfy
+     * fall back to the heap and are counted.
+     *
+     * Every document allocated from an arena must be destroyed before the arena is reset or destroyed.
+     */
+    class json_arena
+    {
+    public:
+        /**
+         * @brief Creates an arena owning a heap buffer of the given size.
+         * @param capacity Buffer size in bytes.
+         */
+        explicit json_arena(std::size_t capacity);
+
+        /**
+         * @brief Creates an arena over a caller-provided buffer.
+         * @param buffer Storage outliving the arena.
+         * @param size Storage size in bytes.
+         */
+        json_arena(void* buffer, std::size_t size);
+
+        json_arena(const json_arena&) = delete;
+        json_arena& operator=(const json_arena&) = delete;
+        json_arena(json_arena&&) = delete;
+        json_arena& operator=(json_arena&&) = delete;
+
+        /**
+         * @brief Unregisters the arena from the cJSON hooks.
+         */
+        ~json_arena();
+
+        /**
+         * @brief Rewinds the arena to empty.
+         * @return true on success, false (arena untouched) while blocks from it are still in use.
+         */
+        bool reset();
+
+        /**
+         * @brief Tells whether a pointer lies inside the arena buffer.
+         * @param ptr Pointer to test.
+         * @return true when ptr was (or could have been) handed out by this arena.
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept;
+
+        /**
+         * @brief Returns the buffer size.
+         * @return Capacity in bytes.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the bytes consumed since the last reset, including alignment padding.
+         * @return Used bytes.
+         */
+        [[nodiscard]] std::size_t used() const noexcept
+        {
+            return m_used;
+        }
+
+        /**
+         * @brief Returns the largest used() value observed.
+         * @return High-water mark in bytes.
+         */
+        [[nodiscard]] std::size_t high_water() const noexcept
+        {
+            return m_high_water;
+        }
+
+        /**
+         * @brief Returns the number of blocks handed out and not yet freed.
+         * @return Live block count.
+         */
+        [[nodiscard]] std::size_t live_blocks() const noexcept
+        {
+            return m_live.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns how many requests made in a scope of this arena were served by the heap.
+         * @return Heap fallback count.
+         */
+        [[nodiscard]] std::size_t fallback_count() const noexcept
+        {
+            return m_fallbacks;
+        }
+
+        /**
+         * @brief Returns the arena serving cJSON allocations on the calling thread.
+         * @return Current arena, or nullptr outside any json_arena_scope.
+         */
+        [[nodiscard]] static json_arena* current() noexcept;
+
+    private:
+        friend class json_arena_scope;
+
+        void* allocate(std::size_t size) noexcept;
+        static void* hook_allocate(std::size_t size);
+        static void hook_free(void* ptr);
+        static void set_current(json_arena* arena) noexcept;
+        void enroll();
+
+        std::unique_ptr<unsigned char[]> m_owned; // NOLINT owned raw buffer
+        unsigned char* m_buffer = nullptr;
+        std::size_t m_size = 0U;
+        std::size_t m_used = 0U;
+        std::size_t m_high_water = 0U;
+        std::size_t m_fallbacks = 0U;
+        std::atomic<std::size_t> m_live { 0U };
+        json_arena* m_next = nullptr;
+    };
+
+    /**
+     * @brief Routes the cJSON allocations of the calling thread to an arena for the lifetime of the scope.
+     *
+     * Scopes nest; the destructor restores the previous arena. A scope over nullptr suspends arena
+     * allocation, for instance around temporary buffers.
+     */
+    class json_arena_scope
+    {
+    public:
+        /**
+         * @brief Makes arena the current arena of the calling thread.
+         * @param arena Arena to allocate from, or nullptr for the heap.
+         */
+        explicit json_arena_scope(json_arena* arena) noexcept;
+
+        /**
+         * @brief Makes arena the current arena of the calling thread.
+         * @param arena Arena to allocate from.
+         */
+        explicit json_arena_scope(json_arena& arena) noexcept
+            : json_arena_scope(&arena)
+        {
+        }
+
+        json_arena_scope(const json_arena_scope&) = delete;
+        json_arena_scope& operator=(const json_arena_scope&) = delete;
+        json_arena_scope(json_arena_scope&&) = delete;
+        json_arena_scope& operator=(json_arena_scope&&) = delete;
+
+        /**
+         * @brief Restores the arena that was current before the scope.
+         */
+        ~json_arena_scope();
+
+    private:
+        json_arena* m_previous;
+    };
+
+} // namespace cjsonpp
+
+#endif // CJSONPP_JSON_ARENA_HPP_
@@ -0,0 +1,452 @@
+/**
+ * @file json_binding.hpp
+ * @brief Declarative binding between a JSON object and the fields of a struct.
+ *
+ * get<T>(name) scans the siblings of an object once per field. A json_binding reads every bound field in a
+ * single pass over the children instead: each child key is hashed once and matched against hashes computed
+ * when the binding was declared, and the matching value is written straight into the struct member.
+ */
+
+#pragma once
+
+#ifndef CJSONPP_JSON_BINDING_HPP_
+#define CJSONPP_JSON_BINDING_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "cJSON/cJSON.h"
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/cjsonpp_result.hpp"
+
+namespace cjsonpp
+{
+
+    /**
+     * @brief FNV-1a hash of an object key, usable at compile time.
+     * @param key Key text.
+     * @return 32-bit hash.
+     */
+    constexpr std::uint32_t json_key_hash(std::string_view key) noexcept
+    {
+        constexpr std::uint32_t fnv_offset = 2166136261U;
+        constexpr std::uint32_t fnv_prime = 16777619U;
+
+        std::uint32_t hash = fnv_offset;
+        for (const char character : key)
+        {
+            hash = (hash ^ static_cast<std::uint8_t>(character)) * fnv_prime;
+        }
+        return hash;
+    }
+
+    /** @brief Marks a member converted as a scalar (bool, arithmetic or std::string). */
+    struct json_scalar_member
+    {
+    };
+
+    /**
+     * @brief One bound member: its key, the precomputed key hash and the member pointer.
+     * @tparam T Struct type.
+     * @tparam M Member type.
+     * @tparam Nested json_binding of M for a nested object, json_scalar_member otherwise.
+     */
+    template <typename T, typename M, typename Nested = json_scalar_member>
+    struct json_member_binding
+    {
+        using owner_type = T;
+        using member_type = M;
+        using nested_type = Nested;
+
+        /** @brief Object key, matched case-sensitively. */
+        std::string_view key;
+        /** @brief json_key_hash(key). */
+        std::uint32_t hash = 0U;
+        /** @brief Bound member. */
+        M T::*member = nullptr;
+        /** @brief Whether read() fails with missing_item when the key is absent. */
+        bool required = true;
+        /** @brief Binding of the nested object, if any. */
+        Nested nested {};
+    };
+
+    /**
+     * @brief Binds a scalar member (bool, arithmetic or std::string) to an object key.
+     * @param key Object key.
+     * @param member Member pointer.
+     * @param required false to leave the member untouched when the key is absent.
+     * @return The member binding.
+     */
+    template <typename T, typename M>
+    constexpr json_member_binding<T, M> json_member(std::string_view key, M T::*member, bool required = true)
+    {
+        static_assert(std::is_arithmetic_v<M> || std::is_same_v<M, std::string>,
+            "scalar members must be bool, arithmetic or std::string, use json_object_member for nested objects");
+        return json_member_binding<T, M> { key, json_key_hash(key), member, required, json_scalar_member {} };
+    }
+
+    /**
+     * @brief Binds a nested struct member to an object key through its own binding.
+     * @param key Object key.
+     * @param member Member pointer.
+     * @param nested json_binding of the member type.
+     * @param required false to leave the member untouched when the key is absent.
+     * @return The member binding.
+     */
+    template <typename T, typename M, typename Nested>
+    constexpr json_member_binding<T, M, Nested> json_object_member(
+        std::string_view key, M T::*member, const Nested& nested, bool required = true)
+    {
+        static_assert(std::is_same_v<typename Nested::value_type, M>, "nested binding must describe the member type");
+        return json_member_binding<T, M, Nested> { key, json_key_hash(key), member, required, nested };
+    }
+
+    /**
+     * @brief Reads and writes the bound members of T from and to a JSON object.
+     *
+     * Declare bindings as constexpr values (see make_json_binding()); static_assert(binding.has_distinct_keys())
+     * catches a key bound twice. Keys are matched case-sensitively; the first occurrence of a key wins.
+     *
+     * @tparam T Struct type.
+     * @tparam Members json_member_binding instantiations, at most 64.
+     */
+    template <typename T, typename... Members>
+    class json_binding
+    {
+        static_assert(sizeof...(Members) <= 64U, "a binding tracks its found members in a 64-bit mask");
+        static_assert((std::is_same_v<typename Members::owner_type, T> && ...), "every member must belong to T");
+
+        static constexpr int byte_mask = 0xff;
+        static constexpr std::uint64_t all_members
+            = (64U == sizeof...(Members)) ? ~std::uint64_t { 0U } : ((std::uint64_t { 1U } << sizeof...(Members)) - 1U);
+
+    public:
+        using value_type = T;
+
+        /** @brief Number of bound members. */
+        static constexpr std::size_t field_count = sizeof...(Members);
+
+        /**
+         * @brief Constructs a binding from member bindings.
+         * @param members Member bindings.
+         */
+        constexpr explicit json_binding(Members... members)
+            : m_members(members...)
+        {
+        }
+
+        /**
+         * @brief Tells whether every key of the binding is distinct.
+         * @return true when no key is bound twice.
+         */
+        [[nodiscard]] constexpr bool has_distinct_keys() const
+        {
+            const std::array<std::string_view, field_count> keys = std::apply(
+                [](const auto&... member) { return std::array<std::string_view, field_count> { member.key... }; },
+                m_members);
+
+            for (std::size_t first = 0U; first < field_count; ++first)
+            {
+                for (std::size_t second = first + 1U; second < field_count; ++second)
+                {
+                    if (keys[first] == keys[second]) // NOLINT bounded indices
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Reads the bound members in one pass over the children of an object.
+         * @param object cJSON object node.
+         * @param out Destination; members whose key is absent keep their value.
+         * @return Success, invalid_type (detail: member index, or -1 if object is not an object) or
+         *         missing_item (detail: index of the first absent required member).
+         */
+        cjsonpp_status read(const cJSON* object, T& out) const
+        {
+            if ((nullptr == object) || ((object->type & byte_mask) != cJSON_Object))
+            {
+                return tools::unexpected<result_error> { make_error(result_code::invalid_type, -1, "Not an object") };
+            }
+
+            std::uint64_t found = 0U;
+            for (const cJSON* item = object->child; nullptr != item; item = item->next)
+            {
+                if (nullptr == item->string)
+                {
+                    continue;
+                }
+
+                const std::string_view key(item->string);
+                const std::uint32_t hash = json_key_hash(key);
+                cjsonpp_status status = read_item(item, key, hash, out, found, std::index_sequence_for<Members...> {});
+                if (!status)
+                {
+                    return status;
+                }
+                if (all_members == found)
+                {
+                    break;
+                }
+            }
+
+            const std::uint64_t missing = required_mask() & ~found;
+            if (0U != missing)
+            {
+                int index = 0;
+                while (0U == ((missing >> static_cast<unsigned>(index)) & 1U))
+                {
+                    ++index;
+                }
+                return tools::unexpected<result_error> { make_error(
+                    result_code::missing_item, index, "Missing bound member") };
+            }
+
+            return cjsonpp_status {};
+        }
+
+        /**
+         * @brief Reads the bound members in one pass over the children of an object.
+         * @param object JSON object.
+         * @param out Destination; members whose key is absent keep their value.
+         * @return See read(const cJSON*, T&).
+         */
+        cjsonpp_status read(const JSONObject& object, T& out) const
+        {
+            return read(object.obj(), out);
+        }
+
+        /**
+         * @brief Builds a JSON object holding every bound member.
+         * @param in Source struct.
+         * @return The object, or the first set() error.
+         */
+        cjsonpp_result<JSONObject> write(const T& in) const
+        {
+            JSONObject object;
+            cjsonpp_status status = std::apply(
+                [this, &object, &in](const auto&... member)
+                {
+                    cjsonpp_status result {};
+                    static_cast<void>(((result = write_member(object, member, in)) && ...));
+                    return result;
+                },
+                m_members);
+
+            if (!status)
+            {
+                return tools::unexpected<result_error> { status.error() };
+            }
+            return object;
+        }
+
+        /**
+         * @brief Calls visitor(member, index) on every member binding, in declaration order.
+         * @param visitor Callable taking a json_member_binding and its index.
+         */
+        template <typename Visitor>
+        constexpr void for_each_member(Visitor&& visitor) const
+        {
+            for_each_member(visitor, std::index_sequence_for<Members...> {});
+        }
+
+        /**
+         * @brief Calls visitor(member, index) on the member bound to a key.
+         * @param key Object key.
+         * @param visitor Callable taking a json_member_binding and its index.
+         * @return true when a member is bound to key.
+         */
+        template <typename Visitor>
+        bool visit_member(std::string_view key, Visitor&& visitor) const
+        {
+            return visit_member(key, json_key_hash(key), visitor, std::index_sequence_for<Members...> {});
+        }
+
+        /**
+         * @brief Mask of the required members, bit i standing for member i.
+         * @return The mask.
+         */
+        [[nodiscard]] constexpr std::uint64_t required_mask() const
+        {
+            return std::apply(
+                [](const auto&... member)
+                {
+                    std::uint64_t mask = 0U;
+                    std::uint64_t bit = 1U;
+                    static_cast<void>(((mask |= (member.required ? bit : 0U), bit <<= 1U), ...));
+                    return mask;
+                },
+                m_members);
+        }
+
+    private:
+        template <typename Visitor, std::size_t... Index>
+        constexpr void for_each_member(Visitor& visitor, std::index_sequence<Index...> /*unused*/) const
+        {
+            (visitor(std::get<Index>(m_members), Index), ...);
+        }
+
+        template <typename Visitor, std::size_t... Index>
+        bool visit_member(
+            std::string_view key, std::uint32_t hash, Visitor& visitor, std::index_sequence<Index...> /*unused*/) const
+        {
+            const auto visit = [&key, hash, &visitor](const auto& member, std::size_t index)
+            {
+                if ((member.hash != hash) || (member.key != key))
+                {
+                    return false;
+                }
+                visitor(member, index);
+                return true;
+            };
+            return (visit(std::get<Index>(m_members), Index) || ...);
+        }
+
+        template <std::size_t... Index>
+        cjsonpp_status read_item(const cJSON* item, std::string_view key, std::uint32_t hash, T& out,
+            std::uint64_t& found, std::index_sequence<Index...> /*unused*/) const
+        {
+            cjsonpp_status status {};
+            static_cast<void>((try_member<Index>(item, key, hash, out, found, status) || ...));
+            return status;
+        }
+
+        template <std::size_t Index>
+        bool try_member(const cJSON* item, std::string_view key, std::uint32_t hash, T& out, std::uint64_t& found,
+            cjsonpp_status& status) const
+        {
+            const auto& member = std::get<Index>(m_members);
+            constexpr std::uint64_t bit = std::uint64_t { 1U } << Index;
+            if ((member.hash != hash) || (member.key != key) || (0U != (found & bit)))
+            {
+                return false;
+            }
+
+            found |= bit;
+            status = read_value(item, out.*(member.member), member.nested, static_cast<int>(Index));
+            return true;
+        }
+
+        template <typename M, typename Nested>
+        static cjsonpp_status read_value(const cJSON* item, M& value, const Nested& nested, int index)
+        {
+            const int type = item->type & byte_mask;
+            if constexpr (!std::is_same_v<Nested, json_scalar_member>)
+            {
+                auto status = nested.read(item, value);
+                if (!status && (result_code::invalid_type == status.error().code) && (-1 == status.error().detail))
+                {
+                    return tools::unexpected<result_error> { make_error(
+                        result_code::invalid_type, index, "Bad value type for bound member") };
+                }
+                return status;
+            }
+            else if constexpr (std::is_same_v<M, bool>)
+            {
+                if ((cJSON_True == type) || (cJSON_False == type))
+                {
+                    value = (cJSON_True == type);
+                    return cjsonpp_status {};
+                }
+            }
+            else if constexpr (std::is_same_v<M, std::string>)
+            {
+                if ((cJSON_String == type) && (nullptr != item->valuestring))
+                {
+                    value.assign(item->valuestring);
+                    return cjsonpp_status {};
+                }
+            }
+            else if constexpr (std::is_integral_v<M>)
+            {
+                // integral members only take integral numbers within their range
+                const double number = item->valuedouble;
+                if ((cJSON_Number == type) && (std::trunc(number) == number)
+                    && (number >= static_cast<double>(std::numeric_limits<M>::lowest()))
+                    && (number < (static_cast<double>(std::numeric_limits<M>::max()) + 1.0)))
+                {
+                    value = static_cast<M>(number);
+                    return cjsonpp_status {};
+                }
+            }
+            else
+            {
+                if (cJSON_Number == type)
+                {
+                    value = static_cast<M>(item->valuedouble);
+                    return cjsonpp_status {};
+                }
+            }
+
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_type, index, "Bad value type for bound member") };
+        }
+
+        template <typename Member>
+        static cjsonpp_status write_member(JSONObject& object, const Member& member, const T& in)
+        {
+            using member_type = typename Member::member_type;
+            const std::string key(member.key);
+            const member_type& value = in.*(member.member);
+
+            if constexpr (!std::is_same_v<typename Member::nested_type, json_scalar_member>)
+            {
+                auto nested = member.nested.write(value);
+                if (!nested)
+                {
+                    return tools::unexpected<result_error> { nested.error() };
+                }
+                return object.set(key, nested.value());
+            }
+            else if constexpr (std::is_same_v<member_type, bool> || std::is_same_v<member_type, std::string>)
+            {
+                return object.set(key, value);
+            }
+            else if constexpr (std::is_integral_v<member_type>)
+            {
+                return object.set(key, static_cast<std::int64_t>(value));
+            }
+            else
+            {
+                return object.set(key, static_cast<double>(value));
+            }
+        }
+
+        std::tuple<Members...> m_members;
+    };
+
+    /**
+     * @brief Builds a binding for T from member bindings.
+     *
+     * @code
+     * struct reading { std::string sensor; double value = 0.0; bool valid = false; };
+     * constexpr auto reading_binding = cjsonpp::make_json_binding<reading>(
+     *     cjsonpp::json_member("sensor", &reading::sensor), cjsonpp::json_member("value", &reading::value),
+     *     cjsonpp::json_member("valid", &reading::valid, false));
+     * static_assert(reading_binding.has_distinct_keys());
+     * @endcode
+     *
+     * @tparam T Struct type.
+     * @param members Member bindings.
+     * @return The binding.
+     */
+    template <typename T, typename... Members>
+    constexpr json_binding<T, Members...> make_json_binding(Members... members)
+    {
+        return json_binding<T, Members...>(members...);
+    }
+
+} // namespace cjsonpp
+
+#endif // CJSONPP_JSON_BINDING_HPP_
@@ -0,0 +1,842 @@
+/**
+ * @file json_cbor.hpp
+ * @brief CBOR (RFC 8949) transcoding of cjsonpp documents and bound structs over bytepack::binary_stream.
+ *
+ * write_cbor()/read_cbor() convert a JSONObject tree to and from CBOR, so that devices exchange a compact binary
+ * encoding while tooling keeps the JSON view of the same document. The json_binding overloads encode and decode a
+ * struct straight from and to the stream, without building a cJSON tree in between.
+ *
+ * Numbers are written as the shortest CBOR integer when integral, else as a single precision float when exact,
+ * else as a double. Byte strings, indefinite lengths and simple values other than false/true/null/undefined have
+ * no JSON counterpart and are rejected on read; tags are skipped.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#ifndef CJSONPP_JSON_CBOR_HPP_
+#define CJSONPP_JSON_CBOR_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "bytepack/bytepack.hpp"
+#include "cJSON/cJSON.h"
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/cjsonpp_result.hpp"
+#include "cjsonpp/json_binding.hpp"
+
+namespace cjsonpp
+{
+    /** @brief CBOR is big endian: the stream type every transcoding function works on. */
+    using cbor_stream = bytepack::binary_stream<std::endian::big>;
+
+    namespace detail
+    {
+        /** @brief CBOR major types (RFC 8949 section 3.1). */
+        enum class cbor_major : std::uint8_t
+        {
+            unsigned_integer = 0,
+            negative_integer = 1,
+            byte_string = 2,
+            text_string = 3,
+            array = 4,
+            map = 5,
+            tag = 6,
+            simple = 7
+        };
+
+        inline constexpr std::uint8_t cbor_false = 0xf4U;
+        inline constexpr std::uint8_t cbor_true = 0xf5U;
+        inline constexpr std::uint8_t cbor_null = 0xf6U;
+        inline constexpr std::uint8_t cbor_info_false = 20U;
+        inline constexpr std::uint8_t cbor_info_true = 21U;
+        inline constexpr std::uint8_t cbor_info_null = 22U;
+        inline constexpr std::uint8_t cbor_info_undefined = 23U;
+        inline constexpr std::uint8_t cbor_info_uint8 = 24U;
+        inline constexpr std::uint8_t cbor_info_uint16 = 25U;
+        inline constexpr std::uint8_t cbor_info_uint32 = 26U;
+        inline constexpr std::uint8_t cbor_info_uint64 = 27U;
+        inline constexpr std::uint8_t cbor_info_mask = 0x1fU;
+        inline constexpr std::uint8_t cbor_single_float = 0xfaU;
+        inline constexpr std::uint8_t cbor_double_float = 0xfbU;
+        /** @brief Strings go through the stream in chunks of this size, bytepack having no runtime-sized copy. */
+        inline constexpr std::size_t cbor_chunk_size = 16U;
+        /** @brief Nesting accepted on read, the same as the cJSON parser. */
+        inline constexpr int cbor_max_depth = CJSON_NESTING_LIMIT;
+
+        /** @brief Initial byte and argument of a data item; for floats the argument holds the bits. */
+        struct cbor_head
+        {
+            cbor_major major = cbor_major::unsigned_integer;
+            std::uint8_t info = 0U;
+            std::uint64_t argument = 0U;
+        };
+
+        inline tools::unexpected<result_error> cbor_full_error()
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, 0, "CBOR stream buffer too small") };
+        }
+
+        inline tools::unexpected<result_error> cbor_parse_error(const char* message)
+        {
+            return tools::unexpected<result_error> { make_error(result_code::parse_error, 0, message) };
+        }
+
+        inline bool cbor_write_head(cbor_stream& stream, cbor_major major, std::uint64_t argument)
+        {
+            const auto type = static_cast<std::uint8_t>(static_cast<std::uint8_t>(major) << 5U);
+            if (argument < cbor_info_uint8)
+            {
+                return stream.write(static_cast<std::uint8_t>(type | argument));
+            }
+            if (argument <= std::numeric_limits<std::uint8_t>::max())
+            {
+                return stream.write(
+                    static_cast<std::uint8_t>(type | cbor_info_uint8), static_cast<std::uint8_t>(argument));
+            }
+            if (argument <= std::numeric_limits<std::uint16_t>::max())
+            {
+                return stream.write(
+                    static_cast<std::uint8_t>(type | cbor_info_uint16), static_cast<std::uint16_t>(argument));
+            }
+            if (argument <= std::numeric_limits<std::uint32_t>::max())
+            {
+                return stream.write(
+                    static_cast<std::uint8_t>(type | cbor_info_uint32), static_cast<std::uint32_t>(argument));
+            }
+            return stream.write(static_cast<std::uint8_t>(type | cbor_info_uint64), argument);
+        }
+
+        inline bool cbor_write_text(cbor_stream& stream, std::string_view text)
+        {
+            if (!cbor_write_head(stream, cbor_major::text_string, text.size()))
+            {
+                return false;
+            }
+
+            std::array<std::uint8_t, cbor_chunk_size> chunk {};
+            std::size_t offset = 0U;
+            for (; (offset + cbor_chunk_size) <= text.size(); offset += cbor_chunk_size)
+            {
+                std::memcpy(chunk.data(), text.data() + offset, cbor_chunk_size); // NOLINT pointer arithmetic
+                if (!stream.write(chunk))
+                {
+                    return false;
+                }
+            }
+            for (; offset < text.size(); ++offset)
+            {
+                if (!stream.write(static_cast<std::uint8_t>(text[offset])))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        inline bool cbor_write_number(cbor_stream& stream, double value)
+        {
+            // 2^63: integral values below it in magnitude are written as CBOR integers
+            constexpr double integer_limit = 9223372036854775808.0;
+            if ((std::trunc(value) == value) && (value >= -integer_limit) && (value < integer_limit))
+            {
+                const auto integer = static_cast<std::int64_t>(value);
+                return (integer >= 0) ? cbor_write_head(stream, cbor_major::unsigned_integer,
+                                            static_cast<std::uint64_t>(integer))
+                                      : cbor_write_head(stream, cbor_major::negative_integer,
+                                            static_cast<std::uint64_t>(-(integer + 1)));
+            }
+
+            const auto single = static_cast<float>(value);
+            if (static_cast<double>(single) == value)
+            {
+                return stream.write(cbor_single_float, std::bit_cast<std::uint32_t>(single));
+            }
+            return stream.write(cbor_double_float, std::bit_cast<std::uint64_t>(value));
+        }
+
+        inline bool cbor_read_head(cbor_stream& stream, cbor_head& head)
+        {
+            std::uint8_t initial = 0U;
+            if (!stream.read(initial))
+            {
+                return false;
+            }
+
+            head.major = static_cast<cbor_major>(initial >> 5U);
+            head.info = static_cast<std::uint8_t>(initial & cbor_info_mask);
+            if (head.info < cbor_info_uint8)
+            {
+                head.argument = head.info;
+                return true;
+            }
+
+            switch (head.info)
+            {
+                case cbor_info_uint8:
+                {
+                    std::uint8_t argument = 0U;
+                    const bool read = stream.read(argument);
+                    head.argument = argument;
+                    return read;
+                }
+                case cbor_info_uint16:
+                {
+                    std::uint16_t argument = 0U;
+                    const bool read = stream.read(argument);
+                    head.argument = argument;
+                    return read;
+                }
+                case cbor_info_uint32:
+                {
+                    std::uint32_t argument = 0U;
+                    const bool read = stream.read(argument);
+                    head.argument = argument;
+                    return read;
+                }
+                case cbor_info_uint64:
+                    return stream.read(head.argument);
+                default:
+                    return false; // reserved, or an indefinite length
+            }
+        }
+
+        /** @brief Reads the head of the next data item, skipping its tags. */
+        inline bool cbor_read_value_head(cbor_stream& stream, cbor_head& head)
+        {
+            do
+            {
+                if (!cbor_read_head(stream, head))
+                {
+                    return false;
+                }
+            } while (cbor_major::tag == head.major);
+            return true;
+        }
+
+        inline bool cbor_read_text(cbor_stream& stream, std::uint64_t length, std::string& text)
+        {
+            text.clear();
+            std::array<std::uint8_t, cbor_chunk_size> chunk {};
+            for (; length >= cbor_chunk_size; length -= cbor_chunk_size)
+            {
+                if (!stream.read(chunk))
+                {
+                    return false;
+                }
+                text.append(reinterpret_cast<const char*>(chunk.data()), cbor_chunk_size); // NOLINT reinterpret_cast
+            }
+            for (; length > 0U; --length)
+            {
+                std::uint8_t character = 0U;
+                if (!stream.read(character))
+                {
+                    return false;
+                }
+                text.push_back(static_cast<char>(character));
+            }
+            return true;
+        }
+
+        inline double cbor_half_to_double(std::uint16_t half)
+        {
+            constexpr int mantissa_bits = 10;
+            constexpr unsigned exponent_mask = 0x1fU;
+            constexpr unsigned mantissa_mask = 0x3ffU;
+            constexpr unsigned sign_bit = 0x8000U;
+
+            const auto exponent = static_cast<int>((half >> mantissa_bits) & exponent_mask);
+            const auto mantissa = static_cast<int>(half & mantissa_mask);
+            double value = 0.0;
+            if (0 == exponent)
+            {
+                value = std::ldexp(mantissa, -24);
+            }
+            else if (static_cast<int>(exponent_mask) != exponent)
+            {
+                value = std::ldexp(mantissa + (1 << mantissa_bits), exponent - 25);
+            }
+            else
+            {
+                value = (0 == mantissa) ? std::numeric_limits<double>::infinity()
+                                        : std::numeric_limits<double>::quiet_NaN();
+            }
+            return (0U != (half & sign_bit)) ? -value : value;
+        }
+
+        /** @brief Converts an integer or float head to a double; false for any other item. */
+        inline bool cbor_number(const cbor_head& head, double& value)
+        {
+            switch (head.major)
+            {
+                case cbor_major::unsigned_integer:
+                    value = static_cast<double>(head.argument);
+                    return true;
+                case cbor_major::negative_integer:
+                    value = -1.0 - static_cast<double>(head.argument);
+                    return true;
+                case cbor_major::simple:
+                    if (cbor_info_uint16 == head.info)
+                    {
+                        value = cbor_half_to_double(static_cast<std::uint16_t>(head.argument));
+                        return true;
+                    }
+                    if (cbor_info_uint32 == head.info)
+                    {
+                        value = std::bit_cast<float>(static_cast<std::uint32_t>(head.argument));
+                        return true;
+                    }
+                    if (cbor_info_uint64 == head.info)
+                    {
+                        value = std::bit_cast<double>(head.argument);
+                        return true;
+                    }
+                    return false;
+                default:
+                    return false;
+            }
+        }
+
+        /** @brief Skips one data item with everything it contains. */
+        inline bool cbor_skip_item(cbor_stream& stream, int depth)
+        {
+            cbor_head head;
+            if ((depth > cbor_max_depth) || !cbor_read_value_head(stream, head))
+            {
+                return false;
+            }
+
+            switch (head.major)
+            {
+                case cbor_major::byte_string:
+                case cbor_major::text_string:
+                {
+                    std::uint8_t byte = 0U;
+                    for (std::uint64_t index = 0U; index < head.argument; ++index)
+                    {
+                        if (!stream.read(byte))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                case cbor_major::array:
+                case cbor_major::map:
+                {
+                    const std::uint64_t items = (cbor_major::map == head.major) ? (2U * head.argument) : head.argument;
+                    for (std::uint64_t index = 0U; index < items; ++index)
+                    {
+                        if (!cbor_skip_item(stream, depth + 1))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                default:
+                    return true;
+            }
+        }
+
+        inline cjsonpp_status cbor_write_item(cbor_stream& stream, const cJSON* item, int depth)
+        {
+            constexpr int byte_mask = 0xff;
+            if (depth > cbor_max_depth)
+            {
+                return tools::unexpected<result_error> { make_error(
+                    result_code::invalid_argument, depth, "Nesting too deep") };
+            }
+
+            bool written = false;
+            switch (item->type & byte_mask)
+            {
+                case cJSON_False:
+                    written = stream.write(cbor_false);
+                    break;
+                case cJSON_True:
+                    written = stream.write(cbor_true);
+                    break;
+                case cJSON_NULL:
+                    written = stream.write(cbor_null);
+                    break;
+                case cJSON_Number:
+                    written = cbor_write_number(stream, item->valuedouble);
+                    break;
+                case cJSON_String:
+                    written = cbor_write_text(stream, (nullptr != item->valuestring) ? item->valuestring : "");
+                    break;
+                case cJSON_Array:
+                case cJSON_Object:
+                {
+                    const bool object = (cJSON_Object == (item->type & byte_mask));
+                    std::uint64_t count = 0U;
+                    for (const cJSON* child = item->child; nullptr != child; child = child->next)
+                    {
+                        ++count;
+                    }
+                    if (!cbor_write_head(stream, object ? cbor_major::map : cbor_major::array, count))
+                    {
+                        return cbor_full_error();
+                    }
+                    for (const cJSON* child = item->child; nullptr != child; child = child->next)
+                    {
+                        if (object && !cbor_write_text(stream, (nullptr != child->string) ? child->string : ""))
+                        {
+                            return cbor_full_error();
+                        }
+                        cjsonpp_status status = cbor_write_item(stream, child, depth + 1);
+                        if (!status)
+                        {
+                            return status;
+                        }
+                    }
+                    return cjsonpp_status {};
+                }
+                default:
+                    return tools::unexpected<result_error> { make_error(
+                        result_code::invalid_type, item->type & byte_mask, "No CBOR form for this item") };
+            }
+
+            return written ? cjsonpp_status {} : cjsonpp_status { cbor_full_error() };
+        }
+
+        inline cjsonpp_status cbor_read_item(cbor_stream& stream, cJSON*& item, int depth)
+        {
+            cbor_head head;
+            if (depth > cbor_max_depth)
+            {
+                return cbor_parse_error("Nesting too deep");
+            }
+            if (!cbor_read_value_head(stream, head))
+            {
+                return cbor_parse_error("Truncated or malformed CBOR");
+            }
+
+            double number = 0.0;
+            switch (head.major)
+            {
+                case cbor_major::text_string:
+                {
+                    std::string text;
+                    if (!cbor_read_text(stream, head.argument, text))
+                    {
+                        return cbor_parse_error("Truncated CBOR string");
+                    }
+                    item = cJSON_CreateString(text.c_str());
+                    break;
+                }
+                case cbor_major::array:
+                case cbor_major::map:
+                {
+                    const bool object = (cbor_major::map == head.major);
+                    item = object ? cJSON_CreateObject() : cJSON_CreateArray();
+                    std::string key;
+                    for (std::uint64_t index = 0U; (nullptr != item) && (index < head.argument); ++index)
+                    {
+                        if (object)
+                        {
+                            cbor_head key_head;
+                            if (!cbor_read_value_head(stream, key_head) || (cbor_major::text_string != key_head.major)
+                                || !cbor_read_text(stream, key_head.argument, key))
+                            {
+                                cJSON_Delete(item);
+                                return cbor_parse_error("Map key is not a CBOR text string");
+                            }
+                        }
+
+                        cJSON* child = nullptr;
+                        cjsonpp_status status = cbor_read_item(stream, child, depth + 1);
+                        if (!status)
+                        {
+                            cJSON_Delete(item);
+                            return status;
+                        }
+                        if (object)
+                        {
+                            cJSON_AddItemToObject(item, key.c_str(), child);
+                        }
+                        else
+                        {
+                            cJSON_AddItemToArray(item, child);
+                        }
+                    }
+                    break;
+                }
+                case cbor_major::simple:
+                    if (cbor_info_false == head.info)
+                    {
+                        item = cJSON_CreateFalse();
+                    }
+                    else if (cbor_info_true == head.info)
+                    {
+                        item = cJSON_CreateTrue();
+                    }
+                    else if ((cbor_info_null == head.info) || (cbor_info_undefined == head.info))
+                    {
+                        item = cJSON_CreateNull();
+                    }
+                    else if (cbor_number(head, number))
+                    {
+                        item = cJSON_CreateNumber(number);
+                    }
+                    else
+                    {
+                        return tools::unexpected<result_error> { make_error(
+                            result_code::invalid_type, static_cast<int>(head.major), "No JSON form for this item") };
+                    }
+                    break;
+                default:
+                    if (!cbor_number(head, number))
+                    {
+                        return tools::unexpected<result_error> { make_error(
+                            result_code::invalid_type, static_cast<int>(head.major), "No JSON form for this item") };
+                    }
+                    item = cJSON_CreateNumber(number);
+                    break;
+            }
+
+            if (nullptr == item)
+            {
+                return tools::unexpected<result_error> { make_error(
+                    result_code::internal_error, 0, "cJSON allocation failed") };
+            }
+            return cjsonpp_status {};
+        }
+
+        template <typename T, typename... Members>
+        cjsonpp_status cbor_read_binding(
+            const json_binding<T, Members...>& binding, cbor_stream& stream, T& out, int depth);
+
+        template <typename T, typename... Members>
+        cjsonpp_status cbor_write_binding(const json_binding<T, Members...>& binding, const T& in, cbor_stream& stream);
+
+        template <typename M, typename Nested>
+        cjsonpp_status cbor_read_member(cbor_stream& stream, M& value, const Nested& nested, int index, int depth)
+        {
+            const auto bad_type = [index]
+            {
+                return tools::unexpected<result_error> { make_error(
+                    result_code::invalid_type, index, "Bad value type for bound member") };
+            };
+
+            if constexpr (!std::is_same_v<Nested, json_scalar_member>)
+            {
+                auto status = cbor_read_binding(nested, stream, value, depth + 1);
+                if (!status && (result_code::invalid_type == status.error().code) && (-1 == status.error().detail))
+                {
+                    return bad_type();
+                }
+                return status;
+            }
+            else
+            {
+                cbor_head head;
+                if (!cbor_read_value_head(stream, head))
+                {
+                    return cbor_parse_error("Truncated or malformed CBOR");
+                }
+
+                double number = 0.0;
+                if constexpr (std::is_same_v<M, bool>)
+                {
+                    if ((cbor_major::simple == head.major)
+                        && ((cbor_info_false == head.info) || (cbor_info_true == head.info)))
+                    {
+                        value = (cbor_info_true == head.info);
+                        return cjsonpp_status {};
+                    }
+                }
+                else if constexpr (std::is_same_v<M, std::string>)
+                {
+                    if (cbor_major::text_string == head.major)
+                    {
+                        if (!cbor_read_text(stream, head.argument, value))
+                        {
+                            return cbor_parse_error("Truncated CBOR string");
+                        }
+                        return cjsonpp_status {};
+                    }
+                }
+                else if constexpr (std::is_integral_v<M>)
+                {
+                    // integral members only take integral numbers within their range, the argument exactly
+                    using limits = std::numeric_limits<M>;
+                    if (cbor_major::unsigned_integer == head.major)
+                    {
+                        if (head.argument <= static_cast<std::uint64_t>(limits::max()))
+                        {
+                            value = static_cast<M>(head.argument);
+                            return cjsonpp_status {};
+                        }
+                    }
+                    else if (cbor_major::negative_integer == head.major)
+                    {
+                        if constexpr (std::is_signed_v<M>)
+                        {
+                            if (head.argument <= static_cast<std::uint64_t>(-(limits::lowest() + 1)))
+                            {
+                                value = static_cast<M>(-1 - static_cast<std::int64_t>(head.argument));
+                                return cjsonpp_status {};
+                            }
+                        }
+                    }
+                    else if (cbor_number(head, number) && (std::trunc(number) == number)
+                        && (number >= static_cast<double>(limits::lowest()))
+                        && (number < (static_cast<double>(limits::max()) + 1.0)))
+                    {
+                        value = static_cast<M>(number);
+                        return cjsonpp_status {};
+                    }
+                }
+                else
+                {
+                    if (cbor_number(head, number))
+                    {
+                        value = static_cast<M>(number);
+                        return cjsonpp_status {};
+                    }
+                }
+
+                return bad_type();
+            }
+        }
+
+        template <typename Member, typename M>
+        cjsonpp_status cbor_write_member(cbor_stream& stream, const Member& member, const M& value)
+        {
+            if (!cbor_write_text(stream, member.key))
+            {
+                return cbor_full_error();
+            }
+
+            bool written = false;
+            if constexpr (!std::is_same_v<typename Member::nested_type, json_scalar_member>)
+            {
+                return cbor_write_binding(member.nested, value, stream);
+            }
+            else if constexpr (std::is_same_v<M, bool>)
+            {
+                written = stream.write(value ? cbor_true : cbor_false);
+            }
+            else if constexpr (std::is_same_v<M, std::string>)
+            {
+                written = cbor_write_text(stream, value);
+            }
+            else if constexpr (std::is_integral_v<M> && std::is_unsigned_v<M>)
+            {
+                written = cbor_write_head(stream, cbor_major::unsigned_integer, static_cast<std::uint64_t>(value));
+            }
+            else if constexpr (std::is_integral_v<M>)
+            {
+                const auto integer = static_cast<std::int64_t>(value);
+                written = (integer >= 0) ? cbor_write_head(stream, cbor_major::unsigned_integer,
+                                               static_cast<std::uint64_t>(integer))
+                                         : cbor_write_head(stream, cbor_major::negative_integer,
+                                               static_cast<std::uint64_t>(-(integer + 1)));
+            }
+            else
+            {
+                written = cbor_write_number(stream, static_cast<double>(value));
+            }
+            return written ? cjsonpp_status {} : cjsonpp_status { cbor_full_error() };
+        }
+
+        template <typename T, typename... Members>
+        cjsonpp_status cbor_write_binding(const json_binding<T, Members...>& binding, const T& in, cbor_stream& stream)
+        {
+            if (!cbor_write_head(stream, cbor_major::map, binding.field_count))
+            {
+                return cbor_full_error();
+            }
+
+            cjsonpp_status status {};
+            binding.for_each_member(
+                [&stream, &in, &status](const auto& member, std::size_t /*index*/)
+                {
+                    if (status)
+                    {
+                        status = cbor_write_member(stream, member, in.*(member.member));
+                    }
+                });
+            return status;
+        }
+
+        template <typename T, typename... Members>
+        cjsonpp_status cbor_read_binding(
+            const json_binding<T, Members...>& binding, cbor_stream& stream, T& out, int depth)
+        {
+            cbor_head head;
+            if (depth > cbor_max_depth)
+            {
+                return cbor_parse_error("Nesting too deep");
+            }
+            if (!cbor_read_value_head(stream, head))
+            {
+                return cbor_parse_error("Truncated or malformed CBOR");
+            }
+            if (cbor_major::map != head.major)
+            {
+                return tools::unexpected<result_error> { make_error(result_code::invalid_type, -1, "Not an object") };
+            }
+
+            std::uint64_t found = 0U;
+            std::string key;
+            for (std::uint64_t pair = 0U; pair < head.argument; ++pair)
+            {
+                cbor_head key_head;
+                if (!cbor_read_value_head(stream, key_head) || (cbor_major::text_string != key_head.major)
+                    || !cbor_read_text(stream, key_head.argument, key))
+                {
+                    return cbor_parse_error("Map key is not a CBOR text string");
+                }
+
+                cjsonpp_status status {};
+                bool consumed = false;
+                binding.visit_member(key,
+                    [&stream, &out, &found, &status, &consumed, depth](const auto& member, std::size_t index)
+                    {
+                        const std::uint64_t bit = std::uint64_t { 1U } << index;
+                        if (0U == (found & bit))
+                        {
+                            // the first occurrence of a key wins, like the JSON read
+                            found |= bit;
+                            consumed = true;
+                            status = cbor_read_member(
+                                stream, out.*(member.member), member.nested, static_cast<int>(index), depth);
+                        }
+                    });
+                if (!status)
+                {
+                    return status;
+                }
+                if (!consumed && !cbor_skip_item(stream, depth + 1))
+                {
+                    return cbor_parse_error("Truncated or malformed CBOR");
+                }
+            }
+
+            const std::uint64_t missing = binding.required_mask() & ~found;
+            if (0U != missing)
+            {
+                return tools::unexpected<result_error> { make_error(
+                    result_code::missing_item, std::countr_zero(missing), "Missing bound member") };
+            }
+            return cjsonpp_status {};
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Encodes a cJSON item and its children as one CBOR data item.
+     * @param item cJSON item.
+     * @param stream Destination stream.
+     * @return Success, invalid_type for a raw item, or invalid_argument when the stream buffer is full.
+     */
+    inline cjsonpp_status write_cbor(const cJSON* item, cbor_stream& stream)
+    {
+        if (nullptr == item)
+        {
+            return tools::unexpected<result_error> { make_error(result_code::invalid_argument, 0, "Null item") };
+        }
+        return detail::cbor_write_item(stream, item, 0);
+    }
+
+    /**
+     * @brief Encodes a JSON document as one CBOR data item.
+     * @param object JSON document.
+     * @param stream Destination stream.
+     * @return See write_cbor(const cJSON*, cbor_stream&).
+     */
+    inline cjsonpp_status write_cbor(const JSONObject& object, cbor_stream& stream)
+    {
+        return write_cbor(object.obj(), stream);
+    }
+
+    /**
+     * @brief Decodes the next CBOR data item of a stream into a JSON document.
+     * @param stream Source stream.
+     * @return The document, parse_error for truncated or malformed input, or invalid_type (detail: CBOR major type)
+     *         for an item without JSON form.
+     */
+    inline cjsonpp_result<JSONObject> read_cbor(cbor_stream& stream)
+    {
+        cJSON* root = nullptr;
+        cjsonpp_status status = detail::cbor_read_item(stream, root, 0);
+        if (!status)
+        {
+            return tools::unexpected<result_error> { status.error() };
+        }
+        return JSONObject { root, true };
+    }
+
+    /**
+     * @brief Encodes the bound members of a struct as a CBOR map, without an intermediate cJSON tree.
+     * @param binding Binding of T.
+     * @param in Source struct.
+     * @param stream Destination stream.
+     * @return Success, or invalid_argument when the stream buffer is full.
+     */
+    template <typename T, typename... Members>
+    cjsonpp_status write_cbor(const json_binding<T, Members...>& binding, const T& in, cbor_stream& stream)
+    {
+        return detail::cbor_write_binding(binding, in, stream);
+    }
+
+    /**
+     * @brief Decodes a CBOR map straight into the bound members of a struct; unbound keys are skipped.
+     * @param binding Binding of T.
+     * @param stream Source stream.
+     * @param out Destination; members whose key is absent keep their value.
+     * @return Success, parse_error for truncated or malformed input, or the errors of json_binding::read().
+     */
+    template <typename T, typename... Members>
+    cjsonpp_status read_cbor(const json_binding<T, Members...>& binding, cbor_stream& stream, T& out)
+    {
+        return detail::cbor_read_binding(binding, stream, out, 0);
+    }
+
+} // namespace cjsonpp
+
+#endif // C++20
+
+#endif // CJSONPP_JSON_CBOR_HPP_
@@ -0,0 +1,332 @@
+/**
+ * @file json_lazy_document.cpp
+ * @brief Document indexing only the top level of a JSON text and parsing each member on first access.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "cJSON/cJSON.h"
+#include "cjsonpp/json_binding.hpp"
+#include "cjsonpp/json_lazy_document.hpp"
+
+namespace cjsonpp
+{
+    namespace
+    {
+        constexpr std::size_t npos = std::string_view::npos;
+
+        bool is_whitespace(char character)
+        {
+            return (' ' == character) || ('\t' == character) || ('\n' == character) || ('\r' == character);
+        }
+
+        std::size_t skip_whitespace(std::string_view text, std::size_t pos)
+        {
+            while ((pos < text.size()) && is_whitespace(text[pos]))
+            {
+                ++pos;
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Skips a string starting at its opening quote.
+         * @return Position after the closing quote, npos when unterminated.
+         */
+        std::size_t skip_string(std::string_view text, std::size_t pos, bool& escaped)
+        {
+            escaped = false;
+            for (++pos; pos < text.size(); ++pos)
+            {
+                if ('\\' == text[pos])
+                {
+                    escaped = true;
+                    ++pos;
+                }
+                else if ('"' == text[pos])
+                {
+                    return pos + 1U;
+                }
+            }
+            return npos;
+        }
+
+        /**
+         * @brief Skips a value, only checking that brackets balance and strings terminate.
+         * @return Position after the value, npos when it is truncated or empty.
+         */
+        std::size_t skip_value(std::string_view text, std::size_t pos)
+        {
+            bool escaped = false;
+            if (pos >= text.size())
+            {
+                return npos;
+            }
+            if ('"' == text[pos])
+            {
+                return skip_string(text, pos, escaped);
+            }
+            if (('{' == text[pos]) || ('[' == text[pos]))
+            {
+                std::size_t depth = 0U;
+                while (pos < text.size())
+                {
+                    const char character = text[pos];
+                    if ('"' == character)
+                    {
+                        pos = skip_string(text, pos, escaped);
+                        if (npos == pos)
+                        {
+                            return npos;
+                        }
+                        continue;
+                    }
+                    ++pos;
+                    if (('{' == character) || ('[' == character))
+                    {
+                        ++depth;
+                    }
+                    else if ((('}' == character) || (']' == character)) && (0U == --depth))
+                    {
+                        return pos;
+                    }
+                }
+                return npos;
+            }
+
+            const std::size_t start = pos;
+            while ((pos < text.size()) && !is_whitespace(text[pos]) && (',' != text[pos]) && ('}' != text[pos])
+                && (']' != text[pos]))
+            {
+                ++pos;
+            }
+            return (pos == start) ? npos : pos;
+        }
+
+        JSONType type_of(std::string_view value)
+        {
+            if (value.empty())
+            {
+                return JSONType::Invalid;
+            }
+            switch (value.front())
+            {
+                case '{':
+                    return JSONType::Object;
+                case '[':
+                    return JSONType::Array;
+                case '"':
+                    return JSONType::String;
+                case 't':
+                case 'f':
+                    return JSONType::Bool;
+                case 'n':
+                    return JSONType::Null;
+                default:
+                    return JSONType::Number;
+            }
+        }
+
+        result_error index_error(std::size_t offset)
+        {
+            return make_error(result_code::parse_error, static_cast<int>(offset), "Malformed JSON document");
+        }
+    } // namespace
+
+    cjsonpp_result<json_lazy_document> json_lazy_document::index(std::string_view text)
+    {
+        json_lazy_document document;
+        document.m_text = text;
+        auto status = document.build_index();
+        if (!status)
+        {
+            return tools::unexpected<result_error> { status.error() };
+        }
+        return cjsonpp_result<json_lazy_document> { std::move(document) };
+    }
+
+    cjsonpp_result<json_lazy_document> json_lazy_document::index(std::string&& text)
+    {
+        json_lazy_document document;
+        document.m_owned_text = std::make_unique<std::string>(std::move(text));
+        document.m_text = *document.m_owned_text;
+        auto status = document.build_index();
+        if (!status)
+        {
+            return tools::unexpected<result_error> { status.error() };
+        }
+        return cjsonpp_result<json_lazy_document> { std::move(document) };
+    }
+
+    cjsonpp_result<void> json_lazy_document::build_index()
+    {
+        std::size_t pos = skip_whitespace(m_text, 0U);
+        if ((pos >= m_text.size()) || (('{' != m_text[pos]) && ('[' != m_text[pos])))
+        {
+            return tools::unexpected<result_error> { index_error(pos) };
+        }
+
+        const bool is_object = ('{' == m_text[pos]);
+        const char closing = is_object ? '}' : ']';
+        m_root_type = is_object ? JSONType::Object : JSONType::Array;
+
+        pos = skip_whitespace(m_text, pos + 1U);
+        if ((pos < m_text.size()) && (closing == m_text[pos]))
+        {
+            ++pos;
+        }
+        else
+        {
+            while (true)
+            {
+                entry item;
+                if (is_object)
+                {
+                    if ((pos >= m_text.size()) || ('"' != m_text[pos]))
+                    {
+                        return tools::unexpected<result_error> { index_error(pos) };
+                    }
+                    const std::size_t key_end = skip_string(m_text, pos, item.escaped_key);
+                    if (npos == key_end)
+                    {
+                        return tools::unexpected<result_error> { index_error(pos) };
+                    }
+                    item.raw_key = m_text.substr(pos + 1U, key_end - pos - 2U);
+                    if (item.escaped_key)
+                    {
+                        // rare: let cJSON unescape the quoted key once
+                        const std::string_view quoted = m_text.substr(pos, key_end - pos);
+                        cJSON* decoded = cJSON_ParseWithLength(quoted.data(), quoted.size());
+                        if ((nullptr == decoded) || (nullptr == decoded->valuestring))
+                        {
+                            cJSON_Delete(decoded);
+                            return tools::unexpected<result_error> { index_error(pos) };
+                        }
+                        item.decoded_key = decoded->valuestring;
+                        cJSON_Delete(decoded);
+                    }
+                    item.key_hash = json_key_hash(item.name());
+
+                    pos = skip_whitespace(m_text, key_end);
+                    if ((pos >= m_text.size()) || (':' != m_text[pos]))
+                    {
+                        return tools::unexpected<result_error> { index_error(pos) };
+                    }
+                    pos = skip_whitespace(m_text, pos + 1U);
+                }
+
+                const std::size_t value_end = skip_value(m_text, pos);
+                if (npos == value_end)
+                {
+                    return tools::unexpected<result_error> { index_error(pos) };
+                }
+                item.value_offset = pos;
+                item.value = m_text.substr(pos, value_end - pos);
+                m_entries.push_back(std::move(item));
+
+                pos = skip_whitespace(m_text, value_end);
+                if ((pos < m_text.size()) && (',' == m_text[pos]))
+                {
+                    pos = skip_whitespace(m_text, pos + 1U);
+                    continue;
+                }
+                if ((pos < m_text.size()) && (closing == m_text[pos]))
+                {
+                    ++pos;
+                    break;
+                }
+                return tools::unexpected<result_error> { index_error(pos) };
+            }
+        }
+
+        pos = skip_whitespace(m_text, pos);
+        if (pos != m_text.size())
+        {
+            return tools::unexpected<result_error> { index_error(pos) };
+        }
+        return {};
+    }
+
+    const json_lazy_document::entry* json_lazy_document::find(std::string_view key) const
+    {
+        if (JSONType::Object != m_root_type)
+        {
+            return nullptr;
+        }
+        const std::uint32_t hash = json_key_hash(key);
+        for (const auto& item : m_entries)
+        {
+            if ((hash == item.key_hash) && (key == item.name()))
+            {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    bool json_lazy_document::has(std::string_view key) const
+    {
+        return nullptr != find(key);
+    }
+
+    std::string_view json_lazy_document::key(std::size_t position) const
+    {
+        return (position < m_entries.size()) ? m_entries[position].name() : std::string_view {};
+    }
+
+    JSONType json_lazy_document::type(std::string_view key) const
+    {
+        const entry* item = find(key);
+        return (nullptr != item) ? type_of(item->value) : JSONType::Invalid;
+    }
+
+    std::string_view json_lazy_document::raw(std::string_view key) const
+    {
+        const entry* item = find(key);
+        return (nullptr != item) ? item->value : std::string_view {};
+    }
+
+    cjsonpp_result<JSONObject> json_lazy_document::get(std::string_view key) const
+    {
+        const entry* item = find(key);
+        if (nullptr == item)
+        {
+            return tools::unexpected<result_error> { make_error(result_code::missing_item, 0, "Missing member") };
+        }
+        return materialize(*item);
+    }
+
+    cjsonpp_result<JSONObject> json_lazy_document::at(std::size_t position) const
+    {
+        if (position >= m_entries.size())
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::missing_item, static_cast<int>(position), "Index out of range") };
+        }
+        return materialize(m_entries[position]);
+    }
+
+    cjsonpp_result<JSONObject> json_lazy_document::materialize(const entry& item) const
+    {
+        if (!item.cached.has_value())
+        {
+            cJSON* parsed = cJSON_ParseWithLength(item.value.data(), item.value.size());
+            if (nullptr == parsed)
+            {
+                return tools::unexpected<result_error> { make_error(
+                    result_code::parse_error, static_cast<int>(item.value_offset), "Parse error") };
+            }
+            item.cached.emplace(parsed, true);
+            ++m_materialized;
+        }
+        return cjsonpp_result<JSONObject> { *item.cached };
+    }
+
+} // namespace cjsonpp
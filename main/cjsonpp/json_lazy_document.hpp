@@ -0,0 +1,176 @@
+/**
+ * @file json_lazy_document.hpp
+ * @brief Document indexing only the top level of a JSON text and parsing each member on first access.
+ *
+ * parse_result() builds the whole cJSON tree up front, so a large configuration costs its full parse time and
+ * heap at boot even if most sections are never read. json_lazy_document scans the text once and records where
+ * each top-level member sits; a member becomes a JSONObject the first time it is read, and stays cached.
+ */
+
+#pragma once
+
+#ifndef CJSONPP_JSON_LAZY_DOCUMENT_HPP_
+#define CJSONPP_JSON_LAZY_DOCUMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/cjsonpp_result.hpp"
+
+namespace cjsonpp
+{
+
+    /**
+     * @brief Top-level index of a JSON object or array, materializing its members on demand.
+     *
+     * index() checks the top level strictly and the nested values only for balanced brackets and terminated
+     * strings: a malformed member is reported as parse_error when it is first read, with its offset in the
+     * text as detail. Keys are matched case-sensitively and the first occurrence of a key wins, as in
+     * json_binding.
+     *
+     * The document either borrows the text (which must then outlive it) or owns a moved-in copy. Materialized
+     * members are independent cJSON trees: a JSONObject handed out stays valid after the document is gone.
+     * Like JSONObject, a document must not be shared across threads.
+     */
+    class json_lazy_document
+    {
+    public:
+        /**
+         * @brief Indexes a text borrowed for the lifetime of the document.
+         * @param text JSON text whose root is an object or an array.
+         * @return The document, or parse_error with the offset of the first top-level error as detail.
+         */
+        static cjsonpp_result<json_lazy_document> index(std::string_view text);
+
+        /**
+         * @brief Indexes a text owned by the document.
+         * @param text JSON text whose root is an object or an array.
+         * @return The document, or parse_error with the offset of the first top-level error as detail.
+         */
+        static cjsonpp_result<json_lazy_document> index(std::string&& text);
+
+        /**
+         * @brief Returns the type of the root value.
+         * @return JSONType::Object or JSONType::Array.
+         */
+        [[nodiscard]] JSONType root_type() const noexcept
+        {
+            return m_root_type;
+        }
+
+        /**
+         * @brief Returns the number of top-level members or elements.
+         * @return Member count.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_entries.size();
+        }
+
+        /**
+         * @brief Tells whether the root object has a member.
+         * @param key Member name.
+         * @return true when the member exists.
+         */
+        [[nodiscard]] bool has(std::string_view key) const;
+
+        /**
+         * @brief Returns the name of a top-level member, unescaped.
+         * @param position Member position, below size().
+         * @return The name, empty for array elements or an out of range position.
+         */
+        [[nodiscard]] std::string_view key(std::size_t position) const;
+
+        /**
+         * @brief Returns the type of a member, read from its first character without parsing it.
+         * @param key Member name.
+         * @return The type, JSONType::Invalid when the member is missing.
+         */
+        [[nodiscard]] JSONType type(std::string_view key) const;
+
+        /**
+         * @brief Returns the text of a member, as written in the document.
+         * @param key Member name.
+         * @return The value text, empty when the member is missing.
+         */
+        [[nodiscard]] std::string_view raw(std::string_view key) const;
+
+        /**
+         * @brief Returns a member as a JSONObject, parsing it on first access.
+         * @param key Member name.
+         * @return The member, missing_item when absent or parse_error when its text is malformed.
+         */
+        [[nodiscard]] cjsonpp_result<JSONObject> get(std::string_view key) const;
+
+        /**
+         * @brief Returns a member or element by position, parsing it on first access.
+         * @param position Member position, below size().
+         * @return The member, missing_item when out of range or parse_error when its text is malformed.
+         */
+        [[nodiscard]] cjsonpp_result<JSONObject> at(std::size_t position) const;
+
+        /**
+         * @brief Converts a member, parsing it on first access.
+         * @tparam T Any type supported by JSONObject::as().
+         * @param key Member name.
+         * @return The value, or the missing_item, parse_error or invalid_type error.
+         */
+        template <typename T>
+        [[nodiscard]] cjsonpp_result<T> get(std::string_view key) const
+        {
+            auto member = get(key);
+            if (!member)
+            {
+                return tools::unexpected<result_error> { member.error() };
+            }
+            return member.value().template as<T>();
+        }
+
+        /**
+         * @brief Returns the number of members parsed so far.
+         * @return Materialized member count.
+         */
+        [[nodiscard]] std::size_t materialized_count() const noexcept
+        {
+            return m_materialized;
+        }
+
+    private:
+        struct entry
+        {
+            std::uint32_t key_hash = 0U;
+            std::string_view raw_key;
+            std::string decoded_key;
+            bool escaped_key = false;
+            std::size_t value_offset = 0U;
+            std::string_view value;
+            mutable std::optional<JSONObject> cached;
+
+            [[nodiscard]] std::string_view name() const
+            {
+                return escaped_key ? std::string_view(decoded_key) : raw_key;
+            }
+        };
+
+        json_lazy_document() = default;
+
+        cjsonpp_result<void> build_index();
+        [[nodiscard]] const entry* find(std::string_view key) const;
+        cjsonpp_result<JSONObject> materialize(const entry& item) const;
+
+        std::unique_ptr<std::string> m_owned_text;
+        std::string_view m_text;
+        JSONType m_root_type = JSONType::Invalid;
+        std::vector<entry> m_entries;
+        mutable std::size_t m_materialized = 0U;
+    };
+
+} // namespace cjsonpp
+
+#endif // CJSONPP_JSON_LAZY_DOCUMENT_HPP_
@@ -0,0 +1,724 @@
+/**
+ * @file json_stream_parser.cpp
+ * @brief Bounded-memory pull parser and path extractor for JSON documents fed in chunks.
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "cJSON/cJSON_number.h"
+#include "cjsonpp/json_stream_parser.hpp"
+
+namespace cjsonpp
+{
+    namespace
+    {
+        bool is_whitespace(char character)
+        {
+            return (' ' == character) || ('\t' == character) || ('\n' == character) || ('\r' == character);
+        }
+
+        bool is_digit(char character)
+        {
+            return (character >= '0') && (character <= '9');
+        }
+
+        bool is_number_character(char character)
+        {
+            return is_digit(character) || ('-' == character) || ('+' == character) || ('.' == character)
+                || ('e' == character) || ('E' == character);
+        }
+
+        int hex_value(char character)
+        {
+            if (is_digit(character))
+            {
+                return character - '0';
+            }
+            if ((character >= 'a') && (character <= 'f'))
+            {
+                return character - 'a' + 10;
+            }
+            if ((character >= 'A') && (character <= 'F'))
+            {
+                return character - 'A' + 10;
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Validates a number token against the JSON grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+         */
+        bool is_valid_number(std::string_view text)
+        {
+            std::size_t pos = 0U;
+            const auto digits = [&text, &pos]()
+            {
+                const std::size_t start = pos;
+                while ((pos < text.size()) && is_digit(text[pos]))
+                {
+                    ++pos;
+                }
+                return pos - start;
+            };
+
+            if ((pos < text.size()) && ('-' == text[pos]))
+            {
+                ++pos;
+            }
+            if ((pos < text.size()) && ('0' == text[pos]))
+            {
+                ++pos;
+            }
+            else if (0U == digits())
+            {
+                return false;
+            }
+
+            if ((pos < text.size()) && ('.' == text[pos]))
+            {
+                ++pos;
+                if (0U == digits())
+                {
+                    return false;
+                }
+            }
+
+            if ((pos < text.size()) && (('e' == text[pos]) || ('E' == text[pos])))
+            {
+                ++pos;
+                if ((pos < text.size()) && (('+' == text[pos]) || ('-' == text[pos])))
+                {
+                    ++pos;
+                }
+                if (0U == digits())
+                {
+                    return false;
+                }
+            }
+
+            return pos == text.size();
+        }
+
+        constexpr const char* literal_true = "true";
+        constexpr const char* literal_false = "false";
+        constexpr const char* literal_null = "null";
+    } // namespace
+
+    json_pull_parser::json_pull_parser(const json_stream_limits& limits)
+        : m_limits(limits)
+    {
+        m_token.reserve(m_limits.max_token_length);
+        m_stack.reserve(m_limits.max_depth);
+    }
+
+    void json_pull_parser::feed(const char* data, std::size_t size)
+    {
+        m_input = data;
+        m_size = (nullptr == data) ? 0U : size;
+        m_pos = 0U;
+    }
+
+    void json_pull_parser::finish()
+    {
+        m_finished = true;
+    }
+
+    void json_pull_parser::reset()
+    {
+        m_input = nullptr;
+        m_size = 0U;
+        m_pos = 0U;
+        m_offset = 0U;
+        m_finished = false;
+        m_string_is_key = false;
+        m_expect = expect::value;
+        m_lexeme = lexeme::none;
+        m_unicode = 0U;
+        m_unicode_digits = 0U;
+        m_high_surrogate = 0U;
+        m_literal = nullptr;
+        m_token.clear();
+        m_stack.clear();
+        m_error.reset();
+    }
+
+    cjsonpp_result<json_event> json_pull_parser::fail(const char* message)
+    {
+        if (!m_error.has_value())
+        {
+            m_error = result_error { result_code::parse_error, static_cast<int>(m_offset), message };
+        }
+        return tools::unexpected<result_error> { m_error.value() };
+    }
+
+    bool json_pull_parser::append(char character)
+    {
+        if (m_token.size() >= m_limits.max_token_length)
+        {
+            return false;
+        }
+        m_token.push_back(character);
+        return true;
+    }
+
+    bool json_pull_parser::append_code_point(std::uint32_t code_point)
+    {
+        if (code_point < 0x80U)
+        {
+            return append(static_cast<char>(code_point));
+        }
+        if (code_point < 0x800U)
+        {
+            return append(static_cast<char>(0xc0U | (code_point >> 6U)))
+                && append(static_cast<char>(0x80U | (code_point & 0x3fU)));
+        }
+        if (code_point < 0x10000U)
+        {
+            return append(static_cast<char>(0xe0U | (code_point >> 12U)))
+                && append(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3fU)))
+                && append(static_cast<char>(0x80U | (code_point & 0x3fU)));
+        }
+        return append(static_cast<char>(0xf0U | (code_point >> 18U)))
+            && append(static_cast<char>(0x80U | ((code_point >> 12U) & 0x3fU)))
+            && append(static_cast<char>(0x80U | ((code_point >> 6U) & 0x3fU)))
+            && append(static_cast<char>(0x80U | (code_point & 0x3fU)));
+    }
+
+    bool json_pull_parser::push_container(char kind)
+    {
+        if (m_stack.size() >= m_limits.max_depth)
+        {
+            return false;
+        }
+        m_stack.push_back(kind);
+        return true;
+    }
+
+    void json_pull_parser::after_value()
+    {
+        m_expect = m_stack.empty() ? expect::done : expect::comma_or_end;
+    }
+
+    json_event json_pull_parser::token_event()
+    {
+        json_event event;
+        event.text = std::string_view(m_token.data(), m_token.size());
+
+        switch (m_lexeme)
+        {
+            case lexeme::number:
+                event.type = json_event_type::number;
+                break;
+            case lexeme::literal:
+                event.type = (literal_null == m_literal) ? json_event_type::null : json_event_type::boolean;
+                break;
+            default:
+                event.type = m_string_is_key ? json_event_type::key : json_event_type::string;
+                break;
+        }
+
+        m_lexeme = lexeme::none;
+        if (json_event_type::key == event.type)
+        {
+            m_expect = expect::colon;
+        }
+        else
+        {
+            after_value();
+        }
+        return event;
+    }
+
+    json_pull_parser::lex_status json_pull_parser::lex_string()
+    {
+        while (m_pos < m_size)
+        {
+            const char character = m_input[m_pos]; // NOLINT chunk access
+            ++m_pos;
+            ++m_offset;
+
+            if (lexeme::string_escape == m_lexeme)
+            {
+                m_lexeme = lexeme::string;
+                if ((0U != m_high_surrogate) && ('u' != character))
+                {
+                    return lex_status::failed;
+                }
+
+                char unescaped = '\0';
+                switch (character)
+                {
+                    case '"':
+                    case '\\':
+                    case '/':
+                        unescaped = character;
+                        break;
+                    case 'b':
+                        unescaped = '\b';
+                        break;
+                    case 'f':
+                        unescaped = '\f';
+                        break;
+                    case 'n':
+                        unescaped = '\n';
+                        break;
+                    case 'r':
+                        unescaped = '\r';
+                        break;
+                    case 't':
+                        unescaped = '\t';
+                        break;
+                    case 'u':
+                        m_lexeme = lexeme::string_unicode;
+                        m_unicode = 0U;
+                        m_unicode_digits = 0U;
+                        continue;
+                    default:
+                        return lex_status::failed;
+                }
+
+                if (!append(unescaped))
+                {
+                    return lex_status::failed;
+                }
+            }
+            else if (lexeme::string_unicode == m_lexeme)
+            {
+                const int digit = hex_value(character);
+                if (digit < 0)
+                {
+                    return lex_status::failed;
+                }
+
+                m_unicode = (m_unicode << 4U) | static_cast<std::uint32_t>(digit);
+                if (++m_unicode_digits < 4U)
+                {
+                    continue;
+                }
+
+                m_lexeme = lexeme::string;
+                if ((m_unicode >= 0xd800U) && (m_unicode <= 0xdbffU))
+                {
+                    if (0U != m_high_surrogate)
+                    {
+                        return lex_status::failed;
+                    }
+                    m_high_surrogate = m_unicode;
+                }
+                else if ((m_unicode >= 0xdc00U) && (m_unicode <= 0xdfffU))
+                {
+                    if (0U == m_high_surrogate)
+                    {
+                        return lex_status::failed;
+                    }
+                    const std::uint32_t code_point
+                        = 0x10000U + ((m_high_surrogate - 0xd800U) << 10U) + (m_unicode - 0xdc00U);
+                    m_high_surrogate = 0U;
+                    if (!append_code_point(code_point))
+                    {
+                        return lex_status::failed;
+                    }
+                }
+                else
+                {
+                    if ((0U != m_high_surrogate) || !append_code_point(m_unicode))
+                    {
+                        return lex_status::failed;
+                    }
+                }
+            }
+            else if ('\\' == character)
+            {
+                m_lexeme = lexeme::string_escape;
+            }
+            else if ((0U != m_high_surrogate) || (static_cast<unsigned char>(character) < 0x20U))
+            {
+                // unpaired high surrogate, or raw control character
+                return lex_status::failed;
+            }
+            else if ('"' == character)
+            {
+                return lex_status::token;
+            }
+            else if (!append(character))
+            {
+                return lex_status::failed;
+            }
+        }
+
+        return lex_status::need_input;
+    }
+
+    json_pull_parser::lex_status json_pull_parser::lex_number()
+    {
+        while (m_pos < m_size)
+        {
+            const char character = m_input[m_pos]; // NOLINT chunk access
+            if (!is_number_character(character))
+            {
+                return is_valid_number(m_token) ? lex_status::token : lex_status::failed;
+            }
+
+            if (!append(character))
+            {
+                return lex_status::failed;
+            }
+            ++m_pos;
+            ++m_offset;
+        }
+
+        if (m_finished)
+        {
+            return is_valid_number(m_token) ? lex_status::token : lex_status::failed;
+        }
+        return lex_status::need_input;
+    }
+
+    json_pull_parser::lex_status json_pull_parser::lex_literal()
+    {
+        const std::size_t length = std::strlen(m_literal);
+        while ((m_pos < m_size) && (m_token.size() < length))
+        {
+            const char character = m_input[m_pos]; // NOLINT chunk access
+            if (character != m_literal[m_token.size()]) // NOLINT literal access
+            {
+                return lex_status::failed;
+            }
+            m_token.push_back(character);
+            ++m_pos;
+            ++m_offset;
+        }
+
+        return (m_token.size() == length) ? lex_status::token : lex_status::need_input;
+    }
+
+    cjsonpp_result<json_event> json_pull_parser::next()
+    {
+        if (m_error.has_value())
+        {
+            return tools::unexpected<result_error> { m_error.value() };
+        }
+
+        for (;;)
+        {
+            if (lexeme::none != m_lexeme)
+            {
+                lex_status status = lex_status::failed;
+                switch (m_lexeme)
+                {
+                    case lexeme::number:
+                        status = lex_number();
+                        break;
+                    case lexeme::literal:
+                        status = lex_literal();
+                        break;
+                    default:
+                        status = lex_string();
+                        break;
+                }
+
+                if (lex_status::token == status)
+                {
+                    return token_event();
+                }
+                if (lex_status::failed == status)
+                {
+                    return fail("Invalid or oversized token");
+                }
+                if (m_finished)
+                {
+                    return fail("Unexpected end of input");
+                }
+                return json_event { json_event_type::need_input, {} };
+            }
+
+            if (m_pos == m_size)
+            {
+                if (expect::done == m_expect)
+                {
+                    return json_event { json_event_type::end_of_document, {} };
+                }
+                if (m_finished)
+                {
+                    return fail("Unexpected end of input");
+                }
+                return json_event { json_event_type::need_input, {} };
+            }
+
+            const char character = m_input[m_pos]; // NOLINT chunk access
+            if (is_whitespace(character))
+            {
+                ++m_pos;
+                ++m_offset;
+                continue;
+            }
+
+            if (expect::done == m_expect)
+            {
+                // stop in front of trailing bytes, the root value is complete
+                return json_event { json_event_type::end_of_document, {} };
+            }
+
+            const bool value_expected = (expect::value == m_expect) || (expect::value_or_end_array == m_expect);
+            const bool key_expected = (expect::key == m_expect) || (expect::key_or_end_object == m_expect);
+            ++m_pos;
+            ++m_offset;
+
+            switch (character)
+            {
+                case '{':
+                case '[':
+                    if (!value_expected)
+                    {
+                        return fail("Unexpected container");
+                    }
+                    if (!push_container(character))
+                    {
+                        return fail("Nesting too deep");
+                    }
+                    m_expect = ('{' == character) ? expect::key_or_end_object : expect::value_or_end_array;
+                    return json_event { ('{' == character) ? json_event_type::begin_object
+                                                           : json_event_type::begin_array,
+                        {} };
+
+                case '}':
+                case ']':
+                {
+                    const char open = ('}' == character) ? '{' : '[';
+                    const bool empty_close = ('}' == character) ? (expect::key_or_end_object == m_expect)
+                                                                : (expect::value_or_end_array == m_expect);
+                    if ((!empty_close && (expect::comma_or_end != m_expect)) || m_stack.empty()
+                        || (m_stack.back() != open))
+                    {
+                        return fail("Unexpected container end");
+                    }
+                    m_stack.pop_back();
+                    after_value();
+                    return json_event { ('}' == character) ? json_event_type::end_object : json_event_type::end_array,
+                        {} };
+                }
+
+                case ':':
+                    if (expect::colon != m_expect)
+                    {
+                        return fail("Unexpected colon");
+                    }
+                    m_expect = expect::value;
+                    continue;
+
+                case ',':
+                    if (expect::comma_or_end != m_expect)
+                    {
+                        return fail("Unexpected comma");
+                    }
+                    m_expect = ('{' == m_stack.back()) ? expect::key : expect::value;
+                    continue;
+
+                case '"':
+                    if (!value_expected && !key_expected)
+                    {
+                        return fail("Unexpected string");
+                    }
+                    m_token.clear();
+                    m_string_is_key = key_expected;
+                    m_lexeme = lexeme::string;
+                    continue;
+
+                default:
+                    break;
+            }
+
+            if (!value_expected)
+            {
+                return fail("Unexpected character");
+            }
+
+            m_token.clear();
+            if (('-' == character) || is_digit(character))
+            {
+                m_token.push_back(character);
+                m_lexeme = lexeme::number;
+            }
+            else if (('t' == character) || ('f' == character) || ('n' == character))
+            {
+                m_literal = ('t' == character) ? literal_true : (('f' == character) ? literal_false : literal_null);
+                m_token.push_back(character);
+                m_lexeme = lexeme::literal;
+            }
+            else
+            {
+                return fail("Unexpected character");
+            }
+        }
+    }
+
+    json_path_extractor::json_path_extractor(std::initializer_list<std::string> paths, const json_stream_limits& limits)
+        : json_path_extractor(std::vector<std::string>(paths), limits)
+    {
+    }
+
+    json_path_extractor::json_path_extractor(std::vector<std::string> paths, const json_stream_limits& limits)
+        : m_parser(limits)
+        , m_paths(std::move(paths))
+        , m_fields(m_paths.size())
+    {
+        m_frames.reserve(limits.max_depth);
+        m_path.reserve(limits.max_depth * 8U);
+    }
+
+    void json_path_extractor::enter_value()
+    {
+        if (!m_frames.empty() && m_frames.back().is_array)
+        {
+            frame& parent = m_frames.back();
+            m_path.resize(parent.base_length);
+            m_path.push_back('[');
+            m_path.append(std::to_string(parent.next_index));
+            m_path.push_back(']');
+            ++parent.next_index;
+        }
+    }
+
+    void json_path_extractor::capture(const json_event& event)
+    {
+        for (std::size_t index = 0U; index < m_paths.size(); ++index)
+        {
+            if (!m_fields[index].has_value() && (m_paths[index] == m_path))
+            {
+                m_fields[index] = json_field { event.type, std::string(event.text) };
+                ++m_found;
+            }
+        }
+    }
+
+    cjsonpp_status json_path_extractor::feed(const char* data, std::size_t size)
+    {
+        if (m_error.has_value())
+        {
+            return tools::unexpected<result_error> { m_error.value() };
+        }
+        if (done())
+        {
+            return cjsonpp_status {};
+        }
+
+        m_parser.feed(data, size);
+        while (!complete())
+        {
+            auto event = m_parser.next();
+            if (!event.has_value())
+            {
+                m_error = event.error();
+                return tools::unexpected<result_error> { event.error() };
+            }
+
+            const json_event& current = event.value();
+            switch (current.type)
+            {
+                case json_event_type::need_input:
+                    return cjsonpp_status {};
+
+                case json_event_type::end_of_document:
+                    m_document_done = true;
+                    return cjsonpp_status {};
+
+                case json_event_type::begin_object:
+                case json_event_type::begin_array:
+                    enter_value();
+                    m_frames.push_back(frame { json_event_type::begin_array == current.type, m_path.size(), 0U });
+                    break;
+
+                case json_event_type::end_object:
+                case json_event_type::end_array:
+                    m_frames.pop_back();
+                    break;
+
+                case json_event_type::key:
+                    m_path.resize(m_frames.back().base_length);
+                    if (!m_path.empty())
+                    {
+                        m_path.push_back('.');
+                    }
+                    m_path.append(current.text);
+                    break;
+
+                default:
+                    enter_value();
+                    capture(current);
+                    break;
+            }
+        }
+
+        return cjsonpp_status {};
+    }
+
+    cjsonpp_status json_path_extractor::finish()
+    {
+        if (done())
+        {
+            return cjsonpp_status {};
+        }
+
+        m_parser.finish();
+        auto status = feed(nullptr, 0U);
+        if (status && !done())
+        {
+            return tools::unexpected<result_error> { result_error {
+                result_code::parse_error, static_cast<int>(m_parser.offset()), "Unexpected end of input" } };
+        }
+        return status;
+    }
+
+    std::optional<long long> json_path_extractor::to_integer(const json_field& captured)
+    {
+        if ((json_event_type::number != captured.type)
+            || (captured.text.find_first_of(".eE") != std::string::npos))
+        {
+            return std::nullopt;
+        }
+
+        errno = 0;
+        char* end = nullptr;
+        const long long value = std::strtoll(captured.text.c_str(), &end, 10);
+        if ((0 != errno) || (end != (captured.text.c_str() + captured.text.size()))) // NOLINT pointer arithmetic
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    std::optional<double> json_path_extractor::to_floating(const json_field& captured)
+    {
+        if (json_event_type::number != captured.type)
+        {
+            return std::nullopt;
+        }
+
+        double value = 0.0;
+        const auto* text = reinterpret_cast<const unsigned char*>(captured.text.data()); // NOLINT reinterpret_cast
+        const std::size_t consumed = cJSON_fast_parse_number(text, captured.text.size(), &value);
+        if ((consumed != 0U) && (consumed == captured.text.size()))
+        {
+            return value;
+        }
+
+        char* end = nullptr;
+        value = std::strtod(captured.text.c_str(), &end);
+        if (end != (captured.text.c_str() + captured.text.size())) // NOLINT pointer arithmetic
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+} // namespace cjsonpp
@@ -0,0 +1,404 @@
+/**
+ * @file json_stream_parser.hpp
+ * @brief Bounded-memory pull parser and path extractor for JSON documents fed in chunks.
+ *
+ * Unlike parse_result(), which builds a whole cJSON tree, these classes tokenize the input as it arrives
+ * and never hold more than one token, the container stack and the current path.
+ */
+
+#pragma once
+
+#ifndef CJSONPP_JSON_STREAM_PARSER_HPP_
+#define CJSONPP_JSON_STREAM_PARSER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "cjsonpp/cjsonpp_result.hpp"
+
+namespace cjsonpp
+{
+
+    /**
+     * @brief Kind of event returned by json_pull_parser::next().
+     */
+    enum class json_event_type : std::uint8_t
+    {
+        /** @brief `{` */
+        begin_object,
+        /** @brief `}` */
+        end_object,
+        /** @brief `[` */
+        begin_array,
+        /** @brief `]` */
+        end_array,
+        /** @brief Object member name, unescaped. */
+        key,
+        /** @brief String value, unescaped. */
+        string,
+        /** @brief Number value, as written in the document. */
+        number,
+        /** @brief `true` or `false`. */
+        boolean,
+        /** @brief `null` */
+        null,
+        /** @brief The current chunk is exhausted: feed() the next one, or finish(). */
+        need_input,
+        /** @brief The root value is complete. */
+        end_of_document
+    };
+
+    /**
+     * @brief Event produced by json_pull_parser.
+     */
+    struct json_event
+    {
+        /** @brief Kind of event. */
+        json_event_type type = json_event_type::need_input;
+        /** @brief Token text for keys and scalars, valid until the next call to the parser. */
+        std::string_view text;
+    };
+
+    /**
+     * @brief Memory bounds of the streaming parser.
+     */
+    struct json_stream_limits
+    {
+        /** @brief Longest string, key or number accepted, in bytes after unescaping. */
+        std::size_t max_token_length = 256U;
+        /** @brief Deepest nesting of objects and arrays accepted. */
+        std::size_t max_depth = 32U;
+    };
+
+    /**
+     * @brief Pull tokenizer over a JSON document delivered in arbitrary chunks.
+     *
+     * feed() hands a chunk to the parser, which keeps a pointer to it: the chunk must stay valid until
+     * next() returns need_input. Tokens split across chunks are reassembled in an internal buffer reserved
+     * once at construction, so the parser never allocates while parsing. Exceeding a limit or a syntax
+     * error latches a parse_error result.
+     */
+    class json_pull_parser
+    {
+    public:
+        /**
+         * @brief Constructs a parser.
+         * @param limits Memory bounds (token length, nesting depth).
+         */
+        explicit json_pull_parser(const json_stream_limits& limits = json_stream_limits {});
+
+        /**
+         * @brief Provides the next chunk of the document.
+         * @param data Chunk bytes, kept until next() returns need_input.
+         * @param size Chunk size.
+         */
+        void feed(const char* data, std::size_t size);
+
+        /**
+         * @brief Tells the parser no more input will come (completes a trailing root number).
+         */
+        void finish();
+
+        /**
+         * @brief Returns the next event of the document.
+         * @return The event, or the parse error.
+         */
+        cjsonpp_result<json_event> next();
+
+        /**
+         * @brief Restarts on a new document, keeping the reserved buffers.
+         */
+        void reset();
+
+        /**
+         * @brief Returns the current nesting depth.
+         * @return Number of open objects and arrays.
+         */
+        [[nodiscard]] std::size_t depth() const
+        {
+            return m_stack.size();
+        }
+
+        /**
+         * @brief Returns the number of document bytes consumed so far.
+         * @return Offset of the next unread byte from the start of the document.
+         */
+        [[nodiscard]] std::size_t offset() const
+        {
+            return m_offset;
+        }
+
+    private:
+        enum class expect : std::uint8_t
+        {
+            value,
+            value_or_end_array,
+            key_or_end_object,
+            key,
+            colon,
+            comma_or_end,
+            done
+        };
+
+        enum class lexeme : std::uint8_t
+        {
+            none,
+            string,
+            string_escape,
+            string_unicode,
+            number,
+            literal
+        };
+
+        enum class lex_status : std::uint8_t
+        {
+            token,
+            need_input,
+            failed
+        };
+
+        lex_status lex_string();
+        lex_status lex_number();
+        lex_status lex_literal();
+        bool append(char character);
+        bool append_code_point(std::uint32_t code_point);
+        bool push_container(char kind);
+        void after_value();
+        cjsonpp_result<json_event> fail(const char* message);
+        json_event token_event();
+
+        json_stream_limits m_limits;
+        const char* m_input = nullptr;
+        std::size_t m_size = 0U;
+        std::size_t m_pos = 0U;
+        std::size_t m_offset = 0U;
+        bool m_finished = false;
+        bool m_string_is_key = false;
+        expect m_expect = expect::value;
+        lexeme m_lexeme = lexeme::none;
+        std::uint32_t m_unicode = 0U;
+        std::uint32_t m_unicode_digits = 0U;
+        std::uint32_t m_high_surrogate = 0U;
+        const char* m_literal = nullptr;
+        std::string m_token;
+        std::vector<char> m_stack;
+        std::optional<result_error> m_error;
+    };
+
+    /**
+     * @brief Scalar captured by json_path_extractor.
+     */
+    struct json_field
+    {
+        /** @brief string, number, boolean or null. */
+        json_event_type type = json_event_type::null;
+        /** @brief Unescaped string, or the number/literal text. */
+        std::string text;
+    };
+
+    /**
+     * @brief Extracts scalar fields by path from a JSON document fed in chunks, without building a tree.
+     *
+     * Paths use dots between object keys and brackets for array indices, relative to the root value:
+     * `"device.id"`, `"sensors[2].value"`, `"[0]"`. Only scalar values (string, number, boolean, null) are
+     * captured; the first occurrence wins. Keys containing `.` or `[` cannot be addressed. Once every path
+     * has been found the remaining input is skipped.
+     *
+     * Memory is bounded by the limits (one token, the container stack, the current path) plus the captured
+     * fields themselves.
+     */
+    class json_path_extractor
+    {
+    public:
+        /**
+         * @brief Constructs an extractor for a set of paths.
+         * @param paths Paths to capture, addressed later by their position in this list.
+         * @param limits Memory bounds of the underlying parser.
+         */
+        explicit json_path_extractor(
+            std::initializer_list<std::string> paths, const json_stream_limits& limits = json_stream_limits {});
+
+        /**
+         * @brief Constructs an extractor for a set of paths.
+         * @param paths Paths to capture, addressed later by their position in this list.
+         * @param limits Memory bounds of the underlying parser.
+         */
+        explicit json_path_extractor(
+            std::vector<std::string> paths, const json_stream_limits& limits = json_stream_limits {});
+
+        /**
+         * @brief Processes the next chunk of the document.
+         * @param data Chunk bytes, only read during the call.
+         * @param size Chunk size.
+         * @return Success, or the parse error (latched).
+         */
+        cjsonpp_status feed(const char* data, std::size_t size);
+
+        /**
+         * @brief Signals the end of the input.
+         * @return Success when the document was complete (or every path was found), parse_error otherwise.
+         */
+        cjsonpp_status finish();
+
+        /**
+         * @brief Pulls the document from a byte source such as tools::memory_pipe until it is complete.
+         *
+         * The source must provide `std::size_t receive(std::uint8_t*, std::size_t, timeout)`. The stream is
+         * expected to carry this one document: bytes received past its end are ignored.
+         *
+         * @param source Byte source.
+         * @param chunk Scratch buffer receiving each chunk.
+         * @param chunk_size Size of the scratch buffer.
+         * @param timeout Maximum wait for each chunk.
+         * @return Success once the document is complete or every path was found, parse_error if the source
+         *         stalls first or the document is malformed.
+         */
+        template <typename Source>
+        cjsonpp_status feed_from(Source& source, std::uint8_t* chunk, std::size_t chunk_size,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            while (!done())
+            {
+                const std::size_t received = source.receive(chunk, chunk_size, timeout);
+                if (0U == received)
+                {
+                    return tools::unexpected<result_error> { result_error {
+                        result_code::parse_error, static_cast<int>(m_parser.offset()), "Input stalled" } };
+                }
+
+                auto status = feed(reinterpret_cast<const char*>(chunk), received); // NOLINT bytes as chars
+                if (!status)
+                {
+                    return status;
+                }
+            }
+            return cjsonpp_status {};
+        }
+
+        /**
+         * @brief Tells whether every path has been found.
+         * @return true when all fields are captured.
+         */
+        [[nodiscard]] bool complete() const
+        {
+            return m_found == m_paths.size();
+        }
+
+        /**
+         * @brief Tells whether the extractor needs no more input.
+         * @return true when every path has been found or the document ended.
+         */
+        [[nodiscard]] bool done() const
+        {
+            return complete() || m_document_done;
+        }
+
+        /**
+         * @brief Returns a captured field.
+         * @param index Position of the path in the constructor list.
+         * @return The field, or std::nullopt if the path has not been found.
+         */
+        [[nodiscard]] const std::optional<json_field>& field(std::size_t index) const
+        {
+            return m_fields.at(index);
+        }
+
+        /**
+         * @brief Returns a captured field converted to T (bool, an arithmetic type, or std::string).
+         * @param index Position of the path in the constructor list.
+         * @return The value, missing_item if not found, invalid_type if the field does not convert to T.
+         */
+        template <typename T>
+        cjsonpp_result<T> get(std::size_t index) const
+        {
+            if ((index >= m_fields.size()) || !m_fields[index].has_value())
+            {
+                return tools::unexpected<result_error> { result_error {
+                    result_code::missing_item, static_cast<int>(index), "No such field" } };
+            }
+
+            const json_field& captured = m_fields[index].value();
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                if (json_event_type::string == captured.type)
+                {
+                    return captured.text;
+                }
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                if (json_event_type::boolean == captured.type)
+                {
+                    return captured.text == "true";
+                }
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                auto value = to_integer(captured);
+                if (value.has_value())
+                {
+                    const long long number = value.value();
+                    const bool in_range = std::is_unsigned_v<T>
+                        ? ((number >= 0)
+                            && (static_cast<unsigned long long>(number)
+                                <= static_cast<unsigned long long>(std::numeric_limits<T>::max())))
+                        : ((number >= static_cast<long long>(std::numeric_limits<T>::min()))
+                            && (number <= static_cast<long long>(std::numeric_limits<T>::max())));
+                    if (in_range)
+                    {
+                        return static_cast<T>(number);
+                    }
+                }
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                auto value = to_floating(captured);
+                if (value.has_value())
+                {
+                    return static_cast<T>(value.value());
+                }
+            }
+            else
+            {
+                static_assert(std::is_same_v<T, std::string>, "unsupported field type");
+            }
+
+            return tools::unexpected<result_error> { result_error {
+                result_code::invalid_type, static_cast<int>(captured.type), "Field does not convert to the type" } };
+        }
+
+    private:
+        /** @brief Path frame of an open container. */
+        struct frame
+        {
+            bool is_array = false;
+            std::size_t base_length = 0U;
+            std::size_t next_index = 0U;
+        };
+
+        void enter_value();
+        void capture(const json_event& event);
+        static std::optional<long long> to_integer(const json_field& captured);
+        static std::optional<double> to_floating(const json_field& captured);
+
+        json_pull_parser m_parser;
+        std::vector<std::string> m_paths;
+        std::vector<std::optional<json_field>> m_fields;
+        std::size_t m_found = 0U;
+        std::string m_path;
+        std::vector<frame> m_frames;
+        bool m_document_done = false;
+        std::optional<result_error> m_error;
+    };
+
+} // namespace cjsonpp
+
+#endif // CJSONPP_JSON_STREAM_PARSER_HPP_
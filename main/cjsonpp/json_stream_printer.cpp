@@ -0,0 +1,394 @@
+/**
+ * @file json_stream_printer.cpp
+ * @brief Bounded-memory printer writing a cJSON tree in chunks to a pipe, a caller buffer or a callback.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "cJSON/cJSON.h"
+#include "cJSON/cJSON_number.h"
+#include "cjsonpp/json_stream_printer.hpp"
+
+namespace cjsonpp
+{
+    namespace
+    {
+        constexpr int byte_mask = 0xff;
+        constexpr unsigned char first_printable = 32U;
+
+        tools::unexpected<result_error> refused_error()
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, 0, "Output refused or buffer too small") };
+        }
+
+        /** @brief The sprintf() fallback of cJSON's print_number() when the fast path declines. */
+        int print_number_fallback(double value, char* buffer, std::size_t size)
+        {
+            double test = 0.0;
+            int length = std::snprintf(buffer, size, "%1.15g", value);
+            if ((std::sscanf(buffer, "%lg", &test) != 1)
+                || (std::fabs(test - value) > (std::max(std::fabs(test), std::fabs(value)) * DBL_EPSILON)))
+            {
+                length = std::snprintf(buffer, size, "%1.17g", value);
+            }
+
+            // cJSON always prints '.', whatever the locale
+            const char decimal_point = (nullptr != std::localeconv()) ? *std::localeconv()->decimal_point : '.';
+            for (int index = 0; index < length; ++index)
+            {
+                if (decimal_point == buffer[index]) // NOLINT bounded index
+                {
+                    buffer[index] = '.'; // NOLINT bounded index
+                }
+            }
+            return length;
+        }
+    } // namespace
+
+    json_stream_printer::json_stream_printer(std::size_t scratch_size)
+        : m_owned(scratch_size)
+        , m_scratch(m_owned.data())
+        , m_scratch_size(scratch_size)
+    {
+    }
+
+    json_stream_printer::json_stream_printer(char* scratch, std::size_t scratch_size) noexcept
+        : m_scratch(scratch)
+        , m_scratch_size((nullptr != scratch) ? scratch_size : 0U)
+    {
+    }
+
+    cjsonpp_result<std::size_t> json_stream_printer::print(
+        const cJSON* item, bool formatted, json_chunk_writer writer)
+    {
+        if (0U == m_scratch_size)
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, 0, "Empty scratch buffer") };
+        }
+
+        auto status = print_tree(item, formatted, writer);
+        if (status && !flush())
+        {
+            status = refused_error();
+        }
+        m_writer = nullptr;
+        if (!status)
+        {
+            return tools::unexpected<result_error> { status.error() };
+        }
+        return m_written;
+    }
+
+    cjsonpp_result<std::size_t> json_stream_printer::print_to(
+        const JSONObject& object, bool formatted, char* buffer, std::size_t size)
+    {
+        if ((nullptr == buffer) || (0U == size))
+        {
+            return tools::unexpected<result_error> { make_error(result_code::invalid_argument, 0, "Empty buffer") };
+        }
+
+        // the buffer stands in for the scratch: it must never need a flush
+        auto refuse = [](const char* /*data*/, std::size_t /*size*/) { return false; };
+        const json_chunk_writer writer(refuse);
+        char* const scratch = m_scratch;
+        const std::size_t scratch_size = m_scratch_size;
+        m_scratch = buffer;
+        m_scratch_size = size - 1U;
+
+        auto status = print_tree(object.obj(), formatted, writer);
+        const std::size_t length = m_used;
+        m_scratch = scratch;
+        m_scratch_size = scratch_size;
+        m_used = 0U;
+        m_writer = nullptr;
+
+        if (!status)
+        {
+            return tools::unexpected<result_error> { status.error() };
+        }
+        buffer[length] = '\0'; // NOLINT bounded index
+        return length;
+    }
+
+    cjsonpp_status json_stream_printer::print_tree(const cJSON* item, bool formatted, const json_chunk_writer& writer)
+    {
+        m_used = 0U;
+        m_written = 0U;
+        m_formatted = formatted;
+        m_writer = &writer;
+        if (nullptr == item)
+        {
+            return tools::unexpected<result_error> { make_error(result_code::invalid_argument, 0, "Null item") };
+        }
+        return print_value(item, 0U);
+    }
+
+    bool json_stream_printer::flush()
+    {
+        if (0U == m_used)
+        {
+            return true;
+        }
+        if (!(*m_writer)(m_scratch, m_used))
+        {
+            return false;
+        }
+        m_written += m_used;
+        m_used = 0U;
+        return true;
+    }
+
+    bool json_stream_printer::put(const char* data, std::size_t size)
+    {
+        while (size > 0U)
+        {
+            if ((m_used == m_scratch_size) && ((0U == m_used) || !flush()))
+            {
+                return false;
+            }
+            const std::size_t count = std::min(size, m_scratch_size - m_used);
+            std::memcpy(m_scratch + m_used, data, count); // NOLINT pointer arithmetic
+            m_used += count;
+            data += count; // NOLINT pointer arithmetic
+            size -= count;
+        }
+        return true;
+    }
+
+    bool json_stream_printer::put(char character)
+    {
+        if ((m_used == m_scratch_size) && ((0U == m_used) || !flush()))
+        {
+            return false;
+        }
+        m_scratch[m_used++] = character; // NOLINT pointer arithmetic
+        return true;
+    }
+
+    cjsonpp_status json_stream_printer::print_value(const cJSON* item, std::size_t depth)
+    {
+        bool written = false;
+        switch (item->type & byte_mask)
+        {
+            case cJSON_NULL:
+                written = put("null", 4U);
+                break;
+            case cJSON_False:
+                written = put("false", 5U);
+                break;
+            case cJSON_True:
+                written = put("true", 4U);
+                break;
+            case cJSON_Number:
+                return print_number(item);
+            case cJSON_Raw:
+                if (nullptr == item->valuestring)
+                {
+                    return tools::unexpected<result_error> { make_error(
+                        result_code::invalid_type, cJSON_Raw, "Raw item without text") };
+                }
+                written = put(item->valuestring, std::strlen(item->valuestring));
+                break;
+            case cJSON_String:
+                return print_string(item->valuestring);
+            case cJSON_Array:
+                return print_array(item, depth + 1U);
+            case cJSON_Object:
+                return print_object(item, depth + 1U);
+            default:
+                return tools::unexpected<result_error> { make_error(
+                    result_code::invalid_type, item->type & byte_mask, "Item cannot be printed") };
+        }
+        return written ? cjsonpp_status {} : cjsonpp_status { refused_error() };
+    }
+
+    cjsonpp_status json_stream_printer::print_number(const cJSON* item)
+    {
+        // same choices as cJSON's print_number()
+        char text[CJSON_NUMBER_BUFFER_SIZE] = {}; // NOLINT C array shared with the C helpers
+        auto* digits = reinterpret_cast<unsigned char*>(text); // NOLINT bytes as chars
+        const double value = item->valuedouble;
+        int length = 0;
+        if (std::isnan(value) || std::isinf(value))
+        {
+            std::memcpy(text, "null", 4U);
+            length = 4;
+        }
+        else if (value == static_cast<double>(item->valueint))
+        {
+            length = cJSON_fast_print_int(item->valueint, digits);
+        }
+        else if ((length = cJSON_fast_print_number(value, digits)) < 0)
+        {
+            length = print_number_fallback(value, text, sizeof(text));
+        }
+
+        if ((length < 0) || (length > static_cast<int>(sizeof(text) - 1U)))
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::internal_error, length, "Number formatting failed") };
+        }
+        return put(text, static_cast<std::size_t>(length)) ? cjsonpp_status {} : cjsonpp_status { refused_error() };
+    }
+
+    cjsonpp_status json_stream_printer::print_string(const char* text)
+    {
+        if (!put('\"'))
+        {
+            return refused_error();
+        }
+
+        if (nullptr != text)
+        {
+            const auto* input = reinterpret_cast<const unsigned char*>(text); // NOLINT chars as bytes
+            const unsigned char* run = input;
+            for (; '\0' != *input; ++input) // NOLINT pointer arithmetic
+            {
+                const unsigned char character = *input;
+                if ((character >= first_printable) && ('\"' != character) && ('\\' != character))
+                {
+                    continue;
+                }
+
+                // copy the run of plain characters, then the escape sequence
+                char escape[7] = { '\\', 0, 0, 0, 0, 0, 0 }; // NOLINT C array for snprintf
+                std::size_t escape_length = 2U;
+                switch (character)
+                {
+                    case '\\':
+                        escape[1] = '\\';
+                        break;
+                    case '\"':
+                        escape[1] = '\"';
+                        break;
+                    case '\b':
+                        escape[1] = 'b';
+                        break;
+                    case '\f':
+                        escape[1] = 'f';
+                        break;
+                    case '\n':
+                        escape[1] = 'n';
+                        break;
+                    case '\r':
+                        escape[1] = 'r';
+                        break;
+                    case '\t':
+                        escape[1] = 't';
+                        break;
+                    default:
+                        std::snprintf(escape + 1, sizeof(escape) - 1U, "u%04x", character); // NOLINT pointer arithmetic
+                        escape_length = 6U;
+                        break;
+                }
+                if (!put(reinterpret_cast<const char*>(run), static_cast<std::size_t>(input - run)) // NOLINT
+                    || !put(escape, escape_length))
+                {
+                    return refused_error();
+                }
+                run = input + 1; // NOLINT pointer arithmetic
+            }
+            if (!put(reinterpret_cast<const char*>(run), static_cast<std::size_t>(input - run))) // NOLINT
+            {
+                return refused_error();
+            }
+        }
+
+        return put('\"') ? cjsonpp_status {} : cjsonpp_status { refused_error() };
+    }
+
+    cjsonpp_status json_stream_printer::print_array(const cJSON* item, std::size_t depth)
+    {
+        if (depth > CJSON_NESTING_LIMIT)
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, static_cast<int>(depth), "Nesting too deep") };
+        }
+        if (!put('['))
+        {
+            return refused_error();
+        }
+
+        for (const cJSON* child = item->child; nullptr != child; child = child->next)
+        {
+            auto status = print_value(child, depth);
+            if (!status)
+            {
+                return status;
+            }
+            if ((nullptr != child->next) && (!put(',') || (m_formatted && !put(' '))))
+            {
+                return refused_error();
+            }
+        }
+
+        return put(']') ? cjsonpp_status {} : cjsonpp_status { refused_error() };
+    }
+
+    cjsonpp_status json_stream_printer::print_object(const cJSON* item, std::size_t depth)
+    {
+        const auto indent = [this](std::size_t count)
+        {
+            for (std::size_t tab = 0U; tab < count; ++tab)
+            {
+                if (!put('\t'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        if (depth > CJSON_NESTING_LIMIT)
+        {
+            return tools::unexpected<result_error> { make_error(
+                result_code::invalid_argument, static_cast<int>(depth), "Nesting too deep") };
+        }
+        if (!put('{') || (m_formatted && !put('\n')))
+        {
+            return refused_error();
+        }
+
+        for (const cJSON* child = item->child; nullptr != child; child = child->next)
+        {
+            if (m_formatted && !indent(depth))
+            {
+                return refused_error();
+            }
+            auto status = print_string(child->string);
+            if (!status)
+            {
+                return status;
+            }
+            if (!put(':') || (m_formatted && !put('\t')))
+            {
+                return refused_error();
+            }
+            status = print_value(child, depth);
+            if (!status)
+            {
+                return status;
+            }
+            if (((nullptr != child->next) && !put(',')) || (m_formatted && !put('\n')))
+            {
+                return refused_error();
+            }
+        }
+
+        if (m_formatted && !indent(depth - 1U))
+        {
+            return refused_error();
+        }
+        return put('}') ? cjsonpp_status {} : cjsonpp_status { refused_error() };
+    }
+
+} // namespace cjsonpp
@@ -0,0 +1,172 @@
+/**
+ * @file json_stream_printer.hpp
+ * @brief Bounded-memory printer writing a cJSON tree in chunks to a pipe, a caller buffer or a callback.
+ *
+ * JSONObject::print() renders the whole document into one malloc'd string and copies it into a std::string.
+ * json_stream_printer walks the tree instead and hands out the text through a scratch buffer of fixed size,
+ * so that sending a document of any size takes constant memory. The text is the one cJSON_Print() or
+ * cJSON_PrintUnformatted() would produce.
+ */
+
+#pragma once
+
+#ifndef CJSONPP_JSON_STREAM_PRINTER_HPP_
+#define CJSONPP_JSON_STREAM_PRINTER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cJSON/cJSON.h"
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/cjsonpp_result.hpp"
+
+namespace cjsonpp
+{
+
+    /**
+     * @brief Non-owning reference to a callable `bool(const char* data, std::size_t size)` receiving printed chunks.
+     *
+     * The callable returns false to stop the printing. It must outlive the json_chunk_writer.
+     */
+    class json_chunk_writer
+    {
+    public:
+        /**
+         * @brief Refers to a writer callable.
+         * @param writer Callable taking a chunk and its size, returning whether it was accepted.
+         */
+        template <typename Writer>
+        explicit json_chunk_writer(Writer& writer) noexcept
+            : m_context(&writer)
+            , m_write([](void* context, const char* data, std::size_t size)
+                  { return static_cast<bool>((*static_cast<Writer*>(context))(data, size)); })
+        {
+        }
+
+        /**
+         * @brief Hands one chunk to the writer.
+         * @param data Chunk bytes.
+         * @param size Chunk size.
+         * @return false when the writer refused the chunk.
+         */
+        bool operator()(const char* data, std::size_t size) const
+        {
+            return m_write(m_context, data, size);
+        }
+
+    private:
+        void* m_context;
+        bool (*m_write)(void*, const char*, std::size_t);
+    };
+
+    /**
+     * @brief Prints JSON documents through a fixed scratch buffer, flushed to the destination whenever it fills.
+     *
+     * Memory stays bounded by the scratch buffer and the recursion over the nesting depth; strings are escaped
+     * as they are copied and never held whole. One printer can be reused for many documents, not concurrently.
+     */
+    class json_stream_printer
+    {
+    public:
+        /** @brief Size of the scratch buffer the default constructor allocates. */
+        static constexpr std::size_t default_scratch_size = 256U;
+
+        /**
+         * @brief Creates a printer owning a scratch buffer.
+         * @param scratch_size Scratch buffer size, at least one byte: the size of each chunk but the last.
+         */
+        explicit json_stream_printer(std::size_t scratch_size = default_scratch_size);
+
+        /**
+         * @brief Creates a printer over a caller scratch buffer, without any allocation.
+         * @param scratch Scratch buffer, kept by the caller while the printer is in use.
+         * @param scratch_size Scratch buffer size, at least one byte.
+         */
+        json_stream_printer(char* scratch, std::size_t scratch_size) noexcept;
+
+        json_stream_printer(const json_stream_printer&) = delete;
+        json_stream_printer& operator=(const json_stream_printer&) = delete;
+        json_stream_printer(json_stream_printer&&) = delete;
+        json_stream_printer& operator=(json_stream_printer&&) = delete;
+        ~json_stream_printer() = default;
+
+        /**
+         * @brief Prints an item in chunks of at most the scratch size.
+         * @param item cJSON item.
+         * @param formatted If true, the text is indented like cJSON_Print().
+         * @param writer Destination of the chunks.
+         * @return Number of bytes written, invalid_argument if the writer refused a chunk, the scratch buffer is
+         *         empty or the nesting exceeds CJSON_NESTING_LIMIT, invalid_type for an item cJSON cannot print.
+         */
+        cjsonpp_result<std::size_t> print(const cJSON* item, bool formatted, json_chunk_writer writer);
+
+        /**
+         * @brief Prints a document in chunks of at most the scratch size.
+         * @param object JSON document.
+         * @param formatted If true, the text is indented like cJSON_Print().
+         * @param writer Destination of the chunks.
+         * @return See print(const cJSON*, bool, json_chunk_writer).
+         */
+        cjsonpp_result<std::size_t> print(const JSONObject& object, bool formatted, json_chunk_writer writer)
+        {
+            return print(object.obj(), formatted, writer);
+        }
+
+        /**
+         * @brief Prints a document into a byte pipe such as tools::memory_pipe.
+         * @param object JSON document.
+         * @param formatted If true, the text is indented like cJSON_Print().
+         * @param pipe Destination with `std::size_t send(const std::uint8_t*, std::size_t, timeout)`.
+         * @param timeout Maximum wait for each chunk.
+         * @return See print(const cJSON*, bool, json_chunk_writer); a chunk not fully sent in time is refused.
+         */
+        template <typename Pipe>
+        cjsonpp_result<std::size_t> print_to(const JSONObject& object, bool formatted, Pipe& pipe,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            auto send = [&pipe, &timeout](const char* data, std::size_t size)
+            {
+                return size
+                    == pipe.send(reinterpret_cast<const std::uint8_t*>(data), size, timeout); // NOLINT chars as bytes
+            };
+            return print(object.obj(), formatted, json_chunk_writer(send));
+        }
+
+        /**
+         * @brief Prints a document straight into a caller buffer, without using the scratch buffer.
+         *
+         * Unlike JSONObject::print(char*, std::size_t, bool) the size is exact: no margin is needed.
+         *
+         * @param object JSON document.
+         * @param formatted If true, the text is indented like cJSON_Print().
+         * @param buffer Destination, receives a NUL-terminated string.
+         * @param size Size of the destination in bytes.
+         * @return Length of the text, or invalid_argument if it does not fit with its terminator.
+         */
+        cjsonpp_result<std::size_t> print_to(const JSONObject& object, bool formatted, char* buffer, std::size_t size);
+
+    private:
+        cjsonpp_status print_tree(const cJSON* item, bool formatted, const json_chunk_writer& writer);
+        bool put(const char* data, std::size_t size);
+        bool put(char character);
+        bool flush();
+        cjsonpp_status print_value(const cJSON* item, std::size_t depth);
+        cjsonpp_status print_string(const char* text);
+        cjsonpp_status print_number(const cJSON* item);
+        cjsonpp_status print_array(const cJSON* item, std::size_t depth);
+        cjsonpp_status print_object(const cJSON* item, std::size_t depth);
+
+        std::vector<char> m_owned;
+        char* m_scratch = nullptr;
+        std::size_t m_scratch_size = 0U;
+        std::size_t m_used = 0U;
+        std::size_t m_written = 0U;
+        bool m_formatted = false;
+        const json_chunk_writer* m_writer = nullptr;
+    };
+
+} // namespace cjsonpp
+
+#endif // CJSONPP_JSON_STREAM_PRINTER_HPP_
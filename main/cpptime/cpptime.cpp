@@ -203,6 +203,33 @@ namespace CppTime
         return true;
     }
 
+    bool Timer::reschedule(timer_id tid, const timestamp& when, const duration& period)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if ((events.size() <= tid) || !events.at(tid).valid)
+        {
+            return false;
+        }
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        auto itr = std::ranges::find_if(time_events, [&](const detail::Time_event& tev) { return tev.ref == tid; });
+#else
+        auto itr = std::find_if(
+            time_events.begin(), time_events.end(), [&](const detail::Time_event& tev) { return tev.ref == tid; });
+#endif
+        if (itr == time_events.end())
+        {
+            return false; // the handler is running, run() re-inserts or frees it
+        }
+
+        auto node = time_events.extract(itr);
+        node.value().next = when;
+        time_events.insert(std::move(node));
+        events.at(tid).period = period;
+        lock.unlock();
+        cond.notify_all();
+        return true;
+    }
+
     void Timer::run()
     {
         std::unique_lock<std::mutex> lock(mutex);
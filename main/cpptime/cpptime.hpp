@@ -261,6 +261,17 @@ namespace CppTime
          */
         bool remove(timer_id tid);
 
+        /**
+         * Moves the next timeout of a timer and sets its period, keeping its id and
+         * its handler; the multiset node is reused instead of reallocated.
+         *
+         * \param tid The timer id.
+         * \param when The new next timeout.
+         * \param period The new period (zero for a one-shot timer).
+         * \return False if the timer is unknown, expired or its handler is running.
+         */
+        bool reschedule(timer_id tid, const timestamp& when, const duration& period);
+
     private:
         void run();
     };
@@ -65,6 +65,7 @@
 
 #include "bytepack/bytepack.hpp"
 #include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_arena.hpp"
 #include "fpm/fixed.hpp"
 #include "fpm/math.hpp"
 
@@ -81,6 +82,7 @@
 #include "tools/platform_helpers.hpp"
 #include "tools/ring_buffer.hpp"
 #include "tools/ring_vector.hpp"
+#include "tools/static_subject.hpp"
 #include "tools/sync_dictionary.hpp"
 #include "tools/sync_observer.hpp"
 #include "tools/sync_queue.hpp"
@@ -90,6 +92,7 @@
 #include "tools/time_list.hpp"
 #include "tools/timer_scheduler.hpp"
 #include "tools/variant_overload.hpp"
+#include "tools/variant_subject.hpp"
 #include "tools/worker_task.hpp"
 
 #if defined(ESP_PLATFORM)
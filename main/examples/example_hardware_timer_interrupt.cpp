@@ -33,24 +33,93 @@
 #include "example_common.hpp"
 #include "examples.hpp"
 
+#if defined(USE_ISR_LATENCY_PROBE)
+#include "tools/latency_clock.hpp"
+#include "tools/light_event.hpp"
+#include "tools/sync_object.hpp"
+#endif
+
 #if defined(ESP_PLATFORM)
 namespace
 {
     constexpr std::size_t isr_queue_depth = 20;
 
-    /** @brief Shared context for the ISR-driven data task, holding the data task handle, storage ring, and ISR timing
-     * queue. */
+    /** @brief Topics published from the timer ISR; count closes the list so that run-time topics index a table. */
+    enum class isr_topic : std::uint8_t
+    {
+        alarm,
+        count
+    };
+
+    /** @brief Event published on each alarm: the alarm counter and the time elapsed since the previous alarm. */
+    struct isr_alarm
+    {
+        std::uint32_t counter;
+        std::uint32_t elapsed_us;
+    };
+
+    struct isr_context;
+
+    /** @brief ISR-side observer forwarding the alarm counter to the data task with isr_submit. */
+    struct isr_task_forwarder
+    {
+        static constexpr bool subscribes(isr_topic topic)
+        {
+            return isr_topic::alarm == topic;
+        }
+
+        void inform(isr_topic topic, const isr_alarm& alarm);
+
+        isr_context* context;
+    };
+
+    /** @brief ISR-side observer recording the ISR production intervals, the first alarm having none. */
+    struct isr_elapsed_recorder
+    {
+        static constexpr bool subscribes(isr_topic topic)
+        {
+            return isr_topic::alarm == topic;
+        }
+
+        void inform(isr_topic topic, const isr_alarm& alarm);
+
+        isr_context* context;
+    };
+
+    using isr_subject = tools::static_subject<isr_topic, isr_alarm, isr_task_forwarder, isr_elapsed_recorder>;
+
+    /** @brief Shared context for the ISR-driven data task, holding the data task handle, storage ring, ISR timing
+     * queue, and the statically wired subject the ISR publishes to. */
     struct isr_context
     {
         tools::ring_buffer<std::pair<std::uint32_t, std::uint32_t>, 1024> storage;
         std::shared_ptr<tools::data_task<isr_context, std::uint32_t>> data_task;
         tools::ring_buffer<std::uint32_t, 1024> isr_queue;
+        isr_task_forwarder forwarder { this };
+        isr_elapsed_recorder recorder { this };
+        isr_subject alarm_subject { forwarder, recorder };
     };
 
+    void isr_task_forwarder::inform(isr_topic topic, const isr_alarm& alarm)
+    {
+        (void)topic;
+        // ISR must stay minimal: push work to data_task and return quickly.
+        context->data_task->isr_submit(alarm.counter);
+    }
+
+    void isr_elapsed_recorder::inform(isr_topic topic, const isr_alarm& alarm)
+    {
+        (void)topic;
+        if (alarm.counter > 0U)
+        {
+            context->isr_queue.emplace(alarm.elapsed_us);
+        }
+    }
+
     using isr_data_task = tools::data_task<isr_context, std::uint32_t>;
 
     /**
-     * @brief Hardware timer ISR callback — fires at each alarm event and submits a counter value to the data task.
+     * @brief Hardware timer ISR callback — fires at each alarm event and publishes the counter to the static subject.
      * @param timer GP timer handle (unused).
      * @param edata Alarm event data (unused).
      * @param user_ctx Pointer to the @c isr_context registered as user data.
@@ -69,15 +138,9 @@ namespace
 
         auto* context = reinterpret_cast<isr_context*>(user_ctx);
 
-        std::uint32_t value = counter++;
-
-        // ISR must stay minimal: push work to data_task and return quickly.
-        context->data_task->isr_submit(value);
-
-        if (counter > 1)
-        {
-            context->isr_queue.emplace(static_cast<std::uint32_t>(elapsed.count()));
-        }
+        // Wired at compile time: direct calls to the forwarder and the recorder, no virtual dispatch nor lookup.
+        context->alarm_subject.publish<isr_topic::alarm>(
+            isr_alarm { counter++, static_cast<std::uint32_t>(elapsed.count()) });
 
         return false;
     }
@@ -181,6 +244,208 @@ namespace
 
         tools::sleep_for(1000);
     }
+
+#if defined(USE_ISR_LATENCY_PROBE)
+    /** @brief ISR hand-off primitives measured in turn, one timer run each. */
+    enum class latency_primitive : std::uint8_t
+    {
+        sync_queue,
+        sync_ring_buffer,
+        memory_pipe,
+        task_notification,
+        count
+    };
+
+    constexpr std::size_t latency_primitive_count = static_cast<std::size_t>(latency_primitive::count);
+    constexpr std::size_t latency_queue_depth = 64U;
+    constexpr std::chrono::duration<std::uint64_t, std::micro> latency_poll_timeout { 10000U };
+    constexpr std::chrono::duration<std::uint64_t, std::milli> latency_pipe_timeout { 10U };
+
+    /** @brief Primitives under test, the primitive the timer ISR currently feeds, and one recorder per primitive. */
+    struct latency_context
+    {
+        std::atomic<latency_primitive> primitive { latency_primitive::sync_queue };
+        std::atomic_bool running { true };
+        tools::bounded_sync_queue<tools::latency_stamp> queue { latency_queue_depth };
+        tools::sync_ring_buffer<tools::latency_stamp, latency_queue_depth> ring;
+        tools::sync_object ring_ready;
+        // message buffer entries carry a size_t length in front of the stamp
+        tools::memory_pipe pipe { latency_queue_depth * (sizeof(tools::latency_stamp) + sizeof(std::size_t)) };
+        tools::light_event notification;
+        tools::isr_latency_recorder queue_latency { "sync_queue" };
+        tools::isr_latency_recorder ring_latency { "sync_ring_buffer" };
+        tools::isr_latency_recorder pipe_latency { "memory_pipe" };
+        tools::isr_latency_recorder notification_latency { "task_notification" };
+        // indexed by latency_primitive
+        std::array<tools::isr_latency_recorder*, latency_primitive_count> recorders { &queue_latency, &ring_latency,
+            &pipe_latency, &notification_latency };
+    };
+
+    using latency_task = tools::generic_task<latency_context>;
+
+    /**
+     * @brief Timer ISR of the latency probe — stamps the cycle counter and hands it over with the primitive under
+     * test.
+     * @param timer GP timer handle (unused).
+     * @param edata Alarm event data (unused).
+     * @param user_ctx Pointer to the @c latency_context registered as user data.
+     * @return False, the primitives yielding themselves when they wake a task.
+     */
+    static bool latency_isr_handler(gptimer_handle_t timer, const gptimer_alarm_event_data_t* edata, void* user_ctx)
+    {
+        (void)timer;
+        (void)edata;
+        auto* context = reinterpret_cast<latency_context*>(user_ctx); // NOLINT gptimer user data is a void*
+        const tools::latency_stamp stamp = tools::latency_clock::now();
+
+        switch (context->primitive.load(std::memory_order_relaxed))
+        {
+            case latency_primitive::sync_queue:
+                context->queue.isr_push(stamp);
+                break;
+            case latency_primitive::sync_ring_buffer:
+                context->ring.isr_push(stamp);
+                context->ring_ready.isr_signal();
+                break;
+            case latency_primitive::memory_pipe:
+                // NOLINTNEXTLINE the message buffer takes the stamp as raw bytes
+                (void)context->pipe.isr_send(reinterpret_cast<const std::uint8_t*>(&stamp), sizeof(stamp));
+                break;
+            case latency_primitive::task_notification:
+                context->notification_latency.mark();
+                context->notification.isr_signal();
+                break;
+            default:
+                break;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Consumer of the latency probe — waits on the primitive under test and records each hand-off latency.
+     * @param context Shared latency context.
+     * @param task_name Task name (unused).
+     */
+    static void latency_consumer(const std::shared_ptr<latency_context>& context, const std::string& task_name)
+    {
+        (void)task_name;
+        while (context->running.load(std::memory_order_acquire))
+        {
+            const auto primitive = context->primitive.load(std::memory_order_acquire);
+            auto& recorder = *context->recorders[static_cast<std::size_t>(primitive)];
+
+            switch (primitive)
+            {
+                case latency_primitive::sync_queue:
+                    if (auto stamp = context->queue.wait_pop(latency_poll_timeout); stamp.has_value())
+                    {
+                        recorder.on_consume(*stamp);
+                    }
+                    break;
+                case latency_primitive::sync_ring_buffer:
+                    context->ring_ready.wait_for_signal(latency_poll_timeout);
+                    while (auto stamp = context->ring.front_pop())
+                    {
+                        recorder.on_consume(*stamp);
+                    }
+                    break;
+                case latency_primitive::memory_pipe:
+                {
+                    tools::latency_stamp stamp = 0U;
+                    // the message buffer fills the stamp as raw bytes
+                    if (sizeof(stamp)
+                        == context->pipe.receive(
+                            reinterpret_cast<std::uint8_t*>(&stamp), sizeof(stamp), latency_pipe_timeout)) // NOLINT
+                    {
+                        recorder.on_consume(stamp);
+                    }
+                    break;
+                }
+                case latency_primitive::task_notification:
+                    context->notification.wait_for_signal(latency_poll_timeout);
+                    recorder.on_notified();
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief Prints the interrupt to task latency distribution of one primitive.
+     * @param recorder The recorder of the primitive.
+     */
+    void print_latency(const tools::isr_latency_recorder& recorder)
+    {
+        constexpr double median = 0.5;
+        constexpr double tail = 0.99;
+        const auto stats = recorder.snapshot();
+        std::printf("%-18s n=%4" PRIu32 " min=%6" PRIu32 " ns mean=%8.0f ns p50<=%6" PRIu64 " ns p99<=%6" PRIu64
+                    " ns max=%6" PRIu32 " ns\n",
+            recorder.name(), stats.count, stats.min, stats.mean(), stats.percentile_upper_bound(median),
+            stats.percentile_upper_bound(tail), stats.max);
+    }
+
+    /**
+     * @brief Fires the GP timer at 1 kHz for 500 ms per primitive and reports the interrupt to task latency
+     * distribution of sync_queue, sync_ring_buffer, memory_pipe and task notification.
+     *
+     * The consumer runs on the core that registers the timer interrupt, the CCOUNT stamps being per core.
+     */
+    void test_isr_to_task_latency()
+    {
+        LOG_INFO("-- ISR to task latency per primitive --");
+
+        auto context = std::make_shared<latency_context>();
+        const int isr_core = static_cast<int>(xPortGetCoreID());
+        constexpr int consumer_priority = configMAX_PRIORITIES - 2;
+        latency_task consumer(latency_consumer, context, "isr_latency", 4096, isr_core, consumer_priority);
+
+        gptimer_handle_t gptimer = nullptr;
+        gptimer_config_t timer_config = {};
+        timer_config.clk_src = GPTIMER_CLK_SRC_DEFAULT;
+        timer_config.direction = GPTIMER_COUNT_UP;
+        constexpr const int one_mhz_clock = 1 * 1000 * 1000;
+        timer_config.resolution_hz = one_mhz_clock;
+        ESP_ERROR_CHECK(gptimer_new_timer(&timer_config, &gptimer));
+
+        gptimer_alarm_config_t alarm_config = {};
+        constexpr const int period_1ms = 1000;
+        alarm_config.reload_count = 0;
+        alarm_config.alarm_count = period_1ms;
+        alarm_config.flags.auto_reload_on_alarm = true;
+        ESP_ERROR_CHECK(gptimer_set_alarm_action(gptimer, &alarm_config));
+
+        gptimer_event_callbacks_t cbs = {};
+        cbs.on_alarm = latency_isr_handler;
+        ESP_ERROR_CHECK(gptimer_register_event_callbacks(gptimer, &cbs, context.get()));
+        ESP_ERROR_CHECK(gptimer_enable(gptimer));
+
+        for (std::size_t index = 0U; index < latency_primitive_count; ++index)
+        {
+            context->primitive.store(static_cast<latency_primitive>(index), std::memory_order_release);
+            ESP_ERROR_CHECK(gptimer_start(gptimer));
+            tools::sleep_for(500);
+            ESP_ERROR_CHECK(gptimer_stop(gptimer));
+            // let the consumer drain the last hand-offs before the next primitive
+            tools::sleep_for(50);
+        }
+
+        ESP_ERROR_CHECK(gptimer_disable(gptimer));
+        ESP_ERROR_CHECK(gptimer_del_timer(gptimer));
+        context->running.store(false, std::memory_order_release);
+        context->notification.signal();
+        context->ring_ready.signal();
+
+        for (const auto* recorder : context->recorders)
+        {
+            print_latency(*recorder);
+        }
+
+        tools::sleep_for(100);
+    }
+#endif
 } // namespace
 #endif
 
@@ -190,5 +455,8 @@ void run_example_hardware_timer_interrupt()
 #if defined(ESP_PLATFORM)
     // ESP32-only reference for ISR handoff into task-level processing via framework ISR-safe APIs.
     test_hardware_timer_interrupt();
+#if defined(USE_ISR_LATENCY_PROBE)
+    test_isr_to_task_latency();
+#endif
 #endif
 }
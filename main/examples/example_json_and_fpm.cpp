@@ -131,8 +131,14 @@ namespace
             data_queue->emplace(json.print(false));
         }
 
+        // Every envelope is parsed into the same arena, rewound once the previous document is gone.
+        constexpr const std::size_t json_arena_size = 2048U;
+        cjsonpp::json_arena envelope_arena(json_arena_size);
+
         while (!data_queue->empty())
         {
+            static_cast<void>(envelope_arena.reset());
+
             // Pop one serialized envelope at a time so downstream handlers stay stateless.
             auto data = data_queue->front_pop();
             if (!data.has_value())
@@ -140,7 +146,7 @@ namespace
                 break;
             }
 
-            auto parse_result = cjsonpp::parse_result(data.value());
+            auto parse_result = cjsonpp::parse_result(data.value(), envelope_arena);
             if (!parse_result)
             {
                 LOG_ERROR("queue json parse failed: %s", parse_result.error().message.c_str());
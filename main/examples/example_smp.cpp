@@ -34,6 +34,7 @@
 #include "examples.hpp"
 
 #include "tools/platform_helpers.hpp"
+#include "tools/zero_copy_channel.hpp"
 
 namespace
 {
@@ -282,6 +283,97 @@ namespace
         }
     }
 
+    constexpr const std::size_t sensor_frame_samples = 2048U;
+    constexpr const std::size_t sensor_pool_pow2 = 2U;
+
+    /** @brief Large sensor frame moved between cores by ownership transfer rather than by copy. */
+    struct sensor_frame
+    {
+        std::uint32_t sequence = 0U;
+        std::array<std::uint16_t, sensor_frame_samples> samples = {};
+    };
+
+    /** @brief Shared context owning the zero-copy channel carrying sensor frames from core 0 to core 1. */
+    struct smp_channel_task_context
+    {
+        tools::zero_copy_channel<sensor_frame, sensor_pool_pow2> m_frames;
+    };
+
+    using periodic_channel_task0 = tools::periodic_task<smp_channel_task_context>;
+    using worker_channel_task1 = tools::worker_task<smp_channel_task_context>;
+
+    /** @brief Demonstrates passing pool-allocated sensor frames from core 0 to core 1 through a @c
+     * tools::zero_copy_channel, without copying the frames. */
+    void test_smp_tasks_zero_copy_channel()
+    {
+        LOG_INFO("-- smp tasks with zero copy channel --");
+        print_stats();
+
+        auto startup = [](const std::shared_ptr<smp_channel_task_context>& context, const std::string& task_name)
+        {
+            (void)context;
+            (void)task_name;
+        };
+
+        auto context = std::make_shared<smp_channel_task_context>();
+
+        {
+            const int core1 = tools::get_nb_of_cpu_cores() - 1;
+            worker_channel_task1 task1(
+                startup, context, "worker_task1", smp_worker_stack_size, core1, tools::base_task::default_priority);
+
+            std::atomic_bool stop(false);
+
+            task1.delegate(
+                [&stop](const auto& delegate_context, const auto& task_name)
+                {
+                    const auto timeout = std::chrono::duration<std::uint64_t, std::micro>(20000);
+
+                    // Consumer side: read each frame in place, then drop the handle to return it to core 0.
+                    while (!stop.load())
+                    {
+                        auto frame = delegate_context->m_frames.receive(timeout);
+                        if (frame)
+                        {
+                            const auto sum = std::accumulate(frame->samples.cbegin(), frame->samples.cend(), 0U);
+                            std::printf("%s (core 1): frame %" PRIu32 " at %p, sum %u\n", task_name.c_str(),
+                                frame->sequence, static_cast<const void*>(frame.get()), sum);
+                        }
+                    }
+                });
+
+            auto periodic_lambda
+                = [](const std::shared_ptr<smp_channel_task_context>& local_context, const std::string& task_name)
+            {
+                static std::uint32_t sequence = 0U;
+
+                // Producer side: fill a pooled block in place and hand its ownership over.
+                auto frame = local_context->m_frames.acquire();
+                if (!frame)
+                {
+                    std::printf("%s (core 0): every frame in flight, skipping\n", task_name.c_str());
+                    return;
+                }
+
+                frame->sequence = sequence++;
+                std::fill(frame->samples.begin(), frame->samples.end(), static_cast<std::uint16_t>(frame->sequence));
+                (void)local_context->m_frames.send(std::move(frame));
+            };
+
+            constexpr const auto period = std::chrono::duration<std::uint64_t, std::milli>(50);
+            constexpr const std::size_t task0_stack_size = 4096U;
+            constexpr const int core0 = 0;
+            periodic_channel_task0 task0(startup, periodic_lambda, context, "periodic_task0", period, task0_stack_size,
+                core0, tools::base_task::default_priority);
+
+            constexpr const int wait_processing_ms = 1000;
+            constexpr const int wait_join_ms = 250;
+            tools::sleep_for(wait_processing_ms);
+            stop.store(true);
+            tools::sleep_for(wait_join_ms);
+        }
+    }
+
     /** @brief Exercises perfect-forwarding send/receive overloads of @c tools::memory_pipe with lvalue, rvalue, range,
      * conversion, and ISR variants. */
     void test_memory_pipe_perfect_forwarding()
@@ -394,6 +486,8 @@ void run_example_smp()
     test_memory_pipe_perfect_forwarding();
     // Use memory_pipe for larger/chunked transfers between core-bound tasks.
     test_smp_tasks_memory_pipe();
+    // Move large frames between cores by handing over pooled blocks instead of copying them.
+    test_smp_tasks_zero_copy_channel();
     // End with task priority interplay to visualize scheduling effects.
     test_tasks_priority();
 }
@@ -88,6 +88,39 @@ namespace
     using traffic_light_event_v = std::variant<traffic_light_event::power_on, traffic_light_event::power_off,
         traffic_light_event::init_done, traffic_light_event::next_state>;
 
+    /** @brief Observer of the power alternatives only, counting the switch requests sent to the traffic light. */
+    class power_monitor
+        : public tools::sync_observer<std::string, traffic_light_event::power_on>
+        , public tools::sync_observer<std::string, traffic_light_event::power_off>
+    {
+    public:
+        void inform(const std::string& topic, const traffic_light_event::power_on& event,
+            const std::string& origin) override
+        {
+            (void)topic;
+            (void)event;
+            (void)origin;
+            ++m_switches;
+        }
+
+        void inform(const std::string& topic, const traffic_light_event::power_off& event,
+            const std::string& origin) override
+        {
+            (void)topic;
+            (void)event;
+            (void)origin;
+            ++m_switches;
+        }
+
+        [[nodiscard]] int switches() const
+        {
+            return m_switches;
+        }
+
+    private:
+        int m_switches = 0;
+    };
+
     class traffic_light_fsm : tools::non_copyable
     {
     public:
@@ -466,47 +499,66 @@ namespace
 
         traffic_light_fsm fsm;
 
+        // Events reach the FSM through a variant subject: each alternative has its own subscriber table, so the
+        // power monitor only receives the power events and is never visited for the cycle events.
+        tools::variant_subject<std::string, traffic_light_event_v> controls("traffic_light_controls");
+        const std::string light_topic = "crossing";
+        auto forward_to_fsm = [&fsm](const std::string& topic, const auto& event, const std::string& origin)
+        {
+            (void)topic;
+            (void)origin;
+            fsm.handle_event(event);
+        };
+        controls.subscribe<traffic_light_event::power_on>(light_topic, "fsm", forward_to_fsm);
+        controls.subscribe<traffic_light_event::power_off>(light_topic, "fsm", forward_to_fsm);
+        controls.subscribe<traffic_light_event::init_done>(light_topic, "fsm", forward_to_fsm);
+        controls.subscribe<traffic_light_event::next_state>(light_topic, "fsm", forward_to_fsm);
+
+        auto monitor = std::make_shared<power_monitor>();
+        controls.subscribe(light_topic, monitor);
+
         fsm.start();
         fsm.update();
         fsm.update();
         fsm.update();
 
-        fsm.handle_event(traffic_light_event::power_on {});
+        controls.publish(light_topic, traffic_light_event::power_on {});
         // Drive initialization, then repeatedly advance through RED->ORANGE->GREEN cycles.
         fsm.update();
         fsm.update();
-        fsm.handle_event(traffic_light_event::init_done {});
+        controls.publish(light_topic, traffic_light_event::init_done {});
         fsm.update();
         fsm.update();
 
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
 
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
 
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
 
-        fsm.handle_event(traffic_light_event::next_state {});
+        controls.publish(light_topic, traffic_light_event::next_state {});
         fsm.update();
         fsm.update();
 
+        std::printf("power switches seen by the monitor: %d\n", monitor->switches());
         std::printf("end fsm test\n");
     }
 } // namespace
@@ -30,6 +30,7 @@
  * @date 2026-04-21
  */
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -38,7 +39,16 @@
 
 #include "examples/examples.hpp"
 
+#if defined(USE_BENCHMARKS)
+#include "benchmarks/benchmarks.hpp"
+#endif
+
+#if defined(USE_SOAK)
+#include "soak/soak.hpp"
+#endif
+
 #include "tools/logger.hpp"
+#include "tools/mem_pool_allocator.hpp"
 #include "tools/platform_detection.hpp"
 
 #if defined(FREERTOS_PLATFORM)
@@ -46,9 +56,45 @@
 #include <freertos/task.h>
 #endif
 
-#if defined(USE_MEM_POOL_ALLOCATOR)
-extern void init_mem_pool_allocator();
-extern void destroy_mem_pool_allocator();
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_STATS)
+void print_mem_pool_stats()
+{
+    std::printf("Mem pool allocator stats\n");
+
+    for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+    {
+        if (const auto stats = tools::mem_pool_stats(idx))
+        {
+            std::printf("[%4zu bytes] hits %zu, misses %zu, slab %zu, overflows %zu, occupancy %zu, high-water %zu / "
+                        "%zu\n",
+                stats->block_size, stats->hits, stats->misses, stats->slab_allocations, stats->overflows,
+                stats->occupancy, stats->high_water_mark, stats->capacity);
+        }
+    }
+
+    // warmup table of this run, to be given back with MEM_POOL_ALLOCATOR_WARMUP_TARGETS
+    std::printf("MEM_POOL_ALLOCATOR_WARMUP_TARGETS=");
+    for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+    {
+        const auto stats = tools::mem_pool_stats(idx);
+        const std::size_t target = stats ? std::min(stats->peak_in_use, stats->capacity) : 0U;
+        std::printf("%s%zuU", (idx == 0U) ? "" : ",", target);
+    }
+    std::printf("\n");
+}
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+void print_tlsf_heap_stats()
+{
+    if (const auto stats = tools::mem_pool_tlsf_stats())
+    {
+        std::printf("TLSF heap: used %zu / %zu bytes (high-water %zu), %zu blocks, %zu free blocks, largest free %zu, "
+                    "fragmentation %zu%%, %zu failed allocations\n",
+            stats->used_bytes, stats->managed_bytes, stats->high_water_mark, stats->used_blocks, stats->free_blocks,
+            stats->largest_free_block, stats->fragmentation_percent, stats->failed_allocations);
+    }
+}
 #endif
 
 void runner()
@@ -58,6 +104,11 @@ void runner()
     init_mem_pool_allocator();
 #endif
 
+#if defined(USE_BENCHMARKS)
+    benchmarks::run_benchmarks(stdout);
+#elif defined(USE_SOAK)
+    soak::run_soak(soak::soak_config {}, stdout);
+#else
     run_example_hardware_timer_interrupt();
     run_example_ring_container();
     run_example_sync_container();
@@ -71,8 +122,15 @@ void runner()
     run_example_allocator_stress();
     run_example_async_processing();
     run_example_time_list();
+#endif
 
 #if defined(USE_MEM_POOL_ALLOCATOR)
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+    print_mem_pool_stats();
+#endif
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+    print_tlsf_heap_stats();
+#endif
     std::printf("Destroy mem pool allocator\n");
     destroy_mem_pool_allocator();
 #endif
@@ -0,0 +1,28 @@
+/**
+ * @file barrier.hpp
+ * @brief Portable concurrency component: reusable countdown barrier.
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ * @license https://creativecommons.org/publicdomain/zero/1.0/
+ * @see https://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+//-----------------------------------------------------------------------------//
+// Portable Concurrency Framework                                              //
+// Barrier extension: Laurent Lardinois                                        //
+// Date: 2026-10-14                                                            //
+// https://github.com/VestniK/portable_concurrency                             //
+// Public Domain (CC0 1.0)                                                     //
+// https://creativecommons.org/publicdomain/zero/1.0/                          //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+/**
+ * @defgroup barrier <portable_concurrency/barrier>
+ * @headerfile portable_concurrency/barrier
+ *
+ * Reusable barrier class.
+ */
+
+#include "bits/barrier_impl.hpp"
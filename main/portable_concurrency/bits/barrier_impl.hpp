@@ -0,0 +1,102 @@
+/**
+ * @file barrier_impl.hpp
+ * @brief Portable concurrency component: reusable countdown barrier.
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ * @license https://creativecommons.org/publicdomain/zero/1.0/
+ * @see https://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+//-----------------------------------------------------------------------------//
+// Portable Concurrency Framework                                              //
+// Barrier extension: Laurent Lardinois                                        //
+// Date: 2026-10-14                                                            //
+// https://github.com/VestniK/portable_concurrency                             //
+// Public Domain (CC0 1.0)                                                     //
+// https://creativecommons.org/publicdomain/zero/1.0/                          //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include "tools/cond_var.hpp"
+#include "tools/critical_section.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace pco
+{
+
+    /**
+     * @headerfile portable_concurrency/barrier
+     * @ingroup barrier
+     *
+     * Reusable countdown barrier: a fixed set of threads meets at the barrier once per
+     * phase, and the last one to arrive releases the others and rearms the counter for
+     * the next phase.
+     *
+     * Arriving is a single atomic subtraction; waiting spins briefly on the phase word
+     * before parking. Like latch, the mutex and condition variable are only touched
+     * once a waiter has actually parked.
+     */
+    class barrier
+    {
+    public:
+        /**
+         * @brief Constructs barrier for a number of participating threads.
+         * @param count Number of arrivals completing a phase.
+         */
+        explicit barrier(ptrdiff_t count)
+            : expected_(count)
+            , remaining_(count)
+        {
+        }
+
+        barrier(const barrier&) = delete;
+        barrier& operator=(const barrier&) = delete;
+        barrier(barrier&&) = delete;
+        barrier& operator=(barrier&&) = delete;
+
+        /** @brief Destroys barrier object once no thread is parked on it. */
+        ~barrier();
+
+        /** @brief Arrives at the barrier and blocks until the current phase completes. */
+        void arrive_and_wait();
+
+        /** @brief Arrives at the barrier without waiting and leaves the participating set for later phases. */
+        void arrive_and_drop();
+
+        /**
+         * @brief Returns the number of phases completed so far.
+         * @return Completed phase count.
+         */
+        std::uint32_t completed_phases() const noexcept;
+
+    private:
+        /** @brief Bit of phase_ set once a waiter parked on the condition variable. */
+        static constexpr std::uint32_t parked_flag = 1U;
+        /** @brief Value of one phase in phase_, above the parked flag. */
+        static constexpr std::uint32_t phase_unit = 2U;
+
+        /**
+         * @brief Counts one arrival and completes the phase when it is the last one.
+         * @return true when this arrival completed the phase.
+         */
+        bool arrive();
+
+        /** @brief Number of arrivals completing a phase. */
+        std::atomic<ptrdiff_t> expected_;
+        /** @brief Arrivals still missing in the current phase. */
+        std::atomic<ptrdiff_t> remaining_;
+        /** @brief Completed phases times phase_unit, plus parked_flag. */
+        std::atomic<std::uint32_t> phase_ { 0U };
+        /** @brief Number of currently parked threads, guarded by mutex_. */
+        unsigned waiters_ = 0;
+        /** @brief Mutex protecting the parked state. */
+        tools::critical_section mutex_;
+        /** @brief Condition variable used to wake parked threads. */
+        tools::cond_var cv_;
+    };
+
+} // namespace pco
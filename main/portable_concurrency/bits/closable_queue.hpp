@@ -32,7 +32,9 @@ namespace pco::detail
     bool closable_queue<T>::pop(T& dest)
     {
         std::unique_lock<tools::critical_section> lock(mutex_);
+        ++waiters_;
         cv_.wait(lock, [this]() { return closed_ || !queue_.empty(); });
+        --waiters_;
         if (closed_ && queue_.empty())
         {
             return false;
@@ -42,6 +44,36 @@ namespace pco::detail
         return true;
     }
 
+    /**
+     * @brief Waits for queued values or closed state, then pops this consumer's share of them.
+     * @tparam T Queue value type.
+     * @param dest Output array receiving the popped values.
+     * @param max_count Capacity of dest.
+     * @return Number of popped values, 0 when queue is closed and empty.
+     */
+    template <typename T>
+    std::size_t closable_queue<T>::pop_batch(T* dest, std::size_t max_count)
+    {
+        if (0U == max_count)
+        {
+            return 0U;
+        }
+
+        std::unique_lock<tools::critical_section> lock(mutex_);
+        ++waiters_;
+        cv_.wait(lock, [this]() { return closed_ || !queue_.empty(); });
+        --waiters_;
+
+        const std::size_t share = (queue_.size() + waiters_) / (waiters_ + 1U);
+        const std::size_t count = (share < max_count) ? share : max_count;
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            dest[index] = std::move(queue_.front());
+            queue_.pop();
+        }
+        return count;
+    }
+
     /**
      * @brief Pushes a value to queue and notifies one waiting consumer.
      * @tparam T Queue value type.
@@ -56,7 +88,42 @@ namespace pco::detail
             return;
         }
         queue_.emplace(std::move(val));
-        cv_.notify_one();
+        if (waiters_ > 0U)
+        {
+            cv_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Moves a range of values to queue, then wakes as many waiting consumers as useful.
+     * @tparam T Queue value type.
+     * @tparam It Input iterator type.
+     * @param first Beginning of the range.
+     * @param last End of the range.
+     */
+    template <typename T>
+    template <typename It>
+    void closable_queue<T>::push_range(It first, It last)
+    {
+        std::scoped_lock<tools::critical_section> guard(mutex_);
+        if (closed_)
+        {
+            return;
+        }
+        std::size_t count = 0U;
+        for (; first != last; ++first)
+        {
+            queue_.emplace(std::move(*first));
+            ++count;
+        }
+        if ((count > 1U) && (waiters_ > 1U))
+        {
+            cv_.notify_all();
+        }
+        else if ((count > 0U) && (waiters_ > 0U))
+        {
+            cv_.notify_one();
+        }
     }
 
     /**
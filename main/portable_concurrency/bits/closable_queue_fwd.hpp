@@ -21,8 +21,12 @@
 #include "tools/cond_var.hpp"
 #include "tools/critical_section.hpp"
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
 #include <queue>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
 
 namespace pco::detail
@@ -43,12 +47,45 @@ namespace pco::detail
          */
         bool pop(T& dest);
 
+        /**
+         * @brief Pops up to max_count values under one lock, waiting until data is available or queue is closed.
+         *
+         * A consumer takes no more than its share of the queued values (size divided by the consumers waiting,
+         * rounded up), so that one worker does not drain a fan-out that idle workers could run in parallel.
+         *
+         * @param dest Destination array of at least max_count values, move-assigned from the queue.
+         * @param max_count Maximum number of values to pop.
+         * @return Number of popped values, 0 when queue is closed and empty.
+         */
+        std::size_t pop_batch(T* dest, std::size_t max_count);
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Pops up to dest.size() values under one lock, see pop_batch(T*, std::size_t).
+         * @param dest Destination span, move-assigned from the queue.
+         * @return Number of popped values, 0 when queue is closed and empty.
+         */
+        std::size_t pop_batch(std::span<T> dest)
+        {
+            return pop_batch(dest.data(), dest.size());
+        }
+#endif
+
         /**
          * @brief Pushes a value into the queue.
          * @param val Value to enqueue.
          */
         void push(T&& val);
 
+        /**
+         * @brief Moves a range of values into the queue under one lock, with a single notification.
+         * @tparam It Input iterator type.
+         * @param first Beginning of the range.
+         * @param last End of the range.
+         */
+        template <typename It>
+        void push_range(It first, It last);
+
         /**
          * @brief Closes the queue and wakes waiting consumers.
          */
@@ -58,6 +95,7 @@ namespace pco::detail
         tools::critical_section mutex_;
         tools::cond_var cv_;
         std::queue<T> queue_;
+        std::size_t waiters_ = 0U;
         bool closed_ = false;
     };
 
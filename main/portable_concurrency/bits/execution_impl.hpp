@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -82,6 +83,126 @@ namespace pco
     {
     };
 
+    namespace detail
+    {
+        /**
+         * @brief Number of tasks currently nested in inline_when_ready_executor calls on this thread.
+         * @return Reference to the per-thread depth counter.
+         */
+        inline std::size_t& inline_continuation_depth() noexcept
+        {
+            static thread_local std::size_t depth = 0U; // NOLINT per-thread nesting depth is the purpose
+            return depth;
+        }
+    } // namespace detail
+
+    /**
+     * @headerfile portable_concurrency/execution
+     * @ingroup execution
+     * @brief Executor adapter running tasks in the posting thread, falling back to a wrapped executor.
+     *
+     * Used as the executor of `then_value`/`then_error`/`then_result`, the continuation runs right away in the
+     * thread that completed the source future (or in the caller of `then_*` when the source is already ready):
+     * no queue hop, no wakeup, and no type erasure of the task. Nested inline runs are bounded per thread by
+     * `max_depth`; past it, tasks are posted to the wrapped executor so that long ready chains cannot overflow
+     * the stack. Meant for short non-blocking continuations such as field extraction or value mapping.
+     *
+     * @tparam Exec Wrapped executor type, used beyond the inline depth.
+     */
+    template <typename Exec>
+    class inline_when_ready_executor
+    {
+    public:
+        /** @brief Default bound of nested inline runs per thread. */
+        static constexpr std::size_t default_max_depth = 16U;
+
+        /**
+         * @brief Wraps an executor.
+         * @param exec Executor receiving the tasks posted beyond the inline depth.
+         * @param max_depth Maximum number of nested inline runs per thread (0 always posts).
+         */
+        explicit inline_when_ready_executor(Exec exec, std::size_t max_depth = default_max_depth)
+            : exec_ { std::move(exec) }
+            , max_depth_ { max_depth }
+        {
+        }
+
+        /**
+         * @brief Returns the wrapped executor.
+         * @return Reference to the fallback executor.
+         */
+        const Exec& underlying() const noexcept
+        {
+            return exec_;
+        }
+
+    private:
+        /** @brief Restores the per-thread depth when an inline task returns or throws. */
+        struct depth_guard
+        {
+            depth_guard() noexcept
+            {
+                ++detail::inline_continuation_depth();
+            }
+
+            ~depth_guard()
+            {
+                --detail::inline_continuation_depth();
+            }
+
+            depth_guard(const depth_guard&) = delete;
+            depth_guard& operator=(const depth_guard&) = delete;
+        };
+
+        /**
+         * @brief Runs the task inline below the depth bound, posts it to the wrapped executor otherwise.
+         * @param exec Adapter instance.
+         * @param task Callable task.
+         */
+        template <typename Task>
+        friend void post(const inline_when_ready_executor& exec, Task&& task)
+        {
+            if (detail::inline_continuation_depth() < exec.max_depth_)
+            {
+                depth_guard guard;
+                std::forward<Task>(task)();
+                return;
+            }
+
+            post(exec.exec_, std::forward<Task>(task));
+        }
+
+        /** @brief Fallback executor. */
+        Exec exec_;
+
+        /** @brief Maximum number of nested inline runs per thread. */
+        std::size_t max_depth_;
+    };
+
+    /**
+     * @brief Marks inline_when_ready_executor as an executor when the wrapped type is one.
+     */
+    template <typename Exec>
+    struct is_executor<inline_when_ready_executor<Exec>> : is_executor<Exec>
+    {
+    };
+
+    /**
+     * @headerfile portable_concurrency/execution
+     * @ingroup execution
+     * @brief Wraps an executor into an inline_when_ready_executor.
+     * @param exec Executor receiving the tasks posted beyond the inline depth.
+     * @param max_depth Maximum number of nested inline runs per thread.
+     * @return The adapter.
+     */
+    template <typename Exec>
+    inline_when_ready_executor<std::decay_t<Exec>> inline_when_ready(Exec&& exec,
+        std::size_t max_depth = inline_when_ready_executor<std::decay_t<Exec>>::default_max_depth)
+    {
+        static_assert(is_executor<std::decay_t<Exec>>::value, "Exec must satisfy pco::is_executor");
+        return inline_when_ready_executor<std::decay_t<Exec>> { std::forward<Exec>(exec), max_depth };
+    }
+
 } // namespace pco
 
 // Documentation-only declaration for the ADL customization point used by
@@ -20,11 +20,11 @@
 
 #include "tools/cond_var.hpp"
 #include "tools/critical_section.hpp"
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
 
-
 namespace pco
 {
 
@@ -37,6 +37,12 @@ namespace pco
      * Threads may block on the latch until the counter is decremented to zero.
      * There is no possibility to increase or reset the counter, which makes the
      * latch a single-use barrier.
+     *
+     * The counter and a "waiter parked" flag share one atomic word: count_down is a
+     * single atomic subtraction, and waiting spins on that word briefly before
+     * parking. The mutex and condition variable are only touched once a waiter has
+     * actually parked, so fork-join rendezvous that resolve within the spin window
+     * never enter the OS.
      */
     class latch
     {
@@ -46,7 +52,7 @@ namespace pco
          * @param count Initial countdown value.
          */
         explicit latch(ptrdiff_t count)
-            : counter_(count)
+            : state_(count * counter_unit)
         {
         }
 
@@ -80,9 +86,17 @@ namespace pco
         void wait() const;
 
     private:
-        /** @brief Remaining countdown value. */
-        ptrdiff_t counter_;
-        /** @brief Number of currently waiting threads. */
+        /** @brief Bit of state_ set once a waiter parked on the condition variable. */
+        static constexpr ptrdiff_t parked_flag = 1;
+        /** @brief Value of one count in state_, above the parked flag. */
+        static constexpr ptrdiff_t counter_unit = 2;
+
+        /** @brief Parks the caller until the counter reaches zero. */
+        void park() const;
+
+        /** @brief Remaining countdown value times counter_unit, plus parked_flag. */
+        mutable std::atomic<ptrdiff_t> state_;
+        /** @brief Number of currently parked threads, guarded by mutex_. */
         mutable unsigned waiters_ = 0;
         /** @brief Mutex protecting latch state. */
         mutable tools::critical_section mutex_;
@@ -187,6 +187,20 @@ namespace pco
             {
             }
 
+            /**
+             * @brief Stores callable and allocates the promise state with a custom allocator.
+             * @tparam Alloc Allocator type.
+             * @param tag Allocator-tag selector.
+             * @param alloc Allocator used for the promise shared state.
+             * @param function_arg Callable to execute once.
+             */
+            template <typename Alloc>
+            state_impl(std::allocator_arg_t tag, const Alloc& alloc, F&& function_arg)
+                : promise(tag, alloc)
+                , stored_function(std::move(function_arg))
+            {
+            }
+
             /**
              * @brief Obtains consumer future for the stored promise.
              * @return Future or shared_result depending on R mapping.
@@ -275,6 +289,22 @@ namespace pco
                 "F must be callable with signature R(A...)");
         }
 
+        /**
+         * @brief Constructs packaged task from callable object, allocating its states with a custom allocator.
+         * @tparam Alloc Allocator type, rebound for the task state and the promise shared state.
+         * @tparam F Callable type.
+         * @param tag Allocator-tag selector.
+         * @param alloc Allocator instance.
+         * @param function_arg Callable target.
+         */
+        template <typename Alloc, typename F>
+        packaged_task_result(std::allocator_arg_t tag, const Alloc& alloc, F&& function_arg)
+            : state_(std::allocate_shared<state_impl<F>>(alloc, tag, alloc, std::forward<F>(function_arg)))
+        {
+            static_assert(std::is_convertible<std::invoke_result_t<std::decay_t<F>&, A...>, R>::value,
+                "F must be callable with signature R(A...)");
+        }
+
         packaged_task_result(const packaged_task_result&) = delete;
         packaged_task_result(packaged_task_result&&) noexcept = default;
         packaged_task_result& operator=(const packaged_task_result&) = delete;
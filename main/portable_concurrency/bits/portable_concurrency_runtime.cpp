@@ -16,15 +16,25 @@
 // https://creativecommons.org/publicdomain/zero/1.0/                          //
 //-----------------------------------------------------------------------------//
 
+#include <array>
 #include <atomic>
+#include <cassert>
 #include <cstdint>
 #include <future>
+#include <memory>
+#include <mutex>
 
 #include "tools/cond_var.hpp"
 #include "tools/critical_section.hpp"
 #include "tools/expected.hpp"
 #include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
 
+#if defined(ESP_PLATFORM)
+#include <esp_pthread.h>
+#endif
+
+#include "barrier_impl.hpp"
 #include "closable_queue.hpp"
 #include "continuations_stack.hpp"
 #include "latch_impl.hpp"
@@ -32,6 +42,7 @@
 #include "small_unique_function.hpp"
 #include "thread_pool_impl.hpp"
 #include "unique_function.hpp"
+#include "work_stealing_pool_impl.hpp"
 
 namespace pco
 {
@@ -67,18 +78,163 @@ namespace pco
 
         template class closable_queue<unique_function<void()>>;
 
+        work_stealing_deque::ring::ring(std::size_t capacity_log2)
+            : mask { (std::size_t { 1U } << capacity_log2) - 1U }
+            , slots { std::make_unique<std::atomic<task_type*>[]>(mask + 1U) }
+        {
+        }
+
+        work_stealing_deque::work_stealing_deque(std::size_t capacity_log2)
+        {
+            rings_.emplace_back(std::make_unique<ring>(capacity_log2));
+            ring_.store(rings_.back().get(), std::memory_order_relaxed);
+        }
+
+        work_stealing_deque::~work_stealing_deque()
+        {
+            while (auto* task = take())
+            {
+                delete task; // NOLINT owning raw pointer by design of the lock-free slots
+            }
+        }
+
+        work_stealing_deque::ring* work_stealing_deque::grow(ring* current, std::int64_t top, std::int64_t bottom)
+        {
+            std::size_t capacity_log2 = 0U;
+            while ((std::size_t { 1U } << capacity_log2) <= current->mask)
+            {
+                ++capacity_log2;
+            }
+
+            rings_.emplace_back(std::make_unique<ring>(capacity_log2 + 1U));
+            ring* larger = rings_.back().get();
+            for (std::int64_t index = top; index < bottom; ++index)
+            {
+                const auto position = static_cast<std::size_t>(index);
+                larger->slots[position & larger->mask].store(
+                    current->slots[position & current->mask].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+
+            // thieves still reading the previous ring find the same tasks at the same indexes
+            ring_.store(larger, std::memory_order_release);
+            return larger;
+        }
+
+        void work_stealing_deque::push(task_type* task)
+        {
+            const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const std::int64_t top = top_.load(std::memory_order_acquire);
+            ring* current = ring_.load(std::memory_order_relaxed);
+
+            if (static_cast<std::size_t>(bottom - top) > current->mask)
+            {
+                current = grow(current, top, bottom);
+            }
+
+            current->slots[static_cast<std::size_t>(bottom) & current->mask].store(task, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_release);
+        }
+
+        work_stealing_deque::task_type* work_stealing_deque::take()
+        {
+            const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            ring* current = ring_.load(std::memory_order_relaxed);
+            bottom_.store(bottom, std::memory_order_seq_cst);
+            std::int64_t top = top_.load(std::memory_order_seq_cst);
+
+            if (top > bottom)
+            {
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            task_type* task
+                = current->slots[static_cast<std::size_t>(bottom) & current->mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // last task: race against the thieves
+                if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return task;
+        }
+
+        work_stealing_deque::task_type* work_stealing_deque::steal()
+        {
+            std::int64_t top = top_.load(std::memory_order_seq_cst);
+            const std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            ring* current = ring_.load(std::memory_order_acquire);
+            task_type* task
+                = current->slots[static_cast<std::size_t>(top) & current->mask].load(std::memory_order_relaxed);
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+
+            return task;
+        }
+
+        bool work_stealing_deque::empty() const noexcept
+        {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+        void post(work_stealing_executor exec, unique_function<void()> fun)
+        {
+            exec.pool_->submit(std::move(fun));
+        }
+
     } // namespace detail
 
     namespace
     {
 
+        /** @brief Pool and worker index of the calling thread, when it is a work_stealing_thread_pool worker. */
+        struct work_stealing_worker_identity
+        {
+            const work_stealing_thread_pool* pool = nullptr;
+            std::size_t index = 0U;
+        };
+
+        /** @brief Maximum number of tasks a static_thread_pool worker pops per lock acquisition. */
+        constexpr std::size_t static_thread_pool_batch_size = 8U;
+
+        /** @brief Number of polls of a latch or barrier state before a waiter parks on the condition variable. */
+        constexpr unsigned sync_spin_count = 64U;
+
+        thread_local work_stealing_worker_identity current_worker; // NOLINT per-thread identity is the purpose
+
         void process_queue(
             detail::closable_queue<unique_function<void()>>& queue, const std::atomic<bool>& stopped) noexcept
         {
-            unique_function<void()> task;
-            while (!stopped.load(std::memory_order_relaxed) && queue.pop(task))
+            // several tasks per lock acquisition, the queue bounds the batch to this worker's fair share
+            std::array<unique_function<void()>, static_thread_pool_batch_size> batch;
+            while (!stopped.load(std::memory_order_relaxed))
             {
-                static_cast<void>(task.invoke());
+                const std::size_t count = queue.pop_batch(batch.data(), batch.size());
+                if (0U == count)
+                {
+                    break;
+                }
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    if (!stopped.load(std::memory_order_relaxed))
+                    {
+                        static_cast<void>(batch[index].invoke());
+                    }
+                    batch[index] = unique_function<void()> {};
+                }
             }
         }
 
@@ -94,54 +250,124 @@ namespace pco
 
     void latch::count_down_and_wait()
     {
-        std::unique_lock<tools::critical_section> lock { mutex_ };
-        ++waiters_;
-        assert(counter_ > 0);
-        if (--counter_ == 0)
+        count_down(1);
+        wait();
+    }
+
+    void latch::count_down()
+    {
+        count_down(1);
+    }
+
+    void latch::count_down(ptrdiff_t n)
+    {
+        assert(n >= 0);
+        const ptrdiff_t previous = state_.fetch_sub(n * counter_unit, std::memory_order_acq_rel);
+        assert((previous / counter_unit) >= n);
+        if (((previous / counter_unit) != n) || ((previous & parked_flag) == 0))
         {
-            --waiters_;
-            cv_.notify_all();
             return;
         }
-        cv_.wait(lock, [this] { return counter_ == 0; });
-        if (--waiters_ == 0)
-        {
-            cv_.notify_one();
-        }
+
+        // the lock orders this notification after the parked waiter entered cv_.wait
+        std::scoped_lock<tools::critical_section> lock { mutex_ };
+        cv_.notify_all();
     }
 
-    void latch::count_down(ptrdiff_t n)
+    bool latch::is_ready() const noexcept
+    {
+        return state_.load(std::memory_order_acquire) < counter_unit;
+    }
+
+    void latch::wait() const
     {
+        for (unsigned spin = 0U; spin < sync_spin_count; ++spin)
         {
-            std::scoped_lock<tools::critical_section> lock { mutex_ };
-            assert(counter_ >= n);
-            assert(n >= 0);
-            counter_ -= n;
-            if (counter_ > 0)
+            if (is_ready())
             {
                 return;
             }
         }
-        cv_.notify_all();
+        park();
     }
 
-    bool latch::is_ready() const noexcept
+    void latch::park() const
     {
-        std::scoped_lock<tools::critical_section> lock { mutex_ };
-        return counter_ == 0;
+        std::unique_lock<tools::critical_section> lock { mutex_ };
+        ++waiters_;
+        static_cast<void>(state_.fetch_or(parked_flag, std::memory_order_acq_rel));
+        cv_.wait(lock, [this] { return is_ready(); });
+        if (--waiters_ == 0)
+        {
+            cv_.notify_one();
+        }
     }
 
-    void latch::wait() const
+    barrier::~barrier()
     {
+        std::unique_lock<tools::critical_section> lock { mutex_ };
+        cv_.wait(lock, [this] { return waiters_ == 0; });
+    }
+
+    bool barrier::arrive()
+    {
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return false;
+        }
+
+        // rearm before publishing the new phase: released threads may arrive again right away
+        remaining_.store(expected_.load(std::memory_order_acquire), std::memory_order_release);
+        const std::uint32_t current = phase_.load(std::memory_order_relaxed) & ~parked_flag;
+        const std::uint32_t previous = phase_.exchange(current + phase_unit, std::memory_order_acq_rel);
+        if ((previous & parked_flag) != 0U)
+        {
+            std::scoped_lock<tools::critical_section> lock { mutex_ };
+            cv_.notify_all();
+        }
+        return true;
+    }
+
+    void barrier::arrive_and_wait()
+    {
+        const std::uint32_t current = phase_.load(std::memory_order_acquire) & ~parked_flag;
+        if (arrive())
+        {
+            return;
+        }
+
+        const auto phase_done = [this, current]
+        { return (phase_.load(std::memory_order_acquire) & ~parked_flag) != current; };
+        for (unsigned spin = 0U; spin < sync_spin_count; ++spin)
+        {
+            if (phase_done())
+            {
+                return;
+            }
+        }
+
         std::unique_lock<tools::critical_section> lock { mutex_ };
         ++waiters_;
-        cv_.wait(lock, [this] { return counter_ == 0; });
+        static_cast<void>(phase_.fetch_or(parked_flag, std::memory_order_acq_rel));
+        cv_.wait(lock, phase_done);
         if (--waiters_ == 0)
         {
             cv_.notify_one();
         }
     }
 
+    void barrier::arrive_and_drop()
+    {
+        assert(expected_.load(std::memory_order_relaxed) > 0);
+        static_cast<void>(expected_.fetch_sub(1, std::memory_order_acq_rel));
+        static_cast<void>(arrive());
+    }
+
+    std::uint32_t barrier::completed_phases() const noexcept
+    {
+        return phase_.load(std::memory_order_acquire) / phase_unit;
+    }
+
     static_thread_pool::static_thread_pool(std::size_t num_threads)
     {
         threads_.reserve(num_threads);
@@ -151,6 +377,48 @@ namespace pco
         }
     }
 
+    static_thread_pool::static_thread_pool(const std::vector<thread_pool_params>& workers)
+    {
+        threads_.reserve(workers.size());
+        for (const auto& params : workers)
+        {
+#if defined(ESP_PLATFORM)
+            // std::thread is a pthread on ESP-IDF: its stack, priority and core come from the pthread config
+            esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+            if (0U != params.stack_size)
+            {
+                cfg.stack_size = params.stack_size;
+            }
+            if (params.priority >= 0)
+            {
+                cfg.prio = params.priority;
+            }
+            if (params.cpu_affinity >= 0)
+            {
+                cfg.pin_to_core = params.cpu_affinity;
+            }
+            if (!params.name.empty())
+            {
+                cfg.thread_name = params.name.c_str();
+            }
+            esp_pthread_set_cfg(&cfg);
+            threads_.emplace_back(&static_thread_pool::attach, this);
+            const esp_pthread_cfg_t default_cfg = esp_pthread_get_default_config();
+            esp_pthread_set_cfg(&default_cfg);
+#elif defined(FREERTOS_PLATFORM)
+            static_cast<void>(params);
+            threads_.emplace_back(&static_thread_pool::attach, this);
+#else
+            threads_.emplace_back(
+                [this, params]
+                {
+                    tools::set_current_thread_params(params.name, params.cpu_affinity, params.priority);
+                    attach();
+                });
+#endif
+        }
+    }
+
     static_thread_pool::~static_thread_pool()
     {
         stop();
@@ -191,4 +459,176 @@ namespace pco
         threads_.clear();
     }
 
+    work_stealing_thread_pool::work_stealing_thread_pool(std::size_t num_threads)
+    {
+        const std::size_t nb_workers = (num_threads == 0U) ? 1U : num_threads;
+
+        workers_.reserve(nb_workers);
+        for (std::size_t index = 0U; index < nb_workers; ++index)
+        {
+            workers_.emplace_back(std::make_unique<worker>());
+            workers_.back()->rng_state = static_cast<std::uint32_t>((index + 1U) * 0x9E3779B9U); // NOLINT golden ratio
+        }
+
+        threads_.reserve(nb_workers);
+        for (std::size_t index = 0U; index < nb_workers; ++index)
+        {
+            threads_.emplace_back(&work_stealing_thread_pool::run_worker, this, index);
+        }
+    }
+
+    work_stealing_thread_pool::~work_stealing_thread_pool()
+    {
+        stop();
+        wait();
+
+        for (auto* task : injected_)
+        {
+            delete task; // NOLINT owning raw pointer, see work_stealing_deque
+        }
+        injected_.clear();
+    }
+
+    void work_stealing_thread_pool::stop()
+    {
+        stopped_.store(true);
+        closed_.store(true);
+        {
+            std::scoped_lock<tools::critical_section> lock { mutex_ };
+        }
+        cv_.notify_all();
+    }
+
+    void work_stealing_thread_pool::wait()
+    {
+        closed_.store(true);
+        {
+            std::scoped_lock<tools::critical_section> lock { mutex_ };
+        }
+        cv_.notify_all();
+
+        for (auto& thread : threads_)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+        threads_.clear();
+    }
+
+    void work_stealing_thread_pool::submit(unique_function<void()>&& fun)
+    {
+        if (stopped_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const bool nested = (current_worker.pool == this);
+        if (!nested && closed_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto* task = new detail::work_stealing_deque::task_type(std::move(fun));
+
+        // counted before the task is visible: a worker may take it and decrement pending_ before this call returns
+        pending_.fetch_add(1U);
+
+        if (nested)
+        {
+            // continuation or nested task: LIFO on the local deque, no lock
+            workers_[current_worker.index]->deque.push(task);
+        }
+        else
+        {
+            std::scoped_lock<tools::critical_section> lock { inject_mutex_ };
+            injected_.push_back(task);
+            injected_size_.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        // pairs with the sleepers_ increment and pending_ check of the idle workers
+        if (sleepers_.load() > 0U)
+        {
+            {
+                std::scoped_lock<tools::critical_section> lock { mutex_ };
+            }
+            cv_.notify_one();
+        }
+    }
+
+    detail::work_stealing_deque::task_type* work_stealing_thread_pool::find_task(std::size_t index)
+    {
+        worker& self = *workers_[index];
+
+        if (auto* task = self.deque.take())
+        {
+            return task;
+        }
+
+        if (injected_size_.load(std::memory_order_relaxed) > 0U)
+        {
+            std::scoped_lock<tools::critical_section> lock { inject_mutex_ };
+            if (!injected_.empty())
+            {
+                auto* task = injected_.front();
+                injected_.pop_front();
+                injected_size_.fetch_sub(1U, std::memory_order_relaxed);
+                return task;
+            }
+        }
+
+        // xorshift32 victim selection
+        self.rng_state ^= self.rng_state << 13U; // NOLINT xorshift constants
+        self.rng_state ^= self.rng_state >> 17U; // NOLINT xorshift constants
+        self.rng_state ^= self.rng_state << 5U;  // NOLINT xorshift constants
+
+        const std::size_t nb_workers = workers_.size();
+        const std::size_t first_victim = self.rng_state % nb_workers;
+        for (std::size_t attempt = 0U; attempt < nb_workers; ++attempt)
+        {
+            const std::size_t victim = (first_victim + attempt) % nb_workers;
+            if (victim == index)
+            {
+                continue;
+            }
+
+            if (auto* task = workers_[victim]->deque.steal())
+            {
+                steals_.fetch_add(1U, std::memory_order_relaxed);
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void work_stealing_thread_pool::run_worker(std::size_t index)
+    {
+        current_worker = { this, index };
+
+        while (!stopped_.load(std::memory_order_relaxed))
+        {
+            if (auto* task = find_task(index))
+            {
+                pending_.fetch_sub(1U);
+                std::unique_ptr<detail::work_stealing_deque::task_type> owned_task { task };
+                static_cast<void>(owned_task->invoke());
+                continue;
+            }
+
+            std::unique_lock<tools::critical_section> lock { mutex_ };
+            sleepers_.fetch_add(1U);
+            cv_.wait(lock, [this] { return stopped_.load() || closed_.load() || (pending_.load() > 0U); });
+            sleepers_.fetch_sub(1U);
+
+            if (closed_.load() && (pending_.load() == 0U))
+            {
+                break;
+            }
+        }
+
+        current_worker = {};
+    }
+
 } // namespace pco
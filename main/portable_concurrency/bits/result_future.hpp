@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -25,6 +26,9 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -33,6 +37,8 @@
 #include "coro.hpp"
 #include "execution_impl.hpp"
 #include "fwd.hpp"
+#include "slab_allocator.hpp"
+#include "stop_token.hpp"
 #include "tools/cond_var.hpp"
 #include "tools/critical_section.hpp"
 #include "tools/expected.hpp"
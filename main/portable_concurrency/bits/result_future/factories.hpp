@@ -66,132 +66,197 @@ namespace pco
         return std::move(promise_and_future.second);
     }
 
-    /**
-     * @brief Posts callable execution to an executor and returns a result-based future.
-     * @tparam Exec Executor type satisfying is_executor.
-     * @tparam F Callable type.
-     * @tparam A Callable argument types.
-     * @param exec Executor used to schedule callable execution.
-     * @param function_arg Callable to run asynchronously.
-     * @param args Callable arguments forwarded to function_arg.
-     * @return Future containing callable result, nested-handle unwrapped when needed.
-     */
-    template <typename Exec, typename F, typename... A>
-    future_result<typename detail::unwrapped_result_value<typename detail::invoke_decay_t<F, A...>>::type, result_error>
-    async_result(Exec&& exec, F&& function_arg, A&&... args)
+    namespace detail
     {
-        static_assert(is_executor<std::decay_t<Exec>>::value, "Exec must satisfy pco::is_executor");
+        /**
+         * @brief Result value type of `async_result` for a callable and its arguments.
+         * @tparam F Callable type.
+         * @tparam A Callable argument types.
+         */
+        template <typename F, typename... A>
+        using async_result_value_t = typename unwrapped_result_value<invoke_decay_t<F, A...>>::type;
 
-        using raw_value_t = typename detail::invoke_decay_t<F, A...>;
-        using value_t = typename detail::unwrapped_result_value<raw_value_t>::type;
+        /**
+         * @brief Posts callable execution to an executor, fulfilling an already created promise/future pair.
+         * @tparam Exec Executor type satisfying is_executor.
+         * @tparam F Callable type.
+         * @tparam A Callable argument types.
+         * @param promise_and_future Pair created by make_result_promise.
+         * @param exec Executor used to schedule callable execution.
+         * @param function_arg Callable to run asynchronously.
+         * @param args Callable arguments forwarded to function_arg.
+         * @return The future of the pair.
+         */
+        template <typename Exec, typename F, typename... A>
+        future_result<async_result_value_t<F, A...>, result_error> post_async_result(
+            std::pair<promise_result<async_result_value_t<F, A...>, result_error>,
+                future_result<async_result_value_t<F, A...>, result_error>>
+                promise_and_future,
+            Exec&& exec, F&& function_arg, A&&... args)
+        {
+            static_assert(is_executor<std::decay_t<Exec>>::value, "Exec must satisfy pco::is_executor");
 
-        auto promise_and_future = make_result_promise<value_t, result_error>();
-        auto promise = std::move(promise_and_future.first);
-        auto future = std::move(promise_and_future.second);
+            using raw_value_t = typename detail::invoke_decay_t<F, A...>;
+            using value_t = typename detail::unwrapped_result_value<raw_value_t>::type;
 
-        if constexpr (detail::is_result_handle<raw_value_t>::value)
-        {
-            /**
-             * @brief Shared state for flattening nested result handles in `async_result`.
-             */
-            struct UnwrapCtx
-            {
-                raw_value_t inner;
-                promise_result<value_t, result_error> outer;
-            };
+            auto promise = std::move(promise_and_future.first);
+            auto future = std::move(promise_and_future.second);
 
-            auto task = [promise = std::move(promise), function_arg = std::forward<F>(function_arg),
-                            params = std::make_tuple(std::forward<A>(args)...)]() mutable
+            if constexpr (detail::is_result_handle<raw_value_t>::value)
             {
-                raw_value_t inner = [&]()
+                /**
+                 * @brief Shared state for flattening nested result handles in `async_result`.
+                 */
+                struct UnwrapCtx
                 {
-                    auto function_local = std::move(function_arg);
-                    auto params_local = std::move(params);
-                    return std::apply(std::move(function_local), std::move(params_local));
-                }();
+                    raw_value_t inner;
+                    promise_result<value_t, result_error> outer;
+                };
 
-                auto ctx = std::make_shared<UnwrapCtx>(UnwrapCtx { std::move(inner), std::move(promise) });
-
-                if constexpr (detail::is_result_future<raw_value_t>::value)
+                auto task = [promise = std::move(promise), function_arg = std::forward<F>(function_arg),
+                                params = std::make_tuple(std::forward<A>(args)...)]() mutable
                 {
-                    ctx->inner.notify(
-                        [ctx]() mutable
-                        {
-                            auto result_holder = ctx->inner.get_result();
-                            if (result_holder.has_value())
+                    if (!promise.is_awaiten())
+                    {
+                        return;
+                    }
+
+                    raw_value_t inner = [&]()
+                    {
+                        auto function_local = std::move(function_arg);
+                        auto params_local = std::move(params);
+                        return std::apply(std::move(function_local), std::move(params_local));
+                    }();
+
+                    auto ctx = std::make_shared<UnwrapCtx>(UnwrapCtx { std::move(inner), std::move(promise) });
+
+                    if constexpr (detail::is_result_future<raw_value_t>::value)
+                    {
+                        ctx->inner.notify(
+                            [ctx]() mutable
                             {
-                                if constexpr (std::is_void_v<value_t>)
+                                auto result_holder = ctx->inner.get_result();
+                                if (result_holder.has_value())
                                 {
-                                    ctx->outer.set_value();
+                                    if constexpr (std::is_void_v<value_t>)
+                                    {
+                                        ctx->outer.set_value();
+                                    }
+                                    else
+                                    {
+                                        ctx->outer.set_value(std::move(result_holder).value());
+                                    }
                                 }
                                 else
                                 {
-                                    ctx->outer.set_value(std::move(result_holder).value());
+                                    ctx->outer.set_error(result_holder.error());
                                 }
-                            }
-                            else
-                            {
-                                ctx->outer.set_error(result_holder.error());
-                            }
-                        });
-                }
-                else
-                {
-                    ctx->inner.notify(
-                        [ctx]() mutable
-                        {
-                            const auto& result_holder = ctx->inner.get_result();
-                            if (result_holder.has_value())
+                            });
+                    }
+                    else
+                    {
+                        ctx->inner.notify(
+                            [ctx]() mutable
                             {
-                                if constexpr (std::is_void_v<value_t>)
+                                const auto& result_holder = ctx->inner.get_result();
+                                if (result_holder.has_value())
                                 {
-                                    ctx->outer.set_value();
+                                    if constexpr (std::is_void_v<value_t>)
+                                    {
+                                        ctx->outer.set_value();
+                                    }
+                                    else
+                                    {
+                                        ctx->outer.set_value(result_holder.value());
+                                    }
                                 }
                                 else
                                 {
-                                    ctx->outer.set_value(result_holder.value());
+                                    ctx->outer.set_error(result_holder.error());
                                 }
-                            }
-                            else
-                            {
-                                ctx->outer.set_error(result_holder.error());
-                            }
-                        });
-                }
-            };
+                            });
+                    }
+                };
 
-            post(std::forward<Exec>(exec), std::move(task));
-        }
-        else
-        {
-            auto task = [promise = std::move(promise), function_arg = std::forward<F>(function_arg),
-                            params = std::make_tuple(std::forward<A>(args)...)]() mutable
+                post(std::forward<Exec>(exec), std::move(task));
+            }
+            else
             {
-                if constexpr (std::is_void_v<value_t>)
+                auto task = [promise = std::move(promise), function_arg = std::forward<F>(function_arg),
+                                params = std::make_tuple(std::forward<A>(args)...)]() mutable
                 {
+                    // future dropped or stop requested while queued: nobody waits for the work anymore
+                    if (!promise.is_awaiten())
                     {
-                        auto function_local = std::move(function_arg);
-                        auto params_local = std::move(params);
-                        std::apply(function_local, std::move(params_local));
+                        return;
                     }
-                    promise.set_value();
-                }
-                else
-                {
-                    auto val = [&]()
+
+                    if constexpr (std::is_void_v<value_t>)
                     {
-                        auto function_local = std::move(function_arg);
-                        auto params_local = std::move(params);
-                        return std::apply(function_local, std::move(params_local));
-                    }();
-                    promise.set_value(std::move(val));
-                }
-            };
+                        {
+                            auto function_local = std::move(function_arg);
+                            auto params_local = std::move(params);
+                            std::apply(function_local, std::move(params_local));
+                        }
+                        promise.set_value();
+                    }
+                    else
+                    {
+                        auto val = [&]()
+                        {
+                            auto function_local = std::move(function_arg);
+                            auto params_local = std::move(params);
+                            return std::apply(function_local, std::move(params_local));
+                        }();
+                        promise.set_value(std::move(val));
+                    }
+                };
+
+                post(std::forward<Exec>(exec), std::move(task));
+            }
 
-            post(std::forward<Exec>(exec), std::move(task));
+            return future;
         }
+    } // namespace detail
+
+    /**
+     * @brief Posts callable execution to an executor and returns a result-based future.
+     * @tparam Exec Executor type satisfying is_executor.
+     * @tparam F Callable type.
+     * @tparam A Callable argument types.
+     * @param exec Executor used to schedule callable execution.
+     * @param function_arg Callable to run asynchronously.
+     * @param args Callable arguments forwarded to function_arg.
+     * @return Future containing callable result, nested-handle unwrapped when needed.
+     */
+    template <typename Exec, typename F, typename... A>
+    future_result<detail::async_result_value_t<F, A...>, result_error> async_result(
+        Exec&& exec, F&& function_arg, A&&... args)
+    {
+        return detail::post_async_result(make_result_promise<detail::async_result_value_t<F, A...>, result_error>(),
+            std::forward<Exec>(exec), std::forward<F>(function_arg), std::forward<A>(args)...);
+    }
 
-        return future;
+    /**
+     * @brief Posts callable execution to an executor, allocating the result shared state with a custom allocator.
+     * @tparam Alloc Allocator type, e.g. the one returned by result_state_allocator<T>().
+     * @tparam Exec Executor type satisfying is_executor.
+     * @tparam F Callable type.
+     * @tparam A Callable argument types.
+     * @param tag Allocator-tag selector.
+     * @param alloc Allocator used for the shared state of the returned future.
+     * @param exec Executor used to schedule callable execution.
+     * @param function_arg Callable to run asynchronously.
+     * @param args Callable arguments forwarded to function_arg.
+     * @return Future containing callable result, nested-handle unwrapped when needed.
+     */
+    template <typename Alloc, typename Exec, typename F, typename... A>
+    future_result<detail::async_result_value_t<F, A...>, result_error> async_result(
+        std::allocator_arg_t tag, const Alloc& alloc, Exec&& exec, F&& function_arg, A&&... args)
+    {
+        return detail::post_async_result(
+            make_result_promise<detail::async_result_value_t<F, A...>, result_error>(tag, alloc),
+            std::forward<Exec>(exec), std::forward<F>(function_arg), std::forward<A>(args)...);
     }
 
 } // namespace pco
@@ -131,6 +131,31 @@ namespace pco
             return state_->ready_;
         }
 
+        /**
+         * @brief Binds a stop token to this future and to every continuation chained on it afterwards.
+         *
+         * Requesting stop completes the pending states of the chain with the cancellation error at once: waiters
+         * are released, pending continuations are skipped and queued producers see the request through their
+         * promise and drop their work when dequeued.
+         *
+         * @param token Stop token, ignored when not associated with a source.
+         * @return This future.
+         */
+        future_result with_stop_token(const stop_token& token) &&
+        {
+            detail::bind_stop_token(state_, token);
+            return std::move(*this);
+        }
+
+        /**
+         * @brief Returns the stop token bound to this future.
+         * @return Bound token, or a token with no source.
+         */
+        [[nodiscard]] stop_token get_stop_token() const
+        {
+            return detail::get_stop_token(state_);
+        }
+
 #if defined(PC_HAS_COROUTINES)
         [[nodiscard]] bool await_ready() const noexcept
         {
@@ -199,6 +224,7 @@ namespace pco
             using next_raw_t = typename detail::result_then_value_type<F, T>::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -284,6 +310,7 @@ namespace pco
         {
             promise_result<T, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -358,6 +385,7 @@ namespace pco
             using next_raw_t = typename traits_t::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -453,6 +481,7 @@ namespace pco
 
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -559,6 +588,7 @@ namespace pco
                 std::reference_wrapper<std::remove_reference_t<Exec>>, std::decay_t<Exec>>;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -736,6 +766,7 @@ namespace pco
 
             promise_result<T, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -869,6 +900,7 @@ namespace pco
                 std::reference_wrapper<std::remove_reference_t<Exec>>, std::decay_t<Exec>>;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
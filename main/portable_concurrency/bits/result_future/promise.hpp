@@ -59,6 +59,35 @@ namespace pco
         {
         }
 
+        /**
+         * @brief Creates a promise whose shared state is allocated with a custom allocator.
+         * @tparam Alloc Allocator type, rebound by std::allocate_shared.
+         * @param tag Allocator-tag selector.
+         * @param alloc Allocator used for the shared state and its control block.
+         */
+        template <typename Alloc>
+        promise_result([[maybe_unused]] std::allocator_arg_t tag, const Alloc& alloc)
+            : state_(std::allocate_shared<detail::result_shared_state<T, E>>(alloc))
+        {
+        }
+
+        /**
+         * @brief Creates a promise with cancellation callback support and a custom state allocator.
+         * @tparam Alloc Allocator type, rebound by std::allocate_shared.
+         * @tparam F Cancellation callback type.
+         * @param tag Allocator-tag selector.
+         * @param alloc Allocator used for the shared state and its control block.
+         * @param canceler_tag Cancellation-tag selector.
+         * @param cancel_action Callback invoked when abandoned before readiness.
+         */
+        template <typename Alloc, typename F>
+        promise_result([[maybe_unused]] std::allocator_arg_t tag, const Alloc& alloc, canceler_arg_t canceler_tag,
+            F&& cancel_action)
+            : state_(std::allocate_shared<detail::result_shared_state<T, E>>(
+                alloc, canceler_tag, std::forward<F>(cancel_action)))
+        {
+        }
+
         explicit promise_result(detail::result_state_ptr<T, E> state)
             : state_(std::move(state))
         {
@@ -145,7 +174,9 @@ namespace pco
                 std::scoped_lock<tools::critical_section> guard(state->mutex_);
                 if (!state->ready_)
                 {
-                    state->result_.emplace(tools::unexpected<E>(E::broken_promise));
+                    // a producer giving up after a stop request reports the cancellation, not a broken promise
+                    state->result_.emplace(tools::unexpected<E>(
+                        state->stop_token_.stop_requested() ? detail::cancelled_error<E>() : E::broken_promise));
                     state->ready_ = true;
                     cbs = std::move(state->on_ready_cbs_);
                     state->cv_.notify_all();
@@ -239,11 +270,42 @@ namespace pco
 
         /**
          * @brief Reports whether the consumer side is still awaiting completion.
-         * @return true while state is still potentially observed by a consumer.
+         * @return true while state is still potentially observed by a consumer and no stop was requested on it.
          */
         [[nodiscard]] bool is_awaiten() const noexcept
         {
-            return static_cast<bool>(state_) || !weak_state_.expired();
+            if (!state_ && weak_state_.expired())
+            {
+                return false;
+            }
+            return !stop_requested();
+        }
+
+        /**
+         * @brief Binds a stop token to the state: requesting stop completes it with the cancellation error.
+         * @param token Stop token, ignored when not associated with a source.
+         */
+        void set_stop_token(const stop_token& token)
+        {
+            detail::bind_stop_token(get_state(), token);
+        }
+
+        /**
+         * @brief Returns the stop token bound to the state, for the producer to poll while running.
+         * @return Bound token, or a token with no source.
+         */
+        [[nodiscard]] stop_token get_stop_token() const
+        {
+            return detail::get_stop_token(get_state());
+        }
+
+        /**
+         * @brief Checks whether stop was requested on the token bound to the state.
+         * @return true when the work producing this result should be abandoned.
+         */
+        [[nodiscard]] bool stop_requested() const
+        {
+            return get_stop_token().stop_requested();
         }
 
         explicit operator bool() const noexcept
@@ -305,6 +367,57 @@ namespace pco
         bool future_retrieved_ = false;
     };
 
+    /** @brief Default number of shared states a result_state_slab holds. */
+    constexpr std::size_t default_result_state_slab_capacity = 16U;
+
+    namespace detail
+    {
+        /** @brief Bytes reserved for the std::allocate_shared control block in front of a pooled state. */
+        constexpr std::size_t shared_control_block_overhead = 4U * sizeof(void*);
+    } // namespace detail
+
+    /**
+     * @brief Slab pool sized for the allocate_shared blocks of result_shared_state<T, E>.
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam Capacity Number of states.
+     */
+    template <typename T, typename E = result_error, std::size_t Capacity = default_result_state_slab_capacity>
+    using result_state_slab
+        = slab_pool<sizeof(detail::result_shared_state<T, E>) + detail::shared_control_block_overhead, Capacity>;
+
+    /**
+     * @brief Returns the process-wide slab of result<T, E> shared states.
+     *
+     * One static slab exists per (T, E, Capacity), so that future-heavy code of a given type has a footprint
+     * fixed at build time; states beyond Capacity are served by the heap and counted as fallbacks.
+     *
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam Capacity Number of states.
+     * @return Slab instance.
+     */
+    template <typename T, typename E = result_error, std::size_t Capacity = default_result_state_slab_capacity>
+    result_state_slab<T, E, Capacity>& result_state_pool()
+    {
+        static result_state_slab<T, E, Capacity> pool;
+        return pool;
+    }
+
+    /**
+     * @brief Returns an allocator drawing result<T, E> shared states from result_state_pool().
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam Capacity Number of states.
+     * @return Allocator to pass to make_result_promise or async_result with std::allocator_arg.
+     */
+    template <typename T, typename E = result_error, std::size_t Capacity = default_result_state_slab_capacity>
+    slab_allocator<detail::result_shared_state<T, E>, result_state_slab<T, E, Capacity>> result_state_allocator()
+    {
+        return slab_allocator<detail::result_shared_state<T, E>, result_state_slab<T, E, Capacity>>(
+            result_state_pool<T, E, Capacity>());
+    }
+
     namespace detail
     {
         template <typename NextT, typename E, typename Handle>
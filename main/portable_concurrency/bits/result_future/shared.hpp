@@ -132,6 +132,26 @@ namespace pco
             return state_->ready_;
         }
 
+        /**
+         * @brief Binds a stop token to the shared state and to every continuation chained on it afterwards.
+         * @param token Stop token, ignored when not associated with a source.
+         * @return A copy of this handle.
+         */
+        shared_result with_stop_token(const stop_token& token) const
+        {
+            detail::bind_stop_token(state_, token);
+            return *this;
+        }
+
+        /**
+         * @brief Returns the stop token bound to the shared state.
+         * @return Bound token, or a token with no source.
+         */
+        [[nodiscard]] stop_token get_stop_token() const
+        {
+            return detail::get_stop_token(state_);
+        }
+
         /**
          * @brief Waits and returns a stable reference to the stored expected result.
          * @return Reference to the shared expected payload.
@@ -233,6 +253,7 @@ namespace pco
             using next_raw_t = typename detail::result_shared_then_value_type<F, T>::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for `shared_result::then_value` chaining.
@@ -317,6 +338,7 @@ namespace pco
             using next_raw_t = typename detail::result_shared_then_value_type<F, T>::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for executor-aware `then_value` chaining.
@@ -424,6 +446,7 @@ namespace pco
             using next_value_t = detail::interrupt_promise_arg_t<F, shared_result<T, E>, E>;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             if (!state_)
             {
@@ -504,6 +527,7 @@ namespace pco
         {
             promise_result<T, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for `then_error` chaining on shared_result.
@@ -562,6 +586,7 @@ namespace pco
 
             promise_result<T, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for executor-aware `then_error` chaining.
@@ -633,6 +658,7 @@ namespace pco
             using next_raw_t = typename traits_t::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for `then_result` chaining on shared_result.
@@ -685,6 +711,7 @@ namespace pco
             using next_raw_t = typename traits_t::raw_type;
             promise_result<next_value_t, E> next_promise;
             auto next_future = next_promise.get_future();
+            next_promise.set_stop_token(get_stop_token());
 
             /**
              * @brief Shared continuation context for executor-aware `then_result` chaining.
@@ -773,4 +800,22 @@ namespace pco
         return { std::move(promise), std::move(future) };
     }
 
+    /**
+     * @brief Creates a promise/future pair whose shared state is allocated with a custom allocator.
+     * @tparam T Value type delivered on success.
+     * @tparam E Error enum type.
+     * @tparam Alloc Allocator type, e.g. the one returned by result_state_allocator<T, E>().
+     * @param tag Allocator-tag selector.
+     * @param alloc Allocator used for the shared state and its control block.
+     * @return Pair of {promise_result, future_result}.
+     */
+    template <typename T, typename E = result_error, typename Alloc>
+    std::pair<promise_result<T, E>, future_result<T, E>> make_result_promise(
+        std::allocator_arg_t tag, const Alloc& alloc)
+    {
+        promise_result<T, E> promise(tag, alloc);
+        auto future = promise.get_future();
+        return { std::move(promise), std::move(future) };
+    }
+
 } // namespace pco
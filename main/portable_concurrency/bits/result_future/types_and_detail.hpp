@@ -27,6 +27,7 @@ namespace pco
         broken_promise,
         execution_failure,
         continuation_failure,
+        cancelled,
     };
 
     /**
@@ -247,6 +248,8 @@ namespace pco
             std::vector<std::function<void()>> on_ready_cbs_;
             /** @brief Optional cancellation action invoked on abandonment. */
             unique_function<void()> cancel_action_;
+            /** @brief Stop token bound to this state, inherited by the continuations chained on it. */
+            stop_token stop_token_;
         };
 
         /**
@@ -257,6 +260,179 @@ namespace pco
         template <typename T, typename E>
         using result_state_ptr = std::shared_ptr<result_shared_state<T, E>>;
 
+        /** @brief Trait detecting error types providing a `cancelled` enumerator. */
+        template <typename E, typename = void>
+        struct has_cancelled_error : std::false_type
+        {
+        };
+
+        /**
+         * @brief Positive specialization for error types providing `E::cancelled`.
+         * @tparam E Error type.
+         */
+        template <typename E>
+        struct has_cancelled_error<E, std::void_t<decltype(E::cancelled)>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Error stored in a state completed by a stop request.
+         * @tparam E Error type.
+         * @return `E::cancelled` when the error type has one, `E::broken_promise` otherwise.
+         */
+        template <typename E>
+        constexpr E cancelled_error() noexcept
+        {
+            if constexpr (has_cancelled_error<E>::value)
+            {
+                return E::cancelled;
+            }
+            else
+            {
+                return E::broken_promise;
+            }
+        }
+
+        /**
+         * @brief Completes a pending state with the cancellation error and runs its cancel action and callbacks.
+         * @tparam T Value type.
+         * @tparam E Error type.
+         * @param state Shared result state.
+         */
+        template <typename T, typename E>
+        void cancel_state(const result_state_ptr<T, E>& state)
+        {
+            std::vector<std::function<void()>> callbacks;
+            unique_function<void()> cancel_action;
+            {
+                std::scoped_lock<tools::critical_section> guard(state->mutex_);
+                if (state->ready_)
+                {
+                    return;
+                }
+                state->result_.emplace(tools::unexpected<E>(cancelled_error<E>()));
+                state->ready_ = true;
+                cancel_action = std::move(state->cancel_action_);
+                callbacks = std::move(state->on_ready_cbs_);
+                state->cv_.notify_all();
+            }
+            if (cancel_action)
+            {
+                static_cast<void>(cancel_action.invoke());
+            }
+            for (auto& callback : callbacks)
+            {
+                callback();
+            }
+        }
+
+        /**
+         * @brief Binds a stop token to a state, which is cancelled as soon as stop is requested.
+         * @tparam T Value type.
+         * @tparam E Error type.
+         * @param state Shared result state, may be null.
+         * @param token Stop token, ignored when not associated with a source.
+         */
+        template <typename T, typename E>
+        void bind_stop_token(const result_state_ptr<T, E>& state, const stop_token& token)
+        {
+            if (!state || !token.stop_possible())
+            {
+                return;
+            }
+
+            {
+                // a ready state keeps the token for the continuations chained on it, but has nothing to cancel
+                std::scoped_lock<tools::critical_section> guard(state->mutex_);
+                if (state->stop_token_ == token)
+                {
+                    return;
+                }
+                state->stop_token_ = token;
+                if (state->ready_)
+                {
+                    return;
+                }
+            }
+
+            std::weak_ptr<result_shared_state<T, E>> weak_state = state;
+            register_stop_callback(token, weak_state,
+                [weak_state]()
+                {
+                    if (auto locked = weak_state.lock())
+                    {
+                        cancel_state(locked);
+                    }
+                });
+        }
+
+        /**
+         * @brief Reads the stop token bound to a state.
+         * @tparam T Value type.
+         * @tparam E Error type.
+         * @param state Shared result state, may be null.
+         * @return Bound token, or a token with no source.
+         */
+        template <typename T, typename E>
+        stop_token get_stop_token(const result_state_ptr<T, E>& state)
+        {
+            if (!state)
+            {
+                return {};
+            }
+            std::scoped_lock<tools::critical_section> guard(state->mutex_);
+            return state->stop_token_;
+        }
+
+        /**
+         * @brief Ends the recursion of first_stop_token over an empty pack.
+         * @return A token with no source.
+         */
+        inline stop_token first_stop_token()
+        {
+            return {};
+        }
+
+        /**
+         * @brief Finds the first stop token bound to one of the given result handles.
+         * @tparam Handle First result handle type.
+         * @tparam Handles Remaining result handle types.
+         * @param handle First result handle.
+         * @param handles Remaining result handles.
+         * @return First bound token, or a token with no source.
+         */
+        template <typename Handle, typename... Handles>
+        stop_token first_stop_token(const Handle& handle, const Handles&... handles)
+        {
+            stop_token token = handle.get_stop_token();
+            if (token.stop_possible())
+            {
+                return token;
+            }
+            return first_stop_token(handles...);
+        }
+
+        /**
+         * @brief Finds the first stop token bound to one of the result handles of a range.
+         * @tparam InputIt Iterator to result handles.
+         * @param first Range begin iterator.
+         * @param last Range end iterator.
+         * @return First bound token, or a token with no source.
+         */
+        template <typename InputIt>
+        stop_token first_stop_token_in(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                stop_token token = first->get_stop_token();
+                if (token.stop_possible())
+                {
+                    return token;
+                }
+            }
+            return {};
+        }
+
         /**
          * @brief Decayed invoke result alias.
          * @tparam F Callable type.
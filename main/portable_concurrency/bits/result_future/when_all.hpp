@@ -89,6 +89,8 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(
+            std::apply([](const auto&... item) { return detail::first_stop_token(item...); }, future_tuple));
         auto ctx = std::make_shared<WhenAllCtx>(sizeof...(Futures), std::move(future_tuple), std::move(promise));
 
         auto subscribe_one = [&](auto& future_item)
@@ -162,6 +164,8 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(
+            std::apply([](const auto&... item) { return detail::first_stop_token(item...); }, shared_tuple));
         auto ctx
             = std::make_shared<WhenAllSharedCtx>(sizeof...(SharedResults), std::move(shared_tuple), std::move(promise));
 
@@ -235,6 +239,8 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(
+            std::apply([](const auto&... item) { return detail::first_stop_token(item...); }, handle_tuple));
         auto ctx = std::make_shared<WhenAllMixedCtx>(sizeof...(Handles), std::move(handle_tuple), std::move(promise));
 
         auto subscribe_one = [&](auto& handle)
@@ -317,6 +323,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
         auto ctx = std::make_shared<WhenAllVectorCtx>(futures.size(), std::move(futures), std::move(promise));
 
         for (auto& future : ctx->futures)
@@ -402,6 +409,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
         auto ctx = std::make_shared<WhenAllVectorCtx>(futures.size(), std::move(futures), std::move(promise));
 
         for (auto& future : ctx->futures)
@@ -425,6 +433,192 @@ namespace pco
         return combined_future;
     }
 
+    namespace detail
+    {
+        /**
+         * @brief Consumes the results of an array of ready futures, element-wise constructed in input order.
+         * @tparam T Value type.
+         * @tparam E Error type.
+         * @tparam N Number of futures.
+         * @tparam I Indices 0..N-1.
+         * @param futures Ready futures.
+         * @return Array of results.
+         */
+        template <typename T, typename E, std::size_t N, std::size_t... I>
+        std::array<tools::expected<T, E>, N> take_ready_results(
+            std::array<future_result<T, E>, N>& futures, std::index_sequence<I...> /*indices*/)
+        {
+            return std::array<tools::expected<T, E>, N> { futures[I].take_ready_result()... };
+        }
+    } // namespace detail
+
+    /**
+     * @brief Aggregates a fixed-size array of future_result handles.
+     *
+     * The futures are kept inline in a single aggregate context, so that the allocation count does not depend on
+     * the operand count: one shared state for the returned future and one context, whatever N.
+     *
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam N Number of futures.
+     * @param futures Futures to wait for.
+     * @return Future with an array of input result payloads, in input order.
+     */
+    template <typename T, typename E, std::size_t N>
+    future_result<std::array<tools::expected<T, E>, N>, E> when_all(std::array<future_result<T, E>, N> futures)
+    {
+        using results_array_t = std::array<tools::expected<T, E>, N>;
+
+        auto promise_and_future = make_result_promise<results_array_t, E>();
+        auto promise = std::move(promise_and_future.first);
+        auto combined_future = std::move(promise_and_future.second);
+
+        if constexpr (0U == N)
+        {
+            promise.set_value(results_array_t {});
+            return combined_future;
+        }
+        else
+        {
+            for (auto& future : futures)
+            {
+                if (!future.valid())
+                {
+                    promise.set_error(E::no_state);
+                    return combined_future;
+                }
+            }
+
+            /**
+             * @brief Shared state for array-based future_result `when_all` aggregation.
+             */
+            struct WhenAllArrayCtx
+            {
+                /** @brief Remaining input futures not yet completed. */
+                std::atomic<std::size_t> remaining_ { N };
+                /** @brief Stored input futures. */
+                std::array<future_result<T, E>, N> futures;
+                /** @brief Promise completing aggregated output future. */
+                promise_result<results_array_t, E> promise;
+
+                WhenAllArrayCtx(std::array<future_result<T, E>, N> input_futures,
+                    promise_result<results_array_t, E> input_promise)
+                    : futures(std::move(input_futures))
+                    , promise(std::move(input_promise))
+                {
+                }
+            };
+
+            promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
+            auto ctx = std::make_shared<WhenAllArrayCtx>(std::move(futures), std::move(promise));
+
+            for (auto& future : ctx->futures)
+            {
+                future.subscribe(
+                    [ctx]() mutable
+                    {
+                        if (ctx->remaining_.fetch_sub(1) == 1)
+                        {
+                            ctx->promise.set_value(
+                                detail::take_ready_results(ctx->futures, std::make_index_sequence<N> {}));
+                        }
+                    });
+            }
+
+            return combined_future;
+        }
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /**
+     * @brief Aggregates a span of future_result handles into caller-provided result storage.
+     *
+     * The futures stay in the caller's storage and their results are moved into `results` once all are ready,
+     * so that the allocation count does not depend on the operand count. Both spans must stay valid until the
+     * returned future is ready.
+     *
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam FuturesExtent Extent of the futures span.
+     * @tparam ResultsExtent Extent of the results span.
+     * @param futures Futures to wait for.
+     * @param results Destination of the input results, in input order, same size as futures.
+     * @return Void future ready once results is filled, or holding no_state on a size mismatch or invalid input.
+     */
+    template <typename T, typename E, std::size_t FuturesExtent, std::size_t ResultsExtent>
+    future_result<void, E> when_all(
+        std::span<future_result<T, E>, FuturesExtent> futures, std::span<tools::expected<T, E>, ResultsExtent> results)
+    {
+        auto promise_and_future = make_result_promise<void, E>();
+        auto promise = std::move(promise_and_future.first);
+        auto combined_future = std::move(promise_and_future.second);
+
+        if (futures.size() != results.size())
+        {
+            promise.set_error(E::no_state);
+            return combined_future;
+        }
+        if (futures.empty())
+        {
+            promise.set_value();
+            return combined_future;
+        }
+        for (auto& future : futures)
+        {
+            if (!future.valid())
+            {
+                promise.set_error(E::no_state);
+                return combined_future;
+            }
+        }
+
+        /**
+         * @brief Shared state for span-based future_result `when_all` aggregation.
+         */
+        struct WhenAllSpanCtx
+        {
+            /** @brief Remaining input futures not yet completed. */
+            std::atomic<std::size_t> remaining_;
+            /** @brief Caller-owned input futures. */
+            std::span<future_result<T, E>, FuturesExtent> futures;
+            /** @brief Caller-owned result storage. */
+            std::span<tools::expected<T, E>, ResultsExtent> results;
+            /** @brief Promise completing aggregated output future. */
+            promise_result<void, E> promise;
+
+            WhenAllSpanCtx(std::span<future_result<T, E>, FuturesExtent> input_futures,
+                std::span<tools::expected<T, E>, ResultsExtent> output_results, promise_result<void, E> input_promise)
+                : remaining_(input_futures.size())
+                , futures(input_futures)
+                , results(output_results)
+                , promise(std::move(input_promise))
+            {
+            }
+        };
+
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
+        auto ctx = std::make_shared<WhenAllSpanCtx>(futures, results, std::move(promise));
+
+        for (auto& future : futures)
+        {
+            future.subscribe(
+                [ctx]() mutable
+                {
+                    if (ctx->remaining_.fetch_sub(1) == 1)
+                    {
+                        for (std::size_t index = 0U; index < ctx->futures.size(); ++index)
+                        {
+                            ctx->results[index] = ctx->futures[index].take_ready_result();
+                        }
+                        ctx->promise.set_value();
+                    }
+                });
+        }
+
+        return combined_future;
+    }
+#endif
+
     /**
      * @brief Aggregates a range of shared_result handles.
      * @tparam InputIt Iterator to shared_result-like values.
@@ -485,6 +679,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(shareds.begin(), shareds.end()));
         auto ctx = std::make_shared<WhenAllSharedVectorCtx>(shareds.size(), std::move(shareds), std::move(promise));
 
         for (auto& shared : ctx->shareds)
@@ -560,6 +755,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(shareds.begin(), shareds.end()));
         auto ctx = std::make_shared<WhenAllSharedVectorCtx>(shareds.size(), std::move(shareds), std::move(promise));
 
         for (auto& shared : ctx->shareds)
@@ -110,6 +110,8 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(
+            std::apply([](const auto&... item) { return detail::first_stop_token(item...); }, future_tuple));
         auto ctx = std::make_shared<WhenAnyCtx>(std::move(future_tuple), std::move(promise));
 
         std::size_t reg_idx = 0;
@@ -119,6 +121,12 @@ namespace pco
             future_item.subscribe(
                 [ctx, my_idx]() mutable
                 {
+                    // an input completed by the stop request must not win over the cancellation
+                    if (ctx->promise.stop_requested())
+                    {
+                        return;
+                    }
+
                     bool expected = false;
                     if (ctx->done_.compare_exchange_strong(expected, true))
                     {
@@ -205,6 +213,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
         auto ctx = std::make_shared<WhenAnyVectorCtx>(std::move(futures), std::move(promise));
 
         for (std::size_t idx = 0; idx < ctx->futures.size(); ++idx)
@@ -212,6 +221,12 @@ namespace pco
             ctx->futures[idx].subscribe(
                 [ctx, idx]() mutable
                 {
+                    // an input completed by the stop request must not win over the cancellation
+                    if (ctx->promise.stop_requested())
+                    {
+                        return;
+                    }
+
                     bool expected = false;
                     if (ctx->done_.compare_exchange_strong(expected, true))
                     {
@@ -295,6 +310,7 @@ namespace pco
             }
         };
 
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
         auto ctx = std::make_shared<WhenAnyVectorCtx>(std::move(futures), std::move(promise));
 
         for (std::size_t idx = 0; idx < ctx->futures.size(); ++idx)
@@ -302,6 +318,98 @@ namespace pco
             ctx->futures[idx].subscribe(
                 [ctx, idx]() mutable
                 {
+                    // an input completed by the stop request must not win over the cancellation
+                    if (ctx->promise.stop_requested())
+                    {
+                        return;
+                    }
+
+                    bool expected = false;
+                    if (ctx->done_.compare_exchange_strong(expected, true))
+                    {
+                        ctx->promise.set_value(any_result_t { idx, std::move(ctx->futures) });
+                    }
+                });
+        }
+
+        return combined_future;
+    }
+
+    /**
+     * @brief Races a fixed-size array of future_result handles and resolves on first ready input.
+     *
+     * The futures are kept inline in a single aggregate context, so that the allocation count does not depend on
+     * the operand count.
+     *
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam N Number of futures.
+     * @param futures Futures to race.
+     * @return Future containing winner index and preserved futures array.
+     */
+    template <typename T, typename E, std::size_t N>
+    future_result<when_any_result<std::array<future_result<T, E>, N>>, E> when_any(
+        std::array<future_result<T, E>, N> futures)
+    {
+        using futures_array_t = std::array<future_result<T, E>, N>;
+        using any_result_t = when_any_result<futures_array_t>;
+        constexpr auto npos = static_cast<std::size_t>(-1);
+
+        auto promise_and_future = make_result_promise<any_result_t, E>();
+        auto promise = std::move(promise_and_future.first);
+        auto combined_future = std::move(promise_and_future.second);
+
+        std::size_t ready_index = npos;
+        for (std::size_t idx = 0; idx < N; ++idx)
+        {
+            if (!futures[idx].valid())
+            {
+                promise.set_error(E::no_state);
+                return combined_future;
+            }
+            if (ready_index == npos && futures[idx].is_ready())
+            {
+                ready_index = idx;
+            }
+        }
+        if ((0U == N) || (ready_index != npos))
+        {
+            promise.set_value(any_result_t { ready_index, std::move(futures) });
+            return combined_future;
+        }
+
+        /**
+         * @brief Shared state for array-based `when_any` race resolution.
+         */
+        struct WhenAnyArrayCtx
+        {
+            /** @brief Atomic winner flag set by first completing input. */
+            std::atomic<bool> done_ { false };
+            /** @brief Stored input futures. */
+            futures_array_t futures;
+            /** @brief Promise completing when_any output future. */
+            promise_result<any_result_t, E> promise;
+
+            WhenAnyArrayCtx(futures_array_t input_futures, promise_result<any_result_t, E> input_promise)
+                : futures(std::move(input_futures))
+                , promise(std::move(input_promise))
+            {
+            }
+        };
+
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
+        auto ctx = std::make_shared<WhenAnyArrayCtx>(std::move(futures), std::move(promise));
+
+        for (std::size_t idx = 0; idx < N; ++idx)
+        {
+            ctx->futures[idx].subscribe(
+                [ctx, idx]() mutable
+                {
+                    if (ctx->promise.stop_requested())
+                    {
+                        return;
+                    }
+
                     bool expected = false;
                     if (ctx->done_.compare_exchange_strong(expected, true))
                     {
@@ -313,4 +421,80 @@ namespace pco
         return combined_future;
     }
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /**
+     * @brief Races a span of future_result handles kept in caller storage.
+     *
+     * Only the winner index is returned: the futures stay in the caller's storage, which must stay valid until
+     * the returned future is ready, so that the allocation count does not depend on the operand count.
+     *
+     * @tparam T Value type.
+     * @tparam E Error type.
+     * @tparam Extent Span extent.
+     * @param futures Futures to race.
+     * @return Future holding the index of the first ready input, or no_state for an empty or invalid input.
+     */
+    template <typename T, typename E, std::size_t Extent>
+    future_result<std::size_t, E> when_any(std::span<future_result<T, E>, Extent> futures)
+    {
+        auto promise_and_future = make_result_promise<std::size_t, E>();
+        auto promise = std::move(promise_and_future.first);
+        auto combined_future = std::move(promise_and_future.second);
+
+        if (futures.empty())
+        {
+            promise.set_error(E::no_state);
+            return combined_future;
+        }
+        for (std::size_t idx = 0; idx < futures.size(); ++idx)
+        {
+            if (!futures[idx].valid())
+            {
+                promise.set_error(E::no_state);
+                return combined_future;
+            }
+        }
+
+        /**
+         * @brief Shared state for span-based `when_any` race resolution.
+         */
+        struct WhenAnySpanCtx
+        {
+            /** @brief Atomic winner flag set by first completing input. */
+            std::atomic<bool> done_ { false };
+            /** @brief Promise completing when_any output future. */
+            promise_result<std::size_t, E> promise;
+
+            explicit WhenAnySpanCtx(promise_result<std::size_t, E> input_promise)
+                : promise(std::move(input_promise))
+            {
+            }
+        };
+
+        promise.set_stop_token(detail::first_stop_token_in(futures.begin(), futures.end()));
+        auto ctx = std::make_shared<WhenAnySpanCtx>(std::move(promise));
+
+        // subscribe() runs the callback inline for an input that is already ready
+        for (std::size_t idx = 0; idx < futures.size(); ++idx)
+        {
+            futures[idx].subscribe(
+                [ctx, idx]() mutable
+                {
+                    if (ctx->promise.stop_requested())
+                    {
+                        return;
+                    }
+
+                    bool expected = false;
+                    if (ctx->done_.compare_exchange_strong(expected, true))
+                    {
+                        ctx->promise.set_value(idx);
+                    }
+                });
+        }
+
+        return combined_future;
+    }
+#endif
+
 } // namespace pco
@@ -0,0 +1,275 @@
+/**
+ * @file slab_allocator.hpp
+ * @brief Fixed-capacity slab pool and allocator adapter for promise/future shared states.
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "tools/critical_section.hpp"
+
+namespace pco
+{
+    /**
+     * @brief Fixed-capacity pool of equally sized blocks, with a heap fallback once exhausted.
+     *
+     * The blocks live inside the pool object, so a pool with static storage duration gives the states allocated
+     * from it a footprint bounded at build time. Requests bigger than a block, over-aligned requests and requests
+     * made while every block is in use go to the global heap and are counted as fallbacks.
+     *
+     * @tparam BlockSize Minimum size in bytes of one block (rounded up to the fundamental alignment).
+     * @tparam Capacity Number of blocks.
+     */
+    template <std::size_t BlockSize, std::size_t Capacity>
+    class slab_pool
+    {
+        static_assert(BlockSize > 0U, "slab blocks cannot be empty");
+        static_assert(Capacity > 0U, "a slab needs at least one block");
+
+    public:
+        /** @brief Alignment of every block. */
+        static constexpr std::size_t block_alignment = alignof(std::max_align_t);
+
+        /** @brief Size in bytes of one block. */
+        static constexpr std::size_t block_size
+            = ((BlockSize + block_alignment - 1U) / block_alignment) * block_alignment;
+
+        /** @brief Number of blocks. */
+        static constexpr std::size_t capacity = Capacity;
+
+        /**
+         * @brief Creates a pool with every block free.
+         */
+        slab_pool() noexcept
+        {
+            for (std::size_t index = 0U; index < Capacity; ++index)
+            {
+                free_[index] = static_cast<std::uint32_t>(Capacity - 1U - index);
+            }
+        }
+
+        slab_pool(const slab_pool&) = delete;
+        slab_pool& operator=(const slab_pool&) = delete;
+        slab_pool(slab_pool&&) = delete;
+        slab_pool& operator=(slab_pool&&) = delete;
+        ~slab_pool() = default;
+
+        /**
+         * @brief Allocates storage from the slab, or from the heap when the request does not fit.
+         * @param bytes Requested size in bytes.
+         * @param alignment Requested alignment.
+         * @return Pointer to the storage.
+         */
+        void* allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if ((bytes <= block_size) && (alignment <= block_alignment))
+            {
+                std::scoped_lock<tools::critical_section> guard(mutex_);
+                if (free_count_ > 0U)
+                {
+                    --free_count_;
+                    const std::size_t used = Capacity - free_count_;
+                    high_water_ = (used > high_water_) ? used : high_water_;
+                    return &storage_[static_cast<std::size_t>(free_[free_count_]) * block_size];
+                }
+                ++fallbacks_;
+            }
+            else
+            {
+                std::scoped_lock<tools::critical_section> guard(mutex_);
+                ++fallbacks_;
+            }
+
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(bytes, std::align_val_t { alignment });
+            }
+
+            return ::operator new(bytes);
+        }
+
+        /**
+         * @brief Releases storage obtained from allocate().
+         * @param ptr Pointer returned by allocate().
+         * @param bytes Size passed to allocate().
+         * @param alignment Alignment passed to allocate().
+         */
+        void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            if (owns(ptr))
+            {
+                const auto offset = static_cast<std::size_t>(static_cast<unsigned char*>(ptr) - storage_.data());
+                std::scoped_lock<tools::critical_section> guard(mutex_);
+                free_[free_count_] = static_cast<std::uint32_t>(offset / block_size);
+                ++free_count_;
+                return;
+            }
+
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(ptr, bytes, std::align_val_t { alignment });
+                return;
+            }
+
+            ::operator delete(ptr, bytes);
+        }
+
+        /**
+         * @brief Tells whether a pointer designates one of the slab blocks.
+         * @param ptr Pointer to test.
+         * @return true when ptr lies inside the slab storage.
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+            const auto first = reinterpret_cast<std::uintptr_t>(storage_.data());
+            return (address >= first) && (address < (first + storage_.size()));
+        }
+
+        /**
+         * @brief Returns the number of blocks currently handed out.
+         * @return Blocks in use.
+         */
+        [[nodiscard]] std::size_t in_use() const
+        {
+            std::scoped_lock<tools::critical_section> guard(mutex_);
+            return Capacity - free_count_;
+        }
+
+        /**
+         * @brief Returns the largest number of blocks in use at the same time so far.
+         * @return High-water mark.
+         */
+        [[nodiscard]] std::size_t high_water() const
+        {
+            std::scoped_lock<tools::critical_section> guard(mutex_);
+            return high_water_;
+        }
+
+        /**
+         * @brief Returns how many requests were served by the heap instead of the slab.
+         * @return Fallback count.
+         */
+        [[nodiscard]] std::size_t fallback_count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(mutex_);
+            return fallbacks_;
+        }
+
+    private:
+        alignas(std::max_align_t) std::array<unsigned char, block_size * Capacity> storage_;
+        std::array<std::uint32_t, Capacity> free_;
+        std::size_t free_count_ = Capacity;
+        std::size_t high_water_ = 0U;
+        std::size_t fallbacks_ = 0U;
+        mutable tools::critical_section mutex_;
+    };
+
+    /**
+     * @brief Standard allocator drawing from a slab_pool; rebinding keeps the same pool.
+     *
+     * Meant for std::allocate_shared, whose control block is a rebound type: size the pool for the control
+     * block plus the object, see result_state_slab.
+     *
+     * @tparam T Value type.
+     * @tparam Pool slab_pool instantiation.
+     */
+    template <typename T, typename Pool>
+    class slab_allocator
+    {
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Rebinds the allocator to another value type on the same pool.
+         * @tparam U Other value type.
+         */
+        template <typename U>
+        struct rebind
+        {
+            using other = slab_allocator<U, Pool>;
+        };
+
+        /**
+         * @brief Creates an allocator drawing from pool.
+         * @param pool Pool outliving every allocation made through this allocator and its copies.
+         */
+        explicit slab_allocator(Pool& pool) noexcept
+            : pool_ { &pool }
+        {
+        }
+
+        /**
+         * @brief Converting copy from a rebound allocator.
+         * @tparam U Other value type.
+         * @param other Allocator to copy the pool from.
+         */
+        template <typename U>
+        slab_allocator(const slab_allocator<U, Pool>& other) noexcept // NOLINT implicit by allocator requirements
+            : pool_ { other.pool() }
+        {
+        }
+
+        /**
+         * @brief Allocates storage for count objects.
+         * @param count Number of objects.
+         * @return Pointer to uninitialized storage.
+         */
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(pool_->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * @brief Releases storage obtained from allocate().
+         * @param ptr Pointer returned by allocate().
+         * @param count Number of objects passed to allocate().
+         */
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            pool_->deallocate(ptr, count * sizeof(T), alignof(T));
+        }
+
+        /**
+         * @brief Returns the pool this allocator draws from.
+         * @return Pool pointer.
+         */
+        [[nodiscard]] Pool* pool() const noexcept
+        {
+            return pool_;
+        }
+
+        template <typename U>
+        friend bool operator==(const slab_allocator& lhs, const slab_allocator<U, Pool>& rhs) noexcept
+        {
+            return lhs.pool() == rhs.pool();
+        }
+
+        template <typename U>
+        friend bool operator!=(const slab_allocator& lhs, const slab_allocator<U, Pool>& rhs) noexcept
+        {
+            return lhs.pool() != rhs.pool();
+        }
+
+    private:
+        Pool* pool_;
+    };
+
+} // namespace pco
@@ -39,10 +39,23 @@ namespace pco::detail
         execution_failure,
     };
 
+#if !defined(PCO_SMALL_BUFFER_WORDS)
+    /**
+     * @brief Inline storage capacity of small_unique_function, in pointers.
+     *
+     * Continuations, posted tasks and unique_function targets up to this size are stored without allocation.
+     * Can be raised at compile time, for instance -DPCO_SMALL_BUFFER_WORDS=8 so that a continuation capturing its
+     * shared context plus a small std::string result stays inline.
+     */
+#define PCO_SMALL_BUFFER_WORDS 5
+#endif
+
+    static_assert(PCO_SMALL_BUFFER_WORDS >= 5, "the internal continuations need at least 5 pointers of storage");
+
     /**
      * @brief Inline storage size used by small_unique_function.
      */
-    constexpr size_t small_buffer_size = 5 * sizeof(void*);
+    constexpr size_t small_buffer_size = PCO_SMALL_BUFFER_WORDS * sizeof(void*);
 
     /**
      * @brief Inline storage alignment used by small_unique_function.
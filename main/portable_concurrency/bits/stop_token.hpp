@@ -0,0 +1,213 @@
+/**
+ * @file stop_token.hpp
+ * @brief Cooperative cancellation source and token for result-future chains.
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "unique_function.hpp"
+
+namespace pco
+{
+    class stop_token;
+
+    namespace detail
+    {
+        /**
+         * @brief Stop flag shared by a stop_source and its tokens, with the callbacks to run on request_stop().
+         */
+        struct stop_state
+        {
+            /** @brief Set once by the first request_stop(). */
+            std::atomic<bool> stopped_ { false };
+            /** @brief Mutex protecting the callback list. */
+            tools::critical_section mutex_;
+            /** @brief Callbacks to run on stop, each skipped once its owner has expired. */
+            std::vector<std::pair<std::weak_ptr<void>, unique_function<void()>>> callbacks_;
+        };
+
+        /**
+         * @brief Registers a callback run when stop is requested, or runs it now if it already was.
+         * @param token Token whose stop request triggers the callback.
+         * @param owner Object the callback acts on; the callback is dropped once the owner has expired.
+         * @param callback Callback to run.
+         */
+        inline void register_stop_callback(
+            const stop_token& token, std::weak_ptr<void> owner, unique_function<void()> callback);
+    } // namespace detail
+
+    /**
+     * @brief Read-only view of a stop_source, polled by running tasks and bound to result-future states.
+     *
+     * A default-constructed token is never stopped.
+     */
+    class stop_token
+    {
+    public:
+        stop_token() noexcept = default;
+
+        /**
+         * @brief Checks whether stop has been requested on the associated source.
+         * @return true once request_stop() has been called.
+         */
+        [[nodiscard]] bool stop_requested() const noexcept
+        {
+            return state_ && state_->stopped_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Checks whether the token is associated with a source.
+         * @return true when a stop can be requested through this token's source.
+         */
+        [[nodiscard]] bool stop_possible() const noexcept
+        {
+            return static_cast<bool>(state_);
+        }
+
+        /**
+         * @brief Compares the associated sources.
+         * @param lhs First token.
+         * @param rhs Second token.
+         * @return true when both tokens view the same source, or none.
+         */
+        friend bool operator==(const stop_token& lhs, const stop_token& rhs) noexcept
+        {
+            return lhs.state_ == rhs.state_;
+        }
+
+        /**
+         * @brief Compares the associated sources.
+         * @param lhs First token.
+         * @param rhs Second token.
+         * @return true when the tokens view different sources.
+         */
+        friend bool operator!=(const stop_token& lhs, const stop_token& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class stop_source;
+        friend void detail::register_stop_callback(
+            const stop_token& token, std::weak_ptr<void> owner, unique_function<void()> callback);
+
+        explicit stop_token(std::shared_ptr<detail::stop_state> state) noexcept
+            : state_(std::move(state))
+        {
+        }
+
+        std::shared_ptr<detail::stop_state> state_;
+    };
+
+    /**
+     * @brief Owner side of a cooperative cancellation request.
+     *
+     * Copies share the same stop state. request_stop() completes every result-future state bound to one of its
+     * tokens with a cancellation error, so that waiters are released and pending continuations are skipped.
+     */
+    class stop_source
+    {
+    public:
+        /**
+         * @brief Creates a source with a fresh stop state.
+         */
+        stop_source()
+            : state_(std::make_shared<detail::stop_state>())
+        {
+        }
+
+        /**
+         * @brief Returns a token viewing this source.
+         * @return Stop token.
+         */
+        [[nodiscard]] stop_token get_token() const noexcept
+        {
+            return stop_token { state_ };
+        }
+
+        /**
+         * @brief Checks whether stop has been requested.
+         * @return true once request_stop() has been called.
+         */
+        [[nodiscard]] bool stop_requested() const noexcept
+        {
+            return state_->stopped_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Requests stop and runs the registered callbacks on the calling thread.
+         * @return true when this call made the request, false when stop was already requested.
+         */
+        bool request_stop()
+        {
+            std::vector<std::pair<std::weak_ptr<void>, unique_function<void()>>> callbacks;
+            {
+                std::scoped_lock<tools::critical_section> guard(state_->mutex_);
+                if (state_->stopped_.exchange(true, std::memory_order_acq_rel))
+                {
+                    return false;
+                }
+                callbacks = std::move(state_->callbacks_);
+            }
+            for (auto& entry : callbacks)
+            {
+                if (auto owner = entry.first.lock())
+                {
+                    static_cast<void>(entry.second.invoke());
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::shared_ptr<detail::stop_state> state_;
+    };
+
+    namespace detail
+    {
+        inline void register_stop_callback(
+            const stop_token& token, std::weak_ptr<void> owner, unique_function<void()> callback)
+        {
+            const auto& state = token.state_;
+            if (!state)
+            {
+                return;
+            }
+
+            {
+                std::scoped_lock<tools::critical_section> guard(state->mutex_);
+                if (!state->stopped_.load(std::memory_order_relaxed))
+                {
+                    // a long-lived source sees many short chains: forget the ones already gone
+                    auto& callbacks = state->callbacks_;
+                    callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(),
+                                        [](const auto& entry) { return entry.first.expired(); }),
+                        callbacks.end());
+                    callbacks.emplace_back(std::move(owner), std::move(callback));
+                    return;
+                }
+            }
+            static_cast<void>(callback.invoke());
+        }
+    } // namespace detail
+
+} // namespace pco
@@ -22,8 +22,10 @@
 #include "tools/critical_section.hpp"
 #include <atomic>
 #include <cstdint>
+#include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "closable_queue_fwd.hpp"
 #include "execution_impl.hpp"
@@ -70,6 +72,27 @@ namespace pco
 
     } // namespace detail
 
+    /**
+     * @brief Scheduling parameters of one static_thread_pool worker.
+     *
+     * Negative cpu_affinity/priority and a zero stack_size keep the platform defaults. The stack size is honoured
+     * on ESP32 only (std::thread offers no portable way to size it elsewhere).
+     */
+    struct thread_pool_params
+    {
+        /** @brief Worker thread name, empty keeps the default name. */
+        std::string name;
+
+        /** @brief Core the worker is pinned to, or -1 for no pinning. */
+        int cpu_affinity = -1;
+
+        /** @brief Worker priority, or -1 for the default priority. */
+        int priority = -1;
+
+        /** @brief Worker stack size in bytes, or 0 for the default size. */
+        std::size_t stack_size = 0U;
+    };
+
     /**
      * @brief Fixed-size thread pool implementation.
      *
@@ -91,6 +114,16 @@ namespace pco
          */
         explicit static_thread_pool(std::size_t num_threads);
 
+        /**
+         * @brief Creates thread pool with one worker per parameter entry.
+         *
+         * Each worker applies its name, core pinning and priority to itself before draining the queue, so that
+         * the pool can be confined to the cores left free by real-time tasks.
+         *
+         * @param workers Scheduling parameters of each worker thread to launch.
+         */
+        explicit static_thread_pool(const std::vector<thread_pool_params>& workers);
+
         static_thread_pool(const static_thread_pool&) = delete;
         static_thread_pool& operator=(const static_thread_pool&) = delete;
         static_thread_pool(static_thread_pool&&) = delete;
@@ -0,0 +1,285 @@
+/**
+ * @file work_stealing_pool_impl.hpp
+ * @brief Portable concurrency component: work-stealing thread pool.
+ * @author Laurent Lardinois
+ * @date 2026-10-14
+ * @license https://creativecommons.org/publicdomain/zero/1.0/
+ * @see https://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+//-----------------------------------------------------------------------------//
+// Portable Concurrency Framework                                              //
+// Work-stealing pool extension: Laurent Lardinois                             //
+// Date: 2026-10-14                                                            //
+// https://github.com/VestniK/portable_concurrency                             //
+// Public Domain (CC0 1.0)                                                     //
+// https://creativecommons.org/publicdomain/zero/1.0/                          //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#include "tools/cond_var.hpp"
+#include "tools/critical_section.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "execution_impl.hpp"
+#include "unique_function.hpp"
+
+namespace pco
+{
+    class work_stealing_thread_pool;
+
+    namespace detail
+    {
+        /**
+         * @brief Chase-Lev work-stealing deque of heap-allocated tasks.
+         *
+         * The owner thread pushes and takes at the bottom (LIFO), any other thread steals at the top (FIFO).
+         * The ring grows on demand; retired rings are kept until destruction since a thief may still read one.
+         * Follows Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+         * Models" (PPoPP 2013), with sequentially consistent accesses in place of the standalone fences.
+         */
+        class work_stealing_deque
+        {
+        public:
+            /** @brief Task type stored by pointer in the deque. */
+            using task_type = unique_function<void()>;
+
+            /**
+             * @brief Creates an empty deque.
+             * @param capacity_log2 log2 of the initial ring capacity.
+             */
+            explicit work_stealing_deque(std::size_t capacity_log2 = 6U);
+
+            work_stealing_deque(const work_stealing_deque&) = delete;
+            work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+            work_stealing_deque(work_stealing_deque&&) = delete;
+            work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+
+            /**
+             * @brief Destroys the tasks still queued.
+             */
+            ~work_stealing_deque();
+
+            /**
+             * @brief Pushes a task at the bottom. Owner thread only.
+             * @param task Task whose ownership is transferred to the deque.
+             */
+            void push(task_type* task);
+
+            /**
+             * @brief Takes the most recently pushed task. Owner thread only.
+             * @return The task (ownership transferred to the caller), or nullptr when empty.
+             */
+            task_type* take();
+
+            /**
+             * @brief Steals the oldest task. Any thread.
+             * @return The task (ownership transferred to the caller), or nullptr when empty or on a lost race.
+             */
+            task_type* steal();
+
+            /**
+             * @brief Tells whether the deque looked empty at the time of the call.
+             * @return true when no task was queued.
+             */
+            bool empty() const noexcept;
+
+        private:
+            /** @brief Power-of-two circular array of task pointers. */
+            struct ring
+            {
+                explicit ring(std::size_t capacity_log2);
+
+                std::size_t mask;
+                std::unique_ptr<std::atomic<task_type*>[]> slots;
+            };
+
+            ring* grow(ring* current, std::int64_t top, std::int64_t bottom);
+
+            /** @brief Index of the oldest task, advanced by thieves and by the owner taking the last task. */
+            std::atomic<std::int64_t> top_ { 0 };
+
+            /** @brief Index one past the newest task, written by the owner only. */
+            std::atomic<std::int64_t> bottom_ { 0 };
+
+            /** @brief Current ring. */
+            std::atomic<ring*> ring_ { nullptr };
+
+            /** @brief Every ring allocated so far, released at destruction. Owner thread only. */
+            std::vector<std::unique_ptr<ring>> rings_;
+        };
+
+        /**
+         * @brief Executor adapter that submits tasks to a work-stealing thread pool.
+         */
+        class work_stealing_executor
+        {
+        public:
+            /**
+             * @brief Creates an executor bound to a pool.
+             * @param pool Pointer to the pool receiving the tasks.
+             */
+            work_stealing_executor(work_stealing_thread_pool* pool) noexcept
+                : pool_ { pool }
+            {
+            }
+
+        private:
+            /**
+             * @brief Submits task to the pool through ADL executor customization point.
+             *
+             * Tasks posted from a worker of the pool (continuations, nested async) go to the bottom of that
+             * worker's deque; tasks posted from any other thread go to the shared injection queue.
+             *
+             * @param exec Pool-backed executor.
+             * @param fun Task to run.
+             */
+            friend void post(work_stealing_executor exec, unique_function<void()> fun);
+
+            /** @brief Non-owning pointer to the pool. */
+            work_stealing_thread_pool* pool_;
+        };
+
+        void post(work_stealing_executor exec, unique_function<void()> fun);
+
+    } // namespace detail
+
+    /**
+     * @brief Fixed-size thread pool with per-worker work-stealing deques.
+     *
+     * Each worker runs its own deque newest first, so that a continuation scheduled by a task runs next on the
+     * same thread with a warm cache, then the shared injection queue fed by non-worker threads, then steals the
+     * oldest task of a randomly chosen victim. No lock is taken on the worker-local path; the pool mutex only
+     * guards sleeping and waking idle workers. Drop-in alternative to static_thread_pool for future::then and
+     * async chains of fine-grained tasks.
+     *
+     * @headerfile portable_concurrency/thread_pool
+     * @ingroup thread_pool
+     */
+    class work_stealing_thread_pool
+    {
+    public:
+        /** @brief Executor type associated with this pool. */
+        using executor_type = detail::work_stealing_executor;
+
+        /**
+         * @brief Creates thread pool with a fixed number of worker threads.
+         * @param num_threads Number of worker threads to launch (at least one).
+         */
+        explicit work_stealing_thread_pool(std::size_t num_threads);
+
+        work_stealing_thread_pool(const work_stealing_thread_pool&) = delete;
+        work_stealing_thread_pool& operator=(const work_stealing_thread_pool&) = delete;
+        work_stealing_thread_pool(work_stealing_thread_pool&&) = delete;
+        work_stealing_thread_pool& operator=(work_stealing_thread_pool&&) = delete;
+
+        /**
+         * @brief Stops the workers once their current task returns and joins them; queued work is discarded.
+         */
+        ~work_stealing_thread_pool();
+
+        /**
+         * @brief Signals pool shutdown: workers exit after their current task, queued work is discarded.
+         */
+        void stop();
+
+        /**
+         * @brief Stops accepting work from non-worker threads, drains queued work and joins the workers.
+         */
+        void wait();
+
+        /**
+         * @brief Returns an executor that posts tasks to this pool.
+         * @return Pool-backed executor handle.
+         */
+        executor_type executor() noexcept
+        {
+            return { this };
+        }
+
+        /**
+         * @brief Returns the number of workers.
+         * @return Number of worker threads.
+         */
+        std::size_t size() const noexcept
+        {
+            return workers_.size();
+        }
+
+        /**
+         * @brief Returns how many tasks have been stolen by idle workers so far.
+         * @return Number of stolen tasks.
+         */
+        std::size_t steal_count() const noexcept
+        {
+            return steals_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend void detail::post(detail::work_stealing_executor exec, unique_function<void()> fun);
+
+        /** @brief Per-worker state, on its own cache line. */
+        struct alignas(64) worker // NOLINT cache line
+        {
+            detail::work_stealing_deque deque;
+            std::uint32_t rng_state = 1U;
+        };
+
+        void submit(unique_function<void()>&& fun);
+        void run_worker(std::size_t index);
+        detail::work_stealing_deque::task_type* find_task(std::size_t index);
+
+        /** @brief Worker states, indexed like threads_. */
+        std::vector<std::unique_ptr<worker>> workers_;
+
+        /** @brief Worker threads owned by this pool. */
+        std::vector<std::thread> threads_;
+
+        /** @brief Tasks posted from non-worker threads. */
+        std::deque<detail::work_stealing_deque::task_type*> injected_;
+
+        /** @brief Number of tasks in injected_, read without the lock. */
+        std::atomic<std::size_t> injected_size_ { 0 };
+
+        /** @brief Protects injected_. */
+        tools::critical_section inject_mutex_;
+
+        /** @brief Number of queued tasks over all the deques and the injection queue. */
+        std::atomic<std::size_t> pending_ { 0 };
+
+        /** @brief Number of workers sleeping or about to sleep on cv_. */
+        std::atomic<std::size_t> sleepers_ { 0 };
+
+        /** @brief Number of successful steals. */
+        std::atomic<std::size_t> steals_ { 0 };
+
+        /** @brief Synchronization primitive for idle workers. */
+        tools::critical_section mutex_;
+
+        /** @brief Condition variable waking idle workers. */
+        tools::cond_var cv_;
+
+        /** @brief Set by wait(): drain then exit, non-worker posts are dropped. */
+        std::atomic<bool> closed_ { false };
+
+        /** @brief Set by stop(): exit as soon as possible, every post is dropped. */
+        std::atomic<bool> stopped_ { false };
+    };
+
+    template <>
+    /**
+     * @brief Marks work_stealing_thread_pool::executor_type as a valid executor.
+     */
+    struct is_executor<work_stealing_thread_pool::executor_type> : std::true_type
+    {
+    };
+
+} // namespace pco
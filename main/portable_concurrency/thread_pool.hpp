@@ -22,7 +22,9 @@
  * @defgroup thread_pool <portable_concurrency/thread_pool>
  * @headerfile portable_concurrency/thread_pool
  *
- * Statically sized thread pool implementation
+ * Statically sized thread pool implementations: a shared-queue pool and a
+ * work-stealing pool
  */
 
 #include "bits/thread_pool_impl.hpp"
+#include "bits/work_stealing_pool_impl.hpp"
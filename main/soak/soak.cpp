@@ -0,0 +1,499 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file soak.cpp
+ * @brief Load generator, pipeline stages and periodic report of the soak test.
+ *
+ * Stages: generator (periodic_task) -> sync_subject -> async_observer -> consumer (generic_task) -> encoder
+ * (data_task: JSON + gzip) -> memory_pipe -> drain (generic_task: gunzip + JSON parse). Event payloads cycle through
+ * several sizes and every stage allocates, so that the heap sees a realistic mix of block sizes and lifetimes.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-15
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "soak/soak.hpp"
+#include "tools/async_observer.hpp"
+#include "tools/data_task.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/latency_clock.hpp"
+#include "tools/log2_histogram.hpp"
+#include "tools/mem_pool_allocator.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/periodic_task.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/sync_observer.hpp"
+
+#if defined(ESP_PLATFORM)
+#include <esp_heap_caps.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    constexpr std::size_t latency_buckets = 32U;
+    constexpr std::size_t task_stack_size = 4096U;
+    constexpr std::size_t encoder_stack_size = 8192U;
+    constexpr std::size_t encoder_queue_depth = 256U;
+    constexpr std::size_t pipe_size = 32768U;
+    constexpr std::size_t max_block_size = 8192U;
+    constexpr std::uint64_t wait_timeout_ms = 20U;
+    constexpr std::uint64_t us_per_second = 1000000U;
+    constexpr std::uint32_t ns_per_us = 1000U;
+    constexpr std::uint32_t sample_mask = 0x0FFFU;
+    constexpr std::uint32_t sequence_stride = 31U;
+    constexpr std::uint32_t index_stride = 7U;
+    constexpr double percentile_50 = 0.50;
+    constexpr double percentile_99 = 0.99;
+
+    /**
+     * @brief Event published by the generator: a sequence number, its publish stamp and a variable size payload.
+     */
+    struct soak_event
+    {
+        std::uint32_t sequence = 0U;
+        tools::latency_stamp stamp = 0U;
+        std::vector<std::int16_t> samples;
+    };
+
+    /**
+     * @brief Digest of an event handed to the encoder, trivially copyable as data_task requires.
+     */
+    struct soak_record
+    {
+        std::uint32_t topic;
+        std::uint32_t sequence;
+        tools::latency_stamp stamp;
+        std::int32_t mean;
+        std::int32_t peak;
+    };
+
+    using soak_subject = tools::sync_subject<std::uint32_t, soak_event>;
+    using soak_observer = tools::async_observer<std::uint32_t, soak_event>;
+    using latency_histogram = tools::log2_histogram<latency_buckets>;
+
+    struct soak_context;
+    using encoder_task = tools::data_task<soak_context, soak_record>;
+
+    /**
+     * @brief State shared by the stages; each stage-local member is only touched by the task named in its comment.
+     */
+    struct soak_context
+    {
+        explicit soak_context(const soak::soak_config& load)
+            : config(load)
+        {
+        }
+
+        soak::soak_config config;
+        std::atomic_bool running { true };
+        soak_subject subject { "soak" };
+        std::shared_ptr<soak_observer> observer = std::make_shared<soak_observer>();
+        tools::memory_pipe pipe { pipe_size };
+        encoder_task* encoder = nullptr; // owned by run_soak, set before the consumer starts
+
+        std::uint32_t next_sequence = 0U;                  // generator
+        cjsonpp::JSONObject block = cjsonpp::arrayObject(); // encoder
+        std::size_t block_records = 0U;                    // encoder
+        tools::gzip_wrapper packer;                        // encoder
+        tools::gzip_wrapper unpacker;                      // drain
+
+        std::atomic<std::uint64_t> published { 0U };
+        std::atomic<std::uint64_t> delivered { 0U };
+        std::atomic<std::uint64_t> rejected { 0U };
+        std::atomic<std::uint64_t> encoded { 0U };
+        std::atomic<std::uint64_t> blocks_sent { 0U };
+        std::atomic<std::uint64_t> blocks_dropped { 0U };
+        std::atomic<std::uint64_t> blocks_received { 0U };
+        std::atomic<std::uint64_t> parse_errors { 0U };
+        std::atomic<std::uint64_t> raw_bytes { 0U };
+        std::atomic<std::uint64_t> packed_bytes { 0U };
+        latency_histogram delivery_latency;   // publish to consumer
+        latency_histogram end_to_end_latency; // publish to encoder
+    };
+
+    /**
+     * @brief Heap counters of the platform allocator.
+     */
+    struct heap_usage
+    {
+        std::size_t free_bytes = 0U;
+        std::size_t minimum_free_bytes = 0U;
+        std::size_t largest_free_block = 0U;
+        std::size_t fragmentation_percent = 0U;
+    };
+
+    /**
+     * @brief Reads the heap counters: byte-capable heaps on ESP32, the main arena of glibc on Linux.
+     *
+     * Fragmentation is the share of the free bytes outside the largest free block; glibc only reports its top
+     * chunk, so that share is computed against it there. Other platforms report zeros.
+     */
+    heap_usage read_heap_usage()
+    {
+        heap_usage usage;
+#if defined(ESP_PLATFORM)
+        usage.free_bytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        usage.minimum_free_bytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+        usage.largest_free_block = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+#elif defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+        const struct mallinfo2 info = mallinfo2();
+        usage.free_bytes = info.fordblks;
+        usage.minimum_free_bytes = info.fordblks;
+        usage.largest_free_block = info.keepcost;
+#endif
+        if (0U != usage.free_bytes)
+        {
+            constexpr std::size_t percent = 100U;
+            usage.fragmentation_percent = percent - ((usage.largest_free_block * percent) / usage.free_bytes);
+        }
+        return usage;
+    }
+
+    void startup(const std::shared_ptr<soak_context>& context, const std::string& task_name)
+    {
+        (void)context;
+        (void)task_name;
+    }
+
+    /**
+     * @brief Generator period: one event per topic, payload sizes cycling from 1 to max_payload_samples.
+     */
+    void publish_tick(const std::shared_ptr<soak_context>& context, const std::string& task_name)
+    {
+        (void)task_name;
+        for (std::uint32_t topic = 0U; topic < context->config.topics; ++topic)
+        {
+            soak_event event;
+            event.sequence = context->next_sequence++;
+            event.samples.resize((event.sequence % context->config.max_payload_samples) + 1U);
+            for (std::size_t index = 0U; index < event.samples.size(); ++index)
+            {
+                const auto value
+                    = (event.sequence * sequence_stride) + (static_cast<std::uint32_t>(index) * index_stride);
+                event.samples[index] = static_cast<std::int16_t>(value & sample_mask);
+            }
+
+            event.stamp = tools::latency_clock::now();
+            context->subject.publish(topic, event);
+            context->published.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Consumer: drains the async observer, records the delivery latency and hands digests to the encoder.
+     */
+    void consume_events(const std::shared_ptr<soak_context>& context, const std::string& task_name)
+    {
+        (void)task_name;
+        while (context->running.load(std::memory_order_relaxed))
+        {
+            context->observer->wait_for_events(std::chrono::duration<std::uint64_t, std::micro>(
+                wait_timeout_ms * ns_per_us));
+
+            for (const auto& entry : context->observer->pop_all_events())
+            {
+                const soak_event& event = std::get<1>(entry);
+                context->delivery_latency.add(
+                    tools::latency_clock::elapsed_ns(event.stamp, tools::latency_clock::now()) / ns_per_us);
+
+                std::int32_t sum = 0;
+                std::int32_t peak = 0;
+                for (const std::int16_t sample : event.samples)
+                {
+                    sum += sample;
+                    peak = (std::max)(peak, static_cast<std::int32_t>(sample));
+                }
+
+                const soak_record record { std::get<0>(entry), event.sequence, event.stamp,
+                    sum / static_cast<std::int32_t>(event.samples.size()), peak };
+                if (context->encoder->submit(record))
+                {
+                    context->delivered.fetch_add(1U, std::memory_order_relaxed);
+                }
+                else
+                {
+                    context->rejected.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Encoder: appends the digest to the JSON document and ships the document gzipped once complete.
+     */
+    void encode_record(const std::shared_ptr<soak_context>& context, const soak_record& record,
+        const std::string& task_name)
+    {
+        (void)task_name;
+        context->end_to_end_latency.add(
+            tools::latency_clock::elapsed_ns(record.stamp, tools::latency_clock::now()) / ns_per_us);
+
+        cjsonpp::JSONObject item;
+        static_cast<void>(item.set("topic", static_cast<std::int64_t>(record.topic)));
+        static_cast<void>(item.set("sequence", static_cast<std::int64_t>(record.sequence)));
+        static_cast<void>(item.set("mean", static_cast<int>(record.mean)));
+        static_cast<void>(item.set("peak", static_cast<int>(record.peak)));
+        static_cast<void>(context->block.add(item));
+        context->encoded.fetch_add(1U, std::memory_order_relaxed);
+
+        if (++context->block_records < context->config.records_per_block)
+        {
+            return;
+        }
+
+        const std::string text = context->block.print(false);
+        const std::vector<std::uint8_t> packed
+            = context->packer.pack(std::vector<std::uint8_t>(text.begin(), text.end()));
+        context->block = cjsonpp::arrayObject();
+        context->block_records = 0U;
+
+        context->raw_bytes.fetch_add(text.size(), std::memory_order_relaxed);
+        context->packed_bytes.fetch_add(packed.size(), std::memory_order_relaxed);
+
+        const bool sent = (packed.size() <= max_block_size)
+            && (packed.size()
+                == context->pipe.send_message(
+                    packed.data(), packed.size(), std::chrono::duration<std::uint64_t, std::milli>(0U)));
+        (sent ? context->blocks_sent : context->blocks_dropped).fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drain: receives the gzip blocks, unpacks them and parses the JSON documents back.
+     */
+    void drain_blocks(const std::shared_ptr<soak_context>& context, const std::string& task_name)
+    {
+        (void)task_name;
+        std::vector<std::uint8_t> buffer(max_block_size);
+
+        while (context->running.load(std::memory_order_relaxed))
+        {
+            const std::size_t received = context->pipe.receive_message(
+                buffer.data(), buffer.size(), std::chrono::duration<std::uint64_t, std::milli>(wait_timeout_ms));
+            if (0U == received)
+            {
+                continue;
+            }
+
+            const std::vector<std::uint8_t> unpacked = context->unpacker.unpack(
+                std::vector<std::uint8_t>(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(received)));
+            const auto document = cjsonpp::parse_result(std::string(unpacked.begin(), unpacked.end()));
+
+            if (document && (cjsonpp::JSONType::Array == document.value().type()))
+            {
+                context->blocks_received.fetch_add(1U, std::memory_order_relaxed);
+            }
+            else
+            {
+                context->parse_errors.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Counters of the previous report, to compute the rates of the period.
+     */
+    struct report_state
+    {
+        std::uint64_t published = 0U;
+        std::uint64_t encoded = 0U;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    void print_latency(std::FILE* output, const char* name, latency_histogram& histogram)
+    {
+        const auto window = histogram.snapshot();
+        histogram.reset();
+        std::fprintf(output, ",\"%s_p50_us\":%llu,\"%s_p99_us\":%llu,\"%s_max_us\":%u", name,
+            static_cast<unsigned long long>(window.percentile_upper_bound(percentile_50)), name,
+            static_cast<unsigned long long>(window.percentile_upper_bound(percentile_99)), name,
+            static_cast<unsigned>(window.max));
+    }
+
+    void print_allocator(std::FILE* output)
+    {
+        const heap_usage heap = read_heap_usage();
+        std::fprintf(output, ",\"heap_free\":%zu,\"heap_min_free\":%zu,\"heap_largest_free\":%zu,\"heap_frag_pct\":%zu",
+            heap.free_bytes, heap.minimum_free_bytes, heap.largest_free_block, heap.fragmentation_percent);
+
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        tools::mem_pool_class_stats total;
+        for (std::size_t index = 0U; index < tools::mem_pool_size_classes(); ++index)
+        {
+            if (const auto stats = tools::mem_pool_stats(index))
+            {
+                total.hits += stats->hits;
+                total.misses += stats->misses;
+                total.overflows += stats->overflows;
+                total.in_use += stats->in_use;
+            }
+        }
+        std::fprintf(output, ",\"pool_hits\":%zu,\"pool_misses\":%zu,\"pool_overflows\":%zu,\"pool_in_use\":%zu",
+            total.hits, total.misses, total.overflows, total.in_use);
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+        if (const auto stats = tools::mem_pool_tlsf_stats())
+        {
+            std::fprintf(output, ",\"tlsf_used\":%zu,\"tlsf_frag_pct\":%zu", stats->used_bytes,
+                stats->fragmentation_percent);
+        }
+#endif
+    }
+
+    void print_report(std::FILE* output, soak_context& context, const tools::periodic_task_stats& timing,
+        report_state& previous, double elapsed_s, bool final_report)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const double period_s = std::chrono::duration<double>(now - previous.time).count();
+        const std::uint64_t published = context.published.load(std::memory_order_relaxed);
+        const std::uint64_t encoded = context.encoded.load(std::memory_order_relaxed);
+
+        std::fprintf(output, "{\"soak\":\"%s\",\"elapsed_s\":%.1f,\"topics\":%zu,\"rate_hz\":%u",
+            final_report ? "final" : "report", elapsed_s, context.config.topics,
+            static_cast<unsigned>(context.config.rate_hz));
+        std::fprintf(output, ",\"published\":%llu,\"delivered\":%llu,\"rejected\":%llu,\"encoded\":%llu",
+            static_cast<unsigned long long>(published),
+            static_cast<unsigned long long>(context.delivered.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.rejected.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(encoded));
+        std::fprintf(output, ",\"publish_per_s\":%.1f,\"encode_per_s\":%.1f",
+            (period_s > 0.0) ? (static_cast<double>(published - previous.published) / period_s) : 0.0,
+            (period_s > 0.0) ? (static_cast<double>(encoded - previous.encoded) / period_s) : 0.0);
+
+        print_latency(output, "delivery", context.delivery_latency);
+        print_latency(output, "end_to_end", context.end_to_end_latency);
+
+        std::fprintf(output, ",\"observer_backlog\":%zu,\"encoder_queue\":%zu", context.observer->number_of_events(),
+            context.encoder->queue_depth());
+        std::fprintf(output,
+            ",\"blocks_sent\":%llu,\"blocks_dropped\":%llu,\"blocks_received\":%llu,\"parse_errors\":%llu"
+            ",\"raw_bytes\":%llu,\"packed_bytes\":%llu",
+            static_cast<unsigned long long>(context.blocks_sent.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.blocks_dropped.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.blocks_received.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.parse_errors.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.raw_bytes.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(context.packed_bytes.load(std::memory_order_relaxed)));
+
+        // timer drift of the generator over the period
+        std::fprintf(output, ",\"wakeup_late_p99_us\":%llu,\"wakeup_late_max_us\":%u,\"overruns\":%llu,\"skipped\":%llu",
+            static_cast<unsigned long long>(timing.wakeup_lateness.percentile_upper_bound(percentile_99)),
+            static_cast<unsigned>(timing.wakeup_lateness.max), static_cast<unsigned long long>(timing.overruns),
+            static_cast<unsigned long long>(timing.skipped_periods));
+
+        print_allocator(output);
+        std::fprintf(output, "}\n");
+        static_cast<void>(std::fflush(output));
+
+        previous.published = published;
+        previous.encoded = encoded;
+        previous.time = now;
+    }
+}
+
+namespace soak
+{
+    void run_soak(const soak_config& config, std::FILE* output)
+    {
+        soak_config load = config;
+        load.topics = (std::max)(load.topics, std::size_t { 1U });
+        load.rate_hz = (std::max)(load.rate_hz, std::uint32_t { 1U });
+        load.report_period_s = (std::max)(load.report_period_s, std::uint32_t { 1U });
+        load.max_payload_samples = (std::max)(load.max_payload_samples, std::size_t { 1U });
+        load.records_per_block = (std::max)(load.records_per_block, std::size_t { 1U });
+
+        auto context = std::make_shared<soak_context>(load);
+        for (std::uint32_t topic = 0U; topic < load.topics; ++topic)
+        {
+            context->subject.subscribe(topic, context->observer);
+        }
+
+        auto encoder = std::make_unique<encoder_task>(
+            startup, encode_record, context, encoder_queue_depth, "soak_encoder", encoder_stack_size);
+        context->encoder = encoder.get();
+        auto drain = std::make_unique<tools::generic_task<soak_context>>(
+            drain_blocks, context, "soak_drain", task_stack_size);
+        auto consumer = std::make_unique<tools::generic_task<soak_context>>(
+            consume_events, context, "soak_consumer", task_stack_size);
+
+        const auto start = std::chrono::steady_clock::now();
+        auto generator = std::make_unique<tools::periodic_task<soak_context>>(startup, publish_tick, context,
+            "soak_generator", std::chrono::duration<std::uint64_t, std::micro>(us_per_second / load.rate_hz),
+            task_stack_size);
+
+        report_state previous;
+        previous.time = start;
+        const std::chrono::seconds report_period(load.report_period_s);
+        const std::chrono::seconds duration(load.duration_s);
+
+        for (std::uint64_t report = 1U;; ++report)
+        {
+            auto next = start + (report_period * static_cast<std::int64_t>(report));
+            const bool last = (0U != load.duration_s) && ((next - start) >= duration);
+            if (last)
+            {
+                next = start + duration;
+            }
+
+            std::this_thread::sleep_until(next);
+            const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const tools::periodic_task_stats timing = generator->stats();
+            generator->reset_stats();
+
+            if (last)
+            {
+                // stop the generator first, so that the final counters are those of a drained pipeline
+                generator.reset();
+                std::this_thread::sleep_for(std::chrono::milliseconds(wait_timeout_ms * 2U));
+                print_report(output, *context, timing, previous, elapsed_s, true);
+                break;
+            }
+
+            print_report(output, *context, timing, previous, elapsed_s, false);
+        }
+
+        context->running.store(false, std::memory_order_relaxed);
+        consumer.reset();
+        encoder.reset();
+        drain.reset();
+    }
+}
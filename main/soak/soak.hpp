@@ -0,0 +1,73 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file soak.hpp
+ * @brief Long-running soak test of the whole stack under a configurable mixed load.
+ *
+ * A load generator publishes N topics at M Hz through a sync_subject into an async_observer; its consumer task
+ * hands a digest of every event to a data_task, which batches them into JSON documents, gzips them and sends them
+ * through a memory_pipe to a drain task that unpacks and parses them back. A report line is printed every period
+ * with the throughput, the latency percentiles, the queue depths, the timer drift of the generator and the heap and
+ * allocator statistics, so that fragmentation, queue growth and drift show up over hours of run time.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-15
+ */
+
+#pragma once
+
+#if !defined(SOAK_HPP_)
+#define SOAK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace soak
+{
+    /**
+     * @brief Load of a soak run.
+     */
+    struct soak_config
+    {
+        std::size_t topics = 8U;               ///< Number of topics published by the generator.
+        std::uint32_t rate_hz = 100U;          ///< Events per second on each topic.
+        std::uint32_t duration_s = 0U;         ///< Run time in seconds, 0 to run until the device is reset.
+        std::uint32_t report_period_s = 10U;   ///< Seconds between two report lines.
+        std::size_t max_payload_samples = 64U; ///< Samples of the largest event; sizes cycle from 1 to this value.
+        std::size_t records_per_block = 32U;   ///< Event digests per JSON document, hence per gzip block.
+    };
+
+    /**
+     * @brief Runs the soak test, one JSON line per report period and a last one at the end.
+     *
+     * @param config The load.
+     * @param output The stream receiving the reports (stdout, the console UART on ESP32).
+     */
+    void run_soak(const soak_config& config, std::FILE* output);
+}
+
+#endif //  SOAK_HPP_
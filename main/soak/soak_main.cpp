@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+/**
+ * @file soak_main.cpp
+ * @brief Desktop entry point of the soak test.
+ *
+ * Usage: publish_subscribe_soak [report.jsonl] [--topics 8] [--rate 100] [--duration 0] [--report 10]
+ * [--payload 64] [--block 32]. The report lines go to stdout without a report file; a zero duration runs until
+ * the process is interrupted. The exit code is 2 on a usage error.
+ *
+ * @author Laurent Lardinois
+ * @date 2026-10-15
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "soak/soak.hpp"
+#include "tools/mem_pool_allocator.hpp"
+
+int main(int argc, char* argv[])
+{
+    const char* output_path = nullptr;
+    soak::soak_config config;
+    constexpr int decimal = 10;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        const char* arg = argv[index];                                      // NOLINT argv access
+        const char* value = (index + 1 < argc) ? argv[index + 1] : nullptr; // NOLINT argv access
+        const auto number = (nullptr != value) ? std::strtoul(value, nullptr, decimal) : 0UL;
+        if ((0 == std::strcmp(arg, "--topics")) && (nullptr != value))
+        {
+            config.topics = number;
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--rate")) && (nullptr != value))
+        {
+            config.rate_hz = static_cast<std::uint32_t>(number);
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--duration")) && (nullptr != value))
+        {
+            config.duration_s = static_cast<std::uint32_t>(number);
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--report")) && (nullptr != value))
+        {
+            config.report_period_s = static_cast<std::uint32_t>(number);
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--payload")) && (nullptr != value))
+        {
+            config.max_payload_samples = number;
+            ++index;
+        }
+        else if ((0 == std::strcmp(arg, "--block")) && (nullptr != value))
+        {
+            config.records_per_block = number;
+            ++index;
+        }
+        else if (('-' != arg[0]) && (nullptr == output_path)) // NOLINT first character
+        {
+            output_path = arg;
+        }
+        else
+        {
+            std::fprintf(stderr, "unknown argument %s\n", arg);
+            return 2;
+        }
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+    init_mem_pool_allocator();
+#endif
+
+    std::FILE* output = (nullptr != output_path) ? std::fopen(output_path, "w") : stdout;
+    if (nullptr == output)
+    {
+        std::fprintf(stderr, "cannot open %s\n", output_path);
+        return 2;
+    }
+
+    soak::run_soak(config, output);
+
+    if (stdout != output)
+    {
+        static_cast<void>(std::fclose(output));
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+    destroy_mem_pool_allocator();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file allocation_counter.cpp
+ * @brief Per-thread allocation counting for the tests asserting allocation free hot paths.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include "allocation_counter.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <new>
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+#include "tools/mem_pool_allocator.hpp"
+#endif
+
+namespace test
+{
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+
+    bool allocation_counting_available() noexcept
+    {
+        return true;
+    }
+
+    allocation_counters thread_allocations() noexcept
+    {
+        const auto counters = tools::mem_pool_thread_allocations();
+        return { counters.allocations, counters.deallocations, counters.bytes };
+    }
+
+#elif defined(USE_MEM_POOL_ALLOCATOR)
+
+    // the mem pool allocator owns operator new/delete but does not count them
+    bool allocation_counting_available() noexcept
+    {
+        return false;
+    }
+
+    allocation_counters thread_allocations() noexcept
+    {
+        return {};
+    }
+
+#else
+
+    namespace
+    {
+        // constant initialized and trivially destructible: no TLS guard nor allocation on first use
+        thread_local allocation_counters g_counters = {}; // NOLINT per thread counters
+
+        void* counted_new(std::size_t size)
+        {
+            ++g_counters.allocations;
+            g_counters.bytes += size;
+
+            // Global throwing new must never return nullptr.
+            void* ptr = std::malloc((size != 0U) ? size : 1U); // NOLINT libc malloc behind operator new
+            if (ptr == nullptr)
+            {
+                std::terminate();
+            }
+            return ptr;
+        }
+
+        void counted_delete(void* ptr) noexcept
+        {
+            if (ptr != nullptr)
+            {
+                ++g_counters.deallocations;
+                std::free(ptr); // NOLINT allocated by counted_new()
+            }
+        }
+    }
+
+    bool allocation_counting_available() noexcept
+    {
+        return true;
+    }
+
+    allocation_counters thread_allocations() noexcept
+    {
+        return g_counters;
+    }
+
+#endif
+}
+
+#if !defined(USE_MEM_POOL_ALLOCATOR)
+
+// counting replacements of the global operator new/delete, as mem_pool_allocator.cpp replaces them
+
+void* operator new(std::size_t size)
+{
+    return test::counted_new(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return test::counted_new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    test::counted_delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    test::counted_delete(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    test::counted_delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+    test::counted_delete(ptr);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file allocation_counter.hpp
+ * @brief Per-thread allocation counting for the tests asserting allocation free hot paths.
+ *
+ * The counts come from the global operator new/delete: those of mem_pool_allocator.cpp when it is built with
+ * USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS, or the counting replacements of allocation_counter.cpp when the test
+ * binary is built without the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ALLOCATION_COUNTER_HPP_)
+#define ALLOCATION_COUNTER_HPP_
+
+#include <cstdint>
+
+namespace test
+{
+    /**
+     * @brief Allocations made and released by one thread.
+     */
+    struct allocation_counters
+    {
+        std::uint64_t allocations = 0U;
+        std::uint64_t deallocations = 0U;
+        std::uint64_t bytes = 0U;
+    };
+
+    /**
+     * @brief Checks whether the global operator new/delete of the test binary are counted.
+     *
+     * @return false when the mem pool allocator is built without its thread counters.
+     */
+    bool allocation_counting_available() noexcept;
+
+    /**
+     * @brief Reads the counters of the calling thread.
+     *
+     * @return The counters accumulated since the thread started, zero when counting is unavailable.
+     */
+    allocation_counters thread_allocations() noexcept;
+
+    /**
+     * @brief Counts the allocations of the calling thread from its construction on.
+     */
+    class allocation_scope
+    {
+    public:
+        allocation_scope() noexcept
+            : m_start(thread_allocations())
+        {
+        }
+
+        [[nodiscard]] std::uint64_t allocations() const noexcept
+        {
+            return thread_allocations().allocations - m_start.allocations;
+        }
+
+        [[nodiscard]] std::uint64_t deallocations() const noexcept
+        {
+            return thread_allocations().deallocations - m_start.deallocations;
+        }
+
+        [[nodiscard]] std::uint64_t bytes() const noexcept
+        {
+            return thread_allocations().bytes - m_start.bytes;
+        }
+
+    private:
+        allocation_counters m_start;
+    };
+}
+
+// skips the current test when the allocations of the test binary are not counted
+#define SKIP_WITHOUT_ALLOCATION_COUNTING()                                                                            \
+    if (!test::allocation_counting_available())                                                                       \
+    {                                                                                                                 \
+        GTEST_SKIP() << "operator new/delete are not counted in this build";                                          \
+    }
+
+// runs a statement and expects the calling thread did not allocate nor release any block meanwhile
+#define EXPECT_NO_ALLOCATIONS(statement)                                                                              \
+    do                                                                                                                \
+    {                                                                                                                 \
+        const test::allocation_scope allocation_scope_;                                                               \
+        statement;                                                                                                    \
+        EXPECT_EQ(0U, allocation_scope_.allocations()) << "allocating: " #statement;                                 \
+        EXPECT_EQ(0U, allocation_scope_.deallocations()) << "releasing: " #statement;                                \
+    } while (false)
+
+#endif // ALLOCATION_COUNTER_HPP_
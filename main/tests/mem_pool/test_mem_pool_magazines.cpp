@@ -0,0 +1,232 @@
+/**
+ * @file test_mem_pool_magazines.cpp
+ * @brief Stress tests of the per-thread magazines of the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "tools/mem_pool_allocator.hpp"
+
+// Built in its own executable with USE_MEM_POOL_ALLOCATOR: the global operator new/delete of this binary are the
+// mem pool ones. The operators are called explicitly, new-expressions may be elided by the compiler.
+
+namespace
+{
+    // cached size classes and one size above the largest class
+    constexpr std::array<std::size_t, 9> stress_sizes = { 8U, 20U, 33U, 64U, 100U, 200U, 384U, 512U, 700U };
+
+    struct live_block
+    {
+        unsigned char* data = nullptr;
+        std::size_t size = 0U;
+        unsigned char fill = 0U;
+        bool array = false;
+    };
+
+    live_block allocate(std::size_t size, unsigned char fill, bool array)
+    {
+        void* ptr = array ? ::operator new[](size) : ::operator new(size);
+        auto* data = static_cast<unsigned char*>(ptr);
+        std::memset(data, fill, size);
+        return live_block { data, size, fill, array };
+    }
+
+    // a block handed out twice would have been overwritten by its other owner
+    bool intact(const live_block& block)
+    {
+        return std::all_of(block.data, block.data + block.size, // NOLINT pointer arithmetic
+            [&block](unsigned char value) { return value == block.fill; });
+    }
+
+    void release(const live_block& block, bool sized)
+    {
+        if (block.array && sized)
+        {
+            ::operator delete[](block.data, block.size);
+        }
+        else if (block.array)
+        {
+            ::operator delete[](block.data);
+        }
+        else if (sized)
+        {
+            ::operator delete(block.data, block.size);
+        }
+        else
+        {
+            ::operator delete(block.data);
+        }
+    }
+}
+
+/**
+ * @brief Test case for concurrent allocations and releases through the per-thread magazines.
+ *
+ * @test
+ * - 8 threads allocate batches of 48 blocks over several size classes, more than a magazine holds, so that the
+ *   magazines are refilled from and flushed to the global pools.
+ * - Every block is filled with a thread specific pattern, checked before it is released.
+ * - Half of the blocks are released sized, half unsized, with the scalar and array operators.
+ * - A quarter of the blocks are handed to another thread and released there.
+ * - Verify no block was handed out twice while in use.
+ */
+TEST(MemPoolMagazineTest, ConcurrentNewDeleteStress)
+{
+    constexpr std::size_t thread_count = 8U;
+    constexpr std::size_t iterations = 1500U;
+    constexpr std::size_t batch = 48U;
+
+    std::mutex exchange_mutex;
+    std::vector<live_block> exchange;
+    exchange.reserve(thread_count * iterations * batch);
+    std::array<std::size_t, thread_count> corrupted = {};
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0U; index < thread_count; ++index)
+    {
+        threads.emplace_back(
+            [&, index]()
+            {
+                std::vector<live_block> blocks;
+                blocks.reserve(batch);
+                std::vector<live_block> foreign;
+                foreign.reserve(batch * thread_count);
+
+                for (std::size_t iteration = 0U; iteration < iterations; ++iteration)
+                {
+                    const auto fill = static_cast<unsigned char>((index * 31U) + iteration + 1U);
+                    for (std::size_t i = 0U; i < batch; ++i)
+                    {
+                        const std::size_t size = stress_sizes[(i + iteration) % stress_sizes.size()];
+                        blocks.push_back(allocate(size, fill, 0U == (i % 3U)));
+                    }
+
+                    for (std::size_t i = 0U; i < blocks.size(); ++i)
+                    {
+                        corrupted[index] += intact(blocks[i]) ? 0U : 1U;
+                        if (0U == (i % 4U))
+                        {
+                            std::scoped_lock<std::mutex> guard(exchange_mutex);
+                            exchange.push_back(blocks[i]);
+                            continue;
+                        }
+                        release(blocks[i], 0U == (i % 2U));
+                    }
+                    blocks.clear();
+
+                    {
+                        std::scoped_lock<std::mutex> guard(exchange_mutex);
+                        foreign.swap(exchange);
+                    }
+                    for (std::size_t i = 0U; i < foreign.size(); ++i)
+                    {
+                        corrupted[index] += intact(foreign[i]) ? 0U : 1U;
+                        release(foreign[i], 0U == (i % 2U));
+                    }
+                    foreign.clear();
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto& block : exchange)
+    {
+        EXPECT_TRUE(intact(block));
+        release(block, true);
+    }
+    for (const std::size_t count : corrupted)
+    {
+        EXPECT_EQ(0U, count);
+    }
+}
+
+/**
+ * @brief Test case for the magazine flush when its thread ends.
+ *
+ * @test
+ * - A thread allocates 12 blocks of 256 bytes, releases them into its magazine and ends.
+ * - Verify the main thread gets the same blocks back from the global pool: the magazine was flushed when the
+ *   thread local storage was destroyed instead of leaking its blocks.
+ */
+TEST(MemPoolMagazineTest, ThreadExitFlushesTheMagazine)
+{
+    constexpr std::size_t block_size = 256U;
+    constexpr std::size_t released_count = 12U;
+    std::vector<void*> released;
+    released.reserve(released_count);
+
+    std::thread worker(
+        [&released]()
+        {
+            for (std::size_t i = 0U; i < released_count; ++i)
+            {
+                released.push_back(::operator new(block_size));
+            }
+            for (void* block : released)
+            {
+                ::operator delete(block, block_size);
+            }
+        });
+    worker.join();
+
+    // drain the main thread magazine and the global pool of the class until the worker blocks come back
+    constexpr std::size_t max_allocations = 1024U;
+    std::vector<void*> drained;
+    drained.reserve(max_allocations);
+    std::size_t found = 0U;
+    while ((found < released_count) && (drained.size() < max_allocations))
+    {
+        drained.push_back(::operator new(block_size));
+        found += (std::find(released.begin(), released.end(), drained.back()) != released.end()) ? 1U : 0U;
+    }
+
+    EXPECT_EQ(released_count, found);
+    for (void* block : drained)
+    {
+        ::operator delete(block, block_size);
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_mem_pool_size_classes.cpp
+ * @brief Unit tests of a configured size class table of the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <new>
+
+#include "tools/mem_pool_allocator.hpp"
+
+// Built in its own executable with USE_MEM_POOL_ALLOCATOR, USE_MEM_POOL_ALLOCATOR_STATS and a MEM_POOL_SIZE_CLASSES
+// list different from the default one.
+
+namespace
+{
+    struct expected_class
+    {
+        std::size_t block_size;
+        std::size_t capacity_pow2;
+    };
+
+    constexpr expected_class expected_classes[] = { MEM_POOL_SIZE_CLASSES }; // NOLINT same list as the allocator
+
+    // A fixed size snapshot, a growing container would allocate from the classes it measures.
+    using class_counts = std::array<std::size_t, std::size(expected_classes)>;
+
+    class_counts in_use_per_class()
+    {
+        class_counts in_use = {};
+        for (std::size_t idx = 0U; idx < in_use.size(); ++idx)
+        {
+            in_use[idx] = tools::mem_pool_stats(idx)->in_use;
+        }
+        return in_use;
+    }
+
+    /**
+     * @brief Allocates one block and returns the index of the size class that served it.
+     *
+     * @return The class index, mem_pool_size_classes() when the size is above the largest class, or one more when
+     *         several classes changed.
+     */
+    std::size_t class_serving(std::size_t size)
+    {
+        const auto before = in_use_per_class();
+        void* block = ::operator new(size);
+        const auto after = in_use_per_class();
+        ::operator delete(block, size);
+
+        std::size_t served = tools::mem_pool_size_classes();
+        for (std::size_t idx = 0U; idx < after.size(); ++idx)
+        {
+            if (after[idx] != before[idx])
+            {
+                served = (served == tools::mem_pool_size_classes()) ? idx : (tools::mem_pool_size_classes() + 1U);
+            }
+        }
+        return served;
+    }
+}
+
+/**
+ * @brief Test case for a size class table given with MEM_POOL_SIZE_CLASSES.
+ *
+ * @test
+ * - Verify the allocator exposes the configured classes, their block sizes and pool capacities.
+ */
+TEST(MemPoolSizeClassTest, ConfiguredTableIsUsed)
+{
+    ASSERT_EQ(std::size(expected_classes), tools::mem_pool_size_classes());
+    for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+    {
+        const auto stats = tools::mem_pool_stats(idx);
+        ASSERT_TRUE(stats.has_value());
+        EXPECT_EQ(expected_classes[idx].block_size, stats->block_size);
+        EXPECT_EQ(static_cast<std::size_t>(1U) << expected_classes[idx].capacity_pow2, stats->capacity);
+    }
+    EXPECT_FALSE(tools::mem_pool_stats(tools::mem_pool_size_classes()).has_value());
+}
+
+/**
+ * @brief Test case for the block size to size class mapping at the class boundaries.
+ *
+ * @test
+ * - Verify a request of exactly a class block size is served by that class, one byte more by the next class, and
+ *   one byte more than the largest class by none.
+ * - Verify the smallest requests are served by the first class.
+ */
+TEST(MemPoolSizeClassTest, BoundariesMapToTheRightClass)
+{
+    const std::size_t classes = tools::mem_pool_size_classes();
+    EXPECT_EQ(0U, class_serving(1U));
+
+    for (std::size_t idx = 0U; idx < classes; ++idx)
+    {
+        const std::size_t block_size = expected_classes[idx].block_size;
+        EXPECT_EQ(idx, class_serving(block_size)) << "size " << block_size;
+        EXPECT_EQ(idx + 1U, class_serving(block_size + 1U)) << "size " << (block_size + 1U);
+    }
+}
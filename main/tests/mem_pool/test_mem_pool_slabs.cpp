@@ -0,0 +1,177 @@
+/**
+ * @file test_mem_pool_slabs.cpp
+ * @brief Unit tests of the address-range slabs of the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <vector>
+
+#include "tools/mem_pool_allocator.hpp"
+
+// Built in its own executable with USE_MEM_POOL_ALLOCATOR, USE_MEM_POOL_ALLOCATOR_SLABS, USE_MEM_POOL_ALLOCATOR_STATS
+// and 2^MEM_POOL_SLAB_BLOCKS_POW2 blocks per slab. Only the test thread allocates while a test runs, so the counter
+// deltas of a size class are exact.
+
+namespace
+{
+    constexpr std::size_t slab_blocks = (static_cast<std::size_t>(1U) << MEM_POOL_SLAB_BLOCKS_POW2);
+    constexpr std::size_t block_size = 512U;
+    // far more than the global pool, a magazine and the slab of the class together
+    constexpr std::size_t block_count = 1000U;
+
+    std::size_t class_of(std::size_t size)
+    {
+        for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+        {
+            if (tools::mem_pool_stats(idx)->block_size == size)
+            {
+                return idx;
+            }
+        }
+        return tools::mem_pool_size_classes();
+    }
+
+    std::vector<void*> allocate_blocks()
+    {
+        std::vector<void*> blocks;
+        blocks.reserve(block_count);
+        for (std::size_t i = 0U; i < block_count; ++i)
+        {
+            blocks.push_back(::operator new(block_size));
+        }
+        return blocks;
+    }
+}
+
+/**
+ * @brief Test case for a size class whose slab is exhausted.
+ *
+ * @test
+ * - Hold 1000 blocks of 512 bytes: the cache, then the slab of the class, then the heap serve them.
+ * - Verify every allocation is counted once, at most the slab size comes from the slab and the rest falls back to
+ *   malloc, including the allocations after the slab ran out.
+ */
+TEST(MemPoolSlabTest, ExhaustedSlabFallsBackToMalloc)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    const auto before = *tools::mem_pool_stats(idx);
+    auto blocks = allocate_blocks();
+    const auto after = *tools::mem_pool_stats(idx);
+
+    const std::size_t hits = after.hits - before.hits;
+    const std::size_t slab_allocations = after.slab_allocations - before.slab_allocations;
+    const std::size_t misses = after.misses - before.misses;
+    EXPECT_EQ(block_count, hits + slab_allocations + misses);
+    EXPECT_LE(slab_allocations, slab_blocks);
+    EXPECT_GT(misses, 0U);
+    EXPECT_EQ(block_count, after.in_use - before.in_use);
+
+    blocks.push_back(::operator new(block_size));
+    EXPECT_EQ(after.misses + 1U, tools::mem_pool_stats(idx)->misses);
+    EXPECT_EQ(after.slab_allocations, tools::mem_pool_stats(idx)->slab_allocations);
+
+    for (void* block : blocks)
+    {
+        ::operator delete(block, block_size);
+    }
+}
+
+/**
+ * @brief Test case for unsized deletes of slab and heap blocks.
+ *
+ * @test
+ * - Hold 1000 blocks of 512 bytes, the slab of the class being exhausted, and release them with unsized deletes.
+ * - Verify the slab blocks, recognized by their address, go back to the cache or the free ring of their class,
+ *   while the heap blocks of unknown size go to free without touching the class counters.
+ */
+TEST(MemPoolSlabTest, UnsizedDeleteRecyclesSlabBlocksOnly)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    auto blocks = allocate_blocks();
+    const auto held = *tools::mem_pool_stats(idx);
+    for (void* block : blocks)
+    {
+        ::operator delete(block);
+    }
+    const auto released = *tools::mem_pool_stats(idx);
+
+    const std::size_t recycled = held.in_use - released.in_use;
+    EXPECT_GT(recycled, 0U);
+    EXPECT_LE(recycled, slab_blocks);
+    EXPECT_EQ(recycled, (released.occupancy - held.occupancy) + (released.overflows - held.overflows));
+    EXPECT_EQ(held.misses, released.misses);
+}
+
+/**
+ * @brief Test case for the free ring of the slab blocks that overflow the cache.
+ *
+ * @test
+ * - Hold 1000 blocks of 512 bytes, the slab of the class being exhausted, and release the last half first: these
+ *   heap blocks fill the cache, so the slab blocks, allocated early and released after them, overflow into the
+ *   free ring of their class.
+ * - Verify allocating them again takes slab blocks back from the free ring although nothing is left to carve.
+ */
+TEST(MemPoolSlabTest, OverflowingSlabBlocksGoToTheFreeRing)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    auto blocks = allocate_blocks();
+    ASSERT_GT(tools::mem_pool_stats(idx)->misses, 0U);
+    for (std::size_t i = 0U; i < block_count; ++i)
+    {
+        ::operator delete(blocks[(i + (block_count / 2U)) % block_count], block_size);
+    }
+    const auto released = *tools::mem_pool_stats(idx);
+    EXPECT_GT(released.overflows, 0U);
+
+    blocks = allocate_blocks();
+    const auto reused = *tools::mem_pool_stats(idx);
+    const std::size_t from_ring = reused.slab_allocations - released.slab_allocations;
+    EXPECT_GT(from_ring, 0U);
+    EXPECT_LE(from_ring, slab_blocks);
+
+    for (void* block : blocks)
+    {
+        ::operator delete(block, block_size);
+    }
+}
@@ -0,0 +1,170 @@
+/**
+ * @file test_mem_pool_stats.cpp
+ * @brief Unit tests of the size class counters of the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "tools/mem_pool_allocator.hpp"
+
+// Built in the magazine test executable, with USE_MEM_POOL_ALLOCATOR and USE_MEM_POOL_ALLOCATOR_STATS and the default
+// size classes. Only the test thread allocates while a test runs, so the counters of a size class are exact.
+
+namespace
+{
+    constexpr std::size_t block_size = 512U;
+    // far more than the global pool and the magazine of the class together
+    constexpr std::size_t block_count = 400U;
+    constexpr std::size_t magazine_capacity = 16U;
+
+    std::size_t class_of(std::size_t size)
+    {
+        for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+        {
+            if (tools::mem_pool_stats(idx)->block_size == size)
+            {
+                return idx;
+            }
+        }
+        return tools::mem_pool_size_classes();
+    }
+
+    void allocate_blocks(std::vector<void*>& blocks)
+    {
+        for (std::size_t i = 0U; i < block_count; ++i)
+        {
+            blocks.push_back(::operator new(block_size));
+        }
+    }
+
+    void release_blocks(std::vector<void*>& blocks)
+    {
+        for (void* block : blocks)
+        {
+            ::operator delete(block, block_size);
+        }
+        blocks.clear();
+    }
+}
+
+/**
+ * @brief Test case for the counters of a size class over a known allocation pattern.
+ *
+ * @test
+ * - Hold 400 blocks of 512 bytes to drain the cache of the class and reset the counters.
+ * - Release them: verify the cache fills up to its capacity and the rest overflows, with a high-water mark following
+ *   the occupancy and an unchanged peak.
+ * - Allocate 400 blocks again: verify every cached block is a hit, the rest are misses, and the peak is reached again.
+ */
+TEST(MemPoolStatsTest, CountsHitsMissesOverflowsAndOccupancy)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    std::vector<void*> blocks;
+    blocks.reserve(block_count);
+    allocate_blocks(blocks);
+    tools::reset_mem_pool_stats();
+
+    const auto held = *tools::mem_pool_stats(idx);
+    EXPECT_EQ(0U, held.occupancy);
+    EXPECT_EQ(0U, held.high_water_mark);
+    EXPECT_EQ(held.in_use, held.peak_in_use);
+    EXPECT_GE(held.in_use, block_count);
+
+    release_blocks(blocks);
+    const auto released = *tools::mem_pool_stats(idx);
+    EXPECT_EQ(0U, released.hits);
+    EXPECT_EQ(0U, released.misses);
+    EXPECT_EQ(block_count, released.occupancy + released.overflows);
+    EXPECT_GE(released.occupancy, released.capacity);
+    EXPECT_LE(released.occupancy, released.capacity + magazine_capacity);
+    EXPECT_EQ(released.occupancy, released.high_water_mark);
+    EXPECT_EQ(held.in_use - block_count, released.in_use);
+    EXPECT_EQ(held.peak_in_use, released.peak_in_use);
+
+    allocate_blocks(blocks);
+    const auto reallocated = *tools::mem_pool_stats(idx);
+    EXPECT_EQ(released.occupancy, reallocated.hits);
+    EXPECT_EQ(block_count - released.occupancy, reallocated.misses);
+    EXPECT_EQ(released.overflows, reallocated.overflows);
+    EXPECT_EQ(0U, reallocated.occupancy);
+    EXPECT_EQ(released.high_water_mark, reallocated.high_water_mark);
+    EXPECT_EQ(held.in_use, reallocated.in_use);
+    EXPECT_EQ(held.peak_in_use, reallocated.peak_in_use);
+
+    release_blocks(blocks);
+}
+
+/**
+ * @brief Test case for the reset of the counters.
+ *
+ * @test
+ * - Fill the cache of a size class, then reset the counters with blocks cached and handed out.
+ * - Verify hits, misses and overflows restart from zero while the high-water mark and the peak restart from the
+ *   current occupancy and in_use.
+ */
+TEST(MemPoolStatsTest, ResetKeepsTheCurrentLevels)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    std::vector<void*> blocks;
+    blocks.reserve(block_count);
+    allocate_blocks(blocks);
+    release_blocks(blocks);
+    blocks.push_back(::operator new(block_size));
+
+    const auto before = *tools::mem_pool_stats(idx);
+    ASSERT_GT(before.hits, 0U);
+    ASSERT_GT(before.overflows, 0U);
+    ASSERT_GT(before.high_water_mark, before.occupancy);
+
+    tools::reset_mem_pool_stats();
+    const auto after = *tools::mem_pool_stats(idx);
+    EXPECT_EQ(0U, after.hits);
+    EXPECT_EQ(0U, after.misses);
+    EXPECT_EQ(0U, after.slab_allocations);
+    EXPECT_EQ(0U, after.overflows);
+    EXPECT_EQ(before.occupancy, after.occupancy);
+    EXPECT_EQ(before.occupancy, after.high_water_mark);
+    EXPECT_EQ(before.in_use, after.in_use);
+    EXPECT_EQ(before.in_use, after.peak_in_use);
+
+    release_blocks(blocks);
+}
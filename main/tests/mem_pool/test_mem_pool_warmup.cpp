@@ -0,0 +1,199 @@
+/**
+ * @file test_mem_pool_warmup.cpp
+ * @brief Unit tests of the warmup target table and free lists of the mem pool allocator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <vector>
+
+#include "tools/mem_pool_allocator.hpp"
+
+// Built in its own executable with USE_MEM_POOL_ALLOCATOR, USE_MEM_POOL_ALLOCATOR_WARMUP, USE_MEM_POOL_ALLOCATOR_STATS
+// and a MEM_POOL_WARMUP_TARGETS table. Only the test thread allocates while a test runs, so the counter deltas of a
+// size class are exact.
+
+namespace
+{
+    constexpr std::size_t warmup_targets[] = { MEM_POOL_WARMUP_TARGETS }; // NOLINT same list as the allocator
+    constexpr std::size_t block_size = 384U;
+    // far more than the global pool and a magazine of the class together
+    constexpr std::size_t block_count = 1000U;
+
+    // cached blocks of each class added by init_mem_pool_allocator()
+    std::vector<std::size_t> g_warmup_occupancy; // NOLINT filled once by the environment
+
+    class warmup_environment : public ::testing::Environment
+    {
+    public:
+        void SetUp() override
+        {
+            if (!g_warmup_occupancy.empty())
+            {
+                return;
+            }
+
+            // reserved first: a growing vector would release small blocks between the two snapshots
+            std::vector<std::size_t> before;
+            before.reserve(tools::mem_pool_size_classes());
+            g_warmup_occupancy.reserve(tools::mem_pool_size_classes());
+            for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+            {
+                before.push_back(tools::mem_pool_stats(idx)->occupancy);
+            }
+            init_mem_pool_allocator();
+            for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+            {
+                g_warmup_occupancy.push_back(tools::mem_pool_stats(idx)->occupancy - before[idx]);
+            }
+        }
+    };
+
+    [[maybe_unused]] ::testing::Environment* const g_environment // NOLINT registered before main runs the tests
+        = ::testing::AddGlobalTestEnvironment(new warmup_environment());
+
+    std::size_t class_of(std::size_t size)
+    {
+        for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+        {
+            if (tools::mem_pool_stats(idx)->block_size == size)
+            {
+                return idx;
+            }
+        }
+        return tools::mem_pool_size_classes();
+    }
+
+    std::vector<void*> allocate_blocks()
+    {
+        std::vector<void*> blocks;
+        blocks.reserve(block_count);
+        for (std::size_t i = 0U; i < block_count; ++i)
+        {
+            blocks.push_back(::operator new(block_size));
+        }
+        return blocks;
+    }
+}
+
+/**
+ * @brief Test case for the warmup target table.
+ *
+ * @test
+ * - Verify init_mem_pool_allocator() cached exactly the MEM_POOL_WARMUP_TARGETS blocks of each size class,
+ *   none for the classes with a zero target.
+ */
+TEST(MemPoolWarmupTest, InitCachesTheTargetTable)
+{
+    ASSERT_EQ(std::size(warmup_targets), tools::mem_pool_size_classes());
+    ASSERT_EQ(g_warmup_occupancy.size(), tools::mem_pool_size_classes());
+    for (std::size_t idx = 0U; idx < tools::mem_pool_size_classes(); ++idx)
+    {
+        EXPECT_EQ(warmup_targets[idx], g_warmup_occupancy[idx]) << "class " << tools::mem_pool_stats(idx)->block_size;
+    }
+}
+
+/**
+ * @brief Test case for unsized deletes of warmup blocks.
+ *
+ * @test
+ * - Hold 1000 blocks of 384 bytes, which takes every warmup block of the class, and release them unsized.
+ * - Verify the warmup blocks, recognized by their address, are recycled while the heap blocks go to free.
+ * - Verify in_use counts the held blocks and peak_in_use follows it.
+ */
+TEST(MemPoolWarmupTest, UnsizedDeleteRecyclesWarmupBlocks)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    const auto before = *tools::mem_pool_stats(idx);
+    auto blocks = allocate_blocks();
+    const auto held = *tools::mem_pool_stats(idx);
+    EXPECT_EQ(block_count, held.in_use - before.in_use);
+    EXPECT_EQ(held.in_use, held.peak_in_use);
+
+    for (void* block : blocks)
+    {
+        ::operator delete(block);
+    }
+    const auto released = *tools::mem_pool_stats(idx);
+
+    const std::size_t recycled = held.in_use - released.in_use;
+    EXPECT_EQ(warmup_targets[idx], recycled);
+    EXPECT_EQ(recycled, released.occupancy - held.occupancy);
+    EXPECT_EQ(held.peak_in_use, released.peak_in_use);
+}
+
+/**
+ * @brief Test case for the free list of the warmup blocks that overflow the cache.
+ *
+ * @test
+ * - Hold 1000 blocks of 384 bytes and release the last half first: these heap blocks fill the cache, so the warmup
+ *   blocks, allocated early and released after them, overflow into the free list of their class instead of free.
+ * - Verify allocating again takes the warmup blocks back from the free list once the cache is empty.
+ * - Verify in_use returns to its initial value once everything is released.
+ */
+TEST(MemPoolWarmupTest, OverflowingWarmupBlocksGoToTheFreeList)
+{
+    const std::size_t idx = class_of(block_size);
+    ASSERT_LT(idx, tools::mem_pool_size_classes());
+
+    const auto before = *tools::mem_pool_stats(idx);
+    auto blocks = allocate_blocks();
+    for (std::size_t i = 0U; i < block_count; ++i)
+    {
+        ::operator delete(blocks[(i + (block_count / 2U)) % block_count], block_size);
+    }
+    const auto released = *tools::mem_pool_stats(idx);
+    EXPECT_GT(released.overflows, before.overflows);
+    EXPECT_EQ(before.in_use, released.in_use);
+
+    blocks = allocate_blocks();
+    const auto reused = *tools::mem_pool_stats(idx);
+    // free list hits do not come from the cache occupancy
+    const std::size_t from_free_list = (reused.hits - released.hits) - (released.occupancy - reused.occupancy);
+    EXPECT_GT(from_free_list, 0U);
+    EXPECT_LE(from_free_list, warmup_targets[idx]);
+    EXPECT_EQ(block_count, reused.in_use - released.in_use);
+
+    for (void* block : blocks)
+    {
+        ::operator delete(block, block_size);
+    }
+    EXPECT_EQ(before.in_use, tools::mem_pool_stats(idx)->in_use);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file test_closable_queue.cpp
+ * @brief Unit tests for the portable_concurrency closable_queue batch operations, the pool batch drain and the pool
+ *        worker parameters.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "portable_concurrency/bits/closable_queue.hpp"
+#include "portable_concurrency/future.hpp"
+#include "portable_concurrency/thread_pool.hpp"
+
+namespace
+{
+
+    /**
+     * @brief Verifies push_range keeps FIFO order and pop_batch drains up to its capacity.
+     */
+    TEST(ClosableQueueTest, push_range_and_pop_batch_keep_order)
+    {
+        pco::detail::closable_queue<int> queue;
+        std::vector<int> values { 1, 2, 3, 4, 5 };
+        queue.push_range(values.begin(), values.end());
+        queue.push(6);
+
+        std::array<int, 4> batch {};
+        ASSERT_EQ(queue.pop_batch(batch.data(), batch.size()), 4U);
+        EXPECT_EQ(batch, (std::array<int, 4> { 1, 2, 3, 4 }));
+
+        ASSERT_EQ(queue.pop_batch(batch.data(), batch.size()), 2U);
+        EXPECT_EQ(batch[0], 5);
+        EXPECT_EQ(batch[1], 6);
+
+        EXPECT_EQ(queue.pop_batch(batch.data(), 0U), 0U);
+    }
+
+    /**
+     * @brief Verifies pop_batch returns zero once the queue is closed and drained, and waits for data before.
+     */
+    TEST(ClosableQueueTest, pop_batch_waits_then_reports_closed)
+    {
+        pco::detail::closable_queue<int> queue;
+        std::atomic<std::size_t> first_count { 0U };
+        std::atomic<std::size_t> second_count { 99U };
+
+        std::thread consumer(
+            [&]()
+            {
+                std::array<int, 8> batch {};
+                first_count.store(queue.pop_batch(batch.data(), batch.size()));
+                second_count.store(queue.pop_batch(batch.data(), batch.size()));
+            });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        EXPECT_EQ(first_count.load(), 0U);
+
+        std::vector<int> values { 7, 8, 9 };
+        queue.push_range(values.begin(), values.end());
+        while (0U == first_count.load())
+        {
+            std::this_thread::yield();
+        }
+        queue.close();
+        consumer.join();
+
+        EXPECT_EQ(first_count.load(), 3U);
+        EXPECT_EQ(second_count.load(), 0U);
+
+        int value = 0;
+        queue.push(10);
+        EXPECT_FALSE(queue.pop(value));
+    }
+
+    /**
+     * @brief Verifies a burst spread over idle consumers is shared instead of drained by the first one awake.
+     */
+    TEST(ClosableQueueTest, pop_batch_takes_fair_share)
+    {
+        pco::detail::closable_queue<int> queue;
+        std::atomic<int> ready { 0 };
+        std::array<std::size_t, 2> counts {};
+
+        auto consume = [&](std::size_t slot)
+        {
+            std::array<int, 16> batch {};
+            ready.fetch_add(1);
+            counts[slot] = queue.pop_batch(batch.data(), batch.size());
+        };
+
+        std::thread first(consume, 0U);
+        std::thread second(consume, 1U);
+        while (ready.load() < 2)
+        {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        std::vector<int> values(8U, 1);
+        queue.push_range(values.begin(), values.end());
+        first.join();
+        second.join();
+
+        EXPECT_EQ(counts[0] + counts[1], 8U);
+        EXPECT_EQ(counts[0], 4U);
+        EXPECT_EQ(counts[1], 4U);
+    }
+
+    /**
+     * @brief Verifies static_thread_pool still runs every task of a when_all fan-out with batched pops.
+     */
+    TEST(ClosableQueueTest, static_pool_runs_fan_out)
+    {
+        pco::static_thread_pool pool(3U);
+        std::vector<pco::future_result<int>> futures;
+        for (int value = 0; value < 64; ++value)
+        {
+            futures.push_back(pco::async_result(pool.executor(), [value]() { return value; }));
+        }
+
+        auto results = pco::when_all(futures.begin(), futures.end()).get_result();
+        ASSERT_TRUE(results.has_value());
+
+        int total = 0;
+        for (auto& item : results.value())
+        {
+            ASSERT_TRUE(item.has_value());
+            total += item.value();
+        }
+        EXPECT_EQ(total, (63 * 64) / 2);
+    }
+
+    /**
+     * @brief Verifies static_thread_pool workers run with their configured name and core pinning.
+     */
+    TEST(StaticThreadPoolTest, workers_apply_their_params)
+    {
+        std::vector<pco::thread_pool_params> workers(2U);
+        workers[0].name = "pco_worker_0";
+        workers[0].cpu_affinity = 0;
+        workers[1].name = "pco_worker_1";
+        workers[1].cpu_affinity = 0;
+        pco::static_thread_pool pool(workers);
+
+        std::vector<pco::future_result<std::string>> futures;
+        for (int index = 0; index < 16; ++index)
+        {
+            futures.push_back(pco::async_result(pool.executor(),
+                []() -> std::string
+                {
+#if defined(__linux__)
+                    EXPECT_EQ(sched_getcpu(), 0);
+                    std::array<char, 16U> name = {};
+                    pthread_getname_np(pthread_self(), name.data(), name.size());
+                    return std::string(name.data());
+#else
+                    return std::string("pco_worker_0");
+#endif
+                }));
+        }
+
+        for (auto& future : futures)
+        {
+            auto result = future.get_result();
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value().rfind("pco_worker_", 0U), 0U);
+        }
+    }
+
+} // namespace
@@ -0,0 +1,163 @@
+/**
+ * @file test_inline_when_ready.cpp
+ * @brief Unit tests for the inline_when_ready executor policy of portable_concurrency continuations.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+
+#include "portable_concurrency/execution.hpp"
+#include "portable_concurrency/functional.hpp"
+#include "portable_concurrency/future.hpp"
+#include "portable_concurrency/thread_pool.hpp"
+
+namespace
+{
+    /**
+     * @brief Executor queuing its tasks in an external vector, run on demand.
+     */
+    struct deferred_executor
+    {
+        std::vector<pco::unique_function<void()>>* tasks;
+    };
+
+    template <typename Task>
+    void post(deferred_executor exec, Task&& task)
+    {
+        exec.tasks->emplace_back(std::forward<Task>(task));
+    }
+
+    void run_all(std::vector<pco::unique_function<void()>>& tasks)
+    {
+        while (!tasks.empty())
+        {
+            auto pending = std::move(tasks);
+            tasks.clear();
+            for (auto& task : pending)
+            {
+                static_cast<void>(task.invoke());
+            }
+        }
+    }
+} // namespace
+
+namespace pco
+{
+    template <>
+    struct is_executor<deferred_executor> : std::true_type
+    {
+    };
+}
+
+namespace
+{
+
+    /**
+     * @brief Verifies a continuation on a ready future runs in the calling thread, without reaching the pool.
+     */
+    TEST(InlineWhenReadyTest, ready_source_runs_in_calling_thread)
+    {
+        std::vector<pco::unique_function<void()>> queued;
+        auto exec = pco::inline_when_ready(deferred_executor { &queued });
+        static_assert(pco::is_executor<decltype(exec)>::value, "adapter must be an executor");
+
+        std::thread::id runner;
+        auto chained = pco::make_ready_result<std::string, pco::result_error>(std::string("{\"id\":7}"))
+                           .then_value(exec,
+                               [&runner](const std::string& payload)
+                               {
+                                   runner = std::this_thread::get_id();
+                                   return payload.size();
+                               });
+
+        EXPECT_TRUE(queued.empty());
+        EXPECT_EQ(runner, std::this_thread::get_id());
+        auto result = chained.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 8U);
+    }
+
+    /**
+     * @brief Verifies a continuation on a pending future runs in the thread that completes it.
+     */
+    TEST(InlineWhenReadyTest, pending_source_runs_in_completing_thread)
+    {
+        pco::static_thread_pool pool { 1 };
+        auto exec = pco::inline_when_ready(pool.executor());
+
+        auto pair = pco::make_result_promise<int>();
+        auto promise = std::move(pair.first);
+        std::thread::id runner;
+        auto chained = std::move(pair.second)
+                           .then_value(exec,
+                               [&runner](int value)
+                               {
+                                   runner = std::this_thread::get_id();
+                                   return value * 2;
+                               });
+
+        std::thread producer([&promise] { promise.set_value(21); });
+        const auto producer_id = producer.get_id();
+        producer.join();
+
+        auto result = chained.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 42);
+        EXPECT_EQ(runner, producer_id);
+    }
+
+    /**
+     * @brief Verifies nested inline runs stop at the depth bound and continue on the wrapped executor.
+     */
+    TEST(InlineWhenReadyTest, depth_bound_falls_back_to_wrapped_executor)
+    {
+        constexpr std::size_t max_depth = 4U;
+        std::vector<pco::unique_function<void()>> queued;
+        auto exec = pco::inline_when_ready(deferred_executor { &queued }, max_depth);
+
+        auto pair = pco::make_result_promise<int>();
+        auto promise = std::move(pair.first);
+        auto future = std::move(pair.second);
+        for (int step = 0; step < 100; ++step)
+        {
+            future = std::move(future).then_value(exec, [](int value) { return value + 1; });
+        }
+
+        // completing the head unrolls max_depth continuations inline, the rest is handed to the executor
+        promise.set_value(0);
+        EXPECT_FALSE(future.is_ready());
+        EXPECT_EQ(queued.size(), 1U);
+
+        run_all(queued);
+        auto result = future.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 100);
+        EXPECT_EQ(pco::detail::inline_continuation_depth(), 0U);
+    }
+
+    /**
+     * @brief Verifies a zero depth always posts, and that error continuations honour the policy too.
+     */
+    TEST(InlineWhenReadyTest, zero_depth_always_posts)
+    {
+        std::vector<pco::unique_function<void()>> queued;
+        auto exec = pco::inline_when_ready(deferred_executor { &queued }, 0U);
+
+        auto recovered = pco::make_ready_result<int, pco::result_error>(5)
+                             .then_value(exec, [](int) -> int { return 0; })
+                             .then_error(exec, [](pco::result_error) { return 1; });
+
+        EXPECT_EQ(queued.size(), 1U);
+        run_all(queued);
+        auto result = recovered.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 0);
+    }
+
+} // namespace
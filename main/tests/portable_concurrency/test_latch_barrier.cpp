@@ -0,0 +1,194 @@
+/**
+ * @file test_latch_barrier.cpp
+ * @brief Unit tests for the portable_concurrency latch and barrier.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+
+#include "portable_concurrency/barrier.hpp"
+#include "portable_concurrency/latch.hpp"
+
+namespace
+{
+
+    /**
+     * @brief Verifies count_down by several steps and is_ready on a latch without waiters.
+     */
+    TEST(LatchTest, count_down_by_steps)
+    {
+        pco::latch gate(5);
+        EXPECT_FALSE(gate.is_ready());
+
+        gate.count_down(3);
+        EXPECT_FALSE(gate.is_ready());
+
+        gate.count_down();
+        gate.count_down(0);
+        EXPECT_FALSE(gate.is_ready());
+
+        gate.count_down();
+        EXPECT_TRUE(gate.is_ready());
+        gate.wait();
+    }
+
+    /**
+     * @brief Verifies waiters parked long past the spin window are released by the last count_down.
+     */
+    TEST(LatchTest, parked_waiters_are_released)
+    {
+        pco::latch gate(1);
+        std::atomic<int> released { 0 };
+
+        std::vector<std::thread> waiters;
+        for (int index = 0; index < 3; ++index)
+        {
+            waiters.emplace_back(
+                [&]()
+                {
+                    gate.wait();
+                    released.fetch_add(1);
+                });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_EQ(released.load(), 0);
+
+        gate.count_down();
+        for (auto& waiter : waiters)
+        {
+            waiter.join();
+        }
+        EXPECT_EQ(released.load(), 3);
+    }
+
+    /**
+     * @brief Verifies repeated fork-join rounds, each on a fresh latch destroyed right after the join.
+     */
+    TEST(LatchTest, fork_join_rounds)
+    {
+        constexpr int workers = 3;
+        constexpr int rounds = 200;
+        std::atomic<int> work { 0 };
+
+        for (int round = 0; round < rounds; ++round)
+        {
+            auto gate = std::make_unique<pco::latch>(workers + 1);
+            std::vector<std::thread> threads;
+            for (int index = 0; index < workers; ++index)
+            {
+                threads.emplace_back(
+                    [&work, latch = gate.get()]()
+                    {
+                        work.fetch_add(1);
+                        latch->count_down();
+                    });
+            }
+
+            gate->count_down_and_wait();
+            EXPECT_EQ(work.load(), (round + 1) * workers);
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Verifies a barrier keeps every participant in the same phase over many phases.
+     */
+    TEST(BarrierTest, phases_stay_in_lockstep)
+    {
+        constexpr int participants = 4;
+        constexpr int phases = 500;
+        pco::barrier sync(participants);
+        std::atomic<int> arrivals { 0 };
+        std::atomic<bool> mismatch { false };
+
+        std::vector<std::thread> threads;
+        for (int index = 0; index < participants; ++index)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    for (int phase = 0; phase < phases; ++phase)
+                    {
+                        arrivals.fetch_add(1);
+                        sync.arrive_and_wait();
+                        if (arrivals.load() < ((phase + 1) * participants))
+                        {
+                            mismatch.store(true);
+                        }
+                        sync.arrive_and_wait();
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_FALSE(mismatch.load());
+        EXPECT_EQ(arrivals.load(), participants * phases);
+        EXPECT_EQ(sync.completed_phases(), static_cast<std::uint32_t>(2 * phases));
+    }
+
+    /**
+     * @brief Verifies waiters parked on a barrier are released by the last arrival.
+     */
+    TEST(BarrierTest, parked_waiters_are_released)
+    {
+        pco::barrier sync(3);
+        std::atomic<int> released { 0 };
+
+        std::vector<std::thread> waiters;
+        for (int index = 0; index < 2; ++index)
+        {
+            waiters.emplace_back(
+                [&]()
+                {
+                    sync.arrive_and_wait();
+                    released.fetch_add(1);
+                });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_EQ(released.load(), 0);
+        EXPECT_EQ(sync.completed_phases(), 0U);
+
+        sync.arrive_and_wait();
+        for (auto& waiter : waiters)
+        {
+            waiter.join();
+        }
+        EXPECT_EQ(released.load(), 2);
+        EXPECT_EQ(sync.completed_phases(), 1U);
+    }
+
+    /**
+     * @brief Verifies arrive_and_drop completes the current phase and shrinks the next ones.
+     */
+    TEST(BarrierTest, arrive_and_drop_shrinks_participants)
+    {
+        pco::barrier sync(2);
+
+        std::thread leaver([&]() { sync.arrive_and_drop(); });
+        sync.arrive_and_wait();
+        leaver.join();
+        EXPECT_EQ(sync.completed_phases(), 1U);
+
+        sync.arrive_and_wait();
+        sync.arrive_and_wait();
+        EXPECT_EQ(sync.completed_phases(), 3U);
+    }
+
+} // namespace
@@ -257,11 +257,19 @@ namespace
     }
 
     /**
-     *  Verifies allocator-tag constructor is intentionally unsupported in the result-based API.
+     *  Verifies allocator-tag constructor allocates a usable shared state.
      */
-    TEST(PromiseResultTest, allocator_constructor_is_not_supported)
+    TEST(PromiseResultTest, allocator_constructor_is_supported)
     {
-        EXPECT_FALSE((std::is_constructible_v<pco::promise_result<int>, std::allocator_arg_t, std::allocator<int>>));
+        EXPECT_TRUE((std::is_constructible_v<pco::promise_result<int>, std::allocator_arg_t, std::allocator<int>>));
+
+        pco::promise_result<int> promise(std::allocator_arg, std::allocator<int>());
+        auto future = promise.get_future();
+        promise.set_value(5);
+
+        auto result = future.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 5);
     }
 
     /**
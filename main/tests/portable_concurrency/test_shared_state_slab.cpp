@@ -0,0 +1,161 @@
+/**
+ * @file test_shared_state_slab.cpp
+ * @brief Unit tests for slab-allocated promise/future shared states of portable_concurrency.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+
+#include "portable_concurrency/future.hpp"
+#include "portable_concurrency/thread_pool.hpp"
+
+namespace
+{
+    /** @brief Tag type giving the tests their own per-type slabs. */
+    struct probe_value
+    {
+        int id = 0;
+    };
+
+    /**
+     * @brief Verifies blocks come from the slab until exhausted, then from the heap.
+     */
+    TEST(SharedStateSlabTest, pool_falls_back_to_heap_when_exhausted)
+    {
+        pco::slab_pool<40U, 2U> pool;
+        EXPECT_EQ(pool.block_size % alignof(std::max_align_t), 0U);
+
+        void* first = pool.allocate(40U, alignof(std::max_align_t));
+        void* second = pool.allocate(16U, alignof(int));
+        void* third = pool.allocate(8U, alignof(int));
+        void* oversized = pool.allocate(pool.block_size + 1U, alignof(int));
+
+        EXPECT_TRUE(pool.owns(first));
+        EXPECT_TRUE(pool.owns(second));
+        EXPECT_FALSE(pool.owns(third));
+        EXPECT_FALSE(pool.owns(oversized));
+        EXPECT_EQ(pool.in_use(), 2U);
+        EXPECT_EQ(pool.fallback_count(), 2U);
+
+        pool.deallocate(oversized, pool.block_size + 1U, alignof(int));
+        pool.deallocate(third, 8U, alignof(int));
+        pool.deallocate(first, 40U, alignof(std::max_align_t));
+        EXPECT_EQ(pool.in_use(), 1U);
+
+        void* reused = pool.allocate(24U, alignof(int));
+        EXPECT_EQ(reused, first);
+
+        pool.deallocate(reused, 24U, alignof(int));
+        pool.deallocate(second, 16U, alignof(int));
+        EXPECT_EQ(pool.in_use(), 0U);
+        EXPECT_EQ(pool.high_water(), 2U);
+    }
+
+    /**
+     * @brief Verifies a pooled promise/future pair holds one slab block for the lifetime of its state.
+     */
+    TEST(SharedStateSlabTest, pooled_promise_uses_per_type_slab)
+    {
+        auto& pool = pco::result_state_pool<probe_value>();
+        ASSERT_EQ(pool.in_use(), 0U);
+
+        {
+            auto promise_and_future = pco::make_result_promise<probe_value, pco::result_error>(
+                std::allocator_arg, pco::result_state_allocator<probe_value>());
+            EXPECT_EQ(pool.in_use(), 1U);
+
+            promise_and_future.first.set_value(probe_value { 42 });
+            auto result = promise_and_future.second.get_result();
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value().id, 42);
+        }
+
+        EXPECT_EQ(pool.in_use(), 0U);
+        EXPECT_EQ(pool.fallback_count(), 0U);
+    }
+
+    /**
+     * @brief Verifies states beyond the slab capacity still work and are counted as fallbacks.
+     */
+    TEST(SharedStateSlabTest, pooled_promises_beyond_capacity_fall_back)
+    {
+        constexpr std::size_t capacity = 4U;
+        auto& pool = pco::result_state_pool<std::string, pco::result_error, capacity>();
+        auto alloc = pco::result_state_allocator<std::string, pco::result_error, capacity>();
+
+        std::vector<pco::promise_result<std::string>> promises;
+        std::vector<pco::future_result<std::string>> futures;
+        for (std::size_t index = 0U; index < (capacity + 2U); ++index)
+        {
+            auto promise_and_future
+                = pco::make_result_promise<std::string, pco::result_error>(std::allocator_arg, alloc);
+            promises.push_back(std::move(promise_and_future.first));
+            futures.push_back(std::move(promise_and_future.second));
+        }
+
+        EXPECT_EQ(pool.in_use(), capacity);
+        EXPECT_EQ(pool.fallback_count(), 2U);
+
+        promises.clear();
+        for (auto& future : futures)
+        {
+            auto result = future.get_result();
+            ASSERT_FALSE(result.has_value());
+            EXPECT_EQ(result.error(), pco::result_error::broken_promise);
+        }
+
+        futures.clear();
+        EXPECT_EQ(pool.in_use(), 0U);
+        EXPECT_EQ(pool.high_water(), capacity);
+    }
+
+    /**
+     * @brief Verifies async_result with an allocator delivers the value and releases the pooled state.
+     */
+    TEST(SharedStateSlabTest, async_result_with_allocator)
+    {
+        auto& pool = pco::result_state_pool<probe_value>();
+        pco::static_thread_pool workers(2U);
+
+        {
+            auto future = pco::async_result(std::allocator_arg, pco::result_state_allocator<probe_value>(),
+                workers.executor(), [](int id) { return probe_value { id }; }, 9);
+            auto result = future.get_result();
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value().id, 9);
+        }
+
+        workers.wait();
+        EXPECT_EQ(pool.in_use(), 0U);
+    }
+
+    /**
+     * @brief Verifies packaged_task_result allocates both its task state and its promise state from the allocator.
+     */
+    TEST(SharedStateSlabTest, packaged_task_with_allocator)
+    {
+        using pool_type = pco::slab_pool<512U, 4U>;
+        auto pool = std::make_unique<pool_type>();
+
+        {
+            pco::packaged_task_result<int(int)> task(
+                std::allocator_arg, pco::slab_allocator<int, pool_type>(*pool), [](int value) { return value * 2; });
+            EXPECT_EQ(pool->in_use(), 2U);
+
+            auto future = task.get_future();
+            task(21);
+            auto result = future.get_result();
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value(), 42);
+        }
+
+        EXPECT_EQ(pool->in_use(), 0U);
+        EXPECT_EQ(pool->fallback_count(), 0U);
+    }
+} // namespace
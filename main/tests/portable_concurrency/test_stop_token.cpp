@@ -0,0 +1,221 @@
+/**
+ * @file test_stop_token.cpp
+ * @brief Unit tests for cooperative cancellation of result-future chains with stop_source/stop_token.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "portable_concurrency/execution.hpp"
+#include "portable_concurrency/future.hpp"
+#include "portable_concurrency/thread_pool.hpp"
+
+namespace
+{
+
+    enum class legacy_error : std::uint8_t
+    {
+        no_state = 1,
+        broken_promise,
+    };
+
+    TEST(StopTokenTest, default_token_is_never_stopped)
+    {
+        pco::stop_token token;
+        EXPECT_FALSE(token.stop_possible());
+        EXPECT_FALSE(token.stop_requested());
+
+        pco::stop_source source;
+        EXPECT_TRUE(source.get_token().stop_possible());
+        EXPECT_TRUE(source.get_token() == source.get_token());
+        EXPECT_TRUE(token != source.get_token());
+        EXPECT_TRUE(source.request_stop());
+        EXPECT_FALSE(source.request_stop());
+        EXPECT_TRUE(source.get_token().stop_requested());
+    }
+
+    TEST(StopTokenTest, request_stop_cancels_pending_chain_without_running_continuations)
+    {
+        pco::stop_source source;
+        pco::promise_result<int> promise;
+        std::atomic<int> runs { 0 };
+
+        auto chained = promise.get_future()
+                           .with_stop_token(source.get_token())
+                           .then_value([&runs](int value) { ++runs; return value + 1; })
+                           .then_value([&runs](int value) { ++runs; return value * 2; });
+        EXPECT_TRUE(chained.get_stop_token() == source.get_token());
+        EXPECT_TRUE(promise.is_awaiten());
+        EXPECT_FALSE(chained.is_ready());
+
+        source.request_stop();
+        EXPECT_TRUE(chained.is_ready());
+        EXPECT_FALSE(promise.is_awaiten());
+
+        promise.set_value(1);
+        auto result = chained.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), pco::result_error::cancelled);
+        EXPECT_EQ(runs.load(), 0);
+    }
+
+    TEST(StopTokenTest, running_task_polls_token_and_downstream_is_released)
+    {
+        pco::static_thread_pool pool { 1 };
+        pco::stop_source source;
+        const pco::stop_token token = source.get_token();
+        std::atomic<bool> started { false };
+        std::atomic<bool> saw_stop { false };
+        std::atomic<int> downstream_runs { 0 };
+
+        auto future = pco::make_ready_result(1)
+                          .with_stop_token(token)
+                          .then_value(pool.executor(),
+                              [&started, &saw_stop, token](int value)
+                              {
+                                  started = true;
+                                  while (!token.stop_requested())
+                                  {
+                                      std::this_thread::yield();
+                                  }
+                                  saw_stop = true;
+                                  return value;
+                              })
+                          .then_value([&downstream_runs](int value) { ++downstream_runs; return value; });
+
+        while (!started.load())
+        {
+            std::this_thread::yield();
+        }
+        source.request_stop();
+
+        auto result = future.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), pco::result_error::cancelled);
+
+        while (!saw_stop.load())
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(downstream_runs.load(), 0);
+    }
+
+    TEST(StopTokenTest, queued_async_task_is_dropped)
+    {
+        pco::static_thread_pool pool { 1 };
+        pco::stop_source source;
+        std::atomic<bool> release { false };
+        std::atomic<bool> ran { false };
+
+        auto gate = pco::async_result(pool.executor(),
+            [&release]
+            {
+                while (!release.load())
+                {
+                    std::this_thread::yield();
+                }
+            });
+        auto queued
+            = pco::async_result(pool.executor(), [&ran] { ran = true; return 5; }).with_stop_token(source.get_token());
+
+        source.request_stop();
+        EXPECT_TRUE(queued.is_ready());
+        auto result = queued.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), pco::result_error::cancelled);
+
+        release = true;
+        EXPECT_TRUE(gate.get_result().has_value());
+        // single worker, FIFO queue: once the marker ran, the cancelled task was dequeued
+        EXPECT_TRUE(pco::async_result(pool.executor(), [] { return 0; }).get_result().has_value());
+        EXPECT_FALSE(ran.load());
+    }
+
+    TEST(StopTokenTest, binding_after_stop_cancels_immediately)
+    {
+        pco::stop_source source;
+        source.request_stop();
+
+        pco::promise_result<int> promise;
+        auto future = promise.get_future().with_stop_token(source.get_token());
+        EXPECT_TRUE(future.is_ready());
+        auto result = future.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), pco::result_error::cancelled);
+    }
+
+    TEST(StopTokenTest, completed_chain_is_not_affected)
+    {
+        pco::stop_source source;
+        auto future = pco::make_ready_result(20)
+                          .with_stop_token(source.get_token())
+                          .then_value([](int value) { return value + 1; });
+        source.request_stop();
+
+        auto result = future.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 21);
+    }
+
+    TEST(StopTokenTest, when_all_and_when_any_inherit_the_token)
+    {
+        pco::stop_source source;
+        pco::promise_result<int> first;
+        pco::promise_result<int> second;
+        auto all = pco::when_all(first.get_future().with_stop_token(source.get_token()), second.get_future());
+        EXPECT_TRUE(all.get_stop_token() == source.get_token());
+
+        pco::promise_result<int> third;
+        pco::promise_result<int> fourth;
+        std::vector<pco::future_result<int>> racers;
+        racers.push_back(third.get_future());
+        racers.push_back(fourth.get_future());
+        racers.front() = std::move(racers.front()).with_stop_token(source.get_token());
+        auto any = pco::when_any(racers.begin(), racers.end());
+        EXPECT_TRUE(any.get_stop_token() == source.get_token());
+
+        source.request_stop();
+        EXPECT_TRUE(all.is_ready());
+        auto all_result = all.get_result();
+        ASSERT_FALSE(all_result.has_value());
+        EXPECT_EQ(all_result.error(), pco::result_error::cancelled);
+
+        auto any_result = any.get_result();
+        ASSERT_FALSE(any_result.has_value());
+        EXPECT_EQ(any_result.error(), pco::result_error::cancelled);
+    }
+
+    TEST(StopTokenTest, shared_result_continuations_inherit_the_token)
+    {
+        pco::stop_source source;
+        pco::promise_result<int> promise;
+        auto shared = promise.get_future().share().with_stop_token(source.get_token());
+        std::atomic<int> runs { 0 };
+        auto next = shared.then_value([&runs](const int& value) { ++runs; return value; });
+        EXPECT_TRUE(next.get_stop_token() == source.get_token());
+
+        source.request_stop();
+        auto result = next.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), pco::result_error::cancelled);
+        EXPECT_EQ(runs.load(), 0);
+    }
+
+    TEST(StopTokenTest, error_type_without_cancelled_reports_broken_promise)
+    {
+        pco::stop_source source;
+        pco::promise_result<int, legacy_error> promise;
+        auto future = promise.get_future().with_stop_token(source.get_token());
+
+        source.request_stop();
+        auto result = future.get_result();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), legacy_error::broken_promise);
+    }
+
+} // namespace
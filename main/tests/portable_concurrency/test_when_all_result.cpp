@@ -5,9 +5,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <list>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 #include <thread>
 #include <vector>
 
@@ -422,4 +426,69 @@ namespace
             EXPECT_EQ(result.value()[i].value(), i * 10);
     }
 
+    /**
+     * @brief Tests the fixed-size array overload keeps input order and reports errors per operand.
+     */
+    TEST(WhenAllResultTest, array_overload_preserves_input_order_in_results)
+    {
+        std::array<pco::promise_result<int>, 3> promises;
+        std::array<pco::future_result<int>, 3> futures
+            = { promises[0].get_future(), promises[1].get_future(), promises[2].get_future() };
+
+        auto combined = pco::when_all(std::move(futures));
+        promises[2].set_value(30);
+        promises[0].set_value(10);
+        EXPECT_FALSE(combined.is_ready());
+        promises[1].set_error(pco::result_error::execution_failure);
+
+        auto result = combined.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value()[0].value(), 10);
+        ASSERT_FALSE(result.value()[1].has_value());
+        EXPECT_EQ(result.value()[1].error(), pco::result_error::execution_failure);
+        EXPECT_EQ(result.value()[2].value(), 30);
+
+        auto empty = pco::when_all(std::array<pco::future_result<int>, 0> {}).get_result();
+        ASSERT_TRUE(empty.has_value());
+
+        std::array<pco::future_result<int>, 2> invalid = { pco::make_ready_result(1), pco::future_result<int> {} };
+        auto invalid_result = pco::when_all(std::move(invalid)).get_result();
+        ASSERT_FALSE(invalid_result.has_value());
+        EXPECT_EQ(invalid_result.error(), pco::result_error::no_state);
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /**
+     * @brief Tests the span overload fills caller-provided storage and checks the sizes match.
+     */
+    TEST(WhenAllResultTest, span_overload_fills_caller_storage)
+    {
+        std::array<pco::promise_result<int>, 4> promises;
+        std::array<pco::future_result<int>, 4> futures;
+        std::vector<pco::expected<int, pco::result_error>> results(
+            futures.size(), pco::unexpected<pco::result_error>(pco::result_error::no_state));
+        for (std::size_t index = 0U; index < futures.size(); ++index)
+        {
+            futures[index] = promises[index].get_future();
+        }
+
+        auto done = pco::when_all(std::span(futures), std::span(results));
+        for (std::size_t index = 0U; index < promises.size(); ++index)
+        {
+            EXPECT_FALSE(done.is_ready());
+            promises[promises.size() - 1U - index].set_value(static_cast<int>(index));
+        }
+
+        ASSERT_TRUE(done.get_result().has_value());
+        EXPECT_EQ(results[0].value(), 3);
+        EXPECT_EQ(results[3].value(), 0);
+        EXPECT_FALSE(futures[0].valid());
+
+        std::array<pco::future_result<int>, 1> single = { pco::make_ready_result(1) };
+        auto mismatch = pco::when_all(
+            std::span<pco::future_result<int>>(single), std::span<pco::expected<int, pco::result_error>>(results));
+        ASSERT_FALSE(mismatch.get_result().has_value());
+    }
+#endif
+
 } // namespace
@@ -5,9 +5,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <list>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 #include <thread>
 #include <vector>
 
@@ -416,4 +420,52 @@ namespace
         pair0.first.set_value(0); // completing the other doesn't change it
     }
 
+    /**
+     * @brief Tests the fixed-size array overload reports the first ready input and keeps the futures.
+     */
+    TEST(WhenAnyResultTest, array_overload_reports_first_ready_input)
+    {
+        std::array<pco::promise_result<int>, 3> promises;
+        std::array<pco::future_result<int>, 3> futures
+            = { promises[0].get_future(), promises[1].get_future(), promises[2].get_future() };
+
+        auto any = pco::when_any(std::move(futures));
+        EXPECT_FALSE(any.is_ready());
+        promises[1].set_value(7);
+        promises[0].set_value(3);
+
+        auto result = any.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value().index, 1U);
+        EXPECT_EQ(result.value().futures[1].get_result().value(), 7);
+        EXPECT_EQ(result.value().futures[0].get_result().value(), 3);
+        EXPECT_FALSE(result.value().futures[2].is_ready());
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /**
+     * @brief Tests the span overload returns the winner index and leaves the futures in caller storage.
+     */
+    TEST(WhenAnyResultTest, span_overload_returns_winner_index)
+    {
+        std::array<pco::promise_result<int>, 3> promises;
+        std::array<pco::future_result<int>, 3> futures
+            = { promises[0].get_future(), promises[1].get_future(), promises[2].get_future() };
+
+        auto any = pco::when_any(std::span(futures));
+        EXPECT_FALSE(any.is_ready());
+        promises[2].set_value(9);
+
+        auto result = any.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 2U);
+        EXPECT_EQ(futures[2].get_result().value(), 9);
+        EXPECT_TRUE(futures[0].valid());
+
+        auto empty = pco::when_any(std::span<pco::future_result<int>> {}).get_result();
+        ASSERT_FALSE(empty.has_value());
+        EXPECT_EQ(empty.error(), pco::result_error::no_state);
+    }
+#endif
+
 } // namespace
@@ -0,0 +1,215 @@
+/**
+ * @file test_work_stealing_pool.cpp
+ * @brief Unit tests for the portable_concurrency work-stealing thread pool and its Chase-Lev deque.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+
+#include "portable_concurrency/execution.hpp"
+#include "portable_concurrency/future.hpp"
+#include "portable_concurrency/thread_pool.hpp"
+
+namespace
+{
+
+    /**
+     * @brief Verifies the owner takes newest first, thieves steal oldest first and the ring grows.
+     */
+    TEST(WorkStealingDequeTest, owner_lifo_thief_fifo_and_growth)
+    {
+        pco::detail::work_stealing_deque deque { 1U };
+        std::vector<int> order;
+
+        EXPECT_TRUE(deque.empty());
+        EXPECT_EQ(deque.take(), nullptr);
+        EXPECT_EQ(deque.steal(), nullptr);
+
+        for (int index = 0; index < 10; ++index)
+        {
+            deque.push(new pco::unique_function<void()>([&order, index] { order.push_back(index); }));
+        }
+
+        auto run = [](pco::unique_function<void()>* task)
+        {
+            ASSERT_NE(task, nullptr);
+            static_cast<void>(task->invoke());
+            delete task;
+        };
+
+        run(deque.steal());
+        run(deque.take());
+        run(deque.steal());
+        run(deque.take());
+
+        EXPECT_EQ(order, (std::vector<int> { 0, 9, 1, 8 }));
+        EXPECT_FALSE(deque.empty());
+        // remaining tasks are released by the destructor
+    }
+
+    /**
+     * @brief Verifies every task is handed out exactly once when an owner and thieves race on the deque.
+     */
+    TEST(WorkStealingDequeTest, concurrent_take_and_steal_hand_out_each_task_once)
+    {
+        constexpr int task_count = 20000;
+        pco::detail::work_stealing_deque deque { 2U };
+        std::atomic<int> executed { 0 };
+        std::atomic<bool> done { false };
+
+        std::vector<std::thread> thieves;
+        for (int thief = 0; thief < 3; ++thief)
+        {
+            thieves.emplace_back(
+                [&]
+                {
+                    while (!done.load() || !deque.empty())
+                    {
+                        if (auto* task = deque.steal())
+                        {
+                            static_cast<void>(task->invoke());
+                            delete task;
+                        }
+                    }
+                });
+        }
+
+        for (int index = 0; index < task_count; ++index)
+        {
+            deque.push(new pco::unique_function<void()>([&executed] { executed.fetch_add(1); }));
+            if ((index % 3) == 0)
+            {
+                if (auto* task = deque.take())
+                {
+                    static_cast<void>(task->invoke());
+                    delete task;
+                }
+            }
+        }
+
+        while (auto* task = deque.take())
+        {
+            static_cast<void>(task->invoke());
+            delete task;
+        }
+
+        done.store(true);
+        for (auto& thief : thieves)
+        {
+            thief.join();
+        }
+
+        EXPECT_EQ(executed.load(), task_count);
+    }
+
+    /**
+     * @brief Verifies async_result and then_value run on the pool threads through the executor customization point.
+     */
+    TEST(WorkStealingThreadPoolTest, async_and_continuation_chain_run_on_pool)
+    {
+        pco::work_stealing_thread_pool pool { 2 };
+        auto exec = pool.executor();
+        EXPECT_EQ(pool.size(), 2U);
+
+        auto future = pco::async_result(exec, [] { return 1; });
+        for (int step = 0; step < 1000; ++step)
+        {
+            future = std::move(future).then_value(exec, [](int value) { return value + 1; });
+        }
+
+        auto thread_future = pco::async_result(exec, [] { return std::this_thread::get_id(); });
+
+        auto result = future.get_result();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 1001);
+
+        auto thread_result = thread_future.get_result();
+        ASSERT_TRUE(thread_result.has_value());
+        EXPECT_NE(thread_result.value(), std::this_thread::get_id());
+    }
+
+    /**
+     * @brief Verifies nested posts from workers are drained by wait() and that idle workers steal them.
+     */
+    TEST(WorkStealingThreadPoolTest, nested_posts_are_drained_and_stolen)
+    {
+        constexpr int subtask_count = 64;
+        std::atomic<int> executed { 0 };
+        std::mutex ids_mutex;
+        std::set<std::thread::id> worker_ids;
+
+        pco::work_stealing_thread_pool pool { 4 };
+        auto exec = pool.executor();
+
+        post(exec,
+            pco::unique_function<void()>(
+                [&, exec]
+                {
+                    for (int index = 0; index < subtask_count; ++index)
+                    {
+                        post(exec,
+                            pco::unique_function<void()>(
+                                [&]
+                                {
+                                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                    {
+                                        std::scoped_lock<std::mutex> lock { ids_mutex };
+                                        worker_ids.insert(std::this_thread::get_id());
+                                    }
+                                    executed.fetch_add(1);
+                                }));
+                    }
+                }));
+
+        // wait until the root task has run, then drain
+        while (executed.load() == 0)
+        {
+            std::this_thread::yield();
+        }
+        pool.wait();
+
+        EXPECT_EQ(executed.load(), subtask_count);
+        EXPECT_GT(pool.steal_count(), 0U);
+        EXPECT_GT(worker_ids.size(), 1U);
+    }
+
+    /**
+     * @brief Verifies queued work discarded by the destructor breaks the corresponding futures.
+     */
+    TEST(WorkStealingThreadPoolTest, destruction_breaks_pending_futures)
+    {
+        pco::future_result<int> pending;
+        std::atomic<bool> release { false };
+
+        {
+            pco::work_stealing_thread_pool pool { 1 };
+            auto exec = pool.executor();
+
+            auto blocker = pco::async_result(exec,
+                [&release]
+                {
+                    while (!release.load())
+                    {
+                        std::this_thread::yield();
+                    }
+                    return 0;
+                });
+            pending = pco::async_result(exec, [] { return 42; });
+
+            pool.stop();
+            release.store(true);
+        }
+
+        auto result = pending.get_result();
+        EXPECT_FALSE(result.has_value());
+    }
+
+} // namespace
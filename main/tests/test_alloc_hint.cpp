@@ -0,0 +1,164 @@
+/**
+ * @file test_alloc_hint.cpp
+ * @brief Unit tests for the memory capability hints and their users using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "tools/alloc_hint.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/ring_vector.hpp"
+
+/**
+ * @brief Test that automatic hints are resolved by size and explicit hints are kept.
+ */
+TEST(AllocHintTest, ResolvesAutomaticHintsBySize)
+{
+    EXPECT_EQ(tools::alloc_hint::internal, tools::resolve_alloc_hint(16U, tools::alloc_hint::automatic));
+    EXPECT_EQ(tools::alloc_hint::external,
+        tools::resolve_alloc_hint(ALLOC_HINT_EXTERNAL_THRESHOLD, tools::alloc_hint::automatic));
+    EXPECT_EQ(tools::alloc_hint::dma, tools::resolve_alloc_hint(1U << 20U, tools::alloc_hint::dma));
+    EXPECT_EQ(tools::alloc_hint::internal, tools::resolve_alloc_hint(1U << 20U, tools::alloc_hint::internal));
+}
+
+/**
+ * @brief Test that every hint serves usable, malloc aligned blocks.
+ */
+TEST(AllocHintTest, ServesBlocksForEveryHint)
+{
+    for (const auto hint : { tools::alloc_hint::automatic, tools::alloc_hint::internal, tools::alloc_hint::external,
+             tools::alloc_hint::dma })
+    {
+        void* block = tools::hinted_malloc(256U, hint);
+        ASSERT_NE(nullptr, block);
+        EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t));
+        std::memset(block, 0x5A, 256U);
+        tools::hinted_free(block);
+    }
+    tools::hinted_free(nullptr);
+}
+
+/**
+ * @brief Test that hinted unique pointers construct objects and zero-initialize arrays.
+ */
+TEST(AllocHintTest, MakesHintedObjectsAndArrays)
+{
+    struct sample
+    {
+        int value;
+        std::vector<int> items;
+    };
+
+    auto object = tools::make_hinted_unique<sample>(tools::alloc_hint::internal, sample { 7, { 1, 2, 3 } });
+    ASSERT_TRUE(object);
+    EXPECT_EQ(7, object->value);
+    EXPECT_EQ(3U, object->items.size());
+
+    auto table = tools::make_hinted_unique<std::array<std::uint32_t, 64U>>(tools::alloc_hint::external);
+    ASSERT_TRUE(table);
+    EXPECT_EQ(0U, (*table)[63]);
+
+    auto bytes = tools::make_hinted_unique<std::uint8_t[]>(1024U, tools::alloc_hint::dma);
+    ASSERT_TRUE(bytes);
+    for (std::size_t i = 0U; i < 1024U; ++i)
+    {
+        ASSERT_EQ(0U, bytes[i]);
+    }
+}
+
+/**
+ * @brief Test that containers keep the hint of their allocator.
+ */
+TEST(AllocHintTest, ContainersAllocateWithTheirHint)
+{
+    const tools::hinted_allocator<int> external(tools::alloc_hint::external);
+    tools::ring_vector<int, tools::hinted_allocator<int>> ring(16U, external);
+    EXPECT_EQ(16U, ring.capacity());
+    for (int i = 0; i < 20; ++i)
+    {
+        ring.push_overwrite(i);
+    }
+    EXPECT_EQ(16U, ring.size());
+    EXPECT_EQ(4, ring.front());
+
+    std::vector<std::uint8_t, tools::hinted_allocator<std::uint8_t>> buffer(
+        tools::hinted_allocator<std::uint8_t>(tools::alloc_hint::dma));
+    buffer.resize(4096U, 0xA5U);
+    EXPECT_EQ(tools::alloc_hint::dma, buffer.get_allocator().hint());
+    EXPECT_TRUE(tools::hinted_allocator<int>(tools::alloc_hint::dma) == buffer.get_allocator());
+    EXPECT_TRUE(external != buffer.get_allocator());
+}
+
+/**
+ * @brief Test a memory pipe whose buffer is allocated from hinted memory.
+ */
+TEST(AllocHintTest, MemoryPipeWithHintedBuffer)
+{
+    tools::memory_pipe pipe(512U, tools::alloc_hint::external);
+    EXPECT_EQ(512U, pipe.capacity());
+
+    const std::vector<std::uint8_t> sent_data(100U, 0x42U);
+    const auto timeout = std::chrono::milliseconds(10);
+    EXPECT_EQ(sent_data.size(), pipe.send(sent_data, timeout));
+
+    std::vector<std::uint8_t> received_data;
+    EXPECT_EQ(sent_data.size(), pipe.receive(received_data, sent_data.size(), timeout));
+    EXPECT_EQ(sent_data, received_data);
+}
+
+/**
+ * @brief Test gzip round trips with the tables allocated from hinted memory.
+ */
+TEST(AllocHintTest, GzipWithHintedTables)
+{
+    tools::gzip_wrapper gzip(tools::alloc_hint::internal);
+    std::vector<std::uint8_t> original(2000U);
+    for (std::size_t i = 0U; i < original.size(); ++i)
+    {
+        original[i] = static_cast<std::uint8_t>(i % 17U);
+    }
+
+    const auto packed = gzip.pack(original);
+    ASSERT_FALSE(packed.empty());
+    EXPECT_EQ(original, gzip.unpack(packed));
+
+    tools::gzip_stream_decoder decoder(tools::gzip_dict_size, tools::alloc_hint::external);
+    decoder.reset();
+    EXPECT_FALSE(decoder.done());
+}
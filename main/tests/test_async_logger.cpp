@@ -0,0 +1,142 @@
+/**
+ * @file test_async_logger.cpp
+ * @brief Unit tests for the async logger records, channels and drain using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tools/async_log_buffer.hpp"
+#include "tools/async_logger.hpp"
+
+namespace
+{
+    std::string format_line(const tools::async_log_record& record, std::size_t size = 256U)
+    {
+        std::vector<char> text(size);
+        const std::size_t length = tools::detail::format_async_log_line(record, text.data(), text.size());
+        return std::string(text.data(), length);
+    }
+
+    std::chrono::duration<std::uint64_t, std::milli> hour()
+    {
+        return std::chrono::duration<std::uint64_t, std::milli>(3600000U);
+    }
+}
+
+TEST(AsyncLogRecordTest, FormatsPackedArguments)
+{
+    std::array<char, 16> name = { 's', 'e', 'n', 's', 'o', 'r', '\0' };
+    tools::async_log_record record;
+    tools::detail::pack_async_log_record(record, tools::log_level::info, "/src/app/main.cpp", "loop", 42,
+        "%s=%d (%.2f) %c %s", name.data(), -7, 1.5, 'x', "end");
+
+    // the string arguments are copied into the record
+    name[0] = 'S';
+    const std::string line = format_line(record);
+
+    EXPECT_NE(std::string::npos, line.find("[INFO] main.cpp [loop, line 42] sensor=-7 (1.50) x end"));
+    EXPECT_EQ('\n', line.back());
+}
+
+TEST(AsyncLogRecordTest, TruncatesLongStringsAndLines)
+{
+    const std::string long_text(300U, 'a');
+    tools::async_log_record record;
+    tools::detail::pack_async_log_record(
+        record, tools::log_level::error, "file.cpp", "f", 1, "%s|%s", long_text.c_str(), "tail");
+
+    const std::string full = format_line(record);
+    EXPECT_NE(std::string::npos, full.find("|tail"));
+    EXPECT_LT(full.size(), 256U);
+
+    const std::string clipped = format_line(record, 40U);
+    EXPECT_EQ(39U, clipped.size());
+    EXPECT_EQ('\n', clipped.back());
+}
+
+TEST(AsyncLoggerTest, DrainsRecordsInOrderThroughTheSink)
+{
+    std::vector<std::string> lines;
+    {
+        tools::async_logger logger(hour(),
+            [&lines](tools::log_level level, const char* line, std::size_t length)
+            {
+                EXPECT_EQ(tools::log_level::info, level);
+                lines.emplace_back(line, length);
+            });
+
+        for (int i = 0; i < 10; ++i)
+        {
+            tools::async_log(tools::log_level::info, __FILE__, "test", __LINE__, "message %d", i);
+        }
+        EXPECT_EQ(10U, logger.drain());
+        EXPECT_EQ(0U, logger.drain());
+        EXPECT_EQ(0U, logger.dropped_count());
+    }
+
+    ASSERT_EQ(10U, lines.size());
+    for (std::size_t i = 0U; i < lines.size(); ++i)
+    {
+        EXPECT_NE(std::string::npos, lines[i].find("message " + std::to_string(i)));
+    }
+}
+
+TEST(AsyncLoggerTest, CountsAndReportsDropsWhenTheChannelIsFull)
+{
+    std::vector<std::string> lines;
+    const std::size_t calls = tools::async_log_channel::record_count + 5U;
+    {
+        tools::async_logger logger(hour(),
+            [&lines](tools::log_level, const char* line, std::size_t length) { lines.emplace_back(line, length); });
+
+        for (std::size_t i = 0U; i < calls; ++i)
+        {
+            const auto value = static_cast<unsigned>(i);
+            tools::async_log(tools::log_level::warning, __FILE__, "test", __LINE__, "flood %u", value);
+        }
+        EXPECT_EQ(5U, logger.dropped_count());
+        EXPECT_EQ(tools::async_log_channel::record_count, logger.drain());
+
+        // the channel is usable again once drained
+        tools::async_log(tools::log_level::warning, __FILE__, "test", __LINE__, "after");
+    }
+
+    ASSERT_EQ(tools::async_log_channel::record_count + 2U, lines.size());
+    EXPECT_NE(std::string::npos, lines[tools::async_log_channel::record_count].find("5 log records dropped"));
+    EXPECT_NE(std::string::npos, lines.back().find("after"));
+}
@@ -37,8 +37,11 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <thread>
@@ -46,6 +49,9 @@
 #include <type_traits>
 #include <utility>
 #include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
 #include "tools/async_observer.hpp"
 #include "tools/sync_queue.hpp"
@@ -1176,3 +1182,536 @@ TEST_F(AsyncObserverTest, DifferentSubjectsConcurrentEventsWithTimeout)
     observer_thread2.join();
     publisher_thread.join();
 }
+
+/**
+ * @brief Verifies publish_shared hands the same envelope to every envelope observer without copying the payload.
+ */
+TEST_F(AsyncObserverTest, EnvelopeObserversShareSinglePublishedEnvelope)
+{
+    auto observer1 = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+    auto observer2 = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+
+    subject1->subscribe("topic_1", observer1);
+    subject1->subscribe("topic_1", observer2);
+
+    subject1->publish_shared("topic_1", "shared_event");
+
+    auto events1 = observer1->pop_all_events();
+    auto events2 = observer2->pop_all_events();
+    ASSERT_EQ(events1.size(), 1U);
+    ASSERT_EQ(events2.size(), 1U);
+
+    EXPECT_EQ(events1[0].get(), events2[0].get());
+    EXPECT_EQ(events1[0]->topic, "topic_1");
+    EXPECT_EQ(events1[0]->event, "shared_event");
+    EXPECT_EQ(events1[0]->origin, "TestSubject1");
+    EXPECT_FALSE(observer1->has_events());
+}
+
+/**
+ * @brief Verifies plain publish still reaches envelope observers and publish_shared still reaches tuple observers.
+ */
+TEST_F(AsyncObserverTest, EnvelopeAndTupleObserversInteroperate)
+{
+    auto envelope_observer
+        = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+    auto tuple_observer = std::make_shared<tools::async_observer<std::string, std::string, tools::sync_queue>>();
+    int handler_calls = 0;
+
+    subject1->subscribe("topic_1", envelope_observer);
+    subject1->subscribe("topic_1", tuple_observer);
+    subject1->subscribe("topic_1", "counter",
+        [&](const std::string&, const std::string&, const std::string& origin)
+        {
+            EXPECT_EQ(origin, "TestSubject1");
+            ++handler_calls;
+        });
+
+    subject1->publish("topic_1", "plain_event");
+    subject1->publish_shared("topic_1", "shared_event");
+
+    ASSERT_EQ(envelope_observer->number_of_events(), 2U);
+    auto first = envelope_observer->pop_first_event();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ((*first)->event, "plain_event");
+    EXPECT_EQ((*first)->origin, "TestSubject1");
+
+    auto tuple_events = tuple_observer->pop_all_events();
+    ASSERT_EQ(tuple_events.size(), 2U);
+    EXPECT_EQ(std::get<1>(tuple_events[0]), "plain_event");
+    EXPECT_EQ(std::get<1>(tuple_events[1]), "shared_event");
+    EXPECT_EQ(std::get<2>(tuple_events[1]), "TestSubject1");
+
+    EXPECT_EQ(handler_calls, 2);
+}
+
+/**
+ * @brief Verifies stamped envelopes record the enqueue and dequeue latencies of each subscriber separately.
+ */
+TEST_F(AsyncObserverTest, EnvelopeObserversRecordDeliveryLatency)
+{
+    auto drained = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+    auto pending = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+
+    subject1->subscribe("topic_1", drained);
+    subject1->subscribe("topic_1", pending);
+    subject1->set_latency_stamping(true);
+
+    subject1->publish_shared("topic_1", "first");
+    subject1->publish_shared("topic_1", "second");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    const auto events = drained->pop_all_events();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_NE(events[0]->published, 0U);
+
+    const auto drained_stats = drained->latency_stats();
+    EXPECT_EQ(drained_stats.enqueued.count, 2U);
+    EXPECT_EQ(drained_stats.delivered.count, 2U);
+    EXPECT_GE(drained_stats.delivered.min, 1000000U);
+    EXPECT_LT(drained_stats.enqueued.max, drained_stats.delivered.min);
+
+    const auto pending_stats = pending->latency_stats();
+    EXPECT_EQ(pending_stats.enqueued.count, 2U);
+    EXPECT_EQ(pending_stats.delivered.count, 0U);
+
+    std::array<tools::shared_event_envelope<std::string, std::string>, 4U> storage {};
+    ASSERT_EQ(pending->pop_events_into(storage.begin(), storage.end()), 2U);
+    EXPECT_EQ(pending->latency_stats().delivered.count, 2U);
+
+    pending->reset_latency_stats();
+    EXPECT_EQ(pending->latency_stats().enqueued.count, 0U);
+}
+
+/**
+ * @brief Verifies envelopes are not stamped by default and that unstamped envelopes are not recorded.
+ */
+TEST_F(AsyncObserverTest, UnstampedEnvelopesRecordNoLatency)
+{
+    auto observer = std::make_shared<tools::async_envelope_observer<std::string, std::string, tools::sync_queue>>();
+    subject1->subscribe("topic_1", observer);
+
+    subject1->publish_shared("topic_1", "shared_event");
+    subject1->publish("topic_1", "plain_event");
+
+    const auto events = observer->pop_all_events();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_EQ(events[0]->published, 0U);
+    EXPECT_EQ(events[1]->published, 0U);
+    EXPECT_EQ(observer->latency_stats().enqueued.count, 0U);
+    EXPECT_EQ(observer->latency_stats().delivered.count, 0U);
+
+    EXPECT_NE(tools::latency_clock::now(), 0U);
+    EXPECT_EQ(tools::latency_clock::elapsed_ns(0xFFFFFFF0U, 0x10U), 0x20U);
+}
+
+/**
+ * @brief Verifies an empty envelope observer reports no event.
+ */
+TEST(AsyncEnvelopeObserverTest, EmptyQueueReturnsNoEvent)
+{
+    tools::async_envelope_observer<std::string, std::string, tools::sync_ring_vector> observer(4U);
+
+    EXPECT_FALSE(observer.has_events());
+    EXPECT_FALSE(observer.pop_first_event().has_value());
+    EXPECT_TRUE(observer.pop_all_events().empty());
+}
+
+/**
+ * @brief Verifies pop_events_into drains in FIFO order into caller storage, bounded by its capacity.
+ */
+TEST(AsyncObserverBatchDrainTest, PopEventsIntoIteratorRangeIsBoundedByDestination)
+{
+    tools::async_observer<std::string, std::string, tools::sync_queue> observer;
+    observer.inform("topic_1", "event1", "origin");
+    observer.inform("topic_2", "event2", "origin");
+    observer.inform("topic_3", "event3", "origin");
+
+    std::array<async_event, 2U> storage {};
+    const auto first_batch = observer.pop_events_into(storage.begin(), storage.end());
+    ASSERT_EQ(first_batch, 2U);
+    EXPECT_EQ(std::get<1>(storage[0]), "event1");
+    EXPECT_EQ(std::get<1>(storage[1]), "event2");
+    EXPECT_EQ(observer.number_of_events(), 1U);
+
+    const auto second_batch = observer.pop_events_into(storage.begin(), storage.end());
+    ASSERT_EQ(second_batch, 1U);
+    EXPECT_EQ(std::get<1>(storage[0]), "event3");
+
+    EXPECT_EQ(observer.pop_events_into(storage.begin(), storage.end()), 0U);
+}
+
+/**
+ * @brief Verifies the reusable-vector drain appends at most max_events and keeps the vector capacity.
+ */
+TEST(AsyncObserverBatchDrainTest, PopEventsIntoReusableVector)
+{
+    tools::async_observer<std::string, std::string, tools::sync_ring_vector> observer(8U);
+    for (int index = 0; index < 5; ++index)
+    {
+        observer.inform("topic", "event" + std::to_string(index), "origin");
+    }
+
+    std::vector<async_event> events;
+    events.reserve(4U);
+    const auto* const storage_ptr = events.data();
+
+    ASSERT_EQ(observer.pop_events_into(events, 4U), 4U);
+    ASSERT_EQ(events.size(), 4U);
+    EXPECT_EQ(std::get<1>(events[0]), "event0");
+    EXPECT_EQ(std::get<1>(events[3]), "event3");
+    EXPECT_EQ(events.data(), storage_ptr);
+
+    events.clear();
+    ASSERT_EQ(observer.pop_events_into(events, 4U), 1U);
+    ASSERT_EQ(events.size(), 1U);
+    EXPECT_EQ(std::get<1>(events[0]), "event4");
+    EXPECT_EQ(events.data(), storage_ptr);
+    EXPECT_FALSE(observer.has_events());
+}
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+/**
+ * @brief Verifies span-based batch drain for both tuple and envelope observers.
+ */
+TEST(AsyncObserverBatchDrainTest, PopEventsIntoSpan)
+{
+    tools::async_observer<std::string, std::string, tools::sync_queue> observer;
+    tools::async_envelope_observer<std::string, std::string, tools::sync_queue> envelope_observer;
+    observer.inform("topic", "event", "origin");
+    envelope_observer.inform("topic", "event", "origin");
+
+    std::array<async_event, 4U> storage {};
+    EXPECT_EQ(observer.pop_events_into(std::span<async_event>(storage)), 1U);
+    EXPECT_EQ(std::get<1>(storage[0]), "event");
+
+    using envelope_ptr = tools::shared_event_envelope<std::string, std::string>;
+    std::array<envelope_ptr, 4U> envelopes {};
+    EXPECT_EQ(envelope_observer.pop_events_into(std::span<envelope_ptr>(envelopes)), 1U);
+    ASSERT_NE(envelopes[0], nullptr);
+    EXPECT_EQ(envelopes[0]->event, "event");
+}
+#endif
+
+/**
+ * @brief Verifies the conflating observer keeps only the latest event of each topic, in dirty order.
+ */
+TEST(AsyncConflatingObserverTest, KeepsLatestEventPerTopic)
+{
+    tools::async_conflating_observer<std::string, std::string> observer;
+    observer.inform("temperature", "20", "sensor");
+    observer.inform("pressure", "1013", "sensor");
+    observer.inform("temperature", "21", "sensor");
+    observer.inform("temperature", "22", "sensor");
+
+    EXPECT_EQ(observer.number_of_events(), 2U);
+    EXPECT_EQ(observer.number_of_topics(), 2U);
+    EXPECT_EQ(observer.conflated_count(), 2U);
+
+    const auto events = observer.pop_all_events();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_EQ(std::get<0>(events[0]), "temperature");
+    EXPECT_EQ(std::get<1>(events[0]), "22");
+    EXPECT_EQ(std::get<0>(events[1]), "pressure");
+    EXPECT_EQ(std::get<1>(events[1]), "1013");
+    EXPECT_FALSE(observer.has_events());
+
+    observer.inform("pressure", "1012", "sensor");
+    const auto first = observer.pop_first_event();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(std::get<1>(*first), "1012");
+    EXPECT_EQ(observer.number_of_topics(), 2U);
+    EXPECT_FALSE(observer.pop_first_event().has_value());
+}
+
+/**
+ * @brief Verifies bounded drains leave the remaining dirty topics pending in order.
+ */
+TEST(AsyncConflatingObserverTest, PopEventsIntoIsBoundedByDestination)
+{
+    tools::async_conflating_observer<int, std::string> observer(4U);
+    for (int topic = 0; topic < 4; ++topic)
+    {
+        observer.inform(topic, "first", "origin");
+    }
+
+    std::array<std::tuple<int, std::string, std::string>, 3U> storage {};
+    ASSERT_EQ(observer.pop_events_into(storage.begin(), storage.end()), 3U);
+    EXPECT_EQ(std::get<0>(storage[2]), 2);
+
+    observer.inform(0, "second", "origin");
+    std::vector<std::tuple<int, std::string, std::string>> events;
+    ASSERT_EQ(observer.pop_events_into(events, 8U), 2U);
+    EXPECT_EQ(std::get<0>(events[0]), 3);
+    EXPECT_EQ(std::get<1>(events[0]), "first");
+    EXPECT_EQ(std::get<0>(events[1]), 0);
+    EXPECT_EQ(std::get<1>(events[1]), "second");
+}
+
+/**
+ * @brief Verifies a slow consumer of a fast publisher sees a queue bounded by the number of topics.
+ */
+TEST(AsyncConflatingObserverTest, FastPublisherIsBoundedByTopics)
+{
+    auto subject = std::make_unique<tools::sync_subject<std::string, int>>("Publisher");
+    auto observer = std::make_shared<tools::async_conflating_observer<std::string, int>>();
+    subject->subscribe("a", observer);
+    subject->subscribe("b", observer);
+
+    constexpr int publish_count = 1000;
+    std::thread publisher(
+        [&subject]()
+        {
+            for (int i = 1; i <= publish_count; ++i)
+            {
+                subject->publish("a", i);
+                subject->publish("b", -i);
+            }
+        });
+
+    int last_a = 0;
+    int last_b = 0;
+    while ((last_a != publish_count) || (last_b != -publish_count))
+    {
+        observer->wait_for_events(std::chrono::duration<std::uint64_t, std::micro>(1000U));
+        EXPECT_LE(observer->number_of_events(), 2U);
+        for (const auto& [topic, value, origin] : observer->pop_all_events())
+        {
+            EXPECT_EQ(origin, "Publisher");
+            int& last = (topic == "a") ? last_a : last_b;
+            EXPECT_GT(std::abs(value), std::abs(last));
+            last = value;
+        }
+    }
+
+    publisher.join();
+    EXPECT_EQ(observer->number_of_topics(), 2U);
+}
+
+/**
+ * @brief Verifies the drop oldest policy keeps the most recent events and counts the overwritten ones.
+ */
+TEST(AsyncBoundedObserverTest, DropOldestKeepsMostRecentEvents)
+{
+    tools::async_bounded_observer<std::string, int> observer(3U);
+    for (int i = 0; i < 5; ++i)
+    {
+        observer.inform("topic", i, "origin");
+    }
+
+    EXPECT_EQ(observer.number_of_events(), 3U);
+    EXPECT_EQ(observer.dropped_count(), 2U);
+
+    const auto events = observer.pop_all_events();
+    ASSERT_EQ(events.size(), 3U);
+    EXPECT_EQ(std::get<1>(events[0]), 2);
+    EXPECT_EQ(std::get<1>(events[2]), 4);
+
+    const auto counters = observer.backlog();
+    EXPECT_EQ(counters.pending, 0U);
+    EXPECT_EQ(counters.peak_pending, 3U);
+    EXPECT_EQ(counters.capacity, 3U);
+    EXPECT_EQ(counters.dropped, 2U);
+}
+
+/**
+ * @brief Verifies the drop newest policy keeps the first events queued.
+ */
+TEST(AsyncBoundedObserverTest, DropNewestKeepsFirstEvents)
+{
+    tools::async_bounded_observer<std::string, int> observer(2U, tools::observer_overflow_policy::drop_newest);
+    for (int i = 0; i < 4; ++i)
+    {
+        observer.inform("topic", i, "origin");
+    }
+
+    std::vector<std::tuple<std::string, int, std::string>> events;
+    ASSERT_EQ(observer.pop_events_into(events, 8U), 2U);
+    EXPECT_EQ(std::get<1>(events[0]), 0);
+    EXPECT_EQ(std::get<1>(events[1]), 1);
+    EXPECT_EQ(observer.dropped_count(), 2U);
+}
+
+/**
+ * @brief Verifies the conflate policy replaces the pending event of the same topic, else drops the oldest.
+ */
+TEST(AsyncBoundedObserverTest, ConflateReplacesPendingEventOfSameTopic)
+{
+    tools::async_bounded_observer<std::string, int> observer(2U, tools::observer_overflow_policy::conflate);
+    observer.inform("a", 1, "origin");
+    observer.inform("b", 1, "origin");
+    observer.inform("b", 2, "origin");
+    observer.inform("c", 1, "origin");
+
+    EXPECT_EQ(observer.dropped_count(), 2U);
+    const auto first = observer.pop_first_event();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(std::get<0>(*first), "b");
+    EXPECT_EQ(std::get<1>(*first), 2);
+    const auto second = observer.pop_first_event();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(std::get<0>(*second), "c");
+    EXPECT_FALSE(observer.has_events());
+}
+
+/**
+ * @brief Verifies the block policy suspends the publisher until the consumer makes room, or times out.
+ */
+TEST(AsyncBoundedObserverTest, BlockWaitsForRoomThenTimesOut)
+{
+    tools::async_bounded_observer<std::string, int> observer(
+        1U, tools::observer_overflow_policy::block, std::chrono::duration<std::uint64_t, std::micro>(5000000U));
+    observer.inform("topic", 1, "origin");
+
+    std::atomic<bool> published { false };
+    std::thread publisher(
+        [&]()
+        {
+            observer.inform("topic", 2, "origin");
+            published = true;
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    const auto first = observer.pop_first_event();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(std::get<1>(*first), 1);
+    publisher.join();
+    EXPECT_TRUE(published);
+    EXPECT_EQ(observer.dropped_count(), 0U);
+
+    tools::async_bounded_observer<std::string, int> impatient(
+        1U, tools::observer_overflow_policy::block, std::chrono::duration<std::uint64_t, std::micro>(1000U));
+    impatient.inform("topic", 1, "origin");
+    impatient.inform("topic", 2, "origin");
+    EXPECT_EQ(impatient.dropped_count(), 1U);
+    const auto events = impatient.pop_all_events();
+    ASSERT_EQ(events.size(), 1U);
+    EXPECT_EQ(std::get<1>(events[0]), 1);
+}
+
+/**
+ * @brief Verifies a subject skips and reports observers whose backlog reached the configured lag.
+ */
+TEST(AsyncBoundedObserverTest, SubjectSkipsAndReportsSlowSubscribers)
+{
+    tools::sync_subject<std::string, int> subject("Publisher");
+    auto slow = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+    auto bounded = std::make_shared<tools::async_bounded_observer<std::string, int>>(2U);
+    subject.subscribe("topic", slow);
+    subject.subscribe("topic", bounded);
+
+    subject.set_max_subscriber_lag(3U);
+    for (int i = 0; i < 5; ++i)
+    {
+        subject.publish("topic", i);
+    }
+
+    EXPECT_EQ(slow->number_of_events(), 3U);
+    EXPECT_EQ(bounded->number_of_events(), 2U);
+    EXPECT_EQ(subject.skipped_informs(), 2U);
+
+    const auto reported = subject.slow_subscribers(3U);
+    ASSERT_EQ(reported.size(), 2U);
+    for (const auto& entry : reported)
+    {
+        EXPECT_EQ(entry.topic, "topic");
+        if (entry.observer == slow)
+        {
+            EXPECT_EQ(entry.backlog.pending, 3U);
+            EXPECT_EQ(entry.backlog.dropped, 0U);
+        }
+        else
+        {
+            EXPECT_EQ(entry.observer, bounded);
+            EXPECT_EQ(entry.backlog.capacity, 2U);
+            EXPECT_EQ(entry.backlog.dropped, 3U);
+        }
+    }
+
+    static_cast<void>(slow->pop_all_events());
+    subject.set_max_subscriber_lag(0U);
+    subject.publish("topic", 5);
+    EXPECT_EQ(slow->number_of_events(), 1U);
+    EXPECT_EQ(subject.skipped_informs(), 2U);
+}
+
+/**
+ * @brief Verifies publish_range hands the batch to queueing observers in order, for every dispatch policy.
+ */
+TEST(AsyncObserverBatchPublishTest, PublishRangeQueuesWholeBatch)
+{
+    for (const auto policy :
+        { tools::subject_dispatch_policy::copy_on_publish, tools::subject_dispatch_policy::snapshot,
+            tools::subject_dispatch_policy::epoch })
+    {
+        tools::sync_subject<std::string, int> subject("Ingest", policy);
+        auto queue_observer = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+        auto ring_observer = std::make_shared<tools::async_observer<std::string, int, tools::sync_ring_vector>>(4U);
+        auto latest_observer = std::make_shared<tools::async_conflating_observer<std::string, int>>();
+        auto bounded_observer = std::make_shared<tools::async_bounded_observer<std::string, int>>(3U);
+        subject.subscribe("burst", queue_observer);
+        subject.subscribe("burst", ring_observer);
+        subject.subscribe("burst", latest_observer);
+        subject.subscribe("burst", bounded_observer);
+
+        int handled_sum = 0;
+        subject.subscribe("burst", "sum", [&handled_sum](const std::string& /*topic*/, const int& event,
+                                              const std::string& /*origin*/) { handled_sum += event; });
+
+        const std::vector<int> batch { 1, 2, 3, 4, 5 };
+        subject.publish_range("burst", batch.data(), batch.size());
+        subject.publish_range("other", batch.data(), batch.size());
+
+        const auto queued = queue_observer->pop_all_events();
+        ASSERT_EQ(queued.size(), 5U);
+        for (std::size_t i = 0U; i < queued.size(); ++i)
+        {
+            EXPECT_EQ(std::get<0>(queued[i]), "burst");
+            EXPECT_EQ(std::get<1>(queued[i]), batch[i]);
+            EXPECT_EQ(std::get<2>(queued[i]), "Ingest");
+        }
+
+        EXPECT_EQ(ring_observer->number_of_events(), 4U);
+
+        const auto latest = latest_observer->pop_all_events();
+        ASSERT_EQ(latest.size(), 1U);
+        EXPECT_EQ(std::get<1>(latest[0]), 5);
+        EXPECT_EQ(latest_observer->conflated_count(), 4U);
+
+        const auto bounded = bounded_observer->pop_all_events();
+        ASSERT_EQ(bounded.size(), 3U);
+        EXPECT_EQ(std::get<1>(bounded[0]), 3);
+        EXPECT_EQ(bounded_observer->dropped_count(), 2U);
+
+        EXPECT_EQ(handled_sum, 15);
+    }
+}
+
+/**
+ * @brief Verifies publish_range applies subscription filters per event and lag skipping per batch.
+ */
+TEST(AsyncObserverBatchPublishTest, PublishRangeHonoursFiltersAndLag)
+{
+    tools::sync_subject<std::string, int> subject("Ingest");
+    auto even_observer = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+    auto slow_observer = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+    subject.subscribe(
+        "burst", even_observer, [](const std::string& /*topic*/, const int& event) { return 0 == (event % 2); });
+    subject.subscribe("burst", slow_observer);
+    subject.set_max_subscriber_lag(4U);
+
+    const std::array<int, 6U> batch { 1, 2, 3, 4, 5, 6 };
+    subject.publish_range("burst", batch.data(), batch.size());
+    subject.publish_range("burst", batch.data(), batch.size());
+
+    EXPECT_EQ(even_observer->number_of_events(), 6U);
+    EXPECT_EQ(subject.filtered_informs(), 6U);
+    EXPECT_EQ(slow_observer->number_of_events(), 6U);
+    EXPECT_EQ(subject.skipped_informs(), 6U);
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    static_cast<void>(slow_observer->pop_all_events());
+    subject.publish_range("burst", std::span<const int>(batch));
+    EXPECT_EQ(slow_observer->number_of_events(), 6U);
+#endif
+}
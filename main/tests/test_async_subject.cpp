@@ -0,0 +1,192 @@
+/**
+ * @file test_async_subject.cpp
+ * @brief Unit tests for the async_subject delivery pool using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/async_subject.hpp"
+#include "tools/sync_object.hpp"
+
+namespace
+{
+    using int_subject = tools::async_subject<std::string, int>;
+
+    class recording_observer : public tools::sync_observer<std::string, int>
+    {
+    public:
+        void inform(const std::string& topic, const int& event, const std::string& origin) override
+        {
+            (void)origin;
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            m_events[topic].push_back(event);
+            m_threads.push_back(std::this_thread::get_id());
+        }
+
+        std::map<std::string, std::vector<int>> events()
+        {
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            return m_events;
+        }
+
+        std::vector<std::thread::id> threads()
+        {
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            return m_threads;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::map<std::string, std::vector<int>> m_events;
+        std::vector<std::thread::id> m_threads;
+    };
+
+    bool wait_delivered(int_subject& subject, std::size_t expected)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while ((subject.delivered_publishes() < expected) && (std::chrono::steady_clock::now() < deadline))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return subject.delivered_publishes() >= expected;
+    }
+}
+
+// Events are delivered off the publisher's thread, in publication order within each topic.
+TEST(AsyncSubjectTest, DeliversOnDeliveryTasksInTopicOrder)
+{
+    int_subject subject("sampler", 512U, 4096U, std::vector<tools::worker_pool_params>(2U));
+    auto observer = std::make_shared<recording_observer>();
+    const std::vector<std::string> topics = { "adc0", "adc1", "adc2" };
+    for (const auto& topic : topics)
+    {
+        subject.subscribe(topic, observer);
+    }
+    EXPECT_EQ(2U, subject.number_of_delivery_tasks());
+    EXPECT_EQ(subject.lane_of("adc1"), subject.lane_of(std::string("adc1")));
+
+    constexpr int nb_events = 100;
+    for (int i = 0; i < nb_events; ++i)
+    {
+        for (const auto& topic : topics)
+        {
+            subject.publish(topic, i);
+        }
+    }
+
+    ASSERT_TRUE(wait_delivered(subject, topics.size() * nb_events));
+    EXPECT_EQ(0U, subject.dropped_publishes());
+    EXPECT_EQ(0U, subject.pending_publishes());
+
+    auto events = observer->events();
+    for (const auto& topic : topics)
+    {
+        const auto& received = events[topic];
+        ASSERT_EQ(static_cast<std::size_t>(nb_events), received.size());
+        for (int i = 0; i < nb_events; ++i)
+        {
+            EXPECT_EQ(i, received[static_cast<std::size_t>(i)]);
+        }
+    }
+
+    for (const auto& thread_id : observer->threads())
+    {
+        EXPECT_NE(std::this_thread::get_id(), thread_id);
+    }
+}
+
+// A blocked handler only fills its lane: the publisher keeps returning and overflowing events are dropped.
+TEST(AsyncSubjectTest, SlowHandlerDoesNotStallThePublisher)
+{
+    int_subject subject("sampler", 4U, 4096U, std::vector<tools::worker_pool_params>(1U));
+    tools::sync_object entered;
+    tools::sync_object release;
+    std::vector<int> handled;
+
+    subject.subscribe("slow", "blocking",
+        [&](const std::string& topic, const int& event, const std::string& origin)
+        {
+            (void)topic;
+            (void)origin;
+            if (handled.empty())
+            {
+                entered.signal();
+                release.wait_for_signal();
+            }
+            handled.push_back(event);
+        });
+
+    EXPECT_TRUE(subject.try_publish("slow", 0));
+    entered.wait_for_signal();
+
+    std::size_t queued = 0U;
+    for (int i = 1; i <= 6; ++i)
+    {
+        queued += subject.try_publish("slow", i) ? 1U : 0U;
+    }
+    EXPECT_EQ(4U, queued);
+    EXPECT_EQ(2U, subject.dropped_publishes());
+    EXPECT_EQ(4U, subject.pending_publishes());
+
+    release.signal();
+    ASSERT_TRUE(wait_delivered(subject, 5U));
+    EXPECT_EQ((std::vector<int> { 0, 1, 2, 3, 4 }), handled);
+}
+
+// Unsubscribed observers stop receiving, and destroying the subject with queued events does not deliver them.
+TEST(AsyncSubjectTest, UnsubscribeAndShutdown)
+{
+    auto observer = std::make_shared<recording_observer>();
+    {
+        int_subject subject("sampler", 8U, 4096U, {});
+        EXPECT_EQ(1U, subject.number_of_delivery_tasks());
+        subject.subscribe("t", observer);
+        subject.publish("t", 1);
+        ASSERT_TRUE(wait_delivered(subject, 1U));
+
+        subject.unsubscribe("t", observer);
+        subject.publish("t", 2);
+        ASSERT_TRUE(wait_delivered(subject, 2U));
+        subject.publish("t", 3);
+    }
+
+    EXPECT_EQ(std::vector<int> { 1 }, observer->events()["t"]);
+}
@@ -0,0 +1,312 @@
+/**
+ * @file test_broadcast_pipe.cpp
+ * @brief Unit tests for the single-writer, multi-reader broadcast pipe.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "tools/broadcast_pipe.hpp"
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::milli> no_wait(0U);
+    constexpr std::chrono::duration<std::uint64_t, std::milli> long_timeout(2000U);
+
+    std::vector<std::uint8_t> make_bytes(std::size_t size, std::size_t first)
+    {
+        std::vector<std::uint8_t> bytes(size);
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            bytes[i] = static_cast<std::uint8_t>(first + i);
+        }
+        return bytes;
+    }
+} // namespace
+
+/**
+ * @brief Test case for readers sharing the same bytes.
+ *
+ * @test
+ * - Attach three readers and send 40 bytes.
+ * - Verify every reader peeks the 40 bytes at the same address of the shared ring.
+ * - Verify a reader attached afterwards starts at the write position.
+ */
+TEST(BroadcastPipeTest, ReadersShareTheSameBytes)
+{
+    tools::broadcast_pipe<4U> pipe(64U, tools::broadcast_policy::block_writer);
+    auto first = pipe.attach();
+    auto second = pipe.attach();
+    auto third = pipe.attach();
+    ASSERT_TRUE(first.has_value() && second.has_value() && third.has_value());
+
+    const auto bytes = make_bytes(40U, 0U);
+    ASSERT_EQ(bytes.size(), pipe.send(bytes.data(), bytes.size(), no_wait));
+
+    const auto regions = first->peek();
+    ASSERT_EQ(40U, regions.size());
+    EXPECT_EQ(regions.first, second->peek().first);
+    EXPECT_EQ(regions.first, third->peek().first);
+    EXPECT_EQ(0, std::memcmp(bytes.data(), regions.first, regions.first_size));
+    EXPECT_TRUE(first->consume(40U));
+    EXPECT_TRUE(second->consume(40U));
+    EXPECT_TRUE(third->consume(40U));
+
+    auto late = pipe.attach();
+    ASSERT_TRUE(late.has_value());
+    EXPECT_EQ(0U, late->peek().size());
+}
+
+/**
+ * @brief Test case for the block_writer policy.
+ *
+ * @test
+ * - Fill a 16 byte ring read by two readers.
+ * - Verify the writer cannot write until the slowest reader consumes, then only what it freed.
+ * - Verify detaching the slowest reader releases the writer.
+ */
+TEST(BroadcastPipeTest, BlockWriterWaitsForTheSlowestReader)
+{
+    tools::broadcast_pipe<2U> pipe(16U, tools::broadcast_policy::block_writer);
+    auto fast = pipe.attach();
+    auto slow = pipe.attach();
+    ASSERT_TRUE(fast.has_value() && slow.has_value());
+
+    const auto bytes = make_bytes(16U, 0U);
+    ASSERT_EQ(16U, pipe.send(bytes.data(), bytes.size(), no_wait));
+    EXPECT_EQ(0U, pipe.send(bytes.data(), 1U, no_wait));
+
+    static_cast<void>(fast->peek());
+    ASSERT_TRUE(fast->consume(16U));
+    EXPECT_EQ(0U, pipe.send(bytes.data(), 1U, no_wait));
+
+    static_cast<void>(slow->peek());
+    ASSERT_TRUE(slow->consume(4U));
+    EXPECT_EQ(4U, pipe.send(bytes.data(), 8U, no_wait));
+
+    slow.reset();
+    EXPECT_EQ(8U, pipe.send(bytes.data(), 8U, no_wait));
+    EXPECT_EQ(12U, fast->peek().size());
+}
+
+/**
+ * @brief Test case for the drop_laggards policy.
+ *
+ * @test
+ * - Send 40 bytes through a 16 byte ring while one reader keeps up and the other does not.
+ * - Verify the laggard resumes at the oldest byte kept and counts the 24 bytes it missed.
+ * - Verify a reader lapped between peek() and consume() has its consume() refused.
+ */
+TEST(BroadcastPipeTest, DropLaggardsKeepsTheWriterRunning)
+{
+    tools::broadcast_pipe<2U> pipe(16U, tools::broadcast_policy::drop_laggards);
+    auto fast = pipe.attach();
+    auto slow = pipe.attach();
+    ASSERT_TRUE(fast.has_value() && slow.has_value());
+
+    std::vector<std::uint8_t> received(8U);
+    for (std::size_t chunk = 0U; chunk < 5U; ++chunk)
+    {
+        const auto bytes = make_bytes(8U, chunk * 8U);
+        ASSERT_EQ(8U, pipe.send(bytes.data(), bytes.size(), no_wait));
+        ASSERT_EQ(8U, fast->receive(received.data(), received.size(), no_wait));
+        EXPECT_EQ(bytes, received);
+    }
+    EXPECT_EQ(0U, fast->dropped_bytes());
+
+    auto regions = slow->peek();
+    ASSERT_EQ(16U, regions.size());
+    EXPECT_EQ(24U, slow->dropped_bytes());
+    EXPECT_EQ(24U, regions.first[0]);
+
+    const auto more = make_bytes(8U, 40U);
+    ASSERT_EQ(8U, pipe.send(more.data(), more.size(), no_wait));
+    EXPECT_FALSE(slow->consume(16U));
+    EXPECT_EQ(32U, slow->dropped_bytes());
+
+    regions = slow->peek();
+    ASSERT_EQ(16U, regions.size());
+    EXPECT_EQ(32U, (regions.first_size > 0U) ? regions.first[0] : regions.second[0]);
+    EXPECT_TRUE(slow->consume(16U));
+}
+
+/**
+ * @brief Test case for the reader slots.
+ *
+ * @test
+ * - Verify attach() fails when all slots are taken and succeeds again once a reader is destroyed.
+ */
+TEST(BroadcastPipeTest, ReaderSlotsAreReused)
+{
+    tools::broadcast_pipe<1U> pipe(8U, tools::broadcast_policy::block_writer);
+    {
+        auto only = pipe.attach();
+        ASSERT_TRUE(only.has_value());
+        EXPECT_FALSE(pipe.attach().has_value());
+    }
+    EXPECT_TRUE(pipe.attach().has_value());
+}
+
+/**
+ * @brief Test case for one writer and three reader threads.
+ *
+ * @test
+ * - Broadcast 100000 bytes through a 256 byte ring under block_writer.
+ * - Verify each reader thread receives every byte in order.
+ */
+TEST(BroadcastPipeTest, ReaderThreadsReceiveEveryByte)
+{
+    constexpr std::size_t total = 100000U;
+    tools::broadcast_pipe<3U> pipe(256U, tools::broadcast_policy::block_writer);
+    std::array<std::size_t, 3> matching = {};
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0U; index < matching.size(); ++index)
+    {
+        auto handle = pipe.attach();
+        ASSERT_TRUE(handle.has_value());
+        threads.emplace_back(
+            [&matching, index, reader = std::move(*handle)]() mutable
+            {
+                std::array<std::uint8_t, 97> chunk = {};
+                std::size_t position = 0U;
+                while (position < total)
+                {
+                    const std::size_t received
+                        = reader.receive(chunk.data(), std::min(chunk.size(), total - position), long_timeout);
+                    if (0U == received)
+                    {
+                        break;
+                    }
+                    for (std::size_t i = 0U; i < received; ++i)
+                    {
+                        matching[index] += (chunk[i] == static_cast<std::uint8_t>(position + i)) ? 1U : 0U;
+                    }
+                    position += received;
+                }
+            });
+    }
+
+    const auto bytes = make_bytes(total, 0U);
+    std::size_t sent = 0U;
+    while (sent < total)
+    {
+        const std::size_t count = std::min<std::size_t>(61U, total - sent);
+        ASSERT_EQ(count, pipe.send(bytes.data() + sent, count, long_timeout));
+        sent += count;
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const std::size_t count : matching)
+    {
+        EXPECT_EQ(total, count);
+    }
+}
+
+/**
+ * @brief Test case for readers attaching while a writer is blocked on a full ring.
+ *
+ * @test
+ * - Keep a block_writer busy sending 160 byte chunks of a counting stream through a 64 byte ring.
+ * - Attach and detach readers from three threads, 5000 times each, reading a few bytes each time.
+ * - Verify every reader receives consecutive bytes: its cursor never lags behind the ring.
+ */
+TEST(BroadcastPipeTest, AttachRacesABlockedWriter)
+{
+    tools::broadcast_pipe<3U> pipe(64U, tools::broadcast_policy::block_writer);
+    std::atomic<bool> running { true };
+    std::thread writer(
+        [&pipe, &running]()
+        {
+            constexpr std::chrono::duration<std::uint64_t, std::milli> short_timeout(1U);
+            std::array<std::uint8_t, 160> chunk = {};
+            std::size_t position = 0U;
+            while (running.load())
+            {
+                for (std::size_t i = 0U; i < chunk.size(); ++i)
+                {
+                    chunk[i] = static_cast<std::uint8_t>(position + i);
+                }
+                position += pipe.send(chunk.data(), chunk.size(), short_timeout);
+            }
+        });
+
+    std::atomic<std::size_t> broken { 0U };
+    std::atomic<std::size_t> attached { 0U };
+    std::vector<std::thread> readers;
+    for (std::size_t index = 0U; index < 3U; ++index)
+    {
+        readers.emplace_back(
+            [&pipe, &broken, &attached]()
+            {
+                for (std::size_t attempt = 0U; attempt < 5000U; ++attempt)
+                {
+                    auto reader = pipe.attach();
+                    if (!reader.has_value())
+                    {
+                        continue;
+                    }
+                    attached.fetch_add(1U);
+                    std::array<std::uint8_t, 40> received = {};
+                    const std::size_t count = reader->receive(received.data(), received.size(), long_timeout);
+                    for (std::size_t i = 1U; i < count; ++i)
+                    {
+                        if (received[i] != static_cast<std::uint8_t>(received[i - 1U] + 1U))
+                        {
+                            broken.fetch_add(1U);
+                        }
+                    }
+                }
+            });
+    }
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    running.store(false);
+    writer.join();
+    EXPECT_EQ(15000U, attached.load());
+    EXPECT_EQ(0U, broken.load());
+}
@@ -41,7 +41,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -466,4 +471,237 @@ TEST_F(SerializationTest, CompanyDeserializationError)
     ASSERT_FALSE(deserialized_company.deserialize(*stream));
 }
 
+/**
+ * @brief Checks the bulk byte swap kernel against a byte-by-byte reversal for one element size.
+ */
+template <std::size_t ElementSize>
+void check_copy_byteswapped()
+{
+    for (std::size_t count = 0U; count < 40U; ++count)
+    {
+        std::vector<std::uint8_t> source(count * ElementSize);
+        for (std::size_t i = 0U; i < source.size(); ++i)
+        {
+            source[i] = static_cast<std::uint8_t>((i * 37U) + 11U);
+        }
+
+        std::vector<std::uint8_t> expected(source.size());
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            const auto first = source.begin() + static_cast<std::ptrdiff_t>(i * ElementSize);
+            const auto target = expected.begin() + static_cast<std::ptrdiff_t>(i * ElementSize);
+            std::reverse_copy(first, first + ElementSize, target);
+        }
+
+        std::vector<std::uint8_t> swapped(source.size());
+        bytepack::detail::copy_byteswapped<ElementSize>(swapped.data(), source.data(), count);
+        ASSERT_EQ(expected, swapped) << "element size " << ElementSize << ", count " << count;
+    }
+}
+
+/**
+ * @brief Test case for the bulk byte swap kernel used by the array and vector overloads.
+ *
+ * @test
+ * - Swap 0 to 39 elements of 2, 4, 8 and 16 bytes, covering the vector blocks and the word-wise tails.
+ * - Verify the result matches a byte-by-byte reversal of each element.
+ */
+TEST(BytepackBulkSwapTest, CopyByteswappedMatchesReversal)
+{
+    check_copy_byteswapped<2U>();
+    check_copy_byteswapped<4U>();
+    check_copy_byteswapped<8U>();
+    check_copy_byteswapped<16U>();
+}
+
+/**
+ * @brief Test case for big endian arrays and vectors of multibyte elements.
+ *
+ * @test
+ * - Serialize an int16 vector, a float std::array, a double C array and a fixed size uint64 vector in big endian.
+ * - Verify the wire bytes of the first elements are in network order.
+ * - Deserialize them back and verify the values.
+ */
+TEST(BytepackBulkSwapTest, BigEndianArraysRoundTrip)
+{
+    std::vector<std::int16_t> samples(4096U);
+    for (std::size_t i = 0U; i < samples.size(); ++i)
+    {
+        samples[i] = static_cast<std::int16_t>((static_cast<int>(i) * 7) - 12000);
+    }
+    std::array<float, 37> gains = {};
+    for (std::size_t i = 0U; i < gains.size(); ++i)
+    {
+        gains[i] = static_cast<float>(i) * 0.25F;
+    }
+    const double offsets[5] = { 1.0, -2.5, 3.25, 1e-3, 42.0 }; // NOLINT C array overload on purpose
+    const std::vector<std::uint64_t> stamps = { 0x0102030405060708ULL, 2U, 3U };
+
+    bytepack::binary_stream<std::endian::big> stream(16384U);
+    ASSERT_TRUE(stream.write(samples));
+    ASSERT_TRUE(stream.write(gains));
+    ASSERT_TRUE(stream.write(offsets));
+    ASSERT_TRUE(stream.write<3U>(stamps));
+
+    const auto* bytes = stream.data().as<std::uint8_t>();
+    // uint32 size prefix, then samples[0] = -12000 = 0xd120
+    EXPECT_EQ(0xd1U, bytes[4]);
+    EXPECT_EQ(0x20U, bytes[5]);
+    const std::size_t stamps_offset = 4U + (samples.size() * 2U) + (gains.size() * 4U) + (5U * 8U);
+    EXPECT_EQ(0x01U, bytes[stamps_offset]);
+    EXPECT_EQ(0x08U, bytes[stamps_offset + 7U]);
+
+    std::vector<std::int16_t> samples_back;
+    std::array<float, 37> gains_back = {};
+    double offsets_back[5] = {}; // NOLINT C array overload on purpose
+    std::vector<std::uint64_t> stamps_back;
+    ASSERT_TRUE(stream.read(samples_back));
+    ASSERT_TRUE(stream.read(gains_back));
+    ASSERT_TRUE(stream.read(offsets_back));
+    ASSERT_TRUE(stream.read<3U>(stamps_back));
+
+    EXPECT_EQ(samples, samples_back);
+    EXPECT_EQ(gains, gains_back);
+    for (std::size_t i = 0U; i < 5U; ++i)
+    {
+        EXPECT_EQ(offsets[i], offsets_back[i]); // NOLINT C array
+    }
+    EXPECT_EQ(stamps, stamps_back);
+}
+
+/**
+ * @brief Test case for a varint stream.
+ *
+ * @test
+ * - Write unsigned and signed integers, a vector and a string into a stream with IntegerMode::Varint.
+ * - Verify the LEB128 and zigzag wire bytes and the one byte length prefixes.
+ * - Read everything back and verify the values.
+ */
+TEST(BytepackVarintTest, VarintStreamRoundTrip)
+{
+    bytepack::binary_stream<std::endian::big, bytepack::IntegerMode::Varint> stream(64U);
+    const std::vector<std::uint16_t> counters = { 1U, 2U };
+    ASSERT_TRUE(stream.write(std::uint32_t { 5U }, std::int32_t { -3 }, std::uint64_t { 300U }));
+    ASSERT_TRUE(stream.write(std::numeric_limits<std::int64_t>::min()));
+    ASSERT_TRUE(stream.write(counters));
+    ASSERT_TRUE(stream.write(std::string("abc")));
+    ASSERT_TRUE(stream.write(std::uint8_t { 200U }));
+
+    const std::vector<std::uint8_t> expected = { 0x05U, 0x05U, 0xacU, 0x02U, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU,
+        0xffU, 0xffU, 0xffU, 0x01U, 0x02U, 0x00U, 0x01U, 0x00U, 0x02U, 0x03U, 'a', 'b', 'c', 200U };
+    const auto* bytes = stream.data().as<std::uint8_t>();
+    ASSERT_EQ(expected.size(), stream.data().size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), bytes));
+
+    std::uint32_t small = 0U;
+    std::int32_t negative = 0;
+    std::uint64_t medium = 0U;
+    std::int64_t lowest = 0;
+    std::vector<std::uint16_t> counters_back;
+    std::string text;
+    std::uint8_t byte = 0U;
+    ASSERT_TRUE(stream.read(small, negative, medium, lowest));
+    ASSERT_TRUE(stream.read(counters_back));
+    ASSERT_TRUE(stream.read(text));
+    ASSERT_TRUE(stream.read(byte));
+    EXPECT_EQ(5U, small);
+    EXPECT_EQ(-3, negative);
+    EXPECT_EQ(300U, medium);
+    EXPECT_EQ(std::numeric_limits<std::int64_t>::min(), lowest);
+    EXPECT_EQ(counters, counters_back);
+    EXPECT_EQ("abc", text);
+    EXPECT_EQ(200U, byte);
+}
+
+/**
+ * @brief Test case for selecting the integer encoding per field.
+ *
+ * @test
+ * - Write a varint field and a varint length prefix into a fixed stream, and fixed fields into a varint stream.
+ * - Verify the wire sizes and read the fields back with the same selection.
+ */
+TEST(BytepackVarintTest, PerFieldSelection)
+{
+    bytepack::binary_stream<> fixed_stream(64U);
+    ASSERT_TRUE(fixed_stream.write<bytepack::IntegerMode::Varint>(std::int16_t { -64 }));
+    ASSERT_TRUE(fixed_stream.write<bytepack::varint_size>(std::string("xy")));
+    ASSERT_TRUE(fixed_stream.write(std::uint16_t { 1U }));
+    EXPECT_EQ(1U + 1U + 2U + 2U, fixed_stream.data().size());
+
+    std::int16_t value = 0;
+    std::string text;
+    std::uint16_t fixed = 0U;
+    ASSERT_TRUE(fixed_stream.read<bytepack::IntegerMode::Varint>(value));
+    ASSERT_TRUE(fixed_stream.read<bytepack::varint_size>(text));
+    ASSERT_TRUE(fixed_stream.read(fixed));
+    EXPECT_EQ(-64, value);
+    EXPECT_EQ("xy", text);
+    EXPECT_EQ(1U, fixed);
+
+    bytepack::binary_stream<std::endian::little, bytepack::IntegerMode::Varint> varint_stream(64U);
+    const std::vector<std::uint8_t> payload = { 7U, 8U };
+    ASSERT_TRUE(varint_stream.write<bytepack::IntegerMode::Fixed>(std::uint32_t { 1U }));
+    ASSERT_TRUE(varint_stream.write<std::uint16_t>(payload));
+    EXPECT_EQ(4U + 2U + 2U, varint_stream.data().size());
+    EXPECT_EQ(1U, varint_stream.data().as<std::uint8_t>()[0]);
+
+    std::uint32_t word = 0U;
+    std::vector<std::uint8_t> payload_back;
+    ASSERT_TRUE(varint_stream.read<bytepack::IntegerMode::Fixed>(word));
+    ASSERT_TRUE(varint_stream.read<std::uint16_t>(payload_back));
+    EXPECT_EQ(1U, word);
+    EXPECT_EQ(payload, payload_back);
+}
+
+/**
+ * @brief Test case for the varint decoder and its malformed inputs.
+ *
+ * @test
+ * - Encode values of every length, decode them from exact and padded buffers (byte loop and word paths).
+ * - Verify truncated, over-long and out of range varints are refused without consuming the stream.
+ */
+TEST(BytepackVarintTest, DecoderPathsAndMalformedInput)
+{
+    std::vector<std::uint64_t> values = { 0U, 1U, 127U, 128U, 16383U, 16384U, std::numeric_limits<std::uint64_t>::max() };
+    for (unsigned shift = 0U; shift < 64U; ++shift)
+    {
+        values.push_back(1ULL << shift);
+        values.push_back((1ULL << shift) - 1U);
+        values.push_back((1ULL << shift) + 0x5aU);
+    }
+
+    for (const std::uint64_t value : values)
+    {
+        std::array<std::uint8_t, 16> buffer = {};
+        const std::size_t length = bytepack::detail::encode_varint(value, buffer.data());
+        ASSERT_EQ(bytepack::detail::varint_length(value), length);
+
+        std::uint64_t exact = 0U;
+        std::uint64_t padded = 0U;
+        EXPECT_EQ(length, bytepack::detail::decode_varint(buffer.data(), length, exact));
+        EXPECT_EQ(length, bytepack::detail::decode_varint(buffer.data(), buffer.size(), padded));
+        EXPECT_EQ(value, exact);
+        EXPECT_EQ(value, padded);
+        if (length > 1U)
+        {
+            EXPECT_EQ(0U, bytepack::detail::decode_varint(buffer.data(), length - 1U, exact));
+        }
+    }
+
+    std::uint64_t bits = 0U;
+    std::array<std::uint8_t, 11> over_long = {};
+    over_long.fill(0x80U);
+    EXPECT_EQ(0U, bytepack::detail::decode_varint(over_long.data(), over_long.size(), bits));
+    std::array<std::uint8_t, 10> too_wide = { 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0x02U };
+    EXPECT_EQ(0U, bytepack::detail::decode_varint(too_wide.data(), too_wide.size(), bits));
+
+    std::array<std::uint8_t, 3> wide = { 0xf0U, 0xa2U, 0x04U }; // 70000 does not fit 16 bits
+    bytepack::binary_stream<std::endian::big, bytepack::IntegerMode::Varint> stream { bytepack::buffer_view(wide) };
+    std::uint16_t narrow = 0U;
+    std::uint32_t enough = 0U;
+    EXPECT_FALSE(stream.read(narrow));
+    ASSERT_TRUE(stream.read(enough));
+    EXPECT_EQ(70000U, enough);
+}
+
 #endif // #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -42,10 +42,20 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "cJSON/cJSON.h"
+#include "cJSON/cJSON_number.h"
 #include "cjsonpp/cjsonpp.hpp"
 
 
@@ -565,3 +575,112 @@ TEST_F(JSONObjectTest, SetInvalidTypeInArray)
     ASSERT_FALSE(add_status.has_value());
     EXPECT_EQ(add_status.error().code, cjsonpp::result_code::invalid_type);
 }
+
+namespace
+{
+    /** @brief The "%1.15g" then "%1.17g" rendering cJSON used before its fast path. */
+    std::string reference_number_text(double value)
+    {
+        std::array<char, 32> text {};
+        double test = 0.0;
+        std::snprintf(text.data(), text.size(), "%1.15g", value);
+        if ((std::sscanf(text.data(), "%lg", &test) != 1)
+            || (std::fabs(test - value) > (std::max(std::fabs(test), std::fabs(value)) * DBL_EPSILON)))
+        {
+            std::snprintf(text.data(), text.size(), "%1.17g", value);
+        }
+        return text.data();
+    }
+
+    std::vector<double> sample_numbers()
+    {
+        std::vector<double> numbers { 0.1, 0.5, 123.456, -273.15, 1.0 / 3.0, 2.0 / 3.0, 1e-5, 9.999999999999999e22,
+            1e21, 3.0e-7, 6.02214076e23, 0.30000000000000004, 4503599627370497.5, -1.5e-8 };
+        std::mt19937_64 generator { 20261015U };
+        for (int i = 0; i < 20000; ++i)
+        {
+            std::uint64_t bits = generator();
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (std::isfinite(value))
+            {
+                numbers.push_back(value);
+            }
+            numbers.push_back(static_cast<double>(static_cast<std::int64_t>(generator() % 2000000U) - 1000000)
+                / std::pow(10.0, static_cast<double>(generator() % 8U)));
+            numbers.push_back(std::ldexp(static_cast<double>(generator() >> 11U), static_cast<int>(generator() % 120U) - 100));
+        }
+        return numbers;
+    }
+} // namespace
+
+/**
+ * @brief Test case for the fast number rendering of the cJSON output path.
+ *
+ * Every double printed without the C library must match the former sprintf()/sscanf() rendering, and the
+ * serialized item must keep that text.
+ */
+TEST_F(JSONObjectTest, FastNumberPrintMatchesPrintf)
+{
+    std::array<unsigned char, CJSON_NUMBER_BUFFER_SIZE> buffer {};
+    std::size_t fast_count = 0U;
+    for (const double value : sample_numbers())
+    {
+        const int length = cJSON_fast_print_number(value, buffer.data());
+        if (length >= 0)
+        {
+            ++fast_count;
+            const std::string text(reinterpret_cast<const char*>(buffer.data()), static_cast<std::size_t>(length));
+            ASSERT_EQ(text, reference_number_text(value)) << "value " << value;
+        }
+    }
+    EXPECT_GT(fast_count, 30000U);
+
+    for (const int value : { 0, 7, -42, 2147483647, -2147483647 - 1 })
+    {
+        const int length = cJSON_fast_print_int(value, buffer.data());
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(buffer.data()), static_cast<std::size_t>(length)),
+            std::to_string(value));
+    }
+
+    EXPECT_EQ(cjsonpp::JSONObject(123.456).print(), "123.456");
+    EXPECT_EQ(cjsonpp::JSONObject(0.1 + 0.2).print(), "0.3");
+    EXPECT_EQ(cjsonpp::JSONObject(1.0 / 3.0).print(), "0.33333333333333331");
+    EXPECT_EQ(cjsonpp::JSONObject(-1.5e-8).print(), "-1.5e-08");
+}
+
+/**
+ * @brief Test case for the fast number parsing of the cJSON input path.
+ *
+ * Whatever the fast parser accepts must be read to the same value and length as strtod(); the rest falls back.
+ */
+TEST_F(JSONObjectTest, FastNumberParseMatchesStrtod)
+{
+    std::vector<std::string> texts { "0", "-0", "12.5e3x", "1e", "1E+", "-.5", "1.5e30", "0e999", "1E-22",
+        "9007199254740993", "4.9e-324", "123456789012345678901", "0.000001" };
+    for (const double value : sample_numbers())
+    {
+        texts.push_back(reference_number_text(value));
+    }
+
+    std::size_t fast_count = 0U;
+    for (const auto& text : texts)
+    {
+        double value = 0.0;
+        const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+        const std::size_t consumed = cJSON_fast_parse_number(data, text.size(), &value);
+        if (consumed != 0U)
+        {
+            ++fast_count;
+            char* end = nullptr;
+            const double expected = std::strtod(text.c_str(), &end);
+            ASSERT_EQ(consumed, static_cast<std::size_t>(end - text.c_str())) << text;
+            ASSERT_EQ(0, std::memcmp(&value, &expected, sizeof(value))) << text;
+        }
+    }
+    EXPECT_GT(fast_count, 20000U);
+
+    const auto parse_res = cjsonpp::parse_result("[-0.25, 1e3, 6.02214076e23]");
+    ASSERT_TRUE(parse_res.has_value());
+    EXPECT_EQ(parse_res.value().print(false), "[-0.25,1000,6.02214076e+23]");
+}
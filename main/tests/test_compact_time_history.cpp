@@ -0,0 +1,145 @@
+/**
+ * @file test_compact_time_history.cpp
+ * @brief Unit tests for the delta-compressed timestamp history using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "tools/compact_time_history.hpp"
+#include "tools/sorted_time_list.hpp"
+
+namespace
+{
+    using timestamp_type = std::chrono::steady_clock::time_point;
+}
+
+/** @brief Entries decode to the pushed timestamps and values, across blocks; older pushes are rejected. */
+TEST(CompactTimeHistoryTest, RoundTripsAcrossBlocks)
+{
+    tools::compact_time_history<long, int, 8U> history;
+
+    EXPECT_TRUE(history.empty());
+    EXPECT_FALSE(history.top().has_value());
+    EXPECT_FALSE(history.latest().has_value());
+
+    std::vector<std::pair<long, int>> expected;
+    std::mt19937 generator(3U); // NOLINT fixed seed
+    std::uniform_int_distribution<long> step(0L, 100000L);
+    long timestamp_value = -5000L;
+
+    for (int index = 0; index < 100; ++index)
+    {
+        timestamp_value += step(generator);
+        ASSERT_TRUE(history.push(timestamp_value, index));
+        expected.emplace_back(timestamp_value, index);
+    }
+
+    EXPECT_FALSE(history.push(timestamp_value - 1L, -1));
+    EXPECT_EQ(history.size(), 100U);
+    EXPECT_EQ(history.block_count(), 13U);
+    EXPECT_EQ(history.top()->first, expected.front().first);
+    EXPECT_EQ(*history.latest(), expected.back().first);
+    EXPECT_EQ(history.snapshot_sorted(), expected);
+
+    history.clear();
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(history.block_count(), 0U);
+}
+
+/** @brief visit_range() returns the [from, until) window; pop_until() trims whole blocks and the straddling one. */
+TEST(CompactTimeHistoryTest, VisitRangeAndPopUntil)
+{
+    tools::compact_time_history<unsigned, int, 4U> history;
+
+    for (unsigned timestamp_value = 0U; timestamp_value < 40U; timestamp_value += 2U)
+    {
+        history.push(timestamp_value, static_cast<int>(timestamp_value));
+    }
+
+    std::vector<unsigned> window;
+    EXPECT_EQ(history.visit_range(7U, 15U, [&window](unsigned entry_timestamp, const int&)
+                  { window.push_back(entry_timestamp); }),
+        4U);
+    EXPECT_EQ(window, (std::vector<unsigned> { 8U, 10U, 12U, 14U }));
+    EXPECT_EQ(history.visit_range(100U, 200U, [](unsigned, const int&) {}), 0U);
+
+    EXPECT_EQ(history.pop_until(10U), 6U);
+    EXPECT_EQ(history.size(), 14U);
+    EXPECT_EQ(history.top()->first, 12U);
+    EXPECT_EQ(history.top()->second, 12);
+
+    std::vector<unsigned> rest;
+    history.for_each([&rest](unsigned entry_timestamp, const int&) { rest.push_back(entry_timestamp); });
+    ASSERT_EQ(rest.size(), 14U);
+    EXPECT_EQ(rest.front(), 12U);
+    EXPECT_EQ(rest.back(), 38U);
+    EXPECT_TRUE(history.push(38U, 38));
+}
+
+/** @brief A jittered periodic chrono history matches sorted_time_list in at least four times less memory. */
+TEST(CompactTimeHistoryTest, MatchesSortedTimeListInLessMemory)
+{
+    tools::compact_time_history<timestamp_type, std::int16_t> history;
+    tools::sorted_time_list<timestamp_type, std::int16_t> reference;
+
+    const auto origin = std::chrono::steady_clock::now();
+    std::mt19937 generator(5U); // NOLINT fixed seed
+    std::uniform_int_distribution<int> jitter(-20, 20);
+    constexpr int sample_count = 20000;
+
+    for (int index = 0; index < sample_count; ++index)
+    {
+        const auto timestamp_value
+            = origin + std::chrono::milliseconds(index) + std::chrono::nanoseconds(jitter(generator));
+        history.push(timestamp_value, static_cast<std::int16_t>(index));
+        reference.push(timestamp_value, static_cast<std::int16_t>(index));
+    }
+
+    const auto from = origin + std::chrono::milliseconds(5000);
+    const auto until = origin + std::chrono::milliseconds(5100);
+    std::vector<std::pair<timestamp_type, std::int16_t>> compact_window;
+    std::vector<std::pair<timestamp_type, std::int16_t>> reference_window;
+    history.visit_range(from, until, [&compact_window](const timestamp_type& entry_timestamp, std::int16_t value)
+        { compact_window.emplace_back(entry_timestamp, value); });
+    reference.visit_range(from, until, [&reference_window](const auto& entry) { reference_window.push_back(entry); });
+    EXPECT_EQ(compact_window, reference_window);
+    EXPECT_EQ(history.snapshot_sorted(), reference.snapshot_sorted());
+
+    const std::size_t plain_bytes = sample_count * sizeof(std::pair<timestamp_type, std::int16_t>);
+    EXPECT_LE(history.memory_footprint() * 4U, plain_bytes);
+}
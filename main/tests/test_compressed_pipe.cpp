@@ -0,0 +1,150 @@
+/**
+ * @file test_compressed_pipe.cpp
+ * @brief Unit tests for the compressed_pipe stage using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/compressed_pipe.hpp"
+#include "tools/memory_pipe.hpp"
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::milli> short_timeout(20U);
+    constexpr std::chrono::duration<std::uint64_t, std::milli> long_timeout(2000U);
+
+    std::vector<std::uint8_t> make_frame(std::size_t index)
+    {
+        const std::string text
+            = "{\"sensor\":\"temperature\",\"index\":" + std::to_string(index) + ",\"value\":21.5}\n";
+        return std::vector<std::uint8_t>(text.begin(), text.end());
+    }
+}
+
+/**
+ * @brief Test that small frames batched by a producer thread are received intact and compressed.
+ */
+TEST(CompressedPipeTest, BatchedFramesRoundTrip)
+{
+    tools::memory_pipe pipe(2048U);
+    tools::compressed_pipe stage(pipe, 1024U);
+
+    std::vector<std::uint8_t> expected;
+    for (std::size_t i = 0U; i < 300U; ++i)
+    {
+        const auto frame = make_frame(i);
+        expected.insert(expected.end(), frame.begin(), frame.end());
+    }
+
+    std::thread producer(
+        [&stage]()
+        {
+            for (std::size_t i = 0U; i < 300U; ++i)
+            {
+                const auto frame = make_frame(i);
+                ASSERT_EQ(frame.size(), stage.send(frame, long_timeout));
+            }
+            ASSERT_TRUE(stage.flush(long_timeout));
+        });
+
+    std::vector<std::uint8_t> received;
+    std::array<std::uint8_t, 333U> chunk = {};
+    while (received.size() < expected.size())
+    {
+        const std::size_t wanted = std::min(chunk.size(), expected.size() - received.size());
+        const std::size_t size = stage.receive(chunk.data(), wanted, long_timeout);
+        ASSERT_GT(size, 0U);
+        received.insert(received.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(size));
+    }
+    producer.join();
+
+    ASSERT_EQ(expected, received);
+
+    // the trailer of the last frame is verified by the next read
+    EXPECT_EQ(0U, stage.receive(chunk.data(), chunk.size(), short_timeout));
+
+    const auto stats = stage.stats();
+    EXPECT_EQ(expected.size(), stats.raw_bytes_sent);
+    EXPECT_LT(stats.packed_bytes_sent, stats.raw_bytes_sent / 2U);
+    EXPECT_EQ(stats.frames_sent, stats.frames_received);
+    EXPECT_EQ(0U, stats.corrupted_frames);
+}
+
+/**
+ * @brief Test that bytes of a partial batch only reach the consumer after flush().
+ */
+TEST(CompressedPipeTest, PartialBatchNeedsFlush)
+{
+    tools::memory_pipe pipe(4096U);
+    tools::compressed_pipe stage(pipe);
+
+    const auto frame = make_frame(7U);
+    ASSERT_EQ(frame.size(), stage.send(frame, short_timeout));
+
+    std::vector<std::uint8_t> received;
+    EXPECT_EQ(0U, stage.receive(received, frame.size(), short_timeout));
+
+    ASSERT_TRUE(stage.flush(short_timeout));
+    EXPECT_EQ(frame.size(), stage.receive(received, frame.size(), short_timeout));
+    EXPECT_EQ(frame, received);
+}
+
+/**
+ * @brief Test that a corrupted frame is dropped and the next frame is still decoded.
+ */
+TEST(CompressedPipeTest, CorruptedFrameIsSkipped)
+{
+    tools::memory_pipe pipe(4096U);
+    tools::compressed_pipe stage(pipe, 256U);
+
+    // a well framed gzip member with a broken body
+    const std::array<std::uint8_t, 16U> garbage = { 12U, 0U, 0U, 0U, 0x1fU, 0x8bU, 0x08U, 0U, 0U, 0U, 0U, 0U,
+        0U, 0x03U, 0xffU, 0xffU };
+    ASSERT_EQ(garbage.size(), pipe.send(garbage.data(), garbage.size(), short_timeout));
+
+    const auto frame = make_frame(42U);
+    ASSERT_EQ(frame.size(), stage.send(frame, short_timeout));
+    ASSERT_TRUE(stage.flush(short_timeout));
+
+    std::vector<std::uint8_t> received;
+    EXPECT_EQ(frame.size(), stage.receive(received, frame.size(), short_timeout));
+    EXPECT_EQ(frame, received);
+    EXPECT_EQ(1U, stage.stats().corrupted_frames);
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test_concurrent_hdr_histogram.cpp
+ * @brief Unit tests for the lock-free multi-writer concurrent_hdr_histogram using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tools/concurrent_hdr_histogram.hpp"
+
+/**
+ * @brief Test that recorders claim distinct lanes, share once exhausted and free their lane when destroyed.
+ */
+TEST(ConcurrentHdrHistogramTest, RecordersClaimAndReleaseLanes)
+{
+    tools::concurrent_hdr_histogram<4U, 16U, 2U> histogram;
+
+    auto first = histogram.make_recorder();
+    auto second = histogram.make_recorder();
+    auto third = histogram.make_recorder();
+    EXPECT_TRUE(first.exclusive());
+    EXPECT_TRUE(second.exclusive());
+    EXPECT_FALSE(third.exclusive());
+    EXPECT_TRUE(static_cast<bool>(third));
+
+    {
+        auto moved = std::move(first);
+        EXPECT_FALSE(static_cast<bool>(first)); // NOLINT use after move is the point
+        EXPECT_TRUE(moved.exclusive());
+    }
+
+    auto fourth = histogram.make_recorder();
+    EXPECT_TRUE(fourth.exclusive());
+}
+
+/**
+ * @brief Test that an interval collection merges every lane, then starts an empty interval.
+ */
+TEST(ConcurrentHdrHistogramTest, CollectIntervalMergesAndResets)
+{
+    tools::concurrent_hdr_histogram<> histogram;
+    tools::concurrent_hdr_histogram<>::histogram_type interval;
+
+    auto lhs = histogram.make_recorder();
+    auto rhs = histogram.make_recorder();
+
+    for (std::uint64_t value = 1U; value <= 100U; ++value)
+    {
+        ((value & 1U) ? lhs : rhs).add(value);
+    }
+
+    histogram.snapshot(interval);
+    EXPECT_EQ(100U, interval.total_count());
+
+    histogram.collect_interval(interval);
+    EXPECT_EQ(100U, interval.total_count());
+    EXPECT_EQ(1U, interval.min());
+    EXPECT_EQ(100U, interval.max());
+    EXPECT_DOUBLE_EQ(50.5, interval.average());
+    EXPECT_EQ(50U, interval.percentile(0.5));
+    EXPECT_EQ(99U, interval.percentile(0.99));
+
+    histogram.collect_interval(interval);
+    EXPECT_EQ(0U, interval.total_count());
+    EXPECT_EQ(0U, interval.percentile(0.99));
+
+    rhs.add(7U);
+    histogram.collect_interval(interval);
+    EXPECT_EQ(1U, interval.total_count());
+    EXPECT_EQ(7U, interval.min());
+    EXPECT_EQ(7U, interval.max());
+}
+
+/**
+ * @brief Test that no sample is lost nor counted twice while intervals are collected under concurrent writers.
+ */
+TEST(ConcurrentHdrHistogramTest, ConcurrentWritersAndCollector)
+{
+    constexpr int writer_count = 6; // more writers than lanes: two of them share
+    constexpr std::uint64_t samples_per_writer = 20000U;
+
+    tools::concurrent_hdr_histogram<5U, 32U, 4U> histogram;
+    std::atomic<int> running = writer_count;
+    std::vector<std::thread> writers;
+
+    for (int writer = 0; writer < writer_count; ++writer)
+    {
+        writers.emplace_back(
+            [&histogram, &running, writer]()
+            {
+                auto recorder = histogram.make_recorder();
+
+                for (std::uint64_t i = 0U; i < samples_per_writer; ++i)
+                {
+                    recorder.add((i % 1000U) + static_cast<std::uint64_t>(writer));
+                }
+
+                running.fetch_sub(1);
+            });
+    }
+
+    tools::concurrent_hdr_histogram<5U, 32U, 4U>::histogram_type interval;
+    tools::concurrent_hdr_histogram<5U, 32U, 4U>::histogram_type total;
+
+    while (running.load() > 0)
+    {
+        histogram.collect_interval(interval);
+        total.merge(interval);
+        std::this_thread::yield();
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    histogram.collect_interval(interval);
+    total.merge(interval);
+
+    EXPECT_EQ(samples_per_writer * writer_count, total.total_count());
+    EXPECT_LE(total.max(), 999U + writer_count);
+    EXPECT_LE(total.percentile(0.99), 999U + writer_count);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_core_batching_observer.cpp
+ * @brief Unit tests for the per-core batching observer decorator.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tools/core_batching_observer.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace
+{
+    /**
+     * @brief Target observer recording the batches it is informed of.
+     */
+    class recording_observer : public tools::sync_observer<int, int>
+    {
+    public:
+        void inform(const int& topic, const int& event, const std::string& origin) override
+        {
+            inform_range(topic, &event, 1U, origin);
+        }
+
+        void inform_range(const int& topic, const int* events, std::size_t count, const std::string& origin) override
+        {
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            m_batches.emplace_back(topic, std::vector<int>(events, events + count)); // NOLINT pointer arithmetic
+            m_origin = origin;
+        }
+
+        std::vector<std::pair<int, std::vector<int>>> batches()
+        {
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            return m_batches;
+        }
+
+        std::string origin()
+        {
+            std::scoped_lock<std::mutex> guard(m_mutex);
+            return m_origin;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::vector<std::pair<int, std::vector<int>>> m_batches;
+        std::string m_origin;
+    };
+}
+
+/**
+ * @brief Published events reach the target in full batches, the rest on flush().
+ */
+TEST(CoreBatchingObserverTest, ForwardsFullBatchesThenFlushes)
+{
+    auto target = std::make_shared<recording_observer>();
+    auto batching = std::make_shared<tools::core_batching_observer<int, int>>(target, 4U);
+    tools::sync_subject<int, int> subject("sensors");
+    subject.subscribe(1, batching);
+
+    for (int event = 0; event < 10; ++event)
+    {
+        subject.publish(1, event);
+    }
+    EXPECT_EQ(2U, target->batches().size());
+    EXPECT_EQ(2U, batching->staged());
+    EXPECT_EQ(2U, batching->backlog().pending);
+
+    batching->flush();
+    const auto batches = target->batches();
+    ASSERT_EQ(3U, batches.size());
+    EXPECT_EQ((std::vector<int> { 0, 1, 2, 3 }), batches[0].second);
+    EXPECT_EQ((std::vector<int> { 4, 5, 6, 7 }), batches[1].second);
+    EXPECT_EQ((std::vector<int> { 8, 9 }), batches[2].second);
+    EXPECT_EQ("sensors", target->origin());
+    EXPECT_EQ(3U, batching->batches());
+    EXPECT_EQ(0U, batching->staged());
+}
+
+/**
+ * @brief A topic change forwards the staged events first, and ranges are forwarded after them.
+ */
+TEST(CoreBatchingObserverTest, KeepsTopicsAndRangesInOrder)
+{
+    auto target = std::make_shared<recording_observer>();
+    tools::core_batching_observer<int, int> batching(target, 8U);
+
+    batching.inform(1, 10, "a");
+    batching.inform(1, 11, "a");
+    batching.inform(2, 20, "a");
+    const std::vector<int> range = { 30, 31 };
+    batching.inform_range(3, range.data(), range.size(), "a");
+
+    const auto batches = target->batches();
+    ASSERT_EQ(3U, batches.size());
+    EXPECT_EQ(1, batches[0].first);
+    EXPECT_EQ((std::vector<int> { 10, 11 }), batches[0].second);
+    EXPECT_EQ(2, batches[1].first);
+    EXPECT_EQ((std::vector<int> { 20 }), batches[1].second);
+    EXPECT_EQ(3, batches[2].first);
+    EXPECT_EQ(range, batches[2].second);
+}
+
+/**
+ * @brief Concurrent publishers lose nothing and each sees its own events delivered in order.
+ */
+TEST(CoreBatchingObserverTest, ConcurrentPublishersKeepTheirOrder)
+{
+    constexpr int publishers = 4;
+    constexpr int events_per_publisher = 2000;
+    auto target = std::make_shared<recording_observer>();
+    auto batching = std::make_shared<tools::core_batching_observer<int, int>>(target, 16U);
+
+    std::vector<std::thread> threads;
+    for (int publisher = 0; publisher < publishers; ++publisher)
+    {
+        threads.emplace_back(
+            [&batching, publisher]()
+            {
+                for (int index = 0; index < events_per_publisher; ++index)
+                {
+                    batching->inform(0, (publisher * events_per_publisher) + index, "load");
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    batching.reset(); // destruction flushes
+
+    std::vector<int> next(publishers, 0);
+    std::size_t total = 0U;
+    for (const auto& batch : target->batches())
+    {
+        for (const int event : batch.second)
+        {
+            const int publisher = event / events_per_publisher;
+            EXPECT_EQ(next[publisher], event % events_per_publisher);
+            next[publisher] = (event % events_per_publisher) + 1;
+            ++total;
+        }
+    }
+    EXPECT_EQ(static_cast<std::size_t>(publishers * events_per_publisher), total);
+}
@@ -617,3 +617,25 @@ TEST_F(TimerTest, PassAnArgumentToAnAction)
     EXPECT_EQ(callback_done_future.wait_for(milliseconds(100)), std::future_status::ready);
     EXPECT_EQ(res.load(), 42);
 }
+
+/**
+ * @brief Unit test for moving the next timeout of a timer with reschedule().
+ *
+ * A one-shot timeout is pushed back before it fires and keeps its id; an unknown id is rejected.
+ */
+TEST_F(TimerTest, RescheduleMovesTheTimeout)
+{
+    auto id0 = timer->add(std::chrono::milliseconds(40), [this](CppTime::timer_id) { called.store(true); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(timer->reschedule(
+        id0, CppTime::clock::now() + std::chrono::milliseconds(80), CppTime::duration::zero()));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    ASSERT_FALSE(called.load());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_TRUE(called.load());
+
+    ASSERT_FALSE(timer->reschedule(id0, CppTime::clock::now(), CppTime::duration::zero())); // already expired
+    ASSERT_FALSE(timer->reschedule(id0 + 100U, CppTime::clock::now(), CppTime::duration::zero()));
+}
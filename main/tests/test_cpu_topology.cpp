@@ -0,0 +1,196 @@
+/**
+ * @file test_cpu_topology.cpp
+ * @brief Unit tests for the CPU topology discovery and the placement helpers.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "tools/cpu_topology.hpp"
+#include "tools/platform_helpers.hpp"
+#include "tools/worker_pool.hpp"
+
+#if defined(__linux__)
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#endif
+
+namespace
+{
+    /**
+     * @brief Two NUMA nodes of two cores with two hardware threads, numbered as Linux does (siblings last).
+     */
+    tools::cpu_topology make_two_node_topology()
+    {
+        std::vector<tools::cpu_info> cpus;
+        for (int cpu = 0; cpu < 8; ++cpu)
+        {
+            const int core = cpu % 4;
+            const int node = core / 2;
+            cpus.push_back(tools::cpu_info { cpu, core, 0, node, node * 2 });
+        }
+        return tools::cpu_topology(std::move(cpus));
+    }
+}
+
+/**
+ * @brief Verifies the counts and the SMT siblings of a synthetic topology.
+ */
+TEST(CpuTopologyTest, CountsCoresNodesAndSiblings)
+{
+    const auto topology = make_two_node_topology();
+
+    EXPECT_EQ(topology.logical_count(), 8U);
+    EXPECT_EQ(topology.physical_count(), 4U);
+    EXPECT_EQ(topology.numa_node_count(), 2U);
+    EXPECT_EQ(topology.cache_domain_count(), 2U);
+    EXPECT_TRUE(topology.has_smt());
+    EXPECT_EQ(topology.smt_siblings(1), (std::vector<int> { 5 }));
+    ASSERT_NE(topology.find(6), nullptr);
+    EXPECT_EQ(topology.find(6)->core_id, 2);
+    EXPECT_EQ(topology.find(42), nullptr);
+}
+
+/**
+ * @brief Verifies that spread() fills physical cores across NUMA nodes before SMT siblings, and wraps around.
+ */
+TEST(CpuTopologyTest, SpreadUsesPhysicalCoresAcrossNodesFirst)
+{
+    const auto topology = make_two_node_topology();
+
+    EXPECT_EQ(topology.spread(9), (std::vector<int> { 0, 2, 1, 3, 4, 6, 5, 7, 0 }));
+
+    const auto params = tools::spread_worker_params(3U, 2, topology);
+    ASSERT_EQ(params.size(), 3U);
+    EXPECT_EQ(params[1].cpu_affinity, 2);
+    EXPECT_EQ(params[2].priority, 2);
+}
+
+/**
+ * @brief Verifies that colocated pairs share a cache domain, on distinct physical cores first.
+ */
+TEST(CpuTopologyTest, ColocatedPairsShareACacheDomain)
+{
+    const auto topology = make_two_node_topology();
+
+    for (std::size_t index = 0U; index < 4U; ++index)
+    {
+        const auto pair = topology.colocated_pair(index);
+        EXPECT_EQ(topology.find(pair.producer)->cache_domain, topology.find(pair.consumer)->cache_domain);
+        EXPECT_NE(pair.producer, pair.consumer);
+    }
+    EXPECT_EQ(topology.colocated_pair(0U).producer, 0);
+    EXPECT_EQ(topology.colocated_pair(0U).consumer, 1);
+    EXPECT_EQ(topology.colocated_pair(1U).producer, 2);
+    EXPECT_EQ(topology.colocated_pair(2U).producer, 4);
+    EXPECT_EQ(topology.colocated_pair(4U).producer, 0);
+
+    const tools::cpu_topology single({});
+    EXPECT_EQ(single.logical_count(), 1U);
+    EXPECT_FALSE(single.has_smt());
+    EXPECT_EQ(single.colocated_pair(3U).producer, single.colocated_pair(3U).consumer);
+    EXPECT_EQ(single.spread(2U), (std::vector<int> { 0, 0 }));
+}
+
+/**
+ * @brief Verifies that the detected topology matches the CPU count used to size the platform helpers.
+ */
+TEST(CpuTopologyTest, CurrentTopologyMatchesCpuCount)
+{
+    const auto& topology = tools::cpu_topology::current();
+
+    EXPECT_EQ(topology.logical_count(), static_cast<std::size_t>(tools::cpu_core_count()));
+    EXPECT_EQ(tools::get_nb_of_cpu_cores(), static_cast<int>(tools::cpu_core_count()));
+    EXPECT_GE(topology.logical_count(), topology.physical_count());
+    EXPECT_EQ(topology.spread(topology.logical_count()).size(), topology.logical_count());
+}
+
+#if defined(__linux__)
+/**
+ * @brief Verifies the sysfs parsing on a fake sysfs tree.
+ */
+TEST(CpuTopologyTest, ReadsSysfsTopology)
+{
+    EXPECT_EQ(tools::linux_os::parse_cpu_list("0-3,8,10-11\n"), (std::vector<int> { 0, 1, 2, 3, 8, 10, 11 }));
+    EXPECT_TRUE(tools::linux_os::parse_cpu_list("").empty());
+
+    char root_template[] = "/tmp/cpu_topology_XXXXXX";
+    ASSERT_NE(mkdtemp(root_template), nullptr);
+    const std::string root(root_template);
+
+    auto make_dir = [](const std::string& path) { std::filesystem::create_directories(path); };
+    auto write = [](const std::string& path, const std::string& text) { std::ofstream(path) << text << "\n"; };
+
+    for (int cpu = 0; cpu < 4; ++cpu)
+    {
+        const std::string cpu_dir = root + "/cpu/cpu" + std::to_string(cpu);
+        make_dir(cpu_dir + "/topology");
+        write(cpu_dir + "/topology/core_id", std::to_string(cpu % 2));
+        write(cpu_dir + "/topology/physical_package_id", "0");
+        make_dir(cpu_dir + "/cache/index0");
+        write(cpu_dir + "/cache/index0/level", "1");
+        write(cpu_dir + "/cache/index0/shared_cpu_list", std::to_string(cpu % 2) + "," + std::to_string(cpu % 2 + 2));
+        make_dir(cpu_dir + "/cache/index1");
+        write(cpu_dir + "/cache/index1/level", "3");
+        write(cpu_dir + "/cache/index1/shared_cpu_list", "0-3");
+    }
+    make_dir(root + "/node/node0");
+    write(root + "/node/node0/cpulist", "0-1");
+    make_dir(root + "/node/node1");
+    write(root + "/node/node1/cpulist", "2-3");
+
+    const auto entries
+        = tools::linux_os::read_cpu_topology({ 0, 1, 2, 3, 4 }, root + "/cpu", root + "/node");
+    ASSERT_EQ(entries.size(), 5U);
+    EXPECT_EQ(entries[3].core_id, 1);
+    EXPECT_EQ(entries[3].numa_node, 1);
+    EXPECT_EQ(entries[3].cache_domain, 0);
+    // no sysfs entry: a core of its own
+    EXPECT_EQ(entries[4].core_id, 4);
+    EXPECT_EQ(entries[4].numa_node, 0);
+
+    std::vector<tools::cpu_info> cpus;
+    for (const auto& entry : entries)
+    {
+        cpus.push_back(
+            tools::cpu_info { entry.logical_id, entry.core_id, entry.package_id, entry.numa_node, entry.cache_domain });
+    }
+    const tools::cpu_topology topology(std::move(cpus));
+    EXPECT_EQ(topology.physical_count(), 3U);
+    EXPECT_EQ(topology.smt_siblings(0), (std::vector<int> { 2 }));
+
+    std::filesystem::remove_all(root);
+}
+#endif
@@ -37,11 +37,23 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
+#include "tools/adaptive_critical_section.hpp"
 #include "tools/critical_section.hpp"
+#include "tools/shared_critical_section.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/sync_ring_vector.hpp"
+
+#include "test_helper.hpp"
 
 /**
  * @class CriticalSectionTest
@@ -278,3 +290,302 @@ TEST_F(CriticalSectionTest, DeadlockAvoidance)
     EXPECT_TRUE(cs2.try_lock());
     cs2.unlock();
 }
+
+/**
+ * @brief Test that shared holders coexist while an exclusive holder excludes everybody else.
+ */
+TEST(SharedCriticalSectionTest, ReadersShareWritersExclude)
+{
+    tools::shared_critical_section rw;
+
+    rw.lock_shared();
+    EXPECT_TRUE(rw.try_lock_shared());
+    EXPECT_FALSE(rw.try_lock());
+    rw.unlock_shared();
+    rw.unlock_shared();
+
+    EXPECT_TRUE(rw.try_lock());
+    EXPECT_FALSE(rw.try_lock_shared());
+    rw.unlock();
+
+    std::atomic<int> inside = 0;
+    std::atomic<int> max_inside = 0;
+    std::atomic<bool> overlap_with_writer = false;
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (int n = 0; n < 200; ++n)
+                {
+                    std::shared_lock<tools::shared_critical_section> guard(rw);
+                    const int now = ++inside;
+                    int seen = max_inside.load();
+                    while ((now > seen) && !max_inside.compare_exchange_weak(seen, now))
+                    {
+                    }
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    --inside;
+                }
+            });
+    }
+
+    threads.emplace_back(
+        [&]()
+        {
+            for (int n = 0; n < 200; ++n)
+            {
+                std::scoped_lock<tools::shared_critical_section> guard(rw);
+                if (inside.load() != 0)
+                {
+                    overlap_with_writer = true;
+                }
+                ++counter;
+            }
+        });
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_FALSE(overlap_with_writer.load());
+    EXPECT_EQ(200, counter);
+    EXPECT_GE(max_inside.load(), 1);
+}
+
+/**
+ * @brief Test read_lock_guard picking a shared lock for reader/writer locks and an exclusive one otherwise.
+ */
+TEST(SharedCriticalSectionTest, ReadLockGuard)
+{
+    static_assert(tools::is_shared_lockable<tools::shared_critical_section>::value);
+    static_assert(!tools::is_shared_lockable<tools::critical_section>::value);
+    static_assert(std::is_same_v<std::shared_lock<tools::shared_critical_section>,
+        tools::read_lock_guard<tools::shared_critical_section>>);
+    static_assert(
+        std::is_same_v<std::unique_lock<tools::critical_section>, tools::read_lock_guard<tools::critical_section>>);
+
+    tools::shared_critical_section rw;
+    {
+        tools::read_lock_guard<tools::shared_critical_section> first(rw);
+        tools::read_lock_guard<tools::shared_critical_section> second(rw);
+        EXPECT_FALSE(rw.try_lock());
+    }
+    EXPECT_TRUE(rw.try_lock());
+    rw.unlock();
+
+    tools::critical_section plain;
+    {
+        tools::read_lock_guard<tools::critical_section> guard(plain);
+        EXPECT_TRUE(guard.owns_lock());
+    }
+    EXPECT_TRUE(plain.try_lock());
+    plain.unlock();
+}
+
+/**
+ * @brief Test a shared_sync_ring_vector peeked by several readers while a writer pushes and pops.
+ */
+TEST(SharedCriticalSectionTest, SharedSyncRingVectorPeeks)
+{
+    constexpr int items = 5000;
+
+    tools::shared_sync_ring_vector<int> ring(16U);
+    std::atomic<bool> stop = false;
+    std::atomic<bool> inconsistent = false;
+    std::atomic<int> peeks = 0;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                while (!stop.load())
+                {
+                    // the writer keeps the ring holding a single increasing value at a time
+                    const auto front = ring.front();
+                    const auto back = ring.back();
+                    if (front.has_value() && back.has_value() && (front.value() > back.value()))
+                    {
+                        inconsistent = true;
+                    }
+                    if (ring.size() > 1U)
+                    {
+                        inconsistent = true;
+                    }
+                    peeks.fetch_add(1);
+                }
+            });
+    }
+
+    long long sum = 0;
+    for (int n = 1; n <= items; ++n)
+    {
+        EXPECT_TRUE(ring.push(n));
+        if (auto value = ring.front_pop(); value.has_value())
+        {
+            sum += value.value();
+        }
+        if (0 == (n % 64))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_FALSE(inconsistent.load());
+    EXPECT_EQ(static_cast<long long>(items) * (items + 1) / 2, sum);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(16U, ring.capacity());
+    TEST_COUT << peeks.load() << " concurrent peeks";
+}
+
+namespace
+{
+    /**
+     * @brief Runs threads incrementing a shared counter, each increment a short critical section.
+     *
+     * @return The elapsed time, the counter being checked by the caller through its reference.
+     */
+    template <typename Lock>
+    std::chrono::duration<double, std::milli> contended_increments(
+        Lock& lock, int thread_count, int increments, std::size_t& counter)
+    {
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    for (int n = 0; n < increments; ++n)
+                    {
+                        std::scoped_lock<Lock> guard(lock);
+                        ++counter;
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return std::chrono::steady_clock::now() - start;
+    }
+}
+
+/**
+ * @brief Test the lock interface of the adaptive critical section, with and without spinning.
+ */
+TEST(AdaptiveCriticalSectionTest, LockUnlock)
+{
+    for (const std::uint32_t spin_count : { 0U, tools::adaptive_critical_section::default_spin_count })
+    {
+        tools::adaptive_critical_section lock(spin_count);
+        lock.lock();
+        EXPECT_FALSE(lock.try_lock());
+        lock.unlock();
+        EXPECT_TRUE(lock.try_lock());
+        lock.unlock();
+
+        {
+            tools::isr_lock_guard<tools::adaptive_critical_section> guard(lock); // NOLINT(modernize-use-scoped-lock)
+            EXPECT_FALSE(lock.try_lock());
+        }
+        EXPECT_TRUE(lock.try_lock());
+        lock.unlock();
+    }
+}
+
+/**
+ * @brief Stress mutual exclusion of the adaptive critical section and compare it with critical_section.
+ *
+ * Both locks guard the same tiny critical section under the same contention; the timings are reported, not
+ * asserted, as they depend on the host.
+ */
+TEST(AdaptiveCriticalSectionTest, ContendedIncrements)
+{
+    constexpr int thread_count = 4;
+    constexpr int increments = 50000;
+    constexpr std::size_t expected = static_cast<std::size_t>(thread_count) * increments;
+
+    tools::critical_section plain_lock;
+    std::size_t plain_counter = 0U;
+    const auto plain_time = contended_increments(plain_lock, thread_count, increments, plain_counter);
+    EXPECT_EQ(expected, plain_counter);
+
+    tools::adaptive_critical_section adaptive_lock;
+    std::size_t adaptive_counter = 0U;
+    const auto adaptive_time = contended_increments(adaptive_lock, thread_count, increments, adaptive_counter);
+    EXPECT_EQ(expected, adaptive_counter);
+    EXPECT_TRUE(adaptive_lock.try_lock());
+    adaptive_lock.unlock();
+
+    TEST_COUT << "critical_section: " << plain_time.count() << " ms, adaptive_critical_section: "
+              << adaptive_time.count() << " ms (" << adaptive_lock.spin_acquisitions() << " spun, "
+              << adaptive_lock.blocking_acquisitions() << " blocked)";
+}
+
+/**
+ * @brief Test sync containers selecting the adaptive lock under concurrent producers and a consumer.
+ */
+TEST(AdaptiveCriticalSectionTest, AdaptiveSyncContainers)
+{
+    constexpr int producer_count = 3;
+    constexpr int items = 20000;
+
+    tools::adaptive_sync_queue<int> queue;
+    tools::adaptive_sync_ring_vector<int> ring(64U);
+    std::atomic<int> done = 0;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; ++p)
+    {
+        producers.emplace_back(
+            [&]()
+            {
+                for (int n = 1; n <= items; ++n)
+                {
+                    queue.push(n);
+                    while (!ring.push(n))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                done.fetch_add(1);
+            });
+    }
+
+    long long queue_sum = 0;
+    long long ring_sum = 0;
+    while ((done.load() < producer_count) || !queue.empty() || !ring.empty())
+    {
+        if (auto value = queue.front_pop(); value.has_value())
+        {
+            queue_sum += value.value();
+        }
+        if (auto value = ring.front_pop(); value.has_value())
+        {
+            ring_sum += value.value();
+        }
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    const long long expected = static_cast<long long>(producer_count) * items * (items + 1) / 2;
+    EXPECT_EQ(expected, queue_sum);
+    EXPECT_EQ(expected, ring_sum);
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_cyclic_executive.cpp
+ * @brief Unit tests for the cyclic_executive class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "tools/cyclic_executive.hpp"
+
+namespace
+{
+    using micro = std::chrono::duration<std::uint64_t, std::micro>;
+
+    tools::cyclic_routine counting(const char* name, std::uint64_t period_us, std::atomic<int>& counter)
+    {
+        return tools::cyclic_routine { name, micro(period_us), [&counter]() { ++counter; }, micro(0U) };
+    }
+}
+
+/**
+ * @brief The minor frame is the gcd of the periods, the major frame their lcm, each frame listing its releases.
+ */
+TEST(CyclicExecutiveTest, FrameTableFollowsThePeriods)
+{
+    std::atomic<int> fast { 0 };
+    std::atomic<int> medium { 0 };
+    std::atomic<int> slow { 0 };
+
+    std::vector<tools::cyclic_routine> routines;
+    routines.push_back(counting("fast", 10000U, fast));
+    routines.push_back(counting("medium", 20000U, medium));
+    routines.push_back(counting("slow", 40000U, slow));
+    tools::cyclic_executive executive(std::move(routines), tools::cyclic_executive_params {});
+
+    ASSERT_TRUE(executive.is_valid());
+    EXPECT_EQ(executive.minor_frame(), micro(10000U));
+    EXPECT_EQ(executive.major_frame(), micro(40000U));
+    ASSERT_EQ(executive.frame_count(), 4U);
+    EXPECT_EQ(executive.frame_routines(0U), (std::vector<std::size_t> { 0U, 1U, 2U }));
+    EXPECT_EQ(executive.frame_routines(1U), (std::vector<std::size_t> { 0U }));
+    EXPECT_EQ(executive.frame_routines(2U), (std::vector<std::size_t> { 0U, 1U }));
+    EXPECT_EQ(executive.frame_routines(3U), (std::vector<std::size_t> { 0U }));
+    EXPECT_TRUE(executive.frame_routines(4U).empty());
+}
+
+/**
+ * @brief Zero periods and tables larger than max_frames are rejected and nothing runs.
+ */
+TEST(CyclicExecutiveTest, RejectsInvalidTables)
+{
+    std::atomic<int> counter { 0 };
+
+    std::vector<tools::cyclic_routine> coprime;
+    coprime.push_back(counting("a", 1000U, counter));
+    coprime.push_back(counting("b", 1001U, counter));
+    tools::cyclic_executive_params params;
+    params.max_frames = 100U;
+    tools::cyclic_executive too_large(std::move(coprime), params);
+    EXPECT_FALSE(too_large.is_valid());
+    EXPECT_EQ(too_large.frame_count(), 0U);
+
+    std::vector<tools::cyclic_routine> zero;
+    zero.push_back(counting("zero", 0U, counter));
+    tools::cyclic_executive zero_period(std::move(zero), tools::cyclic_executive_params {});
+    EXPECT_FALSE(zero_period.is_valid());
+
+    tools::cyclic_executive empty(std::vector<tools::cyclic_routine> {}, tools::cyclic_executive_params {});
+    EXPECT_FALSE(empty.is_valid());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(counter.load(), 0);
+}
+
+/**
+ * @brief Routines of different rates run on the one executive task, the faster ones more often.
+ */
+TEST(CyclicExecutiveTest, RunsRoutinesAtTheirRates)
+{
+    std::atomic<int> fast { 0 };
+    std::atomic<int> medium { 0 };
+    std::atomic<int> slow { 0 };
+
+    {
+        std::vector<tools::cyclic_routine> routines;
+        routines.push_back(counting("fast", 2000U, fast));
+        routines.push_back(counting("medium", 4000U, medium));
+        routines.push_back(counting("slow", 8000U, slow));
+        tools::cyclic_executive executive(std::move(routines), tools::cyclic_executive_params {});
+        ASSERT_TRUE(executive.is_valid());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        EXPECT_EQ(executive.routine_stats(0U).calls, static_cast<std::uint64_t>(fast.load()));
+        EXPECT_GE(executive.frame_stats().execution_time.count, 1U);
+    }
+
+    EXPECT_GE(fast.load(), 10);
+    EXPECT_GE(fast.load(), medium.load());
+    EXPECT_GE(medium.load(), slow.load());
+    EXPECT_GE(slow.load(), 1);
+}
+
+/**
+ * @brief A routine exceeding its budget and its frame is counted against the routine and the frame slot.
+ */
+TEST(CyclicExecutiveTest, CountsOverrunsPerSlot)
+{
+    std::atomic<int> fast { 0 };
+
+    std::vector<tools::cyclic_routine> routines;
+    routines.push_back(counting("fast", 2000U, fast));
+    routines.push_back(tools::cyclic_routine { "hog", micro(8000U),
+        []() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }, micro(1000U) });
+    tools::cyclic_executive executive(std::move(routines), tools::cyclic_executive_params {});
+    ASSERT_TRUE(executive.is_valid());
+    ASSERT_EQ(executive.frame_count(), 4U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+    const auto hog = executive.routine_stats(1U);
+    EXPECT_GE(hog.calls, 1U);
+    EXPECT_EQ(hog.budget_overruns, hog.calls);
+    EXPECT_GE(hog.max_execution_us, 5000U);
+    EXPECT_GE(executive.frame_overruns(0U), 1U);
+    EXPECT_GE(executive.frame_stats().overruns, 1U);
+    EXPECT_EQ(executive.routine_stats(0U).budget_overruns, 0U);
+}
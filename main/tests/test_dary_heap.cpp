@@ -0,0 +1,142 @@
+/**
+ * @file test_dary_heap.cpp
+ * @brief Unit tests for the d-ary heap using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tools/dary_heap.hpp"
+
+namespace
+{
+    template <std::size_t Arity>
+    void check_against_priority_queue()
+    {
+        std::mt19937 generator(static_cast<std::uint32_t>(Arity));
+        std::uniform_int_distribution<int> values(-50, 50);
+        std::uniform_int_distribution<int> actions(0, 9);
+
+        tools::dary_heap<int, std::less<int>, Arity> heap;
+        std::priority_queue<int> model;
+        for (int step = 0; step < 4000; ++step)
+        {
+            const int action = actions(generator);
+            if (action < 5)
+            {
+                const int value = values(generator);
+                heap.push(value);
+                model.push(value);
+            }
+            else if (action < 7)
+            {
+                // small batches sift each element, large ones heapify
+                std::vector<int> batch(static_cast<std::size_t>(actions(generator)) * ((action == 6) ? 10U : 1U));
+                for (auto& value : batch)
+                {
+                    value = values(generator);
+                    model.push(value);
+                }
+                heap.push_range(batch.begin(), batch.end());
+            }
+            else if (!model.empty())
+            {
+                ASSERT_EQ(model.top(), heap.top());
+                heap.pop();
+                model.pop();
+            }
+            ASSERT_EQ(model.size(), heap.size());
+        }
+
+        std::vector<int> drained(heap.size());
+        ASSERT_EQ(model.size(), heap.pop_range(drained.begin(), drained.end()));
+        for (const int value : drained)
+        {
+            ASSERT_EQ(model.top(), value);
+            model.pop();
+        }
+        EXPECT_TRUE(heap.empty());
+    }
+}
+
+/**
+ * @brief Verifies push/push_range/pop/pop_range match std::priority_queue for several arities.
+ */
+TEST(DaryHeapTest, MatchesPriorityQueue)
+{
+    check_against_priority_queue<2U>();
+    check_against_priority_queue<3U>();
+    check_against_priority_queue<4U>();
+    check_against_priority_queue<8U>();
+}
+
+/**
+ * @brief Verifies the min-heap order with std::greater and a batch larger than the destination.
+ */
+TEST(DaryHeapTest, GreaterComparatorAndPartialPopRange)
+{
+    tools::dary_heap<int, std::greater<int>> heap;
+    const std::array<int, 6> values = { 5, 1, 4, 2, 6, 3 };
+    heap.push_range(values.begin(), values.end());
+    EXPECT_EQ(1, heap.top());
+
+    std::array<int, 4> batch = {};
+    EXPECT_EQ(4U, heap.pop_range(batch.begin(), batch.end()));
+    EXPECT_EQ((std::array<int, 4> { 1, 2, 3, 4 }), batch);
+    EXPECT_EQ(2U, heap.size());
+    EXPECT_EQ(5, heap.pop_move());
+}
+
+/**
+ * @brief Verifies move-only elements and in-place construction.
+ */
+TEST(DaryHeapTest, MoveOnlyElements)
+{
+    const auto by_value = [](const std::unique_ptr<std::string>& lhs, const std::unique_ptr<std::string>& rhs)
+    { return *lhs < *rhs; };
+    tools::dary_heap<std::unique_ptr<std::string>, decltype(by_value)> heap(by_value);
+    heap.push(std::make_unique<std::string>("banana"));
+    heap.emplace(std::make_unique<std::string>("cherry"));
+    heap.push(std::make_unique<std::string>("apple"));
+
+    EXPECT_EQ("cherry", *heap.pop_move());
+    EXPECT_EQ("banana", *heap.pop_move());
+    EXPECT_EQ("apple", *heap.top());
+}
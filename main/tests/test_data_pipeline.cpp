@@ -0,0 +1,224 @@
+/**
+ * @file test_data_pipeline.cpp
+ * @brief Unit tests for the data_task pipeline builder using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/data_pipeline.hpp"
+
+namespace
+{
+    struct raw_frame
+    {
+        std::uint32_t id;
+        std::int32_t raw_value;
+    };
+
+    struct sample
+    {
+        std::uint32_t id;
+        double value;
+    };
+
+    struct collector
+    {
+        void add(const sample& item)
+        {
+            const std::lock_guard<std::mutex> guard(mutex);
+            ids.push_back(item.id);
+            threads.push_back(std::this_thread::get_id());
+        }
+
+        bool wait_for(std::size_t count)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                {
+                    const std::lock_guard<std::mutex> guard(mutex);
+                    if (ids.size() >= count)
+                    {
+                        return true;
+                    }
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return false;
+        }
+
+        std::mutex mutex;
+        std::vector<std::uint32_t> ids;
+        std::vector<std::thread::id> threads;
+    };
+
+    bool parse(const raw_frame& frame, sample& output)
+    {
+        output.id = frame.id;
+        output.value = static_cast<double>(frame.raw_value) / 10.;
+        return true;
+    }
+}
+
+/**
+ * @brief Items flow through a queued parse stage, a fused filter and a queued sink in submission order.
+ *
+ * @test
+ * - Checks that the filter drops the odd ids and that the sink sees the even ones in order.
+ * - Checks the per-stage processed/forwarded counters and that the fused filter reports no backlog.
+ */
+TEST(DataPipelineTest, RunsStagesInOrder)
+{
+    collector received;
+    auto pipeline = tools::data_pipeline_builder<raw_frame>()
+                        .stage<sample>("parse", parse)
+                        .stage<sample>("filter",
+                            [](const sample& input, sample& output)
+                            {
+                                output = input;
+                                return 0U == (input.id % 2U);
+                            },
+                            tools::pipeline_stage_params::fused())
+                        .sink("publish", [&received](const sample& item) { received.add(item); })
+                        .build();
+    ASSERT_EQ(3U, pipeline->stage_count());
+
+    for (std::uint32_t id = 0U; id < 10U; ++id)
+    {
+        EXPECT_TRUE(pipeline->submit(raw_frame { id, static_cast<std::int32_t>(id) * 10 }));
+    }
+    ASSERT_TRUE(received.wait_for(5U));
+    EXPECT_EQ((std::vector<std::uint32_t> { 0U, 2U, 4U, 6U, 8U }), received.ids);
+
+    const auto stats = pipeline->stats();
+    ASSERT_EQ(3U, stats.size());
+    EXPECT_EQ("parse", stats[0].name);
+    EXPECT_FALSE(stats[0].fused);
+    EXPECT_EQ(10U, stats[0].processed);
+    EXPECT_EQ(10U, stats[0].forwarded);
+    EXPECT_TRUE(stats[1].fused);
+    EXPECT_EQ(10U, stats[1].processed);
+    EXPECT_EQ(5U, stats[1].forwarded);
+    EXPECT_EQ(0U, stats[1].backlog);
+    EXPECT_EQ(5U, stats[2].processed);
+    EXPECT_EQ(0U, stats[2].forwarded);
+    EXPECT_GT(stats[0].items_per_second, 0.);
+}
+
+/**
+ * @brief Fused stages run on the thread of the stage before them, with no hop.
+ *
+ * @test
+ * - Builds a fully fused pipeline and checks the sink runs on the submitting thread, synchronously.
+ * - Builds a queued stage followed by a fused sink and checks the sink runs off the submitting thread.
+ */
+TEST(DataPipelineTest, FusedStagesRunOnTheUpstreamThread)
+{
+    collector inline_received;
+    auto inline_pipeline = tools::data_pipeline_builder<raw_frame>()
+                               .stage<sample>("parse", parse, tools::pipeline_stage_params::fused())
+                               .sink("publish", [&inline_received](const sample& item) { inline_received.add(item); },
+                                   tools::pipeline_stage_params::fused())
+                               .build();
+    EXPECT_TRUE(inline_pipeline->submit(raw_frame { 7U, 70 }));
+    ASSERT_EQ(1U, inline_received.ids.size());
+    EXPECT_EQ(std::this_thread::get_id(), inline_received.threads[0]);
+
+    collector hopped_received;
+    auto hopped_pipeline = tools::data_pipeline_builder<raw_frame>()
+                               .stage<sample>("parse", parse)
+                               .sink("publish", [&hopped_received](const sample& item) { hopped_received.add(item); },
+                                   tools::pipeline_stage_params::fused())
+                               .build();
+    EXPECT_TRUE(hopped_pipeline->submit(raw_frame { 8U, 80 }));
+    ASSERT_TRUE(hopped_received.wait_for(1U));
+    EXPECT_NE(std::this_thread::get_id(), hopped_received.threads[0]);
+}
+
+/**
+ * @brief A slow queued stage builds a backlog, refuses items once full, and is drained on destruction.
+ *
+ * @test
+ * - Blocks the sink while submitting more items than its queue holds with the fail overflow policy.
+ * - Checks the backlog and refused counters, then that every accepted item reaches the sink before teardown.
+ */
+TEST(DataPipelineTest, ReportsBacklogAndDrainsOnDestruction)
+{
+    std::atomic_bool release = false;
+    std::atomic<std::uint32_t> consumed = 0U;
+    tools::pipeline_stage_params sink_params;
+    sink_params.queue_depth = 4U;
+
+    std::size_t accepted = 0U;
+    {
+        auto pipeline = tools::data_pipeline_builder<sample>()
+                            .sink("slow",
+                                [&release, &consumed](const sample& /*item*/)
+                                {
+                                    while (!release.load())
+                                    {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                    }
+                                    consumed.fetch_add(1U);
+                                },
+                                sink_params)
+                            .build();
+
+        // first item occupies the stage, the next ones queue up until the queue is full
+        EXPECT_TRUE(pipeline->submit(sample { 0U, 0. }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for (std::uint32_t id = 1U; id < 10U; ++id)
+        {
+            if (pipeline->submit(sample { id, 0. }))
+            {
+                ++accepted;
+            }
+        }
+
+        const auto stats = pipeline->stats();
+        EXPECT_EQ(accepted, stats[0].backlog);
+        EXPECT_EQ(9U - accepted, stats[0].rejected);
+        EXPECT_GT(stats[0].rejected, 0U);
+        release.store(true);
+    }
+    EXPECT_EQ(accepted + 1U, consumed.load());
+}
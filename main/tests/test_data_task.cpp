@@ -41,11 +41,16 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
 #include "tools/data_task.hpp"
 
@@ -484,6 +489,377 @@ TEST_F(DataTaskForwardingTest, PerfectForwardingConstructorSupportsLvalueRvalueA
     }
 }
 
+/**
+ * @brief Verifies that a data_task using the lock-free SPSC queue policy processes every item in order.
+ */
+TEST(DataTaskSpscQueueTest, ProcessesItemsInOrder)
+{
+    struct SpscContext
+    {
+        std::atomic<int> processed = 0;
+        std::atomic<bool> in_order = true;
+    };
+    using SpscTask = tools::data_task<SpscContext, int, tools::data_task_spsc_queue<6U>>;
+
+    constexpr int nb_items = 50;
+    auto context = std::make_shared<SpscContext>();
+
+    auto task = std::make_unique<SpscTask>([](const std::shared_ptr<SpscContext>&, const std::string&) {},
+        [](const std::shared_ptr<SpscContext>& ctx, const int& value, const std::string&)
+        {
+            if (value != ctx->processed.load())
+            {
+                ctx->in_order.store(false);
+            }
+            ctx->processed.fetch_add(1);
+        },
+        context, 64U, "spsc_task", 2048U);
+
+    for (int value = 0; value < nb_items; ++value)
+    {
+        task->submit(value);
+    }
+
+    for (int i = 0; (i < 100) && (context->processed.load() < nb_items); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    task.reset();
+
+    EXPECT_EQ(context->processed.load(), nb_items);
+    EXPECT_TRUE(context->in_order.load());
+}
+
+/**
+ * @brief Verifies that a busy-polling data_task picks up data while spinning and parks once the window expired.
+ */
+TEST(DataTaskBusyPollTest, SpinsThenParks)
+{
+    if (tools::cpu_core_count() < 2U)
+    {
+        GTEST_SKIP() << "busy polling is disabled on single-core hosts";
+    }
+
+    struct PollContext
+    {
+        std::atomic<int> processed = 0;
+    };
+    using PollTask = tools::data_task<PollContext, int>;
+
+    auto context = std::make_shared<PollContext>();
+    auto wait_processed = [&context](int count)
+    {
+        for (int i = 0; (i < 1000) && (context->processed.load() < count); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return context->processed.load();
+    };
+
+    auto task = std::make_unique<PollTask>([](const std::shared_ptr<PollContext>&, const std::string&) {},
+        [](const std::shared_ptr<PollContext>& ctx, const int&, const std::string&) { ctx->processed.fetch_add(1); },
+        context, 16U, "poll_task", 2048U);
+
+    EXPECT_EQ(task->busy_poll().count(), 0U);
+    task->set_busy_poll(std::chrono::duration<std::uint64_t, std::micro>(500000U));
+    EXPECT_EQ(task->busy_poll().count(), 500000U);
+
+    task->submit(1);
+    ASSERT_EQ(wait_processed(1), 1);
+
+    // the task spins again once the first item is processed
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    task->submit(2);
+    ASSERT_EQ(wait_processed(2), 2);
+    const auto spun = task->busy_poll_stats();
+    EXPECT_GE(spun.spin_wakeups, 1U);
+    EXPECT_GT(spun.spin_time.count(), 0);
+
+    task->set_busy_poll(std::chrono::duration<std::uint64_t, std::micro>(1000U));
+    task->submit(3);
+    ASSERT_EQ(wait_processed(3), 3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_GE(task->busy_poll_stats().parked_wakeups, 1U);
+
+    task->reset_busy_poll_stats();
+    task->set_busy_poll(std::chrono::duration<std::uint64_t, std::micro>::zero());
+    task->submit(4);
+    ASSERT_EQ(wait_processed(4), 4);
+    task.reset();
+}
+
+namespace
+{
+    struct StopContext
+    {
+        std::atomic<bool> started = false;
+        std::atomic<bool> released = false;
+        std::vector<int> processed; ///< Only touched by the task until it is stopped.
+    };
+    using StopTask = tools::data_task<StopContext, int>;
+
+    /**
+     * @brief Creates a task holding the first item until released, with 0 to 4 queued behind it.
+     */
+    std::unique_ptr<StopTask> make_held_task(const std::shared_ptr<StopContext>& context)
+    {
+        auto task = std::make_unique<StopTask>([](const std::shared_ptr<StopContext>&, const std::string&) {},
+            [](const std::shared_ptr<StopContext>& ctx, const int& value, const std::string&)
+            {
+                ctx->started.store(true);
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                ctx->processed.push_back(value);
+            },
+            context, 16U, "stop_task", 2048U);
+
+        for (int value = 0; value < 5; ++value)
+        {
+            task->submit(value);
+        }
+        while (!context->started.load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return task;
+    }
+
+    /**
+     * @brief Releases the held item once stop() had time to publish its request.
+     */
+    std::thread release_later(const std::shared_ptr<StopContext>& context)
+    {
+        return std::thread(
+            [context]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                context->released.store(true);
+            });
+    }
+}
+
+/**
+ * @brief Verifies that stop() with the discard policy finishes the data in progress and hands back the rest.
+ */
+TEST(DataTaskStopTest, DiscardHandsBackQueuedData)
+{
+    auto context = std::make_shared<StopContext>();
+    auto task = make_held_task(context);
+
+    auto releaser = release_later(context);
+    const auto unprocessed = task->stop(tools::task_drain_policy::discard);
+    releaser.join();
+
+    EXPECT_EQ(context->processed, (std::vector<int> { 0 }));
+    EXPECT_EQ(unprocessed, (std::vector<int> { 1, 2, 3, 4 }));
+    EXPECT_FALSE(task->submit(5));
+    EXPECT_TRUE(task->stop(tools::task_drain_policy::drain_all).empty());
+}
+
+/**
+ * @brief Verifies that stop() with the drain_all policy processes everything queued.
+ */
+TEST(DataTaskStopTest, DrainAllProcessesQueuedData)
+{
+    auto context = std::make_shared<StopContext>();
+    auto task = make_held_task(context);
+
+    auto releaser = release_later(context);
+    const auto unprocessed = task->stop(tools::task_drain_policy::drain_all);
+    releaser.join();
+
+    EXPECT_TRUE(unprocessed.empty());
+    EXPECT_EQ(context->processed, (std::vector<int> { 0, 1, 2, 3, 4 }));
+}
+
+/**
+ * @brief Verifies that stop() with the drain_deadline policy stops draining once the timeout expired.
+ */
+TEST(DataTaskStopTest, DrainDeadlineHandsBackDataPastTheTimeout)
+{
+    using micro = std::chrono::duration<std::uint64_t, std::micro>;
+    auto context = std::make_shared<StopContext>();
+    auto task = make_held_task(context);
+
+    // the held item outlasts the timeout
+    auto releaser = release_later(context);
+    const auto unprocessed = task->stop(tools::task_drain_policy::drain_deadline, micro(1000U));
+    releaser.join();
+
+    EXPECT_EQ(context->processed, (std::vector<int> { 0 }));
+    EXPECT_EQ(unprocessed, (std::vector<int> { 1, 2, 3, 4 }));
+
+    auto generous = std::make_shared<StopContext>();
+    auto other_task = make_held_task(generous);
+    auto other_releaser = release_later(generous);
+    EXPECT_TRUE(other_task->stop(tools::task_drain_policy::drain_deadline, micro(10000000U)).empty());
+    other_releaser.join();
+    EXPECT_EQ(generous->processed.size(), 5U);
+}
+
+/**
+ * @class DataTaskOverflowTest
+ * @brief Unit test class for the data_task overflow policies.
+ *
+ * The startup routine holds the task until released, so that the queue fills up.
+ */
+class DataTaskOverflowTest : public ::testing::Test
+{
+public:
+    struct OverflowContext
+    {
+        std::atomic<bool> released = false;
+        std::vector<int> processed; ///< Only touched by the task thread until the task is destroyed.
+    };
+    using OverflowTask = tools::data_task<OverflowContext, int>;
+
+    static constexpr std::size_t queue_depth = 4U;
+
+protected:
+    void SetUp() override
+    {
+        task = std::make_unique<OverflowTask>(
+            [](const std::shared_ptr<OverflowContext>& ctx, const std::string&)
+            {
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            },
+            [](const std::shared_ptr<OverflowContext>& ctx, const int& value, const std::string&)
+            { ctx->processed.push_back(value); },
+            context, queue_depth, "overflow_task", 2048U);
+    }
+
+    void release_and_stop()
+    {
+        context->released.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        task.reset();
+    }
+
+    std::shared_ptr<OverflowContext> context = std::make_shared<OverflowContext>();
+    std::unique_ptr<OverflowTask> task;
+};
+
+/**
+ * @brief Verifies that submissions to a full queue are dropped and counted by default.
+ */
+TEST_F(DataTaskOverflowTest, DropNewestIsDefault)
+{
+    EXPECT_EQ(task->overflow_policy(), tools::data_task_overflow_policy::drop_newest);
+
+    for (int value = 0; value < 6; ++value)
+    {
+        EXPECT_EQ(task->submit(value), (value < static_cast<int>(queue_depth)));
+    }
+
+    const auto stats = task->overflow_stats();
+    EXPECT_EQ(stats.dropped_newest, 2U);
+    EXPECT_EQ(stats.dropped_oldest, 0U);
+    EXPECT_EQ(stats.rejected, 0U);
+
+    release_and_stop();
+    EXPECT_EQ(context->processed, (std::vector<int> { 0, 1, 2, 3 }));
+}
+
+/**
+ * @brief Verifies that drop_oldest keeps the most recent submissions.
+ */
+TEST_F(DataTaskOverflowTest, DropOldestKeepsLatestData)
+{
+    task->set_overflow_policy(tools::data_task_overflow_policy::drop_oldest);
+
+    for (int value = 0; value < 6; ++value)
+    {
+        EXPECT_TRUE(task->submit(value));
+    }
+
+    EXPECT_EQ(task->overflow_stats().dropped_oldest, 2U);
+
+    release_and_stop();
+    EXPECT_EQ(context->processed, (std::vector<int> { 2, 3, 4, 5 }));
+}
+
+/**
+ * @brief Verifies that fail rejects submissions to a full queue and that the counters can be reset.
+ */
+TEST_F(DataTaskOverflowTest, FailRejectsAndCounts)
+{
+    task->set_overflow_policy(tools::data_task_overflow_policy::fail);
+
+    for (int value = 0; value < 5; ++value)
+    {
+        EXPECT_EQ(task->submit(value), (value < static_cast<int>(queue_depth)));
+    }
+
+    EXPECT_EQ(task->overflow_stats().rejected, 1U);
+    EXPECT_EQ(task->overflow_stats().dropped_newest, 0U);
+
+    task->reset_overflow_stats();
+    EXPECT_EQ(task->overflow_stats().rejected, 0U);
+
+    release_and_stop();
+    EXPECT_EQ(context->processed.size(), queue_depth);
+}
+
+/**
+ * @brief Verifies that block gives up after the timeout and accounts for the time spent waiting.
+ */
+TEST_F(DataTaskOverflowTest, BlockTimesOutOnFullQueue)
+{
+    task->set_overflow_policy(tools::data_task_overflow_policy::block, std::chrono::milliseconds(30));
+
+    for (int value = 0; value < static_cast<int>(queue_depth); ++value)
+    {
+        EXPECT_TRUE(task->submit(value));
+    }
+
+    EXPECT_FALSE(task->submit(99));
+
+    const auto stats = task->overflow_stats();
+    EXPECT_EQ(stats.blocked, 1U);
+    EXPECT_EQ(stats.rejected, 1U);
+    EXPECT_GE(stats.blocked_time, std::chrono::milliseconds(30));
+
+    release_and_stop();
+    EXPECT_EQ(context->processed, (std::vector<int> { 0, 1, 2, 3 }));
+}
+
+/**
+ * @brief Verifies that block resumes the producer once the task frees some room.
+ */
+TEST_F(DataTaskOverflowTest, BlockResumesWhenRoomIsFreed)
+{
+    task->set_overflow_policy(tools::data_task_overflow_policy::block);
+
+    for (int value = 0; value < static_cast<int>(queue_depth); ++value)
+    {
+        EXPECT_TRUE(task->submit(value));
+    }
+
+    std::thread releaser(
+        [this]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            context->released.store(true);
+        });
+
+    EXPECT_TRUE(task->submit(4));
+    releaser.join();
+
+    const auto stats = task->overflow_stats();
+    EXPECT_EQ(stats.blocked, 1U);
+    EXPECT_EQ(stats.rejected, 0U);
+    EXPECT_GT(stats.blocked_time.count(), 0);
+
+    release_and_stop();
+    EXPECT_EQ(context->processed, (std::vector<int> { 0, 1, 2, 3, 4 }));
+}
+
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 TEST(DataTaskCompileTimeChecks, PerfectForwardingConstructorConstraints)
 {
@@ -514,3 +890,134 @@ TEST(DataTaskCompileTimeChecks, PerfectForwardingConstructorConstraints)
     SUCCEED();
 }
 #endif
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+/**
+ * @class DataTaskBatchTest
+ * @brief Unit test class for the batch processing mode of data_task.
+ *
+ * The startup routine holds the task until released, so that submitted items pile up in the queue
+ * before the first drain.
+ */
+class DataTaskBatchTest : public ::testing::Test
+{
+public:
+    struct BatchContext
+    {
+        std::atomic<bool> released = false;
+        std::vector<std::vector<int>> batches; ///< Only touched by the task thread until the task is destroyed.
+    };
+    using BatchTask = tools::data_task<BatchContext, int>;
+
+protected:
+    static void hold_until_released(const std::shared_ptr<BatchContext>& ctx, const std::string&)
+    {
+        while (!ctx->released.load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    static void record_batch(const std::shared_ptr<BatchContext>& ctx, std::span<const int> batch, const std::string&)
+    {
+        ctx->batches.emplace_back(batch.begin(), batch.end());
+    }
+
+    std::shared_ptr<BatchContext> context = std::make_shared<BatchContext>();
+};
+
+/**
+ * @brief Verifies that queued items are handed over in order, in batches of at most the configured size.
+ */
+TEST_F(DataTaskBatchTest, DrainsQueueInBoundedBatches)
+{
+    constexpr std::size_t max_batch_size = 8U;
+    constexpr int nb_items = 20;
+
+    auto task = std::make_unique<BatchTask>(
+        hold_until_released, record_batch, context, 32U, "batch_task", 2048U, max_batch_size);
+
+    for (int value = 0; value < nb_items; ++value)
+    {
+        task->submit(value);
+    }
+
+    context->released.store(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    task.reset();
+
+    ASSERT_EQ(context->batches.size(), 3U);
+    EXPECT_EQ(context->batches[0].size(), max_batch_size);
+    EXPECT_EQ(context->batches[1].size(), max_batch_size);
+    EXPECT_EQ(context->batches[2].size(), 4U);
+
+    int expected = 0;
+    for (const auto& batch : context->batches)
+    {
+        for (const int value : batch)
+        {
+            EXPECT_EQ(value, expected++);
+        }
+    }
+}
+
+/**
+ * @brief Verifies that the linger time coalesces items submitted shortly after each other into one batch.
+ */
+TEST_F(DataTaskBatchTest, LingerCoalescesLateSubmissions)
+{
+    context->released.store(true);
+
+    auto task = std::make_unique<BatchTask>(hold_until_released, record_batch, context, 32U, "linger_task", 2048U,
+        tools::base_task::run_on_all_cores, tools::base_task::default_priority,
+        (std::chrono::duration<std::uint64_t, std::micro>::max)(), 16U, std::chrono::milliseconds(300));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    task->submit(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    task->submit(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    task->submit(3);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    task.reset();
+
+    ASSERT_EQ(context->batches.size(), 1U);
+    EXPECT_EQ(context->batches[0], (std::vector<int> { 1, 2, 3 }));
+}
+
+/**
+ * @brief Verifies that the batch mode drains the lock-free SPSC queue policy in bounded batches.
+ */
+TEST_F(DataTaskBatchTest, SpscQueueDrainsInBoundedBatches)
+{
+    using SpscBatchTask = tools::data_task<BatchContext, int, tools::data_task_spsc_queue<5U>>;
+    constexpr std::size_t max_batch_size = 8U;
+    constexpr int nb_items = 20;
+
+    auto task = std::make_unique<SpscBatchTask>(
+        hold_until_released, record_batch, context, 32U, "spsc_batch_task", 2048U, max_batch_size);
+
+    for (int value = 0; value < nb_items; ++value)
+    {
+        task->submit(value);
+    }
+
+    context->released.store(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    task.reset();
+
+    ASSERT_EQ(context->batches.size(), 3U);
+    EXPECT_EQ(context->batches[0].size(), max_batch_size);
+    EXPECT_EQ(context->batches[2].size(), 4U);
+
+    int expected = 0;
+    for (const auto& batch : context->batches)
+    {
+        for (const int value : batch)
+        {
+            EXPECT_EQ(value, expected++);
+        }
+    }
+}
+#endif
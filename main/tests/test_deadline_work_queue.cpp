@@ -0,0 +1,90 @@
+/**
+ * @file test_deadline_work_queue.cpp
+ * @brief Unit tests for the earliest-deadline-first work queue.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "tools/deadline_work_queue.hpp"
+
+/**
+ * @brief Verifies that items come out earliest deadline first, equal deadlines in arrival order.
+ */
+TEST(DeadlineWorkQueueTest, PopsEarliestDeadlineFirst)
+{
+    tools::deadline_work_queue<int> queue;
+    queue.reserve(8U);
+    queue.push(300U, 3);
+    queue.push(100U, 1);
+    queue.push(200U, 2);
+    queue.push(100U, 11);
+    EXPECT_EQ(queue.size(), 4U);
+
+    std::vector<int> order;
+    for (auto item = queue.pop(0U); item.has_value(); item = queue.pop(0U))
+    {
+        order.push_back(item.value());
+    }
+
+    EXPECT_EQ(order, (std::vector<int> { 1, 11, 2, 3 }));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.missed_count(), 0U);
+}
+
+/**
+ * @brief Verifies that items past their deadline are dropped and counted, and that pop_any() keeps them.
+ */
+TEST(DeadlineWorkQueueTest, DropsAndCountsExpiredItems)
+{
+    tools::deadline_work_queue<std::unique_ptr<int>> queue;
+    queue.push(100U, std::make_unique<int>(1));
+    queue.push(200U, std::make_unique<int>(2));
+    queue.push(300U, std::make_unique<int>(3));
+
+    auto item = queue.pop(200U);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(*item.value(), 2);
+    EXPECT_EQ(queue.missed_count(), 1U);
+
+    EXPECT_FALSE(queue.pop(301U).has_value());
+    EXPECT_EQ(queue.missed_count(), 2U);
+
+    queue.push(50U, std::make_unique<int>(4));
+    auto late = queue.pop_any();
+    ASSERT_TRUE(late.has_value());
+    EXPECT_EQ(*late.value(), 4);
+    EXPECT_FALSE(queue.pop_any().has_value());
+    EXPECT_EQ(queue.missed_count(), 2U);
+}
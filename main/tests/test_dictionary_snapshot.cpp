@@ -0,0 +1,194 @@
+/**
+ * @file test_dictionary_snapshot.cpp
+ * @brief Unit tests for the sync_dictionary snapshots.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tools/dictionary_snapshot.hpp"
+#include "tools/flat_hash_map.hpp"
+
+namespace
+{
+    using registry = tools::sync_dictionary<std::uint32_t, std::string>;
+
+    void fill(registry& dictionary, std::uint32_t count)
+    {
+        // inserted in descending order: the snapshot sorts them anyway
+        for (std::uint32_t id = count; id > 0U; --id)
+        {
+            dictionary.add(id, "device-" + std::to_string(id % 7U));
+        }
+    }
+}
+
+// A snapshot cut into several chunks restores the same entries into ordered and hashed containers.
+TEST(DictionarySnapshotTest, RoundTripsThroughChunks)
+{
+    registry source;
+    fill(source, 1000U);
+
+    tools::dictionary_snapshot_options options;
+    options.chunk_size = 512U;
+    std::size_t chunks = 0U;
+    std::vector<std::uint8_t> image;
+    const auto written = tools::write_dictionary_snapshot(source,
+        [&image, &chunks](std::span<const std::uint8_t> bytes)
+        {
+            EXPECT_LE(bytes.size(), 512U);
+            image.insert(image.end(), bytes.begin(), bytes.end());
+            ++chunks;
+            return true;
+        },
+        options);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(1000U, written.value());
+    EXPECT_GT(chunks, 20U);
+
+    registry restored;
+    restored.add(5000U, "stale");
+    const auto loaded = tools::restore_dictionary_snapshot(restored, image);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(1000U, loaded.value());
+    EXPECT_EQ(source.snapshot(), restored.snapshot());
+    EXPECT_FALSE(restored.contains(5000U));
+
+    tools::sync_dictionary<std::uint32_t, std::string, tools::flat_hash_map<std::uint32_t, std::string>> hashed;
+    ASSERT_TRUE(tools::restore_dictionary_snapshot(hashed, image).has_value());
+    EXPECT_EQ(1000U, hashed.size());
+    EXPECT_EQ("device-6", hashed.find(13U).value_or(""));
+
+    // a hashed source is written sorted as well, so the image is identical
+    const auto rewritten = tools::make_dictionary_snapshot(hashed, options);
+    ASSERT_TRUE(rewritten.has_value());
+    EXPECT_EQ(image, rewritten.value());
+}
+
+// Compressed chunks shrink a repetitive dictionary and restore identically.
+TEST(DictionarySnapshotTest, CompressesChunks)
+{
+    tools::sync_dictionary<std::string, std::uint32_t, std::unordered_map<std::string, std::uint32_t>> source;
+    for (std::uint32_t id = 0U; id < 500U; ++id)
+    {
+        source.add("sensor/building-a/floor-" + std::to_string(id), id);
+    }
+
+    const auto plain = tools::make_dictionary_snapshot(source);
+    tools::dictionary_snapshot_options options;
+    options.compress = true;
+    const auto packed = tools::make_dictionary_snapshot(source, options);
+    ASSERT_TRUE(plain.has_value());
+    ASSERT_TRUE(packed.has_value());
+    EXPECT_LT(packed.value().size() * 2U, plain.value().size());
+
+    tools::sync_dictionary<std::string, std::uint32_t> restored;
+    const auto loaded = tools::restore_dictionary_snapshot(restored, packed.value());
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(500U, loaded.value());
+    EXPECT_EQ(42U, restored.find("sensor/building-a/floor-42").value_or(0U));
+}
+
+// Damaged, truncated or foreign images are rejected and leave the dictionary as it was.
+TEST(DictionarySnapshotTest, RejectsDamagedImages)
+{
+    registry source;
+    fill(source, 100U);
+    const auto image = tools::make_dictionary_snapshot(source).value();
+
+    registry target;
+    target.add(1U, "kept");
+
+    auto corrupted = image;
+    corrupted[tools::dictionary_snapshot_header_size + tools::dictionary_snapshot_chunk_header_size + 3U] ^= 0x55U;
+    EXPECT_EQ(tools::dictionary_snapshot_error::corrupted,
+        tools::restore_dictionary_snapshot(target, corrupted).error());
+
+    const std::vector<std::uint8_t> truncated(image.begin(), image.end() - 8);
+    EXPECT_EQ(tools::dictionary_snapshot_error::truncated,
+        tools::restore_dictionary_snapshot(target, truncated).error());
+
+    auto foreign = image;
+    foreign[0] = 'X';
+    EXPECT_EQ(tools::dictionary_snapshot_error::bad_header,
+        tools::restore_dictionary_snapshot(target, foreign).error());
+
+    EXPECT_EQ(1U, target.size());
+    EXPECT_EQ("kept", target.find(1U).value_or(""));
+
+    const auto refused = tools::write_dictionary_snapshot(
+        source, [](std::span<const std::uint8_t> /*bytes*/) { return false; });
+    EXPECT_EQ(tools::dictionary_snapshot_error::sink_failed, refused.error());
+}
+
+// bulk_load() and for_each_sorted() behave the same on every supported container.
+TEST(DictionarySnapshotTest, BulkLoadsSortedEntries)
+{
+    std::vector<std::pair<std::uint32_t, std::string>> entries;
+    for (std::uint32_t id = 0U; id < 64U; ++id)
+    {
+        entries.emplace_back(id * 2U, std::to_string(id));
+    }
+
+    registry tree;
+    tree.bulk_load(entries);
+    tools::sync_dictionary<std::uint32_t, std::string, std::unordered_map<std::uint32_t, std::string>> hashed;
+    hashed.bulk_load(entries);
+
+    std::vector<std::uint32_t> tree_keys;
+    tree.for_each_sorted(
+        [&tree_keys](const std::uint32_t& key, const std::string& /*value*/) { tree_keys.push_back(key); });
+    std::vector<std::uint32_t> hashed_keys;
+    hashed.for_each_sorted(
+        [&hashed_keys](const std::uint32_t& key, const std::string& /*value*/) { hashed_keys.push_back(key); });
+    EXPECT_EQ(64U, tree_keys.size());
+    EXPECT_EQ(tree_keys, hashed_keys);
+    EXPECT_EQ("21", tree.find(42U).value_or(""));
+
+#if defined(__cpp_lib_flat_map) && (__cpp_lib_flat_map >= 202207L)
+    tools::sync_dictionary<std::uint32_t, std::string, std::flat_map<std::uint32_t, std::string>> flat;
+    flat.add(1U, "dropped");
+    flat.bulk_load(entries);
+    EXPECT_EQ(64U, flat.size());
+    EXPECT_FALSE(flat.contains(1U));
+    EXPECT_EQ("21", flat.find(42U).value_or(""));
+#endif
+}
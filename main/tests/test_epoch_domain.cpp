@@ -0,0 +1,168 @@
+/**
+ * @file test_epoch_domain.cpp
+ * @brief Unit tests for the epoch-based reclamation domain using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "tools/epoch_domain.hpp"
+
+namespace
+{
+    /**
+     * @brief Object counting its live instances, to observe when the domain deletes it.
+     */
+    struct tracked
+    {
+        explicit tracked(std::atomic<int>& live_count, int payload)
+            : live(live_count)
+            , value(payload)
+        {
+            ++live;
+        }
+
+        ~tracked()
+        {
+            --live;
+        }
+
+        tracked(const tracked&) = delete;
+        tracked& operator=(const tracked&) = delete;
+        tracked(tracked&&) = delete;
+        tracked& operator=(tracked&&) = delete;
+
+        std::atomic<int>& live;
+        int value;
+    };
+}
+
+/**
+ * @brief Verifies a retired object is deleted immediately without readers and deferred while a guard could reach it.
+ */
+TEST(EpochDomainTest, RetireWaitsForOlderReaders)
+{
+    std::atomic<int> live { 0 };
+    tools::epoch_domain<4U> domain;
+
+    domain.retire(new tracked(live, 1)); // NOLINT owning pointer handed over to the domain
+    EXPECT_EQ(live.load(), 0);
+    EXPECT_EQ(domain.pending_reclaims(), 0U);
+
+    auto* shared = new tracked(live, 2); // NOLINT owning pointer handed over to the domain
+    {
+        const auto reader = domain.read_guard();
+        domain.retire(shared);
+        EXPECT_EQ(domain.pending_reclaims(), 1U);
+        EXPECT_EQ(shared->value, 2);
+
+        domain.reclaim();
+        EXPECT_EQ(domain.pending_reclaims(), 1U);
+    }
+
+    // a reader entering after the retire cannot reach the object and does not hold it back
+    const auto late_reader = domain.read_guard();
+
+    domain.reclaim();
+    EXPECT_EQ(domain.pending_reclaims(), 0U);
+    EXPECT_EQ(live.load(), 0);
+}
+
+/**
+ * @brief Verifies nested guards take distinct slots and that the destructor deletes the pending objects.
+ */
+TEST(EpochDomainTest, NestedGuardsAndDestructorReclaim)
+{
+    std::atomic<int> live { 0 };
+    {
+        tools::epoch_domain<2U> domain;
+        const auto outer = domain.read_guard();
+        {
+            const auto inner = domain.read_guard();
+            domain.retire(new tracked(live, 3)); // NOLINT owning pointer handed over to the domain
+        }
+        domain.reclaim();
+        EXPECT_EQ(live.load(), 1);
+        EXPECT_EQ(domain.pending_reclaims(), 1U);
+    }
+    EXPECT_EQ(live.load(), 0);
+}
+
+/**
+ * @brief Verifies readers never see a deleted object while a writer keeps replacing it.
+ */
+TEST(EpochDomainTest, ConcurrentReadersAndWriter)
+{
+    std::atomic<int> live { 0 };
+    tools::epoch_domain<8U> domain;
+    std::atomic<const tracked*> current { new tracked(live, 0) }; // NOLINT owning pointer
+    std::atomic<bool> stop { false };
+    std::atomic<int> torn_reads { 0 };
+
+    std::vector<std::thread> readers;
+    for (int reader_index = 0; reader_index < 3; ++reader_index)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                while (!stop.load())
+                {
+                    const auto reader = domain.read_guard();
+                    const tracked* object = current.load();
+                    if (object->value < 0)
+                    {
+                        ++torn_reads;
+                    }
+                }
+            });
+    }
+
+    for (int version = 1; version <= 2000; ++version)
+    {
+        domain.retire(current.exchange(new tracked(live, version))); // NOLINT owning pointer
+    }
+
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    domain.reclaim();
+    EXPECT_EQ(torn_reads.load(), 0);
+    EXPECT_EQ(domain.pending_reclaims(), 0U);
+    EXPECT_EQ(live.load(), 1);
+    delete current.load(); // NOLINT owning pointer
+}
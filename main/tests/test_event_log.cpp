@@ -0,0 +1,192 @@
+/**
+ * @file test_event_log.cpp
+ * @brief Unit tests for the event log recorder and replayer using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "tools/event_log.hpp"
+#include "tools/linux/linux_mmap_event_log.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace
+{
+    class collecting_observer : public tools::sync_observer<std::string, std::int32_t>
+    {
+    public:
+        void inform(const std::string& topic, const std::int32_t& event, const std::string& origin) override
+        {
+            (void)origin;
+            topics.push_back(topic);
+            events.push_back(event);
+        }
+
+        std::vector<std::string> topics;
+        std::vector<std::int32_t> events;
+    };
+
+    using recorder_type = tools::event_log_recorder<std::string, std::int32_t>;
+    using replayer_type = tools::event_log_replayer<std::string, std::int32_t>;
+}
+
+// The events published on a recorded subject are replayed in order, with their topics, into another subject.
+TEST(EventLogTest, RecordsAndReplaysEventStream)
+{
+    std::vector<std::uint8_t> region(1024U);
+    tools::sync_subject<std::string, std::int32_t> production("production");
+    auto recorder = std::make_shared<recorder_type>(region);
+    production.subscribe("speed", recorder);
+    production.subscribe("heading", recorder);
+
+    production.publish("speed", 12);
+    production.publish("heading", -90);
+    production.publish("speed", 13);
+
+    EXPECT_EQ(3U, recorder->stats().events);
+    EXPECT_EQ(0U, recorder->stats().dropped_events);
+    EXPECT_EQ(tools::event_log_header_size + recorder->stats().bytes + 4U, recorder->log().size());
+
+    tools::sync_subject<std::string, std::int32_t> bench("bench");
+    auto observer = std::make_shared<collecting_observer>();
+    bench.subscribe("speed", observer);
+    bench.subscribe("heading", observer);
+
+    replayer_type replayer(recorder->log());
+    EXPECT_EQ(3U, replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+    EXPECT_EQ((std::vector<std::string> { "speed", "heading", "speed" }), observer->topics);
+    EXPECT_EQ((std::vector<std::int32_t> { 12, -90, 13 }), observer->events);
+
+    EXPECT_EQ(3U, replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+    EXPECT_EQ(6U, replayer.stats().events);
+}
+
+// Events beyond the region capacity are dropped and counted, the recorded prefix stays a valid log.
+TEST(EventLogTest, FullRegionDropsEventsAndKeepsLogValid)
+{
+    std::vector<std::uint8_t> region(48U);
+    recorder_type recorder(region);
+
+    for (std::int32_t value = 0; value < 10; ++value)
+    {
+        recorder.inform("t", value, "origin");
+    }
+
+    const auto stats = recorder.stats();
+    EXPECT_GT(stats.events, 0U);
+    EXPECT_GT(stats.dropped_events, 0U);
+    EXPECT_EQ(10U, stats.events + stats.dropped_events);
+
+    tools::sync_subject<std::string, std::int32_t> bench("bench");
+    auto observer = std::make_shared<collecting_observer>();
+    bench.subscribe("t", observer);
+    replayer_type replayer(recorder.log());
+    EXPECT_EQ(stats.events, replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+    EXPECT_EQ(0, observer->events.front());
+
+    std::vector<std::uint8_t> foreign(recorder.log().begin(), recorder.log().end());
+    foreign[0] = 'X';
+    replayer_type foreign_replayer(foreign);
+    EXPECT_EQ(0U, foreign_replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+
+    std::vector<std::uint8_t> too_small(4U);
+    recorder_type unusable(too_small);
+    unusable.inform("t", 1, "origin");
+    EXPECT_EQ(1U, unusable.stats().dropped_events);
+    EXPECT_TRUE(unusable.log().empty());
+}
+
+// A real time replay reproduces the spacing between the recorded events.
+TEST(EventLogTest, RealTimeReplayKeepsEventSpacing)
+{
+    std::vector<std::uint8_t> region(256U);
+    recorder_type recorder(region);
+    recorder.inform("t", 1, "origin");
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    recorder.inform("t", 2, "origin");
+
+    tools::sync_subject<std::string, std::int32_t> bench("bench");
+    replayer_type replayer(recorder.log());
+
+    const auto fast_start = std::chrono::steady_clock::now();
+    EXPECT_EQ(2U, replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+    EXPECT_LT(std::chrono::steady_clock::now() - fast_start, std::chrono::milliseconds(20));
+
+    const auto paced_start = std::chrono::steady_clock::now();
+    EXPECT_EQ(2U, replayer.replay(bench, tools::event_log_pace::real_time));
+    EXPECT_GE(std::chrono::steady_clock::now() - paced_start, std::chrono::milliseconds(29));
+}
+
+#if defined(__linux__)
+// A log recorded into a memory-mapped file is cut to its length and replayed from the mapped file.
+TEST(EventLogTest, RecordsIntoMemoryMappedFile)
+{
+    const std::string path = "/tmp/test_event_log_" + std::to_string(::getpid()) + ".bin";
+    std::size_t log_size = 0U;
+    {
+        tools::linux_os::mmap_event_log_file file(path, 4096U);
+        ASSERT_TRUE(file.valid());
+        recorder_type recorder(file.region());
+        recorder.inform("speed", 42, "origin");
+        recorder.inform("speed", 43, "origin");
+        log_size = recorder.log().size();
+        EXPECT_TRUE(file.sync());
+        EXPECT_TRUE(file.close_at(log_size));
+    }
+
+    tools::linux_os::mmap_event_log_file file(path);
+    ASSERT_TRUE(file.valid());
+    EXPECT_EQ(log_size, file.contents().size());
+    EXPECT_TRUE(file.region().empty());
+
+    tools::sync_subject<std::string, std::int32_t> bench("bench");
+    auto observer = std::make_shared<collecting_observer>();
+    bench.subscribe("speed", observer);
+    replayer_type replayer(file.contents());
+    EXPECT_EQ(2U, replayer.replay(bench, tools::event_log_pace::as_fast_as_possible));
+    EXPECT_EQ((std::vector<std::int32_t> { 42, 43 }), observer->events);
+    (void)std::remove(path.c_str());
+}
+#endif
+#endif
@@ -0,0 +1,288 @@
+/**
+ * @file test_event_reactor.cpp
+ * @brief Unit tests for the event_reactor class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "tools/async_observer.hpp"
+#include "tools/event_reactor.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+
+namespace
+{
+    template <typename Predicate>
+    bool wait_until(Predicate&& predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief Queues and a pipe hosted by one reactor are all handled on the reactor thread.
+ */
+TEST(EventReactorTest, QueuesAndPipeShareOneTask)
+{
+    tools::event_reactor reactor("reactor", 4096U, tools::base_task::run_on_all_cores,
+        tools::base_task::default_priority);
+    tools::memory_pipe pipe(256U);
+
+    std::mutex mutex;
+    std::vector<std::thread::id> threads;
+    std::atomic<int> sum { 0 };
+    std::atomic<std::size_t> piped { 0U };
+
+    auto record_thread = [&mutex, &threads]()
+    {
+        std::scoped_lock guard(mutex);
+        threads.push_back(std::this_thread::get_id());
+    };
+
+    auto ints = reactor.add_queue<int>(16U,
+        [&sum, &record_thread](const int& value)
+        {
+            record_thread();
+            sum += value;
+        });
+    auto strings = reactor.add_queue<std::string>(16U,
+        [&sum, &record_thread](const std::string& value)
+        {
+            record_thread();
+            sum += static_cast<int>(value.size());
+        });
+    static_cast<void>(reactor.add_pipe(pipe, 64U,
+        [&piped, &record_thread](const std::uint8_t*, std::size_t size)
+        {
+            record_thread();
+            piped += size;
+        }));
+    EXPECT_EQ(reactor.number_of_sources(), 3U);
+
+    for (int value = 1; value <= 10; ++value)
+    {
+        EXPECT_TRUE(ints->push(value));
+    }
+    EXPECT_TRUE(strings->push(std::string("abcd")));
+    const std::vector<std::uint8_t> bytes(20U, 0x5AU);
+    EXPECT_EQ(pipe.send(bytes, std::chrono::duration<std::uint64_t, std::milli>(10)), bytes.size());
+    reactor.notify();
+
+    EXPECT_TRUE(wait_until([&]() { return (59 == sum.load()) && (bytes.size() == piped.load()); }));
+
+    std::scoped_lock guard(mutex);
+    ASSERT_FALSE(threads.empty());
+    for (const auto& id : threads)
+    {
+        EXPECT_EQ(id, threads.front());
+        EXPECT_NE(id, std::this_thread::get_id());
+    }
+    EXPECT_GE(reactor.stats().handled, 12U);
+}
+
+/**
+ * @brief Busy sources are served in turn, each within its budget per round.
+ */
+TEST(EventReactorTest, SourcesAreServedRoundRobin)
+{
+    constexpr std::size_t budget = 4U;
+    tools::event_reactor reactor(
+        "reactor", 4096U, tools::base_task::run_on_all_cores, tools::base_task::default_priority, budget);
+
+    std::atomic_bool gate_entered { false };
+    std::atomic_bool gate_open { false };
+    static_cast<void>(reactor.add_poller(
+        [&gate_entered, &gate_open](std::size_t)
+        {
+            gate_entered.store(true);
+            while (!gate_open.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return std::size_t { 0U };
+        }));
+    ASSERT_TRUE(wait_until([&]() { return gate_entered.load(); }));
+
+    std::mutex mutex;
+    std::vector<char> order;
+    auto first = reactor.add_queue<int>(64U,
+        [&mutex, &order](const int&)
+        {
+            std::scoped_lock guard(mutex);
+            order.push_back('a');
+        });
+    auto second = reactor.add_queue<int>(64U,
+        [&mutex, &order](const int&)
+        {
+            std::scoped_lock guard(mutex);
+            order.push_back('b');
+        });
+
+    // both queues fill up while the reactor is held in the gate
+    for (int value = 0; value < 32; ++value)
+    {
+        EXPECT_TRUE(first->push(value));
+        EXPECT_TRUE(second->push(value));
+    }
+    gate_open.store(true);
+
+    ASSERT_TRUE(wait_until(
+        [&]()
+        {
+            std::scoped_lock guard(mutex);
+            return 64U == order.size();
+        }));
+
+    // every round hands one budget to each queue, the first queue served rotating from round to round
+    std::scoped_lock guard(mutex);
+    for (std::size_t round = 0U; round < order.size(); round += 2U * budget)
+    {
+        const char first_served = order[round];
+        const char second_served = order[round + budget];
+        EXPECT_NE(first_served, second_served) << "round at " << round;
+        for (std::size_t item = 0U; item < budget; ++item)
+        {
+            EXPECT_EQ(order[round + item], first_served) << "at " << (round + item);
+            EXPECT_EQ(order[round + budget + item], second_served) << "at " << (round + budget + item);
+        }
+    }
+}
+
+/**
+ * @brief Periodic and one-shot timers fire on the reactor task and can be cancelled.
+ */
+TEST(EventReactorTest, TimersFireAndCancel)
+{
+    tools::event_reactor reactor("reactor", 4096U, tools::base_task::run_on_all_cores,
+        tools::base_task::default_priority);
+
+    std::atomic<int> periodic_fired { 0 };
+    std::atomic<int> one_shot_fired { 0 };
+
+    const auto periodic = reactor.add_timer(
+        2U, [&periodic_fired](tools::timer_handle) { ++periodic_fired; }, tools::timer_type::periodic);
+    const auto one_shot = reactor.add_timer(
+        5U, [&one_shot_fired](tools::timer_handle) { ++one_shot_fired; }, tools::timer_type::one_shot);
+    ASSERT_TRUE(periodic.has_value());
+    ASSERT_TRUE(one_shot.has_value());
+
+    EXPECT_TRUE(wait_until([&]() { return (periodic_fired.load() >= 3) && (1 == one_shot_fired.load()); }));
+    EXPECT_FALSE(reactor.remove_timer(*one_shot));
+    EXPECT_TRUE(reactor.remove_timer(*periodic));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const int after_cancel = periodic_fired.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(periodic_fired.load(), after_cancel);
+    EXPECT_EQ(one_shot_fired.load(), 1);
+    EXPECT_GE(reactor.stats().timer_expirations, 4U);
+}
+
+/**
+ * @brief An async observer is drained by the reactor, woken by a handler subscribed after it.
+ */
+TEST(EventReactorTest, DrainsAsyncObserver)
+{
+    using observer_t = tools::async_observer<std::string, int, tools::sync_queue>;
+
+    tools::event_reactor reactor("reactor", 4096U, tools::base_task::run_on_all_cores,
+        tools::base_task::default_priority);
+    tools::sync_subject<std::string, int> subject("subject");
+    auto observer = std::make_shared<observer_t>();
+
+    std::atomic<int> total { 0 };
+    std::atomic<int> count { 0 };
+    auto source = reactor.add_observer(observer,
+        [&total, &count](const observer_t::event_entry& entry)
+        {
+            total += std::get<1>(entry);
+            ++count;
+        });
+
+    subject.subscribe("topic", observer);
+    subject.subscribe("topic", "doorbell",
+        [&reactor](const std::string&, const int&, const std::string&) { reactor.notify(); });
+
+    for (int value = 1; value <= 20; ++value)
+    {
+        subject.publish("topic", value);
+    }
+
+    EXPECT_TRUE(wait_until([&]() { return 20 == count.load(); }));
+    EXPECT_EQ(total.load(), 210);
+
+    EXPECT_TRUE(reactor.remove_source(source));
+    EXPECT_FALSE(reactor.remove_source(source));
+    subject.publish("topic", 100);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(count.load(), 20);
+    EXPECT_TRUE(observer->has_events());
+}
+
+/**
+ * @brief With a poll period, a source is served without notification.
+ */
+TEST(EventReactorTest, PollPeriodServesUnnotifiedSources)
+{
+    tools::event_reactor reactor("reactor", 4096U, tools::base_task::run_on_all_cores,
+        tools::base_task::default_priority, tools::event_reactor::default_budget,
+        std::chrono::duration<std::uint64_t, std::milli>(2));
+    tools::memory_pipe pipe(128U);
+
+    std::atomic<std::size_t> piped { 0U };
+    static_cast<void>(reactor.add_pipe(pipe, 32U, [&piped](const std::uint8_t*, std::size_t size) { piped += size; }));
+
+    const std::vector<std::uint8_t> bytes(8U, 0x11U);
+    EXPECT_EQ(pipe.send(bytes, std::chrono::duration<std::uint64_t, std::milli>(10)), bytes.size());
+
+    EXPECT_TRUE(wait_until([&]() { return bytes.size() == piped.load(); }));
+}
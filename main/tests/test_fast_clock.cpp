@@ -0,0 +1,87 @@
+/**
+ * @file test_fast_clock.cpp
+ * @brief Unit tests for the cycle-counter fast_clock.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "tools/fast_clock.hpp"
+
+/**
+ * @brief Verifies that the clock is monotonic and that a second worth of counts converts to one second.
+ */
+TEST(FastClockTest, CalibratedConversion)
+{
+    tools::fast_clock::calibrate();
+    ASSERT_GT(tools::fast_clock::frequency(), 0U);
+
+    const auto one_second = tools::fast_clock::to_duration(tools::fast_clock::frequency());
+    EXPECT_NEAR(static_cast<double>(one_second.count()), 1e9, 1e6);
+
+    auto previous = tools::fast_clock::now();
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto current = tools::fast_clock::now();
+        EXPECT_GE(current, previous);
+        previous = current;
+    }
+}
+
+/**
+ * @brief Verifies that counter intervals and chrono time points agree with steady_clock.
+ */
+TEST(FastClockTest, MeasuresLikeSteadyClock)
+{
+    const auto steady_start = std::chrono::steady_clock::now();
+    const auto fast_start = tools::fast_clock::now();
+    const auto counter_start = tools::fast_clock::counter();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    const auto counter_end = tools::fast_clock::counter();
+    const auto fast_end = tools::fast_clock::now();
+    const auto steady_end = std::chrono::steady_clock::now();
+
+    const auto steady_us = std::chrono::duration_cast<std::chrono::microseconds>(steady_end - steady_start).count();
+    const auto fast_us = std::chrono::duration_cast<std::chrono::microseconds>(fast_end - fast_start).count();
+    const auto counter_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        tools::fast_clock::elapsed(counter_start, counter_end))
+                                .count();
+
+    EXPECT_GE(steady_us, 30000);
+    EXPECT_NEAR(static_cast<double>(fast_us), static_cast<double>(steady_us), 1000.0);
+    EXPECT_NEAR(static_cast<double>(counter_us), static_cast<double>(steady_us), 1000.0);
+}
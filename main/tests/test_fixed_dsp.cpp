@@ -0,0 +1,243 @@
+/**
+ * @file test_fixed_dsp.cpp
+ * @brief Unit tests for the fixed-point FFT and filter kernels.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "fpm/fixed.hpp"
+#include "tools/fixed_dsp.hpp"
+
+namespace
+{
+    using fixed = fpm::fixed_16_16;
+
+    /**
+     * @brief Reference DFT in double precision.
+     */
+    std::vector<std::complex<double>> reference_dft(const std::vector<std::complex<double>>& input)
+    {
+        const std::size_t size = input.size();
+        std::vector<std::complex<double>> output(size);
+        for (std::size_t bin = 0U; bin < size; ++bin)
+        {
+            for (std::size_t index = 0U; index < size; ++index)
+            {
+                const double angle = -2.0 * std::numbers::pi * static_cast<double>(bin * index)
+                    / static_cast<double>(size);
+                output[bin] += input[index] * std::polar(1.0, angle);
+            }
+        }
+        return output;
+    }
+
+    /**
+     * @brief Runs the fixed FFT on a two-tone complex signal and returns the worst error against the reference,
+     *        relative to the largest bin.
+     */
+    template <unsigned int Log2Size>
+    double fft_relative_error(double amplitude)
+    {
+        using fft = tools::fixed_fft<fixed, Log2Size>;
+        std::vector<std::complex<double>> signal(fft::size);
+        std::array<fixed, fft::size> real {};
+        std::array<fixed, fft::size> imag {};
+        for (std::size_t index = 0U; index < fft::size; ++index)
+        {
+            const double phase = 2.0 * std::numbers::pi * static_cast<double>(index) / static_cast<double>(fft::size);
+            signal[index] = { amplitude * std::sin(5.0 * phase) + (0.25 * amplitude * std::cos(11.0 * phase)),
+                0.5 * amplitude * std::sin(3.0 * phase) };
+            real[index] = fixed(signal[index].real());
+            imag[index] = fixed(signal[index].imag());
+            signal[index] = { static_cast<double>(real[index]), static_cast<double>(imag[index]) };
+        }
+
+        const int exponent = fft::forward(real.data(), imag.data());
+        const auto expected = reference_dft(signal);
+
+        double largest = 0.0;
+        double worst = 0.0;
+        for (std::size_t bin = 0U; bin < fft::size; ++bin)
+        {
+            const std::complex<double> actual { std::ldexp(static_cast<double>(real[bin]), exponent),
+                std::ldexp(static_cast<double>(imag[bin]), exponent) };
+            largest = std::max(largest, std::abs(expected[bin]));
+            worst = std::max(worst, std::abs(actual - expected[bin]));
+        }
+        return worst / largest;
+    }
+}
+
+/**
+ * @brief The FFT matches a double-precision DFT for radix-4 only and mixed radix-2/4 sizes.
+ *
+ * @test
+ * - Transforms 64 (three radix-4 stages) and 128 points (one radix-2 stage first) of a two-tone signal.
+ * - Checks every bin against the reference once scaled by the block exponent, for small and large amplitudes.
+ */
+TEST(FixedDspTest, FftMatchesReferenceDft)
+{
+    EXPECT_LT(fft_relative_error<6U>(1.0), 1e-3);
+    EXPECT_LT(fft_relative_error<7U>(1.0), 1e-3);
+    EXPECT_LT(fft_relative_error<2U>(0.5), 1e-3);
+    EXPECT_LT(fft_relative_error<10U>(1000.0), 1e-3);
+}
+
+/**
+ * @brief Block floating point: a full-scale input is scaled instead of wrapping, a small one keeps its resolution.
+ *
+ * @test
+ * - Transforms a constant near the top of the fixed_16_16 range and checks the DC bin after the exponent.
+ * - Transforms a small tone and checks that no scaling was needed.
+ * - Checks that inverse(forward(x)) gives x back.
+ */
+TEST(FixedDspTest, FftScalesBlocksAndInverts)
+{
+    using fft = tools::fixed_fft<fixed, 8U>;
+    std::array<fixed, fft::size> real {};
+    std::array<fixed, fft::size> imag {};
+    real.fill(fixed(20000));
+
+    const int exponent = fft::forward(real.data(), imag.data());
+    EXPECT_GT(exponent, 0);
+    EXPECT_NEAR(20000.0 * 256.0, std::ldexp(static_cast<double>(real[0]), exponent), 20000.0 * 256.0 * 1e-4);
+    for (std::size_t bin = 1U; bin < fft::size; ++bin)
+    {
+        EXPECT_NEAR(0.0, std::ldexp(static_cast<double>(real[bin]), exponent), 1.0);
+    }
+
+    std::array<fixed, fft::size> original {};
+    for (std::size_t index = 0U; index < fft::size; ++index)
+    {
+        original[index] = fixed(0.01 * std::sin(2.0 * std::numbers::pi * 7.0 * static_cast<double>(index) / 256.0));
+    }
+    real = original;
+    imag.fill(fixed(0));
+    EXPECT_EQ(0, fft::forward(real.data(), imag.data()));
+
+    const int inverse_exponent = fft::inverse(real.data(), imag.data());
+    for (std::size_t index = 0U; index < fft::size; ++index)
+    {
+        EXPECT_NEAR(static_cast<double>(original[index]),
+            std::ldexp(static_cast<double>(real[index]), inverse_exponent), 1e-4);
+        EXPECT_NEAR(0.0, std::ldexp(static_cast<double>(imag[index]), inverse_exponent), 1e-4);
+    }
+}
+
+/**
+ * @brief A biquad cascade tracks a double-precision direct form I filter.
+ *
+ * @test
+ * - Runs a 2nd order low-pass (fc = fs / 20, Q = 0.707) twice in cascade over a step and a fast tone.
+ * - Checks the fixed output against the double reference, the unit DC gain and the attenuated tone.
+ */
+TEST(FixedDspTest, BiquadCascadeTracksReference)
+{
+    const double omega = 2.0 * std::numbers::pi / 20.0;
+    const double alpha = std::sin(omega) / (2.0 * 0.707);
+    const double a0 = 1.0 + alpha;
+    const std::array<double, 5> coefficients { (1.0 - std::cos(omega)) / (2.0 * a0), (1.0 - std::cos(omega)) / a0,
+        (1.0 - std::cos(omega)) / (2.0 * a0), (-2.0 * std::cos(omega)) / a0, (1.0 - alpha) / a0 };
+    const tools::fixed_biquad_coefficients<fixed> section { fixed(coefficients[0]), fixed(coefficients[1]),
+        fixed(coefficients[2]), fixed(coefficients[3]), fixed(coefficients[4]) };
+    tools::fixed_biquad_cascade<fixed, 2U> cascade({ section, section });
+
+    std::array<double, 4> state {};
+    std::array<double, 4> state2 {};
+    const auto reference = [&coefficients](std::array<double, 4>& history, double input)
+    {
+        const double output = (coefficients[0] * input) + (coefficients[1] * history[0])
+            + (coefficients[2] * history[1]) - (coefficients[3] * history[2]) - (coefficients[4] * history[3]);
+        history = { input, history[0], output, history[2] };
+        return output;
+    };
+
+    double output = 0.0;
+    for (int index = 0; index < 400; ++index)
+    {
+        const double input = 1.0 + ((index >= 200) ? (0.5 * std::sin(std::numbers::pi * 0.9 * index)) : 0.0);
+        const double expected = reference(state2, reference(state, input));
+        output = static_cast<double>(cascade.process(fixed(input)));
+        EXPECT_NEAR(expected, output, 2e-3) << "sample " << index;
+    }
+    EXPECT_NEAR(1.0, output, 1e-2);
+
+    cascade.reset();
+    EXPECT_EQ(0.0, static_cast<double>(cascade.process(fixed(0))));
+}
+
+/**
+ * @brief The streaming FIR filter gives the same output whatever the block split, matching the convolution.
+ *
+ * @test
+ * - Filters a ramp sample by sample and in uneven blocks, and checks both against a double convolution.
+ */
+TEST(FixedDspTest, FirFilterStreamsAcrossBlocks)
+{
+    const std::array<fixed, 5> taps { fixed(0.1), fixed(0.2), fixed(0.4), fixed(0.2), fixed(0.1) };
+    tools::fixed_fir_filter<fixed, 5U> streaming(taps);
+    tools::fixed_fir_filter<fixed, 5U> blocks(taps);
+
+    std::vector<fixed> input(37U);
+    for (std::size_t index = 0U; index < input.size(); ++index)
+    {
+        input[index] = fixed(static_cast<double>(index) * 0.25 - 3.0);
+    }
+
+    std::vector<fixed> block_output(input.size());
+    blocks.process(input.data(), block_output.data(), 3U);
+    blocks.process(input.data() + 3, block_output.data() + 3, 20U);
+    blocks.process(std::span<const fixed>(input).subspan(23U), std::span<fixed>(block_output).subspan(23U));
+
+    for (std::size_t index = 0U; index < input.size(); ++index)
+    {
+        double expected = 0.0;
+        for (std::size_t tap = 0U; (tap < taps.size()) && (tap <= index); ++tap)
+        {
+            expected += static_cast<double>(taps[tap]) * static_cast<double>(input[index - tap]);
+        }
+        const fixed sample = streaming.process(input[index]);
+        EXPECT_NEAR(expected, static_cast<double>(sample), 1e-4) << "sample " << index;
+        EXPECT_EQ(sample, block_output[index]);
+    }
+}
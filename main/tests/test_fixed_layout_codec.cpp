@@ -0,0 +1,202 @@
+/**
+ * @file test_fixed_layout_codec.cpp
+ * @brief Unit tests for the compile-time field list codec.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/fixed_layout_codec.hpp"
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+namespace
+{
+    enum class sensor_kind : std::uint16_t
+    {
+        temperature = 0x0102U,
+        pressure = 0x0304U
+    };
+
+    /**
+     * @brief Message without padding, eligible for the single memcpy path.
+     */
+    struct packed_sample
+    {
+        std::uint32_t id = 0U;
+        sensor_kind kind = sensor_kind::temperature;
+        std::int16_t value = 0;
+        std::array<std::uint16_t, 2U> range = {};
+        float scale = 0.0F;
+        std::uint8_t flags[4] = {}; // NOLINT C array field on purpose
+    };
+
+    using packed_codec = tools::fixed_layout_codec<packed_sample, &packed_sample::id, &packed_sample::kind,
+        &packed_sample::value, &packed_sample::range, &packed_sample::scale, &packed_sample::flags>;
+
+    /**
+     * @brief Message with padding between its members.
+     */
+    struct padded_sample
+    {
+        std::uint8_t channel = 0U;
+        std::uint32_t counter = 0U;
+        double reading = 0.0;
+    };
+
+    using padded_codec = tools::fixed_layout_codec<padded_sample, &padded_sample::channel, &padded_sample::counter,
+        &padded_sample::reading>;
+
+    packed_sample make_packed()
+    {
+        packed_sample item;
+        item.id = 0xdeadbeefU;
+        item.kind = sensor_kind::pressure;
+        item.value = -1234;
+        item.range = { 0x1122U, 0x3344U };
+        item.scale = 0.5F;
+        item.flags[0] = 1U;
+        item.flags[3] = 4U;
+        return item;
+    }
+
+    template <std::endian BufferEndian>
+    std::vector<std::uint8_t> bytepack_encode(const packed_sample& item)
+    {
+        bytepack::binary_stream<BufferEndian> stream(64U);
+        EXPECT_TRUE(stream.write(item.id, item.kind, item.value, item.range, item.scale, item.flags));
+        const auto view = stream.data();
+        const auto* first = view.template as<std::uint8_t>();
+        return std::vector<std::uint8_t>(first, first + view.size());
+    }
+}
+
+/**
+ * @brief Test the compile-time size and the layout detection.
+ */
+TEST(FixedLayoutCodecTest, SizeAndLayout)
+{
+    static_assert(packed_codec::encoded_size == 4U + 2U + 2U + 4U + 4U + 4U);
+    static_assert(packed_codec::field_count == 6U);
+    static_assert(padded_codec::encoded_size == 1U + 4U + 8U);
+
+    EXPECT_TRUE(packed_codec::is_memcpy_layout());
+    EXPECT_FALSE(padded_codec::is_memcpy_layout());
+
+    // same fields in another order: the wire layout no longer matches the struct layout
+    using reordered_codec = tools::fixed_layout_codec<packed_sample, &packed_sample::kind, &packed_sample::id,
+        &packed_sample::value, &packed_sample::range, &packed_sample::scale, &packed_sample::flags>;
+    EXPECT_FALSE(reordered_codec::is_memcpy_layout());
+}
+
+/**
+ * @brief Test that the encoding matches binary_stream::write of the same fields, in both endiannesses.
+ */
+TEST(FixedLayoutCodecTest, MatchesBinaryStreamEncoding)
+{
+    const auto item = make_packed();
+
+    const auto big = packed_codec::encode<std::endian::big>(item);
+    EXPECT_EQ(std::vector<std::uint8_t>(big.begin(), big.end()), bytepack_encode<std::endian::big>(item));
+    EXPECT_EQ(0xdeU, big[0]);
+    EXPECT_EQ(0x03U, big[4]);
+
+    const auto little = packed_codec::encode<std::endian::little>(item);
+    EXPECT_EQ(std::vector<std::uint8_t>(little.begin(), little.end()), bytepack_encode<std::endian::little>(item));
+    EXPECT_EQ(0xefU, little[0]);
+}
+
+/**
+ * @brief Test decoding of bytes written by binary_stream.
+ */
+TEST(FixedLayoutCodecTest, DecodesBinaryStreamEncoding)
+{
+    const auto item = make_packed();
+    const auto bytes = bytepack_encode<std::endian::big>(item);
+
+    packed_sample decoded;
+    ASSERT_TRUE(packed_codec::decode(std::span<const std::uint8_t>(bytes), decoded));
+    EXPECT_EQ(item.id, decoded.id);
+    EXPECT_EQ(item.kind, decoded.kind);
+    EXPECT_EQ(item.value, decoded.value);
+    EXPECT_EQ(item.range, decoded.range);
+    EXPECT_EQ(item.scale, decoded.scale);
+    EXPECT_EQ(item.flags[0], decoded.flags[0]);
+    EXPECT_EQ(item.flags[3], decoded.flags[3]);
+}
+
+/**
+ * @brief Test a round trip of a message with padding, field by field.
+ */
+TEST(FixedLayoutCodecTest, PaddedRoundTrip)
+{
+    padded_sample item;
+    item.channel = 7U;
+    item.counter = 0x01020304U;
+    item.reading = -2.25;
+
+    std::array<std::uint8_t, padded_codec::encoded_size> bytes = {};
+    ASSERT_TRUE(padded_codec::encode(item, std::span<std::uint8_t>(bytes)));
+    EXPECT_EQ(7U, bytes[0]);
+    EXPECT_EQ(0x01U, bytes[1]);
+    EXPECT_EQ(0x04U, bytes[4]);
+
+    padded_sample decoded;
+    ASSERT_TRUE(padded_codec::decode(bytes.data(), bytes.size(), decoded));
+    EXPECT_EQ(item.channel, decoded.channel);
+    EXPECT_EQ(item.counter, decoded.counter);
+    EXPECT_EQ(item.reading, decoded.reading);
+}
+
+/**
+ * @brief Test that short buffers are rejected before anything is written.
+ */
+TEST(FixedLayoutCodecTest, RejectsShortBuffers)
+{
+    const auto item = make_packed();
+    std::array<std::uint8_t, packed_codec::encoded_size> bytes = {};
+
+    EXPECT_FALSE(packed_codec::encode(item, bytes.data(), bytes.size() - 1U));
+    EXPECT_EQ(0U, bytes[0]);
+    EXPECT_FALSE(packed_codec::encode(item, nullptr, bytes.size()));
+
+    packed_sample decoded;
+    EXPECT_FALSE(packed_codec::decode(bytes.data(), bytes.size() - 1U, decoded));
+    EXPECT_EQ(0U, decoded.id);
+}
+
+#endif // C++20
@@ -0,0 +1,233 @@
+/**
+ * @file test_fixed_point_batch.cpp
+ * @brief Unit tests checking the fpm::fixed batch kernels bit for bit against the scalar operators.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "fpm/fixed.hpp"
+#include "fpm/math.hpp"
+#include "tools/fixed_point_batch.hpp"
+
+namespace
+{
+    template <typename Fixed>
+    class FixedPointBatchTest : public ::testing::Test
+    {
+    protected:
+        /** @brief Odd length so that every kernel runs its block loop and its tail. */
+        static constexpr std::size_t sample_count = 67U;
+
+        /**
+         * @brief Random values spanning a quarter of the raw range on each side, so scalar sums of a few
+         *        hundred products never overflow the base type.
+         */
+        static std::vector<Fixed> random_values(std::uint32_t seed, bool non_negative = false)
+        {
+            using base_type = decltype(Fixed {}.raw_value());
+            constexpr int shift = (static_cast<int>(sizeof(base_type)) * 8) / 2 + 2;
+            const std::int64_t bound = std::int64_t { 1 } << (shift - 1);
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<std::int64_t> distribution(non_negative ? 0 : -bound, bound);
+
+            std::vector<Fixed> values(sample_count);
+            for (auto& value : values)
+            {
+                value = Fixed::from_raw_value(static_cast<base_type>(distribution(generator)));
+            }
+            return values;
+        }
+    };
+
+    using fixed_types = ::testing::Types<fpm::fixed_16_16, fpm::fixed<std::int32_t, std::int64_t, 16U, false>,
+        fpm::fixed_24_8, fpm::fixed<std::int16_t, std::int32_t, 8U>>;
+    TYPED_TEST_SUITE(FixedPointBatchTest, fixed_types);
+
+    /**
+     * @brief Verifies add, sub, mul and mul_accumulate match the scalar operators, in place as well.
+     */
+    TYPED_TEST(FixedPointBatchTest, element_wise_kernels_match_scalar)
+    {
+        using Fixed = TypeParam;
+        const auto lhs = TestFixture::random_values(1U);
+        const auto rhs = TestFixture::random_values(2U);
+        const std::size_t count = lhs.size();
+
+        std::vector<Fixed> out(count);
+        tools::fixed_batch::add(lhs.data(), rhs.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), (lhs[index] + rhs[index]).raw_value()) << index;
+        }
+
+        tools::fixed_batch::sub(lhs.data(), rhs.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), (lhs[index] - rhs[index]).raw_value()) << index;
+        }
+
+        tools::fixed_batch::mul(lhs.data(), rhs.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), (lhs[index] * rhs[index]).raw_value()) << index;
+        }
+
+        std::vector<Fixed> accumulator = rhs;
+        tools::fixed_batch::mul_accumulate(lhs.data(), lhs.data(), accumulator.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            Fixed expected = rhs[index];
+            expected += lhs[index] * lhs[index];
+            ASSERT_EQ(accumulator[index].raw_value(), expected.raw_value()) << index;
+        }
+
+        std::vector<Fixed> in_place = lhs;
+        tools::fixed_batch::add(in_place.data(), rhs.data(), in_place.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(in_place[index].raw_value(), (lhs[index] + rhs[index]).raw_value()) << index;
+        }
+    }
+
+    /**
+     * @brief Verifies the lane-split dot product equals the sequential sum of rounded products, for every length.
+     */
+    TYPED_TEST(FixedPointBatchTest, dot_matches_sequential_sum)
+    {
+        using Fixed = TypeParam;
+        const auto lhs = TestFixture::random_values(3U);
+        const auto rhs = TestFixture::random_values(4U);
+
+        for (std::size_t count = 0U; count <= lhs.size(); ++count)
+        {
+            Fixed expected { 0 };
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                expected += lhs[index] * rhs[index];
+            }
+            ASSERT_EQ(tools::fixed_batch::dot(lhs.data(), rhs.data(), count).raw_value(), expected.raw_value())
+                << count;
+        }
+    }
+
+    /**
+     * @brief Verifies the FIR filter against the direct convolution, and its output count.
+     */
+    TYPED_TEST(FixedPointBatchTest, fir_matches_direct_convolution)
+    {
+        using Fixed = TypeParam;
+        const auto input = TestFixture::random_values(5U);
+        const auto taps_source = TestFixture::random_values(6U);
+
+        for (std::size_t taps : { std::size_t { 1U }, std::size_t { 3U }, std::size_t { 8U }, std::size_t { 13U } })
+        {
+            std::vector<Fixed> out(input.size());
+            const std::size_t produced
+                = tools::fixed_batch::fir(taps_source.data(), taps, input.data(), input.size(), out.data());
+            ASSERT_EQ(produced, input.size() - taps + 1U);
+
+            for (std::size_t output = 0U; output < produced; ++output)
+            {
+                Fixed expected { 0 };
+                for (std::size_t tap = 0U; tap < taps; ++tap)
+                {
+                    expected += taps_source[tap] * input[output + taps - 1U - tap];
+                }
+                ASSERT_EQ(out[output].raw_value(), expected.raw_value()) << taps << " " << output;
+            }
+        }
+
+        std::vector<Fixed> out(4U);
+        EXPECT_EQ(tools::fixed_batch::fir(taps_source.data(), 0U, input.data(), input.size(), out.data()), 0U);
+        EXPECT_EQ(tools::fixed_batch::fir(taps_source.data(), 5U, input.data(), 4U, out.data()), 0U);
+    }
+
+    /**
+     * @brief Verifies sqrt, sin and cos match the scalar fpm functions.
+     */
+    TYPED_TEST(FixedPointBatchTest, math_kernels_match_scalar)
+    {
+        using Fixed = TypeParam;
+        const auto angles = TestFixture::random_values(7U);
+        const auto positive = TestFixture::random_values(8U, true);
+        const std::size_t count = angles.size();
+
+        std::vector<Fixed> out(count);
+        tools::fixed_batch::sqrt(positive.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), fpm::sqrt(positive[index]).raw_value()) << index;
+        }
+
+        tools::fixed_batch::sin(angles.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), fpm::sin(angles[index]).raw_value()) << index;
+        }
+
+        tools::fixed_batch::cos(angles.data(), out.data(), count);
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            ASSERT_EQ(out[index].raw_value(), fpm::cos(angles[index]).raw_value()) << index;
+        }
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /**
+     * @brief Verifies the span overloads clamp to the shortest span.
+     */
+    TEST(FixedPointBatchSpanTest, span_overloads_use_shortest_length)
+    {
+        using Fixed = fpm::fixed_16_16;
+        const std::vector<Fixed> lhs { Fixed { 1 }, Fixed { 2 }, Fixed { 3 }, Fixed { 4 }, Fixed { 5 } };
+        const std::vector<Fixed> rhs { Fixed { 2 }, Fixed { 2 }, Fixed { 2 } };
+        std::vector<Fixed> out(5U, Fixed { -1 });
+
+        tools::fixed_batch::add<Fixed>(lhs, rhs, out);
+        EXPECT_EQ(out[2], Fixed { 5 });
+        EXPECT_EQ(out[3], Fixed { -1 });
+        EXPECT_EQ(tools::fixed_batch::dot<Fixed>(lhs, rhs), Fixed { 12 });
+
+        const std::vector<Fixed> taps { Fixed { 1 }, Fixed { 1 } };
+        std::vector<Fixed> filtered(4U);
+        EXPECT_EQ(tools::fixed_batch::fir<Fixed>(taps, lhs, filtered), 4U);
+        EXPECT_EQ(filtered[3], Fixed { 9 });
+        std::vector<Fixed> too_small(3U);
+        EXPECT_EQ(tools::fixed_batch::fir<Fixed>(taps, lhs, too_small), 0U);
+    }
+#endif
+
+} // namespace
@@ -0,0 +1,145 @@
+/**
+ * @file test_fixed_trig_table.cpp
+ * @brief Unit tests checking the accuracy and symmetries of the table-driven fpm::fixed trigonometry.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+#include "fpm/fixed.hpp"
+#include "tools/fixed_trig_table.hpp"
+
+namespace
+{
+    using fixed = fpm::fixed_16_16;
+    using trig = tools::fixed_trig_table<fixed>;
+    using nearest_trig = tools::fixed_trig_table<fixed, 8U, false>;
+
+    constexpr double test_pi = 3.14159265358979323846;
+
+    /**
+     * @brief Largest sin/cos error against libm over [-4 pi, 4 pi].
+     */
+    template <typename Table, typename Fixed>
+    double max_sin_cos_error()
+    {
+        double worst = 0.0;
+        for (int step = -4000; step <= 4000; ++step)
+        {
+            const Fixed angle { (4.0 * test_pi * step) / 4000.0 };
+            const double exact = static_cast<double>(angle);
+            worst = std::fmax(worst, std::fabs(static_cast<double>(Table::sin(angle)) - std::sin(exact)));
+            worst = std::fmax(worst, std::fabs(static_cast<double>(Table::cos(angle)) - std::cos(exact)));
+        }
+        return worst;
+    }
+
+    /**
+     * @brief Verifies the interpolated and nearest-entry modes stay within their documented error.
+     */
+    TEST(FixedTrigTableTest, SinCosAccuracy)
+    {
+        EXPECT_LT((max_sin_cos_error<trig, fixed>()), 3.0e-5);
+        EXPECT_LT((max_sin_cos_error<nearest_trig, fixed>()), 4.0e-3);
+        EXPECT_LT((max_sin_cos_error<tools::fixed_trig_table<fixed, 12U>, fixed>()), 2.0e-5);
+        EXPECT_LT((max_sin_cos_error<tools::fixed_trig_table<fpm::fixed_24_8>, fpm::fixed_24_8>()), 1.5e-2);
+        EXPECT_LT((max_sin_cos_error<tools::fixed_trig_table<fpm::fixed_8_24>, fpm::fixed_8_24>()), 2.0e-5);
+    }
+
+    /**
+     * @brief Verifies exact values at the quadrant boundaries and the odd/even symmetries.
+     */
+    TEST(FixedTrigTableTest, QuadrantsAndSymmetry)
+    {
+        EXPECT_EQ(trig::sin(fixed { 0 }).raw_value(), 0);
+        EXPECT_EQ(trig::cos(fixed { 0 }).raw_value(), fixed { 1 }.raw_value());
+        EXPECT_NEAR(static_cast<double>(trig::sin(fixed::half_pi())), 1.0, 2.0e-5);
+        EXPECT_NEAR(static_cast<double>(trig::sin(fixed::pi())), 0.0, 2.0e-5);
+        EXPECT_NEAR(static_cast<double>(trig::cos(fixed::pi())), -1.0, 2.0e-5);
+        EXPECT_NEAR(static_cast<double>(trig::sin(-fixed::half_pi())), -1.0, 2.0e-5);
+
+        for (int step = 1; step < 200; ++step)
+        {
+            const fixed angle { 0.031 * step };
+            EXPECT_NEAR(static_cast<double>(trig::sin(-angle)), -static_cast<double>(trig::sin(angle)), 3.0e-5);
+            EXPECT_NEAR(static_cast<double>(trig::cos(-angle)), static_cast<double>(trig::cos(angle)), 3.0e-5);
+        }
+    }
+
+    /**
+     * @brief Verifies atan2 against libm around the whole circle and at several radii.
+     */
+    TEST(FixedTrigTableTest, Atan2Accuracy)
+    {
+        for (const double radius : { 0.01, 1.0, 300.0 })
+        {
+            for (int step = -180; step <= 180; ++step)
+            {
+                const double angle = (test_pi * step) / 180.5;
+                const fixed y_value { radius * std::sin(angle) };
+                const fixed x_value { radius * std::cos(angle) };
+                const double exact = std::atan2(static_cast<double>(y_value), static_cast<double>(x_value));
+                EXPECT_NEAR(static_cast<double>(trig::atan2(y_value, x_value)), exact, 3.0e-5)
+                    << "radius " << radius << " step " << step;
+            }
+        }
+    }
+
+    /**
+     * @brief Verifies atan2 on the axes, including the origin.
+     */
+    TEST(FixedTrigTableTest, Atan2Axes)
+    {
+        const fixed one { 1 };
+        const fixed zero { 0 };
+        EXPECT_EQ(trig::atan2(zero, zero).raw_value(), 0);
+        EXPECT_EQ(trig::atan2(zero, one).raw_value(), 0);
+        EXPECT_EQ(trig::atan2(one, zero).raw_value(), fixed::half_pi().raw_value());
+        EXPECT_EQ(trig::atan2(-one, zero).raw_value(), -fixed::half_pi().raw_value());
+        EXPECT_EQ(trig::atan2(zero, -one).raw_value(), fixed::pi().raw_value());
+        EXPECT_NEAR(static_cast<double>(trig::atan2(one, one)), test_pi / 4.0, 2.0e-5);
+        EXPECT_NEAR(static_cast<double>(nearest_trig::atan2(-one, -one)), -0.75 * test_pi, 4.0e-3);
+    }
+
+    /**
+     * @brief Verifies the table footprint reported for the default configuration.
+     */
+    TEST(FixedTrigTableTest, TableFootprint)
+    {
+        static_assert(trig::table_entries == 257U);
+        static_assert(trig::table_bytes == 2U * 257U * sizeof(std::int32_t));
+        static_assert(tools::fixed_trig_table<fpm::fixed<std::int16_t, std::int32_t, 8U>>::table_bytes
+            == 2U * 257U * sizeof(std::int16_t));
+    }
+
+} // namespace
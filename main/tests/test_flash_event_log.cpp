@@ -0,0 +1,321 @@
+/**
+ * @file test_flash_event_log.cpp
+ * @brief Unit tests for the flash event log.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "tools/flash_event_log.hpp"
+#include "tools/linux/linux_flash_log_file.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace
+{
+    // NOR flash in RAM: erasing sets the bits, programming can only clear them
+    class ram_flash
+    {
+    public:
+        ram_flash(std::size_t segment_count, std::size_t segment_size, std::size_t page_size)
+            : m_bytes(segment_count * segment_size, 0xFFU)
+            , m_segment_count(segment_count)
+            , m_segment_size(segment_size)
+            , m_page_size(page_size)
+            , m_erase_counts(segment_count, 0U)
+        {
+        }
+
+        [[nodiscard]] std::size_t segment_count() const
+        {
+            return m_segment_count;
+        }
+
+        [[nodiscard]] std::size_t segment_size() const
+        {
+            return m_segment_size;
+        }
+
+        [[nodiscard]] std::size_t page_size() const
+        {
+            return m_page_size;
+        }
+
+        bool erase(std::size_t segment)
+        {
+            std::fill_n(m_bytes.begin() + static_cast<std::ptrdiff_t>(segment * m_segment_size), m_segment_size, 0xFFU);
+            ++m_erase_counts[segment];
+            return true;
+        }
+
+        bool write(std::size_t segment, std::size_t offset, std::span<const std::uint8_t> bytes)
+        {
+            for (std::size_t index = 0U; index < bytes.size(); ++index)
+            {
+                m_bytes[(segment * m_segment_size) + offset + index] &= bytes[index];
+            }
+            ++m_writes;
+            return true;
+        }
+
+        bool read(std::size_t segment, std::size_t offset, std::span<std::uint8_t> bytes)
+        {
+            std::copy_n(m_bytes.begin() + static_cast<std::ptrdiff_t>((segment * m_segment_size) + offset),
+                bytes.size(), bytes.begin());
+            return true;
+        }
+
+        std::vector<std::uint8_t> m_bytes;
+        std::size_t m_segment_count;
+        std::size_t m_segment_size;
+        std::size_t m_page_size;
+        std::vector<std::uint32_t> m_erase_counts;
+        std::size_t m_writes = 0U;
+    };
+
+    using ram_log = tools::flash_event_log<ram_flash>;
+
+    bool append_value(ram_log& log, std::uint64_t timestamp, std::uint32_t value)
+    {
+        return log.append(timestamp,
+            [value](bytepack::binary_stream<std::endian::big>& stream) { return stream.write(value); });
+    }
+
+    std::vector<std::uint32_t> read_values(ram_log& log, std::size_t max_records)
+    {
+        std::vector<std::uint32_t> values;
+        static_cast<void>(log.tail(max_records,
+            [&values](std::uint64_t /*timestamp_us*/, std::span<const std::uint8_t> payload)
+            {
+                values.push_back(static_cast<std::uint32_t>(tools::detail::load_be(payload.data(), payload.size())));
+            }));
+        return values;
+    }
+
+    class collecting_observer : public tools::sync_observer<std::string, std::int32_t>
+    {
+    public:
+        void inform(const std::string& topic, const std::int32_t& event, const std::string& origin) override
+        {
+            (void)origin;
+            topics.push_back(topic);
+            events.push_back(event);
+        }
+
+        std::vector<std::string> topics;
+        std::vector<std::int32_t> events;
+    };
+}
+
+// Records are batched into page-sized blocks: nothing reaches the storage before a block is sealed and flushed.
+TEST(FlashEventLogTest, BatchesRecordsIntoBlocks)
+{
+    ram_flash flash(4U, 1024U, 128U);
+    ram_log log(flash);
+    ASSERT_TRUE(log.valid());
+    const std::size_t format_writes = flash.m_writes;
+
+    // a block holds (128 - 12) / (12 + 4) = 7 records
+    for (std::uint32_t value = 0U; value < 20U; ++value)
+    {
+        EXPECT_TRUE(append_value(log, value, value));
+    }
+    EXPECT_EQ(format_writes, flash.m_writes);
+    EXPECT_EQ(0U, log.record_count());
+
+    EXPECT_EQ(2U, log.flush());
+    EXPECT_EQ(format_writes + 2U, flash.m_writes);
+    EXPECT_EQ(14U, log.record_count());
+    EXPECT_EQ(1U, log.sync());
+    EXPECT_EQ(20U, log.record_count());
+
+    std::vector<std::uint64_t> timestamps;
+    EXPECT_EQ(20U, log.for_each([&timestamps](std::uint64_t timestamp_us, std::span<const std::uint8_t> /*payload*/)
+                   { timestamps.push_back(timestamp_us); }));
+    ASSERT_EQ(20U, timestamps.size());
+    EXPECT_EQ(19U, timestamps.back());
+    EXPECT_EQ((std::vector<std::uint32_t> { 17U, 18U, 19U }), read_values(log, 3U));
+
+    const auto stats = log.stats();
+    EXPECT_EQ(20U, stats.events);
+    EXPECT_EQ(3U, stats.blocks_written);
+    EXPECT_EQ(0U, stats.dropped_events);
+}
+
+// Appends are refused once every RAM block waits for a flush, and records larger than a block are dropped.
+TEST(FlashEventLogTest, DropsWhenBlocksArePending)
+{
+    ram_flash flash(2U, 512U, 64U);
+    ram_log log(flash, 1U);
+    ASSERT_TRUE(log.valid());
+
+    // a block holds 3 records; one sealed block may wait, the second one fills up
+    std::size_t accepted = 0U;
+    for (std::uint32_t value = 0U; value < 10U; ++value)
+    {
+        accepted += append_value(log, value, value) ? 1U : 0U;
+    }
+    EXPECT_EQ(6U, accepted);
+    EXPECT_EQ(4U, log.stats().dropped_events);
+    EXPECT_EQ(1U, log.flush());
+    EXPECT_TRUE(append_value(log, 10U, 10U));
+
+    const std::vector<std::uint8_t> large(100U, 1U);
+    EXPECT_FALSE(log.append(11U,
+        [&large](bytepack::binary_stream<std::endian::big>& stream)
+        {
+            for (const std::uint8_t byte : large)
+            {
+                if (!stream.write(byte))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }));
+    EXPECT_EQ(5U, log.stats().dropped_events);
+}
+
+// Wrapping recycles the oldest segment, the erasures stay even, and a reopened log finds its tail again.
+TEST(FlashEventLogTest, WrapsAroundSegmentsAndReopens)
+{
+    ram_flash flash(4U, 512U, 64U);
+    {
+        ram_log log(flash);
+        for (std::uint32_t value = 0U; value < 300U; ++value)
+        {
+            EXPECT_TRUE(append_value(log, value, value));
+            static_cast<void>(log.flush());
+        }
+        static_cast<void>(log.sync());
+
+        const auto stats = log.stats();
+        EXPECT_GT(stats.segments_recycled, 0U);
+        EXPECT_LE(stats.max_erase_count - stats.min_erase_count, 1U);
+        EXPECT_EQ((std::vector<std::uint32_t> { 297U, 298U, 299U }), read_values(log, 3U));
+    }
+
+    // 7 blocks of 3 records per segment: the 3 newest segments hold the last records
+    ram_log reopened(flash);
+    ASSERT_TRUE(reopened.valid());
+    const std::uint64_t stored = reopened.record_count();
+    EXPECT_GT(stored, 63U);
+    EXPECT_LT(stored, 300U);
+    const auto values = read_values(reopened, 1000U);
+    ASSERT_EQ(stored, values.size());
+    EXPECT_EQ(299U, values.back());
+    EXPECT_EQ(300U - stored, values.front());
+
+    EXPECT_TRUE(append_value(reopened, 300U, 300U));
+    static_cast<void>(reopened.sync());
+    EXPECT_EQ((std::vector<std::uint32_t> { 299U, 300U }), read_values(reopened, 2U));
+}
+
+// A block with a damaged payload fails its CRC and is skipped, the other blocks are still read.
+TEST(FlashEventLogTest, SkipsCorruptedBlocks)
+{
+    ram_flash flash(2U, 512U, 64U);
+    ram_log log(flash);
+    for (std::uint32_t value = 0U; value < 9U; ++value)
+    {
+        EXPECT_TRUE(append_value(log, value, value));
+    }
+    EXPECT_EQ(3U, log.sync());
+
+    // second block of the first segment, first record payload
+    flash.m_bytes[(2U * 64U) + tools::flash_event_log_block_header_size + tools::event_log_record_header_size] = 0x5AU;
+    EXPECT_EQ((std::vector<std::uint32_t> { 0U, 1U, 2U, 6U, 7U, 8U }), read_values(log, 100U));
+    EXPECT_EQ(1U, log.stats().corrupted_blocks);
+}
+
+// The events of a subject are recorded through the observer and replayed into another subject.
+TEST(FlashEventLogTest, RecordsAndReplaysSubject)
+{
+    ram_flash flash(2U, 1024U, 128U);
+    ram_log log(flash);
+    tools::sync_subject<std::string, std::int32_t> production("production");
+    auto recorder = std::make_shared<tools::flash_event_log_recorder<ram_flash, std::string, std::int32_t>>(log);
+    production.subscribe("speed", recorder);
+    production.subscribe("heading", recorder);
+    production.publish("speed", 12);
+    production.publish("heading", -90);
+    production.publish("speed", 13);
+    static_cast<void>(log.sync());
+
+    tools::sync_subject<std::string, std::int32_t> bench("bench");
+    auto observer = std::make_shared<collecting_observer>();
+    bench.subscribe("speed", observer);
+    bench.subscribe("heading", observer);
+    EXPECT_EQ(2U, tools::replay_flash_event_log(log, bench, 2U));
+    EXPECT_EQ((std::vector<std::string> { "heading", "speed" }), observer->topics);
+    EXPECT_EQ((std::vector<std::int32_t> { -90, 13 }), observer->events);
+}
+
+#if defined(__linux__)
+// The file storage keeps the log across a close and reopen, as a flash partition across a reboot.
+TEST(FlashEventLogTest, PersistsInPreallocatedFile)
+{
+    const std::string path = "/tmp/pubsub_flash_log_" + std::to_string(getpid()) + ".bin";
+    {
+        tools::linux_os::flash_log_file file(path, 4U, 4096U, 512U, false);
+        ASSERT_TRUE(file.valid());
+        tools::flash_event_log<tools::linux_os::flash_log_file> log(file);
+        for (std::uint32_t value = 0U; value < 100U; ++value)
+        {
+            EXPECT_TRUE(log.append(value,
+                [value](bytepack::binary_stream<std::endian::big>& stream) { return stream.write(value); }));
+            static_cast<void>(log.flush());
+        }
+    }
+    {
+        tools::linux_os::flash_log_file file(path, 4U, 4096U, 512U, false);
+        tools::flash_event_log<tools::linux_os::flash_log_file> log(file);
+        EXPECT_EQ(100U, log.record_count());
+        std::uint64_t last = 0U;
+        EXPECT_EQ(1U, log.tail(1U, [&last](std::uint64_t timestamp_us, std::span<const std::uint8_t> /*payload*/)
+                                 { last = timestamp_us; }));
+        EXPECT_EQ(99U, last);
+    }
+    EXPECT_EQ(0, unlink(path.c_str()));
+}
+#endif
@@ -0,0 +1,210 @@
+/**
+ * @file test_flat_hash_map.cpp
+ * @brief Unit tests for the flat_hash_map open-addressing container.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "tools/flat_hash_map.hpp"
+
+/**
+ * @brief Test insertion, update, lookup and erase through the std-like interface.
+ */
+TEST(FlatHashMapTest, InsertFindUpdateErase)
+{
+    tools::flat_hash_map<std::string, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.end(), map.find("missing"));
+    EXPECT_EQ(0U, map.erase("missing"));
+
+    auto [itr, inserted] = map.insert_or_assign(std::string("one"), 1);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(1, itr->second);
+
+    std::tie(itr, inserted) = map.insert_or_assign(std::string("one"), 11);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(11, itr->second);
+
+    map["two"] = 2;
+    EXPECT_EQ(2U, map.size());
+    EXPECT_TRUE(map.contains("two"));
+    EXPECT_EQ(1U, map.count("one"));
+
+    EXPECT_EQ(1U, map.erase("one"));
+    EXPECT_FALSE(map.contains("one"));
+    EXPECT_EQ(1U, map.size());
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.cbegin(), map.cend());
+}
+
+/**
+ * @brief Test that growth and backward-shift erases keep every key reachable, checked against std::unordered_map.
+ */
+TEST(FlatHashMapTest, MatchesUnorderedMapUnderChurn)
+{
+    tools::flat_hash_map<std::uint32_t, std::uint32_t> map;
+    std::unordered_map<std::uint32_t, std::uint32_t> reference;
+    std::uint32_t seed = 12345U;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+        // small key space and strided keys make collisions and long probe runs likely
+        const std::uint32_t key = ((seed >> 16U) % 2048U) * 64U;
+
+        if ((seed & 3U) == 0U)
+        {
+            EXPECT_EQ(reference.erase(key), map.erase(key));
+        }
+        else
+        {
+            reference.insert_or_assign(key, seed);
+            map.insert_or_assign(key, seed);
+        }
+    }
+
+    ASSERT_EQ(reference.size(), map.size());
+
+    for (const auto& [key, value] : reference)
+    {
+        const auto itr = map.find(key);
+        ASSERT_NE(map.end(), itr);
+        EXPECT_EQ(value, itr->second);
+    }
+
+    std::size_t visited = 0U;
+    for (const auto& entry : map)
+    {
+        EXPECT_EQ(1U, reference.count(entry.first));
+        ++visited;
+    }
+    EXPECT_EQ(reference.size(), visited);
+    EXPECT_LE(map.size() * 4U, map.capacity() * 3U);
+}
+
+/**
+ * @brief Test that reserve() pre-sizes the table and that copies are independent.
+ */
+TEST(FlatHashMapTest, ReserveAndCopy)
+{
+    tools::flat_hash_map<int, int> map(100U);
+    const std::size_t capacity = map.capacity();
+    EXPECT_GE(capacity * 3U, 100U * 4U);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        map.insert_or_assign(i, i * i);
+    }
+    EXPECT_EQ(capacity, map.capacity());
+
+    auto copy = map;
+    copy.erase(5);
+    EXPECT_TRUE(map.contains(5));
+    EXPECT_FALSE(copy.contains(5));
+    EXPECT_EQ(81, copy.find(9)->second);
+}
+
+/**
+ * @brief Test that the fixed storage is inline, holds exactly its capacity and reports a full table.
+ */
+TEST(FlatHashMapTest, FixedStorageNeverAllocates)
+{
+    using map_t = tools::fixed_flat_hash_map<std::uint16_t, std::uint32_t, 100U>;
+    static_assert(map_t::fixed_storage, "fixed_flat_hash_map must use inline storage");
+
+    map_t map;
+    EXPECT_EQ(100U, map.max_size());
+    const std::size_t capacity = map.capacity();
+    EXPECT_GE(capacity * 3U, 100U * 4U);
+
+    for (std::uint16_t key = 0U; key < 100U; ++key)
+    {
+        EXPECT_TRUE(map.insert_or_assign(static_cast<std::uint16_t>(key * 37U), key).second);
+    }
+
+    const auto [itr, inserted] = map.insert_or_assign(std::uint16_t{ 1U }, 1U);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(map.end(), itr);
+    EXPECT_EQ(100U, map.size());
+    EXPECT_EQ(capacity, map.capacity());
+
+    // updates of present keys and inserts after an erase still work when full
+    EXPECT_FALSE(map.insert_or_assign(std::uint16_t{ 37U }, 7U).second);
+    EXPECT_EQ(7U, map.find(37U)->second);
+    EXPECT_EQ(1U, map.erase(37U));
+    EXPECT_TRUE(map.insert_or_assign(std::uint16_t{ 1U }, 1U).second);
+
+    for (std::uint16_t key = 2U; key < 100U; ++key)
+    {
+        EXPECT_EQ(key, map.find(static_cast<std::uint16_t>(key * 37U))->second);
+    }
+}
+
+/**
+ * @brief Test fixed storage churn against std::unordered_map, exercising Robin Hood moves and backward shifts.
+ */
+TEST(FlatHashMapTest, FixedStorageMatchesUnorderedMapUnderChurn)
+{
+    tools::fixed_flat_hash_map<std::uint32_t, std::uint32_t, 48U> map;
+    std::unordered_map<std::uint32_t, std::uint32_t> reference;
+    std::uint32_t seed = 777U;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+        const std::uint32_t key = (seed >> 20U) % 96U;
+
+        if (((seed & 1U) == 0U) || (reference.size() >= 48U))
+        {
+            EXPECT_EQ(reference.erase(key), map.erase(key));
+        }
+        else
+        {
+            reference.insert_or_assign(key, seed);
+            EXPECT_NE(map.end(), map.insert_or_assign(key, seed).first);
+        }
+    }
+
+    ASSERT_EQ(reference.size(), map.size());
+    for (const auto& [key, value] : reference)
+    {
+        ASSERT_TRUE(map.contains(key));
+        EXPECT_EQ(value, map.find(key)->second);
+    }
+}
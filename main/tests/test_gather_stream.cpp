@@ -0,0 +1,210 @@
+/**
+ * @file test_gather_stream.cpp
+ * @brief Unit tests for the scatter-gather serialization of header fields and referenced payloads.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "tools/gather_stream.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/memory_pipe.hpp"
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::milli> short_timeout(100U);
+
+    std::vector<std::uint8_t> make_payload(std::size_t size)
+    {
+        std::vector<std::uint8_t> payload(size);
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            payload[i] = static_cast<std::uint8_t>((i * 7U) ^ (i >> 5U));
+        }
+        return payload;
+    }
+
+    std::vector<std::uint8_t> join(std::span<const tools::gather_segment> segments)
+    {
+        std::vector<std::uint8_t> joined;
+        for (const auto& segment : segments)
+        {
+            joined.insert(joined.end(), segment.data, segment.data + segment.size); // NOLINT pointer arithmetic
+        }
+        return joined;
+    }
+
+    /**
+     * @brief Writes a header, a referenced payload and a trailer field.
+     */
+    template <typename Writer>
+    void write_frame(Writer& writer, const std::vector<std::uint8_t>& payload)
+    {
+        ASSERT_TRUE(writer.stream().write(std::uint32_t { 0xcafe0001U }, static_cast<std::uint32_t>(payload.size())));
+        ASSERT_TRUE(writer.reference(payload.data(), payload.size()));
+        ASSERT_TRUE(writer.stream().write(std::uint16_t { 0xbeefU }));
+    }
+} // namespace
+
+/**
+ * @brief Test case for a header plus payload frame.
+ *
+ * @test
+ * - Write two header fields, reference a 4 KB payload and write a trailer field.
+ * - Verify the list has three segments, the payload one pointing at the caller buffer.
+ * - Verify the joined bytes are the fields in big endian around the payload.
+ */
+TEST(GatherStreamTest, HeaderPlusPayloadWithoutCopy)
+{
+    const auto payload = make_payload(4096U);
+    tools::gather_writer<> writer(64U);
+    write_frame(writer, payload);
+
+    EXPECT_EQ(8U + payload.size() + 2U, writer.total_size());
+    const auto segments = writer.segments();
+    ASSERT_EQ(3U, segments.size());
+    EXPECT_EQ(payload.data(), segments[1].data);
+    EXPECT_EQ(payload.size(), segments[1].size);
+    EXPECT_EQ(writer.total_size(), tools::gather_size(segments));
+
+    const auto joined = join(segments);
+    ASSERT_EQ(writer.total_size(), joined.size());
+    EXPECT_EQ(0xcaU, joined[0]);
+    EXPECT_EQ(0x10U, joined[6]); // 4096 = 0x1000
+    EXPECT_TRUE(std::equal(payload.begin(), payload.end(), joined.begin() + 8));
+    EXPECT_EQ(0xbeU, joined[joined.size() - 2U]);
+    EXPECT_EQ(0xefU, joined.back());
+
+    writer.reset();
+    EXPECT_EQ(0U, writer.total_size());
+    EXPECT_TRUE(writer.segments().empty());
+}
+
+/**
+ * @brief Test case for a full segment table.
+ *
+ * @test
+ * - Fill a two segment writer with a field and a reference.
+ * - Verify a further reference is refused and a pending field makes segments() return an empty list.
+ */
+TEST(GatherStreamTest, SegmentTableFull)
+{
+    const auto payload = make_payload(32U);
+    tools::gather_writer<2U> writer(16U);
+    ASSERT_TRUE(writer.stream().write(std::uint8_t { 1U }));
+    ASSERT_TRUE(writer.reference(payload.data(), payload.size()));
+    EXPECT_FALSE(writer.reference(payload.data(), payload.size()));
+    EXPECT_EQ(2U, writer.segments().size());
+
+    ASSERT_TRUE(writer.stream().write(std::uint8_t { 2U }));
+    EXPECT_TRUE(writer.segments().empty());
+}
+
+/**
+ * @brief Test case for the gather consumers.
+ *
+ * @test
+ * - Send a gather list into a memory_pipe and receive the joined bytes.
+ * - Compress it with compress_gather() and verify gzip_wrapper::unpack() restores the joined bytes.
+ * - Verify a destination below compress_gather_bound() is refused.
+ */
+TEST(GatherStreamTest, PipeAndCompressionConsumeList)
+{
+    const auto payload = make_payload(3000U);
+    tools::gather_writer<> writer(64U);
+    write_frame(writer, payload);
+    const auto segments = writer.segments();
+    const auto expected = join(segments);
+
+    tools::memory_pipe pipe(8192U);
+    ASSERT_EQ(expected.size(), tools::send_gather(pipe, segments, short_timeout));
+    std::vector<std::uint8_t> received(expected.size());
+    ASSERT_EQ(expected.size(), pipe.receive(received.data(), received.size(), short_timeout));
+    EXPECT_EQ(expected, received);
+
+    tools::gzip_stream_compressor compressor;
+    std::vector<std::uint8_t> packed(tools::compress_gather_bound(segments));
+    const auto length = tools::compress_gather(compressor, segments, packed.data(), packed.size());
+    ASSERT_TRUE(length.has_value());
+    packed.resize(*length);
+    tools::gzip_wrapper wrapper;
+    EXPECT_EQ(expected, wrapper.unpack(packed));
+
+    const auto refused = tools::compress_gather(compressor, segments, packed.data(), 16U);
+    ASSERT_FALSE(refused.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::output_too_small, refused.error());
+}
+
+#if defined(__linux__)
+/**
+ * @brief Test case for writev() of a gather list.
+ *
+ * @test
+ * - Write a list of 20 segments (more than one writev() batch) into a pipe descriptor.
+ * - Read it back and verify the joined bytes.
+ */
+TEST(GatherStreamTest, WritesToDescriptor)
+{
+    const auto payload = make_payload(512U);
+    tools::gather_writer<24U> writer(128U);
+    for (std::uint16_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_TRUE(writer.stream().write(i));
+        ASSERT_TRUE(writer.reference(payload.data() + (i * 16U), 16U)); // NOLINT pointer arithmetic
+    }
+    const auto segments = writer.segments();
+    ASSERT_EQ(20U, segments.size());
+    const auto expected = join(segments);
+
+    std::array<int, 2> descriptors = {};
+    ASSERT_EQ(0, ::pipe(descriptors.data()));
+    EXPECT_EQ(expected.size(), tools::write_gather(descriptors[1], segments));
+    std::vector<std::uint8_t> received(expected.size());
+    EXPECT_EQ(static_cast<ssize_t>(received.size()), ::read(descriptors[0], received.data(), received.size()));
+    ::close(descriptors[0]);
+    ::close(descriptors[1]);
+    EXPECT_EQ(expected, received);
+}
+#endif
+
+#endif // C++20
@@ -194,6 +194,38 @@ TEST_F(GenericTaskTest, TaskWithDefaultPriorityAndAffinity)
     ASSERT_EQ(task1->priority(), tools::base_task::default_priority);
 }
 
+/**
+ * @brief Test case for a task constructed on caller-provided storage.
+ *
+ * The task runs its routine and takes its stack size from the storage view.
+ */
+TEST_F(GenericTaskTest, TaskRunsInStaticStorage)
+{
+    static tools::static_task_storage<2048> storage;
+
+    context1->value.store(0);
+
+    auto callback = [](const std::shared_ptr<TestContext>& ctx, const std::string& task_name)
+    {
+        (void)task_name;
+        ctx->value.store(7);
+    };
+
+    const tools::task_storage view = storage.view();
+    ASSERT_TRUE(view.valid());
+    ASSERT_FALSE(tools::task_storage {}.valid());
+
+    auto task1 = std::make_unique<TestTask>(std::move(callback), context1, "TestTaskStatic", view, 0, 1);
+
+    ASSERT_EQ(task1->stack_size(), 2048U);
+    ASSERT_EQ(task1->cpu_affinity(), 0);
+    ASSERT_EQ(task1->priority(), 1);
+
+    task1.reset(); // Explicitly reset the task to join the thread
+
+    ASSERT_EQ(context1->value.load(), 7);
+}
+
 /**
  * @brief Test case for verifying communication between two tasks.
  *
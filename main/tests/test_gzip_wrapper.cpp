@@ -40,10 +40,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
+#include "portable_concurrency/thread_pool.hpp"
+#include "tools/checksum.hpp"
 #include "tools/gzip_wrapper.hpp"
+#include "uzlib/uzlib.h"
 
 /**
  * @brief Test fixture for gzip_wrapper tests.
@@ -196,6 +203,46 @@ TEST_F(GzipWrapperTest, UnpackCorruptedData)
 }
 #endif
 
+/**
+ * @brief Test case for the expected-returning pack and unpack.
+ *
+ * @test
+ * - A round trip through pack_result() and unpack_result() restores the data.
+ * - Too short, corrupted and length-mismatched inputs report truncated, checksum_error and length_error.
+ */
+TEST_F(GzipWrapperTest, ResultVariantsReportErrorCodes)
+{
+    std::vector<std::uint8_t> original_data(256U);
+    for (std::size_t index = 0U; index < original_data.size(); ++index)
+    {
+        original_data[index] = static_cast<std::uint8_t>(index % 7U);
+    }
+
+    const auto packed = gzip.pack_result(original_data);
+    ASSERT_TRUE(packed.has_value());
+    const auto unpacked = gzip.unpack_result(packed.value());
+    ASSERT_TRUE(unpacked.has_value());
+    EXPECT_EQ(unpacked.value(), original_data);
+
+    const auto too_short = gzip.unpack_result({ 0x1f, 0x8b, 0x08 });
+    ASSERT_FALSE(too_short.has_value());
+    EXPECT_EQ(too_short.error(), tools::gzip_stream_error::truncated);
+
+    // the CRC32 is the 4 bytes before the trailing length
+    auto bad_crc = packed.value();
+    bad_crc[bad_crc.size() - 8U] ^= 0xffU;
+    const auto crc_result = gzip.unpack_result(bad_crc);
+    ASSERT_FALSE(crc_result.has_value());
+    EXPECT_EQ(crc_result.error(), tools::gzip_stream_error::checksum_error);
+    EXPECT_TRUE(gzip.unpack(bad_crc).empty());
+
+    auto bad_length = packed.value();
+    bad_length[bad_length.size() - 4U] ^= 0x01U;
+    const auto length_result = gzip.unpack_result(bad_length);
+    ASSERT_FALSE(length_result.has_value());
+    EXPECT_EQ(length_result.error(), tools::gzip_stream_error::length_error);
+}
+
 /**
  * @brief Test case for unpacking truncated gzip data.
  *
@@ -243,3 +290,756 @@ TEST_F(GzipWrapperTest, UnpackDataWithInvalidCRC)
 
     ASSERT_TRUE(unpacked_data.empty());
 }
+
+/**
+ * @brief Builds a compressible payload of repeated log-like lines with a changing counter.
+ */
+static std::vector<std::uint8_t> make_log_payload(std::size_t size)
+{
+    std::vector<std::uint8_t> payload;
+    payload.reserve(size);
+    std::uint32_t line = 0U;
+    while (payload.size() < size)
+    {
+        const std::string text = "[INFO] sensor sample " + std::to_string(line++) + " value=42\n";
+        for (const char c : text)
+        {
+            if (payload.size() < size)
+            {
+                payload.push_back(static_cast<std::uint8_t>(c));
+            }
+        }
+    }
+    return payload;
+}
+
+/**
+ * @brief Test that a stream compressed chunk by chunk into a caller buffer unpacks to the input.
+ */
+TEST_F(GzipWrapperTest, StreamCompressorChunksRoundTrip)
+{
+    const auto original_data = make_log_payload(20000U);
+    tools::gzip_stream_compressor compressor;
+
+    std::vector<std::uint8_t> packed(tools::gzip_stream_compressor::compress_bound(original_data.size()));
+    std::size_t written = 0U;
+
+    auto result = compressor.init(packed.data(), packed.size());
+    ASSERT_TRUE(result.has_value());
+    written += result.value();
+
+    // uneven chunk sizes, including empty and shorter than a match
+    const std::vector<std::size_t> chunk_sizes = { 1U, 2U, 0U, 777U, 4096U, 5U, 9000U };
+    std::size_t offset = 0U;
+    std::size_t chunk_index = 0U;
+    while (offset < original_data.size())
+    {
+        const std::size_t chunk
+            = std::min(chunk_sizes[chunk_index++ % chunk_sizes.size()], original_data.size() - offset);
+        result = compressor.update(
+            original_data.data() + offset, chunk, packed.data() + written, packed.size() - written);
+        ASSERT_TRUE(result.has_value());
+        written += result.value();
+        offset += chunk;
+    }
+
+    result = compressor.finish(packed.data() + written, packed.size() - written);
+    ASSERT_TRUE(result.has_value());
+    written += result.value();
+    ASSERT_FALSE(compressor.active());
+
+    packed.resize(written);
+    ASSERT_LT(packed.size(), original_data.size() / 2U);
+    ASSERT_EQ(original_data, gzip.unpack(packed));
+}
+
+/**
+ * @brief Test that the compressor can be reused for consecutive streams without clearing state.
+ */
+TEST_F(GzipWrapperTest, StreamCompressorReusedAcrossStreams)
+{
+    tools::gzip_stream_compressor compressor;
+
+    for (std::size_t size : { 300U, 5000U, 64U })
+    {
+        const auto original_data = make_log_payload(size);
+        std::vector<std::uint8_t> packed(tools::gzip_stream_compressor::compress_bound(size));
+
+        std::size_t written = compressor.init(packed.data(), packed.size()).value();
+        written += compressor.update(original_data.data(), size, packed.data() + written, packed.size() - written)
+                       .value();
+        written += compressor.finish(packed.data() + written, packed.size() - written).value();
+        packed.resize(written);
+
+        ASSERT_EQ(original_data, gzip.unpack(packed));
+    }
+}
+
+/**
+ * @brief Test that undersized destinations and calls outside a stream are rejected without side effects.
+ */
+TEST_F(GzipWrapperTest, StreamCompressorRejectsInvalidCalls)
+{
+    tools::gzip_stream_compressor compressor;
+    std::array<std::uint8_t, 64U> output = {};
+    const std::array<std::uint8_t, 4U> input = { 1U, 2U, 3U, 4U };
+
+    auto result = compressor.update(input.data(), input.size(), output.data(), output.size());
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::not_started, result.error());
+
+    result = compressor.init(output.data(), tools::gzip_stream_compressor::header_size - 1U);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::output_too_small, result.error());
+
+    std::size_t written = compressor.init(output.data(), output.size()).value();
+    result = compressor.update(input.data(), input.size(), output.data() + written, 1U);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::output_too_small, result.error());
+
+    // the rejected call consumed nothing: the stream still holds the full input
+    written += compressor.update(input.data(), input.size(), output.data() + written, output.size() - written)
+                   .value();
+    written += compressor.finish(output.data() + written, output.size() - written).value();
+
+    const std::vector<std::uint8_t> packed(output.begin(), output.begin() + static_cast<std::ptrdiff_t>(written));
+    ASSERT_EQ(std::vector<std::uint8_t>(input.begin(), input.end()), gzip.unpack(packed));
+}
+
+/**
+ * @brief Test that the decoder inflates a stream fed in uneven chunks through a sink.
+ */
+TEST_F(GzipWrapperTest, StreamDecoderFeedsChunksToSink)
+{
+    const auto original_data = make_log_payload(50000U);
+    const auto packed = gzip.pack(original_data);
+    tools::gzip_stream_decoder decoder;
+
+    std::vector<std::uint8_t> unpacked;
+    const auto sink = [&unpacked](const std::uint8_t* data, std::size_t size)
+    { unpacked.insert(unpacked.end(), data, data + size); };
+
+    const std::vector<std::size_t> chunk_sizes = { 3U, 1500U, 1U, 700U, 64U };
+    std::size_t offset = 0U;
+    std::size_t chunk_index = 0U;
+    while (offset < packed.size())
+    {
+        const std::size_t chunk = std::min(chunk_sizes[chunk_index++ % chunk_sizes.size()], packed.size() - offset);
+        ASSERT_TRUE(decoder.feed(packed.data() + offset, chunk, sink).has_value());
+        offset += chunk;
+    }
+
+    ASSERT_TRUE(decoder.finish(sink).has_value());
+    ASSERT_TRUE(decoder.done());
+    ASSERT_EQ(original_data, unpacked);
+}
+
+/**
+ * @brief Test the push/pull interface with a destination smaller than the decoded data.
+ */
+TEST_F(GzipWrapperTest, StreamDecoderPullsIntoSmallBuffer)
+{
+    const auto original_data = make_log_payload(10000U);
+    const auto packed = gzip.pack(original_data);
+    tools::gzip_stream_decoder decoder;
+
+    std::vector<std::uint8_t> unpacked;
+    std::array<std::uint8_t, 100U> output = {};
+    std::size_t offset = 0U;
+
+    while (!decoder.done())
+    {
+        offset += decoder.push(packed.data() + offset, packed.size() - offset);
+        if (offset == packed.size())
+        {
+            decoder.end_input();
+        }
+
+        const auto pulled = decoder.pull(output.data(), output.size());
+        ASSERT_TRUE(pulled.has_value());
+        unpacked.insert(unpacked.end(), output.begin(), output.begin() + static_cast<std::ptrdiff_t>(pulled.value()));
+    }
+
+    ASSERT_EQ(original_data, unpacked);
+
+    // a finished decoder ignores trailing input until reset
+    ASSERT_EQ(4U, decoder.push(packed.data(), 4U));
+    decoder.reset();
+    ASSERT_FALSE(decoder.done());
+}
+
+/**
+ * @brief Test that corrupted, truncated and out of window streams are reported.
+ */
+TEST_F(GzipWrapperTest, StreamDecoderReportsErrors)
+{
+    const auto sink = [](const std::uint8_t* /*data*/, std::size_t /*size*/) {};
+    const auto original_data = make_log_payload(4000U);
+    auto packed = gzip.pack(original_data);
+
+    tools::gzip_stream_decoder decoder;
+    auto corrupted = packed;
+    corrupted[corrupted.size() - 6U] ^= 0x01U; // CRC32 byte
+    static_cast<void>(decoder.feed(corrupted.data(), corrupted.size(), sink));
+    auto result = decoder.finish(sink);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::checksum_error, result.error());
+
+    decoder.reset();
+    ASSERT_TRUE(decoder.feed(packed.data(), packed.size() / 2U, sink).has_value());
+    result = decoder.finish(sink);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::truncated, result.error());
+
+    decoder.reset();
+    const std::array<std::uint8_t, 12U> not_gzip = { 'n', 'o', 't', ' ', 'a', ' ', 'g', 'z', 'i', 'p', '!', '\n' };
+    result = decoder.feed(not_gzip.data(), not_gzip.size(), sink);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::data_error, result.error());
+
+    // a block repeated 2000 bytes later cannot be resolved with a 1 KB window
+    std::vector<std::uint8_t> far_repeat(2000U);
+    for (std::size_t i = 0U; i < far_repeat.size(); ++i)
+    {
+        far_repeat[i] = static_cast<std::uint8_t>((i * 7919U) ^ (i >> 3U));
+    }
+    far_repeat.insert(far_repeat.end(), far_repeat.begin(), far_repeat.end());
+    packed = gzip.pack(far_repeat);
+
+    tools::gzip_stream_decoder small_window_decoder(1024U);
+    static_cast<void>(small_window_decoder.feed(packed.data(), packed.size(), sink));
+    result = small_window_decoder.finish(sink);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(tools::gzip_stream_error::window_too_small, result.error());
+}
+
+/**
+ * @brief Test that every CRC-32 and Adler-32 kernel agrees with uzlib over unaligned slices and split updates.
+ */
+TEST_F(GzipWrapperTest, ChecksumKernelsAgreeWithUzlib)
+{
+    std::vector<std::uint8_t> data(20000U);
+    std::uint32_t seed = 0x2545f491U;
+    for (auto& byte : data)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        byte = static_cast<std::uint8_t>(seed >> 24U);
+    }
+    // all-0xff run: worst case for the deferred Adler modulo
+    std::fill(data.begin() + 8000, data.begin() + 16000, static_cast<std::uint8_t>(0xffU));
+
+    const std::array<tools::checksum_kernel, 3U> kernels = { tools::checksum_kernel::portable_table,
+        tools::checksum_kernel::slicing_by_8, tools::checksum_kernel::hardware };
+    const std::array<std::size_t, 12U> sizes = { 0U, 1U, 7U, 15U, 16U, 63U, 64U, 65U, 200U, 1031U, 5552U, 19000U };
+
+    for (const std::size_t size : sizes)
+    {
+        for (std::size_t offset = 0U; offset < 4U; ++offset)
+        {
+            const std::uint8_t* slice = data.data() + offset;
+            const std::uint32_t crc = uzlib_crc32(slice, static_cast<unsigned int>(size), tools::crc32_initial);
+            const std::uint32_t adler = uzlib_adler32(slice, static_cast<unsigned int>(size), tools::adler32_initial);
+
+            EXPECT_EQ(crc, tools::crc32_update(slice, size, tools::crc32_initial)) << size;
+            EXPECT_EQ(adler, tools::adler32_update(slice, size, tools::adler32_initial)) << size;
+
+            for (const auto kernel : kernels)
+            {
+                EXPECT_EQ(crc, tools::crc32_update(kernel, slice, size, tools::crc32_initial)) << size;
+                EXPECT_EQ(adler, tools::adler32_update(kernel, slice, size, tools::adler32_initial)) << size;
+
+                // incremental updates chain like a single pass
+                const std::size_t split = size / 3U;
+                std::uint32_t chained = tools::crc32_update(kernel, slice, split, tools::crc32_initial);
+                chained = tools::crc32_update(kernel, slice + split, size - split, chained);
+                EXPECT_EQ(crc, chained) << size;
+            }
+        }
+    }
+
+    const char check[] = "123456789";
+    EXPECT_EQ(0xcbf43926U, ~tools::crc32_update(check, sizeof(check) - 1U, tools::crc32_initial));
+    EXPECT_EQ(0x091e01deU, tools::adler32_update(check, sizeof(check) - 1U, tools::adler32_initial));
+    EXPECT_TRUE(tools::checksum_kernel_available(tools::checksum_kernel::slicing_by_8));
+    EXPECT_TRUE(tools::checksum_kernel_available(tools::crc32_kernel()));
+}
+
+namespace
+{
+    /**
+     * @brief Decodes a gzip member with the byte-at-a-time uzlib decoder, as reference for the fast path.
+     */
+    std::vector<std::uint8_t> legacy_unpack(const std::vector<std::uint8_t>& packed, std::size_t expected_size)
+    {
+        std::vector<std::uint8_t> output(expected_size + 1U);
+        struct uzlib_uncomp depack_ctxt = {};
+        uzlib_uncompress_init(&depack_ctxt, nullptr, 0);
+        depack_ctxt.source = packed.data();
+        depack_ctxt.source_limit = packed.data() + packed.size() - 4U;
+        if (TINF_OK != uzlib_gzip_parse_header(&depack_ctxt))
+        {
+            return {};
+        }
+
+        depack_ctxt.dest_start = output.data();
+        depack_ctxt.dest = output.data();
+        int res = TINF_OK;
+        while ((TINF_OK == res) && (depack_ctxt.dest < output.data() + output.size()))
+        {
+            depack_ctxt.dest_limit = depack_ctxt.dest + 1;
+            res = uzlib_uncompress_chksum(&depack_ctxt);
+        }
+        if (TINF_DONE != res)
+        {
+            return {};
+        }
+        output.resize(static_cast<std::size_t>(depack_ctxt.dest - output.data()));
+        return output;
+    }
+
+    /** @brief Text whose gzip -9 encoding below uses a dynamic Huffman block. */
+    std::vector<std::uint8_t> sensor_log_text()
+    {
+        std::string text;
+        for (int i = 0; i < 60; ++i)
+        {
+            text += "sensor " + std::to_string(i % 11) + " value " + std::to_string((i * 31) % 97) + "\n";
+        }
+        return std::vector<std::uint8_t>(text.begin(), text.end());
+    }
+
+    /** @brief sensor_log_text() compressed by zlib at level 9: one dynamic Huffman block. */
+    const std::vector<std::uint8_t> sensor_log_gzip = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+        0x65, 0xd1, 0x31, 0x0e, 0xc2, 0x30, 0x0c, 0x46, 0xe1, 0xbd, 0xa7, 0xe8, 0x11, 0x6a, 0x27, 0x4e, 0xec, 0xe3,
+        0x30, 0xb0, 0x21, 0x90, 0xa8, 0xe0, 0xfc, 0x0c, 0xc4, 0x1d, 0xfc, 0xd6, 0x27, 0x39, 0xca, 0xa7, 0xff, 0xbc,
+        0x3f, 0xcf, 0xd7, 0x7b, 0x3f, 0xf6, 0xef, 0xed, 0xf1, 0xb9, 0xef, 0xc7, 0x76, 0xfe, 0x83, 0xac, 0xd0, 0x24,
+        0x8b, 0xae, 0x32, 0x34, 0x4b, 0x5b, 0x25, 0x5a, 0x96, 0xbe, 0x8a, 0xce, 0x2c, 0xb6, 0x8a, 0x79, 0x96, 0xb1,
+        0x8a, 0x47, 0x96, 0x99, 0x57, 0xd7, 0x3b, 0x9e, 0x57, 0x3d, 0x4b, 0xe4, 0x95, 0x5d, 0x3f, 0xcc, 0x3f, 0xcb,
+        0xf5, 0x50, 0x16, 0x03, 0xc3, 0xc1, 0x10, 0xab, 0x8c, 0x3e, 0x2a, 0x63, 0x82, 0x21, 0x52, 0x19, 0x5d, 0x2b,
+        0x63, 0x82, 0x31, 0xab, 0xa2, 0x39, 0x14, 0x03, 0x8a, 0x86, 0x2d, 0x3a, 0xb6, 0x00, 0x22, 0x80, 0x68, 0x47,
+        0x45, 0x0c, 0x20, 0x02, 0x08, 0x1d, 0xd8, 0x02, 0x0a, 0xa7, 0x42, 0x15, 0x5b, 0x80, 0xe1, 0x60, 0x88, 0x63,
+        0x8b, 0xa8, 0x0c, 0x07, 0x43, 0x3a, 0xb6, 0x30, 0x6c, 0x01, 0x86, 0x1c, 0x95, 0xd1, 0x05, 0x8c, 0x09, 0xc6,
+        0xc0, 0x18, 0x13, 0x63, 0x40, 0xa1, 0xd8, 0xa2, 0x61, 0x0b, 0x20, 0x02, 0x08, 0x8d, 0x8a, 0x18, 0x40, 0x04,
+        0x11, 0x6a, 0xd8, 0x02, 0x0a, 0x87, 0x42, 0xa5, 0x2a, 0x0c, 0x0c, 0x6f, 0xdb, 0x0f, 0xe0, 0x42, 0xaa, 0x18,
+        0x38, 0x04, 0x00, 0x00 };
+} // namespace
+
+/**
+ * @brief Test that the table-driven unpack path is byte-identical to the byte-at-a-time uzlib decoder.
+ */
+TEST_F(GzipWrapperTest, FastInflateMatchesLegacyDecoder)
+{
+    std::uint32_t seed = 0x1234567U;
+    const auto next = [&seed]()
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        return static_cast<std::uint8_t>(seed >> 24U);
+    };
+
+    std::vector<std::vector<std::uint8_t>> inputs;
+    for (const std::size_t size : { 15U, 16U, 17U, 31U, 257U, 4096U, 70000U })
+    {
+        std::vector<std::uint8_t> random(size);
+        std::generate(random.begin(), random.end(), next);
+        inputs.push_back(random);
+    }
+
+    for (const std::size_t size : { 4096U, 70000U })
+    {
+        // short periods (overlapping copies) mixed with long distance repeats (chunked copies)
+        std::vector<std::uint8_t> periodic(size);
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            const std::size_t period = 1U + ((i / 512U) % 40U);
+            periodic[i] = static_cast<std::uint8_t>((i % period) * 7U + ((i / 4096U) & 1U));
+        }
+        inputs.push_back(periodic);
+    }
+
+    for (const auto& input : inputs)
+    {
+        const auto packed = gzip.pack(input);
+        const auto unpacked = gzip.unpack(packed);
+        ASSERT_EQ(input, unpacked) << input.size();
+        EXPECT_EQ(legacy_unpack(packed, input.size()), unpacked) << input.size();
+    }
+}
+
+/**
+ * @brief Test unpacking a dynamic Huffman stream produced by zlib, and a stored block stream.
+ */
+TEST_F(GzipWrapperTest, UnpackDynamicAndStoredBlocks)
+{
+    const auto expected = sensor_log_text();
+    const auto unpacked = gzip.unpack(sensor_log_gzip);
+    ASSERT_EQ(expected, unpacked);
+    EXPECT_EQ(legacy_unpack(sensor_log_gzip, expected.size()), unpacked);
+
+    const std::vector<std::uint8_t> stored_gzip = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01,
+        0x14, 0x00, 0xeb, 0xff, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x70,
+        0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0xbb, 0x40, 0x11, 0x5b, 0x14, 0x00, 0x00, 0x00 };
+    const std::string payload = "stored block payload";
+    EXPECT_EQ(std::vector<std::uint8_t>(payload.begin(), payload.end()), gzip.unpack(stored_gzip));
+
+    // damaged Huffman data or a cut stream must fail cleanly
+    for (std::size_t i = 10U; i < sensor_log_gzip.size() - 8U; i += 7U)
+    {
+        auto damaged = sensor_log_gzip;
+        damaged[i] ^= 0x5aU;
+        const auto result = gzip.unpack(damaged);
+        EXPECT_TRUE(result.empty() || (result == expected)) << i;
+    }
+    auto truncated = sensor_log_gzip;
+    truncated.erase(truncated.begin() + 60, truncated.end() - 8);
+    EXPECT_TRUE(gzip.unpack(truncated).empty());
+}
+
+/**
+ * @brief Test that every compression level round trips through both decoders, across several deflate blocks.
+ */
+TEST_F(GzipWrapperTest, PackLevelsRoundTrip)
+{
+    std::uint32_t seed = 0x9e3779b9U;
+    const auto next = [&seed]()
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        return static_cast<std::uint8_t>(seed >> 24U);
+    };
+
+    std::vector<std::vector<std::uint8_t>> inputs;
+    std::vector<std::uint8_t> random(40000U);
+    std::generate(random.begin(), random.end(), next);
+    inputs.push_back(random);
+    inputs.emplace_back(100000U, static_cast<std::uint8_t>(0x55U));
+
+    std::vector<std::uint8_t> log;
+    while (log.size() < 300000U)
+    {
+        const auto text = sensor_log_text();
+        log.insert(log.end(), text.begin(), text.end());
+        log.push_back(next()); // break the period now and then
+    }
+    inputs.push_back(log);
+
+    // Fibonacci symbol frequencies: the unconstrained Huffman tree is deeper than 15 bits
+    std::vector<std::uint8_t> skewed;
+    std::uint32_t previous = 1U;
+    std::uint32_t current = 1U;
+    for (std::uint8_t symbol = 0U; symbol < 25U; ++symbol)
+    {
+        skewed.insert(skewed.end(), current, static_cast<std::uint8_t>(symbol * 9U));
+        const std::uint32_t sum = previous + current;
+        previous = current;
+        current = sum;
+    }
+    for (std::size_t i = skewed.size() - 1U; i > 0U; --i)
+    {
+        std::swap(skewed[i], skewed[(static_cast<std::size_t>(next()) << 16U | next() << 8U | next()) % (i + 1U)]);
+    }
+    inputs.push_back(skewed);
+
+    for (const auto level : { tools::gzip_level::fast, tools::gzip_level::balanced, tools::gzip_level::best })
+    {
+        for (const auto& input : inputs)
+        {
+            const auto packed = gzip.pack(input, level);
+            ASSERT_FALSE(packed.empty());
+            EXPECT_EQ(input, gzip.unpack(packed)) << static_cast<int>(level) << " " << input.size();
+            EXPECT_EQ(input, legacy_unpack(packed, input.size())) << static_cast<int>(level) << " " << input.size();
+        }
+    }
+}
+
+/**
+ * @brief Test the ratio ordering of the levels on compressible data, and the fast level of the stream compressor.
+ */
+TEST_F(GzipWrapperTest, PackLevelsTradeRatio)
+{
+    std::vector<std::uint8_t> log;
+    for (int i = 0; i < 50; ++i)
+    {
+        const auto text = sensor_log_text();
+        log.insert(log.end(), text.begin(), text.end());
+    }
+
+    const auto fast = gzip.pack(log, tools::gzip_level::fast);
+    const auto balanced = gzip.pack(log);
+    const auto best = gzip.pack(log, tools::gzip_level::best);
+    EXPECT_LE(balanced.size(), fast.size());
+    EXPECT_LT(best.size(), balanced.size());
+    EXPECT_EQ(log, gzip.unpack(best));
+
+    // dynamic Huffman codes pay off on skewed literals even without matches
+    std::vector<std::uint8_t> text = sensor_log_text();
+    const auto best_text = gzip.pack(text, tools::gzip_level::best);
+    EXPECT_LT(best_text.size(), gzip.pack(text).size());
+    EXPECT_LE(best_text.size(), sensor_log_gzip.size() + 16U); // in the range of zlib -9
+
+    tools::gzip_stream_compressor compressor;
+    std::vector<std::uint8_t> stream(tools::gzip_stream_compressor::compress_bound(log.size()));
+    std::size_t size = compressor.init(stream.data(), stream.size(), tools::gzip_level::fast).value();
+    size += compressor.update(log.data(), log.size(), stream.data() + size, stream.size() - size).value();
+    size += compressor.finish(stream.data() + size, stream.size() - size).value();
+    stream.resize(size);
+    EXPECT_EQ(fast, stream);
+    EXPECT_EQ(log, gzip.unpack(stream));
+}
+
+/**
+ * @brief Test the best level on inputs short enough for fixed Huffman blocks, with literals above 0x8f.
+ */
+TEST_F(GzipWrapperTest, PackBestShortInputs)
+{
+    std::vector<std::vector<std::uint8_t>> inputs = { { 0x98U }, { 0x8fU, 0x90U }, { 0xadU, 0xbcU, 0xcaU },
+        { 0xffU, 0x00U, 0x90U, 0x61U }, std::vector<std::uint8_t>(16U, 0xc3U), std::vector<std::uint8_t>(100U, 0xc3U) };
+    std::uint32_t seed = 0x9e3779b9U;
+    for (std::size_t size = 1U; size <= 16U; ++size)
+    {
+        std::vector<std::uint8_t> input;
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            input.push_back(static_cast<std::uint8_t>(0x80U | (seed >> 24U))); // high literals
+        }
+        inputs.push_back(input);
+        input.insert(input.end(), input.begin(), input.end()); // short repeat
+        inputs.push_back(input);
+    }
+
+    for (const auto& input : inputs)
+    {
+        const auto packed = gzip.pack(input, tools::gzip_level::best);
+        ASSERT_FALSE(packed.empty());
+        EXPECT_EQ(input, legacy_unpack(packed, input.size())) << input.size();
+        if (packed.size() >= 23U) // unpack() rejects shorter gzip files
+        {
+            EXPECT_EQ(input, gzip.unpack(packed)) << input.size();
+        }
+    }
+}
+
+/**
+ * @brief Test that crc32_combine() of two ranges matches the CRC32 of their concatenation.
+ */
+TEST_F(GzipWrapperTest, Crc32CombineMatchesContiguousChecksum)
+{
+    std::vector<std::uint8_t> data(70000U);
+    std::uint32_t seed = 12345U;
+    std::generate(data.begin(), data.end(),
+        [&seed]()
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            return static_cast<std::uint8_t>(seed >> 24U);
+        });
+
+    const std::uint32_t whole = ~tools::crc32_update(data.data(), data.size(), tools::crc32_initial);
+    for (const std::size_t split : { std::size_t { 0U }, std::size_t { 1U }, std::size_t { 4097U }, data.size() })
+    {
+        const std::uint32_t first = ~tools::crc32_update(data.data(), split, tools::crc32_initial);
+        const std::uint32_t second
+            = ~tools::crc32_update(data.data() + split, data.size() - split, tools::crc32_initial);
+        EXPECT_EQ(whole, tools::crc32_combine(first, second, data.size() - split)) << split;
+    }
+}
+
+/**
+ * @brief Test that pack_parallel() produces one gzip member both decoders read, matching across block boundaries.
+ */
+TEST_F(GzipWrapperTest, PackParallelRoundTrip)
+{
+    pco::static_thread_pool pool { 3 };
+
+    std::vector<std::uint8_t> log;
+    std::uint32_t seed = 0x2545f491U;
+    while (log.size() < 600000U)
+    {
+        const auto text = sensor_log_text();
+        log.insert(log.end(), text.begin(), text.end());
+        seed = (seed * 1103515245U) + 12345U;
+        log.push_back(static_cast<std::uint8_t>(seed >> 24U));
+    }
+
+    for (const auto level : { tools::gzip_level::fast, tools::gzip_level::balanced, tools::gzip_level::best })
+    {
+        const auto packed = gzip.pack_parallel(pool.executor(), log, level, 65536U, 4U);
+        ASSERT_FALSE(packed.empty());
+        EXPECT_EQ(log, gzip.unpack(packed)) << static_cast<int>(level);
+        EXPECT_EQ(log, legacy_unpack(packed, log.size())) << static_cast<int>(level);
+
+        // the blocks see the tail of the previous one: smaller than the blocks deflated on their own
+        std::size_t independent = 0U;
+        for (std::size_t begin = 0U; begin < log.size(); begin += 65536U)
+        {
+            const std::vector<std::uint8_t> block(log.begin() + static_cast<std::ptrdiff_t>(begin),
+                log.begin() + static_cast<std::ptrdiff_t>(std::min(begin + 65536U, log.size())));
+            independent += gzip.pack(block, level).size() - 18U; // without the gzip header and trailer
+        }
+        EXPECT_LT(packed.size(), independent) << static_cast<int>(level);
+    }
+
+    // one block or less is packed sequentially
+    const std::vector<std::uint8_t> small(log.begin(), log.begin() + 1000);
+    EXPECT_EQ(gzip.pack(small), gzip.pack_parallel(pool.executor(), small));
+}
+
+/**
+ * @brief Test pack_parallel() at the best level on small segments ending with fixed blocks of high literals.
+ */
+TEST_F(GzipWrapperTest, PackParallelBestSmallSegments)
+{
+    pco::static_thread_pool pool { 3 };
+
+    std::uint32_t seed = 0x1b873593U;
+    const std::size_t dictionary = tools::gzip_dict_size;
+    for (const std::size_t size : { std::size_t { 257U }, std::size_t { 4095U }, (2U * dictionary) + 40U,
+             (3U * dictionary) + 7U })
+    {
+        std::vector<std::uint8_t> input;
+        while (input.size() < size)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            const auto literal = static_cast<std::uint8_t>(0x90U | (seed >> 25U));
+            input.insert(input.end(), std::min<std::size_t>(1U + ((seed >> 8U) & 3U), size - input.size()), literal);
+        }
+
+        const auto packed
+            = gzip.pack_parallel(pool.executor(), input, tools::gzip_level::best, tools::gzip_dict_size, 3U);
+        ASSERT_FALSE(packed.empty());
+        EXPECT_EQ(input, gzip.unpack(packed)) << size;
+        EXPECT_EQ(input, legacy_unpack(packed, input.size())) << size;
+    }
+}
+
+namespace
+{
+    /** @brief Shared dictionary of the telemetry messages below. */
+    std::vector<std::uint8_t> telemetry_dictionary()
+    {
+        const std::string text = R"({"device":"esp32-node","sensor":"temperature","unit":"celsius","value":,)"
+                                 R"("timestamp":,"status":"ok"})";
+        return { text.begin(), text.end() };
+    }
+
+    std::vector<std::uint8_t> telemetry_message(int value)
+    {
+        const std::string text = R"({"device":"esp32-node","sensor":"temperature","unit":"celsius","value":)"
+            + std::to_string(value / 10) + "." + std::to_string(value % 10) + R"(,"timestamp":)"
+            + std::to_string(1760000000 + value) + R"(,"status":"ok"})";
+        return { text.begin(), text.end() };
+    }
+
+    /** @brief telemetry_message(215) compressed by zlib at level 9 with telemetry_dictionary(). */
+    const std::vector<std::uint8_t> telemetry_zlib = { 0x78U, 0xf9U, 0x7eU, 0xb5U, 0x21U, 0x38U, 0xabU, 0xa6U, 0x8eU,
+        0x15U, 0x46U, 0x86U, 0x7aU, 0xa6U, 0x28U, 0xd6U, 0x18U, 0x9aU, 0x9bU, 0x19U, 0x00U, 0x81U, 0x91U, 0xa1U, 0x29U,
+        0x9aU, 0x85U, 0x00U, 0x40U, 0xbdU, 0x23U, 0xf4U };
+}
+
+/**
+ * @brief Test that preset dictionary messages round trip in both framings and shrink well below pack().
+ */
+TEST_F(GzipWrapperTest, PackWithDictionaryRoundTrip)
+{
+    const auto dictionary = telemetry_dictionary();
+    const auto message = telemetry_message(215);
+
+    for (const auto level : { tools::gzip_level::fast, tools::gzip_level::balanced, tools::gzip_level::best })
+    {
+        const auto zlib_packed = gzip.pack_with_dictionary(message, dictionary, tools::deflate_framing::zlib, level);
+        EXPECT_EQ(message, gzip.unpack_with_dictionary(zlib_packed, dictionary)) << static_cast<int>(level);
+        EXPECT_LT(zlib_packed.size() * 3U, gzip.pack(message, level).size()) << static_cast<int>(level);
+
+        const auto raw_packed = gzip.pack_with_dictionary(message, dictionary, tools::deflate_framing::raw, level);
+        EXPECT_EQ(zlib_packed.size(), raw_packed.size() + 10U);
+        EXPECT_EQ(message, gzip.unpack_with_dictionary(raw_packed, dictionary, tools::deflate_framing::raw));
+    }
+
+    // without dictionary: a plain zlib stream
+    const auto plain = gzip.pack_with_dictionary(message, {});
+    EXPECT_EQ(0U, plain[1] & 0x20U);
+    EXPECT_EQ(message, gzip.unpack_with_dictionary(plain, {}));
+
+    // larger than the initial output guess
+    std::vector<std::uint8_t> repeated;
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto next = telemetry_message(200 + (i % 3));
+        repeated.insert(repeated.end(), next.begin(), next.end());
+    }
+    const auto packed_repeated = gzip.pack_with_dictionary(repeated, dictionary);
+    EXPECT_EQ(repeated, gzip.unpack_with_dictionary(packed_repeated, dictionary, tools::deflate_framing::zlib, 65536U));
+    EXPECT_TRUE(gzip.unpack_with_dictionary(packed_repeated, dictionary, tools::deflate_framing::zlib, 1000U).empty());
+}
+
+/**
+ * @brief Test zlib interoperability and the rejection of a wrong dictionary or corrupted message.
+ */
+TEST_F(GzipWrapperTest, UnpackWithDictionaryChecksStream)
+{
+    const auto dictionary = telemetry_dictionary();
+    EXPECT_EQ(telemetry_message(215), gzip.unpack_with_dictionary(telemetry_zlib, dictionary));
+
+    auto other = dictionary;
+    other.back() = ' ';
+    EXPECT_TRUE(gzip.unpack_with_dictionary(telemetry_zlib, other).empty());
+
+    auto corrupted = gzip.pack_with_dictionary(telemetry_message(333), dictionary);
+    corrupted.back() ^= 0x01U;
+    EXPECT_TRUE(gzip.unpack_with_dictionary(corrupted, dictionary).empty());
+
+    auto trailing = gzip.pack_with_dictionary(telemetry_message(333), dictionary, tools::deflate_framing::raw);
+    trailing.push_back(0U);
+    EXPECT_TRUE(gzip.unpack_with_dictionary(trailing, dictionary, tools::deflate_framing::raw).empty());
+
+    EXPECT_TRUE(gzip.pack_with_dictionary({}, dictionary).empty());
+    EXPECT_TRUE(gzip.unpack_with_dictionary({ 0x78U }, dictionary).empty());
+}
+
+/**
+ * @brief Test wrappers borrowing workspaces from a static pool: same output, slots given back on destruction.
+ */
+TEST_F(GzipWrapperTest, WorkspacePoolWrappers)
+{
+    static tools::gzip_workspace_pool<2U> pool; // .bss: no allocation at construction nor at borrowing
+
+    const auto message = telemetry_message(215);
+    std::vector<std::uint8_t> large;
+    while (large.size() < 20000U)
+    {
+        const auto text = sensor_log_text();
+        large.insert(large.end(), text.begin(), text.end());
+    }
+
+    {
+        tools::gzip_wrapper first(pool.make_unique());
+        tools::gzip_wrapper second(pool.make_unique());
+        EXPECT_EQ(2U, pool.in_use());
+
+        for (const auto level : { tools::gzip_level::fast, tools::gzip_level::balanced, tools::gzip_level::best })
+        {
+            const auto packed = first.pack(message, level);
+            EXPECT_EQ(gzip.pack(message, level), packed) << static_cast<int>(level);
+            EXPECT_EQ(packed.size(), packed.capacity());
+            EXPECT_EQ(message, second.unpack(packed));
+            EXPECT_EQ(gzip.pack(large, level), second.pack(large, level)) << static_cast<int>(level);
+        }
+
+        const auto dictionary = telemetry_dictionary();
+        EXPECT_EQ(gzip.pack_with_dictionary(message, dictionary), first.pack_with_dictionary(message, dictionary));
+
+        // exhausted pool: the wrapper allocates its own tables
+        tools::gzip_wrapper third(pool.make_unique());
+        EXPECT_EQ(2U, pool.in_use());
+        EXPECT_EQ(large, third.unpack(third.pack(large)));
+    }
+    EXPECT_EQ(0U, pool.in_use());
+    EXPECT_EQ(2U, pool.high_water_mark());
+
+    const auto workspace = pool.make_unique();
+    tools::gzip_stream_compressor compressor(workspace.get());
+    std::vector<std::uint8_t> stream(tools::gzip_stream_compressor::compress_bound(message.size()));
+    std::size_t size = compressor.init(stream.data(), stream.size()).value();
+    size += compressor.update(message.data(), message.size(), stream.data() + size, stream.size() - size).value();
+    size += compressor.finish(stream.data() + size, stream.size() - size).value();
+    stream.resize(size);
+    EXPECT_EQ(message, gzip.unpack(stream));
+}
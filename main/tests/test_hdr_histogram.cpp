@@ -0,0 +1,166 @@
+/**
+ * @file test_hdr_histogram.cpp
+ * @brief Unit tests for the log-linear hdr_histogram using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "tools/hdr_histogram.hpp"
+#include "tools/histogram.hpp"
+
+/**
+ * @brief Test the exact low buckets, the log-linear buckets above and the clamping of oversized samples.
+ */
+TEST(HdrHistogramTest, BucketBoundaries)
+{
+    using histogram_t = tools::hdr_histogram<3U, 16U>;
+
+    EXPECT_EQ(112U, histogram_t::bucket_count);
+    EXPECT_EQ(0U, histogram_t::bucket_of(0U));
+    EXPECT_EQ(7U, histogram_t::bucket_of(7U));
+    EXPECT_EQ(8U, histogram_t::bucket_of(8U));
+    EXPECT_EQ(15U, histogram_t::bucket_of(15U));
+    EXPECT_EQ(16U, histogram_t::bucket_of(16U));
+    EXPECT_EQ(16U, histogram_t::bucket_of(17U));
+    EXPECT_EQ(17U, histogram_t::bucket_of(18U));
+    EXPECT_EQ(histogram_t::bucket_count - 1U, histogram_t::bucket_of(UINT32_MAX));
+
+    for (std::size_t bucket = 0U; bucket < histogram_t::bucket_count; ++bucket)
+    {
+        const auto low = histogram_t::lowest_equivalent(bucket);
+        const auto high = histogram_t::highest_equivalent(bucket);
+        ASSERT_LE(low, high);
+        EXPECT_EQ(bucket, histogram_t::bucket_of(low));
+        EXPECT_EQ(bucket, histogram_t::bucket_of(high));
+
+        if (bucket + 1U < histogram_t::bucket_count)
+        {
+            EXPECT_EQ(high + 1U, histogram_t::lowest_equivalent(bucket + 1U));
+        }
+    }
+
+    EXPECT_EQ(histogram_t::max_value, histogram_t::highest_equivalent(histogram_t::bucket_count - 1U));
+}
+
+/**
+ * @brief Test that percentiles stay within the configured relative error of the exact order statistics.
+ */
+TEST(HdrHistogramTest, PercentilesWithinRelativeError)
+{
+    constexpr unsigned int precision_bits = 5U;
+    tools::hdr_histogram<precision_bits> histogram;
+    std::vector<std::uint64_t> samples;
+    std::mt19937 generator(42U); // NOLINT fixed seed
+    std::lognormal_distribution<double> latency(8.0, 1.5); // NOLINT typical latency spread
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto sample = static_cast<std::uint64_t>(latency(generator));
+        samples.push_back(sample);
+        histogram.add(sample);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const double tolerance = 1.0 / static_cast<double>(1U << precision_bits);
+
+    for (const double fraction : { 0.5, 0.9, 0.99, 0.999 })
+    {
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(samples.size())));
+        const auto exact = static_cast<double>(samples[rank - 1U]);
+        const auto estimate = static_cast<double>(histogram.percentile(fraction));
+        EXPECT_GE(estimate, exact);
+        EXPECT_LE(estimate - exact, (exact * tolerance) + 1.0) << "fraction " << fraction;
+    }
+
+    EXPECT_EQ(samples.front(), histogram.percentile(0.0));
+    EXPECT_EQ(samples.back(), histogram.percentile(1.0));
+    EXPECT_EQ(samples.size(), histogram.total_count());
+}
+
+/**
+ * @brief Test that the exact statistics agree with the occurrence-counting histogram.
+ */
+TEST(HdrHistogramTest, StatisticsMatchHistogram)
+{
+    tools::hdr_histogram<> hdr;
+    tools::histogram<int> reference;
+
+    for (const int value : { 3, 5, 5, 7, 7, 7, 12, 30 })
+    {
+        hdr.add(static_cast<std::uint64_t>(value));
+        reference.add(value);
+    }
+
+    EXPECT_DOUBLE_EQ(reference.average(), hdr.average());
+    EXPECT_NEAR(reference.variance(reference.average()), hdr.variance(hdr.average()), 1e-9);
+    EXPECT_DOUBLE_EQ(7.0, hdr.median());
+    EXPECT_EQ(7U, hdr.top());
+    EXPECT_EQ(3U, hdr.top_occurence());
+    EXPECT_EQ(3U, hdr.min());
+    EXPECT_EQ(30U, hdr.max());
+}
+
+/**
+ * @brief Test that merging adds the counts and bounds, and that reset forgets everything.
+ */
+TEST(HdrHistogramTest, MergeAndReset)
+{
+    tools::hdr_histogram<4U> lhs;
+    tools::hdr_histogram<4U> rhs;
+
+    lhs.add(10U, 3U);
+    rhs.add(2U);
+    rhs.add(1000U, 5U);
+    lhs.merge(rhs);
+
+    EXPECT_EQ(9U, lhs.total_count());
+    EXPECT_EQ(2U, lhs.min());
+    EXPECT_EQ(1000U, lhs.max());
+    EXPECT_EQ(5U, lhs.top_occurence());
+    EXPECT_EQ(1000U, lhs.percentile(0.5));
+    EXPECT_EQ(10U, lhs.percentile(0.4));
+    EXPECT_DOUBLE_EQ((30.0 + 2.0 + 5000.0) / 9.0, lhs.average());
+
+    lhs.reset();
+    EXPECT_EQ(0U, lhs.total_count());
+    EXPECT_EQ(0U, lhs.percentile(0.99));
+    EXPECT_EQ(0U, lhs.top_occurence());
+    EXPECT_DOUBLE_EQ(0.0, lhs.average());
+
+    lhs.add(UINT64_MAX);
+    EXPECT_EQ(tools::hdr_histogram<4U>::max_value, lhs.max());
+}
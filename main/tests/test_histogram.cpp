@@ -41,9 +41,13 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -53,6 +57,7 @@
 
 #include "fpm/fixed.hpp"
 #include "tests/test_helper.hpp"
+#include "tools/flat_hash_map.hpp"
 #include "tools/histogram.hpp"
 
 /**
@@ -468,6 +473,32 @@ TEST(HistogramRangeTest, AddRangeSupportsRangeAndInitializerList)
     EXPECT_NEAR(static_cast<double>(hist.top()), 2.5, 1e-6);
 }
 
+/**
+ * @brief Verifies a histogram over a fixed-capacity flat hash map computes the same statistics and drops overflow.
+ */
+TEST(HistogramContainerTypeTest, FixedFlatHashMapStatistics)
+{
+    tools::histogram<int> reference;
+    tools::histogram<int, tools::fixed_flat_hash_map<int, int, 8U>> fixed;
+
+    const std::vector<int> samples = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    reference.add_range(samples);
+    fixed.add_range(samples);
+
+    EXPECT_EQ(reference.total_count(), fixed.total_count());
+    EXPECT_EQ(reference.top(), fixed.top());
+    EXPECT_EQ(reference.top_occurence(), fixed.top_occurence());
+    EXPECT_DOUBLE_EQ(reference.average(), fixed.average());
+    EXPECT_DOUBLE_EQ(reference.median(), fixed.median());
+
+    // 7 distinct values so far: one more fits, the next new one is dropped, known values still count
+    fixed.add(7);
+    fixed.add(8);
+    fixed.add(5);
+    EXPECT_EQ(static_cast<int>(samples.size()) + 2, fixed.total_count());
+    EXPECT_EQ(4, fixed.top_occurence());
+}
+
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 /**
  * @brief Verifies C++20 requires constraints for histogram add forwarding API.
@@ -506,3 +537,62 @@ TEST(HistogramRangeTest, Cpp20RangeConstraints)
     SUCCEED();
 }
 #endif
+
+namespace
+{
+    template <typename T>
+    void check_dense_against_dictionary(int min_value, int max_value)
+    {
+        tools::histogram<T, tools::dense_counts<T>> dense;
+        tools::histogram<T, std::unordered_map<T, int>> reference;
+
+        std::mt19937 generator(17U); // NOLINT fixed seed
+        std::uniform_int_distribution<int> values(min_value, max_value);
+        std::vector<T> samples(5000U);
+        for (auto& sample : samples)
+        {
+            sample = static_cast<T>(values(generator));
+        }
+        // a clear mode, so that the top value does not depend on the order the ties were reached
+        samples.insert(samples.end(), 500U, static_cast<T>(max_value));
+
+        dense.add_range(samples);
+        dense.add(static_cast<T>(min_value));
+        for (const T sample : samples)
+        {
+            reference.add(sample);
+        }
+        reference.add(static_cast<T>(min_value));
+
+        EXPECT_EQ(reference.total_count(), dense.total_count());
+        EXPECT_EQ(reference.top(), dense.top());
+        EXPECT_EQ(reference.top_occurence(), dense.top_occurence());
+        EXPECT_EQ(reference.top_occurence(), dense.count(static_cast<T>(max_value)));
+        EXPECT_NEAR(reference.average(), dense.average(), 1e-9);
+        EXPECT_NEAR(reference.variance(reference.average()), dense.variance(dense.average()), 1e-6);
+        EXPECT_DOUBLE_EQ(reference.median(), dense.median());
+    }
+}
+
+/**
+ * @brief Verifies the dense array histogram is the default for 8-bit types and matches the dictionary statistics.
+ */
+TEST(HistogramDenseCountsTest, MatchesDictionaryStatistics)
+{
+    static_assert(std::is_same<tools::histogram<std::uint8_t>,
+        tools::histogram<std::uint8_t, tools::dense_counts<std::uint8_t>>>::value);
+    static_assert(std::is_same<tools::histogram<std::int16_t>,
+        tools::histogram<std::int16_t, std::unordered_map<std::int16_t, int>>>::value);
+
+    check_dense_against_dictionary<std::uint8_t>(0, 255);
+    check_dense_against_dictionary<std::int8_t>(-128, 120);
+    check_dense_against_dictionary<std::int16_t>(-2000, 3000);
+
+    tools::histogram<std::uint8_t> empty;
+    EXPECT_DOUBLE_EQ(0.0, empty.average());
+    EXPECT_DOUBLE_EQ(0.0, empty.median());
+
+    tools::histogram<std::int16_t, tools::dense_counts<std::int16_t>> extremes;
+    extremes.add_range({ std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max() });
+    EXPECT_DOUBLE_EQ(-0.5, extremes.median());
+}
@@ -0,0 +1,163 @@
+/**
+ * @file test_hot_path_allocations.cpp
+ * @brief Unit tests asserting allocation free hot paths using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+
+#include "tests/allocation_counter.hpp"
+#include "tools/data_task.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace
+{
+    class counting_observer : public tools::sync_observer<std::string, int>
+    {
+    public:
+        void inform(const std::string& /*topic*/, const int& event, const std::string& /*origin*/) override
+        {
+            sum += event;
+        }
+
+        int sum = 0;
+    };
+
+    struct sample
+    {
+        std::uint32_t id;
+        std::int32_t value;
+    };
+
+    struct sample_context
+    {
+        std::atomic<std::uint32_t> processed { 0U };
+    };
+}
+
+// The harness sees the blocks the calling thread allocates and releases, and only those.
+TEST(HotPathAllocationsTest, CountsThreadAllocations)
+{
+    SKIP_WITHOUT_ALLOCATION_COUNTING();
+
+    // volatile: the compiler may otherwise elide a new/delete pair
+    const test::allocation_scope scope;
+    auto* volatile block = new std::array<std::uint8_t, 40U>(); // NOLINT owning raw pointer on purpose
+    EXPECT_EQ(1U, scope.allocations());
+    EXPECT_GE(scope.bytes(), 40U);
+    delete block; // NOLINT owning raw pointer on purpose
+    EXPECT_EQ(1U, scope.deallocations());
+
+    std::unique_ptr<int> empty;
+    EXPECT_NO_ALLOCATIONS(empty.reset());
+}
+
+// Publishing through the snapshot and epoch dispatch tables allocates nothing once the subject is set up.
+TEST(HotPathAllocationsTest, SyncSubjectPublish)
+{
+    SKIP_WITHOUT_ALLOCATION_COUNTING();
+
+    for (const auto policy : { tools::subject_dispatch_policy::snapshot, tools::subject_dispatch_policy::epoch })
+    {
+        tools::sync_subject<std::string, int> subject("HotSubject", policy);
+        auto observer = std::make_shared<counting_observer>();
+        int handled = 0;
+        const std::string topic = "hot";
+        subject.subscribe(topic, observer);
+        subject.subscribe(topic, "hot_handler",
+            [&handled](const std::string& /*topic*/, const int& event, const std::string& /*origin*/)
+            { handled += event; });
+
+        // warm up: first publish of the thread (epoch slot registration)
+        subject.publish(topic, 1);
+
+        EXPECT_NO_ALLOCATIONS(for (int event = 0; event < 1000; ++event) { subject.publish(topic, 1); });
+        EXPECT_EQ(1001, observer->sum);
+        EXPECT_EQ(1001, handled);
+    }
+}
+
+// Submitting to a data_task only pushes into its preallocated queue and signals the task.
+TEST(HotPathAllocationsTest, DataTaskSubmit)
+{
+    SKIP_WITHOUT_ALLOCATION_COUNTING();
+
+    constexpr std::uint32_t count = 1000U;
+    auto context = std::make_shared<sample_context>();
+    tools::data_task<sample_context, sample> task(
+        [](const std::shared_ptr<sample_context>& /*context*/, const std::string& /*task_name*/) {},
+        [](const std::shared_ptr<sample_context>& context, const sample& /*data*/, const std::string& /*task_name*/)
+        { context->processed.fetch_add(1U); },
+        context, count, "hot_task", 4096U);
+
+    ASSERT_TRUE(task.submit(sample { 0U, 0 }));
+    EXPECT_NO_ALLOCATIONS(for (std::uint32_t id = 1U; id < count; ++id) {
+        ASSERT_TRUE(task.submit(sample { id, 1 }));
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((context->processed.load() < count) && (std::chrono::steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(count, context->processed.load());
+}
+
+// Raw buffer transfers through a memory_pipe copy into and out of its ring storage only.
+TEST(HotPathAllocationsTest, MemoryPipeTransfer)
+{
+    SKIP_WITHOUT_ALLOCATION_COUNTING();
+
+    constexpr std::chrono::duration<std::uint64_t, std::milli> no_wait { 0U };
+    tools::memory_pipe pipe(1024U);
+    std::array<std::uint8_t, 200U> sent = {};
+    std::array<std::uint8_t, 200U> received = {};
+    std::iota(sent.begin(), sent.end(), std::uint8_t { 0U });
+
+    EXPECT_NO_ALLOCATIONS(for (int round = 0; round < 100; ++round) {
+        ASSERT_EQ(sent.size(), pipe.send(sent.data(), sent.size(), no_wait));
+        ASSERT_EQ(received.size(), pipe.receive(received.data(), received.size(), no_wait));
+    });
+    EXPECT_EQ(sent, received);
+}
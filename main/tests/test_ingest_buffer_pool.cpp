@@ -0,0 +1,199 @@
+/**
+ * @file test_ingest_buffer_pool.cpp
+ * @brief Unit tests for the ingest_buffer_pool capture buffers feeding a data_task.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/data_task.hpp"
+#include "tools/ingest_buffer_pool.hpp"
+
+namespace
+{
+    using capture_pool = tools::ingest_buffer_pool<std::int16_t, 1U>;
+
+    struct capture_context
+    {
+        std::atomic<bool> released = true;
+        std::atomic<std::int64_t> sum = 0;
+        std::atomic<std::size_t> blocks = 0U;
+        std::vector<const std::int16_t*> seen; ///< Only touched by the task thread until the task is destroyed.
+    };
+
+    bool wait_for_blocks(const capture_context& context, std::size_t count)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while ((context.blocks.load() < count) && (std::chrono::steady_clock::now() < deadline))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return context.blocks.load() >= count;
+    }
+
+    void fill(std::int16_t* buffer, std::size_t count, std::int16_t value)
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx)
+        {
+            buffer[idx] = value; // NOLINT test buffer
+        }
+    }
+}
+
+/**
+ * @brief Filled buffers reach the data_task by pointer and cycle back to the producer.
+ *
+ * @test
+ * - Captures more buffers than the pool holds, one at a time, and checks every sample is read in place.
+ * - Checks only the two pool buffers are ever used and that they all come back to the producer.
+ */
+TEST(IngestBufferPoolTest, BuffersCycleThroughTheDataTask)
+{
+    constexpr std::size_t buffer_samples = 64U;
+    capture_pool pool(buffer_samples);
+    ASSERT_TRUE(pool.valid());
+    EXPECT_EQ(2U, pool.free_buffers());
+
+    auto context = std::make_shared<capture_context>();
+    {
+        tools::data_task<capture_context, capture_pool::block> task(
+            [](const std::shared_ptr<capture_context>&, const std::string&) {},
+            pool.process_routine<capture_context>(
+                [](const std::shared_ptr<capture_context>& ctx, const std::int16_t* samples, std::size_t count,
+                    const std::string&)
+                {
+                    for (std::size_t idx = 0U; idx < count; ++idx)
+                    {
+                        ctx->sum += samples[idx]; // NOLINT block read in place
+                    }
+                    ctx->seen.push_back(samples);
+                    ctx->blocks.fetch_add(1U);
+                }),
+            context, 4U, "capture_task", 4096U);
+
+        for (std::int16_t round = 1; round <= 6; ++round)
+        {
+            std::int16_t* buffer = pool.acquire();
+            while (nullptr == buffer)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                buffer = pool.acquire();
+            }
+            fill(buffer, buffer_samples, round);
+            EXPECT_TRUE(pool.isr_submit(task, buffer, buffer_samples));
+        }
+        ASSERT_TRUE(wait_for_blocks(*context, 6U));
+    }
+
+    EXPECT_EQ(context->sum.load(), 21 * static_cast<std::int64_t>(buffer_samples));
+    for (const std::int16_t* samples : context->seen)
+    {
+        EXPECT_TRUE((samples == context->seen[0]) || (samples == context->seen[1]));
+    }
+    EXPECT_EQ(0U, pool.dropped_count());
+
+    const std::size_t overruns = pool.overrun_count();
+    std::int16_t* first = pool.acquire();
+    std::int16_t* second = pool.acquire();
+    EXPECT_NE(nullptr, first);
+    EXPECT_NE(nullptr, second);
+    EXPECT_EQ(nullptr, pool.acquire());
+    EXPECT_EQ(overruns + 1U, pool.overrun_count());
+    pool.abandon(first);
+    pool.abandon(second);
+    EXPECT_EQ(2U, pool.free_buffers());
+}
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+/**
+ * @brief A batch routine gets each queued block as a span and every buffer is released after the batch.
+ */
+TEST(IngestBufferPoolTest, BatchRoutineReleasesEveryBlock)
+{
+    tools::ingest_buffer_pool<std::int16_t, 2U> pool(16U);
+    auto context = std::make_shared<capture_context>();
+    context->released = false;
+    {
+        tools::data_task<capture_context, tools::ingest_buffer_pool<std::int16_t, 2U>::block> task(
+            [](const std::shared_ptr<capture_context>& ctx, const std::string&)
+            {
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            },
+            pool.batch_routine<capture_context>(
+                [](const std::shared_ptr<capture_context>& ctx, std::span<const std::int16_t> samples,
+                    const std::string&)
+                {
+                    for (const std::int16_t sample : samples)
+                    {
+                        ctx->sum += sample;
+                    }
+                    ctx->blocks.fetch_add(1U);
+                }),
+            context, 8U, "batch_capture", 4096U, 4U);
+
+        for (std::int16_t round = 1; round <= 4; ++round)
+        {
+            std::int16_t* buffer = pool.acquire();
+            ASSERT_NE(nullptr, buffer);
+            fill(buffer, 8U, round);
+            EXPECT_TRUE(pool.submit(task, buffer, 8U));
+        }
+        EXPECT_EQ(nullptr, pool.acquire());
+
+        context->released = true;
+        ASSERT_TRUE(wait_for_blocks(*context, 4U));
+    }
+
+    EXPECT_EQ(context->sum.load(), 10 * 8);
+    for (std::size_t idx = 0U; idx < 4U; ++idx)
+    {
+        EXPECT_NE(nullptr, pool.acquire());
+    }
+    EXPECT_EQ(nullptr, pool.acquire());
+}
+#endif
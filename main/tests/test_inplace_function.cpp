@@ -0,0 +1,179 @@
+/**
+ * @file test_inplace_function.cpp
+ * @brief Unit tests for the inplace_function callable wrapper using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "tools/inplace_function.hpp"
+
+namespace
+{
+    int add_one(int value)
+    {
+        return value + 1;
+    }
+
+    /**
+     * @brief Counts live instances to check that the wrapper destroys what it stores.
+     */
+    struct instance_counter
+    {
+        explicit instance_counter(int* counter)
+            : m_counter(counter)
+        {
+            ++(*m_counter);
+        }
+
+        instance_counter(const instance_counter& other)
+            : m_counter(other.m_counter)
+        {
+            ++(*m_counter);
+        }
+
+        instance_counter(instance_counter&& other) noexcept
+            : m_counter(other.m_counter)
+        {
+            ++(*m_counter);
+        }
+
+        instance_counter& operator=(const instance_counter&) = delete;
+        instance_counter& operator=(instance_counter&&) = delete;
+
+        ~instance_counter()
+        {
+            --(*m_counter);
+        }
+
+        int operator()() const
+        {
+            return *m_counter;
+        }
+
+        int* m_counter;
+    };
+} // namespace
+
+TEST(InplaceFunctionTest, StoresLambdasAndFunctionPointers)
+{
+    const int factor = 3;
+    tools::inplace_function<int(int)> multiply = [factor](int value) { return value * factor; };
+    tools::inplace_function<int(int)> increment = &add_one;
+
+    ASSERT_TRUE(static_cast<bool>(multiply));
+    EXPECT_EQ(multiply(5), 15);
+    EXPECT_EQ(increment(5), 6);
+}
+
+TEST(InplaceFunctionTest, DefaultAndNullAreEmpty)
+{
+    tools::inplace_function<void()> empty_default;
+    tools::inplace_function<void()> empty_null = nullptr;
+
+    EXPECT_FALSE(static_cast<bool>(empty_default));
+    EXPECT_FALSE(static_cast<bool>(empty_null));
+
+    tools::inplace_function<void()> assigned = []() {};
+    assigned = nullptr;
+    EXPECT_FALSE(static_cast<bool>(assigned));
+}
+
+TEST(InplaceFunctionTest, MoveTransfersTheTarget)
+{
+    tools::inplace_function<int()> source = []() { return 42; };
+    tools::inplace_function<int()> moved = std::move(source);
+
+    EXPECT_FALSE(static_cast<bool>(source)); // NOLINT checking the moved-from state on purpose
+    ASSERT_TRUE(static_cast<bool>(moved));
+    EXPECT_EQ(moved(), 42);
+
+    tools::inplace_function<int()> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned(), 42);
+}
+
+TEST(InplaceFunctionTest, AcceptsMoveOnlyAndMutableCallables)
+{
+    auto value = std::make_unique<int>(7);
+    tools::inplace_function<int()> read = [value = std::move(value)]() { return *value; };
+    EXPECT_EQ(read(), 7);
+
+    tools::inplace_function<int()> count = [calls = 0]() mutable { return ++calls; };
+    EXPECT_EQ(count(), 1);
+    EXPECT_EQ(count(), 2);
+}
+
+TEST(InplaceFunctionTest, WrapsStdFunction)
+{
+    std::function<std::string(const std::string&)> greet = [](const std::string& name) { return "hi " + name; };
+    tools::inplace_function<std::string(const std::string&)> wrapped = std::move(greet);
+
+    EXPECT_EQ(wrapped("esp32"), "hi esp32");
+}
+
+TEST(InplaceFunctionTest, DestroysTheStoredCallable)
+{
+    int live = 0;
+    {
+        tools::inplace_function<int()> first = instance_counter(&live);
+        EXPECT_EQ(live, 1);
+
+        tools::inplace_function<int()> second = std::move(first);
+        EXPECT_EQ(live, 1);
+        EXPECT_EQ(second(), 1);
+
+        second = nullptr;
+        EXPECT_EQ(live, 0);
+
+        second = instance_counter(&live);
+        EXPECT_EQ(live, 1);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+TEST(InplaceFunctionTest, StorableTraitFollowsCapacity)
+{
+    using small_function = tools::inplace_function<void(), 16U>;
+    std::array<char, 8> small_payload {};
+    std::array<char, 64> big_payload {};
+    auto small_lambda = [small_payload]() { (void)small_payload; };
+    auto big_lambda = [big_payload]() { (void)big_payload; };
+
+    EXPECT_TRUE(small_function::is_storable<decltype(small_lambda)>);
+    EXPECT_FALSE(small_function::is_storable<decltype(big_lambda)>);
+    EXPECT_TRUE(tools::inplace_function<void()>::is_storable<std::function<void()>>);
+}
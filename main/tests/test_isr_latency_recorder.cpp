@@ -0,0 +1,122 @@
+/**
+ * @file test_isr_latency_recorder.cpp
+ * @brief Unit tests for the ISR to task latency recorder.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+#include "tools/latency_clock.hpp"
+#include "tools/light_event.hpp"
+#include "tools/sync_queue.hpp"
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::micro> wait_timeout { 1000000U };
+}
+
+/**
+ * @brief Stamps carried through a sync_queue are recorded once consumed, unstamped items are ignored.
+ *
+ * @test
+ * - A producer thread stands for the ISR and pushes stamps with isr_push; the consumer records them.
+ * - Checks the count, that min <= mean <= max and that a 0 stamp and a reset leave the histogram empty.
+ */
+TEST(IsrLatencyRecorderTest, RecordsStampsCarriedByTheItems)
+{
+    tools::isr_latency_recorder recorder("sync_queue");
+    EXPECT_STREQ("sync_queue", recorder.name());
+    tools::bounded_sync_queue<tools::latency_stamp> queue(16U);
+
+    constexpr std::uint32_t hand_offs = 10U;
+    std::thread isr(
+        [&queue]()
+        {
+            for (std::uint32_t index = 0U; index < hand_offs; ++index)
+            {
+                queue.isr_push(tools::latency_clock::now());
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    for (std::uint32_t index = 0U; index < hand_offs; ++index)
+    {
+        const auto stamp = queue.wait_pop(wait_timeout);
+        ASSERT_TRUE(stamp.has_value());
+        recorder.on_consume(*stamp);
+    }
+    isr.join();
+
+    recorder.on_consume(0U);
+    const auto stats = recorder.snapshot();
+    EXPECT_EQ(hand_offs, stats.count);
+    EXPECT_LE(static_cast<double>(stats.min), stats.mean());
+    EXPECT_LE(stats.mean(), static_cast<double>(stats.max));
+
+    recorder.reset();
+    EXPECT_EQ(0U, recorder.snapshot().count);
+}
+
+/**
+ * @brief A notification without data is timed from its mark, and counted once per wake-up.
+ *
+ * @test
+ * - Marks then signals a light_event from a thread, records on wake-up and checks the latency covers the delay.
+ * - Checks that a wake-up without a new mark records nothing.
+ */
+TEST(IsrLatencyRecorderTest, TimesNotificationsFromTheirMark)
+{
+    tools::isr_latency_recorder recorder("task_notification");
+    tools::light_event notification;
+
+    std::thread isr(
+        [&recorder, &notification]()
+        {
+            recorder.mark();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            notification.isr_signal();
+        });
+    notification.wait_for_signal(wait_timeout);
+    recorder.on_notified();
+    isr.join();
+
+    recorder.on_notified();
+    const auto stats = recorder.snapshot();
+    EXPECT_EQ(1U, stats.count);
+    constexpr std::uint32_t five_ms = 5000000U;
+    EXPECT_GE(stats.min, five_ms);
+}
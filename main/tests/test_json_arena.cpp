@@ -0,0 +1,166 @@
+/**
+ * @file test_json_arena.cpp
+ * @brief Unit tests for the arena-backed cJSON allocation hooks of cjsonpp.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_arena.hpp"
+
+namespace
+{
+    const char* const sample_document
+        = R"({"name": "sensor-hub", "channels": [1, 2, 3, 4], "nested": {"enabled": true, "label": "upstairs"}})";
+
+    /**
+     * @brief Verifies a parsed document lives entirely in the arena and is released by one reset.
+     */
+    TEST(JsonArenaTest, parse_allocates_from_arena)
+    {
+        cjsonpp::json_arena arena(4096U);
+        {
+            auto parsed = cjsonpp::parse_result(sample_document, arena);
+            ASSERT_TRUE(parsed);
+            EXPECT_GT(arena.live_blocks(), 0U);
+            EXPECT_GT(arena.used(), 0U);
+            EXPECT_EQ(arena.fallback_count(), 0U);
+            EXPECT_EQ(cjsonpp::json_arena::current(), nullptr);
+
+            auto nested = parsed.value().get<cjsonpp::JSONObject>("nested");
+            ASSERT_TRUE(nested);
+            EXPECT_EQ(nested.value().get<std::string>("label").value(), "upstairs");
+            EXPECT_TRUE(arena.owns(parsed.value().obj()));
+
+            EXPECT_FALSE(arena.reset());
+        }
+
+        EXPECT_EQ(arena.live_blocks(), 0U);
+        const std::size_t high_water = arena.used();
+        EXPECT_TRUE(arena.reset());
+        EXPECT_EQ(arena.used(), 0U);
+        EXPECT_EQ(arena.high_water(), high_water);
+
+        auto heap_parsed = cjsonpp::parse_result(sample_document);
+        ASSERT_TRUE(heap_parsed);
+        EXPECT_FALSE(arena.owns(heap_parsed.value().obj()));
+        EXPECT_EQ(arena.used(), 0U);
+    }
+
+    /**
+     * @brief Verifies a caller buffer too small for the document falls back to the heap without leaking.
+     */
+    TEST(JsonArenaTest, small_caller_buffer_falls_back_to_heap)
+    {
+        alignas(std::max_align_t) std::array<unsigned char, 256U> storage {};
+        cjsonpp::json_arena arena(storage.data(), storage.size());
+        EXPECT_EQ(arena.capacity(), storage.size());
+
+        {
+            auto parsed = cjsonpp::parse_result(std::string(sample_document), arena);
+            ASSERT_TRUE(parsed);
+            EXPECT_GT(arena.fallback_count(), 0U);
+            EXPECT_LE(arena.used(), storage.size());
+            EXPECT_EQ(parsed.value().get<std::string>("name").value(), "sensor-hub");
+        }
+
+        EXPECT_EQ(arena.live_blocks(), 0U);
+        EXPECT_TRUE(arena.reset());
+
+        EXPECT_FALSE(cjsonpp::parse_result("{\"broken\": ", arena));
+        EXPECT_EQ(arena.live_blocks(), 0U);
+    }
+
+    /**
+     * @brief Verifies documents built in a scope can be destroyed outside it, even on another thread.
+     */
+    TEST(JsonArenaTest, scope_builds_and_other_thread_releases)
+    {
+        cjsonpp::json_arena arena(8192U);
+        cjsonpp::JSONObject built;
+        {
+            const cjsonpp::json_arena_scope scope(arena);
+            EXPECT_EQ(cjsonpp::json_arena::current(), &arena);
+            cjsonpp::JSONObject fresh;
+            ASSERT_TRUE(fresh.set("id", 7));
+            ASSERT_TRUE(fresh.set("label", "kitchen"));
+            {
+                const cjsonpp::json_arena_scope suspended(nullptr);
+                EXPECT_EQ(cjsonpp::json_arena::current(), nullptr);
+            }
+            EXPECT_EQ(cjsonpp::json_arena::current(), &arena);
+            built = fresh;
+        }
+        EXPECT_EQ(cjsonpp::json_arena::current(), nullptr);
+        EXPECT_TRUE(arena.owns(built.obj()));
+        EXPECT_EQ(built.get<int>("id").value(), 7);
+
+        std::thread releaser([moved = std::move(built)]() mutable { moved = cjsonpp::JSONObject(); });
+        releaser.join();
+
+        EXPECT_EQ(arena.live_blocks(), 0U);
+        EXPECT_TRUE(arena.reset());
+    }
+
+    /**
+     * @brief Verifies printing into a caller buffer and that print() keeps its buffer out of the arena.
+     */
+    TEST(JsonArenaTest, print_into_caller_buffer)
+    {
+        cjsonpp::json_arena arena(4096U);
+        auto parsed = cjsonpp::parse_result("{\"a\":1,\"b\":[true,null]}", arena);
+        ASSERT_TRUE(parsed);
+
+        std::array<char, 64U> buffer {};
+        auto length = parsed.value().print(buffer.data(), buffer.size(), false);
+        ASSERT_TRUE(length);
+        EXPECT_EQ(std::string(buffer.data(), length.value()), "{\"a\":1,\"b\":[true,null]}");
+
+        std::array<char, 8U> tiny {};
+        auto too_small = parsed.value().print(tiny.data(), tiny.size(), false);
+        ASSERT_FALSE(too_small);
+        EXPECT_EQ(too_small.error().code, cjsonpp::result_code::invalid_argument);
+        EXPECT_FALSE(parsed.value().print(nullptr, 16U, false));
+
+        const std::size_t used = arena.used();
+        {
+            const cjsonpp::json_arena_scope scope(arena);
+            EXPECT_EQ(parsed.value().print(false), "{\"a\":1,\"b\":[true,null]}");
+        }
+        EXPECT_EQ(arena.used(), used);
+    }
+
+} // namespace
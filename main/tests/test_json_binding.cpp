@@ -0,0 +1,198 @@
+/**
+ * @file test_json_binding.cpp
+ * @brief Unit tests for the single-pass struct binding of cjsonpp objects.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_binding.hpp"
+
+namespace
+{
+    struct location
+    {
+        std::string room;
+        int floor = 0;
+    };
+
+    struct sensor_reading
+    {
+        std::string sensor;
+        double value = 0.0;
+        std::uint16_t channel = 0U;
+        bool valid = false;
+        location where;
+        std::int64_t timestamp = -1;
+    };
+
+    constexpr auto location_binding = cjsonpp::make_json_binding<location>(
+        cjsonpp::json_member("room", &location::room), cjsonpp::json_member("floor", &location::floor));
+
+    constexpr auto reading_binding = cjsonpp::make_json_binding<sensor_reading>(
+        cjsonpp::json_member("sensor", &sensor_reading::sensor),
+        cjsonpp::json_member("value", &sensor_reading::value),
+        cjsonpp::json_member("channel", &sensor_reading::channel),
+        cjsonpp::json_member("valid", &sensor_reading::valid),
+        cjsonpp::json_object_member("where", &sensor_reading::where, location_binding),
+        cjsonpp::json_member("timestamp", &sensor_reading::timestamp, false));
+
+    static_assert(reading_binding.field_count == 6U);
+    static_assert(reading_binding.has_distinct_keys());
+    static_assert(cjsonpp::json_key_hash("sensor") == cjsonpp::json_key_hash(std::string_view("sensor")));
+    static_assert(!cjsonpp::make_json_binding<location>(
+        cjsonpp::json_member("room", &location::room), cjsonpp::json_member("room", &location::floor))
+                       .has_distinct_keys());
+
+    /**
+     * @brief Verifies every bound member, including a nested object, is read in one call.
+     */
+    TEST(JsonBindingTest, reads_bound_members)
+    {
+        auto parsed = cjsonpp::parse_result(R"({"extra": [1, 2], "valid": true, "sensor": "hall", "value": 21.5,)"
+                                            R"( "where": {"floor": 2, "room": "attic"}, "channel": 7,)"
+                                            R"( "timestamp": 1700000000123, "sensor": "ignored duplicate"})");
+        ASSERT_TRUE(parsed);
+
+        sensor_reading reading;
+        ASSERT_TRUE(reading_binding.read(parsed.value(), reading));
+        EXPECT_EQ(reading.sensor, "hall");
+        EXPECT_DOUBLE_EQ(reading.value, 21.5);
+        EXPECT_EQ(reading.channel, 7U);
+        EXPECT_TRUE(reading.valid);
+        EXPECT_EQ(reading.where.room, "attic");
+        EXPECT_EQ(reading.where.floor, 2);
+        EXPECT_EQ(reading.timestamp, 1700000000123LL);
+    }
+
+    /**
+     * @brief Verifies absent optional members keep their value and absent required ones are reported.
+     */
+    TEST(JsonBindingTest, reports_missing_members)
+    {
+        auto complete = cjsonpp::parse_result(
+            R"({"sensor": "s", "value": 1, "channel": 0, "valid": false, "where": {"room": "r", "floor": -1}})");
+        ASSERT_TRUE(complete);
+
+        sensor_reading reading;
+        ASSERT_TRUE(reading_binding.read(complete.value(), reading));
+        EXPECT_EQ(reading.timestamp, -1);
+        EXPECT_EQ(reading.where.floor, -1);
+
+        auto partial = cjsonpp::parse_result(R"({"sensor": "s", "value": 1, "where": {"room": "r", "floor": 0}})");
+        ASSERT_TRUE(partial);
+        auto status = reading_binding.read(partial.value(), reading);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().code, cjsonpp::result_code::missing_item);
+        EXPECT_EQ(status.error().detail, 2);
+
+        auto case_mismatch = cjsonpp::parse_result(R"({"Room": "r", "floor": 0})");
+        ASSERT_TRUE(case_mismatch);
+        location place;
+        EXPECT_FALSE(location_binding.read(case_mismatch.value(), place));
+    }
+
+    /**
+     * @brief Verifies type mismatches and out-of-range numbers are rejected with the member index.
+     */
+    TEST(JsonBindingTest, rejects_mismatched_types)
+    {
+        const char* const documents[] = { R"({"room": 3, "floor": 0})", R"({"room": "r", "floor": 1.5})",
+            R"({"room": "r", "floor": 3000000000})", R"({"room": "r", "floor": "2"})" };
+        const int expected_index[] = { 0, 1, 1, 1 };
+
+        for (std::size_t index = 0U; index < 4U; ++index)
+        {
+            auto parsed = cjsonpp::parse_result(documents[index]); // NOLINT bounded index
+            ASSERT_TRUE(parsed);
+            location place;
+            auto status = location_binding.read(parsed.value(), place);
+            ASSERT_FALSE(status) << documents[index]; // NOLINT bounded index
+            EXPECT_EQ(status.error().code, cjsonpp::result_code::invalid_type);
+            EXPECT_EQ(status.error().detail, expected_index[index]); // NOLINT bounded index
+        }
+
+        auto array = cjsonpp::parse_result("[1, 2]");
+        ASSERT_TRUE(array);
+        location place;
+        EXPECT_FALSE(location_binding.read(array.value(), place));
+
+        auto nested_scalar = cjsonpp::parse_result(
+            R"({"sensor": "s", "value": 1, "channel": 70000, "valid": true, "where": {"room": "r", "floor": 0}})");
+        ASSERT_TRUE(nested_scalar);
+        sensor_reading reading;
+        auto status = reading_binding.read(nested_scalar.value(), reading);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().detail, 2);
+
+        auto where_scalar = cjsonpp::parse_result(
+            R"({"sensor": "s", "value": 1, "channel": 7, "valid": true, "where": "kitchen"})");
+        ASSERT_TRUE(where_scalar);
+        status = reading_binding.read(where_scalar.value(), reading);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(status.error().detail, 4);
+    }
+
+    /**
+     * @brief Verifies write() produces an object that reads back to the same struct.
+     */
+    TEST(JsonBindingTest, write_round_trips)
+    {
+        sensor_reading original;
+        original.sensor = "porch";
+        original.value = -3.25;
+        original.channel = 12U;
+        original.valid = true;
+        original.where = location { "garden", 0 };
+        original.timestamp = 1234567890123LL;
+
+        auto written = reading_binding.write(original);
+        ASSERT_TRUE(written);
+
+        auto reparsed = cjsonpp::parse_result(written.value().print(false));
+        ASSERT_TRUE(reparsed);
+
+        sensor_reading copy;
+        ASSERT_TRUE(reading_binding.read(reparsed.value(), copy));
+        EXPECT_EQ(copy.sensor, original.sensor);
+        EXPECT_DOUBLE_EQ(copy.value, original.value);
+        EXPECT_EQ(copy.channel, original.channel);
+        EXPECT_EQ(copy.valid, original.valid);
+        EXPECT_EQ(copy.where.room, original.where.room);
+        EXPECT_EQ(copy.where.floor, original.where.floor);
+        EXPECT_EQ(copy.timestamp, original.timestamp);
+    }
+
+} // namespace
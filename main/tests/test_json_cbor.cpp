@@ -0,0 +1,269 @@
+/**
+ * @file test_json_cbor.cpp
+ * @brief Unit tests for the CBOR transcoding of cjsonpp documents and bound structs.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_binding.hpp"
+#include "cjsonpp/json_cbor.hpp"
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+namespace
+{
+    struct location
+    {
+        std::string room;
+        int floor = 0;
+    };
+
+    struct sensor_reading
+    {
+        std::string sensor;
+        double value = 0.0;
+        std::uint16_t channel = 0U;
+        bool valid = false;
+        location where;
+        std::int64_t timestamp = -1;
+    };
+
+    constexpr auto location_binding = cjsonpp::make_json_binding<location>(
+        cjsonpp::json_member("room", &location::room), cjsonpp::json_member("floor", &location::floor));
+
+    constexpr auto reading_binding = cjsonpp::make_json_binding<sensor_reading>(
+        cjsonpp::json_member("sensor", &sensor_reading::sensor),
+        cjsonpp::json_member("value", &sensor_reading::value),
+        cjsonpp::json_member("channel", &sensor_reading::channel),
+        cjsonpp::json_member("valid", &sensor_reading::valid),
+        cjsonpp::json_object_member("where", &sensor_reading::where, location_binding),
+        cjsonpp::json_member("timestamp", &sensor_reading::timestamp, false));
+
+    std::vector<std::uint8_t> encoded_bytes(const cjsonpp::cbor_stream& stream)
+    {
+        const auto view = stream.data();
+        const auto* bytes = view.as<std::uint8_t>();
+        return std::vector<std::uint8_t>(bytes, bytes + view.size()); // NOLINT pointer arithmetic
+    }
+
+    /**
+     * @brief Verifies a document survives a CBOR round trip and encodes smaller than its JSON text.
+     */
+    TEST(JsonCborTest, document_round_trips)
+    {
+        const std::string json = R"({"sensor":"boiler room thermometer","values":[21.5,-3,0.1,1e+300,4294967296],)"
+                                 R"("valid":true,"error":null,"nested":{"empty":[],"off":false,"name":""}})";
+        auto parsed = cjsonpp::parse_result(json);
+        ASSERT_TRUE(parsed);
+
+        std::array<std::uint8_t, 256U> buffer {};
+        cjsonpp::cbor_stream writer { bytepack::buffer_view(buffer) };
+        ASSERT_TRUE(cjsonpp::write_cbor(parsed.value(), writer));
+        EXPECT_LT(writer.data().size(), json.size());
+
+        cjsonpp::cbor_stream reader(writer.data());
+        auto decoded = cjsonpp::read_cbor(reader);
+        ASSERT_TRUE(decoded);
+        EXPECT_EQ(decoded.value().print(false), parsed.value().print(false));
+    }
+
+    /**
+     * @brief Verifies the encoding against RFC 8949 examples: shortest integers, definite lengths, exact floats.
+     */
+    TEST(JsonCborTest, encodes_rfc_examples)
+    {
+        auto parsed = cjsonpp::parse_result(R"({"a": 1, "b": [2, 3]})");
+        ASSERT_TRUE(parsed);
+
+        std::array<std::uint8_t, 64U> buffer {};
+        cjsonpp::cbor_stream writer { bytepack::buffer_view(buffer) };
+        ASSERT_TRUE(cjsonpp::write_cbor(parsed.value(), writer));
+        EXPECT_EQ(encoded_bytes(writer),
+            (std::vector<std::uint8_t> { 0xa2U, 0x61U, 0x61U, 0x01U, 0x61U, 0x62U, 0x82U, 0x02U, 0x03U }));
+
+        writer.reset();
+        ASSERT_TRUE(cjsonpp::write_cbor(cjsonpp::JSONObject(-1000), writer));
+        EXPECT_EQ(encoded_bytes(writer), (std::vector<std::uint8_t> { 0x39U, 0x03U, 0xe7U }));
+
+        writer.reset();
+        ASSERT_TRUE(cjsonpp::write_cbor(cjsonpp::JSONObject(1.5), writer));
+        EXPECT_EQ(encoded_bytes(writer), (std::vector<std::uint8_t> { 0xfaU, 0x3fU, 0xc0U, 0x00U, 0x00U }));
+
+        writer.reset();
+        ASSERT_TRUE(cjsonpp::write_cbor(cjsonpp::JSONObject(1.1), writer));
+        EXPECT_EQ(encoded_bytes(writer),
+            (std::vector<std::uint8_t> { 0xfbU, 0x3fU, 0xf1U, 0x99U, 0x99U, 0x99U, 0x99U, 0x99U, 0x9aU }));
+    }
+
+    /**
+     * @brief Verifies foreign encodings are decoded (half floats, tags) and items without JSON form rejected.
+     */
+    TEST(JsonCborTest, decodes_foreign_items)
+    {
+        // {"t": 1(1363896240), "h": half 1.0, "u": undefined}
+        std::array<std::uint8_t, 17U> foreign { 0xa3U, 0x61U, 0x74U, 0xc1U, 0x1aU, 0x51U, 0x4bU, 0x67U, 0xb0U, 0x61U,
+            0x68U, 0xf9U, 0x3cU, 0x00U, 0x61U, 0x75U, 0xf7U };
+        cjsonpp::cbor_stream reader { bytepack::buffer_view(foreign) };
+        auto decoded = cjsonpp::read_cbor(reader);
+        ASSERT_TRUE(decoded);
+        EXPECT_EQ(decoded.value().print(false), R"({"t":1363896240,"h":1,"u":null})");
+
+        std::array<std::uint8_t, 3U> bytes { 0x42U, 0x01U, 0x02U };
+        cjsonpp::cbor_stream byte_reader { bytepack::buffer_view(bytes) };
+        auto byte_string = cjsonpp::read_cbor(byte_reader);
+        ASSERT_FALSE(byte_string);
+        EXPECT_EQ(byte_string.error().code, cjsonpp::result_code::invalid_type);
+
+        std::array<std::uint8_t, 3U> indefinite { 0x9fU, 0x01U, 0xffU };
+        cjsonpp::cbor_stream indefinite_reader { bytepack::buffer_view(indefinite) };
+        auto indefinite_array = cjsonpp::read_cbor(indefinite_reader);
+        ASSERT_FALSE(indefinite_array);
+        EXPECT_EQ(indefinite_array.error().code, cjsonpp::result_code::parse_error);
+
+        std::array<std::uint8_t, 4U> truncated { 0x82U, 0x01U, 0x63U, 0x61U };
+        cjsonpp::cbor_stream truncated_reader { bytepack::buffer_view(truncated) };
+        auto truncated_array = cjsonpp::read_cbor(truncated_reader);
+        ASSERT_FALSE(truncated_array);
+        EXPECT_EQ(truncated_array.error().code, cjsonpp::result_code::parse_error);
+    }
+
+    /**
+     * @brief Verifies a struct written as CBOR reads back directly, and through the JSON view used by tooling.
+     */
+    TEST(JsonCborTest, binding_round_trips)
+    {
+        sensor_reading original;
+        original.sensor = "porch";
+        original.value = -3.25;
+        original.channel = 65535U;
+        original.valid = true;
+        original.where = location { "garden", -2 };
+        original.timestamp = 1234567890123LL;
+
+        std::array<std::uint8_t, 128U> buffer {};
+        cjsonpp::cbor_stream writer { bytepack::buffer_view(buffer) };
+        ASSERT_TRUE(cjsonpp::write_cbor(reading_binding, original, writer));
+
+        cjsonpp::cbor_stream reader(writer.data());
+        sensor_reading copy;
+        ASSERT_TRUE(cjsonpp::read_cbor(reading_binding, reader, copy));
+        EXPECT_EQ(copy.sensor, original.sensor);
+        EXPECT_DOUBLE_EQ(copy.value, original.value);
+        EXPECT_EQ(copy.channel, original.channel);
+        EXPECT_EQ(copy.valid, original.valid);
+        EXPECT_EQ(copy.where.room, original.where.room);
+        EXPECT_EQ(copy.where.floor, original.where.floor);
+        EXPECT_EQ(copy.timestamp, original.timestamp);
+
+        cjsonpp::cbor_stream tooling_reader(writer.data());
+        auto document = cjsonpp::read_cbor(tooling_reader);
+        ASSERT_TRUE(document);
+        sensor_reading from_json;
+        ASSERT_TRUE(reading_binding.read(document.value(), from_json));
+        EXPECT_EQ(from_json.where.room, original.where.room);
+        EXPECT_EQ(from_json.timestamp, original.timestamp);
+    }
+
+    /**
+     * @brief Verifies unbound keys are skipped and missing or mistyped members reported like the JSON read.
+     */
+    TEST(JsonCborTest, binding_reports_errors)
+    {
+        std::array<std::uint8_t, 256U> buffer {};
+        cjsonpp::cbor_stream writer { bytepack::buffer_view(buffer) };
+        const auto encode = [&writer](const char* json)
+        {
+            writer.reset();
+            auto parsed = cjsonpp::parse_result(json);
+            return parsed && cjsonpp::write_cbor(parsed.value(), writer);
+        };
+
+        ASSERT_TRUE(encode(R"({"extra": [1, {"deep": "x"}], "valid": false, "sensor": "s", "value": 2, "channel": 3,)"
+                           R"( "where": {"room": "r", "floor": 1, "tag": 4.5}, "sensor": "ignored duplicate"})"));
+        cjsonpp::cbor_stream reader(writer.data());
+        sensor_reading reading;
+        ASSERT_TRUE(cjsonpp::read_cbor(reading_binding, reader, reading));
+        EXPECT_EQ(reading.sensor, "s");
+        EXPECT_DOUBLE_EQ(reading.value, 2.0);
+        EXPECT_EQ(reading.where.floor, 1);
+        EXPECT_EQ(reading.timestamp, -1);
+
+        ASSERT_TRUE(encode(R"({"sensor": "s", "value": 2, "valid": true, "where": {"room": "r", "floor": 1}})"));
+        cjsonpp::cbor_stream missing_reader(writer.data());
+        auto missing = cjsonpp::read_cbor(reading_binding, missing_reader, reading);
+        ASSERT_FALSE(missing);
+        EXPECT_EQ(missing.error().code, cjsonpp::result_code::missing_item);
+        EXPECT_EQ(missing.error().detail, 2);
+
+        ASSERT_TRUE(encode(R"({"sensor": "s", "value": 2, "channel": 70000, "valid": true})"));
+        cjsonpp::cbor_stream range_reader(writer.data());
+        auto out_of_range = cjsonpp::read_cbor(reading_binding, range_reader, reading);
+        ASSERT_FALSE(out_of_range);
+        EXPECT_EQ(out_of_range.error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(out_of_range.error().detail, 2);
+
+        ASSERT_TRUE(encode(R"({"where": [1, 2]})"));
+        cjsonpp::cbor_stream nested_reader(writer.data());
+        auto not_nested = cjsonpp::read_cbor(reading_binding, nested_reader, reading);
+        ASSERT_FALSE(not_nested);
+        EXPECT_EQ(not_nested.error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(not_nested.error().detail, 4);
+    }
+
+    /**
+     * @brief Verifies a full stream buffer is reported instead of producing a partial item silently.
+     */
+    TEST(JsonCborTest, reports_full_buffer)
+    {
+        std::array<std::uint8_t, 8U> buffer {};
+        cjsonpp::cbor_stream writer { bytepack::buffer_view(buffer) };
+        auto status = cjsonpp::write_cbor(cjsonpp::JSONObject("a string longer than the buffer"), writer);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().code, cjsonpp::result_code::invalid_argument);
+
+        sensor_reading reading;
+        writer.reset();
+        auto bound = cjsonpp::write_cbor(reading_binding, reading, writer);
+        ASSERT_FALSE(bound);
+        EXPECT_EQ(bound.error().code, cjsonpp::result_code::invalid_argument);
+    }
+
+} // namespace
+
+#endif // C++20
@@ -0,0 +1,158 @@
+/**
+ * @file test_json_lazy_document.cpp
+ * @brief Unit tests for the lazily materialized JSON document of cjsonpp.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_lazy_document.hpp"
+
+namespace
+{
+    const char* const config_document = R"({
+        "device": {"id": 42, "name": "sensor-hub"},
+        "wifi": {"ssid": "home", "channels": [1, 6, 11]},
+        "rate": 12.5,
+        "enabled": true,
+        "label": "upstairs, \"north\"",
+        "café": null,
+        "broken": {"a": [1, 2,]}
+    })";
+
+    /**
+     * @brief Verifies the index covers the top level only and members are parsed and cached on first access.
+     */
+    TEST(JsonLazyDocumentTest, materializes_members_on_first_access)
+    {
+        auto indexed = cjsonpp::json_lazy_document::index(std::string_view(config_document));
+        ASSERT_TRUE(indexed);
+        const auto& document = indexed.value();
+        EXPECT_EQ(document.root_type(), cjsonpp::JSONType::Object);
+        EXPECT_EQ(document.size(), 7U);
+        EXPECT_EQ(document.materialized_count(), 0U);
+
+        EXPECT_TRUE(document.has("wifi"));
+        EXPECT_FALSE(document.has("WIFI"));
+        EXPECT_EQ(document.type("device"), cjsonpp::JSONType::Object);
+        EXPECT_EQ(document.type("enabled"), cjsonpp::JSONType::Bool);
+        EXPECT_EQ(document.type("missing"), cjsonpp::JSONType::Invalid);
+        EXPECT_EQ(document.raw("rate"), "12.5");
+        EXPECT_EQ(document.key(5U), "caf\xc3\xa9");
+        EXPECT_EQ(document.materialized_count(), 0U);
+
+        auto device = document.get("device");
+        ASSERT_TRUE(device);
+        EXPECT_EQ(device.value().get<int>("id").value(), 42);
+        EXPECT_EQ(document.materialized_count(), 1U);
+
+        auto device_again = document.get("device");
+        ASSERT_TRUE(device_again);
+        EXPECT_EQ(device_again.value().obj(), device.value().obj());
+        EXPECT_EQ(document.materialized_count(), 1U);
+
+        EXPECT_DOUBLE_EQ(document.get<double>("rate").value(), 12.5);
+        EXPECT_TRUE(document.get<bool>("enabled").value());
+        EXPECT_EQ(document.get<std::string>("label").value(), "upstairs, \"north\"");
+        EXPECT_EQ(document.get<int>("label").error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(document.get("missing").error().code, cjsonpp::result_code::missing_item);
+        EXPECT_EQ(document.materialized_count(), 4U);
+    }
+
+    /**
+     * @brief Verifies a malformed nested member only fails when it is read, with its offset as detail.
+     */
+    TEST(JsonLazyDocumentTest, reports_malformed_members_on_access)
+    {
+        auto indexed = cjsonpp::json_lazy_document::index(std::string(config_document));
+        ASSERT_TRUE(indexed);
+        const auto& document = indexed.value();
+
+        auto broken = document.get("broken");
+        ASSERT_FALSE(broken);
+        EXPECT_EQ(broken.error().code, cjsonpp::result_code::parse_error);
+        EXPECT_EQ(static_cast<std::size_t>(broken.error().detail),
+            std::string_view(config_document).find(R"({"a": [1, 2,]})"));
+
+        auto wifi = document.get("wifi");
+        ASSERT_TRUE(wifi);
+        EXPECT_EQ(wifi.value().get<std::string>("ssid").value(), "home");
+    }
+
+    /**
+     * @brief Verifies top-level errors are reported by index() with their offset.
+     */
+    TEST(JsonLazyDocumentTest, rejects_malformed_top_level)
+    {
+        auto scalar = cjsonpp::json_lazy_document::index(std::string_view("42"));
+        ASSERT_FALSE(scalar);
+        EXPECT_EQ(scalar.error().code, cjsonpp::result_code::parse_error);
+
+        auto missing_colon = cjsonpp::json_lazy_document::index(std::string_view(R"({"a" 1})"));
+        ASSERT_FALSE(missing_colon);
+        EXPECT_EQ(missing_colon.error().detail, 5);
+
+        auto truncated = cjsonpp::json_lazy_document::index(std::string_view(R"({"a": {"b": 1})"));
+        ASSERT_FALSE(truncated);
+
+        auto trailing = cjsonpp::json_lazy_document::index(std::string_view(R"({} x)"));
+        ASSERT_FALSE(trailing);
+        EXPECT_EQ(trailing.error().detail, 3);
+
+        auto empty = cjsonpp::json_lazy_document::index(std::string_view(" { } "));
+        ASSERT_TRUE(empty);
+        EXPECT_EQ(empty.value().size(), 0U);
+    }
+
+    /**
+     * @brief Verifies array roots are indexed by position, and materialized members outlive the document.
+     */
+    TEST(JsonLazyDocumentTest, indexes_array_elements)
+    {
+        cjsonpp::JSONObject kept;
+        {
+            auto indexed = cjsonpp::json_lazy_document::index(std::string(R"([{"v": 1}, "two", [3]])"));
+            ASSERT_TRUE(indexed);
+            const auto& document = indexed.value();
+            EXPECT_EQ(document.root_type(), cjsonpp::JSONType::Array);
+            EXPECT_EQ(document.size(), 3U);
+            EXPECT_TRUE(document.key(0U).empty());
+            EXPECT_FALSE(document.has("v"));
+            EXPECT_EQ(document.at(1U).value().as<std::string>().value(), "two");
+            EXPECT_EQ(document.at(3U).error().code, cjsonpp::result_code::missing_item);
+            kept = document.at(0U).value();
+        }
+        EXPECT_EQ(kept.get<int>("v").value(), 1);
+    }
+}
@@ -0,0 +1,300 @@
+/**
+ * @file test_json_stream_parser.cpp
+ * @brief Unit tests for the cjsonpp streaming pull parser and path extractor.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cjsonpp/json_stream_parser.hpp"
+#include "tools/memory_pipe.hpp"
+
+namespace
+{
+    /** @brief Event reduced to comparable values. */
+    struct recorded_event
+    {
+        cjsonpp::json_event_type type;
+        std::string text;
+
+        bool operator==(const recorded_event& other) const
+        {
+            return (type == other.type) && (text == other.text);
+        }
+    };
+
+    /**
+     * @brief Feeds a document in chunks of chunk_size bytes and records every event until the end.
+     * @return false if the parser reported an error.
+     */
+    bool collect(const std::string& document, std::size_t chunk_size, std::vector<recorded_event>& events,
+        const cjsonpp::json_stream_limits& limits = cjsonpp::json_stream_limits {})
+    {
+        cjsonpp::json_pull_parser parser(limits);
+        std::size_t position = 0U;
+        for (;;)
+        {
+            auto event = parser.next();
+            if (!event.has_value())
+            {
+                return false;
+            }
+
+            const auto type = event.value().type;
+            if (cjsonpp::json_event_type::end_of_document == type)
+            {
+                return true;
+            }
+
+            if (cjsonpp::json_event_type::need_input == type)
+            {
+                if (position == document.size())
+                {
+                    parser.finish();
+                    continue;
+                }
+                const std::size_t size = std::min(chunk_size, document.size() - position);
+                parser.feed(document.data() + position, size);
+                position += size;
+                continue;
+            }
+
+            events.push_back(recorded_event { type, std::string(event.value().text) });
+        }
+    }
+
+    /**
+     * @brief Verifies the event sequence of a document with every kind of value.
+     */
+    TEST(JsonStreamParserTest, emits_events_in_document_order)
+    {
+        using cjsonpp::json_event_type;
+        const std::string document = R"({"id": 42, "name": "probe", "on": true, "off": false, "none": null,)"
+                                     R"( "list": [1.5, -2e3, {}], "nested": {"a": []}})";
+
+        std::vector<recorded_event> events;
+        ASSERT_TRUE(collect(document, document.size(), events));
+
+        const std::vector<recorded_event> expected { { json_event_type::begin_object, "" },
+            { json_event_type::key, "id" }, { json_event_type::number, "42" }, { json_event_type::key, "name" },
+            { json_event_type::string, "probe" }, { json_event_type::key, "on" }, { json_event_type::boolean, "true" },
+            { json_event_type::key, "off" }, { json_event_type::boolean, "false" }, { json_event_type::key, "none" },
+            { json_event_type::null, "null" }, { json_event_type::key, "list" }, { json_event_type::begin_array, "" },
+            { json_event_type::number, "1.5" }, { json_event_type::number, "-2e3" },
+            { json_event_type::begin_object, "" }, { json_event_type::end_object, "" },
+            { json_event_type::end_array, "" }, { json_event_type::key, "nested" },
+            { json_event_type::begin_object, "" }, { json_event_type::key, "a" }, { json_event_type::begin_array, "" },
+            { json_event_type::end_array, "" }, { json_event_type::end_object, "" },
+            { json_event_type::end_object, "" } };
+        EXPECT_EQ(events, expected);
+    }
+
+    /**
+     * @brief Verifies feeding one byte at a time gives the same events as a single chunk.
+     */
+    TEST(JsonStreamParserTest, byte_chunks_match_single_chunk)
+    {
+        const std::string document = R"([{"key": "va\"lue", "n": -0.25e+1}, true, null, 12345678, "x\u00e9"])";
+
+        std::vector<recorded_event> whole;
+        std::vector<recorded_event> split;
+        ASSERT_TRUE(collect(document, document.size(), whole));
+        ASSERT_TRUE(collect(document, 1U, split));
+        EXPECT_EQ(whole, split);
+        EXPECT_EQ(split.size(), 12U);
+
+        std::vector<recorded_event> root_number;
+        ASSERT_TRUE(collect("  1024 ", 1U, root_number));
+        ASSERT_EQ(root_number.size(), 1U);
+        EXPECT_EQ(root_number[0].text, "1024");
+
+        root_number.clear();
+        ASSERT_TRUE(collect("7", 1U, root_number));
+        ASSERT_EQ(root_number.size(), 1U);
+        EXPECT_EQ(root_number[0].text, "7");
+    }
+
+    /**
+     * @brief Verifies escapes, including surrogate pairs, are decoded to UTF-8.
+     */
+    TEST(JsonStreamParserTest, decodes_escapes)
+    {
+        std::vector<recorded_event> events;
+        ASSERT_TRUE(collect(R"(["a\\b\/c\n\t", "\u0041\u00e9\u20ac", "\ud83d\ude00"])", 3U, events));
+        ASSERT_EQ(events.size(), 5U);
+        EXPECT_EQ(events[1].text, "a\\b/c\n\t");
+        EXPECT_EQ(events[2].text, "A\xc3\xa9\xe2\x82\xac");
+        EXPECT_EQ(events[3].text, "\xf0\x9f\x98\x80");
+    }
+
+    /**
+     * @brief Verifies malformed documents and exceeded limits are reported as parse errors.
+     */
+    TEST(JsonStreamParserTest, rejects_invalid_input_and_limits)
+    {
+        const std::vector<std::string> invalid { "{\"a\" 1}", "{\"a\":1,}", "[1,]", "[01]", "[1.]", "[-]", "[tru]",
+            "[nul1]", "{\"a\":1]", "\"unterminated", "[\"\\x\"]", "[\"\\ud83d\"]", "[\"\\ude00\"]", "{1:2}",
+            "[\"tab\there\"]", "", "[1 2]" };
+        for (const auto& document : invalid)
+        {
+            std::vector<recorded_event> events;
+            EXPECT_FALSE(collect(document, 2U, events)) << document;
+        }
+
+        cjsonpp::json_stream_limits limits;
+        limits.max_depth = 3U;
+        limits.max_token_length = 8U;
+
+        std::vector<recorded_event> events;
+        EXPECT_TRUE(collect("[[[\"12345678\"]]]", 2U, events, limits));
+        EXPECT_FALSE(collect("[[[[]]]]", 2U, events, limits));
+        EXPECT_FALSE(collect("[\"123456789\"]", 2U, events, limits));
+
+        cjsonpp::json_pull_parser parser;
+        const std::string garbage = "[1, x]";
+        parser.feed(garbage.data(), garbage.size());
+        cjsonpp::json_event_type last = cjsonpp::json_event_type::need_input;
+        for (int step = 0; step < 2; ++step)
+        {
+            auto event = parser.next();
+            ASSERT_TRUE(event.has_value());
+            last = event.value().type;
+        }
+        EXPECT_EQ(last, cjsonpp::json_event_type::number);
+
+        auto failure = parser.next();
+        ASSERT_FALSE(failure.has_value());
+        EXPECT_EQ(failure.error().code, cjsonpp::result_code::parse_error);
+        EXPECT_EQ(failure.error().detail, 5);
+        EXPECT_FALSE(parser.next().has_value());
+
+        parser.reset();
+        parser.feed("[]", 2U);
+        auto restarted = parser.next();
+        ASSERT_TRUE(restarted.has_value());
+        EXPECT_EQ(restarted.value().type, cjsonpp::json_event_type::begin_array);
+    }
+
+    /**
+     * @brief Verifies fields are extracted by path across chunk boundaries and converted on request.
+     */
+    TEST(JsonStreamParserTest, extracts_fields_by_path)
+    {
+        const std::string document = R"({"device": {"id": "esp32-07", "rev": 3},)"
+                                     R"( "sensors": [{"value": 1.25}, {"value": -40, "ok": false}],)"
+                                     R"( "device.id": "shadow", "uptime": 4294967296, "matrix": [[1, 2], [3, 4]]})";
+
+        cjsonpp::json_path_extractor extractor(
+            { "device.id", "device.rev", "sensors[1].value", "sensors[1].ok", "uptime", "matrix[1][0]", "missing" });
+        for (std::size_t position = 0U; position < document.size(); position += 5U)
+        {
+            const std::size_t size = std::min<std::size_t>(5U, document.size() - position);
+            ASSERT_TRUE(extractor.feed(document.data() + position, size));
+        }
+        ASSERT_TRUE(extractor.finish());
+        EXPECT_FALSE(extractor.complete());
+        EXPECT_TRUE(extractor.done());
+
+        EXPECT_EQ(extractor.get<std::string>(0U).value(), "esp32-07");
+        EXPECT_EQ(extractor.get<int>(1U).value(), 3);
+        EXPECT_EQ(extractor.get<int>(2U).value(), -40);
+        EXPECT_FALSE(extractor.get<bool>(3U).value());
+        EXPECT_EQ(extractor.get<std::int64_t>(4U).value(), 4294967296LL);
+        EXPECT_EQ(extractor.get<int>(5U).value(), 3);
+
+        EXPECT_EQ(extractor.get<int>(6U).error().code, cjsonpp::result_code::missing_item);
+        EXPECT_EQ(extractor.get<std::uint32_t>(4U).error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(extractor.get<std::uint8_t>(2U).error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_EQ(extractor.get<std::string>(1U).error().code, cjsonpp::result_code::invalid_type);
+        EXPECT_DOUBLE_EQ(extractor.get<double>(2U).value(), -40.0);
+        ASSERT_TRUE(extractor.field(0U).has_value());
+        EXPECT_EQ(extractor.field(0U)->type, cjsonpp::json_event_type::string);
+    }
+
+    /**
+     * @brief Verifies the extractor stops reading once every path is found, and reports truncated documents.
+     */
+    TEST(JsonStreamParserTest, stops_early_and_reports_truncation)
+    {
+        cjsonpp::json_path_extractor extractor({ "[0]" });
+        const std::string head = "[\"first\", ";
+        ASSERT_TRUE(extractor.feed(head.data(), head.size()));
+        EXPECT_TRUE(extractor.complete());
+
+        const std::string tail = "this is not json";
+        EXPECT_TRUE(extractor.feed(tail.data(), tail.size()));
+        EXPECT_TRUE(extractor.finish());
+        EXPECT_EQ(extractor.get<std::string>(0U).value(), "first");
+
+        cjsonpp::json_path_extractor truncated({ "a.b" });
+        const std::string partial = "{\"a\": {\"c\": 1";
+        ASSERT_TRUE(truncated.feed(partial.data(), partial.size()));
+        auto status = truncated.finish();
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().code, cjsonpp::result_code::parse_error);
+    }
+
+    /**
+     * @brief Verifies the extractor pulls a document through a memory_pipe in small chunks.
+     */
+    TEST(JsonStreamParserTest, feeds_from_memory_pipe)
+    {
+        constexpr std::chrono::duration<std::uint64_t, std::milli> timeout(100U);
+        tools::memory_pipe pipe(256U);
+
+        const std::string document = R"({"header": {"seq": 12}, "payload": [10, 20, 30], "crc": "0xbeef"}  )";
+        ASSERT_EQ(pipe.send(reinterpret_cast<const std::uint8_t*>(document.data()), document.size(), timeout),
+            document.size());
+
+        cjsonpp::json_path_extractor extractor({ "header.seq", "payload[2]", "crc", "absent" });
+        std::vector<std::uint8_t> chunk(7U);
+        ASSERT_TRUE(extractor.feed_from(pipe, chunk.data(), chunk.size(), timeout));
+        EXPECT_TRUE(extractor.done());
+        EXPECT_EQ(extractor.get<int>(0U).value(), 12);
+        EXPECT_EQ(extractor.get<int>(1U).value(), 30);
+        EXPECT_EQ(extractor.get<std::string>(2U).value(), "0xbeef");
+
+        cjsonpp::json_path_extractor stalled({ "x" });
+        const std::string partial = "{\"y\": 1, ";
+        ASSERT_EQ(pipe.send(reinterpret_cast<const std::uint8_t*>(partial.data()), partial.size(), timeout),
+            partial.size());
+        auto status = stalled.feed_from(pipe, chunk.data(), chunk.size(), timeout);
+        ASSERT_FALSE(status);
+        EXPECT_EQ(status.error().message, "Input stalled");
+    }
+
+} // namespace
@@ -0,0 +1,176 @@
+/**
+ * @file test_json_stream_printer.cpp
+ * @brief Unit tests for the chunked printer of cjsonpp documents.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "cJSON/cJSON.h"
+#include "cjsonpp/cjsonpp.hpp"
+#include "cjsonpp/json_stream_printer.hpp"
+#include "tools/memory_pipe.hpp"
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::milli> pipe_timeout(100U);
+
+    const char* const sample_document = R"({"name":"pump \"A\"\t\\ \u0001 é","values":[0.1,-2.5e-07,1e+300,12345678901234,-3],)"
+                                        R"("flags":{"on":true,"off":false,"none":null},"empty":{},"list":[],)"
+                                        R"("nested":[{"deep":[[1,2],{"k":"v"}]}]})";
+
+    std::string cjson_text(const cjsonpp::JSONObject& object, bool formatted)
+    {
+        char* text = formatted ? cJSON_Print(object.obj()) : cJSON_PrintUnformatted(object.obj());
+        std::string copy(text);
+        cJSON_free(text);
+        return copy;
+    }
+
+    /**
+     * @brief Verifies the chunks concatenate to cJSON's own text, whatever the scratch size.
+     */
+    TEST(JsonStreamPrinterTest, matches_cjson_print)
+    {
+        auto parsed = cjsonpp::parse_result(sample_document);
+        ASSERT_TRUE(parsed);
+        cJSON_AddItemToObject(parsed.value().obj(), "raw", cJSON_CreateRaw("[1, 2]"));
+
+        for (const std::size_t scratch_size : { 1U, 7U, 256U })
+        {
+            cjsonpp::json_stream_printer printer(scratch_size);
+            for (const bool formatted : { false, true })
+            {
+                std::string output;
+                std::size_t largest_chunk = 0U;
+                auto collect = [&output, &largest_chunk](const char* data, std::size_t size)
+                {
+                    output.append(data, size);
+                    largest_chunk = std::max(largest_chunk, size);
+                    return true;
+                };
+
+                auto written = printer.print(parsed.value(), formatted, cjsonpp::json_chunk_writer(collect));
+                ASSERT_TRUE(written);
+                EXPECT_EQ(output, cjson_text(parsed.value(), formatted));
+                EXPECT_EQ(written.value(), output.size());
+                EXPECT_LE(largest_chunk, scratch_size);
+            }
+        }
+    }
+
+    /**
+     * @brief Verifies a large document goes through a small caller scratch buffer into a memory_pipe.
+     */
+    TEST(JsonStreamPrinterTest, prints_into_memory_pipe)
+    {
+        auto document = cjsonpp::arrayObject();
+        for (int index = 0; index < 2000; ++index)
+        {
+            ASSERT_TRUE(document.add(index * 0.5));
+        }
+        const std::string expected = cjson_text(document, false);
+
+        tools::memory_pipe pipe(expected.size() * 2U);
+        std::vector<char> scratch(32U);
+        cjsonpp::json_stream_printer printer(scratch.data(), scratch.size());
+        auto written = printer.print_to(document, false, pipe, pipe_timeout);
+        ASSERT_TRUE(written);
+        ASSERT_EQ(written.value(), expected.size());
+
+        std::vector<std::uint8_t> received(expected.size());
+        ASSERT_EQ(pipe.receive(received.data(), received.size(), pipe_timeout), expected.size());
+        EXPECT_EQ(std::string(received.begin(), received.end()), expected);
+    }
+
+    /**
+     * @brief Verifies printing into a caller buffer needs exactly the text and its terminator.
+     */
+    TEST(JsonStreamPrinterTest, prints_into_exact_buffer)
+    {
+        auto parsed = cjsonpp::parse_result(sample_document);
+        ASSERT_TRUE(parsed);
+        const std::string expected = cjson_text(parsed.value(), true);
+
+        cjsonpp::json_stream_printer printer(8U);
+        std::vector<char> buffer(expected.size() + 1U, 'x');
+        auto length = printer.print_to(parsed.value(), true, buffer.data(), buffer.size());
+        ASSERT_TRUE(length);
+        EXPECT_EQ(length.value(), expected.size());
+        EXPECT_EQ(std::string(buffer.data()), expected);
+
+        auto too_small = printer.print_to(parsed.value(), true, buffer.data(), expected.size());
+        ASSERT_FALSE(too_small);
+        EXPECT_EQ(too_small.error().code, cjsonpp::result_code::invalid_argument);
+
+        // the printer still works with its own scratch afterwards
+        std::string output;
+        auto collect = [&output](const char* data, std::size_t size)
+        {
+            output.append(data, size);
+            return true;
+        };
+        ASSERT_TRUE(printer.print(parsed.value(), false, cjsonpp::json_chunk_writer(collect)));
+        EXPECT_EQ(output, cjson_text(parsed.value(), false));
+    }
+
+    /**
+     * @brief Verifies a writer refusing a chunk stops the printing with an error.
+     */
+    TEST(JsonStreamPrinterTest, reports_refused_output)
+    {
+        auto parsed = cjsonpp::parse_result(sample_document);
+        ASSERT_TRUE(parsed);
+
+        std::size_t accepted = 0U;
+        auto limited = [&accepted](const char* /*data*/, std::size_t size)
+        {
+            accepted += size;
+            return accepted <= 32U;
+        };
+        cjsonpp::json_stream_printer printer(16U);
+        auto written = printer.print(parsed.value(), false, cjsonpp::json_chunk_writer(limited));
+        ASSERT_FALSE(written);
+        EXPECT_EQ(written.error().code, cjsonpp::result_code::invalid_argument);
+        EXPECT_EQ(accepted, 48U);
+
+        cjsonpp::json_stream_printer no_scratch(nullptr, 0U);
+        EXPECT_FALSE(no_scratch.print(parsed.value(), false, cjsonpp::json_chunk_writer(limited)));
+    }
+
+} // namespace
@@ -0,0 +1,179 @@
+/**
+ * @file test_light_event.cpp
+ * @brief Unit tests for the tools::light_event class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "tools/light_event.hpp"
+
+/**
+ * @brief Test case for the initial state and the non-blocking consumption of a signal.
+ */
+TEST(LightEventTest, SignalAndTryWait)
+{
+    tools::light_event event;
+    EXPECT_FALSE(event.is_signaled());
+    EXPECT_FALSE(event.try_wait_for_signal());
+
+    event.signal();
+    event.signal(); // signals do not accumulate
+    EXPECT_TRUE(event.is_signaled());
+    EXPECT_TRUE(event.try_wait_for_signal());
+    EXPECT_FALSE(event.is_signaled());
+    EXPECT_FALSE(event.try_wait_for_signal());
+}
+
+/**
+ * @brief Test case for a waiter parked until another thread signals.
+ */
+TEST(LightEventTest, WaitForSignal)
+{
+    tools::light_event event;
+    std::thread signal_thread(
+        [&event]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            event.signal();
+        });
+
+    auto start = std::chrono::steady_clock::now();
+    event.wait_for_signal();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed.count(), 95.0);
+    EXPECT_FALSE(event.is_signaled());
+    signal_thread.join();
+}
+
+/**
+ * @brief Test case for timed waits: timeout without signal, immediate return on a pending signal, and a signal
+ * ending a wait bounded by duration::max.
+ */
+TEST(LightEventTest, WaitForSignalWithTimeout)
+{
+    tools::light_event event;
+    auto start = std::chrono::steady_clock::now();
+    event.wait_for_signal(std::chrono::milliseconds(100));
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed.count(), 100.0);
+    EXPECT_FALSE(event.is_signaled());
+
+    event.signal();
+    start = std::chrono::steady_clock::now();
+    event.wait_for_signal(std::chrono::milliseconds(100));
+    elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed.count(), 50.0);
+    EXPECT_FALSE(event.is_signaled());
+
+    std::thread signal_thread(
+        [&event]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            event.signal();
+        });
+    event.wait_for_signal((std::chrono::duration<std::uint64_t, std::micro>::max)());
+    EXPECT_FALSE(event.is_signaled());
+    signal_thread.join();
+}
+
+/**
+ * @brief Test case for ping-pong between two threads: no wake-up is lost over many rounds.
+ */
+TEST(LightEventTest, PingPong)
+{
+    constexpr int rounds = 20000;
+    tools::light_event ping;
+    tools::light_event pong;
+
+    std::thread responder(
+        [&]()
+        {
+            for (int round = 0; round < rounds; ++round)
+            {
+                ping.wait_for_signal();
+                pong.signal();
+            }
+        });
+
+    for (int round = 0; round < rounds; ++round)
+    {
+        ping.signal();
+        pong.wait_for_signal();
+    }
+
+    responder.join();
+    EXPECT_FALSE(ping.is_signaled());
+    EXPECT_FALSE(pong.is_signaled());
+}
+
+/**
+ * @brief Test case for several waiters: each signal releases one of them.
+ */
+TEST(LightEventTest, MultipleWaiters)
+{
+    constexpr int waiter_count = 4;
+    tools::light_event event;
+    std::atomic<int> released = 0;
+
+    std::vector<std::thread> waiters;
+    for (int index = 0; index < waiter_count; ++index)
+    {
+        waiters.emplace_back(
+            [&]()
+            {
+                event.wait_for_signal();
+                released.fetch_add(1);
+            });
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (int expected = 1; expected <= waiter_count; ++expected)
+    {
+        while ((released.load() < expected) && (std::chrono::steady_clock::now() < deadline))
+        {
+            event.signal();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    for (auto& waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_EQ(released.load(), waiter_count);
+}
@@ -0,0 +1,333 @@
+/**
+ * @file test_linux_fd_bridge.cpp
+ * @brief Unit tests for the Linux file descriptor bridge of memory_pipe using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "tools/data_task.hpp"
+#include "tools/linux/linux_fd_bridge.hpp"
+#include "tools/memory_pipe.hpp"
+
+namespace
+{
+    using tools::linux_os::fd_bridge_completion;
+    using tools::linux_os::fd_bridge_direction;
+
+    constexpr std::chrono::duration<std::uint64_t, std::milli> pipe_timeout { 1000U };
+    constexpr std::chrono::duration<std::uint64_t, std::milli> stream_timeout { 5000U };
+
+    /** @brief Both ends of a pipe(2), closed on destruction. */
+    struct os_pipe
+    {
+        os_pipe()
+        {
+            EXPECT_EQ(0, ::pipe(ends.data()));
+        }
+
+        ~os_pipe()
+        {
+            close_writer();
+            if (ends[0] >= 0)
+            {
+                ::close(ends[0]);
+            }
+        }
+
+        os_pipe(const os_pipe&) = delete;
+        os_pipe& operator=(const os_pipe&) = delete;
+        os_pipe(os_pipe&&) = delete;
+        os_pipe& operator=(os_pipe&&) = delete;
+
+        void close_writer()
+        {
+            if (ends[1] >= 0)
+            {
+                ::close(ends[1]);
+                ends[1] = -1;
+            }
+        }
+
+        [[nodiscard]] int reader() const
+        {
+            return ends[0];
+        }
+
+        [[nodiscard]] int writer() const
+        {
+            return ends[1];
+        }
+
+        std::array<int, 2> ends = { -1, -1 };
+    };
+
+    std::vector<std::uint8_t> make_bytes(std::size_t count, std::uint8_t first)
+    {
+        std::vector<std::uint8_t> bytes(count);
+        std::iota(bytes.begin(), bytes.end(), first);
+        return bytes;
+    }
+
+    /** @brief Moves the ring indexes so that the next bytes straddle the end of the storage. */
+    void advance_ring(tools::memory_pipe& pipe, std::size_t count)
+    {
+        const auto filler = make_bytes(count, 0U);
+        ASSERT_EQ(count, pipe.send(filler.data(), filler.size(), pipe_timeout));
+        std::vector<std::uint8_t> sink(count);
+        ASSERT_EQ(count, pipe.receive(sink.data(), sink.size(), pipe_timeout));
+    }
+
+    std::vector<std::uint8_t> read_exactly(int descriptor, std::size_t count)
+    {
+        std::vector<std::uint8_t> bytes(count);
+        std::size_t offset = 0U;
+        while (offset < count)
+        {
+            const ssize_t received = ::read(descriptor, bytes.data() + offset, count - offset); // NOLINT
+            if (received <= 0)
+            {
+                break;
+            }
+            offset += static_cast<std::size_t>(received);
+        }
+        bytes.resize(offset);
+        return bytes;
+    }
+
+    struct completion_context
+    {
+        std::atomic<std::uint64_t> bytes = 0U;
+        std::atomic<std::size_t> batches = 0U;
+        std::atomic_bool end_of_stream = false;
+    };
+
+    using completion_task = tools::data_task<completion_context, fd_bridge_completion>;
+
+    std::unique_ptr<completion_task> make_completion_task(const std::shared_ptr<completion_context>& context)
+    {
+        return std::make_unique<completion_task>(
+            [](const std::shared_ptr<completion_context>& /*ctx*/, const std::string& /*name*/) {},
+            [](const std::shared_ptr<completion_context>& ctx, const fd_bridge_completion& completion,
+                const std::string& /*name*/)
+            {
+                ctx->bytes.fetch_add(completion.bytes);
+                ctx->batches.fetch_add(1U);
+                if (completion.end_of_stream)
+                {
+                    ctx->end_of_stream.store(true);
+                }
+            },
+            context, 64, "fd_bridge_sink", 4096);
+    }
+
+    template <typename Predicate>
+    bool wait_until(Predicate predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief Drains bytes that wrap around the end of the ring with a single call.
+ *
+ * @test
+ * - Places 12 bytes across the end of a 16-byte ring.
+ * - Checks that one drain writes all of them in order and empties the pipe.
+ */
+TEST(LinuxFdBridgeTest, DrainsBothRingRegions)
+{
+    tools::memory_pipe pipe(16U);
+    advance_ring(pipe, 10U);
+    const auto payload = make_bytes(12U, 100U);
+    ASSERT_EQ(payload.size(), pipe.send(payload.data(), payload.size(), pipe_timeout));
+    ASSERT_GT(pipe.peek().second_size, 0U);
+
+    os_pipe channel;
+    const auto result = tools::linux_os::drain_pipe_to_fd(pipe, channel.writer(), 64U);
+    EXPECT_EQ(0, result.error);
+    EXPECT_EQ(payload.size(), result.bytes);
+    EXPECT_EQ(0U, pipe.peek().size());
+    EXPECT_EQ(payload, read_exactly(channel.reader(), payload.size()));
+}
+
+/**
+ * @brief Fills the ring from a descriptor across the wrap-around point.
+ *
+ * @test
+ * - Reads 12 bytes into a 16-byte ring whose free space wraps.
+ * - Checks that max_bytes bounds a batch.
+ */
+TEST(LinuxFdBridgeTest, FillsAcrossTheWrapPoint)
+{
+    tools::memory_pipe pipe(16U);
+    advance_ring(pipe, 10U);
+    const auto payload = make_bytes(12U, 7U);
+
+    os_pipe channel;
+    ASSERT_EQ(static_cast<ssize_t>(payload.size()), ::write(channel.writer(), payload.data(), payload.size()));
+
+    auto result = tools::linux_os::fill_pipe_from_fd(pipe, channel.reader(), 8U);
+    EXPECT_EQ(0, result.error);
+    EXPECT_EQ(8U, result.bytes);
+    result = tools::linux_os::fill_pipe_from_fd(pipe, channel.reader(), 8U);
+    EXPECT_EQ(4U, result.bytes);
+
+    std::vector<std::uint8_t> received(payload.size());
+    ASSERT_EQ(payload.size(), pipe.receive(received.data(), received.size(), pipe_timeout));
+    EXPECT_EQ(payload, received);
+}
+
+/**
+ * @brief Reports the conditions where no byte can move.
+ *
+ * @test
+ * - Checks EAGAIN for an empty pipe and for an empty non-blocking descriptor.
+ * - Checks ENOBUFS for a full pipe and end of stream once the writer is closed.
+ */
+TEST(LinuxFdBridgeTest, ReportsBlockedTransfers)
+{
+    tools::memory_pipe pipe(8U);
+    os_pipe channel;
+    ASSERT_EQ(0, ::fcntl(channel.reader(), F_SETFL, O_NONBLOCK));
+
+    EXPECT_EQ(EAGAIN, tools::linux_os::drain_pipe_to_fd(pipe, channel.writer(), 64U).error);
+    EXPECT_EQ(EAGAIN, tools::linux_os::fill_pipe_from_fd(pipe, channel.reader(), 64U).error);
+
+    const auto payload = make_bytes(7U, 1U);
+    ASSERT_EQ(payload.size(), pipe.send(payload.data(), payload.size(), pipe_timeout));
+    EXPECT_EQ(ENOBUFS, tools::linux_os::fill_pipe_from_fd(pipe, channel.reader(), 64U).error);
+
+    std::vector<std::uint8_t> received(payload.size());
+    ASSERT_EQ(payload.size(), pipe.receive(received.data(), received.size(), pipe_timeout));
+    channel.close_writer();
+    const auto result = tools::linux_os::fill_pipe_from_fd(pipe, channel.reader(), 64U);
+    EXPECT_EQ(0U, result.bytes);
+    EXPECT_EQ(0, result.error);
+}
+
+/**
+ * @brief Streams a descriptor into a pipe on the bridge thread and reports the batches to a data_task.
+ *
+ * @test
+ * - Writes more bytes than the ring holds while a consumer thread reads them back.
+ * - Checks the byte count and the end-of-stream completion seen by the data_task.
+ */
+TEST(LinuxFdBridgeTest, BridgeFillsPipeAndNotifiesDataTask)
+{
+    auto context = std::make_shared<completion_context>();
+    auto task = make_completion_task(context);
+
+    tools::memory_pipe pipe(256U);
+    os_pipe channel;
+    tools::linux_os::fd_pipe_bridge<completion_task> bridge(
+        pipe, channel.reader(), fd_bridge_direction::fd_to_pipe, task.get(), 100U);
+    ASSERT_TRUE(bridge.start());
+    EXPECT_FALSE(bridge.start());
+
+    const auto payload = make_bytes(4000U, 3U);
+    std::thread producer(
+        [&channel, &payload]()
+        {
+            EXPECT_EQ(static_cast<ssize_t>(payload.size()), ::write(channel.writer(), payload.data(), payload.size()));
+            channel.close_writer();
+        });
+
+    std::vector<std::uint8_t> received(payload.size());
+    EXPECT_EQ(payload.size(), pipe.receive(received.data(), received.size(), stream_timeout));
+    producer.join();
+    EXPECT_EQ(payload, received);
+
+    EXPECT_TRUE(wait_until([&context]() { return context->end_of_stream.load(); }));
+    EXPECT_TRUE(wait_until([&bridge]() { return !bridge.running(); }));
+    EXPECT_EQ(payload.size(), context->bytes.load());
+    EXPECT_EQ(payload.size(), bridge.transferred());
+    EXPECT_GT(context->batches.load(), 1U);
+}
+
+/**
+ * @brief Drains a pipe into a descriptor on the bridge thread until stopped.
+ *
+ * @test
+ * - Sends bytes through the pipe while the bridge writes them to a pipe(2).
+ * - Checks the bytes read back and that stop() ends the thread.
+ */
+TEST(LinuxFdBridgeTest, BridgeDrainsPipeUntilStopped)
+{
+    auto context = std::make_shared<completion_context>();
+    auto task = make_completion_task(context);
+
+    tools::memory_pipe pipe(64U);
+    os_pipe channel;
+    tools::linux_os::fd_pipe_bridge<completion_task> bridge(
+        pipe, channel.writer(), fd_bridge_direction::pipe_to_fd, task.get());
+    ASSERT_TRUE(bridge.start());
+
+    const auto payload = make_bytes(1000U, 9U);
+    std::thread producer(
+        [&pipe, &payload]()
+        {
+            EXPECT_EQ(payload.size(), pipe.send(payload.data(), payload.size(), stream_timeout));
+        });
+
+    EXPECT_EQ(payload, read_exactly(channel.reader(), payload.size()));
+    producer.join();
+
+    EXPECT_TRUE(wait_until([&context, &payload]() { return payload.size() == context->bytes.load(); }));
+    bridge.stop();
+    EXPECT_FALSE(bridge.running());
+    EXPECT_EQ(payload.size(), bridge.transferred());
+}
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file test_linux_huge_pages.cpp
+ * @brief Unit tests for the Linux huge page and locked memory backing using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_huge_pages.hpp"
+#include "tools/ring_vector.hpp"
+
+namespace
+{
+    using tools::linux_os::huge_page_mode;
+    using tools::linux_os::huge_page_options;
+
+    bool huge_aligned(const void* ptr)
+    {
+        return 0U == (reinterpret_cast<std::uintptr_t>(ptr) % tools::linux_os::huge_page_size());
+    }
+}
+
+// A region is zero filled, writable over its whole size and starts on a huge page, with or without a reserved pool.
+TEST(LinuxHugePagesTest, MapsAlignedRegions)
+{
+    EXPECT_GE(tools::linux_os::huge_page_size(), static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+    EXPECT_EQ(
+        tools::linux_os::huge_page_size(), tools::linux_os::huge_page_mapping_size(1U, huge_page_mode::transparent));
+    EXPECT_EQ(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)),
+        tools::linux_os::huge_page_mapping_size(1U, huge_page_mode::none));
+
+    for (const auto mode : { huge_page_mode::transparent, huge_page_mode::explicit_pages })
+    {
+        constexpr std::size_t size = 3U * 1024U * 1024U;
+        tools::linux_os::huge_page_region region(size, huge_page_options { mode, false });
+        ASSERT_TRUE(region.valid());
+        EXPECT_EQ(size, region.size());
+        EXPECT_TRUE(huge_aligned(region.data()));
+        EXPECT_FALSE(region.status().locked);
+
+        auto* bytes = static_cast<std::uint8_t*>(region.data());
+        EXPECT_EQ(0U, bytes[size - 1U]); // NOLINT pointer arithmetic
+        std::memset(bytes, 0xA5, size);
+        EXPECT_EQ(0xA5U, bytes[size / 2U]); // NOLINT pointer arithmetic
+    }
+}
+
+// Locking is best effort within RLIMIT_MEMLOCK, the region stays usable when the kernel refuses it.
+TEST(LinuxHugePagesTest, LocksRegionsWhenAllowed)
+{
+    constexpr std::size_t size = 64U * 1024U;
+    tools::linux_os::huge_page_region region(size, huge_page_options { huge_page_mode::none, true });
+    ASSERT_TRUE(region.valid());
+    if (region.status().locked)
+    {
+        EXPECT_EQ(0, munlock(region.data(), size));
+    }
+
+    std::vector<std::uint8_t> existing(size, 1U);
+    const huge_page_options no_backing { huge_page_mode::none, false };
+    const auto status = tools::linux_os::advise_huge_pages(existing.data(), existing.size(), no_backing);
+    EXPECT_FALSE(status.advised);
+    EXPECT_FALSE(status.locked);
+    EXPECT_FALSE(tools::linux_os::advise_huge_pages(nullptr, size, huge_page_options {}).advised);
+}
+
+// A ring_vector keeps its storage on a huge page mapping through huge_page_allocator.
+TEST(LinuxHugePagesTest, BacksRingVectorStorage)
+{
+    using allocator = tools::linux_os::huge_page_allocator<std::uint64_t>;
+    const allocator huge_pages(huge_page_options { huge_page_mode::transparent, false });
+    tools::ring_vector<std::uint64_t, allocator> ring(1024U, huge_pages);
+
+    for (std::uint64_t value = 0U; value < 1500U; ++value)
+    {
+        if (ring.full())
+        {
+            ring.pop();
+        }
+        ring.push(value);
+    }
+    EXPECT_EQ(1024U, ring.size());
+    EXPECT_EQ(476U, ring.front());
+    EXPECT_EQ(1499U, ring.back());
+
+    EXPECT_TRUE(allocator() == tools::linux_os::huge_page_allocator<char>());
+    EXPECT_TRUE(allocator() != allocator(huge_page_options { huge_page_mode::explicit_pages, true }));
+}
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file test_linux_metrics_http.cpp
+ * @brief Unit tests for the Linux metrics HTTP endpoint.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <cstdint>
+#include <string>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_metrics_http.hpp"
+#include "tools/metrics_exporter.hpp"
+
+namespace
+{
+    std::string http_get(std::uint16_t port, const std::string& path)
+    {
+        const int fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in endpoint = {};
+        endpoint.sin_family = AF_INET;
+        endpoint.sin_port = htons(port);
+        endpoint.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        std::string response;
+        if (0 == connect(fd, reinterpret_cast<sockaddr*>(&endpoint), sizeof(endpoint))) // NOLINT
+        {
+            const std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+            static_cast<void>(send(fd, request.data(), request.size(), MSG_NOSIGNAL));
+            char buffer[1024] = {};
+            ssize_t received = 0;
+            while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+            {
+                response.append(buffer, static_cast<std::size_t>(received));
+            }
+        }
+        close(fd);
+        return response;
+    }
+}
+
+// A scrape of /metrics gets the rendering of the exporter with the OpenMetrics content type; other paths get 404.
+TEST(LinuxMetricsHttpTest, ServesMetricsOnAnEphemeralPort)
+{
+    tools::metrics_exporter exporter;
+    exporter.add_collector([](tools::openmetrics_writer& writer)
+        { writer.family("demo_up", tools::metric_type::gauge, "Up").add({}, std::uint64_t { 1U }); });
+
+    tools::linux_os::metrics_http_server server(exporter);
+    ASSERT_TRUE(server.start(0U));
+    ASSERT_NE(0U, server.port());
+    EXPECT_FALSE(server.start(0U));
+
+    const std::string response = http_get(server.port(), "/metrics");
+    EXPECT_EQ(0U, response.rfind("HTTP/1.1 200 OK\r\n", 0U));
+    EXPECT_NE(std::string::npos, response.find("application/openmetrics-text"));
+    EXPECT_NE(std::string::npos, response.find("\r\n\r\n# TYPE demo_up gauge\n"));
+    EXPECT_NE(std::string::npos, response.find("demo_up 1\n"));
+    EXPECT_EQ(response.size() - response.find("# EOF\n"), 6U);
+
+    EXPECT_EQ(0U, http_get(server.port(), "/other").rfind("HTTP/1.1 404", 0U));
+    EXPECT_EQ(1U, server.scrapes());
+    server.stop();
+}
+#endif
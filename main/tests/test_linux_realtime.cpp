@@ -0,0 +1,172 @@
+/**
+ * @file test_linux_realtime.cpp
+ * @brief Unit tests for the Linux real-time helpers and the task scheduling policies.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+
+#include "tools/data_task.hpp"
+#include "tools/linux/linux_realtime.hpp"
+#include "tools/worker_task.hpp"
+
+namespace
+{
+    struct rt_context
+    {
+        std::atomic<int> observed_policy { -1 };
+        std::atomic<int> processed { 0 };
+    };
+
+    template <typename Predicate>
+    bool wait_until(Predicate&& predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief Prefaulting touches the pages without changing their content, and the startup reports what it did.
+ */
+TEST(LinuxRealtimeTest, PrefaultKeepsContentAndReports)
+{
+    std::vector<std::uint8_t> pool(3U * tools::linux_os::page_size() + 17U);
+    for (std::size_t index = 0U; index < pool.size(); ++index)
+    {
+        pool[index] = static_cast<std::uint8_t>(index);
+    }
+    tools::linux_os::prefault_memory(pool.data(), pool.size());
+    tools::linux_os::prefault_memory(nullptr, 128U);
+    for (std::size_t index = 0U; index < pool.size(); ++index)
+    {
+        ASSERT_EQ(pool[index], static_cast<std::uint8_t>(index));
+    }
+
+    tools::linux_os::realtime_startup_params params;
+    params.lock_memory = false;
+    params.stack_bytes = 32U * 1024U;
+    params.heap_bytes = 256U * 1024U;
+    const auto report = tools::linux_os::realtime_startup(params);
+    EXPECT_FALSE(report.memory_locked);
+    EXPECT_EQ(report.stack_prefaulted, params.stack_bytes);
+    EXPECT_EQ(report.heap_prefaulted, params.heap_bytes);
+
+    // the probe never goes beyond three quarters of the thread stack
+    EXPECT_LT(tools::linux_os::prefault_stack(std::size_t { 1U } << 40U), std::size_t { 1U } << 40U);
+}
+
+/**
+ * @brief A worker_task thread runs under SCHED_FIFO when the system grants it, and reports the outcome.
+ */
+TEST(LinuxRealtimeTest, WorkerTaskAppliesFifoPolicy)
+{
+    auto context = std::make_shared<rt_context>();
+    std::atomic_bool started { false };
+    {
+        tools::worker_task<rt_context> task(
+            [&started](const std::shared_ptr<rt_context>& ctx, const std::string&)
+            {
+                ctx->observed_policy.store(tools::linux_os::current_sched_policy());
+                started.store(true);
+            },
+            context, "rt_worker", 4096U, tools::base_task::run_on_all_cores, tools::base_task::default_priority,
+            tools::task_sched_policy::fifo(10));
+
+        ASSERT_TRUE(wait_until([&started]() { return started.load(); }));
+        if (task.sched_policy_applied())
+        {
+            EXPECT_EQ(context->observed_policy.load(), SCHED_FIFO);
+        }
+        else
+        {
+            EXPECT_NE(context->observed_policy.load(), SCHED_FIFO);
+        }
+    }
+
+    tools::worker_task<rt_context> plain([](const std::shared_ptr<rt_context>&, const std::string&) {}, context,
+        "plain_worker", 4096U);
+    EXPECT_TRUE(wait_until([&plain]() { return plain.sched_policy_applied(); }));
+}
+
+/**
+ * @brief A data_task thread runs under SCHED_DEADLINE when the system grants it, and keeps processing.
+ */
+TEST(LinuxRealtimeTest, DataTaskAppliesDeadlinePolicy)
+{
+    using micro = std::chrono::duration<std::uint64_t, std::micro>;
+    auto context = std::make_shared<rt_context>();
+
+    auto policy = tools::task_sched_policy::earliest_deadline(micro(2000U), micro(10000U), micro(10000U));
+    policy.prefault_stack = true;
+
+    tools::data_task<rt_context, int> task(
+        [](const std::shared_ptr<rt_context>& ctx, const std::string&)
+        { ctx->observed_policy.store(tools::linux_os::current_sched_policy()); },
+        [](const std::shared_ptr<rt_context>& ctx, const int&, const std::string&) { ++ctx->processed; }, context,
+        8U, "rt_data", 16U * 1024U, tools::base_task::run_on_all_cores, tools::base_task::default_priority,
+        micro(1000U), policy);
+
+    for (int value = 0; value < 5; ++value)
+    {
+        task.submit(value);
+    }
+    ASSERT_TRUE(wait_until([&context]() { return 5 == context->processed.load(); }));
+
+    if (task.sched_policy_applied())
+    {
+        EXPECT_EQ(context->observed_policy.load(), SCHED_DEADLINE);
+    }
+    else
+    {
+        EXPECT_NE(context->observed_policy.load(), SCHED_DEADLINE);
+    }
+}
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file test_linux_shm_pipe.cpp
+ * @brief Unit tests for the Linux shared memory byte pipe using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_shm_pipe.hpp"
+
+namespace
+{
+    using tools::linux_os::shm_memory_pipe;
+    using tools::linux_os::shm_pipe_storage;
+
+    constexpr std::chrono::duration<std::uint64_t, std::milli> no_wait { 0U };
+    constexpr std::chrono::duration<std::uint64_t, std::milli> stream_timeout { 5000U };
+
+    std::string segment_name(const char* suffix)
+    {
+        return "/pubsub_pipe_test_" + std::to_string(getpid()) + "_" + suffix;
+    }
+
+    std::vector<std::uint8_t> make_bytes(std::size_t count, std::uint8_t first)
+    {
+        std::vector<std::uint8_t> bytes(count);
+        std::iota(bytes.begin(), bytes.end(), first);
+        return bytes;
+    }
+}
+
+// Bytes sent through one mapping are received through another mapping of the same segment, across the wrap point.
+TEST(LinuxShmPipeTest, StreamsBetweenTwoMappings)
+{
+    const std::string name = segment_name("mappings");
+    shm_memory_pipe writer(name, 16U);
+    ASSERT_TRUE(writer.valid());
+    shm_memory_pipe reader(name);
+    ASSERT_TRUE(reader.valid());
+    EXPECT_EQ(16U, reader.capacity());
+
+    const auto first = make_bytes(10U, 0U);
+    std::vector<std::uint8_t> received(first.size());
+    ASSERT_EQ(first.size(), writer.send(first.data(), first.size(), no_wait));
+    ASSERT_EQ(first.size(), reader.receive(received.data(), received.size(), no_wait));
+    EXPECT_EQ(first, received);
+
+    // the whole ring is usable, and the next bytes straddle its end
+    const auto second = make_bytes(16U, 50U);
+    EXPECT_EQ(second.size(), writer.send(second.data(), second.size(), no_wait));
+    EXPECT_EQ(0U, writer.send(second.data(), 1U, no_wait));
+    EXPECT_EQ(16U, reader.size());
+
+    const auto regions = reader.peek();
+    EXPECT_EQ(6U, regions.first_size);
+    EXPECT_EQ(10U, regions.second_size);
+    std::vector<std::uint8_t> joined(regions.first, regions.first + regions.first_size); // NOLINT
+    joined.insert(joined.end(), regions.second, regions.second + regions.second_size); // NOLINT
+    EXPECT_EQ(second, joined);
+    EXPECT_EQ(16U, reader.consume(100U));
+    EXPECT_FALSE(reader.wait_for_data(no_wait));
+}
+
+// The zero-copy producer path publishes bytes only on commit, and the segment can be a regular file.
+TEST(LinuxShmPipeTest, ReservesAndCommitsInAMappedFile)
+{
+    const std::string path = "/tmp/pubsub_pipe_test_" + std::to_string(getpid()) + ".ring";
+    {
+        shm_memory_pipe writer(path, 64U, shm_pipe_storage::mapped_file);
+        ASSERT_TRUE(writer.valid());
+        shm_memory_pipe reader(path, shm_pipe_storage::mapped_file);
+        ASSERT_TRUE(reader.valid());
+
+        auto region = writer.reserve(8U);
+        ASSERT_EQ(8U, region.size);
+        std::iota(region.data, region.data + region.size, std::uint8_t { 1U }); // NOLINT pointer arithmetic
+        EXPECT_FALSE(reader.wait_for_data(no_wait));
+        EXPECT_EQ(5U, writer.commit(5U));
+        EXPECT_TRUE(reader.wait_for_data(no_wait));
+
+        std::vector<std::uint8_t> received(5U);
+        EXPECT_EQ(5U, reader.receive(received.data(), received.size(), no_wait));
+        EXPECT_EQ(make_bytes(5U, 1U), received);
+    }
+    EXPECT_EQ(0, unlink(path.c_str()));
+}
+
+// Opening a missing segment or one of another layout yields an invalid pipe doing nothing.
+TEST(LinuxShmPipeTest, RejectsMissingOrForeignSegments)
+{
+    shm_memory_pipe missing(segment_name("missing"));
+    EXPECT_FALSE(missing.valid());
+    const std::uint8_t byte = 1U;
+    EXPECT_EQ(0U, missing.send(&byte, 1U, no_wait));
+    EXPECT_EQ(0U, missing.peek().size());
+
+    const std::string path = "/tmp/pubsub_pipe_test_" + std::to_string(getpid()) + ".bad";
+    {
+        shm_memory_pipe sized(path, 256U, shm_pipe_storage::mapped_file);
+        ASSERT_TRUE(sized.valid());
+    }
+
+    // clear the ready word of the header
+    FILE* file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    const std::uint32_t zero = 0U;
+    EXPECT_EQ(1U, std::fwrite(&zero, sizeof(zero), 1U, file));
+    std::fclose(file);
+
+    shm_memory_pipe foreign(path, shm_pipe_storage::mapped_file);
+    EXPECT_FALSE(foreign.valid());
+    EXPECT_EQ(0, unlink(path.c_str()));
+}
+
+// A child process streams more bytes than the ring holds; both sides sleep on the segment futexes in turn.
+TEST(LinuxShmPipeTest, StreamsFromAnotherProcess)
+{
+    const std::string name = segment_name("process");
+    shm_memory_pipe reader(name, 256U);
+    ASSERT_TRUE(reader.valid());
+    const auto payload = make_bytes(64U * 1024U, 3U);
+
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (0 == child)
+    {
+        shm_memory_pipe writer(name);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const bool sent
+            = writer.valid() && (payload.size() == writer.send(payload.data(), payload.size(), stream_timeout));
+        _exit(sent ? 0 : 1);
+    }
+
+    std::vector<std::uint8_t> received(payload.size());
+    EXPECT_EQ(payload.size(), reader.receive(received.data(), received.size(), stream_timeout));
+
+    int status = 0;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status) && (0 == WEXITSTATUS(status)));
+    EXPECT_EQ(payload, received);
+}
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file test_linux_shm_transport.cpp
+ * @brief Unit tests for the Linux shared memory pub/sub transport using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_shm_transport.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace
+{
+    struct sensor_sample
+    {
+        std::uint32_t channel;
+        std::int32_t value;
+    };
+
+    using sample_publisher = tools::linux_os::shm_publisher<std::uint16_t, sensor_sample>;
+    using sample_subscriber = tools::linux_os::shm_subscriber<std::uint16_t, sensor_sample>;
+
+    std::string segment_name(const char* suffix)
+    {
+        return "/pubsub_test_" + std::to_string(getpid()) + "_" + suffix;
+    }
+
+    class sample_observer : public tools::sync_observer<std::uint16_t, sensor_sample>
+    {
+    public:
+        void inform(const std::uint16_t& topic, const sensor_sample& event, const std::string& origin) override
+        {
+            (void)origin;
+            topics.push_back(topic);
+            values.push_back(event.value);
+        }
+
+        std::vector<std::uint16_t> topics;
+        std::vector<std::int32_t> values;
+    };
+}
+
+// Events published on a local subject reach the subject of the reading side through the segment.
+TEST(LinuxShmTransportTest, ForwardsSubjectEventsThroughTheSegment)
+{
+    const std::string name = segment_name("forward");
+    auto exporter = std::make_shared<sample_publisher>(name, 16U);
+    ASSERT_TRUE(exporter->valid());
+
+    sample_subscriber importer(name);
+    ASSERT_TRUE(importer.valid());
+
+    tools::sync_subject<std::uint16_t, sensor_sample> local("local");
+    local.subscribe(7U, exporter);
+
+    tools::sync_subject<std::uint16_t, sensor_sample> remote("remote");
+    auto observer = std::make_shared<sample_observer>();
+    remote.subscribe(7U, observer);
+
+    EXPECT_FALSE(importer.wait_for_events(std::chrono::milliseconds(1)));
+    for (std::int32_t i = 0; i < 5; ++i)
+    {
+        local.publish(7U, sensor_sample { 1U, i * 10 });
+    }
+
+    EXPECT_TRUE(importer.wait_for_events(std::chrono::milliseconds(1)));
+    EXPECT_EQ(5U, importer.forward_to(remote));
+    EXPECT_EQ((std::vector<std::int32_t> { 0, 10, 20, 30, 40 }), observer->values);
+    EXPECT_EQ(0U, importer.lost_events());
+    EXPECT_EQ(0U, exporter->dropped_count());
+}
+
+// A lagging subscriber skips the overwritten events, counts them and resumes with the oldest kept ones.
+TEST(LinuxShmTransportTest, LaggingSubscriberCountsLostEvents)
+{
+    const std::string name = segment_name("lag");
+    sample_publisher exporter(name, 4U, 16U);
+    sample_subscriber importer(name);
+    ASSERT_TRUE(importer.valid());
+
+    for (std::int32_t i = 0; i < 10; ++i)
+    {
+        exporter.inform(3U, sensor_sample { 0U, i }, "local");
+    }
+
+    std::vector<std::int32_t> values;
+    auto collect = [&values](std::uint16_t /*topic*/, const sensor_sample& event) { values.push_back(event.value); };
+    EXPECT_EQ(4U, importer.poll(collect));
+    EXPECT_EQ((std::vector<std::int32_t> { 6, 7, 8, 9 }), values);
+    EXPECT_EQ(6U, importer.lost_events());
+
+    const char text[] = "bytes";
+    const char oversized[32] = {};
+    EXPECT_TRUE(exporter.publish_bytes(4U, text, sizeof(text)));
+    EXPECT_FALSE(exporter.publish_bytes(4U, oversized, sizeof(oversized)));
+    EXPECT_EQ(1U, exporter.dropped_count());
+
+    std::string received;
+    EXPECT_EQ(1U, importer.poll_bytes([&received](std::uint16_t topic, const std::uint8_t* data, std::size_t size)
+        {
+            EXPECT_EQ(4U, topic);
+            received.assign(reinterpret_cast<const char*>(data), size - 1U);
+        }));
+    EXPECT_EQ("bytes", received);
+}
+
+// A subscriber blocked on the futex of the segment is woken by a publisher running in another process.
+TEST(LinuxShmTransportTest, WakesSubscriberFromAnotherProcess)
+{
+    const std::string name = segment_name("process");
+    sample_publisher creator(name, 64U);
+    ASSERT_TRUE(creator.valid());
+    sample_subscriber importer(name);
+
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (0 == child)
+    {
+        // the child opens the ring by name and writes raw records with the publisher layout
+        tools::linux_os::shm_broadcast_ring ring(name);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (std::int32_t i = 1; i <= 3; ++i)
+        {
+            const std::uint16_t topic = 9U;
+            const sensor_sample sample { 2U, i };
+            (void)ring.write(&topic, sizeof(topic), &sample, sizeof(sample));
+        }
+        _exit(ring.valid() ? 0 : 1);
+    }
+
+    std::vector<std::int32_t> values;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((values.size() < 3U) && (std::chrono::steady_clock::now() < deadline))
+    {
+        if (importer.wait_for_events(std::chrono::milliseconds(100)))
+        {
+            importer.poll(
+                [&values](std::uint16_t /*topic*/, const sensor_sample& event) { values.push_back(event.value); });
+        }
+    }
+
+    int status = 0;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status) && (0 == WEXITSTATUS(status)));
+    EXPECT_EQ((std::vector<std::int32_t> { 1, 2, 3 }), values);
+}
+#endif
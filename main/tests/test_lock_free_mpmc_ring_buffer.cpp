@@ -0,0 +1,236 @@
+/**
+ * @file test_lock_free_mpmc_ring_buffer.cpp
+ * @brief Unit tests for the multi-producer multi-consumer lock-free ring buffer.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/lock_free_mpmc_ring_buffer.hpp"
+
+/**
+ * @brief Test fixture for lock_free_mpmc_ring_buffer tests.
+ *
+ * @tparam T The type of elements in the ring buffer.
+ */
+template <typename T>
+class LockFreeMpmcRingBufferTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        buffer = std::make_unique<tools::lock_free_mpmc_ring_buffer<T, 4>>();
+    }
+
+    void TearDown() override
+    {
+        buffer.reset();
+    }
+
+    std::unique_ptr<tools::lock_free_mpmc_ring_buffer<T, 4>> buffer;
+};
+
+using MpmcTypes = ::testing::Types<int, float, double, char>;
+TYPED_TEST_SUITE(LockFreeMpmcRingBufferTest, MpmcTypes);
+
+/**
+ * @brief Verifies every one of the 2^Pow2 slots is usable and FIFO order holds for a single thread.
+ */
+TYPED_TEST(LockFreeMpmcRingBufferTest, FillAndDrainFullCapacity)
+{
+    ASSERT_EQ(this->buffer->capacity(), 16U);
+
+    for (int index = 0; index < 16; ++index)
+    {
+        ASSERT_TRUE(this->buffer->push(static_cast<TypeParam>(index)));
+    }
+    ASSERT_FALSE(this->buffer->push(static_cast<TypeParam>(16))); // Buffer should be full
+
+    TypeParam value {};
+    for (int index = 0; index < 16; ++index)
+    {
+        ASSERT_TRUE(this->buffer->pop(value));
+        ASSERT_EQ(value, static_cast<TypeParam>(index));
+    }
+    ASSERT_FALSE(this->buffer->pop(value)); // Buffer should be empty
+}
+
+/**
+ * @brief Verifies slots are correctly recycled over many laps of the ring.
+ */
+TYPED_TEST(LockFreeMpmcRingBufferTest, WrapsAroundOverManyLaps)
+{
+    TypeParam value {};
+    for (int lap = 0; lap < 50; ++lap)
+    {
+        for (int index = 0; index < 10; ++index)
+        {
+            ASSERT_TRUE(this->buffer->push(static_cast<TypeParam>(index)));
+        }
+        for (int index = 0; index < 10; ++index)
+        {
+            ASSERT_TRUE(this->buffer->pop(value));
+            ASSERT_EQ(value, static_cast<TypeParam>(index));
+        }
+    }
+    ASSERT_FALSE(this->buffer->pop_opt().has_value());
+}
+
+/**
+ * @brief Verifies range push stops when full and range pop stops when empty.
+ */
+TEST(LockFreeMpmcRingBufferRangeTest, PushRangeAndPopRange)
+{
+    tools::lock_free_mpmc_ring_buffer<int, 2> buffer;
+
+    const std::vector<int> source = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(buffer.push_range(source), 4U);
+
+    std::array<int, 3> destination {};
+    EXPECT_EQ(buffer.pop_range(destination.begin(), destination.end()), 3U);
+    EXPECT_EQ(destination[0], 1);
+    EXPECT_EQ(destination[2], 3);
+
+    EXPECT_EQ(buffer.push_range({ 7, 8, 9 }), 3U);
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    std::array<int, 8> span_destination {};
+    EXPECT_EQ(buffer.pop_range(std::span<int>(span_destination)), 4U);
+    EXPECT_EQ(span_destination[0], 4);
+    EXPECT_EQ(span_destination[3], 9);
+#else
+    std::array<int, 8> iterator_destination {};
+    EXPECT_EQ(buffer.pop_range(iterator_destination.begin(), iterator_destination.end()), 4U);
+#endif
+}
+
+/**
+ * @brief Verifies conversion push through the perfect-forwarding overload.
+ */
+TEST(LockFreeMpmcRingBufferRangeTest, PushConversionForwardingTemplate)
+{
+    tools::lock_free_mpmc_ring_buffer<double, 2> buffer;
+    ASSERT_TRUE(buffer.push(3));
+
+    const auto value = buffer.pop_opt();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_DOUBLE_EQ(*value, 3.0);
+}
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+namespace
+{
+    // Constant initialization allows a global buffer to be used before dynamic initialization.
+    constinit tools::lock_free_mpmc_ring_buffer<int, 3> constant_initialized_buffer;
+}
+
+TEST(LockFreeMpmcRingBufferRangeTest, ConstantInitializedInstanceIsEmptyAndUsable)
+{
+    EXPECT_FALSE(constant_initialized_buffer.pop_opt().has_value());
+    ASSERT_TRUE(constant_initialized_buffer.push(5));
+    EXPECT_EQ(constant_initialized_buffer.pop_opt(), std::optional<int>(5));
+}
+#endif
+
+/**
+ * @brief Stress test with several producers and consumers: every pushed value is popped exactly once.
+ */
+TEST(LockFreeMpmcRingBufferStressTest, MultipleProducersMultipleConsumers)
+{
+    constexpr std::size_t producer_count = 4U;
+    constexpr std::size_t consumer_count = 4U;
+    constexpr std::uint32_t items_per_producer = 50000U;
+    constexpr std::uint32_t total_items = items_per_producer * producer_count;
+
+    tools::lock_free_mpmc_ring_buffer<std::uint32_t, 6> buffer;
+    std::vector<std::atomic<std::uint32_t>> seen(total_items);
+    std::atomic<std::uint32_t> consumed_count { 0U };
+
+    std::vector<std::thread> threads;
+    for (std::size_t producer = 0U; producer < producer_count; ++producer)
+    {
+        threads.emplace_back(
+            [&buffer, producer]()
+            {
+                const auto first_value = static_cast<std::uint32_t>(producer) * items_per_producer;
+                for (std::uint32_t value = first_value; value < first_value + items_per_producer; ++value)
+                {
+                    while (!buffer.push(value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    for (std::size_t consumer = 0U; consumer < consumer_count; ++consumer)
+    {
+        threads.emplace_back(
+            [&buffer, &seen, &consumed_count]()
+            {
+                std::uint32_t value = 0U;
+                while (consumed_count.load() < total_items)
+                {
+                    if (buffer.pop(value))
+                    {
+                        seen[value].fetch_add(1U);
+                        consumed_count.fetch_add(1U);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(consumed_count.load(), total_items);
+    for (const auto& counter : seen)
+    {
+        ASSERT_EQ(counter.load(), 1U);
+    }
+}
@@ -0,0 +1,278 @@
+/**
+ * @file test_lock_free_object_ring_buffer.cpp
+ * @brief Unit tests for the single-producer single-consumer lock-free ring buffer of arbitrary objects.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tools/lock_free_object_ring_buffer.hpp"
+
+namespace
+{
+    /**
+     * @brief Element counting its live instances.
+     */
+    struct tracked
+    {
+        explicit tracked(int init_value)
+            : value(init_value)
+        {
+            ++live;
+        }
+
+        tracked(const tracked& other)
+            : value(other.value)
+        {
+            if (other.value == throw_on_copy)
+            {
+                throw std::runtime_error("copy refused");
+            }
+            ++live;
+        }
+
+        tracked(tracked&& other) noexcept
+            : value(other.value)
+        {
+            ++live;
+        }
+
+        tracked& operator=(const tracked&) = default;
+        tracked& operator=(tracked&&) noexcept = default;
+
+        ~tracked()
+        {
+            --live;
+        }
+
+        int value = 0;
+
+        static inline int live = 0;
+        static inline int throw_on_copy = -1;
+    };
+}
+
+/**
+ * @brief Verifies move-only elements round-trip through push, emplace, pop and try_pop.
+ */
+TEST(LockFreeObjectRingBufferTest, MoveOnlyElements)
+{
+    tools::lock_free_object_ring_buffer<std::unique_ptr<int>, 2> buffer;
+    ASSERT_EQ(4U, buffer.capacity());
+    EXPECT_TRUE(buffer.empty());
+
+    EXPECT_TRUE(buffer.push(std::make_unique<int>(1)));
+    EXPECT_TRUE(buffer.emplace(new int(2)));
+    EXPECT_TRUE(buffer.push(std::make_unique<int>(3)));
+    EXPECT_TRUE(buffer.emplace(std::make_unique<int>(4)));
+    EXPECT_EQ(4U, buffer.size());
+
+    // a failed push leaves the argument untouched
+    auto rejected = std::make_unique<int>(5);
+    EXPECT_FALSE(buffer.push(std::move(rejected)));
+    ASSERT_NE(nullptr, rejected);
+
+    std::unique_ptr<int> popped;
+    ASSERT_TRUE(buffer.pop(popped));
+    EXPECT_EQ(1, *popped);
+
+    for (int expected = 2; expected <= 4; ++expected)
+    {
+        auto front = buffer.try_pop();
+        ASSERT_TRUE(front.has_value());
+        EXPECT_EQ(expected, **front);
+    }
+    EXPECT_FALSE(buffer.try_pop().has_value());
+    EXPECT_FALSE(buffer.pop(popped));
+}
+
+/**
+ * @brief Verifies large heap-owning elements are moved, not copied, and leftovers are destroyed with the buffer.
+ */
+TEST(LockFreeObjectRingBufferTest, LargeElementsAndLifetime)
+{
+    {
+        auto buffer = std::make_unique<tools::lock_free_object_ring_buffer<std::vector<std::uint8_t>, 3>>();
+        std::vector<std::uint8_t> frame(1024U, 0xA5U);
+        const auto* payload = frame.data();
+
+        ASSERT_TRUE(buffer->push(std::move(frame)));
+        auto moved = buffer->try_pop();
+        ASSERT_TRUE(moved.has_value());
+        EXPECT_EQ(payload, moved->data());
+        EXPECT_EQ(1024U, moved->size());
+    }
+
+    tracked::live = 0;
+    {
+        tools::lock_free_object_ring_buffer<tracked, 3> buffer;
+        for (int n = 0; n < 5; ++n)
+        {
+            ASSERT_TRUE(buffer.emplace(n));
+        }
+        EXPECT_EQ(5, tracked::live);
+        EXPECT_EQ(0, buffer.try_pop()->value);
+        EXPECT_EQ(4, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+
+/**
+ * @brief Verifies batch push and pop across laps, clamped to the free slots and queued elements.
+ */
+TEST(LockFreeObjectRingBufferTest, BatchPushPopRange)
+{
+    tools::lock_free_object_ring_buffer<std::string, 3> buffer;
+
+    std::vector<std::string> source;
+    for (int n = 0; n < 12; ++n)
+    {
+        source.push_back("frame" + std::to_string(n));
+    }
+
+    EXPECT_EQ(8U, buffer.push_range(source));
+    EXPECT_EQ("frame0", source[0]);
+    EXPECT_EQ(0U, buffer.push_range({ std::string("extra") }));
+
+    std::array<std::string, 5> destination;
+    EXPECT_EQ(5U, buffer.pop_range(destination.begin(), destination.end()));
+    EXPECT_EQ("frame4", destination[4]);
+
+    // the rvalue batch wraps around the end of the storage
+    std::vector<std::string> moved_source = { "a", "b", "c", "d", "e", "f" };
+    EXPECT_EQ(5U, buffer.push_range(std::move(moved_source)));
+
+    std::vector<std::string> drained(16U);
+    const std::size_t popped = buffer.pop_range(drained.begin(), drained.end());
+    ASSERT_EQ(8U, popped);
+    EXPECT_EQ("frame5", drained[0]);
+    EXPECT_EQ("frame7", drained[2]);
+    EXPECT_EQ("a", drained[3]);
+    EXPECT_EQ("e", drained[7]);
+    EXPECT_TRUE(buffer.empty());
+}
+
+/**
+ * @brief Verifies a batch interrupted by a throwing copy still publishes the elements constructed before it.
+ */
+TEST(LockFreeObjectRingBufferTest, BatchPublishesCompletedElementsOnThrow)
+{
+    tracked::live = 0;
+    {
+        tools::lock_free_object_ring_buffer<tracked, 3> buffer;
+        std::vector<tracked> source;
+        source.reserve(4U);
+        for (int n = 0; n < 4; ++n)
+        {
+            source.emplace_back(n);
+        }
+
+        tracked::throw_on_copy = 2;
+        EXPECT_THROW((void)buffer.push_range(source), std::runtime_error);
+        tracked::throw_on_copy = -1;
+
+        EXPECT_EQ(2U, buffer.size());
+        EXPECT_EQ(0, buffer.try_pop()->value);
+        EXPECT_EQ(1, buffer.try_pop()->value);
+        EXPECT_FALSE(buffer.try_pop().has_value());
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+
+/**
+ * @brief Streams heap-owning frames from a producer thread to a consumer thread in batches.
+ */
+TEST(LockFreeObjectRingBufferTest, ProducerConsumerFrames)
+{
+    constexpr const int frame_count = 20000;
+    constexpr const std::size_t batch_size = 8U;
+
+    auto buffer = std::make_unique<tools::lock_free_object_ring_buffer<std::vector<int>, 6>>();
+
+    std::thread producer(
+        [&]()
+        {
+            int next = 0;
+            while (next < frame_count)
+            {
+                std::vector<std::vector<int>> pending;
+                for (std::size_t n = 0U; (n < batch_size) && (next < frame_count); ++n)
+                {
+                    pending.emplace_back(3U, next++);
+                }
+
+                while (!pending.empty())
+                {
+                    // the rvalue range hands its elements over; drop the ones the buffer took
+                    const std::size_t pushed = buffer->push_range(std::move(pending));
+                    pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(pushed));
+                    if (0U == pushed)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+
+    int expected = 0;
+    bool in_order = true;
+    std::array<std::vector<int>, batch_size> received;
+    while (expected < frame_count)
+    {
+        const std::size_t popped = buffer->pop_range(received.begin(), received.end());
+        if (0U == popped)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (std::size_t n = 0U; n < popped; ++n)
+        {
+            in_order = in_order && (received.at(n).size() == 3U) && (received.at(n).front() == expected);
+            ++expected;
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(buffer->empty());
+}
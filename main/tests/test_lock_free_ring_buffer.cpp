@@ -42,6 +42,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -56,6 +57,8 @@
 #include "tools/generic_task.hpp"
 #include "tools/lock_free_ring_buffer.hpp"
 
+#include "test_helper.hpp"
+
 /**
  * @brief Test fixture for LockFreeRingBuffer tests.
  *
@@ -344,6 +347,109 @@ TEST(LockFreeRingBufferStressTest, PortableTaskHelpersProducerConsumer)
     ASSERT_EQ(context->consumer_sum.load(), context->producer_sum.load());
 }
 
+/**
+ * @brief Verifies the cache-padded layout keeps the compact FIFO semantics and separates producer and consumer data.
+ */
+TEST(LockFreeRingBufferLayoutTest, CachePaddedPushPop)
+{
+    using padded_t = tools::padded_lock_free_ring_buffer<int, 3>;
+    static_assert(
+        std::is_same_v<padded_t, tools::lock_free_ring_buffer<int, 3, tools::ring_buffer_layout::cache_padded>>);
+    static_assert(alignof(padded_t) >= 64U);
+    static_assert(sizeof(padded_t) >= (3U * 64U));
+    static_assert(sizeof(tools::lock_free_ring_buffer<int, 3>) < 64U);
+
+    auto buffer = std::make_unique<padded_t>();
+    ASSERT_EQ(buffer->capacity(), 8U);
+
+    // several laps, so the cached indices must be refreshed on both full and empty
+    for (int lap = 0; lap < 4; ++lap)
+    {
+        for (int n = 0; n < 7; ++n)
+        {
+            ASSERT_TRUE(buffer->push(lap * 10 + n));
+        }
+        ASSERT_FALSE(buffer->push(-1));
+
+        for (int n = 0; n < 7; ++n)
+        {
+            auto value = buffer->pop_opt();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_EQ(lap * 10 + n, value.value());
+        }
+        EXPECT_FALSE(buffer->pop_opt().has_value());
+    }
+
+    EXPECT_EQ(3U, buffer->push_range({ 1, 2, 3 }));
+    std::array<int, 4> destination = {};
+    EXPECT_EQ(3U, buffer->pop_range(destination.begin(), destination.end()));
+    EXPECT_EQ(3, destination[2]);
+}
+
+namespace
+{
+    template <typename Buffer>
+    std::chrono::microseconds spsc_transfer(Buffer& buffer, std::uint32_t item_count, std::uint64_t& consumer_sum)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::thread producer(
+            [&]()
+            {
+                for (std::uint32_t value = 1U; value <= item_count; ++value)
+                {
+                    while (!buffer.push(value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+        std::uint64_t local_sum = 0U;
+        std::uint32_t expected = 1U;
+        while (expected <= item_count)
+        {
+            std::uint32_t popped_value = 0U;
+            if (!buffer.pop(popped_value))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if (popped_value != expected)
+            {
+                break;
+            }
+            local_sum += popped_value;
+            ++expected;
+        }
+
+        producer.join();
+        consumer_sum = local_sum;
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+}
+
+/**
+ * @brief Transfers the same stream through both layouts between two threads and reports their throughput.
+ */
+TEST(LockFreeRingBufferLayoutTest, CachePaddedProducerConsumer)
+{
+    constexpr const std::uint32_t item_count = 200000U;
+    constexpr const std::uint64_t expected_sum = static_cast<std::uint64_t>(item_count) * (item_count + 1U) / 2U;
+
+    auto compact = std::make_unique<tools::lock_free_ring_buffer<std::uint32_t, 10>>();
+    auto padded = std::make_unique<tools::padded_lock_free_ring_buffer<std::uint32_t, 10>>();
+
+    std::uint64_t compact_sum = 0U;
+    std::uint64_t padded_sum = 0U;
+    const auto compact_time = spsc_transfer(*compact, item_count, compact_sum);
+    const auto padded_time = spsc_transfer(*padded, item_count, padded_sum);
+
+    EXPECT_EQ(expected_sum, compact_sum);
+    EXPECT_EQ(expected_sum, padded_sum);
+    TEST_COUT << "compact: " << compact_time.count() << " us, cache_padded: " << padded_time.count() << " us";
+}
+
 /**
  * @brief Verifies exact-T lvalue and rvalue push overloads produce the same stored value.
  *
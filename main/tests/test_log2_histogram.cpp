@@ -0,0 +1,128 @@
+/**
+ * @file test_log2_histogram.cpp
+ * @brief Unit tests for the fixed-bucket log2_histogram using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "tools/log2_histogram.hpp"
+#include "tools/periodic_task_stats.hpp"
+
+/**
+ * @brief Test the power-of-two bucket boundaries and the clamping to the last bucket.
+ */
+TEST(Log2HistogramTest, BucketBoundaries)
+{
+    using histogram_t = tools::log2_histogram<8U>;
+
+    EXPECT_EQ(0U, histogram_t::bucket_of(0U));
+    EXPECT_EQ(1U, histogram_t::bucket_of(1U));
+    EXPECT_EQ(2U, histogram_t::bucket_of(2U));
+    EXPECT_EQ(2U, histogram_t::bucket_of(3U));
+    EXPECT_EQ(3U, histogram_t::bucket_of(4U));
+    EXPECT_EQ(7U, histogram_t::bucket_of(64U));
+    EXPECT_EQ(7U, histogram_t::bucket_of(UINT32_MAX));
+}
+
+/**
+ * @brief Test the count, min, max, mean and bucket counters of a snapshot.
+ */
+TEST(Log2HistogramTest, SnapshotSummarizesSamples)
+{
+    tools::log2_histogram<16U> histogram;
+
+    const auto empty = histogram.snapshot();
+    EXPECT_EQ(0U, empty.count);
+    EXPECT_EQ(0U, empty.min);
+    EXPECT_DOUBLE_EQ(0.0, empty.mean());
+
+    histogram.add(3U);
+    histogram.add(5U);
+    histogram.add(100U);
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(3U, snapshot.count);
+    EXPECT_EQ(3U, snapshot.min);
+    EXPECT_EQ(100U, snapshot.max);
+    EXPECT_EQ(108U, snapshot.sum);
+    EXPECT_DOUBLE_EQ(36.0, snapshot.mean());
+    EXPECT_EQ(1U, snapshot.buckets[2]);
+    EXPECT_EQ(1U, snapshot.buckets[3]);
+    EXPECT_EQ(1U, snapshot.buckets[7]);
+
+    histogram.reset();
+    EXPECT_EQ(0U, histogram.snapshot().count);
+    EXPECT_EQ(0U, histogram.snapshot().max);
+}
+
+/**
+ * @brief Test that the percentile estimate is the upper bound of the holding bucket, capped by the maximum.
+ */
+TEST(Log2HistogramTest, PercentileUpperBound)
+{
+    tools::log2_histogram<16U> histogram;
+
+    for (std::uint32_t i = 0U; i < 99U; ++i)
+    {
+        histogram.add(10U);
+    }
+    histogram.add(1000U);
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(15U, snapshot.percentile_upper_bound(0.5));
+    EXPECT_EQ(1000U, snapshot.percentile_upper_bound(1.0));
+}
+
+/**
+ * @brief Test that the periodic_task recorder clamps long durations and accumulates the overruns.
+ */
+TEST(PeriodicTaskStatsRecorderTest, RecordsAndResets)
+{
+    tools::periodic_task_stats_recorder recorder;
+
+    recorder.record_wakeup(12U);
+    recorder.record_execution(0x1FFFFFFFFULL);
+    recorder.record_overrun(1U);
+    recorder.record_overrun(3U);
+
+    auto stats = recorder.snapshot();
+    EXPECT_EQ(12U, stats.wakeup_lateness.max);
+    EXPECT_EQ(UINT32_MAX, stats.execution_time.max);
+    EXPECT_EQ(2U, stats.overruns);
+    EXPECT_EQ(4U, stats.skipped_periods);
+
+    recorder.reset();
+    stats = recorder.snapshot();
+    EXPECT_EQ(0U, stats.wakeup_lateness.count);
+    EXPECT_EQ(0U, stats.overruns);
+}
@@ -0,0 +1,110 @@
+/**
+ * @file test_logger.cpp
+ * @brief Unit tests for the log level filtering of the logger macros using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+// the log calls of this file form their own module
+#define LOG_MODULE "logger_test"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string_view>
+
+#include "tools/logger.hpp"
+
+namespace
+{
+    constexpr bool same_text(const char* lhs, const char* rhs)
+    {
+        return std::string_view(lhs) == std::string_view(rhs);
+    }
+
+    static_assert(same_text(tools::detail::log_file_name("main/tools/logger.hpp"), "logger.hpp"));
+    static_assert(same_text(tools::detail::log_file_name("C:\\repo\\main.cpp"), "main.cpp"));
+    static_assert(same_text(tools::detail::log_file_name("main.cpp"), "main.cpp"));
+    static_assert(tools::detail::log_module_slot("logger_test") < tools::log_module_slots);
+
+    int count(int& calls)
+    {
+        return ++calls;
+    }
+}
+
+// Test fixture restoring the runtime level of the module
+class LoggerTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        tools::set_log_level(LOG_MODULE, tools::log_level::verbose);
+    }
+};
+
+TEST_F(LoggerTest, ModuleLevelRoundTrips)
+{
+    EXPECT_EQ(tools::log_level::verbose, tools::get_log_level(LOG_MODULE));
+
+    tools::set_log_level(LOG_MODULE, tools::log_level::warning);
+    EXPECT_EQ(tools::log_level::warning, tools::get_log_level(LOG_MODULE));
+
+    tools::set_log_level(LOG_MODULE, tools::log_level::error);
+    EXPECT_EQ(tools::log_level::error, tools::get_log_level(LOG_MODULE));
+}
+
+TEST_F(LoggerTest, SilencedCallsSkipArgumentEvaluation)
+{
+    int calls = 0;
+
+    tools::set_log_level(LOG_MODULE, tools::log_level::error);
+    LOG_WARNING("silenced %d", count(calls));
+    LOG_INFO("silenced %d", count(calls));
+    LOG_DEBUG("silenced %d", count(calls));
+    EXPECT_EQ(0, calls);
+
+    LOG_ERROR("written %d", count(calls));
+    EXPECT_EQ(1, calls);
+}
+
+TEST_F(LoggerTest, EnabledCallsEvaluateArgumentsOnce)
+{
+    int calls = 0;
+
+#if LOG_MIN_LEVEL >= 1
+    LOG_WARNING("written %d", count(calls));
+    EXPECT_EQ(1, calls);
+#endif
+
+    tools::set_log_level(LOG_MODULE, tools::log_level::warning);
+    EXPECT_FALSE(tools::detail::log_enabled(tools::log_level::info, tools::detail::log_module_slot(LOG_MODULE)));
+    EXPECT_TRUE(tools::detail::log_enabled(tools::log_level::warning, tools::detail::log_module_slot(LOG_MODULE)));
+}
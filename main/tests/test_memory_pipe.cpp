@@ -243,6 +243,208 @@ TEST_F(MemoryPipeTest, SingleProducerSingleConsumer)
     consumer.join();
 }
 
+/**
+ * @brief Test case for bulk transfers crossing the end of the ring buffer.
+ *
+ * Repeatedly sends and receives blocks that do not divide the pipe capacity, so that most blocks
+ * are split at the wrap-around point, and checks the bytes come out in order.
+ */
+TEST_F(MemoryPipeTest, BulkTransferWrapsAround)
+{
+    constexpr std::size_t block_size = 7U;
+    constexpr int rounds = 20;
+    auto timeout = std::chrono::milliseconds(100);
+    std::uint8_t next_value = 0U;
+
+    for (int round = 0; round < rounds; ++round)
+    {
+        std::vector<std::uint8_t> data_to_send(block_size);
+        for (auto& value : data_to_send)
+        {
+            value = next_value++;
+        }
+
+        ASSERT_EQ(pipe->send(data_to_send, timeout), block_size);
+
+        std::vector<std::uint8_t> data_received;
+        ASSERT_EQ(pipe->receive(data_received, block_size, timeout), block_size);
+        ASSERT_EQ(data_received, data_to_send);
+    }
+}
+
+/**
+ * @brief Test case for a transfer much larger than the pipe capacity.
+ *
+ * The producer blocks when the pipe is full and must be woken up by the consumer freeing space,
+ * the consumer blocks when the pipe is empty and must be woken up by the producer.
+ */
+TEST_F(MemoryPipeTest, BlockedSenderAndReceiverWakeEachOther)
+{
+    constexpr std::size_t transfer_size = 4096U;
+    auto timeout = std::chrono::milliseconds(5000);
+
+    std::vector<std::uint8_t> data_to_send(transfer_size);
+    for (std::size_t idx = 0U; idx < transfer_size; ++idx)
+    {
+        data_to_send[idx] = static_cast<std::uint8_t>(idx * 31U);
+    }
+
+    std::vector<std::uint8_t> data_received;
+    std::size_t sent_bytes = 0U;
+    std::size_t received_bytes = 0U;
+
+    std::thread producer([&]() { sent_bytes = pipe->send(data_to_send, timeout); });
+    std::thread consumer([&]() { received_bytes = pipe->receive(data_received, transfer_size, timeout); });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_EQ(sent_bytes, transfer_size);
+    EXPECT_EQ(received_bytes, transfer_size);
+    EXPECT_EQ(data_received, data_to_send);
+}
+
+/**
+ * @brief Test case for a receive on an empty pipe.
+ *
+ * The receiver blocks until the timeout expires and returns no data.
+ */
+TEST_F(MemoryPipeTest, ReceiveOnEmptyPipeWaitsForTimeout)
+{
+    constexpr auto timeout = std::chrono::milliseconds(50);
+    std::array<std::uint8_t, 4U> buffer = {};
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const std::size_t received_bytes = pipe->receive(buffer.data(), buffer.size(), timeout);
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+
+    EXPECT_EQ(received_bytes, 0U);
+    EXPECT_GE(elapsed, timeout);
+}
+
+/**
+ * @brief Test case for the expected-returning transfers.
+ *
+ * @test
+ * - A complete send and receive return the byte count.
+ * - A send overflowing the pipe and a receive past the available bytes report timed_out with the partial count.
+ * - A null buffer reports invalid_argument.
+ */
+TEST_F(MemoryPipeTest, ResultTransfersReportShortfalls)
+{
+    constexpr auto no_wait = std::chrono::milliseconds(0);
+    const std::vector<std::uint8_t> data = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::array<std::uint8_t, 16U> buffer = {};
+
+    const auto sent = pipe->send_result(data.data(), 4U, no_wait);
+    ASSERT_TRUE(sent.has_value());
+    EXPECT_EQ(sent.value(), 4U);
+    const auto received = pipe->receive_result(buffer.data(), 4U, no_wait);
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received.value(), 4U);
+
+    const auto overflow = pipe->send_result(data.data(), data.size(), no_wait);
+    const auto overflow_more = pipe->send_result(data.data(), data.size(), no_wait);
+    ASSERT_TRUE(overflow.has_value());
+    ASSERT_FALSE(overflow_more.has_value());
+    EXPECT_EQ(overflow_more.error().code, tools::pipe_error::timed_out);
+    EXPECT_LT(overflow_more.error().transferred, data.size());
+
+    const auto drained = pipe->receive_result(buffer.data(), buffer.size(), no_wait);
+    ASSERT_FALSE(drained.has_value());
+    EXPECT_EQ(drained.error().code, tools::pipe_error::timed_out);
+    EXPECT_EQ(drained.error().transferred, data.size() + overflow_more.error().transferred);
+
+    const auto invalid = pipe->send_result(nullptr, 1U, no_wait);
+    ASSERT_FALSE(invalid.has_value());
+    EXPECT_EQ(invalid.error().code, tools::pipe_error::invalid_argument);
+}
+
+/**
+ * @brief Test case for the zero-copy producer path.
+ *
+ * Bytes written in the reserved region become visible to receive() only after commit().
+ */
+TEST_F(MemoryPipeTest, ReserveCommitPublishesWrittenBytes)
+{
+    auto timeout = std::chrono::milliseconds(10);
+
+    auto region = pipe->reserve(4U);
+    ASSERT_EQ(region.size, 4U);
+    ASSERT_NE(region.data, nullptr);
+
+    for (std::size_t idx = 0U; idx < region.size; ++idx)
+    {
+        region.data[idx] = static_cast<std::uint8_t>(idx + 1U);
+    }
+
+    std::array<std::uint8_t, 4U> buffer = {};
+    EXPECT_EQ(pipe->receive(buffer.data(), buffer.size(), std::chrono::milliseconds(0)), 0U);
+
+    EXPECT_EQ(pipe->commit(3U), 3U);
+    EXPECT_EQ(pipe->receive(buffer.data(), buffer.size(), timeout), 3U);
+    EXPECT_EQ(buffer[0], 1U);
+    EXPECT_EQ(buffer[1], 2U);
+    EXPECT_EQ(buffer[2], 3U);
+
+    // nothing reserved anymore
+    EXPECT_EQ(pipe->commit(1U), 0U);
+}
+
+/**
+ * @brief Test case for reserve() on a pipe short of space.
+ *
+ * The reserved region is clamped to the free space and to the end of the storage.
+ */
+TEST_F(MemoryPipeTest, ReserveClampsToContiguousFreeSpace)
+{
+    auto timeout = std::chrono::milliseconds(10);
+    std::vector<std::uint8_t> filler(6U, 0xAAU);
+
+    ASSERT_EQ(pipe->send(filler, timeout), filler.size());
+    EXPECT_EQ(pipe->reserve(buffer_size).size, buffer_size - 1U - filler.size());
+
+    std::vector<std::uint8_t> drained;
+    ASSERT_EQ(pipe->receive(drained, filler.size(), timeout), filler.size());
+
+    // write index is at 6, the storage ends at 10
+    EXPECT_EQ(pipe->reserve(buffer_size).size, buffer_size - filler.size());
+}
+
+/**
+ * @brief Test case for the zero-copy consumer path across the wrap-around point.
+ *
+ * peek() exposes the readable bytes as two regions and consume() releases them.
+ */
+TEST_F(MemoryPipeTest, PeekConsumeExposesWrappedRegions)
+{
+    auto timeout = std::chrono::milliseconds(10);
+    std::vector<std::uint8_t> filler(7U, 0U);
+    std::vector<std::uint8_t> drained;
+
+    ASSERT_EQ(pipe->send(filler, timeout), filler.size());
+    ASSERT_EQ(pipe->receive(drained, filler.size(), timeout), filler.size());
+
+    const std::vector<std::uint8_t> data_to_send = { 1, 2, 3, 4, 5 };
+    ASSERT_EQ(pipe->send(data_to_send, timeout), data_to_send.size());
+
+    auto regions = pipe->peek();
+    ASSERT_EQ(regions.size(), data_to_send.size());
+    ASSERT_EQ(regions.first_size, buffer_size - filler.size());
+    ASSERT_EQ(regions.second_size, data_to_send.size() - regions.first_size);
+
+    std::vector<std::uint8_t> peeked(regions.first, regions.first + regions.first_size);
+    peeked.insert(peeked.end(), regions.second, regions.second + regions.second_size);
+    EXPECT_EQ(peeked, data_to_send);
+
+    EXPECT_EQ(pipe->consume(2U), 2U);
+    EXPECT_EQ(pipe->peek().size(), data_to_send.size() - 2U);
+
+    EXPECT_EQ(pipe->consume(buffer_size), data_to_send.size() - 2U);
+    EXPECT_EQ(pipe->peek().size(), 0U);
+    EXPECT_EQ(pipe->peek().first, nullptr);
+}
+
 namespace
 {
     struct vector_convertible_data
@@ -338,6 +540,105 @@ TEST_F(MemoryPipeTest, ReceiveRangeClampsToAvailable)
     EXPECT_EQ(received[1], 12U);
 }
 
+/**
+ * @brief Test case for message framing across the wrap-around point.
+ *
+ * @test
+ * - Send messages of 5, 0 and 10 bytes many times through a 64 byte pipe, so that headers and bodies wrap.
+ * - Verify each receive_message() returns one whole message into the reused vector.
+ * - Verify the vector is not reallocated once it reached the largest message.
+ */
+TEST_F(MemoryPipeTest, MessagesKeepBoundaries)
+{
+    tools::memory_pipe local_pipe(64U);
+    const auto timeout = std::chrono::milliseconds(100);
+    const std::array<std::size_t, 3> sizes = { 5U, 0U, 10U };
+    std::vector<std::uint8_t> message;
+    message.reserve(10U);
+    const std::uint8_t* storage = message.data();
+
+    for (std::uint8_t round = 0U; round < 20U; ++round)
+    {
+        for (const std::size_t size : sizes)
+        {
+            std::vector<std::uint8_t> sent(size, static_cast<std::uint8_t>(round + size));
+            ASSERT_EQ(size, local_pipe.send_message(sent.data(), sent.size(), timeout));
+        }
+        for (const std::size_t size : sizes)
+        {
+            ASSERT_EQ(size, local_pipe.receive_message(message, timeout));
+            EXPECT_EQ(std::vector<std::uint8_t>(size, static_cast<std::uint8_t>(round + size)), message);
+        }
+    }
+    EXPECT_EQ(storage, message.data());
+
+    EXPECT_EQ(0U, local_pipe.receive_message(message, std::chrono::milliseconds(0)));
+    EXPECT_TRUE(message.empty());
+}
+
+/**
+ * @brief Test case for messages that do not fit.
+ *
+ * @test
+ * - Verify a message larger than the pipe allows (capacity - 5) is refused, and one larger than the free space times out.
+ * - Verify a message larger than the destination stays in the pipe and is received with a larger buffer.
+ */
+TEST_F(MemoryPipeTest, OversizedMessages)
+{
+    tools::memory_pipe local_pipe(32U);
+    const auto timeout = std::chrono::milliseconds(10);
+    std::array<std::uint8_t, 28> payload = {};
+    payload.fill(0x5aU);
+
+    EXPECT_EQ(0U, local_pipe.send_message(payload.data(), payload.size(), timeout));
+    ASSERT_EQ(20U, local_pipe.send_message(payload.data(), 20U, timeout));
+    EXPECT_EQ(0U, local_pipe.send_message(payload.data(), 4U, timeout));
+
+    std::array<std::uint8_t, 8> small = {};
+    EXPECT_EQ(0U, local_pipe.receive_message(small.data(), small.size(), timeout));
+    std::array<std::uint8_t, 26> large = {};
+    ASSERT_EQ(20U, local_pipe.receive_message(large.data(), large.size(), timeout));
+    EXPECT_EQ(0x5aU, large[19]);
+}
+
+/**
+ * @brief Test case for messages between a producer and a consumer thread.
+ *
+ * @test
+ * - Send 2000 messages of 0 to 49 bytes, numbered in their first byte, through a 128 byte pipe.
+ * - Verify the consumer receives them in order with their sizes.
+ */
+TEST_F(MemoryPipeTest, MessagesAcrossThreads)
+{
+    tools::memory_pipe local_pipe(128U);
+    const auto timeout = std::chrono::milliseconds(2000);
+    constexpr std::size_t count = 2000U;
+
+    std::thread producer(
+        [&local_pipe, &timeout]()
+        {
+            std::array<std::uint8_t, 50> payload = {};
+            for (std::size_t i = 0U; i < count; ++i)
+            {
+                payload.fill(static_cast<std::uint8_t>(i));
+                static_cast<void>(local_pipe.send_message(payload.data(), i % payload.size(), timeout));
+            }
+        });
+
+    std::vector<std::uint8_t> message;
+    std::size_t in_order = 0U;
+    for (std::size_t i = 0U; i < count; ++i)
+    {
+        const std::size_t size = local_pipe.receive_message(message, timeout);
+        if ((size == (i % 50U)) && ((0U == size) || (static_cast<std::uint8_t>(i) == message.front())))
+        {
+            ++in_order;
+        }
+    }
+    producer.join();
+    EXPECT_EQ(count, in_order);
+}
+
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 TEST_F(MemoryPipeTest, ReceiveRangeSpanReturnsEffectiveCount)
 {
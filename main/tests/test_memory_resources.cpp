@@ -0,0 +1,217 @@
+/**
+ * @file test_memory_resources.cpp
+ * @brief Unit tests for the std::pmr memory resources and the pmr tools containers using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tools/memory_resources.hpp"
+
+#if defined(__cpp_lib_memory_resource)
+
+namespace
+{
+    /**
+     * @brief Resource forwarding to the new/delete resource while counting the traffic.
+     */
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations = 0U;
+        std::size_t deallocations = 0U;
+        std::size_t live_bytes = 0U;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            live_bytes += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            ++deallocations;
+            live_bytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+/**
+ * @brief Test that the mem pool resource serves default and over-aligned blocks and compares equal to itself.
+ */
+TEST(MemoryResourcesTest, MemPoolResourceServesAlignedBlocks)
+{
+    std::pmr::memory_resource* resource = tools::get_mem_pool_resource();
+    ASSERT_NE(nullptr, resource);
+    EXPECT_EQ(resource, tools::get_mem_pool_resource());
+    EXPECT_TRUE(resource->is_equal(*tools::get_mem_pool_resource()));
+    EXPECT_FALSE(resource->is_equal(*std::pmr::new_delete_resource()));
+
+    for (const std::size_t alignment : { std::size_t { 8U }, std::size_t { 64U }, std::size_t { 256U } })
+    {
+        void* block = resource->allocate(100U, alignment);
+        ASSERT_NE(nullptr, block);
+        EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(block) % alignment);
+        resource->deallocate(block, 100U, alignment);
+    }
+
+    std::pmr::vector<std::pmr::string> names(resource);
+    names.emplace_back("a string long enough to defeat the small string optimization");
+    EXPECT_EQ(resource, names.front().get_allocator().resource());
+}
+
+/**
+ * @brief Test that the static arena keeps allocations in its buffer until exhausted, then uses upstream.
+ */
+TEST(MemoryResourcesTest, StaticArenaFallsBackToUpstreamWhenFull)
+{
+    counting_resource upstream;
+    tools::static_arena_resource<1024U> arena(&upstream);
+    EXPECT_EQ(1024U, arena.capacity());
+
+    void* first = arena.allocate(256U);
+    EXPECT_TRUE(arena.owns(first));
+    EXPECT_EQ(0U, upstream.allocations);
+
+    void* overflow = arena.allocate(2048U);
+    EXPECT_FALSE(arena.owns(overflow));
+    EXPECT_GE(upstream.allocations, 1U);
+
+    arena.deallocate(first, 256U);
+    arena.deallocate(overflow, 2048U);
+    arena.release();
+    EXPECT_EQ(upstream.allocations, upstream.deallocations);
+    EXPECT_EQ(0U, upstream.live_bytes);
+
+    void* again = arena.allocate(256U);
+    EXPECT_EQ(first, again);
+}
+
+/**
+ * @brief Test that the TLSF resource serves from its heap and sends over-aligned and oversized requests upstream.
+ */
+TEST(MemoryResourcesTest, TlsfResourceRoutesByAlignmentAndCapacity)
+{
+    std::vector<unsigned char> region(16U * 1024U);
+    counting_resource upstream;
+    tools::tlsf_resource resource(region.data(), region.size(), &upstream);
+
+    void* small = resource.allocate(128U);
+    EXPECT_TRUE(resource.heap().owns(small));
+    EXPECT_EQ(0U, upstream.allocations);
+    EXPECT_GT(resource.heap().stats().used_bytes, 0U);
+
+    void* aligned = resource.allocate(128U, 4U * tools::tlsf_heap::alignment);
+    EXPECT_FALSE(resource.heap().owns(aligned));
+    void* large = resource.allocate(64U * 1024U);
+    EXPECT_FALSE(resource.heap().owns(large));
+    EXPECT_EQ(2U, upstream.allocations);
+
+    resource.deallocate(small, 128U);
+    resource.deallocate(aligned, 128U, 4U * tools::tlsf_heap::alignment);
+    resource.deallocate(large, 64U * 1024U);
+    EXPECT_EQ(2U, upstream.deallocations);
+    EXPECT_EQ(0U, resource.heap().stats().used_bytes);
+    EXPECT_EQ(&upstream, resource.upstream_resource());
+}
+
+/**
+ * @brief Test that the pmr flavours of the tools containers allocate from the resource they are given.
+ */
+TEST(MemoryResourcesTest, PmrContainersAllocateFromTheirResource)
+{
+    counting_resource resource;
+
+    {
+        tools::pmr::sync_queue<int> queue(&resource);
+        for (int i = 0; i < 100; ++i)
+        {
+            queue.push(i);
+        }
+        EXPECT_EQ(0, queue.front_pop().value_or(-1));
+        EXPECT_EQ(99U, queue.size());
+    }
+    EXPECT_GT(resource.allocations, 0U);
+    EXPECT_EQ(0U, resource.live_bytes);
+
+    const std::size_t before_dictionary = resource.allocations;
+    {
+        tools::pmr::sync_dictionary<int, int> dictionary(&resource);
+        dictionary.add(1, 10);
+        dictionary.add(2, 20);
+        EXPECT_EQ(20, dictionary.find(2).value_or(0));
+    }
+    EXPECT_EQ(before_dictionary + 2U, resource.allocations);
+
+    const std::size_t before_ring = resource.allocations;
+    {
+        tools::pmr::ring_vector<int> ring(8U, &resource);
+        EXPECT_EQ(before_ring + 1U, resource.allocations);
+        EXPECT_TRUE(ring.push(7));
+        EXPECT_EQ(7, ring.front());
+    }
+
+    const std::size_t before_time_list = resource.allocations;
+    {
+        tools::pmr::time_list<std::uint64_t, int> list(&resource);
+        list.push(20U, 2);
+        list.push(10U, 1);
+        EXPECT_EQ(1, list.top_pop().value_or(std::make_pair(0U, 0)).second);
+    }
+    EXPECT_GT(resource.allocations, before_time_list);
+
+    const std::size_t before_histogram = resource.allocations;
+    {
+        tools::pmr::histogram<int> occurrences(&resource);
+        occurrences.add(3);
+        occurrences.add(3);
+        occurrences.add(5);
+        EXPECT_EQ(3, occurrences.total_count());
+        EXPECT_EQ(3, occurrences.top());
+    }
+    EXPECT_GT(resource.allocations, before_histogram);
+    EXPECT_EQ(resource.allocations, resource.deallocations);
+    EXPECT_EQ(0U, resource.live_bytes);
+}
+
+#endif // defined(__cpp_lib_memory_resource)
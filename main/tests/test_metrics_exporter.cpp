@@ -0,0 +1,125 @@
+/**
+ * @file test_metrics_exporter.cpp
+ * @brief Unit tests for the OpenMetrics writer and the metrics_exporter class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "tools/log2_histogram.hpp"
+#include "tools/metrics_exporter.hpp"
+#include "tools/sync_container_stats.hpp"
+#include "tools/sync_ring_vector.hpp"
+
+/**
+ * @brief Verifies families are rendered once with their samples grouped, labels escaped and the EOF marker last.
+ */
+TEST(MetricsExporterTest, WritesOpenMetricsFamilies)
+{
+    tools::openmetrics_writer writer;
+    writer.family("demo_events", tools::metric_type::counter, "Events seen")
+        .add({ { "source", "a" } }, std::uint64_t { 3U });
+    writer.family("demo_depth", tools::metric_type::gauge, "Queue depth").add({}, 1.5);
+    writer.family("demo_events", tools::metric_type::counter, "ignored")
+        .add({ { "source", "b\"c" } }, std::uint64_t { 4U });
+
+    const std::string expected = "# TYPE demo_events counter\n"
+                                 "# HELP demo_events Events seen\n"
+                                 "demo_events_total{source=\"a\"} 3\n"
+                                 "demo_events_total{source=\"b\\\"c\"} 4\n"
+                                 "# TYPE demo_depth gauge\n"
+                                 "# HELP demo_depth Queue depth\n"
+                                 "demo_depth 1.5\n"
+                                 "# EOF\n";
+    EXPECT_EQ(writer.finish(), expected);
+}
+
+/**
+ * @brief Verifies a log2 histogram becomes cumulative power-of-two buckets ending with +Inf, then count and sum.
+ */
+TEST(MetricsExporterTest, WritesHistogramBuckets)
+{
+    tools::log2_histogram_snapshot<4U> histogram;
+    histogram.buckets = { 1U, 0U, 2U, 1U };
+    histogram.count = 4U;
+    histogram.sum = 17U;
+
+    tools::openmetrics_writer writer;
+    writer.family("demo_latency", tools::metric_type::histogram, "Latency").add({ { "task", "t" } }, histogram);
+    const std::string text = writer.finish();
+    EXPECT_NE(text.find("demo_latency_bucket{task=\"t\",le=\"0\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_latency_bucket{task=\"t\",le=\"1\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_latency_bucket{task=\"t\",le=\"3\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_latency_bucket{task=\"t\",le=\"+Inf\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_latency_count{task=\"t\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_latency_sum{task=\"t\"} 17\n"), std::string::npos);
+}
+
+/**
+ * @brief Verifies the exporter runs its collectors, including the sync container one, and dumps to a file.
+ */
+TEST(MetricsExporterTest, RendersCollectorsAndDumpsToFile)
+{
+    tools::basic_sync_ring_vector<int, tools::critical_section, tools::sync_container_stats> ring(4U);
+    ring.stats().set_name("exported_ring");
+    ring.push(1);
+    ring.push(2);
+
+    tools::metrics_exporter exporter;
+    const auto handle = exporter.add_collector(tools::write_sync_container_metrics);
+    exporter.add_collector([](tools::openmetrics_writer& writer)
+        { writer.family("demo_up", tools::metric_type::gauge, "Up").add({}, std::uint64_t { 1U }); });
+
+    std::string text = exporter.render();
+    EXPECT_NE(text.find("pubsub_container_pushes_total{container=\"exported_ring\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("demo_up 1\n"), std::string::npos);
+
+    const std::string path = "metrics_exporter_test.prom";
+    ASSERT_TRUE(exporter.dump_to_file(path));
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str(), text);
+    EXPECT_EQ(std::remove(path.c_str()), 0);
+
+    EXPECT_TRUE(exporter.remove_collector(handle));
+    EXPECT_FALSE(exporter.remove_collector(handle));
+    text = exporter.render();
+    EXPECT_EQ(text.find("pubsub_container_pushes"), std::string::npos);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file test_mpsc_queue.cpp
+ * @brief Unit tests for the multi-producer single-consumer node queue.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/mpsc_queue.hpp"
+
+/**
+ * @brief Elements pushed by concurrent producers all reach the consumer, each producer's in FIFO order.
+ *
+ * @test
+ * - Four producers push 20000 tagged sequence numbers while the consumer pops; checks each producer's sequence
+ *   arrives complete and increasing, and that the queue ends empty.
+ */
+TEST(MpscQueueTest, KeepsPerProducerOrderUnderContention)
+{
+    constexpr std::size_t producers = 4U;
+    constexpr std::size_t per_producer = 20000U;
+    tools::mpsc_queue<std::size_t> queue;
+
+    std::vector<std::thread> threads;
+    for (std::size_t producer = 0U; producer < producers; ++producer)
+    {
+        threads.emplace_back(
+            [&queue, producer]()
+            {
+                for (std::size_t index = 0U; index < per_producer; ++index)
+                {
+                    queue.push((producer * per_producer) + index);
+                }
+            });
+    }
+
+    std::vector<std::size_t> next(producers, 0U);
+    std::size_t received = 0U;
+    bool ordered = true;
+    while (received < (producers * per_producer))
+    {
+        const auto elem = queue.front_pop();
+        if (!elem.has_value())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const std::size_t producer = elem.value() / per_producer;
+        ordered = ordered && ((elem.value() % per_producer) == next[producer]);
+        ++next[producer];
+        ++received;
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.front_pop().has_value());
+}
+
+/**
+ * @brief Nodes come from the pool, then from the heap once it is exhausted; batches keep their order.
+ *
+ * @test
+ * - Pushes more elements than the pool holds through push_range and emplace; checks the heap node count, the
+ *   FIFO order through pop_range, and that queued elements are destroyed with the queue.
+ */
+TEST(MpscQueueTest, FallsBackToTheHeapAndBatches)
+{
+    auto tracked = std::make_shared<int>(0);
+    {
+        tools::mpsc_queue<std::shared_ptr<int>, 4U> queue;
+        queue.push(tracked);
+        EXPECT_EQ(2, tracked.use_count());
+    }
+    EXPECT_EQ(1, tracked.use_count());
+
+    tools::mpsc_queue<std::string, 4U> queue;
+    queue.push_range(std::vector<std::string> { "a", "b", "c" });
+    queue.emplace(2U, 'd');
+    queue.push("e");
+    EXPECT_EQ(5U, queue.size());
+    EXPECT_EQ(2U, queue.heap_node_count()); // the pool also holds the head node
+
+    std::vector<std::string> popped(8U);
+    EXPECT_EQ(5U, queue.pop_range(popped.begin(), popped.end()));
+    EXPECT_EQ((std::vector<std::string> { "a", "b", "c", "dd", "e", "", "", "" }), popped);
+
+    queue.push("f");
+    queue.pop();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(2U, queue.heap_node_count());
+}
@@ -0,0 +1,304 @@
+/**
+ * @file test_object_pool.cpp
+ * @brief Unit tests for the typed object pools and their pooled handles using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/async_observer.hpp"
+#include "tools/data_task.hpp"
+#include "tools/object_pool.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+
+namespace
+{
+    struct sensor_frame
+    {
+        sensor_frame(int frame_id, double frame_value)
+            : id(frame_id)
+            , value(frame_value)
+        {
+        }
+
+        int id;
+        double value;
+    };
+
+    struct throwing_frame
+    {
+        explicit throwing_frame(bool fail)
+        {
+            if (fail)
+            {
+                throw std::runtime_error("constructor failure");
+            }
+        }
+    };
+
+    struct task_context
+    {
+    };
+}
+
+/**
+ * @brief Test create/destroy, exhaustion and most recently released first reuse.
+ */
+TEST(ObjectPoolTest, CreatesUntilExhaustedAndReusesReleasedSlots)
+{
+    static tools::object_pool<sensor_frame, 4U> pool;
+
+    std::vector<sensor_frame*> frames;
+    for (int i = 0; i < 4; ++i)
+    {
+        frames.push_back(pool.create(i, 0.5 * i));
+        ASSERT_NE(nullptr, frames.back());
+        EXPECT_TRUE(pool.owns(frames.back()));
+        EXPECT_EQ(i, frames.back()->id);
+    }
+
+    EXPECT_EQ(nullptr, pool.create(5, 0.0));
+    EXPECT_EQ(4U, pool.in_use());
+    EXPECT_EQ(4U, pool.capacity());
+
+    sensor_frame* released = frames[2];
+    pool.destroy(released);
+    EXPECT_EQ(3U, pool.in_use());
+
+    sensor_frame* reused = pool.create(7, 1.0);
+    EXPECT_EQ(released, reused);
+    EXPECT_EQ(7, reused->id);
+
+    sensor_frame outside(0, 0.0);
+    EXPECT_FALSE(pool.owns(&outside));
+
+    for (std::size_t i = 0U; i < frames.size(); ++i)
+    {
+        pool.destroy((i == 2U) ? reused : frames[i]);
+    }
+
+    EXPECT_EQ(0U, pool.in_use());
+    EXPECT_EQ(4U, pool.high_water_mark());
+}
+
+/**
+ * @brief Test that pooled_ptr handles return their object to the pool.
+ */
+TEST(ObjectPoolTest, PooledPtrReturnsObjectToPool)
+{
+    tools::object_pool<sensor_frame, 2U> pool;
+
+    {
+        tools::pooled_ptr<sensor_frame> first = pool.make_unique(1, 1.5);
+        tools::pooled_ptr<sensor_frame> second = pool.make_unique(2, 2.5);
+        ASSERT_TRUE(first);
+        ASSERT_TRUE(second);
+        EXPECT_DOUBLE_EQ(2.5, second->value);
+
+        EXPECT_FALSE(pool.make_unique(3, 3.5));
+
+        tools::pooled_ptr<sensor_frame> moved = std::move(first);
+        EXPECT_EQ(2U, pool.in_use());
+
+        second.reset();
+        EXPECT_EQ(1U, pool.in_use());
+    }
+
+    EXPECT_EQ(0U, pool.in_use());
+}
+
+/**
+ * @brief Test that a throwing constructor gives its slot back.
+ */
+TEST(ObjectPoolTest, ThrowingConstructorReleasesSlot)
+{
+    tools::object_pool<throwing_frame, 1U> pool;
+    tools::shared_object_pool<throwing_frame, 1U> shared_pool;
+
+    EXPECT_THROW(static_cast<void>(pool.create(true)), std::runtime_error);
+    EXPECT_EQ(0U, pool.in_use());
+    EXPECT_TRUE(pool.make_unique(false));
+
+    EXPECT_THROW(static_cast<void>(shared_pool.make_shared(true)), std::runtime_error);
+    EXPECT_EQ(0U, shared_pool.in_use());
+    EXPECT_TRUE(shared_pool.make_shared(false));
+}
+
+/**
+ * @brief Test that shared handles keep their slot until the last copy goes away.
+ */
+TEST(ObjectPoolTest, SharedPoolReleasesSlotWithLastReference)
+{
+    tools::shared_object_pool<sensor_frame, 2U> pool;
+
+    std::shared_ptr<const sensor_frame> copy;
+    {
+        std::shared_ptr<sensor_frame> frame = pool.make_shared(3, 4.5);
+        ASSERT_TRUE(frame);
+        copy = frame;
+        EXPECT_EQ(2, copy.use_count());
+
+        auto other = pool.make_shared(4, 5.5);
+        EXPECT_FALSE(pool.make_shared(5, 6.5));
+        EXPECT_EQ(2U, pool.in_use());
+    }
+
+    EXPECT_EQ(1U, pool.in_use());
+    EXPECT_EQ(3, copy->id);
+
+    copy.reset();
+    EXPECT_EQ(0U, pool.in_use());
+}
+
+/**
+ * @brief Test concurrent acquisitions never hand the same slot to two threads.
+ */
+TEST(ObjectPoolTest, ConcurrentAcquireRelease)
+{
+    static tools::object_pool<std::atomic<int>, 16U> pool;
+
+    constexpr int thread_count = 4;
+    std::atomic<int> conflicts = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&conflicts, t]()
+            {
+                for (int i = 0; i < 20000; ++i)
+                {
+                    auto owner = pool.make_unique(t);
+                    if (!owner)
+                    {
+                        continue;
+                    }
+
+                    std::this_thread::yield();
+                    if (owner->load(std::memory_order_relaxed) != t)
+                    {
+                        conflicts.fetch_add(1);
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, conflicts.load());
+    EXPECT_EQ(0U, pool.in_use());
+    EXPECT_LE(pool.high_water_mark(), static_cast<std::size_t>(thread_count));
+}
+
+/**
+ * @brief Test that publish_pooled allocates the shared envelope from the pool, and from the heap once exhausted.
+ */
+TEST(ObjectPoolTest, SubjectPublishesEnvelopesFromPool)
+{
+    using subject_type = tools::sync_subject<std::string, int>;
+    using observer_type = tools::async_envelope_observer<std::string, int, tools::sync_queue>;
+
+    tools::shared_object_pool<subject_type::envelope_type, 2U> pool;
+    subject_type subject("PoolSubject");
+    auto observer = std::make_shared<observer_type>();
+    subject.subscribe("frames", observer);
+
+    subject.publish_pooled(pool, "frames", 1);
+    subject.publish_pooled(pool, "frames", 2);
+    EXPECT_EQ(2U, pool.in_use());
+
+    subject.publish_pooled(pool, "frames", 3); // exhausted: heap envelope
+    EXPECT_EQ(2U, pool.in_use());
+
+    auto events = observer->pop_all_events();
+    ASSERT_EQ(3U, events.size());
+    EXPECT_EQ(1, events[0]->event);
+    EXPECT_EQ(3, events[2]->event);
+    EXPECT_EQ("PoolSubject", events[2]->origin);
+
+    events.clear();
+    EXPECT_EQ(0U, pool.in_use());
+}
+
+/**
+ * @brief Test pooled objects as data_task payloads: the trivially copyable pointer is queued, the task releases it.
+ */
+TEST(ObjectPoolTest, DataTaskProcessesPooledPayloads)
+{
+    static tools::object_pool<sensor_frame, 8U> pool;
+    std::atomic<int> sum = 0;
+    std::atomic<int> processed = 0;
+
+    auto startup = [](const std::shared_ptr<task_context>& context, const std::string& task_name)
+    {
+        (void)context;
+        (void)task_name;
+    };
+    auto process = [&sum, &processed](const std::shared_ptr<task_context>& context, sensor_frame* const& frame,
+                       const std::string& task_name)
+    {
+        (void)context;
+        (void)task_name;
+        sum.fetch_add(frame->id);
+        pool.destroy(frame);
+        processed.fetch_add(1);
+    };
+
+    {
+        tools::data_task<task_context, sensor_frame*> task(
+            startup, process, std::make_shared<task_context>(), 8U, "PoolTask", 2048U);
+
+        for (int i = 1; i <= 4; ++i)
+        {
+            ASSERT_TRUE(task.submit(pool.create(i, 0.0)));
+        }
+
+        for (int retry = 0; (retry < 200) && (processed.load() < 4); ++retry)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    EXPECT_EQ(10, sum.load());
+    EXPECT_EQ(0U, pool.in_use());
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_origin_registry.cpp
+ * @brief Unit tests for origin_registry and interned origins on the publish/subscribe path.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "tools/async_observer.hpp"
+#include "tools/origin_registry.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+
+TEST(OriginRegistryTest, InternReturnsStableDenseIds)
+{
+    tools::origin_registry registry;
+
+    const auto first = registry.intern("sensor_hub");
+    const auto second = registry.intern("command_hub");
+    const auto again = registry.intern("sensor_hub");
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(static_cast<std::uint16_t>(*first), 0U);
+    EXPECT_EQ(static_cast<std::uint16_t>(*second), 1U);
+    EXPECT_EQ(*again, *first);
+    EXPECT_EQ(registry.size(), 2U);
+}
+
+TEST(OriginRegistryTest, NameOfResolvesInternedIds)
+{
+    tools::origin_registry registry;
+    const auto origin = registry.intern("sensor_hub");
+    ASSERT_TRUE(origin.has_value());
+
+    const auto name = registry.name_of(*origin);
+    ASSERT_TRUE(name.has_value());
+    EXPECT_EQ(*name, "sensor_hub");
+}
+
+TEST(OriginRegistryTest, NameOfUnknownIdFails)
+{
+    tools::origin_registry registry;
+    (void)registry.intern("sensor_hub");
+
+    const auto name = registry.name_of(static_cast<tools::origin_id>(42U));
+    ASSERT_FALSE(name.has_value());
+    EXPECT_EQ(name.error(), tools::origin_registry_error::unknown_id);
+}
+
+TEST(OriginRegistryTest, InternFailsWhenIdSpaceIsExhausted)
+{
+    constexpr std::size_t max_origins = 65536U;
+    tools::origin_registry registry;
+
+    for (std::size_t index = 0U; index < max_origins; ++index)
+    {
+        ASSERT_TRUE(registry.intern(std::to_string(index)).has_value());
+    }
+
+    const auto overflow = registry.intern("one_too_many");
+    ASSERT_FALSE(overflow.has_value());
+    EXPECT_EQ(overflow.error(), tools::origin_registry_error::capacity_exhausted);
+
+    const auto existing = registry.intern("0");
+    ASSERT_TRUE(existing.has_value());
+    EXPECT_EQ(static_cast<std::uint16_t>(*existing), 0U);
+}
+
+namespace
+{
+    class interned_test_observer : public tools::sync_observer<std::string, int, tools::origin_id>
+    {
+    public:
+        void inform(const std::string& topic, const int& event, const tools::origin_id& origin) override
+        {
+            last_topic = topic;
+            last_event = event;
+            last_origin = origin;
+        }
+
+        std::string last_topic;
+        int last_event = 0;
+        tools::origin_id last_origin {};
+    };
+}
+
+TEST(OriginRegistryTest, SubjectPublishesInternedOrigin)
+{
+    tools::origin_registry registry;
+    const auto origin = registry.intern("interned_subject");
+    ASSERT_TRUE(origin.has_value());
+
+    tools::sync_subject<std::string, int, tools::origin_id> subject("interned_subject", *origin);
+    auto observer = std::make_shared<interned_test_observer>();
+    tools::origin_id handler_origin {};
+
+    subject.subscribe("topic", observer);
+    subject.subscribe("topic", "handler",
+        [&](const std::string&, const int&, const tools::origin_id& from) { handler_origin = from; });
+
+    subject.publish("topic", 7);
+
+    EXPECT_EQ(subject.name(), "interned_subject");
+    EXPECT_EQ(subject.origin(), *origin);
+    EXPECT_EQ(observer->last_event, 7);
+    EXPECT_EQ(observer->last_origin, *origin);
+    EXPECT_EQ(handler_origin, *origin);
+
+    const auto resolved = registry.name_of(observer->last_origin);
+    ASSERT_TRUE(resolved.has_value());
+    EXPECT_EQ(*resolved, "interned_subject");
+}
+
+TEST(OriginRegistryTest, AsyncObserversQueueInternedOrigin)
+{
+    tools::origin_registry registry;
+    const auto origin = registry.intern("interned_subject");
+    ASSERT_TRUE(origin.has_value());
+
+    tools::sync_subject<std::string, int, tools::origin_id> subject("interned_subject", *origin);
+    auto tuple_observer
+        = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue, tools::origin_id>>();
+    auto envelope_observer
+        = std::make_shared<tools::async_envelope_observer<std::string, int, tools::sync_queue, tools::origin_id>>();
+
+    subject.subscribe("topic", tuple_observer);
+    subject.subscribe("topic", envelope_observer);
+    subject.publish_shared("topic", 11);
+
+    auto tuple_event = tuple_observer->pop_first_event();
+    ASSERT_TRUE(tuple_event.has_value());
+    EXPECT_EQ(std::get<1>(*tuple_event), 11);
+    EXPECT_EQ(std::get<2>(*tuple_event), *origin);
+
+    auto envelope = envelope_observer->pop_first_event();
+    ASSERT_TRUE(envelope.has_value());
+    EXPECT_EQ((*envelope)->event, 11);
+    EXPECT_EQ((*envelope)->origin, *origin);
+}
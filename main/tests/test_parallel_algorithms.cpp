@@ -0,0 +1,181 @@
+/**
+ * @file test_parallel_algorithms.cpp
+ * @brief Unit tests for the fork-join parallel algorithms using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "portable_concurrency/thread_pool.hpp"
+#include "tools/parallel_algorithms.hpp"
+#include "tools/worker_pool.hpp"
+
+namespace
+{
+    struct pool_context
+    {
+    };
+
+    using test_pool = tools::worker_pool<pool_context>;
+
+    void no_startup(const std::shared_ptr<pool_context>&, const std::string&)
+    {
+    }
+
+    constexpr tools::parallel_params small_grain_params { 4U, 64U, 4U };
+}
+
+/**
+ * @brief parallel_for, parallel_transform and parallel_reduce on a pco::static_thread_pool match the sequential result.
+ */
+TEST(ParallelAlgorithmsTest, ForTransformReduceOnStaticThreadPool)
+{
+    pco::static_thread_pool pool { 3 };
+    auto exec = pool.executor();
+
+    std::vector<std::uint32_t> values(100000U);
+    std::iota(values.begin(), values.end(), 0U);
+
+    tools::parallel_for(
+        exec, values.begin(), values.end(), [](std::uint32_t& value) { value *= 2U; }, small_grain_params);
+    for (std::size_t index = 0U; index < values.size(); ++index)
+    {
+        ASSERT_EQ(index * 2U, values[index]);
+    }
+
+    std::vector<std::uint64_t> squares(values.size());
+    tools::parallel_transform(exec, values.cbegin(), values.cend(), squares.begin(),
+        [](std::uint32_t value) { return std::uint64_t { value } * value; }, small_grain_params);
+    EXPECT_EQ(std::uint64_t { 199998U } * 199998U, squares.back());
+
+    const std::uint64_t sum = tools::parallel_reduce(exec, squares.cbegin(), squares.cend(), std::uint64_t { 0U },
+        std::plus<>(), small_grain_params);
+    EXPECT_EQ(std::accumulate(squares.cbegin(), squares.cend(), std::uint64_t { 0U }), sum);
+
+    // a non-commutative operation: partial results are folded in order
+    std::vector<std::string> words(500U);
+    for (std::size_t index = 0U; index < words.size(); ++index)
+    {
+        words[index] = std::to_string(index % 10U);
+    }
+    const std::string joined = tools::parallel_reduce(
+        exec, words.cbegin(), words.cend(), std::string(">"), std::plus<>(), tools::parallel_params { 4U, 16U, 4U });
+    EXPECT_EQ(std::accumulate(words.cbegin(), words.cend(), std::string(">")), joined);
+
+    EXPECT_EQ(
+        7U, tools::parallel_reduce(exec, squares.cbegin(), squares.cbegin(), std::uint64_t { 7U }, std::plus<>()));
+
+    pool.stop();
+    pool.wait();
+}
+
+/**
+ * @brief parallel_sort on a worker_pool sorts like std::sort, also with a comparator and a single chunk.
+ */
+TEST(ParallelAlgorithmsTest, SortOnWorkerPool)
+{
+    auto pool = std::make_unique<test_pool>(no_startup, std::make_shared<pool_context>(), "sort", 4096U, 3U);
+
+    std::mt19937 generator(21U); // NOLINT fixed seed
+    std::uniform_int_distribution<int> distribution(-100000, 100000);
+    std::vector<int> values(50001U);
+    for (auto& value : values)
+    {
+        value = distribution(generator);
+    }
+
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    tools::parallel_sort(pool->as_executor(), values.begin(), values.end(), std::less<>(), small_grain_params);
+    EXPECT_EQ(expected, values);
+
+    tools::parallel_sort(pool->as_executor(), values.begin(), values.end(), std::greater<>(), small_grain_params);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+
+    std::vector<int> few = { 3, 1, 2 };
+    tools::parallel_sort(pool->as_executor(), few.begin(), few.end());
+    EXPECT_EQ((std::vector<int> { 1, 2, 3 }), few);
+}
+
+/**
+ * @brief A chunk exception reaches the caller after every chunk finished; helpers starting late find no work.
+ */
+TEST(ParallelAlgorithmsTest, PropagatesExceptionsAndSurvivesLateHelpers)
+{
+    pco::static_thread_pool pool { 2 };
+    std::vector<int> values(4096U, 1);
+
+#if defined(CPP_EXCEPTIONS_ENABLED)
+    const int* failing = &values[2000];
+    EXPECT_THROW(tools::parallel_for(
+                     pool.executor(), values.begin(), values.end(),
+                     [failing](int& value)
+                     {
+                         if (&value == failing)
+                         {
+                             throw std::runtime_error("chunk failed");
+                         }
+                     },
+                     small_grain_params),
+        std::runtime_error);
+#endif
+
+    // many back to back calls: helpers of a finished call may run after it returned
+    for (int round = 0; round < 200; ++round)
+    {
+        const int total = tools::parallel_reduce(
+            pool.executor(), values.cbegin(), values.cend(), 0, std::plus<>(), tools::parallel_params { 8U, 16U, 1U });
+        ASSERT_EQ(4096, total);
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    std::span<int> view(values);
+    tools::parallel_for(pool.executor(), view, [](int& value) { value = 3; }, small_grain_params);
+    EXPECT_EQ(3 * 4096, tools::parallel_reduce(pool.executor(), view, 0, std::plus<>(), small_grain_params));
+    tools::parallel_sort(pool.executor(), view);
+#endif
+
+    pool.stop();
+    pool.wait();
+}
@@ -43,6 +43,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <thread>
@@ -217,6 +218,105 @@ TEST_F(PeriodicTaskTest, ContextValueAfterShortRun)
     TEST_COUT << "Test passed. Context value: " << context->get_value() << '\n';
 }
 
+/**
+ * @brief Test that the wakeup lateness and execution time are recorded for each iteration.
+ */
+TEST_F(PeriodicTaskTest, RecordsWakeupLatenessAndExecutionTime)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(350));
+
+    const auto stats = task->stats();
+    ASSERT_GT(stats.wakeup_lateness.count, 0U);
+    ASSERT_GT(stats.execution_time.count, 0U);
+    ASSERT_LE(stats.wakeup_lateness.min, stats.wakeup_lateness.max);
+    ASSERT_LE(stats.execution_time.mean(), static_cast<double>(stats.execution_time.max));
+    ASSERT_EQ(0U, stats.overruns);
+    TEST_COUT << "max lateness: " << stats.wakeup_lateness.max << " us, mean execution: "
+              << stats.execution_time.mean() << " us" << '\n';
+
+    task->reset_stats();
+    ASSERT_EQ(0U, task->stats().execution_time.count);
+}
+
+/**
+ * @brief Test that the wakeup calibrator widens its guard on oversleep outliers and learns the lateness bias.
+ */
+TEST(PeriodicWakeupTest, CalibratorFollowsOversleepAndLateness)
+{
+    tools::wakeup_calibrator calibrator(200);
+    EXPECT_EQ(200, calibrator.guard(1000));
+    EXPECT_EQ(100, calibrator.guard(100));
+
+    for (int sample = 0; sample < 64; ++sample)
+    {
+        calibrator.record_oversleep(50);
+    }
+    const auto steady_guard = calibrator.guard(1000);
+    EXPECT_GE(steady_guard, 50);
+    EXPECT_LE(steady_guard, 60);
+
+    calibrator.record_oversleep(400);
+    EXPECT_GT(calibrator.guard(1000), steady_guard + 300);
+    EXPECT_EQ(0, calibrator.lateness_bias());
+
+    for (int sample = 0; sample < 64; ++sample)
+    {
+        calibrator.record_lateness(8);
+    }
+    EXPECT_GE(calibrator.lateness_bias(), 7);
+    EXPECT_LE(calibrator.lateness_bias(), 8);
+}
+
+/**
+ * @brief Test that the hybrid wakeup calibrates its spin guard and keeps the task on time.
+ */
+TEST(PeriodicWakeupTest, HybridWakeupCalibratesItsGuard)
+{
+    auto context = std::make_shared<TestContext>();
+    tools::periodic_task<TestContext> task(startup_routine, periodic_routine, context, std::string("HybridTask"),
+        std::chrono::duration<std::uint64_t, std::micro>(1000U), 2048U);
+
+    tools::periodic_precision precision;
+    precision.hybrid_wakeup = true;
+    precision.compensate_lateness = true;
+    precision.max_spin = std::chrono::duration<std::uint64_t, std::micro>(500U);
+    task.set_precision(precision);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    task.reset_stats();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    const auto stats = task.stats();
+    EXPECT_GT(stats.wakeup_lateness.count, 100U);
+    EXPECT_GT(task.spin_guard().count(), 0U);
+    EXPECT_LE(task.spin_guard().count(), 500U);
+    TEST_COUT << "spin guard: " << task.spin_guard().count() << " us, mean lateness: " << stats.wakeup_lateness.mean()
+              << " us, max lateness: " << stats.wakeup_lateness.max << " us" << '\n';
+}
+
+/**
+ * @brief Test that a routine longer than the period is reported as overruns with skipped periods.
+ */
+TEST(PeriodicTaskStatsTest, SlowRoutineCountsOverruns)
+{
+    auto context = std::make_shared<TestContext>();
+    tools::periodic_task<TestContext> task(
+        startup_routine,
+        [](const std::shared_ptr<TestContext>& ctx, const std::string& /*name*/)
+        {
+            ctx->inc_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        },
+        context, std::string("SlowTask"), std::chrono::duration<std::uint64_t, std::micro>(10000U), 2048U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    const auto stats = task.stats();
+    ASSERT_GT(stats.overruns, 0U);
+    ASSERT_GE(stats.skipped_periods, stats.overruns);
+    ASSERT_GE(stats.execution_time.min, 25000U);
+}
+
 TEST(PeriodicTaskForwardingTest, ConstructorSupportsLvalueRvalueAndConversion)
 {
     auto context = std::make_shared<TestContext>();
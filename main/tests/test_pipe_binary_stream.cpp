@@ -0,0 +1,264 @@
+/**
+ * @file test_pipe_binary_stream.cpp
+ * @brief Unit tests for the binary_stream adapters over memory_pipe windows.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "tools/memory_pipe.hpp"
+#include "tools/pipe_binary_stream.hpp"
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+namespace
+{
+    constexpr std::chrono::duration<std::uint64_t, std::milli> long_timeout(2000U);
+
+    /**
+     * @brief Fixed-size frame payload: 4 + 2 + 8 bytes.
+     */
+    struct sample
+    {
+        std::uint32_t sequence = 0U;
+        std::int16_t value = 0;
+        std::array<std::uint8_t, 8U> tag = {};
+    };
+
+    template <typename Stream>
+    bool write_sample(Stream& stream, const sample& item)
+    {
+        return stream.write(item.sequence, item.value, item.tag);
+    }
+
+    template <typename Stream>
+    bool read_sample(Stream& stream, sample& item)
+    {
+        return stream.read(item.sequence, item.value, item.tag);
+    }
+
+    sample make_sample(std::uint32_t sequence)
+    {
+        sample item;
+        item.sequence = sequence;
+        item.value = static_cast<std::int16_t>(-static_cast<int>(sequence));
+        item.tag.fill(static_cast<std::uint8_t>(sequence & 0xffU));
+        return item;
+    }
+}
+
+/**
+ * @brief Test that a frame serialized in the pipe window is read back in place.
+ */
+TEST(PipeBinaryStreamTest, RoundTripInPlace)
+{
+    tools::memory_pipe pipe(256U);
+    tools::pipe_stream_writer<> writer(pipe, 64U, long_timeout);
+    tools::pipe_stream_reader<> reader(pipe, 64U);
+
+    EXPECT_EQ(nullptr, reader.next_frame());
+
+    auto& out = writer.begin_frame();
+    ASSERT_TRUE(out.write(std::uint32_t { 0x01020304U }, std::string("hello")));
+    EXPECT_EQ(writer.commit_frame(), 4U + 4U + 5U);
+
+    auto* in = reader.next_frame();
+    ASSERT_NE(nullptr, in);
+    std::uint32_t number = 0U;
+    std::string text;
+    ASSERT_TRUE(in->read(number, text));
+    EXPECT_EQ(0x01020304U, number);
+    EXPECT_EQ("hello", text);
+
+    EXPECT_EQ(nullptr, reader.next_frame());
+    EXPECT_EQ(1U, writer.stats().frames_in_place);
+    EXPECT_EQ(0U, writer.stats().frames_staged);
+    EXPECT_EQ(1U, reader.stats().frames_in_place);
+    EXPECT_EQ(0U, reader.stats().frames_staged);
+}
+
+/**
+ * @brief Test that frames meeting the wrap-around point go through the staging buffers unchanged.
+ */
+TEST(PipeBinaryStreamTest, WrapAroundUsesStaging)
+{
+    tools::memory_pipe pipe(64U);
+    tools::pipe_stream_writer<std::endian::little> writer(pipe, 24U, long_timeout);
+    tools::pipe_stream_reader<std::endian::little> reader(pipe, 24U);
+
+    for (std::uint32_t sequence = 0U; sequence < 20U; ++sequence)
+    {
+        auto& out = writer.begin_frame();
+        ASSERT_TRUE(write_sample(out, make_sample(sequence)));
+        ASSERT_EQ(14U, writer.commit_frame());
+
+        auto* in = reader.next_frame();
+        ASSERT_NE(nullptr, in);
+        sample item;
+        ASSERT_TRUE(read_sample(*in, item));
+        const auto expected = make_sample(sequence);
+        EXPECT_EQ(expected.sequence, item.sequence);
+        EXPECT_EQ(expected.value, item.value);
+        EXPECT_EQ(expected.tag, item.tag);
+    }
+    reader.release_frame();
+
+    EXPECT_GT(writer.stats().frames_in_place, 0U);
+    EXPECT_GT(writer.stats().frames_staged, 0U);
+    EXPECT_GT(reader.stats().frames_in_place, 0U);
+    EXPECT_GT(reader.stats().frames_staged, 0U);
+    EXPECT_EQ(0U, writer.stats().frames_dropped);
+}
+
+/**
+ * @brief Test that a frame is only exposed once all of its bytes are in the pipe.
+ */
+TEST(PipeBinaryStreamTest, IncompleteFrameIsNotExposed)
+{
+    tools::memory_pipe pipe(128U);
+    tools::pipe_stream_reader<> reader(pipe, 32U);
+
+    const std::array<std::uint8_t, 6U> frame = { 2U, 0U, 0U, 0U, 0xabU, 0xcdU };
+    ASSERT_EQ(3U, pipe.send(frame.data(), 3U, long_timeout));
+    EXPECT_EQ(nullptr, reader.next_frame());
+    ASSERT_EQ(2U, pipe.send(frame.data() + 3U, 2U, long_timeout));
+    EXPECT_EQ(nullptr, reader.next_frame());
+    ASSERT_EQ(1U, pipe.send(frame.data() + 5U, 1U, long_timeout));
+
+    auto* in = reader.next_frame();
+    ASSERT_NE(nullptr, in);
+    std::uint16_t value = 0U;
+    ASSERT_TRUE(in->read(value));
+    EXPECT_EQ(0xabcdU, value);
+    EXPECT_FALSE(in->read(value));
+}
+
+/**
+ * @brief Test that a frame larger than the reader staging buffer is skipped.
+ */
+TEST(PipeBinaryStreamTest, OversizedFrameIsDropped)
+{
+    tools::memory_pipe pipe(128U);
+    tools::pipe_stream_writer<> writer(pipe, 32U, long_timeout);
+    tools::pipe_stream_reader<> reader(pipe, 4U);
+
+    ASSERT_TRUE(writer.begin_frame().write(std::uint64_t { 1U }));
+    ASSERT_EQ(8U, writer.commit_frame());
+    ASSERT_TRUE(writer.begin_frame().write(std::uint32_t { 7U }));
+    ASSERT_EQ(4U, writer.commit_frame());
+
+    EXPECT_EQ(nullptr, reader.next_frame());
+    EXPECT_EQ(1U, reader.stats().frames_dropped);
+
+    auto* in = reader.next_frame();
+    ASSERT_NE(nullptr, in);
+    std::uint32_t value = 0U;
+    ASSERT_TRUE(in->read(value));
+    EXPECT_EQ(7U, value);
+}
+
+/**
+ * @brief Test that an aborted frame never reaches the consumer.
+ */
+TEST(PipeBinaryStreamTest, AbortedFrameIsNotSent)
+{
+    tools::memory_pipe pipe(128U);
+    tools::pipe_stream_writer<> writer(pipe, 32U, long_timeout);
+    tools::pipe_stream_reader<> reader(pipe, 32U);
+
+    ASSERT_TRUE(writer.begin_frame().write(std::uint32_t { 1U }));
+    writer.abort_frame();
+    EXPECT_EQ(0U, writer.commit_frame());
+    EXPECT_EQ(nullptr, reader.next_frame());
+
+    ASSERT_TRUE(writer.begin_frame().write(std::uint32_t { 2U }));
+    ASSERT_TRUE(writer.begin_frame().write(std::uint32_t { 3U }));
+    ASSERT_EQ(4U, writer.commit_frame());
+
+    auto* in = reader.next_frame();
+    ASSERT_NE(nullptr, in);
+    std::uint32_t value = 0U;
+    ASSERT_TRUE(in->read(value));
+    EXPECT_EQ(3U, value);
+    EXPECT_EQ(nullptr, reader.next_frame());
+}
+
+/**
+ * @brief Test a producer thread streaming frames to a polling consumer thread.
+ */
+TEST(PipeBinaryStreamTest, ProducerConsumerThreads)
+{
+    constexpr std::uint32_t frame_count = 2000U;
+    tools::memory_pipe pipe(200U);
+    tools::pipe_stream_writer<> writer(pipe, 24U, long_timeout);
+    tools::pipe_stream_reader<> reader(pipe, 24U);
+
+    std::thread producer(
+        [&writer]()
+        {
+            for (std::uint32_t sequence = 0U; sequence < frame_count; ++sequence)
+            {
+                ASSERT_TRUE(write_sample(writer.begin_frame(), make_sample(sequence)));
+                ASSERT_EQ(14U, writer.commit_frame());
+            }
+        });
+
+    std::uint32_t expected = 0U;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((expected < frame_count) && (std::chrono::steady_clock::now() < deadline))
+    {
+        auto* in = reader.next_frame();
+        if (nullptr == in)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        sample item;
+        ASSERT_TRUE(read_sample(*in, item));
+        ASSERT_EQ(expected, item.sequence);
+        ASSERT_EQ(make_sample(expected).tag, item.tag);
+        ++expected;
+    }
+    reader.release_frame();
+    producer.join();
+
+    EXPECT_EQ(frame_count, expected);
+    EXPECT_EQ(0U, writer.stats().frames_dropped);
+}
+
+#endif // C++20
@@ -232,6 +232,17 @@ namespace
         co_return value * 3;
     }
 
+    pco::future_result<int> coroutine_delegate_await_job(
+        worker_result_task& worker, const std::shared_ptr<worker_result_context>& context, int value)
+    {
+        co_await worker.delegate_await([context](const std::shared_ptr<worker_result_context>&, const std::string&)
+            { context->loop_counter.fetch_add(1); });
+        const int doubled = co_await worker.delegate_await(
+            [value](const std::shared_ptr<worker_result_context>&, const std::string&) { return value * 2; },
+            tools::work_priority::high);
+        co_return doubled + 1;
+    }
+
     pco::future_result<int> coroutine_await_future_job(worker_result_task& worker,
         const std::shared_ptr<worker_result_context>& context, pco::future_result<int> upstream)
     {
@@ -637,6 +648,17 @@ TEST(PortableConcurrencyWorkerTaskResultTest, CoroutineScheduleFlow)
     EXPECT_EQ(context->loop_counter.load(), 1);
 }
 
+TEST(PortableConcurrencyWorkerTaskResultTest, CoroutineDelegateAwaitReturnsTheWorkResult)
+{
+    auto context = std::make_shared<worker_result_context>();
+    auto worker = make_worker_result_task(context, "coro_delegate_await_test");
+
+    auto result = coroutine_delegate_await_job(*worker, context, 20).get_result();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 41);
+    EXPECT_EQ(context->loop_counter.load(), 1);
+}
+
 TEST(PortableConcurrencyWorkerTaskResultTest, CoroutineAwaitsFutureResult)
 {
     auto context = std::make_shared<worker_result_context>();
@@ -0,0 +1,200 @@
+/**
+ * @file test_rcu_sync_dictionary.cpp
+ * @brief Unit tests for the rcu_sync_dictionary class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tools/flat_hash_map.hpp"
+#include "tools/rcu_sync_dictionary.hpp"
+
+/**
+ * @brief Test the sync_dictionary-like interface on top of published versions.
+ */
+TEST(RcuSyncDictionaryTest, AddRemoveFindContains)
+{
+    tools::rcu_sync_dictionary<std::string, int> dictionary;
+    EXPECT_TRUE(dictionary.empty());
+
+    dictionary.add("one", 1);
+    dictionary.add(std::string("two"), 2);
+    dictionary.add("one", 11);
+
+    EXPECT_EQ(2U, dictionary.size());
+    EXPECT_EQ(11, dictionary.find("one").value_or(0));
+    EXPECT_TRUE(dictionary.contains("two"));
+    EXPECT_FALSE(dictionary.find("three").has_value());
+
+    dictionary.remove("two");
+    EXPECT_FALSE(dictionary.contains("two"));
+
+    dictionary.add_collection({ { "a", 1 }, { "b", 2 } });
+    dictionary.add_collection(std::vector<std::pair<std::string, int>>{ { "c", 3 } });
+    EXPECT_EQ(4U, dictionary.snapshot().size());
+
+    dictionary.remove_collection({ "a", "b" });
+    dictionary.remove_collection(std::vector<std::string>{ "c" });
+    EXPECT_EQ(1U, dictionary.size());
+
+    dictionary.clear();
+    EXPECT_TRUE(dictionary.empty());
+}
+
+/**
+ * @brief Test that a view keeps its version while writers publish, and that a batch publishes one version.
+ */
+TEST(RcuSyncDictionaryTest, ViewsAreImmutableAndBatchesPublishOnce)
+{
+    tools::rcu_sync_dictionary<int, int, std::unordered_map<int, int>> dictionary;
+    dictionary.add(1, 10);
+
+    const auto before = dictionary.get_view();
+    ASSERT_TRUE(before);
+    const std::uint64_t generation = before.generation();
+
+    dictionary.add_collection({ { 2, 20 }, { 3, 30 }, { 4, 40 } });
+    dictionary.update(
+        [](std::unordered_map<int, int>& content)
+        {
+            content.erase(1);
+            content[5] = 50;
+        });
+
+    EXPECT_EQ(1U, before->size());
+    EXPECT_EQ(10, before->at(1));
+
+    auto after = dictionary.get_view();
+    EXPECT_EQ(generation + 2U, after.generation());
+    EXPECT_EQ(4U, after->size());
+    EXPECT_EQ(0U, after->count(1));
+
+    const auto moved = std::move(after);
+    EXPECT_FALSE(after); // NOLINT use after move is the point
+    EXPECT_EQ(50, moved->at(5));
+}
+
+/**
+ * @brief Test that a retired version is reclaimed only once its last view is released.
+ */
+TEST(RcuSyncDictionaryTest, RetiredVersionsWaitForTheirViews)
+{
+    tools::rcu_sync_dictionary<int, std::string, tools::flat_hash_map<int, std::string>> dictionary;
+    dictionary.add(1, "one");
+
+    {
+        const auto pinned = dictionary.get_view();
+        dictionary.add(2, "two");
+        dictionary.add(3, "three");
+
+        // the version pinned above is still alive, the intermediate one was never pinned
+        EXPECT_EQ(1U, dictionary.reclaim());
+        EXPECT_EQ("one", pinned->find(1)->second);
+        EXPECT_FALSE(pinned->contains(2));
+    }
+
+    EXPECT_EQ(0U, dictionary.reclaim());
+    EXPECT_EQ(3U, dictionary.size());
+}
+
+/**
+ * @brief Test lock-free readers against a writer publishing consistent batches.
+ */
+TEST(RcuSyncDictionaryTest, ConcurrentReadersSeeWholeBatches)
+{
+    tools::rcu_sync_dictionary<int, int> dictionary;
+    constexpr int key_count = 16;
+
+    std::vector<std::pair<int, int>> batch;
+    for (int key = 0; key < key_count; ++key)
+    {
+        batch.emplace_back(key, 0);
+    }
+    dictionary.add_collection(batch);
+
+    std::atomic<bool> stop = false;
+    std::atomic<int> torn = 0;
+    std::atomic<int> reads = 0;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                while (!stop.load())
+                {
+                    const auto pinned = dictionary.get_view();
+                    const int expected = pinned->begin()->second;
+                    for (const auto& [key, value] : *pinned)
+                    {
+                        if (value != expected)
+                        {
+                            ++torn;
+                        }
+                    }
+                    ++reads;
+                }
+            });
+    }
+
+    for (int round = 1; round <= 300; ++round)
+    {
+        for (auto& entry : batch)
+        {
+            entry.second = round;
+        }
+        dictionary.add_collection(batch);
+    }
+
+    while (reads.load() < 1000)
+    {
+        std::this_thread::yield();
+    }
+
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, torn.load());
+    EXPECT_EQ(300, dictionary.find(0).value_or(0));
+    EXPECT_EQ(0U, dictionary.reclaim());
+}
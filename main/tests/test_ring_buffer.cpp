@@ -43,6 +43,8 @@
 
 #include <array>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -640,3 +642,165 @@ TEST(RingBufferPerfectForwardingTest, Cpp20RequiresConstraints)
     SUCCEED();
 }
 #endif
+
+namespace
+{
+    template <std::size_t Capacity>
+    void check_bulk_spans()
+    {
+        tools::ring_buffer<std::uint8_t, Capacity> ring;
+
+        // move the start near the end of the storage so that bulk operations wrap
+        const std::array<std::uint8_t, 3> warmup = { 0xEEU, 0xEEU, 0xEEU };
+        ASSERT_EQ(warmup.size(), ring.push_span(warmup.data(), warmup.size()));
+        EXPECT_EQ(warmup.size(), ring.consume(warmup.size()));
+        EXPECT_TRUE(ring.empty());
+
+        std::array<std::uint8_t, Capacity + 2U> source = {};
+        for (std::size_t i = 0U; i < source.size(); ++i)
+        {
+            source[i] = static_cast<std::uint8_t>(i + 1U);
+        }
+        ASSERT_EQ(Capacity, ring.push_span(source.data(), source.size()));
+        EXPECT_TRUE(ring.full());
+        EXPECT_EQ(0U, ring.push_span(source.data(), 1U));
+        EXPECT_EQ(static_cast<std::uint8_t>(Capacity), ring.back());
+
+        const auto spans = ring.peek_spans();
+        EXPECT_EQ(Capacity - warmup.size(), spans.first_size);
+        EXPECT_EQ(warmup.size(), spans.second_size);
+        for (std::size_t i = 0U; i < spans.first_size; ++i)
+        {
+            EXPECT_EQ(source[i], spans.first_data[i]);
+        }
+        for (std::size_t i = 0U; i < spans.second_size; ++i)
+        {
+            EXPECT_EQ(source[spans.first_size + i], spans.second_data[i]);
+        }
+
+        EXPECT_EQ(2U, ring.consume(2U));
+        std::array<std::uint8_t, Capacity> destination = {};
+        const std::size_t popped = ring.pop_span(destination.data(), destination.size());
+        ASSERT_EQ(Capacity - 2U, popped);
+        for (std::size_t i = 0U; i < popped; ++i)
+        {
+            EXPECT_EQ(source[i + 2U], destination[i]);
+        }
+        EXPECT_TRUE(ring.empty());
+        EXPECT_EQ(0U, ring.peek_spans().first_size);
+
+        // single pushes keep working from the index the bulk operations left
+        EXPECT_TRUE(ring.push(std::uint8_t { 42U }));
+        EXPECT_EQ(42U, ring.front());
+        EXPECT_EQ(42U, ring.back());
+    }
+}
+
+/**
+ * @brief Verifies push_span/pop_span/peek_spans/consume with power-of-two and other capacities.
+ */
+TEST(RingBufferSpanTest, BulkOperationsAcrossTheWrapPoint)
+{
+    check_bulk_spans<8U>();
+    check_bulk_spans<6U>();
+}
+
+/**
+ * @brief Verifies bulk operations copy and move non-trivially-copyable elements element-wise.
+ */
+TEST(RingBufferSpanTest, BulkOperationsOnStrings)
+{
+    tools::ring_buffer<std::string, 4> ring;
+    ring.push("old");
+    ring.pop();
+
+    const std::array<std::string, 4> source = { "a", "b", "c", "d" };
+    ASSERT_EQ(4U, ring.push_span(source.data(), source.size()));
+    EXPECT_EQ("a", source[0]);
+
+    std::array<std::string, 4> destination;
+    ASSERT_EQ(4U, ring.pop_span(destination.data(), destination.size()));
+    EXPECT_EQ("a", destination[0]);
+    EXPECT_EQ("d", destination[3]);
+}
+
+/**
+ * @brief Verifies copies and moves of wrapped rings, through the trivially copyable fast path and element-wise.
+ */
+TEST(RingBufferCopyTest, CopiesWrappedRings)
+{
+    tools::ring_buffer<std::uint16_t, 5> ring;
+    for (std::uint16_t value = 0U; value < 7U; ++value)
+    {
+        ring.push_overwrite(value);
+    }
+
+    tools::ring_buffer<std::uint16_t, 5> copy(ring);
+    tools::ring_buffer<std::uint16_t, 5> assigned;
+    assigned.push(99U);
+    assigned = ring;
+    tools::ring_buffer<std::uint16_t, 5> moved(std::move(copy));
+
+    for (auto* target : { &assigned, &moved })
+    {
+        ASSERT_EQ(5U, target->size());
+        EXPECT_EQ(6U, target->back());
+        for (std::uint16_t expected = 2U; expected < 7U; ++expected)
+        {
+            EXPECT_EQ(expected, target->front());
+            target->pop();
+        }
+    }
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    ring.push(42U);
+    EXPECT_EQ(42U, ring.front());
+    EXPECT_EQ(42U, ring.back());
+
+    tools::ring_buffer<std::string, 3> strings;
+    strings.push_overwrite("a");
+    strings.push_overwrite("b");
+    strings.push_overwrite("c");
+    strings.push_overwrite("d");
+    tools::ring_buffer<std::string, 3> string_copy;
+    string_copy = strings;
+    EXPECT_EQ("b", string_copy.front());
+    EXPECT_EQ("d", string_copy.back());
+    strings.clear();
+    EXPECT_EQ(3U, string_copy.size());
+}
+
+/**
+ * @brief Verifies front() and back() return T{} on empty copied, moved and cleared rings.
+ */
+TEST(RingBufferCopyTest, EmptyRingsReturnDefaultValues)
+{
+    tools::ring_buffer<std::uint16_t, 4> empty_ring;
+    tools::ring_buffer<std::uint16_t, 4> copy(empty_ring);
+    tools::ring_buffer<std::uint16_t, 4> moved(std::move(copy));
+    for (const auto* target : { &empty_ring, &moved })
+    {
+        EXPECT_TRUE(target->empty());
+        EXPECT_EQ(0U, target->front());
+        EXPECT_EQ(0U, target->back());
+    }
+
+    tools::ring_buffer<std::uint16_t, 4> ring;
+    ring.push(7U);
+    ring.push(9U);
+    ring.clear();
+    EXPECT_EQ(0U, ring.front());
+    EXPECT_EQ(0U, ring.back());
+
+    ring.push(11U);
+    ring.pop();
+    EXPECT_EQ(0U, ring.front());
+    EXPECT_EQ(0U, ring.back());
+
+    tools::ring_buffer<std::string, 2> strings;
+    strings.push("a");
+    strings.clear();
+    EXPECT_EQ("", strings.front());
+    EXPECT_EQ("", strings.back());
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_ring_queue.cpp
+ * @brief Unit tests for the preallocated ring_queue using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+
+#include "tools/ring_queue.hpp"
+
+namespace
+{
+    struct counted
+    {
+        explicit counted(int id, int& live)
+            : value(id)
+            , instances(&live)
+        {
+            ++*instances;
+        }
+
+        counted(const counted& other)
+            : value(other.value)
+            , instances(other.instances)
+        {
+            ++*instances;
+        }
+
+        counted& operator=(const counted&) = delete;
+
+        ~counted()
+        {
+            --*instances;
+        }
+
+        int value;
+        int* instances;
+    };
+}
+
+TEST(RingQueueTest, GrowsLikeStdQueue)
+{
+    std::mt19937 generator(7U);
+    std::uniform_int_distribution<int> actions(0, 9);
+
+    tools::ring_queue<std::string> queue;
+    std::queue<std::string> model;
+    for (int step = 0; step < 3000; ++step)
+    {
+        if (actions(generator) < 6)
+        {
+            queue.push(std::to_string(step));
+            model.push(std::to_string(step));
+        }
+        else if (!model.empty())
+        {
+            ASSERT_EQ(model.front(), queue.front());
+            queue.pop();
+            model.pop();
+        }
+
+        ASSERT_EQ(model.size(), queue.size());
+        if (!model.empty())
+        {
+            ASSERT_EQ(model.back(), queue.back());
+        }
+    }
+
+    EXPECT_EQ(0U, queue.dropped_count());
+    EXPECT_GE(queue.capacity(), queue.size());
+}
+
+TEST(RingQueueTest, RejectKeepsStorageAndCountsDrops)
+{
+    tools::ring_queue<int> queue(3U, tools::queue_full_policy::reject);
+    ASSERT_EQ(3U, queue.capacity());
+
+    for (int i = 0; i < 5; ++i)
+    {
+        queue.push(i);
+    }
+    EXPECT_TRUE(queue.full());
+    EXPECT_EQ(2U, queue.dropped_count());
+    EXPECT_FALSE(queue.push(5));
+
+    // wrap around the end of the ring
+    queue.pop();
+    queue.pop();
+    EXPECT_TRUE(queue.push(6));
+    EXPECT_TRUE(queue.emplace(7));
+    EXPECT_EQ(3U, queue.capacity());
+    EXPECT_EQ(2, queue.front());
+    EXPECT_EQ(7, queue.back());
+
+    const tools::ring_queue<int> copy(queue);
+    EXPECT_EQ(3U, copy.size());
+    EXPECT_EQ(2, copy.front());
+    EXPECT_EQ(tools::queue_full_policy::reject, copy.full_policy());
+}
+
+TEST(RingQueueTest, OverwriteOldestAndReserve)
+{
+    tools::ring_queue<std::unique_ptr<int>> queue(2U, tools::queue_full_policy::overwrite_oldest);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(queue.push(std::make_unique<int>(i)));
+    }
+    EXPECT_EQ(3U, queue.dropped_count());
+    EXPECT_EQ(3, *queue.front());
+    EXPECT_EQ(4, *queue.back());
+
+    // growing keeps the queued elements in order
+    queue.reserve(4U, tools::queue_full_policy::reject);
+    EXPECT_TRUE(queue.push(std::make_unique<int>(5)));
+    EXPECT_TRUE(queue.push(std::make_unique<int>(6)));
+    EXPECT_FALSE(queue.push(std::make_unique<int>(7)));
+    EXPECT_EQ(4U, queue.capacity());
+
+    tools::ring_queue<std::unique_ptr<int>> moved(std::move(queue));
+    for (int expected = 3; expected <= 6; ++expected)
+    {
+        ASSERT_FALSE(moved.empty());
+        EXPECT_EQ(expected, *moved.front());
+        moved.pop();
+    }
+    EXPECT_TRUE(moved.empty());
+}
+
+TEST(RingQueueTest, DestroysEveryElement)
+{
+    int live = 0;
+    {
+        tools::ring_queue<counted> queue(2U, tools::queue_full_policy::overwrite_oldest);
+        for (int i = 0; i < 4; ++i)
+        {
+            queue.emplace(i, live);
+        }
+        EXPECT_EQ(2, live);
+
+        tools::ring_queue<counted> copy(queue);
+        EXPECT_EQ(4, live);
+        copy.clear();
+        EXPECT_EQ(2, live);
+
+        copy = queue;
+        EXPECT_EQ(3, copy.back().value);
+        EXPECT_EQ(4, live);
+    }
+    EXPECT_EQ(0, live);
+}
@@ -239,6 +239,107 @@ TYPED_TEST(RingVectorTest, TestResize)
     EXPECT_EQ(this->rv->size(), 5);
 }
 
+/**
+ * @brief Checks in-place resize against a reference model for every wrap position, fill level and new capacity.
+ */
+TEST(RingVectorResizeTest, InPlaceResizeKeepsNewestElementsInOrder)
+{
+    constexpr std::size_t max_capacity = 7U;
+    for (std::size_t capacity = 1U; capacity <= max_capacity; ++capacity)
+    {
+        for (std::size_t offset = 0U; offset < capacity; ++offset)
+        {
+            for (std::size_t count = 0U; count <= capacity; ++count)
+            {
+                for (std::size_t new_capacity = 1U; new_capacity <= (max_capacity + 3U); ++new_capacity)
+                {
+                    tools::ring_vector<std::string> ring(capacity);
+                    // rotate the start position, then fill
+                    for (std::size_t n = 0U; n < offset; ++n)
+                    {
+                        ring.push("skip");
+                        (void)ring.pop();
+                    }
+
+                    std::vector<std::string> model;
+                    for (std::size_t n = 0U; n < count; ++n)
+                    {
+                        model.push_back("v" + std::to_string(n));
+                        ring.push(model.back());
+                    }
+
+                    ring.resize(new_capacity);
+                    if (model.size() > new_capacity)
+                    {
+                        model.erase(model.begin(), model.end() - static_cast<std::ptrdiff_t>(new_capacity));
+                    }
+
+                    ASSERT_EQ(new_capacity, ring.capacity());
+                    ASSERT_EQ(model.size(), ring.size()) << capacity << " " << offset << " " << count;
+                    for (std::size_t n = 0U; n < model.size(); ++n)
+                    {
+                        ASSERT_EQ(model[n], ring[n]) << capacity << " " << offset << " " << count << " " << n;
+                    }
+                    if (!model.empty())
+                    {
+                        ASSERT_EQ(model.back(), ring.back());
+                    }
+
+                    // the ring keeps working as a bounded FIFO after the resize
+                    ASSERT_EQ(model.size() < new_capacity, ring.push("tail"));
+                    if (model.size() < new_capacity)
+                    {
+                        model.push_back("tail");
+                    }
+                    for (const auto& expected : model)
+                    {
+                        auto popped = ring.pop_move();
+                        ASSERT_TRUE(popped.has_value());
+                        ASSERT_EQ(expected, popped.value());
+                    }
+                    ASSERT_TRUE(ring.empty());
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks that growing within reserved storage and shrinking never reallocate the storage.
+ */
+TEST(RingVectorResizeTest, ReservedGrowthDoesNotAllocate)
+{
+    tools::ring_vector<int> ring(4U);
+    ring.reserve(32U);
+    const std::size_t storage = ring.storage_capacity();
+    ASSERT_GE(storage, 32U);
+    EXPECT_EQ(4U, ring.capacity());
+
+    ring.push(0);
+    ring.push(1);
+    ring.pop();
+    ring.pop();
+    for (int n = 2; n < 6; ++n)
+    {
+        ring.push(n); // wraps: holds 2, 3, 4, 5
+    }
+
+    ring.resize(16U);
+    EXPECT_EQ(storage, ring.storage_capacity());
+    ASSERT_EQ(4U, ring.size());
+    EXPECT_EQ(2, ring[0]);
+    EXPECT_EQ(5, ring[3]);
+
+    ring.resize(3U);
+    EXPECT_EQ(storage, ring.storage_capacity());
+    ASSERT_EQ(3U, ring.size());
+    EXPECT_EQ(3, ring[0]);
+
+    ring.resize(32U);
+    EXPECT_EQ(storage, ring.storage_capacity());
+    EXPECT_EQ(5, ring.back());
+}
+
 TEST(RingVectorOverwriteApiTest, ScalarOverwriteReturnsEvictionAndKeepsBoundedHistory)
 {
     tools::ring_vector<int> vec(3);
@@ -486,3 +587,73 @@ TEST(RingVectorPerfectForwardingTest, Cpp20RequiresConstraints)
     SUCCEED();
 }
 #endif
+
+/**
+ * @brief Verifies push_span/pop_span/peek_spans/consume on a ring vector, before and after a resize.
+ */
+TEST(RingVectorSpanTest, BulkOperationsAcrossTheWrapPoint)
+{
+    tools::ring_vector<float> ring(5U);
+    ring.push(0.0F);
+    ring.push(0.0F);
+    ring.push(0.0F);
+    EXPECT_EQ(3U, ring.consume(3U));
+
+    const std::array<float, 7> source = { 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F };
+    ASSERT_EQ(5U, ring.push_span(source.data(), source.size()));
+    EXPECT_EQ(5.0F, ring.back());
+
+    auto spans = ring.peek_spans();
+    ASSERT_EQ(2U, spans.first_size);
+    ASSERT_EQ(3U, spans.second_size);
+    EXPECT_EQ(1.0F, spans.first_data[0]);
+    EXPECT_EQ(3.0F, spans.second_data[0]);
+
+    ring.resize(8U);
+    spans = ring.peek_spans();
+    EXPECT_EQ(5U, spans.first_size + spans.second_size);
+    ASSERT_EQ(2U, ring.push_span(source.data() + 5U, 2U));
+
+    std::vector<float> destination(10U);
+    ASSERT_EQ(7U, ring.pop_span(destination.data(), destination.size()));
+    EXPECT_EQ(1.0F, destination[0]);
+    EXPECT_EQ(7.0F, destination[6]);
+    EXPECT_EQ(0U, ring.pop_span(destination.data(), destination.size()));
+}
+
+/**
+ * @brief Verifies copy assignment of wrapped rings of the same and of different capacities, and clear.
+ */
+TEST(RingVectorCopyTest, CopyAssignsWrappedRings)
+{
+    tools::ring_vector<float> ring(4U);
+    for (int value = 0; value < 6; ++value)
+    {
+        ring.push_overwrite(static_cast<float>(value));
+    }
+
+    tools::ring_vector<float> same(4U);
+    same.push(99.0F);
+    same = ring;
+    tools::ring_vector<float> other(9U);
+    other = ring;
+
+    for (auto* target : { &same, &other })
+    {
+        ASSERT_EQ(4U, target->capacity());
+        ASSERT_EQ(4U, target->size());
+        EXPECT_FLOAT_EQ(5.0F, target->back());
+        for (int expected = 2; expected < 6; ++expected)
+        {
+            EXPECT_FLOAT_EQ(static_cast<float>(expected), target->front());
+            target->pop();
+        }
+    }
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(4U, ring.capacity());
+    ring.push(7.0F);
+    EXPECT_FLOAT_EQ(7.0F, ring.front());
+    EXPECT_FLOAT_EQ(7.0F, ring.back());
+}
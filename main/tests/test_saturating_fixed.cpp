@@ -0,0 +1,146 @@
+/**
+ * @file test_saturating_fixed.cpp
+ * @brief Unit tests for the saturating fixed-point wrapper and the reciprocal division.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "fpm/fixed.hpp"
+#include "tools/saturating_fixed.hpp"
+
+namespace
+{
+    using fixed = fpm::fixed_16_16;
+    using sat = tools::saturating_fixed<fixed>;
+
+    // the multiplier is computed at compile time
+    constexpr tools::fixed_reciprocal<fixed> by_four(fixed(4));
+    static_assert(fixed(2) / by_four == fixed(0.5));
+    static_assert((sat(fixed(30000)) + sat(fixed(30000))) == sat::highest());
+}
+
+/**
+ * @brief Results out of range stick to the bounds, results in range match fpm bit for bit.
+ *
+ * @test
+ * - Checks saturation of +, -, *, /, negation, division by zero and the integer and float conversions.
+ * - Compares the four operations with fpm on random operands whose results stay in range.
+ */
+TEST(SaturatingFixedTest, SaturatesAndMatchesFpmInRange)
+{
+    EXPECT_EQ(sat::highest(), sat(fixed(30000)) + sat(fixed(5000)));
+    EXPECT_EQ(sat::lowest(), sat(fixed(-30000)) - sat(fixed(5000)));
+    EXPECT_EQ(sat::highest(), sat(fixed(300)) * sat(fixed(300)));
+    EXPECT_EQ(sat::lowest(), sat(fixed(-300)) * sat(fixed(300)));
+    EXPECT_EQ(sat::highest(), sat(fixed(1000)) / sat(fixed(0.01)));
+    EXPECT_EQ(sat::highest(), -sat::lowest());
+    EXPECT_EQ(sat::lowest(), sat(fixed(-1)) / sat(fixed(0)));
+    EXPECT_EQ(sat(fixed(0)), sat(fixed(0)) / sat(fixed(0)));
+    EXPECT_EQ(sat::highest(), sat(100000));
+    EXPECT_EQ(sat::lowest(), sat(-100000));
+    EXPECT_EQ(sat::highest(), sat(std::numeric_limits<std::uint64_t>::max()));
+    EXPECT_EQ(sat::highest(), sat(1e9));
+    EXPECT_EQ(sat(fixed(12)), sat(12));
+    EXPECT_DOUBLE_EQ(-2.5, static_cast<double>(sat(-2.5)));
+
+    // plain fixed operands convert implicitly
+    sat accumulator(fixed(32000));
+    accumulator += fixed(1000);
+    EXPECT_EQ(sat::highest(), accumulator);
+
+    std::mt19937 generator(7U);
+    std::uniform_real_distribution<double> distribution(-150.0, 150.0);
+    for (int iteration = 0; iteration < 2000; ++iteration)
+    {
+        const fixed lhs(distribution(generator));
+        const fixed rhs(distribution(generator));
+        EXPECT_EQ(lhs + rhs, (sat(lhs) + sat(rhs)).value());
+        EXPECT_EQ(lhs - rhs, (sat(lhs) - sat(rhs)).value());
+        EXPECT_EQ(lhs * rhs, (sat(lhs) * sat(rhs)).value());
+        if (std::abs(static_cast<double>(rhs)) > 0.01)
+        {
+            EXPECT_EQ(lhs / rhs, (sat(lhs) / sat(rhs)).value());
+        }
+    }
+}
+
+/**
+ * @brief Division by a precomputed reciprocal stays within one unit in the last place of fpm division.
+ *
+ * @test
+ * - Divides random dividends by integer, fractional, negative and power-of-two divisors, including the extremes.
+ * - Checks that an overflowing quotient saturates, also through saturating_fixed.
+ */
+TEST(SaturatingFixedTest, ReciprocalMatchesDivision)
+{
+    std::mt19937 generator(11U);
+    std::uniform_int_distribution<std::int32_t> raw_values(
+        std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max());
+
+    for (const double divisor_value : { 3.0, 48.0, -7.0, 0.75, 1.0, 1024.0, -0.125, 12345.678, 32767.0 })
+    {
+        const fixed divisor(divisor_value);
+        const tools::fixed_reciprocal<fixed> reciprocal(divisor);
+        EXPECT_EQ(divisor, reciprocal.divisor());
+        for (int iteration = 0; iteration < 2000; ++iteration)
+        {
+            const fixed dividend = fixed::from_raw_value(raw_values(generator));
+            const double exact = static_cast<double>(dividend) / static_cast<double>(divisor);
+            if (std::abs(exact) >= 32767.0)
+            {
+                continue;
+            }
+            const std::int64_t expected = (dividend / divisor).raw_value();
+            const std::int64_t actual = (dividend / reciprocal).raw_value();
+            EXPECT_LE(std::abs(expected - actual), 1) << static_cast<double>(dividend) << " / " << divisor_value;
+        }
+
+        // the lowest dividend has the largest magnitude
+        const fixed lowest = sat::lowest().value();
+        const double exact = -32768.0 / static_cast<double>(divisor);
+        const fixed expected = (exact >= 32767.0) ? sat::highest().value()
+            : ((exact <= -32768.0) ? lowest : fixed(exact));
+        EXPECT_LE(std::abs(static_cast<std::int64_t>(expected.raw_value()) - (lowest / reciprocal).raw_value()), 1);
+    }
+
+    const tools::fixed_reciprocal<fixed> by_tenth(fixed(0.1));
+    EXPECT_EQ(sat::highest().value(), fixed(10000) / by_tenth);
+    EXPECT_EQ(sat::lowest(), sat(fixed(-10000)) / by_tenth);
+    EXPECT_EQ(fixed(-5) / fixed(0.1), fixed(-5) / by_tenth);
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test_seqlock.cpp
+ * @brief Unit tests for the seqlock and triple buffer latest-value cells using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "tools/seqlock.hpp"
+
+namespace
+{
+    struct sensor_state
+    {
+        std::uint32_t sequence;
+        std::int16_t x;
+        std::int16_t y;
+        std::uint64_t checksum;
+    };
+
+    sensor_state make_state(std::uint32_t sequence)
+    {
+        const auto x = static_cast<std::int16_t>(sequence * 3U);
+        const auto y = static_cast<std::int16_t>(sequence * 7U);
+        return { sequence, x, y, std::uint64_t { sequence } * 31U + static_cast<std::uint16_t>(x) };
+    }
+
+    bool is_consistent(const sensor_state& state)
+    {
+        const sensor_state expected = make_state(state.sequence);
+        return (expected.x == state.x) && (expected.y == state.y) && (expected.checksum == state.checksum);
+    }
+}
+
+/**
+ * @brief Single-threaded store/load/try_load/isr variants and the version counter.
+ */
+TEST(SeqlockTest, StoreAndLoad)
+{
+    tools::seqlock<sensor_state> cell(make_state(1U));
+    EXPECT_EQ(0U, cell.version());
+    EXPECT_EQ(1U, cell.load().sequence);
+
+    cell.store(make_state(2U));
+    EXPECT_EQ(1U, cell.version());
+
+    sensor_state state {};
+    ASSERT_TRUE(cell.try_load(state));
+    EXPECT_EQ(2U, state.sequence);
+
+    cell.isr_store(make_state(3U));
+    ASSERT_TRUE(cell.isr_load(state));
+    EXPECT_EQ(3U, state.sequence);
+    EXPECT_TRUE(is_consistent(state));
+    EXPECT_EQ(2U, cell.version());
+
+    tools::seqlock<std::uint8_t> small_cell;
+    EXPECT_EQ(0U, small_cell.load());
+    small_cell.store(42U);
+    EXPECT_EQ(42U, small_cell.load());
+}
+
+/**
+ * @brief Readers racing a writer never observe a torn value and see the sequence move forward.
+ */
+TEST(SeqlockTest, ReadersNeverSeeTornValues)
+{
+    tools::seqlock<sensor_state> cell(make_state(0U));
+    std::atomic<bool> done { false };
+    constexpr std::uint32_t store_count = 200000U;
+
+    std::vector<std::thread> readers;
+    std::array<std::atomic<bool>, 3> consistent = { true, true, true };
+    for (std::size_t reader = 0U; reader < consistent.size(); ++reader)
+    {
+        readers.emplace_back(
+            [&cell, &done, &consistent, reader]()
+            {
+                std::uint32_t last = 0U;
+                while (!done.load(std::memory_order_acquire))
+                {
+                    const sensor_state state = cell.load();
+                    if (!is_consistent(state) || (state.sequence < last))
+                    {
+                        consistent[reader] = false;
+                    }
+                    last = state.sequence;
+                }
+            });
+    }
+
+    for (std::uint32_t sequence = 1U; sequence <= store_count; ++sequence)
+    {
+        cell.store(make_state(sequence));
+    }
+    done.store(true, std::memory_order_release);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    for (const auto& flag : consistent)
+    {
+        EXPECT_TRUE(flag.load());
+    }
+    EXPECT_EQ(store_count, cell.load().sequence);
+}
+
+/**
+ * @brief The reader gets the newest published buffer, keeps its buffer when nothing new came, and never a torn one.
+ */
+TEST(TripleBufferTest, ReaderGetsNewestValue)
+{
+    auto exchange = std::make_unique<tools::triple_buffer<std::array<std::uint32_t, 64>>>();
+
+    EXPECT_FALSE(exchange->has_new_value());
+    EXPECT_EQ(0U, exchange->read()[0]);
+
+    exchange->write_buffer().fill(1U);
+    exchange->publish();
+    exchange->write_buffer().fill(2U);
+    exchange->publish();
+    EXPECT_TRUE(exchange->has_new_value());
+    EXPECT_EQ(2U, exchange->read()[63]);
+    EXPECT_FALSE(exchange->has_new_value());
+    EXPECT_EQ(2U, exchange->read()[0]);
+
+    std::atomic<bool> done { false };
+    bool consistent = true;
+    std::thread reader(
+        [&exchange, &done, &consistent]()
+        {
+            std::uint32_t last = 0U;
+            while (!done.load(std::memory_order_acquire))
+            {
+                const auto& value = exchange->read();
+                for (const auto element : value)
+                {
+                    consistent = consistent && (element == value[0]);
+                }
+                consistent = consistent && (value[0] >= last);
+                last = value[0];
+            }
+        });
+
+    std::array<std::uint32_t, 64> value {};
+    for (std::uint32_t sequence = 3U; sequence < 100000U; ++sequence)
+    {
+        value.fill(sequence);
+        exchange->isr_store(value);
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(99999U, exchange->read()[0]);
+}
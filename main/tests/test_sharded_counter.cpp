@@ -0,0 +1,102 @@
+/**
+ * @file test_sharded_counter.cpp
+ * @brief Unit tests for the sharded relaxed counter.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "tools/sharded_counter.hpp"
+
+/**
+ * @brief Concurrent adds from several threads all land in the sum.
+ *
+ * @test
+ * - Four threads add 100000 ones and one thread adds 5 per call; checks the exact total once they are joined.
+ * - Checks that each slot fills its own cache line.
+ */
+TEST(ShardedCounterTest, SumsConcurrentAdds)
+{
+    tools::sharded_counter<> counter;
+    static_assert(sizeof(counter) == (tools::sharded_counter<>::shard_count() * 64U));
+
+    constexpr std::size_t adds = 100000U;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back(
+            [&counter]()
+            {
+                for (std::size_t index = 0U; index < adds; ++index)
+                {
+                    ++counter;
+                }
+            });
+    }
+    threads.emplace_back(
+        [&counter]()
+        {
+            for (std::size_t index = 0U; index < adds; ++index)
+            {
+                counter.isr_add(5U);
+            }
+        });
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ((4U * adds) + (5U * adds), counter.value());
+}
+
+/**
+ * @brief exchange() hands over the count and restarts from zero; reset() clears it.
+ */
+TEST(ShardedCounterTest, ExchangesAndResets)
+{
+    tools::sharded_counter<std::uint32_t, 2U> counter;
+    counter.add(7U);
+    counter.add();
+    EXPECT_EQ(8U, counter.value());
+    EXPECT_EQ(8U, counter.exchange());
+    EXPECT_EQ(0U, counter.value());
+
+    counter.add(3U);
+    counter.reset();
+    EXPECT_EQ(0U, counter.exchange());
+}
@@ -0,0 +1,188 @@
+/**
+ * @file test_sharded_sync_dictionary.cpp
+ * @brief Unit tests for the sharded_sync_dictionary class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tools/flat_hash_map.hpp"
+#include "tools/sharded_sync_dictionary.hpp"
+
+/**
+ * @brief Test fixture running the same cases over the supported shard containers.
+ */
+template <typename TDictionary>
+class ShardedSyncDictionaryTest : public ::testing::Test
+{
+protected:
+    tools::sharded_sync_dictionary<int, std::string, TDictionary, 4U> dictionary;
+};
+
+using ShardContainers = ::testing::Types<std::unordered_map<int, std::string>,
+    tools::flat_hash_map<int, std::string>, std::map<int, std::string>>;
+TYPED_TEST_SUITE(ShardedSyncDictionaryTest, ShardContainers);
+
+/**
+ * @brief Test the sync_dictionary-like add/remove/find/contains interface.
+ */
+TYPED_TEST(ShardedSyncDictionaryTest, AddRemoveFindContains)
+{
+    auto& dictionary = this->dictionary;
+    EXPECT_TRUE(dictionary.empty());
+
+    dictionary.add(1, std::string("one"));
+    const int two = 2;
+    const std::string two_text = "two";
+    dictionary.add(two, two_text);
+    dictionary.add(3, "three");
+    dictionary.add(1, "uno");
+
+    EXPECT_EQ(3U, dictionary.size());
+    EXPECT_EQ("uno", dictionary.find(1).value_or(""));
+    EXPECT_TRUE(dictionary.contains(2));
+    EXPECT_FALSE(dictionary.find(4).has_value());
+
+    dictionary.remove(2);
+    EXPECT_FALSE(dictionary.contains(2));
+
+    dictionary.add_range({ { 10, "ten" }, { 11, "eleven" } });
+    dictionary.add_range(std::vector<std::pair<int, std::string>>{ { 12, "twelve" } });
+    EXPECT_EQ(5U, dictionary.size());
+
+    dictionary.remove_collection({ 10, 11 });
+    dictionary.remove_collection(std::vector<int>{ 12 });
+
+    const auto snapshot = dictionary.snapshot();
+    static_assert(std::is_same<typename std::decay<decltype(snapshot)>::type, TypeParam>::value,
+        "snapshot type must follow configured dictionary container");
+    EXPECT_EQ(2U, snapshot.size());
+
+    dictionary.clear();
+    EXPECT_TRUE(dictionary.empty());
+}
+
+/**
+ * @brief Test that keys spread over the shards and stay in the shard reported by shard_of().
+ */
+TEST(ShardedSyncDictionaryShardTest, KeysSpreadOverShards)
+{
+    using dict_t = tools::sharded_sync_dictionary<int, int, tools::flat_hash_map<int, int>, 8U>;
+    static_assert(8U == dict_t::shard_count(), "shard count must follow the template argument");
+
+    std::vector<std::size_t> per_shard(dict_t::shard_count(), 0U);
+    for (int key = 0; key < 800; ++key)
+    {
+        const std::size_t shard = dict_t::shard_of(key);
+        ASSERT_LT(shard, dict_t::shard_count());
+        EXPECT_EQ(shard, dict_t::shard_of(key));
+        ++per_shard[shard];
+    }
+
+    for (const std::size_t count : per_shard)
+    {
+        EXPECT_GT(count, 50U);
+    }
+}
+
+/**
+ * @brief Test concurrent readers against a writer: every key a reader looks up is either absent or consistent.
+ */
+TEST(ShardedSyncDictionaryShardTest, ConcurrentReadersAndWriter)
+{
+    tools::sharded_sync_dictionary<int, int, tools::flat_hash_map<int, int>> dictionary;
+    constexpr int key_count = 256;
+
+    for (int key = 0; key < key_count; ++key)
+    {
+        dictionary.add(key, key * 2);
+    }
+
+    std::atomic<bool> stop = false;
+    std::atomic<int> mismatches = 0;
+    std::atomic<int> lookups = 0;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back(
+            [&, r]()
+            {
+                int key = r;
+                while (!stop.load())
+                {
+                    const auto value = dictionary.find(key);
+                    if (value.has_value() && ((*value % 2) != 0))
+                    {
+                        ++mismatches;
+                    }
+                    ++lookups;
+                    key = (key + 7) % (key_count * 2);
+                }
+            });
+    }
+
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int key = key_count; key < (key_count * 2); ++key)
+        {
+            dictionary.add(key, key * 2);
+        }
+        for (int key = key_count; key < (key_count * 2); ++key)
+        {
+            dictionary.remove(key);
+        }
+    }
+
+    while (lookups.load() < 1000)
+    {
+        std::this_thread::yield();
+    }
+
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_GT(lookups.load(), 0);
+    EXPECT_EQ(static_cast<std::size_t>(key_count), dictionary.size());
+}
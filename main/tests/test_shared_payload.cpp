@@ -0,0 +1,198 @@
+/**
+ * @file test_shared_payload.cpp
+ * @brief Unit tests for the shared_payload class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/async_observer.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/shared_payload.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/sync_ring_vector.hpp"
+
+using byte_payload = tools::shared_payload<std::uint8_t>;
+
+/**
+ * @brief Verifies copies share the block and mutate() copies the elements only while they are shared.
+ */
+TEST(SharedPayloadTest, CopiesShareAndMutateDetaches)
+{
+    const byte_payload empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.data(), nullptr);
+    EXPECT_EQ(empty.use_count(), 0U);
+
+    byte_payload frame(std::vector<std::uint8_t> { 1U, 2U, 3U, 4U });
+    byte_payload copy = frame;
+    EXPECT_TRUE(copy.shares_with(frame));
+    EXPECT_EQ(frame.use_count(), 2U);
+    EXPECT_EQ(copy.data(), frame.data());
+
+    copy.mutate()[0] = 9U;
+    EXPECT_FALSE(copy.shares_with(frame));
+    EXPECT_EQ(frame[0], 1U);
+    EXPECT_EQ(copy[0], 9U);
+    EXPECT_EQ(frame.use_count(), 1U);
+    EXPECT_NE(copy, frame);
+
+    const std::uint8_t* own = copy.data();
+    copy.mutable_view()[1] = 8U; // unique: written in place
+    EXPECT_EQ(copy.data(), own);
+    EXPECT_EQ(copy.to_vector(), (std::vector<std::uint8_t> { 9U, 8U, 3U, 4U }));
+
+    byte_payload moved = std::move(frame);
+    EXPECT_EQ(moved.use_count(), 1U);
+    EXPECT_EQ(moved.view().size(), 4U);
+
+    const tools::shared_payload<char> text(std::string_view("{\"id\":1}"));
+    EXPECT_EQ(std::string_view(text.data(), text.size()), "{\"id\":1}");
+}
+
+/**
+ * @brief Verifies copies made and dropped concurrently keep the count exact and free the block once.
+ */
+TEST(SharedPayloadTest, CountsReferencesAcrossThreads)
+{
+    const byte_payload frame(4096U);
+    std::vector<std::thread> threads;
+    for (int index = 0; index < 4; ++index)
+    {
+        threads.emplace_back(
+            [&frame]()
+            {
+                for (int iteration = 0; iteration < 10000; ++iteration)
+                {
+                    const byte_payload copy = frame;
+                    EXPECT_EQ(copy.size(), 4096U);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(frame.use_count(), 1U);
+}
+
+/**
+ * @brief Verifies a payload goes through queues, ring vector snapshots and observers without copying its bytes.
+ */
+TEST(SharedPayloadTest, TravelsThroughContainersAndObservers)
+{
+    const byte_payload frame(std::vector<std::uint8_t>(1024U, 0x5AU));
+
+    tools::sync_queue<byte_payload> queue;
+    queue.push(frame);
+    const auto queued = queue.front_pop();
+    ASSERT_TRUE(queued.has_value());
+    EXPECT_TRUE(queued->shares_with(frame));
+
+    tools::sync_ring_vector<byte_payload> ring(4U);
+    ring.push(frame);
+    const auto snapshot = ring.snapshot();
+    EXPECT_TRUE(snapshot.front().shares_with(frame));
+
+    tools::sync_subject<int, byte_payload> subject("frames");
+    auto first = std::make_shared<tools::async_observer<int, byte_payload>>();
+    auto second = std::make_shared<tools::async_observer<int, byte_payload>>();
+    subject.subscribe(1, first);
+    subject.subscribe(1, second);
+    subject.publish(1, frame);
+
+    for (const auto& observer : { first, second })
+    {
+        const auto events = observer->pop_all_events();
+        ASSERT_EQ(events.size(), 1U);
+        EXPECT_TRUE(std::get<1>(events.front()).shares_with(frame));
+    }
+}
+
+/**
+ * @brief Verifies memory_pipe messages are sent from and received into shared payloads.
+ */
+TEST(SharedPayloadTest, SendsAndReceivesPipeMessages)
+{
+    tools::memory_pipe pipe(1024U);
+    const byte_payload frame(std::vector<std::uint8_t> { 10U, 20U, 30U });
+
+    EXPECT_EQ(pipe.send_message(frame, std::chrono::duration<std::uint64_t, std::milli>(10U)), 3U);
+
+    byte_payload received;
+    EXPECT_EQ(pipe.receive_message(received, std::chrono::duration<std::uint64_t, std::milli>(10U)), 3U);
+    EXPECT_EQ(received, frame);
+    EXPECT_EQ(received.use_count(), 1U);
+
+    EXPECT_EQ(pipe.receive_message(received, std::chrono::duration<std::uint64_t, std::milli>(1U)), 0U);
+    EXPECT_TRUE(received.empty());
+}
+
+/**
+ * @brief Verifies bytepack writes a payload view with a size prefix and reads it back in place.
+ */
+TEST(SharedPayloadTest, SerializesWithBytepack)
+{
+    const byte_payload frame(std::vector<std::uint8_t> { 1U, 2U, 3U, 4U, 5U });
+
+    bytepack::binary_stream<> writer(64U);
+    ASSERT_TRUE(writer.write(frame.view()));
+    ASSERT_TRUE(writer.write(std::uint16_t { 0xBEEFU }));
+
+    bytepack::binary_stream<> reader(writer.data());
+    std::span<const std::uint8_t> view;
+    std::uint16_t trailer = 0U;
+    ASSERT_TRUE(reader.read(view));
+    ASSERT_TRUE(reader.read(trailer));
+    EXPECT_EQ(view.data(), writer.data().as<std::uint8_t>() + sizeof(std::uint32_t)); // no copy
+    EXPECT_EQ(byte_payload(view), frame);
+    EXPECT_EQ(trailer, 0xBEEFU);
+
+    // a vector reads the same layout back
+    bytepack::binary_stream<> vector_reader(writer.data());
+    std::vector<std::uint8_t> elements;
+    ASSERT_TRUE(vector_reader.read(elements));
+    EXPECT_EQ(elements, frame.to_vector());
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_soa_ring.cpp
+ * @brief Unit tests for the structure-of-arrays ring container.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "tools/soa_ring.hpp"
+
+/**
+ * @brief Verifies rows pushed field by field or as tuples come back in order, the ring refusing or overwriting
+ *        rows once full.
+ */
+TEST(SoaRingTest, PushesAndPopsRows)
+{
+    tools::soa_ring<float, std::uint32_t, std::string> ring(3U);
+    EXPECT_EQ(3U, ring.capacity());
+    EXPECT_TRUE(ring.empty());
+
+    EXPECT_TRUE(ring.push(1.5F, 10U, std::string("a")));
+    EXPECT_TRUE(ring.push(std::make_tuple(2.5F, 20U, std::string("b"))));
+    EXPECT_TRUE(ring.push(3.5F, 30U, std::string("c")));
+    EXPECT_TRUE(ring.full());
+    EXPECT_FALSE(ring.push(4.5F, 40U, std::string("d")));
+
+    EXPECT_EQ(std::make_tuple(1.5F, 10U, std::string("a")), ring.front());
+    EXPECT_EQ(std::make_tuple(3.5F, 30U, std::string("c")), ring.back());
+    EXPECT_EQ(20U, ring.field<1U>(1U));
+
+    EXPECT_TRUE(ring.push_overwrite(4.5F, 40U, std::string("d")));
+    EXPECT_EQ(3U, ring.size());
+    const auto oldest = ring.pop_move();
+    ASSERT_TRUE(oldest.has_value());
+    EXPECT_EQ(std::string("b"), std::get<2U>(*oldest));
+
+    ring.pop();
+    EXPECT_EQ(std::make_tuple(4.5F, 40U, std::string("d")), ring.front());
+    ring.clear();
+    EXPECT_FALSE(ring.pop_move().has_value());
+}
+
+/**
+ * @brief Verifies each field is exposed as contiguous views split at the wrap point, and linearize() joins them.
+ */
+TEST(SoaRingTest, ExposesContiguousFieldSpans)
+{
+    tools::soa_ring<float, float, std::int64_t> ring(8U);
+    for (int index = 0; index < 6; ++index)
+    {
+        EXPECT_TRUE(ring.push(static_cast<float>(index), static_cast<float>(-index), index));
+    }
+    EXPECT_EQ(4U, ring.consume(4U));
+    for (int index = 6; index < 12; ++index)
+    {
+        EXPECT_TRUE(ring.push(static_cast<float>(index), static_cast<float>(-index), index));
+    }
+
+    const auto x_spans = ring.peek_spans<0U>();
+    EXPECT_EQ(4U, x_spans.first_size);
+    EXPECT_EQ(4U, x_spans.second_size);
+    EXPECT_EQ(4.F, x_spans.first_data[0]);  // NOLINT pointer arithmetic
+    EXPECT_EQ(8.F, x_spans.second_data[0]); // NOLINT pointer arithmetic
+
+    ring.linearize();
+    const auto y_spans = ring.peek_spans<1U>();
+    ASSERT_EQ(8U, y_spans.first_size);
+    EXPECT_EQ(0U, y_spans.second_size);
+    float sum = 0.F;
+    for (std::size_t index = 0U; index < y_spans.first_size; ++index)
+    {
+        sum += y_spans.first_data[index]; // NOLINT pointer arithmetic
+    }
+    EXPECT_EQ(-60.F, sum);
+    EXPECT_EQ(8U, ring.field_span<2U>().size());
+    EXPECT_EQ(11, ring.field_span<2U>().back());
+
+    EXPECT_TRUE(ring.full());
+    EXPECT_TRUE(ring.push_overwrite(12.F, -12.F, 12));
+    EXPECT_EQ(std::make_tuple(5.F, -5.F, std::int64_t { 5 }), ring.front());
+}
+
+/**
+ * @brief Verifies bulk transfers through one array per field, across the wrap point and with a move-only field.
+ */
+TEST(SoaRingTest, TransfersBlocksPerField)
+{
+    tools::soa_ring<std::int32_t, double> ring(5U);
+    std::vector<std::int32_t> ids(7U);
+    std::iota(ids.begin(), ids.end(), 1);
+    const std::vector<double> values(7U, 0.5);
+
+    EXPECT_EQ(5U, ring.push_span(ids.size(), ids.data(), values.data()));
+    std::vector<std::int32_t> popped_ids(3U);
+    std::vector<double> popped_values(3U);
+    EXPECT_EQ(3U, ring.pop_span(popped_ids.size(), popped_ids.data(), popped_values.data()));
+    EXPECT_EQ((std::vector<std::int32_t> { 1, 2, 3 }), popped_ids);
+
+    EXPECT_EQ(2U, ring.push_span(2U, ids.data() + 5, values.data() + 5)); // NOLINT pointer arithmetic
+    std::vector<std::int32_t> rest(8U);
+    std::vector<double> rest_values(8U);
+    EXPECT_EQ(4U, ring.pop_span(rest.size(), rest.data(), rest_values.data()));
+    EXPECT_EQ(4, rest[0]);
+    EXPECT_EQ(7, rest[3]);
+    EXPECT_EQ(0.5, rest_values[3]);
+
+    tools::soa_ring<std::unique_ptr<int>, int> owners(2U);
+    EXPECT_TRUE(owners.push(std::make_unique<int>(7), 1));
+    auto row = owners.pop_move();
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(7, *std::get<0U>(*row));
+}
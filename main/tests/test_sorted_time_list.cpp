@@ -0,0 +1,156 @@
+/**
+ * @file test_sorted_time_list.cpp
+ * @brief Unit tests for the ring-sorted tools::sorted_time_list using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/sorted_time_list.hpp"
+#include "tools/time_list.hpp"
+
+/** @brief Entries come out earliest first whatever the push order, equal timestamps in insertion order. */
+TEST(SortedTimeListTest, KeepsChronologicalAndStableOrder)
+{
+    tools::sorted_time_list<long, std::string> list;
+
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.top().has_value());
+    EXPECT_FALSE(list.top_pop().has_value());
+
+    list.push(20L, "b1");
+    list.push(10L, "a");
+    list.push(30L, "c");
+    list.emplace(20L, "b2");
+    list.push(5L, std::string("first"));
+
+    const auto snapshot_values = list.snapshot_sorted();
+    ASSERT_EQ(snapshot_values.size(), 5U);
+    EXPECT_EQ(snapshot_values[0].second, "first");
+    EXPECT_EQ(snapshot_values[1].second, "a");
+    EXPECT_EQ(snapshot_values[2].second, "b1");
+    EXPECT_EQ(snapshot_values[3].second, "b2");
+    EXPECT_EQ(snapshot_values[4].second, "c");
+
+    EXPECT_EQ(list.top_pop()->second, "first");
+    list.pop();
+    EXPECT_EQ(list.top()->second, "b1");
+    EXPECT_EQ(list.size(), 3U);
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+}
+
+/** @brief visit_range() walks the [from, until) window in place; for_each() walks everything in order. */
+TEST(SortedTimeListTest, VisitRangeAndForEach)
+{
+    tools::sorted_time_list<long, int> list;
+
+    for (long timestamp_value = 0L; timestamp_value < 100L; timestamp_value += 10L)
+    {
+        list.push(timestamp_value, static_cast<int>(timestamp_value));
+    }
+
+    std::vector<long> window;
+    EXPECT_EQ(list.visit_range(15L, 50L, [&window](const auto& entry) { window.push_back(entry.first); }), 3U);
+    EXPECT_EQ(window, (std::vector<long> { 20L, 30L, 40L }));
+
+    EXPECT_EQ(list.visit_range(200L, 300L, [](const auto&) {}), 0U);
+    EXPECT_EQ(list.visit_range(50L, 50L, [](const auto&) {}), 0U);
+
+    long previous = -1L;
+    list.for_each(
+        [&previous](const auto& entry)
+        {
+            EXPECT_LT(previous, entry.first);
+            previous = entry.first;
+        });
+    EXPECT_EQ(previous, 90L);
+    EXPECT_EQ(list.size(), 10U);
+}
+
+/** @brief pop_until() drains the head up to the inclusive bound, with or without a consumer. */
+TEST(SortedTimeListTest, PopUntilDrainsHead)
+{
+    tools::sorted_time_list<long, std::string> list;
+    list.push(1L, "a");
+    list.push(2L, "b");
+    list.push(3L, "c");
+    list.push(4L, "d");
+
+    std::vector<std::string> drained;
+    EXPECT_EQ(list.pop_until(2L, [&drained](auto&& entry) { drained.push_back(std::move(entry.second)); }), 2U);
+    EXPECT_EQ(drained, (std::vector<std::string> { "a", "b" }));
+
+    EXPECT_EQ(list.pop_until(0L), 0U);
+    EXPECT_EQ(list.pop_until(3L), 1U);
+    EXPECT_EQ(list.top()->second, "d");
+}
+
+/** @brief The sorted ring agrees with the heap-based time_list on a mostly-monotonic chrono history. */
+TEST(SortedTimeListTest, MatchesHeapTimeListWithChronoTimestamps)
+{
+    using timestamp_type = std::chrono::steady_clock::time_point;
+    tools::sorted_time_list<timestamp_type, int> sorted;
+    tools::time_list<timestamp_type, int> heap;
+
+    const auto origin = std::chrono::steady_clock::now();
+    std::mt19937 generator(7U); // NOLINT fixed seed
+    std::uniform_int_distribution<int> jitter(-3, 0);
+
+    for (int index = 0; index < 500; ++index)
+    {
+        const auto timestamp_value = origin + std::chrono::milliseconds(index + jitter(generator));
+        sorted.push(timestamp_value, index);
+        heap.push(timestamp_value, index);
+    }
+
+    const auto bound = origin + std::chrono::milliseconds(250);
+    std::vector<timestamp_type> sorted_head;
+    std::vector<timestamp_type> heap_head;
+    sorted.pop_until(bound, [&sorted_head](auto&& entry) { sorted_head.push_back(entry.first); });
+    heap.pop_until(bound, [&heap_head](const auto& entry) { heap_head.push_back(entry.first); });
+    EXPECT_EQ(sorted_head, heap_head);
+
+    const auto sorted_rest = sorted.snapshot_sorted();
+    const auto heap_rest = heap.snapshot_sorted();
+    ASSERT_EQ(sorted_rest.size(), heap_rest.size());
+
+    for (std::size_t index = 0U; index < sorted_rest.size(); ++index)
+    {
+        EXPECT_EQ(sorted_rest[index].first, heap_rest[index].first);
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file test_startup_graph.cpp
+ * @brief Unit tests for the startup_graph class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/startup_graph.hpp"
+
+/**
+ * @brief Verifies start() runs every eager component after its dependencies and leaves unused lazy ones pending.
+ */
+TEST(StartupGraphTest, RunsEagerComponentsInDependencyOrder)
+{
+    tools::startup_graph graph;
+    tools::critical_section mutex;
+    std::vector<std::string> order;
+    const auto record = [&mutex, &order](const char* name)
+    {
+        return [&mutex, &order, name]()
+        {
+            std::scoped_lock<tools::critical_section> guard(mutex);
+            order.emplace_back(name);
+            return true;
+        };
+    };
+
+    const auto allocator = graph.add("allocator", record("allocator"));
+    const auto codec = graph.add("codec", record("codec"), { allocator }, tools::startup_mode::lazy);
+    const auto subject = graph.add("subject", record("subject"), { allocator });
+    const auto logger = graph.add("logger", record("logger"), { codec, subject });
+    const auto gzip = graph.add("gzip", record("gzip"), { allocator }, tools::startup_mode::lazy);
+    EXPECT_EQ(graph.add("broken", record("broken"), { 42U }), tools::startup_graph::invalid_component);
+
+    EXPECT_TRUE(graph.start(3U));
+    ASSERT_EQ(order.size(), 4U);
+    EXPECT_EQ(order.front(), "allocator");
+    EXPECT_EQ(order.back(), "logger");
+    EXPECT_EQ(graph.state(codec), tools::startup_state::ready); // lazy, but the logger needs it
+    EXPECT_EQ(graph.state(gzip), tools::startup_state::pending);
+    EXPECT_EQ(graph.find("subject"), subject);
+    EXPECT_EQ(graph.find("missing"), tools::startup_graph::invalid_component);
+    EXPECT_FALSE(graph.profile()[logger].on_demand);
+}
+
+/**
+ * @brief Verifies require() initializes a lazy component once, concurrent callers waiting for the first one.
+ */
+TEST(StartupGraphTest, InitializesLazyComponentsOnce)
+{
+    tools::startup_graph graph;
+    std::atomic<int> calls = 0;
+    const auto table = graph.add("table", [] { return true; }, {}, tools::startup_mode::lazy);
+    const auto gzip = graph.add(
+        "gzip",
+        [&calls]
+        {
+            calls.fetch_add(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            return true;
+        },
+        { table }, tools::startup_mode::lazy);
+
+    EXPECT_TRUE(graph.start());
+    EXPECT_EQ(graph.state(gzip), tools::startup_state::pending);
+
+    std::vector<std::thread> threads;
+    std::atomic<int> ready = 0;
+    for (int index = 0; index < 4; ++index)
+    {
+        threads.emplace_back(
+            [&graph, &ready, gzip]()
+            {
+                if (graph.require(gzip))
+                {
+                    ready.fetch_add(1);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(ready.load(), 4);
+    EXPECT_EQ(graph.state(table), tools::startup_state::ready);
+    EXPECT_TRUE(graph.profile()[gzip].on_demand);
+    EXPECT_GE(graph.profile()[gzip].duration_us, 20000U);
+}
+
+/**
+ * @brief Verifies a failed routine fails its dependents without running them, the other branches going on.
+ */
+TEST(StartupGraphTest, FailsDependentsOfFailedComponents)
+{
+    tools::startup_graph graph;
+    std::atomic<int> dependent_calls = 0;
+    const auto storage = graph.add("storage", [] { return false; });
+    const auto config = graph.add(
+        "config",
+        [&dependent_calls]
+        {
+            dependent_calls.fetch_add(1);
+            return true;
+        },
+        { storage });
+    const auto timers = graph.add("timers", [] { return true; });
+
+    EXPECT_FALSE(graph.start(2U));
+    EXPECT_EQ(graph.state(storage), tools::startup_state::failed);
+    EXPECT_EQ(graph.state(config), tools::startup_state::failed);
+    EXPECT_EQ(graph.state(timers), tools::startup_state::ready);
+    EXPECT_EQ(dependent_calls.load(), 0);
+    EXPECT_FALSE(graph.require(config));
+}
+
+/**
+ * @brief Verifies independent components run in parallel: the start takes about the longest routine, not the sum.
+ */
+TEST(StartupGraphTest, RunsIndependentComponentsInParallel)
+{
+    tools::startup_graph graph;
+    constexpr auto routine_time = std::chrono::milliseconds(100);
+    for (int index = 0; index < 4; ++index)
+    {
+        graph.add("sensor_" + std::to_string(index),
+            [routine_time]
+            {
+                std::this_thread::sleep_for(routine_time);
+                return true;
+            });
+    }
+
+    EXPECT_TRUE(graph.start(4U));
+    EXPECT_LT(graph.start_duration_us(), 350000U);
+
+    std::vector<std::string> runners;
+    for (const auto& record : graph.profile())
+    {
+        EXPECT_EQ(record.state, tools::startup_state::ready);
+        runners.push_back(record.runner);
+    }
+    std::sort(runners.begin(), runners.end());
+    EXPECT_GT(std::unique(runners.begin(), runners.end()) - runners.begin(), 1);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file test_static_subject.cpp
+ * @brief Unit tests for the compile-time wired static_subject using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "tools/static_subject.hpp"
+
+namespace
+{
+    enum class sensor_topic : std::uint8_t
+    {
+        temperature,
+        pressure,
+        alarm,
+        count
+    };
+
+    struct temperature_observer
+    {
+        static constexpr bool subscribes(sensor_topic topic)
+        {
+            return sensor_topic::temperature == topic;
+        }
+
+        void inform(sensor_topic /*topic*/, const int& event)
+        {
+            received.push_back(event);
+        }
+
+        std::vector<int> received;
+    };
+
+    struct pressure_and_alarm_observer
+    {
+        static constexpr bool subscribes(sensor_topic topic)
+        {
+            return (sensor_topic::pressure == topic) || (sensor_topic::alarm == topic);
+        }
+
+        void inform(sensor_topic topic, const int& event)
+        {
+            topics.push_back(topic);
+            received.push_back(event);
+        }
+
+        std::vector<sensor_topic> topics;
+        std::vector<int> received;
+    };
+
+    struct counting_observer
+    {
+        template <typename Topic>
+        void inform(const Topic& /*topic*/, const int& event)
+        {
+            ++count;
+            sum += event;
+        }
+
+        int count = 0;
+        int sum = 0;
+    };
+
+    using sensor_subject = tools::
+        static_subject<sensor_topic, int, temperature_observer, pressure_and_alarm_observer, counting_observer>;
+
+    static_assert(tools::static_topic_count<sensor_topic>::value == 3U);
+    static_assert(tools::static_topic_count<int>::value == 0U);
+    static_assert(sensor_subject::number_of_observers == 3U);
+    static_assert(sensor_subject::number_of_receivers(sensor_topic::temperature) == 2U);
+    static_assert(sensor_subject::number_of_receivers(sensor_topic::alarm) == 2U);
+}
+
+/**
+ * @brief Test that a compile-time topic only reaches the observers subscribing to it, in pack order.
+ */
+TEST(StaticSubjectTest, CompileTimeTopicReachesSubscribers)
+{
+    temperature_observer temperatures;
+    pressure_and_alarm_observer pressures;
+    counting_observer all;
+    sensor_subject subject(temperatures, pressures, all);
+
+    subject.publish<sensor_topic::temperature>(21);
+    subject.publish<sensor_topic::pressure>(1013);
+    subject.publish<sensor_topic::alarm>(1);
+
+    EXPECT_EQ(temperatures.received, (std::vector<int> { 21 }));
+    EXPECT_EQ(pressures.received, (std::vector<int> { 1013, 1 }));
+    EXPECT_EQ(pressures.topics, (std::vector<sensor_topic> { sensor_topic::pressure, sensor_topic::alarm }));
+    EXPECT_EQ(all.count, 3);
+    EXPECT_EQ(all.sum, 1035);
+}
+
+/**
+ * @brief Test that a run-time enum topic is dispatched through the topic table and out of range topics are ignored.
+ */
+TEST(StaticSubjectTest, RuntimeEnumTopicUsesTopicTable)
+{
+    temperature_observer temperatures;
+    pressure_and_alarm_observer pressures;
+    counting_observer all;
+    sensor_subject subject(temperatures, pressures, all);
+
+    for (const auto topic : { sensor_topic::temperature, sensor_topic::pressure, sensor_topic::temperature })
+    {
+        subject.publish(topic, 5);
+    }
+    subject.publish(sensor_topic::count, 100);
+    subject.publish(static_cast<sensor_topic>(200U), 100);
+
+    EXPECT_EQ(temperatures.received, (std::vector<int> { 5, 5 }));
+    EXPECT_EQ(pressures.received, (std::vector<int> { 5 }));
+    EXPECT_EQ(all.count, 3);
+}
+
+/**
+ * @brief Test that topics without a count enumerator are dispatched by testing the observer subscriptions.
+ */
+TEST(StaticSubjectTest, RuntimeNonEnumTopicTestsSubscriptions)
+{
+    struct named_observer
+    {
+        static bool subscribes(const std::string& topic)
+        {
+            return topic.rfind("sensors/", 0U) == 0U;
+        }
+
+        void inform(const std::string& topic, const int& event)
+        {
+            last_topic = topic;
+            last_event = event;
+        }
+
+        std::string last_topic;
+        int last_event = 0;
+    };
+
+    named_observer sensors;
+    counting_observer all;
+    tools::static_subject<std::string, int, named_observer, counting_observer> subject(sensors, all);
+
+    subject.publish(std::string("sensors/kitchen"), 7);
+    subject.publish(std::string("actuators/valve"), 8);
+
+    EXPECT_EQ(sensors.last_topic, "sensors/kitchen");
+    EXPECT_EQ(sensors.last_event, 7);
+    EXPECT_EQ(all.count, 2);
+    EXPECT_EQ(all.sum, 15);
+}
@@ -0,0 +1,170 @@
+/**
+ * @file test_sync_cache.cpp
+ * @brief Unit tests for the sync_cache class.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/sync_cache.hpp"
+
+/**
+ * @brief Verifies lookups, replacement, removal and the hit/miss counters.
+ */
+TEST(SyncCacheTest, StoresFindsAndRemoves)
+{
+    tools::sync_cache<int, std::string, 4U> cache(16U);
+    EXPECT_EQ(cache.capacity(), 16U);
+
+    EXPECT_FALSE(cache.find(1).has_value());
+    cache.add(1, "one");
+    cache.add(2, "two");
+    cache.add(1, "uno");
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.find(1).value_or(""), "uno");
+    EXPECT_TRUE(cache.remove(2));
+    EXPECT_FALSE(cache.remove(2));
+    EXPECT_FALSE(cache.find(2).has_value());
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_EQ(stats.misses, 2U);
+    EXPECT_EQ(stats.evictions, 0U);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+    cache.reset_stats();
+    EXPECT_EQ(cache.stats().misses, 0U);
+}
+
+/**
+ * @brief Verifies LRU eviction drops the least recently used entry of a full shard.
+ */
+TEST(SyncCacheTest, EvictsLeastRecentlyUsed)
+{
+    tools::sync_cache<int, int, 1U> cache(3U, tools::cache_eviction::lru);
+    cache.add(1, 10);
+    cache.add(2, 20);
+    cache.add(3, 30);
+    EXPECT_TRUE(cache.find(1).has_value()); // 2 is now the least recently used
+
+    cache.add(4, 40);
+    EXPECT_FALSE(cache.find(2).has_value());
+    EXPECT_EQ(cache.find(1).value_or(0), 10);
+    EXPECT_EQ(cache.find(3).value_or(0), 30);
+    EXPECT_EQ(cache.find(4).value_or(0), 40);
+    EXPECT_EQ(cache.stats().evictions, 1U);
+    EXPECT_EQ(cache.size(), 3U);
+}
+
+/**
+ * @brief Verifies CLOCK eviction gives referenced entries a second chance.
+ */
+TEST(SyncCacheTest, ClockGivesSecondChance)
+{
+    tools::sync_cache<int, int, 1U> cache(3U, tools::cache_eviction::clock);
+    cache.add(1, 10);
+    cache.add(2, 20);
+    cache.add(3, 30);
+    EXPECT_TRUE(cache.find(1).has_value());
+    EXPECT_TRUE(cache.find(3).has_value());
+
+    cache.add(4, 40); // 1 and 3 referenced: 2 goes
+    EXPECT_FALSE(cache.find(2).has_value());
+    EXPECT_TRUE(cache.find(1).has_value());
+    EXPECT_TRUE(cache.find(3).has_value());
+    EXPECT_TRUE(cache.find(4).has_value());
+    EXPECT_EQ(cache.stats().evictions, 1U);
+}
+
+/**
+ * @brief Verifies entries expire after their time to live and are counted.
+ */
+TEST(SyncCacheTest, ExpiresAfterTimeToLive)
+{
+    tools::sync_cache<int, int, 2U> cache(8U, tools::cache_eviction::lru, std::chrono::milliseconds(30));
+    cache.add(1, 10);
+    EXPECT_EQ(cache.find(1).value_or(0), 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_FALSE(cache.find(1).has_value());
+    EXPECT_EQ(cache.stats().expirations, 1U);
+    EXPECT_EQ(cache.size(), 0U);
+
+    EXPECT_EQ(cache.get_or_compute(1, []() { return 11; }), 11);
+    EXPECT_EQ(cache.find(1).value_or(0), 11);
+}
+
+/**
+ * @brief Verifies concurrent misses on one key run a single computation, the other callers sharing its result.
+ */
+TEST(SyncCacheTest, CollapsesConcurrentMisses)
+{
+    tools::sync_cache<std::string, int> cache(64U);
+    std::atomic<int> computations = 0;
+
+    std::vector<std::thread> threads;
+    std::vector<int> results(8U, 0);
+    for (std::size_t index = 0U; index < results.size(); ++index)
+    {
+        threads.emplace_back(
+            [&cache, &computations, &results, index]()
+            {
+                results[index] = cache.get_or_compute("config",
+                    [&computations]()
+                    {
+                        computations.fetch_add(1);
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                        return 42;
+                    });
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(computations.load(), 1);
+    for (const int result : results)
+    {
+        EXPECT_EQ(result, 42);
+    }
+    EXPECT_GT(cache.stats().collapsed, 0U);
+}
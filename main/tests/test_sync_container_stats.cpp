@@ -0,0 +1,209 @@
+/**
+ * @file test_sync_container_stats.cpp
+ * @brief Unit tests for the statistics policy of the sync containers and its registry.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/ring_queue.hpp"
+#include "tools/sync_container_stats.hpp"
+#include "tools/sync_priority_queue.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/sync_ring_buffer.hpp"
+#include "tools/sync_ring_vector.hpp"
+
+namespace
+{
+    const tools::sync_container_stats_snapshot* find_snapshot(
+        const std::vector<tools::sync_container_stats_snapshot>& snapshots, const std::string& name)
+    {
+        const auto found = std::find_if(snapshots.cbegin(), snapshots.cend(),
+            [&name](const tools::sync_container_stats_snapshot& snapshot) { return snapshot.name == name; });
+        return (snapshots.cend() != found) ? &(*found) : nullptr;
+    }
+}
+
+/**
+ * @brief Verifies a bounded sync_queue counts pushes, pops, rejected and overwritten elements and its high-water mark.
+ */
+TEST(SyncContainerStatsTest, CountsQueueTraffic)
+{
+    tools::basic_sync_queue<int, tools::critical_section, tools::ring_queue<int>, tools::sync_container_stats>
+        rejecting(4U, tools::queue_full_policy::reject);
+    rejecting.push_range({ 1, 2, 3, 4, 5, 6 });
+    EXPECT_EQ(rejecting.front_pop().value_or(0), 1);
+    int destination[2] = {};
+    EXPECT_EQ(rejecting.pop_range(std::begin(destination), std::end(destination)), 2U);
+
+    auto stats = rejecting.stats().snapshot();
+    EXPECT_EQ(stats.pushes, 4U);
+    EXPECT_EQ(stats.overflows, 2U);
+    EXPECT_EQ(stats.overwrites, 0U);
+    EXPECT_EQ(stats.pops, 3U);
+    EXPECT_EQ(stats.high_water_mark, 4U);
+
+    tools::basic_sync_queue<int, tools::critical_section, tools::ring_queue<int>, tools::sync_container_stats>
+        overwriting(2U, tools::queue_full_policy::overwrite_oldest);
+    overwriting.push(1);
+    overwriting.push(2);
+    overwriting.push(3);
+    EXPECT_EQ(overwriting.wait_pop(std::chrono::microseconds(0U)).value_or(0), 2);
+    stats = overwriting.stats().snapshot();
+    EXPECT_EQ(stats.pushes, 3U);
+    EXPECT_EQ(stats.overwrites, 1U);
+    EXPECT_EQ(stats.overflows, 0U);
+    EXPECT_EQ(stats.pops, 1U);
+    EXPECT_EQ(stats.high_water_mark, 2U);
+
+    overwriting.stats().reset();
+    EXPECT_EQ(overwriting.stats().snapshot().pushes, 0U);
+}
+
+/**
+ * @brief Verifies the ring containers report refused pushes as overflows and overwriting pushes as overwrites.
+ */
+TEST(SyncContainerStatsTest, CountsRingOverflowsAndOverwrites)
+{
+    tools::basic_sync_ring_vector<int, tools::critical_section, tools::sync_container_stats> ring_vector(3U);
+    EXPECT_EQ(ring_vector.push_range({ 1, 2, 3, 4 }), 3U);
+    EXPECT_FALSE(ring_vector.push(5));
+    EXPECT_TRUE(ring_vector.push_overwrite(6));
+    EXPECT_EQ(ring_vector.front_pop_move().value_or(0), 2);
+    auto stats = ring_vector.stats().snapshot();
+    EXPECT_EQ(stats.pushes, 4U);
+    EXPECT_EQ(stats.overflows, 2U);
+    EXPECT_EQ(stats.overwrites, 1U);
+    EXPECT_EQ(stats.pops, 1U);
+    EXPECT_EQ(stats.high_water_mark, 3U);
+
+    tools::sync_ring_buffer<int, 2U, tools::ring_concurrency::locked, tools::sync_container_stats> locked_ring;
+    EXPECT_TRUE(locked_ring.push(1));
+    EXPECT_TRUE(locked_ring.push(2));
+    EXPECT_FALSE(locked_ring.push(3));
+    locked_ring.pop();
+    stats = locked_ring.stats().snapshot();
+    EXPECT_EQ(stats.pushes, 2U);
+    EXPECT_EQ(stats.overflows, 1U);
+    EXPECT_EQ(stats.pops, 1U);
+
+    tools::sync_ring_buffer<int, 4U, tools::ring_concurrency::spsc_lock_free, tools::sync_container_stats> spsc_ring;
+    const std::array<int, 6U> values = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(spsc_ring.push_span(values.data(), values.size()), 4U);
+    EXPECT_EQ(spsc_ring.front_pop().value_or(0), 1);
+    stats = spsc_ring.stats().snapshot();
+    EXPECT_EQ(stats.pushes, 4U);
+    EXPECT_EQ(stats.overflows, 2U);
+    EXPECT_EQ(stats.pops, 1U);
+    EXPECT_EQ(stats.high_water_mark, 4U);
+    EXPECT_EQ(stats.contended_locks, 0U);
+}
+
+/**
+ * @brief Verifies the registry lists live instrumented containers by name and forgets destroyed ones.
+ */
+TEST(SyncContainerStatsTest, RegistryEnumeratesLiveContainers)
+{
+    auto& registry = tools::sync_container_registry::instance();
+    const std::size_t initial_count = registry.size();
+    {
+        using heap_type = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+        tools::sync_priority_queue<int, std::greater<int>, heap_type, tools::sync_container_stats> priority_queue;
+        priority_queue.stats().set_name("rx_priority");
+        priority_queue.push_range({ 5, 1, 3 });
+        EXPECT_EQ(priority_queue.top_pop().value_or(0), 1);
+
+        EXPECT_EQ(registry.size(), initial_count + 1U);
+        const auto snapshots = registry.snapshot();
+        const auto* snapshot = find_snapshot(snapshots, "rx_priority");
+        ASSERT_NE(snapshot, nullptr);
+        EXPECT_EQ(snapshot->pushes, 3U);
+        EXPECT_EQ(snapshot->pops, 1U);
+        EXPECT_EQ(snapshot->high_water_mark, 3U);
+    }
+    EXPECT_EQ(registry.size(), initial_count);
+    EXPECT_EQ(find_snapshot(registry.snapshot(), "rx_priority"), nullptr);
+
+    // the default policy registers nothing
+    tools::sync_queue<int> plain_queue;
+    plain_queue.push(1);
+    EXPECT_EQ(registry.size(), initial_count);
+    EXPECT_FALSE(tools::no_sync_container_stats::enabled);
+}
+
+/**
+ * @brief Verifies a lock acquisition that has to wait is counted with its waiting time.
+ */
+TEST(SyncContainerStatsTest, MeasuresLockContention)
+{
+    tools::critical_section lock;
+    tools::sync_container_stats stats;
+    std::atomic_bool held = false;
+
+    std::thread holder(
+        [&lock, &held]()
+        {
+            lock.lock();
+            held.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            lock.unlock();
+        });
+    while (!held.load())
+    {
+        std::this_thread::yield();
+    }
+    {
+        const tools::sync_stats_lock_guard<tools::critical_section, tools::sync_container_stats> guard(lock, stats);
+    }
+    holder.join();
+
+    {
+        const tools::sync_stats_lock_guard<tools::critical_section, tools::sync_container_stats> guard(lock, stats);
+    }
+    const auto snapshot = stats.snapshot();
+    EXPECT_EQ(snapshot.contended_locks, 1U);
+    EXPECT_GE(snapshot.lock_wait, std::chrono::milliseconds(10));
+}
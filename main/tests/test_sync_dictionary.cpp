@@ -45,6 +45,7 @@
 #include <complex>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -52,6 +53,9 @@
 #include <utility>
 #include <vector>
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 #if ((__cplusplus >= 202302L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202302L))) && defined(__has_include)
 #if __has_include(<flat_map>)
 #include <flat_map>
@@ -62,6 +66,7 @@
 #include <ranges>
 #endif
 
+#include "tools/flat_hash_map.hpp"
 #include "tools/sync_dictionary.hpp"
 
 
@@ -1013,6 +1018,153 @@ TEST(SyncDictionaryContainerTypeTest, SupportsConfiguredUnorderedMap)
     ASSERT_TRUE(dictionary.contains(2));
 }
 
+/**
+ * @brief Verifies the internal associative container can be configured to tools::flat_hash_map.
+ */
+TEST(SyncDictionaryContainerTypeTest, SupportsConfiguredFlatHashMap)
+{
+    using dict_t = tools::sync_dictionary<int, std::string, tools::flat_hash_map<int, std::string>>;
+
+    dict_t dictionary;
+    dictionary.add(5, "five");
+    dictionary.add(6, "six");
+    dictionary.add(5, "cinq");
+    dictionary.remove(6);
+
+    auto snapshot = dictionary.snapshot();
+    static_assert(std::is_same<decltype(snapshot), tools::flat_hash_map<int, std::string>>::value,
+        "snapshot type must follow configured dictionary container");
+
+    ASSERT_EQ(snapshot.size(), 1U);
+    ASSERT_TRUE(dictionary.contains(5));
+    ASSERT_FALSE(dictionary.contains(6));
+    ASSERT_EQ(dictionary.find(5).value_or(""), "cinq");
+}
+
+/**
+ * @brief Verifies the internal associative container can be a heap-free tools::fixed_flat_hash_map.
+ */
+TEST(SyncDictionaryContainerTypeTest, SupportsConfiguredFixedFlatHashMap)
+{
+    using dict_t = tools::sync_dictionary<int, int, tools::fixed_flat_hash_map<int, int, 4U>>;
+
+    dict_t dictionary;
+    dictionary.add_range({ { 1, 10 }, { 2, 20 }, { 3, 30 }, { 4, 40 } });
+    dictionary.add(5, 50); // full: dropped
+    dictionary.add(4, 44); // existing key: still updated
+
+    ASSERT_EQ(dictionary.size(), 4U);
+    ASSERT_FALSE(dictionary.contains(5));
+    ASSERT_EQ(dictionary.find(4).value_or(0), 44);
+}
+
+/**
+ * @brief Verifies find_many resolves a batch of keys, hits and misses, in key order.
+ */
+TEST(SyncDictionaryBulkTest, FindManyResolvesBatch)
+{
+    tools::sync_dictionary<int, std::string, std::unordered_map<int, std::string>> dictionary;
+    dictionary.add_range({ { 1, "one" }, { 3, "three" }, { 5, "five" } });
+
+    const std::vector<int> keys = { 5, 2, 1, 3, 4 };
+    std::vector<std::optional<std::string>> results(keys.size(), std::string("stale"));
+    ASSERT_EQ(dictionary.find_many(keys.data(), keys.size(), results.data()), 3U);
+    ASSERT_EQ(results[0].value_or(""), "five");
+    ASSERT_FALSE(results[1].has_value());
+    ASSERT_EQ(results[2].value_or(""), "one");
+    ASSERT_EQ(results[3].value_or(""), "three");
+    ASSERT_FALSE(results[4].has_value());
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    std::vector<std::optional<std::string>> partial(2U);
+    ASSERT_EQ(dictionary.find_many(std::span<const int>(keys), std::span<std::optional<std::string>>(partial)), 1U);
+    ASSERT_EQ(partial[0].value_or(""), "five");
+    ASSERT_FALSE(partial[1].has_value());
+#endif
+}
+
+/**
+ * @brief Verifies visit and upsert modify values in place and upsert creates missing entries.
+ */
+TEST(SyncDictionaryBulkTest, VisitAndUpsertInPlace)
+{
+    tools::sync_dictionary<int, std::vector<int>> dictionary;
+    dictionary.add(1, std::vector<int> { 10 });
+
+    ASSERT_TRUE(dictionary.visit(1, [](std::vector<int>& values) { values.push_back(11); }));
+    ASSERT_FALSE(dictionary.visit(2, [](std::vector<int>& values) { values.push_back(0); }));
+    ASSERT_FALSE(dictionary.contains(2));
+
+    ASSERT_TRUE(dictionary.upsert(1, [](std::vector<int>& values) { values.push_back(12); }));
+    ASSERT_TRUE(dictionary.upsert(2, [](std::vector<int>& values) { values.push_back(20); }));
+    ASSERT_EQ(dictionary.find(1).value_or(std::vector<int> {}), (std::vector<int> { 10, 11, 12 }));
+    ASSERT_EQ(dictionary.find(2).value_or(std::vector<int> {}), (std::vector<int> { 20 }));
+
+    using fixed_t = tools::sync_dictionary<int, int, tools::fixed_flat_hash_map<int, int, 2U>>;
+    fixed_t counters;
+    ASSERT_TRUE(counters.upsert(1, [](int& count) { ++count; }));
+    ASSERT_TRUE(counters.upsert(1, [](int& count) { ++count; }));
+    ASSERT_TRUE(counters.upsert(2, [](int& count) { ++count; }));
+    ASSERT_FALSE(counters.upsert(3, [](int& count) { ++count; })); // full
+    ASSERT_EQ(counters.find(1).value_or(0), 2);
+    ASSERT_EQ(counters.size(), 2U);
+}
+
+/**
+ * @brief Verifies for_each visits every entry in place without copying the dictionary.
+ */
+TEST(SyncDictionaryBulkTest, ForEachVisitsEveryEntry)
+{
+    tools::sync_dictionary<int, int> dictionary;
+    dictionary.add(1, 10);
+    dictionary.add(2, 20);
+    dictionary.add(3, 30);
+
+    int key_sum = 0;
+    int value_sum = 0;
+    EXPECT_EQ(3U, dictionary.for_each(
+                      [&key_sum, &value_sum](const int& key, const int& value)
+                      {
+                          key_sum += key;
+                          value_sum += value;
+                      }));
+    EXPECT_EQ(6, key_sum);
+    EXPECT_EQ(60, value_sum);
+}
+
+/**
+ * @brief Verifies concurrent upserts on shared keys lose no increment.
+ */
+TEST(SyncDictionaryBulkTest, ConcurrentUpsertsAreAtomic)
+{
+    tools::sync_dictionary<int, int> dictionary;
+    constexpr int increments = 1000;
+    std::vector<std::thread> threads;
+    for (int thread_index = 0; thread_index < 4; ++thread_index)
+    {
+        threads.emplace_back(
+            [&dictionary]()
+            {
+                for (int i = 0; i < increments; ++i)
+                {
+                    dictionary.upsert(i % 8, [](int& count) { ++count; });
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::vector<int> keys = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    std::vector<std::optional<int>> counts(keys.size());
+    ASSERT_EQ(dictionary.find_many(keys.data(), keys.size(), counts.data()), keys.size());
+    for (const auto& count : counts)
+    {
+        ASSERT_EQ(count.value_or(0), 4 * increments / 8);
+    }
+}
+
 #if defined(__cpp_lib_flat_map) && (__cpp_lib_flat_map >= 202207L)
 /**
  * @brief Verifies the internal associative container can be configured to std::flat_map when available.
@@ -0,0 +1,160 @@
+/**
+ * @file test_sync_lane_queue.cpp
+ * @brief Unit tests for the multi-lane sync_lane_queue using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tools/sync_lane_queue.hpp"
+
+namespace
+{
+    std::vector<int> drain(tools::sync_lane_queue<int, 3U>& queue)
+    {
+        std::vector<int> order;
+        for (auto item = queue.pop(); item.has_value(); item = queue.pop())
+        {
+            order.push_back(item.value());
+        }
+        return order;
+    }
+} // namespace
+
+TEST(SyncLaneQueueTest, EmptyQueuePopsNothing)
+{
+    tools::sync_lane_queue<int, 3U> queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(SyncLaneQueueTest, HighestLaneFirstAndFifoWithinLane)
+{
+    tools::sync_lane_queue<int, 3U> queue;
+
+    queue.push(2U, 20);
+    queue.push(1U, 10);
+    queue.push(2U, 21);
+    queue.push(0U, 0);
+    queue.push(1U, 11);
+
+    EXPECT_EQ(queue.size(1U), 2U);
+    EXPECT_EQ(drain(queue), (std::vector<int> { 0, 10, 11, 20, 21 }));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SyncLaneQueueTest, QuotaLetsLowerLanesThrough)
+{
+    tools::sync_lane_queue<int, 3U> queue;
+    queue.set_quota(2U);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        queue.push(0U, i);
+    }
+    queue.push(2U, 100);
+    queue.push(2U, 101);
+
+    EXPECT_EQ(drain(queue), (std::vector<int> { 0, 1, 100, 2, 3, 101, 4, 5 }));
+}
+
+TEST(SyncLaneQueueTest, OutOfRangeLaneIsClampedToLowest)
+{
+    tools::sync_lane_queue<int, 3U> queue;
+
+    queue.push(7U, 70);
+    queue.push(2U, 20);
+    queue.push(0U, 0);
+
+    EXPECT_EQ(queue.size(2U), 2U);
+    EXPECT_EQ(drain(queue), (std::vector<int> { 0, 70, 20 }));
+}
+
+TEST(SyncLaneQueueTest, StoresMoveOnlyElements)
+{
+    tools::sync_lane_queue<std::unique_ptr<std::string>, 2U> queue;
+
+    queue.emplace(1U, std::make_unique<std::string>("bulk"));
+    queue.push(0U, std::make_unique<std::string>("urgent"));
+
+    auto first = queue.pop();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(**first, "urgent");
+
+    auto second = queue.pop();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(**second, "bulk");
+}
+
+TEST(SyncLaneQueueTest, ReservedRingLanesDropWhenFull)
+{
+    tools::sync_lane_queue<int, 2U, tools::ring_queue<int>> queue;
+    queue.reserve(2U, tools::queue_full_policy::reject);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        queue.push(0U, i);
+        queue.push(1U, 10 + i);
+    }
+    EXPECT_EQ(2U, queue.size(0U));
+    EXPECT_EQ(2U, queue.dropped_count());
+
+    queue.reserve(2U, tools::queue_full_policy::overwrite_oldest);
+    queue.emplace(1U, 13);
+    EXPECT_EQ(3U, queue.dropped_count());
+
+    std::vector<int> drained;
+    for (auto item = queue.pop(); item.has_value(); item = queue.pop())
+    {
+        drained.push_back(*item);
+    }
+    EXPECT_EQ(drained, (std::vector<int> { 0, 1, 11, 13 }));
+}
+
+TEST(SyncLaneQueueTest, RangesKeepThePopOrder)
+{
+    tools::sync_lane_queue<int, 2U> queue;
+    queue.set_quota(2U);
+    const std::vector<int> urgent = { 0, 1, 2, 3 };
+    queue.push_range(0U, urgent.begin(), urgent.end());
+    queue.push(1U, 10);
+
+    std::vector<int> batch(8U, -1);
+    EXPECT_EQ(5U, queue.pop_range(batch.begin(), batch.end()));
+    batch.resize(5U);
+    EXPECT_EQ(batch, (std::vector<int> { 0, 1, 10, 2, 3 }));
+    EXPECT_EQ(0U, queue.pop_range(batch.begin(), batch.end()));
+}
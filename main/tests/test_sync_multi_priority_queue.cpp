@@ -0,0 +1,156 @@
+/**
+ * @file test_sync_multi_priority_queue.cpp
+ * @brief Unit tests for the relaxed sharded priority queue using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "tools/sync_multi_priority_queue.hpp"
+
+/**
+ * @brief Verifies a single shard behaves as a strict min-heap.
+ */
+TEST(SyncMultiPriorityQueueTest, SingleShardIsStrict)
+{
+    tools::sync_multi_priority_queue<int, std::greater<int>, 1U> queue;
+    EXPECT_TRUE(queue.empty());
+    queue.push_range({ 7, 3, 9, 1 });
+    queue.push(5);
+    queue.emplace(2);
+    EXPECT_EQ(6U, queue.size());
+
+    EXPECT_EQ(1, queue.top_pop().value_or(0));
+    std::array<int, 8> batch = {};
+    EXPECT_EQ(5U, queue.pop_range(batch.begin(), batch.end()));
+    EXPECT_EQ(2, batch[0]);
+    EXPECT_EQ(9, batch[4]);
+    EXPECT_FALSE(queue.top_pop_move().has_value());
+}
+
+/**
+ * @brief Verifies sharded pops return every element exactly once, and the best ones first overall.
+ */
+TEST(SyncMultiPriorityQueueTest, ShardedPopsDrainEverything)
+{
+    struct greater_value
+    {
+        bool operator()(const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) const
+        {
+            return *lhs > *rhs;
+        }
+    };
+
+    tools::sync_multi_priority_queue<std::unique_ptr<int>, greater_value, 4U> queue;
+    for (int i = 0; i < 64; ++i)
+    {
+        queue.push(std::make_unique<int>(i));
+    }
+    EXPECT_EQ(64U, queue.size());
+
+    std::vector<int> seen;
+    for (auto item = queue.top_pop_move(); item.has_value(); item = queue.top_pop_move())
+    {
+        seen.push_back(**item);
+    }
+    ASSERT_EQ(64U, seen.size());
+    // relaxed order: the first pops come from the low end
+    EXPECT_LT(seen.front(), 32);
+    std::sort(seen.begin(), seen.end());
+    for (int i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(i, seen[static_cast<std::size_t>(i)]);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @brief Verifies concurrent producers and consumers neither lose nor duplicate elements.
+ */
+TEST(SyncMultiPriorityQueueTest, ConcurrentProducersConsumers)
+{
+    constexpr int per_producer = 5000;
+    constexpr int producer_count = 4;
+    constexpr int total = per_producer * producer_count;
+    tools::sync_multi_priority_queue<int> queue;
+    EXPECT_TRUE((decltype(queue)::thread_safe::value));
+
+    std::atomic<int> consumed { 0 };
+    std::atomic<long long> sum { 0 };
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producer_count; ++producer)
+    {
+        threads.emplace_back(
+            [&queue, producer]()
+            {
+                for (int i = 0; i < per_producer; ++i)
+                {
+                    queue.push((producer * per_producer) + i);
+                }
+            });
+    }
+    for (int consumer = 0; consumer < 3; ++consumer)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                std::array<int, 16> batch = {};
+                while (consumed.load() < total)
+                {
+                    const std::size_t popped = queue.pop_range(batch.begin(), batch.end());
+                    for (std::size_t i = 0U; i < popped; ++i)
+                    {
+                        sum += batch[i];
+                    }
+                    consumed += static_cast<int>(popped);
+                    if (0U == popped)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(total, consumed.load());
+    EXPECT_EQ(static_cast<long long>(total) * (total - 1) / 2, sum.load());
+    EXPECT_TRUE(queue.empty());
+}
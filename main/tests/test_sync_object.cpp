@@ -213,3 +213,20 @@ TEST_F(SyncObjectTest, WaitForSignalTimeoutNotSignaled)
     EXPECT_GE(elapsed.count(), 100);
     EXPECT_FALSE(sync.is_signaled());
 }
+
+/**
+ * @brief Test case for consuming a signal without waiting.
+ *
+ * This test case checks that try_wait_for_signal reports and clears a pending signal,
+ * and returns false right away when the sync_object is not signaled.
+ */
+TEST_F(SyncObjectTest, TryWaitForSignal)
+{
+    tools::sync_object sync;
+    EXPECT_FALSE(sync.try_wait_for_signal());
+
+    sync.signal();
+    EXPECT_TRUE(sync.try_wait_for_signal());
+    EXPECT_FALSE(sync.is_signaled());
+    EXPECT_FALSE(sync.try_wait_for_signal());
+}
@@ -37,6 +37,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -443,3 +445,253 @@ TEST(SyncObserverPerfectForwardingTest, Cpp20RequiresConstraints)
     SUCCEED();
 }
 #endif
+
+/**
+ * @brief Observer that unsubscribes itself from its subject while being informed.
+ */
+class SelfUnsubscribingObserver : public tools::sync_observer<std::string, int>,
+                                  public std::enable_shared_from_this<SelfUnsubscribingObserver>
+{
+public:
+    explicit SelfUnsubscribingObserver(tools::sync_subject<std::string, int>& subject)
+        : subject_ref(subject)
+    {
+    }
+
+    void inform(const std::string& topic, const int& event, const std::string& /*origin*/) override
+    {
+        ++inform_count;
+        last_event = event;
+        subject_ref.unsubscribe(topic, shared_from_this());
+    }
+
+    tools::sync_subject<std::string, int>& subject_ref;
+    int inform_count = 0;
+    int last_event = 0;
+};
+
+/**
+ * @brief Verifies the snapshot dispatch policy delivers to observers and handlers of the published topic only.
+ */
+TEST(SyncObserverSnapshotDispatchTest, PublishReachesObserversAndHandlers)
+{
+    tools::sync_subject<std::string, int> subject("SnapshotSubject", tools::subject_dispatch_policy::snapshot);
+    EXPECT_EQ(subject.dispatch_policy(), tools::subject_dispatch_policy::snapshot);
+
+    auto observer = std::make_shared<TestObserver>();
+    int handler_sum = 0;
+
+    subject.subscribe("Topic1", observer);
+    subject.subscribe("Topic1", "sum_handler",
+        [&](const std::string&, const int& event, const std::string&) { handler_sum += event; });
+
+    subject.publish("Topic1", 42);
+    EXPECT_EQ(observer->last_topic, "Topic1");
+    EXPECT_EQ(observer->last_event, 42);
+    EXPECT_EQ(observer->last_origin, "SnapshotSubject");
+    EXPECT_EQ(handler_sum, 42);
+
+    subject.publish("Topic2", 100);
+    EXPECT_EQ(observer->last_event, 42);
+    EXPECT_EQ(handler_sum, 42);
+}
+
+/**
+ * @brief Verifies the snapshot dispatch policy reflects unsubscriptions on the next publish.
+ */
+TEST(SyncObserverSnapshotDispatchTest, UnsubscribeRebuildsSnapshot)
+{
+    tools::sync_subject<std::string, int> subject("SnapshotSubject", tools::subject_dispatch_policy::snapshot);
+    auto observer = std::make_shared<TestObserver>();
+    int handler_calls = 0;
+
+    subject.subscribe("Topic", observer);
+    subject.subscribe("Topic", "counter", [&](const std::string&, const int&, const std::string&) { ++handler_calls; });
+
+    subject.publish("Topic", 1);
+    subject.unsubscribe("Topic", observer);
+    subject.unsubscribe("Topic", "counter");
+    subject.publish("Topic", 2);
+
+    EXPECT_EQ(observer->last_event, 1);
+    EXPECT_EQ(handler_calls, 1);
+}
+
+/**
+ * @brief Verifies an observer can unsubscribe itself during a snapshot publish without deadlock.
+ */
+TEST(SyncObserverSnapshotDispatchTest, ObserverCanUnsubscribeDuringPublish)
+{
+    tools::sync_subject<std::string, int> subject("SnapshotSubject", tools::subject_dispatch_policy::snapshot);
+    auto observer = std::make_shared<SelfUnsubscribingObserver>(subject);
+
+    subject.subscribe("Topic", observer);
+    subject.publish("Topic", 7);
+    subject.publish("Topic", 8);
+
+    EXPECT_EQ(observer->inform_count, 1);
+    EXPECT_EQ(observer->last_event, 7);
+}
+
+/**
+ * @brief Verifies concurrent publish and subscription churn in snapshot mode completes without crashes.
+ */
+TEST(SyncObserverSnapshotDispatchTest, ConcurrentPublishAndSubscribe)
+{
+    tools::sync_subject<std::string, int> subject("SnapshotSubject", tools::subject_dispatch_policy::snapshot);
+    auto stable_observer = std::make_shared<TestObserver>();
+    auto churn_observer = std::make_shared<TestObserver>();
+    subject.subscribe("Topic", stable_observer);
+
+    std::thread publisher(
+        [&]()
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                subject.publish("Topic", i);
+            }
+        });
+
+    std::thread subscriber(
+        [&]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                subject.subscribe("Topic", churn_observer);
+                subject.unsubscribe("Topic", churn_observer);
+            }
+        });
+
+    publisher.join();
+    subscriber.join();
+
+    EXPECT_EQ(stable_observer->last_event, 199);
+}
+
+/**
+ * @brief Verifies the epoch dispatch policy delivers to the receivers of the published topic and follows
+ * unsubscriptions, including an observer unsubscribing itself while being informed.
+ */
+TEST(SyncObserverEpochDispatchTest, PublishFollowsSubscriptionChanges)
+{
+    tools::sync_subject<std::string, int> subject("EpochSubject", tools::subject_dispatch_policy::epoch);
+    EXPECT_EQ(subject.dispatch_policy(), tools::subject_dispatch_policy::epoch);
+
+    auto observer = std::make_shared<TestObserver>();
+    auto self_unsubscribing = std::make_shared<SelfUnsubscribingObserver>(subject);
+    int handler_sum = 0;
+
+    subject.publish("Topic", 1);
+    subject.subscribe("Topic", observer);
+    subject.subscribe("Topic", self_unsubscribing);
+    subject.subscribe("Topic", "sum_handler",
+        [&](const std::string&, const int& event, const std::string&) { handler_sum += event; });
+
+    subject.publish("Topic", 7);
+    subject.publish("Other", 100);
+    EXPECT_EQ(observer->last_event, 7);
+    EXPECT_EQ(observer->last_origin, "EpochSubject");
+    EXPECT_EQ(self_unsubscribing->inform_count, 1);
+    EXPECT_EQ(handler_sum, 7);
+
+    subject.unsubscribe("Topic", observer);
+    subject.unsubscribe("Topic", "sum_handler");
+    subject.publish_shared("Topic", 8);
+    EXPECT_EQ(observer->last_event, 7);
+    EXPECT_EQ(self_unsubscribing->inform_count, 1);
+    EXPECT_EQ(handler_sum, 7);
+}
+
+/**
+ * @brief Verifies concurrent publish and subscription churn in epoch mode, the unsubscribed observer being
+ * released once no publish can reach it anymore.
+ */
+TEST(SyncObserverEpochDispatchTest, ConcurrentPublishAndSubscribe)
+{
+    tools::sync_subject<std::string, int> subject("EpochSubject", tools::subject_dispatch_policy::epoch);
+    auto stable_observer = std::make_shared<TestObserver>();
+    auto churn_observer = std::make_shared<TestObserver>();
+    subject.subscribe("Topic", stable_observer);
+
+    std::thread publisher(
+        [&]()
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                subject.publish("Topic", i);
+            }
+        });
+
+    std::thread subscriber(
+        [&]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                subject.subscribe("Topic", churn_observer);
+                subject.unsubscribe("Topic", churn_observer);
+            }
+        });
+
+    publisher.join();
+    subscriber.join();
+
+    EXPECT_EQ(stable_observer->last_event, 199);
+
+    const std::weak_ptr<TestObserver> released = churn_observer;
+    churn_observer.reset();
+    subject.unsubscribe("Topic", stable_observer);
+    EXPECT_TRUE(released.expired());
+}
+
+/**
+ * @brief Test that a subscription filter rejects events on the publisher side, with every dispatch policy.
+ */
+TEST(SyncObserverFilterTest, FilterRejectsEventsBeforeInform)
+{
+    for (const auto policy :
+        { tools::subject_dispatch_policy::copy_on_publish, tools::subject_dispatch_policy::snapshot,
+            tools::subject_dispatch_policy::epoch })
+    {
+        tools::sync_subject<std::string, int> subject("FilterSubject", policy);
+        auto filtered_observer = std::make_shared<TestObserver>();
+        auto plain_observer = std::make_shared<TestObserver>();
+        filtered_observer->last_event = -1;
+        subject.subscribe("Topic", filtered_observer,
+            [](const std::string& /*topic*/, const int& event) { return event >= 10; });
+        subject.subscribe("Topic", plain_observer);
+
+        subject.publish("Topic", 12);
+        EXPECT_EQ(filtered_observer->last_event, 12);
+        subject.publish("Topic", 3);
+        EXPECT_EQ(filtered_observer->last_event, 12);
+        EXPECT_EQ(plain_observer->last_event, 3);
+        subject.publish_shared("Topic", 4);
+        EXPECT_EQ(filtered_observer->last_event, 12);
+        EXPECT_EQ(plain_observer->last_event, 4);
+        EXPECT_EQ(subject.filtered_informs(), 2U);
+
+        subject.unsubscribe("Topic", filtered_observer);
+        subject.publish("Topic", 20);
+        EXPECT_EQ(filtered_observer->last_event, 12);
+        EXPECT_EQ(subject.filtered_informs(), 2U);
+    }
+}
+
+/**
+ * @brief Test that publish_range informs plain observers once per event through the default inform_range.
+ */
+TEST(SyncObserverBatchTest, DefaultInformRangeInformsEachEvent)
+{
+    tools::sync_subject<std::string, int> subject("BatchSubject");
+    auto observer = std::make_shared<TestObserver>();
+    subject.subscribe("Topic", observer);
+
+    const std::array<int, 3U> batch { 7, 8, 9 };
+    subject.publish_range("Topic", batch.data(), batch.size());
+    EXPECT_EQ(observer->last_event, 9);
+    EXPECT_EQ(observer->last_topic, "Topic");
+    EXPECT_EQ(observer->last_origin, "BatchSubject");
+
+    subject.publish_range("Topic", batch.data(), 0U);
+    EXPECT_EQ(observer->last_event, 9);
+}
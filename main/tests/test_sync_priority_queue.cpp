@@ -30,9 +30,12 @@
  * @date January 2025
  */
 
+#include <array>
+#include <chrono>
 #include <functional>
 #include <gtest/gtest.h>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -401,4 +404,54 @@ namespace
         EXPECT_EQ(expected, num_elements + 1);
     }
 
+    /**
+     * @brief Verifies wait_pop returns the top element and wait_pop_range data pushed by another thread.
+     */
+    TEST(SyncPriorityQueueWaitTest, WaitPopReturnsTopAndWakesOnPush)
+    {
+        tools::sync_priority_queue<int> queue;
+        EXPECT_FALSE(queue.wait_pop(std::chrono::milliseconds(1)).has_value());
+        queue.push_range({ 3, 9, 5 });
+        EXPECT_EQ(3, queue.wait_pop(std::chrono::microseconds(0)).value_or(0));
+
+        std::array<int, 4> batch = {};
+        EXPECT_EQ(2U, queue.wait_pop_range(batch.begin(), batch.end(), std::chrono::microseconds(0)));
+        EXPECT_EQ(5, batch[0]);
+
+        std::thread producer(
+            [&queue]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                queue.emplace(7);
+            });
+        EXPECT_EQ(1U, queue.wait_pop_range(batch.begin(), batch.end(), std::chrono::seconds(10)));
+        producer.join();
+        EXPECT_EQ(7, batch[0]);
+    }
+
+    /**
+     * @brief Verifies the dary_heap-backed queue keeps the priority order through bulk push and batch pop.
+     */
+    TEST(SyncDaryPriorityQueueTest, BulkPushAndBatchPopInOrder)
+    {
+        tools::sync_dary_priority_queue<int> queue;
+        std::vector<int> values(200);
+        for (std::size_t i = 0U; i < values.size(); ++i)
+        {
+            values[i] = static_cast<int>((i * 37U) % values.size());
+        }
+        queue.push_range(values);
+        queue.push(-1);
+        EXPECT_EQ(201U, queue.size());
+        EXPECT_EQ(-1, queue.top_pop_move().value_or(0));
+
+        std::vector<int> drained(values.size());
+        EXPECT_EQ(values.size(), queue.pop_range(drained.begin(), drained.end()));
+        for (std::size_t i = 0U; i < drained.size(); ++i)
+        {
+            EXPECT_EQ(static_cast<int>(i), drained[i]);
+        }
+        EXPECT_FALSE(queue.wait_pop(std::chrono::microseconds(0)).has_value());
+    }
+
 } // namespace
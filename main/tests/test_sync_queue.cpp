@@ -51,6 +51,8 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <complex>
 #include <concepts>
 #include <memory>
@@ -1014,3 +1016,121 @@ TEST(SyncQueueRangeTest, PopRangeWithSpanReturnsCount)
 }
 
 #endif
+
+/**
+ * @brief Verifies wait_pop times out on an empty queue and returns data pushed by another thread.
+ */
+TEST(SyncQueueWaitTest, WaitPopTimesOutAndWakesOnPush)
+{
+    tools::sync_queue<std::unique_ptr<int>> queue;
+    EXPECT_FALSE(queue.wait_pop(std::chrono::microseconds(0)).has_value());
+    EXPECT_FALSE(queue.wait_pop(std::chrono::milliseconds(2)).has_value());
+
+    std::thread producer(
+        [&queue]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            queue.emplace(std::make_unique<int>(42));
+        });
+    auto item = queue.wait_pop(std::chrono::seconds(10));
+    producer.join();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(42, **item);
+}
+
+/**
+ * @brief Verifies several consumers blocked in wait_pop/wait_pop_range all receive what is pushed.
+ */
+TEST(SyncQueueWaitTest, ParkedConsumersDrainEveryItem)
+{
+    constexpr int item_count = 4000;
+    tools::sync_queue<int> queue;
+    std::atomic<int> consumed { 0 };
+
+    auto single_consumer = [&]()
+    {
+        while (consumed.load() < item_count)
+        {
+            if (queue.wait_pop(std::chrono::milliseconds(1)).has_value())
+            {
+                ++consumed;
+            }
+        }
+    };
+    auto batch_consumer = [&]()
+    {
+        std::array<int, 8> batch = {};
+        while (consumed.load() < item_count)
+        {
+            const std::size_t popped = queue.wait_pop_range(batch.begin(), batch.end(), std::chrono::milliseconds(1));
+            consumed += static_cast<int>(popped);
+        }
+    };
+
+    std::thread consumer1(single_consumer);
+    std::thread consumer2(batch_consumer);
+    for (int i = 0; i < item_count; ++i)
+    {
+        queue.push(i);
+        if (0 == (i % 64))
+        {
+            std::this_thread::yield();
+        }
+    }
+    consumer1.join();
+    consumer2.join();
+    EXPECT_EQ(item_count, consumed.load());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedSyncQueueTest, RejectsOrOverwritesWhenFull)
+{
+    tools::bounded_sync_queue<int> rejecting(4U);
+    rejecting.push_range({ 1, 2, 3, 4, 5, 6 });
+    EXPECT_EQ(4U, rejecting.size());
+    EXPECT_EQ(4U, rejecting.capacity());
+    EXPECT_EQ(2U, rejecting.dropped_count());
+    EXPECT_EQ(1, rejecting.front_pop().value_or(0));
+    EXPECT_EQ(4, rejecting.back().value_or(0));
+
+    tools::bounded_sync_queue<std::unique_ptr<int>> overwriting(2U, tools::queue_full_policy::overwrite_oldest);
+    for (int i = 0; i < 5; ++i)
+    {
+        overwriting.push(std::make_unique<int>(i));
+    }
+    EXPECT_EQ(3U, overwriting.dropped_count());
+    auto oldest = overwriting.wait_pop(std::chrono::microseconds(0));
+    ASSERT_TRUE(oldest.has_value());
+    EXPECT_EQ(3, **oldest);
+
+    const auto copy = rejecting.snapshot();
+    EXPECT_EQ(3U, copy.size());
+    EXPECT_EQ(4U, copy.capacity());
+}
+
+/**
+ * @brief Verifies visit and visit_range walk the elements in place, front first, for both container kinds.
+ */
+TEST(SyncQueueVisitTest, VisitsInPlaceFrontFirst)
+{
+    tools::sync_queue<int> queue;
+    queue.push_range({ 1, 2, 3, 4 });
+    std::vector<int> seen;
+    EXPECT_EQ(4U, queue.visit([&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 1, 2, 3, 4 }), seen);
+    seen.clear();
+    EXPECT_EQ(2U, queue.visit_range(2U, [&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 1, 2 }), seen);
+    EXPECT_EQ(4U, queue.size());
+
+    // wrap the ring past its end so the visit crosses it
+    tools::bounded_sync_queue<int> bounded(4U, tools::queue_full_policy::overwrite_oldest);
+    bounded.push_range({ 1, 2, 3, 4, 5, 6 });
+    seen.clear();
+    EXPECT_EQ(4U, bounded.visit([&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4, 5, 6 }), seen);
+    seen.clear();
+    EXPECT_EQ(3U, bounded.visit_range(3U, [&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4, 5 }), seen);
+    EXPECT_EQ(4U, bounded.visit_range(10U, [](const int& /*item*/) {}));
+}
@@ -869,3 +869,183 @@ TEST(SyncRingBufferPerfectForwardingTest, Cpp20RequiresConstraints)
     SUCCEED();
 }
 #endif
+
+/**
+ * @brief Verifies the locked push_span/pop_span of the thread-safe ring buffer.
+ */
+TEST(SyncRingBufferSpanTest, PushSpanPopSpan)
+{
+    tools::sync_ring_buffer<int, 4> ring;
+    const std::array<int, 6> source = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(4U, ring.push_span(source.data(), source.size()));
+    EXPECT_TRUE(ring.full());
+
+    std::array<int, 3> destination = {};
+    EXPECT_EQ(3U, ring.pop_span(destination.data(), destination.size()));
+    EXPECT_EQ(3, destination[2]);
+    EXPECT_EQ(1U, ring.size());
+}
+
+/**
+ * @brief Policy-parameterized fixture: the same calls must work on the locked and the lock-free buffers.
+ */
+template <typename Buffer>
+class SyncRingBufferPolicyTest : public ::testing::Test
+{
+};
+
+using sync_ring_buffer_policies = ::testing::Types<tools::sync_ring_buffer<int, 8>,
+    tools::sync_ring_buffer<int, 8, tools::ring_concurrency::spsc_lock_free>,
+    tools::sync_ring_buffer<int, 8, tools::ring_concurrency::mpmc_lock_free>>;
+TYPED_TEST_SUITE(SyncRingBufferPolicyTest, sync_ring_buffer_policies);
+
+/**
+ * @brief Verifies the API shared by every concurrency policy.
+ */
+TYPED_TEST(SyncRingBufferPolicyTest, CommonApi)
+{
+    TypeParam ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(8U, ring.capacity());
+
+    EXPECT_TRUE(ring.push(1));
+    EXPECT_TRUE(ring.emplace(2));
+    EXPECT_EQ(2U, ring.push_range(std::vector<int> { 3, 4 }));
+    EXPECT_EQ(2U, ring.push_range({ 5, 6 }));
+    const std::array<int, 4> block = { 7, 8, 9, 10 };
+    EXPECT_EQ(2U, ring.push_span(block.data(), block.size()));
+    EXPECT_TRUE(ring.full());
+    EXPECT_TRUE(ring.isr_full());
+    EXPECT_FALSE(ring.push(11));
+    ring.isr_push(12);
+    EXPECT_EQ(8U, ring.isr_size());
+
+    ring.pop();
+    EXPECT_EQ(2, ring.front_pop().value_or(0));
+    EXPECT_EQ(3, ring.front_pop_move().value_or(0));
+
+    std::array<int, 2> pair = {};
+    EXPECT_EQ(2U, ring.pop_range(pair.begin(), pair.end()));
+    EXPECT_EQ(5, pair[1]);
+
+    ring.isr_emplace(13);
+    EXPECT_EQ(1U, ring.isr_push_range({ 14 }));
+    std::array<int, 8> rest = {};
+    EXPECT_EQ(5U, ring.pop_span(rest.data(), rest.size()));
+    EXPECT_EQ(6, rest[0]);
+    EXPECT_EQ(14, rest[4]);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.front_pop_move().has_value());
+}
+
+/**
+ * @brief Verifies the spsc policy carries move-only payloads between two threads.
+ */
+TEST(SyncRingBufferPolicyThreadsTest, SpscMoveOnlyProducerConsumer)
+{
+    constexpr int item_count = 10000;
+    tools::sync_ring_buffer<std::unique_ptr<int>, 16, tools::ring_concurrency::spsc_lock_free> ring;
+
+    std::thread producer(
+        [&ring]()
+        {
+            for (int i = 0; i < item_count; ++i)
+            {
+                while (!ring.emplace(std::make_unique<int>(i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    int expected = 0;
+    while (expected < item_count)
+    {
+        auto item = ring.front_pop_move();
+        if (item.has_value())
+        {
+            ASSERT_EQ(expected, **item);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+/**
+ * @brief Verifies the mpmc policy with concurrent producers and consumers: every item arrives once.
+ */
+TEST(SyncRingBufferPolicyThreadsTest, MpmcProducersConsumers)
+{
+    constexpr int per_producer = 5000;
+    constexpr int producer_count = 2;
+    tools::sync_ring_buffer<int, 32, tools::ring_concurrency::mpmc_lock_free> ring;
+    EXPECT_TRUE((decltype(ring)::thread_safe::value));
+
+    std::atomic<int> consumed { 0 };
+    std::atomic<long long> sum { 0 };
+    auto consumer = [&]()
+    {
+        while (consumed.load() < (per_producer * producer_count))
+        {
+            auto item = ring.front_pop();
+            if (item.has_value())
+            {
+                sum += *item;
+                ++consumed;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+    auto producer = [&ring]()
+    {
+        for (int i = 1; i <= per_producer; ++i)
+        {
+            while (!ring.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::thread consumer1(consumer);
+    std::thread consumer2(consumer);
+    std::thread producer1(producer);
+    std::thread producer2(producer);
+    producer1.join();
+    producer2.join();
+    consumer1.join();
+    consumer2.join();
+
+    const long long expected_sum = static_cast<long long>(per_producer) * (per_producer + 1) / 2 * producer_count;
+    EXPECT_EQ(expected_sum, sum.load());
+    EXPECT_TRUE(ring.empty());
+}
+
+/**
+ * @brief Verifies visit and visit_range walk the elements in place, oldest first, across the wrap point.
+ */
+TEST(SyncRingBufferVisitTest, VisitsInPlaceOldestFirst)
+{
+    tools::sync_ring_buffer<int, 4U> ring;
+    ring.push_range({ 1, 2, 3 });
+    ring.pop();
+    ring.pop();
+    ring.push_range({ 4, 5, 6 });
+
+    std::vector<int> seen;
+    EXPECT_EQ(4U, ring.visit([&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4, 5, 6 }), seen);
+    seen.clear();
+    EXPECT_EQ(3U, ring.visit_range(3U, [&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4, 5 }), seen);
+    EXPECT_EQ(0U, ring.visit_range(0U, [&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ(4U, ring.size());
+}
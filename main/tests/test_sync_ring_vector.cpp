@@ -39,6 +39,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <chrono>
 #include <complex>
 #include <memory>
 #include <string>
@@ -193,6 +194,28 @@ TYPED_TEST(SyncRingVectorTest, Resize)
     EXPECT_EQ(this->vec->capacity(), 10);
 }
 
+/**
+ * @brief Test case for resizing a SyncRingVector to its element count, within reserved storage.
+ */
+TEST(SyncRingVectorResizeTest, ResizeToElementCountAndReserve)
+{
+    tools::sync_ring_vector<int> vec(5U);
+    vec.reserve(12U);
+    EXPECT_TRUE(vec.push(1));
+    EXPECT_TRUE(vec.push(2));
+    EXPECT_TRUE(vec.push(3));
+
+    // capacity changes even though it matches the current element count
+    vec.resize(3U);
+    EXPECT_EQ(3U, vec.capacity());
+    EXPECT_TRUE(vec.full());
+
+    vec.resize(12U);
+    EXPECT_EQ(12U, vec.capacity());
+    EXPECT_EQ(1, vec.front().value());
+    EXPECT_EQ(3, vec.back().value());
+}
+
 /**
  * @brief Test case for ISR push and ISR size operations in SyncRingVector.
  *
@@ -817,3 +840,53 @@ TEST(SyncRingVectorPerfectForwardingTest, Cpp20RequiresConstraints)
     SUCCEED();
 }
 #endif
+
+/**
+ * @brief Verifies wait_pop and the span wait_pop_range of the ring vector, including ISR-side pushes.
+ */
+TEST(SyncRingVectorWaitTest, WaitPopAndWaitPopRange)
+{
+    tools::sync_ring_vector<int> ring(8U);
+    EXPECT_FALSE(ring.wait_pop(std::chrono::milliseconds(1)).has_value());
+
+    std::thread producer(
+        [&ring]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            ring.isr_push(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            EXPECT_EQ(3U, ring.push_range({ 2, 3, 4 }));
+        });
+
+    EXPECT_EQ(1, ring.wait_pop(std::chrono::seconds(10)).value_or(0));
+    std::array<int, 8> batch = {};
+    std::size_t received = 0U;
+    while (received < 3U)
+    {
+        received += ring.wait_pop_range(batch.begin() + received, batch.end(), std::chrono::seconds(10));
+    }
+    producer.join();
+    EXPECT_EQ(2, batch[0]);
+    EXPECT_EQ(4, batch[2]);
+    EXPECT_TRUE(ring.empty());
+}
+
+/**
+ * @brief Verifies visit and visit_range walk the elements in place, oldest first, across the wrap point.
+ */
+TEST(SyncRingVectorVisitTest, VisitsInPlaceOldestFirst)
+{
+    tools::sync_ring_vector<int> ring(4U);
+    ring.push_range({ 1, 2, 3 });
+    ring.pop();
+    ring.pop();
+    ring.push_range({ 4, 5, 6 });
+
+    std::vector<int> seen;
+    EXPECT_EQ(4U, ring.visit([&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4, 5, 6 }), seen);
+    seen.clear();
+    EXPECT_EQ(2U, ring.visit_range(2U, [&seen](const int& item) { seen.push_back(item); }));
+    EXPECT_EQ((std::vector<int> { 3, 4 }), seen);
+    EXPECT_EQ(4U, ring.size());
+}
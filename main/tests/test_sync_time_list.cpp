@@ -43,7 +43,9 @@
 #include <thread>
 #include <vector>
 
+#include "tools/sorted_time_list.hpp"
 #include "tools/sync_time_list.hpp"
+#include "tools/windowed_time_list.hpp"
 
 /**
  * @brief Fixture for tools::sync_time_list tests.
@@ -172,3 +174,43 @@ TEST_F(SyncTimeListTest, ConcurrentProducersMaintainTotalCountAndOrder)
     EXPECT_EQ(
         snapshot_values.back().first, producer_b_start + static_cast<long>(inserts_per_producer) - timestamp_step);
 }
+
+TEST(SyncSortedTimeListTest, WindowVisitAndBatchPopUnderLock)
+{
+    tools::sync_time_list<long, int, tools::sorted_time_list<long, int>> sorted_list;
+
+    for (long timestamp_value = 1L; timestamp_value <= 10L; ++timestamp_value)
+    {
+        sorted_list.push(timestamp_value, static_cast<int>(timestamp_value) * 10);
+    }
+
+    int window_sum = 0;
+    EXPECT_EQ(sorted_list.visit_range(3L, 6L, [&window_sum](const auto& entry) { window_sum += entry.second; }), 3U);
+    EXPECT_EQ(window_sum, 120);
+
+    std::vector<long> drained;
+    EXPECT_EQ(sorted_list.pop_until(4L, [&drained](auto&& entry) { drained.push_back(entry.first); }), 4U);
+    EXPECT_EQ(drained, (std::vector<long> { 1L, 2L, 3L, 4L }));
+    EXPECT_EQ(sorted_list.size(), 6U);
+    EXPECT_EQ(sorted_list.top()->first, 5L);
+}
+
+TEST(SyncWindowedTimeListTest, HorizonEvictionAndBatchPopUnderLock)
+{
+    tools::sync_time_list<long, int, tools::windowed_time_list<long, int>> windowed_list(8U, 5L);
+
+    for (long timestamp_value = 1L; timestamp_value <= 10L; ++timestamp_value)
+    {
+        windowed_list.push(timestamp_value, static_cast<int>(timestamp_value));
+    }
+
+    EXPECT_EQ(windowed_list.size(), 6U);
+    EXPECT_EQ(windowed_list.top()->first, 5L);
+    EXPECT_EQ(windowed_list.evicted_count(), 4U);
+
+    std::vector<long> drained;
+    EXPECT_EQ(windowed_list.pop_until(7L, [&drained](auto&& entry) { drained.push_back(entry.first); }), 3U);
+    EXPECT_EQ(drained, (std::vector<long> { 5L, 6L, 7L }));
+    EXPECT_EQ(windowed_list.expire(16L), 3U);
+    EXPECT_TRUE(windowed_list.empty());
+}
@@ -0,0 +1,181 @@
+/**
+ * @file test_table_fsm.cpp
+ * @brief Unit tests for the table-driven finite state machine.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tools/async_observer.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/table_fsm.hpp"
+
+namespace
+{
+    enum class light_state : std::uint8_t
+    {
+        off,
+        red,
+        green,
+        count
+    };
+
+    enum class light_event : std::uint8_t
+    {
+        power_on,
+        power_off,
+        next,
+        count
+    };
+
+    struct light
+    {
+        std::vector<std::string> trace;
+        std::uint32_t last_payload = 0U;
+    };
+
+    using light_fsm = tools::table_fsm<light_state, light_event, light, std::uint32_t>;
+
+    void enter_red(light& context)
+    {
+        context.trace.emplace_back("enter red");
+    }
+
+    void exit_red(light& context)
+    {
+        context.trace.emplace_back("exit red");
+    }
+
+    void enter_green(light& context)
+    {
+        context.trace.emplace_back("enter green");
+    }
+
+    void switch_light(light& context, const std::uint32_t& payload)
+    {
+        context.trace.emplace_back("switch");
+        context.last_payload = payload;
+    }
+
+    constexpr auto light_table = light_fsm::make_table(
+        std::array {
+            light_fsm::transition { light_state::off, light_event::power_on, light_state::red },
+            light_fsm::transition { light_state::red, light_event::next, light_state::green, switch_light },
+            light_fsm::transition { light_state::green, light_event::next, light_state::red, switch_light },
+            light_fsm::transition { light_state::red, light_event::power_off, light_state::off },
+            light_fsm::transition { light_state::green, light_event::power_off, light_state::off },
+        },
+        std::array {
+            light_fsm::state_actions {},
+            light_fsm::state_actions { enter_red, exit_red },
+            light_fsm::state_actions { enter_green, nullptr },
+        });
+
+    // the grid is built at compile time
+    static_assert(static_cast<std::uint8_t>(light_state::green)
+        == light_table.cells[(static_cast<std::size_t>(light_state::red) * light_fsm::event_count)
+            + static_cast<std::size_t>(light_event::next)]
+               .target);
+    static_assert(light_fsm::no_target == light_table.cells[static_cast<std::size_t>(light_event::next)].target);
+}
+
+/**
+ * @brief Transitions run the exit, transition and entry actions in order, and unknown events are counted.
+ *
+ * @test
+ * - Starts in off (no entry action), powers on and cycles red -> green -> red, checking the action trace.
+ * - Checks that next in off is ignored and counted, and that handles() agrees with the table.
+ */
+TEST(TableFsmTest, RunsActionsInOrder)
+{
+    light context;
+    light_fsm fsm(light_table, context, light_state::off);
+    fsm.start();
+    EXPECT_EQ(light_state::off, fsm.state());
+    EXPECT_TRUE(context.trace.empty());
+
+    EXPECT_FALSE(fsm.handles(light_event::next));
+    EXPECT_FALSE(fsm.dispatch(light_event::next));
+    EXPECT_EQ(1U, fsm.unhandled_count());
+    EXPECT_EQ(light_state::off, fsm.state());
+
+    EXPECT_TRUE(fsm.dispatch(light_event::power_on));
+    EXPECT_TRUE(fsm.dispatch(light_event::next, 7U));
+    EXPECT_TRUE(fsm.dispatch(light_event::next, 8U));
+    EXPECT_EQ(light_state::red, fsm.state());
+    EXPECT_EQ(8U, context.last_payload);
+    EXPECT_EQ(3U, fsm.transition_count());
+
+    const std::vector<std::string> expected { "enter red", "exit red", "switch", "enter green", "switch",
+        "enter red" };
+    EXPECT_EQ(expected, context.trace);
+
+    EXPECT_TRUE(fsm.dispatch(light_event::power_off));
+    EXPECT_EQ(light_state::off, fsm.state());
+    EXPECT_EQ("exit red", context.trace.back());
+}
+
+/**
+ * @brief Events queued in an async_observer are dispatched in FIFO order, across several batches.
+ *
+ * @test
+ * - Queues power_on, then ten next events with payloads, and drains them in batches of four.
+ * - Checks the events processed, the final state and the last payload seen by a transition action.
+ */
+TEST(TableFsmTest, ProcessesEventsQueuedInAnAsyncObserver)
+{
+    using light_fsm_event = tools::fsm_event<light_event, std::uint32_t>;
+    tools::async_observer<std::string, light_fsm_event, tools::sync_queue> observer;
+
+    light context;
+    light_fsm fsm(light_table, context, light_state::off);
+    fsm.start();
+
+    observer.inform(std::string("light"), light_fsm_event { light_event::power_on, 0U }, std::string("test"));
+    for (std::uint32_t index = 1U; index <= 10U; ++index)
+    {
+        observer.inform(std::string("light"), light_fsm_event { light_event::next, index }, std::string("test"));
+    }
+
+    EXPECT_EQ(11U, fsm.process_events<4U>(observer));
+    EXPECT_FALSE(observer.has_events());
+    EXPECT_EQ(light_state::red, fsm.state());
+    EXPECT_EQ(10U, context.last_payload);
+    EXPECT_EQ(11U, fsm.transition_count());
+    EXPECT_EQ(0U, fsm.process_events(observer));
+}
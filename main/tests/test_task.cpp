@@ -0,0 +1,401 @@
+/**
+ * @file test_task.cpp
+ * @brief Unit tests for the tools::task coroutine type and its awaitables using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/data_task.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/sync_object.hpp"
+#include "tools/task.hpp"
+#include "tools/timer_scheduler.hpp"
+#include "tools/worker_task.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace
+{
+    struct TaskTestContext
+    {
+    };
+
+    using worker_type = tools::worker_task<TaskTestContext>;
+    using context_type = tools::await_context<worker_type::executor_type>;
+    using micros = std::chrono::duration<std::uint64_t, std::micro>;
+
+    template <typename Predicate>
+    bool wait_until(Predicate&& predicate, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000))
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    tools::task<int> answer(int base)
+    {
+        co_return base + 1;
+    }
+
+    tools::task<int> sum_answers(int count)
+    {
+        int total = 0;
+        for (int index = 0; index < count; ++index)
+        {
+            total += co_await answer(index);
+        }
+        co_return total;
+    }
+
+    tools::task<void> increment(int& value)
+    {
+        ++value;
+        co_return;
+    }
+
+    tools::task<std::string> greet()
+    {
+        int value = 0;
+        co_await increment(value);
+        co_await increment(value);
+        co_return std::string("hello ") + std::to_string(value);
+    }
+
+    class TaskCoroutineTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            worker = std::make_unique<worker_type>([](const std::shared_ptr<TaskTestContext>&, const std::string&) {},
+                std::make_shared<TaskTestContext>(), "coro_worker", 4096);
+            context.timers = &timers;
+        }
+
+        // the timers are declared last so that their thread is joined before the worker they post to goes away
+        std::unique_ptr<worker_type> worker;
+        tools::timer_scheduler timers;
+        context_type context { nullptr, worker_type::executor_type { nullptr } };
+    };
+}
+
+/**
+ * @brief Tests that nested tasks run lazily and deliver their values through symmetric transfer.
+ */
+TEST(TaskTest, NestedTasksDeliverValues)
+{
+    auto root = sum_answers(10);
+    EXPECT_FALSE(root.done());
+
+    root.start();
+    ASSERT_TRUE(root.done());
+
+    auto value = root.get();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value.value(), 55);
+    EXPECT_FALSE(root.get().has_value());
+
+    auto text = greet();
+    text.start();
+    EXPECT_EQ(text.get().value_or(""), "hello 2");
+}
+
+/**
+ * @brief Tests that a long chain of synchronously completing awaits resumes its awaiter each time.
+ *
+ * The count stays moderate: symmetric transfer only becomes a tail call with optimizations enabled.
+ */
+TEST(TaskTest, LongAwaitChainCompletes)
+{
+    constexpr int count = 1000;
+    auto root = sum_answers(count);
+    root.start();
+
+    ASSERT_TRUE(root.done());
+    EXPECT_EQ(root.get().value_or(0), (count * (count + 1)) / 2);
+}
+
+/**
+ * @brief Tests that coroutine frames are recycled by the frame pool.
+ */
+TEST(TaskTest, FramesAreReused)
+{
+    {
+        auto warmup = answer(0);
+        warmup.start();
+    }
+
+    const auto before = tools::coro_frame_pool_stats();
+    for (int index = 0; index < 16; ++index)
+    {
+        auto item = answer(index);
+        item.start();
+    }
+    const auto after = tools::coro_frame_pool_stats();
+
+    EXPECT_EQ(after.allocations - before.allocations, 16U);
+    EXPECT_EQ(after.reuses - before.reuses, 16U);
+    EXPECT_GE(after.cached, 1U);
+}
+
+/**
+ * @brief Tests that a task never started releases its frame.
+ */
+TEST(TaskTest, UnstartedTaskIsDestroyed)
+{
+    const auto before = tools::coro_frame_pool_stats();
+    {
+        auto item = answer(1);
+        EXPECT_TRUE(item.valid());
+        EXPECT_FALSE(item.done());
+
+        auto moved = std::move(item);
+        EXPECT_FALSE(item.valid()); // NOLINT checks the moved-from state
+        EXPECT_TRUE(moved.valid());
+    }
+    const auto after = tools::coro_frame_pool_stats();
+
+    EXPECT_EQ(after.allocations - before.allocations, 1U);
+    EXPECT_EQ(after.cached, before.cached);
+}
+
+/**
+ * @brief Tests that a spawned coroutine suspended on a delay resumes on the worker thread.
+ */
+TEST_F(TaskCoroutineTest, DelayResumesOnWorker)
+{
+    context.executor = worker->as_executor();
+
+    std::atomic<bool> finished { false };
+    std::thread::id resumed_on;
+    std::thread::id started_on;
+    const auto start_time = std::chrono::steady_clock::now();
+
+    auto handler = [&]() -> tools::task<void>
+    {
+        started_on = std::this_thread::get_id();
+        co_await tools::async_delay(context, micros(5000U));
+        resumed_on = std::this_thread::get_id();
+        finished.store(true);
+    };
+
+    tools::spawn(worker->as_executor(), handler());
+
+    ASSERT_TRUE(wait_until([&]() { return finished.load(); }));
+    EXPECT_GE(std::chrono::steady_clock::now() - start_time, std::chrono::milliseconds(5));
+    EXPECT_EQ(started_on, resumed_on);
+    EXPECT_NE(resumed_on, std::this_thread::get_id());
+}
+
+/**
+ * @brief Tests that many sequential handlers share one worker thread while waiting.
+ */
+TEST_F(TaskCoroutineTest, ManyHandlersShareOneWorker)
+{
+    context.executor = worker->as_executor();
+
+    constexpr int handler_count = 32;
+    std::atomic<int> finished { 0 };
+
+    auto handler = [&](int steps) -> tools::task<void>
+    {
+        for (int step = 0; step < steps; ++step)
+        {
+            co_await tools::async_delay(context, micros(1000U));
+        }
+        finished.fetch_add(1);
+    };
+
+    for (int index = 0; index < handler_count; ++index)
+    {
+        tools::spawn(worker->as_executor(), handler(3));
+    }
+
+    EXPECT_TRUE(wait_until([&]() { return handler_count == finished.load(); }));
+}
+
+/**
+ * @brief Tests that async_receive suspends until the producer sent all the requested bytes.
+ */
+TEST_F(TaskCoroutineTest, ReceiveFromMemoryPipe)
+{
+    context.executor = worker->as_executor();
+    tools::memory_pipe pipe(64U);
+
+    std::array<std::uint8_t, 6U> received = {};
+    std::atomic<std::size_t> received_bytes { 0U };
+    std::atomic<bool> finished { false };
+
+    auto handler = [&]() -> tools::task<void>
+    {
+        received_bytes.store(
+            co_await tools::async_receive(context, pipe, received.data(), received.size(), micros(2000000U)));
+        finished.store(true);
+    };
+
+    tools::spawn(worker->as_executor(), handler());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(finished.load());
+
+    const std::vector<std::uint8_t> first = { 1U, 2U, 3U };
+    const std::vector<std::uint8_t> second = { 4U, 5U, 6U };
+    EXPECT_EQ(pipe.send(first, std::chrono::duration<std::uint64_t, std::milli>(10U)), 3U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(finished.load());
+    EXPECT_EQ(pipe.send(second, std::chrono::duration<std::uint64_t, std::milli>(10U)), 3U);
+
+    ASSERT_TRUE(wait_until([&]() { return finished.load(); }));
+    EXPECT_EQ(received_bytes.load(), received.size());
+    EXPECT_EQ(received, (std::array<std::uint8_t, 6U> { 1U, 2U, 3U, 4U, 5U, 6U }));
+}
+
+/**
+ * @brief Tests that async_receive yields the partial count once its timeout expires.
+ */
+TEST_F(TaskCoroutineTest, ReceiveTimesOut)
+{
+    context.executor = worker->as_executor();
+    tools::memory_pipe pipe(64U);
+
+    std::array<std::uint8_t, 4U> received = {};
+    std::atomic<std::size_t> received_bytes { 99U };
+    std::atomic<bool> finished { false };
+
+    const std::vector<std::uint8_t> partial = { 7U };
+    EXPECT_EQ(pipe.send(partial, std::chrono::duration<std::uint64_t, std::milli>(10U)), 1U);
+
+    auto handler = [&]() -> tools::task<void>
+    {
+        received_bytes.store(
+            co_await tools::async_receive(context, pipe, received.data(), received.size(), micros(10000U)));
+        finished.store(true);
+    };
+
+    tools::spawn(worker->as_executor(), handler());
+
+    ASSERT_TRUE(wait_until([&]() { return finished.load(); }));
+    EXPECT_EQ(received_bytes.load(), 1U);
+    EXPECT_EQ(received[0], 7U);
+}
+
+/**
+ * @brief Tests that async_wait_for_signal consumes a signal, and reports a timeout when none comes.
+ */
+TEST_F(TaskCoroutineTest, WaitForSignal)
+{
+    context.executor = worker->as_executor();
+    tools::sync_object object;
+
+    std::atomic<int> outcome { -1 };
+    std::atomic<bool> timed_out_first { false };
+
+    auto handler = [&]() -> tools::task<void>
+    {
+        const bool early = co_await tools::async_wait_for_signal(context, object, micros(3000U));
+        timed_out_first.store(!early);
+        const bool late = co_await tools::async_wait_for_signal(context, object, micros(2000000U));
+        outcome.store(late ? 1 : 0);
+    };
+
+    tools::spawn(worker->as_executor(), handler());
+
+    ASSERT_TRUE(wait_until([&]() { return timed_out_first.load(); }));
+    EXPECT_EQ(outcome.load(), -1);
+
+    object.signal();
+    ASSERT_TRUE(wait_until([&]() { return -1 != outcome.load(); }));
+    EXPECT_EQ(outcome.load(), 1);
+    EXPECT_FALSE(object.is_signaled());
+}
+
+/**
+ * @brief Tests that async_submit retries a full data_task queue until the data is accepted.
+ */
+TEST_F(TaskCoroutineTest, SubmitToDataTask)
+{
+    context.executor = worker->as_executor();
+
+    std::atomic<bool> release { false };
+    std::atomic<int> processed_sum { 0 };
+    std::atomic<int> accepted { 0 };
+
+    tools::data_task<TaskTestContext, int> consumer(
+        [](const std::shared_ptr<TaskTestContext>&, const std::string&) {},
+        [&](const std::shared_ptr<TaskTestContext>&, const int& data, const std::string&)
+        {
+            while (!release.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            processed_sum.fetch_add(data);
+        },
+        std::make_shared<TaskTestContext>(), 2U, "coro_consumer", 4096U);
+    consumer.set_overflow_policy(tools::data_task_overflow_policy::fail);
+
+    auto producer = [&]() -> tools::task<void>
+    {
+        for (int value = 1; value <= 6; ++value)
+        {
+            if (co_await tools::async_submit(context, consumer, value, micros(2000000U)))
+            {
+                accepted.fetch_add(1);
+            }
+        }
+    };
+
+    tools::spawn(worker->as_executor(), producer());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_LT(accepted.load(), 6);
+
+    release.store(true);
+    ASSERT_TRUE(wait_until([&]() { return 21 == processed_sum.load(); }));
+    EXPECT_EQ(accepted.load(), 6);
+    EXPECT_GT(consumer.overflow_stats().rejected, 0U);
+}
+
+#endif // __cpp_impl_coroutine
@@ -0,0 +1,149 @@
+/**
+ * @file test_task_monitor.cpp
+ * @brief Unit tests for the task CPU load, stack and queue depth monitor.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "tools/data_task.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/task_monitor.hpp"
+
+namespace
+{
+    struct monitor_context
+    {
+        std::atomic<bool> release { false };
+        std::atomic<int> started { 0 };
+    };
+
+    constexpr std::size_t monitor_stack_size = 2048U;
+}
+
+/**
+ * @brief Verifies that a snapshot reports the configuration and the queue depth of a data_task.
+ */
+TEST(TaskMonitorTest, ReportsConfigurationAndQueueDepth)
+{
+    auto context = std::make_shared<monitor_context>();
+    tools::data_task<monitor_context, int> task([](const std::shared_ptr<monitor_context>&, const std::string&) {},
+        [](const std::shared_ptr<monitor_context>& ctx, const int&, const std::string&)
+        {
+            ctx->started.fetch_add(1);
+            while (!ctx->release.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        },
+        context, 8U, "monitored", monitor_stack_size);
+
+    tools::task_monitor monitor;
+    monitor.watch_queue(task);
+    EXPECT_EQ(monitor.watched_count(), 1U);
+
+    ASSERT_TRUE(task.submit(1));
+    while (0 == context->started.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(task.submit(2));
+    ASSERT_TRUE(task.submit(3));
+
+    const auto snapshot = monitor.sample();
+    const auto* sample = snapshot.find("monitored");
+    ASSERT_NE(sample, nullptr);
+    EXPECT_EQ(sample->stack_size, monitor_stack_size);
+    EXPECT_EQ(sample->cpu_affinity, tools::base_task::run_on_all_cores);
+    ASSERT_TRUE(sample->queue_depth.has_value());
+    EXPECT_EQ(sample->queue_depth.value(), 2U);
+    EXPECT_FALSE(sample->stack_high_water.has_value());
+    EXPECT_EQ(monitor.last_snapshot().tasks.size(), 1U);
+
+    context->release.store(true);
+    EXPECT_TRUE(monitor.unwatch(task));
+    EXPECT_FALSE(monitor.unwatch(task));
+    EXPECT_TRUE(monitor.sample().tasks.empty());
+}
+
+#if defined(__linux__)
+/**
+ * @brief Verifies that the CPU time of a busy thread is measured, then no longer reported once it returned.
+ */
+TEST(TaskMonitorTest, MeasuresTheCpuTimeOfABusyTask)
+{
+    auto context = std::make_shared<monitor_context>();
+    tools::generic_task<monitor_context> task(
+        [](const std::shared_ptr<monitor_context>& ctx, const std::string&)
+        {
+            ctx->started.store(1);
+            while (!ctx->release.load())
+            {
+            }
+            ctx->started.store(2);
+        },
+        context, "busy", monitor_stack_size);
+
+    tools::task_monitor monitor;
+    monitor.watch(task);
+    while (0 == context->started.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    static_cast<void>(monitor.sample());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const auto busy = monitor.sample();
+    ASSERT_EQ(busy.tasks.size(), 1U);
+    ASSERT_TRUE(busy.tasks[0].cpu_time.has_value());
+    EXPECT_GE(busy.tasks[0].cpu_time.value(), std::chrono::milliseconds(20));
+    EXPECT_GT(busy.tasks[0].cpu_share, 0.2);
+    EXPECT_LE(busy.tasks[0].cpu_share, 1.1);
+    EXPECT_GE(busy.interval, std::chrono::milliseconds(100));
+    EXPECT_FALSE(busy.tasks[0].queue_depth.has_value());
+
+    context->release.store(true);
+    bool reported = true;
+    for (int attempt = 0; reported && (attempt < 1000); ++attempt)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        reported = monitor.sample().tasks[0].cpu_time.has_value();
+    }
+    EXPECT_FALSE(reported);
+    monitor.unwatch(task);
+}
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file test_task_runner_pool.cpp
+ * @brief Unit tests for the pool of parked task runners.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/task_runner_pool.hpp"
+
+namespace
+{
+    struct runner_context
+    {
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+        std::set<std::string> runners;
+        std::atomic<int> runs { 0 };
+        std::atomic<bool> release { false };
+    };
+
+    using runner_pool = tools::task_runner_pool<runner_context>;
+
+    void record_run(const std::shared_ptr<runner_context>& context, const std::string& task_name)
+    {
+        std::scoped_lock<std::mutex> guard(context->mutex);
+        context->threads.insert(std::this_thread::get_id());
+        context->runners.insert(task_name);
+        context->runs.fetch_add(1);
+    }
+
+    void hold_until_released(const std::shared_ptr<runner_context>& context, const std::string& task_name)
+    {
+        record_run(context, task_name);
+        while (!context->release.load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+/**
+ * @brief Verifies that successive launches reuse the parked runners instead of creating threads.
+ */
+TEST(TaskRunnerPoolTest, LaunchesReuseTheParkedRunners)
+{
+    auto context = std::make_shared<runner_context>();
+    runner_pool pool("runner", 2U, tools::task_runner_params { 2048U });
+    EXPECT_EQ(pool.size(), 2U);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(pool.launch(record_run, context));
+        pool.wait_idle();
+    }
+
+    EXPECT_EQ(context->runs.load(), 10);
+    EXPECT_EQ(pool.completed_count(), 10U);
+    EXPECT_EQ(pool.idle_count(), 2U);
+    EXPECT_LE(context->threads.size(), 2U);
+    for (const auto& name : context->runners)
+    {
+        EXPECT_TRUE((name == pool.runner_task(0).task_name()) || (name == pool.runner_task(1).task_name()));
+    }
+    // the pool no longer holds the context once the routines returned
+    EXPECT_EQ(context.use_count(), 1);
+}
+
+/**
+ * @brief Verifies that a launch takes the smallest idle runner with enough stack, and fails when none is idle.
+ */
+TEST(TaskRunnerPoolTest, PicksTheSmallestFittingIdleRunner)
+{
+    auto context = std::make_shared<runner_context>();
+    runner_pool pool("sized", { tools::task_runner_params { 8192U }, tools::task_runner_params { 1024U },
+                                  tools::task_runner_params { 4096U } });
+
+    EXPECT_FALSE(pool.launch(hold_until_released, context, 16384U));
+
+    ASSERT_TRUE(pool.launch(hold_until_released, context, 2048U));
+    ASSERT_TRUE(pool.launch(hold_until_released, context, 2048U));
+    EXPECT_FALSE(pool.launch(hold_until_released, context, 2048U));
+    ASSERT_TRUE(pool.launch(hold_until_released, context));
+    EXPECT_FALSE(pool.launch(hold_until_released, context));
+    EXPECT_EQ(pool.idle_count(), 0U);
+
+    while (3 != context->runs.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    {
+        std::scoped_lock<std::mutex> guard(context->mutex);
+        EXPECT_EQ(context->runners, (std::set<std::string> { "sized_0", "sized_1", "sized_2" }));
+    }
+
+    context->release.store(true);
+    pool.wait_idle();
+    EXPECT_EQ(pool.idle_count(), 3U);
+}
+
+/**
+ * @brief Verifies that a launch pinned to a core only takes a runner with that affinity.
+ */
+TEST(TaskRunnerPoolTest, HonoursTheRequestedCore)
+{
+    auto context = std::make_shared<runner_context>();
+    runner_pool pool("pinned", { tools::task_runner_params { 2048U, 0 } });
+
+    EXPECT_FALSE(pool.launch(record_run, context, 0U, 1));
+    ASSERT_TRUE(pool.launch(record_run, context, 0U, 0));
+    pool.wait_idle();
+    EXPECT_EQ(context->runs.load(), 1);
+}
@@ -223,6 +223,29 @@ TEST_F(TimeListIntTest, SnapshotSortedOnEmptyReturnsEmpty)
     EXPECT_TRUE(tl->snapshot_sorted().empty());
 }
 
+// ---------------------------------------------------------------------------
+// pop_until
+// ---------------------------------------------------------------------------
+
+/** @brief pop_until() drains every entry up to the bound (inclusive) in chronological order. */
+TEST_F(TimeListIntTest, PopUntilDrainsHeadInOrder)
+{
+    tl->push(30L, "c");
+    tl->push(10L, "a");
+    tl->push(40L, "d");
+    tl->push(20L, "b");
+
+    std::vector<long> drained;
+    EXPECT_EQ(tl->pop_until(30L, [&drained](const auto& entry) { drained.push_back(entry.first); }), 3U);
+
+    const std::vector<long> expected { 10L, 20L, 30L };
+    EXPECT_EQ(drained, expected);
+    EXPECT_EQ(tl->size(), 1U);
+    EXPECT_EQ(tl->pop_until(5L), 0U);
+    EXPECT_EQ(tl->pop_until(100L), 1U);
+    EXPECT_TRUE(tl->empty());
+}
+
 // ---------------------------------------------------------------------------
 // Emplace
 // ---------------------------------------------------------------------------
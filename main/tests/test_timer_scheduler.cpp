@@ -44,12 +44,15 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "tools/timer_scheduler.hpp"
+#include "tools/worker_task.hpp"
 
 /**
  * @class TimerSchedulerTest
@@ -366,3 +369,284 @@ TEST_F(TimerSchedulerTest, RemovePeriodicTimerBeforeTimeout)
     std::this_thread::sleep_for(std::chrono::milliseconds(150)); // Wait to ensure the timer does not fire
     ASSERT_EQ(counter.load(), 0);
 }
+
+/**
+ * @brief Test case for a large number of low-resolution timers.
+ *
+ * Low-resolution timers run on the timing wheel: thousands of one-shot timers are armed, half of them are
+ * removed before expiry, and each remaining one must fire exactly once.
+ */
+TEST_F(TimerSchedulerTest, ManyLowResolutionTimersFireOnce)
+{
+    constexpr int timer_count = 5000;
+    std::atomic<int> fired { 0 };
+    std::vector<tools::timer_handle> handles;
+    handles.reserve(timer_count);
+
+    for (int i = 0; i < timer_count; ++i)
+    {
+        auto handler = [&fired](tools::timer_handle hnd)
+        {
+            (void)hnd;
+            fired.fetch_add(1);
+        };
+        handles.push_back(scheduler->add("test_many_" + std::to_string(i), 40U + static_cast<std::uint64_t>(i % 60),
+            std::move(handler), tools::timer_type::one_shot, tools::timer_resolution_policy::low_resolution));
+        ASSERT_NE(handles.back(), static_cast<tools::timer_handle>(0));
+    }
+
+    for (int i = 0; i < timer_count; i += 2)
+    {
+        ASSERT_TRUE(scheduler->remove(handles[static_cast<std::size_t>(i)]));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    ASSERT_EQ(fired.load(), timer_count / 2);
+    ASSERT_FALSE(scheduler->remove(handles[1])); // one-shot timers are released after firing
+}
+
+/**
+ * @brief Test case for a periodic low-resolution timer removing itself from its own handler.
+ */
+TEST_F(TimerSchedulerTest, PeriodicTimerRemovesItselfFromHandler)
+{
+    std::atomic<int> fired { 0 };
+    auto* sched = scheduler.get();
+    auto handler = [&fired, sched](tools::timer_handle hnd)
+    {
+        if (fired.fetch_add(1) == 2)
+        {
+            EXPECT_TRUE(sched->remove(hnd));
+        }
+    };
+    auto handle = scheduler->add("test_self_remove", 10, std::move(handler), tools::timer_type::periodic);
+    ASSERT_NE(handle, static_cast<tools::timer_handle>(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    ASSERT_EQ(fired.load(), 3);
+    ASSERT_FALSE(scheduler->remove(handle));
+}
+
+/**
+ * @brief Test case for the resolution reported for each policy.
+ *
+ * Low-resolution timers report the 1 ms timing wheel; high-resolution timers report the timerfd backend on Linux
+ * and count their expirations with the observed lateness.
+ */
+TEST_F(TimerSchedulerTest, ReportsAchievedResolution)
+{
+    std::atomic<int> fired { 0 };
+    auto handler = [&fired](tools::timer_handle hnd)
+    {
+        (void)hnd;
+        fired.fetch_add(1);
+    };
+    auto handle = scheduler->add("test_resolution_high", std::chrono::duration<std::uint64_t, std::micro>(2000),
+        std::move(handler), tools::timer_type::periodic, tools::timer_resolution_policy::high_resolution);
+    ASSERT_NE(handle, static_cast<tools::timer_handle>(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_TRUE(scheduler->remove(handle));
+
+    const auto high = scheduler->resolution(tools::timer_resolution_policy::high_resolution);
+#if defined(__linux__)
+    EXPECT_EQ(high.backend, tools::timer_backend_kind::timerfd);
+#endif
+    EXPECT_GE(high.granularity.count(), 1U);
+    EXPECT_GT(high.expirations, 10U);
+    EXPECT_LE(high.expirations, static_cast<std::uint64_t>(fired.load()));
+
+    const auto low = scheduler->resolution(tools::timer_resolution_policy::low_resolution);
+    EXPECT_EQ(low.backend, tools::timer_backend_kind::timing_wheel);
+    EXPECT_EQ(low.granularity.count(), 1000U);
+    EXPECT_EQ(low.expirations, 0U);
+}
+
+/**
+ * @brief Test case for a high-resolution periodic timer finished by a busy-spin.
+ */
+TEST_F(TimerSchedulerTest, HighResolutionTimerWithBusySpin)
+{
+    scheduler->set_high_resolution_spin(std::chrono::duration<std::uint64_t, std::micro>(200));
+
+    std::atomic<int> fired { 0 };
+    auto handler = [&fired](tools::timer_handle hnd)
+    {
+        (void)hnd;
+        fired.fetch_add(1);
+    };
+    auto handle = scheduler->add("test_spin_high", std::chrono::duration<std::uint64_t, std::micro>(250),
+        std::move(handler), tools::timer_type::periodic, tools::timer_resolution_policy::high_resolution);
+    ASSERT_NE(handle, static_cast<tools::timer_handle>(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(scheduler->remove(handle));
+
+    const int count = fired.load();
+    EXPECT_GT(count, 50); // ~200 expected, lenient for loaded machines
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_LE(fired.load(), count + 1); // at most one dispatch in flight when removed
+}
+
+/**
+ * @brief Test case for low-resolution timers with a coalescing slack.
+ *
+ * Each expiry is allowed to be deferred by the slack so that timers can share a wakeup; the timers must still
+ * fire, never before their period and within the tolerance window.
+ */
+TEST_F(TimerSchedulerTest, SlackTimersFireWithinTheirWindow)
+{
+    using clock = std::chrono::steady_clock;
+    std::atomic<int> periodic_fired { 0 };
+    std::atomic<long long> one_shot_delay_us { -1 };
+    const auto start = clock::now();
+
+    auto periodic = scheduler->add("test_slack_periodic", std::chrono::duration<std::uint64_t, std::micro>(10000),
+        [&periodic_fired](tools::timer_handle) { periodic_fired.fetch_add(1); }, tools::timer_type::periodic,
+        tools::timer_resolution_policy::low_resolution, std::chrono::duration<std::uint64_t, std::micro>(8000));
+    auto one_shot = scheduler->add(
+        "test_slack_one_shot", std::chrono::duration<std::uint64_t, std::micro>(30000),
+        [&one_shot_delay_us, start](tools::timer_handle)
+        {
+            one_shot_delay_us.store(
+                std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count());
+        },
+        tools::timer_type::one_shot, tools::timer_resolution_policy::low_resolution,
+        std::chrono::duration<std::uint64_t, std::micro>(16000));
+    ASSERT_NE(periodic, static_cast<tools::timer_handle>(0));
+    ASSERT_NE(one_shot, static_cast<tools::timer_handle>(0));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    ASSERT_TRUE(scheduler->remove(periodic));
+
+    EXPECT_GE(periodic_fired.load(), 8);  // 15 at most with a 10 ms period
+    EXPECT_LE(periodic_fired.load(), 15);
+    EXPECT_GE(one_shot_delay_us.load(), 30000);
+    EXPECT_LT(one_shot_delay_us.load(), 30000 + 16000 + 20000); // window plus scheduling allowance
+}
+
+/**
+ * @brief Test case for watchdog-style timeouts re-armed with restart().
+ *
+ * A one-shot timeout restarted more often than its delay never fires; once the restarts stop, it fires once
+ * with its original handle. reschedule() shortens the period of a periodic timer in place.
+ */
+TEST_F(TimerSchedulerTest, RestartAndRescheduleKeepTheHandle)
+{
+    for (const auto policy :
+        { tools::timer_resolution_policy::low_resolution, tools::timer_resolution_policy::high_resolution })
+    {
+        std::atomic<int> fired { 0 };
+        std::atomic<tools::timer_handle> fired_handle { 0U };
+        auto handle = scheduler->add(
+            "test_watchdog", std::chrono::duration<std::uint64_t, std::micro>(60000U),
+            [&fired, &fired_handle](tools::timer_handle hnd)
+            {
+                fired_handle.store(hnd);
+                fired.fetch_add(1);
+            },
+            tools::timer_type::one_shot, policy);
+        ASSERT_NE(handle, static_cast<tools::timer_handle>(0));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(15));
+            ASSERT_TRUE(scheduler->restart(handle));
+        }
+        EXPECT_EQ(fired.load(), 0);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        EXPECT_EQ(fired.load(), 1);
+        EXPECT_EQ(fired_handle.load(), handle);
+        EXPECT_FALSE(scheduler->restart(handle));
+
+        std::atomic<int> ticks { 0 };
+        auto periodic = scheduler->add(
+            "test_reschedule", std::chrono::duration<std::uint64_t, std::micro>(1000000U),
+            [&ticks](tools::timer_handle) { ticks.fetch_add(1); }, tools::timer_type::periodic, policy);
+        ASSERT_TRUE(scheduler->reschedule(periodic, std::chrono::duration<std::uint64_t, std::micro>(20000U)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        EXPECT_TRUE(scheduler->remove(periodic));
+        EXPECT_GE(ticks.load(), 3);
+    }
+}
+
+/**
+ * @brief Test case for a timer whose expirations are dispatched to a worker_task.
+ *
+ * The dispatched handler blocks on the worker; a second timer served inline keeps firing on time meanwhile,
+ * and the dispatched handler receives its own handle.
+ */
+TEST_F(TimerSchedulerTest, DispatchedHandlerDoesNotDelayOtherTimers)
+{
+    struct worker_context
+    {
+    };
+    using worker_task_t = tools::worker_task<worker_context>;
+
+    worker_task_t worker([](const std::shared_ptr<worker_context>&, const std::string&) {},
+        std::make_shared<worker_context>(), "timer_worker", 4096);
+
+    std::atomic<int> slow_runs { 0 };
+    std::atomic<tools::timer_handle> slow_handle { 0U };
+    auto slow = scheduler->add(
+        "test_dispatched", std::chrono::duration<std::uint64_t, std::micro>(10000U),
+        [&slow_runs, &slow_handle](tools::timer_handle hnd)
+        {
+            slow_handle.store(hnd);
+            slow_runs.fetch_add(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        },
+        tools::timer_type::one_shot, tools::timer_resolution_policy::low_resolution,
+        tools::make_timer_dispatcher(worker.as_executor()));
+    ASSERT_NE(slow, static_cast<tools::timer_handle>(0));
+
+    std::atomic<int> fast_runs { 0 };
+    auto fast = scheduler->add(
+        "test_inline", 20U, [&fast_runs](tools::timer_handle) { fast_runs.fetch_add(1); }, tools::timer_type::periodic);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(slow_runs.load(), 1);
+    EXPECT_EQ(slow_handle.load(), slow);
+    EXPECT_GE(fast_runs.load(), 4); // the timer thread was not held by the 200 ms handler
+    EXPECT_TRUE(scheduler->remove(fast));
+}
+
+/**
+ * @brief Test case for batch registration and cancellation.
+ *
+ * A batch mixing low- and high-resolution timers is added in one call, every other timer is cancelled in one
+ * call, and each remaining one fires exactly once.
+ */
+TEST_F(TimerSchedulerTest, AddRangeAndRemoveRange)
+{
+    constexpr std::size_t timer_count = 400U;
+    std::atomic<int> fired { 0 };
+
+    std::vector<tools::timer_request> requests(timer_count);
+    for (std::size_t i = 0U; i < timer_count; ++i)
+    {
+        auto& request = requests[i];
+        request.name = "test_batch_" + std::to_string(i);
+        request.period = std::chrono::duration<std::uint64_t, std::micro>(40000U + ((i % 40U) * 1000U));
+        request.handler = [&fired](tools::timer_handle) { fired.fetch_add(1); };
+        request.policy = (0U == (i % 4U)) ? tools::timer_resolution_policy::high_resolution
+                                          : tools::timer_resolution_policy::low_resolution;
+    }
+
+    const auto handles = scheduler->add_range(std::move(requests));
+    ASSERT_EQ(handles.size(), timer_count);
+
+    std::vector<tools::timer_handle> cancelled;
+    for (std::size_t i = 0U; i < timer_count; ++i)
+    {
+        ASSERT_NE(handles[i], static_cast<tools::timer_handle>(0));
+        if (0U == (i % 2U))
+        {
+            cancelled.push_back(handles[i]);
+        }
+    }
+
+    EXPECT_EQ(scheduler->remove_range(cancelled), cancelled.size());
+    EXPECT_EQ(scheduler->remove_range(cancelled), 0U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    EXPECT_EQ(fired.load(), static_cast<int>(timer_count / 2U));
+}
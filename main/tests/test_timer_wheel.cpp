@@ -0,0 +1,254 @@
+/**
+ * @file test_timer_wheel.cpp
+ * @brief Unit tests for the hierarchical timer_wheel using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "tools/timer_wheel.hpp"
+
+namespace
+{
+    using wheel_t = tools::timer_wheel<std::function<void()>>;
+
+    std::vector<std::size_t> advance_ids(wheel_t& wheel, wheel_t::tick_type now)
+    {
+        std::vector<wheel_t::expired_timer> expired;
+        wheel.advance(now, expired);
+
+        std::vector<std::size_t> ids;
+        for (auto& timer : expired)
+        {
+            ids.push_back(timer.id);
+            wheel.rearm(std::move(timer));
+        }
+        return ids;
+    }
+} // namespace
+
+TEST(TimerWheelTest, FiresOnExactTickAcrossLevels)
+{
+    wheel_t wheel;
+    const std::vector<wheel_t::tick_type> expiries = { 1U, 63U, 64U, 65U, 4095U, 4096U, 300000U, 20000000U };
+
+    std::vector<std::size_t> ids;
+    for (const auto expiry : expiries)
+    {
+        ids.push_back(wheel.insert(expiry, 0U, [] { }).value());
+    }
+    EXPECT_EQ(wheel.size(), expiries.size());
+
+    for (std::size_t i = 0U; i < expiries.size(); ++i)
+    {
+        EXPECT_TRUE(advance_ids(wheel, expiries[i] - 1U).empty()) << "early expiry of timer " << i;
+        EXPECT_EQ(advance_ids(wheel, expiries[i]), (std::vector<std::size_t> { ids[i] }));
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, CancelIsImmediateAndRejectsStaleIds)
+{
+    wheel_t wheel;
+
+    const auto first = wheel.insert(10U, 0U, [] { }).value();
+    EXPECT_TRUE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_TRUE(wheel.empty());
+
+    // the node is recycled with a new generation, the stale id must not cancel it
+    const auto second = wheel.insert(10U, 0U, [] { }).value();
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_EQ(advance_ids(wheel, 10U), (std::vector<std::size_t> { second }));
+}
+
+TEST(TimerWheelTest, PeriodicTimerKeepsItsPhase)
+{
+    wheel_t wheel;
+    const auto id = wheel.insert(5U, 5U, [] { }).value();
+
+    std::size_t fired = 0U;
+    for (wheel_t::tick_type now = 1U; now <= 50U; ++now)
+    {
+        fired += advance_ids(wheel, now).size();
+    }
+    EXPECT_EQ(fired, 10U);
+    EXPECT_EQ(wheel.next_expiry_hint().value(), 5U); // fired at 50, next due at 55
+
+    // a late advance fires once and skips the missed period (60) instead of drifting
+    EXPECT_EQ(advance_ids(wheel, 62U).size(), 1U);
+    EXPECT_TRUE(advance_ids(wheel, 64U).empty());
+    EXPECT_EQ(advance_ids(wheel, 65U).size(), 1U);
+
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.next_expiry_hint().has_value());
+}
+
+TEST(TimerWheelTest, CancelWhileRunningStopsPeriodicTimer)
+{
+    wheel_t wheel;
+    const auto id = wheel.insert(2U, 2U, [] { }).value();
+
+    std::vector<wheel_t::expired_timer> expired;
+    wheel.advance(2U, expired);
+    ASSERT_EQ(expired.size(), 1U);
+
+    EXPECT_TRUE(wheel.cancel(id));  // handler "running"
+    EXPECT_FALSE(wheel.cancel(id)); // already cancelled
+    wheel.rearm(std::move(expired.front()));
+
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_TRUE(advance_ids(wheel, 10U).empty());
+}
+
+TEST(TimerWheelTest, RecyclesNodesAndReleasesHandlers)
+{
+    wheel_t wheel(4U);
+    auto counter = std::make_shared<int>(0);
+
+    for (wheel_t::tick_type round = 1U; round <= 100U; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(wheel.insert(round, 0U, [counter] { ++*counter; }).has_value());
+        }
+
+        std::vector<wheel_t::expired_timer> expired;
+        wheel.advance(round, expired);
+        for (auto& timer : expired)
+        {
+            timer.handler();
+        }
+    }
+
+    EXPECT_EQ(*counter, 400);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(counter.use_count(), 1); // released nodes drop their handler
+}
+
+TEST(TimerWheelTest, SlackCoalescesExpiriesOnSharedBoundary)
+{
+    wheel_t wheel;
+
+    const auto first = wheel.insert(33U, 0U, [] { }, 16U).value();
+    const auto second = wheel.insert(37U, 0U, [] { }, 20U).value();
+    const auto third = wheel.insert(45U, 0U, [] { }, 16U).value();
+    const auto exact = wheel.insert(40U, 0U, [] { }).value();
+
+    EXPECT_EQ(advance_ids(wheel, 40U), (std::vector<std::size_t> { exact }));
+    EXPECT_TRUE(advance_ids(wheel, 47U).empty());
+
+    auto ids = advance_ids(wheel, 48U); // 3 timers, 1 wakeup
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<std::size_t> { first, second, third }));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, PeriodicSlackTimerStaysWithinItsWindow)
+{
+    wheel_t wheel;
+    (void)wheel.insert(10U, 10U, [] { }, 7U).value(); // quantum 4
+
+    std::vector<wheel_t::tick_type> fired_at;
+    for (wheel_t::tick_type now = 1U; now <= 100U; ++now)
+    {
+        if (!advance_ids(wheel, now).empty())
+        {
+            fired_at.push_back(now);
+        }
+    }
+
+    ASSERT_EQ(fired_at.size(), 10U);
+    for (std::size_t i = 0U; i < fired_at.size(); ++i)
+    {
+        const wheel_t::tick_type nominal = 10U * (i + 1U);
+        EXPECT_GE(fired_at[i], nominal);
+        EXPECT_LE(fired_at[i], nominal + 7U);
+        EXPECT_EQ(fired_at[i] % 4U, 0U);
+    }
+}
+
+TEST(TimerWheelTest, RestartPushesBackOneShotTimeout)
+{
+    wheel_t wheel;
+    const auto id = wheel.insert(10U, 0U, [] { }).value();
+
+    // re-armed on every "message", the timeout never fires while messages keep coming
+    for (wheel_t::tick_type now = 5U; now <= 50U; now += 5U)
+    {
+        EXPECT_TRUE(advance_ids(wheel, now).empty());
+        EXPECT_EQ(wheel.restart(id, now).value(), now + 10U);
+    }
+
+    EXPECT_TRUE(advance_ids(wheel, 59U).empty());
+    EXPECT_EQ(advance_ids(wheel, 60U), (std::vector<std::size_t> { id }));
+    EXPECT_FALSE(wheel.restart(id, 60U).has_value()); // fired one-shot ids are released
+}
+
+TEST(TimerWheelTest, RescheduleChangesThePeriodInPlace)
+{
+    wheel_t wheel;
+    const auto id = wheel.insert(5U, 5U, [] { }).value();
+
+    EXPECT_EQ(advance_ids(wheel, 5U), (std::vector<std::size_t> { id }));
+    EXPECT_EQ(wheel.reschedule(id, 6U, 20U).value(), 26U);
+    EXPECT_TRUE(advance_ids(wheel, 25U).empty());
+    EXPECT_EQ(advance_ids(wheel, 26U), (std::vector<std::size_t> { id }));
+    EXPECT_TRUE(advance_ids(wheel, 45U).empty());
+    EXPECT_EQ(advance_ids(wheel, 46U), (std::vector<std::size_t> { id }));
+    EXPECT_EQ(wheel.size(), 1U);
+}
+
+TEST(TimerWheelTest, RestartWhileRunningAppliesOnRearm)
+{
+    wheel_t wheel;
+    const auto id = wheel.insert(4U, 4U, [] { }).value();
+
+    std::vector<wheel_t::expired_timer> expired;
+    wheel.advance(4U, expired);
+    ASSERT_EQ(expired.size(), 1U);
+
+    EXPECT_EQ(wheel.restart(id, 6U).value(), 10U); // handler "running"
+    wheel.rearm(std::move(expired.front()));
+
+    EXPECT_TRUE(advance_ids(wheel, 9U).empty());
+    EXPECT_EQ(advance_ids(wheel, 10U), (std::vector<std::size_t> { id }));
+
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.restart(id, 10U).has_value());
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_tlsf_heap.cpp
+ * @brief Unit tests for the two-level segregated fit heap using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "tools/tlsf_heap.hpp"
+
+namespace
+{
+    constexpr std::size_t region_size = 64U * 1024U;
+
+    bool is_aligned(const void* ptr)
+    {
+        return (reinterpret_cast<std::uintptr_t>(ptr) % tools::tlsf_heap::alignment) == 0U;
+    }
+}
+
+/**
+ * @brief Test that blocks are aligned, inside the region, large enough and accounted for.
+ */
+TEST(TlsfHeapTest, AllocatesAlignedBlocksInTheRegion)
+{
+    std::vector<unsigned char> region(region_size);
+    tools::tlsf_heap heap(region.data(), region.size());
+
+    const auto initial = heap.stats();
+    EXPECT_GT(initial.managed_bytes, region_size - 256U);
+    EXPECT_EQ(initial.managed_bytes, initial.free_bytes);
+    EXPECT_EQ(initial.managed_bytes, initial.largest_free_block);
+    EXPECT_EQ(1U, initial.free_blocks);
+    EXPECT_EQ(0U, initial.fragmentation_percent);
+
+    for (const std::size_t size : { 0U, 1U, 24U, 513U, 1000U, 4096U })
+    {
+        void* ptr = heap.allocate(size);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_TRUE(is_aligned(ptr));
+        EXPECT_TRUE(heap.owns(ptr));
+        EXPECT_GE(heap.usable_size(ptr), size);
+        std::memset(ptr, 0xA5, size);
+        heap.deallocate(ptr);
+    }
+
+    int local = 0;
+    EXPECT_FALSE(heap.owns(&local));
+
+    const auto final_stats = heap.stats();
+    EXPECT_EQ(6U, final_stats.allocations);
+    EXPECT_EQ(0U, final_stats.used_bytes);
+    EXPECT_EQ(0U, final_stats.used_blocks);
+    EXPECT_EQ(1U, final_stats.free_blocks);
+    EXPECT_GT(final_stats.high_water_mark, 4096U);
+}
+
+/**
+ * @brief Test that released neighbours coalesce back into a single free block, whatever the release order.
+ */
+TEST(TlsfHeapTest, CoalescesReleasedNeighbours)
+{
+    std::vector<unsigned char> region(region_size);
+    tools::tlsf_heap heap(region.data(), region.size());
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 8; ++i)
+    {
+        blocks.push_back(heap.allocate(1000U));
+        ASSERT_NE(nullptr, blocks.back());
+    }
+
+    // every other block: holes that cannot merge yet
+    for (std::size_t i = 0U; i < blocks.size(); i += 2U)
+    {
+        heap.deallocate(blocks[i]);
+    }
+
+    const auto holes = heap.stats();
+    EXPECT_EQ(5U, holes.free_blocks); // 4 holes and the tail of the region
+    EXPECT_EQ(4U, holes.used_blocks);
+    EXPECT_GT(holes.fragmentation_percent, 0U);
+
+    for (std::size_t i = 1U; i < blocks.size(); i += 2U)
+    {
+        heap.deallocate(blocks[i]);
+    }
+
+    const auto merged = heap.stats();
+    EXPECT_EQ(1U, merged.free_blocks);
+    EXPECT_EQ(merged.managed_bytes, merged.largest_free_block);
+    EXPECT_EQ(0U, merged.fragmentation_percent);
+}
+
+/**
+ * @brief Test that an exhausted heap reports failures and serves again once blocks are released.
+ */
+TEST(TlsfHeapTest, ReportsExhaustion)
+{
+    std::vector<unsigned char> region(4096U);
+    tools::tlsf_heap heap(region.data(), region.size());
+
+    EXPECT_EQ(nullptr, heap.allocate(8192U));
+    EXPECT_EQ(nullptr, heap.allocate(static_cast<std::size_t>(-1)));
+
+    std::vector<void*> blocks;
+    while (void* ptr = heap.allocate(256U))
+    {
+        blocks.push_back(ptr);
+    }
+
+    EXPECT_FALSE(blocks.empty());
+    EXPECT_EQ(3U, heap.stats().failed_allocations);
+
+    heap.deallocate(blocks.front());
+    EXPECT_NE(nullptr, heap.allocate(256U));
+
+    tools::tlsf_heap empty_heap(nullptr, 0U);
+    EXPECT_EQ(nullptr, empty_heap.allocate(1U));
+    EXPECT_EQ(0U, empty_heap.stats().managed_bytes);
+}
+
+/**
+ * @brief Test random allocations and releases: blocks never overlap and their contents survive.
+ */
+TEST(TlsfHeapTest, RandomWorkloadKeepsBlocksIntact)
+{
+    std::vector<unsigned char> region(256U * 1024U);
+    tools::tlsf_heap heap(region.data(), region.size());
+
+    struct live_block
+    {
+        unsigned char* ptr;
+        std::size_t size;
+        unsigned char pattern;
+    };
+
+    std::vector<live_block> live;
+    std::uint32_t seed = 12345U;
+    auto next_random = [&seed]()
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        return seed >> 8U;
+    };
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (live.empty() || ((next_random() % 3U) != 0U))
+        {
+            const std::size_t size = 1U + (next_random() % 3000U);
+            auto* ptr = static_cast<unsigned char*>(heap.allocate(size));
+            if (ptr != nullptr)
+            {
+                const auto pattern = static_cast<unsigned char>(step);
+                std::memset(ptr, pattern, size);
+                live.push_back({ ptr, size, pattern });
+            }
+        }
+        else
+        {
+            const std::size_t victim = next_random() % live.size();
+            const auto& block = live[victim];
+            ASSERT_TRUE(std::all_of(
+                block.ptr, block.ptr + block.size, [&block](unsigned char byte) { return byte == block.pattern; }));
+            heap.deallocate(block.ptr);
+            live[victim] = live.back();
+            live.pop_back();
+        }
+    }
+
+    std::sort(live.begin(), live.end(), [](const live_block& lhs, const live_block& rhs) { return lhs.ptr < rhs.ptr; });
+    for (std::size_t i = 1U; i < live.size(); ++i)
+    {
+        EXPECT_LE(live[i - 1U].ptr + live[i - 1U].size, live[i].ptr);
+    }
+
+    EXPECT_EQ(live.size(), heap.stats().used_blocks);
+
+    for (const auto& block : live)
+    {
+        heap.deallocate(block.ptr);
+    }
+
+    const auto stats = heap.stats();
+    EXPECT_EQ(1U, stats.free_blocks);
+    EXPECT_EQ(0U, stats.used_bytes);
+}
+
+/**
+ * @brief Test concurrent allocations and releases from several threads.
+ */
+TEST(TlsfHeapTest, ConcurrentAllocations)
+{
+    std::vector<unsigned char> region(region_size);
+    tools::tlsf_heap heap(region.data(), region.size());
+
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&heap, t]()
+            {
+                for (int i = 0; i < 5000; ++i)
+                {
+                    const std::size_t size = 16U + static_cast<std::size_t>((i * 37 + t) % 1024);
+                    if (auto* ptr = static_cast<unsigned char*>(heap.allocate(size)))
+                    {
+                        ptr[0] = static_cast<unsigned char>(t);
+                        ptr[size - 1U] = static_cast<unsigned char>(t);
+                        heap.deallocate(ptr);
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = heap.stats();
+    EXPECT_EQ(0U, stats.used_blocks);
+    EXPECT_EQ(1U, stats.free_blocks);
+    EXPECT_EQ(static_cast<std::size_t>(thread_count * 5000), stats.allocations + stats.failed_allocations);
+}
@@ -0,0 +1,301 @@
+/**
+ * @file test_token_bucket.cpp
+ * @brief Unit tests for token_bucket, load_shedder and the rate limits of sync_subject.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/sync_observer.hpp"
+#include "tools/token_bucket.hpp"
+
+namespace
+{
+    tools::fast_clock::time_point at_ms(std::int64_t milliseconds)
+    {
+        return tools::fast_clock::time_point(std::chrono::milliseconds(milliseconds));
+    }
+}
+
+/**
+ * @brief Verifies the bucket admits its burst back to back, then refills at its rate.
+ */
+TEST(TokenBucketTest, AdmitsBurstThenRefillsAtRate)
+{
+    tools::token_bucket bucket(10U, 3U);
+    EXPECT_EQ(bucket.burst(), 3U);
+    EXPECT_EQ(bucket.available(at_ms(1000)), 3U);
+
+    EXPECT_TRUE(bucket.try_acquire(2U, at_ms(1000)));
+    EXPECT_TRUE(bucket.try_acquire(1U, at_ms(1000)));
+    EXPECT_FALSE(bucket.try_acquire(1U, at_ms(1000)));
+    EXPECT_EQ(bucket.available(at_ms(1000)), 0U);
+
+    EXPECT_TRUE(bucket.try_acquire(1U, at_ms(1100)));
+    EXPECT_FALSE(bucket.try_acquire(1U, at_ms(1150)));
+    EXPECT_FALSE(bucket.try_acquire(4U, at_ms(5000)));
+    EXPECT_EQ(bucket.available(at_ms(5000)), 3U);
+}
+
+/**
+ * @brief Verifies the sample policy delivers one exceeding event in N and drops the others.
+ */
+TEST(TokenBucketTest, ShedderSamplesOneInN)
+{
+    tools::load_shedder shedder(tools::rate_limit { 1U, 1U, tools::shed_policy::sample, 3U });
+    std::size_t delivered = 0U;
+    for (int i = 0; i < 7; ++i)
+    {
+        if (tools::shed_verdict::deliver == shedder.admit(1U, at_ms(0)))
+        {
+            ++delivered;
+        }
+    }
+
+    EXPECT_EQ(delivered, 3U);
+    const auto counters = shedder.counters();
+    EXPECT_EQ(counters.passed, 1U);
+    EXPECT_EQ(counters.sampled, 2U);
+    EXPECT_EQ(counters.dropped, 4U);
+
+    EXPECT_FALSE(shedder.try_release(at_ms(500)));
+    EXPECT_TRUE(shedder.try_release(at_ms(1000)));
+    EXPECT_EQ(shedder.counters().flushed, 1U);
+}
+
+/**
+ * @brief Verifies a conflated topic delivers its burst, holds its latest event and flushes it once refilled,
+ * without affecting the other topics.
+ */
+TEST(TokenBucketTest, SubjectConflatesLimitedTopic)
+{
+    tools::sync_subject<std::string, int> subject("limited");
+    std::map<std::string, int> received_count;
+    std::map<std::string, int> last_value;
+    subject.subscribe("fast", "count",
+        [&](const std::string& topic, const int& event, const std::string&)
+        {
+            ++received_count[topic];
+            last_value[topic] = event;
+        });
+    subject.subscribe("slow", "count",
+        [&](const std::string& topic, const int& event, const std::string&)
+        {
+            ++received_count[topic];
+            last_value[topic] = event;
+        });
+
+    subject.set_rate_limit("fast", tools::rate_limit { 20U, 2U, tools::shed_policy::conflate, 1U });
+    for (int i = 0; i < 5; ++i)
+    {
+        subject.publish("fast", i);
+        subject.publish("slow", i);
+    }
+
+    EXPECT_EQ(received_count["slow"], 5);
+    EXPECT_EQ(received_count["fast"], 2);
+    EXPECT_EQ(last_value["fast"], 1);
+    EXPECT_EQ(subject.conflated_pending(), 1U);
+    EXPECT_FALSE(subject.rate_limit_stats("slow").has_value());
+
+    const auto counters = subject.rate_limit_stats("fast");
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_EQ(counters->passed, 2U);
+    EXPECT_EQ(counters->conflated, 3U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    EXPECT_EQ(subject.flush_conflated(), 1U);
+    EXPECT_EQ(received_count["fast"], 3);
+    EXPECT_EQ(last_value["fast"], 4);
+    EXPECT_EQ(subject.conflated_pending(), 0U);
+    EXPECT_EQ(subject.flush_conflated(), 0U);
+
+    subject.clear_rate_limit("fast");
+    EXPECT_FALSE(subject.rate_limit_stats("fast").has_value());
+}
+
+/**
+ * @brief Verifies the publisher limit applies to all topics together, including batches.
+ */
+TEST(TokenBucketTest, SubjectDropsOverPublisherLimit)
+{
+    tools::sync_subject<std::string, int> subject("limited");
+    int received = 0;
+    subject.subscribe("a", "count", [&](const std::string&, const int&, const std::string&) { ++received; });
+    subject.subscribe("b", "count", [&](const std::string&, const int&, const std::string&) { ++received; });
+
+    subject.set_publisher_rate_limit(tools::rate_limit { 1U, 3U, tools::shed_policy::drop, 1U });
+    subject.publish("a", 1);
+    subject.publish("b", 2);
+
+    const int batch[] = { 3, 4 };
+    subject.publish_range("a", batch, 2U); // needs 2 tokens, only 1 left
+    subject.publish("b", 5);
+    subject.publish("a", 6);
+
+    EXPECT_EQ(received, 3);
+    const auto counters = subject.publisher_rate_limit_stats();
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_EQ(counters->passed, 3U);
+    EXPECT_EQ(counters->dropped, 3U);
+
+    subject.clear_publisher_rate_limit();
+    subject.publish("a", 7);
+    EXPECT_EQ(received, 4);
+    EXPECT_FALSE(subject.publisher_rate_limit_stats().has_value());
+}
+
+/**
+ * @brief Verifies the bucket takes back unused tokens without exceeding its burst.
+ */
+TEST(TokenBucketTest, GiveBackRestoresTokens)
+{
+    tools::token_bucket bucket(10U, 2U);
+    EXPECT_TRUE(bucket.try_acquire(2U, at_ms(1000)));
+    EXPECT_EQ(bucket.available(at_ms(1000)), 0U);
+
+    bucket.give_back(1U);
+    EXPECT_EQ(bucket.available(at_ms(1000)), 1U);
+    bucket.give_back(5U);
+    EXPECT_EQ(bucket.available(at_ms(1000)), 2U);
+    EXPECT_TRUE(bucket.try_acquire(2U, at_ms(1000)));
+    EXPECT_FALSE(bucket.try_acquire(1U, at_ms(1000)));
+}
+
+/**
+ * @brief Verifies a held event refused by the publisher limit leaves the token of its topic untouched.
+ */
+TEST(TokenBucketTest, FlushTakesTokensFromBothLimitsOrNeither)
+{
+    tools::sync_subject<std::string, int> subject("limited");
+    int received = 0;
+    subject.subscribe("a", "count", [&](const std::string&, const int&, const std::string&) { ++received; });
+    subject.subscribe("b", "count", [&](const std::string&, const int&, const std::string&) { ++received; });
+
+    subject.set_rate_limit("a", tools::rate_limit { 100U, 1U, tools::shed_policy::conflate, 1U });
+    subject.publish("a", 1);
+    subject.publish("a", 2);
+    EXPECT_EQ(received, 1);
+    EXPECT_EQ(subject.conflated_pending(), 1U);
+
+    subject.set_publisher_rate_limit(tools::rate_limit { 1U, 1U, tools::shed_policy::drop, 1U });
+    subject.publish("b", 3);
+    EXPECT_EQ(received, 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(subject.flush_conflated(), 0U);
+    EXPECT_EQ(subject.conflated_pending(), 1U);
+    EXPECT_EQ(subject.rate_limit_stats("a")->flushed, 0U);
+
+    // the topic token is still there: the next event of the topic is delivered and supersedes the held one
+    subject.clear_publisher_rate_limit();
+    subject.publish("a", 4);
+    EXPECT_EQ(received, 3);
+    EXPECT_EQ(subject.conflated_pending(), 0U);
+}
+
+/**
+ * @brief Verifies a flushed event is not overtaken by a newer event of its topic published during its delivery.
+ */
+TEST(TokenBucketTest, FlushKeepsTheTopicOrder)
+{
+    tools::sync_subject<std::string, int> subject("limited");
+    std::mutex received_mutex;
+    std::vector<int> received;
+    std::atomic<bool> delivering_held { false };
+    subject.subscribe("t", "order",
+        [&](const std::string&, const int& event, const std::string&)
+        {
+            if (2 == event)
+            {
+                delivering_held.store(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+            std::scoped_lock<std::mutex> guard(received_mutex);
+            received.push_back(event);
+        });
+
+    subject.set_rate_limit("t", tools::rate_limit { 1U, 1U, tools::shed_policy::conflate, 1U });
+    subject.set_publisher_rate_limit(tools::rate_limit { 1000000U, 1000U, tools::shed_policy::drop, 1U });
+    subject.publish("t", 1);
+    subject.publish("t", 2);
+    subject.clear_rate_limit("t");
+
+    std::thread flusher([&subject]() { EXPECT_EQ(subject.flush_conflated(), 1U); });
+    while (!delivering_held.load())
+    {
+        std::this_thread::yield();
+    }
+    subject.publish("t", 3);
+    flusher.join();
+
+    EXPECT_EQ(received, (std::vector<int> { 1, 2, 3 }));
+}
+
+/**
+ * @brief Verifies an observer may publish the topic whose held event it is receiving from a flush.
+ */
+TEST(TokenBucketTest, PublishFromAFlushedDeliveryDoesNotWait)
+{
+    tools::sync_subject<std::string, int> subject("limited");
+    std::vector<int> received;
+    subject.subscribe("t", "echo",
+        [&](const std::string& topic, const int& event, const std::string&)
+        {
+            received.push_back(event);
+            if (2 == event)
+            {
+                subject.publish(topic, 3);
+            }
+        });
+
+    subject.set_rate_limit("t", tools::rate_limit { 1U, 1U, tools::shed_policy::conflate, 1U });
+    subject.set_publisher_rate_limit(tools::rate_limit { 1000000U, 1000U, tools::shed_policy::drop, 1U });
+    subject.publish("t", 1);
+    subject.publish("t", 2);
+    subject.clear_rate_limit("t");
+
+    EXPECT_EQ(subject.flush_conflated(), 1U);
+    EXPECT_EQ(received, (std::vector<int> { 1, 2, 3 }));
+    EXPECT_EQ(subject.conflated_pending(), 0U);
+}
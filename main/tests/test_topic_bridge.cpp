@@ -0,0 +1,209 @@
+/**
+ * @file test_topic_bridge.cpp
+ * @brief Unit tests for the batched topic bridge using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/sync_observer.hpp"
+#include "tools/topic_bridge.hpp"
+
+namespace
+{
+    using datagram = std::vector<std::uint8_t>;
+
+    template <typename Topic, typename Evt>
+    class collecting_observer : public tools::sync_observer<Topic, Evt>
+    {
+    public:
+        void inform(const Topic& topic, const Evt& event, const std::string& origin) override
+        {
+            (void)origin;
+            topics.push_back(topic);
+            events.push_back(event);
+        }
+
+        std::vector<Topic> topics;
+        std::vector<Evt> events;
+    };
+
+    tools::topic_bridge_config make_config(std::size_t mtu, std::chrono::milliseconds linger, bool compress)
+    {
+        tools::topic_bridge_config config;
+        config.mtu = mtu;
+        config.linger = linger;
+        config.compress = compress;
+        return config;
+    }
+}
+
+// Events are coalesced into datagrams no larger than the MTU and republished remotely in order.
+TEST(TopicBridgeTest, CoalescesEventsIntoMtuSizedDatagrams)
+{
+    std::vector<datagram> wire;
+    auto sender = std::make_shared<tools::topic_bridge_sender<std::uint16_t, std::int32_t>>(
+        [&wire](const std::uint8_t* data, std::size_t size)
+        {
+            wire.emplace_back(data, data + size);
+            return true;
+        },
+        make_config(64U, std::chrono::hours(1), false));
+
+    tools::sync_subject<std::uint16_t, std::int32_t> local("node");
+    local.subscribe(1U, sender);
+    local.subscribe(2U, sender);
+    for (std::int32_t i = 0; i < 25; ++i)
+    {
+        local.publish(static_cast<std::uint16_t>(1U + (i % 2)), i);
+    }
+
+    // 2 header bytes, a 16-bit count, then 6 bytes per event: 10 events per 64-byte datagram
+    EXPECT_EQ(2U, wire.size());
+    EXPECT_EQ(5U, sender->pending_events());
+    EXPECT_TRUE(sender->flush());
+    EXPECT_FALSE(sender->flush());
+    ASSERT_EQ(3U, wire.size());
+    for (const auto& packet : wire)
+    {
+        EXPECT_LE(packet.size(), 64U);
+    }
+
+    tools::sync_subject<std::uint16_t, std::int32_t> remote("gateway");
+    auto observer = std::make_shared<collecting_observer<std::uint16_t, std::int32_t>>();
+    remote.subscribe(1U, observer);
+    remote.subscribe(2U, observer);
+    tools::topic_bridge_receiver<std::uint16_t, std::int32_t> receiver(remote);
+    for (const auto& packet : wire)
+    {
+        receiver.receive(packet.data(), packet.size());
+    }
+
+    ASSERT_EQ(25U, observer->events.size());
+    for (std::int32_t i = 0; i < 25; ++i)
+    {
+        EXPECT_EQ(i, observer->events[static_cast<std::size_t>(i)]);
+        EXPECT_EQ(1U + (i % 2), observer->topics[static_cast<std::size_t>(i)]);
+    }
+
+    const auto stats = sender->stats();
+    EXPECT_EQ(25U, stats.events);
+    EXPECT_EQ(3U, stats.datagrams);
+    EXPECT_EQ(25U, receiver.stats().events);
+}
+
+// A batch older than the linger is sent by flush_expired(), a young one is kept.
+TEST(TopicBridgeTest, FlushExpiredHonoursTheLinger)
+{
+    std::size_t datagrams = 0U;
+    tools::topic_bridge_sender<std::uint16_t, std::int32_t> sender(
+        [&datagrams](const std::uint8_t* /*data*/, std::size_t /*size*/)
+        {
+            ++datagrams;
+            return true;
+        },
+        make_config(tools::esp_now_mtu, std::chrono::milliseconds(20), false));
+
+    sender.inform(1U, 10, "node");
+    sender.inform(1U, 11, "node");
+    EXPECT_FALSE(sender.flush_expired());
+    EXPECT_EQ(0U, datagrams);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(25));
+    EXPECT_TRUE(sender.flush_expired());
+    EXPECT_EQ(1U, datagrams);
+    EXPECT_EQ(0U, sender.pending_events());
+}
+
+// Compressible batches travel gzip compressed and are inflated by the receiver.
+TEST(TopicBridgeTest, CompressesBatchesThatShrink)
+{
+    std::vector<datagram> wire;
+    tools::topic_bridge_sender<std::string, std::string> sender(
+        [&wire](const std::uint8_t* data, std::size_t size)
+        {
+            wire.emplace_back(data, data + size);
+            return true;
+        },
+        make_config(tools::udp_ethernet_mtu, std::chrono::hours(1), true));
+
+    std::size_t raw_bytes = 0U;
+    for (int i = 0; i < 20; ++i)
+    {
+        const std::string reading = "temperature=21.5;humidity=40;pressure=1013";
+        raw_bytes += reading.size();
+        sender.inform("sensors/room", reading, "node");
+    }
+    EXPECT_TRUE(sender.flush());
+    ASSERT_EQ(1U, wire.size());
+    EXPECT_EQ(tools::topic_bridge_gzip_flag, wire.front()[1]);
+    EXPECT_LT(wire.front().size(), raw_bytes);
+    EXPECT_EQ(1U, sender.stats().compressed_datagrams);
+
+    tools::sync_subject<std::string, std::string> remote("gateway");
+    auto observer = std::make_shared<collecting_observer<std::string, std::string>>();
+    remote.subscribe("sensors/room", observer);
+    tools::topic_bridge_receiver<std::string, std::string> receiver(remote);
+    EXPECT_EQ(20U, receiver.receive(wire.front().data(), wire.front().size()));
+    ASSERT_EQ(20U, observer->events.size());
+    EXPECT_EQ("temperature=21.5;humidity=40;pressure=1013", observer->events.back());
+}
+
+// Refused datagrams count their events as dropped, and foreign datagrams are rejected.
+TEST(TopicBridgeTest, CountsRefusedAndMalformedDatagrams)
+{
+    tools::topic_bridge_sender<std::uint16_t, std::int32_t> sender(
+        [](const std::uint8_t* /*data*/, std::size_t /*size*/) { return false; },
+        make_config(tools::esp_now_mtu, std::chrono::hours(1), false));
+    sender.inform(1U, 1, "node");
+    sender.inform(1U, 2, "node");
+    EXPECT_TRUE(sender.flush());
+    EXPECT_EQ(2U, sender.stats().dropped_events);
+    EXPECT_EQ(0U, sender.stats().datagrams);
+
+    tools::sync_subject<std::uint16_t, std::int32_t> remote("gateway");
+    tools::topic_bridge_receiver<std::uint16_t, std::int32_t> receiver(remote);
+    const datagram foreign = { 0x00U, 0x00U, 0x00U, 0x01U };
+    const datagram truncated = { tools::topic_bridge_magic, 0x00U, 0x00U, 0x02U, 0x00U, 0x01U };
+    EXPECT_EQ(0U, receiver.receive(foreign.data(), foreign.size()));
+    EXPECT_EQ(0U, receiver.receive(truncated.data(), truncated.size()));
+    EXPECT_EQ(2U, receiver.stats().malformed_datagrams);
+}
+#endif
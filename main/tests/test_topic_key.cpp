@@ -0,0 +1,132 @@
+/**
+ * @file test_topic_key.cpp
+ * @brief Unit tests for topic_key digests and topic_registry.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+
+#include "tools/async_observer.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/topic_key.hpp"
+
+using namespace tools::topic_literals;
+
+TEST(TopicKeyTest, LiteralKeysAreHashedAtCompileTime)
+{
+    static constexpr tools::topic_key temperature = "temperature";
+    static_assert(temperature == "temperature"_topic);
+    static_assert(temperature != "pressure"_topic);
+    static_assert(tools::topic_key() == tools::topic_key::from(""));
+    static_assert(sizeof(tools::topic_key) == sizeof(std::uint64_t));
+
+    const std::string runtime_name = "temperature";
+    EXPECT_EQ(tools::topic_key::from(runtime_name), temperature);
+    EXPECT_EQ(tools::topic_key::from("a").value(), 0xaf63dc4c8601ec8cULL); // FNV-1a 64 reference value
+
+    std::unordered_set<tools::topic_key> keys { "a"_topic, "b"_topic, "a"_topic };
+    EXPECT_EQ(keys.size(), 2U);
+}
+
+TEST(TopicKeyTest, RegistryInternsAndResolvesNames)
+{
+    tools::topic_registry registry;
+
+    const auto first = registry.intern("temperature");
+    const auto again = registry.intern("temperature");
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(*first, "temperature"_topic);
+    EXPECT_EQ(*again, *first);
+    EXPECT_EQ(registry.size(), 1U);
+
+    const auto name = registry.name_of("temperature"_topic);
+    ASSERT_TRUE(name.has_value());
+    EXPECT_EQ(*name, "temperature");
+
+    const auto unknown = registry.name_of("pressure"_topic);
+    ASSERT_FALSE(unknown.has_value());
+    EXPECT_EQ(unknown.error(), tools::topic_registry_error::unknown_key);
+}
+
+namespace
+{
+    class keyed_test_observer : public tools::sync_observer<tools::topic_key, int>
+    {
+    public:
+        void inform(const tools::topic_key& topic, const int& event, const std::string& origin) override
+        {
+            last_topic = topic;
+            last_event = event;
+            last_origin = origin;
+        }
+
+        tools::topic_key last_topic;
+        int last_event = 0;
+        std::string last_origin;
+    };
+}
+
+TEST(TopicKeyTest, SubjectsRouteOnKeys)
+{
+    tools::sync_subject<tools::topic_key, int> subject("keyed_subject");
+    auto observer = std::make_shared<keyed_test_observer>();
+    auto queued = std::make_shared<tools::async_observer<tools::topic_key, int, tools::sync_queue>>();
+    int handled = 0;
+
+    subject.subscribe("temperature"_topic, observer);
+    subject.subscribe("temperature"_topic, queued);
+    subject.subscribe("pressure"_topic, "handler", [&](const tools::topic_key&, const int& event, const std::string&)
+        { handled = event; });
+
+    subject.publish("temperature"_topic, 21);
+    subject.publish(tools::topic_key::from(std::string("pressure")), 1013);
+
+    EXPECT_EQ(observer->last_topic, "temperature"_topic);
+    EXPECT_EQ(observer->last_event, 21);
+    EXPECT_EQ(observer->last_origin, "keyed_subject");
+    EXPECT_EQ(handled, 1013);
+
+    auto event = queued->pop_first_event();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(std::get<0>(*event), "temperature"_topic);
+    EXPECT_EQ(std::get<1>(*event), 21);
+    EXPECT_FALSE(queued->pop_first_event().has_value());
+}
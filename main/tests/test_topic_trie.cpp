@@ -0,0 +1,162 @@
+/**
+ * @file test_topic_trie.cpp
+ * @brief Unit tests for the hierarchical topics, the topic trie and the hierarchical subject using the Google Test
+ * framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tools/async_observer.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/topic_trie.hpp"
+
+namespace
+{
+    std::vector<int> matches(const tools::topic_trie<int>& trie, const char* topic)
+    {
+        std::vector<int> found;
+        trie.match(tools::topic_path(topic), [&found](int value) { found.push_back(value); });
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+}
+
+/**
+ * @brief Test that topics are split into their levels and filters are validated.
+ */
+TEST(TopicPathTest, SplitsLevelsAndValidatesWildcards)
+{
+    const tools::topic_path topic("sensors/kitchen/temperature");
+    ASSERT_EQ(topic.depth(), 3U);
+    EXPECT_EQ(topic.segment(0U), "sensors");
+    EXPECT_EQ(topic.segment(1U), "kitchen");
+    EXPECT_EQ(topic.segment(2U), "temperature");
+    EXPECT_TRUE(topic.is_valid_name());
+
+    const tools::topic_path empty_levels("a//");
+    ASSERT_EQ(empty_levels.depth(), 3U);
+    EXPECT_EQ(empty_levels.segment(1U), "");
+    EXPECT_EQ(empty_levels.segment(2U), "");
+
+    EXPECT_TRUE(tools::topic_path("sensors/+/temperature").is_valid_filter());
+    EXPECT_TRUE(tools::topic_path("sensors/#").is_valid_filter());
+    EXPECT_TRUE(tools::topic_path("#").is_valid_filter());
+    EXPECT_FALSE(tools::topic_path("sensors/#/temperature").is_valid_filter());
+    EXPECT_FALSE(tools::topic_path("sensors/kit+chen").is_valid_filter());
+    EXPECT_FALSE(tools::topic_path("sensors/+").is_valid_name());
+}
+
+/**
+ * @brief Test exact, single-level and multi-level wildcard matching.
+ */
+TEST(TopicTrieTest, MatchesExactAndWildcardFilters)
+{
+    tools::topic_trie<int> trie;
+    EXPECT_TRUE(trie.insert(tools::topic_path("sensors/kitchen/temperature"), 1));
+    EXPECT_TRUE(trie.insert(tools::topic_path("sensors/+/temperature"), 2));
+    EXPECT_TRUE(trie.insert(tools::topic_path("sensors/#"), 3));
+    EXPECT_TRUE(trie.insert(tools::topic_path("#"), 4));
+    EXPECT_TRUE(trie.insert(tools::topic_path("+/+"), 5));
+    EXPECT_FALSE(trie.insert(tools::topic_path("sensors/#/x"), 6));
+    EXPECT_EQ(trie.size(), 5U);
+
+    EXPECT_EQ(matches(trie, "sensors/kitchen/temperature"), (std::vector<int> { 1, 2, 3, 4 }));
+    EXPECT_EQ(matches(trie, "sensors/garage/temperature"), (std::vector<int> { 2, 3, 4 }));
+    EXPECT_EQ(matches(trie, "sensors/garage"), (std::vector<int> { 3, 4, 5 }));
+    EXPECT_EQ(matches(trie, "sensors"), (std::vector<int> { 3, 4 }));
+    EXPECT_EQ(matches(trie, "actuators/valve/state"), (std::vector<int> { 4 }));
+}
+
+/**
+ * @brief Test that erasing values prunes the trie and leaves the other subscriptions untouched.
+ */
+TEST(TopicTrieTest, EraseRemovesOneSubscription)
+{
+    tools::topic_trie<int> trie;
+    trie.insert(tools::topic_path("a/+/c"), 1);
+    trie.insert(tools::topic_path("a/+/c"), 2);
+    trie.insert(tools::topic_path("a/#"), 3);
+
+    EXPECT_TRUE(trie.erase(tools::topic_path("a/+/c"), 1));
+    EXPECT_FALSE(trie.erase(tools::topic_path("a/+/c"), 1));
+    EXPECT_FALSE(trie.erase(tools::topic_path("a/b/c"), 2));
+    EXPECT_EQ(matches(trie, "a/b/c"), (std::vector<int> { 2, 3 }));
+
+    EXPECT_TRUE(trie.erase(tools::topic_path("a/+/c"), 2));
+    EXPECT_TRUE(trie.erase(tools::topic_path("a/#"), 3));
+    EXPECT_TRUE(trie.empty());
+    EXPECT_TRUE(matches(trie, "a/b/c").empty());
+}
+
+/**
+ * @brief Test that a hierarchical subject informs wildcard observers and handlers with the concrete topic.
+ */
+TEST(HierarchicalSubjectTest, PublishesToMatchingFilters)
+{
+    tools::hierarchical_subject<int> subject("Sensors");
+    auto temperatures = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+    auto everything = std::make_shared<tools::async_observer<std::string, int, tools::sync_queue>>();
+    EXPECT_TRUE(subject.subscribe("sensors/+/temperature", temperatures));
+    EXPECT_TRUE(subject.subscribe("sensors/#", everything));
+    EXPECT_FALSE(subject.subscribe("sensors/#/temperature", everything));
+
+    std::vector<std::string> handled;
+    EXPECT_TRUE(subject.subscribe("+/garage/#", "garage",
+        [&handled](const std::string& topic, const int& /*event*/, const std::string& /*origin*/)
+        { handled.push_back(topic); }));
+    EXPECT_EQ(subject.number_of_subscriptions(), 3U);
+
+    const tools::topic_path kitchen("sensors/kitchen/temperature");
+    subject.publish(kitchen, 21);
+    subject.publish("sensors/garage/temperature", 12);
+    subject.publish("sensors/garage/humidity", 60);
+
+    const auto temperature_events = temperatures->pop_all_events();
+    ASSERT_EQ(temperature_events.size(), 2U);
+    EXPECT_EQ(std::get<0>(temperature_events[0]), "sensors/kitchen/temperature");
+    EXPECT_EQ(std::get<1>(temperature_events[0]), 21);
+    EXPECT_EQ(std::get<2>(temperature_events[0]), "Sensors");
+    EXPECT_EQ(std::get<0>(temperature_events[1]), "sensors/garage/temperature");
+    EXPECT_EQ(everything->number_of_events(), 3U);
+    EXPECT_EQ(handled, (std::vector<std::string> { "sensors/garage/temperature", "sensors/garage/humidity" }));
+
+    EXPECT_TRUE(subject.unsubscribe(tools::topic_path("sensors/+/temperature"), temperatures));
+    EXPECT_TRUE(subject.unsubscribe(tools::topic_path("+/garage/#"), "garage"));
+    subject.publish(kitchen, 22);
+    EXPECT_FALSE(temperatures->has_events());
+    EXPECT_EQ(everything->number_of_events(), 4U);
+    EXPECT_EQ(handled.size(), 2U);
+}
@@ -0,0 +1,249 @@
+/**
+ * @file test_trace_ring.cpp
+ * @brief Unit tests for the trace rings, the task and pub/sub trace hooks and the Chrome trace exporter using the
+ * Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+// compile the trace hooks in: the traced templates below are instantiated with types local to this file
+#define USE_TRACE_RING
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cJSON/cJSON.h"
+#include "tools/async_observer.hpp"
+#include "tools/data_task.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/trace_ring.hpp"
+
+namespace
+{
+    enum class trace_topic : std::uint8_t
+    {
+        sample
+    };
+
+    struct trace_context
+    {
+        std::atomic<int> processed { 0 };
+    };
+
+    std::vector<tools::trace_event> events_of(
+        const std::vector<tools::trace_event>& events, const void* object, tools::trace_event_type type)
+    {
+        std::vector<tools::trace_event> matching;
+        std::copy_if(events.begin(), events.end(), std::back_inserter(matching),
+            [&](const tools::trace_event& event) { return (object == event.object) && (type == event.type); });
+        return matching;
+    }
+}
+
+// Test fixture detaching the ring of the trace hooks
+class TraceRingTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        tools::set_trace_target(nullptr);
+    }
+};
+
+TEST_F(TraceRingTest, ChannelKeepsTheNewestEvents)
+{
+    tools::trace_channel channel(2U);
+    for (std::uint32_t value = 0U; value < 6U; ++value)
+    {
+        channel.record(tools::trace_event_type::instant, "tick", &channel, value);
+    }
+
+    std::vector<tools::trace_event> events;
+    channel.collect(events, 3U);
+
+    EXPECT_EQ(6U, channel.recorded_count());
+    ASSERT_EQ(4U, events.size());
+    for (std::size_t index = 0U; index < events.size(); ++index)
+    {
+        EXPECT_EQ(index + 2U, events[index].value);
+        EXPECT_STREQ("tick", events[index].name);
+        EXPECT_EQ(&channel, events[index].object);
+        EXPECT_EQ(3U, events[index].channel);
+        EXPECT_EQ(tools::detail::current_trace_task(), events[index].task);
+    }
+    EXPECT_LE(events.front().timestamp_us, events.back().timestamp_us);
+}
+
+TEST_F(TraceRingTest, ConcurrentWritersNeverTearEvents)
+{
+    constexpr std::uint32_t writer_count = 4U;
+    constexpr std::uint32_t events_per_writer = 2000U;
+    static const char* const names[writer_count] = { "w0", "w1", "w2", "w3" };
+    tools::trace_ring ring(6U, 2U);
+
+    std::atomic_bool reading { true };
+    std::thread reader(
+        [&]()
+        {
+            while (reading.load())
+            {
+                for (const auto& event : ring.snapshot())
+                {
+                    ASSERT_EQ(names[event.value % writer_count], event.name);
+                }
+            }
+        });
+
+    std::vector<std::thread> writers;
+    for (std::uint32_t writer = 0U; writer < writer_count; ++writer)
+    {
+        writers.emplace_back(
+            [&ring, writer]()
+            {
+                for (std::uint32_t step = 0U; step < events_per_writer; ++step)
+                {
+                    const std::uint32_t value = (step * writer_count) + writer;
+                    ring.record(tools::trace_event_type::instant, names[writer], &ring, value);
+                }
+            });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    reading.store(false);
+    reader.join();
+
+    const auto events = ring.snapshot();
+    EXPECT_EQ(ring.channel_count() * ring.channel(0U).capacity(), events.size());
+    EXPECT_TRUE(std::is_sorted(events.begin(), events.end(),
+        [](const tools::trace_event& lhs, const tools::trace_event& rhs)
+        { return lhs.timestamp_us < rhs.timestamp_us; }));
+}
+
+TEST_F(TraceRingTest, NothingIsRecordedWithoutTarget)
+{
+    tools::trace_ring ring(4U, 1U);
+    tools::trace_record(tools::trace_event_type::instant, "dropped", &ring);
+    EXPECT_EQ(0U, ring.channel(0U).recorded_count());
+
+    EXPECT_EQ(nullptr, tools::set_trace_target(&ring));
+    tools::trace_record(tools::trace_event_type::instant, "kept", &ring, 7U);
+    EXPECT_EQ(&ring, tools::set_trace_target(nullptr));
+    tools::trace_record(tools::trace_event_type::instant, "dropped", &ring);
+
+    const auto events = ring.snapshot();
+    ASSERT_EQ(1U, events.size());
+    EXPECT_STREQ("kept", events[0].name);
+    EXPECT_EQ(7U, events[0].value);
+}
+
+TEST_F(TraceRingTest, HooksTracePublishInformAndProcess)
+{
+    tools::trace_ring ring(8U);
+    tools::set_trace_target(&ring);
+
+    tools::sync_subject<trace_topic, int> subject("TraceSubject");
+    auto observer = std::make_shared<tools::async_observer<trace_topic, int, tools::sync_queue>>();
+    subject.subscribe(trace_topic::sample, observer);
+
+    auto context = std::make_shared<trace_context>();
+    auto task = std::make_unique<tools::data_task<trace_context, int>>(
+        [](const std::shared_ptr<trace_context>&, const std::string&) {},
+        [](const std::shared_ptr<trace_context>& ctx, const int&, const std::string&) { ++ctx->processed; }, context,
+        8, "TraceTask", 2048);
+
+    subject.publish(trace_topic::sample, 1);
+    ASSERT_TRUE(task->submit(1));
+    for (int retry = 0; (retry < 500) && (context->processed.load() < 1); ++retry)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ASSERT_EQ(1, context->processed.load());
+    const void* task_object = task.get();
+    task.reset();
+    tools::set_trace_target(nullptr);
+
+    const auto events = ring.snapshot();
+    EXPECT_EQ(1U, events_of(events, &subject, tools::trace_event_type::publish).size());
+    EXPECT_EQ(1U, events_of(events, observer.get(), tools::trace_event_type::inform).size());
+
+    const auto dequeued = events_of(events, task_object, tools::trace_event_type::dequeue);
+    const auto begun = events_of(events, task_object, tools::trace_event_type::process_begin);
+    const auto ended = events_of(events, task_object, tools::trace_event_type::process_end);
+    ASSERT_EQ(1U, dequeued.size());
+    ASSERT_EQ(1U, begun.size());
+    ASSERT_EQ(1U, ended.size());
+    EXPECT_FALSE(events_of(events, task_object, tools::trace_event_type::task_switch).empty());
+    EXPECT_LE(dequeued[0].timestamp_us, begun[0].timestamp_us);
+    EXPECT_LE(begun[0].timestamp_us, ended[0].timestamp_us);
+    EXPECT_EQ(begun[0].task, ended[0].task);
+}
+
+TEST_F(TraceRingTest, ChromeTraceIsValidJson)
+{
+    tools::trace_ring ring(4U, 1U);
+    ring.record(tools::trace_event_type::publish, "publish", &ring, 1U);
+    ring.record(tools::trace_event_type::process_begin, "process", &ring, 2U);
+    ring.record(tools::trace_event_type::process_end, "process", &ring, 3U);
+
+    std::string json;
+    tools::write_chrome_trace(
+        ring.snapshot(), [&json](const char* data, std::size_t size) { json.append(data, size); });
+
+    cJSON* document = cJSON_Parse(json.c_str());
+    ASSERT_NE(nullptr, document) << json;
+    const cJSON* trace_events = cJSON_GetObjectItemCaseSensitive(document, "traceEvents");
+    ASSERT_TRUE(cJSON_IsArray(trace_events));
+    ASSERT_EQ(3, cJSON_GetArraySize(trace_events));
+
+    const char* phases[] = { "i", "B", "E" };
+    for (int index = 0; index < 3; ++index)
+    {
+        const cJSON* event = cJSON_GetArrayItem(trace_events, index);
+        EXPECT_STREQ(phases[index], cJSON_GetObjectItemCaseSensitive(event, "ph")->valuestring);
+        EXPECT_EQ(0, cJSON_GetObjectItemCaseSensitive(event, "pid")->valueint);
+        EXPECT_EQ(1, cJSON_GetObjectItemCaseSensitive(event, "tid")->valueint);
+    }
+    const cJSON* instant_args = cJSON_GetObjectItemCaseSensitive(cJSON_GetArrayItem(trace_events, 0), "args");
+    EXPECT_EQ(1, cJSON_GetObjectItemCaseSensitive(instant_args, "value")->valueint);
+
+    cJSON_Delete(document);
+}
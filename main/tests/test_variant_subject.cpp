@@ -0,0 +1,185 @@
+/**
+ * @file test_variant_subject.cpp
+ * @brief Unit tests for the variant_subject per-alternative dispatch using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "tools/variant_subject.hpp"
+
+namespace
+{
+    struct power_on
+    {
+    };
+
+    struct temperature
+    {
+        int celsius = 0;
+    };
+
+    struct pressure
+    {
+        int hpa = 0;
+    };
+
+    using sensor_event = std::variant<power_on, temperature, pressure>;
+    using sensor_subject = tools::variant_subject<std::string, sensor_event>;
+
+    class temperature_observer : public tools::sync_observer<std::string, temperature>
+    {
+    public:
+        void inform(const std::string& topic, const temperature& event, const std::string& origin) override
+        {
+            (void)topic;
+            (void)origin;
+            readings.push_back(event.celsius);
+        }
+
+        std::vector<int> readings;
+    };
+
+    class climate_observer
+        : public tools::sync_observer<std::string, temperature>
+        , public tools::sync_observer<std::string, pressure>
+    {
+    public:
+        void inform(const std::string& topic, const temperature& event, const std::string& origin) override
+        {
+            (void)topic;
+            EXPECT_EQ("sensors", origin);
+            temperature_sum += event.celsius;
+        }
+
+        void inform(const std::string& topic, const pressure& event, const std::string& origin) override
+        {
+            (void)topic;
+            (void)origin;
+            pressure_sum += event.hpa;
+        }
+
+        int temperature_sum = 0;
+        int pressure_sum = 0;
+    };
+
+    static_assert(sensor_subject::alternative_index<temperature> == 1U);
+    static_assert(sensor_subject::has_alternative<pressure>);
+    static_assert(!sensor_subject::has_alternative<int>);
+    static_assert(sensor_subject::observes_any<climate_observer>);
+    static_assert(!sensor_subject::observes_any<tools::sync_observer<std::string, int>>);
+}
+
+// Each observer only receives the alternatives it implements, unwrapped from the variant.
+TEST(VariantSubjectTest, DispatchesAlternativesToTheirSubscribers)
+{
+    sensor_subject subject("sensors");
+    auto temperatures = std::make_shared<temperature_observer>();
+    auto climate = std::make_shared<climate_observer>();
+
+    subject.subscribe("room", temperatures);
+    subject.subscribe("room", climate);
+    EXPECT_EQ(3U, subject.number_of_subscriptions());
+    EXPECT_EQ(2U, subject.number_of_subscriptions<temperature>());
+    EXPECT_EQ(1U, subject.number_of_subscriptions<pressure>());
+    EXPECT_EQ(0U, subject.number_of_subscriptions<power_on>());
+
+    subject.publish("room", sensor_event { temperature { 21 } });
+    subject.publish("room", sensor_event { pressure { 1013 } });
+    subject.publish("room", sensor_event { power_on {} });
+    subject.publish("room", temperature { 4 });
+    subject.publish("garage", sensor_event { temperature { 100 } });
+
+    EXPECT_EQ((std::vector<int> { 21, 4 }), temperatures->readings);
+    EXPECT_EQ(25, climate->temperature_sum);
+    EXPECT_EQ(1013, climate->pressure_sum);
+}
+
+// Handlers register per alternative and are removed by name for that alternative only.
+TEST(VariantSubjectTest, NamedHandlersPerAlternative)
+{
+    sensor_subject subject("sensors");
+    int powered = 0;
+    int pressure_sum = 0;
+
+    subject.subscribe<power_on>("panel", "power",
+        [&powered](const std::string& topic, const power_on& event, const std::string& origin)
+        {
+            (void)topic;
+            (void)event;
+            (void)origin;
+            ++powered;
+        });
+    subject.subscribe<pressure>("panel", "power",
+        [&pressure_sum](const std::string& topic, const pressure& event, const std::string& origin)
+        {
+            (void)topic;
+            (void)origin;
+            pressure_sum += event.hpa;
+        });
+
+    subject.publish("panel", sensor_event { power_on {} });
+    subject.publish("panel", pressure { 7 });
+    subject.publish("panel", sensor_event { temperature { 3 } });
+    EXPECT_EQ(1, powered);
+    EXPECT_EQ(7, pressure_sum);
+
+    subject.unsubscribe<power_on>("panel", "power");
+    EXPECT_EQ(1U, subject.number_of_subscriptions());
+    subject.publish("panel", power_on {});
+    subject.publish("panel", pressure { 5 });
+    EXPECT_EQ(1, powered);
+    EXPECT_EQ(12, pressure_sum);
+}
+
+// Unsubscribing an observer removes it from the tables of all its alternatives.
+TEST(VariantSubjectTest, UnsubscribeObserverFromAllAlternatives)
+{
+    sensor_subject subject("sensors");
+    auto climate = std::make_shared<climate_observer>();
+    auto temperatures = std::make_shared<temperature_observer>();
+
+    subject.subscribe("room", climate);
+    subject.subscribe("room", temperatures);
+    subject.unsubscribe("room", climate);
+    EXPECT_EQ(1U, subject.number_of_subscriptions());
+
+    subject.publish("room", sensor_event { temperature { 18 } });
+    subject.publish("room", sensor_event { pressure { 990 } });
+    EXPECT_EQ(0, climate->temperature_sum);
+    EXPECT_EQ(0, climate->pressure_sum);
+    EXPECT_EQ(std::vector<int> { 18 }, temperatures->readings);
+}
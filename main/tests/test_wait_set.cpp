@@ -0,0 +1,114 @@
+/**
+ * @file test_wait_set.cpp
+ * @brief Unit tests for the wait-on-many set of sources.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "tools/async_observer.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/wait_set.hpp"
+
+namespace
+{
+    constexpr std::size_t observer_source = 0U;
+    constexpr std::size_t queue_source = 1U;
+    constexpr std::size_t pipe_source = 5U;
+
+    constexpr tools::wait_set_mask bit(std::size_t index)
+    {
+        return tools::wait_set_mask { 1U } << index;
+    }
+}
+
+/**
+ * @brief One task waits on an observer, a queue and a pipe through a single wait_set.
+ *
+ * @test
+ * - Checks that attaching an idle source reports it once, and that waiting on idle sources times out.
+ * - Feeds each source from another thread; checks the returned mask names exactly that source and its data is
+ *   there to drain.
+ * - Checks that a detached source no longer wakes the set.
+ */
+TEST(WaitSetTest, ReportsWhichSourceIsReady)
+{
+    auto observer = std::make_shared<tools::async_observer<int, int>>();
+    tools::sync_queue<int> queue;
+    tools::memory_pipe pipe(64U);
+    tools::wait_set set;
+
+    EXPECT_TRUE(set.attach(*observer, observer_source));
+    EXPECT_TRUE(set.attach(queue, queue_source));
+    EXPECT_TRUE(set.attach(pipe, pipe_source));
+    EXPECT_FALSE(set.attach(queue, tools::wait_set::max_sources));
+    EXPECT_EQ(bit(observer_source) | bit(queue_source) | bit(pipe_source), set.poll());
+    EXPECT_EQ(0U, set.wait(std::chrono::milliseconds(10)));
+
+    std::thread producer(
+        [&]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            observer->inform(1, 10, "subject");
+        });
+    EXPECT_EQ(bit(observer_source), set.wait());
+    producer.join();
+    EXPECT_EQ(10, std::get<1>(observer->pop_first_event().value()));
+
+    producer = std::thread(
+        [&]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            queue.push(7);
+        });
+    EXPECT_EQ(bit(queue_source), set.wait(std::chrono::seconds(5)));
+    producer.join();
+    EXPECT_EQ(7, queue.front_pop().value());
+
+    const std::array<std::uint8_t, 3U> bytes = { 1U, 2U, 3U };
+    EXPECT_EQ(bytes.size(), pipe.send(bytes.data(), bytes.size(), std::chrono::milliseconds(0)));
+    EXPECT_EQ(bit(pipe_source), set.wait());
+    std::array<std::uint8_t, 3U> received = {};
+    EXPECT_EQ(bytes.size(), pipe.receive(received.data(), received.size(), std::chrono::milliseconds(0)));
+
+    queue.ready_hook().detach();
+    queue.push(8);
+    EXPECT_EQ(0U, set.wait(std::chrono::milliseconds(10)));
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_windowed_aggregate.cpp
+ * @brief Unit tests for windowed_aggregate and sync_windowed_aggregate.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "tools/windowed_aggregate.hpp"
+
+namespace
+{
+    struct reference_window
+    {
+        double min = 0.;
+        double max = 0.;
+        double mean = 0.;
+        double variance = 0.;
+    };
+
+    reference_window recompute(const std::vector<int>& values)
+    {
+        const auto front = static_cast<double>(values.front());
+        reference_window result { front, front, 0., 0. };
+        for (const int value : values)
+        {
+            result.min = (value < result.min) ? value : result.min;
+            result.max = (value > result.max) ? value : result.max;
+            result.mean += value;
+        }
+        result.mean /= static_cast<double>(values.size());
+        for (const int value : values)
+        {
+            result.variance += (value - result.mean) * (value - result.mean);
+        }
+        result.variance /= static_cast<double>(values.size());
+        return result;
+    }
+}
+
+/**
+ * @brief A sliding window tracks min/max/mean/variance as samples enter and leave it.
+ *
+ * @test
+ * - Feeds pseudo-random samples every tick and compares each summary with a recomputation over the window.
+ * - Checks expire() empties the window and late samples are ignored.
+ */
+TEST(WindowedAggregateTest, SlidingWindowMatchesRecomputation)
+{
+    constexpr std::int64_t length = 10;
+    tools::windowed_aggregate<std::int64_t, int> aggregate(length);
+    std::mt19937 generator(7U);
+    std::uniform_int_distribution<int> distribution(-100, 100);
+
+    std::vector<std::pair<std::int64_t, int>> history;
+    for (std::int64_t tick = 0; tick < 200; tick += 1 + (tick % 3))
+    {
+        const int sample = distribution(generator);
+        EXPECT_FALSE(aggregate.push(tick, sample).has_value());
+        history.emplace_back(tick, sample);
+
+        std::vector<int> window;
+        for (const auto& [timestamp, value] : history)
+        {
+            if (timestamp > tick - length)
+            {
+                window.push_back(value);
+            }
+        }
+        const auto summary = aggregate.summary();
+        ASSERT_TRUE(summary.has_value());
+        const reference_window expected = recompute(window);
+        ASSERT_EQ(summary->count, window.size());
+        EXPECT_EQ(summary->last, tick);
+        EXPECT_EQ(summary->min, expected.min);
+        EXPECT_EQ(summary->max, expected.max);
+        EXPECT_NEAR(summary->mean, expected.mean, 1e-9);
+        EXPECT_NEAR(summary->variance, expected.variance, 1e-6);
+    }
+
+    const std::size_t kept = aggregate.count();
+    EXPECT_FALSE(aggregate.push(0, 1).has_value());
+    EXPECT_EQ(aggregate.late_count(), 1U);
+    EXPECT_EQ(aggregate.count(), kept);
+
+    EXPECT_EQ(aggregate.expire(1000), kept);
+    EXPECT_TRUE(aggregate.empty());
+    EXPECT_FALSE(aggregate.summary().has_value());
+}
+
+/**
+ * @brief Tumbling windows are reported once, when the first sample past them arrives, skipping empty windows.
+ */
+TEST(WindowedAggregateTest, TumblingWindowsCloseOnce)
+{
+    using clock = std::chrono::steady_clock;
+    const clock::time_point start = clock::now();
+    tools::sync_windowed_aggregate<clock::time_point, double> aggregate(
+        std::chrono::milliseconds(100), tools::aggregate_window::tumbling);
+
+    EXPECT_FALSE(aggregate.push(start, 1.).has_value());
+    EXPECT_FALSE(aggregate.push(start + std::chrono::milliseconds(50), 3.).has_value());
+    EXPECT_FALSE(aggregate.push(start + std::chrono::milliseconds(99), 2.).has_value());
+
+    const auto first = aggregate.push(start + std::chrono::milliseconds(100), 10.);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->count, 3U);
+    EXPECT_EQ(first->first, start);
+    EXPECT_EQ(first->min, 1.);
+    EXPECT_EQ(first->max, 3.);
+    EXPECT_DOUBLE_EQ(first->mean, 2.);
+    EXPECT_NEAR(first->variance, 2. / 3., 1e-12);
+
+    // windows [200, 300) and [300, 400) are empty, the sample at 450 falls in [400, 500)
+    const auto second = aggregate.push(start + std::chrono::milliseconds(450), 20.);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->count, 1U);
+    EXPECT_EQ(second->max, 10.);
+    EXPECT_FALSE(aggregate.push(start + std::chrono::milliseconds(499), 30.).has_value());
+    const auto third = aggregate.push(start + std::chrono::milliseconds(500), 0.);
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(third->count, 2U);
+    EXPECT_DOUBLE_EQ(third->mean, 25.);
+
+    EXPECT_EQ(aggregate.expire(start + std::chrono::seconds(10)), 0U);
+    EXPECT_EQ(aggregate.count(), 1U);
+}
@@ -0,0 +1,121 @@
+/**
+ * @file test_windowed_histogram.cpp
+ * @brief Unit tests for the log-linear hdr_histogram using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "tools/windowed_histogram.hpp"
+
+/**
+ * @brief The window covers the last IntervalCount intervals: older samples drop out as the intervals rotate.
+ */
+TEST(SlidingWindowHistogramTest, ForgetsIntervalsBeyondTheWindow)
+{
+    auto window = std::make_unique<tools::sliding_window_histogram<3U, 5U, 16U>>();
+
+    EXPECT_EQ(0U, window->percentile(0.99));
+
+    for (std::uint64_t value = 0U; value < 100U; ++value)
+    {
+        window->add(1000U);
+    }
+    window->rotate();
+    window->add(10U, 100U);
+    window->rotate();
+    window->add(20U, 100U);
+
+    EXPECT_EQ(300U, window->total_count());
+    EXPECT_EQ(10U, window->merged().min());
+    EXPECT_EQ(1000U, window->merged().max());
+    EXPECT_EQ(20U, window->percentile(0.5));
+    EXPECT_NEAR(1000.0, static_cast<double>(window->percentile(0.99)), 1000.0 / 32.0);
+    EXPECT_EQ(100U, window->current().total_count());
+
+    // the 1000s were three intervals ago: out of the window
+    window->rotate();
+    EXPECT_EQ(200U, window->total_count());
+    EXPECT_EQ(20U, window->percentile(0.99));
+    EXPECT_EQ(0U, window->current().total_count());
+
+    // a long gap clears everything
+    window->rotate(10U);
+    EXPECT_EQ(0U, window->total_count());
+    EXPECT_EQ(0U, window->merged().total_count());
+
+    window->add(5U);
+    window->reset();
+    EXPECT_EQ(0U, window->percentile(0.5));
+}
+
+/**
+ * @brief Decayed samples weigh less: halving each interval, the recent values take over the percentiles.
+ */
+TEST(DecayingHistogramTest, RecentSamplesDominate)
+{
+    auto decaying = std::make_unique<tools::decaying_histogram<5U, 16U>>(0.5);
+
+    EXPECT_EQ(0U, decaying->percentile(0.5));
+    EXPECT_DOUBLE_EQ(0.0, decaying->average());
+
+    decaying->add(60U, 100U);
+    EXPECT_EQ(60U, decaying->percentile(0.5));
+    EXPECT_DOUBLE_EQ(60.0, decaying->average());
+
+    decaying->decay(3U);
+    EXPECT_DOUBLE_EQ(12.5, decaying->total_weight());
+
+    // 100 fresh samples weigh 100, the 100 old ones 12.5
+    decaying->add(10U, 100U);
+    EXPECT_DOUBLE_EQ(112.5, decaying->total_weight());
+    EXPECT_EQ(10U, decaying->percentile(0.5));
+    EXPECT_EQ(10U, decaying->percentile(0.88));
+    EXPECT_EQ(60U, decaying->percentile(0.9));
+    const double expected_average = ((12.5 * 60.0) + (100.0 * 10.0)) / 112.5;
+    const double expected_variance = ((12.5 * (60.0 - expected_average) * (60.0 - expected_average))
+                                         + (100.0 * (10.0 - expected_average) * (10.0 - expected_average)))
+        / 112.5;
+    EXPECT_NEAR(expected_average, decaying->average(), 1e-9);
+    EXPECT_NEAR(expected_variance, decaying->variance(decaying->average()), 1e-6);
+
+    // many decays renormalize the weights without overflow; the old samples vanish
+    decaying->decay(2000U);
+    decaying->add(7U);
+    EXPECT_EQ(7U, decaying->percentile(0.999));
+    EXPECT_NEAR(1.0, decaying->total_weight(), 1e-9);
+
+    decaying->reset();
+    EXPECT_DOUBLE_EQ(0.0, decaying->total_weight());
+}
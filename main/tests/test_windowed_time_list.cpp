@@ -0,0 +1,154 @@
+/**
+ * @file test_windowed_time_list.cpp
+ * @brief Unit tests for the time-windowed bounded list using the Google Test framework.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/sorted_time_list.hpp"
+#include "tools/windowed_time_list.hpp"
+
+/** @brief A push evicts every entry older than the horizon before the latest timestamp. */
+TEST(WindowedTimeListTest, EvictsBeyondHorizon)
+{
+    tools::windowed_time_list<long, std::string> list(16U, 10L);
+
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.top().has_value());
+    EXPECT_EQ(list.capacity(), 16U);
+    EXPECT_EQ(list.horizon(), 10L);
+
+    list.push(0L, "a");
+    list.push(5L, "b");
+    list.push(10L, "c");
+    EXPECT_EQ(list.size(), 3U);
+
+    list.push(12L, "d");
+    EXPECT_EQ(list.size(), 3U);
+    EXPECT_EQ(list.top()->second, "b");
+    EXPECT_EQ(list.evicted_count(), 1U);
+
+    list.push(30L, "e");
+    EXPECT_EQ(list.size(), 1U);
+    EXPECT_EQ(list.evicted_count(), 4U);
+    EXPECT_EQ(list.dropped_count(), 0U);
+
+    EXPECT_EQ(list.expire(40L), 0U);
+    EXPECT_EQ(list.expire(41L), 1U);
+    EXPECT_TRUE(list.empty());
+}
+
+/** @brief A full ring drops its oldest entry, or the pushed one when it is older than everything kept. */
+TEST(WindowedTimeListTest, FullRingDropsOldest)
+{
+    tools::windowed_time_list<unsigned, int> list(4U, 1000U);
+
+    for (unsigned timestamp_value = 1U; timestamp_value <= 6U; ++timestamp_value)
+    {
+        list.push(timestamp_value, static_cast<int>(timestamp_value));
+    }
+    EXPECT_EQ(list.size(), 4U);
+    EXPECT_EQ(list.top()->first, 3U);
+    EXPECT_EQ(list.dropped_count(), 2U);
+
+    list.push(1U, 1);
+    EXPECT_EQ(list.top()->first, 3U);
+    EXPECT_EQ(list.dropped_count(), 3U);
+
+    list.push(4U, 40);
+    const auto snapshot_values = list.snapshot_sorted();
+    ASSERT_EQ(snapshot_values.size(), 4U);
+    EXPECT_EQ(snapshot_values[0].first, 4U);
+    EXPECT_EQ(snapshot_values[1].second, 40);
+    EXPECT_EQ(snapshot_values[3].first, 6U);
+}
+
+/** @brief Late timestamps are inserted in order, equal ones after the kept ones; window visits and batch pops work. */
+TEST(WindowedTimeListTest, LateInsertVisitAndPopUntil)
+{
+    tools::windowed_time_list<long, std::unique_ptr<int>> list(8U, 100L);
+
+    list.push(10L, std::make_unique<int>(1));
+    list.push(30L, std::make_unique<int>(3));
+    list.push(20L, std::make_unique<int>(2));
+    list.emplace(20L, new int(22)); // NOLINT ownership taken by the unique_ptr
+    list.push(5L, std::make_unique<int>(0));
+
+    std::vector<int> window;
+    EXPECT_EQ(list.visit_range(10L, 30L, [&window](const auto& entry) { window.push_back(*entry.second); }), 3U);
+    EXPECT_EQ(window, (std::vector<int> { 1, 2, 22 }));
+
+    std::vector<int> drained;
+    EXPECT_EQ(list.pop_until(20L, [&drained](auto&& entry) { drained.push_back(*entry.second); }), 4U);
+    EXPECT_EQ(drained, (std::vector<int> { 0, 1, 2, 22 }));
+    EXPECT_EQ(*list.top_pop()->second, 3);
+    EXPECT_TRUE(list.empty());
+}
+
+/** @brief On a jittered chrono history, the window matches the tail of an unbounded sorted_time_list. */
+TEST(WindowedTimeListTest, MatchesSortedTimeListTail)
+{
+    using timestamp_type = std::chrono::steady_clock::time_point;
+    const auto horizon = std::chrono::milliseconds(50);
+    tools::windowed_time_list<timestamp_type, int> windowed(128U, horizon);
+    tools::sorted_time_list<timestamp_type, int> sorted;
+
+    const auto origin = std::chrono::steady_clock::now();
+    std::mt19937 generator(11U); // NOLINT fixed seed
+    std::uniform_int_distribution<int> jitter(-3, 0);
+    timestamp_type latest = origin;
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        const auto timestamp_value = origin + std::chrono::milliseconds(index + jitter(generator));
+        windowed.push(timestamp_value, index);
+        sorted.push(timestamp_value, index);
+        latest = std::max(latest, timestamp_value);
+    }
+
+    std::vector<int> expected;
+    sorted.visit_range(latest - horizon, latest + std::chrono::milliseconds(1),
+        [&expected](const auto& entry) { expected.push_back(entry.second); });
+
+    std::vector<int> kept;
+    windowed.for_each([&kept](const auto& entry) { kept.push_back(entry.second); });
+    EXPECT_EQ(kept, expected);
+    EXPECT_EQ(windowed.dropped_count(), 0U);
+    EXPECT_EQ(windowed.evicted_count() + windowed.size(), 1000U);
+}
@@ -0,0 +1,175 @@
+/**
+ * @file test_worker_pool.cpp
+ * @brief Unit tests for the work-stealing worker_pool using the Google Test framework.
+ *
+ * The tests include:
+ * - RunsAllDelegatedWork: Verifies that every delegated callback runs exactly once.
+ * - IdleWorkersStealFromBusyWorker: Verifies that work queued behind a long callback is stolen.
+ * - PerWorkerParamsAndStartupRoutine: Verifies the per-worker parameters and the startup routine.
+ * - DelegateAsyncOnPoolExecutor: Verifies delegate_async() through the pool executor.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/worker_pool.hpp"
+
+namespace
+{
+    struct pool_context
+    {
+        std::atomic<int> counter = 0;
+        std::atomic<bool> released = false;
+        tools::critical_section mutex;
+        std::set<std::string> names; ///< Protected by mutex.
+    };
+
+    using test_pool = tools::worker_pool<pool_context>;
+
+    void no_startup(const std::shared_ptr<pool_context>&, const std::string&)
+    {
+    }
+
+    bool wait_for_counter(const std::shared_ptr<pool_context>& context, int expected)
+    {
+        for (int i = 0; (i < 200) && (context->counter.load() < expected); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return context->counter.load() == expected;
+    }
+} // namespace
+
+TEST(WorkerPoolTest, RunsAllDelegatedWork)
+{
+    constexpr int nb_items = 200;
+    auto context = std::make_shared<pool_context>();
+    auto pool = std::make_unique<test_pool>(no_startup, context, "pool", 2048U, 4U);
+
+    EXPECT_EQ(pool->size(), 4U);
+
+    for (int i = 0; i < nb_items / 2; ++i)
+    {
+        pool->delegate([](const std::shared_ptr<pool_context>& ctx, const std::string&) { ctx->counter.fetch_add(1); });
+    }
+
+    std::vector<test_pool::call_back> batch(nb_items / 2,
+        [](const std::shared_ptr<pool_context>& ctx, const std::string&) { ctx->counter.fetch_add(1); });
+    pool->delegate_range(batch);
+
+    EXPECT_TRUE(wait_for_counter(context, nb_items));
+    pool.reset();
+    EXPECT_EQ(context->counter.load(), nb_items);
+}
+
+TEST(WorkerPoolTest, IdleWorkersStealFromBusyWorker)
+{
+    constexpr int nb_items = 10;
+    auto context = std::make_shared<pool_context>();
+    auto pool = std::make_unique<test_pool>(no_startup, context, "pool", 2048U, 2U);
+
+    // the first callback goes to worker 0 and keeps it busy until released
+    pool->delegate(
+        [](const std::shared_ptr<pool_context>& ctx, const std::string&)
+        {
+            while (!ctx->released.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+    // half of these land behind the blocked callback
+    for (int i = 0; i < nb_items; ++i)
+    {
+        pool->delegate([](const std::shared_ptr<pool_context>& ctx, const std::string&) { ctx->counter.fetch_add(1); });
+    }
+
+    EXPECT_TRUE(wait_for_counter(context, nb_items));
+    EXPECT_FALSE(context->released.load());
+    EXPECT_GT(pool->steal_count(), 0U);
+
+    context->released.store(true);
+    pool.reset();
+}
+
+TEST(WorkerPoolTest, PerWorkerParamsAndStartupRoutine)
+{
+    auto context = std::make_shared<pool_context>();
+    const std::vector<tools::worker_pool_params> params = {
+        { tools::base_task::run_on_all_cores, tools::base_task::default_priority },
+        { tools::base_task::run_on_all_cores, tools::base_task::default_priority },
+        { tools::base_task::run_on_all_cores, tools::base_task::default_priority },
+    };
+
+    auto pool = std::make_unique<test_pool>(
+        [](const std::shared_ptr<pool_context>& ctx, const std::string& task_name)
+        {
+            std::scoped_lock<tools::critical_section> guard(ctx->mutex);
+            ctx->names.insert(task_name);
+            ctx->counter.fetch_add(1);
+        },
+        context, "param_pool", 2048U, params);
+
+    EXPECT_EQ(pool->size(), params.size());
+    EXPECT_EQ(pool->worker(1).task_name(), "param_pool_1");
+
+    EXPECT_TRUE(wait_for_counter(context, static_cast<int>(params.size())));
+    pool.reset();
+
+    EXPECT_EQ(context->names, (std::set<std::string> { "param_pool_0", "param_pool_1", "param_pool_2" }));
+}
+
+TEST(WorkerPoolTest, DelegateAsyncOnPoolExecutor)
+{
+    auto context = std::make_shared<pool_context>();
+    auto pool = std::make_unique<test_pool>(no_startup, context, "async_pool", 2048U, 2U);
+
+    auto future = pool->delegate_async(
+        [](const std::shared_ptr<pool_context>& ctx, const std::string&, int value)
+        {
+            ctx->counter.fetch_add(1);
+            return value * 7;
+        },
+        6);
+
+    auto result = future.get_result();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 42);
+    EXPECT_EQ(context->counter.load(), 1);
+}
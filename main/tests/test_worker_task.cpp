@@ -49,10 +49,12 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <initializer_list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -414,6 +416,332 @@ TEST_F(WorkerTaskTest, DelegateRangeSupportsInitializerAndRange)
     EXPECT_EQ(context->computation_result, 6);
 }
 
+TEST_F(WorkerTaskTest, DelegateMoveOnlyAndOversizedCallables)
+{
+    using worker_task_t = tools::worker_task<TestContext>;
+
+    {
+        worker_task_t task([](const std::shared_ptr<TestContext>&, const std::string&) {}, context, "test_task", 4096);
+
+        // move-only callable, stored inline in the work queue
+        auto value = std::make_unique<int>(40);
+        task.delegate([value = std::move(value)](const std::shared_ptr<TestContext>& ctx, const std::string&)
+            { ctx->computation_result = *value; });
+
+        // callable larger than the inline buffer, wrapped in a call_back
+        std::array<int, 32> payload {};
+        payload.back() = 2;
+        static_assert(!worker_task_t::work_item::is_storable<std::array<int, 32>>);
+        task.delegate([payload](const std::shared_ptr<TestContext>& ctx, const std::string&)
+            { ctx->computation_result += payload.back(); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    EXPECT_EQ(context->computation_result, 42);
+}
+
+TEST(WorkerTaskPriorityTest, HighPriorityWorkOvertakesQueuedBulkWork)
+{
+    struct lane_context
+    {
+        std::atomic<bool> released = false;
+        std::vector<int> order; ///< Only touched by the worker until the task is destroyed.
+    };
+    using worker_task_t = tools::worker_task<lane_context>;
+
+    auto context = std::make_shared<lane_context>();
+    auto record = [](int value)
+    { return [value](const std::shared_ptr<lane_context>& ctx, const std::string&) { ctx->order.push_back(value); }; };
+
+    {
+        worker_task_t task(
+            [](const std::shared_ptr<lane_context>& ctx, const std::string&)
+            {
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            },
+            context, "lane_task", 4096);
+        task.set_starvation_quota(2U);
+
+        task.delegate_with_priority(tools::work_priority::low, record(100));
+        task.delegate(record(10));
+        for (int value = 0; value < 4; ++value)
+        {
+            task.delegate_with_priority(tools::work_priority::high, record(value));
+        }
+
+        context->released.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    EXPECT_EQ(context->order, (std::vector<int> { 0, 1, 10, 2, 3, 100 }));
+}
+
+TEST(WorkerTaskPriorityTest, BatchedRangesRunInOrder)
+{
+    struct lane_context
+    {
+        std::atomic<bool> released = false;
+        std::vector<int> order; ///< Only touched by the worker until the task is destroyed.
+    };
+    using worker_task_t = tools::worker_task<lane_context>;
+    using call_back = worker_task_t::call_back;
+
+    auto context = std::make_shared<lane_context>();
+    auto record = [](int value) -> call_back
+    { return [value](const std::shared_ptr<lane_context>& ctx, const std::string&) { ctx->order.push_back(value); }; };
+
+    std::vector<call_back> burst;
+    for (int value = 0; value < 20; ++value)
+    {
+        burst.push_back(record(value));
+    }
+
+    {
+        worker_task_t task(
+            [](const std::shared_ptr<lane_context>& ctx, const std::string&)
+            {
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            },
+            context, "batch_task", 4096);
+        task.set_batch_size(8U);
+
+        task.delegate_range(burst);
+        task.delegate_range(burst.begin(), burst.begin() + 2);
+        task.delegate_range({ record(100), record(101) });
+        EXPECT_EQ(24U, task.queue_depth());
+
+        context->released.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    std::vector<int> expected;
+    for (int value = 0; value < 20; ++value)
+    {
+        expected.push_back(value);
+    }
+    expected.insert(expected.end(), { 0, 1, 100, 101 });
+    EXPECT_EQ(context->order, expected);
+}
+
+TEST(WorkerTaskStopTest, UnprocessedWorkMovesToAnotherWorker)
+{
+    struct stop_context
+    {
+        std::atomic<bool> started = false;
+        std::atomic<bool> released = false;
+        std::vector<int> order; ///< Only touched by one worker at a time.
+    };
+    using worker_task_t = tools::worker_task<stop_context>;
+
+    auto context = std::make_shared<stop_context>();
+    auto record = [](int value)
+    { return [value](const std::shared_ptr<stop_context>& ctx, const std::string&) { ctx->order.push_back(value); }; };
+
+    worker_task_t task([](const std::shared_ptr<stop_context>&, const std::string&) {}, context, "stop_task", 4096);
+    task.delegate(
+        [](const std::shared_ptr<stop_context>& ctx, const std::string&)
+        {
+            ctx->started.store(true);
+            while (!ctx->released.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ctx->order.push_back(0);
+        });
+    while (!context->started.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    task.delegate(record(1));
+    task.delegate(record(2));
+    task.delegate_with_priority(tools::work_priority::high, record(3));
+
+    std::thread releaser(
+        [context]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            context->released.store(true);
+        });
+    auto unprocessed = task.stop(tools::task_drain_policy::discard);
+    releaser.join();
+
+    EXPECT_EQ(context->order, (std::vector<int> { 0 }));
+    ASSERT_EQ(unprocessed.size(), 3U);
+    EXPECT_TRUE(task.stop(tools::task_drain_policy::drain_all).empty());
+
+    {
+        worker_task_t next_task(
+            [](const std::shared_ptr<stop_context>&, const std::string&) {}, context, "next_task", 4096);
+        for (auto& work : unprocessed)
+        {
+            next_task.delegate_work_item(std::move(work));
+        }
+        EXPECT_TRUE(next_task.stop(tools::task_drain_policy::drain_all).empty());
+    }
+
+    EXPECT_EQ(context->order, (std::vector<int> { 0, 3, 1, 2 }));
+}
+
+TEST(WorkerTaskPriorityTest, ReservedWorkQueueDropsWorkToFullLane)
+{
+    struct lane_context
+    {
+        std::atomic<bool> released = false;
+        std::vector<int> order; ///< Only touched by the worker until the task is destroyed.
+    };
+    using worker_task_t = tools::worker_task<lane_context>;
+
+    auto context = std::make_shared<lane_context>();
+    auto record = [](int value)
+    { return [value](const std::shared_ptr<lane_context>& ctx, const std::string&) { ctx->order.push_back(value); }; };
+
+    {
+        worker_task_t task(
+            [](const std::shared_ptr<lane_context>& ctx, const std::string&)
+            {
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            },
+            context, "bounded_task", 4096);
+        task.reserve_work_queue(2U);
+
+        for (int value = 0; value < 4; ++value)
+        {
+            task.delegate(record(value));
+        }
+        task.delegate_with_priority(tools::work_priority::high, record(100));
+        EXPECT_EQ(2U, task.dropped_work_count());
+
+        context->released.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    EXPECT_EQ(context->order, (std::vector<int> { 100, 0, 1 }));
+}
+
+TEST(WorkerTaskDeadlineTest, EarliestDeadlineRunsFirstAndLateWorkIsDropped)
+{
+    struct deadline_context
+    {
+        std::atomic<bool> started = false;
+        std::atomic<bool> released = false;
+        std::vector<int> order; ///< Only touched by the worker.
+    };
+    using worker_task_t = tools::worker_task<deadline_context>;
+
+    auto context = std::make_shared<deadline_context>();
+    auto record = [](int value)
+    {
+        return [value](const std::shared_ptr<deadline_context>& ctx, const std::string&)
+        { ctx->order.push_back(value); };
+    };
+
+    {
+        worker_task_t task(
+            [](const std::shared_ptr<deadline_context>&, const std::string&) {}, context, "edf_task", 4096);
+        task.delegate(
+            [](const std::shared_ptr<deadline_context>& ctx, const std::string&)
+            {
+                ctx->started.store(true);
+                while (!ctx->released.load())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            });
+        while (!context->started.load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        task.delegate(record(0));
+        task.delegate_with_deadline(std::chrono::seconds(30), record(3));
+        task.delegate_with_deadline(std::chrono::seconds(10), record(1));
+        task.delegate_with_deadline(std::chrono::milliseconds(1), record(-1));
+        task.delegate_with_deadline(std::chrono::seconds(20), record(2));
+        EXPECT_EQ(task.queue_depth(), 5U);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        context->released.store(true);
+        EXPECT_TRUE(task.stop(tools::task_drain_policy::drain_all).empty());
+        EXPECT_EQ(task.missed_deadline_count(), 1U);
+    }
+
+    EXPECT_EQ(context->order, (std::vector<int> { 1, 2, 3, 0 }));
+}
+
+TEST(WorkerTaskResultTest, DelegateWithResultFillsTheCallerSlot)
+{
+    struct result_context
+    {
+        int base = 40;
+    };
+    using worker_task_t = tools::worker_task<result_context>;
+
+    worker_task_t task([](const std::shared_ptr<result_context>&, const std::string&) {},
+        std::make_shared<result_context>(), "result_task", 4096);
+
+    tools::work_result<std::string> result;
+    for (int i = 0; i < 3; ++i)
+    {
+        result.reset();
+        EXPECT_FALSE(result.ready());
+        task.delegate_with_result([i](const std::shared_ptr<result_context>& ctx, const std::string& name)
+            { return name + ":" + std::to_string(ctx->base + i); },
+            result);
+        EXPECT_TRUE(result.wait_for(std::chrono::seconds(5)));
+        ASSERT_TRUE(result.ready());
+        EXPECT_EQ(result.value(), "result_task:" + std::to_string(40 + i));
+    }
+
+    result.reset();
+    task.delegate_with_result(
+        [](const std::shared_ptr<result_context>&, const std::string&) { return std::string("taken"); }, result,
+        tools::work_priority::high);
+    result.wait();
+    EXPECT_EQ(result.take(), std::optional<std::string>("taken"));
+}
+
+TEST(WorkerTaskResultTest, DelegateWithResultRunsTheCallbackOnTheWorker)
+{
+    struct result_context
+    {
+        std::atomic<int> received { 0 };
+        std::atomic<bool> same_thread { false };
+        std::thread::id worker_id;
+    };
+    using worker_task_t = tools::worker_task<result_context>;
+
+    auto context = std::make_shared<result_context>();
+    {
+        worker_task_t task([](const std::shared_ptr<result_context>&, const std::string&) {}, context,
+            "callback_task", 4096);
+        task.delegate_with_result(
+            [](const std::shared_ptr<result_context>& ctx, const std::string&)
+            {
+                ctx->worker_id = std::this_thread::get_id();
+                return 7;
+            },
+            [context](int value)
+            {
+                context->same_thread.store(std::this_thread::get_id() == context->worker_id);
+                context->received.store(value);
+            });
+        EXPECT_TRUE(task.stop(tools::task_drain_policy::drain_all).empty());
+    }
+
+    EXPECT_EQ(context->received.load(), 7);
+    EXPECT_TRUE(context->same_thread.load());
+}
+
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 TEST(WorkerTaskCompileTimeChecks, PerfectForwardingConstraints)
 {
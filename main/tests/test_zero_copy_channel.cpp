@@ -0,0 +1,169 @@
+/**
+ * @file test_zero_copy_channel.cpp
+ * @brief Unit tests for the zero-copy inter-core message channel.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <utility>
+
+#include "tools/zero_copy_channel.hpp"
+
+namespace
+{
+    /**
+     * @brief Sensor frame large enough that copying it would show.
+     */
+    struct sensor_frame
+    {
+        std::uint32_t sequence = 0U;
+        std::size_t length = 0U;
+        std::array<std::uint8_t, 4096> samples = {};
+    };
+
+    using frame_channel = tools::zero_copy_channel<sensor_frame, 2>;
+}
+
+/**
+ * @brief Verifies the consumer reads the very block the producer filled, and blocks cycle back to the pool.
+ */
+TEST(ZeroCopyChannelTest, BlocksTravelWithoutCopy)
+{
+    auto channel = std::make_unique<frame_channel>();
+    ASSERT_EQ(4U, frame_channel::block_count);
+    EXPECT_EQ(4U, channel->free_blocks());
+
+    auto message = channel->acquire();
+    ASSERT_TRUE(message);
+    const sensor_frame* filled = message.get();
+    message->sequence = 7U;
+    message->length = 3U;
+    message->samples[2] = 0x5AU;
+    EXPECT_TRUE(channel->send(std::move(message)));
+    EXPECT_FALSE(message);
+    EXPECT_EQ(3U, channel->free_blocks());
+
+    {
+        auto received = channel->try_receive();
+        ASSERT_TRUE(received);
+        EXPECT_EQ(filled, received.get());
+        EXPECT_EQ(7U, received->sequence);
+        EXPECT_EQ(0x5AU, received->samples[2]);
+        EXPECT_FALSE(channel->try_receive());
+    }
+
+    // the released block is back once the free list runs dry and refills
+    std::set<const sensor_frame*> blocks;
+    std::array<frame_channel::message_ptr, frame_channel::block_count> held;
+    for (auto& slot : held)
+    {
+        slot = channel->acquire();
+        ASSERT_TRUE(slot);
+        blocks.insert(slot.get());
+    }
+    EXPECT_EQ(frame_channel::block_count, blocks.size());
+    EXPECT_EQ(1U, blocks.count(filled));
+    EXPECT_FALSE(channel->acquire());
+    EXPECT_FALSE(channel->send(channel->acquire()));
+}
+
+/**
+ * @brief Verifies unsent blocks return to the free list and a pending block survives a timed receive.
+ */
+TEST(ZeroCopyChannelTest, UnsentBlocksAndTimeouts)
+{
+    auto channel = std::make_unique<frame_channel>();
+    {
+        auto message = channel->acquire();
+        ASSERT_TRUE(message);
+        EXPECT_EQ(3U, channel->free_blocks());
+    }
+    EXPECT_EQ(4U, channel->free_blocks());
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(channel->receive(std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(15));
+
+    auto message = channel->acquire();
+    message->sequence = 42U;
+    ASSERT_TRUE(channel->isr_send(std::move(message)));
+    auto received = channel->receive(std::chrono::milliseconds(20));
+    ASSERT_TRUE(received);
+    EXPECT_EQ(42U, received->sequence);
+}
+
+/**
+ * @brief Streams frames from a producer thread to a consumer thread through a small pool.
+ */
+TEST(ZeroCopyChannelTest, ProducerToConsumerFrames)
+{
+    constexpr const std::uint32_t frame_count = 5000U;
+
+    auto channel = std::make_unique<frame_channel>();
+    std::thread producer(
+        [&]()
+        {
+            for (std::uint32_t sequence = 0U; sequence < frame_count; ++sequence)
+            {
+                auto message = channel->acquire();
+                while (!message)
+                {
+                    std::this_thread::yield();
+                    message = channel->acquire();
+                }
+                message->sequence = sequence;
+                message->length = message->samples.size();
+                message->samples.front() = static_cast<std::uint8_t>(sequence);
+                message->samples.back() = static_cast<std::uint8_t>(sequence >> 8U);
+                channel->send(std::move(message));
+            }
+        });
+
+    bool in_order = true;
+    for (std::uint32_t expected = 0U; expected < frame_count; ++expected)
+    {
+        auto received = channel->receive();
+        in_order = in_order && (expected == received->sequence)
+            && (static_cast<std::uint8_t>(expected) == received->samples.front())
+            && (static_cast<std::uint8_t>(expected >> 8U) == received->samples.back());
+    }
+
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_FALSE(channel->try_receive());
+}
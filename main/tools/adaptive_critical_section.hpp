@@ -0,0 +1,207 @@
+/**
+ * @file adaptive_critical_section.hpp
+ * @brief Spin-then-block lock for short critical sections.
+ *
+ * The sync containers hold their lock for a few tens of nanoseconds, far less than a context switch. Under
+ * contention adaptive_critical_section first spins for a bounded number of polls, hoping the holder running
+ * on another core releases the lock, and only then blocks on a plain critical_section.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ADAPTIVE_CRITICAL_SECTION_HPP_)
+#define ADAPTIVE_CRITICAL_SECTION_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Lock spinning briefly with a CPU pause hint before blocking on a critical_section.
+     *
+     * Same interface as critical_section (lock/try_lock/unlock, plus the isr_* variants on FreeRTOS), so it can
+     * replace it as the Lock parameter of basic_sync_queue and basic_sync_ring_vector. The spinning polls a
+     * relaxed "held" hint rather than the underlying lock, so spinners do not hammer the mutex (or, on FreeRTOS,
+     * enter the kernel on each poll). Spinning is disabled on single-core targets where the holder cannot run
+     * while we spin. ISR variants never spin.
+     */
+    class adaptive_critical_section : public non_copyable // NOLINT inherits from non copyable and non movable
+    {
+    public:
+        /** @brief Default number of polls before blocking, roughly a microsecond on a desktop core. */
+        static constexpr std::uint32_t default_spin_count = 100U;
+
+        /**
+         * @brief Constructs the lock with the default spin count.
+         */
+        adaptive_critical_section()
+            : adaptive_critical_section(default_spin_count)
+        {
+        }
+
+        /**
+         * @brief Constructs the lock.
+         *
+         * @param spin_count Polls of the lock before blocking (0 blocks at once), ignored on single-core targets.
+         */
+        explicit adaptive_critical_section(std::uint32_t spin_count)
+            : m_spin_count((cpu_core_count() > 1U) ? spin_count : 0U)
+        {
+        }
+
+        ~adaptive_critical_section() = default;
+
+        /**
+         * @brief Locks, spinning first, then blocking.
+         */
+        void lock() // NOLINT keep same interface than standard mutex
+        {
+            if (try_acquire())
+            {
+                return;
+            }
+
+            for (std::uint32_t spin = 0U; spin < m_spin_count; ++spin)
+            {
+                cpu_relax();
+                if (!m_held.load(std::memory_order_relaxed) && try_acquire())
+                {
+                    m_spin_acquisitions.fetch_add(1U, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            m_lock.lock();
+            m_held.store(true, std::memory_order_relaxed);
+            m_blocking_acquisitions.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Attempts to lock without spinning or blocking.
+         *
+         * @return true if the lock was taken.
+         */
+        bool try_lock() // NOLINT keep same interface than standard mutex
+        {
+            return try_acquire();
+        }
+
+        /**
+         * @brief Unlocks.
+         */
+        void unlock() // NOLINT keep same interface than standard mutex
+        {
+            m_held.store(false, std::memory_order_relaxed);
+            m_lock.unlock();
+        }
+
+#if defined(FREERTOS_PLATFORM)
+        /**
+         * @brief Locks from an ISR, without spinning.
+         */
+        void isr_lock() // NOLINT keep same interface than critical_section
+        {
+            m_lock.isr_lock();
+            m_held.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Attempts to lock from an ISR.
+         *
+         * @return true if the lock was taken.
+         */
+        bool try_isr_lock() // NOLINT keep same interface than critical_section
+        {
+            const bool locked = m_lock.try_isr_lock();
+            if (locked)
+            {
+                m_held.store(true, std::memory_order_relaxed);
+            }
+            return locked;
+        }
+
+        /**
+         * @brief Unlocks from an ISR.
+         */
+        void isr_unlock() // NOLINT keep same interface than critical_section
+        {
+            m_held.store(false, std::memory_order_relaxed);
+            m_lock.isr_unlock();
+        }
+#endif
+
+        /**
+         * @brief Gets the number of contended lock() calls that acquired the lock while spinning.
+         *
+         * @return The spin acquisition count.
+         */
+        [[nodiscard]] std::size_t spin_acquisitions() const
+        {
+            return m_spin_acquisitions.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the number of contended lock() calls that had to block.
+         *
+         * @return The blocking acquisition count.
+         */
+        [[nodiscard]] std::size_t blocking_acquisitions() const
+        {
+            return m_blocking_acquisitions.load(std::memory_order_relaxed);
+        }
+
+    private:
+        bool try_acquire()
+        {
+            if (m_lock.try_lock())
+            {
+                m_held.store(true, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        critical_section m_lock;
+        std::atomic_bool m_held = false; // hint only, the lock itself provides the ordering
+        std::uint32_t m_spin_count;
+        std::atomic<std::size_t> m_spin_acquisitions = 0U;
+        std::atomic<std::size_t> m_blocking_acquisitions = 0U;
+    };
+}
+
+#endif //  ADAPTIVE_CRITICAL_SECTION_HPP_
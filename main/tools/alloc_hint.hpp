@@ -0,0 +1,330 @@
+/**
+ * @file alloc_hint.hpp
+ * @brief Memory capability hints routing buffers to internal RAM, PSRAM or DMA capable memory.
+ *
+ * On ESP32 the hints map to heap_caps_malloc() capabilities: small hot blocks stay in internal SRAM, large cold
+ * buffers go to PSRAM when the board has some (CONFIG_SPIRAM), and DMA buffers come from DMA capable memory. On the
+ * other platforms every hint is served by malloc. hinted_allocator and make_hinted_unique carry a hint into the
+ * containers and owned buffers of the tools, e.g. ring_vector, memory_pipe and the gzip tables.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ALLOC_HINT_HPP_)
+#define ALLOC_HINT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "tools/platform_detection.hpp"
+
+#if defined(ESP_PLATFORM) && defined(FREERTOS_PLATFORM)
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+#endif
+
+// blocks of at least this size are routed to PSRAM by alloc_hint::automatic
+#if !defined(ALLOC_HINT_EXTERNAL_THRESHOLD)
+#define ALLOC_HINT_EXTERNAL_THRESHOLD 4096U
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Kind of memory a buffer should be allocated from.
+     */
+    enum class alloc_hint : std::uint8_t
+    {
+        automatic, ///< internal below ALLOC_HINT_EXTERNAL_THRESHOLD bytes, external from there on
+        internal,  ///< internal SRAM, for small or frequently accessed blocks
+        external,  ///< PSRAM when available, internal SRAM otherwise, for large and cold buffers
+        dma        ///< DMA capable memory, for the buffers handed to peripherals
+    };
+
+    /**
+     * @brief Resolves alloc_hint::automatic for a block size.
+     *
+     * @param size Block size in bytes.
+     * @param hint Requested hint.
+     * @return The hint to allocate with, never alloc_hint::automatic.
+     */
+    [[nodiscard]] constexpr alloc_hint resolve_alloc_hint(std::size_t size, alloc_hint hint) noexcept
+    {
+        if (hint != alloc_hint::automatic)
+        {
+            return hint;
+        }
+        return (size >= ALLOC_HINT_EXTERNAL_THRESHOLD) ? alloc_hint::external : alloc_hint::internal;
+    }
+
+    /**
+     * @brief Allocates a block from the memory matching a hint.
+     *
+     * The block is aligned like a malloc() block and must be released with hinted_free(). It does not go through
+     * the global operator new, so it is never served by the mem pool allocator.
+     *
+     * @param size Block size in bytes.
+     * @param hint Kind of memory wanted.
+     * @return The block, or nullptr when no memory of a suitable kind is left.
+     */
+    [[nodiscard]] inline void* hinted_malloc(std::size_t size, alloc_hint hint = alloc_hint::automatic) noexcept
+    {
+#if defined(ESP_PLATFORM) && defined(FREERTOS_PLATFORM)
+        constexpr std::uint32_t internal_caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+
+        switch (resolve_alloc_hint(size, hint))
+        {
+            case alloc_hint::external:
+            {
+#if defined(CONFIG_SPIRAM)
+                if (void* block = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT))
+                {
+                    return block;
+                }
+#endif
+                // no PSRAM or PSRAM exhausted, a slower internal block beats a failure
+                return heap_caps_malloc(size, internal_caps);
+            }
+
+            case alloc_hint::dma:
+                return heap_caps_malloc(size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+
+            case alloc_hint::internal:
+            case alloc_hint::automatic:
+            default:
+                return heap_caps_malloc(size, internal_caps);
+        }
+#else
+        static_cast<void>(hint);
+        return std::malloc(size); // NOLINT hinted blocks are released with hinted_free()
+#endif
+    }
+
+    /**
+     * @brief Releases a block allocated by hinted_malloc().
+     *
+     * @param ptr The block, nullptr is ignored.
+     */
+    inline void hinted_free(void* ptr) noexcept
+    {
+#if defined(ESP_PLATFORM) && defined(FREERTOS_PLATFORM)
+        heap_caps_free(ptr);
+#else
+        std::free(ptr); // NOLINT allocated by hinted_malloc()
+#endif
+    }
+
+    /**
+     * @brief Standard allocator allocating from the memory matching a hint.
+     *
+     * Usable with any allocator-aware container, e.g. tools::ring_vector<T, hinted_allocator<T>> or
+     * std::vector<std::uint8_t, hinted_allocator<std::uint8_t>>. Two allocators with the same hint are equal.
+     *
+     * @tparam T Element type, at most as aligned as std::max_align_t.
+     */
+    template <typename T>
+    class hinted_allocator
+    {
+    public:
+        static_assert(alignof(T) <= alignof(std::max_align_t), "hinted blocks are only aligned like malloc blocks");
+
+        using value_type = T;
+
+        hinted_allocator() noexcept = default;
+
+        /**
+         * @brief Constructs an allocator with the given hint.
+         *
+         * @param hint Kind of memory to allocate from.
+         */
+        explicit hinted_allocator(alloc_hint hint) noexcept
+            : m_hint(hint)
+        {
+        }
+
+        template <typename U>
+        hinted_allocator(const hinted_allocator<U>& other) noexcept // NOLINT implicit rebind conversion
+            : m_hint(other.hint())
+        {
+        }
+
+        /**
+         * @brief Allocates storage for count elements.
+         *
+         * @param count Number of elements.
+         * @return The storage; throws std::bad_alloc on failure when exceptions are enabled, nullptr otherwise.
+         */
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            void* block = hinted_malloc(count * sizeof(T), m_hint);
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            if (block == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+#endif
+            return static_cast<T*>(block);
+        }
+
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            static_cast<void>(count);
+            hinted_free(ptr);
+        }
+
+        [[nodiscard]] alloc_hint hint() const noexcept
+        {
+            return m_hint;
+        }
+
+        template <typename U>
+        [[nodiscard]] bool operator==(const hinted_allocator<U>& other) const noexcept
+        {
+            return m_hint == other.hint();
+        }
+
+        template <typename U>
+        [[nodiscard]] bool operator!=(const hinted_allocator<U>& other) const noexcept
+        {
+            return m_hint != other.hint();
+        }
+
+    private:
+        alloc_hint m_hint = alloc_hint::automatic;
+    };
+
+    /**
+     * @brief Deleter of the objects and arrays created by make_hinted_unique().
+     *
+     * @tparam T Object type, or array type of trivially destructible elements.
+     */
+    template <typename T>
+    struct hinted_deleter
+    {
+        void operator()(T* ptr) const noexcept
+        {
+            if (ptr != nullptr)
+            {
+                ptr->~T();
+                hinted_free(ptr);
+            }
+        }
+    };
+
+    template <typename T>
+    struct hinted_deleter<T[]>
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "hinted arrays hold trivially destructible elements");
+
+        void operator()(T* ptr) const noexcept
+        {
+            hinted_free(ptr);
+        }
+    };
+
+    /**
+     * @brief Unique pointer owning a hinted allocation.
+     */
+    template <typename T>
+    using hinted_unique_ptr = std::unique_ptr<T, hinted_deleter<T>>;
+
+    /**
+     * @brief Creates an object in the memory matching a hint.
+     *
+     * @param hint Kind of memory to allocate from.
+     * @param args Constructor arguments.
+     * @return The owning pointer; throws std::bad_alloc on failure when exceptions are enabled, empty otherwise.
+     */
+    template <typename T, typename... Args, typename = std::enable_if_t<!std::is_array<T>::value>>
+    [[nodiscard]] hinted_unique_ptr<T> make_hinted_unique(alloc_hint hint, Args&&... args)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "hinted blocks are only aligned like malloc blocks");
+
+        void* block = hinted_malloc(sizeof(T), hint);
+        if (block == nullptr)
+        {
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            throw std::bad_alloc();
+#else
+            return hinted_unique_ptr<T>();
+#endif
+        }
+
+#if defined(CPP_EXCEPTIONS_ENABLED)
+        try
+        {
+            return hinted_unique_ptr<T>(new (block) T(std::forward<Args>(args)...));
+        }
+        catch (...)
+        {
+            hinted_free(block);
+            throw;
+        }
+#else
+        return hinted_unique_ptr<T>(new (block) T(std::forward<Args>(args)...));
+#endif
+    }
+
+    /**
+     * @brief Creates a zero-initialized array in the memory matching a hint.
+     *
+     * @param count Number of elements.
+     * @param hint Kind of memory to allocate from.
+     * @return The owning pointer; throws std::bad_alloc on failure when exceptions are enabled, empty otherwise.
+     */
+    template <typename T, typename = std::enable_if_t<std::is_array<T>::value && (std::extent<T>::value == 0U)>>
+    [[nodiscard]] hinted_unique_ptr<T> make_hinted_unique(std::size_t count, alloc_hint hint)
+    {
+        using element_type = std::remove_extent_t<T>;
+        static_assert(std::is_trivially_default_constructible<element_type>::value, "hinted arrays are trivial");
+
+        void* block = hinted_malloc((count == 0U) ? 1U : (count * sizeof(element_type)), hint);
+        if (block == nullptr)
+        {
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            throw std::bad_alloc();
+#else
+            return hinted_unique_ptr<T>();
+#endif
+        }
+
+        auto* elements = static_cast<element_type*>(block);
+        std::uninitialized_value_construct_n(elements, count);
+        return hinted_unique_ptr<T>(elements);
+    }
+}
+
+#endif //  ALLOC_HINT_HPP_
@@ -0,0 +1,566 @@
+/**
+ * @file async_log_buffer.hpp
+ * @brief Lock-free per-core buffers of binary log records, the producer side of the async logger.
+ *
+ * This file contains the definition of the async_log_record, async_log_channel and async_log_buffer classes and of
+ * tools::async_log(), which the LOG_xxx macros call when USE_ASYNC_LOGGER is defined. A log call does not format
+ * anything: it copies the format pointer, the source location and the printf arguments into a preallocated record
+ * of the channel of the current core, and the async_logger drain task formats and writes the records later.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ASYNC_LOG_BUFFER_HPP_)
+#define ASYNC_LOG_BUFFER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+#include "tools/lock_free_mpmc_ring_buffer.hpp"
+#include "tools/logger.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(ESP_PLATFORM)
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief A log call captured without formatting.
+     *
+     * The format, file and function pointers are kept as is: they must have static storage, which string literals,
+     * __FILE__ and __FUNCTION__ have. The arguments are copied into the payload, C strings included.
+     */
+    struct async_log_record
+    {
+        /** @brief Size of the argument payload in bytes. */
+        static constexpr std::size_t payload_size = 96U;
+
+        /**
+         * @brief Formats the message of a record, instantiated at the log site for its argument types.
+         */
+        using formatter = int (*)(const async_log_record& record, char* output, std::size_t size);
+
+        formatter format_message = nullptr;
+        const char* format = nullptr;
+        const char* file = nullptr;
+        const char* function = nullptr;
+        int line = 0;
+        log_level level = log_level::info;
+        alignas(std::max_align_t) unsigned char payload[payload_size] = {}; // NOLINT raw argument storage
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief How a printf argument is stored in a record: C strings by copy, scalars and pointers by value.
+         */
+        template <typename Arg>
+        struct async_log_argument
+        {
+            using decayed = typename std::decay<Arg>::type;
+            static constexpr bool is_string
+                = std::is_same<decayed, const char*>::value || std::is_same<decayed, char*>::value;
+            using stored = typename std::conditional<is_string, const char*, decayed>::type;
+
+            static_assert(is_string || std::is_arithmetic<decayed>::value || std::is_pointer<decayed>::value,
+                "async log arguments must be printf scalars, pointers or C strings");
+
+            /** @brief Worst-case bytes taken in the fixed part of the payload, alignment included. */
+            static constexpr std::size_t fixed_bytes = is_string ? 0U : (sizeof(stored) + alignof(stored) - 1U);
+        };
+
+        /**
+         * @brief Payload layout of a record: the scalar arguments first, then the C strings.
+         */
+        template <typename... Args>
+        struct async_log_layout
+        {
+            static constexpr std::size_t fixed_region
+                = (std::size_t { 0U } + ... + async_log_argument<Args>::fixed_bytes);
+            static constexpr std::size_t string_count
+                = (std::size_t { 0U } + ... + (async_log_argument<Args>::is_string ? 1U : 0U));
+
+            static_assert((fixed_region + string_count) <= async_log_record::payload_size,
+                "too many async log arguments for an async_log_record payload");
+        };
+
+        /**
+         * @brief Sequential access to the payload of a record, shared by the packing and unpacking sides.
+         */
+        class async_log_payload_cursor
+        {
+        public:
+            async_log_payload_cursor(std::size_t fixed_region, std::size_t string_count)
+                : m_string_offset(fixed_region)
+                , m_strings_pending(string_count)
+            {
+            }
+
+            template <typename Stored>
+            void put(unsigned char* payload, const Stored& value)
+            {
+                if constexpr (std::is_same<Stored, const char*>::value)
+                {
+                    // a string gets at most its share of the space left, the next ones may be shorter
+                    const std::size_t room
+                        = ((async_log_record::payload_size - m_string_offset) / m_strings_pending) - 1U;
+                    --m_strings_pending;
+                    const char* text = (nullptr == value) ? "(null)" : value;
+                    unsigned char* destination = payload + m_string_offset; // NOLINT pointer arithmetic
+                    std::size_t length = 0U;
+                    for (; (length < room) && ('\0' != text[length]); ++length) // NOLINT pointer arithmetic
+                    {
+                        destination[length] = static_cast<unsigned char>(text[length]); // NOLINT pointer arithmetic
+                    }
+                    destination[length] = 0U; // NOLINT pointer arithmetic
+                    m_string_offset += length + 1U;
+                }
+                else
+                {
+                    std::memcpy(payload + align<Stored>(), &value, sizeof(Stored)); // NOLINT pointer arithmetic
+                    m_fixed_offset += sizeof(Stored);
+                }
+            }
+
+            template <typename Stored>
+            Stored get(const unsigned char* payload)
+            {
+                if constexpr (std::is_same<Stored, const char*>::value)
+                {
+                    const char* text = reinterpret_cast<const char*>(payload + m_string_offset); // NOLINT raw payload
+                    m_string_offset += std::strlen(text) + 1U;
+                    return text;
+                }
+                else
+                {
+                    Stored value {};
+                    std::memcpy(&value, payload + align<Stored>(), sizeof(Stored)); // NOLINT pointer arithmetic
+                    m_fixed_offset += sizeof(Stored);
+                    return value;
+                }
+            }
+
+        private:
+            template <typename Stored>
+            std::size_t align()
+            {
+                m_fixed_offset = (m_fixed_offset + alignof(Stored) - 1U) & ~(alignof(Stored) - 1U);
+                return m_fixed_offset;
+            }
+
+            std::size_t m_fixed_offset = 0U;
+            std::size_t m_string_offset;
+            std::size_t m_strings_pending;
+        };
+
+        /**
+         * @brief Formats the message of a record whose arguments were packed from the Stored types.
+         */
+        template <typename... Stored>
+        int format_async_log_message(const async_log_record& record, char* output, std::size_t size)
+        {
+            if constexpr (0U == sizeof...(Stored))
+            {
+                return std::snprintf(output, size, "%s", record.format);
+            }
+            else
+            {
+                async_log_payload_cursor cursor(
+                    async_log_layout<Stored...>::fixed_region, async_log_layout<Stored...>::string_count);
+                // braced initialization unpacks the arguments in order
+                const std::tuple<Stored...> values { cursor.template get<Stored>(record.payload)... };
+                return std::apply(
+                    [&record, output, size](const Stored&... value) {
+                        return std::snprintf(output, size, record.format, value...); // NOLINT format of the log site
+                    },
+                    values);
+            }
+        }
+
+        /**
+         * @brief Fills a record with a log call.
+         */
+        template <typename... Args>
+        void pack_async_log_record(async_log_record& record, log_level level, const char* file, const char* function,
+            int line, const char* format, const Args&... args)
+        {
+            using layout = async_log_layout<typename async_log_argument<Args>::stored...>;
+
+            record.format_message = &format_async_log_message<typename async_log_argument<Args>::stored...>;
+            record.format = format;
+            record.file = file;
+            record.function = function;
+            record.line = line;
+            record.level = level;
+
+            async_log_payload_cursor cursor(layout::fixed_region, layout::string_count);
+            (cursor.template put<typename async_log_argument<Args>::stored>(
+                 record.payload, static_cast<typename async_log_argument<Args>::stored>(args)),
+                ...);
+        }
+
+        /**
+         * @brief Formats a record as a full log line, prefix and terminal attributes included.
+         *
+         * @param record The record to format.
+         * @param output The destination buffer.
+         * @param size The size of the destination buffer (the line is truncated to fit).
+         * @return The length of the line, terminating newline included.
+         */
+        inline std::size_t format_async_log_line(const async_log_record& record, char* output, std::size_t size)
+        {
+            const char* end = log_level_end();
+            const std::size_t tail = std::strlen(end) + 1U;
+            if (size <= (tail + 1U))
+            {
+                return 0U;
+            }
+
+            const std::size_t body = size - tail;
+            const auto clamp = [](int written, std::size_t available)
+            { return (written < 0) ? 0U : (std::min)(static_cast<std::size_t>(written), available - 1U); };
+
+            std::size_t length = clamp(std::snprintf(output, body, "%s %s [%s, line %d] ", log_level_tag(record.level),
+                                           log_file_name(record.file), record.function, record.line),
+                body);
+            length += clamp(record.format_message(record, output + length, body - length), body - length); // NOLINT
+
+            std::memcpy(output + length, end, tail - 1U); // NOLINT pointer arithmetic
+            length += tail - 1U;
+            output[length] = '\n'; // NOLINT pointer arithmetic
+            ++length;
+            output[length] = '\0'; // NOLINT pointer arithmetic
+            return length;
+        }
+
+        /**
+         * @brief Writes a formatted log line to the platform console, without flushing.
+         */
+        inline void write_log_line(log_level level, const char* line)
+        {
+#if defined(ESP_PLATFORM)
+            static constexpr std::array<esp_log_level_t, 5U> esp_levels
+                = { ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE };
+            esp_log_write(esp_levels[static_cast<std::size_t>(level)], "log", "%s", line);
+#else
+            std::fputs(line, (level <= log_level::warning) ? stderr : stdout);
+#endif
+        }
+
+        /**
+         * @brief Flushes the platform console.
+         */
+        inline void flush_log_output()
+        {
+#if !defined(ESP_PLATFORM)
+            std::fflush(stderr);
+            std::fflush(stdout);
+#endif
+        }
+
+        /**
+         * @brief Returns the channel of the calling task: its core on ESP32, a per-thread round-robin slot elsewhere.
+         */
+        inline std::size_t current_async_log_channel()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::size_t>(xPortGetCoreID());
+#elif defined(FREERTOS_PLATFORM)
+            return 0U;
+#else
+            static std::atomic<std::size_t> next_channel { 0U };
+            thread_local const std::size_t channel = next_channel.fetch_add(1U, std::memory_order_relaxed);
+            return channel;
+#endif
+        }
+    }
+
+    /**
+     * @brief A lock-free pool of async_log_record shared by the producers of one core.
+     *
+     * Free and ready records are tracked by two lock_free_mpmc_ring_buffer of record indices, so acquiring, publishing
+     * and taking a record never blocks. A task migrated to another core between two calls only costs locality. When
+     * no record is free, the log call is dropped and counted.
+     */
+    class async_log_channel : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /** @brief Power of 2 of the number of records of each channel. */
+        static constexpr std::size_t records_pow2 = 5U;
+        /** @brief Number of records of each channel. */
+        static constexpr std::size_t record_count = std::size_t { 1U } << records_pow2;
+
+        async_log_channel()
+        {
+            for (std::uint32_t index = 0U; index < record_count; ++index)
+            {
+                static_cast<void>(m_free.push(index));
+            }
+        }
+
+        ~async_log_channel() = default;
+
+        /**
+         * @brief Claims a free record, producer side.
+         *
+         * @param index Receives the index of the record, to be given back to publish().
+         * @return The record to fill, or nullptr if the channel is full (the call is counted as dropped).
+         */
+        [[nodiscard]] async_log_record* acquire(std::uint32_t& index)
+        {
+            if (!m_free.pop(index))
+            {
+                m_dropped.fetch_add(1U, std::memory_order_relaxed);
+                return nullptr;
+            }
+            return &m_records[index];
+        }
+
+        /**
+         * @brief Hands a filled record to the drain, producer side.
+         *
+         * @param index The index given by acquire().
+         */
+        void publish(std::uint32_t index)
+        {
+            // at most record_count indices exist and the drain is the only consumer, so there is always room
+            static_cast<void>(m_ready.push(index));
+        }
+
+        /**
+         * @brief Takes the oldest published record, drain side (single consumer).
+         *
+         * @param index Receives the index of the record, to be given back to release().
+         * @return The record, or nullptr if none is ready.
+         */
+        [[nodiscard]] const async_log_record* take(std::uint32_t& index)
+        {
+            return m_ready.pop(index) ? &m_records[index] : nullptr;
+        }
+
+        /**
+         * @brief Returns a record taken by take() to the free pool, drain side.
+         *
+         * @param index The index given by take().
+         * @return false if a preempted producer still holds the ring slot, the caller retries.
+         */
+        [[nodiscard]] bool release(std::uint32_t index)
+        {
+            return m_free.push(index);
+        }
+
+        /**
+         * @brief Returns the number of log calls dropped because the channel was full.
+         *
+         * @return The dropped count since construction.
+         */
+        [[nodiscard]] std::uint32_t dropped_count() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<async_log_record, record_count> m_records = {};
+        lock_free_mpmc_ring_buffer<std::uint32_t, records_pow2> m_free;
+        lock_free_mpmc_ring_buffer<std::uint32_t, records_pow2> m_ready;
+        std::atomic<std::uint32_t> m_dropped { 0U };
+    };
+
+    /**
+     * @brief One async_log_channel per core (or per hardware thread on desktop platforms).
+     */
+    class async_log_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Allocates the channels, once.
+         *
+         * @param channel_count The number of channels (at least 1).
+         */
+        explicit async_log_buffer(std::size_t channel_count)
+            : m_channel_count((std::max)(std::size_t { 1U }, channel_count))
+            , m_channels(std::make_unique<async_log_channel[]>(m_channel_count)) // NOLINT fixed array of channels
+        {
+        }
+
+        ~async_log_buffer() = default;
+
+        /**
+         * @brief Captures a log call into the channel of the calling task.
+         *
+         * @return false if the channel was full and the call was dropped.
+         */
+        template <typename... Args>
+        bool write(log_level level, const char* file, const char* function, int line, const char* format,
+            const Args&... args)
+        {
+            async_log_channel& target = m_channels[detail::current_async_log_channel() % m_channel_count];
+            std::uint32_t index = 0U;
+            async_log_record* record = target.acquire(index);
+            if (nullptr == record)
+            {
+                return false;
+            }
+
+            detail::pack_async_log_record(*record, level, file, function, line, format, args...);
+            target.publish(index);
+            return true;
+        }
+
+        /**
+         * @brief Accesses a channel, for the drain.
+         *
+         * @param index The channel index, below channel_count().
+         * @return The channel.
+         */
+        [[nodiscard]] async_log_channel& channel(std::size_t index)
+        {
+            return m_channels[index];
+        }
+
+        /**
+         * @brief Returns the number of channels.
+         *
+         * @return The channel count.
+         */
+        [[nodiscard]] std::size_t channel_count() const
+        {
+            return m_channel_count;
+        }
+
+        /**
+         * @brief Returns the number of log calls dropped because their channel was full.
+         *
+         * @return The dropped count, all channels together.
+         */
+        [[nodiscard]] std::uint64_t dropped_count() const
+        {
+            std::uint64_t dropped = 0U;
+            for (std::size_t index = 0U; index < m_channel_count; ++index)
+            {
+                dropped += m_channels[index].dropped_count();
+            }
+            return dropped;
+        }
+
+    private:
+        std::size_t m_channel_count;
+        std::unique_ptr<async_log_channel[]> m_channels; // NOLINT fixed array of channels
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief The buffer the async_log() calls are routed to, and the number of calls using it.
+         */
+        struct async_log_route
+        {
+            std::atomic<async_log_buffer*> target { nullptr };
+            std::atomic<std::uint32_t> writers { 0U };
+        };
+
+        inline async_log_route& async_log_routing()
+        {
+            static async_log_route route;
+            return route;
+        }
+    }
+
+    /**
+     * @brief Routes the async_log() calls to a buffer, or back to synchronous output.
+     *
+     * Returns once no log call uses the previous buffer anymore.
+     *
+     * @param buffer The buffer to write to, nullptr to write synchronously.
+     * @return The previous buffer.
+     */
+    inline async_log_buffer* set_async_log_target(async_log_buffer* buffer)
+    {
+        auto& route = detail::async_log_routing();
+        async_log_buffer* previous = route.target.exchange(buffer);
+        while (0U != route.writers.load())
+        {
+            // a log call holds the route for a few instructions only
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        return previous;
+    }
+
+    /**
+     * @brief Logs a printf-style message through the async logger.
+     *
+     * When an async_logger is running, the call only copies the arguments into a record of the current core, or
+     * counts a drop if the core channel is full. Otherwise the line is formatted and written synchronously.
+     *
+     * @param level The log level.
+     * @param file The source file, with static storage.
+     * @param function The function name, with static storage.
+     * @param line The source line.
+     * @param format The printf format, with static storage.
+     * @param args The printf arguments: scalars, pointers, or C strings (copied, truncated to the record size).
+     */
+    template <typename... Args>
+    void async_log(log_level level, const char* file, const char* function, int line, const char* format,
+        const Args&... args)
+    {
+        auto& route = detail::async_log_routing();
+        route.writers.fetch_add(1U);
+        async_log_buffer* buffer = route.target.load();
+        if (nullptr != buffer)
+        {
+            static_cast<void>(buffer->write(level, file, function, line, format, args...));
+            route.writers.fetch_sub(1U, std::memory_order_release);
+            return;
+        }
+        route.writers.fetch_sub(1U, std::memory_order_release);
+
+        async_log_record record;
+        detail::pack_async_log_record(record, level, file, function, line, format, args...);
+        std::array<char, 256U> text = {};
+        static_cast<void>(detail::format_async_log_line(record, text.data(), text.size()));
+        detail::write_log_line(level, text.data());
+        detail::flush_log_output();
+    }
+}
+
+#endif //  ASYNC_LOG_BUFFER_HPP_
@@ -0,0 +1,231 @@
+/**
+ * @file async_logger.hpp
+ * @brief Low-priority task draining the async log buffers to the console.
+ *
+ * This file contains the definition of the async_logger class. While an async_logger exists, the LOG_xxx macros
+ * built with USE_ASYNC_LOGGER (and direct tools::async_log() calls) only capture binary records into the lock-free
+ * per-core channels of its async_log_buffer; its task formats them and writes them out in batches, with one flush
+ * per batch instead of one per line.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ASYNC_LOGGER_HPP_)
+#define ASYNC_LOGGER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "tools/async_log_buffer.hpp"
+#include "tools/base_task.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/light_event.hpp"
+#include "tools/logger.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Asynchronous logging backend: owns the per-core record channels and the task draining them.
+     *
+     * Records are written in per-core order; lines from different cores may interleave out of order. When records
+     * were dropped since the previous batch, the drain reports how many in a warning line. Only one async_logger may
+     * exist at a time; log calls made before its construction or after its destruction are written synchronously.
+     */
+    class async_logger : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Destination of the formatted lines, the console by default.
+         *
+         * @param level The level of the line.
+         * @param line The formatted line, newline terminated.
+         * @param length The length of the line.
+         */
+        using line_sink = std::function<void(log_level level, const char* line, std::size_t length)>;
+
+        /** @brief Longest formatted line, longer lines are truncated. */
+        static constexpr std::size_t max_line_length = 255U;
+
+#if defined(FREERTOS_PLATFORM)
+        /** @brief Drain task priority, just above the idle task. */
+        static constexpr int default_drain_priority = 1;
+#else
+        /** @brief Drain task priority, left to the scheduler. */
+        static constexpr int default_drain_priority = base_task::default_priority;
+#endif
+
+        async_logger() = delete;
+
+        /**
+         * @brief Creates the channels and starts the drain task, then routes async_log() to it.
+         *
+         * @param period Maximum delay between a log call and its output.
+         * @param sink Destination of the lines, the console if empty.
+         * @param stack_size The stack size of the drain task.
+         * @param priority The priority of the drain task.
+         * @param cpu_affinity The cpu affinity of the drain task.
+         */
+        explicit async_logger(const std::chrono::duration<std::uint64_t, std::milli>& period, line_sink sink = {},
+            std::size_t stack_size = 4096U, int priority = default_drain_priority,
+            int cpu_affinity = base_task::run_on_all_cores)
+            : m_buffer(static_cast<std::size_t>(cpu_core_count()))
+            , m_sink(std::move(sink))
+            , m_period(period)
+        {
+            m_task = std::make_unique<generic_task<async_logger>>(
+                [this](const std::shared_ptr<async_logger>&, const std::string&) { run_loop(); },
+                std::shared_ptr<async_logger> {}, "async_logger", stack_size, cpu_affinity, priority);
+            static_cast<void>(set_async_log_target(&m_buffer));
+        }
+
+        /**
+         * @brief Routes async_log() back to synchronous output, stops the task and writes the remaining records.
+         */
+        ~async_logger()
+        {
+            static_cast<void>(set_async_log_target(nullptr));
+            m_stop.store(true);
+            m_wake.signal();
+            m_task.reset();
+            static_cast<void>(drain());
+        }
+
+        /**
+         * @brief Formats and writes every published record now, from the calling task.
+         *
+         * @return The number of records written.
+         */
+        std::size_t drain()
+        {
+            std::scoped_lock<critical_section> guard(m_drain_mutex);
+
+            std::size_t written = 0U;
+            for (std::size_t channel_index = 0U; channel_index < m_buffer.channel_count(); ++channel_index)
+            {
+                async_log_channel& channel = m_buffer.channel(channel_index);
+                std::uint32_t index = 0U;
+                for (const async_log_record* record = channel.take(index); nullptr != record;
+                     record = channel.take(index))
+                {
+                    const std::size_t length = detail::format_async_log_line(*record, m_line.data(), m_line.size());
+                    const log_level level = record->level;
+                    while (!channel.release(index))
+                    {
+                        yield();
+                    }
+                    output(level, length);
+                    ++written;
+                }
+            }
+
+            report_drops();
+            if ((0U != written) && !m_sink)
+            {
+                detail::flush_log_output();
+            }
+            return written;
+        }
+
+        /**
+         * @brief Returns the number of log calls dropped because their channel was full.
+         *
+         * @return The dropped count since construction.
+         */
+        [[nodiscard]] std::uint64_t dropped_count() const
+        {
+            return m_buffer.dropped_count();
+        }
+
+    private:
+        void run_loop()
+        {
+            const auto period = std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(m_period);
+            while (!m_stop.load())
+            {
+                m_wake.wait_for_signal(period);
+                static_cast<void>(drain());
+            }
+        }
+
+        void output(log_level level, std::size_t length)
+        {
+            if (m_sink)
+            {
+                m_sink(level, m_line.data(), length);
+            }
+            else
+            {
+                detail::write_log_line(level, m_line.data());
+            }
+        }
+
+        void report_drops()
+        {
+            const std::uint64_t dropped = m_buffer.dropped_count();
+            if (dropped == m_reported_drops)
+            {
+                return;
+            }
+
+            async_log_record record;
+            detail::pack_async_log_record(record, log_level::warning, __FILE__, "async_logger", __LINE__,
+                "%llu log records dropped (channels full)",
+                static_cast<unsigned long long>(dropped - m_reported_drops)); // NOLINT printf %llu
+            m_reported_drops = dropped;
+            output(log_level::warning, detail::format_async_log_line(record, m_line.data(), m_line.size()));
+        }
+
+        async_log_buffer m_buffer;
+        line_sink m_sink;
+        std::chrono::duration<std::uint64_t, std::milli> m_period;
+        critical_section m_drain_mutex;
+        std::array<char, max_line_length + 1U> m_line = {};
+        std::uint64_t m_reported_drops = 0U;
+        std::atomic_bool m_stop = false;
+        light_event m_wake;
+        std::unique_ptr<generic_task<async_logger>> m_task;
+    };
+}
+
+#endif //  ASYNC_LOGGER_HPP_
@@ -35,16 +35,32 @@
 #if !defined(ASYNC_OBSERVER_HPP_)
 #define ASYNC_OBSERVER_HPP_
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
-#include "tools/sync_object.hpp"
+#include "tools/cond_var.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/latency_clock.hpp"
+#include "tools/light_event.hpp"
+#include "tools/mpsc_queue.hpp"
+#include "tools/ring_vector.hpp"
 #include "tools/sync_observer.hpp"
+#include "tools/trace_ring.hpp"
+#include "tools/wait_set.hpp"
 
 namespace tools
 {
@@ -81,6 +97,114 @@ namespace tools
         static const bool value = sizeof(SFINAE<T>(nullptr)) == sizeof(std::int32_t);
     };
 
+    /**
+     * @brief Input range presenting a batch of events of one topic as (topic, event, origin) entries.
+     *
+     * The entries are built on dereference, so that a container push_range() constructs each queued tuple
+     * directly from the batch without an intermediate vector.
+     *
+     * @tparam Topic The type of the topic associated with the events.
+     * @tparam Evt The type of the event data.
+     * @tparam Origin The type identifying the publishing subject.
+     */
+    template <typename Topic, typename Evt, typename Origin>
+    class event_batch_range
+    {
+    public:
+        using entry_type = std::tuple<Topic, Evt, Origin>;
+
+        /**
+         * @brief Iterator over the batch, yielding entries by value.
+         */
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = entry_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = entry_type;
+
+            iterator() = default;
+
+            iterator(const event_batch_range* batch, const Evt* current)
+                : m_batch(batch)
+                , m_current(current)
+            {
+            }
+
+            entry_type operator*() const
+            {
+                return entry_type { *m_batch->m_topic, *m_current, *m_batch->m_origin };
+            }
+
+            iterator& operator++()
+            {
+                ++m_current; // NOLINT pointer arithmetic
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator previous = *this;
+                ++m_current; // NOLINT pointer arithmetic
+                return previous;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return m_current == other.m_current;
+            }
+
+            bool operator!=(const iterator& other) const
+            {
+                return m_current != other.m_current;
+            }
+
+        private:
+            const event_batch_range* m_batch = nullptr;
+            const Evt* m_current = nullptr;
+        };
+
+        event_batch_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin)
+            : m_topic(&topic)
+            , m_events(events)
+            , m_count(count)
+            , m_origin(&origin)
+        {
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return iterator(this, m_events);
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return iterator(this, m_events + m_count); // NOLINT pointer arithmetic
+        }
+
+    private:
+        const Topic* m_topic;
+        const Evt* m_events;
+        std::size_t m_count;
+        const Origin* m_origin;
+    };
+
+    /**
+     * @brief Detects a push_range(range) member accepting an event_batch_range.
+     */
+    template <typename Container, typename Range, typename = void>
+    struct has_push_range : std::false_type
+    {
+    };
+
+    template <typename Container, typename Range>
+    struct has_push_range<Container, Range,
+        std::void_t<decltype(std::declval<Container&>().push_range(std::declval<const Range&>()))>> : std::true_type
+    {
+    };
+
     /**
      * @brief A class that provides asynchronous observation capabilities.
      *
@@ -88,16 +212,20 @@ namespace tools
      *
      * @tparam Topic The type of the topic associated with the events.
      * @tparam Evt The type of the event data.
-     * @tparam Sync_Container The type of the synchronization container used for event queuing.
+     * @tparam Sync_Container The type of the synchronization container used for event queuing; the default
+     * mpsc_queue lets publishers on different cores push without blocking each other.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
      */
-    template <typename Topic, typename Evt, template <class> class Sync_Container>
+    template <typename Topic, typename Evt, template <class> class Sync_Container = mpsc_queue,
+        typename Origin = std::string>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-        requires Sync_Container<std::tuple<Topic, Evt, std::string>>::thread_safe::value
+        requires Sync_Container<std::tuple<Topic, Evt, Origin>>::thread_safe::value
 #endif
-    class async_observer : public sync_observer<Topic, Evt> // NOLINT inherits from non copyable and non movable class
+    class async_observer
+        : public sync_observer<Topic, Evt, Origin> // NOLINT inherits from non copyable and non movable class
     {
     public:
-        static_assert(Sync_Container<std::tuple<Topic, Evt, std::string>>::thread_safe::value,
+        static_assert(Sync_Container<std::tuple<Topic, Evt, Origin>>::thread_safe::value,
             "Sync_Container has to provide a thread-safe container");
 
         ~async_observer() override = default;
@@ -107,10 +235,10 @@ namespace tools
          *
          * This constructor initializes the async_observer with an empty event queue and a wakeable object.
          */
-        template <typename T = Sync_Container<std::tuple<Topic, Evt, std::string>>,
+        template <typename T = Sync_Container<std::tuple<Topic, Evt, Origin>>,
             typename = std::enable_if_t<std::is_default_constructible_v<T>>>
         async_observer()
-            : sync_observer<Topic, Evt>()
+            : sync_observer<Topic, Evt, Origin>()
             , m_evt_queue()
         {
         }
@@ -121,10 +249,10 @@ namespace tools
          *
          * @param container_capacity The capacity of the event queue.
          */
-        template <typename T = Sync_Container<std::tuple<Topic, Evt, std::string>>,
+        template <typename T = Sync_Container<std::tuple<Topic, Evt, Origin>>,
             typename = std::enable_if_t<has_ctor_1_args<T>::value>>
         async_observer(std::size_t container_capacity)
-            : sync_observer<Topic, Evt>()
+            : sync_observer<Topic, Evt, Origin>()
             , m_evt_queue(container_capacity)
         {
         }
@@ -138,7 +266,7 @@ namespace tools
          * @param event The event data.
          * @param origin The origin of the event.
          */
-        void inform(const Topic& topic, const Evt& event, const std::string& origin) override
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
         {
             do_inform(topic, event, origin);
         }
@@ -152,7 +280,7 @@ namespace tools
          * @param event The event data.
          * @param origin The origin of the event.
          */
-        void inform(Topic&& topic, Evt&& event, std::string&& origin)
+        void inform(Topic&& topic, Evt&& event, Origin&& origin)
         {
             do_inform(std::move(topic), std::move(event), std::move(origin));
         }
@@ -173,20 +301,50 @@ namespace tools
         template <typename UTopic, typename UEvt, typename UOrigin>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
             requires std::is_constructible_v<Topic, UTopic> && std::is_constructible_v<Evt, UEvt>
-                         && std::is_constructible_v<std::string, UOrigin>
+                         && std::is_constructible_v<Origin, UOrigin>
 #endif
         auto inform(UTopic&& topic, UEvt&& event, UOrigin&& origin)
 #if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
             -> typename std::enable_if<std::is_constructible<Topic, UTopic>::value
-                    && std::is_constructible<Evt, UEvt>::value && std::is_constructible<std::string, UOrigin>::value,
+                    && std::is_constructible<Evt, UEvt>::value && std::is_constructible<Origin, UOrigin>::value,
                 void>::type
 #endif
         {
             do_inform(Topic(std::forward<UTopic>(topic)), Evt(std::forward<UEvt>(event)),
-                std::string(std::forward<UOrigin>(origin)));
+                Origin(std::forward<UOrigin>(origin)));
         }
 
-        using event_entry = std::tuple<Topic, Evt, std::string>;
+        using event_entry = std::tuple<Topic, Evt, Origin>;
+
+        /**
+         * @brief Informs the observer of a batch of events with one container push_range and one signal.
+         *
+         * Falls back to one push per event when the container has no push_range.
+         *
+         * @param topic The topic associated with the events.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         * @param origin The origin of the events.
+         */
+        void inform_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin) override
+        {
+            using batch_type = event_batch_range<Topic, Evt, Origin>;
+            TOOLS_TRACE(inform, "async_observer::inform_range", this, 0U);
+
+            if constexpr (has_push_range<Sync_Container<event_entry>, batch_type>::value)
+            {
+                m_evt_queue.push_range(batch_type(topic, events, count, origin));
+            }
+            else
+            {
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    m_evt_queue.push(event_entry { topic, events[i], origin }); // NOLINT pointer arithmetic
+                }
+            }
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
 
         /**
          * @brief Pops all events from the event queue.
@@ -199,18 +357,64 @@ namespace tools
         {
             std::vector<event_entry> events;
 
-            while (!m_evt_queue.empty())
+            // stops at the first failed pop rather than on empty(): an mpsc_queue element still being linked by
+            // its producer is counted before it can be popped
+            for (auto tmp = m_evt_queue.front_pop(); tmp.has_value(); tmp = m_evt_queue.front_pop())
             {
-                auto tmp = m_evt_queue.front_pop();
-                if (tmp.has_value())
-                {
-                    events.emplace_back(tmp.value());
-                }
+                events.emplace_back(std::move(tmp.value()));
             }
 
             return events;
         }
 
+        /**
+         * @brief Moves up to the destination capacity of queued events into caller-supplied storage.
+         *
+         * The events are extracted in FIFO order under a single container lock acquisition, without allocating.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of events extracted.
+         */
+        template <typename OutputIt>
+        std::size_t pop_events_into(OutputIt first, OutputIt last)
+        {
+            return m_evt_queue.pop_range(first, last);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch drain into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::span<event_entry> destination)
+        {
+            return pop_events_into(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Appends up to max_events queued events to a reusable vector under a single container lock.
+         *
+         * Intended to be called with a vector cleared by the caller between drains: once its capacity has grown to
+         * max_events, draining no longer allocates.
+         *
+         * @param destination Vector the events are appended to.
+         * @param max_events Maximum number of events to extract.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::vector<event_entry>& destination, std::size_t max_events)
+        {
+            const auto offset = static_cast<std::ptrdiff_t>(destination.size());
+            destination.resize(destination.size() + max_events);
+            const auto popped_count = pop_events_into(destination.begin() + offset, destination.end());
+            destination.resize(static_cast<std::size_t>(offset) + popped_count);
+            return popped_count;
+        }
+
         /**
          * @brief Pops the first event from the event queue.
          *
@@ -245,19 +449,9 @@ namespace tools
         {
             std::optional<event_entry> entry;
 
-            if (!m_evt_queue.empty())
+            for (auto tmp = m_evt_queue.front_pop(); tmp.has_value(); tmp = m_evt_queue.front_pop())
             {
-                auto tmp = m_evt_queue.back();
-
-                if (tmp.has_value())
-                {
-                    entry = tmp;
-
-                    while (!m_evt_queue.empty())
-                    {
-                        m_evt_queue.pop();
-                    }
-                }
+                entry = std::move(tmp);
             }
 
             return entry;
@@ -304,24 +498,1030 @@ namespace tools
             m_wakeable.wait_for_signal(timeout);
         }
 
+        /**
+         * @brief Gets the hook registering the observer with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified whenever an event is queued.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
+        /**
+         * @brief Reports the number of queued events as the backlog of the observer.
+         *
+         * @return The backlog counters, without capacity nor drop accounting.
+         */
+        observer_backlog backlog() override
+        {
+            observer_backlog counters;
+            counters.pending = number_of_events();
+            return counters;
+        }
+
     private:
         template <typename UTopic, typename UEvt, typename UOrigin>
         void do_inform(UTopic&& topic, UEvt&& event, UOrigin&& origin)
         {
+            TOOLS_TRACE(inform, "async_observer::inform", this, 0U);
             m_evt_queue.push(
                 event_entry { std::forward<UTopic>(topic), std::forward<UEvt>(event), std::forward<UOrigin>(origin) });
             m_wakeable.signal();
+            m_ready_hook.notify();
         }
 
         /**
          * @brief A synchronization object used for waking up threads or tasks.
          */
-        sync_object m_wakeable;
+        light_event m_wakeable;
+        wait_set_hook m_ready_hook;
+
+        /**
+         * @brief A synchronized queue that holds tuples of Topic, Evt, and Origin.
+         */
+        Sync_Container<std::tuple<Topic, Evt, Origin>> m_evt_queue;
+    };
+
+    /**
+     * @brief An asynchronous observer queueing shared event envelopes instead of per-observer event copies.
+     *
+     * Combined with sync_subject::publish_shared, a single immutable envelope is allocated per publish and every
+     * subscribed async_envelope_observer only queues a handle to it, so fan-out to N observers costs N reference
+     * count increments instead of N topic/event/origin copies. Events received through the plain inform() path are
+     * wrapped into a fresh envelope.
+     *
+     * When the subject stamps its envelopes (sync_subject::set_latency_stamping), the observer records the publish
+     * to enqueue and publish to dequeue latencies of each envelope, reported by latency_stats().
+     *
+     * @tparam Topic The type of the topic associated with the events.
+     * @tparam Evt The type of the event data.
+     * @tparam Sync_Container The type of the synchronization container used for envelope queuing.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     */
+    template <typename Topic, typename Evt, template <class> class Sync_Container, typename Origin = std::string>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        requires Sync_Container<shared_event_envelope<Topic, Evt, Origin>>::thread_safe::value
+#endif
+    class async_envelope_observer
+        : public sync_observer<Topic, Evt, Origin> // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(Sync_Container<shared_event_envelope<Topic, Evt, Origin>>::thread_safe::value,
+            "Sync_Container has to provide a thread-safe container");
+
+        using envelope_type = event_envelope<Topic, Evt, Origin>;
+        using envelope_ptr = shared_event_envelope<Topic, Evt, Origin>;
+
+        ~async_envelope_observer() override = default;
+
+        /**
+         * @brief Default constructor if the underlying container is default constructible.
+         */
+        template <typename T = Sync_Container<envelope_ptr>,
+            typename = std::enable_if_t<std::is_default_constructible_v<T>>>
+        async_envelope_observer()
+            : sync_observer<Topic, Evt, Origin>()
+            , m_evt_queue()
+        {
+        }
+
+        /**
+         * @brief Construct with a given container capacity if the underlying container has a single argument
+         * constructor.
+         *
+         * @param container_capacity The capacity of the envelope queue.
+         */
+        template <typename T = Sync_Container<envelope_ptr>, typename = std::enable_if_t<has_ctor_1_args<T>::value>>
+        async_envelope_observer(std::size_t container_capacity)
+            : sync_observer<Topic, Evt, Origin>()
+            , m_evt_queue(container_capacity)
+        {
+        }
+
+        /**
+         * @brief Informs the observer of a new event by wrapping it into a new envelope.
+         *
+         * @param topic The topic associated with the event.
+         * @param event The event data.
+         * @param origin The origin of the event.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            push_envelope(std::make_shared<envelope_type>(envelope_type { topic, event, origin }));
+        }
+
+        /**
+         * @brief Informs the observer of a new event by queueing the shared envelope handle.
+         *
+         * @param envelope The shared, immutable event envelope.
+         */
+        void inform_shared(const envelope_ptr& envelope) override
+        {
+            push_envelope(envelope);
+        }
+
+        /**
+         * @brief Pops all envelopes from the queue.
+         *
+         * @return std::vector<envelope_ptr> A vector containing all the queued envelopes in arrival order.
+         */
+        std::vector<envelope_ptr> pop_all_events()
+        {
+            std::vector<envelope_ptr> events;
+
+            while (!m_evt_queue.empty())
+            {
+                auto tmp = m_evt_queue.front_pop();
+                if (tmp.has_value())
+                {
+                    m_latency.on_dequeue(tmp.value()->published);
+                    events.emplace_back(std::move(tmp.value()));
+                }
+            }
+
+            return events;
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of queued events into caller-supplied storage.
+         *
+         * The events are extracted in FIFO order under a single container lock acquisition, without allocating.
+         * The destination is read back to record the delivery latencies, so OutputIt must be a forward iterator.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of events extracted.
+         */
+        template <typename OutputIt>
+        std::size_t pop_events_into(OutputIt first, OutputIt last)
+        {
+            const std::size_t popped_count = m_evt_queue.pop_range(first, last);
+            for (std::size_t index = 0U; index < popped_count; ++index, ++first)
+            {
+                m_latency.on_dequeue((*first)->published);
+            }
+            return popped_count;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch drain into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::span<envelope_ptr> destination)
+        {
+            return pop_events_into(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Appends up to max_events queued events to a reusable vector under a single container lock.
+         *
+         * Intended to be called with a vector cleared by the caller between drains: once its capacity has grown to
+         * max_events, draining no longer allocates.
+         *
+         * @param destination Vector the events are appended to.
+         * @param max_events Maximum number of events to extract.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::vector<envelope_ptr>& destination, std::size_t max_events)
+        {
+            const auto offset = static_cast<std::ptrdiff_t>(destination.size());
+            destination.resize(destination.size() + max_events);
+            const auto popped_count = pop_events_into(destination.begin() + offset, destination.end());
+            destination.resize(static_cast<std::size_t>(offset) + popped_count);
+            return popped_count;
+        }
+
+        /**
+         * @brief Pops the first envelope from the queue.
+         *
+         * @return std::optional<envelope_ptr> The first envelope, or an empty optional if the queue is empty.
+         */
+        std::optional<envelope_ptr> pop_first_event()
+        {
+            if (m_evt_queue.empty())
+            {
+                return std::nullopt;
+            }
+
+            auto envelope = m_evt_queue.front_pop();
+            if (envelope.has_value())
+            {
+                m_latency.on_dequeue(envelope.value()->published);
+            }
+            return envelope;
+        }
+
+        /**
+         * @brief Checks if there are any envelopes in the queue.
+         *
+         * @return true if the queue is not empty, false otherwise.
+         */
+        bool has_events()
+        {
+            return !m_evt_queue.empty();
+        }
+
+        /**
+         * @brief Returns the number of envelopes in the queue.
+         *
+         * @return The number of envelopes currently queued.
+         */
+        std::size_t number_of_events()
+        {
+            return m_evt_queue.size();
+        }
+
+        /**
+         * @brief Waits for events by blocking until a signal is received.
+         */
+        void wait_for_events()
+        {
+            m_wakeable.wait_for_signal();
+        }
+
+        /**
+         * @brief Waits for events to occur within a specified timeout duration.
+         *
+         * @param timeout The maximum duration to wait for events.
+         */
+        void wait_for_events(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            m_wakeable.wait_for_signal(timeout);
+        }
 
         /**
-         * @brief A synchronized queue that holds tuples of Topic, Evt, and std::string.
+         * @brief Gets the hook registering the observer with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified whenever an event is queued.
          */
-        Sync_Container<std::tuple<Topic, Evt, std::string>> m_evt_queue;
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
+        /**
+         * @brief Reports the number of queued envelopes as the backlog of the observer.
+         *
+         * @return The backlog counters, without capacity nor drop accounting.
+         */
+        observer_backlog backlog() override
+        {
+            observer_backlog counters;
+            counters.pending = number_of_events();
+            return counters;
+        }
+
+        /**
+         * @brief Gets the delivery latencies of the envelopes stamped by their subject.
+         *
+         * Only envelopes published with sync_subject::set_latency_stamping enabled are recorded: the publish to
+         * enqueue latency when informed, and the publish to dequeue latency when taken by one of the pop methods.
+         *
+         * @return The latency histograms, in nanoseconds.
+         */
+        [[nodiscard]] delivery_latency_stats latency_stats() const
+        {
+            return m_latency.snapshot();
+        }
+
+        /**
+         * @brief Clears the delivery latency histograms.
+         */
+        void reset_latency_stats()
+        {
+            m_latency.reset();
+        }
+
+    private:
+        void push_envelope(envelope_ptr envelope)
+        {
+            TOOLS_TRACE(inform, "async_envelope_observer::inform", this, 0U);
+            m_latency.on_enqueue(envelope->published);
+            m_evt_queue.push(std::move(envelope));
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
+
+        light_event m_wakeable;
+        wait_set_hook m_ready_hook;
+        Sync_Container<envelope_ptr> m_evt_queue;
+        delivery_latency_recorder m_latency;
+    };
+
+
+    /**
+     * @brief An asynchronous observer keeping only the latest pending event of each topic.
+     *
+     * inform() overwrites the pending slot of its topic in constant time (one hash lookup under the lock), and a
+     * topic is queued for the consumer only when its slot goes from clean to dirty. A slow consumer therefore sees at
+     * most one update per topic, the most recent one, whatever the publish rate: the queue is bounded by the number
+     * of topics. Topics are drained in the order they became dirty.
+     *
+     * A topic slot is created on its first event and then reused, so once every topic has been seen (or reserved
+     * at construction) informing no longer allocates beyond what copying the event itself requires.
+     *
+     * @tparam Topic The type of the topic associated with the events, hashable with Hash.
+     * @tparam Evt The type of the event data.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     * @tparam Lock The lock type protecting the slots, critical_section by default.
+     * @tparam Hash The hash function of the topics.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Lock = critical_section,
+        typename Hash = std::hash<Topic>>
+    class async_conflating_observer
+        : public sync_observer<Topic, Evt, Origin> // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using event_entry = std::tuple<Topic, Evt, Origin>;
+
+        async_conflating_observer() = default;
+        ~async_conflating_observer() override = default;
+
+        /**
+         * @brief Constructs the observer with room reserved for a number of topics.
+         *
+         * @param expected_topics The number of distinct topics expected.
+         */
+        explicit async_conflating_observer(std::size_t expected_topics)
+        {
+            m_slot_index.reserve(expected_topics);
+            m_slots.reserve(expected_topics);
+            m_dirty.reserve(expected_topics);
+        }
+
+        /**
+         * @brief Informs the observer of a new event, replacing the pending event of the same topic if any.
+         *
+         * @param topic The topic associated with the event.
+         * @param event The event data.
+         * @param origin The origin of the event.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            TOOLS_TRACE(inform, "async_conflating_observer::inform", this, 0U);
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                store_latest(topic, event, origin);
+            }
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
+
+        /**
+         * @brief Informs the observer of a batch of events of one topic: only the last one is kept.
+         *
+         * @param topic The topic associated with the events.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         * @param origin The origin of the events.
+         */
+        void inform_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin) override
+        {
+            if (0U == count)
+            {
+                return;
+            }
+
+            TOOLS_TRACE(inform, "async_conflating_observer::inform_range", this, 0U);
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                store_latest(topic, events[count - 1U], origin); // NOLINT pointer arithmetic
+                m_conflated += count - 1U;
+            }
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
+
+        /**
+         * @brief Takes the latest pending event of every dirty topic.
+         *
+         * @return The events, one per topic, in the order the topics became dirty.
+         */
+        std::vector<event_entry> pop_all_events()
+        {
+            std::vector<event_entry> events;
+            std::scoped_lock<Lock> guard(m_mutex);
+            events.reserve(m_dirty.size());
+            take_dirty(std::back_inserter(events), m_dirty.size());
+            return events;
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of pending events into caller-supplied storage.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of events extracted.
+         */
+        template <typename OutputIt>
+        std::size_t pop_events_into(OutputIt first, OutputIt last)
+        {
+            const auto capacity = static_cast<std::size_t>(std::distance(first, last));
+            std::scoped_lock<Lock> guard(m_mutex);
+            return take_dirty(first, capacity);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch drain into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::span<event_entry> destination)
+        {
+            return pop_events_into(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Appends up to max_events pending events to a reusable vector under a single lock.
+         *
+         * @param destination Vector the events are appended to.
+         * @param max_events Maximum number of events to extract.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::vector<event_entry>& destination, std::size_t max_events)
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return take_dirty(std::back_inserter(destination), max_events);
+        }
+
+        /**
+         * @brief Takes the pending event of the topic that became dirty first.
+         *
+         * @return The event, or an empty optional if no topic is dirty.
+         */
+        std::optional<event_entry> pop_first_event()
+        {
+            std::optional<event_entry> entry;
+            std::scoped_lock<Lock> guard(m_mutex);
+
+            if (!m_dirty.empty())
+            {
+                auto& dirty_slot = m_slots[m_dirty.front()];
+                entry.emplace(dirty_slot.m_topic, std::move(dirty_slot.m_pending->first),
+                    std::move(dirty_slot.m_pending->second));
+                dirty_slot.m_pending.reset();
+                m_dirty.erase(m_dirty.begin());
+            }
+
+            return entry;
+        }
+
+        /**
+         * @brief Checks if any topic has a pending event.
+         *
+         * @return true if at least one topic is dirty.
+         */
+        bool has_events()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return !m_dirty.empty();
+        }
+
+        /**
+         * @brief Returns the number of topics with a pending event.
+         *
+         * @return The number of dirty topics, at most the number of topics seen.
+         */
+        std::size_t number_of_events()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_dirty.size();
+        }
+
+        /**
+         * @brief Returns the number of distinct topics seen so far.
+         *
+         * @return The number of topic slots.
+         */
+        std::size_t number_of_topics()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_slots.size();
+        }
+
+        /**
+         * @brief Returns the number of events overwritten before the consumer took them.
+         *
+         * @return The conflated event count since construction.
+         */
+        std::size_t conflated_count()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_conflated;
+        }
+
+        /**
+         * @brief Reports the dirty topics as the backlog and the overwritten events as drops.
+         *
+         * @return The backlog counters.
+         */
+        observer_backlog backlog() override
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            observer_backlog counters;
+            counters.pending = m_dirty.size();
+            counters.peak_pending = m_peak_dirty;
+            counters.dropped = m_conflated;
+            return counters;
+        }
+
+        /**
+         * @brief Waits for events by blocking until a signal is received.
+         */
+        void wait_for_events()
+        {
+            m_wakeable.wait_for_signal();
+        }
+
+        /**
+         * @brief Waits for events to occur within a specified timeout duration.
+         *
+         * @param timeout The maximum duration to wait for events.
+         */
+        void wait_for_events(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            m_wakeable.wait_for_signal(timeout);
+        }
+
+        /**
+         * @brief Gets the hook registering the observer with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified whenever an event is queued.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
+    private:
+        struct topic_slot
+        {
+            Topic m_topic;
+            std::optional<std::pair<Evt, Origin>> m_pending;
+        };
+
+        // called with the lock held
+        void store_latest(const Topic& topic, const Evt& event, const Origin& origin)
+        {
+            const std::size_t index = slot_of(topic);
+            auto& pending = m_slots[index].m_pending;
+
+            if (pending.has_value())
+            {
+                pending->first = event;
+                pending->second = origin;
+                ++m_conflated;
+            }
+            else
+            {
+                pending.emplace(event, origin);
+                m_dirty.push_back(index);
+                m_peak_dirty = (m_dirty.size() > m_peak_dirty) ? m_dirty.size() : m_peak_dirty;
+            }
+        }
+
+        // called with the lock held, returns the slot index of the topic
+        std::size_t slot_of(const Topic& topic)
+        {
+            auto found = m_slot_index.find(topic);
+
+            if (found == m_slot_index.end())
+            {
+                found = m_slot_index.emplace(topic, m_slots.size()).first;
+                m_slots.push_back(topic_slot { topic, std::nullopt });
+            }
+
+            return found->second;
+        }
+
+        // called with the lock held, takes the count first dirty topics
+        template <typename OutputIt>
+        std::size_t take_dirty(OutputIt destination, std::size_t count)
+        {
+            const std::size_t taken = (count < m_dirty.size()) ? count : m_dirty.size();
+
+            for (std::size_t i = 0U; i < taken; ++i)
+            {
+                auto& dirty_slot = m_slots[m_dirty[i]];
+                *destination = event_entry { dirty_slot.m_topic, std::move(dirty_slot.m_pending->first),
+                    std::move(dirty_slot.m_pending->second) };
+                ++destination;
+                dirty_slot.m_pending.reset();
+            }
+
+            m_dirty.erase(m_dirty.begin(), m_dirty.begin() + static_cast<std::ptrdiff_t>(taken));
+            return taken;
+        }
+
+        Lock m_mutex;
+        std::unordered_map<Topic, std::size_t, Hash> m_slot_index;
+        std::vector<topic_slot> m_slots;
+        std::vector<std::size_t> m_dirty; // slot indexes of the dirty topics, oldest first
+        std::size_t m_conflated = 0U;
+        std::size_t m_peak_dirty = 0U;
+        light_event m_wakeable;
+        wait_set_hook m_ready_hook;
+    };
+
+
+    /**
+     * @brief Selects what an async_bounded_observer does with an event arriving while its queue is full.
+     */
+    enum class observer_overflow_policy : std::uint8_t
+    {
+        drop_oldest, //!< overwrite the oldest pending event
+        drop_newest, //!< discard the incoming event
+        conflate,    //!< replace the pending event of the same topic, or drop the oldest if there is none
+        block        //!< block the publisher until there is room or the timeout elapses, then drop the newest
+    };
+
+    /**
+     * @brief An asynchronous observer queueing at most a fixed number of events.
+     *
+     * The events are stored in a ring_vector allocated once at construction, so a consumer falling behind can
+     * neither exhaust the heap nor make informing allocate. When the queue is full, the overflow policy decides
+     * which event is lost; every lost event is counted, and the counters are reported through backlog() so that
+     * sync_subject can skip or report slow subscribers.
+     *
+     * With the conflate policy, the pending event of the same topic is searched at most over the capacity and
+     * Topic must be equality comparable. With the block policy, the publisher is suspended at most block_timeout
+     * per event: a stuck consumer then slows its publishers down instead of silently losing events.
+     *
+     * @tparam Topic The type of the topic associated with the events.
+     * @tparam Evt The type of the event data, default constructible.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     * @tparam Lock The lock type protecting the queue, critical_section by default.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Lock = critical_section>
+    class async_bounded_observer
+        : public sync_observer<Topic, Evt, Origin> // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using event_entry = std::tuple<Topic, Evt, Origin>;
+
+        async_bounded_observer() = delete;
+        ~async_bounded_observer() override = default;
+
+        /**
+         * @brief Constructs the observer with its queue capacity and overflow policy.
+         *
+         * @param capacity The maximum number of pending events, at least 1.
+         * @param policy What to do with an event arriving while the queue is full.
+         * @param block_timeout The longest a publisher waits for room with the block policy.
+         */
+        explicit async_bounded_observer(std::size_t capacity,
+            observer_overflow_policy policy = observer_overflow_policy::drop_oldest,
+            const std::chrono::duration<std::uint64_t, std::micro>& block_timeout
+            = std::chrono::duration<std::uint64_t, std::micro>(0U))
+            : m_events((0U == capacity) ? 1U : capacity)
+            , m_policy(policy)
+            , m_block_timeout(std::chrono::duration_cast<std::chrono::microseconds>(block_timeout))
+        {
+        }
+
+        /**
+         * @brief Informs the observer of a new event, applying the overflow policy if the queue is full.
+         *
+         * @param topic The topic associated with the event.
+         * @param event The event data.
+         * @param origin The origin of the event.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            do_inform(topic, event, origin);
+        }
+
+        /**
+         * @brief Informs the observer of a new event using exact rvalue arguments.
+         *
+         * @param topic The topic associated with the event.
+         * @param event The event data.
+         * @param origin The origin of the event.
+         */
+        void inform(Topic&& topic, Evt&& event, Origin&& origin)
+        {
+            do_inform(std::move(topic), std::move(event), std::move(origin));
+        }
+
+        /**
+         * @brief Informs the observer of a batch of events under a single lock and with a single signal.
+         *
+         * The overflow policy applies to each event in turn.
+         *
+         * @param topic The topic associated with the events.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         * @param origin The origin of the events.
+         */
+        void inform_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin) override
+        {
+            TOOLS_TRACE(inform, "async_bounded_observer::inform_range", this, 0U);
+            {
+                std::unique_lock<Lock> guard(m_mutex);
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    enqueue(guard, topic, events[i], origin); // NOLINT pointer arithmetic
+                }
+            }
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
+
+        /**
+         * @brief Takes all pending events.
+         *
+         * @return The events in FIFO order.
+         */
+        std::vector<event_entry> pop_all_events()
+        {
+            std::vector<event_entry> events;
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                events.reserve(m_events.size());
+                take_events(std::back_inserter(events), m_events.size());
+            }
+            notify_room();
+            return events;
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of pending events into caller-supplied storage.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of events extracted.
+         */
+        template <typename OutputIt>
+        std::size_t pop_events_into(OutputIt first, OutputIt last)
+        {
+            const auto capacity = static_cast<std::size_t>(std::distance(first, last));
+            std::size_t taken = 0U;
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                taken = take_events(first, capacity);
+            }
+            notify_room();
+            return taken;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch drain into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::span<event_entry> destination)
+        {
+            return pop_events_into(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Appends up to max_events pending events to a reusable vector under a single lock.
+         *
+         * @param destination Vector the events are appended to.
+         * @param max_events Maximum number of events to extract.
+         * @return The number of events extracted.
+         */
+        std::size_t pop_events_into(std::vector<event_entry>& destination, std::size_t max_events)
+        {
+            std::size_t taken = 0U;
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                taken = take_events(std::back_inserter(destination), max_events);
+            }
+            notify_room();
+            return taken;
+        }
+
+        /**
+         * @brief Takes the oldest pending event.
+         *
+         * @return The event, or an empty optional if the queue is empty.
+         */
+        std::optional<event_entry> pop_first_event()
+        {
+            std::optional<event_entry> entry;
+            {
+                std::scoped_lock<Lock> guard(m_mutex);
+                entry = m_events.pop_move();
+            }
+            notify_room();
+            return entry;
+        }
+
+        /**
+         * @brief Checks if there are pending events.
+         *
+         * @return true if the queue is not empty.
+         */
+        bool has_events()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return !m_events.empty();
+        }
+
+        /**
+         * @brief Returns the number of pending events.
+         *
+         * @return The number of events in the queue, at most the capacity.
+         */
+        std::size_t number_of_events()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_events.size();
+        }
+
+        /**
+         * @brief Returns the number of events lost to the overflow policy.
+         *
+         * @return The dropped event count since construction.
+         */
+        std::size_t dropped_count()
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_dropped;
+        }
+
+        /**
+         * @brief Returns the overflow policy of the observer.
+         *
+         * @return The policy given at construction.
+         */
+        [[nodiscard]] observer_overflow_policy policy() const
+        {
+            return m_policy;
+        }
+
+        /**
+         * @brief Reports the queue occupancy, capacity and drop count.
+         *
+         * @return The backlog counters.
+         */
+        observer_backlog backlog() override
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            observer_backlog counters;
+            counters.pending = m_events.size();
+            counters.peak_pending = m_peak_pending;
+            counters.capacity = m_events.capacity();
+            counters.dropped = m_dropped;
+            return counters;
+        }
+
+        /**
+         * @brief Waits for events by blocking until a signal is received.
+         */
+        void wait_for_events()
+        {
+            m_wakeable.wait_for_signal();
+        }
+
+        /**
+         * @brief Waits for events to occur within a specified timeout duration.
+         *
+         * @param timeout The maximum duration to wait for events.
+         */
+        void wait_for_events(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            m_wakeable.wait_for_signal(timeout);
+        }
+
+        /**
+         * @brief Gets the hook registering the observer with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified whenever an event is queued.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
+    private:
+        template <typename UTopic, typename UEvt, typename UOrigin>
+        void do_inform(UTopic&& topic, UEvt&& event, UOrigin&& origin)
+        {
+            TOOLS_TRACE(inform, "async_bounded_observer::inform", this, 0U);
+            {
+                std::unique_lock<Lock> guard(m_mutex);
+                enqueue(guard, std::forward<UTopic>(topic), std::forward<UEvt>(event), std::forward<UOrigin>(origin));
+            }
+            m_wakeable.signal();
+            m_ready_hook.notify();
+        }
+
+        // called with the lock held, applies the overflow policy if the queue is full
+        template <typename UTopic, typename UEvt, typename UOrigin>
+        void enqueue(std::unique_lock<Lock>& guard, UTopic&& topic, UEvt&& event, UOrigin&& origin)
+        {
+            // make_room only consumes the event when it returns false
+            if (m_events.full()
+                && !make_room(guard, topic, std::forward<UEvt>(event), std::forward<UOrigin>(origin)))
+            {
+                return;
+            }
+
+            // an event kept by make_room is intact
+            event_entry entry { std::forward<UTopic>(topic),
+                std::forward<UEvt>(event),      // NOLINT(bugprone-use-after-move)
+                std::forward<UOrigin>(origin) }; // NOLINT(bugprone-use-after-move)
+
+            if (!m_events.full())
+            {
+                m_events.push(std::move(entry));
+            }
+            else if (m_events.push_overwrite(std::move(entry)))
+            {
+                ++m_dropped;
+            }
+
+            m_peak_pending = (m_events.size() > m_peak_pending) ? m_events.size() : m_peak_pending;
+        }
+
+        // called with the lock held on a full queue; returns false when the incoming event must not be queued,
+        // true to push it, overwriting the oldest event if the queue is still full
+        template <typename UTopic, typename UEvt, typename UOrigin>
+        bool make_room(std::unique_lock<Lock>& guard, const UTopic& topic, UEvt&& event, UOrigin&& origin)
+        {
+            switch (m_policy)
+            {
+                case observer_overflow_policy::drop_newest:
+                    ++m_dropped;
+                    return false;
+
+                case observer_overflow_policy::conflate:
+                    for (std::size_t i = 0U; i < m_events.size(); ++i)
+                    {
+                        auto& pending = m_events[i];
+                        if (std::get<0>(pending) == topic)
+                        {
+                            std::get<1>(pending) = std::forward<UEvt>(event);
+                            std::get<2>(pending) = std::forward<UOrigin>(origin);
+                            ++m_dropped;
+                            return false;
+                        }
+                    }
+                    return true;
+
+                case observer_overflow_policy::block:
+                    if (!m_not_full.wait_for(guard, m_block_timeout, [this]() { return !m_events.full(); }))
+                    {
+                        ++m_dropped;
+                        return false;
+                    }
+                    return true;
+
+                case observer_overflow_policy::drop_oldest:
+                default:
+                    return true;
+            }
+        }
+
+        // called with the lock held, takes the count oldest events
+        template <typename OutputIt>
+        std::size_t take_events(OutputIt destination, std::size_t count)
+        {
+            std::size_t taken = 0U;
+
+            while ((taken < count) && !m_events.empty())
+            {
+                *destination = std::move(*m_events.pop_move());
+                ++destination;
+                ++taken;
+            }
+
+            return taken;
+        }
+
+        void notify_room()
+        {
+            if (observer_overflow_policy::block == m_policy)
+            {
+                m_not_full.notify_all();
+            }
+        }
+
+        Lock m_mutex;
+        ring_vector<event_entry> m_events;
+        observer_overflow_policy m_policy;
+        std::chrono::microseconds m_block_timeout;
+        std::size_t m_dropped = 0U;
+        std::size_t m_peak_pending = 0U;
+        cond_var m_not_full;
+        light_event m_wakeable;
+        wait_set_hook m_ready_hook;
     };
 
 }
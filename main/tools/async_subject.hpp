@@ -0,0 +1,348 @@
+/**
+ * @file async_subject.hpp
+ * @brief A subject whose publish enqueues the event and leaves the fan-out to a pool of delivery tasks.
+ *
+ * sync_subject::publish informs every observer and invokes every handler on the publishing task, so a slow
+ * subscriber stalls the producer. async_subject keeps the sync_subject subscription interface, but publish only
+ * copies the event into the bounded queue of a delivery lane and signals the lane's task: the cost of the
+ * publisher does not depend on the number nor on the speed of the subscribers. Each delivery task owns one lane
+ * and can be pinned to a core; a topic always maps to the same lane, so events of a topic are delivered in
+ * publication order, while different topics are delivered in parallel.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ASYNC_SUBJECT_HPP_)
+#define ASYNC_SUBJECT_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/ring_vector.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/worker_pool.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A subject delivering its events to the subscribers from a pool of delivery tasks.
+     *
+     * Subscriptions, content filters and lag limits behave as with sync_subject. publish() and try_publish()
+     * return once the event is queued in the lane of its topic; when that lane is full the event is dropped and
+     * counted, the publisher never waits for the subscribers. Events still queued when the subject is destroyed
+     * are discarded.
+     *
+     * @tparam Topic The type of the topic, default constructible.
+     * @tparam Evt The type of the event, default constructible.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     * @tparam Hash The hash mapping a topic to its delivery lane.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Hash = std::hash<Topic>>
+    class async_subject : private sync_subject<Topic, Evt, Origin> // NOLINT inherits from non copyable class
+    {
+        using base = sync_subject<Topic, Evt, Origin>;
+
+    public:
+        using typename base::handler;
+        using typename base::predicate;
+        using typename base::subscriber_backlog;
+        using typename base::sync_observer_shared_ptr;
+
+        using base::filtered_informs;
+        using base::name;
+        using base::origin;
+        using base::set_max_subscriber_lag;
+        using base::skipped_informs;
+        using base::slow_subscribers;
+        using base::subscribe;
+        using base::unsubscribe;
+
+        async_subject() = delete;
+
+        /**
+         * @brief Constructs the subject with one delivery task per entry of delivery_params.
+         *
+         * @param subject_name The name of the subject, also used as origin.
+         * @param queue_capacity The number of events each delivery lane can hold (at least one).
+         * @param stack_size The stack size of each delivery task.
+         * @param delivery_params The cpu affinity and priority of each delivery task (at least one task is created).
+         */
+        template <typename UOrigin = Origin,
+            typename = std::enable_if_t<std::is_constructible_v<UOrigin, const std::string&>>>
+        async_subject(std::string subject_name, std::size_t queue_capacity, std::size_t stack_size,
+            const std::vector<worker_pool_params>& delivery_params)
+            : base(std::move(subject_name))
+        {
+            start_delivery(queue_capacity, stack_size, delivery_params);
+        }
+
+        /**
+         * @brief Constructs the subject with an explicit origin value and one delivery task per entry of
+         * delivery_params.
+         *
+         * @param subject_name The name of the subject.
+         * @param origin_value The origin value handed to observers and handlers on delivery.
+         * @param queue_capacity The number of events each delivery lane can hold (at least one).
+         * @param stack_size The stack size of each delivery task.
+         * @param delivery_params The cpu affinity and priority of each delivery task (at least one task is created).
+         */
+        async_subject(std::string subject_name, Origin origin_value, std::size_t queue_capacity,
+            std::size_t stack_size, const std::vector<worker_pool_params>& delivery_params)
+            : base(std::move(subject_name), std::move(origin_value))
+        {
+            start_delivery(queue_capacity, stack_size, delivery_params);
+        }
+
+        /**
+         * @brief Stops the delivery tasks once their current delivery returns; queued events are discarded.
+         */
+        ~async_subject() override
+        {
+            m_stop_delivery.store(true);
+
+            for (auto& lane : m_lanes)
+            {
+                lane->m_work_sync.signal();
+            }
+
+            // generic_task destructors wait for the delivery tasks to complete
+            m_tasks.clear();
+        }
+
+        async_subject(const async_subject&) = delete;
+        async_subject& operator=(const async_subject&) = delete;
+        async_subject(async_subject&&) = delete;
+        async_subject& operator=(async_subject&&) = delete;
+
+        /**
+         * @brief Queues an event for delivery to the subscribers of the given topic.
+         *
+         * @param topic The topic to publish the event to.
+         * @param event The event to be published.
+         */
+        void publish(const Topic& topic, const Evt& event) override
+        {
+            static_cast<void>(try_publish(topic, event));
+        }
+
+        /**
+         * @brief Queues an event for delivery to the subscribers of the given topic.
+         *
+         * @tparam UTopic The deduced topic type.
+         * @tparam UEvt The deduced event type.
+         * @param topic The topic to publish the event to.
+         * @param event The event to be published.
+         * @return true if the event was queued, false if it was dropped because the lane of the topic is full.
+         */
+        template <typename UTopic, typename UEvt>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<Topic, UTopic> && std::is_constructible_v<Evt, UEvt>
+#endif
+        auto try_publish(UTopic&& topic, UEvt&& event)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<
+                std::is_constructible<Topic, UTopic>::value && std::is_constructible<Evt, UEvt>::value, bool>::type
+#endif
+        {
+            pending_publish entry { Topic(std::forward<UTopic>(topic)), Evt(std::forward<UEvt>(event)) };
+            auto& lane = *m_lanes[lane_of(entry.topic)];
+
+            bool queued = false;
+            {
+                std::scoped_lock<tools::critical_section> guard(lane.m_mutex);
+                queued = lane.m_queue.push(std::move(entry));
+            }
+
+            if (!queued)
+            {
+                m_dropped.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+
+            lane.m_work_sync.signal();
+            return true;
+        }
+
+        /**
+         * @brief Returns the delivery lane, hence the delivery task, serving a topic.
+         *
+         * @param topic The topic.
+         * @return The lane index, lower than number_of_delivery_tasks().
+         */
+        [[nodiscard]] std::size_t lane_of(const Topic& topic) const
+        {
+            return m_hash(topic) % m_lanes.size();
+        }
+
+        /**
+         * @brief Returns the number of delivery tasks, one per lane.
+         *
+         * @return The delivery task count.
+         */
+        [[nodiscard]] std::size_t number_of_delivery_tasks() const
+        {
+            return m_lanes.size();
+        }
+
+        /**
+         * @brief Returns the number of events queued and not yet taken by a delivery task.
+         *
+         * @return The pending event count over all lanes.
+         */
+        std::size_t pending_publishes()
+        {
+            std::size_t pending = 0U;
+            for (auto& lane : m_lanes)
+            {
+                std::scoped_lock<tools::critical_section> guard(lane->m_mutex);
+                pending += lane->m_queue.size();
+            }
+            return pending;
+        }
+
+        /**
+         * @brief Returns the number of events delivered to all their subscribers.
+         *
+         * @return The delivered event count.
+         */
+        [[nodiscard]] std::size_t delivered_publishes() const
+        {
+            return m_delivered.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Returns the number of events dropped because the lane of their topic was full.
+         *
+         * @return The dropped event count.
+         */
+        [[nodiscard]] std::size_t dropped_publishes() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /**
+         * @brief A queued publish, copied out of the publisher's arguments.
+         */
+        struct pending_publish
+        {
+            Topic topic;
+            Evt event;
+        };
+
+        /**
+         * @brief Bounded queue and wake-up signal of one delivery task.
+         */
+        struct delivery_lane : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+            explicit delivery_lane(std::size_t capacity)
+                : m_queue(capacity)
+            {
+            }
+
+            tools::critical_section m_mutex;
+            ring_vector<pending_publish> m_queue;
+            tools::light_event m_work_sync;
+        };
+
+        void start_delivery(
+            std::size_t queue_capacity, std::size_t stack_size, const std::vector<worker_pool_params>& delivery_params)
+        {
+            const std::size_t nb_lanes = delivery_params.empty() ? 1U : delivery_params.size();
+            const std::size_t capacity = (0U == queue_capacity) ? 1U : queue_capacity;
+
+            m_lanes.reserve(nb_lanes);
+            for (std::size_t i = 0U; i < nb_lanes; ++i)
+            {
+                m_lanes.emplace_back(std::make_shared<delivery_lane>(capacity));
+            }
+
+            m_tasks.reserve(nb_lanes);
+            for (std::size_t i = 0U; i < nb_lanes; ++i)
+            {
+                const worker_pool_params params = delivery_params.empty() ? worker_pool_params {} : delivery_params[i];
+
+                m_tasks.emplace_back(std::make_unique<tools::generic_task<delivery_lane>>(
+                    [this](const std::shared_ptr<delivery_lane>& lane, const std::string& /*task_name*/)
+                    { run_loop(*lane); },
+                    m_lanes[i], base::name() + "_delivery_" + std::to_string(i), stack_size, params.cpu_affinity,
+                    params.priority));
+            }
+        }
+
+        std::optional<pending_publish> pop_pending(delivery_lane& lane)
+        {
+            std::scoped_lock<tools::critical_section> guard(lane.m_mutex);
+            return lane.m_queue.pop_move();
+        }
+
+        /**
+         * @brief Main loop of a delivery task: drains its lane in order, then sleeps until signaled.
+         */
+        void run_loop(delivery_lane& lane)
+        {
+            while (!m_stop_delivery.load())
+            {
+                auto entry = pop_pending(lane);
+
+                if (!entry.has_value())
+                {
+                    lane.m_work_sync.wait_for_signal();
+                    continue;
+                }
+
+                base::publish(entry->topic, entry->event);
+                m_delivered.fetch_add(1U, std::memory_order_release);
+            }
+        }
+
+        Hash m_hash;
+        std::vector<std::shared_ptr<delivery_lane>> m_lanes;
+        std::vector<std::unique_ptr<tools::generic_task<delivery_lane>>> m_tasks;
+        std::atomic<std::size_t> m_delivered = 0U;
+        std::atomic<std::size_t> m_dropped = 0U;
+        std::atomic_bool m_stop_delivery = false;
+    };
+}
+
+#endif //  ASYNC_SUBJECT_HPP_
@@ -40,12 +40,169 @@
 #if !defined(BASE_TASK_HPP_)
 #define BASE_TASK_HPP_
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 namespace tools
 {
+#if defined(FREERTOS_PLATFORM)
+    using task_stack_word = StackType_t;     ///< Unit of a task stack (a byte on ESP-IDF, a word elsewhere).
+    using task_control_block = StaticTask_t; ///< Storage of a task control block.
+#else
+    using task_stack_word = std::uintptr_t; ///< Unit of a task stack, unused by std::thread.
+
+    /**
+     * @brief Storage of a task control block, unused by std::thread.
+     */
+    struct task_control_block
+    {
+    };
+#endif
+
+    /**
+     * @brief Caller-provided stack and control block storage, given to a task constructor instead of a stack size.
+     *
+     * On FreeRTOS the task is created with xTaskCreateStatic(PinnedToCore) into this storage, so neither its stack
+     * nor its TCB comes from the heap; the storage must outlive the task. Storage with static duration lands in
+     * internal RAM on ESP-IDF, where task stacks have to live unless external stacks are enabled. Threads of the
+     * standard backend keep their own stack and only use stack_size as the stack size hint.
+     */
+    struct task_storage
+    {
+        task_stack_word* stack = nullptr;            ///< First entry of the stack buffer.
+        std::size_t stack_size = 0U;                 ///< Stack depth in task_stack_word units (bytes on ESP-IDF).
+        task_control_block* control_block = nullptr; ///< Control block storage.
+
+        /**
+         * @brief Checks whether both buffers are provided.
+         *
+         * @return True for usable storage.
+         */
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return (nullptr != stack) && (0U != stack_size) && (nullptr != control_block);
+        }
+    };
+
+    /**
+     * @brief Scheduling class requested for the thread of a task.
+     */
+    enum class task_sched_class : unsigned char
+    {
+        inherit,     ///< Keep the class set from the task priority.
+        fifo,        ///< SCHED_FIFO at a real-time priority.
+        round_robin, ///< SCHED_RR at a real-time priority.
+        deadline     ///< SCHED_DEADLINE with a runtime, deadline and period.
+    };
+
+    /**
+     * @brief Real-time scheduling of the thread of a data_task or worker_task, applied by the thread itself.
+     *
+     * Only the standard backend on Linux applies it, and real-time classes need root or CAP_SYS_NICE: the task
+     * reports whether it succeeded. FreeRTOS tasks are already scheduled by fixed priority and ignore it.
+     */
+    struct task_sched_policy
+    {
+        task_sched_class sched_class = task_sched_class::inherit;       ///< The scheduling class.
+        int rt_priority = 1;                                            ///< SCHED_FIFO/RR priority (1 to 99).
+        std::chrono::duration<std::uint64_t, std::micro> runtime = {};  ///< SCHED_DEADLINE budget per period.
+        std::chrono::duration<std::uint64_t, std::micro> deadline = {}; ///< SCHED_DEADLINE relative deadline.
+        std::chrono::duration<std::uint64_t, std::micro> period = {};   ///< SCHED_DEADLINE period.
+        bool prefault_stack = false; ///< Touch the stack_size first bytes of the stack before the first job.
+
+        /**
+         * @brief Makes a SCHED_FIFO policy.
+         *
+         * @param priority The real-time priority.
+         * @return The policy.
+         */
+        [[nodiscard]] static task_sched_policy fifo(int priority)
+        {
+            task_sched_policy policy;
+            policy.sched_class = task_sched_class::fifo;
+            policy.rt_priority = priority;
+            return policy;
+        }
+
+        /**
+         * @brief Makes a SCHED_RR policy.
+         *
+         * @param priority The real-time priority.
+         * @return The policy.
+         */
+        [[nodiscard]] static task_sched_policy round_robin(int priority)
+        {
+            task_sched_policy policy;
+            policy.sched_class = task_sched_class::round_robin;
+            policy.rt_priority = priority;
+            return policy;
+        }
+
+        /**
+         * @brief Makes a SCHED_DEADLINE policy; the kernel requires runtime <= deadline <= period.
+         *
+         * @param runtime The execution budget per period.
+         * @param deadline The relative deadline of each job.
+         * @param period The period of the jobs.
+         * @return The policy.
+         */
+        [[nodiscard]] static task_sched_policy earliest_deadline(
+            const std::chrono::duration<std::uint64_t, std::micro>& runtime,
+            const std::chrono::duration<std::uint64_t, std::micro>& deadline,
+            const std::chrono::duration<std::uint64_t, std::micro>& period)
+        {
+            task_sched_policy policy;
+            policy.sched_class = task_sched_class::deadline;
+            policy.runtime = runtime;
+            policy.deadline = deadline;
+            policy.period = period;
+            return policy;
+        }
+    };
+
+    /**
+     * @brief What a task does with the work still queued when it is stopped.
+     */
+    enum class task_drain_policy : unsigned char
+    {
+        drain_all,      ///< Process everything queued before stopping.
+        drain_deadline, ///< Process queued work until the drain timeout expires.
+        discard         ///< Stop after the work in progress, leaving the rest unprocessed.
+    };
+
+    /**
+     * @brief Stack and control block of one task, to be declared with static duration.
+     *
+     * @tparam StackSize The stack depth in task_stack_word units, as the stack_size of the other constructors.
+     */
+    template <std::size_t StackSize>
+    struct static_task_storage
+    {
+        std::array<task_stack_word, StackSize> stack = {}; ///< Stack buffer.
+        task_control_block control_block = {};             ///< Control block storage.
+
+        /**
+         * @brief Gets the view handed to a task constructor.
+         *
+         * @return The storage descriptor.
+         */
+        [[nodiscard]] task_storage view() noexcept
+        {
+            return task_storage { stack.data(), StackSize, &control_block };
+        }
+    };
+
     /**
      * @brief A base class for creating tasks.
      */
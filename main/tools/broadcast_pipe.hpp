@@ -0,0 +1,513 @@
+/**
+ * @file broadcast_pipe.hpp
+ * @brief Single-writer, multi-reader byte pipe: every reader consumes the same bytes in place from one shared ring.
+ *
+ * A memory_pipe has one consumer, so fanning a sample stream out to N consumers means N pipes and N copies.
+ * A broadcast_pipe keeps one ring and one cursor per reader. The writer copies the bytes once; each reader
+ * peeks them in place and consumes them at its own pace. When the ring is full, the writer either waits for
+ * the slowest reader (broadcast_policy::block_writer) or moves the laggards forward, counting the bytes they
+ * missed (broadcast_policy::drop_laggards), so a slow consumer never stalls the others.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(BROADCAST_PIPE_HPP_)
+#define BROADCAST_PIPE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "tools/alloc_hint.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/sync_object.hpp"
+
+namespace tools
+{
+    /**
+     * @brief What a broadcast_pipe writer does when the ring is full.
+     */
+    enum class broadcast_policy : std::uint8_t
+    {
+        block_writer, ///< The writer waits for the slowest reader, no reader misses a byte.
+        drop_laggards ///< The writer never waits, readers behind by more than the capacity skip the oldest bytes.
+    };
+
+    /**
+     * @brief Readable area of a broadcast_pipe reader, split in two parts when it wraps around.
+     */
+    struct broadcast_regions
+    {
+        const std::uint8_t* first = nullptr;  ///< Oldest unread bytes.
+        std::size_t first_size = 0U;          ///< Number of bytes in the first part.
+        const std::uint8_t* second = nullptr; ///< Continuation after the wrap-around point, if any.
+        std::size_t second_size = 0U;         ///< Number of bytes in the second part.
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return first_size + second_size;
+        }
+    };
+
+    /**
+     * @brief Byte ring with one writer and up to MaxReaders readers, each with its own cursor.
+     *
+     * Cursors and the write index are free-running byte counts. A reader commits what it processed with a
+     * compare-and-swap of its cursor; under drop_laggards the writer moves a lagging cursor forward with the same
+     * compare-and-swap before overwriting, so a reader whose bytes were overwritten while it was reading them
+     * sees its consume() fail and discards them. Under block_writer the writer only writes behind the slowest
+     * cursor. Bytes sent while no reader is attached are discarded.
+     *
+     * Only one thread may write. Each reader handle belongs to one thread; readers may attach and detach at any
+     * time and start at the current write position.
+     *
+     * @tparam MaxReaders Number of reader slots.
+     */
+    template <std::size_t MaxReaders>
+    class broadcast_pipe : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Reader handle, detaching its slot on destruction.
+         */
+        class reader
+        {
+        public:
+            reader(const reader&) = delete;
+            reader& operator=(const reader&) = delete;
+
+            reader(reader&& other) noexcept
+                : m_pipe(other.m_pipe)
+                , m_slot(other.m_slot)
+                , m_peek_cursor(other.m_peek_cursor)
+                , m_peek_size(other.m_peek_size)
+            {
+                other.m_pipe = nullptr;
+            }
+
+            reader& operator=(reader&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    detach();
+                    m_pipe = other.m_pipe;
+                    m_slot = other.m_slot;
+                    m_peek_cursor = other.m_peek_cursor;
+                    m_peek_size = other.m_peek_size;
+                    other.m_pipe = nullptr;
+                }
+                return *this;
+            }
+
+            ~reader()
+            {
+                detach();
+            }
+
+            /**
+             * @brief Exposes the unread bytes in place, without blocking.
+             *
+             * @return The readable regions, empty when the reader is up to date.
+             */
+            [[nodiscard]] broadcast_regions peek()
+            {
+                broadcast_regions regions;
+                if (nullptr == m_pipe)
+                {
+                    return regions;
+                }
+
+                const auto& slot = m_pipe->m_slots[m_slot]; // NOLINT bounded index
+                std::size_t cursor = slot.cursor.load(std::memory_order_acquire);
+                std::size_t written = m_pipe->m_write_index.load(std::memory_order_acquire);
+                while ((written - cursor) > m_pipe->m_capacity)
+                {
+                    // lapped between the two loads: the writer already moved the cursor, reload both
+                    cursor = slot.cursor.load(std::memory_order_acquire);
+                    written = m_pipe->m_write_index.load(std::memory_order_acquire);
+                }
+
+                m_peek_cursor = cursor;
+                m_peek_size = written - cursor;
+
+                const std::size_t offset = cursor % m_pipe->m_capacity;
+                regions.first_size = std::min(m_peek_size, m_pipe->m_capacity - offset);
+                regions.second_size = m_peek_size - regions.first_size;
+                regions.first = (regions.first_size > 0U) ? (m_pipe->m_buffer.data() + offset) : nullptr; // NOLINT
+                regions.second = (regions.second_size > 0U) ? m_pipe->m_buffer.data() : nullptr;
+                return regions;
+            }
+
+            /**
+             * @brief Releases bytes exposed by the last peek().
+             *
+             * @param consume_bytes Number of bytes processed, clamped to the peeked size.
+             * @return false if the writer lapped the reader meanwhile: the peeked bytes may have been overwritten
+             *         and must be discarded, the reader resuming at the oldest byte still in the ring.
+             */
+            bool consume(std::size_t consume_bytes)
+            {
+                if (nullptr == m_pipe)
+                {
+                    return false;
+                }
+
+                const std::size_t count = std::min(consume_bytes, m_peek_size);
+                auto& slot = m_pipe->m_slots[m_slot]; // NOLINT bounded index
+                std::size_t expected = m_peek_cursor;
+                const bool kept = slot.cursor.compare_exchange_strong(
+                    expected, m_peek_cursor + count, std::memory_order_acq_rel, std::memory_order_acquire);
+                m_peek_size = 0U;
+                if (kept && (count > 0U))
+                {
+                    m_pipe->m_space_sync.signal();
+                }
+                return kept;
+            }
+
+            /**
+             * @brief Copies up to size bytes, waiting for them until the timeout expires.
+             *
+             * @param data Destination buffer.
+             * @param size Number of bytes wanted.
+             * @param timeout Maximum duration to wait for the bytes.
+             * @return The number of bytes received; bytes overwritten while being copied are not counted.
+             */
+            [[nodiscard]] std::size_t receive(
+                std::uint8_t* data, std::size_t size, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+            {
+                std::size_t received = 0U;
+                const auto deadline = std::chrono::steady_clock::now() + timeout;
+                while ((nullptr != m_pipe) && (received < size))
+                {
+                    const auto regions = peek();
+                    if (regions.size() > 0U)
+                    {
+                        const std::size_t head = std::min(size - received, regions.first_size);
+                        const std::size_t tail = std::min(size - received - head, regions.second_size);
+                        std::memcpy(data + received, regions.first, head);               // NOLINT pointer arithmetic
+                        std::memcpy(data + received + head, regions.second, tail); // NOLINT pointer arithmetic
+                        if (consume(head + tail))
+                        {
+                            received += head + tail;
+                        }
+                        continue;
+                    }
+
+                    const auto current_time = std::chrono::steady_clock::now();
+                    if (current_time >= deadline)
+                    {
+                        break;
+                    }
+                    wait_for_data(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                        deadline - current_time));
+                }
+                return received;
+            }
+
+            /**
+             * @brief Waits until the writer publishes bytes or the timeout expires.
+             *
+             * @param timeout Maximum duration to wait.
+             */
+            void wait_for_data(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+            {
+                if (nullptr != m_pipe)
+                {
+                    m_pipe->m_slots[m_slot].data_sync.wait_for_signal(timeout); // NOLINT bounded index
+                }
+            }
+
+            /**
+             * @brief Gets the number of bytes this reader missed because the writer lapped it.
+             *
+             * @return The dropped byte count since the reader attached.
+             */
+            [[nodiscard]] std::uint64_t dropped_bytes() const
+            {
+                return (nullptr != m_pipe) ? m_pipe->m_slots[m_slot].dropped.load(std::memory_order_relaxed) // NOLINT
+                                           : 0U;
+            }
+
+        private:
+            friend class broadcast_pipe;
+
+            reader(broadcast_pipe* pipe, std::size_t slot)
+                : m_pipe(pipe)
+                , m_slot(slot)
+            {
+            }
+
+            void detach()
+            {
+                if (nullptr != m_pipe)
+                {
+                    m_pipe->m_slots[m_slot].state.store(slot_state::idle, std::memory_order_release); // NOLINT
+                    m_pipe->m_space_sync.signal();
+                    m_pipe = nullptr;
+                }
+            }
+
+            broadcast_pipe* m_pipe;
+            std::size_t m_slot;
+            std::size_t m_peek_cursor = 0U;
+            std::size_t m_peek_size = 0U;
+        };
+
+        broadcast_pipe() = delete;
+        ~broadcast_pipe() = default;
+
+        /**
+         * @brief Constructs a broadcast pipe.
+         *
+         * @param capacity Size of the shared ring in bytes.
+         * @param policy What the writer does when the ring is full.
+         * @param buffer_hint Memory the ring is allocated from.
+         */
+        broadcast_pipe(std::size_t capacity, broadcast_policy policy, alloc_hint buffer_hint = alloc_hint::automatic)
+            : m_capacity(std::max<std::size_t>(capacity, 1U))
+            , m_policy(policy)
+            , m_buffer(m_capacity, hinted_allocator<std::uint8_t>(buffer_hint))
+        {
+        }
+
+        /**
+         * @brief Attaches a reader, starting at the current write position.
+         *
+         * @return The reader handle, or nothing if all MaxReaders slots are in use.
+         */
+        [[nodiscard]] std::optional<reader> attach()
+        {
+            for (std::size_t index = 0U; index < MaxReaders; ++index)
+            {
+                auto& slot = m_slots[index]; // NOLINT bounded index
+                slot_state idle = slot_state::idle;
+                if (slot.state.compare_exchange_strong(idle, slot_state::claimed, std::memory_order_acq_rel))
+                {
+                    // the writer ignores a claimed slot, its cursor is stored before the slot becomes active
+                    std::size_t cursor = m_write_index.load(std::memory_order_seq_cst);
+                    slot.cursor.store(cursor, std::memory_order_seq_cst);
+                    slot.state.store(slot_state::active, std::memory_order_seq_cst);
+
+                    // a send that did not see the activation may have published meanwhile: start after its bytes
+                    std::size_t written = m_write_index.load(std::memory_order_seq_cst);
+                    while (written != cursor)
+                    {
+                        cursor = written;
+                        slot.cursor.store(cursor, std::memory_order_seq_cst);
+                        written = m_write_index.load(std::memory_order_seq_cst);
+                    }
+                    slot.dropped.store(0U, std::memory_order_relaxed);
+                    return reader(this, index);
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Writes bytes for all the attached readers.
+         *
+         * @param data Bytes to broadcast.
+         * @param send_bytes Number of bytes.
+         * @param timeout Under block_writer, maximum duration to wait for the slowest reader; unused otherwise.
+         * @return The number of bytes written, send_bytes unless block_writer timed out.
+         */
+        [[nodiscard]] std::size_t send(const std::uint8_t* data, std::size_t send_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t sent = 0U;
+            if (nullptr == data)
+            {
+                return sent;
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            while (sent < send_bytes)
+            {
+                const std::size_t written = m_write_index.load(std::memory_order_relaxed);
+                std::size_t room = m_capacity;
+                if (broadcast_policy::block_writer == m_policy)
+                {
+                    const std::size_t used = written - slowest_cursor(written);
+                    room = m_capacity - std::min(used, m_capacity);
+                }
+                else
+                {
+                    evict_laggards(written + std::min(send_bytes - sent, m_capacity));
+                }
+
+                const std::size_t count = std::min(send_bytes - sent, room);
+                if (count > 0U)
+                {
+                    const std::size_t offset = written % m_capacity;
+                    const std::size_t first_chunk = std::min(count, m_capacity - offset);
+                    std::memcpy(m_buffer.data() + offset, data + sent, first_chunk); // NOLINT raw buffer access
+                    std::memcpy(m_buffer.data(), data + sent + first_chunk, count - first_chunk); // NOLINT
+                    m_write_index.store(written + count, std::memory_order_seq_cst);
+                    sent += count;
+                    signal_readers();
+                    continue;
+                }
+
+                // wait until the slowest reader frees some space or the timeout expires
+                const auto current_time = std::chrono::steady_clock::now();
+                if (current_time >= deadline)
+                {
+                    break;
+                }
+                m_space_sync.wait_for_signal(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                    deadline - current_time));
+            }
+            return sent;
+        }
+
+        /**
+         * @brief Gets the ring size.
+         *
+         * @return The capacity in bytes.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Gets the policy applied when the ring is full.
+         *
+         * @return The policy given at construction.
+         */
+        [[nodiscard]] broadcast_policy policy() const
+        {
+            return m_policy;
+        }
+
+    private:
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        /**
+         * @brief Life cycle of a reader slot.
+         */
+        enum class slot_state : std::uint8_t
+        {
+            idle,    ///< Free for attach().
+            claimed, ///< Taken by attach(), cursor not set yet: the writer ignores it.
+            active   ///< Attached reader, its cursor bounds the writer.
+        };
+
+        /**
+         * @brief Cursor of one reader, on its own cache line.
+         */
+        struct alignas(cache_line_size) reader_slot
+        {
+            std::atomic<std::size_t> cursor = 0U;
+            std::atomic<std::uint64_t> dropped = 0U;
+            std::atomic<slot_state> state = slot_state::idle;
+            tools::sync_object data_sync; // signaled when bytes are published
+        };
+
+        /**
+         * @brief Oldest cursor of the attached readers, the write index without reader.
+         */
+        std::size_t slowest_cursor(std::size_t written) const
+        {
+            std::size_t slowest = written;
+            for (const auto& slot : m_slots)
+            {
+                if (slot_state::active == slot.state.load(std::memory_order_seq_cst))
+                {
+                    slowest = std::min(slowest, slot.cursor.load(std::memory_order_acquire));
+                }
+            }
+            return slowest;
+        }
+
+        /**
+         * @brief Moves the cursors that the bytes up to end would overwrite to the oldest byte kept.
+         *
+         * The compare-and-swap happens before the bytes are written: a reader committing the old cursor afterwards
+         * fails, and a reader whose commit came first has finished reading.
+         */
+        void evict_laggards(std::size_t end)
+        {
+            if (end <= m_capacity)
+            {
+                return;
+            }
+
+            const std::size_t oldest_kept = end - m_capacity;
+            for (auto& slot : m_slots)
+            {
+                if (slot_state::active != slot.state.load(std::memory_order_seq_cst))
+                {
+                    continue;
+                }
+
+                std::size_t cursor = slot.cursor.load(std::memory_order_acquire);
+                while ((cursor < oldest_kept)
+                    && !slot.cursor.compare_exchange_weak(
+                        cursor, oldest_kept, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                }
+                if (cursor < oldest_kept)
+                {
+                    slot.dropped.fetch_add(oldest_kept - cursor, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void signal_readers()
+        {
+            for (auto& slot : m_slots)
+            {
+                if (slot_state::active == slot.state.load(std::memory_order_relaxed))
+                {
+                    slot.data_sync.signal();
+                }
+            }
+        }
+
+        const std::size_t m_capacity;
+        const broadcast_policy m_policy;
+        std::vector<std::uint8_t, hinted_allocator<std::uint8_t>> m_buffer;
+        alignas(cache_line_size) std::atomic<std::size_t> m_write_index = 0U;
+        std::array<reader_slot, MaxReaders> m_slots;
+        tools::sync_object m_space_sync; // signaled when a reader consumes or detaches
+    };
+
+} // namespace tools
+
+#endif //  BROADCAST_PIPE_HPP_
@@ -0,0 +1,515 @@
+/**
+ * @file checksum.cpp
+ * @brief Implementation of the CRC-32 and Adler-32 kernels and of their dispatch.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "tools/checksum.hpp"
+#include "uzlib/uzlib.h"
+
+#if defined(ESP_PLATFORM)
+#include <esp_rom_crc.h>
+#define CHECKSUM_HAS_ESP_ROM_CRC32
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define CHECKSUM_HAS_PCLMUL_CRC32
+#elif defined(__ARM_FEATURE_CRC32) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_acle.h>
+#define CHECKSUM_HAS_ARMV8_CRC32
+#endif
+
+namespace
+{
+    using crc32_table = std::array<std::uint32_t, 256U>;
+
+    constexpr const std::uint32_t crc32_polynomial = 0xedb88320U;
+    constexpr const std::size_t slice_count = 8U;
+    constexpr const std::uint32_t byte_mask = 0xffU;
+    constexpr const unsigned int byte_bits = 8U;
+
+    /**
+     * @brief Builds the slicing-by-8 tables: table k advances a byte followed by k zero bytes.
+     *
+     * @return The eight tables, the first one being the classic byte-wise table.
+     */
+    constexpr std::array<crc32_table, slice_count> make_crc32_tables()
+    {
+        std::array<crc32_table, slice_count> tables = {};
+
+        for (std::uint32_t i = 0U; i < tables[0].size(); ++i)
+        {
+            std::uint32_t crc = i;
+
+            for (unsigned int bit = 0U; bit < byte_bits; ++bit)
+            {
+                crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ crc32_polynomial) : (crc >> 1U);
+            }
+
+            tables[0][i] = crc;
+        }
+
+        for (std::size_t k = 1U; k < slice_count; ++k)
+        {
+            for (std::size_t i = 0U; i < tables[k].size(); ++i)
+            {
+                const std::uint32_t previous = tables[k - 1U][i];
+                tables[k][i] = (previous >> byte_bits) ^ tables[0][previous & byte_mask];
+            }
+        }
+
+        return tables;
+    }
+
+    constexpr const std::array<crc32_table, slice_count> crc32_tables = make_crc32_tables();
+
+    std::uint32_t load_le32(const std::uint8_t* data)
+    {
+        return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8U) // NOLINT
+            | (static_cast<std::uint32_t>(data[2]) << 16U) | (static_cast<std::uint32_t>(data[3]) << 24U); // NOLINT
+    }
+
+    std::uint32_t crc32_portable(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        constexpr const std::size_t max_chunk = std::numeric_limits<unsigned int>::max();
+
+        while (size > 0U)
+        {
+            const std::size_t chunk = (size < max_chunk) ? size : max_chunk;
+            crc = uzlib_crc32(data, static_cast<unsigned int>(chunk), crc);
+            data += chunk; // NOLINT pointer arithmetic
+            size -= chunk;
+        }
+
+        return crc;
+    }
+
+    std::uint32_t crc32_slicing_by_8(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        const auto& t = crc32_tables;
+
+        while (size >= slice_count)
+        {
+            const std::uint32_t lo = crc ^ load_le32(data);
+            const std::uint32_t hi = load_le32(data + 4U); // NOLINT pointer arithmetic
+
+            crc = t[7][lo & byte_mask] ^ t[6][(lo >> 8U) & byte_mask] ^ t[5][(lo >> 16U) & byte_mask] // NOLINT
+                ^ t[4][lo >> 24U] ^ t[3][hi & byte_mask] ^ t[2][(hi >> 8U) & byte_mask]             // NOLINT
+                ^ t[1][(hi >> 16U) & byte_mask] ^ t[0][hi >> 24U];                                  // NOLINT
+
+            data += slice_count; // NOLINT pointer arithmetic
+            size -= slice_count;
+        }
+
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            crc = t[0][(crc ^ data[i]) & byte_mask] ^ (crc >> byte_bits); // NOLINT pointer arithmetic
+        }
+
+        return crc;
+    }
+
+#if defined(CHECKSUM_HAS_ESP_ROM_CRC32)
+    bool crc32_hardware_supported()
+    {
+        return true;
+    }
+
+    std::uint32_t crc32_hardware(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        constexpr const std::size_t max_chunk = std::numeric_limits<std::uint32_t>::max();
+
+        while (size > 0U)
+        {
+            const std::size_t chunk = (size < max_chunk) ? size : max_chunk;
+            // the ROM routine takes and returns the finalized value
+            crc = ~esp_rom_crc32_le(~crc, data, static_cast<std::uint32_t>(chunk));
+            data += chunk; // NOLINT pointer arithmetic
+            size -= chunk;
+        }
+
+        return crc;
+    }
+#elif defined(CHECKSUM_HAS_PCLMUL_CRC32)
+    bool crc32_hardware_supported()
+    {
+        return (__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("sse4.1") != 0);
+    }
+
+    __attribute__((target("sse2"))) __m128i crc32_pclmul_load(const std::uint8_t* data)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); // NOLINT intrinsic unaligned load
+    }
+
+    /**
+     * @brief Multiplies both halves of an accumulator by the folding constants and adds the next block.
+     */
+    __attribute__((target("pclmul,sse4.1"))) __m128i crc32_pclmul_fold(__m128i k, __m128i acc, __m128i next)
+    {
+        const __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+        const __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+        return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+    }
+
+    /**
+     * @brief Folds 64 bytes per step with carry-less multiplications, then Barrett-reduces to 32 bits.
+     *
+     * Intel "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ", reflected gzip constants.
+     *
+     * @param data The bytes to checksum.
+     * @param size The number of bytes, a multiple of 16 and at least 64.
+     * @param crc The running state.
+     * @return The updated running state.
+     */
+    __attribute__((target("pclmul,sse4.1"))) std::uint32_t crc32_pclmul_blocks(
+        const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        alignas(16) static const std::uint64_t k1k2[2] = { 0x0154442bd4U, 0x01c6e41596U }; // NOLINT
+        alignas(16) static const std::uint64_t k3k4[2] = { 0x01751997d0U, 0x00ccaa009eU }; // NOLINT
+        alignas(16) static const std::uint64_t k5k0[2] = { 0x0163cd6124U, 0x0000000000U }; // NOLINT
+        alignas(16) static const std::uint64_t poly[2] = { 0x01db710641U, 0x01f7011641U }; // NOLINT
+
+        __m128i x1 = crc32_pclmul_load(data);
+        __m128i x2 = crc32_pclmul_load(data + 16U); // NOLINT pointer arithmetic
+        __m128i x3 = crc32_pclmul_load(data + 32U); // NOLINT pointer arithmetic
+        __m128i x4 = crc32_pclmul_load(data + 48U); // NOLINT pointer arithmetic
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        data += 64U; // NOLINT pointer arithmetic
+        size -= 64U;
+
+        __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+
+        while (size >= 64U)
+        {
+            x1 = crc32_pclmul_fold(k, x1, crc32_pclmul_load(data));
+            x2 = crc32_pclmul_fold(k, x2, crc32_pclmul_load(data + 16U)); // NOLINT pointer arithmetic
+            x3 = crc32_pclmul_fold(k, x3, crc32_pclmul_load(data + 32U)); // NOLINT pointer arithmetic
+            x4 = crc32_pclmul_fold(k, x4, crc32_pclmul_load(data + 48U)); // NOLINT pointer arithmetic
+            data += 64U;                     // NOLINT pointer arithmetic
+            size -= 64U;
+        }
+
+        // fold the four lanes into one, then the remaining 16-byte blocks
+        k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+        x1 = crc32_pclmul_fold(k, x1, x2);
+        x1 = crc32_pclmul_fold(k, x1, x3);
+        x1 = crc32_pclmul_fold(k, x1, x4);
+
+        while (size >= 16U)
+        {
+            x1 = crc32_pclmul_fold(k, x1, crc32_pclmul_load(data));
+            data += 16U; // NOLINT pointer arithmetic
+            size -= 16U;
+        }
+
+        // 128 to 64 bits
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+        x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+        k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        // Barrett reduction to 32 bits
+        k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+
+    std::uint32_t crc32_hardware(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        constexpr const std::size_t min_blocks_size = 64U;
+        constexpr const std::size_t block_mask = 15U;
+
+        if (size >= min_blocks_size)
+        {
+            const std::size_t blocks_size = size & ~block_mask;
+            crc = crc32_pclmul_blocks(data, blocks_size, crc);
+            data += blocks_size; // NOLINT pointer arithmetic
+            size -= blocks_size;
+        }
+
+        return crc32_slicing_by_8(data, size, crc);
+    }
+#elif defined(CHECKSUM_HAS_ARMV8_CRC32)
+    bool crc32_hardware_supported()
+    {
+        return true;
+    }
+
+    std::uint32_t crc32_hardware(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        while (size >= sizeof(std::uint64_t))
+        {
+            std::uint64_t word = 0U;
+            std::memcpy(&word, data, sizeof(word));
+            crc = __crc32d(crc, word);
+            data += sizeof(word); // NOLINT pointer arithmetic
+            size -= sizeof(word);
+        }
+
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            crc = __crc32b(crc, data[i]); // NOLINT pointer arithmetic
+        }
+
+        return crc;
+    }
+#else
+    bool crc32_hardware_supported()
+    {
+        return false;
+    }
+
+    std::uint32_t crc32_hardware(const std::uint8_t* data, std::size_t size, std::uint32_t crc)
+    {
+        return crc32_slicing_by_8(data, size, crc);
+    }
+#endif
+
+    constexpr const std::uint32_t adler_base = 65521U;
+    constexpr const std::size_t adler_nmax = 5552U; // largest n keeping 255n(n+1)/2 + (n+1)(base-1) in 32 bits
+
+    std::uint32_t adler32_portable(const std::uint8_t* data, std::size_t size, std::uint32_t adler)
+    {
+        constexpr const std::size_t max_chunk = std::numeric_limits<unsigned int>::max();
+
+        while (size > 0U)
+        {
+            const std::size_t chunk = (size < max_chunk) ? size : max_chunk;
+            adler = uzlib_adler32(data, static_cast<unsigned int>(chunk), adler);
+            data += chunk; // NOLINT pointer arithmetic
+            size -= chunk;
+        }
+
+        return adler;
+    }
+
+#if defined(CHECKSUM_HAS_PCLMUL_CRC32)
+    bool adler32_hardware_supported()
+    {
+        return __builtin_cpu_supports("ssse3") != 0;
+    }
+
+    /**
+     * @brief Adler-32 over 32-byte blocks: psadbw sums the bytes for s1, pmaddubsw weights them by their distance
+     * to the block end for s2, and the s1 carried into s2 is accumulated apart and scaled once per NMAX run.
+     */
+    __attribute__((target("ssse3"))) std::uint32_t adler32_hardware(
+        const std::uint8_t* data, std::size_t size, std::uint32_t adler)
+    {
+        constexpr const unsigned int half_bits = 16U;
+        constexpr const std::uint32_t half_mask = 0xffffU;
+        constexpr const std::size_t block_size = 32U;
+        constexpr const int block_shift = 5;
+
+        std::uint32_t s1 = adler & half_mask;
+        std::uint32_t s2 = adler >> half_bits;
+        std::size_t blocks = size / block_size;
+        size -= blocks * block_size;
+
+        const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17); // NOLINT
+        const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);         // NOLINT
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i ones = _mm_set1_epi16(1);
+
+        while (blocks > 0U)
+        {
+            std::size_t n = adler_nmax / block_size;
+            n = (n < blocks) ? n : blocks;
+            blocks -= n;
+
+            __m128i v_ps = _mm_cvtsi32_si128(static_cast<int>(s1 * n));
+            __m128i v_s2 = _mm_cvtsi32_si128(static_cast<int>(s2));
+            __m128i v_s1 = _mm_setzero_si128();
+
+            for (; n > 0U; --n)
+            {
+                const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));       // NOLINT
+                const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16U)); // NOLINT
+
+                v_ps = _mm_add_epi32(v_ps, v_s1);
+                v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+                v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones));
+                v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+                v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones));
+                data += block_size; // NOLINT pointer arithmetic
+            }
+
+            v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, block_shift));
+
+            // horizontal sums (psadbw leaves its results in lanes 0 and 2)
+            v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+            s1 += static_cast<std::uint32_t>(_mm_cvtsi128_si32(v_s1));
+            v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+            v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+            s2 = static_cast<std::uint32_t>(_mm_cvtsi128_si32(v_s2));
+
+            s1 %= adler_base;
+            s2 %= adler_base;
+        }
+
+        return adler32_portable(data, size, (s2 << half_bits) | s1);
+    }
+#else
+    bool adler32_hardware_supported()
+    {
+        return false;
+    }
+
+    std::uint32_t adler32_hardware(const std::uint8_t* data, std::size_t size, std::uint32_t adler)
+    {
+        return adler32_portable(data, size, adler);
+    }
+#endif
+
+    /**
+     * @brief Multiplies two polynomials modulo the CRC-32 polynomial, in reflected bit order.
+     */
+    constexpr std::uint32_t crc32_multiply(std::uint32_t lhs, std::uint32_t rhs)
+    {
+        std::uint32_t product = 0U;
+        for (std::uint32_t bit = 0x80000000U; 0U != bit; bit >>= 1U)
+        {
+            if (0U != (lhs & bit))
+            {
+                product ^= rhs;
+            }
+            rhs = (0U != (rhs & 1U)) ? ((rhs >> 1U) ^ crc32_polynomial) : (rhs >> 1U);
+        }
+        return product;
+    }
+
+    /**
+     * @brief Powers x^(2^k) modulo the CRC-32 polynomial, for k in [0, 32).
+     */
+    constexpr std::array<std::uint32_t, 32U> make_crc32_x2n_table()
+    {
+        std::array<std::uint32_t, 32U> table = {};
+        std::uint32_t power = 0x40000000U; // x^1
+        for (auto& entry : table)
+        {
+            entry = power;
+            power = crc32_multiply(power, power);
+        }
+        return table;
+    }
+
+    constexpr const std::array<std::uint32_t, 32U> crc32_x2n_table = make_crc32_x2n_table();
+
+    using checksum_function = std::uint32_t (*)(const std::uint8_t*, std::size_t, std::uint32_t);
+
+    checksum_function crc32_function(tools::checksum_kernel kernel)
+    {
+        switch (kernel)
+        {
+            case tools::checksum_kernel::portable_table:
+                return &crc32_portable;
+            case tools::checksum_kernel::hardware:
+                return crc32_hardware_supported() ? &crc32_hardware : &crc32_slicing_by_8;
+            case tools::checksum_kernel::slicing_by_8:
+            default:
+                return &crc32_slicing_by_8;
+        }
+    }
+}
+
+namespace tools
+{
+    bool checksum_kernel_available(checksum_kernel kernel)
+    {
+        return (checksum_kernel::hardware != kernel) || crc32_hardware_supported();
+    }
+
+    bool adler32_hardware_available()
+    {
+        return adler32_hardware_supported();
+    }
+
+    checksum_kernel crc32_kernel()
+    {
+        static const checksum_kernel selected
+            = crc32_hardware_supported() ? checksum_kernel::hardware : checksum_kernel::slicing_by_8;
+
+        return selected;
+    }
+
+    std::uint32_t crc32_update(const void* data, std::size_t size, std::uint32_t crc)
+    {
+        static const checksum_function selected = crc32_function(crc32_kernel());
+
+        return selected(static_cast<const std::uint8_t*>(data), size, crc);
+    }
+
+    std::uint32_t crc32_update(checksum_kernel kernel, const void* data, std::size_t size, std::uint32_t crc)
+    {
+        return crc32_function(kernel)(static_cast<const std::uint8_t*>(data), size, crc);
+    }
+
+    std::uint32_t crc32_combine(std::uint32_t crc1, std::uint32_t crc2, std::uint64_t size2)
+    {
+        // crc(A . B) = crc(A) * x^(8 * |B|) + crc(B): the shift is built from the squares x^(2^k)
+        std::uint32_t shift = 0x80000000U; // x^0
+        for (unsigned int k = 3U; 0U != size2; size2 >>= 1U, ++k)
+        {
+            if (0U != (size2 & 1U))
+            {
+                shift = crc32_multiply(crc32_x2n_table[k & 31U], shift);
+            }
+        }
+        return crc32_multiply(shift, crc1) ^ crc2;
+    }
+
+    std::uint32_t adler32_update(const void* data, std::size_t size, std::uint32_t adler)
+    {
+        static const checksum_function selected = adler32_hardware_supported() ? &adler32_hardware : &adler32_portable;
+
+        return selected(static_cast<const std::uint8_t*>(data), size, adler);
+    }
+
+    std::uint32_t adler32_update(checksum_kernel kernel, const void* data, std::size_t size, std::uint32_t adler)
+    {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+        return ((checksum_kernel::hardware == kernel) && adler32_hardware_supported())
+            ? adler32_hardware(bytes, size, adler)
+            : adler32_portable(bytes, size, adler);
+    }
+}
@@ -0,0 +1,153 @@
+/**
+ * @file checksum.hpp
+ * @brief CRC-32 and Adler-32 checksums with a runtime-dispatched fastest kernel.
+ *
+ * This file declares the checksum helpers used by the gzip path: a portable table kernel (uzlib), a slicing-by-8
+ * CRC kernel and a hardware kernel (PCLMULQDQ folding on x86, ARMv8 CRC instructions, ESP32 ROM crc32_le; SSSE3
+ * for Adler-32 on x86), all computing the same values.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(CHECKSUM_HPP_)
+#define CHECKSUM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tools
+{
+    /**
+     * @brief Checksum implementations, from the slowest to the fastest.
+     */
+    enum class checksum_kernel : unsigned char
+    {
+        portable_table = 0U, ///< uzlib nibble-table CRC and deferred-modulo Adler loop, always available.
+        slicing_by_8 = 1U,   ///< Eight 256-entry tables, eight bytes per step (CRC-32 only).
+        hardware = 2U        ///< PCLMULQDQ or ARMv8 CRC instructions or the ESP32 ROM, SSSE3 for Adler-32.
+    };
+
+    /**
+     * @brief CRC-32 running state to start a new checksum with.
+     */
+    constexpr const std::uint32_t crc32_initial = ~0U;
+
+    /**
+     * @brief Adler-32 running state to start a new checksum with.
+     */
+    constexpr const std::uint32_t adler32_initial = 1U;
+
+    /**
+     * @brief Checks whether a kernel can run on this build and this CPU.
+     *
+     * @param kernel The kernel to check.
+     * @return true if CRC-32 calls with this kernel do not fall back to a slower one.
+     */
+    [[nodiscard]] bool checksum_kernel_available(checksum_kernel kernel);
+
+    /**
+     * @brief Checks whether Adler-32 has a hardware kernel on this build and this CPU.
+     *
+     * @return true if adler32_update() runs vectorized.
+     */
+    [[nodiscard]] bool adler32_hardware_available();
+
+    /**
+     * @brief Retrieves the kernel crc32_update() dispatches to, selected once at first use.
+     *
+     * @return The fastest available CRC-32 kernel.
+     */
+    [[nodiscard]] checksum_kernel crc32_kernel();
+
+    /**
+     * @brief Updates a gzip (reflected 0xedb88320) CRC-32 with the fastest available kernel.
+     *
+     * Same convention as uzlib_crc32(): start from crc32_initial and invert the final state.
+     *
+     * @param data The bytes to checksum.
+     * @param size The number of bytes.
+     * @param crc The running state.
+     * @return The updated running state.
+     */
+    [[nodiscard]] std::uint32_t crc32_update(const void* data, std::size_t size, std::uint32_t crc);
+
+    /**
+     * @brief Updates a CRC-32 with a given kernel, falling back to slicing-by-8 if it is not available.
+     *
+     * @param kernel The kernel to use.
+     * @param data The bytes to checksum.
+     * @param size The number of bytes.
+     * @param crc The running state.
+     * @return The updated running state.
+     */
+    [[nodiscard]] std::uint32_t crc32_update(
+        checksum_kernel kernel, const void* data, std::size_t size, std::uint32_t crc);
+
+    /**
+     * @brief Combines the CRC-32 of two adjacent byte ranges into the CRC-32 of their concatenation.
+     *
+     * Works on finished checksums (the inverted running states), so that ranges checksummed independently, for
+     * instance on several cores, can be merged in order in O(log(size2)) without touching the data again.
+     *
+     * @param crc1 The CRC-32 of the first range.
+     * @param crc2 The CRC-32 of the second range.
+     * @param size2 The size of the second range in bytes.
+     * @return The CRC-32 of the first range followed by the second one.
+     */
+    [[nodiscard]] std::uint32_t crc32_combine(std::uint32_t crc1, std::uint32_t crc2, std::uint64_t size2);
+
+    /**
+     * @brief Updates an Adler-32 with the fastest available kernel.
+     *
+     * Same convention as uzlib_adler32(): start from adler32_initial, the state is the final value.
+     *
+     * @param data The bytes to checksum.
+     * @param size The number of bytes.
+     * @param adler The running state.
+     * @return The updated running state.
+     */
+    [[nodiscard]] std::uint32_t adler32_update(const void* data, std::size_t size, std::uint32_t adler);
+
+    /**
+     * @brief Updates an Adler-32 with a given kernel; slicing_by_8 and an unavailable hardware kernel run the
+     * portable loop.
+     *
+     * @param kernel The kernel to use.
+     * @param data The bytes to checksum.
+     * @param size The number of bytes.
+     * @param adler The running state.
+     * @return The updated running state.
+     */
+    [[nodiscard]] std::uint32_t adler32_update(
+        checksum_kernel kernel, const void* data, std::size_t size, std::uint32_t adler);
+}
+
+#endif //  CHECKSUM_HPP_
@@ -0,0 +1,440 @@
+/**
+ * @file compact_time_history.hpp
+ * @brief Append-only timestamp/value history storing its timestamps as compressed deltas in blocks.
+ *
+ * This file defines tools::compact_time_history, a non-thread-safe long-retention alternative to tools::time_list.
+ * Entries are appended in chronological order into blocks of BlockSize entries; a block keeps its first and last
+ * timestamps in full and the others as zigzag varint deltas-of-deltas, so a periodic sample stream costs about one
+ * byte of timestamp per entry instead of a full time_point plus padding. The block bounds act as a min/max index:
+ * range scans skip whole blocks by binary search and decode only the blocks they overlap.
+ *
+ * Supported timestamp types:
+ * - std::chrono::time_point<Clock, Duration> with an integral Duration::rep
+ * - integral types (signed/unsigned)
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(COMPACT_TIME_HISTORY_HPP_)
+#define COMPACT_TIME_HISTORY_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/time_list.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Non-thread-safe append-only history of <timestamp, value> entries with delta-compressed timestamps.
+     *
+     * - push() appends at or after the latest timestamp in O(1) and returns false (entry ignored) for an older one;
+     * - visit_range() binary searches the blocks on their [first, last] bounds and decodes only the overlapped ones;
+     * - pop_until() drops whole blocks and re-encodes at most the one block straddling the bound;
+     * - visitors receive the decoded timestamp and a const reference to the stored value.
+     *
+     * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
+     * @tparam TValue Value type, stored uncompressed next to the timestamp stream of its block.
+     * @tparam BlockSize Number of entries per block.
+     */
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    template <typename TTimestamp, typename TValue, std::size_t BlockSize = 128U>
+        requires detail::is_valid_timestamp<TTimestamp>::value
+    class compact_time_history
+    {
+#else
+    template <typename TTimestamp, typename TValue, std::size_t BlockSize = 128U>
+    class compact_time_history
+    {
+        static_assert(detail::is_valid_timestamp<TTimestamp>::value,
+            "TTimestamp must be std::chrono::time_point<...> or an integral type");
+#endif
+        static_assert(BlockSize >= 2U, "a block holds at least two entries");
+
+    public:
+        using timestamp_type = TTimestamp;
+        using value_type = TValue;
+        using entry_type = std::pair<timestamp_type, value_type>;
+
+        /**
+         * @brief Append an entry by copy.
+         *
+         * @param timestamp_value Timestamp associated with value, not older than the latest one.
+         * @param payload_value Value to store.
+         * @return False when the timestamp is older than the latest one (nothing stored).
+         */
+        bool push(const timestamp_type& timestamp_value, const value_type& payload_value)
+        {
+            return append(timestamp_value, payload_value);
+        }
+
+        /**
+         * @brief Append an entry by move.
+         *
+         * @param timestamp_value Timestamp associated with value, not older than the latest one.
+         * @param payload_value Value to store.
+         * @return False when the timestamp is older than the latest one (nothing stored).
+         */
+        bool push(const timestamp_type& timestamp_value, value_type&& payload_value)
+        {
+            return append(timestamp_value, std::move(payload_value));
+        }
+
+        /**
+         * @brief Access the earliest entry.
+         *
+         * @return Earliest entry when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<entry_type> top() const
+        {
+            if (m_blocks.empty())
+            {
+                return std::nullopt;
+            }
+            return entry_type(m_blocks.front().m_first, m_blocks.front().m_values.front());
+        }
+
+        /**
+         * @brief Get the latest timestamp.
+         *
+         * @return Latest timestamp when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<timestamp_type> latest() const
+        {
+            if (m_blocks.empty())
+            {
+                return std::nullopt;
+            }
+            return m_blocks.back().m_last;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @return Number of removed entries.
+         */
+        std::size_t pop_until(const timestamp_type& timestamp_value)
+        {
+            std::size_t removed = 0U;
+
+            while (!m_blocks.empty() && !(timestamp_value < m_blocks.front().m_last))
+            {
+                removed += m_blocks.front().m_values.size();
+                m_blocks.pop_front();
+            }
+
+            if (!m_blocks.empty() && !(timestamp_value < m_blocks.front().m_first))
+            {
+                // the bound falls inside the first block: re-encode its kept tail
+                block& straddling = m_blocks.front();
+                block kept = make_block();
+                decode(straddling,
+                    [this, &kept, &timestamp_value, &straddling, &removed](
+                        const timestamp_type& entry_timestamp, std::size_t index)
+                    {
+                        if (timestamp_value < entry_timestamp)
+                        {
+                            encode(kept, entry_timestamp, std::move(straddling.m_values[index]));
+                        }
+                        else
+                        {
+                            ++removed;
+                        }
+                        return true;
+                    });
+                straddling = std::move(kept);
+            }
+
+            m_size -= removed;
+            return removed;
+        }
+
+        /**
+         * @brief Visit in chronological order the entries of a time window.
+         *
+         * @param from Inclusive lower bound of the visited timestamps.
+         * @param until Exclusive upper bound of the visited timestamps.
+         * @param visitor Callable invoked with the timestamp and a const reference to the value of each entry.
+         * @return Number of visited entries.
+         */
+        template <typename TVisitor>
+        std::size_t visit_range(const timestamp_type& from, const timestamp_type& until, TVisitor&& visitor) const
+        {
+            std::size_t visited = 0U;
+
+            auto itr = std::lower_bound(m_blocks.cbegin(), m_blocks.cend(), from,
+                [](const block& current, const timestamp_type& value) { return current.m_last < value; });
+
+            for (bool in_window = true; in_window && (itr != m_blocks.cend()) && (itr->m_first < until); ++itr)
+            {
+                const block& current = *itr;
+                decode(current,
+                    [&](const timestamp_type& entry_timestamp, std::size_t index)
+                    {
+                        if (!(entry_timestamp < until))
+                        {
+                            in_window = false;
+                            return false;
+                        }
+                        if (!(entry_timestamp < from))
+                        {
+                            visitor(entry_timestamp, static_cast<const value_type&>(current.m_values[index]));
+                            ++visited;
+                        }
+                        return true;
+                    });
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Visit every entry in chronological order.
+         *
+         * @param visitor Callable invoked with the timestamp and a const reference to the value of each entry.
+         */
+        template <typename TVisitor>
+        void for_each(TVisitor&& visitor) const
+        {
+            for (const block& current : m_blocks)
+            {
+                decode(current,
+                    [&](const timestamp_type& entry_timestamp, std::size_t index)
+                    {
+                        visitor(entry_timestamp, static_cast<const value_type&>(current.m_values[index]));
+                        return true;
+                    });
+            }
+        }
+
+        /**
+         * @brief Check whether the history is empty.
+         * @return True when empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        /**
+         * @brief Get the number of entries.
+         * @return Number of stored entries.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Get the number of blocks.
+         * @return Number of allocated blocks.
+         */
+        [[nodiscard]] std::size_t block_count() const
+        {
+            return m_blocks.size();
+        }
+
+        /**
+         * @brief Estimate the heap bytes held by the history (block headers, timestamp streams and values).
+         * @return Approximate footprint in bytes.
+         */
+        [[nodiscard]] std::size_t memory_footprint() const
+        {
+            std::size_t bytes = m_blocks.size() * sizeof(block);
+            for (const block& current : m_blocks)
+            {
+                bytes += current.m_deltas.capacity() + (current.m_values.capacity() * sizeof(value_type));
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Remove all entries.
+         */
+        void clear()
+        {
+            m_blocks.clear();
+            m_size = 0U;
+        }
+
+        /**
+         * @brief Return a chronological snapshot (earliest to latest).
+         *
+         * @return Vector copy sorted by timestamp ascending.
+         */
+        [[nodiscard]] std::vector<entry_type> snapshot_sorted() const
+        {
+            std::vector<entry_type> snapshot_values;
+            snapshot_values.reserve(m_size);
+            for_each([&snapshot_values](const timestamp_type& entry_timestamp, const value_type& payload_value)
+                { snapshot_values.emplace_back(entry_timestamp, payload_value); });
+            return snapshot_values;
+        }
+
+    private:
+        struct block
+        {
+            timestamp_type m_first;
+            timestamp_type m_last;
+            std::int64_t m_last_delta = 0; ///< ticks between the last two entries, base of the next delta-of-delta
+            std::vector<std::uint8_t> m_deltas;
+            std::vector<value_type> m_values;
+        };
+
+        static block make_block()
+        {
+            block created {};
+            created.m_values.reserve(BlockSize);
+            return created;
+        }
+
+        static std::int64_t ticks_between(const timestamp_type& earlier, const timestamp_type& later)
+        {
+            if constexpr (detail::is_std_time_point<timestamp_type>::value)
+            {
+                return static_cast<std::int64_t>((later - earlier).count());
+            }
+            else
+            {
+                return static_cast<std::int64_t>(static_cast<std::uint64_t>(later) - static_cast<std::uint64_t>(earlier));
+            }
+        }
+
+        static timestamp_type advance(const timestamp_type& base, std::int64_t ticks)
+        {
+            if constexpr (detail::is_std_time_point<timestamp_type>::value)
+            {
+                return base + typename timestamp_type::duration(static_cast<typename timestamp_type::rep>(ticks));
+            }
+            else
+            {
+                return static_cast<timestamp_type>(static_cast<std::uint64_t>(base) + static_cast<std::uint64_t>(ticks));
+            }
+        }
+
+        template <typename TV>
+        static void encode(block& target, const timestamp_type& timestamp_value, TV&& payload_value)
+        {
+            if (target.m_values.empty())
+            {
+                target.m_first = timestamp_value;
+            }
+            else
+            {
+                const std::int64_t delta = ticks_between(target.m_last, timestamp_value);
+                const std::int64_t delta_of_delta = delta - target.m_last_delta;
+                // zigzag: small negative and positive jitters both map to small unsigned codes
+                auto code = (static_cast<std::uint64_t>(delta_of_delta) << 1U)
+                    ^ static_cast<std::uint64_t>(delta_of_delta >> 63); // NOLINT sign mask
+                while (code >= 0x80U)
+                {
+                    target.m_deltas.push_back(static_cast<std::uint8_t>(code | 0x80U));
+                    code >>= 7U;
+                }
+                target.m_deltas.push_back(static_cast<std::uint8_t>(code));
+                target.m_last_delta = delta;
+            }
+
+            target.m_last = timestamp_value;
+            target.m_values.push_back(std::forward<TV>(payload_value));
+        }
+
+        /**
+         * @brief Decodes the timestamps of a block in order, calling fn(timestamp, index) until it returns false.
+         */
+        template <typename TFunction>
+        static void decode(const block& source, TFunction&& function)
+        {
+            timestamp_type current = source.m_first;
+            std::int64_t delta = 0;
+            std::size_t offset = 0U;
+
+            for (std::size_t index = 0U; index < source.m_values.size(); ++index)
+            {
+                if (0U != index)
+                {
+                    std::uint64_t code = 0U;
+                    unsigned shift = 0U;
+                    std::uint8_t byte = 0U;
+                    do
+                    {
+                        byte = source.m_deltas[offset++];
+                        code |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+                        shift += 7U;
+                    } while (0U != (byte & 0x80U));
+
+                    delta += static_cast<std::int64_t>(code >> 1U) ^ -static_cast<std::int64_t>(code & 1U);
+                    current = advance(current, delta);
+                }
+
+                if (!function(static_cast<const timestamp_type&>(current), index))
+                {
+                    return;
+                }
+            }
+        }
+
+        template <typename TV>
+        bool append(const timestamp_type& timestamp_value, TV&& payload_value)
+        {
+            if (!m_blocks.empty() && (timestamp_value < m_blocks.back().m_last))
+            {
+                return false;
+            }
+
+            if (m_blocks.empty() || (BlockSize == m_blocks.back().m_values.size()))
+            {
+                if (!m_blocks.empty())
+                {
+                    m_blocks.back().m_deltas.shrink_to_fit();
+                }
+                m_blocks.push_back(make_block());
+            }
+
+            encode(m_blocks.back(), timestamp_value, std::forward<TV>(payload_value));
+            ++m_size;
+            return true;
+        }
+
+        std::deque<block> m_blocks;
+        std::size_t m_size = 0U;
+    };
+
+} // namespace tools
+
+#endif // COMPACT_TIME_HISTORY_HPP_
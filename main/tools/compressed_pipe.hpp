@@ -0,0 +1,421 @@
+/**
+ * @file compressed_pipe.hpp
+ * @brief Pipeline stage compressing a byte stream in batches on top of a memory_pipe.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(COMPRESSED_PIPE_HPP_)
+#define COMPRESSED_PIPE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "tools/gzip_wrapper.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Counters of a compressed_pipe.
+     */
+    struct compressed_pipe_stats
+    {
+        std::uint64_t raw_bytes_sent = 0U;    ///< Bytes accepted by send().
+        std::uint64_t packed_bytes_sent = 0U; ///< Frame bytes written to the memory_pipe, headers included.
+        std::uint64_t frames_sent = 0U;       ///< Compressed frames written.
+        std::uint64_t frames_received = 0U;   ///< Frames decoded with a matching trailer.
+        std::uint64_t corrupted_frames = 0U;  ///< Frames dropped because they failed to decode.
+    };
+
+    /**
+     * @brief Stage between a producer and a memory_pipe compressing the stream with gzip_stream_compressor.
+     *
+     * send() accumulates the bytes in a batch; a full batch (or flush()) is compressed in one deflate block and
+     * written to the pipe as one frame: a 32-bit little endian length followed by a gzip member. Batching the
+     * small writes gives the match finder more context, and one send per frame suits the FreeRTOS message
+     * buffer behind memory_pipe (its message size must then hold frame_capacity() bytes).
+     *
+     * receive() reads the frames back and inflates them with gzip_stream_decoder straight into the caller
+     * buffer. The matches never reach further than one batch, so the decoder window is one batch too. A frame
+     * failing to decode is dropped and counted; the length prefix resynchronizes the stream on the next frame.
+     *
+     * As with memory_pipe, one producer thread calls send()/flush() and one consumer thread calls receive().
+     */
+    class compressed_pipe : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static constexpr std::size_t default_batch_size = 4096U;
+        static constexpr std::size_t frame_header_size = 4U;
+
+        compressed_pipe() = delete;
+        ~compressed_pipe() = default;
+
+        /**
+         * @brief Constructs a compressed stage on top of a memory_pipe.
+         *
+         * @param pipe The memory_pipe carrying the frames, outliving this object.
+         * @param batch_size The number of raw bytes compressed per frame (clamped to [64, gzip_dict_size]).
+         */
+        explicit compressed_pipe(memory_pipe& pipe, std::size_t batch_size = default_batch_size)
+            : m_pipe(pipe)
+            , m_batch_size(std::clamp<std::size_t>(batch_size, min_batch_size, gzip_dict_size))
+            , m_decoder(m_batch_size)
+        {
+            m_batch.resize(m_batch_size);
+            m_packed.resize(frame_capacity());
+            m_frame.resize(frame_capacity());
+        }
+
+        /**
+         * @brief Gets the largest frame written to the pipe.
+         *
+         * @return The frame header size plus the worst case gzip member size of one batch.
+         */
+        [[nodiscard]] std::size_t frame_capacity() const
+        {
+            return frame_header_size + gzip_stream_compressor::compress_bound(m_batch_size);
+        }
+
+        /**
+         * @brief Accepts bytes in the current batch, compressing and writing each batch that gets full.
+         *
+         * @param data Pointer to the bytes to send.
+         * @param send_bytes Number of bytes to send.
+         * @param timeout Maximum duration to wait for space in the pipe.
+         * @return The number of bytes accepted; they reach the consumer once their batch is full or flushed.
+         */
+        [[nodiscard]] std::size_t send(const std::uint8_t* data, std::size_t send_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t accepted = 0U;
+
+            if (nullptr == data)
+            {
+                return accepted;
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+            while ((accepted < send_bytes) && write_pending_frame(deadline))
+            {
+                const std::size_t copied = std::min(send_bytes - accepted, m_batch_size - m_batch_used);
+                std::memcpy(m_batch.data() + m_batch_used, data + accepted, copied); // NOLINT pointer arithmetic
+                m_batch_used += copied;
+                accepted += copied;
+
+                if (m_batch_used == m_batch_size)
+                {
+                    pack_batch();
+                }
+            }
+
+            static_cast<void>(write_pending_frame(deadline));
+            m_raw_bytes_sent.fetch_add(accepted, std::memory_order_relaxed);
+
+            return accepted;
+        }
+
+        /**
+         * @brief Accepts the bytes of a vector (see send()).
+         */
+        [[nodiscard]] std::size_t send(
+            const std::vector<std::uint8_t>& data, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send(data.data(), data.size(), timeout);
+        }
+
+        /**
+         * @brief Compresses the current partial batch and writes every pending frame to the pipe.
+         *
+         * @param timeout Maximum duration to wait for space in the pipe.
+         * @return true if nothing is left to write.
+         */
+        bool flush(const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+            if (!write_pending_frame(deadline))
+            {
+                return false;
+            }
+
+            if (0U != m_batch_used)
+            {
+                pack_batch();
+            }
+
+            return write_pending_frame(deadline);
+        }
+
+        /**
+         * @brief Receives decompressed bytes.
+         *
+         * @param data Pointer to the destination buffer.
+         * @param rcv_bytes The number of bytes wanted.
+         * @param timeout Maximum duration to wait for frames.
+         * @return The number of bytes received.
+         */
+        [[nodiscard]] std::size_t receive(
+            std::uint8_t* data, std::size_t rcv_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t received = 0U;
+
+            if (nullptr == data)
+            {
+                return received;
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+            while (received < rcv_bytes)
+            {
+                if (m_frame_pushed < m_frame_size)
+                {
+                    m_frame_pushed += m_decoder.push(
+                        m_frame.data() + m_frame_pushed, m_frame_size - m_frame_pushed); // NOLINT pointer arithmetic
+                    if (m_frame_pushed == m_frame_size)
+                    {
+                        m_decoder.end_input();
+                    }
+                }
+
+                if (m_frame_active)
+                {
+                    const auto pulled
+                        = m_decoder.pull(data + received, rcv_bytes - received); // NOLINT pointer arithmetic
+
+                    if (!pulled.has_value())
+                    {
+                        m_corrupted_frames.fetch_add(1U, std::memory_order_relaxed);
+                        m_frame_active = false;
+                    }
+                    else
+                    {
+                        received += pulled.value();
+                        if (m_decoder.done())
+                        {
+                            m_frames_received.fetch_add(1U, std::memory_order_relaxed);
+                            m_frame_active = false;
+                        }
+                    }
+                }
+                else if (!read_frame(deadline))
+                {
+                    break;
+                }
+            }
+
+            return received;
+        }
+
+        /**
+         * @brief Receives decompressed bytes into a vector (see receive()).
+         */
+        [[nodiscard]] std::size_t receive(std::vector<std::uint8_t>& data, std::size_t rcv_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            data.resize(rcv_bytes);
+            const std::size_t effective_size = receive(data.data(), rcv_bytes, timeout);
+            data.resize(effective_size);
+            return effective_size;
+        }
+
+        /**
+         * @brief Gets the counters of the stage.
+         *
+         * @return The counters.
+         */
+        [[nodiscard]] compressed_pipe_stats stats() const
+        {
+            compressed_pipe_stats counters;
+            counters.raw_bytes_sent = m_raw_bytes_sent.load(std::memory_order_relaxed);
+            counters.packed_bytes_sent = m_packed_bytes_sent.load(std::memory_order_relaxed);
+            counters.frames_sent = m_frames_sent.load(std::memory_order_relaxed);
+            counters.frames_received = m_frames_received.load(std::memory_order_relaxed);
+            counters.corrupted_frames = m_corrupted_frames.load(std::memory_order_relaxed);
+            return counters;
+        }
+
+    private:
+        static constexpr std::size_t min_batch_size = 64U;
+        using time_point = std::chrono::steady_clock::time_point;
+
+        static std::chrono::duration<std::uint64_t, std::milli> remaining(const time_point& deadline)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            return (deadline > now) ? std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::milli>>(
+                                          deadline - now)
+                                    : std::chrono::duration<std::uint64_t, std::milli>(0U);
+        }
+
+        void pack_batch()
+        {
+            // the bounds are checked at construction time: compression into m_packed cannot fail
+            std::uint8_t* member = m_packed.data() + frame_header_size; // NOLINT pointer arithmetic
+            const std::size_t capacity = m_packed.size() - frame_header_size;
+
+            std::size_t size = m_compressor.init(member, capacity).value_or(0U);
+            size += m_compressor.update(m_batch.data(), m_batch_used, member + size, capacity - size) // NOLINT
+                        .value_or(0U);
+            size += m_compressor.finish(member + size, capacity - size).value_or(0U); // NOLINT pointer arithmetic
+
+            for (std::size_t i = 0U; i < frame_header_size; ++i)
+            {
+                m_packed[i] = static_cast<std::uint8_t>((size >> (i * 8U)) & 0xffU); // NOLINT little endian
+            }
+
+            m_packed_size = frame_header_size + size;
+            m_packed_written = 0U;
+            m_batch_used = 0U;
+        }
+
+        bool write_pending_frame(const time_point& deadline)
+        {
+            while (m_packed_written < m_packed_size)
+            {
+                const std::size_t written = m_pipe.send(m_packed.data() + m_packed_written, // NOLINT arithmetic
+                    m_packed_size - m_packed_written, remaining(deadline));
+                m_packed_written += written;
+                m_packed_bytes_sent.fetch_add(written, std::memory_order_relaxed);
+
+                if (m_packed_written == m_packed_size)
+                {
+                    m_frames_sent.fetch_add(1U, std::memory_order_relaxed);
+                }
+                else if ((0U == written) && (std::chrono::steady_clock::now() >= deadline))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // returns false when the deadline expired before a whole frame could be read
+        bool read_frame(const time_point& deadline)
+        {
+#if defined(FREERTOS_PLATFORM)
+            // message buffer: one receive returns one whole frame, a shorter message fails the length check below
+            m_frame_read = m_pipe.receive(m_frame.data(), m_frame.size(), remaining(deadline));
+            if (0U == m_frame_read)
+            {
+                return false;
+            }
+#else
+            // byte stream: read the header, then exactly the announced member
+            while (m_frame_read < frame_header_size)
+            {
+                const std::size_t got = m_pipe.receive(m_frame.data() + m_frame_read, // NOLINT pointer arithmetic
+                    frame_header_size - m_frame_read, remaining(deadline));
+                m_frame_read += got;
+                if ((0U == got) && (std::chrono::steady_clock::now() >= deadline))
+                {
+                    return false;
+                }
+            }
+#endif
+
+            std::size_t member_size = 0U;
+            for (std::size_t i = 0U; i < frame_header_size; ++i)
+            {
+                member_size |= static_cast<std::size_t>(m_frame[i]) << (i * 8U); // NOLINT little endian
+            }
+
+#if defined(FREERTOS_PLATFORM)
+            if ((frame_header_size + member_size) != m_frame_read)
+#else
+            if (member_size > (m_frame.size() - frame_header_size))
+#endif
+            {
+                // not a frame of this stage: drop it and read on
+                m_corrupted_frames.fetch_add(1U, std::memory_order_relaxed);
+                m_frame_read = 0U;
+                return true;
+            }
+
+#if !defined(FREERTOS_PLATFORM)
+            while (m_frame_read < (frame_header_size + member_size))
+            {
+                const std::size_t got = m_pipe.receive(m_frame.data() + m_frame_read, // NOLINT pointer arithmetic
+                    frame_header_size + member_size - m_frame_read, remaining(deadline));
+                m_frame_read += got;
+                if ((0U == got) && (std::chrono::steady_clock::now() >= deadline))
+                {
+                    return false;
+                }
+            }
+#endif
+
+            m_decoder.reset();
+            m_frame_pushed = frame_header_size;
+            m_frame_size = frame_header_size + member_size;
+            m_frame_read = 0U;
+            m_frame_active = true;
+
+            return true;
+        }
+
+        memory_pipe& m_pipe;
+        std::size_t m_batch_size;
+
+        // producer side
+        gzip_stream_compressor m_compressor;
+        std::vector<std::uint8_t> m_batch;
+        std::size_t m_batch_used = 0U;
+        std::vector<std::uint8_t> m_packed;
+        std::size_t m_packed_size = 0U;
+        std::size_t m_packed_written = 0U;
+
+        // consumer side
+        gzip_stream_decoder m_decoder;
+        std::vector<std::uint8_t> m_frame;
+        std::size_t m_frame_read = 0U;
+        std::size_t m_frame_pushed = 0U;
+        std::size_t m_frame_size = 0U;
+        bool m_frame_active = false;
+
+        std::atomic<std::uint64_t> m_raw_bytes_sent = 0U;
+        std::atomic<std::uint64_t> m_packed_bytes_sent = 0U;
+        std::atomic<std::uint64_t> m_frames_sent = 0U;
+        std::atomic<std::uint64_t> m_frames_received = 0U;
+        std::atomic<std::uint64_t> m_corrupted_frames = 0U;
+    };
+}
+
+#endif //  COMPRESSED_PIPE_HPP_
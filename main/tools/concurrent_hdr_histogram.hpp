@@ -0,0 +1,343 @@
+/**
+ * @file concurrent_hdr_histogram.hpp
+ * @brief A lock-free multi-writer recorder of hdr_histogram samples, merged per interval.
+ *
+ * This file contains the definition of the concurrent_hdr_histogram class: each recording thread gets its own
+ * lane of relaxed atomic bucket counters, and an exporter periodically merges every lane into an hdr_histogram
+ * while resetting them, without ever blocking the writers.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(CONCURRENT_HDR_HISTOGRAM_HPP_)
+#define CONCURRENT_HDR_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "tools/hdr_histogram.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A thread-safe hdr_histogram recorder, one lane of atomic counters per writer thread.
+     *
+     * Writers obtain a recorder with make_recorder(), which claims a free lane for its lifetime; add() is then a
+     * few relaxed atomic operations on a cache line no other writer touches. When more recorders than lanes are
+     * alive, the extra ones share lanes round-robin, which stays correct (every update is atomic) and only costs
+     * contention. collect_interval() exchanges every counter with zero and merges the lanes into an
+     * hdr_histogram, so that a periodic exporter reads p99/p999 of the last interval without locking. A sample
+     * racing with a collection lands in this interval or the next, never in both; its bucket and its share of
+     * the sum may straddle the two. The variance of the merged histogram is estimated from bucket midpoints.
+     *
+     * Footprint: LaneCount * ((ValueBits - PrecisionBits + 1) * 2^PrecisionBits * 4 + 32) bytes, cache aligned.
+     *
+     * @tparam PrecisionBits log2 of the sub-buckets per power of two, as for hdr_histogram.
+     * @tparam ValueBits Width of the largest recordable sample, as for hdr_histogram.
+     * @tparam LaneCount Number of lanes, i.e. of concurrent writers without sharing.
+     */
+    template <unsigned int PrecisionBits = 5U, unsigned int ValueBits = 32U, std::size_t LaneCount = 4U>
+    class concurrent_hdr_histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    private:
+        struct alignas(64) lane // NOLINT cache line
+        {
+            std::array<std::atomic<std::uint32_t>, hdr_histogram<PrecisionBits, ValueBits>::bucket_count> m_buckets
+                = {};
+            std::atomic<std::uint64_t> m_sum = 0U;
+            std::atomic<std::uint64_t> m_min = hdr_histogram<PrecisionBits, ValueBits>::max_value;
+            std::atomic<std::uint64_t> m_max = 0U;
+            std::atomic<bool> m_claimed = false;
+        };
+
+    public:
+        static_assert(LaneCount > 0U, "at least one lane is required");
+
+        using histogram_type = hdr_histogram<PrecisionBits, ValueBits>;
+
+        static constexpr std::size_t bucket_count = histogram_type::bucket_count;
+
+        concurrent_hdr_histogram() = default;
+        ~concurrent_hdr_histogram() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Move-only handle recording into one lane, to be kept by a single thread.
+         */
+        class recorder
+        {
+        public:
+            recorder() = default;
+
+            ~recorder()
+            {
+                release();
+            }
+
+            recorder(const recorder&) = delete;
+            recorder& operator=(const recorder&) = delete;
+
+            recorder(recorder&& other) noexcept
+                : m_lane(std::exchange(other.m_lane, nullptr))
+                , m_owned(std::exchange(other.m_owned, false))
+            {
+            }
+
+            recorder& operator=(recorder&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_lane = std::exchange(other.m_lane, nullptr);
+                    m_owned = std::exchange(other.m_owned, false);
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Records a sample, lock-free.
+             *
+             * @param value The sample (clamped to histogram_type::max_value).
+             */
+            void add(std::uint64_t value)
+            {
+                if (nullptr == m_lane)
+                {
+                    return;
+                }
+
+                value = (value > histogram_type::max_value) ? histogram_type::max_value : value;
+                m_lane->m_buckets[histogram_type::bucket_of(value)].fetch_add(1U, std::memory_order_relaxed);
+                m_lane->m_sum.fetch_add(value, std::memory_order_relaxed);
+
+                auto current = m_lane->m_min.load(std::memory_order_relaxed);
+                while ((value < current)
+                    && !m_lane->m_min.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                {
+                }
+
+                current = m_lane->m_max.load(std::memory_order_relaxed);
+                while ((value > current)
+                    && !m_lane->m_max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            /**
+             * @brief Checks if the recorder is bound to a lane.
+             */
+            explicit operator bool() const
+            {
+                return nullptr != m_lane;
+            }
+
+            /**
+             * @brief Checks if the lane is exclusive to this recorder (false once lanes are shared).
+             *
+             * @return true if no other recorder writes to the same lane.
+             */
+            [[nodiscard]] bool exclusive() const
+            {
+                return m_owned;
+            }
+
+        private:
+            friend class concurrent_hdr_histogram;
+
+            recorder(lane* target, bool owned)
+                : m_lane(target)
+                , m_owned(owned)
+            {
+            }
+
+            void release()
+            {
+                if (m_owned && (nullptr != m_lane))
+                {
+                    m_lane->m_claimed.store(false, std::memory_order_release);
+                }
+
+                m_lane = nullptr;
+                m_owned = false;
+            }
+
+            lane* m_lane = nullptr;
+            bool m_owned = false;
+        };
+
+        /**
+         * @brief Gets a recorder for the calling thread, on a free lane if any, on a shared lane otherwise.
+         *
+         * @return The recorder; it must not outlive the concurrent_hdr_histogram.
+         */
+        [[nodiscard]] recorder make_recorder()
+        {
+            for (auto& candidate : m_lanes)
+            {
+                if (!candidate.m_claimed.exchange(true, std::memory_order_acquire))
+                {
+                    return recorder(&candidate, true);
+                }
+            }
+
+            const auto shared = m_next_shared.fetch_add(1U, std::memory_order_relaxed) % LaneCount;
+            return recorder(&m_lanes[shared], false);
+        }
+
+        /**
+         * @brief Merges every lane into a histogram and resets the lanes, starting a new interval.
+         *
+         * @param interval The histogram receiving the samples since the previous collection (reset first).
+         */
+        void collect_interval(histogram_type& interval)
+        {
+            gather<true>(m_lanes, interval);
+        }
+
+        /**
+         * @brief Merges every lane into a histogram, keeping the lanes untouched.
+         *
+         * @param copy The histogram receiving the samples since the previous collection (reset first).
+         */
+        void snapshot(histogram_type& copy) const
+        {
+            gather<false>(m_lanes, copy);
+        }
+
+    private:
+        template <bool Drain, typename Counter, typename Value>
+        static std::uint64_t take(Counter& counter, Value reset_value)
+        {
+            if constexpr (Drain)
+            {
+                return counter.exchange(reset_value, std::memory_order_relaxed);
+            }
+            else
+            {
+                static_cast<void>(reset_value);
+                return counter.load(std::memory_order_relaxed);
+            }
+        }
+
+        template <bool Drain, typename Lanes>
+        static void gather(Lanes& lanes, histogram_type& out)
+        {
+            out.reset();
+            std::uint64_t sum = 0U;
+            std::uint64_t min = histogram_type::max_value;
+            std::uint64_t max = 0U;
+
+            for (auto& source : lanes)
+            {
+                std::uint64_t lane_count = 0U;
+
+                for (std::size_t bucket = 0U; bucket < bucket_count; ++bucket)
+                {
+                    const std::uint64_t count = take<Drain>(source.m_buckets[bucket], 0U);
+                    out.m_buckets[bucket] += count;
+                    lane_count += count;
+                }
+
+                const std::uint64_t lane_sum = take<Drain>(source.m_sum, 0U);
+                const std::uint64_t lane_min = take<Drain>(source.m_min, histogram_type::max_value);
+                const std::uint64_t lane_max = take<Drain>(source.m_max, 0U);
+
+                out.m_total_count += lane_count;
+                sum += lane_sum;
+
+                if (0U != lane_count)
+                {
+                    min = (lane_min < min) ? lane_min : min;
+                    max = (lane_max > max) ? lane_max : max;
+                }
+            }
+
+            if (0U == out.m_total_count)
+            {
+                out.reset();
+                return;
+            }
+
+            out.m_sum = static_cast<double>(sum);
+
+            for (std::size_t bucket = 0U; bucket < bucket_count; ++bucket)
+            {
+                const std::uint64_t count = out.m_buckets[bucket];
+
+                if (0U == count)
+                {
+                    continue;
+                }
+
+                const std::uint64_t low = histogram_type::lowest_equivalent(bucket);
+                const std::uint64_t high = histogram_type::highest_equivalent(bucket);
+                const auto midpoint = static_cast<double>(low + ((high - low) / 2U));
+                out.m_sum_of_squares += midpoint * midpoint * static_cast<double>(count);
+
+                if (count > out.m_buckets[out.m_top_bucket])
+                {
+                    out.m_top_bucket = bucket;
+                }
+            }
+
+            // a sample racing with the collection may have its bucket counted before its bounds
+            const std::uint64_t first = histogram_type::lowest_equivalent(first_bucket(out));
+            min = (min > max) ? first : min;
+            out.m_min = min;
+            out.m_max = (max < min) ? min : max;
+        }
+
+        static std::size_t first_bucket(const histogram_type& histogram)
+        {
+            std::size_t bucket = 0U;
+
+            while ((bucket + 1U < bucket_count) && (0U == histogram.m_buckets[bucket]))
+            {
+                ++bucket;
+            }
+
+            return bucket;
+        }
+
+        std::array<lane, LaneCount> m_lanes = {};
+        std::atomic<std::size_t> m_next_shared = 0U;
+    };
+}
+
+#endif //  CONCURRENT_HDR_HISTOGRAM_HPP_
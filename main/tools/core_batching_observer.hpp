@@ -0,0 +1,243 @@
+/**
+ * @file core_batching_observer.hpp
+ * @brief Observer decorator staging events per publishing core and forwarding them in batches.
+ *
+ * When a publisher and the consumer task of an async observer run on different cores, every event moves the
+ * queue and the wake-up event between caches. The decorator keeps one staging buffer per core, touched only by
+ * the tasks of that core, and hands the target observer whole batches through inform_range(): one queue push
+ * and one signal per batch instead of per event.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(CORE_BATCHING_OBSERVER_HPP_)
+#define CORE_BATCHING_OBSERVER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/sharded_counter.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Sync observer staging events on the core of the publisher and informing a target observer in batches.
+     *
+     * Subscribe the decorator to a sync_subject in place of the target, usually an async_observer whose consumer
+     * task runs on another core. A stage is forwarded when it holds batch_size events, when the topic or the
+     * origin of the next event differs, and on flush(), which the publisher calls after a burst or periodically
+     * so that a partial batch does not wait for more traffic. Events published from one core keep their order;
+     * events of different cores may be reordered across batches.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject, compared with ==.
+     * @tparam StageCount The number of staging buffers, a power of two (the core count on ESP32).
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string,
+        std::size_t StageCount = default_counter_shards>
+    class core_batching_observer : public sync_observer<Topic, Evt, Origin>
+    {
+        static_assert((0U != StageCount) && (0U == (StageCount & (StageCount - 1U))), "StageCount: power of two");
+
+    public:
+        using target_ptr = std::shared_ptr<sync_observer<Topic, Evt, Origin>>;
+
+        /**
+         * @brief Constructs the decorator and reserves its staging buffers.
+         *
+         * @param target The observer informed of the batches.
+         * @param batch_size The number of events per batch, 1 to forward every event at once.
+         */
+        core_batching_observer(target_ptr target, std::size_t batch_size)
+            : m_target(std::move(target))
+            , m_batch_size((0U == batch_size) ? 1U : batch_size)
+        {
+            for (auto& stage : m_stages)
+            {
+                stage.events.reserve(m_batch_size);
+            }
+        }
+
+        ~core_batching_observer() override
+        {
+            flush();
+        }
+
+        /**
+         * @brief Stages an event on the core of the caller, forwarding the stage once full.
+         *
+         * @param topic The topic of the event.
+         * @param event The event data.
+         * @param origin The origin of the event.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            auto& stage = local_stage();
+            std::scoped_lock<critical_section> guard(stage.mutex);
+            if (!stage.events.empty() && ((topic != *stage.topic) || !(origin == *stage.origin)))
+            {
+                forward(stage);
+            }
+            if (stage.events.empty())
+            {
+                stage.topic = topic;
+                stage.origin = origin;
+            }
+            stage.events.push_back(event);
+            if (stage.events.size() >= m_batch_size)
+            {
+                forward(stage);
+            }
+        }
+
+        /**
+         * @brief Forwards an already formed batch, after the events staged before it on the caller's core.
+         *
+         * @param topic The topic of the events.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         * @param origin The origin of the events.
+         */
+        void inform_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin) override
+        {
+            auto& stage = local_stage();
+            std::scoped_lock<critical_section> guard(stage.mutex);
+            forward(stage);
+            m_target->inform_range(topic, events, count, origin);
+            m_batches.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Forwards the staged events of every core.
+         */
+        void flush()
+        {
+            for (auto& stage : m_stages)
+            {
+                std::scoped_lock<critical_section> guard(stage.mutex);
+                forward(stage);
+            }
+        }
+
+        /**
+         * @brief Reports the backlog of the target, the staged events counting as pending.
+         *
+         * @return The backlog counters.
+         */
+        observer_backlog backlog() override
+        {
+            observer_backlog counters = m_target->backlog();
+            counters.pending += staged();
+            return counters;
+        }
+
+        /**
+         * @brief Gets the number of events staged and not forwarded yet, over all cores.
+         *
+         * @return The staged event count.
+         */
+        [[nodiscard]] std::size_t staged()
+        {
+            std::size_t count = 0U;
+            for (auto& stage : m_stages)
+            {
+                std::scoped_lock<critical_section> guard(stage.mutex);
+                count += stage.events.size();
+            }
+            return count;
+        }
+
+        /**
+         * @brief Gets the number of batches handed to the target since construction.
+         *
+         * @return The batch count.
+         */
+        [[nodiscard]] std::size_t batches() const
+        {
+            return m_batches.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the number of events per full batch.
+         *
+         * @return The batch size.
+         */
+        [[nodiscard]] std::size_t batch_size() const
+        {
+            return m_batch_size;
+        }
+
+    private:
+        /**
+         * @brief Staging buffer of one core, on its own cache line.
+         */
+        struct alignas(64) stage_slot // NOLINT cache line size
+        {
+            critical_section mutex;
+            std::optional<Topic> topic;
+            std::optional<Origin> origin;
+            std::vector<Evt> events;
+        };
+
+        stage_slot& local_stage()
+        {
+            return m_stages[detail::counter_shard_hint() & (StageCount - 1U)];
+        }
+
+        void forward(stage_slot& stage)
+        {
+            if (stage.events.empty())
+            {
+                return;
+            }
+            m_target->inform_range(*stage.topic, stage.events.data(), stage.events.size(), *stage.origin);
+            m_batches.fetch_add(1U, std::memory_order_relaxed);
+            stage.events.clear();
+        }
+
+        target_ptr m_target;
+        std::size_t m_batch_size;
+        std::array<stage_slot, StageCount> m_stages;
+        std::atomic<std::size_t> m_batches { 0U };
+    };
+}
+
+#endif // CORE_BATCHING_OBSERVER_HPP_
@@ -0,0 +1,405 @@
+/**
+ * @file cpu_topology.hpp
+ * @brief Logical and physical cores, SMT siblings, cache domains and NUMA nodes, with placement helpers.
+ *
+ * cpu_topology::current() describes the CPUs the process may run on: read from sysfs and the affinity mask on
+ * Linux, from esp_chip_info on ESP32, flat elsewhere. spread() orders CPU numbers so that consecutive workers
+ * land on distinct physical cores and NUMA nodes first, and colocated_pair() picks two CPUs sharing a last
+ * level cache for a producer/consumer pair. Both return the cpu_affinity values the task classes take.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(CPU_TOPOLOGY_HPP_)
+#define CPU_TOPOLOGY_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+#if defined(__linux__) && !defined(FREERTOS_PLATFORM)
+#include "tools/linux/linux_cpu_topology.hpp"
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Placement of one logical CPU.
+     */
+    struct cpu_info
+    {
+        int logical_id = 0;   ///< CPU number, as given to the cpu_affinity of a task.
+        int core_id = 0;      ///< Physical core index (0 .. physical_count() - 1), shared by SMT siblings.
+        int package_id = 0;   ///< Physical package (socket).
+        int numa_node = 0;    ///< NUMA node.
+        int cache_domain = 0; ///< Id shared by the CPUs sharing the same last level cache.
+    };
+
+    /**
+     * @brief Two CPUs for a producer/consumer pair.
+     */
+    struct cpu_pair
+    {
+        int producer = 0; ///< CPU of the producer task.
+        int consumer = 0; ///< CPU of the consumer task.
+    };
+
+    /**
+     * @brief CPU topology of the platform and placement helpers built on it.
+     *
+     * The placement orders are computed once at construction; the object is immutable afterwards.
+     */
+    class cpu_topology
+    {
+    public:
+        /**
+         * @brief Builds a topology from a CPU description, a single CPU 0 if empty.
+         *
+         * Physical core indices are made dense in the order the (package, core) pairs first appear by CPU number.
+         *
+         * @param cpus One entry per logical CPU; core_id may be any per-package core number.
+         */
+        explicit cpu_topology(std::vector<cpu_info> cpus)
+            : m_cpus(std::move(cpus))
+        {
+            if (m_cpus.empty())
+            {
+                m_cpus.emplace_back();
+            }
+
+            std::sort(m_cpus.begin(), m_cpus.end(),
+                [](const cpu_info& lhs, const cpu_info& rhs) { return lhs.logical_id < rhs.logical_id; });
+
+            std::map<std::pair<int, int>, int> core_index;
+            std::map<int, int> node_ids;
+            std::map<int, int> domain_ids;
+
+            for (auto& cpu : m_cpus)
+            {
+                const auto core = core_index.emplace(std::make_pair(cpu.package_id, cpu.core_id),
+                    static_cast<int>(core_index.size()));
+                cpu.core_id = core.first->second;
+                node_ids.emplace(cpu.numa_node, 0);
+                domain_ids.emplace(cpu.cache_domain, 0);
+            }
+
+            m_physical_count = core_index.size();
+            m_numa_node_count = node_ids.size();
+            m_cache_domain_count = domain_ids.size();
+
+            compute_spread_order();
+            compute_pairs();
+        }
+
+        /**
+         * @brief Detects the topology of the CPUs the process may run on.
+         *
+         * @return The detected topology.
+         */
+        [[nodiscard]] static cpu_topology detect()
+        {
+            std::vector<cpu_info> cpus;
+
+#if defined(ESP_PLATFORM)
+            esp_chip_info_t chip_info = {};
+            esp_chip_info(&chip_info);
+            for (int core = 0; core < static_cast<int>(chip_info.cores); ++core)
+            {
+                cpus.push_back(cpu_info { core, core, 0, 0, 0 });
+            }
+#elif defined(FREERTOS_PLATFORM)
+            for (int core = 0; core < static_cast<int>(cpu_core_count()); ++core)
+            {
+                cpus.push_back(cpu_info { core, core, 0, 0, 0 });
+            }
+#elif defined(__linux__)
+            for (const auto& entry : linux_os::read_cpu_topology(linux_os::allowed_cpus()))
+            {
+                cpus.push_back(cpu_info {
+                    entry.logical_id, entry.core_id, entry.package_id, entry.numa_node, entry.cache_domain });
+            }
+#else
+            const int count = static_cast<int>((std::max)(1U, std::thread::hardware_concurrency()));
+            for (int cpu = 0; cpu < count; ++cpu)
+            {
+                cpus.push_back(cpu_info { cpu, cpu, 0, 0, 0 });
+            }
+#endif
+
+            return cpu_topology(std::move(cpus));
+        }
+
+        /**
+         * @brief Gets the topology of the platform, detected on first use.
+         *
+         * @return The process-wide topology.
+         */
+        [[nodiscard]] static const cpu_topology& current()
+        {
+            static const cpu_topology topology = detect();
+            return topology;
+        }
+
+        /**
+         * @brief Gets the logical CPUs, by increasing CPU number.
+         *
+         * @return The CPU descriptions.
+         */
+        [[nodiscard]] const std::vector<cpu_info>& cpus() const
+        {
+            return m_cpus;
+        }
+
+        /**
+         * @brief Gets the number of logical CPUs (hardware threads).
+         *
+         * @return The logical CPU count, at least 1.
+         */
+        [[nodiscard]] std::size_t logical_count() const
+        {
+            return m_cpus.size();
+        }
+
+        /**
+         * @brief Gets the number of physical cores.
+         *
+         * @return The physical core count, at least 1.
+         */
+        [[nodiscard]] std::size_t physical_count() const
+        {
+            return m_physical_count;
+        }
+
+        /**
+         * @brief Gets the number of NUMA nodes holding the CPUs.
+         *
+         * @return The NUMA node count, at least 1.
+         */
+        [[nodiscard]] std::size_t numa_node_count() const
+        {
+            return m_numa_node_count;
+        }
+
+        /**
+         * @brief Gets the number of distinct last level caches.
+         *
+         * @return The cache domain count, at least 1.
+         */
+        [[nodiscard]] std::size_t cache_domain_count() const
+        {
+            return m_cache_domain_count;
+        }
+
+        /**
+         * @brief Tells whether some physical core runs several hardware threads.
+         *
+         * @return true with SMT (hyper-threading).
+         */
+        [[nodiscard]] bool has_smt() const
+        {
+            return m_physical_count < m_cpus.size();
+        }
+
+        /**
+         * @brief Finds the description of a CPU.
+         *
+         * @param logical_id The CPU number.
+         * @return The description, nullptr if the CPU is not part of the topology.
+         */
+        [[nodiscard]] const cpu_info* find(int logical_id) const
+        {
+            const auto found = std::find_if(m_cpus.begin(), m_cpus.end(),
+                [logical_id](const cpu_info& cpu) { return cpu.logical_id == logical_id; });
+            return (m_cpus.end() == found) ? nullptr : &(*found);
+        }
+
+        /**
+         * @brief Lists the other hardware threads of the physical core of a CPU.
+         *
+         * @param logical_id The CPU number.
+         * @return The CPU numbers of the SMT siblings, empty without SMT.
+         */
+        [[nodiscard]] std::vector<int> smt_siblings(int logical_id) const
+        {
+            std::vector<int> siblings;
+            const cpu_info* self = find(logical_id);
+
+            if (nullptr != self)
+            {
+                for (const auto& cpu : m_cpus)
+                {
+                    if ((cpu.core_id == self->core_id) && (cpu.logical_id != logical_id))
+                    {
+                        siblings.push_back(cpu.logical_id);
+                    }
+                }
+            }
+
+            return siblings;
+        }
+
+        /**
+         * @brief Gives count CPU numbers spreading load: one per physical core, alternating NUMA nodes, before
+         *        any SMT sibling, wrapping around when count exceeds the logical CPU count.
+         *
+         * @param count The number of workers to place.
+         * @return The cpu_affinity of each worker.
+         */
+        [[nodiscard]] std::vector<int> spread(std::size_t count) const
+        {
+            std::vector<int> placement;
+            placement.reserve(count);
+
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                placement.push_back(m_spread_order[index % m_spread_order.size()]);
+            }
+
+            return placement;
+        }
+
+        /**
+         * @brief Gives two CPUs sharing a last level cache for a producer/consumer pair.
+         *
+         * Pairs use distinct physical cores of one cache domain when possible, SMT siblings otherwise; successive
+         * indices alternate cache domains and give disjoint pairs while there are enough CPUs, then wrap around.
+         *
+         * @param index The pair number.
+         * @return The CPUs of the pair (the same CPU twice on a single-CPU platform).
+         */
+        [[nodiscard]] cpu_pair colocated_pair(std::size_t index = 0U) const
+        {
+            return m_pairs[index % m_pairs.size()];
+        }
+
+    private:
+        /**
+         * @brief Rank of a CPU among the hardware threads of its physical core (0 for the first one).
+         */
+        [[nodiscard]] std::size_t smt_rank(const cpu_info& self) const
+        {
+            std::size_t rank = 0U;
+            for (const auto& cpu : m_cpus)
+            {
+                if ((cpu.core_id == self.core_id) && (cpu.logical_id < self.logical_id))
+                {
+                    ++rank;
+                }
+            }
+            return rank;
+        }
+
+        void compute_spread_order()
+        {
+            std::vector<std::size_t> ranks;
+            std::size_t max_rank = 0U;
+
+            ranks.reserve(m_cpus.size());
+            for (const auto& cpu : m_cpus)
+            {
+                ranks.push_back(smt_rank(cpu));
+                max_rank = (std::max)(max_rank, ranks.back());
+            }
+
+            for (std::size_t rank = 0U; rank <= max_rank; ++rank)
+            {
+                // per NUMA node queues of the CPUs of this rank, served round robin
+                std::map<int, std::vector<int>> by_node;
+                std::size_t remaining = 0U;
+
+                for (std::size_t index = 0U; index < m_cpus.size(); ++index)
+                {
+                    if (rank == ranks[index])
+                    {
+                        by_node[m_cpus[index].numa_node].push_back(m_cpus[index].logical_id);
+                        ++remaining;
+                    }
+                }
+
+                for (std::size_t position = 0U; remaining > 0U; ++position)
+                {
+                    for (const auto& node : by_node)
+                    {
+                        if (position < node.second.size())
+                        {
+                            m_spread_order.push_back(node.second[position]);
+                            --remaining;
+                        }
+                    }
+                }
+            }
+        }
+
+        void compute_pairs()
+        {
+            // within each cache domain, physical cores first (spread order), then their siblings
+            std::map<int, std::vector<int>> by_domain;
+
+            for (const int logical_id : m_spread_order)
+            {
+                by_domain[find(logical_id)->cache_domain].push_back(logical_id);
+            }
+
+            // successive pairs alternate cache domains
+            for (std::size_t index = 0U; index < m_cpus.size(); index += 2U)
+            {
+                for (const auto& domain : by_domain)
+                {
+                    if ((index + 1U) < domain.second.size())
+                    {
+                        m_pairs.push_back(cpu_pair { domain.second[index], domain.second[index + 1U] });
+                    }
+                }
+            }
+
+            if (m_pairs.empty())
+            {
+                // no cache domain holds two CPUs
+                const int second = m_spread_order[(m_spread_order.size() > 1U) ? 1U : 0U];
+                m_pairs.push_back(cpu_pair { m_spread_order[0U], second });
+            }
+        }
+
+        std::vector<cpu_info> m_cpus;
+        std::size_t m_physical_count = 1U;
+        std::size_t m_numa_node_count = 1U;
+        std::size_t m_cache_domain_count = 1U;
+        std::vector<int> m_spread_order;
+        std::vector<cpu_pair> m_pairs;
+    };
+}
+
+#endif //  CPU_TOPOLOGY_HPP_
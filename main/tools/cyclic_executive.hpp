@@ -0,0 +1,429 @@
+/**
+ * @file cyclic_executive.hpp
+ * @brief Multi-rate periodic scheduler hosting many routines in one task.
+ *
+ * This file contains the definition of the cyclic_executive class. Instead of one periodic_task per rate, the
+ * routines share one task driven by a frame table computed at construction: the minor frame is the greatest
+ * common divisor of the periods, the major frame their least common multiple, and each minor frame lists the
+ * routines released in it. The task wakes up once per minor frame.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(CYCLIC_EXECUTIVE_HPP_)
+#define CYCLIC_EXECUTIVE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/periodic_task_stats.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+#else
+#include "tools/linux/linux_sched_deadline.hpp"
+#endif
+
+namespace tools
+{
+    /**
+     * @brief A routine hosted by a cyclic_executive.
+     */
+    struct cyclic_routine
+    {
+        std::string name;                                             ///< Name of the routine, for the statistics.
+        std::chrono::duration<std::uint64_t, std::micro> period = {}; ///< Release period (must not be 0).
+        std::function<void()> routine;                                ///< The routine, called once per period.
+        std::chrono::duration<std::uint64_t, std::micro> budget = {}; ///< Execution budget, 0 for none.
+    };
+
+    /**
+     * @brief Statistics of one hosted routine, the durations being in microseconds.
+     */
+    struct cyclic_routine_stats
+    {
+        std::uint64_t calls = 0U;            ///< Number of calls.
+        std::uint64_t budget_overruns = 0U;  ///< Calls that exceeded the budget of the routine.
+        std::uint64_t max_execution_us = 0U; ///< Longest call.
+    };
+
+    /**
+     * @brief Construction parameters of a cyclic_executive.
+     */
+    struct cyclic_executive_params
+    {
+        std::string task_name = "cyclic_executive";     ///< Name of the task.
+        std::size_t stack_size = 4096U;                 ///< Stack size of the task.
+        int cpu_affinity = base_task::run_on_all_cores; ///< CPU affinity of the task.
+        int priority = base_task::default_priority;     ///< Priority of the task.
+        std::size_t max_frames = 4096U;                 ///< Largest accepted major/minor frame ratio.
+        bool earliest_deadline_scheduling = false;      ///< Run under SCHED_DEADLINE on Linux (root only).
+    };
+
+    /**
+     * @brief Multi-rate periodic scheduler dispatching routines from a precomputed minor frame table.
+     *
+     * Routines are released at the start of the minor frames that are multiples of their period and run in the
+     * order they were given. The wake-up lateness and the duration of each frame are recorded with the
+     * periodic_task statistics; a frame that ends after the start of the next one is an overrun of its slot,
+     * counted per frame index, and the frames already started are skipped to keep the phase, so the routines of
+     * the skipped frames miss that release. Each routine also counts the calls exceeding its own budget.
+     *
+     * The periods are best kept harmonic (each one a multiple of the shorter ones): the table then has one
+     * entry per release of the slowest routine. Periods giving more than max_frames minor frames per major
+     * frame are rejected, and the executive does not start (is_valid() returns false).
+     */
+    class cyclic_executive : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        cyclic_executive() = delete;
+
+        /**
+         * @brief Computes the frame table of the routines and starts the task.
+         *
+         * @param routines The routines to host.
+         * @param params The task parameters.
+         */
+        cyclic_executive(std::vector<cyclic_routine>&& routines, const cyclic_executive_params& params)
+            : m_routines(std::move(routines))
+            , m_earliest_deadline(params.earliest_deadline_scheduling)
+        {
+            if (!build_frame_table(params.max_frames))
+            {
+                return;
+            }
+
+            m_routine_stats = std::make_unique<routine_counters[]>(m_routines.size()); // NOLINT counter array
+            m_frame_overruns = std::make_unique<std::atomic<std::uint64_t>[]>(frame_count()); // NOLINT
+            m_task = std::make_unique<generic_task<cyclic_executive>>(
+                [this](const std::shared_ptr<cyclic_executive>&, const std::string&) { run_frames(); },
+                std::shared_ptr<cyclic_executive> {}, params.task_name, params.stack_size, params.cpu_affinity,
+                params.priority);
+        }
+
+        /**
+         * @brief Stops the task at the end of the current frame.
+         */
+        ~cyclic_executive()
+        {
+            m_stop.store(true);
+            m_wake.signal();
+            m_task.reset();
+        }
+
+        /**
+         * @brief Checks whether the frame table could be built and the task started.
+         *
+         * @return True if the routines are running.
+         */
+        [[nodiscard]] bool is_valid() const
+        {
+            return nullptr != m_task;
+        }
+
+        /**
+         * @brief Gets the minor frame, the greatest common divisor of the periods.
+         *
+         * @return The minor frame duration (0 if invalid).
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> minor_frame() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_minor_us);
+        }
+
+        /**
+         * @brief Gets the major frame, the least common multiple of the periods.
+         *
+         * @return The major frame duration (0 if invalid).
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> major_frame() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_minor_us * frame_count());
+        }
+
+        /**
+         * @brief Gets the number of minor frames in the major frame.
+         *
+         * @return The table size.
+         */
+        [[nodiscard]] std::size_t frame_count() const
+        {
+            return m_frame_offsets.empty() ? 0U : (m_frame_offsets.size() - 1U);
+        }
+
+        /**
+         * @brief Gets the routines released in a minor frame, as indices into the given routines.
+         *
+         * @param frame The minor frame index, below frame_count().
+         * @return The routine indices, in release order.
+         */
+        [[nodiscard]] std::vector<std::size_t> frame_routines(std::size_t frame) const
+        {
+            std::vector<std::size_t> indices;
+            if (frame < frame_count())
+            {
+                indices.assign(m_frame_entries.begin() + static_cast<std::ptrdiff_t>(m_frame_offsets[frame]),
+                    m_frame_entries.begin() + static_cast<std::ptrdiff_t>(m_frame_offsets[frame + 1U]));
+            }
+            return indices;
+        }
+
+        /**
+         * @brief Gets the statistics of the minor frames: wake-up lateness, frame duration and overruns.
+         *
+         * @return A snapshot of the frame statistics.
+         */
+        [[nodiscard]] periodic_task_stats frame_stats() const
+        {
+            return m_frame_stats.snapshot();
+        }
+
+        /**
+         * @brief Gets the number of overruns of one minor frame slot.
+         *
+         * @param frame The minor frame index, below frame_count().
+         * @return The overrun count of the slot.
+         */
+        [[nodiscard]] std::uint64_t frame_overruns(std::size_t frame) const
+        {
+            return (frame < frame_count()) ? m_frame_overruns[frame].load(std::memory_order_relaxed) : 0U;
+        }
+
+        /**
+         * @brief Gets the statistics of one routine.
+         *
+         * @param routine The routine index, in construction order.
+         * @return A snapshot of the routine statistics.
+         */
+        [[nodiscard]] cyclic_routine_stats routine_stats(std::size_t routine) const
+        {
+            cyclic_routine_stats stats;
+            if (is_valid() && (routine < m_routines.size()))
+            {
+                const auto& counters = m_routine_stats[routine];
+                stats.calls = counters.calls.load(std::memory_order_relaxed);
+                stats.budget_overruns = counters.budget_overruns.load(std::memory_order_relaxed);
+                stats.max_execution_us = counters.max_execution_us.load(std::memory_order_relaxed);
+            }
+            return stats;
+        }
+
+        /**
+         * @brief Checks whether the task runs under SCHED_DEADLINE.
+         *
+         * @return True once the task switched to earliest deadline scheduling.
+         */
+        [[nodiscard]] bool earliest_deadline_enabled() const
+        {
+            return m_earliest_deadline_enabled.load();
+        }
+
+    private:
+        struct routine_counters
+        {
+            std::atomic<std::uint64_t> calls = 0U;
+            std::atomic<std::uint64_t> budget_overruns = 0U;
+            std::atomic<std::uint64_t> max_execution_us = 0U;
+        };
+
+        bool build_frame_table(std::size_t max_frames)
+        {
+            std::uint64_t minor_us = 0U;
+            for (const auto& hosted : m_routines)
+            {
+                if ((0U == hosted.period.count()) || !hosted.routine)
+                {
+                    return false;
+                }
+                minor_us = std::gcd(minor_us, static_cast<std::uint64_t>(hosted.period.count()));
+            }
+            if (0U == minor_us)
+            {
+                return false;
+            }
+
+            std::uint64_t frames = 1U;
+            for (const auto& hosted : m_routines)
+            {
+                const std::uint64_t releases = static_cast<std::uint64_t>(hosted.period.count()) / minor_us;
+                frames = std::lcm(frames, releases);
+                if (frames > max_frames)
+                {
+                    return false;
+                }
+            }
+
+            m_frame_offsets.reserve(static_cast<std::size_t>(frames) + 1U);
+            for (std::uint64_t frame = 0U; frame < frames; ++frame)
+            {
+                m_frame_offsets.push_back(m_frame_entries.size());
+                for (std::size_t index = 0U; index < m_routines.size(); ++index)
+                {
+                    const auto releases = static_cast<std::uint64_t>(m_routines[index].period.count()) / minor_us;
+                    if (0U == (frame % releases))
+                    {
+                        m_frame_entries.push_back(index);
+                    }
+                }
+            }
+            m_frame_offsets.push_back(m_frame_entries.size());
+            m_minor_us = minor_us;
+            return true;
+        }
+
+        void run_frames()
+        {
+#if !defined(FREERTOS_PLATFORM)
+            if (m_earliest_deadline)
+            {
+                const std::chrono::duration<std::uint64_t, std::micro> minor(m_minor_us);
+                m_earliest_deadline_enabled.store(
+                    set_earliest_deadline_scheduling(std::chrono::high_resolution_clock::now(), minor));
+            }
+#endif
+            const std::size_t frames = frame_count();
+            std::size_t frame = 0U;
+            std::uint64_t frame_start = now_us();
+
+            while (!m_stop.load())
+            {
+                std::uint64_t current = wait_until(frame_start);
+                if (m_stop.load())
+                {
+                    break;
+                }
+                m_frame_stats.record_wakeup(current - frame_start);
+
+                const std::uint64_t wakeup = current;
+                for (std::size_t entry = m_frame_offsets[frame]; entry < m_frame_offsets[frame + 1U]; ++entry)
+                {
+                    current = run_routine(m_frame_entries[entry], current);
+                }
+                m_frame_stats.record_execution(current - wakeup);
+
+                const std::size_t slot = frame;
+                frame_start += m_minor_us;
+                frame = (frame + 1U) % frames;
+
+                if (current > frame_start)
+                {
+                    // the slot overran into the next frame: skip the frames already started, keeping the phase
+                    const std::uint64_t skipped = ((current - frame_start) / m_minor_us) + 1U;
+                    m_frame_overruns[slot].fetch_add(1U, std::memory_order_relaxed);
+                    m_frame_stats.record_overrun(skipped);
+                    frame_start += skipped * m_minor_us;
+                    frame = static_cast<std::size_t>((frame + skipped) % frames);
+                }
+            }
+        }
+
+        std::uint64_t run_routine(std::size_t index, std::uint64_t start)
+        {
+            m_routines[index].routine();
+
+            const std::uint64_t end = now_us();
+            const std::uint64_t duration = (end > start) ? (end - start) : 0U;
+            auto& counters = m_routine_stats[index];
+            counters.calls.fetch_add(1U, std::memory_order_relaxed);
+            if ((0U != m_routines[index].budget.count()) && (duration > m_routines[index].budget.count()))
+            {
+                counters.budget_overruns.fetch_add(1U, std::memory_order_relaxed);
+            }
+            if (duration > counters.max_execution_us.load(std::memory_order_relaxed))
+            {
+                counters.max_execution_us.store(duration, std::memory_order_relaxed);
+            }
+            return end;
+        }
+
+        std::uint64_t wait_until(std::uint64_t deadline)
+        {
+            std::uint64_t current = now_us();
+            while ((current < deadline) && !m_stop.load())
+            {
+                m_wake.wait_for_signal(std::chrono::duration<std::uint64_t, std::micro>(deadline - current));
+                current = now_us();
+            }
+            return current;
+        }
+
+        static std::uint64_t now_us()
+        {
+#if defined(FREERTOS_PLATFORM)
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#endif
+#else
+            const auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(since_epoch).count());
+#endif
+        }
+
+        std::vector<cyclic_routine> m_routines;
+        bool m_earliest_deadline;
+        std::uint64_t m_minor_us = 0U;
+        std::vector<std::size_t> m_frame_offsets; ///< Start of each minor frame in m_frame_entries, plus the end.
+        std::vector<std::size_t> m_frame_entries; ///< Routine indices released by each minor frame.
+
+        std::unique_ptr<routine_counters[]> m_routine_stats;           // NOLINT counter array
+        std::unique_ptr<std::atomic<std::uint64_t>[]> m_frame_overruns; // NOLINT counter array
+        periodic_task_stats_recorder m_frame_stats;
+        std::atomic_bool m_earliest_deadline_enabled = false;
+
+        std::atomic_bool m_stop = false;
+        light_event m_wake;
+        std::unique_ptr<generic_task<cyclic_executive>> m_task;
+    };
+}
+
+#endif //  CYCLIC_EXECUTIVE_HPP_
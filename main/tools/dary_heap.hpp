@@ -0,0 +1,337 @@
+/**
+ * @file dary_heap.hpp
+ * @brief A d-ary heap with bulk insertion and batch extraction.
+ *
+ * This file contains the definition of the dary_heap class, a drop-in alternative to std::priority_queue whose
+ * nodes have Arity children: the tree is shallower, so a push compares fewer levels, and the children of a node
+ * sit next to each other in memory. Large push_range() batches are merged with one bottom-up heapify instead of
+ * one sift per element. Usable as the Heap of sync_priority_queue.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DARY_HEAP_HPP_)
+#define DARY_HEAP_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tools
+{
+    /**
+     * @brief A d-ary max-heap ordered by Compare, with the std::priority_queue interface.
+     *
+     * As with std::priority_queue, top() is the element e for which Compare(e, x) is false for every other x:
+     * the largest with std::less, the smallest with std::greater.
+     *
+     * @tparam T The type of elements stored in the heap.
+     * @tparam Compare The comparison function object (default: std::less<T>).
+     * @tparam Arity The number of children per node, 2 or more (4 keeps a node's children in one cache line for
+     *         small T).
+     */
+    template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4U>
+    class dary_heap
+    {
+    public:
+        static_assert(Arity >= 2U, "dary_heap: Arity must be at least 2");
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using value_compare = Compare;
+        using container_type = std::vector<T>;
+
+        dary_heap() = default;
+        ~dary_heap() = default;
+        dary_heap(const dary_heap&) = default;
+        dary_heap& operator=(const dary_heap&) = default;
+        dary_heap(dary_heap&&) noexcept = default;
+        dary_heap& operator=(dary_heap&&) noexcept = default;
+
+        /**
+         * @brief Constructs an empty heap with a given comparator.
+         *
+         * @param compare The comparison function object.
+         */
+        explicit dary_heap(const Compare& compare)
+            : m_compare(compare)
+        {
+        }
+
+        /**
+         * @brief Checks if the heap is empty.
+         *
+         * @return true if the heap holds no element.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_nodes.empty();
+        }
+
+        /**
+         * @brief Returns the number of elements.
+         *
+         * @return The number of elements in the heap.
+         */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return m_nodes.size();
+        }
+
+        /**
+         * @brief Returns the highest priority element; the heap must not be empty.
+         *
+         * @return A reference to the top element.
+         */
+        [[nodiscard]] const T& top() const
+        {
+            return m_nodes.front();
+        }
+
+        /**
+         * @brief Reserves storage so that up to capacity elements are pushed without reallocating.
+         *
+         * @param capacity The number of elements to reserve room for.
+         */
+        void reserve(size_type capacity)
+        {
+            m_nodes.reserve(capacity);
+        }
+
+        /**
+         * @brief Removes every element, keeping the storage.
+         */
+        void clear() noexcept
+        {
+            m_nodes.clear();
+        }
+
+        /**
+         * @brief Inserts a copy of an element.
+         *
+         * @param elem The element to insert.
+         */
+        void push(const T& elem)
+        {
+            m_nodes.push_back(elem);
+            sift_up(m_nodes.size() - 1U);
+        }
+
+        /**
+         * @brief Inserts an element by move.
+         *
+         * @param elem The element to insert.
+         */
+        void push(T&& elem)
+        {
+            m_nodes.push_back(std::move(elem));
+            sift_up(m_nodes.size() - 1U);
+        }
+
+        /**
+         * @brief Constructs an element in place and inserts it.
+         *
+         * @tparam Args The constructor argument types.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args)
+        {
+            m_nodes.emplace_back(std::forward<Args>(args)...);
+            sift_up(m_nodes.size() - 1U);
+        }
+
+        /**
+         * @brief Inserts a batch of elements.
+         *
+         * The elements are appended first; the heap is then rebuilt bottom-up in O(n) when the batch would cost
+         * more in individual sifts, and each new element is sifted up otherwise.
+         *
+         * @tparam InputIt Input iterator type.
+         * @tparam Sentinel End marker type, InputIt for an iterator pair.
+         * @param first Begin iterator.
+         * @param last End iterator or sentinel.
+         */
+        template <typename InputIt, typename Sentinel>
+        void push_range(InputIt first, Sentinel last)
+        {
+            const size_type old_size = m_nodes.size();
+            for (; first != last; ++first)
+            {
+                m_nodes.emplace_back(*first);
+            }
+
+            const size_type added = m_nodes.size() - old_size;
+            if (added * depth(m_nodes.size()) > m_nodes.size())
+            {
+                heapify();
+            }
+            else
+            {
+                for (size_type index = old_size; index < m_nodes.size(); ++index)
+                {
+                    sift_up(index);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes the top element; the heap must not be empty.
+         */
+        void pop()
+        {
+            if (m_nodes.size() > 1U)
+            {
+                T last = std::move(m_nodes.back());
+                m_nodes.pop_back();
+                sift_down(0U, std::move(last));
+            }
+            else
+            {
+                m_nodes.pop_back();
+            }
+        }
+
+        /**
+         * @brief Moves the top element out and removes it; the heap must not be empty.
+         *
+         * @return The former top element.
+         */
+        [[nodiscard]] T pop_move()
+        {
+            T item = std::move(m_nodes.front());
+            pop();
+            return item;
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of elements out, in priority order.
+         *
+         * Each extraction costs O(Arity * log_Arity(n)) moves and compares, so a batch of k costs O(k log n).
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of elements extracted.
+         */
+        template <typename OutputIt>
+        std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            std::size_t popped_count = 0U;
+            for (; (first != last) && !m_nodes.empty(); ++first)
+            {
+                *first = pop_move();
+                ++popped_count;
+            }
+            return popped_count;
+        }
+
+    private:
+        static size_type depth(size_type count)
+        {
+            size_type levels = 1U;
+            for (size_type span = Arity; span < count; span *= Arity)
+            {
+                ++levels;
+            }
+            return levels;
+        }
+
+        void sift_up(size_type index)
+        {
+            T moving = std::move(m_nodes[index]);
+            while (index > 0U)
+            {
+                const size_type parent = (index - 1U) / Arity;
+                if (!m_compare(m_nodes[parent], moving))
+                {
+                    break;
+                }
+                m_nodes[index] = std::move(m_nodes[parent]);
+                index = parent;
+            }
+            m_nodes[index] = std::move(moving);
+        }
+
+        void sift_down(size_type index, T moving)
+        {
+            const size_type count = m_nodes.size();
+            for (;;)
+            {
+                const size_type first_child = (index * Arity) + 1U;
+                if (first_child >= count)
+                {
+                    break;
+                }
+
+                const size_type last_child = (first_child + Arity < count) ? (first_child + Arity) : count;
+                size_type best = first_child;
+                for (size_type child = first_child + 1U; child < last_child; ++child)
+                {
+                    if (m_compare(m_nodes[best], m_nodes[child]))
+                    {
+                        best = child;
+                    }
+                }
+
+                if (!m_compare(moving, m_nodes[best]))
+                {
+                    break;
+                }
+                m_nodes[index] = std::move(m_nodes[best]);
+                index = best;
+            }
+            m_nodes[index] = std::move(moving);
+        }
+
+        void heapify()
+        {
+            const size_type count = m_nodes.size();
+            if (count < 2U)
+            {
+                return;
+            }
+            for (size_type index = ((count - 2U) / Arity) + 1U; index > 0U; --index)
+            {
+                T moving = std::move(m_nodes[index - 1U]);
+                sift_down(index - 1U, std::move(moving));
+            }
+        }
+
+        container_type m_nodes;
+        Compare m_compare {};
+    };
+}
+
+#endif //  DARY_HEAP_HPP_
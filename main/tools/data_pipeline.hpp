@@ -0,0 +1,424 @@
+/**
+ * @file data_pipeline.hpp
+ * @brief Pipeline of data_task stages connected by bounded queues, with short stages fused into their upstream task.
+ *
+ * Chaining data_tasks by hand (parse, filter, aggregate, publish) costs a queue push, a lock and a context switch
+ * per hop even when a stage is a few instructions long. The builder connects typed stages, runs a stage marked
+ * fusible inline on the task before it, and every stage counts its throughput, its refused items and its backlog.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DATA_PIPELINE_HPP_)
+#define DATA_PIPELINE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/data_task.hpp"
+#include "tools/data_task_queue.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Placement of one stage of a data_pipeline.
+     */
+    struct pipeline_stage_params
+    {
+        std::size_t queue_depth = 64U; ///< Depth of the bounded queue in front of a queued stage.
+        bool fusible = false;          ///< Runs inline on the upstream task (or the submitting thread) instead.
+        /** @brief What a full queue does with a new item; block applies backpressure to the upstream stage. */
+        data_task_overflow_policy overflow_policy = data_task_overflow_policy::drop_newest;
+        std::size_t stack_size = 4096U;
+        int cpu_affinity = base_task::run_on_all_cores;
+        int priority = base_task::default_priority;
+
+        /**
+         * @brief Parameters of a stage fused into its upstream task.
+         *
+         * @return The parameters.
+         */
+        static pipeline_stage_params fused()
+        {
+            pipeline_stage_params params;
+            params.fusible = true;
+            return params;
+        }
+    };
+
+    /**
+     * @brief Snapshot of the counters of one data_pipeline stage.
+     */
+    struct pipeline_stage_stats
+    {
+        std::string name;             ///< Stage name, also the name of its task when queued.
+        bool fused = false;           ///< The stage runs inline on its upstream task.
+        std::uint64_t processed = 0U; ///< Items handed to the stage function.
+        std::uint64_t forwarded = 0U; ///< Items the stage function passed downstream.
+        std::uint64_t rejected = 0U;  ///< Items refused by the full queue of the stage (overflow_policy).
+        std::size_t backlog = 0U;     ///< Items waiting in the queue of the stage, 0 when fused.
+        double items_per_second = 0.; ///< processed over the lifetime of the pipeline.
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Type-erased stage owned by a data_pipeline.
+         */
+        class pipeline_stage_base : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            pipeline_stage_base(std::string name, bool fused)
+                : m_name(std::move(name))
+                , m_fused(fused)
+            {
+            }
+
+            virtual ~pipeline_stage_base() = default;
+
+            /**
+             * @brief Stops the task of the stage after it processed its queue, so that nothing is lost.
+             */
+            virtual void stop() = 0;
+
+            [[nodiscard]] virtual std::size_t backlog() const = 0;
+
+            [[nodiscard]] pipeline_stage_stats stats(double uptime_seconds) const
+            {
+                pipeline_stage_stats stats;
+                stats.name = m_name;
+                stats.fused = m_fused;
+                stats.processed = m_processed.load(std::memory_order_relaxed);
+                stats.forwarded = m_forwarded.load(std::memory_order_relaxed);
+                stats.rejected = m_rejected.load(std::memory_order_relaxed);
+                stats.backlog = backlog();
+                stats.items_per_second
+                    = (uptime_seconds > 0.) ? (static_cast<double>(stats.processed) / uptime_seconds) : 0.;
+                return stats;
+            }
+
+        protected:
+            std::string m_name;
+            bool m_fused;
+            std::atomic<std::uint64_t> m_processed { 0U };
+            std::atomic<std::uint64_t> m_forwarded { 0U };
+            std::atomic<std::uint64_t> m_rejected { 0U };
+        };
+
+        /**
+         * @brief Stage turning an In item into zero or one Out item handed to the next stage.
+         */
+        template <typename In, typename Out>
+        class pipeline_stage : public pipeline_stage_base // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            using transform_function = std::function<bool(const In& input, Out& output)>;
+            using entry_function = std::function<bool(const Out& item)>;
+
+            pipeline_stage(std::string name, bool fused, transform_function transform)
+                : pipeline_stage_base(std::move(name), fused)
+                , m_transform(std::move(transform))
+            {
+            }
+
+            /**
+             * @brief Runs the stage function on an item and hands its output, if any, to the next stage.
+             *
+             * @param input The item.
+             */
+            void process(const In& input)
+            {
+                m_processed.fetch_add(1U, std::memory_order_relaxed);
+                Out output {};
+                if (m_transform(input, output))
+                {
+                    m_forwarded.fetch_add(1U, std::memory_order_relaxed);
+                    if (m_next)
+                    {
+                        static_cast<void>(m_next(output));
+                    }
+                }
+            }
+
+            /**
+             * @brief Gets the slot receiving the entry point of the next stage.
+             *
+             * @return The entry slot.
+             */
+            entry_function& next()
+            {
+                return m_next;
+            }
+
+            /**
+             * @brief Gives the stage its own task and bounded queue.
+             *
+             * @param params The queue depth and task placement.
+             * @param self The stage, shared with the task as its context.
+             */
+            void attach_task(const pipeline_stage_params& params, const std::shared_ptr<pipeline_stage>& self)
+            {
+                m_task = std::make_unique<data_task<pipeline_stage, In>>(
+                    [](const std::shared_ptr<pipeline_stage>& /*stage*/, const std::string& /*task_name*/) {},
+                    [](const std::shared_ptr<pipeline_stage>& stage, const In& input, const std::string& /*task_name*/)
+                    { stage->process(input); },
+                    self, params.queue_depth, m_name, params.stack_size, params.cpu_affinity, params.priority,
+                    // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
+                    (std::chrono::duration<std::uint64_t, std::micro>::max)());
+                m_task->set_overflow_policy(params.overflow_policy);
+            }
+
+            /**
+             * @brief Entry point of the stage: a queue push when it has a task, an inline call when fused.
+             *
+             * @param input The item.
+             * @return false if the queue of the stage refused the item.
+             */
+            bool enter(const In& input)
+            {
+                if (!m_task)
+                {
+                    process(input);
+                    return true;
+                }
+                if (m_task->submit(input))
+                {
+                    return true;
+                }
+                m_rejected.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+
+            void stop() override
+            {
+                // the task holds the stage as its context: releasing the task breaks the cycle
+                m_task.reset();
+            }
+
+            [[nodiscard]] std::size_t backlog() const override
+            {
+                return m_task ? m_task->queue_depth() : 0U;
+            }
+
+        private:
+            transform_function m_transform;
+            entry_function m_next;
+            std::unique_ptr<data_task<pipeline_stage, In>> m_task;
+        };
+    }
+
+    template <typename Source, typename Tail>
+    class data_pipeline_builder;
+
+    /**
+     * @brief Chain of processing stages fed with Source items, each stage on its own data_task or fused.
+     *
+     * A queued stage has its own task and bounded queue; a fusible stage runs inline on the task of the stage
+     * before it (the submitting thread for a first stage), so that short stages cost a function call instead of
+     * a queue push and a thread hop. Items refused by a full queue are counted on the refusing stage. The
+     * pipeline is built by data_pipeline_builder and stopped from the source to the sink on destruction, each
+     * queued stage processing its queue first.
+     *
+     * @tparam Source The type of the items submitted to the pipeline.
+     */
+    template <typename Source>
+    class data_pipeline : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        ~data_pipeline()
+        {
+            for (auto& stage : m_stages)
+            {
+                stage->stop();
+            }
+        }
+
+        /**
+         * @brief Feeds an item to the first stage.
+         *
+         * @param item The item.
+         * @return false if the first stage is queued and its queue refused the item.
+         */
+        bool submit(const Source& item)
+        {
+            return m_entry ? m_entry(item) : false;
+        }
+
+        /**
+         * @brief Gets the number of stages.
+         *
+         * @return The stage count.
+         */
+        [[nodiscard]] std::size_t stage_count() const
+        {
+            return m_stages.size();
+        }
+
+        /**
+         * @brief Takes a snapshot of the counters of every stage.
+         *
+         * @return The stage statistics, from the source to the sink.
+         */
+        [[nodiscard]] std::vector<pipeline_stage_stats> stats() const
+        {
+            const double uptime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+            std::vector<pipeline_stage_stats> all_stats;
+            all_stats.reserve(m_stages.size());
+            for (const auto& stage : m_stages)
+            {
+                all_stats.push_back(stage->stats(uptime));
+            }
+            return all_stats;
+        }
+
+    private:
+        template <typename S, typename T>
+        friend class data_pipeline_builder;
+
+        data_pipeline() = default;
+
+        std::function<bool(const Source&)> m_entry;
+        std::vector<std::shared_ptr<detail::pipeline_stage_base>> m_stages;
+        std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+    };
+
+    /**
+     * @brief Builds a data_pipeline stage by stage, from the source to the sink.
+     *
+     * @code
+     * auto pipeline = tools::data_pipeline_builder<raw_frame>()
+     *                     .stage<sample>("parse", parse_frame)
+     *                     .stage<sample>("filter", drop_outliers, tools::pipeline_stage_params::fused())
+     *                     .sink("publish", publish_sample, { 32U })
+     *                     .build();
+     * @endcode
+     *
+     * @tparam Source The type of the items submitted to the pipeline.
+     * @tparam Tail The output type of the last stage added.
+     */
+    template <typename Source, typename Tail = Source>
+    class data_pipeline_builder
+    {
+    public:
+        data_pipeline_builder()
+            : m_pipeline(new data_pipeline<Source>())
+            , m_tail(&m_pipeline->m_entry)
+        {
+        }
+
+        /**
+         * @brief Appends a stage turning each Tail item into zero or one Out item.
+         *
+         * Tail must be trivial and standard layout, as any data_task data, even for a fused stage.
+         *
+         * @tparam Out The output type of the stage.
+         * @param name The stage name, also the name of its task when queued.
+         * @param transform Callable `bool(const Tail& input, Out& output)` returning true to forward output.
+         * @param params The queue and task of the stage, or pipeline_stage_params::fused().
+         * @return The builder of the extended pipeline.
+         */
+        template <typename Out, typename Transform>
+        data_pipeline_builder<Source, Out> stage(
+            const std::string& name, Transform&& transform, const pipeline_stage_params& params = {}) &&
+        {
+            using stage_type = detail::pipeline_stage<Tail, Out>;
+            auto stage = std::make_shared<stage_type>(
+                name, params.fusible, typename stage_type::transform_function(std::forward<Transform>(transform)));
+            if (!params.fusible)
+            {
+                stage->attach_task(params, stage);
+            }
+
+            stage_type* raw_stage = stage.get();
+            *m_tail = [raw_stage](const Tail& item) { return raw_stage->enter(item); };
+            m_pipeline->m_stages.push_back(stage);
+
+            return data_pipeline_builder<Source, Out>(std::move(m_pipeline), &raw_stage->next());
+        }
+
+        /**
+         * @brief Appends the last stage, consuming each Tail item.
+         *
+         * @param name The stage name, also the name of its task when queued.
+         * @param consume Callable `void(const Tail& item)`.
+         * @param params The queue and task of the stage, or pipeline_stage_params::fused().
+         * @return The builder of the extended pipeline.
+         */
+        template <typename Consume>
+        data_pipeline_builder<Source, Tail> sink(
+            const std::string& name, Consume&& consume, const pipeline_stage_params& params = {}) &&
+        {
+            return std::move(*this).template stage<Tail>(name,
+                [consumer = std::forward<Consume>(consume)](const Tail& item, Tail& /*output*/)
+                {
+                    consumer(item);
+                    return false;
+                },
+                params);
+        }
+
+        /**
+         * @brief Hands over the pipeline, ready to take items.
+         *
+         * @return The pipeline.
+         */
+        std::unique_ptr<data_pipeline<Source>> build() &&
+        {
+            m_pipeline->m_start = std::chrono::steady_clock::now();
+            return std::move(m_pipeline);
+        }
+
+    private:
+        template <typename S, typename T>
+        friend class data_pipeline_builder;
+
+        data_pipeline_builder(std::unique_ptr<data_pipeline<Source>> pipeline, std::function<bool(const Tail&)>* tail)
+            : m_pipeline(std::move(pipeline))
+            , m_tail(tail)
+        {
+        }
+
+        std::unique_ptr<data_pipeline<Source>> m_pipeline;
+        std::function<bool(const Tail&)>* m_tail;
+    };
+}
+
+#endif // DATA_PIPELINE_HPP_
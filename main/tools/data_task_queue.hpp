@@ -0,0 +1,363 @@
+/**
+ * @file data_task_queue.hpp
+ * @brief Queue policies selecting the storage behind data_task submissions.
+ *
+ * This file contains the data_task_default_queue and data_task_spsc_queue policies, the spsc_data_queue
+ * adapter exposing a lock_free_ring_buffer through the queue interface data_task relies on, the overflow
+ * policies and counters applied by data_task::submit() when the queue is full, and the busy-poll counters.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DATA_TASK_QUEUE_HPP_)
+#define DATA_TASK_QUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "tools/lock_free_ring_buffer.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief What data_task::submit() does when the data queue is full.
+     */
+    enum class data_task_overflow_policy : unsigned char
+    {
+        block,       ///< Wait for room up to the block timeout, then reject the data.
+        drop_newest, ///< Discard the submitted data.
+        drop_oldest, ///< Discard the oldest queued data to make room (drop_newest with lock-free queues).
+        fail         ///< Reject the data, the caller is expected to check the submit() status.
+    };
+
+    /**
+     * @brief Snapshot of the data_task overflow counters.
+     */
+    struct data_task_overflow_stats
+    {
+        std::uint32_t dropped_newest = 0U;           ///< Submissions discarded by drop_newest.
+        std::uint32_t dropped_oldest = 0U;           ///< Queued items discarded by drop_oldest.
+        std::uint32_t rejected = 0U;                 ///< Submissions refused by fail or by an expired block timeout.
+        std::uint32_t blocked = 0U;                  ///< Submissions that had to wait for room.
+        std::chrono::microseconds blocked_time = {}; ///< Total time producers spent waiting for room.
+    };
+
+    /**
+     * @brief Snapshot of the data_task busy-poll counters (see data_task::set_busy_poll()).
+     */
+    struct data_task_busy_poll_stats
+    {
+        std::uint32_t spin_wakeups = 0U;          ///< Waits that found data while spinning, with no context switch.
+        std::uint32_t parked_wakeups = 0U;        ///< Waits that spun for the whole window, then blocked.
+        std::chrono::microseconds spin_time = {}; ///< Total time the task spent spinning.
+    };
+
+    /**
+     * @brief Default data_task queue policy.
+     *
+     * Multi-producer safe: a mutex protected sync_ring_vector on standard platforms, a FreeRTOS queue otherwise.
+     */
+    struct data_task_default_queue
+    {
+        static constexpr bool lock_free = false;
+    };
+
+    /**
+     * @brief Single-producer/single-consumer data_task queue policy backed by lock_free_ring_buffer.
+     *
+     * submit()/isr_submit() and the task drain take no lock. Only one producer may submit at a time, the queue
+     * holds (2^Pow2 - 1) items whatever the data_queue_depth given to data_task, and DataType must fit the
+     * lock_free_ring_buffer constraints (scalar or pointer).
+     *
+     * @tparam Pow2 The power of 2 of the ring buffer size.
+     */
+    template <std::size_t Pow2>
+    struct data_task_spsc_queue
+    {
+        static constexpr bool lock_free = true;
+        static constexpr std::size_t capacity_pow2 = Pow2;
+    };
+
+    /**
+     * @brief Adapter giving a lock_free_ring_buffer the queue interface used by data_task.
+     *
+     * @tparam T The type of the elements.
+     * @tparam Pow2 The power of 2 of the ring buffer size.
+     */
+    template <typename T, std::size_t Pow2>
+    class spsc_data_queue : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        spsc_data_queue() = default;
+        ~spsc_data_queue() = default;
+
+        /**
+         * @brief Constructs the queue, the depth is fixed at compile time by Pow2.
+         *
+         * @param depth Ignored, kept for interface compatibility with sync_ring_vector.
+         */
+        explicit spsc_data_queue(std::size_t depth)
+        {
+            (void)depth;
+        }
+
+        /**
+         * @brief Pushes an element, producer side only.
+         *
+         * @param elem The element to push.
+         * @return true if pushed, false if the queue is full.
+         */
+        bool push(const T& elem)
+        {
+            return m_ring_buffer.push(elem);
+        }
+
+        /**
+         * @brief Pops the oldest element, consumer side only.
+         *
+         * @return The element, or std::nullopt if the queue is empty.
+         */
+        [[nodiscard]] std::optional<T> front_pop()
+        {
+            return m_ring_buffer.pop_opt();
+        }
+
+        /**
+         * @brief Pops a batch of elements into an output range, consumer side only.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The effective number of elements extracted.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            return m_ring_buffer.pop_range(first, last);
+        }
+
+        /**
+         * @brief Tells whether the queue holds no element, consumer side only.
+         *
+         * @return true if the queue is empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return m_ring_buffer.empty();
+        }
+
+        /**
+         * @brief Returns the number of queued elements, a snapshot outside the consumer.
+         *
+         * @return The queue depth.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_ring_buffer.size();
+        }
+
+        /**
+         * @brief Get the maximum number of elements the queue can hold.
+         *
+         * @return The usable capacity (one slot stays empty).
+         */
+        [[nodiscard]] constexpr std::size_t capacity() const
+        {
+            return m_ring_buffer.capacity() - 1U;
+        }
+
+    private:
+        tools::lock_free_ring_buffer<T, Pow2> m_ring_buffer;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Overflow counters of a data_task, updated by producers and read by anyone.
+         */
+        class data_task_overflow_counters : public non_copyable // NOLINT inherits from non copyable and non movable
+        {
+        public:
+            data_task_overflow_counters() = default;
+            ~data_task_overflow_counters() = default;
+
+            void on_dropped_newest()
+            {
+                m_dropped_newest.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            void on_dropped_oldest()
+            {
+                m_dropped_oldest.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            void on_rejected()
+            {
+                m_rejected.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            void on_blocked(std::uint64_t blocked_us)
+            {
+                m_blocked.fetch_add(1U, std::memory_order_relaxed);
+                m_blocked_us.fetch_add(blocked_us, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] data_task_overflow_stats snapshot() const
+            {
+                data_task_overflow_stats stats;
+                stats.dropped_newest = m_dropped_newest.load(std::memory_order_relaxed);
+                stats.dropped_oldest = m_dropped_oldest.load(std::memory_order_relaxed);
+                stats.rejected = m_rejected.load(std::memory_order_relaxed);
+                stats.blocked = m_blocked.load(std::memory_order_relaxed);
+                stats.blocked_time = std::chrono::microseconds(m_blocked_us.load(std::memory_order_relaxed));
+                return stats;
+            }
+
+            void reset()
+            {
+                m_dropped_newest.store(0U, std::memory_order_relaxed);
+                m_dropped_oldest.store(0U, std::memory_order_relaxed);
+                m_rejected.store(0U, std::memory_order_relaxed);
+                m_blocked.store(0U, std::memory_order_relaxed);
+                m_blocked_us.store(0U, std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<std::uint32_t> m_dropped_newest = 0U;
+            std::atomic<std::uint32_t> m_dropped_oldest = 0U;
+            std::atomic<std::uint32_t> m_rejected = 0U;
+            std::atomic<std::uint32_t> m_blocked = 0U;
+            std::atomic<std::uint64_t> m_blocked_us = 0U;
+        };
+
+        /**
+         * @brief Busy-poll counters of a data_task, updated by the task and read by anyone.
+         */
+        class data_task_busy_poll_counters : public non_copyable // NOLINT inherits from non copyable and non movable
+        {
+        public:
+            data_task_busy_poll_counters() = default;
+            ~data_task_busy_poll_counters() = default;
+
+            void on_spin(bool found_data, std::uint64_t spin_us)
+            {
+                if (found_data)
+                {
+                    m_spin_wakeups.fetch_add(1U, std::memory_order_relaxed);
+                }
+                else
+                {
+                    m_parked_wakeups.fetch_add(1U, std::memory_order_relaxed);
+                }
+                m_spin_us.fetch_add(spin_us, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] data_task_busy_poll_stats snapshot() const
+            {
+                data_task_busy_poll_stats stats;
+                stats.spin_wakeups = m_spin_wakeups.load(std::memory_order_relaxed);
+                stats.parked_wakeups = m_parked_wakeups.load(std::memory_order_relaxed);
+                stats.spin_time = std::chrono::microseconds(m_spin_us.load(std::memory_order_relaxed));
+                return stats;
+            }
+
+            void reset()
+            {
+                m_spin_wakeups.store(0U, std::memory_order_relaxed);
+                m_parked_wakeups.store(0U, std::memory_order_relaxed);
+                m_spin_us.store(0U, std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<std::uint32_t> m_spin_wakeups = 0U;
+            std::atomic<std::uint32_t> m_parked_wakeups = 0U;
+            std::atomic<std::uint64_t> m_spin_us = 0U;
+        };
+
+        /**
+         * @brief Placeholder queue for backends that do not need a secondary queue with the default policy.
+         *
+         * It never holds anything, so that code paths discarded by the queue policy still compile.
+         *
+         * @tparam T The type of the elements.
+         */
+        template <typename T>
+        struct data_task_no_queue
+        {
+            explicit data_task_no_queue(std::size_t /*depth*/)
+            {
+            }
+
+            bool push(const T& /*elem*/)
+            {
+                return false;
+            }
+
+            [[nodiscard]] std::optional<T> front_pop()
+            {
+                return std::nullopt;
+            }
+
+            template <typename OutputIt>
+            [[nodiscard]] std::size_t pop_range(OutputIt /*first*/, OutputIt /*last*/)
+            {
+                return 0U;
+            }
+        };
+
+        /**
+         * @brief Selects the queue type of a data_task from its queue policy.
+         *
+         * @tparam QueuePolicy data_task_default_queue or data_task_spsc_queue<Pow2>.
+         * @tparam T The type of the elements.
+         * @tparam DefaultQueue The backend specific type used by data_task_default_queue.
+         */
+        template <typename QueuePolicy, typename T, typename DefaultQueue, typename = void>
+        struct data_task_queue_selector
+        {
+            using type = DefaultQueue;
+        };
+
+        template <typename QueuePolicy, typename T, typename DefaultQueue>
+        struct data_task_queue_selector<QueuePolicy, T, DefaultQueue,
+            typename std::enable_if<QueuePolicy::lock_free>::type>
+        {
+            using type = spsc_data_queue<T, QueuePolicy::capacity_pow2>;
+        };
+    } // namespace detail
+}
+
+#endif //  DATA_TASK_QUEUE_HPP_
@@ -0,0 +1,229 @@
+/**
+ * @file data_waiters.hpp
+ * @brief Wait-for-data support shared by the locked sync containers.
+ *
+ * @author Laurent Lardinois
+ *
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DATA_WAITERS_HPP_)
+#define DATA_WAITERS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/wait_set.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Parks consumers of a locked container until a producer adds data.
+     *
+     * The container embeds one instance. Its push functions declare a scoped_notify (or scoped_isr_notify)
+     * before taking their lock, so that the event is signaled once the lock is released, and only when a
+     * consumer is parked: without waiters a push costs one relaxed load. Its wait_pop functions call
+     * wait_take(), which registers the consumer under the container lock before it sleeps, so a push cannot
+     * slip between the empty check and the wait.
+     *
+     * A consumer task serving several containers registers them with a wait_set through ready_hook() instead,
+     * the push functions then also notifying it.
+     *
+     * Signals of the auto-reset event coalesce; a consumer that takes data while more is queued and other
+     * consumers are parked passes the signal on, so every parked consumer facing data is eventually woken.
+     */
+    class data_waiters : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        data_waiters() = default;
+        ~data_waiters() = default;
+
+        /**
+         * @brief Signals parked consumers, if any, when it goes out of scope.
+         */
+        class scoped_notify : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            /**
+             * @brief Binds to the waiters of a container; declare it before the container lock guard.
+             * @param waiters The waiters of the container.
+             */
+            explicit scoped_notify(data_waiters& waiters)
+                : m_waiters(waiters)
+            {
+            }
+
+            /**
+             * @brief Wakes a parked consumer, after the container lock guard has been released.
+             */
+            ~scoped_notify()
+            {
+                if (m_waiters.waiting())
+                {
+                    m_waiters.m_event.signal();
+                }
+                m_waiters.m_ready_hook.notify();
+            }
+
+        private:
+            data_waiters& m_waiters;
+        };
+
+        /**
+         * @brief ISR flavor of scoped_notify.
+         */
+        class scoped_isr_notify : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            /**
+             * @brief Binds to the waiters of a container; declare it before the container ISR lock guard.
+             * @param waiters The waiters of the container.
+             */
+            explicit scoped_isr_notify(data_waiters& waiters)
+                : m_waiters(waiters)
+            {
+            }
+
+            /**
+             * @brief Wakes a parked consumer from the ISR, after the container lock guard has been released.
+             */
+            ~scoped_isr_notify()
+            {
+                if (m_waiters.waiting())
+                {
+                    m_waiters.m_event.isr_signal();
+                }
+                m_waiters.m_ready_hook.isr_notify();
+            }
+
+        private:
+            data_waiters& m_waiters;
+        };
+
+        /**
+         * @brief Gets the hook registering the container with a wait_set.
+         * @return The hook, notified by every push.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
+        /**
+         * @brief Tells whether a consumer is parked or about to park.
+         * @return true if at least one consumer waits for data.
+         */
+        [[nodiscard]] bool waiting() const
+        {
+            return 0U != m_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Takes data from a container, waiting up to a timeout for some to arrive.
+         *
+         * take and has_data run under the container lock. take returns the data (a std::optional or a count)
+         * and converts to false when the container was empty.
+         *
+         * @tparam Lock The container lock type.
+         * @tparam Take Callable taking the data, returning a default-constructible result testable as bool.
+         * @tparam HasData Callable telling whether the container still holds data.
+         * @param lock The container lock.
+         * @param timeout The maximum duration to wait for data.
+         * @param take Takes the data.
+         * @param has_data Tells whether data remains after take.
+         * @return The result of the first successful take, or of the last attempt when the timeout expires.
+         */
+        template <typename Lock, typename Take, typename HasData>
+        auto wait_take(Lock& lock, const std::chrono::duration<std::uint64_t, std::micro>& timeout, Take&& take,
+            HasData&& has_data)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            bool registered = false;
+            bool pass_on = false;
+            decltype(take()) result {};
+
+            for (;;)
+            {
+                std::uint64_t remaining_us = 0U;
+                {
+                    std::scoped_lock<Lock> guard(lock);
+                    result = take();
+                    remaining_us = remaining(start, timeout);
+                    if (static_cast<bool>(result) || (0U == remaining_us))
+                    {
+                        if (registered)
+                        {
+                            m_count.fetch_sub(1U, std::memory_order_relaxed);
+                        }
+                        pass_on = static_cast<bool>(result) && waiting() && has_data();
+                        break;
+                    }
+
+                    if (!registered)
+                    {
+                        m_count.fetch_add(1U, std::memory_order_relaxed);
+                        registered = true;
+                    }
+                }
+
+                m_event.wait_for_signal(std::chrono::duration<std::uint64_t, std::micro>(remaining_us));
+            }
+
+            if (pass_on)
+            {
+                m_event.signal();
+            }
+            return result;
+        }
+
+    private:
+        static std::uint64_t remaining(const std::chrono::steady_clock::time_point& start,
+            const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            const auto elapsed_us = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                    .count());
+            return (elapsed_us >= timeout.count()) ? 0U : (timeout.count() - elapsed_us);
+        }
+
+        // modified under the container lock, read without it by the push side
+        std::atomic<std::size_t> m_count { 0U };
+        light_event m_event;
+        wait_set_hook m_ready_hook;
+    };
+}
+
+#endif //  DATA_WAITERS_HPP_
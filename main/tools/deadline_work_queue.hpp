@@ -0,0 +1,204 @@
+/**
+ * @file deadline_work_queue.hpp
+ * @brief Thread-safe earliest-deadline-first queue that drops the items whose deadline has passed.
+ *
+ * This file contains the definition of the deadline_work_queue class, the earliest-deadline-first lane of
+ * worker_task. Items are ordered by an absolute deadline in microseconds, ties in arrival order, in a dary_heap;
+ * pop() skips and counts the items that can no longer start in time, so under overload the remaining ones still
+ * meet their deadline instead of all of them being late.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DEADLINE_WORK_QUEUE_HPP_)
+#define DEADLINE_WORK_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "tools/critical_section.hpp"
+#include "tools/dary_heap.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Thread-safe queue served earliest deadline first, dropping expired items.
+     *
+     * @tparam T The type of the queued items, possibly move-only.
+     */
+    template <typename T>
+    class deadline_work_queue : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        deadline_work_queue() = default;
+        ~deadline_work_queue() = default;
+
+        /**
+         * @brief Queues an item.
+         *
+         * @param deadline_us The latest start time of the item, on the clock later given to pop().
+         * @param item The item.
+         */
+        void push(std::uint64_t deadline_us, T&& item)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_heap.push(entry { deadline_us, m_sequence++, std::move(item) });
+        }
+
+        /**
+         * @brief Removes the item with the earliest deadline still ahead.
+         *
+         * The items whose deadline is before now_us are discarded on the way and counted as missed; they are
+         * destroyed outside the lock.
+         *
+         * @param now_us The current time, on the clock of the deadlines.
+         * @return The item, or nothing once the queue holds no item that can still start in time.
+         */
+        std::optional<T> pop(std::uint64_t now_us)
+        {
+            while (true)
+            {
+                std::optional<entry> earliest = pop_entry();
+                if (!earliest.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                if (earliest->deadline_us >= now_us)
+                {
+                    return std::optional<T>(std::move(earliest->item));
+                }
+
+                m_missed_count.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Removes the item with the earliest deadline, expired or not.
+         *
+         * @return The item, or nothing if the queue is empty.
+         */
+        std::optional<T> pop_any()
+        {
+            std::optional<entry> earliest = pop_entry();
+            if (!earliest.has_value())
+            {
+                return std::nullopt;
+            }
+            return std::optional<T>(std::move(earliest->item));
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @return true if nothing is queued.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_heap.empty();
+        }
+
+        /**
+         * @brief Retrieves the number of queued items, expired ones included until pop() drops them.
+         *
+         * @return The number of queued items.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_heap.size();
+        }
+
+        /**
+         * @brief Retrieves the number of items dropped because their deadline had passed.
+         *
+         * @return The missed deadline count.
+         */
+        [[nodiscard]] std::size_t missed_count() const noexcept
+        {
+            return m_missed_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Preallocates room for a number of items.
+         *
+         * @param capacity The number of items the queue holds without allocating.
+         */
+        void reserve(std::size_t capacity)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_heap.reserve(capacity);
+        }
+
+    private:
+        struct entry
+        {
+            std::uint64_t deadline_us;
+            std::uint64_t sequence;
+            T item;
+        };
+
+        /**
+         * @brief Orders the heap so that its top is the earliest deadline, then the oldest item.
+         */
+        struct later_deadline
+        {
+            bool operator()(const entry& lhs, const entry& rhs) const noexcept
+            {
+                return (lhs.deadline_us != rhs.deadline_us) ? (lhs.deadline_us > rhs.deadline_us)
+                                                            : (lhs.sequence > rhs.sequence);
+            }
+        };
+
+        std::optional<entry> pop_entry()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            if (m_heap.empty())
+            {
+                return std::nullopt;
+            }
+            return std::optional<entry>(m_heap.pop_move());
+        }
+
+        mutable tools::critical_section m_mutex;
+        tools::dary_heap<entry, later_deadline> m_heap;
+        std::uint64_t m_sequence = 0U;
+        std::atomic<std::size_t> m_missed_count = 0U;
+    };
+}
+
+#endif //  DEADLINE_WORK_QUEUE_HPP_
@@ -0,0 +1,431 @@
+/**
+ * @file dictionary_snapshot.hpp
+ * @brief Binary snapshot and fast warm start of a sync_dictionary.
+ *
+ * Rebuilding a dictionary from a text format at boot parses every entry and inserts them one by one.
+ * write_dictionary_snapshot() streams the entries in ascending key order as bytepack records, cut into chunks
+ * handed to a sink one at a time (a file, a flash partition, a socket), each chunk optionally gzip compressed and
+ * protected by a CRC-32. restore_dictionary_snapshot() checks and decodes an image, then loads the sorted entries
+ * with sync_dictionary::bulk_load() in linear time.
+ *
+ * Image layout: an 8-byte header (magic "PSDS", 16-bit version, 16-bit flags, bit 0 set for gzip chunks), then the
+ * chunks, each a 16-byte header (32-bit stored size, 32-bit raw size, 32-bit entry count, CRC-32 of the stored
+ * bytes) followed by the stored bytes, and a 16-byte trailer (a null stored size, 32-bit reserved, 64-bit total
+ * entry count). Header fields are big endian.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(DICTIONARY_SNAPSHOT_HPP_)
+#define DICTIONARY_SNAPSHOT_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/checksum.hpp"
+#include "tools/expected.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/sync_dictionary.hpp"
+#include "tools/topic_bridge.hpp"
+
+namespace tools
+{
+    /** @brief First bytes of every dictionary snapshot. */
+    inline constexpr std::array<std::uint8_t, 4U> dictionary_snapshot_magic = { 'P', 'S', 'D', 'S' };
+
+    /** @brief Layout version written in the snapshot header. */
+    inline constexpr std::uint16_t dictionary_snapshot_version = 1U;
+
+    /** @brief Header flag set when the chunks are gzip compressed. */
+    inline constexpr std::uint16_t dictionary_snapshot_gzip_flag = 0x01U;
+
+    /** @brief Size of the snapshot header. */
+    inline constexpr std::size_t dictionary_snapshot_header_size = 8U;
+
+    /** @brief Size of a chunk header, and of the trailer. */
+    inline constexpr std::size_t dictionary_snapshot_chunk_header_size = 16U;
+
+    /**
+     * @brief Failures of write_dictionary_snapshot() and restore_dictionary_snapshot().
+     */
+    enum class dictionary_snapshot_error : std::uint8_t
+    {
+        sink_failed,      ///< The sink refused a chunk, or a chunk could not be compressed.
+        entry_too_large,  ///< An entry does not fit in a chunk, or could not be encoded.
+        bad_header,       ///< Not a snapshot, or a snapshot of another layout version.
+        truncated,        ///< The image ends inside a chunk or before the trailer.
+        corrupted,        ///< A chunk fails its CRC, or does not inflate to its raw size.
+        decode_failed,    ///< A chunk holds fewer decodable entries than announced.
+        unsorted,         ///< The keys are not strictly ascending.
+        count_mismatch    ///< The trailer total differs from the sum of the chunk counts.
+    };
+
+    /**
+     * @brief Parameters of write_dictionary_snapshot().
+     */
+    struct dictionary_snapshot_options
+    {
+        std::size_t chunk_size = 16U * 1024U; ///< Largest raw size of a chunk, hence of an entry.
+        bool compress = false;                ///< Gzip every chunk; the restore inflates them chunk by chunk.
+        gzip_level level = gzip_level::fast;  ///< Compression effort when compress is set.
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Accumulates the encoded entries of a snapshot into a chunk and hands full chunks to a sink.
+         */
+        template <std::endian BufferEndian, typename Sink>
+        class dictionary_snapshot_writer
+        {
+        public:
+            dictionary_snapshot_writer(Sink& sink, const dictionary_snapshot_options& options)
+                : m_sink(sink)
+                , m_options(options)
+                , m_scratch((std::min)(options.chunk_size, std::size_t { 256U }))
+            {
+                m_chunk.reserve(options.chunk_size);
+                if (options.compress)
+                {
+                    m_gzip = std::make_unique<gzip_wrapper>();
+                }
+            }
+
+            bool write_header()
+            {
+                std::array<std::uint8_t, dictionary_snapshot_header_size> header = {};
+                bytepack::binary_stream<std::endian::big> stream { bytepack::buffer_view(header) };
+                const std::uint16_t flags = m_options.compress ? dictionary_snapshot_gzip_flag : 0U;
+                static_cast<void>(stream.write(dictionary_snapshot_magic, dictionary_snapshot_version, flags));
+                return emit(header);
+            }
+
+            /**
+             * @brief Encodes an entry into the current chunk, handing the chunk to the sink first when it is full.
+             */
+            template <typename Codec, typename K, typename T>
+            bool add(const K& key, const T& value)
+            {
+                const auto record = encode<Codec>(key, value);
+                if (record.empty())
+                {
+                    m_error = dictionary_snapshot_error::entry_too_large;
+                    return false;
+                }
+                if (((m_chunk.size() + record.size()) > m_options.chunk_size) && !flush_chunk())
+                {
+                    return false;
+                }
+
+                m_chunk.insert(m_chunk.end(), record.begin(), record.end());
+                ++m_chunk_entries;
+                return true;
+            }
+
+            bool finish()
+            {
+                if (!flush_chunk())
+                {
+                    return false;
+                }
+
+                std::array<std::uint8_t, dictionary_snapshot_chunk_header_size> trailer = {};
+                bytepack::binary_stream<std::endian::big> stream { bytepack::buffer_view(trailer) };
+                static_cast<void>(stream.write(std::uint32_t { 0U }, std::uint32_t { 0U }, m_total_entries));
+                return emit(trailer);
+            }
+
+            [[nodiscard]] std::uint64_t total_entries() const
+            {
+                return m_total_entries;
+            }
+
+            [[nodiscard]] dictionary_snapshot_error error() const
+            {
+                return m_error;
+            }
+
+        private:
+            template <typename Codec, typename K, typename T>
+            std::span<const std::uint8_t> encode(const K& key, const T& value)
+            {
+                while (true)
+                {
+                    bytepack::binary_stream<BufferEndian> stream(
+                        bytepack::buffer_view(m_scratch.data(), m_scratch.size()));
+                    if (Codec::encode(stream, key, value))
+                    {
+                        return std::span<const std::uint8_t>(m_scratch.data(), stream.data().size());
+                    }
+                    if (m_scratch.size() >= m_options.chunk_size)
+                    {
+                        return {};
+                    }
+                    m_scratch.resize((std::min)(m_scratch.size() * 2U, m_options.chunk_size));
+                }
+            }
+
+            bool flush_chunk()
+            {
+                if (m_chunk.empty())
+                {
+                    return true;
+                }
+
+                const std::vector<std::uint8_t> packed = m_gzip ? m_gzip->pack(m_chunk, m_options.level)
+                                                                 : std::vector<std::uint8_t> {};
+                const std::vector<std::uint8_t>& stored = m_gzip ? packed : m_chunk;
+
+                std::array<std::uint8_t, dictionary_snapshot_chunk_header_size> header = {};
+                bytepack::binary_stream<std::endian::big> stream { bytepack::buffer_view(header) };
+                static_cast<void>(stream.write(static_cast<std::uint32_t>(stored.size()),
+                    static_cast<std::uint32_t>(m_chunk.size()), m_chunk_entries,
+                    ~crc32_update(stored.data(), stored.size(), crc32_initial)));
+                if (stored.empty() || !emit(header) || !emit(stored))
+                {
+                    m_error = dictionary_snapshot_error::sink_failed;
+                    return false;
+                }
+
+                m_total_entries += m_chunk_entries;
+                m_chunk_entries = 0U;
+                m_chunk.clear();
+                return true;
+            }
+
+            bool emit(std::span<const std::uint8_t> bytes)
+            {
+                if (!m_sink(bytes))
+                {
+                    m_error = dictionary_snapshot_error::sink_failed;
+                    return false;
+                }
+                return true;
+            }
+
+            Sink& m_sink;
+            const dictionary_snapshot_options& m_options;
+            std::vector<std::uint8_t> m_scratch;
+            std::vector<std::uint8_t> m_chunk;
+            std::uint32_t m_chunk_entries = 0U;
+            std::uint64_t m_total_entries = 0U;
+            std::unique_ptr<gzip_wrapper> m_gzip;
+            dictionary_snapshot_error m_error = dictionary_snapshot_error::sink_failed;
+        };
+    }
+
+    /**
+     * @brief Streams a snapshot of a dictionary, in ascending key order, to a sink.
+     *
+     * The entries are visited under the shared lock of the dictionary: lookups go on, writers wait until the last
+     * chunk is handed over. Only one chunk is held in memory, never the whole image.
+     *
+     * @tparam Codec The key/value serializer, see bytepack_bridge_codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     * @param dictionary The dictionary; K provides operator< when its container is hashed.
+     * @param sink Callable taking a std::span<const std::uint8_t> and returning false on failure; it receives the
+     *        header, then each chunk, then the trailer.
+     * @param options The chunk size and compression.
+     * @return The number of entries written, or the failure.
+     */
+    template <typename Codec = bytepack_bridge_codec, std::endian BufferEndian = std::endian::big, typename K,
+        typename T, typename D, typename Sink>
+    expected<std::size_t, dictionary_snapshot_error> write_dictionary_snapshot(
+        const sync_dictionary<K, T, D>& dictionary, Sink&& sink, const dictionary_snapshot_options& options = {})
+    {
+        detail::dictionary_snapshot_writer<BufferEndian, Sink> writer(sink, options);
+        bool written = writer.write_header();
+        dictionary.for_each_sorted(
+            [&writer, &written](const K& key, const T& value)
+            { written = written && writer.template add<Codec>(key, value); });
+        if (!written || !writer.finish())
+        {
+            return unexpected<dictionary_snapshot_error>(writer.error());
+        }
+        return static_cast<std::size_t>(writer.total_entries());
+    }
+
+    /**
+     * @brief Builds the whole snapshot image of a dictionary in memory.
+     *
+     * @tparam Codec The key/value serializer, see bytepack_bridge_codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     * @param dictionary The dictionary.
+     * @param options The chunk size and compression.
+     * @return The image, or the failure.
+     */
+    template <typename Codec = bytepack_bridge_codec, std::endian BufferEndian = std::endian::big, typename K,
+        typename T, typename D>
+    expected<std::vector<std::uint8_t>, dictionary_snapshot_error> make_dictionary_snapshot(
+        const sync_dictionary<K, T, D>& dictionary, const dictionary_snapshot_options& options = {})
+    {
+        std::vector<std::uint8_t> image;
+        const auto written = write_dictionary_snapshot<Codec, BufferEndian>(dictionary,
+            [&image](std::span<const std::uint8_t> bytes)
+            {
+                image.insert(image.end(), bytes.begin(), bytes.end());
+                return true;
+            },
+            options);
+        if (!written.has_value())
+        {
+            return unexpected<dictionary_snapshot_error>(written.error());
+        }
+        return image;
+    }
+
+    /**
+     * @brief Replaces the contents of a dictionary with the entries of a snapshot image.
+     *
+     * The whole image is checked and decoded before the dictionary is touched: on failure, it keeps its contents.
+     * The decoded entries are then bulk loaded in linear time under one exclusive lock.
+     *
+     * @tparam Codec The key/value deserializer, matching the writer codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     * @param dictionary The dictionary to load; K and T are default constructible, K provides operator<.
+     * @param image The snapshot image, for instance a mapped file or flash partition.
+     * @return The number of entries loaded, or the failure.
+     */
+    template <typename Codec = bytepack_bridge_codec, std::endian BufferEndian = std::endian::big, typename K,
+        typename T, typename D>
+    expected<std::size_t, dictionary_snapshot_error> restore_dictionary_snapshot(
+        sync_dictionary<K, T, D>& dictionary, std::span<const std::uint8_t> image)
+    {
+        auto read_stream = [](std::span<const std::uint8_t> bytes)
+        {
+            return bytepack::buffer_view(const_cast<std::uint8_t*>(bytes.data()), bytes.size()); // NOLINT read only
+        };
+
+        std::array<std::uint8_t, 4U> magic = {};
+        std::uint16_t version = 0U;
+        std::uint16_t flags = 0U;
+        bytepack::binary_stream<std::endian::big> header(read_stream(image.first(
+            (std::min)(image.size(), dictionary_snapshot_header_size))));
+        if ((image.size() < dictionary_snapshot_header_size) || !header.read(magic, version, flags)
+            || (dictionary_snapshot_magic != magic) || (dictionary_snapshot_version != version))
+        {
+            return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::bad_header);
+        }
+
+        std::unique_ptr<gzip_wrapper> gzip;
+        if (0U != (flags & dictionary_snapshot_gzip_flag))
+        {
+            gzip = std::make_unique<gzip_wrapper>();
+        }
+
+        std::vector<std::pair<K, T>> entries;
+        std::size_t offset = dictionary_snapshot_header_size;
+        while (true)
+        {
+            if ((image.size() - offset) < dictionary_snapshot_chunk_header_size)
+            {
+                return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::truncated);
+            }
+
+            std::uint32_t stored_size = 0U;
+            std::uint32_t raw_size = 0U;
+            std::uint32_t count = 0U;
+            std::uint32_t crc = 0U;
+            bytepack::binary_stream<std::endian::big> chunk_header(
+                read_stream(image.subspan(offset, dictionary_snapshot_chunk_header_size)));
+            static_cast<void>(chunk_header.read(stored_size, raw_size, count, crc));
+            offset += dictionary_snapshot_chunk_header_size;
+
+            if (0U == stored_size)
+            {
+                // trailer: the 64-bit entry count spans the count and CRC words
+                const std::uint64_t total = (static_cast<std::uint64_t>(count) << 32U) | crc;
+                if (total != entries.size())
+                {
+                    return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::count_mismatch);
+                }
+                break;
+            }
+
+            if ((image.size() - offset) < stored_size)
+            {
+                return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::truncated);
+            }
+            const auto stored = image.subspan(offset, stored_size);
+            offset += stored_size;
+            if (crc != ~crc32_update(stored.data(), stored.size(), crc32_initial))
+            {
+                return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::corrupted);
+            }
+
+            std::vector<std::uint8_t> inflated;
+            std::span<const std::uint8_t> raw = stored;
+            if (gzip)
+            {
+                inflated = gzip->unpack(std::vector<std::uint8_t>(stored.begin(), stored.end()));
+                if (inflated.size() != raw_size)
+                {
+                    return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::corrupted);
+                }
+                raw = inflated;
+            }
+
+            bytepack::binary_stream<BufferEndian> records(read_stream(raw));
+            for (std::uint32_t index = 0U; index < count; ++index)
+            {
+                K key {};
+                T value {};
+                if (!Codec::decode(records, key, value))
+                {
+                    return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::decode_failed);
+                }
+                if (!entries.empty() && !(entries.back().first < key))
+                {
+                    return unexpected<dictionary_snapshot_error>(dictionary_snapshot_error::unsorted);
+                }
+                entries.emplace_back(std::move(key), std::move(value));
+            }
+        }
+
+        const std::size_t loaded = entries.size();
+        dictionary.bulk_load(std::move(entries));
+        return loaded;
+    }
+}
+
+#endif // C++20
+
+#endif // DICTIONARY_SNAPSHOT_HPP_
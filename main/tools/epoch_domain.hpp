@@ -0,0 +1,265 @@
+/**
+ * @file epoch_domain.hpp
+ * @brief Epoch-based reclamation of objects read without locks nor reference counting.
+ *
+ * Readers bracket their accesses with an epoch_domain::guard, which announces the current epoch in a reader slot.
+ * A writer replaces the shared object, then retires the old one with retire(): it is deleted once no reader slot
+ * announces an epoch that could have seen it. Reading costs one slot exchange on enter and one store on leave,
+ * whatever the number of objects reached from the protected pointer.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(EPOCH_DOMAIN_HPP_)
+#define EPOCH_DOMAIN_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace tools
+{
+    namespace detail
+    {
+        /**
+         * @brief Returns the first reader slot tried by the calling task: its core on ESP32, one per thread elsewhere.
+         */
+        inline std::size_t epoch_slot_hint()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::size_t>(xPortGetCoreID());
+#elif defined(FREERTOS_PLATFORM)
+            return 0U;
+#else
+            static std::atomic<std::size_t> next_hint { 0U };
+            thread_local const std::size_t hint = next_hint.fetch_add(1U, std::memory_order_relaxed);
+            return hint;
+#endif
+        }
+    }
+
+    /**
+     * @brief Epoch-based reclamation domain with a fixed number of reader slots.
+     *
+     * Any number of tasks may hold guards, up to MaxReaders at the same time (a nested guard takes another slot);
+     * entering while every slot is taken yields until one is released. retire() and reclaim() may be called from
+     * any task, including from within a guard, but a retired object is only deleted once the guards that could
+     * reach it have been released. The destructor deletes every retired object: no guard may outlive the domain.
+     *
+     * @tparam MaxReaders The number of reader slots.
+     */
+    template <std::size_t MaxReaders = 16U>
+    class epoch_domain : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(MaxReaders >= 1U, "at least one reader slot is required");
+
+        /**
+         * @brief Read-side critical section: objects loaded from the protected pointers stay valid while it lives.
+         */
+        class guard
+        {
+        public:
+            explicit guard(epoch_domain& domain)
+                : m_slot(domain.enter())
+            {
+            }
+
+            ~guard()
+            {
+                m_slot->store(0U, std::memory_order_release);
+            }
+
+            guard(const guard&) = delete;
+            guard& operator=(const guard&) = delete;
+            guard(guard&&) = delete;
+            guard& operator=(guard&&) = delete;
+
+        private:
+            std::atomic<std::uint64_t>* m_slot;
+        };
+
+        epoch_domain() = default;
+
+        ~epoch_domain()
+        {
+            for (const auto& object : m_retired)
+            {
+                object.deleter(object.pointer);
+            }
+        }
+
+        /**
+         * @brief Enters a read-side critical section.
+         *
+         * @return The guard, to keep alive while the protected objects are used.
+         */
+        [[nodiscard]] guard read_guard()
+        {
+            return guard(*this);
+        }
+
+        /**
+         * @brief Hands an object unlinked from the protected pointers over to the domain for deferred deletion.
+         *
+         * The caller must have made the object unreachable for new readers before retiring it. Objects no longer
+         * reachable by any reader are deleted on the way.
+         *
+         * @tparam T The type of the object, deleted with delete.
+         * @param object The object to retire, ignored if null.
+         */
+        template <typename T>
+        void retire(const T* object)
+        {
+            if (nullptr == object)
+            {
+                return;
+            }
+
+            std::scoped_lock<tools::critical_section> lock(m_mutex);
+            // readers entering from now on announce a later epoch and cannot reach the object anymore
+            const std::uint64_t epoch = m_global_epoch.fetch_add(1U, std::memory_order_seq_cst);
+            m_retired.push_back(retired_object { const_cast<T*>(object), &delete_object<T>, epoch }); // NOLINT
+            reclaim_unlocked();
+        }
+
+        /**
+         * @brief Deletes the retired objects no reader can reach anymore.
+         */
+        void reclaim()
+        {
+            std::scoped_lock<tools::critical_section> lock(m_mutex);
+            reclaim_unlocked();
+        }
+
+        /**
+         * @brief Returns the number of retired objects waiting for their readers to leave.
+         *
+         * @return The pending object count.
+         */
+        [[nodiscard]] std::size_t pending_reclaims()
+        {
+            std::scoped_lock<tools::critical_section> lock(m_mutex);
+            return m_retired.size();
+        }
+
+    private:
+        struct retired_object
+        {
+            void* pointer;
+            void (*deleter)(void*);
+            std::uint64_t epoch;
+        };
+
+        struct alignas(64) reader_slot // NOLINT cache line
+        {
+            std::atomic<std::uint64_t> epoch { 0U }; // 0 when free
+        };
+
+        template <typename T>
+        static void delete_object(void* object)
+        {
+            delete static_cast<T*>(object); // NOLINT owning raw pointer handed over by retire
+        }
+
+        std::atomic<std::uint64_t>* enter()
+        {
+            const std::size_t hint = detail::epoch_slot_hint();
+
+            for (;;)
+            {
+                const std::uint64_t epoch = m_global_epoch.load(std::memory_order_seq_cst);
+
+                for (std::size_t offset = 0U; offset < MaxReaders; ++offset)
+                {
+                    auto& slot = m_slots[(hint + offset) % MaxReaders].epoch;
+                    std::uint64_t expected = 0U;
+                    // the protected pointers are loaded after this exchange, hence after any retire that missed it
+                    if (slot.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst))
+                    {
+                        return &slot;
+                    }
+                }
+
+                tools::yield();
+            }
+        }
+
+        void reclaim_unlocked()
+        {
+            std::uint64_t oldest_reader = std::numeric_limits<std::uint64_t>::max();
+            for (const auto& slot : m_slots)
+            {
+                const std::uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+                if ((0U != epoch) && (epoch < oldest_reader))
+                {
+                    oldest_reader = epoch;
+                }
+            }
+
+            // an object retired at epoch e may only be reached by readers that announced e or earlier
+            std::size_t kept = 0U;
+            for (const auto& object : m_retired)
+            {
+                if (object.epoch < oldest_reader)
+                {
+                    object.deleter(object.pointer);
+                }
+                else
+                {
+                    m_retired[kept++] = object;
+                }
+            }
+            m_retired.resize(kept);
+        }
+
+        std::array<reader_slot, MaxReaders> m_slots {};
+        std::atomic<std::uint64_t> m_global_epoch { 1U };
+        tools::critical_section m_mutex;
+        std::vector<retired_object> m_retired;
+    };
+}
+
+#endif //  EPOCH_DOMAIN_HPP_
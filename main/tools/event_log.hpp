@@ -0,0 +1,620 @@
+/**
+ * @file event_log.hpp
+ * @brief Binary event log: record the event stream of a subject into a memory region and replay it later.
+ *
+ * event_log_recorder is an observer appending each event it is informed of, with a microsecond timestamp, to an
+ * event_log_writer over a caller-provided byte region: a memory-mapped file on Linux (linux_mmap_event_log.hpp),
+ * or a RAM buffer on ESP32 that a background task then stores into a flash partition (esp_partition_event_log).
+ * Recording serializes the event in place under a short lock and never waits for storage I/O.
+ * event_log_replayer republishes a recorded log into a subject, at the recorded pace or as fast as possible, which
+ * makes a captured production stream a reproducible load source.
+ *
+ * Log layout: an 8-byte header (magic "PSEL", 16-bit version, 16-bit reserved), then the records, each a 32-bit
+ * payload size, a 64-bit timestamp in microseconds since the start of the recording and the payload (topic and
+ * event serialized by the codec). A null payload size ends the log. Header and record fields are big endian.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(EVENT_LOG_HPP_)
+#define EVENT_LOG_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <string>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_helpers.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/topic_bridge.hpp"
+
+#if defined(ESP_PLATFORM)
+#include <esp_partition.h>
+#endif
+
+namespace tools
+{
+    /** @brief First bytes of every event log. */
+    inline constexpr std::array<std::uint8_t, 4U> event_log_magic = { 'P', 'S', 'E', 'L' };
+
+    /** @brief Layout version written in the log header. */
+    inline constexpr std::uint16_t event_log_version = 1U;
+
+    /** @brief Size of the log header. */
+    inline constexpr std::size_t event_log_header_size = 8U;
+
+    /** @brief Size of the payload size and timestamp fields opening every record. */
+    inline constexpr std::size_t event_log_record_header_size = sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+    /**
+     * @brief Counters of an event_log_recorder or an event_log_replayer.
+     */
+    struct event_log_stats
+    {
+        std::uint64_t events = 0U;            ///< Events recorded, or replayed.
+        std::uint64_t bytes = 0U;             ///< Log bytes written, or read.
+        std::uint64_t dropped_events = 0U;    ///< Events that did not fit in the region (recorder only).
+        std::uint64_t malformed_records = 0U; ///< Records that could not be decoded (replayer only).
+    };
+
+    namespace detail
+    {
+        inline void store_be(std::uint8_t* destination, std::uint64_t value, std::size_t size)
+        {
+            for (std::size_t index = 0U; index < size; ++index)
+            {
+                destination[size - 1U - index] = static_cast<std::uint8_t>(value & 0xFFU); // NOLINT
+                value >>= 8U;
+            }
+        }
+
+        inline std::uint64_t load_be(const std::uint8_t* source, std::size_t size)
+        {
+            std::uint64_t value = 0U;
+            for (std::size_t index = 0U; index < size; ++index)
+            {
+                value = (value << 8U) | source[index]; // NOLINT pointer arithmetic
+            }
+            return value;
+        }
+    }
+
+    /**
+     * @brief Appends records to an event log laid out in a caller-provided byte region.
+     *
+     * The writer initializes the log header on construction; the region must outlive it. Appends are serialized by
+     * a lock held while the record is encoded in place, as long as a memory copy. The byte after the last record
+     * always holds an end marker, so the committed part of the region is a valid log at any time.
+     */
+    class event_log_writer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        event_log_writer() = delete;
+
+        /**
+         * @brief Starts an empty log in the region.
+         *
+         * @param region The storage of the log, at least event_log_header_size + 4 bytes to be usable.
+         */
+        explicit event_log_writer(std::span<std::uint8_t> region)
+            : m_region(region)
+        {
+            if (m_region.size() >= (event_log_header_size + end_marker_size))
+            {
+                std::memcpy(m_region.data(), event_log_magic.data(), event_log_magic.size());
+                detail::store_be(m_region.data() + event_log_magic.size(), event_log_version, sizeof(std::uint16_t));
+                detail::store_be(m_region.data() + 6U, 0U, sizeof(std::uint16_t)); // NOLINT reserved field
+                detail::store_be(m_region.data() + event_log_header_size, 0U, end_marker_size);
+                m_tail = event_log_header_size;
+            }
+        }
+
+        ~event_log_writer() = default;
+
+        /**
+         * @brief Appends a record whose payload is written by an encoder.
+         *
+         * @tparam BufferEndian Endianness of the payload stream.
+         * @tparam Encoder Callable taking a bytepack::binary_stream<BufferEndian>& and returning false on failure.
+         * @param timestamp_us The record timestamp.
+         * @param encoder Writes the payload; it runs under the writer lock.
+         * @return False if the log is not usable, full, or if the encoder failed.
+         */
+        template <std::endian BufferEndian = std::endian::big, typename Encoder>
+        bool append(std::uint64_t timestamp_us, Encoder&& encoder)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            const std::size_t reserved = event_log_record_header_size + end_marker_size;
+            if ((0U == m_tail) || ((m_region.size() - m_tail) <= reserved))
+            {
+                return false;
+            }
+
+            std::uint8_t* record = m_region.data() + m_tail;
+            bytepack::binary_stream<BufferEndian> stream(
+                bytepack::buffer_view(record + event_log_record_header_size, m_region.size() - m_tail - reserved));
+            if (!encoder(stream) || (0U == stream.data().size()))
+            {
+                return false;
+            }
+
+            const std::size_t payload_size = stream.data().size();
+            const std::size_t next_tail = m_tail + event_log_record_header_size + payload_size;
+            // end marker first, then the size committing the record
+            detail::store_be(m_region.data() + next_tail, 0U, end_marker_size);
+            detail::store_be(record + sizeof(std::uint32_t), timestamp_us, sizeof(std::uint64_t));
+            detail::store_be(record, payload_size, sizeof(std::uint32_t));
+            m_tail = next_tail;
+            return true;
+        }
+
+        /**
+         * @brief Gets the committed part of the log, header and end marker included.
+         *
+         * @return The log bytes, empty if the region is too small.
+         */
+        [[nodiscard]] std::span<const std::uint8_t> committed()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return (0U == m_tail) ? std::span<const std::uint8_t> {}
+                                  : std::span<const std::uint8_t>(m_region.data(), m_tail + end_marker_size);
+        }
+
+    private:
+        static constexpr std::size_t end_marker_size = sizeof(std::uint32_t);
+
+        tools::critical_section m_mutex;
+        std::span<std::uint8_t> m_region;
+        std::size_t m_tail = 0U; // 0 when the region is too small
+    };
+
+    /**
+     * @brief Iterates over the records of an event log.
+     */
+    class event_log_reader
+    {
+    public:
+        /**
+         * @brief Opens a log for reading.
+         *
+         * @param log The log bytes, for instance a mapped file or partition.
+         */
+        explicit event_log_reader(std::span<const std::uint8_t> log)
+            : m_log(log)
+        {
+            const bool header_ok = (m_log.size() >= event_log_header_size)
+                && (0 == std::memcmp(m_log.data(), event_log_magic.data(), event_log_magic.size()))
+                && (event_log_version == detail::load_be(m_log.data() + event_log_magic.size(), 2U));
+            m_offset = header_ok ? event_log_header_size : m_log.size();
+            m_valid = header_ok;
+        }
+
+        /**
+         * @brief Checks whether the log starts with a supported header.
+         *
+         * @return True for a readable log.
+         */
+        [[nodiscard]] bool valid() const
+        {
+            return m_valid;
+        }
+
+        /**
+         * @brief Reads the next record.
+         *
+         * @param timestamp_us Set to the record timestamp.
+         * @param payload Set to the record payload, pointing into the log.
+         * @return False at the end of the log, or on a truncated record.
+         */
+        bool next(std::uint64_t& timestamp_us, std::span<const std::uint8_t>& payload)
+        {
+            if ((m_log.size() - m_offset) < event_log_record_header_size)
+            {
+                return false;
+            }
+
+            const std::uint8_t* record = m_log.data() + m_offset;
+            const auto payload_size = static_cast<std::size_t>(detail::load_be(record, sizeof(std::uint32_t)));
+            if ((0U == payload_size) || (payload_size > (m_log.size() - m_offset - event_log_record_header_size)))
+            {
+                return false;
+            }
+
+            timestamp_us = detail::load_be(record + sizeof(std::uint32_t), sizeof(std::uint64_t));
+            payload = m_log.subspan(m_offset + event_log_record_header_size, payload_size);
+            m_offset += event_log_record_header_size + payload_size;
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of log bytes consumed so far, header included.
+         *
+         * @return The read offset.
+         */
+        [[nodiscard]] std::size_t offset() const
+        {
+            return m_offset;
+        }
+
+    private:
+        std::span<const std::uint8_t> m_log;
+        std::size_t m_offset = 0U;
+        bool m_valid = false;
+    };
+
+    /**
+     * @brief Observer recording every event it is informed of into an event log.
+     *
+     * Timestamps are the microseconds elapsed since the construction of the recorder. Informs may come from several
+     * tasks. Events that no longer fit in the region are counted as dropped.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type of the origin, not recorded.
+     * @tparam Codec The topic/event serializer, see bytepack_bridge_codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Codec = bytepack_bridge_codec,
+        std::endian BufferEndian = std::endian::big>
+    class event_log_recorder : public sync_observer<Topic, Evt, Origin>
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        event_log_recorder() = delete;
+
+        /**
+         * @brief Constructs a recorder starting an empty log in a region.
+         *
+         * @param region The storage of the log, outliving the recorder.
+         */
+        explicit event_log_recorder(std::span<std::uint8_t> region)
+            : m_writer(region)
+            , m_start(clock::now())
+        {
+        }
+
+        ~event_log_recorder() override = default;
+
+        /**
+         * @brief Appends the event to the log.
+         *
+         * @param topic The topic of the event.
+         * @param event The event.
+         * @param origin The origin, not recorded.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            (void)origin;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - m_start);
+            std::size_t encoded_size = 0U;
+            const bool recorded = m_writer.append<BufferEndian>(static_cast<std::uint64_t>(elapsed.count()),
+                [&](bytepack::binary_stream<BufferEndian>& stream)
+                {
+                    const bool encoded = Codec::encode(stream, topic, event);
+                    encoded_size = stream.data().size();
+                    return encoded;
+                });
+
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            if (recorded)
+            {
+                ++m_stats.events;
+                m_stats.bytes += event_log_record_header_size + encoded_size;
+            }
+            else
+            {
+                ++m_stats.dropped_events;
+            }
+        }
+
+        /**
+         * @brief Gets the recorded log, to store or replay it.
+         *
+         * @return The committed log bytes.
+         */
+        [[nodiscard]] std::span<const std::uint8_t> log()
+        {
+            return m_writer.committed();
+        }
+
+        /**
+         * @brief Gets the counters of the recorder.
+         *
+         * @return A copy of the counters.
+         */
+        event_log_stats stats()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_stats;
+        }
+
+    private:
+        event_log_writer m_writer;
+        clock::time_point m_start;
+        tools::critical_section m_mutex;
+        event_log_stats m_stats;
+    };
+
+    /**
+     * @brief Replay speed of an event_log_replayer.
+     */
+    enum class event_log_pace : std::uint8_t
+    {
+        as_fast_as_possible, ///< Publish the records back to back.
+        real_time            ///< Wait between records as long as between their timestamps.
+    };
+
+    /**
+     * @brief Republishes the events of a recorded log into a subject.
+     *
+     * @tparam Topic The type of the topic, default constructible.
+     * @tparam Evt The type of the event, default constructible.
+     * @tparam Origin The origin type of the subject.
+     * @tparam Codec The topic/event deserializer, matching the recorder codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Codec = bytepack_bridge_codec,
+        std::endian BufferEndian = std::endian::big>
+    class event_log_replayer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        event_log_replayer() = delete;
+
+        /**
+         * @brief Constructs a replayer over a log.
+         *
+         * @param log The log bytes, outliving the replayer.
+         */
+        explicit event_log_replayer(std::span<const std::uint8_t> log)
+            : m_log(log)
+        {
+        }
+
+        ~event_log_replayer() = default;
+
+        /**
+         * @brief Publishes every record of the log, in order, from the calling task.
+         *
+         * In real time, the first record is published immediately and each next one once as much time has elapsed
+         * since the start of the replay as between its timestamp and the first one.
+         *
+         * @param subject The subject to publish into.
+         * @param pace The replay speed.
+         * @return The number of events published, 0 for a log without a valid header.
+         */
+        std::size_t replay(sync_subject<Topic, Evt, Origin>& subject, event_log_pace pace)
+        {
+            event_log_reader reader(m_log);
+            if (!reader.valid())
+            {
+                return 0U;
+            }
+
+            const auto start = clock::now();
+            std::uint64_t timestamp_us = 0U;
+            std::span<const std::uint8_t> payload;
+            std::size_t published = 0U;
+            bool first_record = true;
+            std::uint64_t first_timestamp = 0U;
+
+            while (reader.next(timestamp_us, payload))
+            {
+                if (first_record)
+                {
+                    first_timestamp = timestamp_us;
+                    first_record = false;
+                }
+
+                Topic topic {};
+                Evt event {};
+                bytepack::binary_stream<BufferEndian> stream(bytepack::buffer_view(
+                    const_cast<std::uint8_t*>(payload.data()), payload.size())); // NOLINT read only
+                if (!Codec::decode(stream, topic, event))
+                {
+                    ++m_stats.malformed_records;
+                    continue;
+                }
+
+                if (event_log_pace::real_time == pace)
+                {
+                    wait_until(start + std::chrono::microseconds(timestamp_us - first_timestamp));
+                }
+
+                subject.publish(topic, event);
+                ++m_stats.events;
+                ++published;
+            }
+
+            m_stats.bytes += reader.offset();
+            return published;
+        }
+
+        /**
+         * @brief Gets the counters accumulated over the replays.
+         *
+         * @return A copy of the counters.
+         */
+        [[nodiscard]] event_log_stats stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        static void wait_until(clock::time_point deadline)
+        {
+            constexpr auto coarse_margin = std::chrono::milliseconds(1);
+            for (auto now = clock::now(); now < deadline; now = clock::now())
+            {
+                const auto remaining = deadline - now;
+                if (remaining > coarse_margin)
+                {
+                    const auto sleep_ms
+                        = std::chrono::duration_cast<std::chrono::milliseconds>(remaining - coarse_margin);
+                    tools::sleep_for(static_cast<std::uint64_t>(sleep_ms.count()));
+                }
+                else
+                {
+                    tools::yield();
+                }
+            }
+        }
+
+        std::span<const std::uint8_t> m_log;
+        event_log_stats m_stats;
+    };
+
+#if defined(ESP_PLATFORM)
+    /**
+     * @brief Event log storage in a data partition of the ESP32 flash.
+     *
+     * Flash writes stall both cores' caches and must not run in a publisher: record into a RAM region with an
+     * event_log_recorder, then store() its log from a low priority task. map() exposes a stored log for replay
+     * without copying it to RAM.
+     */
+    class esp_partition_event_log : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Looks up a data partition by label.
+         *
+         * @param label The partition label in the partition table.
+         */
+        explicit esp_partition_event_log(const char* label)
+            : m_partition(esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label))
+        {
+        }
+
+        ~esp_partition_event_log()
+        {
+            unmap();
+        }
+
+        /**
+         * @brief Checks whether the partition was found.
+         *
+         * @return True if the partition is usable.
+         */
+        [[nodiscard]] bool valid() const
+        {
+            return nullptr != m_partition;
+        }
+
+        /**
+         * @brief Gets the size of the partition.
+         *
+         * @return The largest storable log in bytes, 0 without partition.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return valid() ? static_cast<std::size_t>(m_partition->size) : 0U;
+        }
+
+        /**
+         * @brief Erases the needed sectors and writes a log at the start of the partition.
+         *
+         * @param log The log bytes, for instance event_log_recorder::log().
+         * @return True on success.
+         */
+        bool store(std::span<const std::uint8_t> log)
+        {
+            if (!valid() || log.empty() || (log.size() > capacity()))
+            {
+                return false;
+            }
+
+            unmap();
+            const std::size_t sector = m_partition->erase_size;
+            const std::size_t erased = ((log.size() + sector - 1U) / sector) * sector;
+            return (ESP_OK == esp_partition_erase_range(m_partition, 0U, erased))
+                && (ESP_OK == esp_partition_write(m_partition, 0U, log.data(), log.size()));
+        }
+
+        /**
+         * @brief Maps the whole partition in the data address space, to replay its log.
+         *
+         * @return The partition bytes, empty on failure; valid until the next store() or the destruction.
+         */
+        std::span<const std::uint8_t> map()
+        {
+            if (!valid())
+            {
+                return {};
+            }
+
+            if (nullptr == m_mapped)
+            {
+                const void* mapped = nullptr;
+                if (ESP_OK
+                    != esp_partition_mmap(
+                        m_partition, 0U, m_partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &m_mmap_handle))
+                {
+                    return {};
+                }
+                m_mapped = static_cast<const std::uint8_t*>(mapped);
+            }
+
+            return std::span<const std::uint8_t>(m_mapped, capacity());
+        }
+
+    private:
+        void unmap()
+        {
+            if (nullptr != m_mapped)
+            {
+                esp_partition_munmap(m_mmap_handle);
+                m_mapped = nullptr;
+            }
+        }
+
+        const esp_partition_t* m_partition;
+        const std::uint8_t* m_mapped = nullptr;
+        esp_partition_mmap_handle_t m_mmap_handle = {};
+    };
+#endif
+}
+
+#endif // C++20
+
+#endif //  EVENT_LOG_HPP_
@@ -0,0 +1,789 @@
+/**
+ * @file event_reactor.hpp
+ * @brief Single task multiplexing data queues, memory pipes, async observers and timers.
+ *
+ * This file contains the definition of the event_reactor class and of its event sources. Each data_task or
+ * worker_task owns a task and a stack; an event_reactor runs many low-rate handlers on one task instead, woken
+ * by a single light_event and serving its sources round robin with a bounded budget per round.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(EVENT_REACTOR_HPP_)
+#define EVENT_REACTOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/light_event.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/ring_queue.hpp"
+#include "tools/timer_scheduler.hpp"
+#include "tools/timer_wheel.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Counters of an event_reactor loop.
+     */
+    struct event_reactor_stats
+    {
+        std::uint64_t wakeups = 0U;           ///< Times the loop returned from its wait.
+        std::uint64_t rounds = 0U;            ///< Round robin passes over the sources.
+        std::uint64_t handled = 0U;           ///< Items handled by the sources.
+        std::uint64_t timer_expirations = 0U; ///< Timer handlers invoked.
+    };
+
+    /**
+     * @brief An event source served by an event_reactor.
+     *
+     * poll() runs on the reactor task and handles at most budget pending items without blocking. A source has
+     * no wakeup of its own: whoever makes it ready calls event_reactor::notify(), unless the reactor polls on a
+     * period.
+     */
+    class event_reactor_source : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        event_reactor_source() = default;
+        virtual ~event_reactor_source() = default;
+
+        /**
+         * @brief Handles pending items.
+         *
+         * @param budget The maximum number of items to handle.
+         * @return The number of items handled, 0 when the source is idle.
+         */
+        virtual std::size_t poll(std::size_t budget) = 0;
+    };
+
+    /**
+     * @brief A multiplexed event loop hosting many sources and timers on a single task.
+     *
+     * The loop waits on one light_event. Once woken it fires the due timers then polls every source in turn,
+     * each one handling at most budget items, starting one source further at every round so that no source is
+     * always served first; rounds repeat until all sources are idle. It then sleeps until notify(), the next
+     * timer or the poll period, whichever comes first.
+     *
+     * Handlers run on the reactor task and share its stack, so they should not block. Sources and timers can be
+     * added and removed from any task, the handlers included, except remove_source() which waits for the current
+     * round and would deadlock when called from a handler.
+     */
+    class event_reactor : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using source_ptr = std::shared_ptr<event_reactor_source>;
+        using timer_handler = std::function<void(timer_handle)>;
+
+        /** @brief Default number of items a source may handle per round. */
+        static constexpr std::size_t default_budget = 8U;
+
+        event_reactor() = delete;
+
+        /**
+         * @brief Constructs the reactor and starts its task.
+         *
+         * @param task_name The name of the reactor task.
+         * @param stack_size The stack size of the reactor task.
+         * @param cpu_affinity The CPU affinity of the reactor task.
+         * @param priority The priority of the reactor task.
+         * @param budget The maximum number of items a source handles per round (at least 1).
+         * @param poll_period Period at which sources are polled without notification, 0 to only rely on notify().
+         */
+        event_reactor(const std::string& task_name, std::size_t stack_size, int cpu_affinity, int priority,
+            std::size_t budget = default_budget,
+            const std::chrono::duration<std::uint64_t, std::milli>& poll_period =
+                std::chrono::duration<std::uint64_t, std::milli>::zero())
+            : m_budget(std::max<std::size_t>(budget, 1U))
+            , m_poll_period(poll_period)
+            , m_epoch(now_ms())
+        {
+            m_task = std::make_unique<generic_task<event_reactor>>(
+                [this](const std::shared_ptr<event_reactor>&, const std::string&) { run_loop(); },
+                std::shared_ptr<event_reactor> {}, task_name, stack_size, cpu_affinity, priority);
+        }
+
+        /**
+         * @brief Constructs the reactor and starts its task in caller-provided storage.
+         *
+         * @param task_name The name of the reactor task.
+         * @param storage The stack and control block of the reactor task.
+         * @param cpu_affinity The CPU affinity of the reactor task.
+         * @param priority The priority of the reactor task.
+         * @param budget The maximum number of items a source handles per round (at least 1).
+         * @param poll_period Period at which sources are polled without notification, 0 to only rely on notify().
+         */
+        event_reactor(const std::string& task_name, const task_storage& storage, int cpu_affinity, int priority,
+            std::size_t budget = default_budget,
+            const std::chrono::duration<std::uint64_t, std::milli>& poll_period =
+                std::chrono::duration<std::uint64_t, std::milli>::zero())
+            : m_budget(std::max<std::size_t>(budget, 1U))
+            , m_poll_period(poll_period)
+            , m_epoch(now_ms())
+        {
+            m_task = std::make_unique<generic_task<event_reactor>>(
+                [this](const std::shared_ptr<event_reactor>&, const std::string&) { run_loop(); },
+                std::shared_ptr<event_reactor> {}, task_name, storage, cpu_affinity, priority);
+        }
+
+        /**
+         * @brief Stops the loop and waits for the reactor task to end; pending items are left in their sources.
+         */
+        ~event_reactor()
+        {
+            m_stop.store(true);
+            m_wake.signal();
+            m_task.reset();
+        }
+
+        /**
+         * @brief Wakes the reactor so that it polls its sources.
+         */
+        void notify()
+        {
+            m_wake.signal();
+        }
+
+        /**
+         * @brief Wakes the reactor from an interrupt service routine.
+         */
+        void isr_notify()
+        {
+            m_wake.isr_signal();
+        }
+
+        /**
+         * @brief Adds a source, polled from the next round on.
+         *
+         * @param source The source to add.
+         */
+        void add_source(source_ptr source)
+        {
+            if (nullptr == source)
+            {
+                return;
+            }
+
+            {
+                std::scoped_lock<critical_section> guard(m_sources_mutex);
+                m_sources.push_back(std::move(source));
+                m_sources_changed = true;
+            }
+            m_wake.signal();
+        }
+
+        /**
+         * @brief Removes a source; once it returns, the source is no longer polled.
+         *
+         * Must not be called from a handler of this reactor.
+         *
+         * @param source The source to remove.
+         * @return True if the source was hosted by the reactor.
+         */
+        bool remove_source(const source_ptr& source)
+        {
+            bool removed = false;
+            {
+                std::scoped_lock<critical_section> guard(m_sources_mutex);
+                const auto found = std::find(m_sources.begin(), m_sources.end(), source);
+                if (found != m_sources.end())
+                {
+                    m_sources.erase(found);
+                    m_sources_changed = true;
+                    removed = true;
+                }
+            }
+
+            if (removed)
+            {
+                // wait for the round in progress, which may still hold the source
+                std::scoped_lock<critical_section> guard(m_round_mutex);
+            }
+
+            return removed;
+        }
+
+        /**
+         * @brief Hosts a poll function as a source.
+         *
+         * @param poller Called with the budget, returns the number of items it handled.
+         * @return The source, to be given to remove_source().
+         */
+        source_ptr add_poller(std::function<std::size_t(std::size_t)>&& poller);
+
+        /**
+         * @brief Hosts a bounded queue of data handled one item at a time, like a data_task.
+         *
+         * @tparam DataType The type of the queued data.
+         * @param depth The capacity of the queue.
+         * @param handler Called on the reactor task for each item.
+         * @return The queue, whose push() wakes the reactor.
+         */
+        template <typename DataType>
+        auto add_queue(std::size_t depth, std::function<void(const DataType&)>&& handler);
+
+        /**
+         * @brief Hosts the reader side of a memory_pipe.
+         *
+         * The pipe has no hook into the reactor: its writer calls notify() after sending, or the reactor is given
+         * a poll period.
+         *
+         * @param pipe The pipe to read, outliving the source.
+         * @param chunk_size The largest chunk read at once (one message on FreeRTOS, where it bounds the message).
+         * @param handler Called on the reactor task for each chunk read.
+         * @return The source, to be given to remove_source().
+         */
+        source_ptr add_pipe(
+            memory_pipe& pipe, std::size_t chunk_size, std::function<void(const std::uint8_t*, std::size_t)>&& handler);
+
+        /**
+         * @brief Hosts the queue of an async observer (async_observer, async_envelope_observer, ...).
+         *
+         * The subject informing the observer does not know the reactor: subscribe a handler calling notify() after
+         * the observer on the same topic, or give the reactor a poll period.
+         *
+         * @tparam Observer The observer type, providing pop_first_event() and pop_events_into(vector, count).
+         * @tparam Handler Callable taking one queued entry of the observer.
+         * @param observer The observer to drain.
+         * @param handler Called on the reactor task for each entry.
+         * @return The source, to be given to remove_source().
+         */
+        template <typename Observer, typename Handler>
+        source_ptr add_observer(const std::shared_ptr<Observer>& observer, Handler&& handler);
+
+        /**
+         * @brief Arms a timer fired on the reactor task, with a 1 ms resolution.
+         *
+         * @param period The period of the timer in ms (the delay of a one-shot timer).
+         * @param handler The handler invoked when the timer fires.
+         * @param type periodic to fire every period, one_shot to fire once.
+         * @return The timer handle, or none if no timer slot could be allocated.
+         */
+        std::optional<timer_handle> add_timer(std::uint64_t period, timer_handler&& handler, timer_type type)
+        {
+            const std::uint64_t delay = std::max<std::uint64_t>(period, 1U);
+            std::optional<std::size_t> id;
+            {
+                std::scoped_lock<critical_section> guard(m_timers_mutex);
+                const auto now = elapsed_ms();
+                id = m_timers.insert(now + delay, (timer_type::periodic == type) ? delay : 0U, std::move(handler));
+            }
+            m_wake.signal();
+            return id;
+        }
+
+        /**
+         * @brief Cancels a timer.
+         *
+         * @param handle The timer handle.
+         * @return True if the timer was armed and is now cancelled.
+         */
+        bool remove_timer(timer_handle handle)
+        {
+            std::scoped_lock<critical_section> guard(m_timers_mutex);
+            return m_timers.cancel(handle);
+        }
+
+        /**
+         * @brief Gets the number of hosted sources.
+         *
+         * @return The number of sources.
+         */
+        [[nodiscard]] std::size_t number_of_sources()
+        {
+            std::scoped_lock<critical_section> guard(m_sources_mutex);
+            return m_sources.size();
+        }
+
+        /**
+         * @brief Gets the loop counters.
+         *
+         * @return A snapshot of the counters.
+         */
+        [[nodiscard]] event_reactor_stats stats() const
+        {
+            event_reactor_stats snapshot;
+            snapshot.wakeups = m_wakeups.load(std::memory_order_relaxed);
+            snapshot.rounds = m_rounds.load(std::memory_order_relaxed);
+            snapshot.handled = m_handled.load(std::memory_order_relaxed);
+            snapshot.timer_expirations = m_timer_expirations.load(std::memory_order_relaxed);
+            return snapshot;
+        }
+
+    private:
+        using wheel_type = timer_wheel<timer_handler>;
+
+        void run_loop()
+        {
+            while (!m_stop.load())
+            {
+                fire_timers();
+
+                std::size_t handled = 0U;
+                {
+                    std::scoped_lock<critical_section> guard(m_round_mutex);
+                    refresh_sources();
+                    handled = poll_round();
+                }
+
+                if (0U != handled)
+                {
+                    // keep serving while some source has work, the budget bounding each one per round
+                    continue;
+                }
+
+                wait_for_work();
+                m_wakeups.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+
+        void refresh_sources()
+        {
+            std::scoped_lock<critical_section> guard(m_sources_mutex);
+            if (m_sources_changed)
+            {
+                m_round = m_sources;
+                m_sources_changed = false;
+                m_next_first = 0U;
+            }
+        }
+
+        std::size_t poll_round()
+        {
+            std::size_t handled = 0U;
+            const std::size_t count = m_round.size();
+            for (std::size_t offset = 0U; offset < count; ++offset)
+            {
+                handled += m_round[(m_next_first + offset) % count]->poll(m_budget);
+            }
+
+            if (0U != count)
+            {
+                m_next_first = (m_next_first + 1U) % count;
+                m_rounds.fetch_add(1U, std::memory_order_relaxed);
+            }
+            m_handled.fetch_add(handled, std::memory_order_relaxed);
+            return handled;
+        }
+
+        void fire_timers()
+        {
+            {
+                std::scoped_lock<critical_section> guard(m_timers_mutex);
+                m_timers.advance(elapsed_ms(), m_expired);
+            }
+
+            for (auto& timer : m_expired)
+            {
+                timer.handler(timer.id);
+                m_timer_expirations.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            if (!m_expired.empty())
+            {
+                std::scoped_lock<critical_section> guard(m_timers_mutex);
+                for (auto& timer : m_expired)
+                {
+                    m_timers.rearm(std::move(timer));
+                }
+            }
+            m_expired.clear();
+        }
+
+        void wait_for_work()
+        {
+            std::optional<std::uint64_t> timeout_ms;
+            {
+                std::scoped_lock<critical_section> guard(m_timers_mutex);
+                const auto hint = m_timers.next_expiry_hint();
+                if (hint.has_value())
+                {
+                    const auto now = elapsed_ms();
+                    const auto target = m_timers.now() + *hint;
+                    timeout_ms = (target > now) ? (target - now) : 0U;
+                }
+            }
+
+            if (0U != m_poll_period.count())
+            {
+                timeout_ms = std::min<std::uint64_t>(timeout_ms.value_or(m_poll_period.count()), m_poll_period.count());
+            }
+
+            if (!timeout_ms.has_value())
+            {
+                m_wake.wait_for_signal();
+            }
+            else if (0U != *timeout_ms)
+            {
+                constexpr std::uint64_t us_per_ms = 1000U;
+                m_wake.wait_for_signal(std::chrono::duration<std::uint64_t, std::micro>(*timeout_ms * us_per_ms));
+            }
+        }
+
+        [[nodiscard]] std::uint64_t elapsed_ms() const
+        {
+            return now_ms() - m_epoch;
+        }
+
+        static std::uint64_t now_ms()
+        {
+            constexpr std::uint64_t us_per_ms = 1000U;
+#if defined(FREERTOS_PLATFORM)
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time()) / us_per_ms;
+#else
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS;
+#endif
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count())
+                / us_per_ms;
+#endif
+        }
+
+        std::size_t m_budget;
+        std::chrono::duration<std::uint64_t, std::milli> m_poll_period;
+        std::uint64_t m_epoch;
+
+        critical_section m_sources_mutex;
+        std::vector<source_ptr> m_sources;
+        bool m_sources_changed = false;
+
+        critical_section m_round_mutex;
+        std::vector<source_ptr> m_round; ///< Sources of the loop, copied from m_sources when they change.
+        std::size_t m_next_first = 0U;
+
+        critical_section m_timers_mutex;
+        wheel_type m_timers;
+        std::vector<wheel_type::expired_timer> m_expired;
+
+        std::atomic<std::uint64_t> m_wakeups = 0U;
+        std::atomic<std::uint64_t> m_rounds = 0U;
+        std::atomic<std::uint64_t> m_handled = 0U;
+        std::atomic<std::uint64_t> m_timer_expirations = 0U;
+
+        std::atomic_bool m_stop = false;
+        light_event m_wake;
+        std::unique_ptr<generic_task<event_reactor>> m_task;
+    };
+
+    /**
+     * @brief A source wrapping a poll function.
+     */
+    class event_reactor_poller : public event_reactor_source // NOLINT inherits from non copyable class
+    {
+    public:
+        /**
+         * @brief Constructs the source.
+         *
+         * @param poller Called with the budget, returns the number of items it handled.
+         */
+        explicit event_reactor_poller(std::function<std::size_t(std::size_t)>&& poller)
+            : m_poller(std::move(poller))
+        {
+        }
+
+        std::size_t poll(std::size_t budget) override
+        {
+            return m_poller(budget);
+        }
+
+    private:
+        std::function<std::size_t(std::size_t)> m_poller;
+    };
+
+    /**
+     * @brief A bounded queue of data handled on an event_reactor, the counterpart of a data_task.
+     *
+     * push() may be called from any task; items pushed while the queue is full are rejected and counted.
+     *
+     * @tparam DataType The type of the queued data.
+     */
+    template <typename DataType>
+    class event_reactor_queue : public event_reactor_source // NOLINT inherits from non copyable class
+    {
+    public:
+        using handler = std::function<void(const DataType&)>;
+
+        /**
+         * @brief Constructs the queue.
+         *
+         * @param reactor The reactor serving the queue.
+         * @param depth The capacity of the queue.
+         * @param item_handler Called on the reactor task for each item.
+         */
+        event_reactor_queue(event_reactor& reactor, std::size_t depth, handler&& item_handler)
+            : m_reactor(reactor)
+            , m_queue(std::max<std::size_t>(depth, 1U))
+            , m_handler(std::move(item_handler))
+        {
+        }
+
+        /**
+         * @brief Queues an item and wakes the reactor.
+         *
+         * @param item The item to queue.
+         * @return True if queued, false if the queue was full.
+         */
+        bool push(const DataType& item)
+        {
+            bool queued = false;
+            {
+                std::scoped_lock<critical_section> guard(m_mutex);
+                queued = m_queue.push(item);
+            }
+            record(queued);
+            return queued;
+        }
+
+        /**
+         * @brief Queues an item and wakes the reactor.
+         *
+         * @param item The item to queue.
+         * @return True if queued, false if the queue was full.
+         */
+        bool push(DataType&& item)
+        {
+            bool queued = false;
+            {
+                std::scoped_lock<critical_section> guard(m_mutex);
+                queued = m_queue.push(std::move(item));
+            }
+            record(queued);
+            return queued;
+        }
+
+        /**
+         * @brief Gets the number of queued items.
+         *
+         * @return The number of items.
+         */
+        [[nodiscard]] std::size_t size()
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            return m_queue.size();
+        }
+
+        /**
+         * @brief Gets the number of items rejected because the queue was full.
+         *
+         * @return The rejected count.
+         */
+        [[nodiscard]] std::uint64_t rejected_count() const
+        {
+            return m_rejected.load(std::memory_order_relaxed);
+        }
+
+        std::size_t poll(std::size_t budget) override
+        {
+            std::size_t handled = 0U;
+            for (; handled < budget; ++handled)
+            {
+                std::optional<DataType> item;
+                {
+                    std::scoped_lock<critical_section> guard(m_mutex);
+                    if (m_queue.empty())
+                    {
+                        break;
+                    }
+                    item.emplace(std::move(m_queue.front()));
+                    m_queue.pop();
+                }
+                m_handler(*item);
+            }
+            return handled;
+        }
+
+    private:
+        void record(bool queued)
+        {
+            if (queued)
+            {
+                m_reactor.notify();
+            }
+            else
+            {
+                m_rejected.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+
+        event_reactor& m_reactor;
+        critical_section m_mutex;
+        ring_queue<DataType> m_queue;
+        handler m_handler;
+        std::atomic<std::uint64_t> m_rejected = 0U;
+    };
+
+    /**
+     * @brief A source reading the chunks of a memory_pipe without blocking.
+     */
+    class event_reactor_pipe : public event_reactor_source // NOLINT inherits from non copyable class
+    {
+    public:
+        using handler = std::function<void(const std::uint8_t*, std::size_t)>;
+
+        /**
+         * @brief Constructs the source.
+         *
+         * @param pipe The pipe to read, outliving the source.
+         * @param chunk_size The largest chunk read at once.
+         * @param chunk_handler Called on the reactor task for each chunk read.
+         */
+        event_reactor_pipe(memory_pipe& pipe, std::size_t chunk_size, handler&& chunk_handler)
+            : m_pipe(pipe)
+            , m_chunk(std::max<std::size_t>(chunk_size, 1U))
+            , m_handler(std::move(chunk_handler))
+        {
+        }
+
+        std::size_t poll(std::size_t budget) override
+        {
+            std::size_t handled = 0U;
+            for (; handled < budget; ++handled)
+            {
+                const std::size_t received = m_pipe.receive(
+                    m_chunk.data(), m_chunk.size(), std::chrono::duration<std::uint64_t, std::milli>::zero());
+                if (0U == received)
+                {
+                    break;
+                }
+                m_handler(m_chunk.data(), received);
+            }
+            return handled;
+        }
+
+    private:
+        memory_pipe& m_pipe;
+        std::vector<std::uint8_t> m_chunk;
+        handler m_handler;
+    };
+
+    /**
+     * @brief A source draining the queue of an async observer in batches of at most the budget.
+     *
+     * @tparam Observer The observer type, providing pop_first_event() and pop_events_into(vector, count).
+     * @tparam Handler Callable taking one queued entry of the observer.
+     */
+    template <typename Observer, typename Handler>
+    class event_reactor_observer : public event_reactor_source // NOLINT inherits from non copyable class
+    {
+    public:
+        using entry_type = typename decltype(std::declval<Observer&>().pop_first_event())::value_type;
+
+        /**
+         * @brief Constructs the source.
+         *
+         * @param observer The observer to drain.
+         * @param entry_handler Called on the reactor task for each entry.
+         */
+        template <typename UHandler>
+        event_reactor_observer(const std::shared_ptr<Observer>& observer, UHandler&& entry_handler)
+            : m_observer(observer)
+            , m_handler(std::forward<UHandler>(entry_handler))
+        {
+        }
+
+        std::size_t poll(std::size_t budget) override
+        {
+            m_batch.clear();
+            const std::size_t popped = m_observer->pop_events_into(m_batch, budget);
+            for (const auto& entry : m_batch)
+            {
+                m_handler(entry);
+            }
+            m_batch.clear();
+            return popped;
+        }
+
+    private:
+        std::shared_ptr<Observer> m_observer;
+        Handler m_handler;
+        std::vector<entry_type> m_batch;
+    };
+
+    inline event_reactor::source_ptr event_reactor::add_poller(std::function<std::size_t(std::size_t)>&& poller)
+    {
+        auto source = std::make_shared<event_reactor_poller>(std::move(poller));
+        add_source(source);
+        return source;
+    }
+
+    template <typename DataType>
+    auto event_reactor::add_queue(std::size_t depth, std::function<void(const DataType&)>&& handler)
+    {
+        auto queue = std::make_shared<event_reactor_queue<DataType>>(*this, depth, std::move(handler));
+        add_source(queue);
+        return queue;
+    }
+
+    inline event_reactor::source_ptr event_reactor::add_pipe(
+        memory_pipe& pipe, std::size_t chunk_size, std::function<void(const std::uint8_t*, std::size_t)>&& handler)
+    {
+        auto source = std::make_shared<event_reactor_pipe>(pipe, chunk_size, std::move(handler));
+        add_source(source);
+        return source;
+    }
+
+    template <typename Observer, typename Handler>
+    event_reactor::source_ptr event_reactor::add_observer(const std::shared_ptr<Observer>& observer, Handler&& handler)
+    {
+        auto source = std::make_shared<event_reactor_observer<Observer, std::decay_t<Handler>>>(
+            observer, std::forward<Handler>(handler));
+        add_source(source);
+        return source;
+    }
+}
+
+#endif //  EVENT_REACTOR_HPP_
@@ -0,0 +1,233 @@
+/**
+ * @file fast_clock.hpp
+ * @brief Cycle-counter clock, calibrated once and convertible to std::chrono durations.
+ *
+ * fast_clock reads the cheapest monotonic hardware counter of the platform: the time stamp counter on x86, the
+ * generic timer virtual count on AArch64, the CCOUNT/mcycle cycle counter on ESP32 (Xtensa and RISC-V) and the tick
+ * count elsewhere on FreeRTOS. The counter frequency is known (AArch64, ESP32, FreeRTOS) or calibrated once against
+ * steady_clock (x86), and counts are converted with a precomputed multiply and shift, so that instrumentation,
+ * latency stamping and deadline checks read time in a few cycles.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FAST_CLOCK_HPP_)
+#define FAST_CLOCK_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <thread>
+
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_cpu.h>
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
+#endif
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Monotonic clock over the platform cycle counter, usable as a std::chrono clock.
+     *
+     * counter() and elapsed() are the few-cycles path: raw counts, compared with modular arithmetic on 32-bit
+     * counters (about 17 s of CCOUNT at 240 MHz). now() returns a chrono time point; on ESP32 it reads esp_timer,
+     * since the 32-bit cycle counter wraps and is not synchronized between the two cores.
+     */
+    struct fast_clock
+    {
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::nanoseconds;
+        using time_point = std::chrono::time_point<fast_clock>;
+        static constexpr bool is_steady = true;
+
+        using counter_type = std::uint64_t;
+
+#if defined(FREERTOS_PLATFORM)
+        static constexpr counter_type counter_mask = std::numeric_limits<std::uint32_t>::max();
+#else
+        static constexpr counter_type counter_mask = std::numeric_limits<counter_type>::max();
+#endif
+
+        /**
+         * @brief Reads the raw hardware counter.
+         *
+         * @return The current count.
+         */
+        [[nodiscard]] static counter_type counter() noexcept
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<counter_type>(esp_cpu_get_cycle_count());
+#elif defined(FREERTOS_PLATFORM)
+            return static_cast<counter_type>(xTaskGetTickCount());
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            return static_cast<counter_type>(__rdtsc());
+#elif defined(__x86_64__) || defined(__i386__)
+            return static_cast<counter_type>(__builtin_ia32_rdtsc());
+#elif defined(__aarch64__)
+            counter_type count = 0U;
+            __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(count));
+            return count;
+#else
+            return static_cast<counter_type>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+#endif
+        }
+
+        /**
+         * @brief Gets the counter frequency, calibrated on the first call where it is not known.
+         *
+         * @return The number of counts per second.
+         */
+        [[nodiscard]] static std::uint64_t frequency()
+        {
+            return calibration_data().m_frequency;
+        }
+
+        /**
+         * @brief Calibrates the counter now, so that the first timed read does not pay for it.
+         */
+        static void calibrate()
+        {
+            (void)calibration_data();
+        }
+
+        /**
+         * @brief Converts a number of counts into nanoseconds.
+         *
+         * @param counts The number of counts.
+         * @return The duration.
+         */
+        [[nodiscard]] static duration to_duration(counter_type counts)
+        {
+            const auto& data = calibration_data();
+#if defined(__SIZEOF_INT128__)
+            const auto product = static_cast<unsigned __int128>(counts) * data.m_multiplier;
+            return duration(static_cast<rep>(product >> calibration_shift));
+#else
+            const counter_type seconds = counts / data.m_frequency;
+            const counter_type remainder = counts % data.m_frequency;
+            return duration(static_cast<rep>((seconds * nanoseconds_per_second)
+                + ((remainder * nanoseconds_per_second) / data.m_frequency)));
+#endif
+        }
+
+        /**
+         * @brief Measures the time between two counter readings.
+         *
+         * @param from The earlier reading.
+         * @param to The later reading.
+         * @return The elapsed time, exact as long as it is shorter than one counter wrap.
+         */
+        [[nodiscard]] static duration elapsed(counter_type from, counter_type to)
+        {
+            return to_duration((to - from) & counter_mask);
+        }
+
+        /**
+         * @brief Reads the clock.
+         *
+         * @return The current time point, counted from an unspecified epoch.
+         */
+        [[nodiscard]] static time_point now()
+        {
+#if defined(ESP_PLATFORM)
+            constexpr rep ns_per_us = 1000;
+            return time_point(duration(static_cast<rep>(esp_timer_get_time()) * ns_per_us));
+#else
+            return time_point(to_duration(counter()));
+#endif
+        }
+
+    private:
+        static constexpr std::uint64_t nanoseconds_per_second = 1000000000U;
+        static constexpr unsigned calibration_shift = 32U;
+
+        struct calibration
+        {
+            std::uint64_t m_frequency = nanoseconds_per_second;
+            std::uint64_t m_multiplier = std::uint64_t { 1U } << calibration_shift; ///< ns per count, fixed point.
+        };
+
+        static calibration make_calibration()
+        {
+            calibration data;
+#if defined(ESP_PLATFORM)
+            constexpr std::uint64_t us_per_second = 1000000U;
+            data.m_frequency = static_cast<std::uint64_t>(esp_rom_get_cpu_ticks_per_us()) * us_per_second;
+#elif defined(FREERTOS_PLATFORM)
+            data.m_frequency = static_cast<std::uint64_t>(configTICK_RATE_HZ);
+#elif (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+            // the invariant TSC runs at a fixed rate the OS does not report: measure it against steady_clock
+            constexpr auto calibration_window = std::chrono::milliseconds(5);
+            const auto steady_start = std::chrono::steady_clock::now();
+            const counter_type counter_start = counter();
+            std::this_thread::sleep_for(calibration_window);
+            const counter_type counter_end = counter();
+            const auto steady_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - steady_start)
+                                       .count();
+            if ((steady_ns > 0) && (counter_end > counter_start))
+            {
+                data.m_frequency = static_cast<std::uint64_t>(
+                    (static_cast<long double>(counter_end - counter_start) * nanoseconds_per_second) / steady_ns);
+            }
+#elif defined(__aarch64__)
+            std::uint64_t counter_frequency = 0U;
+            __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(counter_frequency));
+            data.m_frequency = (0U != counter_frequency) ? counter_frequency : nanoseconds_per_second;
+#endif
+            data.m_multiplier = static_cast<std::uint64_t>(
+                (static_cast<long double>(nanoseconds_per_second) * (std::uint64_t { 1U } << calibration_shift))
+                / data.m_frequency);
+            return data;
+        }
+
+        static const calibration& calibration_data()
+        {
+            static const calibration data = make_calibration();
+            return data;
+        }
+    };
+}
+
+#endif //  FAST_CLOCK_HPP_
@@ -0,0 +1,639 @@
+/**
+ * @file fixed_dsp.hpp
+ * @brief Fixed-point FFT and IIR/FIR filter kernels on fpm::fixed values, in integer arithmetic only.
+ *
+ * The FFT runs radix-4 stages (plus one radix-2 stage for odd powers of two) over twiddles computed at compile
+ * time, with block floating-point scaling: a stage that could overflow first shifts the whole block right and
+ * the shifts are returned as a block exponent. The biquad and FIR filters accumulate full-width products in 64
+ * bits and round once per output sample.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FIXED_DSP_HPP_)
+#define FIXED_DSP_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "fpm/fixed.hpp"
+#include "tools/fixed_trig_table.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        /**
+         * @brief Rounds a wide accumulator shifted right by shift bits and saturates it to the base type range.
+         */
+        template <typename B>
+        constexpr B round_saturate(std::int64_t accumulator, unsigned int shift) noexcept
+        {
+            const std::int64_t half = (0U == shift) ? 0 : (std::int64_t { 1 } << (shift - 1U));
+            const std::int64_t value = (accumulator + half) >> shift;
+            constexpr std::int64_t lowest = std::numeric_limits<B>::min();
+            constexpr std::int64_t highest = std::numeric_limits<B>::max();
+            return static_cast<B>((value < lowest) ? lowest : ((value > highest) ? highest : value));
+        }
+
+        template <typename Fixed>
+        using dsp_base_t = typename trig_fixed_traits<Fixed>::base_type;
+
+        template <typename Fixed>
+        constexpr bool dsp_supported_v = std::is_signed_v<dsp_base_t<Fixed>>
+            && (sizeof(dsp_base_t<Fixed>) <= sizeof(std::int32_t));
+    } // namespace detail
+
+    /**
+     * @brief In-place complex FFT of 2^Log2Size fpm::fixed samples with block floating-point scaling.
+     *
+     * The real and imaginary parts live in two arrays. Input is permuted in bit-reversed order, then combined by
+     * radix-4 decimation-in-time stages (three complex multiplies per four points), preceded by one radix-2
+     * stage when Log2Size is odd. Twiddles are a quarter sine wave of Q30 integers generated at compile time
+     * (table_bytes of read-only data); every product is 32 x 32 -> 64 bits, rounded once.
+     *
+     * Before each stage the largest magnitude of the block is compared with the headroom the stage needs (2 bits
+     * for radix-2, 3 for radix-4); when it is short, the whole block is shifted right (rounded) and the shift
+     * added to the block exponent. The true transform is the output times 2^exponent, so small signals keep their
+     * full resolution and large ones never wrap. The fixed-point format of the samples does not matter: the
+     * transform works on raw values.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     * @tparam Log2Size log2 of the number of points, 2 to 16.
+     */
+    template <typename Fixed, unsigned int Log2Size>
+    class fixed_fft
+    {
+        using base_type = detail::dsp_base_t<Fixed>;
+
+        static_assert(detail::dsp_supported_v<Fixed>, "fixed_fft needs a signed base type of at most 32 bits");
+        static_assert((Log2Size >= 2U) && (Log2Size <= 16U), "Log2Size must be in [2, 16]");
+
+        static constexpr unsigned int twiddle_bits = 30U;
+        static constexpr std::size_t quarter = std::size_t { 1U } << (Log2Size - 2U);
+
+    public:
+        /** @brief Number of points. */
+        static constexpr std::size_t size = std::size_t { 1U } << Log2Size;
+
+        /** @brief Storage used by the twiddle table. */
+        static constexpr std::size_t table_bytes = (quarter + 1U) * sizeof(std::int32_t);
+
+        /**
+         * @brief Forward transform, X[k] = sum of x[n] e^(-2 pi i k n / size).
+         * @param real Real parts, size values, replaced by the real parts of the spectrum.
+         * @param imag Imaginary parts, size values, replaced by the imaginary parts of the spectrum.
+         * @return The block exponent: the spectrum is the output times 2^exponent.
+         */
+        static int forward(Fixed* real, Fixed* imag) noexcept
+        {
+            bit_reverse(real, imag);
+
+            int exponent = 0;
+            std::size_t span = 1U;
+            if (0U != (Log2Size & 1U))
+            {
+                exponent += scale_block(real, imag, 2U);
+                radix2_stage(real, imag);
+                span = 2U;
+            }
+            for (; span < size; span *= 4U)
+            {
+                exponent += scale_block(real, imag, 3U);
+                radix4_stage(real, imag, span);
+            }
+            return exponent;
+        }
+
+        /**
+         * @brief Inverse transform, x[n] = (1 / size) sum of X[k] e^(2 pi i k n / size).
+         *
+         * Runs the forward transform on the swapped parts; the 1 / size factor goes into the exponent, so no
+         * precision is lost dividing.
+         *
+         * @param real Real parts of the spectrum, replaced by the real parts of the signal.
+         * @param imag Imaginary parts of the spectrum, replaced by the imaginary parts of the signal.
+         * @return The block exponent: the signal is the output times 2^exponent.
+         */
+        static int inverse(Fixed* real, Fixed* imag) noexcept
+        {
+            return forward(imag, real) - static_cast<int>(Log2Size);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span form of forward().
+         */
+        static int forward(std::span<Fixed, size> real, std::span<Fixed, size> imag) noexcept
+        {
+            return forward(real.data(), imag.data());
+        }
+
+        /**
+         * @brief Span form of inverse().
+         */
+        static int inverse(std::span<Fixed, size> real, std::span<Fixed, size> imag) noexcept
+        {
+            return inverse(real.data(), imag.data());
+        }
+#endif
+
+    private:
+        using table_type = std::array<std::int32_t, quarter + 1U>;
+
+        static constexpr table_type make_sine_table()
+        {
+            table_type table {};
+            for (std::size_t index = 0U; index <= quarter; ++index)
+            {
+                const long double angle = (detail::trig_table_pi / 2.0L) * static_cast<long double>(index)
+                    / static_cast<long double>(quarter);
+                table[index] = detail::round_to_raw<std::int32_t>(detail::constexpr_sin(angle), twiddle_bits);
+            }
+            return table;
+        }
+
+        static constexpr table_type sine_table = make_sine_table();
+
+        /**
+         * @brief sin(2 pi turn / size) in Q30 from the quarter-wave table.
+         */
+        static std::int64_t sine(std::size_t turn) noexcept
+        {
+            const std::size_t wrapped = turn & (size - 1U);
+            const std::size_t quadrant = wrapped / quarter;
+            std::size_t position = wrapped & (quarter - 1U);
+            if (0U != (quadrant & 1U))
+            {
+                position = quarter - position;
+            }
+            const std::int64_t value = sine_table[position]; // NOLINT position <= quarter
+            return (0U != (quadrant & 2U)) ? -value : value;
+        }
+
+        /**
+         * @brief A complex value of raw 64-bit parts.
+         */
+        struct complex_raw
+        {
+            std::int64_t re;
+            std::int64_t im;
+        };
+
+        /**
+         * @brief value * e^(-2 pi i turn / size), rounded back to the scale of value.
+         */
+        static complex_raw rotate(complex_raw value, std::size_t turn) noexcept
+        {
+            if (0U == turn)
+            {
+                return value;
+            }
+            const std::int64_t cosine = sine(turn + quarter);
+            const std::int64_t sinus = sine(turn);
+            constexpr std::int64_t half = std::int64_t { 1 } << (twiddle_bits - 1U);
+            return complex_raw { ((value.re * cosine) + (value.im * sinus) + half) >> twiddle_bits,
+                ((value.im * cosine) - (value.re * sinus) + half) >> twiddle_bits };
+        }
+
+        static complex_raw load(const Fixed* real, const Fixed* imag, std::size_t index) noexcept
+        {
+            return complex_raw { real[index].raw_value(), imag[index].raw_value() }; // NOLINT index < size
+        }
+
+        static void store(Fixed* real, Fixed* imag, std::size_t index, std::int64_t re, std::int64_t im) noexcept
+        {
+            // the headroom kept by scale_block guarantees the values fit
+            real[index] = Fixed::from_raw_value(static_cast<base_type>(re)); // NOLINT index < size
+            imag[index] = Fixed::from_raw_value(static_cast<base_type>(im)); // NOLINT index < size
+        }
+
+        static void bit_reverse(Fixed* real, Fixed* imag) noexcept
+        {
+            std::size_t reversed = 0U;
+            for (std::size_t index = 0U; index < size; ++index)
+            {
+                if (index < reversed)
+                {
+                    std::swap(real[index], real[reversed]); // NOLINT indices < size
+                    std::swap(imag[index], imag[reversed]); // NOLINT indices < size
+                }
+                // increment reversed as a mirrored binary counter
+                std::size_t bit = size >> 1U;
+                while ((0U != bit) && (0U != (reversed & bit)))
+                {
+                    reversed ^= bit;
+                    bit >>= 1U;
+                }
+                reversed |= bit;
+            }
+        }
+
+        /**
+         * @brief Shifts the block right until the next stage, growing values by up to 2^growth_bits, cannot
+         *        overflow the base type.
+         * @return The shift applied.
+         */
+        static int scale_block(Fixed* real, Fixed* imag, unsigned int growth_bits) noexcept
+        {
+            std::int64_t largest = 0;
+            for (std::size_t index = 0U; index < size; ++index)
+            {
+                const std::int64_t re = real[index].raw_value(); // NOLINT index < size
+                const std::int64_t im = imag[index].raw_value(); // NOLINT index < size
+                largest = std::max({ largest, (re < 0) ? -re : re, (im < 0) ? -im : im });
+            }
+
+            constexpr unsigned int value_bits = (sizeof(base_type) * 8U) - 1U;
+            const std::int64_t limit = std::int64_t { 1 } << (value_bits - growth_bits);
+            unsigned int shift = 0U;
+            while ((largest >> shift) >= limit)
+            {
+                ++shift;
+            }
+            if (0U != shift)
+            {
+                for (std::size_t index = 0U; index < size; ++index)
+                {
+                    const complex_raw value = load(real, imag, index);
+                    const std::int64_t half = std::int64_t { 1 } << (shift - 1U);
+                    store(real, imag, index, (value.re + half) >> shift, (value.im + half) >> shift);
+                }
+            }
+            return static_cast<int>(shift);
+        }
+
+        static void radix2_stage(Fixed* real, Fixed* imag) noexcept
+        {
+            for (std::size_t index = 0U; index < size; index += 2U)
+            {
+                const complex_raw even = load(real, imag, index);
+                const complex_raw odd = load(real, imag, index + 1U);
+                store(real, imag, index, even.re + odd.re, even.im + odd.im);
+                store(real, imag, index + 1U, even.re - odd.re, even.im - odd.im);
+            }
+        }
+
+        /**
+         * @brief Combines groups of four DFTs of span points into DFTs of 4 * span points.
+         *
+         * In bit-reversed order the four quarters of a group hold the sub-sequences of indices 0, 2, 1 and 3
+         * modulo 4.
+         */
+        static void radix4_stage(Fixed* real, Fixed* imag, std::size_t span) noexcept
+        {
+            const std::size_t group = 4U * span;
+            const std::size_t stride = size / group;
+            for (std::size_t base = 0U; base < size; base += group)
+            {
+                for (std::size_t offset = 0U; offset < span; ++offset)
+                {
+                    const std::size_t index0 = base + offset;
+                    const std::size_t turn = offset * stride;
+                    const complex_raw a0 = load(real, imag, index0);
+                    const complex_raw a2 = rotate(load(real, imag, index0 + span), 2U * turn);
+                    const complex_raw a1 = rotate(load(real, imag, index0 + (2U * span)), turn);
+                    const complex_raw a3 = rotate(load(real, imag, index0 + (3U * span)), 3U * turn);
+
+                    const complex_raw sum02 { a0.re + a2.re, a0.im + a2.im };
+                    const complex_raw diff02 { a0.re - a2.re, a0.im - a2.im };
+                    const complex_raw sum13 { a1.re + a3.re, a1.im + a3.im };
+                    // -i (a1 - a3)
+                    const complex_raw rot13 { a1.im - a3.im, a3.re - a1.re };
+
+                    store(real, imag, index0, sum02.re + sum13.re, sum02.im + sum13.im);
+                    store(real, imag, index0 + span, diff02.re + rot13.re, diff02.im + rot13.im);
+                    store(real, imag, index0 + (2U * span), sum02.re - sum13.re, sum02.im - sum13.im);
+                    store(real, imag, index0 + (3U * span), diff02.re - rot13.re, diff02.im - rot13.im);
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Coefficients of a biquad section, normalized so that a0 = 1.
+     *
+     * H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2). The Fixed type needs two integer bits for the
+     * usual |a1| < 2.
+     *
+     * @tparam Fixed fpm::fixed type of the coefficients.
+     */
+    template <typename Fixed>
+    struct fixed_biquad_coefficients
+    {
+        Fixed b0; ///< Feed-forward coefficient of x[n].
+        Fixed b1; ///< Feed-forward coefficient of x[n-1].
+        Fixed b2; ///< Feed-forward coefficient of x[n-2].
+        Fixed a1; ///< Feedback coefficient of y[n-1].
+        Fixed a2; ///< Feedback coefficient of y[n-2].
+    };
+
+    /**
+     * @brief Biquad IIR section in direct form I over fpm::fixed samples.
+     *
+     * Direct form I keeps the input and output histories at the sample precision, which suits fixed point: the
+     * five products are summed at full width in 64 bits and rounded once, and the output saturates instead of
+     * wrapping.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     */
+    template <typename Fixed>
+    class fixed_biquad
+    {
+        using base_type = detail::dsp_base_t<Fixed>;
+        static constexpr unsigned int fraction_bits = detail::trig_fixed_traits<Fixed>::fraction_bits;
+
+        static_assert(detail::dsp_supported_v<Fixed>, "fixed_biquad needs a signed base type of at most 32 bits");
+
+    public:
+        fixed_biquad() = default;
+
+        /**
+         * @brief Constructs a section at rest.
+         * @param coefficients The normalized coefficients.
+         */
+        explicit fixed_biquad(const fixed_biquad_coefficients<Fixed>& coefficients) noexcept
+            : m_b0(coefficients.b0.raw_value())
+            , m_b1(coefficients.b1.raw_value())
+            , m_b2(coefficients.b2.raw_value())
+            , m_a1(coefficients.a1.raw_value())
+            , m_a2(coefficients.a2.raw_value())
+        {
+        }
+
+        /**
+         * @brief Filters one sample.
+         * @param sample The input sample.
+         * @return The output sample.
+         */
+        Fixed process(Fixed sample) noexcept
+        {
+            const std::int64_t input = sample.raw_value();
+            const std::int64_t accumulator = (m_b0 * input) + (m_b1 * m_x1) + (m_b2 * m_x2) - (m_a1 * m_y1)
+                - (m_a2 * m_y2);
+            const base_type output = detail::round_saturate<base_type>(accumulator, fraction_bits);
+            m_x2 = m_x1;
+            m_x1 = input;
+            m_y2 = m_y1;
+            m_y1 = output;
+            return Fixed::from_raw_value(output);
+        }
+
+        /**
+         * @brief Filters a block of samples. out may alias input.
+         * @param input Input samples, oldest first.
+         * @param out Output samples.
+         * @param count Number of samples.
+         */
+        void process(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = process(input[index]); // NOLINT caller provides count elements
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span form of the block process(); processes the shorter of the two spans.
+         */
+        void process(std::span<const Fixed> input, std::span<Fixed> out) noexcept
+        {
+            process(input.data(), out.data(), std::min(input.size(), out.size()));
+        }
+#endif
+
+        /**
+         * @brief Clears the sample histories.
+         */
+        void reset() noexcept
+        {
+            m_x1 = 0;
+            m_x2 = 0;
+            m_y1 = 0;
+            m_y2 = 0;
+        }
+
+    private:
+        std::int64_t m_b0 = 0;
+        std::int64_t m_b1 = 0;
+        std::int64_t m_b2 = 0;
+        std::int64_t m_a1 = 0;
+        std::int64_t m_a2 = 0;
+        std::int64_t m_x1 = 0;
+        std::int64_t m_x2 = 0;
+        std::int64_t m_y1 = 0;
+        std::int64_t m_y2 = 0;
+    };
+
+    /**
+     * @brief Cascade of biquad sections, the usual way to run a higher-order IIR filter in fixed point.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     * @tparam SectionCount Number of sections.
+     */
+    template <typename Fixed, std::size_t SectionCount>
+    class fixed_biquad_cascade
+    {
+    public:
+        /**
+         * @brief Constructs the cascade at rest.
+         * @param sections The coefficients of each section, in processing order.
+         */
+        explicit fixed_biquad_cascade(const std::array<fixed_biquad_coefficients<Fixed>, SectionCount>& sections)
+        {
+            for (std::size_t index = 0U; index < SectionCount; ++index)
+            {
+                m_sections[index] = fixed_biquad<Fixed>(sections[index]);
+            }
+        }
+
+        /**
+         * @brief Filters one sample through every section.
+         * @param sample The input sample.
+         * @return The output sample.
+         */
+        Fixed process(Fixed sample) noexcept
+        {
+            for (auto& section : m_sections)
+            {
+                sample = section.process(sample);
+            }
+            return sample;
+        }
+
+        /**
+         * @brief Filters a block of samples, section by section. out may alias input.
+         * @param input Input samples, oldest first.
+         * @param out Output samples.
+         * @param count Number of samples.
+         */
+        void process(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            const Fixed* source = input;
+            for (auto& section : m_sections)
+            {
+                section.process(source, out, count);
+                source = out;
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span form of the block process(); processes the shorter of the two spans.
+         */
+        void process(std::span<const Fixed> input, std::span<Fixed> out) noexcept
+        {
+            process(input.data(), out.data(), std::min(input.size(), out.size()));
+        }
+#endif
+
+        /**
+         * @brief Clears the sample histories of every section.
+         */
+        void reset() noexcept
+        {
+            for (auto& section : m_sections)
+            {
+                section.reset();
+            }
+        }
+
+    private:
+        std::array<fixed_biquad<Fixed>, SectionCount> m_sections = {};
+    };
+
+    /**
+     * @brief Streaming FIR filter over fpm::fixed samples, y[n] = sum over k of coefficients[k] * x[n - k].
+     *
+     * Unlike the block fixed_batch::fir, the filter keeps the last Taps samples between calls, so a stream can be
+     * fed in blocks of any size. The delay line stores each sample twice, Taps apart, so that the window of every
+     * output is contiguous; products are summed at full width in 64 bits and rounded once, with saturation.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     * @tparam Taps Number of coefficients.
+     */
+    template <typename Fixed, std::size_t Taps>
+    class fixed_fir_filter
+    {
+        using base_type = detail::dsp_base_t<Fixed>;
+        static constexpr unsigned int fraction_bits = detail::trig_fixed_traits<Fixed>::fraction_bits;
+
+        static_assert(detail::dsp_supported_v<Fixed>, "fixed_fir_filter needs a signed base type of at most 32 bits");
+        static_assert(Taps >= 1U, "at least one tap is required");
+
+    public:
+        /**
+         * @brief Constructs a filter at rest.
+         * @param coefficients The taps, coefficients[0] applying to the newest sample.
+         */
+        explicit fixed_fir_filter(const std::array<Fixed, Taps>& coefficients) noexcept
+        {
+            // stored oldest first, to walk the window and the taps in the same direction
+            for (std::size_t tap = 0U; tap < Taps; ++tap)
+            {
+                m_coefficients[Taps - 1U - tap] = coefficients[tap].raw_value();
+            }
+        }
+
+        /**
+         * @brief Filters one sample.
+         * @param sample The input sample.
+         * @return The output sample.
+         */
+        Fixed process(Fixed sample) noexcept
+        {
+            const base_type raw = sample.raw_value();
+            m_history[m_position] = raw;
+            m_history[m_position + Taps] = raw;
+            m_position = (m_position + 1U == Taps) ? 0U : (m_position + 1U);
+
+            // the window starts at the oldest sample, which the next sample overwrites
+            const base_type* window = &m_history[m_position];
+            std::int64_t accumulator = 0;
+            for (std::size_t tap = 0U; tap < Taps; ++tap)
+            {
+                accumulator += m_coefficients[tap] * static_cast<std::int64_t>(window[tap]); // NOLINT tap < Taps
+            }
+            return Fixed::from_raw_value(detail::round_saturate<base_type>(accumulator, fraction_bits));
+        }
+
+        /**
+         * @brief Filters a block of samples. out may alias input.
+         * @param input Input samples, oldest first.
+         * @param out Output samples.
+         * @param count Number of samples.
+         */
+        void process(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = process(input[index]); // NOLINT caller provides count elements
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span form of the block process(); processes the shorter of the two spans.
+         */
+        void process(std::span<const Fixed> input, std::span<Fixed> out) noexcept
+        {
+            process(input.data(), out.data(), std::min(input.size(), out.size()));
+        }
+#endif
+
+        /**
+         * @brief Clears the delay line.
+         */
+        void reset() noexcept
+        {
+            m_history.fill(0);
+            m_position = 0U;
+        }
+
+    private:
+        std::array<std::int64_t, Taps> m_coefficients = {};
+        std::array<base_type, 2U * Taps> m_history = {};
+        std::size_t m_position = 0U;
+    };
+
+} // namespace tools
+
+#endif // FIXED_DSP_HPP_
@@ -0,0 +1,342 @@
+/**
+ * @file fixed_layout_codec.hpp
+ * @brief Compile-time field list codec encoding fixed-size messages in the bytepack wire format.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FIXED_LAYOUT_CODEC_HPP_)
+#define FIXED_LAYOUT_CODEC_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace tools
+{
+    namespace detail
+    {
+        template <typename M>
+        struct codec_member_traits;
+
+        template <typename C, typename F>
+        struct codec_member_traits<F C::*>
+        {
+            using class_type = C;
+            using field_type = F;
+        };
+
+        template <auto Member>
+        using codec_field_t = typename codec_member_traits<decltype(Member)>::field_type;
+
+        template <typename F>
+        inline constexpr bool is_codec_scalar_v
+            = (std::is_arithmetic_v<F> || std::is_enum_v<F>) && !std::is_same_v<F, bool>;
+
+        /**
+         * @brief Element type and count of a field: a scalar, or a C array or std::array of scalars.
+         */
+        template <typename F>
+        struct codec_field_traits
+        {
+            static constexpr bool supported = is_codec_scalar_v<F>;
+            using element_type = F;
+            static constexpr std::size_t count = 1U;
+        };
+
+        template <typename E, std::size_t N>
+        struct codec_field_traits<E[N]> // NOLINT C arrays are valid message fields
+        {
+            static constexpr bool supported = is_codec_scalar_v<E>;
+            using element_type = E;
+            static constexpr std::size_t count = N;
+        };
+
+        template <typename E, std::size_t N>
+        struct codec_field_traits<std::array<E, N>>
+        {
+            static constexpr bool supported = is_codec_scalar_v<E>;
+            using element_type = E;
+            static constexpr std::size_t count = N;
+        };
+
+        /**
+         * @brief Reverses in place the bytes of every element of an encoded field when the endianness differs.
+         */
+        template <std::endian BufferEndian, typename F>
+        void swap_codec_field(std::uint8_t* bytes) noexcept
+        {
+            using traits = codec_field_traits<F>;
+            constexpr std::size_t element_size = sizeof(typename traits::element_type);
+
+            if constexpr ((BufferEndian != std::endian::native) && (element_size > 1U))
+            {
+                for (std::size_t i = 0U; i < traits::count; ++i)
+                {
+                    std::uint8_t* element = bytes + (i * element_size); // NOLINT pointer arithmetic
+                    std::reverse(element, element + element_size);      // NOLINT pointer arithmetic
+                }
+            }
+            else
+            {
+                (void)bytes;
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Fixed-size encoder/decoder for a struct described by a compile-time list of member pointers.
+     *
+     * The fields are laid out back to back in list order, each in the given endianness, like
+     * bytepack::binary_stream::write(fields...) does for the same scalar and array fields: a message encoded
+     * here can be decoded by binary_stream and the other way around. Supported fields are arithmetic types
+     * (except bool), enums, and C arrays or std::array of those.
+     *
+     * The size and every field offset are compile-time constants, so encode() and decode() do a single
+     * bounds check per message. When the struct is trivially copyable and the list covers its members in
+     * declaration order without padding, the whole message is copied with one memcpy, followed by in-place
+     * byte swaps when the wire endianness is not the native one. This layout is verified once per
+     * instantiation, the first time it is needed (member pointer offsets are not constant expressions).
+     *
+     * @code
+     * using sample_codec = tools::fixed_layout_codec<sample, &sample::id, &sample::value, &sample::flags>;
+     * std::array<std::uint8_t, sample_codec::encoded_size> frame;
+     * sample_codec::encode(item, frame.data(), frame.size());
+     * @endcode
+     *
+     * @tparam T Message struct.
+     * @tparam Members Pointers to the data members of T, in wire order.
+     */
+    template <typename T, auto... Members>
+    class fixed_layout_codec
+    {
+        static_assert(sizeof...(Members) > 0U, "a message needs at least one field");
+        static_assert((std::is_same_v<typename detail::codec_member_traits<decltype(Members)>::class_type, T> && ...),
+            "every field must be a data member pointer of the message type");
+        static_assert((detail::codec_field_traits<detail::codec_field_t<Members>>::supported && ...),
+            "fields must be arithmetic types, enums, or arrays of those");
+
+    public:
+        /** @brief Number of bytes of an encoded message. */
+        static constexpr std::size_t encoded_size = (sizeof(detail::codec_field_t<Members>) + ...);
+
+        /** @brief Number of fields. */
+        static constexpr std::size_t field_count = sizeof...(Members);
+
+        /**
+         * @brief Encodes a message.
+         *
+         * @tparam BufferEndian Wire endianness, network order by default.
+         * @param value Message to encode.
+         * @param destination Output buffer.
+         * @param capacity Size of the output buffer.
+         * @return true when the message was encoded, false if the buffer is shorter than encoded_size.
+         */
+        template <std::endian BufferEndian = std::endian::big>
+        static bool encode(const T& value, std::uint8_t* destination, std::size_t capacity) noexcept
+        {
+            if ((nullptr == destination) || (capacity < encoded_size))
+            {
+                return false;
+            }
+
+            if constexpr (memcpy_candidate)
+            {
+                if (is_memcpy_layout())
+                {
+                    std::memcpy(destination, &value, encoded_size);
+                    swap_fields<BufferEndian>(destination, std::index_sequence_for<decltype(Members)...> {});
+                    return true;
+                }
+            }
+
+            encode_fields<BufferEndian>(value, destination, std::index_sequence_for<decltype(Members)...> {});
+            return true;
+        }
+
+        /**
+         * @brief Encodes a message into a span (see encode()).
+         */
+        template <std::endian BufferEndian = std::endian::big>
+        static bool encode(const T& value, std::span<std::uint8_t> destination) noexcept
+        {
+            return encode<BufferEndian>(value, destination.data(), destination.size());
+        }
+
+        /**
+         * @brief Encodes a message into an array of exactly encoded_size bytes.
+         *
+         * @tparam BufferEndian Wire endianness, network order by default.
+         * @param value Message to encode.
+         * @return The encoded bytes.
+         */
+        template <std::endian BufferEndian = std::endian::big>
+        static std::array<std::uint8_t, encoded_size> encode(const T& value) noexcept
+        {
+            std::array<std::uint8_t, encoded_size> bytes;
+            static_cast<void>(encode<BufferEndian>(value, bytes.data(), bytes.size()));
+            return bytes;
+        }
+
+        /**
+         * @brief Decodes a message.
+         *
+         * Fields of value not listed in Members are left untouched.
+         *
+         * @tparam BufferEndian Wire endianness, network order by default.
+         * @param source Encoded bytes.
+         * @param size Number of bytes available at source.
+         * @param value Message receiving the fields.
+         * @return true when the message was decoded, false if fewer than encoded_size bytes are available.
+         */
+        template <std::endian BufferEndian = std::endian::big>
+        static bool decode(const std::uint8_t* source, std::size_t size, T& value) noexcept
+        {
+            if ((nullptr == source) || (size < encoded_size))
+            {
+                return false;
+            }
+
+            if constexpr (memcpy_candidate)
+            {
+                if (is_memcpy_layout())
+                {
+                    std::memcpy(&value, source, encoded_size);
+                    auto* bytes = reinterpret_cast<std::uint8_t*>(&value); // NOLINT object representation
+                    swap_fields<BufferEndian>(bytes, std::index_sequence_for<decltype(Members)...> {});
+                    return true;
+                }
+            }
+
+            decode_fields<BufferEndian>(source, value, std::index_sequence_for<decltype(Members)...> {});
+            return true;
+        }
+
+        /**
+         * @brief Decodes a message from a span (see decode()).
+         */
+        template <std::endian BufferEndian = std::endian::big>
+        static bool decode(std::span<const std::uint8_t> source, T& value) noexcept
+        {
+            return decode<BufferEndian>(source.data(), source.size(), value);
+        }
+
+        /**
+         * @brief Tells whether the message is copied with a single memcpy.
+         *
+         * @return true when T is trivially copyable and the fields cover it in order without padding.
+         */
+        [[nodiscard]] static bool is_memcpy_layout() noexcept
+        {
+            if constexpr (memcpy_candidate)
+            {
+                static const bool same_layout = check_memcpy_layout();
+                return same_layout;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+    private:
+        static constexpr std::array<std::size_t, field_count> sizes = { sizeof(detail::codec_field_t<Members>)... };
+
+        static constexpr std::array<std::size_t, field_count> offsets = []()
+        {
+            std::array<std::size_t, field_count> result {};
+            std::size_t offset = 0U;
+            for (std::size_t i = 0U; i < field_count; ++i)
+            {
+                result[i] = offset;
+                offset += sizes[i]; // NOLINT index bounded by field_count
+            }
+            return result;
+        }();
+
+        static constexpr bool memcpy_candidate = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>
+            && std::is_default_constructible_v<T> && (sizeof(T) == encoded_size);
+
+        static bool check_memcpy_layout() noexcept
+        {
+            const T probe {};
+            const auto* base = reinterpret_cast<const std::uint8_t*>(&probe); // NOLINT address arithmetic
+            const std::array<const std::uint8_t*, field_count> fields
+                = { reinterpret_cast<const std::uint8_t*>(&(probe.*Members))... }; // NOLINT address arithmetic
+
+            for (std::size_t i = 0U; i < field_count; ++i)
+            {
+                if (fields[i] != (base + offsets[i])) // NOLINT index bounded by field_count
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <std::endian BufferEndian, std::size_t... I>
+        static void encode_fields(const T& value, std::uint8_t* destination, std::index_sequence<I...> /*unused*/)
+        {
+            ((std::memcpy(destination + offsets[I], &(value.*Members), sizes[I]), // NOLINT pointer arithmetic
+                 detail::swap_codec_field<BufferEndian, detail::codec_field_t<Members>>(destination + offsets[I])),
+                ...);
+        }
+
+        template <std::endian BufferEndian, std::size_t... I>
+        static void decode_fields(const std::uint8_t* source, T& value, std::index_sequence<I...> /*unused*/)
+        {
+            ((std::memcpy(&(value.*Members), source + offsets[I], sizes[I]), // NOLINT pointer arithmetic
+                 detail::swap_codec_field<BufferEndian, detail::codec_field_t<Members>>(
+                     reinterpret_cast<std::uint8_t*>(&(value.*Members)))), // NOLINT field bytes
+                ...);
+        }
+
+        template <std::endian BufferEndian, std::size_t... I>
+        static void swap_fields(std::uint8_t* bytes, std::index_sequence<I...> /*unused*/)
+        {
+            (detail::swap_codec_field<BufferEndian, detail::codec_field_t<Members>>(bytes + offsets[I]), ...); // NOLINT
+        }
+    };
+
+} // namespace tools
+
+#endif // C++20
+
+#endif //  FIXED_LAYOUT_CODEC_HPP_
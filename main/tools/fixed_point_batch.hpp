@@ -0,0 +1,408 @@
+/**
+ * @file fixed_point_batch.hpp
+ * @brief Batch kernels over arrays of fpm::fixed values (add, mul, mul-accumulate, dot product, FIR, sqrt, sin, cos).
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FIXED_POINT_BATCH_HPP_)
+#define FIXED_POINT_BATCH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define FIXED_POINT_BATCH_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FIXED_POINT_BATCH_NEON
+#endif
+
+#include "fpm/fixed.hpp"
+#include "fpm/math.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Batch kernels over arrays of fpm::fixed values.
+     *
+     * Every kernel is bit-exact with the equivalent loop over the scalar fpm operators and functions:
+     * products go through fpm::fixed::operator*, with its rounding, and sums of products are accumulated with
+     * wrapping raw-value additions. Two's complement addition being associative, dot products and FIR outputs
+     * can be summed over four independent lanes (no loop-carried dependency beyond one lane) and still match
+     * the sequential sum. Element-wise add/sub of 32-bit values use SSE2 or NEON when available; the other
+     * kernels are unrolled for the compiler to pipeline or vectorize on the target.
+     *
+     * Arrays must not overlap unless stated; counts are in elements. The C++20 span overloads need the
+     * fixed type spelled out, e.g. `tools::fixed_batch::dot<fpm::fixed_16_16>(lhs, rhs)`.
+     */
+    namespace fixed_batch
+    {
+        namespace detail
+        {
+            constexpr std::size_t lane_count = 4U;
+
+            template <typename Fixed>
+            struct fixed_traits;
+
+            template <typename B, typename I, unsigned int F, bool R>
+            struct fixed_traits<fpm::fixed<B, I, F, R>>
+            {
+                using base_type = B;
+                using accumulator_type = std::make_unsigned_t<B>;
+                static constexpr bool simd_int32 = std::is_same_v<B, std::int32_t>
+                    && (sizeof(fpm::fixed<B, I, F, R>) == sizeof(std::int32_t))
+                    && std::is_standard_layout_v<fpm::fixed<B, I, F, R>>;
+            };
+
+            template <typename Fixed>
+            using accumulator_t = typename fixed_traits<Fixed>::accumulator_type;
+
+            template <typename Fixed>
+            accumulator_t<Fixed> raw_bits(const Fixed& value) noexcept
+            {
+                return static_cast<accumulator_t<Fixed>>(value.raw_value());
+            }
+
+            template <typename Fixed>
+            Fixed from_bits(accumulator_t<Fixed> bits) noexcept
+            {
+                return Fixed::from_raw_value(static_cast<typename fixed_traits<Fixed>::base_type>(bits));
+            }
+
+            /**
+             * @brief Element-wise a + b (Subtract false) or a - b (Subtract true).
+             */
+            template <bool Subtract, typename Fixed>
+            void add_or_sub(const Fixed* lhs, const Fixed* rhs, Fixed* out, std::size_t count) noexcept
+            {
+                std::size_t index = 0U;
+
+#if defined(FIXED_POINT_BATCH_SSE2) || defined(FIXED_POINT_BATCH_NEON)
+                if constexpr (fixed_traits<Fixed>::simd_int32)
+                {
+                    for (; (index + lane_count) <= count; index += lane_count)
+                    {
+#if defined(FIXED_POINT_BATCH_SSE2)
+                        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index)); // NOLINT
+                        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index)); // NOLINT
+                        const __m128i result = Subtract ? _mm_sub_epi32(left, right) : _mm_add_epi32(left, right);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), result); // NOLINT
+#else
+                        const int32x4_t left = vld1q_s32(reinterpret_cast<const std::int32_t*>(lhs + index)); // NOLINT
+                        const int32x4_t right = vld1q_s32(reinterpret_cast<const std::int32_t*>(rhs + index)); // NOLINT
+                        const int32x4_t result = Subtract ? vsubq_s32(left, right) : vaddq_s32(left, right);
+                        vst1q_s32(reinterpret_cast<std::int32_t*>(out + index), result); // NOLINT
+#endif
+                    }
+                }
+#endif
+
+                for (; index < count; ++index)
+                {
+                    const auto left = raw_bits(lhs[index]); // NOLINT caller provides count elements
+                    const auto right = raw_bits(rhs[index]); // NOLINT caller provides count elements
+                    out[index] = from_bits<Fixed>(Subtract ? (left - right) : (left + right)); // NOLINT
+                }
+            }
+        } // namespace detail
+
+        /**
+         * @brief Element-wise sum: out[i] = lhs[i] + rhs[i]. out may alias lhs or rhs.
+         * @param lhs Left operands.
+         * @param rhs Right operands.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void add(const Fixed* lhs, const Fixed* rhs, Fixed* out, std::size_t count) noexcept
+        {
+            detail::add_or_sub<false>(lhs, rhs, out, count);
+        }
+
+        /**
+         * @brief Element-wise difference: out[i] = lhs[i] - rhs[i]. out may alias lhs or rhs.
+         * @param lhs Left operands.
+         * @param rhs Right operands.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void sub(const Fixed* lhs, const Fixed* rhs, Fixed* out, std::size_t count) noexcept
+        {
+            detail::add_or_sub<true>(lhs, rhs, out, count);
+        }
+
+        /**
+         * @brief Element-wise product: out[i] = lhs[i] * rhs[i]. out may alias lhs or rhs.
+         * @param lhs Left operands.
+         * @param rhs Right operands.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void mul(const Fixed* lhs, const Fixed* rhs, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = lhs[index] * rhs[index]; // NOLINT caller provides count elements
+            }
+        }
+
+        /**
+         * @brief Element-wise multiply-accumulate: accumulator[i] += lhs[i] * rhs[i].
+         * @param lhs Left operands.
+         * @param rhs Right operands.
+         * @param accumulator Values updated in place.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void mul_accumulate(const Fixed* lhs, const Fixed* rhs, Fixed* accumulator, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                // NOLINTNEXTLINE caller provides count elements
+                accumulator[index] = detail::from_bits<Fixed>(
+                    detail::raw_bits(accumulator[index]) + detail::raw_bits(lhs[index] * rhs[index]));
+            }
+        }
+
+        /**
+         * @brief Dot product: sum of lhs[i] * rhs[i], every product rounded as by fpm::fixed::operator*.
+         * @param lhs Left operands.
+         * @param rhs Right operands.
+         * @param count Number of elements.
+         * @return The sum (wrapping like repeated operator+=).
+         */
+        template <typename Fixed>
+        [[nodiscard]] Fixed dot(const Fixed* lhs, const Fixed* rhs, std::size_t count) noexcept
+        {
+            using accumulator = detail::accumulator_t<Fixed>;
+            std::array<accumulator, detail::lane_count> lanes {};
+
+            std::size_t index = 0U;
+            for (; (index + detail::lane_count) <= count; index += detail::lane_count)
+            {
+                for (std::size_t lane = 0U; lane < detail::lane_count; ++lane)
+                {
+                    // NOLINTNEXTLINE caller provides count elements
+                    lanes[lane] += detail::raw_bits(lhs[index + lane] * rhs[index + lane]);
+                }
+            }
+
+            accumulator total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            for (; index < count; ++index)
+            {
+                total += detail::raw_bits(lhs[index] * rhs[index]); // NOLINT caller provides count elements
+            }
+            return detail::from_bits<Fixed>(total);
+        }
+
+        /**
+         * @brief FIR filter over a block: out[n] = sum over k of coefficients[k] * input[n + taps - 1 - k].
+         *
+         * Only outputs whose taps all fall inside the block are produced. To filter a stream, carry the
+         * last taps - 1 input samples over to the front of the next block.
+         *
+         * @param coefficients Filter taps, coefficients[0] applying to the newest sample.
+         * @param taps Number of taps.
+         * @param input Input samples, oldest first.
+         * @param input_count Number of input samples.
+         * @param out Receives input_count - taps + 1 outputs; must not overlap input.
+         * @return Number of outputs written (0 when input_count < taps or taps == 0).
+         */
+        template <typename Fixed>
+        std::size_t fir(const Fixed* coefficients, std::size_t taps, const Fixed* input, std::size_t input_count,
+            Fixed* out) noexcept
+        {
+            if ((0U == taps) || (input_count < taps))
+            {
+                return 0U;
+            }
+
+            using accumulator = detail::accumulator_t<Fixed>;
+            const std::size_t output_count = input_count - taps + 1U;
+            const Fixed* newest = input + (taps - 1U); // NOLINT pointer arithmetic
+
+            // Four outputs per pass share every coefficient load.
+            std::size_t output = 0U;
+            for (; (output + detail::lane_count) <= output_count; output += detail::lane_count)
+            {
+                std::array<accumulator, detail::lane_count> lanes {};
+                for (std::size_t tap = 0U; tap < taps; ++tap)
+                {
+                    const Fixed coefficient = coefficients[tap]; // NOLINT caller provides taps coefficients
+                    const Fixed* samples = newest + output - tap; // NOLINT pointer arithmetic
+                    for (std::size_t lane = 0U; lane < detail::lane_count; ++lane)
+                    {
+                        lanes[lane] += detail::raw_bits(coefficient * samples[lane]); // NOLINT bounded by output_count
+                    }
+                }
+                for (std::size_t lane = 0U; lane < detail::lane_count; ++lane)
+                {
+                    out[output + lane] = detail::from_bits<Fixed>(lanes[lane]); // NOLINT bounded by output_count
+                }
+            }
+
+            for (; output < output_count; ++output)
+            {
+                accumulator sum = 0U;
+                for (std::size_t tap = 0U; tap < taps; ++tap)
+                {
+                    sum += detail::raw_bits(coefficients[tap] * newest[output - tap]); // NOLINT bounded indices
+                }
+                out[output] = detail::from_bits<Fixed>(sum); // NOLINT bounded by output_count
+            }
+
+            return output_count;
+        }
+
+        /**
+         * @brief Element-wise square root (fpm::sqrt). out may alias input.
+         * @param input Non-negative values.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void sqrt(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = fpm::sqrt(input[index]); // NOLINT caller provides count elements
+            }
+        }
+
+        /**
+         * @brief Element-wise sine (fpm::sin). out may alias input.
+         * @param input Angles in radians.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void sin(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = fpm::sin(input[index]); // NOLINT caller provides count elements
+            }
+        }
+
+        /**
+         * @brief Element-wise cosine (fpm::cos). out may alias input.
+         * @param input Angles in radians.
+         * @param out Results.
+         * @param count Number of elements.
+         */
+        template <typename Fixed>
+        void cos(const Fixed* input, Fixed* out, std::size_t count) noexcept
+        {
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                out[index] = fpm::cos(input[index]); // NOLINT caller provides count elements
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span form of add(); processes the shortest of the three spans.
+         */
+        template <typename Fixed>
+        void add(std::span<const Fixed> lhs, std::span<const Fixed> rhs, std::span<Fixed> out) noexcept
+        {
+            add(lhs.data(), rhs.data(), out.data(), std::min({ lhs.size(), rhs.size(), out.size() }));
+        }
+
+        /**
+         * @brief Span form of sub(); processes the shortest of the three spans.
+         */
+        template <typename Fixed>
+        void sub(std::span<const Fixed> lhs, std::span<const Fixed> rhs, std::span<Fixed> out) noexcept
+        {
+            sub(lhs.data(), rhs.data(), out.data(), std::min({ lhs.size(), rhs.size(), out.size() }));
+        }
+
+        /**
+         * @brief Span form of mul(); processes the shortest of the three spans.
+         */
+        template <typename Fixed>
+        void mul(std::span<const Fixed> lhs, std::span<const Fixed> rhs, std::span<Fixed> out) noexcept
+        {
+            mul(lhs.data(), rhs.data(), out.data(), std::min({ lhs.size(), rhs.size(), out.size() }));
+        }
+
+        /**
+         * @brief Span form of mul_accumulate(); processes the shortest of the three spans.
+         */
+        template <typename Fixed>
+        void mul_accumulate(
+            std::span<const Fixed> lhs, std::span<const Fixed> rhs, std::span<Fixed> accumulator) noexcept
+        {
+            mul_accumulate(
+                lhs.data(), rhs.data(), accumulator.data(), std::min({ lhs.size(), rhs.size(), accumulator.size() }));
+        }
+
+        /**
+         * @brief Span form of dot(); processes the shorter of the two spans.
+         */
+        template <typename Fixed>
+        [[nodiscard]] Fixed dot(std::span<const Fixed> lhs, std::span<const Fixed> rhs) noexcept
+        {
+            return dot(lhs.data(), rhs.data(), std::min(lhs.size(), rhs.size()));
+        }
+
+        /**
+         * @brief Span form of fir(); out must hold input.size() - coefficients.size() + 1 values.
+         * @return Number of outputs written, 0 if out is too small.
+         */
+        template <typename Fixed>
+        std::size_t fir(
+            std::span<const Fixed> coefficients, std::span<const Fixed> input, std::span<Fixed> out) noexcept
+        {
+            if ((input.size() >= coefficients.size()) && (out.size() < (input.size() - coefficients.size() + 1U)))
+            {
+                return 0U;
+            }
+            return fir(coefficients.data(), coefficients.size(), input.data(), input.size(), out.data());
+        }
+#endif
+
+    } // namespace fixed_batch
+} // namespace tools
+
+#endif // FIXED_POINT_BATCH_HPP_
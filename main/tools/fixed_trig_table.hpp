@@ -0,0 +1,297 @@
+/**
+ * @file fixed_trig_table.hpp
+ * @brief Compile-time lookup tables for fast sin, cos and atan2 on fpm::fixed values.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FIXED_TRIG_TABLE_HPP_)
+#define FIXED_TRIG_TABLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "fpm/fixed.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        constexpr long double trig_table_pi = 3.141592653589793238462643383279502884L;
+
+        /**
+         * @brief Taylor series sine, accurate to long double precision on [0, pi/2].
+         */
+        constexpr long double constexpr_sin(long double angle)
+        {
+            const long double squared = angle * angle;
+            long double term = angle;
+            long double sum = angle;
+            for (int order = 1; order < 16; ++order)
+            {
+                term = -term * squared / static_cast<long double>((2 * order) * ((2 * order) + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Arctangent on [0, 1]: atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))) brings the argument under
+         *        tan(pi/8), where the alternating series converges quickly.
+         */
+        constexpr long double constexpr_atan_unit(long double value)
+        {
+            // Newton iterations for sqrt(1 + x^2), which lies in [1, sqrt(2)]
+            const long double radicand = 1.0L + (value * value);
+            long double root = 1.2L;
+            for (int iteration = 0; iteration < 8; ++iteration)
+            {
+                root = 0.5L * (root + (radicand / root));
+            }
+
+            const long double reduced = value / (1.0L + root);
+            const long double squared = reduced * reduced;
+            long double power = reduced;
+            long double sum = reduced;
+            for (int order = 1; order < 24; ++order)
+            {
+                power = -power * squared;
+                sum += power / static_cast<long double>((2 * order) + 1);
+            }
+            return 2.0L * sum;
+        }
+
+        /**
+         * @brief Rounds value * 2^fraction_bits to the nearest integer.
+         */
+        template <typename B>
+        constexpr B round_to_raw(long double value, unsigned int fraction_bits)
+        {
+            const long double scaled = value * static_cast<long double>(std::uint64_t { 1U } << fraction_bits);
+            return static_cast<B>((scaled >= 0.0L) ? (scaled + 0.5L) : (scaled - 0.5L));
+        }
+
+        template <typename Fixed>
+        struct trig_fixed_traits;
+
+        template <typename B, typename I, unsigned int F, bool R>
+        struct trig_fixed_traits<fpm::fixed<B, I, F, R>>
+        {
+            using base_type = B;
+            static constexpr unsigned int fraction_bits = F;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Table-driven sin, cos and atan2 for an fpm::fixed type, a faster alternative to the polynomial
+     *        fpm::sin, fpm::cos and fpm::atan2.
+     *
+     * Two tables of (1 << TableBits) + 1 raw values are computed at compile time: a quarter sine wave over
+     * [0, pi/2] and atan over [0, 1]. Being constexpr data they land in read-only storage (flash on the ESP32,
+     * read through the cache); table_bytes gives their footprint. The angle is reduced with one multiply to a
+     * 32-bit binary angle, so there is no fmod and no division in sin/cos; atan2 needs one integer division
+     * for the y/x ratio. Each call reads one or two entries and, with Interpolate, interpolates linearly.
+     *
+     * With the default 256 intervals and fixed_16_16, sin/cos stay within 3e-5 of the exact value when
+     * interpolated (1.5e-5 is the format's own rounding) and within 4e-3 otherwise; atan2 within 3e-5.
+     * Range reduction is exact to a few units of 2^-32 turn per unit of angle: large angles lose accuracy.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits and at most 29 fraction bits.
+     * @tparam TableBits log2 of the number of table intervals, 1 to 12.
+     * @tparam Interpolate Linear interpolation between entries (true) or nearest entry (false).
+     */
+    template <typename Fixed, unsigned int TableBits = 8U, bool Interpolate = true>
+    class fixed_trig_table
+    {
+        using base_type = typename detail::trig_fixed_traits<Fixed>::base_type;
+        static constexpr unsigned int fraction_bits = detail::trig_fixed_traits<Fixed>::fraction_bits;
+
+        static_assert(std::is_signed_v<base_type> && (sizeof(base_type) <= sizeof(std::int32_t)),
+            "fixed_trig_table needs a signed base type of at most 32 bits");
+        static_assert(((fraction_bits + 3U) <= (sizeof(base_type) * 8U)), "pi must be representable");
+        static_assert((TableBits >= 1U) && (TableBits <= 12U), "TableBits must be in [1, 12]");
+
+        /** @brief Bits of the position within a quadrant (binary angle) or of the atan2 ratio. */
+        static constexpr unsigned int position_bits = 30U;
+        static constexpr unsigned int fraction_shift = position_bits - TableBits;
+        static constexpr std::uint32_t quarter_turn = std::uint32_t { 1U } << position_bits;
+
+    public:
+        /** @brief Number of entries of each table. */
+        static constexpr std::size_t table_entries = (std::size_t { 1U } << TableBits) + 1U;
+
+        /** @brief Storage used by the two tables. */
+        static constexpr std::size_t table_bytes = 2U * table_entries * sizeof(base_type);
+
+        /**
+         * @brief Sine.
+         * @param angle Angle in radians.
+         * @return sin(angle).
+         */
+        [[nodiscard]] static Fixed sin(Fixed angle) noexcept
+        {
+            return Fixed::from_raw_value(sine_of(binary_angle(angle)));
+        }
+
+        /**
+         * @brief Cosine.
+         * @param angle Angle in radians.
+         * @return cos(angle).
+         */
+        [[nodiscard]] static Fixed cos(Fixed angle) noexcept
+        {
+            return Fixed::from_raw_value(sine_of(binary_angle(angle) + quarter_turn));
+        }
+
+        /**
+         * @brief Four-quadrant arctangent of y / x.
+         * @param y_value Ordinate.
+         * @param x_value Abscissa.
+         * @return Angle in [-pi, pi], 0 when both arguments are 0.
+         */
+        [[nodiscard]] static Fixed atan2(Fixed y_value, Fixed x_value) noexcept
+        {
+            const std::int64_t y_raw = y_value.raw_value();
+            const std::int64_t x_raw = x_value.raw_value();
+            const auto y_abs = static_cast<std::uint64_t>((y_raw < 0) ? -y_raw : y_raw);
+            const auto x_abs = static_cast<std::uint64_t>((x_raw < 0) ? -x_raw : x_raw);
+            if ((0U == y_abs) && (0U == x_abs))
+            {
+                return Fixed::from_raw_value(0);
+            }
+
+            const bool steep = y_abs > x_abs;
+            const std::uint64_t numerator = steep ? x_abs : y_abs;
+            const std::uint64_t denominator = steep ? y_abs : x_abs;
+            const auto ratio = static_cast<std::uint32_t>((numerator << position_bits) / denominator);
+
+            std::int64_t angle = lookup(atan_table, ratio);
+            angle = steep ? (half_pi_raw - angle) : angle;
+            angle = (x_raw < 0) ? (pi_raw - angle) : angle;
+            angle = (y_raw < 0) ? -angle : angle;
+            return Fixed::from_raw_value(static_cast<base_type>(angle));
+        }
+
+    private:
+        using table_type = std::array<base_type, table_entries>;
+
+        static constexpr table_type make_sine_table()
+        {
+            table_type table {};
+            for (std::size_t index = 0U; index < table_entries; ++index)
+            {
+                const long double angle = (detail::trig_table_pi / 2.0L) * static_cast<long double>(index)
+                    / static_cast<long double>(table_entries - 1U);
+                table[index] = detail::round_to_raw<base_type>(detail::constexpr_sin(angle), fraction_bits);
+            }
+            return table;
+        }
+
+        static constexpr table_type make_atan_table()
+        {
+            table_type table {};
+            for (std::size_t index = 0U; index < table_entries; ++index)
+            {
+                const long double ratio
+                    = static_cast<long double>(index) / static_cast<long double>(table_entries - 1U);
+                table[index] = detail::round_to_raw<base_type>(detail::constexpr_atan_unit(ratio), fraction_bits);
+            }
+            return table;
+        }
+
+        static constexpr table_type sine_table = make_sine_table();
+        static constexpr table_type atan_table = make_atan_table();
+
+        static constexpr std::int64_t pi_raw = detail::round_to_raw<std::int64_t>(detail::trig_table_pi, fraction_bits);
+        static constexpr std::int64_t half_pi_raw
+            = detail::round_to_raw<std::int64_t>(detail::trig_table_pi / 2.0L, fraction_bits);
+
+        /** @brief round(2^32 / (2 pi)): radians in Q(fraction_bits) times this, shifted, give a binary angle. */
+        static constexpr std::int64_t turn_scale = 683565276;
+
+        /**
+         * @brief Converts radians to a binary angle (a full turn is 2^32), reduced modulo one turn.
+         */
+        static std::uint32_t binary_angle(Fixed angle) noexcept
+        {
+            // arithmetic shift floors negative angles, and the unsigned conversion wraps to the turn
+            const std::int64_t scaled = static_cast<std::int64_t>(angle.raw_value()) * turn_scale;
+            return static_cast<std::uint32_t>(static_cast<std::uint64_t>(scaled >> fraction_bits));
+        }
+
+        /**
+         * @brief Reads a table at a position in [0, 2^position_bits].
+         */
+        static std::int64_t lookup(const table_type& table, std::uint32_t position) noexcept
+        {
+            if constexpr (Interpolate)
+            {
+                const std::uint32_t index = position >> fraction_shift;
+                if (index >= (table_entries - 1U))
+                {
+                    return table[table_entries - 1U];
+                }
+                const std::int64_t low = table[index];       // NOLINT bounded index
+                const std::int64_t high = table[index + 1U]; // NOLINT bounded index
+                const std::int64_t weight = position & ((std::uint32_t { 1U } << fraction_shift) - 1U);
+                const std::int64_t half = std::int64_t { 1 } << (fraction_shift - 1U);
+                return low + ((((high - low) * weight) + half) >> fraction_shift);
+            }
+            else
+            {
+                const std::uint32_t index
+                    = (position + (std::uint32_t { 1U } << (fraction_shift - 1U))) >> fraction_shift;
+                return table[index]; // NOLINT index <= table_entries - 1
+            }
+        }
+
+        /**
+         * @brief Sine of a binary angle from the quarter-wave table.
+         */
+        static base_type sine_of(std::uint32_t angle) noexcept
+        {
+            const std::uint32_t quadrant = angle >> position_bits;
+            std::uint32_t position = angle & (quarter_turn - 1U);
+            if (0U != (quadrant & 1U))
+            {
+                position = quarter_turn - position;
+            }
+
+            const std::int64_t value = lookup(sine_table, position);
+            return static_cast<base_type>((0U != (quadrant & 2U)) ? -value : value);
+        }
+    };
+
+} // namespace tools
+
+#endif // FIXED_TRIG_TABLE_HPP_
@@ -0,0 +1,855 @@
+/**
+ * @file flash_event_log.hpp
+ * @brief Durable, append-only event log on flash: records batched into blocks, circular segments, CRC per block.
+ *
+ * Persisting events one record at a time programs a flash page and updates metadata for every event. The
+ * flash_event_log batches records in a RAM block of one storage page, seals it with a CRC when full, and a
+ * background task appends the sealed blocks to the storage: an ESP32 flash partition
+ * (esp_partition_segment_storage) or a preallocated file on Linux (linux/linux_flash_log_file.hpp). The storage
+ * is split into segments erased in turn, so the wear spreads evenly; when the log wraps, the oldest segment is
+ * recycled. A RAM index of the segments, rebuilt from the block headers when the log is opened, serves the last
+ * records after a reboot without reading the whole log.
+ *
+ * Segment layout: a header page (magic "PSFL", 32-bit sequence, 32-bit erase count, CRC-32 of these 12 bytes),
+ * then one block per page: 32-bit payload size, 32-bit record count, CRC-32 of these 8 bytes and of the payload,
+ * and the payload made of event_log records (32-bit payload size, 64-bit timestamp, payload). Erased pages read
+ * as 0xFF. Header and record fields are big endian.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FLASH_EVENT_LOG_HPP_)
+#define FLASH_EVENT_LOG_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/checksum.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/event_log.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/topic_bridge.hpp"
+
+#if defined(ESP_PLATFORM)
+#include <esp_partition.h>
+#endif
+
+namespace tools
+{
+    /** @brief First bytes of every segment of a flash event log. */
+    inline constexpr std::array<std::uint8_t, 4U> flash_event_log_magic = { 'P', 'S', 'F', 'L' };
+
+    /** @brief Size of the segment header, alone in the first page of the segment. */
+    inline constexpr std::size_t flash_event_log_segment_header_size = 16U;
+
+    /** @brief Size of the header opening every block. */
+    inline constexpr std::size_t flash_event_log_block_header_size = 12U;
+
+    /**
+     * @brief Counters of a flash_event_log.
+     */
+    struct flash_event_log_stats
+    {
+        std::uint64_t events = 0U;            ///< Records accepted into a RAM block.
+        std::uint64_t dropped_events = 0U;    ///< Records larger than a block, or refused while every block is pending.
+        std::uint64_t blocks_written = 0U;    ///< Blocks appended to the storage.
+        std::uint64_t bytes_written = 0U;     ///< Bytes programmed into the storage, segment headers included.
+        std::uint64_t write_errors = 0U;      ///< Blocks lost to a failed storage erase or write.
+        std::uint64_t segments_erased = 0U;   ///< Segment erasures since the log was opened.
+        std::uint64_t segments_recycled = 0U; ///< Erasures of a segment still holding records, the oldest ones.
+        std::uint64_t corrupted_blocks = 0U;  ///< Blocks skipped by the reads for a bad size or CRC.
+        std::uint32_t min_erase_count = 0U;   ///< Lowest erase count among the formatted segments.
+        std::uint32_t max_erase_count = 0U;   ///< Highest erase count among the formatted segments.
+    };
+
+    /**
+     * @brief Durable append-only event log over a segmented flash-like storage.
+     *
+     * Appends serialize a record into the RAM block being filled, under a short lock, and never touch the
+     * storage. A full block is sealed with its CRC and waits for flush(), to be called from a low priority task:
+     * a flash write stalls the caches of both ESP32 cores. At most pending_blocks sealed blocks wait; once they are
+     * all pending, appends are refused and counted as dropped. Blocks are written one per page, in segments
+     * erased in turn; when the log wraps, the oldest segment is erased, and its records lost.
+     *
+     * The storage provides `segment_count()`, `segment_size()` and `page_size()`, and
+     * `erase(segment)`, `write(segment, offset, bytes)`, `read(segment, offset, bytes)` returning false on
+     * failure. Erased bytes read as 0xFF and a page is written once between two erasures.
+     *
+     * @tparam Storage The storage, see esp_partition_segment_storage and linux_os::flash_log_file.
+     */
+    template <typename Storage>
+    class flash_event_log : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        flash_event_log() = delete;
+
+        /**
+         * @brief Opens the log kept in a storage, indexing its segments, or starts an empty log.
+         *
+         * @param storage The storage, outliving the log; at least 2 segments of at least 2 pages.
+         * @param pending_blocks The number of sealed blocks that may wait for flush().
+         */
+        explicit flash_event_log(Storage& storage, std::size_t pending_blocks = 4U)
+            : m_storage(storage)
+            , m_page_size(storage.page_size())
+            , m_slots_per_segment((0U != storage.page_size()) ? (storage.segment_size() / storage.page_size()) : 0U)
+        {
+            const bool usable
+                = (m_page_size > (flash_event_log_block_header_size + event_log_record_header_size))
+                && (m_page_size >= flash_event_log_segment_header_size) && (m_slots_per_segment >= 2U)
+                && (m_storage.segment_count() >= 2U);
+            if (!usable)
+            {
+                return;
+            }
+
+            const std::size_t block_count = (std::max)(pending_blocks, std::size_t { 1U }) + 1U;
+            m_blocks.assign(block_count, std::vector<std::uint8_t>(m_page_size));
+            m_block_used.assign(block_count, flash_event_log_block_header_size);
+            m_block_records.assign(block_count, 0U);
+            if (!mount())
+            {
+                m_blocks.clear();
+            }
+        }
+
+        /**
+         * @brief Writes the records still in RAM to the storage.
+         */
+        ~flash_event_log()
+        {
+            static_cast<void>(sync());
+        }
+
+        /**
+         * @brief Checks whether the storage geometry is usable and the log could be opened.
+         *
+         * @return True for a usable log.
+         */
+        [[nodiscard]] bool valid() const
+        {
+            return !m_blocks.empty();
+        }
+
+        /**
+         * @brief Appends a record whose payload is written by an encoder into the RAM block being filled.
+         *
+         * @tparam BufferEndian Endianness of the payload stream.
+         * @tparam Encoder Callable taking a bytepack::binary_stream<BufferEndian>& and returning false on failure;
+         *         it is called a second time, on a fresh block, if it failed for lack of space.
+         * @param timestamp_us The record timestamp.
+         * @param encoder Writes the payload; it runs under the log lock.
+         * @return False if the log is not usable, the record does not fit a block, or no block is free.
+         */
+        template <std::endian BufferEndian = std::endian::big, typename Encoder>
+        bool append(std::uint64_t timestamp_us, Encoder&& encoder)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            bool appended = !m_blocks.empty() && encode_record<BufferEndian>(timestamp_us, encoder);
+            if (!m_blocks.empty() && !appended && (flash_event_log_block_header_size != m_block_used[filling_index()]))
+            {
+                // the record may not fit the space left: retry once in a fresh block
+                appended = seal_block() && encode_record<BufferEndian>(timestamp_us, encoder);
+            }
+
+            if (appended)
+            {
+                ++m_stats.events;
+            }
+            else
+            {
+                ++m_stats.dropped_events;
+            }
+            return appended;
+        }
+
+        /**
+         * @brief Writes the sealed blocks to the storage, from the calling task.
+         *
+         * @return The number of blocks written.
+         */
+        std::size_t flush()
+        {
+            std::scoped_lock<tools::critical_section> storage_guard(m_storage_mutex);
+            if (m_blocks.empty())
+            {
+                return 0U;
+            }
+
+            std::size_t first = 0U;
+            std::size_t count = 0U;
+            {
+                std::scoped_lock<tools::critical_section> guard(m_mutex);
+                first = m_first_sealed;
+                count = m_sealed;
+            }
+
+            // appends only fill the block after the sealed ones: the sealed blocks are written without the lock
+            std::size_t written = 0U;
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                if (write_block((first + index) % m_blocks.size()))
+                {
+                    ++written;
+                }
+            }
+
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_first_sealed = (first + count) % m_blocks.size();
+            m_sealed -= count;
+            return written;
+        }
+
+        /**
+         * @brief Seals the block being filled, even partly filled, and writes every sealed block.
+         *
+         * A partly filled block still takes a whole page: sync at checkpoints, not after every record.
+         *
+         * @return The number of blocks written.
+         */
+        std::size_t sync()
+        {
+            {
+                std::scoped_lock<tools::critical_section> guard(m_mutex);
+                if (!m_blocks.empty())
+                {
+                    static_cast<void>(seal_block());
+                }
+            }
+            return flush();
+        }
+
+        /**
+         * @brief Visits every record in the storage, oldest first; records still in RAM are not visited.
+         *
+         * Blocks with a bad CRC are skipped and counted. The visitor must not call flush() or sync().
+         *
+         * @tparam Visitor Callable taking the timestamp and the payload, as std::uint64_t and
+         *         std::span<const std::uint8_t>.
+         * @param visitor The record visitor.
+         * @return The number of records visited.
+         */
+        template <typename Visitor>
+        std::size_t for_each(Visitor&& visitor)
+        {
+            std::scoped_lock<tools::critical_section> storage_guard(m_storage_mutex);
+            return visit_records(0U, visitor);
+        }
+
+        /**
+         * @brief Visits the last records in the storage, oldest first.
+         *
+         * The segment index and the block headers locate the first record to visit: only the blocks holding the
+         * visited records are read.
+         *
+         * @tparam Visitor Callable taking the timestamp and the payload, as std::uint64_t and
+         *         std::span<const std::uint8_t>.
+         * @param max_records The number of records to visit at most.
+         * @param visitor The record visitor.
+         * @return The number of records visited.
+         */
+        template <typename Visitor>
+        std::size_t tail(std::size_t max_records, Visitor&& visitor)
+        {
+            std::scoped_lock<tools::critical_section> storage_guard(m_storage_mutex);
+            const std::uint64_t stored = stored_records();
+            return visit_records((stored > max_records) ? (stored - max_records) : 0U, visitor);
+        }
+
+        /**
+         * @brief Gets the number of records in the storage, as counted by the block headers.
+         *
+         * @return The stored record count.
+         */
+        [[nodiscard]] std::uint64_t record_count()
+        {
+            std::scoped_lock<tools::critical_section> storage_guard(m_storage_mutex);
+            return stored_records();
+        }
+
+        /**
+         * @brief Gets the counters of the log and the spread of the segment erase counts.
+         *
+         * @return A copy of the counters.
+         */
+        [[nodiscard]] flash_event_log_stats stats()
+        {
+            std::scoped_lock<tools::critical_section> storage_guard(m_storage_mutex);
+            flash_event_log_stats stats = m_storage_stats;
+            bool first_segment = true;
+            for (const segment_index& entry : m_index)
+            {
+                if (entry.formatted)
+                {
+                    stats.min_erase_count = first_segment ? entry.erase_count
+                                                          : (std::min)(stats.min_erase_count, entry.erase_count);
+                    stats.max_erase_count = (std::max)(stats.max_erase_count, entry.erase_count);
+                    first_segment = false;
+                }
+            }
+
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            stats.events = m_stats.events;
+            stats.dropped_events = m_stats.dropped_events;
+            return stats;
+        }
+
+    private:
+        static constexpr std::uint32_t erased_word = 0xFFFFFFFFU;
+
+        struct segment_index
+        {
+            bool formatted = false;
+            std::uint32_t sequence = 0U;
+            std::uint32_t erase_count = 0U;
+            std::size_t last_slot = 0U; // last programmed block slot, 0 for none
+            std::uint64_t records = 0U;
+        };
+
+        [[nodiscard]] std::size_t filling_index() const
+        {
+            return (m_first_sealed + m_sealed) % m_blocks.size();
+        }
+
+        template <std::endian BufferEndian, typename Encoder>
+        bool encode_record(std::uint64_t timestamp_us, Encoder& encoder)
+        {
+            const std::size_t filling = filling_index();
+            std::size_t& used = m_block_used[filling];
+            if ((m_page_size - used) <= event_log_record_header_size)
+            {
+                return false;
+            }
+
+            std::uint8_t* record = m_blocks[filling].data() + used; // NOLINT pointer arithmetic
+            bytepack::binary_stream<BufferEndian> stream(bytepack::buffer_view(
+                record + event_log_record_header_size, m_page_size - used - event_log_record_header_size)); // NOLINT
+            if (!encoder(stream) || (0U == stream.data().size()))
+            {
+                return false;
+            }
+
+            const std::size_t payload_size = stream.data().size();
+            detail::store_be(record, payload_size, sizeof(std::uint32_t));
+            detail::store_be(record + sizeof(std::uint32_t), timestamp_us, sizeof(std::uint64_t)); // NOLINT
+            used += event_log_record_header_size + payload_size;
+            ++m_block_records[filling];
+            return true;
+        }
+
+        bool seal_block()
+        {
+            const std::size_t filling = filling_index();
+            if (flash_event_log_block_header_size == m_block_used[filling])
+            {
+                return true;
+            }
+            if ((m_sealed + 1U) >= m_blocks.size())
+            {
+                return false;
+            }
+
+            std::uint8_t* block = m_blocks[filling].data();
+            const std::size_t payload_size = m_block_used[filling] - flash_event_log_block_header_size;
+            detail::store_be(block, payload_size, sizeof(std::uint32_t));
+            detail::store_be(block + 4U, m_block_records[filling], sizeof(std::uint32_t));        // NOLINT
+            detail::store_be(block + 8U, block_crc(block, payload_size), sizeof(std::uint32_t)); // NOLINT
+            ++m_sealed;
+
+            const std::size_t next = filling_index();
+            m_block_used[next] = flash_event_log_block_header_size;
+            m_block_records[next] = 0U;
+            return true;
+        }
+
+        static std::uint32_t block_crc(const std::uint8_t* block, std::size_t payload_size)
+        {
+            const std::uint32_t header_crc = crc32_update(block, 2U * sizeof(std::uint32_t), crc32_initial);
+            return ~crc32_update(block + flash_event_log_block_header_size, payload_size, header_crc); // NOLINT
+        }
+
+        bool write_block(std::size_t block)
+        {
+            const std::uint8_t* data = m_blocks[block].data();
+            const auto payload_size = static_cast<std::size_t>(detail::load_be(data, sizeof(std::uint32_t)));
+            const std::uint64_t records = detail::load_be(data + 4U, sizeof(std::uint32_t)); // NOLINT
+
+            if ((m_next_slot >= m_slots_per_segment) && !format_segment((m_head + 1U) % m_index.size()))
+            {
+                ++m_storage_stats.write_errors;
+                return false;
+            }
+
+            const std::size_t size = flash_event_log_block_header_size + payload_size;
+            const std::size_t slot = m_next_slot++;
+            // a failed write may have programmed part of the page: the slot is not reused before the next erasure
+            m_index[m_head].last_slot = slot;
+            if (!m_storage.write(m_head, slot * m_page_size, std::span<const std::uint8_t>(data, size)))
+            {
+                ++m_storage_stats.write_errors;
+                return false;
+            }
+
+            m_index[m_head].records += records;
+            ++m_storage_stats.blocks_written;
+            m_storage_stats.bytes_written += size;
+            return true;
+        }
+
+        bool format_segment(std::size_t segment)
+        {
+            segment_index& entry = m_index[segment];
+            if (entry.formatted && (0U != entry.records))
+            {
+                ++m_storage_stats.segments_recycled;
+            }
+
+            const std::uint32_t erase_count = entry.erase_count + 1U;
+            entry = segment_index {};
+            entry.erase_count = erase_count;
+            ++m_storage_stats.segments_erased;
+
+            std::array<std::uint8_t, flash_event_log_segment_header_size> header = {};
+            std::memcpy(header.data(), flash_event_log_magic.data(), flash_event_log_magic.size());
+            detail::store_be(header.data() + 4U, m_sequence + 1U, sizeof(std::uint32_t));  // NOLINT
+            detail::store_be(header.data() + 8U, erase_count, sizeof(std::uint32_t));       // NOLINT
+            detail::store_be(header.data() + 12U, header_crc(header), sizeof(std::uint32_t)); // NOLINT
+            if (!m_storage.erase(segment) || !m_storage.write(segment, 0U, header))
+            {
+                return false;
+            }
+
+            ++m_sequence;
+            entry.formatted = true;
+            entry.sequence = m_sequence;
+            m_storage_stats.bytes_written += header.size();
+            m_head = segment;
+            m_next_slot = 1U;
+            return true;
+        }
+
+        static std::uint32_t header_crc(const std::array<std::uint8_t, flash_event_log_segment_header_size>& header)
+        {
+            return ~crc32_update(header.data(), 12U, crc32_initial); // NOLINT header fields before the CRC
+        }
+
+        /**
+         * @brief Rebuilds the segment index from the segment and block headers, then finds the write position.
+         */
+        bool mount()
+        {
+            m_index.assign(m_storage.segment_count(), segment_index {});
+            bool found = false;
+            std::array<std::uint8_t, flash_event_log_segment_header_size> header = {};
+            for (std::size_t segment = 0U; segment < m_index.size(); ++segment)
+            {
+                segment_index& entry = m_index[segment];
+                if (!m_storage.read(segment, 0U, header)
+                    || (0 != std::memcmp(header.data(), flash_event_log_magic.data(), flash_event_log_magic.size()))
+                    || (header_crc(header) != detail::load_be(header.data() + 12U, sizeof(std::uint32_t)))) // NOLINT
+                {
+                    continue;
+                }
+
+                entry.formatted = true;
+                entry.sequence = static_cast<std::uint32_t>(detail::load_be(header.data() + 4U, 4U)); // NOLINT
+                entry.erase_count = static_cast<std::uint32_t>(detail::load_be(header.data() + 8U, 4U)); // NOLINT
+                index_blocks(segment, entry);
+
+                if (!found || (entry.sequence > m_sequence))
+                {
+                    m_head = segment;
+                    m_sequence = entry.sequence;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                return format_segment(0U);
+            }
+
+            m_next_slot = m_index[m_head].last_slot + 1U;
+            return true;
+        }
+
+        void index_blocks(std::size_t segment, segment_index& entry)
+        {
+            std::array<std::uint8_t, flash_event_log_block_header_size> header = {};
+            for (std::size_t slot = 1U; slot < m_slots_per_segment; ++slot)
+            {
+                if (!m_storage.read(segment, slot * m_page_size, header))
+                {
+                    continue;
+                }
+
+                const std::uint64_t payload_size = detail::load_be(header.data(), sizeof(std::uint32_t));
+                if (erased_word == payload_size)
+                {
+                    continue;
+                }
+
+                entry.last_slot = slot;
+                if (payload_size <= (m_page_size - flash_event_log_block_header_size))
+                {
+                    entry.records += detail::load_be(header.data() + 4U, sizeof(std::uint32_t)); // NOLINT
+                }
+            }
+        }
+
+        [[nodiscard]] std::vector<std::size_t> ordered_segments() const
+        {
+            std::vector<std::size_t> segments;
+            for (std::size_t segment = 0U; segment < m_index.size(); ++segment)
+            {
+                if (m_index[segment].formatted)
+                {
+                    segments.push_back(segment);
+                }
+            }
+            std::sort(segments.begin(), segments.end(),
+                [this](std::size_t lhs, std::size_t rhs) { return m_index[lhs].sequence < m_index[rhs].sequence; });
+            return segments;
+        }
+
+        [[nodiscard]] std::uint64_t stored_records() const
+        {
+            std::uint64_t records = 0U;
+            for (const segment_index& entry : m_index)
+            {
+                records += entry.formatted ? entry.records : 0U;
+            }
+            return records;
+        }
+
+        /**
+         * @brief Visits the stored records after the first skip ones, skipping whole segments and blocks unread.
+         */
+        template <typename Visitor>
+        std::size_t visit_records(std::uint64_t skip, Visitor& visitor)
+        {
+            std::vector<std::uint8_t> block(m_page_size);
+            std::size_t visited = 0U;
+            for (const std::size_t segment : ordered_segments())
+            {
+                const segment_index& entry = m_index[segment];
+                if (skip >= entry.records)
+                {
+                    skip -= entry.records;
+                    continue;
+                }
+
+                for (std::size_t slot = 1U; slot <= entry.last_slot; ++slot)
+                {
+                    const std::size_t offset = slot * m_page_size;
+                    const std::span<std::uint8_t> header(block.data(), flash_event_log_block_header_size);
+                    if (!m_storage.read(segment, offset, header))
+                    {
+                        ++m_storage_stats.corrupted_blocks;
+                        continue;
+                    }
+
+                    const auto payload_size = static_cast<std::size_t>(detail::load_be(block.data(), 4U));
+                    const std::uint64_t records = detail::load_be(block.data() + 4U, 4U); // NOLINT
+                    if (erased_word == payload_size)
+                    {
+                        continue;
+                    }
+                    if (payload_size > (m_page_size - flash_event_log_block_header_size))
+                    {
+                        ++m_storage_stats.corrupted_blocks;
+                        continue;
+                    }
+                    if (skip >= records)
+                    {
+                        skip -= records;
+                        continue;
+                    }
+
+                    const bool readable = m_storage.read(segment, offset + flash_event_log_block_header_size,
+                        std::span<std::uint8_t>(block.data() + flash_event_log_block_header_size, payload_size));
+                    if (!readable
+                        || (block_crc(block.data(), payload_size) != detail::load_be(block.data() + 8U, 4U))) // NOLINT
+                    {
+                        ++m_storage_stats.corrupted_blocks;
+                        skip = 0U;
+                        continue;
+                    }
+
+                    visited += visit_block(
+                        std::span<const std::uint8_t>(block.data() + flash_event_log_block_header_size, payload_size),
+                        skip, visitor);
+                }
+            }
+            return visited;
+        }
+
+        template <typename Visitor>
+        static std::size_t visit_block(std::span<const std::uint8_t> payload, std::uint64_t& skip, Visitor& visitor)
+        {
+            std::size_t visited = 0U;
+            std::size_t offset = 0U;
+            while ((payload.size() - offset) >= event_log_record_header_size)
+            {
+                const std::uint8_t* record = payload.data() + offset; // NOLINT pointer arithmetic
+                const auto size = static_cast<std::size_t>(detail::load_be(record, sizeof(std::uint32_t)));
+                if ((0U == size) || (size > (payload.size() - offset - event_log_record_header_size)))
+                {
+                    break;
+                }
+
+                if (0U != skip)
+                {
+                    --skip;
+                }
+                else
+                {
+                    visitor(detail::load_be(record + sizeof(std::uint32_t), sizeof(std::uint64_t)), // NOLINT
+                        payload.subspan(offset + event_log_record_header_size, size));
+                    ++visited;
+                }
+                offset += event_log_record_header_size + size;
+            }
+            return visited;
+        }
+
+        Storage& m_storage;
+        std::size_t m_page_size;
+        std::size_t m_slots_per_segment;
+
+        // RAM blocks, guarded by m_mutex: the sealed ones, then the one being filled
+        tools::critical_section m_mutex;
+        std::vector<std::vector<std::uint8_t>> m_blocks;
+        std::vector<std::size_t> m_block_used;
+        std::vector<std::uint32_t> m_block_records;
+        std::size_t m_first_sealed = 0U;
+        std::size_t m_sealed = 0U;
+        flash_event_log_stats m_stats;
+
+        // storage side, guarded by m_storage_mutex, always taken before m_mutex
+        tools::critical_section m_storage_mutex;
+        std::vector<segment_index> m_index;
+        std::size_t m_head = 0U;
+        std::size_t m_next_slot = 1U;
+        std::uint32_t m_sequence = 0U;
+        flash_event_log_stats m_storage_stats;
+    };
+
+    /**
+     * @brief Observer appending every event it is informed of to a flash_event_log.
+     *
+     * Timestamps are the microseconds of the system clock since its epoch, so that they keep increasing across
+     * reboots once the clock is set. Only the append runs in the publisher; call flush() on the log from a low
+     * priority task.
+     *
+     * @tparam Storage The storage of the log.
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type of the origin, not recorded.
+     * @tparam Codec The topic/event serializer, see bytepack_bridge_codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <typename Storage, typename Topic, typename Evt, typename Origin = std::string,
+        typename Codec = bytepack_bridge_codec, std::endian BufferEndian = std::endian::big>
+    class flash_event_log_recorder : public sync_observer<Topic, Evt, Origin>
+    {
+    public:
+        flash_event_log_recorder() = delete;
+
+        /**
+         * @brief Constructs a recorder appending to a log.
+         *
+         * @param log The log, outliving the recorder.
+         */
+        explicit flash_event_log_recorder(flash_event_log<Storage>& log)
+            : m_log(log)
+        {
+        }
+
+        ~flash_event_log_recorder() override = default;
+
+        /**
+         * @brief Appends the event to the log; a refused event is counted by the log.
+         *
+         * @param topic The topic of the event.
+         * @param event The event.
+         * @param origin The origin, not recorded.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            (void)origin;
+            const auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+            static_cast<void>(m_log.template append<BufferEndian>(static_cast<std::uint64_t>(now.count()),
+                [&](bytepack::binary_stream<BufferEndian>& stream) { return Codec::encode(stream, topic, event); }));
+        }
+
+    private:
+        flash_event_log<Storage>& m_log;
+    };
+
+    /**
+     * @brief Republishes the last stored events of a flash_event_log into a subject, as fast as possible.
+     *
+     * @tparam Codec The topic/event deserializer, matching the recorder codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     * @param log The log.
+     * @param subject The subject to publish into.
+     * @param max_records The number of last records to replay at most, all by default.
+     * @return The number of events published; records that cannot be decoded are skipped.
+     */
+    template <typename Codec = bytepack_bridge_codec, std::endian BufferEndian = std::endian::big, typename Storage,
+        typename Topic, typename Evt, typename Origin>
+    std::size_t replay_flash_event_log(flash_event_log<Storage>& log, sync_subject<Topic, Evt, Origin>& subject,
+        std::size_t max_records = (std::numeric_limits<std::size_t>::max)())
+    {
+        std::size_t published = 0U;
+        static_cast<void>(log.tail(max_records,
+            [&subject, &published](std::uint64_t /*timestamp_us*/, std::span<const std::uint8_t> payload)
+            {
+                Topic topic {};
+                Evt event {};
+                bytepack::binary_stream<BufferEndian> stream(bytepack::buffer_view(
+                    const_cast<std::uint8_t*>(payload.data()), payload.size())); // NOLINT read only
+                if (Codec::decode(stream, topic, event))
+                {
+                    subject.publish(topic, event);
+                    ++published;
+                }
+            }));
+        return published;
+    }
+
+#if defined(ESP_PLATFORM)
+    /**
+     * @brief Segmented storage of a flash_event_log in a data partition of the ESP32 flash.
+     *
+     * The segment size is rounded up to the partition erase size (a 4 KiB sector); pages are the 256-byte
+     * program pages of the flash chip, the unit of a block.
+     */
+    class esp_partition_segment_storage : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        /**
+         * @brief Looks up a data partition by label and splits it into segments.
+         *
+         * @param label The partition label in the partition table.
+         * @param segment_size The requested segment size in bytes.
+         * @param page_size The block size in bytes, dividing the segment size.
+         */
+        explicit esp_partition_segment_storage(
+            const char* label, std::size_t segment_size = 16U * 1024U, std::size_t page_size = 256U)
+            : m_partition(esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label))
+            , m_page_size(page_size)
+        {
+            if (nullptr != m_partition)
+            {
+                const std::size_t sector = m_partition->erase_size;
+                m_segment_size = ((segment_size + sector - 1U) / sector) * sector;
+                m_segment_count = static_cast<std::size_t>(m_partition->size) / m_segment_size;
+            }
+        }
+
+        ~esp_partition_segment_storage() = default;
+
+        /** @brief Gets the number of segments, 0 without partition. */
+        [[nodiscard]] std::size_t segment_count() const
+        {
+            return m_segment_count;
+        }
+
+        /** @brief Gets the size of a segment in bytes. */
+        [[nodiscard]] std::size_t segment_size() const
+        {
+            return m_segment_size;
+        }
+
+        /** @brief Gets the size of a block in bytes. */
+        [[nodiscard]] std::size_t page_size() const
+        {
+            return m_page_size;
+        }
+
+        /** @brief Erases a segment, every byte then reading 0xFF. */
+        bool erase(std::size_t segment)
+        {
+            return (segment < m_segment_count)
+                && (ESP_OK == esp_partition_erase_range(m_partition, segment * m_segment_size, m_segment_size));
+        }
+
+        /** @brief Programs bytes at an offset of an erased segment. */
+        bool write(std::size_t segment, std::size_t offset, std::span<const std::uint8_t> bytes)
+        {
+            const std::size_t address = (segment * m_segment_size) + offset;
+            return in_range(segment, offset, bytes.size())
+                && (ESP_OK == esp_partition_write(m_partition, address, bytes.data(), bytes.size()));
+        }
+
+        /** @brief Reads bytes at an offset of a segment. */
+        bool read(std::size_t segment, std::size_t offset, std::span<std::uint8_t> bytes)
+        {
+            const std::size_t address = (segment * m_segment_size) + offset;
+            return in_range(segment, offset, bytes.size())
+                && (ESP_OK == esp_partition_read(m_partition, address, bytes.data(), bytes.size()));
+        }
+
+    private:
+        [[nodiscard]] bool in_range(std::size_t segment, std::size_t offset, std::size_t size) const
+        {
+            return (segment < m_segment_count) && (offset <= m_segment_size) && (size <= (m_segment_size - offset));
+        }
+
+        const esp_partition_t* m_partition;
+        std::size_t m_page_size;
+        std::size_t m_segment_size = 0U;
+        std::size_t m_segment_count = 0U;
+    };
+#endif
+}
+
+#endif // C++20
+
+#endif // FLASH_EVENT_LOG_HPP_
@@ -0,0 +1,605 @@
+/**
+ * @file flat_hash_map.hpp
+ * @brief An open-addressing hash map storing its entries in one contiguous array.
+ *
+ * This file contains the definition of the flat_hash_map class, a Robin Hood hash map with backward-shift deletion
+ * (no tombstones) and an optional fixed-capacity storage that never allocates, usable as the TDictionary of
+ * sync_dictionary, sharded_sync_dictionary, rcu_sync_dictionary and histogram.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(FLAT_HASH_MAP_HPP_)
+#define FLAT_HASH_MAP_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tools
+{
+    namespace detail
+    {
+        /**
+         * @brief Slot count of a fixed-capacity flat_hash_map: the smallest power of two keeping a 3/4 load factor.
+         *
+         * @param entries The number of entries the map must hold.
+         * @return The number of slots.
+         */
+        constexpr std::size_t flat_hash_map_slots(std::size_t entries)
+        {
+            std::size_t slots = 8U;
+
+            while ((slots * 3U) < (entries * 4U))
+            {
+                slots *= 2U;
+            }
+
+            return slots;
+        }
+    }
+
+    /**
+     * @brief A Robin Hood hash map with a power-of-two slot array, not thread-safe.
+     *
+     * Lookups hash once and scan adjacent slots, which keeps them in one or two cache lines, unlike the node based
+     * std::map and std::unordered_map. Each slot records how far its entry sits from its home slot; insertion lets
+     * the entry farther from home keep the slot, so probe lengths stay short and even, and a lookup stops as soon as
+     * it meets an entry closer to its home than the searched key would be. erase() shifts the following entries one
+     * slot back, leaving no tombstones. Any insertion or erase invalidates iterators.
+     *
+     * With FixedCapacity = 0 the slots live in a std::vector that doubles when it gets 3/4 full. With FixedCapacity
+     * > 0 they live inline in a std::array sized for FixedCapacity entries: the map never touches the heap, and
+     * insert_or_assign() of a new key reports a failure (end(), false) once FixedCapacity entries are stored.
+     *
+     * @tparam K The type of the keys.
+     * @tparam T The type of the mapped values.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality function object type.
+     * @tparam FixedCapacity The maximum number of entries of the inline storage, or 0 for a growing heap storage.
+     */
+    template <typename K, typename T, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>,
+        std::size_t FixedCapacity = 0U>
+    class flat_hash_map
+    {
+    public:
+        using key_type = K;
+        using mapped_type = T;
+        using value_type = std::pair<K, T>; ///< The key stays mutable for the Robin Hood moves, do not modify it.
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        /**
+         * @brief true when the slots are stored inline and never reallocated.
+         */
+        static constexpr bool fixed_storage = (FixedCapacity > 0U);
+
+    private:
+        using distance_type = std::uint32_t;
+
+        struct slot_type
+        {
+            std::optional<value_type> m_entry;
+            distance_type m_distance = 0U; ///< Distance from the home slot, meaningful when m_entry is set.
+
+            [[nodiscard]] bool has_value() const
+            {
+                return m_entry.has_value();
+            }
+        };
+
+        using slots_type = typename std::conditional<fixed_storage,
+            std::array<slot_type, detail::flat_hash_map_slots(FixedCapacity)>, std::vector<slot_type>>::type;
+
+        template <bool IsConst>
+        class basic_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = flat_hash_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+            using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+            using slot_pointer = typename std::conditional<IsConst, const slot_type*, slot_type*>::type;
+
+            basic_iterator() = default;
+
+            basic_iterator(slot_pointer slot, slot_pointer last)
+                : m_slot(slot)
+                , m_last(last)
+            {
+                skip_empty();
+            }
+
+            template <bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+            basic_iterator(const basic_iterator<WasConst>& other) // NOLINT implicit iterator to const_iterator
+                : m_slot(other.m_slot)
+                , m_last(other.m_last)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *m_slot->m_entry;
+            }
+
+            pointer operator->() const
+            {
+                return &*m_slot->m_entry;
+            }
+
+            basic_iterator& operator++()
+            {
+                ++m_slot; // NOLINT pointer arithmetic
+                skip_empty();
+                return *this;
+            }
+
+            basic_iterator operator++(int)
+            {
+                basic_iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs)
+            {
+                return lhs.m_slot == rhs.m_slot;
+            }
+
+            friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs)
+            {
+                return lhs.m_slot != rhs.m_slot;
+            }
+
+        private:
+            friend class flat_hash_map;
+            friend class basic_iterator<!IsConst>;
+
+            void skip_empty()
+            {
+                while ((m_slot != m_last) && !m_slot->has_value())
+                {
+                    ++m_slot; // NOLINT pointer arithmetic
+                }
+            }
+
+            slot_pointer m_slot = nullptr;
+            slot_pointer m_last = nullptr;
+        };
+
+    public:
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        flat_hash_map()
+        {
+            if constexpr (fixed_storage)
+            {
+                update_bits();
+            }
+        }
+
+        /**
+         * @brief Constructs an empty map able to hold a number of entries without growing.
+         *
+         * @param expected_size The number of entries to reserve room for (ignored by the fixed storage).
+         */
+        explicit flat_hash_map(size_type expected_size)
+            : flat_hash_map()
+        {
+            reserve(expected_size);
+        }
+
+        /**
+         * @brief Grows the table so that a number of entries fit without rehashing; no-op for the fixed storage.
+         *
+         * @param expected_size The number of entries to reserve room for.
+         */
+        void reserve(size_type expected_size)
+        {
+            if constexpr (!fixed_storage)
+            {
+                const size_type capacity = detail::flat_hash_map_slots(expected_size);
+
+                if (capacity > m_slots.size())
+                {
+                    rehash(capacity);
+                }
+            }
+        }
+
+        /**
+         * @brief Inserts an entry or assigns the value of the existing one.
+         *
+         * @param key The key to insert or update.
+         * @param value The value to store.
+         * @return A pair made of the iterator to the entry and true if it was inserted; (end(), false) if the fixed
+         * storage is full.
+         */
+        template <typename KU, typename TU>
+        std::pair<iterator, bool> insert_or_assign(KU&& key, TU&& value)
+        {
+            if (!m_slots.empty())
+            {
+                const size_type existing = locate(key);
+
+                if (existing != npos)
+                {
+                    m_slots[existing].m_entry->second = std::forward<TU>(value);
+                    return { make_iterator(existing), false };
+                }
+            }
+
+            if constexpr (fixed_storage)
+            {
+                if (m_size >= FixedCapacity)
+                {
+                    return { end(), false };
+                }
+            }
+            else
+            {
+                if ((m_slots.size() * 3U) < ((m_size + 1U) * 4U))
+                {
+                    rehash(m_slots.empty() ? detail::flat_hash_map_slots(0U) : (m_slots.size() * 2U));
+                }
+            }
+
+            const size_type index = place(value_type(std::forward<KU>(key), std::forward<TU>(value)));
+            ++m_size;
+
+            return { make_iterator(index), true };
+        }
+
+        /**
+         * @brief Accesses the value of a key, inserting a default constructed one if missing.
+         *
+         * The fixed storage must not be full when the key is missing.
+         *
+         * @param key The key to look up.
+         * @return A reference to the mapped value.
+         */
+        T& operator[](const K& key)
+        {
+            auto itr = find(key);
+
+            if (end() == itr)
+            {
+                itr = insert_or_assign(key, T{}).first;
+            }
+
+            return itr->second;
+        }
+
+        /**
+         * @brief Removes the entry of a key, if any.
+         *
+         * @param key The key to remove.
+         * @return The number of removed entries (0 or 1).
+         */
+        size_type erase(const K& key)
+        {
+            if (m_slots.empty())
+            {
+                return 0U;
+            }
+
+            size_type hole = locate(key);
+
+            if (npos == hole)
+            {
+                return 0U;
+            }
+
+            // backward shift: pull back the following entries that are away from their home slot
+            const size_type mask = m_slots.size() - 1U;
+
+            for (size_type next = (hole + 1U) & mask; m_slots[next].has_value() && (m_slots[next].m_distance > 0U);
+                 next = (next + 1U) & mask)
+            {
+                m_slots[hole].m_entry = std::move(m_slots[next].m_entry);
+                m_slots[hole].m_distance = m_slots[next].m_distance - 1U;
+                hole = next;
+            }
+
+            m_slots[hole].m_entry.reset();
+            --m_size;
+
+            return 1U;
+        }
+
+        /**
+         * @brief Finds the entry of a key.
+         *
+         * @param key The key to look up.
+         * @return An iterator to the entry, or end() if the key is missing.
+         */
+        [[nodiscard]] iterator find(const K& key)
+        {
+            const size_type index = m_slots.empty() ? npos : locate(key);
+            return (npos != index) ? make_iterator(index) : end();
+        }
+
+        /**
+         * @brief Finds the entry of a key.
+         *
+         * @param key The key to look up.
+         * @return A const iterator to the entry, or cend() if the key is missing.
+         */
+        [[nodiscard]] const_iterator find(const K& key) const
+        {
+            const size_type index = m_slots.empty() ? npos : locate(key);
+            return (npos != index) ? make_const_iterator(index) : cend();
+        }
+
+        /**
+         * @brief Checks whether a key is present.
+         *
+         * @param key The key to look up.
+         * @return true if the map holds the key.
+         */
+        [[nodiscard]] bool contains(const K& key) const
+        {
+            return cend() != find(key);
+        }
+
+        /**
+         * @brief Counts the entries of a key.
+         *
+         * @param key The key to look up.
+         * @return 1 if the map holds the key, 0 otherwise.
+         */
+        [[nodiscard]] size_type count(const K& key) const
+        {
+            return contains(key) ? 1U : 0U;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        [[nodiscard]] size_type size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Retrieves the maximum number of entries.
+         *
+         * @return FixedCapacity for the fixed storage, the largest vector size otherwise.
+         */
+        [[nodiscard]] size_type max_size() const
+        {
+            if constexpr (fixed_storage)
+            {
+                return FixedCapacity;
+            }
+            else
+            {
+                return m_slots.max_size();
+            }
+        }
+
+        /**
+         * @brief Retrieves the number of slots of the table.
+         *
+         * @return The slot count, a power of two, or zero before the first insertion of a growing map.
+         */
+        [[nodiscard]] size_type capacity() const
+        {
+            return m_slots.size();
+        }
+
+        /**
+         * @brief Removes all the entries, keeping the table allocated.
+         */
+        void clear()
+        {
+            for (auto& slot : m_slots)
+            {
+                slot.m_entry.reset();
+            }
+
+            m_size = 0U;
+        }
+
+        [[nodiscard]] iterator begin()
+        {
+            return make_iterator(0U);
+        }
+
+        [[nodiscard]] iterator end()
+        {
+            return make_iterator(m_slots.size());
+        }
+
+        [[nodiscard]] const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        [[nodiscard]] const_iterator end() const
+        {
+            return cend();
+        }
+
+        [[nodiscard]] const_iterator cbegin() const
+        {
+            return make_const_iterator(0U);
+        }
+
+        [[nodiscard]] const_iterator cend() const
+        {
+            return make_const_iterator(m_slots.size());
+        }
+
+    private:
+        static constexpr size_type npos = ~size_type{ 0U };
+
+        [[nodiscard]] size_type home_of(const K& key) const
+        {
+            // Fibonacci hashing: the high bits of the product mix every bit of the hash
+            constexpr const std::uint64_t golden_ratio = 0x9e3779b97f4a7c15ULL;
+            const auto mixed = static_cast<std::uint64_t>(m_hash(key)) * golden_ratio;
+            return static_cast<size_type>(mixed >> (64U - m_bits));
+        }
+
+        /**
+         * @brief Retrieves the slot of a key, stopping at the first slot holding an entry closer to its home.
+         */
+        [[nodiscard]] size_type locate(const K& key) const
+        {
+            const size_type mask = m_slots.size() - 1U;
+            size_type index = home_of(key);
+
+            for (distance_type distance = 0U;; ++distance)
+            {
+                const slot_type& slot = m_slots[index];
+
+                if (!slot.has_value() || (slot.m_distance < distance))
+                {
+                    return npos;
+                }
+
+                if (m_equal(slot.m_entry->first, key))
+                {
+                    return index;
+                }
+
+                index = (index + 1U) & mask;
+            }
+        }
+
+        /**
+         * @brief Stores a new entry, taking the slot of any entry nearer to its home on the way.
+         *
+         * @return The slot of the new entry.
+         */
+        size_type place(value_type&& entry)
+        {
+            const size_type mask = m_slots.size() - 1U;
+            size_type index = home_of(entry.first);
+            size_type placed = npos;
+            std::optional<value_type> carried(std::move(entry));
+
+            for (distance_type distance = 0U;; ++distance)
+            {
+                slot_type& slot = m_slots[index];
+
+                if (!slot.has_value())
+                {
+                    slot.m_entry = std::move(carried);
+                    slot.m_distance = distance;
+                    return (npos == placed) ? index : placed;
+                }
+
+                if (slot.m_distance < distance)
+                {
+                    std::swap(slot.m_entry, carried);
+                    std::swap(slot.m_distance, distance);
+
+                    if (npos == placed)
+                    {
+                        placed = index;
+                    }
+                }
+
+                index = (index + 1U) & mask;
+            }
+        }
+
+        void update_bits()
+        {
+            m_bits = 0U;
+            while ((size_type{ 1U } << m_bits) < m_slots.size())
+            {
+                ++m_bits;
+            }
+        }
+
+        void rehash(size_type capacity)
+        {
+            slots_type previous(capacity);
+            previous.swap(m_slots);
+            update_bits();
+
+            for (auto& slot : previous)
+            {
+                if (slot.has_value())
+                {
+                    static_cast<void>(place(std::move(*slot.m_entry)));
+                }
+            }
+        }
+
+        iterator make_iterator(size_type index)
+        {
+            slot_type* first = m_slots.data();
+            return iterator(first + index, first + m_slots.size()); // NOLINT pointer arithmetic
+        }
+
+        const_iterator make_const_iterator(size_type index) const
+        {
+            const slot_type* first = m_slots.data();
+            return const_iterator(first + index, first + m_slots.size()); // NOLINT pointer arithmetic
+        }
+
+        slots_type m_slots = {};
+        size_type m_size = 0U;
+        unsigned int m_bits = 0U;
+        Hash m_hash;
+        KeyEqual m_equal;
+    };
+
+    /**
+     * @brief A flat_hash_map holding at most Capacity entries in inline storage, never allocating.
+     *
+     * @tparam K The type of the keys.
+     * @tparam T The type of the mapped values.
+     * @tparam Capacity The maximum number of entries.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality function object type.
+     */
+    template <typename K, typename T, std::size_t Capacity, typename Hash = std::hash<K>,
+        typename KeyEqual = std::equal_to<K>>
+    using fixed_flat_hash_map = flat_hash_map<K, T, Hash, KeyEqual, Capacity>;
+}
+
+#endif //  FLAT_HASH_MAP_HPP_
@@ -40,17 +40,29 @@
 #include <chrono>
 #include <cstdio>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+
 #include "tools/base_task.hpp"
+#include "tools/data_task_queue.hpp"
 #include "tools/logger.hpp"
 #include "tools/platform_helpers.hpp"
+#include "tools/trace_ring.hpp"
 
 namespace tools
 {
@@ -63,8 +75,10 @@ namespace tools
      *
      * @tparam Context The type of the context object shared among tasks.
      * @tparam DataType The type of data to be processed by the task.
+     * @tparam QueuePolicy data_task_default_queue (FreeRTOS queue) or data_task_spsc_queue<Pow2> (lock-free
+     *                     single producer queue with task notifications).
      */
-    template <typename Context, typename DataType>
+    template <typename Context, typename DataType, typename QueuePolicy = data_task_default_queue>
 #if __cplusplus >= 202002L
         requires std::is_standard_layout_v<DataType> && std::is_trivial_v<DataType>
 #endif
@@ -98,6 +112,21 @@ namespace tools
         using data_call_back = std::function<void(
             const std::shared_ptr<Context>& context, const DataType& data, const std::string& task_name)>;
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Alias for a callback function that processes a batch of data.
+         *
+         * The batch holds every item drained from the queue in one go (up to the configured maximum batch size).
+         * The span is only valid during the call.
+         *
+         * @param context A shared pointer to the Context object.
+         * @param batch The data to be processed, oldest first.
+         * @param task_name The name of the task that is processing the data.
+         */
+        using batch_call_back = std::function<void(
+            const std::shared_ptr<Context>& context, std::span<const DataType> batch, const std::string& task_name)>;
+#endif
+
         /**
          * @brief Constructor for the data_task class.
          *
@@ -118,22 +147,79 @@ namespace tools
             : base_task(task_name, stack_size, cpu_affinity, priority)
             , m_startup_routine(std::move(startup_routine))
             , m_process_routine(std::move(process_routine))
+            , m_spsc_queue(data_queue_depth)
             , m_context(context)
             , m_data_timeout(data_timeout)
         {
             // FreeRTOS platform
-            m_data_queue = xQueueCreate(data_queue_depth, sizeof(DataType));
-
-            if (nullptr == m_data_queue)
-            {
-                LOG_ERROR("FATAL error: xQueueCreate() failed for task %s", this->task_name().c_str());
-            }
+            create_data_queue(data_queue_depth);
 
             m_task_created = task_create(&m_task, this->task_name(), run_loop,
                 reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
                 this->stack_size(), this->cpu_affinity(), this->priority());
         }
 
+        /**
+         * @brief Constructor for a data_task with a real-time scheduling policy, ignored on FreeRTOS.
+         *
+         * FreeRTOS tasks are already scheduled by fixed priority, so the task is created as with the priority
+         * alone and sched_policy_applied() reports false for a real-time policy.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param process_routine The process routine callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The stack size for the task.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param sched_policy The SCHED_FIFO, SCHED_RR or SCHED_DEADLINE policy of the Linux builds.
+         */
+        data_task(call_back&& startup_routine, data_call_back&& process_routine,
+            const std::shared_ptr<Context>& context, std::size_t data_queue_depth, const std::string& task_name,
+            std::size_t stack_size, int cpu_affinity, int priority,
+            const std::chrono::duration<std::uint64_t, std::micro>& data_timeout, const task_sched_policy& sched_policy)
+            : data_task(std::move(startup_routine), std::move(process_routine), context, data_queue_depth, task_name,
+                  stack_size, cpu_affinity, priority, data_timeout)
+        {
+            m_sched_policy_applied = (task_sched_class::inherit == sched_policy.sched_class);
+        }
+
+        /**
+         * @brief Constructor for a data_task running in caller-provided task storage.
+         *
+         * The stack and control block come from storage instead of the heap; storage must outlive the task.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param process_routine The process routine callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         */
+        data_task(call_back&& startup_routine, data_call_back&& process_routine,
+            const std::shared_ptr<Context>& context, std::size_t data_queue_depth, const std::string& task_name,
+            const task_storage& storage, int cpu_affinity, int priority,
+            const std::chrono::duration<std::uint64_t, std::micro>& data_timeout)
+            : base_task(task_name, storage.stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_process_routine(std::move(process_routine))
+            , m_spsc_queue(data_queue_depth)
+            , m_context(context)
+            , m_data_timeout(data_timeout)
+        {
+            // FreeRTOS platform
+            create_data_queue(data_queue_depth);
+
+            m_task_created = task_create_static(&m_task, this->task_name(), run_loop,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                storage.stack, storage.stack_size, storage.control_block, this->cpu_affinity(), this->priority());
+        }
+
         /**
          * @brief Constructs a data_task object using perfect forwarding.
          *
@@ -160,16 +246,12 @@ namespace tools
             : base_task(std::string(std::forward<UName>(task_name)), stack_size, cpu_affinity, priority)
             , m_startup_routine(call_back(std::forward<UStartup>(startup_routine)))
             , m_process_routine(data_call_back(std::forward<UProcess>(process_routine)))
+            , m_spsc_queue(data_queue_depth)
             , m_context(std::shared_ptr<Context>(std::forward<UContext>(context)))
             , m_data_timeout(data_timeout)
         {
             // FreeRTOS platform
-            m_data_queue = xQueueCreate(data_queue_depth, sizeof(DataType));
-
-            if (nullptr == m_data_queue)
-            {
-                LOG_ERROR("FATAL error: xQueueCreate() failed for task %s", this->task_name().c_str());
-            }
+            create_data_queue(data_queue_depth);
 
             m_task_created = task_create(&m_task, this->task_name(), run_loop,
                 reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
@@ -221,33 +303,186 @@ namespace tools
         {
         }
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Constructor for a data_task processing data in batches.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param batch_routine The batch processing callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The stack size for the task.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         * @param batch_linger How long to wait for more data to fill a partial batch in us (0 to flush at once).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, std::size_t stack_size, int cpu_affinity,
+            int priority, const std::chrono::duration<std::uint64_t, std::micro>& data_timeout,
+            std::size_t max_batch_size, const std::chrono::duration<std::uint64_t, std::micro>& batch_linger)
+            : base_task(task_name, stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_batch_routine(std::move(batch_routine))
+            , m_batch_buffer(std::max<std::size_t>(max_batch_size, 1U))
+            , m_batch_linger(batch_linger)
+            , m_spsc_queue(data_queue_depth)
+            , m_context(context)
+            , m_data_timeout(data_timeout)
+        {
+            // FreeRTOS platform
+            create_data_queue(data_queue_depth);
+
+            m_task_created = task_create(&m_task, this->task_name(), run_loop,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                this->stack_size(), this->cpu_affinity(), this->priority());
+        }
+
+        /**
+         * @brief Constructor for a data_task processing data in batches, running in caller-provided task storage.
+         *
+         * The stack and control block come from storage instead of the heap; storage must outlive the task.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param batch_routine The batch processing callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         * @param batch_linger How long to wait for more data to fill a partial batch in us (0 to flush at once).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, const task_storage& storage, int cpu_affinity,
+            int priority, const std::chrono::duration<std::uint64_t, std::micro>& data_timeout,
+            std::size_t max_batch_size, const std::chrono::duration<std::uint64_t, std::micro>& batch_linger)
+            : base_task(task_name, storage.stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_batch_routine(std::move(batch_routine))
+            , m_batch_buffer(std::max<std::size_t>(max_batch_size, 1U))
+            , m_batch_linger(batch_linger)
+            , m_spsc_queue(data_queue_depth)
+            , m_context(context)
+            , m_data_timeout(data_timeout)
+        {
+            // FreeRTOS platform
+            create_data_queue(data_queue_depth);
+
+            m_task_created = task_create_static(&m_task, this->task_name(), run_loop,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                storage.stack, storage.stack_size, storage.control_block, this->cpu_affinity(), this->priority());
+        }
+
+        /**
+         * @brief Constructor for a data_task processing data in batches, with default priority, default cpu
+         * affinity and no linger time.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param batch_routine The batch processing callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The stack size for the task.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, std::size_t stack_size,
+            std::size_t max_batch_size)
+            : data_task(std::move(startup_routine), std::move(batch_routine), context, data_queue_depth, task_name,
+                  stack_size, base_task::run_on_all_cores, base_task::default_priority,
+                  std::chrono::duration<std::uint64_t, std::micro>::max(), max_batch_size,
+                  std::chrono::duration<std::uint64_t, std::micro>::zero())
+        {
+        }
+#endif
+
         /**
          * @brief Destructor for the data_task class.
          *
-         * This destructor stops the task by setting the m_stop_task flag to true.
-         * If the data queue is not null, it sends a dummy value to the queue to unblock any waiting operations.
-         * If the task was created, it waits for the task to self-terminate.
+         * This destructor stops the task if stop() was not called, leaving the queued data unprocessed.
+         * A task blocked on an empty queue is woken up by a wake-up item it skips (with the lock-free queue
+         * policy, by a notification instead). If the task was created, it waits for the task to self-terminate.
          */
         ~data_task()
         {
             // FreeRTOS platform
 
-            m_stop_task.store(true);
-            if (nullptr != m_data_queue)
+            static_cast<void>(stop(task_drain_policy::discard));
+        }
+
+        /**
+         * @brief Stops the task and hands back the data it did not process.
+         *
+         * The task finishes the data in progress, then drains the queue according to the policy and deletes itself.
+         * Submissions are rejected from then on. Calling stop() again returns an empty vector.
+         *
+         * @param policy Whether the queued data is processed (all, or until the timeout) or left unprocessed.
+         * @param drain_timeout How long the task may drain with the drain_deadline policy in us.
+         * @return The unprocessed data, oldest first, to be resubmitted elsewhere or dropped.
+         */
+        std::vector<DataType> stop(task_drain_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& drain_timeout
+            = std::chrono::duration<std::uint64_t, std::micro>::zero())
+        {
+            std::vector<DataType> unprocessed;
+
+            if (m_stop_task.load())
             {
-                constexpr const TickType_t x_block_time = 20 * portTICK_PERIOD_MS;
-                DataType value = {};
-                xQueueSend(m_data_queue, &value, x_block_time);
+                return unprocessed;
             }
 
+            m_drain_policy = policy;
+            m_drain_timeout_us = drain_timeout.count();
+            m_drain_start_us = now_us();
+            // publishes the drain settings to the task
+            m_stop_task.store(true);
+
             if (m_task_created)
             {
+                wake_to_stop();
+
                 constexpr TickType_t wait_tick = 1;
                 while (!m_task_stopped.load())
                 {
                     vTaskDelay(wait_tick);
                 }
             }
+
+            if (m_unprocessed_item.has_value())
+            {
+                unprocessed.push_back(m_unprocessed_item.value());
+                m_unprocessed_item.reset();
+            }
+
+            if constexpr (QueuePolicy::lock_free)
+            {
+                for (auto data = m_spsc_queue.front_pop(); data.has_value(); data = m_spsc_queue.front_pop())
+                {
+                    unprocessed.push_back(data.value());
+                }
+            }
+            else if (nullptr != m_data_queue)
+            {
+                DataType data = {};
+                while (pdPASS == xQueueReceive(m_data_queue, &data, 0))
+                {
+                    unprocessed.push_back(data);
+                }
+            }
+
+            if (m_wake_item_sent.load() && !unprocessed.empty())
+            {
+                // the wake-up item is the newest one
+                unprocessed.pop_back();
+                m_wake_item_sent.store(false);
+            }
+
+            return unprocessed;
         }
 
         // note: native handle allows specific OS calls like setting scheduling policy or setting priority
@@ -264,23 +499,58 @@ namespace tools
             return reinterpret_cast<void*>(&m_task); // NOLINT native handler wrapping as a void*
         }
 
+        /**
+         * @brief Tells whether the task runs with the scheduling policy given at construction.
+         *
+         * @return True without real-time policy, false otherwise: FreeRTOS keeps its fixed-priority scheduling.
+         */
+        [[nodiscard]] bool sched_policy_applied() const
+        {
+            return m_sched_policy_applied;
+        }
+
         /**
          * @brief Submits data to the FreeRTOS queue.
          *
          * This function sends the provided data to the FreeRTOS queue if the queue is not null.
-         * It blocks indefinitely until the data is successfully sent to the queue.
+         * If the queue is full, the overflow policy decides what happens (see set_overflow_policy()); by default
+         * it blocks indefinitely until the data is successfully sent to the queue.
+         * With the lock-free queue policy, the data is pushed in the SPSC queue and the task is notified;
+         * only one producer may call submit() and isr_submit().
          *
          * @param data The data to be submitted to the queue.
+         * @return true if the data has been queued, false if it has been dropped or rejected.
          */
-        void submit(const DataType& data)
+        bool submit(const DataType& data)
         {
             // FreeRTOS platform
 
-            if (nullptr != m_data_queue)
+            bool queued = false;
+
+            if (m_stop_task.load(std::memory_order_relaxed))
             {
-                constexpr const TickType_t x_block_time = portMAX_DELAY; /* NOLINT init to Block indefinitely. */
-                xQueueSend(m_data_queue, &data, x_block_time);
+                // stopping: nobody would process the data
+                return queued;
             }
+
+            if constexpr (QueuePolicy::lock_free)
+            {
+                if (m_task_created)
+                {
+                    queued = m_spsc_queue.push(data) || on_queue_full(data);
+
+                    if (queued)
+                    {
+                        xTaskNotifyGive(m_task);
+                    }
+                }
+            }
+            else if (nullptr != m_data_queue)
+            {
+                queued = (pdPASS == xQueueSend(m_data_queue, &data, 0)) || on_queue_full(data);
+            }
+
+            return queued;
         }
 
         /**
@@ -289,18 +559,165 @@ namespace tools
          * This function is designed to be called from an Interrupt Service Routine (ISR).
          * It sends the provided data to the FreeRTOS queue and yields if a higher priority
          * task was woken up by the send operation.
+         * An ISR cannot wait for room: with the block policy, data submitted to a full queue is rejected.
          *
          * @param data The data to be sent to the queue.
+         * @return true if the data has been queued, false if it has been dropped or rejected.
          */
-        void isr_submit(const DataType& data)
+        bool isr_submit(const DataType& data)
         {
             // FreeRTOS platform
 
-            if (nullptr != m_data_queue)
+            BaseType_t px_higher_priority_task_woken = pdFALSE; // NOLINT initialized with pdFALSE
+            bool queued = false;
+
+            if (m_stop_task.load(std::memory_order_relaxed))
+            {
+                // stopping: nobody would process the data
+                return queued;
+            }
+
+            if constexpr (QueuePolicy::lock_free)
+            {
+                if (m_task_created)
+                {
+                    queued = m_spsc_queue.push(data);
+
+                    if (queued)
+                    {
+                        vTaskNotifyGiveFromISR(m_task, &px_higher_priority_task_woken);
+                    }
+                    else
+                    {
+                        count_discarded(m_overflow_policy.load(std::memory_order_relaxed));
+                    }
+                }
+            }
+            else if (nullptr != m_data_queue)
+            {
+                queued = (pdPASS == xQueueSendFromISR(m_data_queue, &data, &px_higher_priority_task_woken));
+
+                if (!queued)
+                {
+                    const auto policy = m_overflow_policy.load(std::memory_order_relaxed);
+                    DataType oldest = {};
+
+                    if ((data_task_overflow_policy::drop_oldest == policy)
+                        && (pdPASS == xQueueReceiveFromISR(m_data_queue, &oldest, &px_higher_priority_task_woken)))
+                    {
+                        m_overflow_counters.on_dropped_oldest();
+                        queued = (pdPASS == xQueueSendFromISR(m_data_queue, &data, &px_higher_priority_task_woken));
+                    }
+
+                    if (!queued)
+                    {
+                        count_discarded(policy);
+                    }
+                }
+            }
+
+            portYIELD_FROM_ISR(px_higher_priority_task_woken);
+
+            return queued;
+        }
+
+        /**
+         * @brief Selects what submit() does when the data queue is full (block for ever by default).
+         *
+         * @param policy The overflow policy.
+         * @param block_timeout How long a producer may wait for room with the block policy in us (max for ever).
+         */
+        void set_overflow_policy(data_task_overflow_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& block_timeout
+            = std::chrono::duration<std::uint64_t, std::micro>::max())
+        {
+            m_block_timeout_us.store(block_timeout.count(), std::memory_order_relaxed);
+            m_overflow_policy.store(policy, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the current overflow policy.
+         *
+         * @return The overflow policy applied when the data queue is full.
+         */
+        [[nodiscard]] data_task_overflow_policy overflow_policy() const
+        {
+            return m_overflow_policy.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the drop/reject/blocking counters, so that producers can adapt their rate.
+         *
+         * @return A snapshot of the overflow counters.
+         */
+        [[nodiscard]] data_task_overflow_stats overflow_stats() const
+        {
+            return m_overflow_counters.snapshot();
+        }
+
+        /**
+         * @brief Resets the overflow counters to zero.
+         */
+        void reset_overflow_stats()
+        {
+            m_overflow_counters.reset();
+        }
+
+        /**
+         * @brief Makes the task poll for data during a spin window before blocking (0, the default, blocks at once).
+         *
+         * Data submitted within the window is picked up with no context switch, at the price of a busy core: meant
+         * for a task pinned on a core of its own. Ignored on single-core targets.
+         *
+         * @param spin_window How long the task spins before blocking on the queue in us.
+         */
+        void set_busy_poll(const std::chrono::duration<std::uint64_t, std::micro>& spin_window)
+        {
+            m_busy_poll_us.store((cpu_core_count() > 1U) ? spin_window.count() : 0U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the busy-poll spin window.
+         *
+         * @return The spin window in us, 0 when the task blocks at once.
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> busy_poll() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_busy_poll_us.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Retrieves how many waits ended while spinning or after parking, and the time spent spinning.
+         *
+         * @return A snapshot of the busy-poll counters.
+         */
+        [[nodiscard]] data_task_busy_poll_stats busy_poll_stats() const
+        {
+            return m_busy_poll_counters.snapshot();
+        }
+
+        /**
+         * @brief Resets the busy-poll counters to zero.
+         */
+        void reset_busy_poll_stats()
+        {
+            m_busy_poll_counters.reset();
+        }
+
+        /**
+         * @brief Retrieves the number of data items waiting in the queue.
+         *
+         * @return The queue depth, a snapshot taken from any task.
+         */
+        [[nodiscard]] std::size_t queue_depth() const
+        {
+            if constexpr (QueuePolicy::lock_free)
             {
-                BaseType_t px_higher_priority_task_woken = pdFALSE; // NOLINT initialized with pdFALSE
-                xQueueSendFromISR(m_data_queue, &data, &px_higher_priority_task_woken);
-                portYIELD_FROM_ISR(px_higher_priority_task_woken);
+                return m_spsc_queue.size();
+            }
+            else
+            {
+                return (nullptr != m_data_queue) ? static_cast<std::size_t>(uxQueueMessagesWaiting(m_data_queue)) : 0U;
             }
         }
 
@@ -336,31 +753,533 @@ namespace tools
 
             while (!instance->m_stop_task.load())
             {
-                if (nullptr != instance->m_data_queue)
+                // data seen while spinning is received without blocking
+                const TickType_t block_time = instance->spin_for_data() ? 0 : x_block_time;
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+                if (instance->m_batch_routine && (QueuePolicy::lock_free || (nullptr != instance->m_data_queue)))
+                {
+                    TOOLS_TRACE(process_begin, "data_task::process_batches", instance, 0U);
+                    instance->process_batch(block_time, task_name);
+                    TOOLS_TRACE(process_end, "data_task::process_batches", instance, 0U);
+                    continue;
+                }
+#endif
+
+                if constexpr (QueuePolicy::lock_free)
+                {
+                    instance->process_notified(block_time, task_name);
+                }
+                else if (nullptr != instance->m_data_queue)
                 {
                     DataType data = {};
-                    if (pdPASS == xQueueReceive(instance->m_data_queue, &data, x_block_time))
+                    if (pdPASS == xQueueReceive(instance->m_data_queue, &data, block_time))
                     {
-                        instance->m_process_routine(instance->m_context, data, task_name);
+                        TOOLS_TRACE(task_switch, "data_task::resume", instance, 0U);
+                        TOOLS_TRACE(dequeue, "data_task::dequeue", instance, 0U);
+                        instance->process_received(data, task_name);
                     }
                 }
             } // run loop
 
+            instance->drain_on_stop(task_name);
+
             instance->m_task_stopped.store(true);
             vTaskDelete(nullptr);
         }
 
+        /**
+         * @brief Processes data received from the FreeRTOS queue, unless it arrived while stopping and the drain
+         *        policy leaves it for stop() or it is the wake-up item sent by stop().
+         *
+         * @param data The received data.
+         * @param task_name The name of the task.
+         */
+        void process_received(const DataType& data, const std::string& task_name)
+        {
+            if (m_stop_task.load())
+            {
+                if (take_wake_item())
+                {
+                    return;
+                }
+
+                if (!may_process())
+                {
+                    m_unprocessed_item = data;
+                    return;
+                }
+            }
+
+            TOOLS_TRACE(process_begin, "data_task::process", this, 0U);
+            m_process_routine(m_context, data, task_name);
+            TOOLS_TRACE(process_end, "data_task::process", this, 0U);
+        }
+
+        /**
+         * @brief Processes what is left in the queue once stopping, as far as the drain policy allows.
+         *
+         * @param task_name The name of the task.
+         */
+        void drain_on_stop(const std::string& task_name)
+        {
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            if (m_batch_routine)
+            {
+                while (may_process())
+                {
+                    std::size_t batch_size = 0U;
+
+                    if constexpr (QueuePolicy::lock_free)
+                    {
+                        batch_size = m_spsc_queue.pop_range(m_batch_buffer.begin(), m_batch_buffer.end());
+                    }
+                    else if (nullptr != m_data_queue)
+                    {
+                        while ((batch_size < m_batch_buffer.size())
+                            && (pdPASS == xQueueReceive(m_data_queue, &m_batch_buffer[batch_size], 0)))
+                        {
+                            ++batch_size;
+                        }
+
+                        if ((batch_size > 0U) && take_wake_item())
+                        {
+                            --batch_size;
+                        }
+                    }
+
+                    if (0U == batch_size)
+                    {
+                        break;
+                    }
+
+                    m_batch_routine(
+                        m_context, std::span<const DataType>(m_batch_buffer.data(), batch_size), task_name);
+                }
+                return;
+            }
+#endif
+
+            if constexpr (QueuePolicy::lock_free)
+            {
+                process_spsc_queue(task_name);
+            }
+            else if (nullptr != m_data_queue)
+            {
+                DataType data = {};
+                while (may_process() && (pdPASS == xQueueReceive(m_data_queue, &data, 0)))
+                {
+                    process_received(data, task_name);
+                }
+            }
+        }
+
+        /**
+         * @brief Recognizes the wake-up item stop() sends to a task blocked on an empty queue.
+         *
+         * The wake-up item is the newest one: it was just received if the queue is empty now.
+         *
+         * @return true if the item just received is the wake-up item, which is consumed.
+         */
+        bool take_wake_item()
+        {
+            if constexpr (!QueuePolicy::lock_free)
+            {
+                if (m_wake_item_sent.load() && (0U == uxQueueMessagesWaiting(m_data_queue)))
+                {
+                    m_wake_item_sent.store(false);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Wakes up the task so that it notices the stop request.
+         *
+         * With the default queue policy a task can only be blocked on an empty queue: it receives a wake-up item
+         * then, recognized and skipped by take_wake_item().
+         */
+        void wake_to_stop()
+        {
+            if constexpr (QueuePolicy::lock_free)
+            {
+                xTaskNotifyGive(m_task);
+            }
+            else if ((nullptr != m_data_queue) && (0U == uxQueueMessagesWaiting(m_data_queue)))
+            {
+                constexpr const TickType_t x_block_time = 20 * portTICK_PERIOD_MS;
+                DataType value = {};
+                m_wake_item_sent.store(true);
+
+                if (pdPASS != xQueueSend(m_data_queue, &value, x_block_time))
+                {
+                    m_wake_item_sent.store(false);
+                }
+            }
+        }
+
+        /**
+         * @brief Tells whether queued data may still be processed, according to the drain policy once stopping.
+         *
+         * @return true if the task runs, or drains and the drain policy allows more.
+         */
+        [[nodiscard]] bool may_process() const
+        {
+            if (!m_stop_task.load())
+            {
+                return true;
+            }
+
+            switch (m_drain_policy)
+            {
+                case task_drain_policy::drain_all:
+                    return true;
+                case task_drain_policy::drain_deadline:
+                    return (now_us() - m_drain_start_us) < m_drain_timeout_us;
+                case task_drain_policy::discard:
+                default:
+                    return false;
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Waits for data, drains up to the configured batch size and hands the batch to the batch routine.
+         *
+         * @param x_block_time Ticks to wait for the first item of the batch.
+         * @param task_name The name of the task.
+         */
+        void process_batch(TickType_t x_block_time, const std::string& task_name)
+        {
+            if constexpr (QueuePolicy::lock_free)
+            {
+                process_notified_batch(x_block_time, task_name);
+                return;
+            }
+
+            const std::size_t max_batch_size = m_batch_buffer.size();
+            std::size_t batch_size = 0U;
+
+            if (pdPASS != xQueueReceive(m_data_queue, &m_batch_buffer[batch_size], x_block_time))
+            {
+                return;
+            }
+            ++batch_size;
+
+            // drain what is already queued
+            while ((batch_size < max_batch_size)
+                && (pdPASS == xQueueReceive(m_data_queue, &m_batch_buffer[batch_size], 0)))
+            {
+                ++batch_size;
+            }
+
+            if ((batch_size < max_batch_size) && (m_batch_linger.count() > 0U))
+            {
+                // coalesce: give producers a chance to complete the batch
+                const TickType_t linger_ticks = pdMS_TO_TICKS(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(m_batch_linger).count());
+                const TickType_t start_tick = xTaskGetTickCount();
+                TickType_t elapsed_ticks = 0;
+
+                while ((batch_size < max_batch_size) && (elapsed_ticks < linger_ticks)
+                    && (pdPASS
+                        == xQueueReceive(m_data_queue, &m_batch_buffer[batch_size], linger_ticks - elapsed_ticks)))
+                {
+                    ++batch_size;
+                    elapsed_ticks = xTaskGetTickCount() - start_tick;
+                }
+            }
+
+            if (m_stop_task.load() && take_wake_item())
+            {
+                --batch_size;
+            }
+
+            if (0U == batch_size)
+            {
+                return;
+            }
+
+            m_batch_routine(m_context, std::span<const DataType>(m_batch_buffer.data(), batch_size), task_name);
+        }
+#endif
+
+        /**
+         * @brief Polls the data queue during the busy-poll spin window.
+         *
+         * @return true if data was queued within the window, false if the task has to block.
+         */
+        bool spin_for_data()
+        {
+            const std::uint64_t spin_window_us = m_busy_poll_us.load(std::memory_order_relaxed);
+
+            if (0U == spin_window_us)
+            {
+                return false;
+            }
+
+            const std::uint64_t start_us = now_us();
+            std::uint64_t spin_us = 0U;
+            bool found_data = false;
+
+            while (!found_data && (spin_us < spin_window_us) && !m_stop_task.load(std::memory_order_relaxed))
+            {
+                if constexpr (QueuePolicy::lock_free)
+                {
+                    found_data = !m_spsc_queue.empty();
+                }
+                else
+                {
+                    found_data = (nullptr != m_data_queue) && (0U != uxQueueMessagesWaiting(m_data_queue));
+                }
+
+                if (!found_data)
+                {
+                    cpu_relax();
+                    spin_us = now_us() - start_us;
+                }
+            }
+
+            m_busy_poll_counters.on_spin(found_data, spin_us);
+            return found_data;
+        }
+
+        static std::uint64_t now_us()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#endif
+        }
+
+        /**
+         * @brief Applies the overflow policy to data that did not fit in the queue, from a task context.
+         *
+         * @param data The submitted data.
+         * @return true if the data has been queued after all.
+         */
+        bool on_queue_full(const DataType& data)
+        {
+            const auto policy = m_overflow_policy.load(std::memory_order_relaxed);
+            bool queued = false;
+
+            if (data_task_overflow_policy::block == policy)
+            {
+                const std::uint64_t timeout_us = m_block_timeout_us.load(std::memory_order_relaxed);
+                const TickType_t timeout_ticks = (std::numeric_limits<std::uint64_t>::max() == timeout_us)
+                    ? portMAX_DELAY
+                    : static_cast<TickType_t>(pdMS_TO_TICKS(timeout_us / 1000U));
+                const TickType_t start_tick = xTaskGetTickCount();
+
+                if constexpr (QueuePolicy::lock_free)
+                {
+                    constexpr TickType_t wait_tick = 1;
+                    TickType_t elapsed_ticks = 0;
+
+                    while (!queued && !m_stop_task.load() && (elapsed_ticks < timeout_ticks))
+                    {
+                        // queue full: wake up the consumer and let it drain
+                        xTaskNotifyGive(m_task);
+                        vTaskDelay(wait_tick);
+                        queued = m_spsc_queue.push(data);
+                        elapsed_ticks = xTaskGetTickCount() - start_tick;
+                    }
+                }
+                else
+                {
+                    queued = (pdPASS == xQueueSend(m_data_queue, &data, timeout_ticks));
+                }
+
+                const auto elapsed_ticks = static_cast<std::uint64_t>(xTaskGetTickCount() - start_tick);
+                m_overflow_counters.on_blocked(elapsed_ticks * portTICK_PERIOD_MS * 1000U);
+
+                if (!queued)
+                {
+                    m_overflow_counters.on_rejected();
+                }
+
+                return queued;
+            }
+
+            if constexpr (!QueuePolicy::lock_free)
+            {
+                // only the consumer may pop a lock-free SPSC queue, drop_oldest falls back to drop_newest there
+                DataType oldest = {};
+
+                if ((data_task_overflow_policy::drop_oldest == policy)
+                    && (pdPASS == xQueueReceive(m_data_queue, &oldest, 0)))
+                {
+                    m_overflow_counters.on_dropped_oldest();
+                    queued = (pdPASS == xQueueSend(m_data_queue, &data, 0));
+                }
+            }
+
+            if (!queued)
+            {
+                count_discarded(policy);
+            }
+
+            return queued;
+        }
+
+        /**
+         * @brief Counts submitted data that could not be queued.
+         *
+         * @param policy The overflow policy in use.
+         */
+        void count_discarded(data_task_overflow_policy policy)
+        {
+            if ((data_task_overflow_policy::fail == policy) || (data_task_overflow_policy::block == policy))
+            {
+                m_overflow_counters.on_rejected();
+            }
+            else
+            {
+                m_overflow_counters.on_dropped_newest();
+            }
+        }
+
+        /**
+         * @brief Creates the FreeRTOS queue used by the default queue policy.
+         *
+         * @param data_queue_depth The depth of the data queue.
+         */
+        void create_data_queue(std::size_t data_queue_depth)
+        {
+            if constexpr (!QueuePolicy::lock_free)
+            {
+                m_data_queue = xQueueCreate(data_queue_depth, sizeof(DataType));
+
+                if (nullptr == m_data_queue)
+                {
+                    LOG_ERROR("FATAL error: xQueueCreate() failed for task %s", this->task_name().c_str());
+                }
+            }
+        }
+
+        /**
+         * @brief Waits for a task notification, then processes everything queued in the SPSC queue.
+         *
+         * @param x_block_time Ticks to wait for the notification.
+         * @param task_name The name of the task.
+         */
+        void process_notified(TickType_t x_block_time, const std::string& task_name)
+        {
+            if (0U == ulTaskNotifyTake(pdTRUE, x_block_time))
+            {
+                return;
+            }
+            TOOLS_TRACE(task_switch, "data_task::resume", this, 0U);
+
+            process_spsc_queue(task_name);
+        }
+
+        /**
+         * @brief Processes the SPSC queue content until it is empty or the drain policy says stop.
+         *
+         * @param task_name The name of the task.
+         */
+        void process_spsc_queue(const std::string& task_name)
+        {
+            while (may_process())
+            {
+                auto data = m_spsc_queue.front_pop();
+
+                if (!data.has_value())
+                {
+                    break;
+                }
+
+                TOOLS_TRACE(dequeue, "data_task::dequeue", this, 0U);
+                TOOLS_TRACE(process_begin, "data_task::process", this, 0U);
+                m_process_routine(m_context, data.value(), task_name);
+                TOOLS_TRACE(process_end, "data_task::process", this, 0U);
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Waits for a task notification, then hands the SPSC queue content to the batch routine.
+         *
+         * @param x_block_time Ticks to wait for the notification.
+         * @param task_name The name of the task.
+         */
+        void process_notified_batch(TickType_t x_block_time, const std::string& task_name)
+        {
+            if (0U == ulTaskNotifyTake(pdTRUE, x_block_time))
+            {
+                return;
+            }
+
+            std::size_t batch_size = m_spsc_queue.pop_range(m_batch_buffer.begin(), m_batch_buffer.end());
+
+            if ((batch_size < m_batch_buffer.size()) && (m_batch_linger.count() > 0U))
+            {
+                // coalesce: give producers a chance to complete the batch
+                const TickType_t linger_ticks = pdMS_TO_TICKS(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(m_batch_linger).count());
+                const TickType_t start_tick = xTaskGetTickCount();
+                TickType_t elapsed_ticks = 0;
+
+                while ((batch_size < m_batch_buffer.size()) && (elapsed_ticks < linger_ticks)
+                    && !m_stop_task.load())
+                {
+                    ulTaskNotifyTake(pdTRUE, linger_ticks - elapsed_ticks);
+                    batch_size += m_spsc_queue.pop_range(m_batch_buffer.begin() + batch_size, m_batch_buffer.end());
+                    elapsed_ticks = xTaskGetTickCount() - start_tick;
+                }
+            }
+
+            if (batch_size > 0U)
+            {
+                m_batch_routine(m_context, std::span<const DataType>(m_batch_buffer.data(), batch_size), task_name);
+            }
+
+            if (batch_size == m_batch_buffer.size())
+            {
+                // more data may be left behind a full batch: keep the notification pending
+                xTaskNotifyGive(m_task);
+            }
+        }
+#endif
+
+        using spsc_queue_type = typename detail::data_task_queue_selector<QueuePolicy, DataType,
+            detail::data_task_no_queue<DataType>>::type;
+
         call_back m_startup_routine;
         data_call_back m_process_routine;
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        batch_call_back m_batch_routine;
+        std::vector<DataType> m_batch_buffer;
+        std::chrono::duration<std::uint64_t, std::micro> m_batch_linger = {};
+#endif
         QueueHandle_t m_data_queue = {};
+        spsc_queue_type m_spsc_queue;
+        std::atomic<data_task_overflow_policy> m_overflow_policy = data_task_overflow_policy::block;
+        std::atomic<std::uint64_t> m_block_timeout_us = std::numeric_limits<std::uint64_t>::max();
+        detail::data_task_overflow_counters m_overflow_counters;
+        std::atomic<std::uint64_t> m_busy_poll_us = 0U;
+        detail::data_task_busy_poll_counters m_busy_poll_counters;
         std::shared_ptr<Context> m_context;
 
         std::atomic_bool m_stop_task = false;
 
         TaskHandle_t m_task = {};
+        bool m_sched_policy_applied = true;
         bool m_task_created = false;
         std::atomic_bool m_task_stopped = false;
 
+        // written by stop() before m_stop_task, read by the task once it sees m_stop_task
+        task_drain_policy m_drain_policy = task_drain_policy::discard;
+        std::uint64_t m_drain_timeout_us = 0U;
+        std::uint64_t m_drain_start_us = 0U;
+        std::atomic_bool m_wake_item_sent = false;
+        std::optional<DataType> m_unprocessed_item; // received while stopping, handed back by stop()
+
         std::chrono::duration<std::uint64_t, std::micro> m_data_timeout;
     };
 }
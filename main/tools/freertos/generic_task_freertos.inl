@@ -103,6 +103,30 @@ namespace tools
                 this->stack_size(), this->cpu_affinity(), this->priority());
         }
 
+        /**
+         * @brief Constructs a generic_task object running in caller-provided storage.
+         *
+         * The stack and control block come from storage instead of the heap; storage must outlive the task.
+         *
+         * @param routine The callback routine to be executed by the task.
+         * @param context A shared pointer to the context in which the task operates.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU core affinity for the task.
+         * @param priority The priority of the task.
+         */
+        generic_task(call_back&& routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            const task_storage& storage, int cpu_affinity, int priority)
+            : base_task(task_name, storage.stack_size, cpu_affinity, priority)
+            , m_routine(std::move(routine))
+            , m_context(context)
+        {
+            // FreeRTOS platform
+            m_task_created = task_create_static(&m_task, this->task_name(), single_call,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                storage.stack, storage.stack_size, storage.control_block, this->cpu_affinity(), this->priority());
+        }
+
         /**
          * @brief Constructs a generic_task object using perfect forwarding.
          *
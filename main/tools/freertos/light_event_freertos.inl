@@ -0,0 +1,231 @@
+/**
+ * @file light_event_freertos.inl
+ * @brief Lightweight auto-reset event using FreeRTOS direct-to-task notifications.
+ *
+ * The event keeps its state in an atomic word and records the task parked on it: a signal() nobody waits for
+ * is a single atomic exchange, and a parked task is woken with a task notification instead of an event group.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "tools/non_copyable.hpp"
+
+/**
+ * @brief Task notification index used by light_event.
+ *
+ * Defaults to the last entry of the notification array. When the array has a single entry (the ESP-IDF
+ * default) the index is shared with other users such as data_task; light_event then gives back a notification
+ * it took without being signaled, so the other user still sees it.
+ */
+#if !defined(LIGHT_EVENT_NOTIFY_INDEX)
+#if defined(configTASK_NOTIFICATION_ARRAY_ENTRIES)
+#define LIGHT_EVENT_NOTIFY_INDEX (configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)
+#else
+#define LIGHT_EVENT_NOTIFY_INDEX 0
+#endif
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Auto-reset event with the sync_object interface and an uncontended fast path.
+     *
+     * Signals do not accumulate: several signals before a wait are consumed by one wait. Any number of tasks
+     * (and ISRs) may signal. One task at a time is parked with a notification; a second concurrent waiter
+     * polls the state every tick.
+     */
+    class light_event : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        /**
+         * @brief Constructor for the light_event class, initially not signaled.
+         */
+        light_event() = default;
+
+        /**
+         * @brief Destructor for the light_event class, sets the signal and wakes the parked task.
+         */
+        ~light_event()
+        {
+            signal();
+        }
+
+        /**
+         * @brief Signals the event, notifying the parked task if there is one.
+         */
+        void signal()
+        {
+            // seq_cst pairs the state exchange with the waiter registration of wait()
+            if (signaled_state != m_state.exchange(signaled_state, std::memory_order_seq_cst))
+            {
+                TaskHandle_t waiter = m_waiter.load(std::memory_order_seq_cst);
+                if (nullptr != waiter)
+                {
+                    (void)xTaskNotifyGiveIndexed(waiter, LIGHT_EVENT_NOTIFY_INDEX);
+                }
+            }
+        }
+
+        /**
+         * @brief Signals the event from an ISR context, yielding if the parked task has a higher priority.
+         */
+        void isr_signal()
+        {
+            if (signaled_state != m_state.exchange(signaled_state, std::memory_order_seq_cst))
+            {
+                TaskHandle_t waiter = m_waiter.load(std::memory_order_seq_cst);
+                if (nullptr != waiter)
+                {
+                    BaseType_t px_higher_priority_task_woken = pdFALSE;
+                    vTaskNotifyGiveIndexedFromISR(waiter, LIGHT_EVENT_NOTIFY_INDEX, &px_higher_priority_task_woken);
+                    portYIELD_FROM_ISR(px_higher_priority_task_woken);
+                }
+            }
+        }
+
+        /**
+         * @brief Checks if the event is signaled.
+         *
+         * @return true if the event is signaled, false otherwise.
+         */
+        [[nodiscard]] bool is_signaled() const
+        {
+            return signaled_state == m_state.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Consumes the signal if it is set, without waiting.
+         *
+         * @return true if the event was signaled (the signal is then cleared), false otherwise.
+         */
+        [[nodiscard]] bool try_wait_for_signal()
+        {
+            std::uint32_t expected = signaled_state;
+            return m_state.compare_exchange_strong(expected, idle_state, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Waits for the signal to be set, then consumes it.
+         */
+        void wait_for_signal()
+        {
+            wait(portMAX_DELAY);
+        }
+
+        /**
+         * @brief Waits for the signal with a specified timeout, and consumes it if it was set.
+         *
+         * @param timeout The maximum duration to wait for the signal, rounded up to whole ticks.
+         */
+        void wait_for_signal(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            constexpr std::uint64_t max_timeout_ms = std::uint64_t { 1U } << 32U;
+            const std::uint64_t timeout_ms = (timeout.count() / 1000U) + ((0U != (timeout.count() % 1000U)) ? 1U : 0U);
+            const std::uint64_t ticks
+                = ((timeout_ms < max_timeout_ms) ? timeout_ms : max_timeout_ms) * configTICK_RATE_HZ / 1000U;
+            const std::uint64_t max_ticks = static_cast<std::uint64_t>(portMAX_DELAY) - 1U;
+            wait(static_cast<TickType_t>((ticks < max_ticks) ? ticks : max_ticks));
+        }
+
+    private:
+        static constexpr std::uint32_t idle_state = 0U;
+        static constexpr std::uint32_t signaled_state = 1U;
+
+        /**
+         * @brief Parks the calling task until the signal is consumed or the ticks have elapsed.
+         */
+        void wait(TickType_t ticks)
+        {
+            if (try_wait_for_signal() || (0U == ticks))
+            {
+                return;
+            }
+
+            TaskHandle_t self = xTaskGetCurrentTaskHandle();
+            TaskHandle_t vacant = nullptr;
+            if (!m_waiter.compare_exchange_strong(vacant, self, std::memory_order_seq_cst))
+            {
+                poll(ticks);
+                return;
+            }
+
+            const TickType_t start_tick = xTaskGetTickCount();
+            bool foreign_notification = false;
+            while (!try_wait_for_signal())
+            {
+                const TickType_t elapsed_ticks = xTaskGetTickCount() - start_tick;
+                if ((portMAX_DELAY != ticks) && (elapsed_ticks >= ticks))
+                {
+                    break;
+                }
+
+                const TickType_t remaining_ticks = (portMAX_DELAY == ticks) ? portMAX_DELAY : (ticks - elapsed_ticks);
+                if ((0U != ulTaskNotifyTakeIndexed(LIGHT_EVENT_NOTIFY_INDEX, pdTRUE, remaining_ticks))
+                    && !is_signaled())
+                {
+                    foreign_notification = true;
+                }
+            }
+
+            m_waiter.store(nullptr, std::memory_order_seq_cst);
+
+            if ((0 == LIGHT_EVENT_NOTIFY_INDEX) && foreign_notification)
+            {
+                // shared index: hand the notification back to whoever else waits on it
+                (void)xTaskNotifyGiveIndexed(self, LIGHT_EVENT_NOTIFY_INDEX);
+            }
+        }
+
+        /**
+         * @brief Tick polling for a task waiting while another one is parked.
+         */
+        void poll(TickType_t ticks)
+        {
+            const TickType_t start_tick = xTaskGetTickCount();
+            while (!try_wait_for_signal())
+            {
+                if ((portMAX_DELAY != ticks) && ((xTaskGetTickCount() - start_tick) >= ticks))
+                {
+                    break;
+                }
+                vTaskDelay(1);
+            }
+        }
+
+        std::atomic<std::uint32_t> m_state = idle_state;
+        std::atomic<TaskHandle_t> m_waiter = nullptr;
+    };
+}
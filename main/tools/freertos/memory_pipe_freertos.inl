@@ -35,6 +35,7 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -52,9 +53,14 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/message_buffer.h>
 
+#include "tools/alloc_hint.hpp"
+#include "tools/expected.hpp"
 #include "tools/logger.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/pipe_error.hpp"
 #include "tools/platform_helpers.hpp"
+#include "tools/shared_payload.hpp"
+#include "tools/wait_set.hpp"
 
 namespace tools
 {
@@ -73,6 +79,50 @@ namespace tools
          */
         using static_buffer_holder = StaticMessageBuffer_t;
 
+        /**
+         * @brief Contiguous writable area of the pipe returned by reserve().
+         */
+        struct write_region
+        {
+            std::uint8_t* data = nullptr; ///< First writable byte, nullptr when nothing could be reserved.
+            std::size_t size = 0U;        ///< Number of writable bytes.
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            [[nodiscard]] std::span<std::uint8_t> as_span() const
+            {
+                return std::span<std::uint8_t>(data, size);
+            }
+#endif
+        };
+
+        /**
+         * @brief Readable area of the pipe returned by peek(), split in two parts when it wraps around.
+         */
+        struct read_regions
+        {
+            const std::uint8_t* first = nullptr;  ///< Oldest readable bytes.
+            std::size_t first_size = 0U;          ///< Number of bytes in the first part.
+            const std::uint8_t* second = nullptr; ///< Continuation after the wrap-around point, if any.
+            std::size_t second_size = 0U;         ///< Number of bytes in the second part.
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return first_size + second_size;
+            }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            [[nodiscard]] std::span<const std::uint8_t> first_span() const
+            {
+                return std::span<const std::uint8_t>(first, first_size);
+            }
+
+            [[nodiscard]] std::span<const std::uint8_t> second_span() const
+            {
+                return std::span<const std::uint8_t>(second, second_size);
+            }
+#endif
+        };
+
         memory_pipe() = delete;
 
         /**
@@ -131,6 +181,38 @@ namespace tools
             }
         }
 
+        /**
+         * @brief Constructor for the memory_pipe class with a buffer allocated from the memory matching a hint.
+         *
+         * The pipe owns the storage area of its static message buffer, e.g. in PSRAM for a large pipe between
+         * tasks or in DMA capable memory.
+         *
+         * @param buffer_size The size of the buffer to be used.
+         * @param buffer_hint Memory the buffer is allocated from.
+         */
+        memory_pipe(std::size_t buffer_size, alloc_hint buffer_hint)
+            : m_capacity(buffer_size)
+            , m_owned_storage(make_hinted_unique<std::uint8_t[]>(buffer_size + 1U, buffer_hint))
+        {
+            // a static message buffer storage area holds one byte more than the capacity
+            if (!m_owned_storage)
+            {
+                LOG_ERROR("FATAL error: memory_pipe buffer allocation failed");
+                return;
+            }
+
+            m_message_buffer_hnd = xMessageBufferCreateStatic(m_capacity, m_owned_storage.get(), &m_owned_holder);
+
+            if (nullptr == m_message_buffer_hnd)
+            {
+                LOG_ERROR("FATAL error: xMessageBufferCreateStatic() failed");
+            }
+            else
+            {
+                m_static_msg_buffer = &m_owned_holder;
+            }
+        }
+
         /**
          * @brief Destructor for the memory_pipe class.
          *
@@ -158,6 +240,16 @@ namespace tools
             return m_capacity;
         }
 
+        /**
+         * @brief Gets the hook registering the reader side of the pipe with a wait_set.
+         *
+         * @return The hook, notified whenever bytes are sent.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
         /**
          * @brief Sends data to the message pipe (internally FreeRTOS message buffer).
          *
@@ -182,6 +274,38 @@ namespace tools
                 sent = xMessageBufferSend(m_message_buffer_hnd, data, send_bytes, ticks_to_wait);
             }
 
+            if (sent > 0U)
+            {
+                m_ready_hook.notify();
+            }
+
+            return sent;
+        }
+
+        /**
+         * @brief Sends data as send() does, reporting a short transfer as an error value.
+         *
+         * @param data Pointer to the data buffer to be sent.
+         * @param send_bytes Number of bytes to send from the data buffer.
+         * @param timeout Maximum duration to wait for the send operation to complete.
+         * @return send_bytes, or the error with the number of bytes sent before it (0, a message is atomic).
+         */
+        [[nodiscard]] expected<std::size_t, pipe_transfer_error> send_result(const std::uint8_t* data,
+            std::size_t send_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            if (nullptr == m_message_buffer_hnd)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::not_created, 0U });
+            }
+            if (nullptr == data)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::invalid_argument, 0U });
+            }
+            const std::size_t sent = send(data, send_bytes, timeout);
+            if (sent < send_bytes)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::timed_out, sent });
+            }
             return sent;
         }
 
@@ -311,6 +435,33 @@ namespace tools
             return received;
         }
 
+        /**
+         * @brief Receives one message as receive() does, reporting an empty receive as an error value.
+         *
+         * @param data Pointer to the buffer where the received data will be stored.
+         * @param rcv_bytes The capacity of the buffer.
+         * @param timeout The maximum duration to wait for the data, specified as a std::chrono::duration.
+         * @return The size of the message received, or the error (also when the message exceeds rcv_bytes).
+         */
+        [[nodiscard]] expected<std::size_t, pipe_transfer_error> receive_result(
+            std::uint8_t* data, std::size_t rcv_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            if (nullptr == m_message_buffer_hnd)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::not_created, 0U });
+            }
+            if (nullptr == data)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::invalid_argument, 0U });
+            }
+            const std::size_t received = receive(data, rcv_bytes, timeout);
+            if ((0U == received) && (0U != rcv_bytes))
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::timed_out, 0U });
+            }
+            return received;
+        }
+
         /**
          * @brief Receives data from the message pipe (internally FreeRTOS message buffer).
          *
@@ -383,6 +534,10 @@ namespace tools
                 BaseType_t px_higher_priority_task_woken = pdFALSE;
                 sent
                     = xMessageBufferSendFromISR(m_message_buffer_hnd, data, send_bytes, &px_higher_priority_task_woken);
+                if (sent > 0U)
+                {
+                    m_ready_hook.isr_notify();
+                }
                 portYIELD_FROM_ISR(px_higher_priority_task_woken);
             }
 
@@ -559,9 +714,257 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Reserves writable space for the next message (producer path).
+         *
+         * Message buffers do not expose their storage, so the region is a staging area owned by the pipe
+         * and commit() moves it into the message buffer as one message: the serialization copy into a
+         * temporary std::vector is avoided, the kernel copy remains. Only the producer task may call
+         * reserve() and commit().
+         *
+         * @param reserve_bytes Number of bytes wanted.
+         * @return The writable region, at most the largest message the pipe can hold.
+         */
+        [[nodiscard]] write_region reserve(std::size_t reserve_bytes)
+        {
+            write_region region;
+
+            if (nullptr == m_message_buffer_hnd)
+            {
+                return region;
+            }
+
+            if (m_reserve_buffer.empty())
+            {
+                m_reserve_buffer.resize(max_message_size());
+            }
+
+            region.size = std::min(reserve_bytes, m_reserve_buffer.size());
+            region.data = (region.size > 0U) ? m_reserve_buffer.data() : nullptr;
+            m_reserved_bytes = region.size;
+
+            return region;
+        }
+
+        /**
+         * @brief Sends the bytes written in the region returned by the last reserve() call as one message.
+         *
+         * @param commit_bytes Number of bytes written, clamped to the reserved size.
+         * @return The number of bytes sent, 0 if the message buffer has not enough space.
+         */
+        std::size_t commit(std::size_t commit_bytes)
+        {
+            const std::size_t committed = std::min(commit_bytes, m_reserved_bytes);
+            m_reserved_bytes = 0U;
+
+            if ((0U == committed) || (nullptr == m_message_buffer_hnd))
+            {
+                return 0U;
+            }
+
+            const std::size_t sent = xMessageBufferSend(m_message_buffer_hnd, m_reserve_buffer.data(), committed, 0);
+            if (sent > 0U)
+            {
+                m_ready_hook.notify();
+            }
+
+            return sent;
+        }
+
+        /**
+         * @brief Exposes the bytes of the next message (consumer path).
+         *
+         * The next message is pulled from the message buffer into a staging area owned by the pipe and stays
+         * there until consume() has released all its bytes. Bytes pulled this way are not visible to receive().
+         * Only the consumer task may call peek() and consume().
+         *
+         * @return The readable regions (a message never wraps, the second part is always empty).
+         */
+        [[nodiscard]] read_regions peek()
+        {
+            read_regions regions;
+
+            if (nullptr == m_message_buffer_hnd)
+            {
+                return regions;
+            }
+
+            if (m_peek_offset == m_peek_size)
+            {
+                if (m_peek_buffer.empty())
+                {
+                    m_peek_buffer.resize(max_message_size());
+                }
+
+                m_peek_offset = 0U;
+                m_peek_size
+                    = xMessageBufferReceive(m_message_buffer_hnd, m_peek_buffer.data(), m_peek_buffer.size(), 0);
+            }
+
+            regions.first_size = m_peek_size - m_peek_offset;
+            regions.first = (regions.first_size > 0U) ? (m_peek_buffer.data() + m_peek_offset) : nullptr;
+
+            return regions;
+        }
+
+        /**
+         * @brief Waits until bytes are readable, without consuming them (consumer side, before peek()).
+         *
+         * The next message is pulled into the peek() staging area when it arrives.
+         *
+         * @param timeout Maximum duration to wait.
+         * @return true if bytes are readable.
+         */
+        bool wait_for_data(const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            if ((nullptr == m_message_buffer_hnd) || (m_peek_offset < m_peek_size))
+            {
+                return m_peek_offset < m_peek_size;
+            }
+
+            if (m_peek_buffer.empty())
+            {
+                m_peek_buffer.resize(max_message_size());
+            }
+
+            const TickType_t ticks_to_wait = static_cast<TickType_t>(timeout.count() * portTICK_PERIOD_MS);
+            m_peek_offset = 0U;
+            m_peek_size = xMessageBufferReceive(
+                m_message_buffer_hnd, m_peek_buffer.data(), m_peek_buffer.size(), ticks_to_wait);
+            return m_peek_size > 0U;
+        }
+
+        /**
+         * @brief Releases bytes previously exposed by peek().
+         *
+         * @param consume_bytes Number of bytes processed, clamped to the readable size.
+         * @return The number of bytes released.
+         */
+        std::size_t consume(std::size_t consume_bytes)
+        {
+            const std::size_t consumed = std::min(consume_bytes, m_peek_size - m_peek_offset);
+            m_peek_offset += consumed;
+            return consumed;
+        }
+
+        /**
+         * @brief Sends one message; the same call as send(), a message buffer keeping every send whole.
+         *
+         * @param data Pointer to the message bytes.
+         * @param send_bytes Message size, at most the capacity minus the sizeof(size_t) length header.
+         * @param timeout Maximum duration to wait for room for the whole message.
+         * @return send_bytes if the message was sent, 0 otherwise.
+         */
+        [[nodiscard]] std::size_t send_message(const std::uint8_t* data, std::size_t send_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send(data, send_bytes, timeout);
+        }
+
+        /**
+         * @brief Receives the next message into a caller buffer.
+         *
+         * @param data Destination buffer.
+         * @param capacity Destination capacity; a larger message stays in the pipe and 0 is returned.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time or it does not fit.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::uint8_t* data, std::size_t capacity, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return receive(data, capacity, timeout);
+        }
+
+        /**
+         * @brief Receives the next message into a reused vector, resized to the message size.
+         *
+         * The vector is grown to the largest message once and only shrunk afterwards, so its storage is reused.
+         *
+         * @param data Destination vector, cleared when no message arrived in time.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::vector<std::uint8_t>& data, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            data.resize(max_message_size());
+            const std::size_t received = receive(data.data(), data.size(), timeout);
+            data.resize(received);
+            return received;
+        }
+
+        /**
+         * @brief Sends a shared payload as one message, copied into the pipe straight from its block.
+         *
+         * @param payload Message bytes.
+         * @param timeout Maximum duration to wait for room for the whole message.
+         * @return The payload size if the message was sent, 0 otherwise.
+         */
+        [[nodiscard]] std::size_t send_message(const shared_payload<std::uint8_t>& payload,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send_message(payload.data(), payload.size(), timeout);
+        }
+
+        /**
+         * @brief Receives the next message into a new shared payload of exactly the message size.
+         *
+         * The message buffer only hands out whole messages, so the bytes go through a reused staging vector.
+         *
+         * @param payload Destination, emptied when no message arrived in time.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            shared_payload<std::uint8_t>& payload, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            const std::size_t received = receive_message(m_payload_buffer, timeout);
+            payload = (0U != received) ? shared_payload<std::uint8_t>(m_payload_buffer.data(), received)
+                                       : shared_payload<std::uint8_t>();
+            return received;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of send_message().
+         */
+        [[nodiscard]] std::size_t send_message(
+            std::span<const std::uint8_t> data, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send_message(data.data(), data.size(), timeout);
+        }
+
+        /**
+         * @brief C++20 span overload of receive_message().
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::span<std::uint8_t> destination, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return receive_message(destination.data(), destination.size(), timeout);
+        }
+#endif
+
     private:
+        /**
+         * @brief Largest message the message buffer can store (each message is prefixed by its length).
+         */
+        [[nodiscard]] std::size_t max_message_size() const
+        {
+            return (m_capacity > sizeof(std::size_t)) ? (m_capacity - sizeof(std::size_t)) : 0U;
+        }
+
         std::size_t m_capacity = 0;
         MessageBufferHandle_t m_message_buffer_hnd = nullptr;
+        wait_set_hook m_ready_hook; // notified when a message is sent
         static_buffer_holder* m_static_msg_buffer = nullptr;
+        hinted_unique_ptr<std::uint8_t[]> m_owned_storage; // storage of the hinted constructor, freed after the handle
+        static_buffer_holder m_owned_holder = {};
+
+        std::vector<std::uint8_t> m_reserve_buffer; // reserve()/commit() staging area, producer side
+        std::size_t m_reserved_bytes = 0U;
+        std::vector<std::uint8_t> m_peek_buffer; // peek()/consume() staging area, consumer side
+        std::size_t m_peek_size = 0U;
+        std::size_t m_peek_offset = 0U;
+        std::vector<std::uint8_t> m_payload_buffer; // shared_payload receive staging area, consumer side
     };
 }
@@ -49,7 +49,13 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+
 #include "tools/base_task.hpp"
+#include "tools/periodic_task_stats.hpp"
+#include "tools/periodic_wakeup.hpp"
 #include "tools/platform_helpers.hpp"
 
 namespace tools
@@ -110,6 +116,37 @@ namespace tools
                 this->stack_size(), this->cpu_affinity(), this->priority());
         }
 
+        /**
+         * @brief Constructs a periodic_task object running in caller-provided task storage.
+         *
+         * The stack and control block come from storage instead of the heap; storage must outlive the task.
+         *
+         * @param startup_routine The callback function to be executed at startup.
+         * @param periodic_routine The callback function to be executed periodically.
+         * @param context Shared pointer to the context object.
+         * @param task_name The name of the task.
+         * @param period The period of the task in microseconds.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity of the task.
+         * @param priority The priority of the task.
+         */
+        periodic_task(call_back&& startup_routine, call_back&& periodic_routine,
+            const std::shared_ptr<Context>& context, const std::string& task_name,
+            const std::chrono::duration<std::uint64_t, std::micro>& period, const task_storage& storage,
+            int cpu_affinity, int priority)
+            : base_task(task_name, storage.stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_periodic_routine(std::move(periodic_routine))
+            , m_context(context)
+            , m_period(period)
+        {
+            // FreeRTOS platform
+
+            m_task_created = task_create_static(&m_task, this->task_name(), periodic_call,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                storage.stack, storage.stack_size, storage.control_block, this->cpu_affinity(), this->priority());
+        }
+
         /**
          * @brief Constructs a periodic_task object using perfect forwarding.
          *
@@ -240,6 +277,56 @@ namespace tools
             return reinterpret_cast<void*>(&m_task); // NOLINT native handler wrapping as a void*
         }
 
+        /**
+         * @brief Retrieves the timing statistics of the task.
+         *
+         * Wakeup lateness is measured against the vTaskDelayUntil() deadline with tick granularity, execution time
+         * of the periodic routine with esp_timer on ESP32 (ticks elsewhere), both in microseconds. Overruns count
+         * the iterations that started past the next deadline, and the periods skipped to catch up.
+         *
+         * @return A snapshot of the statistics.
+         */
+        [[nodiscard]] periodic_task_stats stats() const
+        {
+            return m_stats.snapshot();
+        }
+
+        /**
+         * @brief Clears the timing statistics of the task.
+         */
+        void reset_stats()
+        {
+            m_stats.reset();
+        }
+
+        /**
+         * @brief Selects how the task waits for its deadlines, from the next period on.
+         *
+         * By default the task waits with vTaskDelayUntil(), at tick granularity. On ESP32 the hybrid wakeup
+         * keeps microsecond deadlines on esp_timer instead: it sleeps whole ticks until a guard before the
+         * deadline, the guard following the oversleep measured at every period, then spins. The spin keeps the
+         * core, so pin the task and leave the idle task of that core enough time for the task watchdog; a period
+         * shorter than a tick spins throughout. Other FreeRTOS ports have no microsecond clock and ignore it.
+         *
+         * @param precision The wakeup settings.
+         */
+        void set_precision(const periodic_precision& precision)
+        {
+            m_max_spin_us.store(precision.max_spin.count(), std::memory_order_relaxed);
+            m_compensate_lateness.store(precision.compensate_lateness, std::memory_order_relaxed);
+            m_hybrid_wakeup.store(precision.hybrid_wakeup, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the guard the hybrid wakeup leaves between the end of its sleep and the deadline.
+         *
+         * @return The calibrated guard, 0 until a hybrid period ran.
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> spin_guard() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_spin_guard_us.load(std::memory_order_relaxed));
+        }
+
     private:
         /**
          * @brief Periodic call function for FreeRTOS tasks.
@@ -272,36 +359,149 @@ namespace tools
             }
 
             const std::string& task_name = instance->task_name();
+#if defined(ESP_PLATFORM)
+            wakeup_calibrator calibrator(static_cast<std::int64_t>(ticks_to_us(1U)));
+            const auto hybrid_period_us = std::max<std::uint64_t>(static_cast<std::uint64_t>(period_us), 1U);
+            std::uint64_t deadline_us = now_us() + hybrid_period_us;
+#endif
 
             // execute given startup function
             instance->m_startup_routine(instance->m_context, task_name);
 
             while (!instance->m_stop_task.load())
             {
-                const auto current_tick_time = xTaskGetTickCount();
-                if ((current_tick_time - x_last_wake_time) > x_period)
+#if defined(ESP_PLATFORM)
+                if (instance->m_hybrid_wakeup.load(std::memory_order_relaxed))
                 {
-                    // deadline missed, setup the next deadline in the future and multiple of the period
-                    x_last_wake_time += (((current_tick_time - x_last_wake_time) % x_period) + 1) * x_period;
+                    instance->wait_hybrid(deadline_us, hybrid_period_us, calibrator);
+                    // keeps the tick schedule aligned, should the hybrid wakeup be turned off
+                    x_last_wake_time = xTaskGetTickCount();
                 }
                 else
                 {
-                    // wait for the next period
-
-                    // note: STM32 ThreadX FreeRTOS compatibility layer is buggy with vTaskDelayUntil and
-                    // short or passed deadline (blocking the task). Replace in that case with vTaskDelay
-                    // and the remaining time to wait
-                    vTaskDelayUntil(&x_last_wake_time, x_period);
+                    instance->wait_next_tick_period(x_last_wake_time, x_period);
+                    deadline_us = now_us() + hybrid_period_us;
                 }
+#else
+                instance->wait_next_tick_period(x_last_wake_time, x_period);
+#endif
 
                 // execute given periodic function
+                const auto execution_start_us = now_us();
                 instance->m_periodic_routine(instance->m_context, task_name);
+                instance->m_stats.record_execution(now_us() - execution_start_us);
             }
 
             instance->m_task_stopped.store(true);
             vTaskDelete(nullptr);
         }
 
+        /**
+         * @brief Waits for the next period with vTaskDelayUntil(), at tick granularity.
+         *
+         * @param x_last_wake_time The tick of the previous wakeup, updated.
+         * @param x_period The period in ticks.
+         */
+        void wait_next_tick_period(TickType_t& x_last_wake_time, TickType_t x_period)
+        {
+            const auto current_tick_time = xTaskGetTickCount();
+            const TickType_t elapsed_ticks = current_tick_time - x_last_wake_time;
+            if (elapsed_ticks > x_period)
+            {
+                // deadline missed, realign on the latest passed deadline (multiple of the period) and run now
+                const TickType_t passed_periods = elapsed_ticks / x_period;
+                x_last_wake_time += passed_periods * x_period;
+                m_stats.record_overrun(passed_periods - 1U);
+            }
+            else
+            {
+                // wait for the next period
+
+                // note: STM32 ThreadX FreeRTOS compatibility layer is buggy with vTaskDelayUntil and
+                // short or passed deadline (blocking the task). Replace in that case with vTaskDelay
+                // and the remaining time to wait
+                vTaskDelayUntil(&x_last_wake_time, x_period);
+            }
+
+            m_stats.record_wakeup(ticks_to_us(xTaskGetTickCount() - x_last_wake_time));
+        }
+
+#if defined(ESP_PLATFORM)
+        /**
+         * @brief Sleeps whole ticks until the calibrated guard before the deadline, then spins until it.
+         *
+         * @param deadline_us The deadline on esp_timer, moved to the next one.
+         * @param period_us The period in microseconds.
+         * @param calibrator The oversleep and lateness estimates of the task.
+         */
+        void wait_hybrid(std::uint64_t& deadline_us, std::uint64_t period_us, wakeup_calibrator& calibrator)
+        {
+            std::uint64_t current_us = now_us();
+
+            if (current_us >= deadline_us)
+            {
+                // deadline missed, realign on the latest passed deadline (multiple of the period) and run now
+                const std::uint64_t skipped_periods = (current_us - deadline_us) / period_us;
+                deadline_us += skipped_periods * period_us;
+                m_stats.record_overrun(skipped_periods);
+            }
+            else
+            {
+                const auto guard = static_cast<std::uint64_t>(
+                    calibrator.guard(static_cast<std::int64_t>(m_max_spin_us.load(std::memory_order_relaxed))));
+                m_spin_guard_us.store(guard, std::memory_order_relaxed);
+
+                // vTaskDelay(n) returns within n ticks, so whole ticks never sleep past the wake time
+                const std::uint64_t tick_us = std::max<std::uint64_t>(ticks_to_us(1U), 1U);
+                const std::uint64_t time_left_us = deadline_us - current_us;
+                const std::uint64_t sleep_us = (time_left_us > guard) ? (time_left_us - guard) : 0U;
+                const auto sleep_ticks = static_cast<TickType_t>(sleep_us / tick_us);
+                if (sleep_ticks > 0U)
+                {
+                    const std::uint64_t requested_end_us = current_us + (sleep_ticks * tick_us);
+                    vTaskDelay(sleep_ticks);
+                    calibrator.record_oversleep(
+                        static_cast<std::int64_t>(now_us()) - static_cast<std::int64_t>(requested_end_us));
+                }
+
+                const std::uint64_t bias = m_compensate_lateness.load(std::memory_order_relaxed)
+                    ? static_cast<std::uint64_t>(calibrator.lateness_bias())
+                    : 0U;
+                const std::uint64_t spin_target = deadline_us - std::min(bias, deadline_us);
+
+                current_us = now_us();
+                const bool spinning = current_us < spin_target;
+                while (current_us < spin_target)
+                {
+                    current_us = now_us();
+                }
+                if (spinning)
+                {
+                    calibrator.record_lateness(
+                        static_cast<std::int64_t>(current_us) - static_cast<std::int64_t>(spin_target));
+                }
+            }
+
+            m_stats.record_wakeup((current_us > deadline_us) ? (current_us - deadline_us) : 0U);
+            deadline_us += period_us;
+        }
+#endif
+
+        static std::uint64_t ticks_to_us(TickType_t ticks)
+        {
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(ticks) * portTICK_PERIOD_MS * us_per_ms;
+        }
+
+        static std::uint64_t now_us()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+            return ticks_to_us(xTaskGetTickCount());
+#endif
+        }
+
         call_back m_startup_routine;
         call_back m_periodic_routine;
         std::shared_ptr<Context> m_context;
@@ -311,5 +511,11 @@ namespace tools
         TaskHandle_t m_task = {};
         bool m_task_created = false;
         std::atomic_bool m_task_stopped = false;
+        periodic_task_stats_recorder m_stats;
+
+        std::atomic_bool m_hybrid_wakeup = false;
+        std::atomic_bool m_compensate_lateness = false;
+        std::atomic<std::uint64_t> m_max_spin_us = periodic_precision {}.max_spin.count();
+        std::atomic<std::uint64_t> m_spin_guard_us = 0U;
     };
 }
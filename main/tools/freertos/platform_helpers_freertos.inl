@@ -74,6 +74,36 @@ namespace tools
         taskYIELD();
     }
 
+    /**
+     * @brief Hints the CPU that the caller is spinning on a shared variable.
+     *
+     * Xtensa and RISC-V cores have no pause instruction: a nop only keeps the loop from being optimized out.
+     */
+    inline void cpu_relax()
+    {
+#if defined(__ARM_ARCH)
+        __asm__ __volatile__("yield");
+#else
+        __asm__ __volatile__("nop");
+#endif
+    }
+
+    /**
+     * @brief Gets the number of cores the scheduler runs tasks on.
+     *
+     * @return The core count, 1 on single-core targets.
+     */
+    constexpr unsigned int cpu_core_count()
+    {
+#if defined(configNUMBER_OF_CORES)
+        return static_cast<unsigned int>(configNUMBER_OF_CORES);
+#elif defined(portNUM_PROCESSORS)
+        return static_cast<unsigned int>(portNUM_PROCESSORS);
+#else
+        return 1U;
+#endif
+    }
+
     // -- specific FreeRTOS task helper --
 
     /**
@@ -84,6 +114,26 @@ namespace tools
      */
     using task_func_handler = void(void*);
 
+    /**
+     * @brief Maps a framework task priority to a FreeRTOS priority.
+     *
+     * @param priority Priority of the task, relative to the idle task. If negative, the idle priority is used.
+     * @return The FreeRTOS priority, clamped to the configured range.
+     */
+    inline UBaseType_t task_priority(int priority)
+    {
+        UBaseType_t freertos_priority = tskIDLE_PRIORITY;
+
+        if (priority >= 0)
+        {
+            // https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/01-xTaskCreate
+            freertos_priority = std::clamp(static_cast<UBaseType_t>(priority + tskIDLE_PRIORITY),
+                static_cast<UBaseType_t>(tskIDLE_PRIORITY), static_cast<UBaseType_t>(configMAX_PRIORITIES - 1));
+        }
+
+        return freertos_priority;
+    }
+
     /**
      * @brief Creates a FreeRTOS task with optional CPU affinity.
      *
@@ -107,14 +157,7 @@ namespace tools
         BaseType_t ret = 0;
         bool task_created = false;
 
-        UBaseType_t freertos_priority = tskIDLE_PRIORITY;
-
-        if (priority >= 0)
-        {
-            // https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/01-xTaskCreate
-            freertos_priority = std::clamp(static_cast<UBaseType_t>(priority + tskIDLE_PRIORITY),
-                static_cast<UBaseType_t>(tskIDLE_PRIORITY), static_cast<UBaseType_t>(configMAX_PRIORITIES - 1));
-        }
+        const UBaseType_t freertos_priority = task_priority(priority);
 
 #if defined(ESP_PLATFORM)
         // https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/system/freertos_idf.html
@@ -157,4 +200,72 @@ namespace tools
 
         return task_created;
     }
+
+    /**
+     * @brief Creates a FreeRTOS task into caller-provided stack and control block storage.
+     *
+     * The task is created with xTaskCreateStaticPinnedToCore() on ESP-IDF and with xTaskCreateStatic() elsewhere,
+     * so no heap is used; both buffers must outlive the task. On ESP-IDF the stack must lie in internal RAM,
+     * which is where storage with static duration is placed by default. Without configSUPPORT_STATIC_ALLOCATION
+     * the storage is ignored and the task is created on the heap with the same stack size.
+     *
+     * @param task_handle Pointer to the handle of the created task.
+     * @param task_name Name of the task.
+     * @param task_function Function to be executed by the task.
+     * @param task_param Parameter to be passed to the task function.
+     * @param stack_buffer Stack storage of stack_size entries.
+     * @param stack_size Stack depth, in StackType_t units.
+     * @param control_block Control block storage.
+     * @param cpu_affinity CPU core to which the task should be pinned. If negative, no affinity is set.
+     * @param priority Priority of the task.
+     * @return true if the task was successfully created, false otherwise.
+     */
+    inline bool task_create_static(TaskHandle_t* task_handle, const std::string& task_name,
+        task_func_handler task_function, void* task_param, StackType_t* stack_buffer, std::size_t stack_size,
+        StaticTask_t* control_block, int cpu_affinity, int priority)
+    {
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+        if ((nullptr == stack_buffer) || (nullptr == control_block) || (0U == stack_size))
+        {
+            LOG_ERROR("FATAL error: no static storage provided for task %s", task_name.c_str());
+            return false;
+        }
+
+        const UBaseType_t freertos_priority = task_priority(priority);
+
+#if defined(ESP_PLATFORM)
+        // https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/system/freertos_idf.html
+        const BaseType_t core_id = (cpu_affinity >= 0) ? static_cast<BaseType_t>(cpu_affinity) : tskNO_AFFINITY;
+        *task_handle = xTaskCreateStaticPinnedToCore(task_function, task_name.c_str(), stack_size, task_param,
+            freertos_priority, stack_buffer, control_block, core_id);
+#else
+        // https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/02-xTaskCreateStatic
+        *task_handle = xTaskCreateStatic(task_function, task_name.c_str(), static_cast<uint32_t>(stack_size),
+            task_param, freertos_priority, stack_buffer, control_block);
+#endif
+
+        if (nullptr == *task_handle)
+        {
+            LOG_ERROR("FATAL error: xTaskCreateStatic() failed for task %s", task_name.c_str());
+            return false;
+        }
+
+#if defined(configUSE_CORE_AFFINITY) && !defined(ESP_PLATFORM)
+        if (cpu_affinity >= 0)
+        {
+            UBaseType_t mask = (1 << cpu_affinity);
+            vTaskCoreAffinitySet(*task_handle, mask);
+        }
+#else
+        (void)cpu_affinity; // potentially unused
+#endif
+
+        return true;
+#else
+        (void)stack_buffer;
+        (void)control_block;
+        LOG_WARNING("static task allocation disabled, task %s allocated on the heap", task_name.c_str());
+        return task_create(task_handle, task_name, task_function, task_param, stack_size, cpu_affinity, priority);
+#endif
+    }
 }
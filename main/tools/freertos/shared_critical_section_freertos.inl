@@ -0,0 +1,278 @@
+/**
+ * @file shared_critical_section_freertos.inl
+ * @brief Reader/writer critical section built on an atomic state word and FreeRTOS semaphores.
+ *
+ * This file contains a shared_critical_section class exposing the std::shared_mutex interface: many tasks may hold
+ * it shared, one task may hold it exclusive. Readers enter and leave with a single compare-and-swap on the state
+ * word, so concurrent readers on both cores never serialize on a kernel object. A writer holds the entry gate and
+ * flags the state word, so new readers queue behind it and writers cannot starve.
+ *
+ * ISR rules: an ISR may only use the non-blocking try_isr_lock_shared()/isr_unlock_shared() pair and the
+ * isr_lock()/try_isr_lock()/isr_unlock() exclusive variants, which never wait for the readers in progress.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "tools/critical_section.hpp"
+#include "tools/logger.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Reader/writer lock using an atomic reader count, a FreeRTOS mutex and a binary semaphore.
+     *
+     * The state word holds the reader count and a writer flag. Readers increment the count while the flag is clear
+     * and otherwise wait on the gate mutex, which the writer holds for its whole critical section. A writer takes the
+     * gate, raises the flag and, if readers are still inside, sleeps on the "no readers" semaphore that the last of
+     * them gives.
+     */
+    class shared_critical_section : public non_copyable // NOLINT inherits from non copyable and non movable
+    {
+    public:
+        /**
+         * @brief Creates the semaphore given by the last reader leaving while a writer waits.
+         */
+        shared_critical_section()
+            : m_no_readers(xSemaphoreCreateBinary())
+        {
+            // FreeRTOS platform
+            if (nullptr == m_no_readers)
+            {
+                LOG_ERROR("FATAL error: xSemaphoreCreateBinary() failed");
+            }
+        }
+
+        /**
+         * @brief Deletes the semaphore.
+         */
+        ~shared_critical_section()
+        {
+            // FreeRTOS platform
+            if (nullptr != m_no_readers)
+            {
+                vSemaphoreDelete(m_no_readers);
+            }
+        }
+
+        /**
+         * @brief Acquires the lock exclusively, waiting for the readers in progress.
+         */
+        void lock() // NOLINT keep same interface than standard shared mutex
+        {
+            m_gate.lock();
+            const std::uint32_t previous = m_state.fetch_or(writer_flag, std::memory_order_acquire);
+            if (0U != (previous & reader_mask))
+            {
+                take_no_readers(portMAX_DELAY);
+            }
+        }
+
+        /**
+         * @brief Attempts to acquire the lock exclusively without blocking.
+         *
+         * @return true if the lock was acquired.
+         */
+        bool try_lock() // NOLINT keep same interface than standard shared mutex
+        {
+            if (!m_gate.try_lock())
+            {
+                return false;
+            }
+
+            if (!try_raise_writer_flag())
+            {
+                m_gate.unlock();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Releases an exclusive hold.
+         */
+        void unlock() // NOLINT keep same interface than standard shared mutex
+        {
+            m_state.fetch_and(~writer_flag, std::memory_order_release);
+            m_gate.unlock();
+        }
+
+        /**
+         * @brief Acquires the lock shared, waiting for a writer in progress or queued.
+         */
+        void lock_shared() // NOLINT keep same interface than standard shared mutex
+        {
+            while (!try_lock_shared())
+            {
+                // the writer holds the gate until it unlocks: queue behind it
+                std::scoped_lock<tools::critical_section> gate(m_gate);
+            }
+        }
+
+        /**
+         * @brief Attempts to acquire the lock shared without blocking; lock-free, hence ISR safe.
+         *
+         * @return true if the lock was acquired, false while a writer holds or waits for the lock.
+         */
+        bool try_lock_shared() // NOLINT keep same interface than standard shared mutex
+        {
+            std::uint32_t state = m_state.load(std::memory_order_relaxed);
+            while (0U == (state & writer_flag))
+            {
+                if (m_state.compare_exchange_weak(state, state + 1U, std::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Releases a shared hold.
+         */
+        void unlock_shared() // NOLINT keep same interface than standard shared mutex
+        {
+            if (writer_flag == (m_state.fetch_sub(1U, std::memory_order_release) - 1U))
+            {
+                give_no_readers();
+            }
+        }
+
+        /**
+         * @brief Attempts to acquire the lock shared from an ISR.
+         *
+         * @return true if the lock was acquired.
+         */
+        bool try_isr_lock_shared() // NOLINT keep same interface than critical_section
+        {
+            return try_lock_shared();
+        }
+
+        /**
+         * @brief Releases a shared hold from an ISR, waking a waiting writer if this was the last reader.
+         */
+        void isr_unlock_shared() // NOLINT keep same interface than critical_section
+        {
+            if ((writer_flag == (m_state.fetch_sub(1U, std::memory_order_release) - 1U)) && (nullptr != m_no_readers))
+            {
+                BaseType_t px_higher_priority_task_woken = pdFALSE; // NOLINT initialized to pdFALSE
+                xSemaphoreGiveFromISR(m_no_readers, &px_higher_priority_task_woken);
+                portYIELD_FROM_ISR(px_higher_priority_task_woken);
+            }
+        }
+
+        /**
+         * @brief Acquires the lock exclusively from an ISR, retrying until neither a writer nor a reader holds it.
+         */
+        void isr_lock() // NOLINT keep same interface than critical_section
+        {
+            while (!try_isr_lock())
+            {
+            }
+        }
+
+        /**
+         * @brief Attempts to acquire the lock exclusively from an ISR.
+         *
+         * @return true if the lock was acquired.
+         */
+        bool try_isr_lock() // NOLINT keep same interface than critical_section
+        {
+            if (!m_gate.try_isr_lock())
+            {
+                return false;
+            }
+
+            if (!try_raise_writer_flag())
+            {
+                m_gate.isr_unlock();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Releases an exclusive hold taken from an ISR.
+         */
+        void isr_unlock() // NOLINT keep same interface than critical_section
+        {
+            m_state.fetch_and(~writer_flag, std::memory_order_release);
+            m_gate.isr_unlock();
+        }
+
+    private:
+        static constexpr std::uint32_t writer_flag = 0x80000000U;
+        static constexpr std::uint32_t reader_mask = ~writer_flag;
+
+        /** @brief Raises the writer flag if no reader is inside; the gate must be held. */
+        bool try_raise_writer_flag()
+        {
+            std::uint32_t expected = 0U;
+            return m_state.compare_exchange_strong(expected, writer_flag, std::memory_order_acquire);
+        }
+
+        void take_no_readers(TickType_t ticks)
+        {
+            if (nullptr != m_no_readers)
+            {
+                (void)xSemaphoreTake(m_no_readers, ticks);
+            }
+            else
+            {
+                // without the semaphore, poll until the readers are gone
+                while (0U != (m_state.load(std::memory_order_acquire) & reader_mask))
+                {
+                    vTaskDelay(1);
+                }
+            }
+        }
+
+        void give_no_readers()
+        {
+            if (nullptr != m_no_readers)
+            {
+                xSemaphoreGive(m_no_readers);
+            }
+        }
+
+        critical_section m_gate;
+        std::atomic<std::uint32_t> m_state = 0U;
+        SemaphoreHandle_t m_no_readers = {};
+    };
+}
@@ -99,6 +99,13 @@ namespace tools
          */
         void isr_signal();
 
+        /**
+         * @brief Consumes the signal if it is set, without waiting.
+         *
+         * @return true if the sync_object was signaled (the signal is then cleared), false otherwise.
+         */
+        [[nodiscard]] bool try_wait_for_signal();
+
         /**
          * @brief Waits for a signal from the event group.
          *
@@ -112,6 +112,19 @@ namespace tools
         }
     }
 
+    bool sync_object::try_wait_for_signal()
+    {
+        // FreeRTOS platform
+
+        if (nullptr != m_event_group)
+        {
+            // xEventGroupClearBits returns the bits as they were before clearing
+            return (xEventGroupClearBits(m_event_group, BIT0) & BIT0) != 0;
+        }
+
+        return false;
+    }
+
     void sync_object::wait_for_signal(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
     {
         // FreeRTOS platform
@@ -41,7 +41,9 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/timers.h>
@@ -76,7 +78,19 @@ namespace tools
     enum class timer_backend_kind
     {
         freertos_tick,
-        esp_timer
+        esp_timer,
+        coalesced_tick ///< Slack timer served by the shared coalescing FreeRTOS timer.
+    };
+
+    /**
+     * @brief Resolution achieved by the timers of one resolution policy.
+     */
+    struct timer_resolution_report
+    {
+        timer_backend_kind backend;                                    ///< The backend serving the policy.
+        std::chrono::duration<std::uint64_t, std::micro> granularity;  ///< Finest expiry step of the backend.
+        std::chrono::duration<std::uint64_t, std::micro> max_lateness; ///< Worst observed dispatch delay.
+        std::uint64_t expirations;                                     ///< Number of expirations observed.
     };
 
     /**
@@ -84,6 +98,24 @@ namespace tools
      */
     using timer_handle = std::size_t;
 
+    /**
+     * @brief Callable posting a timer expiration to another execution context.
+     */
+    using timer_dispatcher = std::function<void(std::function<void()>&&)>;
+
+    /**
+     * @brief Description of one timer of a batch given to timer_scheduler::add_range().
+     */
+    struct timer_request
+    {
+        std::string name;                                         ///< The name of the timer.
+        std::chrono::duration<std::uint64_t, std::micro> period;  ///< The period, or the delay of a one-shot timer.
+        std::function<void(timer_handle)> handler;                ///< The callable invoked when the timer fires.
+        timer_type type = timer_type::one_shot;                   ///< One-shot or periodic.
+        timer_resolution_policy policy = timer_resolution_policy::low_resolution; ///< The resolution policy.
+        std::chrono::duration<std::uint64_t, std::micro> slack {}; ///< Tolerated delay (low resolution only).
+    };
+
     /**
      * @brief Class for managing FreeRTOS timers.
      *
@@ -170,6 +202,45 @@ namespace tools
         timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
             std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy);
 
+        /**
+         * @brief Add a new timer whose expirations may be deferred by a slack to be coalesced with other timers.
+         *
+         * Low-resolution timers with overlapping tolerance windows are served by a single wakeup, which saves
+         * power for periodic work whose exact firing time does not matter. High-resolution timers ignore the slack.
+         *
+         * @param timer_name The name of the timer.
+         * @param period The period as std::chrono duration.
+         * @param handler The callable that is invoked when the timer fires.
+         * @param type If periodic, then the timer will expire repeatedly with a frequency set by the period
+         * parameter. If set to one_shot, then the timer will be a one-shot timer.
+         * @param policy The requested timer resolution policy.
+         * @param slack The maximum delay tolerated on each expiry (0 disables the coalescing).
+         * @return A handle to the added timer.
+         */
+        timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
+            std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& slack);
+
+        /**
+         * @brief Add a new timer whose expirations are handed to a dispatcher instead of running on the timer thread.
+         *
+         * The timer thread (or FreeRTOS timer service task) only does the bookkeeping and posts each expiration,
+         * so a slow handler no longer delays the other timers. The handler stays alive while a posted expiration
+         * is pending, even if the timer is removed meanwhile.
+         *
+         * @param timer_name The name of the timer.
+         * @param period The period as std::chrono duration.
+         * @param handler The callable that is invoked, through the dispatcher, when the timer fires.
+         * @param type If periodic, then the timer will expire repeatedly with a frequency set by the period
+         * parameter. If set to one_shot, then the timer will be a one-shot timer.
+         * @param policy The requested timer resolution policy.
+         * @param dispatcher Runs each expiration, e.g. make_timer_dispatcher() over a worker_task executor.
+         * @return A handle to the added timer.
+         */
+        timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
+            std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy,
+            timer_dispatcher&& dispatcher);
+
         /**
          * @brief Removes a timer from the scheduler.
          *
@@ -181,6 +252,68 @@ namespace tools
          */
         bool remove(timer_handle hnd);
 
+        /**
+         * @brief Adds a batch of timers.
+         *
+         * Slack timers are inserted under one lock with at most one kick of the shared coalescing timer; the other
+         * timers are FreeRTOS or esp_timer objects of their own, created one by one.
+         *
+         * @param requests The timers to add; their handlers are moved out.
+         * @return The handles of the added timers, in request order (0 for a timer that could not be added).
+         */
+        std::vector<timer_handle> add_range(std::vector<timer_request> requests);
+
+        /**
+         * @brief Removes a batch of timers.
+         *
+         * @param handles The handles of the timers to remove.
+         * @return The number of timers removed.
+         */
+        std::size_t remove_range(const std::vector<timer_handle>& handles);
+
+        /**
+         * @brief Re-arms a timer one interval from now, keeping its handle and its handler.
+         *
+         * The interval is the period of a periodic timer and the delay of a one-shot timer that has not fired yet.
+         * Tick timers map to xTimerReset(), so watchdog-style timeouts pushed back on every message need no
+         * allocation.
+         *
+         * @param hnd The handle of the timer to restart.
+         * @return True if the timer was found and re-armed, false otherwise.
+         */
+        bool restart(timer_handle hnd);
+
+        /**
+         * @brief Changes the interval of a timer and re-arms it one new interval from now, keeping its handle.
+         *
+         * Tick timers map to xTimerChangePeriod().
+         *
+         * @param hnd The handle of the timer to reschedule.
+         * @param period The new period of a periodic timer, or the new delay of a one-shot timer.
+         * @return True if the timer was found and re-armed, false otherwise.
+         */
+        bool reschedule(timer_handle hnd, const std::chrono::duration<std::uint64_t, std::micro>& period);
+
+        /**
+         * @brief Reports the resolution achieved by the timers of a policy.
+         *
+         * The granularity is the FreeRTOS tick period or the 1 us esp_timer step; the lateness is measured between
+         * each deadline and the dispatch of its callback.
+         *
+         * @param policy The timer resolution policy.
+         * @return The backend, granularity and observed lateness of the policy.
+         */
+        [[nodiscard]] timer_resolution_report resolution(timer_resolution_policy policy) const;
+
+        /**
+         * @brief Busy-spin slice of the high-resolution timers, kept for API parity with the standard backend.
+         *
+         * esp_timer dispatches from its own high priority task, so no spin is applied on FreeRTOS.
+         *
+         * @param slice Ignored.
+         */
+        void set_high_resolution_spin(const std::chrono::duration<std::uint64_t, std::micro>& slice);
+
         struct timer_context
         {
             std::function<void(timer_handle)> m_callback = {};
@@ -190,8 +323,30 @@ namespace tools
             timer_resolution_policy m_policy = timer_resolution_policy::low_resolution;
             bool m_auto_release = false;
             timer_scheduler* m_this = nullptr;
+            std::uint64_t m_deadline_us = 0U; ///< Next expected expiry, for the lateness statistics.
+            std::uint64_t m_period_us = 0U;
+            std::uint64_t m_interval_us = 0U; ///< Delay re-applied by restart().
+            std::uint64_t m_slack_us = 0U; ///< Tolerated delay of a coalesced timer.
+            bool m_running = false;        ///< Coalesced callback running outside the lock.
+            bool m_cancelled = false;      ///< Coalesced timer removed while running.
         };
 
+        /**
+         * @brief Records the lateness of an expiring timer and advances its expected deadline.
+         *
+         * Called by the FreeRTOS and esp_timer callbacks before the user callback runs.
+         *
+         * @param context The expiring timer context.
+         */
+        void record_lateness(timer_context& context);
+
+        /**
+         * @brief Runs the coalesced timers whose tolerance window is open and re-arms the coalescing timer.
+         *
+         * Called from the FreeRTOS timer daemon task by the shared coalescing timer.
+         */
+        void run_coalesced();
+
         /**
          * @brief Removes and deletes a timer from the scheduler.
          *
@@ -203,14 +358,6 @@ namespace tools
         void remove_and_delete_timer(timer_handle hnd);
 
     private:
-        timer_handle add_tick(const std::string& timer_name, TickType_t period,
-            std::function<void(timer_handle)>&& handler, timer_type type);
-
-#if defined(ESP_PLATFORM)
-        timer_handle add_esp_timer(const std::string& timer_name, std::uint64_t period,
-            std::function<void(timer_handle)>&& handler, timer_type type);
-#endif
-
         /**
          * @brief Adds a tick timer to the scheduler.
          *
@@ -222,8 +369,82 @@ namespace tools
          * @param type The type of the timer (one-shot or periodic).
          * @return The handle to the created timer, or nullptr if the timer could not be created.
          */
+        timer_handle add_tick(const std::string& timer_name, TickType_t period,
+            std::function<void(timer_handle)>&& handler, timer_type type);
+
+        /**
+         * @brief Adds a slack timer served by the shared coalescing timer.
+         *
+         * @param period_us The period in microseconds.
+         * @param handler The callback function to be called when the timer expires.
+         * @param type The type of the timer (one-shot or periodic).
+         * @param slack_us The tolerated delay on each expiry, in microseconds.
+         * @return The handle to the created timer, or 0 if the coalescing timer could not be created.
+         */
+        timer_handle add_coalesced(std::uint64_t period_us, std::function<void(timer_handle)>&& handler,
+            timer_type type, std::uint64_t slack_us);
+
+        /**
+         * @brief Prepares the context of a slack timer, outside the lock.
+         *
+         * @param period_us The period in microseconds.
+         * @param handler The callback function to be called when the timer expires.
+         * @param type The type of the timer (one-shot or periodic).
+         * @param slack_us The tolerated delay on each expiry, in microseconds.
+         * @return The timer context.
+         */
+        std::unique_ptr<timer_context> make_coalesced_context(
+            std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type, std::uint64_t slack_us);
+
+        /**
+         * @brief Registers a slack timer context (lock held).
+         *
+         * @param context The timer context.
+         * @param kick Set when the coalescing timer must be re-armed for an earlier window.
+         * @return The handle of the timer, or 0 if the coalescing timer could not be created.
+         */
+        timer_handle insert_coalesced(std::unique_ptr<timer_context>&& context, bool& kick);
+
+        /**
+         * @brief Re-arms a timer, with a new interval if one is given.
+         *
+         * @param hnd The handle of the timer.
+         * @param period_us The new interval in microseconds, or none to keep the current one.
+         * @return True if the timer was found and re-armed, false otherwise.
+         */
+        bool restart_timer(timer_handle hnd, std::optional<std::uint64_t> period_us);
+
+        /**
+         * @brief Arms the coalescing timer for the earliest end of the pending tolerance windows (daemon task only).
+         */
+        void arm_coalescing_timer();
+
+        /**
+         * @brief Lets the daemon task re-arm the coalescing timer for an earlier tolerance window.
+         */
+        void kick_coalescing_timer();
+
+#if defined(ESP_PLATFORM)
+        timer_handle add_esp_timer(const std::string& timer_name, std::uint64_t period,
+            std::function<void(timer_handle)>&& handler, timer_type type);
+#endif
+
+        /**
+         * @brief Lock-free lateness statistics of one policy.
+         */
+        struct lateness_stats
+        {
+            std::atomic<std::uint32_t> m_max_lateness_us = 0U;
+            std::atomic<std::uint32_t> m_expirations = 0U;
+        };
+
         tools::critical_section m_mutex;
         std::list<std::unique_ptr<timer_context>> m_contexts = {};
+        lateness_stats m_tick_stats;
+        lateness_stats m_esp_timer_stats;
+        TimerHandle_t m_coalescing_timer = nullptr; ///< One-shot timer shared by all the slack timers.
+        std::uint64_t m_coalescing_armed_us = 0U;   ///< Expiry the coalescing timer is armed for, 0 if idle.
+        std::vector<timer_context*> m_coalesced_due = {};
         timer_handle m_next_timer_handle = 1;
     };
 }
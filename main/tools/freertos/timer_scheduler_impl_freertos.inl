@@ -40,10 +40,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/timers.h>
@@ -57,6 +60,21 @@
 
 namespace
 {
+    /**
+     * @brief Current time in microseconds used for the lateness statistics.
+     *
+     * @return esp_timer time on ESP32, FreeRTOS tick count converted to microseconds elsewhere.
+     */
+    std::uint64_t timer_now_us()
+    {
+#if defined(ESP_PLATFORM)
+        return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+        constexpr const std::uint64_t us_per_ms = 1000U;
+        return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#endif
+    }
+
     /**
      * @brief Callback function for FreeRTOS timer events.
      *
@@ -74,6 +92,7 @@ namespace
             pvTimerGetTimerID(x_timer));
         if (nullptr != context)
         {
+            context->m_this->record_lateness(*context);
             (context->m_callback)(context->m_timer_handle);
 
             if (context->m_auto_release)
@@ -84,6 +103,35 @@ namespace
         }
     }
 
+    /**
+     * @brief Callback function of the shared coalescing FreeRTOS timer.
+     *
+     * @param x_timer Handle to the coalescing timer, whose ID is the owning scheduler.
+     */
+    void coalescing_timer_callback(TimerHandle_t x_timer)
+    {
+        auto* scheduler = reinterpret_cast<tools::timer_scheduler*>( // NOLINT only way to cast the void* timer param
+            pvTimerGetTimerID(x_timer));
+        if (nullptr != scheduler)
+        {
+            scheduler->run_coalesced();
+        }
+    }
+
+    /**
+     * @brief Converts a delay in microseconds to FreeRTOS ticks, rounding up to at least one tick.
+     *
+     * @param delay_us The delay in microseconds.
+     * @return The delay in ticks.
+     */
+    TickType_t us_to_ticks(std::uint64_t delay_us)
+    {
+        constexpr const std::uint64_t us_per_ms = 1000U;
+        const std::uint64_t delay_ms = (delay_us + (us_per_ms - 1U)) / us_per_ms;
+        TickType_t ticks = pdMS_TO_TICKS(static_cast<TickType_t>(delay_ms));
+        return (0U == ticks) ? static_cast<TickType_t>(1U) : ticks;
+    }
+
 #if defined(ESP_PLATFORM)
     /**
      * @brief Callback function for esp_timer events.
@@ -95,6 +143,7 @@ namespace
         auto* context = static_cast<tools::timer_scheduler::timer_context*>(arg);
         if (nullptr != context)
         {
+            context->m_this->record_lateness(*context);
             (context->m_callback)(context->m_timer_handle);
 
             if (context->m_auto_release)
@@ -113,6 +162,14 @@ namespace tools
     {
         // FreeRTOS platform
 
+        if (nullptr != m_coalescing_timer)
+        {
+            constexpr const int timeout_ticks = 100;
+            xTimerStop(m_coalescing_timer, static_cast<TickType_t>(timeout_ticks));
+            tools::sleep_for(1);
+            xTimerDelete(m_coalescing_timer, static_cast<TickType_t>(timeout_ticks));
+        }
+
         std::scoped_lock<tools::critical_section> guard(m_mutex);
         for (const auto& context : m_contexts)
         {
@@ -121,6 +178,11 @@ namespace tools
                 continue;
             }
 
+            if (timer_backend_kind::coalesced_tick == context->m_backend)
+            {
+                continue; // no native timer of its own
+            }
+
             if (timer_backend_kind::freertos_tick == context->m_backend)
             {
                 constexpr const int timeout_ticks = 100;
@@ -153,6 +215,11 @@ namespace tools
         context->m_policy = timer_resolution_policy::low_resolution;
         context->m_this = this;
         context->m_timer_handle = m_next_timer_handle++;
+        constexpr const std::uint64_t us_per_ms = 1000U;
+        const std::uint64_t period_us = static_cast<std::uint64_t>(period) * portTICK_PERIOD_MS * us_per_ms;
+        context->m_deadline_us = timer_now_us() + period_us;
+        context->m_period_us = auto_reload ? period_us : 0U;
+        context->m_interval_us = period_us;
         const timer_handle timer_id = context->m_timer_handle;
 
         // https://mcuoneclipse.com/2018/05/27/tutorial-understanding-and-using-freertos-software-timers/
@@ -218,6 +285,19 @@ namespace tools
         const std::chrono::duration<std::uint64_t, std::micro>& period, std::function<void(timer_handle)>&& handler,
         timer_type type, timer_resolution_policy policy)
     {
+        return add(
+            timer_name, period, std::move(handler), type, policy, std::chrono::duration<std::uint64_t, std::micro>(0U));
+    }
+
+    timer_handle timer_scheduler::add(const std::string& timer_name,
+        const std::chrono::duration<std::uint64_t, std::micro>& period, std::function<void(timer_handle)>&& handler,
+        timer_type type, timer_resolution_policy policy, const std::chrono::duration<std::uint64_t, std::micro>& slack)
+    {
+        if ((timer_resolution_policy::low_resolution == policy) && (slack.count() > 0U))
+        {
+            return add_coalesced(period.count(), std::move(handler), type, slack.count());
+        }
+
         if (timer_resolution_policy::high_resolution == policy)
         {
 #if defined(ESP_PLATFORM)
@@ -258,6 +338,25 @@ namespace tools
                 if (itr != m_contexts.end())
                 {
                     context_ptr = itr->get();
+
+                    if (timer_backend_kind::coalesced_tick == context_ptr->m_backend)
+                    {
+                        if (context_ptr->m_cancelled)
+                        {
+                            return false;
+                        }
+
+                        // a running callback is released by run_coalesced() once it returns
+                        if (context_ptr->m_running)
+                        {
+                            context_ptr->m_cancelled = true;
+                        }
+                        else
+                        {
+                            m_contexts.erase(itr);
+                        }
+                        return true;
+                    }
                 }
             }
 
@@ -288,6 +387,163 @@ namespace tools
         return success;
     }
 
+    std::vector<timer_handle> timer_scheduler::add_range(std::vector<timer_request> requests)
+    {
+        std::vector<timer_handle> handles(requests.size(), 0U);
+        const auto coalesced = [](const timer_request& request) -> bool
+        { return (timer_resolution_policy::low_resolution == request.policy) && (request.slack.count() > 0U); };
+
+        // slack timers share the coalescing timer: one lock and at most one daemon kick for the whole batch
+        std::vector<std::pair<std::size_t, std::unique_ptr<timer_context>>> contexts;
+        for (std::size_t index = 0U; index < requests.size(); ++index)
+        {
+            auto& request = requests[index];
+            if (coalesced(request))
+            {
+                contexts.emplace_back(index,
+                    make_coalesced_context(
+                        request.period.count(), std::move(request.handler), request.type, request.slack.count()));
+            }
+        }
+
+        bool kick = false;
+        if (!contexts.empty())
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            for (auto& [index, context] : contexts)
+            {
+                handles[index] = insert_coalesced(std::move(context), kick);
+            }
+        }
+
+        if (kick)
+        {
+            kick_coalescing_timer();
+        }
+
+        // every other timer is a kernel timer object of its own
+        for (std::size_t index = 0U; index < requests.size(); ++index)
+        {
+            auto& request = requests[index];
+            if (!coalesced(request))
+            {
+                handles[index]
+                    = add(request.name, request.period, std::move(request.handler), request.type, request.policy);
+            }
+        }
+
+        return handles;
+    }
+
+    std::size_t timer_scheduler::remove_range(const std::vector<timer_handle>& handles)
+    {
+        std::size_t removed = 0U;
+        for (const auto hnd : handles)
+        {
+            if (remove(hnd))
+            {
+                ++removed;
+            }
+        }
+
+        return removed;
+    }
+
+    bool timer_scheduler::restart(timer_handle hnd)
+    {
+        return restart_timer(hnd, std::nullopt);
+    }
+
+    bool timer_scheduler::reschedule(timer_handle hnd, const std::chrono::duration<std::uint64_t, std::micro>& period)
+    {
+        return restart_timer(hnd, period.count());
+    }
+
+    bool timer_scheduler::restart_timer(timer_handle hnd, std::optional<std::uint64_t> period_us)
+    {
+        if (0 == hnd)
+        {
+            return false;
+        }
+
+        timer_context* context_ptr = nullptr;
+        bool kick = false;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            auto itr = std::ranges::find_if(
+                m_contexts, [&hnd](const auto& context) -> bool { return (context->m_timer_handle == hnd); });
+#else
+            auto itr = std::find_if(m_contexts.begin(), m_contexts.end(),
+                [&hnd](const auto& context) -> bool { return (context->m_timer_handle == hnd); });
+#endif
+
+            if ((itr == m_contexts.end()) || (*itr)->m_cancelled)
+            {
+                return false;
+            }
+
+            context_ptr = itr->get();
+            if (period_us.has_value())
+            {
+                context_ptr->m_interval_us = std::max<std::uint64_t>(*period_us, 1U);
+                if (0U != context_ptr->m_period_us)
+                {
+                    context_ptr->m_period_us = context_ptr->m_interval_us;
+                }
+            }
+            context_ptr->m_deadline_us = timer_now_us() + context_ptr->m_interval_us;
+
+            if (timer_backend_kind::coalesced_tick == context_ptr->m_backend)
+            {
+                const std::uint64_t latest_us = context_ptr->m_deadline_us + context_ptr->m_slack_us;
+                kick = (0U == m_coalescing_armed_us) || (latest_us < m_coalescing_armed_us);
+                m_coalescing_armed_us = kick ? latest_us : m_coalescing_armed_us;
+            }
+        }
+
+        if (timer_backend_kind::coalesced_tick == context_ptr->m_backend)
+        {
+            if (kick)
+            {
+                kick_coalescing_timer();
+            }
+            return true;
+        }
+
+        if (timer_backend_kind::freertos_tick == context_ptr->m_backend)
+        {
+            // both commands (re)start the timer from now, on its existing timer daemon entry
+            constexpr const int restart_timeout_ticks = 100;
+            auto* native_handle = static_cast<TimerHandle_t>(context_ptr->m_native_handle);
+            const auto send_restart = [&]() -> BaseType_t
+            {
+                if (period_us.has_value())
+                {
+                    return xTimerChangePeriod(native_handle, us_to_ticks(context_ptr->m_interval_us),
+                        static_cast<TickType_t>(restart_timeout_ticks));
+                }
+                return xTimerReset(native_handle, static_cast<TickType_t>(restart_timeout_ticks));
+            };
+
+            while (send_restart() != pdPASS)
+            {
+            }
+            return true;
+        }
+
+#if defined(ESP_PLATFORM)
+        auto* native_handle = static_cast<esp_timer_handle_t>(context_ptr->m_native_handle);
+        (void)esp_timer_stop(native_handle);
+        const esp_err_t start_status = (0U != context_ptr->m_period_us)
+            ? esp_timer_start_periodic(native_handle, context_ptr->m_interval_us)
+            : esp_timer_start_once(native_handle, context_ptr->m_interval_us);
+        return (ESP_OK == start_status);
+#else
+        return false;
+#endif
+    }
+
     void timer_scheduler::remove_and_delete_timer(timer_handle hnd)
     {
         // FreeRTOS platform
@@ -322,7 +578,7 @@ namespace tools
                         static_cast<TickType_t>(delete_timeout_ticks));
                 }
 #if defined(ESP_PLATFORM)
-                else
+                else if (timer_backend_kind::esp_timer == context_to_delete->m_backend)
                 {
                     (void)esp_timer_delete(static_cast<esp_timer_handle_t>(context_to_delete->m_native_handle));
                 }
@@ -357,13 +613,17 @@ namespace tools
         }
 
         context->m_native_handle = native_handle;
+        context->m_period_us = (timer_type::periodic == type) ? period : 0U;
+        context->m_interval_us = period;
         const timer_handle timer_id = context->m_timer_handle;
+        timer_context* context_ptr = context.get();
 
         {
             std::scoped_lock<tools::critical_section> guard(m_mutex);
             m_contexts.emplace_back(std::move(context));
         }
 
+        context_ptr->m_deadline_us = timer_now_us() + period;
         const esp_err_t start_status = (timer_type::periodic == type) ? esp_timer_start_periodic(native_handle, period)
                                                                       : esp_timer_start_once(native_handle, period);
 
@@ -377,4 +637,199 @@ namespace tools
     }
 #endif
 
+    timer_resolution_report timer_scheduler::resolution(timer_resolution_policy policy) const
+    {
+        timer_resolution_report report = {};
+        const lateness_stats* stats = &m_tick_stats;
+        constexpr const std::uint64_t us_per_ms = 1000U;
+        report.backend = timer_backend_kind::freertos_tick;
+        report.granularity = std::chrono::duration<std::uint64_t, std::micro>(portTICK_PERIOD_MS * us_per_ms);
+
+#if defined(ESP_PLATFORM)
+        if (timer_resolution_policy::high_resolution == policy)
+        {
+            stats = &m_esp_timer_stats;
+            report.backend = timer_backend_kind::esp_timer;
+            report.granularity = std::chrono::duration<std::uint64_t, std::micro>(1U);
+        }
+#else
+        (void)policy;
+#endif
+
+        report.max_lateness = std::chrono::duration<std::uint64_t, std::micro>(
+            stats->m_max_lateness_us.load(std::memory_order_relaxed));
+        report.expirations = stats->m_expirations.load(std::memory_order_relaxed);
+        return report;
+    }
+
+    void timer_scheduler::set_high_resolution_spin(const std::chrono::duration<std::uint64_t, std::micro>& slice)
+    {
+        (void)slice;
+    }
+
+    void timer_scheduler::record_lateness(timer_context& context)
+    {
+        const std::uint64_t now = timer_now_us();
+        const std::uint64_t lateness = (now > context.m_deadline_us) ? (now - context.m_deadline_us) : 0U;
+        context.m_deadline_us += context.m_period_us;
+
+        auto& stats = (timer_backend_kind::esp_timer == context.m_backend) ? m_esp_timer_stats : m_tick_stats;
+        const auto lateness_us = static_cast<std::uint32_t>(
+            std::min<std::uint64_t>(lateness, std::numeric_limits<std::uint32_t>::max()));
+
+        stats.m_expirations.fetch_add(1U, std::memory_order_relaxed);
+        auto current = stats.m_max_lateness_us.load(std::memory_order_relaxed);
+        while ((lateness_us > current)
+            && !stats.m_max_lateness_us.compare_exchange_weak(current, lateness_us, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    timer_handle timer_scheduler::add_coalesced(std::uint64_t period_us, std::function<void(timer_handle)>&& handler,
+        timer_type type, std::uint64_t slack_us)
+    {
+        auto context = make_coalesced_context(period_us, std::move(handler), type, slack_us);
+
+        bool kick = false;
+        timer_handle timer_id = 0;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            timer_id = insert_coalesced(std::move(context), kick);
+        }
+
+        if (kick)
+        {
+            kick_coalescing_timer();
+        }
+
+        return timer_id;
+    }
+
+    std::unique_ptr<timer_scheduler::timer_context> timer_scheduler::make_coalesced_context(
+        std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type, std::uint64_t slack_us)
+    {
+        auto context = std::make_unique<timer_context>();
+        context->m_callback = std::move(handler);
+        context->m_backend = timer_backend_kind::coalesced_tick;
+        context->m_policy = timer_resolution_policy::low_resolution;
+        context->m_this = this;
+        context->m_deadline_us = timer_now_us() + period_us;
+        context->m_period_us = (timer_type::periodic == type) ? std::max<std::uint64_t>(period_us, 1U) : 0U;
+        context->m_interval_us = std::max<std::uint64_t>(period_us, 1U);
+        context->m_slack_us = slack_us;
+        return context;
+    }
+
+    timer_handle timer_scheduler::insert_coalesced(std::unique_ptr<timer_context>&& context, bool& kick)
+    {
+        if (nullptr == m_coalescing_timer)
+        {
+            // one-shot, re-armed by the daemon task for the next window after each run
+            m_coalescing_timer = xTimerCreate("coalescing", 1U, pdFALSE, this, coalescing_timer_callback);
+            if (nullptr == m_coalescing_timer)
+            {
+                return 0;
+            }
+        }
+
+        const std::uint64_t latest_us = context->m_deadline_us + context->m_slack_us;
+        context->m_timer_handle = m_next_timer_handle++;
+        const timer_handle timer_id = context->m_timer_handle;
+        m_contexts.emplace_back(std::move(context));
+
+        if ((0U == m_coalescing_armed_us) || (latest_us < m_coalescing_armed_us))
+        {
+            m_coalescing_armed_us = latest_us;
+            kick = true;
+        }
+
+        return timer_id;
+    }
+
+    void timer_scheduler::kick_coalescing_timer()
+    {
+        // let the daemon task re-arm the coalescing timer, so that all the re-arms stay ordered
+        constexpr const int start_timeout_ticks = 100;
+        while (xTimerChangePeriod(m_coalescing_timer, 1U, static_cast<TickType_t>(start_timeout_ticks)) != pdPASS)
+        {
+        }
+    }
+
+    void timer_scheduler::arm_coalescing_timer()
+    {
+        std::uint64_t next_us = 0U;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            for (const auto& context : m_contexts)
+            {
+                if ((timer_backend_kind::coalesced_tick != context->m_backend) || context->m_cancelled)
+                {
+                    continue;
+                }
+
+                const std::uint64_t latest_us = context->m_deadline_us + context->m_slack_us;
+                next_us = ((0U == next_us) || (latest_us < next_us)) ? latest_us : next_us;
+            }
+            m_coalescing_armed_us = next_us;
+        }
+
+        // daemon task context: never block on the timer command queue
+        if (0U == next_us)
+        {
+            (void)xTimerStop(m_coalescing_timer, 0U);
+            return;
+        }
+
+        const std::uint64_t now_us = timer_now_us();
+        (void)xTimerChangePeriod(m_coalescing_timer, us_to_ticks((next_us > now_us) ? (next_us - now_us) : 0U), 0U);
+    }
+
+    void timer_scheduler::run_coalesced()
+    {
+        const std::uint64_t now_us = timer_now_us();
+        {
+            // every timer whose tolerance window is open shares this wakeup
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            for (const auto& context : m_contexts)
+            {
+                if ((timer_backend_kind::coalesced_tick != context->m_backend) || context->m_cancelled
+                    || (context->m_deadline_us > now_us))
+                {
+                    continue;
+                }
+
+                record_lateness(*context);
+                if ((0U != context->m_period_us) && (context->m_deadline_us <= now_us))
+                {
+                    // skip the periods missed by an overrun, keeping the original phase
+                    context->m_deadline_us
+                        += (((now_us - context->m_deadline_us) / context->m_period_us) + 1U) * context->m_period_us;
+                }
+                context->m_running = true;
+                m_coalesced_due.push_back(context.get());
+            }
+        }
+
+        // callbacks run unlocked so that they may add or remove timers
+        for (auto* context : m_coalesced_due)
+        {
+            (context->m_callback)(context->m_timer_handle);
+        }
+
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            for (auto* context : m_coalesced_due)
+            {
+                context->m_running = false;
+                if (context->m_cancelled || (0U == context->m_period_us))
+                {
+                    m_contexts.remove_if([context](const auto& item) -> bool { return item.get() == context; });
+                }
+            }
+        }
+        m_coalesced_due.clear();
+
+        arm_coalescing_timer();
+    }
+
 }
@@ -43,9 +43,11 @@
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 #include <ranges>
 #endif
@@ -53,11 +55,21 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+
 #include "portable_concurrency/bits/coro.hpp"
 #include "portable_concurrency/future.hpp"
 #include "tools/base_task.hpp"
+#include "tools/deadline_work_queue.hpp"
+#include "tools/inplace_function.hpp"
+#include "tools/mpsc_queue.hpp"
 #include "tools/platform_helpers.hpp"
-#include "tools/sync_queue.hpp"
+#include "tools/ring_queue.hpp"
+#include "tools/sync_lane_queue.hpp"
+#include "tools/trace_ring.hpp"
+#include "tools/work_result.hpp"
 
 namespace tools
 {
@@ -83,9 +95,20 @@ namespace tools
     template <typename Context, typename Task>
     void post(worker_task_executor<Context> exec, Task&& task)
     {
-        auto shared_task = std::make_shared<std::decay_t<Task>>(std::forward<Task>(task));
-        exec.m_owner->delegate(
-            [shared_task](const std::shared_ptr<Context>&, const std::string&) mutable { (*shared_task)(); });
+        using work_item = typename worker_task<Context>::work_item;
+
+        if constexpr (work_item::template is_storable<std::decay_t<Task>>)
+        {
+            // small tasks are moved into the work queue, no allocation
+            exec.m_owner->delegate([stored_task = std::decay_t<Task>(std::forward<Task>(task))](
+                                       const std::shared_ptr<Context>&, const std::string&) mutable { stored_task(); });
+        }
+        else
+        {
+            auto shared_task = std::make_shared<std::decay_t<Task>>(std::forward<Task>(task));
+            exec.m_owner->delegate(
+                [shared_task](const std::shared_ptr<Context>&, const std::string&) mutable { (*shared_task)(); });
+        }
     }
 
     /**
@@ -115,6 +138,25 @@ namespace tools
         using call_back = std::function<void(const std::shared_ptr<Context>& context, const std::string& task_name)>;
         using executor_type = worker_task_executor<Context>;
 
+        /**
+         * @brief Type alias for a queued work item.
+         *
+         * Delegated callables are stored inline, without allocation, when they fit in the inplace_function buffer;
+         * larger ones are wrapped in a call_back first.
+         */
+        using work_item
+            = tools::inplace_function<void(const std::shared_ptr<Context>& context, const std::string& task_name)>;
+        static_assert(work_item::template is_storable<call_back>, "a call_back must fit in a work_item");
+
+        /**
+         * @brief Tells whether a callable can be delegated: copyable into a call_back, or small enough to be moved
+         * into a work_item.
+         */
+        template <typename UWork>
+        static constexpr bool is_delegable = std::is_constructible<call_back, UWork>::value
+            || (std::is_constructible<work_item, UWork>::value
+                && work_item::template is_storable<typename std::decay<UWork>::type>);
+
         /**
          * @brief Constructs a worker_task object and initializes the FreeRTOS task.
          *
@@ -138,6 +180,52 @@ namespace tools
                 this->stack_size(), this->cpu_affinity(), this->priority());
         }
 
+        /**
+         * @brief Constructs a worker_task object with a real-time scheduling policy, ignored on FreeRTOS.
+         *
+         * FreeRTOS tasks are already scheduled by fixed priority, so the task is created as with the priority
+         * alone and sched_policy_applied() reports false for a real-time policy.
+         *
+         * @param startup_routine The startup routine to be executed by the task.
+         * @param context Shared pointer to the context object.
+         * @param task_name Name of the task.
+         * @param stack_size Size of the stack allocated for the task.
+         * @param cpu_affinity CPU affinity for the task.
+         * @param priority Priority of the task.
+         * @param sched_policy The SCHED_FIFO, SCHED_RR or SCHED_DEADLINE policy of the Linux builds.
+         */
+        worker_task(call_back&& startup_routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            std::size_t stack_size, int cpu_affinity, int priority, const task_sched_policy& sched_policy)
+            : worker_task(std::move(startup_routine), context, task_name, stack_size, cpu_affinity, priority)
+        {
+            m_sched_policy_applied = (task_sched_class::inherit == sched_policy.sched_class);
+        }
+
+        /**
+         * @brief Constructs a worker_task object running in caller-provided task storage.
+         *
+         * The stack and control block come from storage instead of the heap; storage must outlive the task.
+         *
+         * @param startup_routine The startup routine to be executed by the task.
+         * @param context Shared pointer to the context object.
+         * @param task_name Name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity CPU affinity for the task.
+         * @param priority Priority of the task.
+         */
+        worker_task(call_back&& startup_routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            const task_storage& storage, int cpu_affinity, int priority)
+            : base_task(task_name, storage.stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_context(context)
+        {
+            // FreeRTOS platform
+
+            m_task_created = task_create_static(&m_task, this->task_name(), run_loop,
+                reinterpret_cast<void*>(this), // NOLINT only way to pass the instance as a void* to the task
+                storage.stack, storage.stack_size, storage.control_block, this->cpu_affinity(), this->priority());
+        }
+
         /**
          * @brief Constructs a worker_task object using perfect forwarding.
          *
@@ -211,17 +299,47 @@ namespace tools
         /**
          * @brief Destructor for the worker_task class.
          *
-         * This destructor stops the FreeRTOS task by setting the stop flag and notifying the task.
-         * If the task was created, it suspends and deletes the task.
+         * This destructor stops the FreeRTOS task if stop() was not called, running all the queued work first,
+         * and waits for the task to delete itself.
          */
         ~worker_task() override
         {
             // FreeRTOS platform
 
+            static_cast<void>(stop(task_drain_policy::drain_all));
+        }
+
+        /**
+         * @brief Stops the task and hands back the work it did not run.
+         *
+         * The task finishes the work in progress, then drains the lanes according to the policy and deletes itself.
+         * Work delegated from then on is never run. Calling stop() again returns an empty vector.
+         *
+         * @param policy Whether the queued work is run (all, or until the timeout) or left aside.
+         * @param drain_timeout How long the task may drain with the drain_deadline policy in us.
+         * @return The work not run, deadline work first (earliest first) then highest lane first, to be delegated
+         * to another worker or dropped.
+         */
+        std::vector<work_item> stop(task_drain_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& drain_timeout
+            = std::chrono::duration<std::uint64_t, std::micro>::zero())
+        {
+            std::vector<work_item> unprocessed;
+
+            if (m_stop_task.load())
+            {
+                return unprocessed;
+            }
+
+            m_drain_policy = policy;
+            m_drain_timeout_us = drain_timeout.count();
+            m_drain_start_us = now_us();
+            // publishes the drain settings to the task
             m_stop_task.store(true);
+
             if (m_task_created)
             {
-                xTaskNotify(m_task, 0x01 /* BIT */, eSetBits);
+                xTaskNotifyGive(m_task);
 
                 constexpr TickType_t wait_tick = 1;
                 while (!m_task_stopped.load())
@@ -229,6 +347,18 @@ namespace tools
                     vTaskDelay(wait_tick);
                 }
             }
+
+            for (auto work = m_deadline_queue.pop_any(); work.has_value(); work = m_deadline_queue.pop_any())
+            {
+                unprocessed.push_back(std::move(work.value()));
+            }
+            collect_inbox();
+            for (auto work = m_work_queue.pop(); work.has_value(); work = m_work_queue.pop())
+            {
+                unprocessed.push_back(std::move(work.value()));
+            }
+
+            return unprocessed;
         }
 
         // note: native handle allows specific OS calls like setting scheduling policy or setting priority
@@ -245,22 +375,32 @@ namespace tools
             return reinterpret_cast<void*>(&m_task); // NOLINT native handler wrapping as a void*
         }
 
+        /**
+         * @brief Tells whether the task runs with the scheduling policy given at construction.
+         *
+         * @return True without real-time policy, false otherwise: FreeRTOS keeps its fixed-priority scheduling.
+         */
+        [[nodiscard]] bool sched_policy_applied() const
+        {
+            return m_sched_policy_applied;
+        }
+
         /**
          * @brief Delegates a task to the worker by adding it to the work queue and notifying the task.
          *
          * This function adds the provided work callback to the work queue and notifies the task using FreeRTOS's
-         * xTaskNotify function.
+         * xTaskNotifyGive function.
          *
          * @param work The callback function to be added to the work queue.
          */
         void delegate(call_back&& work)
         {
-            do_delegate(std::move(work));
+            do_delegate(work_item(std::move(work)));
         }
 
         void delegate(const call_back& work)
         {
-            do_delegate(call_back(work));
+            do_delegate(work_item(call_back(work)));
         }
 
         /**
@@ -268,14 +408,165 @@ namespace tools
          */
         template <typename UWork>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-            requires std::is_constructible_v<call_back, UWork>
+            requires is_delegable<UWork>
 #endif
         auto delegate(UWork&& work)
 #if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
-            -> typename std::enable_if<std::is_constructible<call_back, UWork>::value, void>::type
+            -> typename std::enable_if<is_delegable<UWork>, void>::type
+#endif
+        {
+            do_delegate(make_work_item(std::forward<UWork>(work)));
+        }
+
+        /**
+         * @brief Delegates a task to one of the priority lanes.
+         *
+         * Lanes are drained highest first; see set_starvation_quota() for how lower lanes still make progress.
+         *
+         * @param priority The lane of the work.
+         * @param work A callable object (e.g., lambda, function object) to be executed by the worker.
+         */
+        template <typename UWork>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires is_delegable<UWork>
+#endif
+        auto delegate_with_priority(work_priority priority, UWork&& work)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<is_delegable<UWork>, void>::type
+#endif
+        {
+            do_delegate(make_work_item(std::forward<UWork>(work)), priority);
+        }
+
+        /**
+         * @brief Delegates a task to the earliest-deadline-first lane.
+         *
+         * Deadline work runs before the priority lanes, earliest deadline first. Work that has not started by its
+         * deadline is dropped without running and counted by missed_deadline_count().
+         *
+         * @param deadline The latest start time of the work, relative to now.
+         * @param work A callable object (e.g., lambda, function object) to be executed by the worker.
+         */
+        template <typename UWork>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires is_delegable<UWork>
+#endif
+        auto delegate_with_deadline(const std::chrono::duration<std::uint64_t, std::micro>& deadline, UWork&& work)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<is_delegable<UWork>, void>::type
 #endif
         {
-            do_delegate(call_back(std::forward<UWork>(work)));
+            m_deadline_queue.push(now_us() + deadline.count(), make_work_item(std::forward<UWork>(work)));
+            notify_work();
+        }
+
+        /**
+         * @brief Returns the number of deadline work items dropped because they could not start in time.
+         *
+         * @return The missed deadline count.
+         */
+        [[nodiscard]] std::size_t missed_deadline_count() const
+        {
+            return m_deadline_queue.missed_count();
+        }
+
+        /**
+         * @brief Delegates a work item as is, for instance one handed back by the stop() of another worker.
+         *
+         * @param work The work item.
+         * @param priority The lane of the work.
+         */
+        void delegate_work_item(work_item&& work, work_priority priority = work_priority::normal)
+        {
+            do_delegate(std::move(work), priority);
+        }
+
+        /**
+         * @brief Delegates work returning a value, written into a caller-provided slot.
+         *
+         * The work and the slot address are moved into the work item, inline when they fit, so the round trip
+         * costs one queue push and one signal. The slot must outlive the work.
+         *
+         * @param work A callable taking the context and the task name, returning a value convertible to R.
+         * @param result The slot receiving the value, see work_result::wait().
+         * @param priority The lane of the work.
+         */
+        template <typename UWork, typename R>
+        void delegate_with_result(
+            UWork&& work, work_result<R>& result, work_priority priority = work_priority::normal)
+        {
+            auto run_work = [stored_work = std::decay_t<UWork>(std::forward<UWork>(work)), slot = &result](
+                                const std::shared_ptr<Context>& context, const std::string& task_name) mutable
+            { slot->set_value(stored_work(context, task_name)); };
+
+            do_delegate(make_work_item(std::move(run_work)), priority);
+        }
+
+        /**
+         * @brief Delegates work returning a value, handed to a completion callback run by the worker.
+         *
+         * @param work A callable taking the context and the task name, returning a value.
+         * @param on_result A callable taking the value, run by the worker right after the work.
+         * @param priority The lane of the work.
+         */
+        template <typename UWork, typename UCallback>
+        auto delegate_with_result(UWork&& work, UCallback&& on_result, work_priority priority = work_priority::normal)
+            -> decltype(static_cast<void>(on_result(
+                work(std::declval<const std::shared_ptr<Context>&>(), std::declval<const std::string&>()))))
+        {
+            auto run_work = [stored_work = std::decay_t<UWork>(std::forward<UWork>(work)),
+                                callback = std::decay_t<UCallback>(std::forward<UCallback>(on_result))](
+                                const std::shared_ptr<Context>& context, const std::string& task_name) mutable
+            { callback(stored_work(context, task_name)); };
+
+            do_delegate(make_work_item(std::move(run_work)), priority);
+        }
+
+        /**
+         * @brief Sets how many work items in a row a lane may run while a lower lane waits (8 by default).
+         *
+         * @param quota The anti-starvation quota (at least 1).
+         */
+        void set_starvation_quota(std::size_t quota)
+        {
+            m_work_queue.set_quota(quota);
+        }
+
+        /**
+         * @brief Preallocates the work queue so that delegating no longer allocates once the task is started.
+         *
+         * By default the priority lanes grow on demand and keep their storage. Once reserved with the reject or
+         * overwrite_oldest policy, each lane holds at most lane_capacity work items: work delegated to a full lane
+         * is dropped, or replaces the oldest work of that lane, and is counted by dropped_work_count().
+         * Delegation then always takes the lane lock, instead of the lock-free inbox of normal priority work.
+         *
+         * @param lane_capacity The number of work items each priority lane holds.
+         * @param policy What delegating to a full lane does.
+         */
+        void reserve_work_queue(std::size_t lane_capacity, queue_full_policy policy = queue_full_policy::reject)
+        {
+            m_work_queue.reserve(lane_capacity, policy);
+            m_bounded_lanes.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of work items dropped because their lane was full.
+         *
+         * @return The dropped work count.
+         */
+        [[nodiscard]] std::size_t dropped_work_count() const
+        {
+            return m_work_queue.dropped_count();
+        }
+
+        /**
+         * @brief Retrieves the number of work items waiting in the queue, all priorities and deadline work together.
+         *
+         * @return The queue depth.
+         */
+        [[nodiscard]] std::size_t queue_depth() const
+        {
+            return m_inbox.size() + m_work_queue.size() + m_deadline_queue.size();
         }
 
         /**
@@ -298,20 +589,26 @@ namespace tools
 #endif
         void delegate_range(TRange&& range)
         {
+            std::vector<work_item> batch;
             for (auto&& work : std::forward<TRange>(range))
             {
-                do_delegate(call_back(std::forward<decltype(work)>(work)));
+                batch.push_back(make_work_item(std::forward<decltype(work)>(work)));
             }
+            delegate_batch(std::move(batch));
         }
 
+        /**
+         * @brief Delegates a batch of work callbacks from an iterator range.
+         */
         template <typename InputIt>
         void delegate_range(InputIt first, InputIt last)
         {
-            m_work_queue.push_range(first, last);
-            if (m_task_created)
+            std::vector<work_item> batch;
+            for (; first != last; ++first)
             {
-                xTaskNotify(m_task, 0x01 /* BIT */, eSetBits);
+                batch.push_back(make_work_item(*first));
             }
+            delegate_batch(std::move(batch));
         }
 
         /**
@@ -328,10 +625,27 @@ namespace tools
 #endif
         void delegate_range(std::initializer_list<U> range)
         {
+            std::vector<work_item> batch;
+            batch.reserve(range.size());
             for (const auto& work : range)
             {
-                do_delegate(call_back(work));
+                batch.push_back(make_work_item(work));
             }
+            delegate_batch(std::move(batch));
+        }
+
+        /**
+         * @brief Sets how many lane work items the task takes per lock of the work queue.
+         *
+         * With the default of 1, the deadline work and the lanes are checked again before every work item. A larger
+         * batch pays one lock for up to batch_size items, at the cost of latency: work of a higher lane or deadline
+         * work arriving meanwhile waits for the batch in hand to finish, and so does a stop request.
+         *
+         * @param batch_size The number of work items taken at once (at least 1).
+         */
+        void set_batch_size(std::size_t batch_size)
+        {
+            m_batch_size.store((0U == batch_size) ? 1U : batch_size, std::memory_order_relaxed);
         }
 
         [[nodiscard]] executor_type as_executor()
@@ -382,22 +696,141 @@ namespace tools
         {
             return schedule_awaitable { this };
         }
+
+        /**
+         * @brief Awaitable delegating work and resuming the awaiting coroutine on the worker with its result.
+         *
+         * The work and its result live in the awaitable, inside the coroutine frame: nothing is allocated.
+         *
+         * @tparam Work The type of the work.
+         */
+        template <typename Work>
+        class result_awaitable
+        {
+        public:
+            using result_type = std::invoke_result_t<Work&, const std::shared_ptr<Context>&, const std::string&>;
+
+            result_awaitable(worker_task* owner, Work&& work, work_priority priority)
+                : m_owner(owner)
+                , m_work(std::move(work))
+                , m_priority(priority)
+            {
+            }
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(pco::detail::coroutine_handle<> handle)
+            {
+                m_owner->do_delegate(
+                    work_item([this, handle](const std::shared_ptr<Context>& context,
+                                  const std::string& task_name) mutable
+                        {
+                            m_result.run(m_work, context, task_name);
+                            handle.resume();
+                        }),
+                    m_priority);
+            }
+
+            result_type await_resume()
+            {
+                return m_result.take();
+            }
+
+        private:
+            worker_task* m_owner = nullptr;
+            Work m_work;
+            work_priority m_priority;
+            detail::work_result_storage<result_type> m_result;
+        };
+
+        /**
+         * @brief Runs work on the worker from a coroutine, which resumes on the worker with the returned value.
+         *
+         * @param work A callable taking the context and the task name.
+         * @param priority The lane of the work.
+         * @return The awaitable, yielding what work returns.
+         */
+        template <typename UWork>
+        [[nodiscard]] result_awaitable<std::decay_t<UWork>> delegate_await(
+            UWork&& work, work_priority priority = work_priority::normal)
+        {
+            return result_awaitable<std::decay_t<UWork>>(
+                this, std::decay_t<UWork>(std::forward<UWork>(work)), priority);
+        }
 #endif // coroutine support
 
     private:
-        void do_delegate(call_back&& work)
+        /**
+         * @brief Builds a work item, inline when the callable fits, through a call_back otherwise.
+         */
+        template <typename UWork>
+        static work_item make_work_item(UWork&& work)
+        {
+            if constexpr (work_item::template is_storable<typename std::decay<UWork>::type>
+                && std::is_constructible<work_item, UWork>::value)
+            {
+                return work_item(std::forward<UWork>(work));
+            }
+            else
+            {
+                return work_item(call_back(std::forward<UWork>(work)));
+            }
+        }
+
+        void do_delegate(work_item&& work, work_priority priority = work_priority::normal)
         {
             // FreeRTOS platform
 
-            m_work_queue.emplace(std::move(work));
+            enqueue_work(std::move(work), priority);
+            notify_work();
+        }
 
-            // Likewise, bits are set using the xTaskNotify() and xTaskNotifyFromISR() API functions (with their eAction
-            // parameter set to eSetBits) in place of the xEventGroupSetBits() and xEventGroupSetBitsFromISR() functions
-            // respectively.
+        void enqueue_work(work_item&& work, work_priority priority)
+        {
+            if ((priority == work_priority::normal) && !m_bounded_lanes.load(std::memory_order_relaxed))
+            {
+                // wait-free: producers on different cores do not contend on the lane lock
+                m_inbox.push(std::move(work));
+            }
+            else
+            {
+                m_work_queue.push(static_cast<std::size_t>(priority), std::move(work));
+            }
+        }
+
+        /**
+         * @brief Enqueues a batch of normal priority work with one push and a single wake-up.
+         */
+        void delegate_batch(std::vector<work_item>&& batch)
+        {
+            if (batch.empty())
+            {
+                return;
+            }
+
+            if (!m_bounded_lanes.load(std::memory_order_relaxed))
+            {
+                m_inbox.push_range(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+            }
+            else
+            {
+                m_work_queue.push_range(static_cast<std::size_t>(work_priority::normal),
+                    std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+            }
+            notify_work();
+        }
+
+        void notify_work()
+        {
+            // The notification value is used as a lightweight counting semaphore: xTaskNotifyGive() in place of
+            // xEventGroupSetBits(), and ulTaskNotifyTake() in the run loop in place of xEventGroupWaitBits().
 
             if (m_task_created)
             {
-                xTaskNotify(m_task, 0x01 /* BIT */, eSetBits);
+                xTaskNotifyGive(m_task);
             }
         }
 
@@ -433,35 +866,139 @@ namespace tools
 
                 constexpr const TickType_t x_block_time = portMAX_DELAY; /* Block indefinitely. */
 
-                std::uint32_t ul_notified_value = 0U;
-                (void)xTaskNotifyWait(pdFALSE, /* Don't clear bits on entry. */
-                    ULONG_MAX,                 /* Clear all bits on exit. */
-                    &ul_notified_value,        /* Stores the notified value. */
-                    x_block_time);
-
-                while (!instance->m_work_queue.empty())
-                {
-                    auto work = instance->m_work_queue.front_pop();
+                // clear the count on exit: the queue is drained until empty whatever the number of delegates
+                (void)ulTaskNotifyTake(pdTRUE, x_block_time);
+                TOOLS_TRACE(task_switch, "worker_task::resume", instance, 0U);
 
-                    if (work.has_value())
-                    {
-                        work.value()(instance->m_context, task_name);
-                    }
-                }
+                instance->run_queued(task_name);
             } // run loop
 
+            // work delegated while the stop request was issued
+            instance->run_queued(task_name);
+
             instance->m_task_stopped.store(true);
             vTaskDelete(nullptr);
         }
 
+        /**
+         * @brief Runs the queued work until the lanes are empty or the drain policy says stop.
+         *
+         * @param task_name The name of the task.
+         */
+        void run_queued(const std::string& task_name)
+        {
+            while (may_process())
+            {
+                const std::size_t count = next_work();
+
+                if (0U == count)
+                {
+                    break;
+                }
+
+                for (std::size_t index = 0U; index < count; ++index)
+                {
+                    TOOLS_TRACE(dequeue, "worker_task::dequeue", this, 0U);
+                    TOOLS_TRACE(process_begin, "worker_task::process", this, 0U);
+                    m_batch[index](m_context, task_name);
+                    m_batch[index] = work_item();
+                    TOOLS_TRACE(process_end, "worker_task::process", this, 0U);
+                }
+            }
+        }
+
+        /**
+         * @brief Tells whether queued work may still run, according to the drain policy once stopping.
+         *
+         * @return true if the task runs, or drains and the drain policy allows more.
+         */
+        [[nodiscard]] bool may_process() const
+        {
+            if (!m_stop_task.load())
+            {
+                return true;
+            }
+
+            switch (m_drain_policy)
+            {
+                case task_drain_policy::drain_all:
+                    return true;
+                case task_drain_policy::drain_deadline:
+                    return (now_us() - m_drain_start_us) < m_drain_timeout_us;
+                case task_drain_policy::discard:
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * @brief Takes the deadline work still able to start in time, earliest first, else a batch from the lanes.
+         *
+         * @return The number of work items placed at the front of m_batch, 0 if everything is empty.
+         */
+        std::size_t next_work()
+        {
+            const std::size_t batch_size = m_batch_size.load(std::memory_order_relaxed);
+            if (m_batch.size() < batch_size)
+            {
+                m_batch.resize(batch_size);
+            }
+
+            auto work = m_deadline_queue.pop(now_us());
+            if (work.has_value())
+            {
+                m_batch.front() = std::move(work.value());
+                return 1U;
+            }
+
+            collect_inbox();
+            return m_work_queue.pop_range(m_batch.begin(), m_batch.begin() + static_cast<std::ptrdiff_t>(batch_size));
+        }
+
+        /**
+         * @brief Moves the normal priority work of the inbox into its lane, behind the anti-starvation quota.
+         */
+        void collect_inbox()
+        {
+            for (auto work = m_inbox.front_pop(); work.has_value(); work = m_inbox.front_pop())
+            {
+                m_collected.push_back(std::move(work.value()));
+            }
+            m_work_queue.push_range(static_cast<std::size_t>(work_priority::normal),
+                std::make_move_iterator(m_collected.begin()), std::make_move_iterator(m_collected.end()));
+            m_collected.clear();
+        }
+
+        static std::uint64_t now_us()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#endif
+        }
+
         call_back m_startup_routine;
-        tools::sync_queue<call_back> m_work_queue;
+        tools::sync_lane_queue<work_item, work_priority_lanes, tools::ring_queue<work_item>> m_work_queue;
+        // normal priority work, the common case, pushed wait-free and moved into m_work_queue by the task alone
+        tools::mpsc_queue<work_item> m_inbox;
+        std::atomic_bool m_bounded_lanes = false; // set by reserve_work_queue(): drops happen when delegating
+        std::atomic<std::size_t> m_batch_size = 1U;
+        std::vector<work_item> m_batch;     // work taken from the queues, run by the task alone
+        std::vector<work_item> m_collected; // inbox work on its way to its lane, moved by the task alone
+        tools::deadline_work_queue<work_item> m_deadline_queue;
         std::shared_ptr<Context> m_context;
 
         std::atomic_bool m_stop_task = false;
         std::atomic_bool m_task_stopped = false;
+        // written by stop() before m_stop_task, read by the task once it sees m_stop_task
+        task_drain_policy m_drain_policy = task_drain_policy::drain_all;
+        std::uint64_t m_drain_timeout_us = 0U;
+        std::uint64_t m_drain_start_us = 0U;
 
         TaskHandle_t m_task = {};
+        bool m_sched_policy_applied = true;
         bool m_task_created = false;
     };
 }
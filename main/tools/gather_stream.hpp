@@ -0,0 +1,373 @@
+/**
+ * @file gather_stream.hpp
+ * @brief Scatter-gather serialization: bytepack header fields plus references to large payload spans, consumed
+ * by memory_pipe, POSIX writev() or the streaming gzip compressor without joining them first.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(GATHER_STREAM_HPP_)
+#define GATHER_STREAM_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <sys/uio.h>
+#define GATHER_STREAM_WRITEV
+#endif
+
+#include "bytepack/bytepack.hpp"
+#include "tools/expected.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief One contiguous span of a gather list, the same pair as a POSIX iovec.
+     */
+    struct gather_segment
+    {
+        const std::uint8_t* data = nullptr; ///< First byte of the span.
+        std::size_t size = 0U;              ///< Span size in bytes.
+    };
+
+    /**
+     * @brief Serializes a frame as a gather list: fields written with bytepack::binary_stream land in an inline
+     * buffer, large spans are only referenced.
+     *
+     * Fields written through stream() before and after each reference() become separate inline segments, so the
+     * list keeps the order of the calls. A frame made of a header and an existing payload is therefore described
+     * by two segments and the payload is never copied; the consumers below (send_gather(), write_gather(),
+     * compress_gather()) walk the list directly.
+     *
+     * Referenced spans must stay valid and unchanged until the list is consumed. The inline buffer and the
+     * segment table are allocated once at construction; reset() starts the next frame.
+     *
+     * @tparam MaxSegments Capacity of the segment table.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <std::size_t MaxSegments = 8U, std::endian BufferEndian = std::endian::big>
+    class gather_writer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using stream_type = bytepack::binary_stream<BufferEndian>;
+
+        gather_writer() = delete;
+        ~gather_writer() = default;
+
+        /**
+         * @brief Constructs a writer.
+         *
+         * @param inline_bytes Capacity of the inline buffer holding the fields of one frame.
+         */
+        explicit gather_writer(std::size_t inline_bytes)
+            : m_inline(inline_bytes)
+            , m_stream(bytepack::buffer_view(m_inline.data(), m_inline.size()))
+        {
+        }
+
+        /**
+         * @brief Gets the stream serializing the inline fields of the frame.
+         *
+         * @return The stream, writing after any reference already added.
+         */
+        [[nodiscard]] stream_type& stream()
+        {
+            return m_stream;
+        }
+
+        /**
+         * @brief Appends a span to the frame by reference.
+         *
+         * @param data First byte of the span, valid until the list is consumed.
+         * @param size Span size in bytes, an empty span being ignored.
+         * @return false if the segment table is full.
+         */
+        bool reference(const std::uint8_t* data, std::size_t size)
+        {
+            if (0U == size)
+            {
+                return true;
+            }
+
+            // the pending inline bytes and the reference may need two segments
+            const bool pending = (m_stream.data().size() > m_mark);
+            if ((m_count + (pending ? 2U : 1U)) > MaxSegments)
+            {
+                return false;
+            }
+
+            cut_inline();
+            m_segments[m_count++] = gather_segment { data, size }; // NOLINT bounded index
+            m_total += size;
+            return true;
+        }
+
+        /**
+         * @brief C++20 span overload of reference().
+         */
+        bool reference(std::span<const std::uint8_t> data)
+        {
+            return reference(data.data(), data.size());
+        }
+
+        /**
+         * @brief Gets the gather list of the frame, closing its pending inline segment.
+         *
+         * @return The segments in frame order, or an empty list if the table cannot hold the last inline segment.
+         */
+        [[nodiscard]] std::span<const gather_segment> segments()
+        {
+            if ((m_stream.data().size() > m_mark) && (m_count == MaxSegments))
+            {
+                return {};
+            }
+
+            cut_inline();
+            return { m_segments.data(), m_count };
+        }
+
+        /**
+         * @brief Gets the frame size, inline fields and referenced spans together.
+         *
+         * @return The number of bytes the gather list describes.
+         */
+        [[nodiscard]] std::size_t total_size() const
+        {
+            return m_total + (m_stream.data().size() - m_mark);
+        }
+
+        /**
+         * @brief Forgets the frame and rewinds the inline buffer.
+         */
+        void reset()
+        {
+            m_stream.reset();
+            m_count = 0U;
+            m_mark = 0U;
+            m_total = 0U;
+        }
+
+    private:
+        void cut_inline()
+        {
+            const std::size_t written = m_stream.data().size();
+            if (written > m_mark)
+            {
+                m_segments[m_count++] = gather_segment { m_inline.data() + m_mark, written - m_mark }; // NOLINT
+                m_total += written - m_mark;
+                m_mark = written;
+            }
+        }
+
+        std::vector<std::uint8_t> m_inline;
+        stream_type m_stream;
+        std::array<gather_segment, MaxSegments> m_segments = {};
+        std::size_t m_count = 0U;
+        std::size_t m_mark = 0U;
+        std::size_t m_total = 0U;
+    };
+
+    /**
+     * @brief Gets the size of a gather list.
+     *
+     * @param segments The gather list.
+     * @return The sum of the segment sizes.
+     */
+    [[nodiscard]] inline std::size_t gather_size(std::span<const gather_segment> segments)
+    {
+        std::size_t total = 0U;
+        for (const auto& segment : segments)
+        {
+            total += segment.size;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Sends a gather list into a memory_pipe segment by segment, without joining it first.
+     *
+     * @param pipe Destination pipe; only its producer thread may call this.
+     * @param segments The gather list.
+     * @param timeout Maximum wait for room in the pipe, for each segment.
+     * @return The number of bytes sent, short of gather_size() if a segment could not be sent in time.
+     */
+    inline std::size_t send_gather(memory_pipe& pipe, std::span<const gather_segment> segments,
+        const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+    {
+        std::size_t sent = 0U;
+        for (const auto& segment : segments)
+        {
+            const std::size_t pushed = pipe.send(segment.data, segment.size, timeout);
+            sent += pushed;
+            if (pushed != segment.size)
+            {
+                break;
+            }
+        }
+        return sent;
+    }
+
+    /**
+     * @brief Gets the destination capacity compress_gather() requires.
+     *
+     * @param segments The gather list.
+     * @return The worst case gzip stream size, one gzip_stream_compressor::update() per segment.
+     */
+    [[nodiscard]] inline std::size_t compress_gather_bound(std::span<const gather_segment> segments)
+    {
+        std::size_t bound = gzip_stream_compressor::header_size + gzip_stream_compressor::finish_bound;
+        for (const auto& segment : segments)
+        {
+            bound += gzip_stream_compressor::update_bound(segment.size);
+        }
+        return bound;
+    }
+
+    /**
+     * @brief Compresses a gather list into one gzip stream, each segment being one update() of the compressor.
+     *
+     * Matches are searched within each segment, so a small header costs a few literals but the payload is read
+     * in place.
+     *
+     * @param compressor The compressor; any stream in progress is restarted.
+     * @param segments The gather list.
+     * @param output Destination buffer.
+     * @param capacity Destination capacity, at least compress_gather_bound(segments).
+     * @param level Match finding effort of the stream.
+     * @return The size of the gzip stream, or the error of the failing compressor call.
+     */
+    [[nodiscard]] inline expected<std::size_t, gzip_stream_error> compress_gather(gzip_stream_compressor& compressor,
+        std::span<const gather_segment> segments, std::uint8_t* output, std::size_t capacity,
+        gzip_level level = gzip_level::balanced)
+    {
+        if (capacity < compress_gather_bound(segments))
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::output_too_small);
+        }
+
+        auto written = compressor.init(output, capacity, level);
+        if (!written)
+        {
+            return written;
+        }
+        std::size_t length = *written;
+
+        for (const auto& segment : segments)
+        {
+            written = compressor.update(segment.data, segment.size, output + length, capacity - length); // NOLINT
+            if (!written)
+            {
+                return written;
+            }
+            length += *written;
+        }
+
+        written = compressor.finish(output + length, capacity - length); // NOLINT pointer arithmetic
+        if (!written)
+        {
+            return written;
+        }
+        return length + *written;
+    }
+
+#if defined(GATHER_STREAM_WRITEV)
+    /**
+     * @brief Writes a gather list to a file descriptor or socket with writev(), resuming after partial writes.
+     *
+     * @param descriptor Destination descriptor.
+     * @param segments The gather list.
+     * @return The number of bytes written, short of gather_size() on error (errno is kept).
+     */
+    inline std::size_t write_gather(int descriptor, std::span<const gather_segment> segments)
+    {
+        constexpr std::size_t batch_size = 16U;
+        std::array<iovec, batch_size> vectors = {};
+        std::size_t written = 0U;
+        std::size_t index = 0U;
+        std::size_t offset = 0U; // bytes of segments[index] already written
+
+        while (index < segments.size())
+        {
+            std::size_t count = 0U;
+            for (std::size_t next = index; (next < segments.size()) && (count < batch_size); ++next)
+            {
+                const std::size_t skip = (next == index) ? offset : 0U;
+                vectors[count].iov_base = const_cast<std::uint8_t*>(segments[next].data + skip); // NOLINT iovec API
+                vectors[count].iov_len = segments[next].size - skip;
+                ++count;
+            }
+
+            const ssize_t result = ::writev(descriptor, vectors.data(), static_cast<int>(count));
+            if (result < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                break;
+            }
+
+            // advance over the fully written segments, then into the partially written one
+            auto remaining = static_cast<std::size_t>(result);
+            written += remaining;
+            while ((index < segments.size()) && (remaining >= (segments[index].size - offset)))
+            {
+                remaining -= segments[index].size - offset;
+                offset = 0U;
+                ++index;
+            }
+            offset += remaining;
+            if ((0 == result) && (index < segments.size()))
+            {
+                break;
+            }
+        }
+        return written;
+    }
+#endif
+
+} // namespace tools
+
+#endif // C++20
+
+#endif //  GATHER_STREAM_HPP_
@@ -35,210 +35,1843 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
-#include <cstdlib>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
+#include "tools/checksum.hpp"
 #include "tools/gzip_wrapper.hpp"
 #include "tools/logger.hpp"
 #include "tools/non_copyable.hpp"
 #include "uzlib/uzlib.h"
 
+namespace
+{
+    constexpr const std::size_t min_match = 3U;
+    constexpr const std::size_t max_match = 258U;
+    constexpr const std::uint32_t end_of_block = 256U;
+    constexpr const unsigned int byte_bits = 8U;
+    constexpr const std::uint32_t lo_byte_mask = 0xffU;
+
+    // RFC 1951 section 3.2.5 length and distance codes
+    constexpr const std::array<std::uint16_t, 29U> length_base = { 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 13U, 15U,
+        17U, 19U, 23U, 27U, 31U, 35U, 43U, 51U, 59U, 67U, 83U, 99U, 115U, 131U, 163U, 195U, 227U, 258U };
+    constexpr const std::array<std::uint8_t, 29U> length_extra
+        = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U, 2U, 2U, 2U, 2U, 3U, 3U, 3U, 3U, 4U, 4U, 4U, 4U, 5U, 5U,
+              5U, 5U, 0U };
+    constexpr const std::array<std::uint16_t, 30U> distance_base = { 1U, 2U, 3U, 4U, 5U, 7U, 9U, 13U, 17U, 25U, 33U,
+        49U, 65U, 97U, 129U, 193U, 257U, 385U, 513U, 769U, 1025U, 1537U, 2049U, 3073U, 4097U, 6145U, 8193U, 12289U,
+        16385U, 24577U };
+    constexpr const std::array<std::uint8_t, 30U> distance_extra = { 0U, 0U, 0U, 0U, 1U, 1U, 2U, 2U, 3U, 3U, 4U, 4U,
+        5U, 5U, 6U, 6U, 7U, 7U, 8U, 8U, 9U, 9U, 10U, 10U, 11U, 11U, 12U, 12U, 13U, 13U };
+
+    /**
+     * @brief Reverses the bits of a Huffman code, deflate emitting codes most significant bit first.
+     */
+    constexpr std::uint32_t reverse_bits(std::uint32_t code, unsigned int length)
+    {
+        std::uint32_t reversed = 0U;
+        for (unsigned int i = 0U; i < length; ++i)
+        {
+            reversed = (reversed << 1U) | ((code >> i) & 1U);
+        }
+        return reversed;
+    }
+
+    /**
+     * @brief Fixed Huffman code of a literal/length symbol, already bit reversed, with its length.
+     */
+    constexpr std::pair<std::uint32_t, unsigned int> fixed_symbol_code(std::uint32_t symbol)
+    {
+        // NOLINTBEGIN fixed Huffman table of RFC 1951 section 3.2.6
+        if (symbol <= 143U)
+        {
+            return { reverse_bits(0x30U + symbol, 8U), 8U };
+        }
+        if (symbol <= 255U)
+        {
+            return { reverse_bits(0x190U + (symbol - 144U), 9U), 9U };
+        }
+        if (symbol <= 279U)
+        {
+            return { reverse_bits(symbol - 256U, 7U), 7U };
+        }
+        return { reverse_bits(0xc0U + (symbol - 280U), 8U), 8U };
+        // NOLINTEND
+    }
+
+    /**
+     * @brief Bit reversed fixed Huffman codes of the 256 literals, their length being 8 or 9 bits.
+     */
+    constexpr std::array<std::uint16_t, 256U> make_literal_codes()
+    {
+        std::array<std::uint16_t, 256U> codes = {};
+        for (std::uint32_t symbol = 0U; symbol < codes.size(); ++symbol)
+        {
+            codes[symbol] = static_cast<std::uint16_t>(fixed_symbol_code(symbol).first);
+        }
+        return codes;
+    }
+
+    constexpr const std::array<std::uint16_t, 256U> literal_codes = make_literal_codes();
+
+    /**
+     * @brief Match finder hash (the liblzf one used by uzlib) of the 3 bytes at data.
+     */
+    inline std::size_t match_hash(const std::uint8_t* data, unsigned int hash_bits)
+    {
+        const std::uint32_t value = (static_cast<std::uint32_t>(data[0]) << 16U) // NOLINT pointer arithmetic
+            | (static_cast<std::uint32_t>(data[1]) << 8U)                        // NOLINT pointer arithmetic
+            | static_cast<std::uint32_t>(data[2]);                               // NOLINT pointer arithmetic
+        return static_cast<std::size_t>(
+            ((value >> ((3U * byte_bits) - hash_bits)) - value) & ((std::uint32_t { 1U } << hash_bits) - 1U));
+    }
+
+    /**
+     * @brief Writes the gzip member header.
+     *
+     * @param extra_flags XFL byte: 2 for maximum compression, 4 for fastest.
+     */
+    inline void put_gzip_header(std::uint8_t* output, std::uint8_t extra_flags)
+    {
+        // magic tag, deflate method, no flag, no time, XFL, OS (Unix)
+        const std::array<std::uint8_t, tools::gzip_stream_compressor::header_size> gzip_header
+            = { 0x1fU, 0x8bU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, extra_flags, 0x03U };
+        std::memcpy(output, gzip_header.data(), gzip_header.size());
+    }
+
+    constexpr const std::uint8_t xfl_best = 0x02U;
+    constexpr const std::uint8_t xfl_fastest = 0x04U;
+
+    /**
+     * @brief Greedy LZ77 parse of data[begin, end) on a single-entry hash of positions.
+     *
+     * Matches may reach history bytes before begin. positions holds origin + index of the last occurrence of each
+     * hash; entries outside the window are rejected by range and every candidate is checked by content, so the
+     * table never needs clearing. With skip_misses (gzip_level::fast), a run of misses makes the parse probe every
+     * other byte, then every third, and so on, the skipped bytes being emitted as literals.
+     */
+    template <typename Literal, typename Match>
+    void greedy_parse(std::uint32_t* positions, unsigned int hash_bits, bool skip_misses, const std::uint8_t* data,
+        std::size_t begin, std::size_t end, std::size_t history, std::uint32_t origin, Literal&& literal,
+        Match&& match)
+    {
+        constexpr const unsigned int fast_skip_shift = 5U;
+
+        std::size_t index = begin;
+        std::size_t misses = 0U;
+
+        while ((index + min_match) <= end)
+        {
+            const std::uint8_t* current = data + index; // NOLINT pointer arithmetic
+            auto& entry = positions[match_hash(current, hash_bits)]; // NOLINT pointer arithmetic
+            const auto current_position = static_cast<std::uint32_t>(origin + index);
+            // modular distance: stale entries of previous chunks fall outside the window and are rejected
+            const std::uint32_t distance = current_position - entry;
+            entry = current_position;
+
+            if ((0U != distance) && (distance <= ((index - begin) + history)) && (distance <= tools::gzip_dict_size)
+                && (0 == std::memcmp(current, current - distance, min_match))) // NOLINT pointer arithmetic
+            {
+                std::size_t length = min_match;
+                const std::size_t max_length = std::min(max_match, end - index);
+                while ((length < max_length) && (current[length] == current[length - distance])) // NOLINT arithmetic
+                {
+                    ++length;
+                }
+
+                match(length, static_cast<std::size_t>(distance));
+                index += length;
+                misses = 0U;
+            }
+            else if (skip_misses)
+            {
+                const std::size_t step = std::min(std::size_t { 1U } + (misses++ >> fast_skip_shift), end - index);
+                for (std::size_t i = 0U; i < step; ++i)
+                {
+                    literal(current[i]); // NOLINT pointer arithmetic
+                }
+                index += step;
+            }
+            else
+            {
+                literal(*current);
+                ++index;
+            }
+        }
+
+        // buffer tail, shorter than a match
+        for (; index < end; ++index)
+        {
+            literal(data[index]); // NOLINT pointer arithmetic
+        }
+    }
+
+    /**
+     * @brief Writes a 32-bit value in little endian order.
+     */
+    inline std::uint8_t* put_le32(std::uint8_t* output, std::uint32_t value)
+    {
+        for (unsigned int shift = 0U; shift < (4U * byte_bits); shift += byte_bits)
+        {
+            *output++ = static_cast<std::uint8_t>((value >> shift) & lo_byte_mask); // NOLINT pointer arithmetic
+        }
+        return output;
+    }
+
+    /**
+     * @brief Writes a 32-bit value in big endian order, as zlib streams store it.
+     */
+    inline std::uint8_t* put_be32(std::uint8_t* output, std::uint32_t value)
+    {
+        for (unsigned int shift = 4U * byte_bits; shift != 0U; shift -= byte_bits)
+        {
+            *output++ = static_cast<std::uint8_t>((value >> (shift - byte_bits)) & lo_byte_mask); // NOLINT
+        }
+        return output;
+    }
+
+    /**
+     * @brief Reads a 32-bit big endian value.
+     */
+    inline std::uint32_t get_be32(const std::uint8_t* input)
+    {
+        std::uint32_t value = 0U;
+        for (unsigned int i = 0U; i < 4U; ++i)
+        {
+            value = (value << byte_bits) | input[i]; // NOLINT pointer arithmetic
+        }
+        return value;
+    }
+
+    constexpr const std::uint8_t zlib_deflate_32k = 0x78U; ///< CMF: deflate method, 32 KB window.
+    constexpr const std::uint8_t zlib_fdict = 0x20U;       ///< FLG: a dictionary id follows the header.
+    constexpr const unsigned int zlib_check_modulo = 31U;  ///< (CMF * 256 + FLG) is a multiple of 31.
+    constexpr const std::size_t zlib_header_size = 2U;
+}
+
+namespace tools
+{
+    /**
+     * @brief Hash chains and symbol buffer of gzip_level::best, allocated once per wrapper on first use.
+     */
+    struct gzip_chain_tables
+    {
+        static constexpr std::size_t chain_heads = std::size_t { 1U } << gzip_chain_hash_bits;
+        static constexpr std::size_t block_symbols = 8192U; ///< Symbols per deflate block.
+
+        std::array<std::uint32_t, chain_heads> m_heads;        ///< Last position + 1 of each hash, 0 when none.
+        std::array<std::uint16_t, gzip_dict_size> m_previous;  ///< Distance to the previous position of same hash.
+        std::array<std::uint32_t, block_symbols> m_symbols;    ///< Literal, or (distance << 16) | length.
+    };
+}
+
+namespace
+{
+    constexpr const std::size_t literal_length_symbols = 286U;
+    constexpr const std::size_t distance_symbols = 30U;
+    constexpr const std::size_t code_length_symbols = 19U;
+    constexpr const unsigned int max_code_length = 15U;
+    constexpr const unsigned int max_code_length_code_length = 7U;
+    constexpr const std::uint32_t max_best_distance = tools::gzip_dict_size - 1U; // keeps chain slots unambiguous
+    constexpr const std::size_t stored_block_max = 0xffffU;
+
+    // RFC 1951 section 3.2.7 order of the code length code lengths
+    constexpr const std::array<std::uint8_t, code_length_symbols> code_length_order
+        = { 16U, 17U, 18U, 0U, 8U, 7U, 9U, 6U, 10U, 5U, 11U, 4U, 12U, 3U, 13U, 2U, 14U, 1U, 15U };
+
+    inline std::size_t length_code(std::size_t length)
+    {
+        return static_cast<std::size_t>(
+            std::upper_bound(length_base.begin(), length_base.end(), length) - length_base.begin() - 1);
+    }
+
+    inline std::size_t distance_code(std::size_t distance)
+    {
+        return static_cast<std::size_t>(
+            std::upper_bound(distance_base.begin(), distance_base.end(), distance) - distance_base.begin() - 1);
+    }
+
+    /**
+     * @brief LSB-first bit writer over a buffer sized beforehand.
+     */
+    class bit_writer
+    {
+    public:
+        explicit bit_writer(std::uint8_t* output)
+            : m_output(output)
+        {
+        }
+
+        void put(std::uint32_t bits, unsigned int count)
+        {
+            m_buffer |= static_cast<std::uint64_t>(bits) << m_count;
+            m_count += count;
+            while (m_count >= byte_bits)
+            {
+                *m_output++ = static_cast<std::uint8_t>(m_buffer & lo_byte_mask); // NOLINT pointer arithmetic
+                m_buffer >>= byte_bits;
+                m_count -= byte_bits;
+            }
+        }
+
+        void align()
+        {
+            if (0U != m_count)
+            {
+                put(0U, byte_bits - m_count);
+            }
+        }
+
+        void put_aligned_bytes(const std::uint8_t* data, std::size_t size)
+        {
+            std::memcpy(m_output, data, size);
+            m_output += size; // NOLINT pointer arithmetic
+        }
+
+        [[nodiscard]] std::uint8_t* position() const
+        {
+            return m_output;
+        }
+
+    private:
+        std::uint8_t* m_output;
+        std::uint64_t m_buffer = 0U;
+        unsigned int m_count = 0U;
+    };
+
+    /**
+     * @brief Ends a non final deflate segment with an empty stored block (a zlib sync flush), byte aligned.
+     */
+    void put_sync_marker(bit_writer& writer)
+    {
+        writer.put(0U, 3U); // BFINAL = 0, BTYPE = 00
+        writer.align();
+        writer.put(0U, 16U);      // NOLINT LEN
+        writer.put(0xffffU, 16U); // NOLINT NLEN
+    }
+
+    /**
+     * @brief Writes a literal with the fixed Huffman codes.
+     */
+    inline void put_fixed_literal(bit_writer& writer, std::uint8_t value)
+    {
+        constexpr const std::uint8_t last_8_bits_literal = 143U;
+        writer.put(literal_codes[value], (value <= last_8_bits_literal) ? 8U : 9U); // NOLINT code lengths
+    }
+
+    /**
+     * @brief Writes a match with the fixed Huffman codes.
+     */
+    void put_fixed_match(bit_writer& writer, std::size_t length, std::size_t distance)
+    {
+        const std::size_t lcode = length_code(length);
+        const auto symbol = fixed_symbol_code(static_cast<std::uint32_t>(end_of_block + 1U + lcode));
+        writer.put(symbol.first, symbol.second);
+        writer.put(static_cast<std::uint32_t>(length - length_base[lcode]), length_extra[lcode]);
+
+        const std::size_t dcode = distance_code(distance);
+        writer.put(reverse_bits(static_cast<std::uint32_t>(dcode), 5U), 5U); // NOLINT 5 bits distance codes
+        writer.put(static_cast<std::uint32_t>(distance - distance_base[dcode]), distance_extra[dcode]);
+    }
+
+    /**
+     * @brief Writes data as stored blocks, the last one final when final_range is set.
+     */
+    void put_stored(bit_writer& writer, const std::uint8_t* data, std::size_t size, bool final_range)
+    {
+        do
+        {
+            const std::size_t length = std::min(size, stored_block_max);
+            size -= length;
+            writer.put((final_range && (0U == size)) ? 1U : 0U, 3U);
+            writer.align();
+            writer.put(static_cast<std::uint32_t>(length), 16U);            // NOLINT LEN
+            writer.put(static_cast<std::uint32_t>(~length & 0xffffU), 16U); // NOLINT NLEN
+            writer.put_aligned_bytes(data, length);
+            data += length; // NOLINT pointer arithmetic
+        } while (0U != size);
+    }
+
+    /**
+     * @brief Computes Huffman code lengths limited to max_length bits.
+     *
+     * The tree is built with the two-queue method over the symbols sorted by frequency, then overlong codes are
+     * folded back until the Kraft sum is exact. A code always gets at least two symbols, so it is complete.
+     */
+    void build_code_lengths(
+        const std::uint32_t* frequencies, std::size_t count, unsigned int max_length, std::uint8_t* lengths)
+    {
+        std::array<std::uint16_t, literal_length_symbols> leaves = {};
+        std::size_t used = 0U;
+        std::fill(lengths, lengths + count, std::uint8_t { 0U }); // NOLINT pointer arithmetic
+        for (std::size_t symbol = 0U; symbol < count; ++symbol)
+        {
+            if (0U != frequencies[symbol]) // NOLINT pointer arithmetic
+            {
+                leaves[used++] = static_cast<std::uint16_t>(symbol);
+            }
+        }
+
+        if (used < 2U)
+        {
+            const std::size_t first = (0U == used) ? 0U : leaves[0];
+            lengths[first] = 1U;                     // NOLINT pointer arithmetic
+            lengths[(0U == first) ? 1U : 0U] = 1U; // NOLINT pointer arithmetic
+            return;
+        }
+
+        std::stable_sort(leaves.begin(), leaves.begin() + static_cast<std::ptrdiff_t>(used),
+            [frequencies](std::uint16_t lhs, std::uint16_t rhs)
+            { return frequencies[lhs] < frequencies[rhs]; }); // NOLINT pointer arithmetic
+
+        // nodes [0, used) are the leaves by increasing weight, [used, 2 * used - 1) the internal nodes
+        std::array<std::uint32_t, 2U * literal_length_symbols> weights = {};
+        std::array<std::uint16_t, 2U * literal_length_symbols> parents = {};
+        for (std::size_t i = 0U; i < used; ++i)
+        {
+            weights[i] = frequencies[leaves[i]]; // NOLINT pointer arithmetic
+        }
+
+        std::size_t next_leaf = 0U;
+        std::size_t next_internal = used;
+        const std::size_t nodes = (2U * used) - 1U;
+        for (std::size_t node = used; node < nodes; ++node)
+        {
+            for (unsigned int child = 0U; child < 2U; ++child)
+            {
+                const bool take_leaf
+                    = (next_leaf < used) && ((next_internal >= node) || (weights[next_leaf] <= weights[next_internal]));
+                const std::size_t picked = take_leaf ? next_leaf++ : next_internal++;
+                weights[node] += weights[picked];
+                parents[picked] = static_cast<std::uint16_t>(node);
+            }
+        }
+
+        // depths: parents always come after their children
+        std::array<std::uint16_t, 2U * literal_length_symbols> depths = {};
+        std::array<std::uint32_t, literal_length_symbols + 1U> length_counts = {};
+        for (std::size_t node = nodes - 1U; node-- > 0U;)
+        {
+            depths[node] = static_cast<std::uint16_t>(depths[parents[node]] + 1U);
+        }
+        for (std::size_t i = 0U; i < used; ++i)
+        {
+            ++length_counts[std::min<std::size_t>(depths[i], max_length + 1U)];
+        }
+
+        // fold overlong codes into max_length, then lengthen shorter codes until the Kraft sum is exact again
+        length_counts[max_length] += length_counts[max_length + 1U];
+        length_counts[max_length + 1U] = 0U;
+        std::uint32_t kraft = 0U;
+        for (unsigned int length = 1U; length <= max_length; ++length)
+        {
+            kraft += length_counts[length] << (max_length - length);
+        }
+        while (kraft != (std::uint32_t { 1U } << max_length))
+        {
+            --length_counts[max_length];
+            for (unsigned int length = max_length - 1U; length > 0U; --length)
+            {
+                if (0U != length_counts[length])
+                {
+                    --length_counts[length];
+                    length_counts[length + 1U] += 2U;
+                    break;
+                }
+            }
+            --kraft;
+        }
+
+        // the least frequent symbols get the longest codes
+        std::size_t leaf = 0U;
+        for (unsigned int length = max_length; length > 0U; --length)
+        {
+            for (std::uint32_t n = length_counts[length]; n > 0U; --n)
+            {
+                lengths[leaves[leaf++]] = static_cast<std::uint8_t>(length); // NOLINT pointer arithmetic
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns the canonical codes of RFC 1951 section 3.2.2, bit reversed for emission.
+     */
+    void build_codes(const std::uint8_t* lengths, std::size_t count, std::uint16_t* codes)
+    {
+        std::array<std::uint32_t, max_code_length + 1U> length_counts = {};
+        std::array<std::uint32_t, max_code_length + 1U> next_code = {};
+        for (std::size_t symbol = 0U; symbol < count; ++symbol)
+        {
+            ++length_counts[lengths[symbol]]; // NOLINT pointer arithmetic
+        }
+        length_counts[0] = 0U;
+
+        std::uint32_t code = 0U;
+        for (unsigned int length = 1U; length <= max_code_length; ++length)
+        {
+            code = (code + length_counts[length - 1U]) << 1U;
+            next_code[length] = code;
+        }
+
+        for (std::size_t symbol = 0U; symbol < count; ++symbol)
+        {
+            const unsigned int length = lengths[symbol]; // NOLINT pointer arithmetic
+            codes[symbol] = (0U != length) ? static_cast<std::uint16_t>(reverse_bits(next_code[length]++, length)) // NOLINT
+                                           : std::uint16_t { 0U };
+        }
+    }
+
+    /**
+     * @brief Hash chain, lazy matching deflate encoder of gzip_level::best, writing raw deflate blocks.
+     *
+     * Encodes input[begin, end), matches reaching up to history bytes before begin.
+     */
+    class best_deflater
+    {
+    public:
+        best_deflater(tools::gzip_chain_tables& tables, const std::uint8_t* input, std::size_t begin,
+            std::size_t end, std::size_t history, std::uint8_t* output)
+            : m_tables(tables)
+            , m_input(input)
+            , m_begin(begin)
+            , m_end(end)
+            , m_history(history)
+            , m_writer(output)
+            , m_block_start(begin)
+        {
+            m_tables.m_heads.fill(0U);
+        }
+
+        /**
+         * @brief Encodes the range.
+         *
+         * @param final_range true to set BFINAL on the last block, false to end with an empty stored block
+         * instead, leaving the output byte aligned for another deflate segment to follow.
+         * @return The end of the written output.
+         */
+        std::uint8_t* run(bool final_range)
+        {
+            // zlib level 9 like tuning, with a shorter chain
+            constexpr const std::size_t too_far = 4096U;
+
+            for (std::size_t position = m_begin - m_history; position < m_begin; ++position)
+            {
+                if ((position + min_match) <= m_end)
+                {
+                    insert(position);
+                }
+            }
+
+            std::size_t position = m_begin;
+            std::size_t previous_length = 0U;
+            std::size_t previous_distance = 0U;
+            bool literal_pending = false;
+
+            while (position < m_end)
+            {
+                std::size_t length = 0U;
+                std::size_t distance = 0U;
+                if ((position + min_match) <= m_end)
+                {
+                    insert(position);
+                    find_match(position, previous_length, length, distance);
+                    if ((min_match == length) && (distance > too_far))
+                    {
+                        length = 0U;
+                    }
+                }
+
+                // lazy evaluation: keep the match of the previous position unless this one is longer
+                if ((previous_length >= min_match) && (length <= previous_length))
+                {
+                    add_match(previous_length, previous_distance);
+                    const std::size_t match_end = position - 1U + previous_length;
+                    for (++position; position < match_end; ++position)
+                    {
+                        if ((position + min_match) <= m_end)
+                        {
+                            insert(position);
+                        }
+                    }
+                    previous_length = 0U;
+                    literal_pending = false;
+                    continue;
+                }
+
+                if (literal_pending)
+                {
+                    add_literal(position - 1U);
+                }
+                literal_pending = true;
+                previous_length = length;
+                previous_distance = distance;
+                ++position;
+            }
+
+            if (literal_pending)
+            {
+                add_literal(m_end - 1U);
+            }
+
+            flush_block(final_range);
+            if (!final_range)
+            {
+                put_sync_marker(m_writer);
+            }
+            m_writer.align();
+            return m_writer.position();
+        }
+
+    private:
+        void insert(std::size_t position)
+        {
+            auto& head = m_tables.m_heads[match_hash(m_input + position, tools::gzip_chain_hash_bits)]; // NOLINT
+            const auto current = static_cast<std::uint32_t>(position + 1U);
+            const std::uint32_t distance = (0U != head) ? (current - head) : 0U;
+            m_tables.m_previous[position & max_best_distance]
+                = static_cast<std::uint16_t>((distance <= max_best_distance) ? distance : 0U);
+            head = current;
+        }
+
+        void find_match(std::size_t position, std::size_t previous_length, std::size_t& length, std::size_t& distance)
+        {
+            constexpr const unsigned int max_chain = 256U;
+            constexpr const std::size_t good_length = 32U;
+            constexpr const std::size_t nice_length = max_match;
+
+            const std::size_t limit = std::min(max_match, m_end - position);
+            std::size_t best_length = std::max(previous_length, min_match - 1U);
+            if (best_length >= limit)
+            {
+                return;
+            }
+
+            // a good match already: look less hard for a better one
+            unsigned int chain = (previous_length >= good_length) ? (max_chain / 4U) : max_chain;
+            const std::uint8_t* current = m_input + position; // NOLINT pointer arithmetic
+            std::size_t candidate_distance = m_tables.m_previous[position & max_best_distance];
+
+            while ((0U != candidate_distance) && (candidate_distance <= max_best_distance) && (0U != chain--))
+            {
+                const std::uint8_t* candidate = current - candidate_distance; // NOLINT pointer arithmetic
+                if ((candidate[best_length] == current[best_length]) && (candidate[0] == current[0])) // NOLINT
+                {
+                    std::size_t matched = 0U;
+                    while ((matched < limit) && (candidate[matched] == current[matched])) // NOLINT pointer arithmetic
+                    {
+                        ++matched;
+                    }
+                    if (matched > best_length)
+                    {
+                        best_length = matched;
+                        length = matched;
+                        distance = candidate_distance;
+                        if ((matched >= nice_length) || (matched == limit))
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                const std::uint16_t step = m_tables.m_previous[(position - candidate_distance) & max_best_distance];
+                if (0U == step)
+                {
+                    break;
+                }
+                candidate_distance += step;
+            }
+        }
+
+        void add_literal(std::size_t position)
+        {
+            add_symbol(m_input[position]); // NOLINT pointer arithmetic
+            ++m_block_input;
+        }
+
+        void add_match(std::size_t length, std::size_t distance)
+        {
+            add_symbol(static_cast<std::uint32_t>((distance << 16U) | length)); // NOLINT symbol packing
+            m_block_input += length;
+        }
+
+        void add_symbol(std::uint32_t symbol)
+        {
+            m_tables.m_symbols[m_symbol_count++] = symbol;
+            if (tools::gzip_chain_tables::block_symbols == m_symbol_count)
+            {
+                flush_block(false);
+            }
+        }
+
+        /**
+         * @brief Emits the buffered symbols as the cheapest of a stored, fixed or dynamic Huffman block.
+         */
+        void flush_block(bool final_block) // NOLINT cognitive complexity
+        {
+            std::array<std::uint32_t, literal_length_symbols> literal_frequencies = {};
+            std::array<std::uint32_t, distance_symbols> distance_frequencies = {};
+            std::size_t extra_bits = 0U;
+
+            for (std::size_t i = 0U; i < m_symbol_count; ++i)
+            {
+                const std::uint32_t symbol = m_tables.m_symbols[i];
+                const std::uint32_t distance = symbol >> 16U;
+                if (0U == distance)
+                {
+                    ++literal_frequencies[symbol];
+                    continue;
+                }
+                const std::size_t lcode = length_code(symbol & 0xffffU);
+                const std::size_t dcode = distance_code(distance);
+                ++literal_frequencies[end_of_block + 1U + lcode];
+                ++distance_frequencies[dcode];
+                extra_bits += length_extra[lcode] + distance_extra[dcode];
+            }
+            literal_frequencies[end_of_block] = 1U;
+
+            // dynamic trees and their run-length encoded code lengths
+            std::array<std::uint8_t, literal_length_symbols + distance_symbols> lengths = {};
+            build_code_lengths(literal_frequencies.data(), literal_length_symbols, max_code_length, lengths.data());
+            build_code_lengths(distance_frequencies.data(), distance_symbols, max_code_length,
+                lengths.data() + literal_length_symbols);
+
+            std::size_t literal_count = literal_length_symbols;
+            while ((literal_count > (end_of_block + 1U)) && (0U == lengths[literal_count - 1U]))
+            {
+                --literal_count;
+            }
+            std::size_t distance_count = distance_symbols;
+            while ((distance_count > 1U) && (0U == lengths[literal_length_symbols + distance_count - 1U]))
+            {
+                --distance_count;
+            }
+            std::array<std::uint8_t, literal_length_symbols + distance_symbols> sent_lengths = {};
+            std::copy_n(lengths.begin(), literal_count, sent_lengths.begin());
+            std::copy_n(lengths.begin() + literal_length_symbols, distance_count, sent_lengths.begin() + literal_count);
+
+            std::array<std::uint16_t, literal_length_symbols + distance_symbols> runs = {}; // symbol | extra << 8
+            std::array<std::uint32_t, code_length_symbols> run_frequencies = {};
+            const std::size_t run_count = encode_runs(sent_lengths.data(), literal_count + distance_count, runs.data());
+            std::size_t run_extra_bits = 0U;
+            for (std::size_t i = 0U; i < run_count; ++i)
+            {
+                const unsigned int symbol = runs[i] & lo_byte_mask;
+                ++run_frequencies[symbol];
+                run_extra_bits += (16U == symbol) ? 2U : ((17U == symbol) ? 3U : ((18U == symbol) ? 7U : 0U));
+            }
+            std::array<std::uint8_t, code_length_symbols> run_lengths = {};
+            build_code_lengths(
+                run_frequencies.data(), code_length_symbols, max_code_length_code_length, run_lengths.data());
+            std::size_t run_lengths_sent = code_length_symbols;
+            while ((run_lengths_sent > 4U) && (0U == run_lengths[code_length_order[run_lengths_sent - 1U]]))
+            {
+                --run_lengths_sent;
+            }
+
+            // block costs in bits, headers included
+            std::array<std::uint8_t, literal_length_symbols + distance_symbols> fixed_lengths = {};
+            for (std::size_t symbol = 0U; symbol < literal_length_symbols; ++symbol)
+            {
+                fixed_lengths[symbol] = static_cast<std::uint8_t>(fixed_symbol_code(static_cast<std::uint32_t>(symbol)).second);
+            }
+            std::fill_n(fixed_lengths.begin() + literal_length_symbols, distance_symbols, std::uint8_t { 5U });
+
+            std::size_t dynamic_bits = 3U + 5U + 5U + 4U + (3U * run_lengths_sent) + run_extra_bits + extra_bits;
+            std::size_t fixed_bits = 3U + extra_bits;
+            for (std::size_t symbol = 0U; symbol < code_length_symbols; ++symbol)
+            {
+                dynamic_bits += static_cast<std::size_t>(run_frequencies[symbol]) * run_lengths[symbol];
+            }
+            for (std::size_t symbol = 0U; symbol < literal_length_symbols; ++symbol)
+            {
+                dynamic_bits += static_cast<std::size_t>(literal_frequencies[symbol]) * lengths[symbol];
+                fixed_bits += static_cast<std::size_t>(literal_frequencies[symbol]) * fixed_lengths[symbol];
+            }
+            for (std::size_t symbol = 0U; symbol < distance_symbols; ++symbol)
+            {
+                dynamic_bits += static_cast<std::size_t>(distance_frequencies[symbol])
+                    * lengths[literal_length_symbols + symbol];
+                fixed_bits += static_cast<std::size_t>(distance_frequencies[symbol]) * 5U; // NOLINT fixed distance
+            }
+            const std::size_t stored_bits = (m_block_input <= stored_block_max)
+                ? (3U + 7U + 32U + (m_block_input * byte_bits))
+                : std::numeric_limits<std::size_t>::max();
+
+            const std::uint32_t final_bit = final_block ? 1U : 0U;
+            if ((stored_bits <= fixed_bits) && (stored_bits <= dynamic_bits))
+            {
+                m_writer.put(final_bit, 3U); // BTYPE = 00
+                m_writer.align();
+                m_writer.put(static_cast<std::uint32_t>(m_block_input), 16U);                // NOLINT LEN
+                m_writer.put(static_cast<std::uint32_t>(~m_block_input & 0xffffU), 16U);    // NOLINT NLEN
+                m_writer.put_aligned_bytes(m_input + m_block_start, m_block_input); // NOLINT pointer arithmetic
+            }
+            else if (fixed_bits <= dynamic_bits)
+            {
+                m_writer.put(final_bit | (1U << 1U), 3U); // BTYPE = 01
+
+                // the fixed literal/length code spans 288 symbols: take it from the RFC table, not from
+                // canonical codes rebuilt over the 286 symbols in use, which would shift the 9-bit codes
+                std::array<std::uint16_t, literal_length_symbols + distance_symbols> fixed_codes = {};
+                for (std::size_t symbol = 0U; symbol < literal_length_symbols; ++symbol)
+                {
+                    fixed_codes[symbol]
+                        = static_cast<std::uint16_t>(fixed_symbol_code(static_cast<std::uint32_t>(symbol)).first);
+                }
+                for (std::size_t symbol = 0U; symbol < distance_symbols; ++symbol)
+                {
+                    fixed_codes[literal_length_symbols + symbol]
+                        = static_cast<std::uint16_t>(reverse_bits(static_cast<std::uint32_t>(symbol), 5U)); // NOLINT
+                }
+                put_symbols(fixed_codes.data(), fixed_lengths.data());
+            }
+            else
+            {
+                m_writer.put(final_bit | (2U << 1U), 3U); // BTYPE = 10
+                m_writer.put(static_cast<std::uint32_t>(literal_count - (end_of_block + 1U)), 5U); // NOLINT HLIT
+                m_writer.put(static_cast<std::uint32_t>(distance_count - 1U), 5U);                 // NOLINT HDIST
+                m_writer.put(static_cast<std::uint32_t>(run_lengths_sent - 4U), 4U);               // NOLINT HCLEN
+                for (std::size_t i = 0U; i < run_lengths_sent; ++i)
+                {
+                    m_writer.put(run_lengths[code_length_order[i]], 3U);
+                }
+
+                std::array<std::uint16_t, code_length_symbols> run_codes = {};
+                build_codes(run_lengths.data(), code_length_symbols, run_codes.data());
+                for (std::size_t i = 0U; i < run_count; ++i)
+                {
+                    const unsigned int symbol = runs[i] & lo_byte_mask;
+                    m_writer.put(run_codes[symbol], run_lengths[symbol]);
+                    if (symbol >= 16U)
+                    {
+                        m_writer.put(runs[i] >> byte_bits, (16U == symbol) ? 2U : ((17U == symbol) ? 3U : 7U));
+                    }
+                }
+                std::array<std::uint16_t, literal_length_symbols + distance_symbols> codes = {};
+                build_codes(lengths.data(), literal_length_symbols, codes.data());
+                build_codes(lengths.data() + literal_length_symbols, distance_symbols, // NOLINT pointer arithmetic
+                    codes.data() + literal_length_symbols);
+                put_symbols(codes.data(), lengths.data());
+            }
+
+            m_block_start += m_block_input;
+            m_block_input = 0U;
+            m_symbol_count = 0U;
+        }
+
+        /**
+         * @brief Run-length encodes code lengths with the symbols 16 to 18 (repeat counts in the high byte).
+         */
+        static std::size_t encode_runs(const std::uint8_t* lengths, std::size_t count, std::uint16_t* runs)
+        {
+            std::size_t run_count = 0U;
+            const auto emit = [&runs, &run_count](unsigned int symbol, std::size_t extra)
+            { runs[run_count++] = static_cast<std::uint16_t>(symbol | (extra << byte_bits)); }; // NOLINT
+
+            std::size_t i = 0U;
+            while (i < count)
+            {
+                const std::uint8_t value = lengths[i]; // NOLINT pointer arithmetic
+                std::size_t run = 1U;
+                while (((i + run) < count) && (lengths[i + run] == value)) // NOLINT pointer arithmetic
+                {
+                    ++run;
+                }
+                i += run;
+
+                if (0U == value)
+                {
+                    for (; run >= 11U; run -= std::min<std::size_t>(run, 138U)) // NOLINT RFC 1951 repeat ranges
+                    {
+                        emit(18U, std::min<std::size_t>(run, 138U) - 11U); // NOLINT
+                    }
+                    if (run >= 3U)
+                    {
+                        emit(17U, run - 3U); // NOLINT
+                        run = 0U;
+                    }
+                }
+                else
+                {
+                    emit(value, 0U);
+                    for (--run; run >= 3U; run -= std::min<std::size_t>(run, 6U)) // NOLINT RFC 1951 repeat range
+                    {
+                        emit(16U, std::min<std::size_t>(run, 6U) - 3U); // NOLINT
+                    }
+                }
+                for (; run > 0U; --run)
+                {
+                    emit(value, 0U);
+                }
+            }
+            return run_count;
+        }
+
+        /**
+         * @brief Emits the symbols of the block with the given bit reversed codes, then the end of block.
+         */
+        void put_symbols(const std::uint16_t* codes, const std::uint8_t* lengths)
+        {
+            for (std::size_t i = 0U; i < m_symbol_count; ++i)
+            {
+                const std::uint32_t symbol = m_tables.m_symbols[i];
+                const std::uint32_t distance = symbol >> 16U;
+                if (0U == distance)
+                {
+                    m_writer.put(codes[symbol], lengths[symbol]); // NOLINT pointer arithmetic
+                    continue;
+                }
+                const std::size_t length = symbol & 0xffffU;
+                const std::size_t lcode = length_code(length);
+                const std::size_t lsymbol = end_of_block + 1U + lcode;
+                m_writer.put(codes[lsymbol], lengths[lsymbol]); // NOLINT pointer arithmetic
+                m_writer.put(static_cast<std::uint32_t>(length - length_base[lcode]), length_extra[lcode]);
+                const std::size_t dcode = distance_code(distance);
+                const std::size_t dsymbol = literal_length_symbols + dcode;
+                m_writer.put(codes[dsymbol], lengths[dsymbol]); // NOLINT pointer arithmetic
+                m_writer.put(distance - distance_base[dcode], distance_extra[dcode]);
+            }
+            m_writer.put(codes[end_of_block], lengths[end_of_block]); // NOLINT pointer arithmetic
+        }
+
+        tools::gzip_chain_tables& m_tables;
+        const std::uint8_t* m_input;
+        std::size_t m_begin;
+        std::size_t m_end;
+        std::size_t m_history;
+        bit_writer m_writer;
+        std::size_t m_block_start;
+        std::size_t m_symbol_count = 0U;
+        std::size_t m_block_input = 0U;
+    };
+}
+
 namespace tools
 {
     bool gzip_wrapper::m_uzlib_initialized = false; // NOLINT private variable common to all wrapper instances
 
-    gzip_wrapper::gzip_wrapper()
+    gzip_stream_compressor::gzip_stream_compressor(alloc_hint table_hint)
+        : gzip_stream_compressor(nullptr, table_hint)
+    {
+    }
+
+    gzip_stream_compressor::gzip_stream_compressor(gzip_workspace* workspace, alloc_hint table_hint)
+        : m_own_positions((nullptr == workspace) ? make_hinted_unique<position_table>(table_hint) : nullptr)
+        , m_positions((nullptr != workspace) ? workspace->m_positions.data() : nullptr)
+    {
+        if (m_own_positions)
+        {
+            m_positions = m_own_positions->data();
+        }
+    }
+
+    expected<std::size_t, gzip_stream_error> gzip_stream_compressor::init(
+        std::uint8_t* output, std::size_t capacity, gzip_level level)
+    {
+        if (capacity < header_size)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::output_too_small);
+        }
+
+        put_gzip_header(output, xfl_fastest);
+
+        // positions left by another level are still validated by range and content
+        m_hash_bits = (gzip_level::fast == level) ? gzip_fast_hash_bits : gzip_hash_bits;
+        m_skip_misses = (gzip_level::fast == level);
+        m_bit_buffer = 0U;
+        m_bit_count = 0U;
+        m_crc32 = tools::crc32_initial;
+        m_position = 0U;
+        m_active = true;
+
+        // single final block with static Huffman codes (BFINAL = 1, BTYPE = 01)
+        m_output = output + header_size; // NOLINT pointer arithmetic
+        put_bits(1U, 1U);
+        put_bits(1U, 2U);
+
+        return header_size;
+    }
+
+    expected<std::size_t, gzip_stream_error> gzip_stream_compressor::update(
+        const std::uint8_t* input, std::size_t input_size, std::uint8_t* output, std::size_t capacity)
+    {
+        if (!m_active)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::not_started);
+        }
+
+        if (input_size > static_cast<std::size_t>(std::numeric_limits<unsigned int>::max()))
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::input_too_large);
+        }
+
+        if (capacity < update_bound(input_size))
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::output_too_small);
+        }
+
+        m_output = output;
+        greedy_parse(m_positions, m_hash_bits, m_skip_misses, input, 0U, input_size, 0U, m_position,
+            [this](std::uint8_t value) { put_literal(value); },
+            [this](std::size_t length, std::size_t distance) { put_match(length, distance); });
+
+        m_crc32 = tools::crc32_update(input, input_size, m_crc32);
+        m_position += static_cast<std::uint32_t>(input_size); // size modulo 2^32 as stored in the trailer
+
+        return static_cast<std::size_t>(m_output - output);
+    }
+
+    expected<std::size_t, gzip_stream_error> gzip_stream_compressor::finish(std::uint8_t* output, std::size_t capacity)
+    {
+        if (!m_active)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::not_started);
+        }
+
+        if (capacity < finish_bound)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::output_too_small);
+        }
+
+        m_output = output;
+        const auto eob = fixed_symbol_code(end_of_block);
+        put_bits(eob.first, eob.second);
+
+        // pad the last byte
+        if (0U != m_bit_count)
+        {
+            put_bits(0U, byte_bits - m_bit_count);
+        }
+
+        m_output = put_le32(m_output, ~m_crc32);
+        m_output = put_le32(m_output, m_position);
+        m_active = false;
+
+        return static_cast<std::size_t>(m_output - output);
+    }
+
+    void gzip_stream_compressor::put_bits(std::uint32_t bits, unsigned int count)
+    {
+        m_bit_buffer |= bits << m_bit_count;
+        m_bit_count += count;
+
+        while (m_bit_count >= byte_bits)
+        {
+            *m_output++ = static_cast<std::uint8_t>(m_bit_buffer & lo_byte_mask); // NOLINT pointer arithmetic
+            m_bit_buffer >>= byte_bits;
+            m_bit_count -= byte_bits;
+        }
+    }
+
+    void gzip_stream_compressor::put_literal(std::uint8_t value)
+    {
+        constexpr const std::uint8_t last_8_bits_literal = 143U;
+        put_bits(literal_codes[value], (value <= last_8_bits_literal) ? 8U : 9U); // NOLINT code lengths
+    }
+
+    void gzip_stream_compressor::put_match(std::size_t length, std::size_t distance)
+    {
+        const auto length_code = static_cast<std::size_t>(
+            std::upper_bound(length_base.begin(), length_base.end(), length) - length_base.begin() - 1);
+        const auto symbol = fixed_symbol_code(static_cast<std::uint32_t>(end_of_block + 1U + length_code));
+        put_bits(symbol.first, symbol.second);
+        put_bits(static_cast<std::uint32_t>(length - length_base[length_code]), length_extra[length_code]);
+
+        const auto distance_code = static_cast<std::size_t>(
+            std::upper_bound(distance_base.begin(), distance_base.end(), distance) - distance_base.begin() - 1);
+        put_bits(reverse_bits(static_cast<std::uint32_t>(distance_code), 5U), 5U); // NOLINT 5 bits distance codes
+        put_bits(static_cast<std::uint32_t>(distance - distance_base[distance_code]), distance_extra[distance_code]);
+    }
+
+    gzip_stream_decoder::gzip_stream_decoder(std::size_t window_size, alloc_hint window_hint)
+        : m_window_size(window_size)
+        , m_window(make_hinted_unique<std::uint8_t[]>(window_size, window_hint)) // NOLINT fixed size dictionary ring
+    {
+        reset();
+    }
+
+    void gzip_stream_decoder::reset()
+    {
+        m_input_begin = 0U;
+        m_input_end = 0U;
+        m_input_ended = false;
+        m_stage = stage::header;
+        m_flags = 0U;
+        m_extra_remaining = 0U;
+        m_crc32 = tools::crc32_initial;
+        m_size = 0U;
+        // uzlib does not track the filled part of the ring: never leak a previous stream through bad offsets
+        std::memset(m_window.get(), 0, m_window_size);
+        m_inflate = {};
+        uzlib_uncompress_init(&m_inflate, m_window.get(), static_cast<unsigned int>(m_window_size));
+    }
+
+    std::size_t gzip_stream_decoder::push(const std::uint8_t* input, std::size_t input_size)
+    {
+        if ((stage::done == m_stage) || (stage::failed == m_stage))
+        {
+            return input_size;
+        }
+
+        if ((0U != m_input_begin) && ((input_buffer_size - m_input_end) < input_size))
+        {
+            // compact the staged bytes at the front of the buffer
+            std::memmove(m_input.data(), m_input.data() + m_input_begin, staged()); // NOLINT pointer arithmetic
+            m_input_end -= m_input_begin;
+            m_input_begin = 0U;
+        }
+
+        const std::size_t accepted = std::min(input_size, input_buffer_size - m_input_end);
+        if (0U != accepted)
+        {
+            std::memcpy(m_input.data() + m_input_end, input, accepted); // NOLINT pointer arithmetic
+            m_input_end += accepted;
+        }
+
+        return accepted;
+    }
+
+    expected<std::size_t, gzip_stream_error> gzip_stream_decoder::pull(std::uint8_t* output, std::size_t capacity)
+    {
+        std::size_t produced = 0U;
+        bool progress = true;
+
+        while (progress && (produced < capacity))
+        {
+            switch (m_stage)
+            {
+                case stage::failed:
+                    return unexpected<gzip_stream_error>(m_error);
+
+                case stage::done:
+                    progress = false;
+                    break;
+
+                case stage::body:
+                {
+                    const auto inflated = inflate(output + produced, capacity - produced); // NOLINT arithmetic
+                    if (!inflated.has_value())
+                    {
+                        return inflated;
+                    }
+                    produced += inflated.value();
+                    progress = (0U != inflated.value()) || (stage::body != m_stage);
+                    break;
+                }
+
+                case stage::trailer:
+                    progress = check_trailer();
+                    break;
+
+                default:
+                    progress = parse_header();
+                    break;
+            }
+        }
+
+        if (stage::failed == m_stage)
+        {
+            return unexpected<gzip_stream_error>(m_error);
+        }
+
+        return produced;
+    }
+
+    bool gzip_stream_decoder::parse_header()
+    {
+        constexpr const std::size_t fixed_header_size = 10U;
+        constexpr const std::uint8_t reserved_flags = 0xe0U;
+        const std::uint8_t* data = m_input.data() + m_input_begin; // NOLINT pointer arithmetic
+
+        switch (m_stage)
+        {
+            case stage::header:
+                if (staged() < fixed_header_size)
+                {
+                    return false;
+                }
+                // magic tag, deflate method and flags without reserved bits
+                if ((0x1fU != data[0]) || (0x8bU != data[1]) || (0x08U != data[2]) // NOLINT magic tag
+                    || (0U != (data[3] & reserved_flags)))                          // NOLINT flags
+                {
+                    static_cast<void>(fail(gzip_stream_error::data_error));
+                    return false;
+                }
+                m_flags = data[3];
+                m_input_begin += fixed_header_size;
+                next_header_field();
+                return true;
+
+            case stage::extra_length:
+                if (staged() < 2U)
+                {
+                    return false;
+                }
+                m_extra_remaining = static_cast<std::size_t>(data[0]) | (static_cast<std::size_t>(data[1]) << 8U);
+                m_input_begin += 2U;
+                m_stage = stage::extra;
+                return true;
+
+            case stage::extra:
+            {
+                const std::size_t skipped = std::min(m_extra_remaining, staged());
+                m_input_begin += skipped;
+                m_extra_remaining -= skipped;
+                if (0U == m_extra_remaining)
+                {
+                    next_header_field();
+                }
+                return 0U != skipped;
+            }
+
+            case stage::name:
+            case stage::comment:
+            {
+                const auto* terminator = static_cast<const std::uint8_t*>(std::memchr(data, 0, staged()));
+                if (nullptr == terminator)
+                {
+                    m_input_begin = m_input_end;
+                    return false;
+                }
+                m_input_begin += static_cast<std::size_t>(terminator - data) + 1U;
+                next_header_field();
+                return true;
+            }
+
+            case stage::header_crc:
+                if (staged() < 2U)
+                {
+                    return false;
+                }
+                m_input_begin += 2U;
+                next_header_field();
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    void gzip_stream_decoder::next_header_field()
+    {
+        constexpr const std::uint8_t flag_hcrc = 0x02U;
+        constexpr const std::uint8_t flag_extra = 0x04U;
+        constexpr const std::uint8_t flag_name = 0x08U;
+        constexpr const std::uint8_t flag_comment = 0x10U;
+
+        // optional fields in the order of RFC 1952, each one cleared once consumed
+        if (0U != (m_flags & flag_extra))
+        {
+            m_flags &= static_cast<std::uint8_t>(~flag_extra);
+            m_stage = stage::extra_length;
+        }
+        else if (0U != (m_flags & flag_name))
+        {
+            m_flags &= static_cast<std::uint8_t>(~flag_name);
+            m_stage = stage::name;
+        }
+        else if (0U != (m_flags & flag_comment))
+        {
+            m_flags &= static_cast<std::uint8_t>(~flag_comment);
+            m_stage = stage::comment;
+        }
+        else if (0U != (m_flags & flag_hcrc))
+        {
+            m_flags &= static_cast<std::uint8_t>(~flag_hcrc);
+            m_stage = stage::header_crc;
+        }
+        else
+        {
+            m_stage = stage::body;
+        }
+    }
+
+    expected<std::size_t, gzip_stream_error> gzip_stream_decoder::inflate(std::uint8_t* output, std::size_t capacity)
+    {
+        // longest deflate symbol: 15 bits length code + 5 extra bits + 15 bits distance code + 13 extra bits
+        constexpr const std::size_t max_symbol_size = 6U;
+        std::size_t step = capacity;
+
+        if (!m_input_ended)
+        {
+            if (staged() < (lookahead + max_symbol_size))
+            {
+                return 0U;
+            }
+            // every symbol of the step produces at least one byte
+            step = std::min(step, (staged() - lookahead) / max_symbol_size);
+        }
+
+        m_inflate.source = m_input.data() + m_input_begin; // NOLINT pointer arithmetic
+        m_inflate.source_limit = m_input.data() + m_input_end; // NOLINT pointer arithmetic
+        m_inflate.source_read_cb = nullptr;
+        m_inflate.dest_start = output;
+        m_inflate.dest = output;
+        m_inflate.dest_limit = output + step; // NOLINT pointer arithmetic
+
+        const int res = uzlib_uncompress(&m_inflate);
+
+        const auto produced = static_cast<std::size_t>(m_inflate.dest - output);
+        m_input_begin = static_cast<std::size_t>(m_inflate.source - m_input.data());
+        m_crc32 = tools::crc32_update(output, produced, m_crc32);
+        m_size += static_cast<std::uint32_t>(produced);
+
+        if (m_inflate.eof)
+        {
+            return fail(m_input_ended ? gzip_stream_error::truncated : gzip_stream_error::data_error);
+        }
+
+        if (TINF_DICT_ERROR == res)
+        {
+            return fail(gzip_stream_error::window_too_small);
+        }
+
+        if (res < 0)
+        {
+            return fail(gzip_stream_error::data_error);
+        }
+
+        if (TINF_DONE == res)
+        {
+            // the trailer starts on the next byte boundary, where uzlib left the source
+            m_stage = stage::trailer;
+        }
+
+        return produced;
+    }
+
+    bool gzip_stream_decoder::check_trailer()
+    {
+        constexpr const std::size_t trailer_size = 8U;
+
+        if (staged() < trailer_size)
+        {
+            if (m_input_ended)
+            {
+                static_cast<void>(fail(gzip_stream_error::truncated));
+            }
+            return false;
+        }
+
+        const std::uint8_t* data = m_input.data() + m_input_begin; // NOLINT pointer arithmetic
+        std::uint32_t source_crc32 = 0U;
+        std::uint32_t source_size = 0U;
+        for (unsigned int i = 0U; i < 4U; ++i)
+        {
+            source_crc32 |= static_cast<std::uint32_t>(data[i]) << (i * byte_bits);       // NOLINT little endian
+            source_size |= static_cast<std::uint32_t>(data[i + 4U]) << (i * byte_bits); // NOLINT little endian
+        }
+        m_input_begin += trailer_size;
+
+        if (~m_crc32 != source_crc32)
+        {
+            static_cast<void>(fail(gzip_stream_error::checksum_error));
+        }
+        else if (m_size != source_size)
+        {
+            static_cast<void>(fail(gzip_stream_error::length_error));
+        }
+        else
+        {
+            m_stage = stage::done;
+        }
+
+        return false;
+    }
+
+    unexpected<gzip_stream_error> gzip_stream_decoder::fail(gzip_stream_error error)
+    {
+        m_error = error;
+        m_stage = stage::failed;
+        return unexpected<gzip_stream_error>(error);
+    }
+
+    gzip_wrapper::gzip_wrapper(alloc_hint table_hint)
+        : gzip_wrapper(pooled_ptr<gzip_workspace>(), table_hint)
+    {
+    }
+
+    gzip_wrapper::gzip_wrapper(pooled_ptr<gzip_workspace> workspace, alloc_hint table_hint)
+        : m_table_hint(table_hint)
+        , m_workspace(std::move(workspace))
+        , m_compressor(m_workspace.get(), table_hint)
     {
         if (!m_uzlib_initialized)
         {
             uzlib_init();
             m_uzlib_initialized = true;
         }
+    }
 
-        m_hash_table = std::make_unique<hash_table>();
+    gzip_wrapper::~gzip_wrapper() = default;
 
-        if (nullptr == m_hash_table)
+    std::vector<std::uint8_t> gzip_wrapper::pack(const std::vector<std::uint8_t>& unpacked_input, gzip_level level)
+    {
+        auto gzip_packed = pack_result(unpacked_input, level);
+        if (!gzip_packed.has_value())
         {
-            LOG_ERROR("could not allocate hash_table");
+            LOG_ERROR("input too large for gzip pack: %u", static_cast<unsigned int>(unpacked_input.size()));
+            return {};
         }
+        return std::move(gzip_packed.value());
     }
 
-    std::vector<std::uint8_t> gzip_wrapper::pack(const std::vector<std::uint8_t>& unpacked_input)
+    expected<std::vector<std::uint8_t>, gzip_stream_error> gzip_wrapper::pack_result(
+        const std::vector<std::uint8_t>& unpacked_input, gzip_level level)
     {
+        if (gzip_level::best == level)
+        {
+            if (!m_chain_tables)
+            {
+                m_chain_tables = make_hinted_unique<gzip_chain_tables>(m_table_hint);
+            }
+            if (m_chain_tables)
+            {
+                return pack_best(unpacked_input);
+            }
+            LOG_WARNING("no memory for gzip hash chains, packing at balanced level");
+        }
+
         std::vector<std::uint8_t> gzip_packed;
 
-        if ((nullptr != m_hash_table) && !unpacked_input.empty())
-        {
-            if (unpacked_input.size() > static_cast<std::size_t>(std::numeric_limits<unsigned int>::max()))
-            {
-                LOG_ERROR("input too large for uzlib pack API: %u", static_cast<unsigned int>(unpacked_input.size()));
-                return gzip_packed;
-            }
-
-            struct uzlib_comp comp = {};
-            comp.dict_size = gzip_dict_size;
-            comp.hash_bits = gzip_hash_bits;
-            comp.hash_table = m_hash_table->data();
-            std::memset(reinterpret_cast<void*>(comp.hash_table), 0, gzip_hash_size);
-
-            zlib_start_block(&comp.out);
-            const auto input_size = static_cast<unsigned int>(unpacked_input.size());
-            uzlib_compress(&comp, unpacked_input.data(), input_size);
-            zlib_finish_block(&comp.out);
-
-            std::uint32_t crc32 = ~uzlib_crc32(unpacked_input.data(), input_size, ~0);
-
-            // create other buffer with gzip header + footer
-            const std::size_t packed_size = comp.out.outlen;
-            const std::size_t gzip_buffer_sz = packed_size + 10U + 8U;
-            constexpr const std::size_t gzip_header_sz = 10U;
-
-            gzip_packed.resize(gzip_buffer_sz);
-
-            gzip_packed.at(0) = 0x1f; // NOLINT magic tag
-            gzip_packed.at(1) = 0x8b; // NOLINT magic tag
-            gzip_packed.at(2) = 0x08; // NOLINT magic tag
-            gzip_packed.at(3) = 0x00; // NOLINT magic tag
-            gzip_packed.at(4) = 0x00; // NOLINT time
-            gzip_packed.at(5) = 0x00; // NOLINT time
-            gzip_packed.at(6) = 0x00; // NOLINT time
-            gzip_packed.at(7) = 0x00; // NOLINT time
-            gzip_packed.at(8) = 0x04; // NOLINT XFL
-            gzip_packed.at(9) = 0x03; // NOLINT OS
-
-            std::memcpy(gzip_packed.data() + gzip_header_sz, comp.out.outbuf, packed_size);
-            // free packed buffer
-            std::free(comp.out.outbuf); // NOLINT allocated by malloc in uzib lib
-
-            constexpr const std::uint32_t lo_byte_mask = 0xff;
-
-            // little endian CRC32
-            gzip_packed.at(gzip_header_sz + packed_size + 0U) // NOLINT gzip footer little endian transformation
-                = crc32 & lo_byte_mask;                       // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 1U) // NOLINT gzip footer little endian transformation
-                = (crc32 >> 8) & lo_byte_mask;                // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 2U) // NOLINT gzip footer little endian transformation
-                = (crc32 >> 16) & lo_byte_mask;               // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 3U) // NOLINT gzip footer little endian transformation
-                = (crc32 >> 24) & lo_byte_mask;               // NOLINT little endian transformation
-
-            // little endian source length
-            gzip_packed.at(gzip_header_sz + packed_size + 4U)   // NOLINT gzip footer little endian transformation
-                = unpacked_input.size() & lo_byte_mask;         // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 5U)   // NOLINT gzip footer little endian transformation
-                = (unpacked_input.size() >> 8) & lo_byte_mask;  // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 6U)   // NOLINT gzip footer little endian transformation
-                = (unpacked_input.size() >> 16) & lo_byte_mask; // NOLINT little endian transformation
-            gzip_packed.at(gzip_header_sz + packed_size + 7U)   // NOLINT gzip footer little endian transformation
-                = (unpacked_input.size() >> 24) & lo_byte_mask; // NOLINT little endian transformation
-
-        } // (nullptr != m_hash_table)
+        if (!unpacked_input.empty())
+        {
+            // small inputs go through the workspace scratch, so that the result is allocated at its exact size
+            const std::size_t bound = gzip_stream_compressor::compress_bound(unpacked_input.size());
+            const bool use_scratch = m_workspace && (bound <= gzip_workspace::scratch_size);
+            if (!use_scratch)
+            {
+                gzip_packed.resize(bound);
+            }
+            std::uint8_t* output = use_scratch ? m_workspace->m_scratch.data() : gzip_packed.data();
+            const std::size_t capacity = use_scratch ? m_workspace->m_scratch.size() : gzip_packed.size();
+
+            std::size_t packed_size = m_compressor.init(output, capacity, level).value_or(0U);
+            const auto body = m_compressor.update(unpacked_input.data(), unpacked_input.size(),
+                output + packed_size, capacity - packed_size); // NOLINT pointer arithmetic
+
+            if (!body.has_value())
+            {
+                return unexpected<gzip_stream_error>(body.error());
+            }
+
+            packed_size += body.value();
+            packed_size += m_compressor.finish(output + packed_size, capacity - packed_size) // NOLINT arithmetic
+                               .value_or(0U);
+            if (use_scratch)
+            {
+                gzip_packed.assign(output, output + packed_size); // NOLINT pointer arithmetic
+            }
+            else
+            {
+                gzip_packed.resize(packed_size);
+            }
+        }
 
         return gzip_packed;
     }
 
-
-    std::vector<std::uint8_t>
-    gzip_wrapper::unpack( // NOLINT doesn't use the hash table but keep pack/unpack IF symmetric
-        const std::vector<std::uint8_t>& packed_input) // NOLINT cognitive complexity
+    expected<std::vector<std::uint8_t>, gzip_stream_error> gzip_wrapper::pack_best(
+        const std::vector<std::uint8_t>& unpacked_input)
     {
-        std::vector<std::uint8_t> gzip_unpacked;
+        std::vector<std::uint8_t> gzip_packed;
 
-        // The smallest file that can be compressed by gzip is 24 bytes of zeros down to 23 bytes.
-        constexpr const std::size_t minimal_gzip_packed_size = 23U;
+        if (unpacked_input.empty())
+        {
+            return gzip_packed;
+        }
+
+        if (unpacked_input.size() >= static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()))
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::input_too_large);
+        }
 
-        if (packed_input.size() >= minimal_gzip_packed_size)
+        // every block is at worst stored: 5 bytes of header each on top of the static Huffman bound
+        constexpr const std::size_t stored_header_size = 5U;
+        const std::size_t blocks = (unpacked_input.size() / gzip_chain_tables::block_symbols) + 1U;
+        const std::size_t bound
+            = gzip_stream_compressor::compress_bound(unpacked_input.size()) + (blocks * stored_header_size);
+        const bool use_scratch = m_workspace && (bound <= gzip_workspace::scratch_size);
+        if (!use_scratch)
         {
-            // an empty gzip file has a size of 21 bytes plus the length of the file's name without extension.
-            // Edit: According to the file format specification, the last four bytes in the file contain the size of
-            // the original data modulo 2^32
+            gzip_packed.resize(bound);
+        }
 
-            const auto len = static_cast<unsigned int>(packed_input.size());
-            unsigned int dlen = packed_input.at(len - 1U);  // NOLINT little endian transformation
-            dlen = (dlen << 8) | packed_input.at(len - 2U); // NOLINT little endian transformation
-            dlen = (dlen << 8) | packed_input.at(len - 3U); // NOLINT little endian transformation
-            dlen = (dlen << 8) | packed_input.at(len - 4U); // NOLINT little endian transformation
-            const auto outlen = static_cast<std::size_t>(dlen);
-            ++dlen; // reserve one extra byte
+        std::uint8_t* const start = use_scratch ? m_workspace->m_scratch.data() : gzip_packed.data();
+        std::uint8_t* output = start;
+        put_gzip_header(output, xfl_best);
+        output = best_deflater(*m_chain_tables, unpacked_input.data(), 0U, unpacked_input.size(), 0U,
+            output + gzip_stream_compressor::header_size) // NOLINT pointer arithmetic
+                     .run(true);
+        output = put_le32(output, ~tools::crc32_update(unpacked_input.data(), unpacked_input.size(), crc32_initial));
+        output = put_le32(output, static_cast<std::uint32_t>(unpacked_input.size()));
 
-            std::uint32_t source_crc32 = packed_input.at(len - 5U);         // NOLINT little endian transformation
-            source_crc32 = (source_crc32 << 8) | packed_input.at(len - 6U); // NOLINT little endian transformation
-            source_crc32 = (source_crc32 << 8) | packed_input.at(len - 7U); // NOLINT little endian transformation
-            source_crc32 = (source_crc32 << 8) | packed_input.at(len - 8U); // NOLINT little endian transformation
+        if (use_scratch)
+        {
+            gzip_packed.assign(start, output);
+        }
+        else
+        {
+            gzip_packed.resize(static_cast<std::size_t>(output - start));
+        }
+        return gzip_packed;
+    }
 
-            gzip_unpacked.resize(dlen);
+    std::vector<std::uint8_t> gzip_wrapper::deflate_range(const std::uint8_t* data, std::size_t begin,
+        std::size_t end, std::size_t history, bool final_range, gzip_level level, gzip_chain_tables* chain_tables,
+        std::uint32_t* positions) const
+    {
+        const std::size_t size = end - begin;
+        constexpr const std::size_t stored_header_size = 5U;
+        const std::size_t bound = gzip_stream_compressor::update_bound(size)
+            + (stored_header_size * ((size / gzip_chain_tables::block_symbols) + 2U)) + byte_bits;
 
-            struct uzlib_uncomp depack_ctxt = {};
-            uzlib_uncompress_init(&depack_ctxt, nullptr, 0);
+        std::vector<std::uint8_t> deflated(bound);
+        std::uint8_t* output = deflated.data();
 
-            depack_ctxt.source
-                = reinterpret_cast<const unsigned char*>(packed_input.data()); // NOLINT std::uint8_t* to unsigned char*
-            depack_ctxt.source_limit = reinterpret_cast<const unsigned char*>( // NOLINT std::uint8_t* to unsigned char*
-                packed_input.data() + len - 4U); // NOLINT space for length and uint8_t* to uchar*
-            depack_ctxt.source_read_cb = nullptr;
+        if (gzip_level::best == level)
+        {
+            // own hash chains unless given: the ranges of pack_parallel() are deflated concurrently
+            hinted_unique_ptr<gzip_chain_tables> own_tables;
+            if (nullptr == chain_tables)
+            {
+                own_tables = make_hinted_unique<gzip_chain_tables>(m_table_hint);
+                chain_tables = own_tables.get();
+            }
+            if (nullptr != chain_tables)
+            {
+                output = best_deflater(*chain_tables, data, begin, end, history, output).run(final_range);
+                deflated.resize(static_cast<std::size_t>(output - deflated.data()));
+                return deflated;
+            }
+            level = gzip_level::balanced;
+        }
+
+        bit_writer writer(output);
+        const unsigned int hash_bits = (gzip_level::fast == level) ? gzip_fast_hash_bits : gzip_hash_bits;
+        // own hash table unless given, stale entries of a given one being rejected by range and content
+        hinted_unique_ptr<std::array<std::uint32_t, gzip_hash_nb_entries>> own_positions;
+        if (nullptr == positions)
+        {
+            own_positions = make_hinted_unique<std::array<std::uint32_t, gzip_hash_nb_entries>>(m_table_hint);
+            positions = own_positions ? own_positions->data() : nullptr;
+        }
+        if (nullptr == positions)
+        {
+            put_stored(writer, data + begin, size, final_range); // NOLINT pointer arithmetic
+        }
+        else
+        {
+            // the dictionary: positions of the history, to be matched from the first bytes of the range
+            for (std::size_t position = begin - history; (position < begin) && ((position + min_match) <= end);
+                 ++position)
+            {
+                positions[match_hash(data + position, hash_bits)] = static_cast<std::uint32_t>(position); // NOLINT
+            }
 
-            int res = uzlib_gzip_parse_header(&depack_ctxt);
-            if (TINF_OK != res)
+            writer.put((final_range ? 1U : 0U) | (1U << 1U), 3U); // BTYPE = 01
+            greedy_parse(positions, hash_bits, (gzip_level::fast == level), data, begin, end, history, 0U,
+                [&writer](std::uint8_t value) { put_fixed_literal(writer, value); },
+                [&writer](std::size_t length, std::size_t distance) { put_fixed_match(writer, length, distance); });
+            const auto eob = fixed_symbol_code(end_of_block);
+            writer.put(eob.first, eob.second);
+            if (!final_range)
             {
-                LOG_ERROR("error parsing header: %d", res);
-                gzip_unpacked.clear();
-                return gzip_unpacked;
+                put_sync_marker(writer);
             }
+            writer.align();
+        }
+
+        deflated.resize(static_cast<std::size_t>(writer.position() - deflated.data()));
+        return deflated;
+    }
+
+    std::vector<std::uint8_t> gzip_wrapper::join_segments(const std::vector<gzip_segment>& segments, gzip_level level)
+    {
+        std::size_t packed_size = gzip_stream_compressor::header_size + (2U * sizeof(std::uint32_t));
+        for (const auto& segment : segments)
+        {
+            packed_size += segment.m_data.size();
+        }
+
+        std::vector<std::uint8_t> gzip_packed(packed_size);
+        std::uint8_t* output = gzip_packed.data();
+        put_gzip_header(output, (gzip_level::best == level) ? xfl_best : xfl_fastest);
+        output += gzip_stream_compressor::header_size; // NOLINT pointer arithmetic
+
+        std::uint32_t crc32 = 0U;
+        std::size_t size = 0U;
+        for (const auto& segment : segments)
+        {
+            std::memcpy(output, segment.m_data.data(), segment.m_data.size());
+            output += segment.m_data.size(); // NOLINT pointer arithmetic
+            crc32 = (0U == size) ? segment.m_crc32 : crc32_combine(crc32, segment.m_crc32, segment.m_size);
+            size += segment.m_size;
+        }
+
+        output = put_le32(output, crc32);
+        put_le32(output, static_cast<std::uint32_t>(size));
+        return gzip_packed;
+    }
+
+    std::vector<std::uint8_t> gzip_wrapper::pack_with_dictionary(const std::vector<std::uint8_t>& unpacked_input,
+        const std::vector<std::uint8_t>& dictionary, deflate_framing framing, gzip_level level)
+    {
+        std::vector<std::uint8_t> packed;
+
+        if (unpacked_input.empty()
+            || (unpacked_input.size() >= static_cast<std::size_t>(gzip_max_pack_size - gzip_dict_size)))
+        {
+            return packed;
+        }
+
+        // the dictionary tail and the message in one buffer: matches reach back into the dictionary
+        const std::size_t history = std::min<std::size_t>(dictionary.size(), gzip_dict_size);
+        std::vector<std::uint8_t> window;
+        window.reserve(history + unpacked_input.size());
+        window.insert(window.end(), dictionary.end() - static_cast<std::ptrdiff_t>(history), dictionary.end());
+        window.insert(window.end(), unpacked_input.begin(), unpacked_input.end());
+
+        if ((gzip_level::best == level) && !m_chain_tables)
+        {
+            m_chain_tables = make_hinted_unique<gzip_chain_tables>(m_table_hint);
+        }
+        const auto deflated = deflate_range(window.data(), history, window.size(), history, true, level,
+            m_chain_tables.get(), m_workspace ? m_workspace->m_positions.data() : nullptr);
+
+        if (deflate_framing::raw == framing)
+        {
+            return deflated;
+        }
+
+        const bool has_dictionary = !dictionary.empty();
+        packed.resize(zlib_header_size + (has_dictionary ? sizeof(std::uint32_t) : 0U) + deflated.size()
+            + sizeof(std::uint32_t));
+
+        // FLEVEL: 0 fastest, 1 fast, 3 maximum compression
+        constexpr const unsigned int flevel_shift = 6U;
+        const std::array<std::uint8_t, 3U> flevels = { 0U, 1U, 3U };
+        auto flags = static_cast<std::uint8_t>((flevels[static_cast<std::size_t>(level)] << flevel_shift)
+            | (has_dictionary ? zlib_fdict : 0U));
+        const unsigned int remainder = ((static_cast<unsigned int>(zlib_deflate_32k) << byte_bits) | flags)
+            % zlib_check_modulo;
+        flags = static_cast<std::uint8_t>(flags + ((zlib_check_modulo - remainder) % zlib_check_modulo));
+
+        std::uint8_t* output = packed.data();
+        *output++ = zlib_deflate_32k; // NOLINT pointer arithmetic
+        *output++ = flags;            // NOLINT pointer arithmetic
+        if (has_dictionary)
+        {
+            output = put_be32(output, adler32_update(dictionary.data(), dictionary.size(), adler32_initial));
+        }
+        std::memcpy(output, deflated.data(), deflated.size());
+        output += deflated.size(); // NOLINT pointer arithmetic
+        put_be32(output, adler32_update(unpacked_input.data(), unpacked_input.size(), adler32_initial));
+
+        return packed;
+    }
+
+    std::vector<std::uint8_t> gzip_wrapper::unpack_with_dictionary( // NOLINT keep pack/unpack IF symmetric
+        const std::vector<std::uint8_t>& packed_input, const std::vector<std::uint8_t>& dictionary,
+        deflate_framing framing, std::size_t max_unpacked_size)
+    {
+        std::vector<std::uint8_t> unpacked;
+
+        const std::uint8_t* source = packed_input.data();
+        const std::uint8_t* source_end = packed_input.data() + packed_input.size(); // NOLINT pointer arithmetic
+        std::size_t history = std::min<std::size_t>(dictionary.size(), gzip_dict_size);
 
-            depack_ctxt.dest = gzip_unpacked.data();
-            depack_ctxt.dest_start = gzip_unpacked.data();
+        if (deflate_framing::zlib == framing)
+        {
+            if (packed_input.size() < (zlib_header_size + sizeof(std::uint32_t) + 1U))
+            {
+                LOG_ERROR("zlib stream too short: %zu", packed_input.size());
+                return unpacked;
+            }
 
-            // produce decompressed output in chunks of this size
-            // default is to decompress byte by byte; can be any other length
-            constexpr const unsigned int out_chunk_size = 1U;
+            const unsigned int header = (static_cast<unsigned int>(source[0]) << byte_bits) | source[1]; // NOLINT
+            if ((zlib_deflate_32k < source[0]) || (0x08U != (source[0] & 0x0fU)) // NOLINT deflate method
+                || (0U != (header % zlib_check_modulo)))
+            {
+                LOG_ERROR("error parsing zlib header");
+                return unpacked;
+            }
+            source += zlib_header_size; // NOLINT pointer arithmetic
 
-            while (dlen > 0U)
+            if (0U != (source[-1] & zlib_fdict)) // NOLINT pointer arithmetic
             {
-                unsigned int chunk_len = (dlen < out_chunk_size) ? dlen : out_chunk_size;
-                depack_ctxt.dest_limit = depack_ctxt.dest + chunk_len;
-                res = uzlib_uncompress_chksum(&depack_ctxt);
-                dlen -= chunk_len;
-                if (res != TINF_OK)
+                if ((source_end - source) < static_cast<std::ptrdiff_t>(2U * sizeof(std::uint32_t))
+                    || (get_be32(source) != adler32_update(dictionary.data(), dictionary.size(), adler32_initial)))
                 {
-                    break;
+                    LOG_ERROR("zlib stream of another dictionary");
+                    return unpacked;
                 }
+                source += sizeof(std::uint32_t); // NOLINT pointer arithmetic
             }
-
-            if (TINF_DONE != res)
+            else
             {
-                LOG_ERROR("error during decompression: %d", res);
-                gzip_unpacked.clear();
-                return gzip_unpacked;
+                history = 0U;
             }
+            source_end -= sizeof(std::uint32_t); // NOLINT pointer arithmetic
+        }
+
+        // the size is not stored: start from a few times the packed size and grow on overflow
+        constexpr const std::size_t initial_expansion = 4U;
+        constexpr const std::size_t minimal_capacity = 256U;
+        std::size_t capacity = std::min(
+            std::max(packed_input.size() * initial_expansion, minimal_capacity), max_unpacked_size);
+        std::vector<std::uint8_t> window;
+        auto trees = std::make_unique<UZLIB_FAST_TREES>();
+        struct uzlib_uncomp depack_ctxt = {};
+
+        for (;;)
+        {
+            window.resize(history + capacity);
+            std::copy(dictionary.end() - static_cast<std::ptrdiff_t>(history), dictionary.end(), window.begin());
 
-            const std::size_t depacked_sz = depack_ctxt.dest
-                - reinterpret_cast<unsigned char*>(gzip_unpacked.data()); // NOLINT std::uint8_t* to unsigned char*
+            depack_ctxt = {};
+            uzlib_uncompress_init(&depack_ctxt, nullptr, 0);
+            depack_ctxt.source = source;
+            depack_ctxt.source_limit = source_end;
+            depack_ctxt.source_read_cb = nullptr;
+            depack_ctxt.dest_start = window.data();
+            depack_ctxt.dest = window.data() + history; // NOLINT pointer arithmetic
+            depack_ctxt.dest_limit = window.data() + window.size(); // NOLINT pointer arithmetic
 
-            if (depacked_sz != outlen)
+            const int res = uzlib_uncompress_fast(&depack_ctxt, trees.get());
+            if (TINF_DONE == res)
+            {
+                break;
+            }
+            if (capacity >= max_unpacked_size)
             {
-                LOG_ERROR("invalid decompressed length: %zu vs %zu", depacked_sz, outlen);
-                gzip_unpacked.clear();
-                return gzip_unpacked;
+                LOG_ERROR("error during decompression: %d", res);
+                return unpacked;
             }
+            capacity = std::min(capacity * 2U, max_unpacked_size);
+        }
+
+        if (depack_ctxt.source != source_end)
+        {
+            LOG_ERROR("trailing data after the deflate stream");
+            return unpacked;
+        }
+
+        unpacked.assign(window.begin() + static_cast<std::ptrdiff_t>(history),
+            window.begin() + (depack_ctxt.dest - window.data()));
+
+        if ((deflate_framing::zlib == framing)
+            && (get_be32(source_end) != adler32_update(unpacked.data(), unpacked.size(), adler32_initial)))
+        {
+            LOG_ERROR("invalid decompressed adler32");
+            unpacked.clear();
+        }
 
-            std::uint32_t check_crc32 = ~uzlib_crc32(gzip_unpacked.data(), static_cast<unsigned int>(depacked_sz), ~0);
+        return unpacked;
+    }
 
-            if (check_crc32 != source_crc32)
+    std::vector<std::uint8_t>
+    gzip_wrapper::unpack( // NOLINT doesn't use the hash table but keep pack/unpack IF symmetric
+        const std::vector<std::uint8_t>& packed_input)
+    {
+        auto gzip_unpacked = unpack_result(packed_input);
+        if (!gzip_unpacked.has_value())
+        {
+            // too short inputs are silently unpacked as nothing
+            if (gzip_stream_error::truncated != gzip_unpacked.error())
             {
-                LOG_ERROR("invalid decompressed crc32");
-                gzip_unpacked.clear();
-                return gzip_unpacked;
+                LOG_ERROR("gzip unpack failed: %u", static_cast<unsigned int>(gzip_unpacked.error()));
             }
+            return {};
+        }
+        return std::move(gzip_unpacked.value());
+    }
+
+    expected<std::vector<std::uint8_t>, gzip_stream_error> gzip_wrapper::unpack_result( // NOLINT doesn't use the hash table
+        const std::vector<std::uint8_t>& packed_input) // NOLINT cognitive complexity
+    {
+        std::vector<std::uint8_t> gzip_unpacked;
+
+        // The smallest file that can be compressed by gzip is 24 bytes of zeros down to 23 bytes.
+        constexpr const std::size_t minimal_gzip_packed_size = 23U;
+
+        if (packed_input.size() < minimal_gzip_packed_size)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::truncated);
+        }
+
+        // an empty gzip file has a size of 21 bytes plus the length of the file's name without extension.
+        // Edit: According to the file format specification, the last four bytes in the file contain the size of
+        // the original data modulo 2^32
+
+        const auto len = static_cast<unsigned int>(packed_input.size());
+        unsigned int dlen = packed_input.at(len - 1U);  // NOLINT little endian transformation
+        dlen = (dlen << 8) | packed_input.at(len - 2U); // NOLINT little endian transformation
+        dlen = (dlen << 8) | packed_input.at(len - 3U); // NOLINT little endian transformation
+        dlen = (dlen << 8) | packed_input.at(len - 4U); // NOLINT little endian transformation
+        const auto outlen = static_cast<std::size_t>(dlen);
+        ++dlen; // reserve one extra byte
+
+        std::uint32_t source_crc32 = packed_input.at(len - 5U);         // NOLINT little endian transformation
+        source_crc32 = (source_crc32 << 8) | packed_input.at(len - 6U); // NOLINT little endian transformation
+        source_crc32 = (source_crc32 << 8) | packed_input.at(len - 7U); // NOLINT little endian transformation
+        source_crc32 = (source_crc32 << 8) | packed_input.at(len - 8U); // NOLINT little endian transformation
+
+        gzip_unpacked.resize(dlen);
+
+        struct uzlib_uncomp depack_ctxt = {};
+        uzlib_uncompress_init(&depack_ctxt, nullptr, 0);
+
+        depack_ctxt.source
+            = reinterpret_cast<const unsigned char*>(packed_input.data()); // NOLINT std::uint8_t* to unsigned char*
+        depack_ctxt.source_limit = reinterpret_cast<const unsigned char*>( // NOLINT std::uint8_t* to unsigned char*
+            packed_input.data() + len - 4U); // NOLINT space for length and uint8_t* to uchar*
+        depack_ctxt.source_read_cb = nullptr;
+
+        int res = uzlib_gzip_parse_header(&depack_ctxt);
+        if (TINF_OK != res)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::data_error);
+        }
+
+        depack_ctxt.dest = gzip_unpacked.data();
+        depack_ctxt.dest_start = gzip_unpacked.data();
+        depack_ctxt.dest_limit = depack_ctxt.dest + dlen; // NOLINT pointer arithmetic
+
+        // the whole stream and output are at hand: decode in one go with the table-driven path,
+        // the trailer crc32 and length are checked below
+        auto trees = std::make_unique<UZLIB_FAST_TREES>();
+        res = uzlib_uncompress_fast(&depack_ctxt, trees.get());
+
+        if (TINF_DONE != res)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::data_error);
+        }
+
+        const std::size_t depacked_sz = depack_ctxt.dest
+            - reinterpret_cast<unsigned char*>(gzip_unpacked.data()); // NOLINT std::uint8_t* to unsigned char*
+
+        if (depacked_sz != outlen)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::length_error);
+        }
+
+        std::uint32_t check_crc32 = ~tools::crc32_update(gzip_unpacked.data(), depacked_sz, tools::crc32_initial);
+
+        if (check_crc32 != source_crc32)
+        {
+            return unexpected<gzip_stream_error>(gzip_stream_error::checksum_error);
+        }
 
-            gzip_unpacked.resize(outlen);
-        } // end if !packed_input.empty()
+        gzip_unpacked.resize(outlen);
 
         return gzip_unpacked;
     }
@@ -4,7 +4,9 @@
  *
  * This file contains the definition of the gzip_wrapper class, which provides methods to
  * compress and decompress data using the gzip format. It utilizes the uzlib library for
- * compression and decompression.
+ * compression and decompression, of the gzip_stream_compressor class compressing a stream chunk by chunk
+ * straight into caller-provided buffers, and of the gzip_stream_decoder class inflating a stream chunk by chunk
+ * within bounded memory.
  *
  * @author Laurent Lardinois
  * @date January 2025
@@ -40,12 +42,25 @@
 #if !defined(GZIP_WRAPPER_HPP_)
 #define GZIP_WRAPPER_HPP_
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/alloc_hint.hpp"
+#include "tools/checksum.hpp"
+#include "tools/expected.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/object_pool.hpp"
+#include "tools/parallel_algorithms.hpp"
 #include "uzlib/uzlib.h"
 namespace tools
 {
@@ -53,6 +68,447 @@ namespace tools
     constexpr const unsigned int gzip_hash_bits = 12U;
     constexpr const std::size_t gzip_hash_nb_entries = (1U << gzip_hash_bits);
     constexpr const std::size_t gzip_hash_size = sizeof(uzlib_hash_entry_t) * gzip_hash_nb_entries;
+    constexpr const unsigned int gzip_fast_hash_bits = 10U;  ///< Match finder hash of gzip_level::fast.
+    constexpr const unsigned int gzip_chain_hash_bits = 13U; ///< Hash chain heads of gzip_level::best.
+    constexpr const std::size_t gzip_parallel_block_size = 131072U; ///< Input block of gzip_wrapper::pack_parallel().
+
+    /**
+     * @brief Speed/ratio trade-off of a gzip stream.
+     */
+    enum class gzip_level : std::uint8_t
+    {
+        fast,     ///< Smaller hash, and the match search backs off on incompressible runs.
+        balanced, ///< Greedy matching on a single-entry hash, static Huffman codes.
+        best      ///< Hash chains, lazy matching and dynamic Huffman blocks (whole-buffer pack() only).
+    };
+
+    /**
+     * @brief Framing of the preset dictionary streams of gzip_wrapper::pack_with_dictionary().
+     */
+    enum class deflate_framing : std::uint8_t
+    {
+        zlib, ///< RFC 1950: 2 bytes header, 4 bytes dictionary id, Adler-32 trailer (10 bytes overhead).
+        raw   ///< RFC 1951 deflate data only, without header nor integrity check.
+    };
+
+    /**
+     * @brief Errors reported by the gzip streaming API.
+     */
+    enum class gzip_stream_error : std::uint8_t
+    {
+        output_too_small, ///< The destination cannot hold the worst case output of the call.
+        input_too_large,  ///< The chunk exceeds the 32-bit length supported by uzlib helpers.
+        not_started,      ///< update() or finish() called without a successful init().
+        data_error,       ///< Invalid gzip header or deflate stream.
+        window_too_small, ///< A back-reference reaches beyond the decoder sliding window.
+        checksum_error,   ///< The CRC32 of the decoded data does not match the trailer.
+        length_error,     ///< The decoded size does not match the trailer.
+        truncated         ///< The input ended before the gzip trailer.
+    };
+
+    /**
+     * @brief Preallocated compression memory a gzip_stream_compressor or gzip_wrapper borrows instead of allocating.
+     *
+     * Held in a gzip_workspace_pool, declared static to live in .bss, wrappers created per request take a
+     * workspace at construction and give it back on destruction: compressing allocates nothing but the returned
+     * vector, and building a wrapper costs no allocation.
+     */
+    struct gzip_workspace
+    {
+        static constexpr std::size_t scratch_size = 4096U; ///< Output buffer of pack() for small messages.
+
+        // not value-initialized: borrowing must not clear 20 KB, stale table entries being validated anyway
+        gzip_workspace() noexcept // NOLINT members deliberately left uninitialized
+        {
+        }
+
+        std::array<std::uint32_t, gzip_hash_nb_entries> m_positions; ///< Match finder hash table.
+        std::array<std::uint8_t, scratch_size> m_scratch;            ///< pack() output before its exact copy.
+    };
+
+    /**
+     * @brief Fixed pool of N compression workspaces.
+     */
+    template <std::size_t N>
+    using gzip_workspace_pool = object_pool<gzip_workspace, N>;
+
+    /**
+     * @brief Streaming gzip compressor writing straight into caller-provided buffers.
+     *
+     * The stream is one static Huffman deflate block (the same encoding as uzlib's compressor) framed by the gzip
+     * header and CRC32/size trailer: init() writes the header, each update() compresses one chunk, finish()
+     * terminates the block and writes the trailer. gzip_level::fast uses a smaller hash and skips ahead over
+     * incompressible runs; gzip_level::best is encoded as balanced here, its hash chains needing the whole input
+     * (see gzip_wrapper::pack()). Every call checks up front that the destination can hold its
+     * worst case output (see update_bound()), so a failed call consumes nothing and leaves the stream usable.
+     *
+     * The match finder hash table is allocated once, or borrowed from a gzip_workspace, and keeps stream positions
+     * rather than pointers: stale entries of previous calls are rejected by range, so it is never cleared. Matches are searched within the
+     * current chunk only, so no history copy of the input is kept between calls.
+     */
+    class gzip_stream_compressor : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static constexpr std::size_t header_size = 10U;  ///< Bytes written by init().
+        static constexpr std::size_t finish_bound = 10U; ///< Maximum bytes written by finish().
+
+        /**
+         * @brief Constructs a compressor and allocates its match finder hash table.
+         *
+         * @param table_hint Memory the hash table is allocated from, PSRAM when available by default.
+         */
+        explicit gzip_stream_compressor(alloc_hint table_hint = alloc_hint::automatic);
+
+        /**
+         * @brief Constructs a compressor on the hash table of a workspace, which must outlive it.
+         *
+         * @param workspace The workspace to borrow, or nullptr to allocate the hash table.
+         * @param table_hint Memory the hash table is allocated from without workspace.
+         */
+        explicit gzip_stream_compressor(gzip_workspace* workspace, alloc_hint table_hint = alloc_hint::automatic);
+        ~gzip_stream_compressor() = default;
+
+        /**
+         * @brief Gets the maximum number of bytes written by update() for a chunk.
+         *
+         * @param input_size The chunk size in bytes.
+         * @return The destination capacity update() requires.
+         */
+        [[nodiscard]] static constexpr std::size_t update_bound(std::size_t input_size)
+        {
+            // at most 9 bits per input byte, plus up to 7 pending bits of the previous call
+            return ((input_size * 9U) + 7U) / 8U; // NOLINT bits per literal
+        }
+
+        /**
+         * @brief Gets the maximum size of a whole gzip stream.
+         *
+         * @param input_size The total uncompressed size in bytes.
+         * @return The destination capacity for init(), one update() and finish().
+         */
+        [[nodiscard]] static constexpr std::size_t compress_bound(std::size_t input_size)
+        {
+            return header_size + update_bound(input_size) + finish_bound;
+        }
+
+        /**
+         * @brief Starts a new gzip stream (restarting any stream in progress) and writes its header.
+         *
+         * @param output Destination buffer.
+         * @param capacity Destination capacity in bytes (at least header_size).
+         * @param level Match finding effort of the stream.
+         * @return The number of bytes written, or gzip_stream_error::output_too_small.
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> init(
+            std::uint8_t* output, std::size_t capacity, gzip_level level = gzip_level::balanced);
+
+        /**
+         * @brief Compresses one chunk of the stream.
+         *
+         * @param input The chunk to compress.
+         * @param input_size The chunk size in bytes.
+         * @param output Destination buffer.
+         * @param capacity Destination capacity in bytes (at least update_bound(input_size)).
+         * @return The number of bytes written, or an error.
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> update(
+            const std::uint8_t* input, std::size_t input_size, std::uint8_t* output, std::size_t capacity);
+
+        /**
+         * @brief Terminates the stream and writes the gzip trailer.
+         *
+         * @param output Destination buffer.
+         * @param capacity Destination capacity in bytes (at least finish_bound).
+         * @return The number of bytes written, or an error.
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> finish(std::uint8_t* output, std::size_t capacity);
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of init().
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> init(
+            std::span<std::uint8_t> output, gzip_level level = gzip_level::balanced)
+        {
+            return init(output.data(), output.size(), level);
+        }
+
+        /**
+         * @brief C++20 span overload of update().
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> update(
+            std::span<const std::uint8_t> input, std::span<std::uint8_t> output)
+        {
+            return update(input.data(), input.size(), output.data(), output.size());
+        }
+
+        /**
+         * @brief C++20 span overload of finish().
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> finish(std::span<std::uint8_t> output)
+        {
+            return finish(output.data(), output.size());
+        }
+#endif
+
+        /**
+         * @brief Checks if a stream is in progress.
+         *
+         * @return true between a successful init() and finish().
+         */
+        [[nodiscard]] bool active() const
+        {
+            return m_active;
+        }
+
+    private:
+        using position_table = std::array<std::uint32_t, gzip_hash_nb_entries>;
+
+        void put_bits(std::uint32_t bits, unsigned int count);
+        void put_literal(std::uint8_t value);
+        void put_match(std::size_t length, std::size_t distance);
+
+        hinted_unique_ptr<position_table> m_own_positions;
+        std::uint32_t* m_positions;
+        std::uint8_t* m_output = nullptr;
+        std::uint32_t m_bit_buffer = 0U;
+        unsigned int m_bit_count = 0U;
+        std::uint32_t m_position = 0U;
+        std::uint32_t m_crc32 = 0U;
+        unsigned int m_hash_bits = gzip_hash_bits;
+        bool m_skip_misses = false;
+        bool m_active = false;
+    };
+
+    struct gzip_chain_tables;
+
+    /**
+     * @brief Incremental gzip decoder inflating input chunks with uzlib into caller buffers or a callback.
+     *
+     * Input is copied into a fixed staging buffer with push() and inflated with pull(), the back-references being
+     * resolved from a fixed sliding window given to uzlib as its dictionary ring. Memory use is therefore bounded
+     * by the window and the staging buffer whatever the payload size. feed() and finish() wrap push()/pull() for
+     * sinks taking the decoded chunks.
+     *
+     * uzlib cannot suspend in the middle of a symbol, so pull() only inflates while at least lookahead bytes are
+     * staged (enough for a dynamic block header and the symbols of one step) until end_input() is called. A
+     * stream with a run of empty deflate blocks longer than that is rejected as a data_error.
+     */
+    class gzip_stream_decoder : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static constexpr std::size_t input_buffer_size = 1024U; ///< Staging buffer size.
+        static constexpr std::size_t lookahead = 512U;          ///< Input kept staged while more can come.
+        static constexpr std::size_t output_chunk_size = 256U;  ///< Chunk size given to feed()/finish() sinks.
+
+        /**
+         * @brief Constructs a decoder and allocates its sliding window.
+         *
+         * @param window_size The window size in bytes, at least the window of the compressor (32 KB for any gzip
+         * stream, gzip_dict_size for gzip_stream_compressor).
+         * @param window_hint Memory the window is allocated from, PSRAM when available for large windows by default.
+         */
+        explicit gzip_stream_decoder(
+            std::size_t window_size = gzip_dict_size, alloc_hint window_hint = alloc_hint::automatic);
+        ~gzip_stream_decoder() = default;
+
+        /**
+         * @brief Prepares the decoder for a new gzip stream.
+         */
+        void reset();
+
+        /**
+         * @brief Stages input bytes.
+         *
+         * Once the stream is decoded, further input is accepted and ignored.
+         *
+         * @param input The input bytes.
+         * @param input_size The number of input bytes.
+         * @return The number of bytes accepted, less than input_size when the staging buffer is full.
+         */
+        [[nodiscard]] std::size_t push(const std::uint8_t* input, std::size_t input_size);
+
+        /**
+         * @brief Signals that no more input will be pushed, letting pull() decode the staged tail.
+         */
+        void end_input()
+        {
+            m_input_ended = true;
+        }
+
+        /**
+         * @brief Inflates staged input into a destination buffer.
+         *
+         * @param output Destination buffer.
+         * @param capacity Destination capacity in bytes.
+         * @return The number of bytes written, 0 when more input is needed or the stream is done, or an error
+         * (sticky until reset()).
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> pull(std::uint8_t* output, std::size_t capacity);
+
+        /**
+         * @brief Decodes an input chunk, giving the decoded chunks to a sink.
+         *
+         * @tparam Sink Callable as sink(const std::uint8_t* data, std::size_t size).
+         * @param input The input bytes.
+         * @param input_size The number of input bytes.
+         * @param sink The sink receiving the decoded chunks.
+         * @return The number of decoded bytes given to the sink, or an error.
+         */
+        template <typename Sink>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_invocable_v<Sink&, const std::uint8_t*, std::size_t>
+#endif
+        auto feed(const std::uint8_t* input, std::size_t input_size, Sink&& sink)
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            -> expected<std::size_t, gzip_stream_error>
+#else
+            -> typename std::enable_if<std::is_invocable<Sink&, const std::uint8_t*, std::size_t>::value,
+                expected<std::size_t, gzip_stream_error>>::type
+#endif
+        {
+            std::size_t decoded = 0U;
+
+            do
+            {
+                const std::size_t accepted = push(input, input_size);
+                input += accepted; // NOLINT pointer arithmetic
+                input_size -= accepted;
+
+                const auto drained = drain(sink);
+                if (!drained.has_value())
+                {
+                    return drained;
+                }
+                decoded += drained.value();
+            } while (0U != input_size);
+
+            return decoded;
+        }
+
+        /**
+         * @brief Ends the input and decodes the staged tail, giving the decoded chunks to a sink.
+         *
+         * @tparam Sink Callable as sink(const std::uint8_t* data, std::size_t size).
+         * @param sink The sink receiving the decoded chunks.
+         * @return The number of decoded bytes given to the sink, or an error (truncated if the gzip trailer
+         * was not reached).
+         */
+        template <typename Sink>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_invocable_v<Sink&, const std::uint8_t*, std::size_t>
+#endif
+        auto finish(Sink&& sink)
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            -> expected<std::size_t, gzip_stream_error>
+#else
+            -> typename std::enable_if<std::is_invocable<Sink&, const std::uint8_t*, std::size_t>::value,
+                expected<std::size_t, gzip_stream_error>>::type
+#endif
+        {
+            end_input();
+            return drain(sink);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push().
+         */
+        [[nodiscard]] std::size_t push(std::span<const std::uint8_t> input)
+        {
+            return push(input.data(), input.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pull().
+         */
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> pull(std::span<std::uint8_t> output)
+        {
+            return pull(output.data(), output.size());
+        }
+#endif
+
+        /**
+         * @brief Checks if the whole stream, trailer included, has been decoded and verified.
+         *
+         * @return true once the gzip trailer matched.
+         */
+        [[nodiscard]] bool done() const
+        {
+            return stage::done == m_stage;
+        }
+
+    private:
+        enum class stage : std::uint8_t
+        {
+            header,
+            extra_length,
+            extra,
+            name,
+            comment,
+            header_crc,
+            body,
+            trailer,
+            done,
+            failed
+        };
+
+        template <typename Sink>
+        expected<std::size_t, gzip_stream_error> drain(Sink& sink)
+        {
+            std::size_t decoded = 0U;
+
+            while (true)
+            {
+                const auto pulled = pull(m_output.data(), m_output.size());
+                if (!pulled.has_value())
+                {
+                    return pulled;
+                }
+
+                if (0U == pulled.value())
+                {
+                    break;
+                }
+
+                sink(static_cast<const std::uint8_t*>(m_output.data()), pulled.value());
+                decoded += pulled.value();
+            }
+
+            if (m_input_ended && !done())
+            {
+                return fail(gzip_stream_error::truncated);
+            }
+
+            return decoded;
+        }
+
+        [[nodiscard]] std::size_t staged() const
+        {
+            return m_input_end - m_input_begin;
+        }
+
+        [[nodiscard]] bool parse_header();
+        [[nodiscard]] expected<std::size_t, gzip_stream_error> inflate(std::uint8_t* output, std::size_t capacity);
+        [[nodiscard]] bool check_trailer();
+        void next_header_field();
+        unexpected<gzip_stream_error> fail(gzip_stream_error error);
+
+        std::size_t m_window_size;
+        hinted_unique_ptr<std::uint8_t[]> m_window; // NOLINT fixed size dictionary ring given to uzlib
+        std::array<std::uint8_t, input_buffer_size> m_input = {};
+        std::array<std::uint8_t, output_chunk_size> m_output = {};
+        std::size_t m_input_begin = 0U;
+        std::size_t m_input_end = 0U;
+        bool m_input_ended = false;
+        stage m_stage = stage::header;
+        gzip_stream_error m_error = gzip_stream_error::data_error;
+        std::uint8_t m_flags = 0U;
+        std::size_t m_extra_remaining = 0U;
+        std::uint32_t m_crc32 = 0U;
+        std::uint32_t m_size = 0U;
+        struct uzlib_uncomp m_inflate = {};
+    };
 
     /**
      * @brief A wrapper class for gzip compression and decompression.
@@ -67,20 +523,105 @@ namespace tools
          * @brief Constructor for the gzip_wrapper class.
          *
          * This constructor initializes the uzlib library if it has not been initialized yet.
+         *
+         * @param table_hint Memory the hash table of the compressor is allocated from.
+         */
+        explicit gzip_wrapper(alloc_hint table_hint = alloc_hint::automatic);
+
+        /**
+         * @brief Constructs a wrapper on a workspace taken from a gzip_workspace_pool, held until destruction.
+         *
+         * The compressor uses the hash table of the workspace, and pack() compresses inputs whose
+         * gzip_stream_compressor::compress_bound() fits gzip_workspace::scratch_size in its scratch buffer, so that
+         * the returned vector is allocated once at its exact size. An empty handle (exhausted pool) falls back to
+         * allocated tables.
+         *
+         * @param workspace The borrowed workspace.
+         * @param table_hint Memory the tables are allocated from when not borrowed.
          */
-        gzip_wrapper();
-        ~gzip_wrapper() = default;
+        explicit gzip_wrapper(pooled_ptr<gzip_workspace> workspace, alloc_hint table_hint = alloc_hint::automatic);
+        ~gzip_wrapper();
 
         /**
          * @brief Compresses the input data using gzip compression.
          *
          * This function takes a vector of uncompressed input data and compresses it using the gzip format.
-         * It utilizes the uzlib library for compression and constructs the gzip header and footer manually.
+         * The output vector is sized once with gzip_stream_compressor::compress_bound() and filled in place.
+         * gzip_level::best allocates its hash chains (about 128 KB) on first use, from the table memory hint, and
+         * falls back to gzip_level::balanced when they cannot be allocated.
          *
          * @param unpacked_input A vector of uncompressed input data.
+         * @param level Speed/ratio trade-off of this call.
          * @return A vector containing the gzip compressed data.
          */
-        std::vector<std::uint8_t> pack(const std::vector<std::uint8_t>& unpacked_input); // use the hash table instance
+        std::vector<std::uint8_t> pack(const std::vector<std::uint8_t>& unpacked_input, // use the compressor instance
+            gzip_level level = gzip_level::balanced);
+
+        /**
+         * @brief Compresses the input data as pack() does, reporting failures instead of logging them.
+         *
+         * @param unpacked_input A vector of uncompressed input data.
+         * @param level Speed/ratio trade-off of this call.
+         * @return The gzip compressed data (empty for an empty input), or gzip_stream_error::input_too_large.
+         */
+        [[nodiscard]] expected<std::vector<std::uint8_t>, gzip_stream_error> pack_result(
+            const std::vector<std::uint8_t>& unpacked_input, gzip_level level = gzip_level::balanced);
+
+        /**
+         * @brief Compresses the input data into one gzip member, its blocks being deflated concurrently.
+         *
+         * The input is cut into block_size blocks, each deflated on its own by the caller and up to concurrency - 1
+         * helpers posted to the executor, with the 32 KB preceding it as dictionary so that matches still cross the
+         * block boundaries. The deflate segments end byte aligned (with an empty stored block, as a zlib sync flush)
+         * and are concatenated after one gzip header, the CRC32 of the trailer being combined from the per-block
+         * CRCs with crc32_combine(). Any gzip decoder, unpack() included, reads the result as a single stream.
+         *
+         * Each block allocates its own match finder tables (16 KB, or 128 KB of hash chains for gzip_level::best,
+         * from the table memory hint), a block whose tables cannot be allocated being stored uncompressed. Inputs
+         * of one block or less are packed by pack() on the caller.
+         *
+         * @tparam Executor Any tools/pco executor accepted by the parallel algorithms.
+         * @param exec The executor running the helpers.
+         * @param unpacked_input A vector of uncompressed input data.
+         * @param level Speed/ratio trade-off of this call.
+         * @param block_size Uncompressed size of each block in bytes.
+         * @param concurrency Participants including the caller, 0 for cpu_core_count().
+         * @return A vector containing the gzip compressed data.
+         */
+        template <typename Executor>
+        std::vector<std::uint8_t> pack_parallel(Executor exec, const std::vector<std::uint8_t>& unpacked_input,
+            gzip_level level = gzip_level::balanced, std::size_t block_size = gzip_parallel_block_size,
+            std::size_t concurrency = 0U)
+        {
+            const std::size_t size = unpacked_input.size();
+            block_size = std::max<std::size_t>(block_size, gzip_dict_size);
+            if ((size <= block_size) || (size >= static_cast<std::size_t>(gzip_max_pack_size)))
+            {
+                return pack(unpacked_input, level);
+            }
+
+            const std::size_t block_count = (size + block_size - 1U) / block_size;
+            std::vector<gzip_segment> segments(block_count);
+            auto deflate_block = [this, &unpacked_input, &segments, size, block_size, level](std::size_t block)
+            {
+                const std::size_t begin = block * block_size;
+                const std::size_t end = std::min(begin + block_size, size);
+                auto& segment = segments[block];
+                segment.m_data = deflate_range(unpacked_input.data(), begin, end,
+                    std::min<std::size_t>(begin, gzip_dict_size), end == size, level, nullptr, nullptr);
+                segment.m_crc32 = ~crc32_update(
+                    unpacked_input.data() + begin, end - begin, crc32_initial); // NOLINT pointer arithmetic
+                segment.m_size = end - begin;
+            };
+
+            parallel_params params;
+            params.concurrency = concurrency;
+            params.min_grain = 1U;
+            params.chunks_per_worker = 1U;
+            detail::run_chunks(exec, block_count, params, deflate_block);
+
+            return join_segments(segments, level);
+        }
 
         /**
          * @brief Unpacks a gzip compressed input vector.
@@ -91,13 +632,79 @@ namespace tools
          * @param packed_input The input vector containing gzip compressed data.
          * @return A vector containing the decompressed data. If decompression fails, an empty vector is returned.
          */
-        std::vector<std::uint8_t> unpack(const std::vector<std::uint8_t>& packed_input); // doesn't use the hash table
+        std::vector<std::uint8_t> unpack(const std::vector<std::uint8_t>& packed_input); // doesn't use the compressor
+
+        /**
+         * @brief Unpacks a gzip compressed input vector as unpack() does, reporting failures instead of logging them.
+         *
+         * @param packed_input The input vector containing gzip compressed data.
+         * @return The decompressed data, or gzip_stream_error::truncated (input shorter than a gzip stream),
+         * data_error, length_error or checksum_error.
+         */
+        [[nodiscard]] expected<std::vector<std::uint8_t>, gzip_stream_error> unpack_result(
+            const std::vector<std::uint8_t>& packed_input);
+
+        /**
+         * @brief Compresses a message with a preset dictionary, for small messages resembling each other.
+         *
+         * The last 32 KB of the dictionary are the initial window of the compressor: a short message repeating the
+         * strings of a dictionary built from sample traffic (most frequent strings at its end) compresses to a
+         * fraction of what pack() achieves with an empty window. The zlib framing records the Adler-32 of the
+         * dictionary (FDICT), so that zlib's inflateSetDictionary() and unpack_with_dictionary() can check it; the
+         * raw framing saves its 10 bytes, the decoder having to know the dictionary in use.
+         *
+         * @param unpacked_input The message to compress.
+         * @param dictionary The preset dictionary, shared with the decoder; may be empty.
+         * @param framing Stream framing.
+         * @param level Speed/ratio trade-off of this call.
+         * @return The compressed message, empty if the input is empty or too large.
+         */
+        std::vector<std::uint8_t> pack_with_dictionary(const std::vector<std::uint8_t>& unpacked_input,
+            const std::vector<std::uint8_t>& dictionary, deflate_framing framing = deflate_framing::zlib,
+            gzip_level level = gzip_level::balanced);
+
+        /**
+         * @brief Decompresses a message of pack_with_dictionary(), or any zlib/raw deflate stream of that dictionary.
+         *
+         * The message size is not stored by the framings: decoding starts with a buffer of a few times the packed
+         * size and grows it up to max_unpacked_size.
+         *
+         * @param packed_input The compressed message.
+         * @param dictionary The preset dictionary the message was compressed with.
+         * @param framing Stream framing.
+         * @param max_unpacked_size Largest accepted decompressed size.
+         * @return The decompressed message. If decompression fails, an empty vector is returned.
+         */
+        std::vector<std::uint8_t> unpack_with_dictionary(const std::vector<std::uint8_t>& packed_input,
+            const std::vector<std::uint8_t>& dictionary, deflate_framing framing = deflate_framing::zlib,
+            std::size_t max_unpacked_size = gzip_dict_size);
 
     private:
-        using hash_table = std::array<uzlib_hash_entry_t, gzip_hash_nb_entries>;
+        static constexpr std::uint32_t gzip_max_pack_size = 0xffffffffU; ///< Positions are kept on 32 bits.
+
+        /**
+         * @brief Raw deflate data of one block of pack_parallel(), with the CRC32 of its input.
+         */
+        struct gzip_segment
+        {
+            std::vector<std::uint8_t> m_data;
+            std::uint32_t m_crc32 = 0U;
+            std::size_t m_size = 0U;
+        };
+
+        expected<std::vector<std::uint8_t>, gzip_stream_error> pack_best(
+            const std::vector<std::uint8_t>& unpacked_input);
+        [[nodiscard]] std::vector<std::uint8_t> deflate_range(const std::uint8_t* data, std::size_t begin,
+            std::size_t end, std::size_t history, bool final_range, gzip_level level,
+            gzip_chain_tables* chain_tables, std::uint32_t* positions) const;
+        [[nodiscard]] static std::vector<std::uint8_t> join_segments(
+            const std::vector<gzip_segment>& segments, gzip_level level);
 
         static bool m_uzlib_initialized; // NOLINT common to all wrapper instances
-        std::unique_ptr<hash_table> m_hash_table;
+        alloc_hint m_table_hint;
+        pooled_ptr<gzip_workspace> m_workspace;
+        gzip_stream_compressor m_compressor;
+        hinted_unique_ptr<gzip_chain_tables> m_chain_tables;
     };
 }
 
@@ -0,0 +1,417 @@
+/**
+ * @file hdr_histogram.hpp
+ * @brief A fixed-size log-linear histogram with constant-time recording and bucket-walk percentiles.
+ *
+ * This file contains the definition of the hdr_histogram class, an HDR-style histogram of unsigned samples
+ * (latencies, sizes) trading exact values for a bounded relative error and a footprint independent of the
+ * number of samples.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(HDR_HISTOGRAM_HPP_)
+#define HDR_HISTOGRAM_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    template <unsigned int PrecisionBits, unsigned int ValueBits, std::size_t LaneCount>
+    class concurrent_hdr_histogram;
+
+    /**
+     * @brief A log-linear histogram of unsigned samples, not thread-safe.
+     *
+     * Samples below 2^PrecisionBits get a bucket each; above, every power of two range [2^k, 2^(k+1)) is split
+     * into 2^PrecisionBits equal buckets, so a bucket never spans more than 2^-PrecisionBits of its values. add()
+     * is a bit scan and an increment; percentiles walk the fixed bucket array; average and variance come from
+     * exact running sums. Storage is inline: (ValueBits - PrecisionBits + 1) * 2^PrecisionBits counters.
+     *
+     * @tparam PrecisionBits log2 of the sub-buckets per power of two (relative error below 2^-PrecisionBits).
+     * @tparam ValueBits Width of the largest recordable sample; larger samples are clamped to 2^ValueBits - 1.
+     */
+    template <unsigned int PrecisionBits = 5U, unsigned int ValueBits = 32U>
+    class hdr_histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert((PrecisionBits >= 1U) && (PrecisionBits < ValueBits), "precision must be below value bits");
+        static_assert(ValueBits <= 64U, "samples are at most 64-bit wide");
+
+        /**
+         * @brief Number of buckets of the histogram.
+         */
+        static constexpr std::size_t bucket_count = (std::size_t{ ValueBits - PrecisionBits } + 1U)
+            << PrecisionBits;
+
+        /**
+         * @brief Largest recordable sample.
+         */
+        static constexpr std::uint64_t max_value = (ValueBits == 64U)
+            ? std::numeric_limits<std::uint64_t>::max()
+            : ((std::uint64_t{ 1U } << (ValueBits % 64U)) - 1U);
+
+        hdr_histogram() = default;
+        ~hdr_histogram() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief Gets the bucket of a sample.
+         *
+         * @param value The sample (clamped to max_value).
+         * @return The bucket index.
+         */
+        [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t value)
+        {
+            value = (value > max_value) ? max_value : value;
+
+            if (value < sub_buckets)
+            {
+                return static_cast<std::size_t>(value);
+            }
+
+            const unsigned int shift = highest_bit(value) - PrecisionBits;
+            return (std::size_t{ shift } << PrecisionBits) + static_cast<std::size_t>(value >> shift);
+        }
+
+        /**
+         * @brief Gets the smallest sample of a bucket.
+         *
+         * @param bucket The bucket index.
+         * @return The lowest value mapped to the bucket.
+         */
+        [[nodiscard]] static constexpr std::uint64_t lowest_equivalent(std::size_t bucket)
+        {
+            if (bucket < sub_buckets)
+            {
+                return bucket;
+            }
+
+            const auto shift = static_cast<unsigned int>((bucket >> PrecisionBits) - 1U);
+            const std::uint64_t mantissa = sub_buckets + (bucket & (sub_buckets - 1U));
+            return mantissa << shift;
+        }
+
+        /**
+         * @brief Gets the largest sample of a bucket.
+         *
+         * @param bucket The bucket index.
+         * @return The highest value mapped to the bucket.
+         */
+        [[nodiscard]] static constexpr std::uint64_t highest_equivalent(std::size_t bucket)
+        {
+            if (bucket < sub_buckets)
+            {
+                return bucket;
+            }
+
+            const auto shift = static_cast<unsigned int>((bucket >> PrecisionBits) - 1U);
+            return lowest_equivalent(bucket) + ((std::uint64_t{ 1U } << shift) - 1U);
+        }
+
+        /**
+         * @brief Records a sample.
+         *
+         * @param value The sample (clamped to max_value).
+         */
+        void add(std::uint64_t value)
+        {
+            add(value, 1U);
+        }
+
+        /**
+         * @brief Records the same sample several times.
+         *
+         * @param value The sample (clamped to max_value).
+         * @param occurrences The number of times it occurred.
+         */
+        void add(std::uint64_t value, std::uint64_t occurrences)
+        {
+            if (0U == occurrences)
+            {
+                return;
+            }
+
+            value = (value > max_value) ? max_value : value;
+            const std::size_t bucket = bucket_of(value);
+            m_buckets[bucket] += occurrences;
+
+            if (m_buckets[bucket] > m_buckets[m_top_bucket])
+            {
+                m_top_bucket = bucket;
+            }
+
+            if ((0U == m_total_count) || (value < m_min))
+            {
+                m_min = value;
+            }
+
+            if (value > m_max)
+            {
+                m_max = value;
+            }
+
+            const auto sample = static_cast<double>(value);
+            const auto weight = static_cast<double>(occurrences);
+            m_total_count += occurrences;
+            m_sum += sample * weight;
+            m_sum_of_squares += sample * sample * weight;
+        }
+
+        /**
+         * @brief Adds the samples of another histogram of the same layout.
+         *
+         * @param other The histogram to merge into this one.
+         */
+        void merge(const hdr_histogram& other)
+        {
+            if (0U == other.m_total_count)
+            {
+                return;
+            }
+
+            for (std::size_t bucket = 0U; bucket < bucket_count; ++bucket)
+            {
+                m_buckets[bucket] += other.m_buckets[bucket];
+
+                if (m_buckets[bucket] > m_buckets[m_top_bucket])
+                {
+                    m_top_bucket = bucket;
+                }
+            }
+
+            m_min = ((0U == m_total_count) || (other.m_min < m_min)) ? other.m_min : m_min;
+            m_max = (other.m_max > m_max) ? other.m_max : m_max;
+            m_total_count += other.m_total_count;
+            m_sum += other.m_sum;
+            m_sum_of_squares += other.m_sum_of_squares;
+        }
+
+        /**
+         * @brief Forgets every sample.
+         */
+        void reset()
+        {
+            m_buckets = {};
+            m_total_count = 0U;
+            m_top_bucket = 0U;
+            m_min = 0U;
+            m_max = 0U;
+            m_sum = 0.0;
+            m_sum_of_squares = 0.0;
+        }
+
+        /**
+         * @brief Gets the value below or at which a fraction of the samples fall.
+         *
+         * @param fraction The percentile as a fraction in [0, 1], e.g. 0.5, 0.99 or 0.999.
+         * @return The highest value of the bucket holding the percentile, within [min(), max()]; 0 if empty.
+         */
+        [[nodiscard]] std::uint64_t percentile(double fraction) const
+        {
+            if (0U == m_total_count)
+            {
+                return 0U;
+            }
+
+            fraction = (fraction < 0.0) ? 0.0 : ((fraction > 1.0) ? 1.0 : fraction);
+            const auto rank = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(m_total_count)));
+
+            if (0U == rank)
+            {
+                return m_min;
+            }
+
+            std::uint64_t seen = 0U;
+            for (std::size_t bucket = 0U; bucket < bucket_count; ++bucket)
+            {
+                seen += m_buckets[bucket];
+
+                if (seen >= rank)
+                {
+                    return clamp_to_range(highest_equivalent(bucket));
+                }
+            }
+
+            return m_max;
+        }
+
+        /**
+         * @brief Gets the median of the samples, percentile(0.5).
+         *
+         * @return The median value.
+         */
+        [[nodiscard]] double median() const
+        {
+            return static_cast<double>(percentile(0.5)); // NOLINT half
+        }
+
+        /**
+         * @brief Gets the middle value of the most populated bucket.
+         *
+         * @return The mode estimate, 0 if empty.
+         */
+        [[nodiscard]] std::uint64_t top() const
+        {
+            if (0U == m_total_count)
+            {
+                return 0U;
+            }
+
+            const std::uint64_t low = lowest_equivalent(m_top_bucket);
+            return clamp_to_range(low + ((highest_equivalent(m_top_bucket) - low) / 2U));
+        }
+
+        /**
+         * @brief Gets the sample count of the most populated bucket.
+         *
+         * @return The highest bucket count.
+         */
+        [[nodiscard]] std::uint64_t top_occurence() const
+        {
+            return m_buckets[m_top_bucket];
+        }
+
+        /**
+         * @brief Gets the number of recorded samples.
+         *
+         * @return The total count.
+         */
+        [[nodiscard]] std::uint64_t total_count() const
+        {
+            return m_total_count;
+        }
+
+        /**
+         * @brief Gets the number of samples recorded in a bucket.
+         *
+         * @param bucket The bucket index.
+         * @return The bucket count, 0 for an out of range index.
+         */
+        [[nodiscard]] std::uint64_t count_at(std::size_t bucket) const
+        {
+            return (bucket < bucket_count) ? m_buckets[bucket] : 0U;
+        }
+
+        [[nodiscard]] std::uint64_t min() const
+        {
+            return m_min;
+        }
+
+        [[nodiscard]] std::uint64_t max() const
+        {
+            return m_max;
+        }
+
+        /**
+         * @brief Calculates the exact average of the samples (after clamping).
+         *
+         * @return The average, 0 if empty.
+         */
+        [[nodiscard]] double average() const
+        {
+            return (0U == m_total_count) ? 0.0 : (m_sum / static_cast<double>(m_total_count));
+        }
+
+        /**
+         * @brief Calculates the variance of the samples around a given average.
+         *
+         * @param average The average value of the data set.
+         * @return The variance, 0 if empty.
+         */
+        [[nodiscard]] double variance(double average) const
+        {
+            if (0U == m_total_count)
+            {
+                return 0.0;
+            }
+
+            // E[(x - a)^2] = E[x^2] - 2a E[x] + a^2
+            const auto total = static_cast<double>(m_total_count);
+            const double result
+                = (m_sum_of_squares / total) - (2.0 * average * (m_sum / total)) + (average * average); // NOLINT
+            return (result > 0.0) ? result : 0.0;
+        }
+
+        /**
+         * @brief Calculates the standard deviation from a variance.
+         *
+         * @param variance The variance value of the data set.
+         * @return The standard deviation.
+         */
+        [[nodiscard]] double standard_deviation(double variance) const
+        {
+            return std::sqrt(variance);
+        }
+
+    private:
+        template <unsigned int, unsigned int, std::size_t>
+        friend class concurrent_hdr_histogram;
+
+        static constexpr std::uint64_t sub_buckets = std::uint64_t{ 1U } << PrecisionBits;
+
+        static constexpr unsigned int highest_bit(std::uint64_t value)
+        {
+            unsigned int bit = 0U;
+
+            while ((value >> 1U) != 0U)
+            {
+                value >>= 1U;
+                ++bit;
+            }
+
+            return bit;
+        }
+
+        [[nodiscard]] std::uint64_t clamp_to_range(std::uint64_t value) const
+        {
+            return (value < m_min) ? m_min : ((value > m_max) ? m_max : value);
+        }
+
+        std::array<std::uint64_t, bucket_count> m_buckets = {};
+        std::uint64_t m_total_count = 0U;
+        std::size_t m_top_bucket = 0U;
+        std::uint64_t m_min = 0U;
+        std::uint64_t m_max = 0U;
+        double m_sum = 0.0;
+        double m_sum_of_squares = 0.0;
+    };
+}
+
+#endif //  HDR_HISTOGRAM_HPP_
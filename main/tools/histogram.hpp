@@ -41,9 +41,14 @@
 #define HISTOGRAM_HPP_
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <random>
 #include <type_traits>
 #include <unordered_map>
@@ -61,17 +66,168 @@
 
 namespace tools
 {
+    /**
+     * @brief Tag selecting the dense counts of histogram: one counter per possible value, in a std::array indexed by
+     *        value, for 8-bit and 16-bit integral types.
+     *
+     * @tparam T The integral type of values stored in the histogram.
+     */
+    template <typename T>
+    struct dense_counts
+    {
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Distribution helpers shared by the histogram flavours, independent of how counts are stored.
+         *
+         * @tparam T The type of values stored in the histogram.
+         */
+        template <typename T>
+        class histogram_distribution
+        {
+        public:
+            /**
+             * @brief Calculates the standard deviation of the data set.
+             *
+             * This function computes the standard deviation of the data set stored in the histogram.
+             *
+             * @param variance The variance value of the data set.
+             * @return The standard deviation of the data set.
+             */
+            [[nodiscard]] double standard_deviation(double variance) const
+            {
+                return std::sqrt(variance);
+            }
+
+            /**
+             * @brief Computes the Gaussian density of a given value.
+             *
+             * This function calculates the density of a given value under a Gaussian (normal) distribution
+             * characterized by the specified average and variance.
+             *
+             * @param value The value for which the density is to be computed.
+             * @param average The mean (average) of the Gaussian distribution.
+             * @param standard_deviation The standard deviation (sigma) of the Gaussian distribution.
+             * @return The density of the given value under the specified Gaussian distribution.
+             */
+            [[nodiscard]] double gaussian_density(
+                T value, double average, double standard_deviation) const // NOLINT keep it
+            {
+                // https://fr.wikipedia.org/wiki/Loi_normale
+                // https://www.savarese.org/math/gaussianintegral.html
+                double result = 0.0;
+                if (standard_deviation > 0.0)
+                {
+                    static const double sqrt_two_pi = std::sqrt(M_TWO_PI);
+                    const double sigma = standard_deviation;
+                    const double epsilon = (static_cast<double>(value) - average) / sigma;
+                    result = std::exp(-0.5 * epsilon * epsilon) / (sigma * sqrt_two_pi); // NOLINT math formula
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Calculates the Gaussian probability over a specified range using Monte Carlo integration.
+             *
+             * This function estimates the probability that a value falls within a specified range
+             * for a Gaussian distribution with a given average and standard deviation. The estimation
+             * is performed using Monte Carlo integration with a specified number of samples.
+             *
+             * @tparam T The type of the range values.
+             * @param range_from The lower bound of the range.
+             * @param range_to The upper bound of the range.
+             * @param average The mean (average) of the Gaussian distribution.
+             * @param standard_deviation The standard deviation of the Gaussian distribution.
+             * @param montecarlo_samples The number of Monte Carlo samples to use for the estimation.
+             * @return The estimated probability that a value falls within the specified range.
+             */
+            [[nodiscard]] double gaussian_probability(
+                T range_from, T range_to, double average, double standard_deviation, int montecarlo_samples) const
+            {
+                // https://cameron-mcelfresh.medium.com/monte-carlo-integration-313b37157852
+                // https://www.savarese.org/math/gaussianintegral.html
+                // https://en.wikipedia.org/wiki/Gaussian_integral
+                // https://stackoverflow.com/questions/288739/generate-random-numbers-uniformly-over-an-entire-range
+                double result = 0.0;
+                if ((standard_deviation > 0.0) && (montecarlo_samples > 0))
+                {
+                    // static: mt19937 state is 2496 bytes — keeping it off the caller's stack.
+                    // Initialized once at first call; continuing the sequence across calls
+                    // also improves Monte Carlo quality compared to re-seeding every time.
+                    static std::random_device rand_dev;
+                    static std::mt19937 generator(rand_dev());
+
+                    if constexpr (std::is_integral<T>::value)
+                    {
+                        std::uniform_int_distribution<T> distr(range_from, range_to);
+                        for (int i = 0; i < montecarlo_samples; ++i)
+                        {
+                            const T value = distr(generator);
+                            result += gaussian_density(value, average, standard_deviation);
+                        }
+                    }
+                    else
+                    {
+                        std::uniform_real_distribution<T> distr(range_from, range_to);
+                        for (int i = 0; i < montecarlo_samples; ++i)
+                        {
+                            const T value = distr(generator);
+                            result += gaussian_density(value, average, standard_deviation);
+                        }
+                    }
+
+                    result = (result * static_cast<double>(range_to - range_from))
+                        / static_cast<double>(montecarlo_samples - 1);
+                }
+
+                return result;
+            }
+        };
+
+        template <typename T>
+        struct is_dense_histogram_domain
+            : std::integral_constant<bool,
+                  std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) <= 2U)>
+        {
+        };
+
+        template <typename T>
+        using default_histogram_dictionary = typename std::conditional<
+            is_dense_histogram_domain<T>::value && (1U == sizeof(T)), dense_counts<T>, std::unordered_map<T, int>>::type;
+    } // namespace detail
+
     /**
      * @brief A class representing a histogram for counting occurrences of values.
      *
      * @tparam T The type of values stored in the histogram.
+     * @tparam TDictionary The value to occurrence count container, std::unordered_map<T, int> by default (dense_counts<T>
+     *         for 8-bit integral types, see the specialization below); a tools::fixed_flat_hash_map<T, int, N> keeps the
+     *         histogram off the heap (values beyond N distinct ones are then dropped).
      */
-    template <typename T>
-    class histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    template <typename T, typename TDictionary = detail::default_histogram_dictionary<T>>
+    class histogram // NOLINT inherits from non copyable and non movable class
+        : public non_copyable
+        , public detail::histogram_distribution<T>
     {
     public:
         histogram() = default;
         ~histogram() = default;
+
+        /**
+         * @brief Constructs an empty histogram whose container allocates through the given allocator.
+         *
+         * @param alloc The allocator, e.g. a std::pmr::memory_resource* for a std::pmr container.
+         */
+        template <typename Alloc, typename D = TDictionary,
+            typename = std::enable_if_t<std::uses_allocator<D, Alloc>::value>>
+        explicit histogram(const Alloc& alloc)
+            : m_occurences(alloc)
+        {
+        }
+
         struct thread_safe
         {
             static constexpr bool value = false;
@@ -195,9 +351,14 @@ namespace tools
     private:
         void add_value(T value)
         {
-            if (0 == m_occurences.count(value)) // first time
+            auto found = m_occurences.find(value);
+
+            if (found == m_occurences.end()) // first time
             {
-                m_occurences.emplace(value, 1);
+                if (m_occurences.end() == m_occurences.insert_or_assign(value, 1).first)
+                {
+                    return; // fixed-capacity dictionary full
+                }
 
                 if (0 == m_top_occurence)
                 {
@@ -207,16 +368,12 @@ namespace tools
             }
             else // found twice at least
             {
-                auto found = m_occurences.find(value);
-                if (found != m_occurences.end())
-                {
-                    found->second += 1;
+                found->second += 1;
 
-                    if (found->second > m_top_occurence)
-                    {
-                        m_top_occurence = found->second;
-                        m_top_value = value;
-                    }
+                if (found->second > m_top_occurence)
+                {
+                    m_top_occurence = found->second;
+                    m_top_value = value;
                 }
             }
 
@@ -306,159 +463,435 @@ namespace tools
             return (total > 0.0) ? (vari / total) : 0.0;
         }
 
-        /**
-         * @brief Calculates the standard deviation of the data set.
-         *
-         * This function computes the standard deviation of the data set stored in the histogram.
-         *
-         * @param variance The variance value of the data set.
-         * @return The standard deviation of the data set.
-         */
-        [[nodiscard]] double standard_deviation(double variance) const
-        {
-            return std::sqrt(variance);
-        }
-
         /**
          * @brief Computes the median value of the histogram.
          *
-         * This function creates a sorted list of all occurrences and returns the median value.
-         * If the histogram is empty, it returns 0.
+         * This function sorts the distinct values with their counts and walks the cumulative counts to the
+         * middle occurrence(s), without expanding each occurrence. If the histogram is empty, it returns 0.
          *
          * @return The median value of the histogram.
          */
         [[nodiscard]] double median() const
         {
-            std::vector<T> to_sort;
+            std::vector<std::pair<T, int>> to_sort(m_occurences.cbegin(), m_occurences.cend());
+            std::size_t total = 0U;
 
-            for (auto itr = m_occurences.cbegin(); itr != m_occurences.cend(); ++itr)
+            for (const auto& entry : to_sort)
             {
-                for (int i = 0; i < itr->second; ++i) // occurence
-                {
-                    to_sort.emplace_back(itr->first);
-                }
+                total += static_cast<std::size_t>(entry.second);
             }
 
-            if (to_sort.empty())
+            if (0U == total)
             {
                 return 0.0;
             }
 
+            const auto by_value = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-            std::ranges::sort(to_sort);
+            std::ranges::sort(to_sort, by_value);
 #else
-            std::sort(to_sort.begin(), to_sort.end());
+            std::sort(to_sort.begin(), to_sort.end(), by_value);
 #endif
 
+            // value of the occurrence at a given rank of the sorted occurrences
+            const auto value_at = [&to_sort](std::size_t rank)
+            {
+                std::size_t seen = 0U;
+
+                for (const auto& entry : to_sort)
+                {
+                    seen += static_cast<std::size_t>(entry.second);
+
+                    if (seen > rank)
+                    {
+                        return static_cast<double>(entry.first);
+                    }
+                }
+
+                return static_cast<double>(to_sort.back().first);
+            };
+
             // https://www.calculator.net/mean-median-mode-range-calculator.html
 
-            const auto idx = to_sort.size() >> 1;
+            const auto idx = total >> 1;
             double value = 0.0;
 
-            if (to_sort.size() & 1U)
+            if (total & 1U)
             {
                 // odd case
-                value = static_cast<double>(to_sort[idx]);
+                value = value_at(idx);
             }
             else
             {
                 // even case
                 constexpr double median_even_divisor = 2.0;
-                const auto lhs_value = static_cast<double>(to_sort[idx]);
-                const auto rhs_value = static_cast<double>(to_sort[idx - 1]);
+                const auto lhs_value = value_at(idx);
+                const auto rhs_value = value_at(idx - 1);
                 value = (lhs_value + rhs_value) / median_even_divisor; // NOLINT math formula
             }
 
             return value;
         }
 
+    private:
+        TDictionary m_occurences;
+        int m_total_count = 0;
+        int m_top_occurence = 0;
+        T m_top_value = static_cast<T>(0);
+    };
+
+    /**
+     * @brief Histogram specialization counting 8-bit and 16-bit integral values in a dense array indexed by value.
+     *
+     * Same interface as the dictionary histogram without hashing: add() is one increment, add_range() counts 8-bit
+     * values into four interleaved sub-histograms merged every chunk (so runs of equal samples do not serialize on
+     * one counter through store forwarding), and average(), variance() and median() walk the array in value order
+     * without allocating. 8-bit counts (1 KB) live in the object; 16-bit counts (256 KB) are allocated once at
+     * construction. After add_range(), top() is the most frequent value among those overtaking the previous top,
+     * the smallest one on ties.
+     *
+     * @tparam T The integral type of values stored in the histogram.
+     */
+    template <typename T>
+    class histogram<T, dense_counts<T>> // NOLINT inherits from non copyable and non movable class
+        : public non_copyable
+        , public detail::histogram_distribution<T>
+    {
+        static_assert(detail::is_dense_histogram_domain<T>::value, "dense_counts needs an 8-bit or 16-bit integral type");
+
+        static constexpr std::size_t domain_size = std::size_t { 1U } << (sizeof(T) * 8U);
+        static constexpr bool inline_counts = (1U == sizeof(T));
+        using counts_type = std::array<int, domain_size>;
+
+    public:
+        histogram()
+        {
+            if constexpr (!inline_counts)
+            {
+                m_counts = std::make_unique<counts_type>();
+            }
+        }
+
+        ~histogram() = default;
+
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief Adds a value to the histogram and updates the occurrence count.
+         *
+         * @param value The value to be added to the histogram.
+         */
+        void add(const T& value)
+        {
+            add_value(value);
+        }
+
+        /**
+         * @brief Adds a value to the histogram with conversion.
+         *
+         * @tparam U The deduced value type.
+         * @param value The value to be converted into T.
+         */
+        template <typename U>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, U>
+#endif
+        auto add(U&& value)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
+#endif
+        {
+            add_value(T(std::forward<U>(value)));
+        }
+
+        /**
+         * @brief Adds values from a generic range-like source.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param values The source range of values.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange> && std::is_constructible_v<T, std::ranges::range_value_t<TRange>>
+#endif
+        void add_range(TRange&& values)
+        {
+            add_batch(std::begin(values), std::end(values));
+        }
+
+        /**
+         * @brief Adds values from an initializer-list source.
+         *
+         * @param values The source initializer-list of values.
+         */
+        void add_range(std::initializer_list<T> values)
+        {
+            add_batch(values.begin(), values.end());
+        }
+
+        /**
+         * @brief Backward-compatible alias for add_range(range).
+         *
+         * @tparam TRange The range type (deduced).
+         * @param values The source collection of values.
+         */
+        template <typename TRange>
+        void add_collection(TRange&& values)
+        {
+            add_range(std::forward<TRange>(values));
+        }
+
+        /**
+         * @brief Backward-compatible alias for add_range(initializer_list).
+         *
+         * @param values The source initializer-list of values.
+         */
+        void add_collection(std::initializer_list<T> values)
+        {
+            add_range(values);
+        }
+
+        /**
+         * @brief Returns the top value of the histogram.
+         *
+         * @return The top value of the histogram.
+         */
+        [[nodiscard]] constexpr T top() const
+        {
+            return m_top_value;
+        }
+
+        /**
+         * @brief Returns the total count of values present in the histogram.
+         *
+         * @return The total count as an integer.
+         */
+        [[nodiscard]] constexpr int total_count() const
+        {
+            return m_total_count;
+        }
+
         /**
-         * @brief Computes the Gaussian density of a given value.
+         * @brief Returns the highest occurrence count in the histogram.
          *
-         * This function calculates the density of a given value under a Gaussian (normal) distribution
-         * characterized by the specified average and variance.
+         * @return The highest occurrence count as an integer.
+         */
+        [[nodiscard]] constexpr int top_occurence() const
+        {
+            return m_top_occurence;
+        }
+
+        /**
+         * @brief Returns the occurrence count of a value.
+         *
+         * @param value The value to look up.
+         * @return The number of times the value was added.
+         */
+        [[nodiscard]] int count(T value) const
+        {
+            return counts()[index_of(value)];
+        }
+
+        /**
+         * @brief Calculates the average value of the histogram.
          *
-         * @param value The value for which the density is to be computed.
-         * @param average The mean (average) of the Gaussian distribution.
-         * @param standard_deviation The standard deviation (sigma) of the Gaussian distribution.
-         * @return The density of the given value under the specified Gaussian distribution.
+         * @return The average value, 0 if there are no occurrences.
          */
-        [[nodiscard]] double gaussian_density(
-            T value, double average, double standard_deviation) const // NOLINT keep it
+        [[nodiscard]] double average() const
         {
-            // https://fr.wikipedia.org/wiki/Loi_normale
-            // https://www.savarese.org/math/gaussianintegral.html
-            double result = 0.0;
-            if (standard_deviation > 0.0)
+            std::int64_t sum = 0;
+            const counts_type& bins = counts();
+
+            for (std::size_t index = 0U; index < domain_size; ++index)
             {
-                static const double sqrt_two_pi = std::sqrt(M_TWO_PI);
-                const double sigma = standard_deviation;
-                const double epsilon = (static_cast<double>(value) - average) / sigma;
-                result = std::exp(-0.5 * epsilon * epsilon) / (sigma * sqrt_two_pi); // NOLINT math formula
+                sum += static_cast<std::int64_t>(bins[index]) * static_cast<std::int64_t>(value_of(index));
             }
 
-            return result;
+            return (m_total_count > 0) ? (static_cast<double>(sum) / static_cast<double>(m_total_count)) : 0.0;
         }
 
         /**
-         * @brief Calculates the Gaussian probability over a specified range using Monte Carlo integration.
-         *
-         * This function estimates the probability that a value falls within a specified range
-         * for a Gaussian distribution with a given average and standard deviation. The estimation
-         * is performed using Monte Carlo integration with a specified number of samples.
-         *
-         * @tparam T The type of the range values.
-         * @param range_from The lower bound of the range.
-         * @param range_to The upper bound of the range.
-         * @param average The mean (average) of the Gaussian distribution.
-         * @param standard_deviation The standard deviation of the Gaussian distribution.
-         * @param montecarlo_samples The number of Monte Carlo samples to use for the estimation.
-         * @return The estimated probability that a value falls within the specified range.
+         * @brief Calculates the variance of the data set.
+         *
+         * @param average The average value of the data set.
+         * @return The variance of the data set.
          */
-        [[nodiscard]] double gaussian_probability(
-            T range_from, T range_to, double average, double standard_deviation, int montecarlo_samples) const
-        {
-            // https://cameron-mcelfresh.medium.com/monte-carlo-integration-313b37157852
-            // https://www.savarese.org/math/gaussianintegral.html
-            // https://en.wikipedia.org/wiki/Gaussian_integral
-            // https://stackoverflow.com/questions/288739/generate-random-numbers-uniformly-over-an-entire-range
-            double result = 0.0;
-            if ((standard_deviation > 0.0) && (montecarlo_samples > 0))
+        [[nodiscard]] double variance(double average) const
+        {
+            double vari = 0.0;
+            const counts_type& bins = counts();
+
+            for (std::size_t index = 0U; index < domain_size; ++index)
             {
-                // static: mt19937 state is 2496 bytes — keeping it off the caller's stack.
-                // Initialized once at first call; continuing the sequence across calls
-                // also improves Monte Carlo quality compared to re-seeding every time.
-                static std::random_device rand_dev;
-                static std::mt19937 generator(rand_dev());
+                if (bins[index] > 0) // occurence
+                {
+                    const auto dva = static_cast<double>(value_of(index)) - average;
+                    vari += bins[index] * (dva * dva);
+                }
+            }
+
+            return (m_total_count > 0) ? (vari / static_cast<double>(m_total_count)) : 0.0;
+        }
 
-                if constexpr (std::is_integral<T>::value)
+        /**
+         * @brief Computes the median value of the histogram by walking the cumulative counts in value order.
+         *
+         * @return The median value of the histogram, 0 if it is empty.
+         */
+        [[nodiscard]] double median() const
+        {
+            if (0 == m_total_count)
+            {
+                return 0.0;
+            }
+
+            const auto total = static_cast<std::size_t>(m_total_count);
+            const auto idx = total >> 1;
+
+            if (total & 1U)
+            {
+                // odd case
+                return value_at(idx);
+            }
+
+            // even case
+            constexpr double median_even_divisor = 2.0;
+            return (value_at(idx) + value_at(idx - 1)) / median_even_divisor; // NOLINT math formula
+        }
+
+    private:
+        static std::size_t index_of(T value)
+        {
+            return static_cast<std::size_t>(static_cast<long>(value) - static_cast<long>(std::numeric_limits<T>::min()));
+        }
+
+        static T value_of(std::size_t index)
+        {
+            return static_cast<T>(static_cast<long>(index) + static_cast<long>(std::numeric_limits<T>::min()));
+        }
+
+        [[nodiscard]] counts_type& counts()
+        {
+            if constexpr (inline_counts)
+            {
+                return m_counts;
+            }
+            else
+            {
+                return *m_counts;
+            }
+        }
+
+        [[nodiscard]] const counts_type& counts() const
+        {
+            if constexpr (inline_counts)
+            {
+                return m_counts;
+            }
+            else
+            {
+                return *m_counts;
+            }
+        }
+
+        void add_value(T value)
+        {
+            const int occurence = ++counts()[index_of(value)];
+
+            if (occurence > m_top_occurence)
+            {
+                m_top_occurence = occurence;
+                m_top_value = value;
+            }
+
+            ++m_total_count;
+        }
+
+        template <typename TIterator, typename TSentinel>
+        void add_batch(TIterator first, TSentinel last)
+        {
+            if constexpr (inline_counts)
+            {
+                // consecutive samples go to different sub-histograms; 8-bit sub-counts merged before they overflow
+                constexpr std::size_t lanes = 4U;
+                constexpr std::size_t chunk = lanes * std::numeric_limits<std::uint8_t>::max();
+                std::array<std::array<std::uint8_t, domain_size>, lanes> lane_counts {};
+
+                while (first != last)
                 {
-                    std::uniform_int_distribution<T> distr(range_from, range_to);
-                    for (int i = 0; i < montecarlo_samples; ++i)
+                    std::size_t counted = 0U;
+                    for (; (first != last) && (counted < chunk); ++first, ++counted)
                     {
-                        const T value = distr(generator);
-                        result += gaussian_density(value, average, standard_deviation);
+                        ++lane_counts[counted % lanes][index_of(T(*first))];
                     }
+
+                    merge(lane_counts);
+                    m_total_count += static_cast<int>(counted);
                 }
-                else
+            }
+            else
+            {
+                for (; first != last; ++first)
                 {
-                    std::uniform_real_distribution<T> distr(range_from, range_to);
-                    for (int i = 0; i < montecarlo_samples; ++i)
+                    add_value(T(*first));
+                }
+            }
+        }
+
+        template <typename TLanes>
+        void merge(TLanes& lane_counts)
+        {
+            counts_type& bins = counts();
+
+            for (std::size_t index = 0U; index < domain_size; ++index)
+            {
+                int added = 0;
+                for (auto& lane : lane_counts)
+                {
+                    added += lane[index];
+                    lane[index] = 0U;
+                }
+
+                if (0 != added)
+                {
+                    bins[index] += added;
+                    if (bins[index] > m_top_occurence)
                     {
-                        const T value = distr(generator);
-                        result += gaussian_density(value, average, standard_deviation);
+                        m_top_occurence = bins[index];
+                        m_top_value = value_of(index);
                     }
                 }
+            }
+        }
 
-                result = (result * static_cast<double>(range_to - range_from))
-                    / static_cast<double>(montecarlo_samples - 1);
+        [[nodiscard]] double value_at(std::size_t rank) const
+        {
+            const counts_type& bins = counts();
+            std::size_t seen = 0U;
+
+            for (std::size_t index = 0U; index < domain_size; ++index)
+            {
+                seen += static_cast<std::size_t>(bins[index]);
+
+                if (seen > rank)
+                {
+                    return static_cast<double>(value_of(index));
+                }
             }
 
-            return result;
+            return 0.0;
         }
 
-    private:
-        std::unordered_map<T, int> m_occurences;
+        std::conditional_t<inline_counts, counts_type, std::unique_ptr<counts_type>> m_counts {};
         int m_total_count = 0;
         int m_top_occurence = 0;
         T m_top_value = static_cast<T>(0);
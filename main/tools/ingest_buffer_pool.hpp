@@ -0,0 +1,334 @@
+/**
+ * @file ingest_buffer_pool.hpp
+ * @brief Ping-pong (or N-buffered) DMA capable capture buffers handed to a data_task by pointer.
+ *
+ * I2S or ADC continuous capture fills one buffer while the previous one is processed. Instead of copying each
+ * completed half-buffer in the ISR and submitting its samples one by one, the producer submits a small block
+ * descriptor to a data_task; the task reads the samples where the DMA wrote them and the buffer returns to the
+ * producer once the routine is done with it.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(INGEST_BUFFER_POOL_HPP_)
+#define INGEST_BUFFER_POOL_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/alloc_hint.hpp"
+#include "tools/lock_free_ring_buffer.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Fixed set of capture buffers cycling between a producer (ISR or driver task) and a data_task.
+     *
+     * The 2^Pow2 buffers (2 by default: ping-pong) are allocated once, contiguously, from the memory matching the
+     * hint (DMA capable by default). Ownership travels with the buffer:
+     * - the producer acquire()s a free buffer and lets the peripheral fill it;
+     * - submit()/isr_submit() queue a block descriptor (pointer and sample count) into the data_task; a buffer
+     *   the task queue refuses goes straight back to the free list and is counted by dropped_count();
+     * - the data_task routine built by process_routine() (or batch_routine()) reads the samples in place, then
+     *   hands the buffer back through a lock-free return ring.
+     *
+     * As in zero_copy_channel, the free list belongs to the producer and is refilled from the return ring when it
+     * runs dry, so neither side takes a lock. All producer calls must come from one context, all releases from the
+     * data_task. Blocks handed back by data_task::stop() were never processed: pass them to release().
+     *
+     * @tparam Sample The sample type, trivially copyable (e.g. std::int16_t for I2S, adc_digi_output_data_t).
+     * @tparam Pow2 The power of 2 that determines the number of buffers.
+     */
+    template <typename Sample, std::size_t Pow2 = 1U>
+    class ingest_buffer_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_trivially_copyable<Sample>::value, "Sample has to be trivially copyable");
+        static_assert(alignof(Sample) <= alignof(std::max_align_t), "buffers are only aligned like malloc blocks");
+
+        /** @brief Number of capture buffers. */
+        static constexpr const std::size_t buffer_count = (1U << Pow2);
+
+        /**
+         * @brief Descriptor of a completed buffer, queued in the data_task instead of its samples (trivial, as
+         * data_task requires).
+         */
+        struct block
+        {
+            const Sample* data; ///< First sample, where the peripheral wrote it.
+            std::size_t count;  ///< Number of valid samples.
+        };
+
+        /**
+         * @brief Allocates the buffers and puts them all in the producer free list.
+         *
+         * @param buffer_samples The capacity of each buffer in samples.
+         * @param hint Kind of memory the buffers come from.
+         */
+        explicit ingest_buffer_pool(std::size_t buffer_samples, alloc_hint hint = alloc_hint::dma)
+            : m_buffer_samples(buffer_samples)
+            , m_storage(make_hinted_unique<std::uint8_t[]>(buffer_count * buffer_samples * sizeof(Sample), hint))
+        {
+            if (m_storage)
+            {
+                for (std::size_t idx = 0U; idx < buffer_count; ++idx)
+                {
+                    m_free_list.at(idx) = static_cast<std::uint32_t>(idx);
+                }
+                m_free_count = buffer_count;
+            }
+        }
+
+        ~ingest_buffer_pool() = default;
+
+        /**
+         * @brief Tells whether the buffers could be allocated.
+         *
+         * @return false when no memory of the requested kind was left.
+         */
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return static_cast<bool>(m_storage);
+        }
+
+        /**
+         * @brief Returns the capacity of each buffer.
+         *
+         * @return The number of samples a buffer holds.
+         */
+        [[nodiscard]] std::size_t buffer_samples() const noexcept
+        {
+            return m_buffer_samples;
+        }
+
+        /**
+         * @brief Takes a free buffer for the peripheral to fill; producer side, ISR safe.
+         *
+         * @return The buffer, or nullptr when every buffer is still queued or being processed (an overrun).
+         */
+        [[nodiscard]] Sample* acquire()
+        {
+            if (0U == m_free_count)
+            {
+                refill_free_list();
+                if (0U == m_free_count)
+                {
+                    m_overruns.fetch_add(1U, std::memory_order_relaxed);
+                    return nullptr;
+                }
+            }
+
+            --m_free_count;
+            return buffer_at(m_free_list.at(m_free_count));
+        }
+
+        /**
+         * @brief Queues a filled buffer into a data_task, or takes it back if the task refuses it; producer side.
+         *
+         * @param task The data_task processing the blocks of this pool.
+         * @param buffer The buffer, as returned by acquire().
+         * @param count The number of samples written, at most buffer_samples().
+         * @return true if the block was queued.
+         */
+        template <typename Task>
+        bool submit(Task& task, Sample* buffer, std::size_t count)
+        {
+            return hand_over(task.submit(make_block(buffer, count)), buffer);
+        }
+
+        /**
+         * @brief Queues a filled buffer into a data_task from an ISR, or takes it back if the task refuses it.
+         *
+         * @param task The data_task processing the blocks of this pool.
+         * @param buffer The buffer, as returned by acquire() from the same ISR.
+         * @param count The number of samples written, at most buffer_samples().
+         * @return true if the block was queued.
+         */
+        template <typename Task>
+        bool isr_submit(Task& task, Sample* buffer, std::size_t count)
+        {
+            return hand_over(task.isr_submit(make_block(buffer, count)), buffer);
+        }
+
+        /**
+         * @brief Puts an acquired buffer back without submitting it; producer side.
+         *
+         * @param buffer The buffer, as returned by acquire().
+         */
+        void abandon(Sample* buffer)
+        {
+            m_free_list.at(m_free_count) = index_of(buffer);
+            ++m_free_count;
+        }
+
+        /**
+         * @brief Hands a processed block back to the producer; consumer side.
+         *
+         * @param processed The block, as received by the data_task.
+         */
+        void release(const block& processed)
+        {
+            // the ring holds every buffer of the pool: it cannot be full
+            (void)m_returned.push(index_of(processed.data));
+        }
+
+        /**
+         * @brief Builds the data_task process routine reading each block in place, then releasing it.
+         *
+         * @tparam Context The context type of the data_task.
+         * @param routine Callable taking the context, a const Sample*, the sample count and the task name.
+         * @return The routine to construct data_task<Context, block> with.
+         */
+        template <typename Context, typename Routine>
+        [[nodiscard]] auto process_routine(Routine&& routine)
+        {
+            return [this, routine = std::forward<Routine>(routine)](const std::shared_ptr<Context>& context,
+                       const block& filled, const std::string& task_name) mutable
+            {
+                routine(context, filled.data, filled.count, task_name);
+                release(filled);
+            };
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Builds the data_task batch routine reading each block of a batch in place, then releasing them.
+         *
+         * @tparam Context The context type of the data_task.
+         * @param routine Callable taking the context, a std::span<const Sample> and the task name, once per block.
+         * @return The batch routine to construct data_task<Context, block> with.
+         */
+        template <typename Context, typename Routine>
+        [[nodiscard]] auto batch_routine(Routine&& routine)
+        {
+            return [this, routine = std::forward<Routine>(routine)](const std::shared_ptr<Context>& context,
+                       std::span<const block> batch, const std::string& task_name) mutable
+            {
+                for (const block& filled : batch)
+                {
+                    routine(context, std::span<const Sample>(filled.data, filled.count), task_name);
+                    release(filled);
+                }
+            };
+        }
+#endif
+
+        /**
+         * @brief Returns the number of buffers in the producer free list; producer side only.
+         *
+         * @return The number of buffers acquire() can hand out without refilling.
+         */
+        [[nodiscard]] std::size_t free_buffers() const
+        {
+            return m_free_count;
+        }
+
+        /**
+         * @brief Returns how many times acquire() found no free buffer.
+         *
+         * @return The overrun count: the consumer did not keep up with the capture.
+         */
+        [[nodiscard]] std::size_t overrun_count() const
+        {
+            return m_overruns.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns how many filled buffers the data_task queue refused.
+         *
+         * @return The dropped buffer count.
+         */
+        [[nodiscard]] std::size_t dropped_count() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        Sample* buffer_at(std::uint32_t index) const
+        {
+            return reinterpret_cast<Sample*>( // NOLINT the storage is raw DMA capable bytes
+                       m_storage.get())
+                + (static_cast<std::size_t>(index) * m_buffer_samples); // NOLINT pointer arithmetic
+        }
+
+        std::uint32_t index_of(const Sample* buffer) const
+        {
+            const auto* base = reinterpret_cast<const Sample*>(m_storage.get()); // NOLINT raw DMA capable bytes
+            return static_cast<std::uint32_t>(static_cast<std::size_t>(buffer - base) / m_buffer_samples);
+        }
+
+        block make_block(const Sample* buffer, std::size_t count) const
+        {
+            return block { buffer, (count < m_buffer_samples) ? count : m_buffer_samples };
+        }
+
+        bool hand_over(bool queued, Sample* buffer)
+        {
+            if (!queued)
+            {
+                abandon(buffer);
+                m_dropped.fetch_add(1U, std::memory_order_relaxed);
+            }
+            return queued;
+        }
+
+        void refill_free_list()
+        {
+            std::uint32_t index = 0U;
+            while ((m_free_count < buffer_count) && m_returned.pop(index))
+            {
+                m_free_list.at(m_free_count) = index;
+                ++m_free_count;
+            }
+        }
+
+        std::size_t m_buffer_samples;
+        hinted_unique_ptr<std::uint8_t[]> m_storage;
+        std::array<std::uint32_t, buffer_count> m_free_list {};
+        std::size_t m_free_count = 0U;
+        // 2^(Pow2 + 1) - 1 usable slots, more than the buffer count
+        lock_free_ring_buffer<std::uint32_t, Pow2 + 1U> m_returned;
+        std::atomic<std::size_t> m_overruns = 0U;
+        std::atomic<std::size_t> m_dropped = 0U;
+    };
+}
+
+#endif //  INGEST_BUFFER_POOL_HPP_
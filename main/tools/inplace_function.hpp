@@ -0,0 +1,209 @@
+/**
+ * @file inplace_function.hpp
+ * @brief Fixed-capacity, move-only callable wrapper storing its target inline.
+ *
+ * This file contains the definition of the inplace_function class template, a std::function replacement that never
+ * allocates: the callable is constructed in an internal buffer, and callables that do not fit are rejected at
+ * compile time.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(INPLACE_FUNCTION_HPP_)
+#define INPLACE_FUNCTION_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tools
+{
+    /**
+     * @brief Default inline capacity of an inplace_function, large enough to wrap a std::function on the supported
+     * toolchains.
+     */
+    constexpr std::size_t inplace_function_default_capacity = 8U * sizeof(void*);
+
+    template <typename Signature, std::size_t Capacity = inplace_function_default_capacity,
+        std::size_t Alignment = alignof(std::max_align_t)>
+    class inplace_function;
+
+    /**
+     * @brief Move-only callable wrapper storing its target in an internal buffer of Capacity bytes.
+     *
+     * @tparam R The return type of the callable.
+     * @tparam Args The argument types of the callable.
+     * @tparam Capacity The size of the internal buffer.
+     * @tparam Alignment The alignment of the internal buffer.
+     */
+    template <typename R, typename... Args, std::size_t Capacity, std::size_t Alignment>
+    class inplace_function<R(Args...), Capacity, Alignment>
+    {
+    public:
+        /**
+         * @brief Tells whether a callable of type F can be stored inline.
+         *
+         * @tparam F The decayed type of the callable.
+         */
+        template <typename F>
+        static constexpr bool is_storable = (sizeof(F) <= Capacity) && (alignof(F) <= Alignment)
+            && std::is_nothrow_move_constructible<F>::value;
+
+        inplace_function() noexcept = default;
+
+        inplace_function(std::nullptr_t /*null*/) noexcept // NOLINT implicit like std::function
+        {
+        }
+
+        /**
+         * @brief Constructs the wrapper from a callable, moved or copied into the internal buffer.
+         *
+         * @param func The callable; it must fit in Capacity bytes and be nothrow move constructible.
+         */
+        template <typename F, typename D = typename std::decay<F>::type,
+            typename = typename std::enable_if<!std::is_same<D, inplace_function>::value
+                && std::is_invocable_r<R, D&, Args...>::value>::type>
+        inplace_function(F&& func) // NOLINT implicit like std::function
+        {
+            static_assert(is_storable<D>, "callable too large or not nothrow movable for this inplace_function");
+            ::new (static_cast<void*>(m_storage.data())) D(std::forward<F>(func));
+            m_ops = &ops_for<D>::value;
+        }
+
+        inplace_function(const inplace_function&) = delete;
+        inplace_function& operator=(const inplace_function&) = delete;
+
+        inplace_function(inplace_function&& other) noexcept
+        {
+            move_from(other);
+        }
+
+        inplace_function& operator=(inplace_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        inplace_function& operator=(std::nullptr_t /*null*/) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        ~inplace_function()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Invokes the stored callable, which must not be empty.
+         *
+         * @param args The arguments forwarded to the callable.
+         * @return The result of the callable.
+         */
+        R operator()(Args... args) const
+        {
+            assert(nullptr != m_ops);
+            return m_ops->invoke(m_storage.data(), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Tells whether a callable is stored.
+         */
+        explicit operator bool() const noexcept
+        {
+            return nullptr != m_ops;
+        }
+
+    private:
+        struct operations
+        {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*move)(void* dst, void* src) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename D>
+        struct ops_for
+        {
+            static R invoke(void* storage, Args&&... args)
+            {
+                return std::invoke(*std::launder(static_cast<D*>(storage)), std::forward<Args>(args)...);
+            }
+
+            static void move(void* dst, void* src) noexcept
+            {
+                D* source = std::launder(static_cast<D*>(src));
+                ::new (dst) D(std::move(*source));
+                source->~D();
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                std::launder(static_cast<D*>(storage))->~D();
+            }
+
+            static constexpr operations value = { &ops_for::invoke, &ops_for::move, &ops_for::destroy };
+        };
+
+        void move_from(inplace_function& other) noexcept
+        {
+            if (nullptr != other.m_ops)
+            {
+                other.m_ops->move(m_storage.data(), other.m_storage.data());
+                m_ops = other.m_ops;
+                other.m_ops = nullptr;
+            }
+        }
+
+        void reset() noexcept
+        {
+            if (nullptr != m_ops)
+            {
+                m_ops->destroy(m_storage.data());
+                m_ops = nullptr;
+            }
+        }
+
+        alignas(Alignment) mutable std::array<std::byte, Capacity> m_storage = {};
+        const operations* m_ops = nullptr;
+    };
+}
+
+#endif //  INPLACE_FUNCTION_HPP_
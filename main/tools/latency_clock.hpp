@@ -0,0 +1,288 @@
+/**
+ * @file latency_clock.hpp
+ * @brief Cheap monotonic stamps for measuring end-to-end delivery latency in the observer pipeline.
+ *
+ * A latency_stamp is a 32-bit reading of the cheapest free-running counter of the platform: the CCOUNT cycle
+ * counter on ESP32, the FreeRTOS tick count elsewhere on FreeRTOS and steady_clock nanoseconds on desktop. Stamps
+ * are compared with modular arithmetic, so an interval is exact as long as it is shorter than one counter wrap
+ * (about 17 s of CCOUNT at 240 MHz, 4.29 s of nanoseconds).
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LATENCY_CLOCK_HPP_)
+#define LATENCY_CLOCK_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "tools/log2_histogram.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_cpu.h>
+#include <esp_rom_sys.h>
+#endif
+#endif
+
+namespace tools
+{
+    /**
+     * @brief A reading of the latency clock; 0 means "not stamped".
+     */
+    using latency_stamp = std::uint32_t;
+
+    /**
+     * @brief Free-running counter used to stamp events along the observer pipeline.
+     */
+    struct latency_clock
+    {
+        /**
+         * @brief Reads the counter.
+         *
+         * The lowest bit is forced to one so that a valid stamp is never 0, at the cost of one tick of resolution.
+         * On ESP32 the CCOUNT registers of the two cores are not synchronized: intervals between stamps taken on
+         * different cores include the offset between the counters.
+         *
+         * @return The current stamp.
+         */
+        [[nodiscard]] static latency_stamp now()
+        {
+#if defined(ESP_PLATFORM)
+            const auto ticks = static_cast<latency_stamp>(esp_cpu_get_cycle_count());
+#elif defined(FREERTOS_PLATFORM)
+            const auto ticks = static_cast<latency_stamp>(xTaskGetTickCount());
+#else
+            const auto ticks = static_cast<latency_stamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+#endif
+            return ticks | 1U;
+        }
+
+        /**
+         * @brief Converts the interval between two stamps into nanoseconds.
+         *
+         * @param from The earlier stamp.
+         * @param to The later stamp.
+         * @return The elapsed nanoseconds, saturated to the 32-bit range.
+         */
+        [[nodiscard]] static std::uint32_t elapsed_ns(latency_stamp from, latency_stamp to)
+        {
+            const std::uint64_t ticks = static_cast<latency_stamp>(to - from);
+#if defined(ESP_PLATFORM)
+            constexpr std::uint64_t ns_per_us = 1000U;
+            const std::uint64_t ns = (ticks * ns_per_us) / esp_rom_get_cpu_ticks_per_us();
+#elif defined(FREERTOS_PLATFORM)
+            constexpr std::uint64_t ns_per_ms = 1000000U;
+            const std::uint64_t ns = ticks * portTICK_PERIOD_MS * ns_per_ms;
+#else
+            const std::uint64_t ns = ticks;
+#endif
+            constexpr std::uint64_t max_ns = UINT32_MAX;
+            return static_cast<std::uint32_t>((ns < max_ns) ? ns : max_ns);
+        }
+    };
+
+    /**
+     * @brief Number of buckets of the delivery latency histograms, covering 1 ns up to 2^31 ns.
+     */
+    inline constexpr std::size_t delivery_latency_buckets = 32U;
+
+    /**
+     * @brief Snapshot of the delivery latencies recorded by one observer, in nanoseconds.
+     *
+     * Queue residency is the difference between the two: delivered.mean() - enqueued.mean() is the mean time an
+     * event waited in the queue of the observer.
+     */
+    struct delivery_latency_stats
+    {
+        log2_histogram_snapshot<delivery_latency_buckets> enqueued;  ///< From publish to enqueue in the observer.
+        log2_histogram_snapshot<delivery_latency_buckets> delivered; ///< From publish to dequeue by the consumer.
+    };
+
+    /**
+     * @brief Records the enqueue and dequeue latencies of the stamped events going through one observer.
+     *
+     * Unstamped events (published without latency stamping) are ignored, so an idle recorder costs one compare per
+     * event. Enqueue samples come from the publishing threads and dequeue samples from the consumer: with several
+     * publishers the min/max of the enqueue histogram are best effort, its counts stay exact.
+     */
+    class delivery_latency_recorder : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        delivery_latency_recorder() = default;
+        ~delivery_latency_recorder() = default;
+
+        /**
+         * @brief Records the publish to enqueue latency of an event.
+         *
+         * @param published The publish stamp carried by the event, 0 when not stamped.
+         */
+        void on_enqueue(latency_stamp published)
+        {
+            if (0U != published)
+            {
+                m_enqueued.add(latency_clock::elapsed_ns(published, latency_clock::now()));
+            }
+        }
+
+        /**
+         * @brief Records the publish to dequeue latency of an event.
+         *
+         * @param published The publish stamp carried by the event, 0 when not stamped.
+         */
+        void on_dequeue(latency_stamp published)
+        {
+            if (0U != published)
+            {
+                m_delivered.add(latency_clock::elapsed_ns(published, latency_clock::now()));
+            }
+        }
+
+        /**
+         * @brief Takes a copy of the latency histograms.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] delivery_latency_stats snapshot() const
+        {
+            return delivery_latency_stats { m_enqueued.snapshot(), m_delivered.snapshot() };
+        }
+
+        /**
+         * @brief Clears the latency histograms.
+         */
+        void reset()
+        {
+            m_enqueued.reset();
+            m_delivered.reset();
+        }
+
+    private:
+        log2_histogram<delivery_latency_buckets> m_enqueued;
+        log2_histogram<delivery_latency_buckets> m_delivered;
+    };
+
+    /**
+     * @brief Records the interrupt to task latency of one ISR hand-off primitive, in nanoseconds.
+     *
+     * The ISR stamps latency_clock::now() into the item it hands over (isr_push, isr_send, isr_submit), or calls
+     * mark() before signaling when the primitive carries no data (isr_signal, task notification). The consuming
+     * task calls on_consume() with the stamp, or on_notified(), as soon as it holds the item. Stamps taken on one
+     * ESP32 core are only comparable with the same core: the consuming task must run on the core serving the
+     * interrupt. A notification marked again before the task woke up counts once, from the latest mark.
+     */
+    class isr_latency_recorder : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Constructs an empty recorder.
+         *
+         * @param name The name of the measured primitive, a string literal.
+         */
+        explicit isr_latency_recorder(const char* name)
+            : m_name(name)
+        {
+        }
+
+        ~isr_latency_recorder() = default;
+
+        /**
+         * @brief Gets the name of the measured primitive.
+         *
+         * @return The name.
+         */
+        [[nodiscard]] const char* name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Stamps a hand-off that carries no data, from the ISR.
+         */
+        void mark()
+        {
+            m_pending.store(latency_clock::now(), std::memory_order_release);
+        }
+
+        /**
+         * @brief Records the latency of a hand-off, from the consuming task.
+         *
+         * @param stamped The stamp taken in the ISR, 0 when not stamped.
+         */
+        void on_consume(latency_stamp stamped)
+        {
+            if (0U != stamped)
+            {
+                m_latency.add(latency_clock::elapsed_ns(stamped, latency_clock::now()));
+            }
+        }
+
+        /**
+         * @brief Records the latency of the last hand-off stamped with mark(), from the notified task.
+         */
+        void on_notified()
+        {
+            on_consume(m_pending.exchange(0U, std::memory_order_acquire));
+        }
+
+        /**
+         * @brief Takes a copy of the latency histogram.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] log2_histogram_snapshot<delivery_latency_buckets> snapshot() const
+        {
+            return m_latency.snapshot();
+        }
+
+        /**
+         * @brief Clears the latency histogram.
+         */
+        void reset()
+        {
+            m_pending.store(0U, std::memory_order_relaxed);
+            m_latency.reset();
+        }
+
+    private:
+        const char* m_name;
+        std::atomic<latency_stamp> m_pending = 0U;
+        log2_histogram<delivery_latency_buckets> m_latency;
+    };
+}
+
+#endif //  LATENCY_CLOCK_HPP_
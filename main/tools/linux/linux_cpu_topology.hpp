@@ -0,0 +1,310 @@
+/**
+ * @file linux_cpu_topology.hpp
+ * @brief CPU topology discovery from sysfs and the scheduler affinity mask on Linux.
+ *
+ * read_cpu_topology() reads, for each logical CPU, its physical core and package from
+ * /sys/devices/system/cpu/cpuN/topology, the CPUs sharing its last level cache from cpuN/cache, and its NUMA
+ * node from /sys/devices/system/node. Missing entries fall back to a flat topology, as in some containers.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_CPU_TOPOLOGY_HPP_)
+#define LINUX_CPU_TOPOLOGY_HPP_
+
+#if defined(__linux__)
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sched.h>
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Topology of one logical CPU as read from sysfs (Linux specific).
+         */
+        struct sysfs_cpu_entry
+        {
+            int logical_id = 0;   ///< Number of the CPU, as used in affinity masks.
+            int core_id = 0;      ///< Core number within the package, shared by SMT siblings.
+            int package_id = 0;   ///< Physical package (socket).
+            int numa_node = 0;    ///< NUMA node holding the CPU.
+            int cache_domain = 0; ///< Lowest CPU sharing the last level cache, -1 - package_id if unknown.
+        };
+
+        /**
+         * @brief Parses a sysfs CPU list such as "0-3,8,10-11".
+         *
+         * @param list The list text.
+         * @return The CPU numbers in increasing order, without duplicates.
+         */
+        inline std::vector<int> parse_cpu_list(const std::string& list)
+        {
+            std::vector<int> cpus;
+            const char* cursor = list.c_str();
+
+            while ('\0' != *cursor)
+            {
+                char* end = nullptr;
+                const long first = std::strtol(cursor, &end, 10);
+
+                if (end == cursor)
+                {
+                    // skip separators and trailing new line
+                    ++cursor;
+                    continue;
+                }
+
+                long last = first;
+                cursor = end;
+
+                if ('-' == *cursor)
+                {
+                    ++cursor;
+                    last = std::strtol(cursor, &end, 10);
+                    cursor = end;
+                }
+
+                for (long cpu = first; (cpu <= last) && (cpu < CPU_SETSIZE); ++cpu)
+                {
+                    cpus.push_back(static_cast<int>(cpu));
+                }
+            }
+
+            std::sort(cpus.begin(), cpus.end());
+            cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+            return cpus;
+        }
+
+        /**
+         * @brief Reads the first line of a sysfs file.
+         *
+         * @param path The file path.
+         * @param text Receives the line without its new line.
+         * @return true if the file could be read.
+         */
+        inline bool read_sysfs_line(const std::string& path, std::string& text)
+        {
+            std::FILE* file = std::fopen(path.c_str(), "r"); // NOLINT sysfs attribute read once
+            if (nullptr == file)
+            {
+                return false;
+            }
+
+            char buffer[256] = {}; // NOLINT sysfs attributes are short
+            const bool read = (nullptr != std::fgets(buffer, sizeof(buffer), file));
+            std::fclose(file); // NOLINT
+            text = read ? std::string(buffer) : std::string();
+
+            while (!text.empty() && (('\n' == text.back()) || (' ' == text.back())))
+            {
+                text.pop_back();
+            }
+
+            return read;
+        }
+
+        /**
+         * @brief Reads an integer sysfs attribute.
+         *
+         * @param path The file path.
+         * @param fallback The value returned when the file is missing or not a number.
+         * @return The attribute value.
+         */
+        inline int read_sysfs_int(const std::string& path, int fallback)
+        {
+            std::string text;
+            if (!read_sysfs_line(path, text) || text.empty())
+            {
+                return fallback;
+            }
+
+            char* end = nullptr;
+            const long value = std::strtol(text.c_str(), &end, 10);
+            return (end == text.c_str()) ? fallback : static_cast<int>(value);
+        }
+
+        /**
+         * @brief Lists the CPUs the calling thread may run on.
+         *
+         * @return The CPU numbers of the affinity mask, or CPU 0 alone if the mask cannot be read.
+         */
+        inline std::vector<int> allowed_cpus()
+        {
+            std::vector<int> cpus;
+            cpu_set_t cpu_set = {};
+            CPU_ZERO(&cpu_set);
+
+            if (0 == sched_getaffinity(0, sizeof(cpu_set), &cpu_set))
+            {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                {
+                    if (CPU_ISSET(cpu, &cpu_set))
+                    {
+                        cpus.push_back(cpu);
+                    }
+                }
+            }
+
+            if (cpus.empty())
+            {
+                cpus.push_back(0);
+            }
+
+            return cpus;
+        }
+
+        /**
+         * @brief Maps each CPU to its NUMA node from the nodeN/cpulist files.
+         *
+         * @param node_root The sysfs node directory (/sys/devices/system/node).
+         * @return NUMA node by CPU number, empty without NUMA information.
+         */
+        inline std::map<int, int> read_numa_nodes(const std::string& node_root)
+        {
+            std::map<int, int> node_of_cpu;
+            DIR* directory = opendir(node_root.c_str());
+
+            if (nullptr == directory)
+            {
+                return node_of_cpu;
+            }
+
+            for (const dirent* entry = readdir(directory); nullptr != entry; entry = readdir(directory))
+            {
+                const std::string name(entry->d_name); // NOLINT dirent name array
+                char* end = nullptr;
+
+                if ((name.size() <= 4U) || (0 != name.compare(0U, 4U, "node")))
+                {
+                    continue;
+                }
+
+                const long node = std::strtol(name.c_str() + 4, &end, 10); // NOLINT pointer arithmetic
+                std::string cpu_list;
+
+                if (('\0' == *end) && read_sysfs_line(node_root + "/" + name + "/cpulist", cpu_list))
+                {
+                    for (const int cpu : parse_cpu_list(cpu_list))
+                    {
+                        node_of_cpu[cpu] = static_cast<int>(node);
+                    }
+                }
+            }
+
+            closedir(directory);
+            return node_of_cpu;
+        }
+
+        /**
+         * @brief Finds the lowest CPU sharing the highest level cache of a CPU.
+         *
+         * @param cpu_dir The sysfs directory of the CPU (/sys/devices/system/cpu/cpuN).
+         * @param fallback The value returned without cache information.
+         * @return The cache domain of the CPU.
+         */
+        inline int read_cache_domain(const std::string& cpu_dir, int fallback)
+        {
+            constexpr int max_cache_indices = 16;
+            int best_level = -1;
+            int domain = fallback;
+
+            for (int index = 0; index < max_cache_indices; ++index)
+            {
+                const std::string cache_dir = cpu_dir + "/cache/index" + std::to_string(index);
+                const int level = read_sysfs_int(cache_dir + "/level", -1);
+                std::string shared;
+
+                if (level < 0)
+                {
+                    break;
+                }
+
+                if ((level > best_level) && read_sysfs_line(cache_dir + "/shared_cpu_list", shared))
+                {
+                    const auto cpus = parse_cpu_list(shared);
+                    if (!cpus.empty())
+                    {
+                        best_level = level;
+                        domain = cpus.front();
+                    }
+                }
+            }
+
+            return domain;
+        }
+
+        /**
+         * @brief Reads the topology of the given CPUs from sysfs.
+         *
+         * @param cpus The CPU numbers to describe, usually allowed_cpus().
+         * @param cpu_root The sysfs CPU directory.
+         * @param node_root The sysfs NUMA node directory.
+         * @return One entry per CPU, in the order of cpus.
+         */
+        inline std::vector<sysfs_cpu_entry> read_cpu_topology(const std::vector<int>& cpus,
+            const std::string& cpu_root = "/sys/devices/system/cpu",
+            const std::string& node_root = "/sys/devices/system/node")
+        {
+            const auto node_of_cpu = read_numa_nodes(node_root);
+            std::vector<sysfs_cpu_entry> entries;
+            entries.reserve(cpus.size());
+
+            for (const int cpu : cpus)
+            {
+                const std::string cpu_dir = cpu_root + "/cpu" + std::to_string(cpu);
+                sysfs_cpu_entry entry;
+
+                entry.logical_id = cpu;
+                // without topology information every CPU is a core of its own
+                entry.core_id = read_sysfs_int(cpu_dir + "/topology/core_id", cpu);
+                entry.package_id = (std::max)(0, read_sysfs_int(cpu_dir + "/topology/physical_package_id", 0));
+
+                const auto node = node_of_cpu.find(cpu);
+                entry.numa_node = (node_of_cpu.end() == node) ? 0 : node->second;
+                entry.cache_domain = read_cache_domain(cpu_dir, -1 - entry.package_id);
+                entries.push_back(entry);
+            }
+
+            return entries;
+        }
+    }
+}
+
+#endif
+
+#endif //  LINUX_CPU_TOPOLOGY_HPP_
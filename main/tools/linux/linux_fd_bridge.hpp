@@ -0,0 +1,370 @@
+/**
+ * @file linux_fd_bridge.hpp
+ * @brief Moves memory_pipe contents to and from Linux file descriptors in batches, straight from the ring storage.
+ *
+ * Draining a pipe into a socket used to take a receive() into a user buffer and a write() per chunk. The bridge
+ * hands the peeked ring regions (both sides of the wrap-around point) to one writev(), and reads from a
+ * descriptor straight into the reserved ring space, so the bytes are never staged and each batch costs one
+ * system call. fd_pipe_bridge runs the transfers on its own thread and reports each batch to a completion sink
+ * such as a data_task.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_FD_BRIDGE_HPP_)
+#define LINUX_FD_BRIDGE_HPP_
+
+#if defined(__linux__)
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <poll.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Outcome of one batch transfer between a memory_pipe and a file descriptor.
+         */
+        struct fd_transfer_result
+        {
+            std::size_t bytes = 0U; ///< Bytes moved.
+            int error = 0;          ///< errno of the failed call, EAGAIN when nothing could move yet, 0 otherwise.
+        };
+
+        /**
+         * @brief Writes the readable bytes of a pipe to a descriptor with one writev() over the two ring regions.
+         *
+         * Only the consumer thread of the pipe may call it. The bytes written are consumed from the pipe.
+         *
+         * @param pipe Source pipe.
+         * @param descriptor Destination descriptor (socket, file, pipe), blocking or not.
+         * @param max_bytes Largest batch.
+         * @return The bytes written; EAGAIN if the pipe is empty or the descriptor would block.
+         */
+        inline fd_transfer_result drain_pipe_to_fd(memory_pipe& pipe, int descriptor, std::size_t max_bytes)
+        {
+            fd_transfer_result result;
+            const auto regions = pipe.peek();
+            const std::size_t head = std::min(regions.first_size, max_bytes);
+            const std::size_t tail = std::min(regions.second_size, max_bytes - head);
+            if (0U == (head + tail))
+            {
+                result.error = EAGAIN;
+                return result;
+            }
+
+            std::array<iovec, 2> vectors = {};
+            vectors[0].iov_base = const_cast<std::uint8_t*>(regions.first); // NOLINT iovec API is not const
+            vectors[0].iov_len = head;
+            vectors[1].iov_base = const_cast<std::uint8_t*>(regions.second); // NOLINT iovec API is not const
+            vectors[1].iov_len = tail;
+
+            ssize_t written = -1;
+            do
+            {
+                written = ::writev(descriptor, vectors.data(), (tail > 0U) ? 2 : 1);
+            } while ((written < 0) && (EINTR == errno));
+
+            if (written < 0)
+            {
+                result.error = (EWOULDBLOCK == errno) ? EAGAIN : errno;
+                return result;
+            }
+
+            result.bytes = pipe.consume(static_cast<std::size_t>(written));
+            return result;
+        }
+
+        /**
+         * @brief Reads from a descriptor straight into the free space of a pipe and publishes the bytes.
+         *
+         * Only the producer thread of the pipe may call it. A batch crossing the wrap-around point takes a second
+         * read() for the part after it.
+         *
+         * @param pipe Destination pipe.
+         * @param descriptor Source descriptor, blocking or not.
+         * @param max_bytes Largest batch.
+         * @return The bytes read; ENOBUFS if the pipe is full, EAGAIN if the descriptor would block, and
+         *         0 bytes without error at end of stream.
+         */
+        inline fd_transfer_result fill_pipe_from_fd(memory_pipe& pipe, int descriptor, std::size_t max_bytes)
+        {
+            fd_transfer_result result;
+            while (result.bytes < max_bytes)
+            {
+                const auto region = pipe.reserve(max_bytes - result.bytes);
+                if (0U == region.size)
+                {
+                    static_cast<void>(pipe.commit(0U));
+                    if (0U == result.bytes)
+                    {
+                        result.error = ENOBUFS;
+                    }
+                    break;
+                }
+
+                ssize_t received = -1;
+                do
+                {
+                    received = ::read(descriptor, region.data, region.size);
+                } while ((received < 0) && (EINTR == errno));
+
+                if (received <= 0)
+                {
+                    static_cast<void>(pipe.commit(0U));
+                    if ((received < 0) && (0U == result.bytes))
+                    {
+                        result.error = (EWOULDBLOCK == errno) ? EAGAIN : errno;
+                    }
+                    break;
+                }
+
+                result.bytes += pipe.commit(static_cast<std::size_t>(received));
+                if (static_cast<std::size_t>(received) < region.size)
+                {
+                    break; // the descriptor has nothing more for now
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Direction of an fd_pipe_bridge.
+         */
+        enum class fd_bridge_direction : std::uint8_t
+        {
+            pipe_to_fd, ///< Drains the pipe into the descriptor (consumer side of the pipe).
+            fd_to_pipe  ///< Fills the pipe from the descriptor (producer side of the pipe).
+        };
+
+        /**
+         * @brief Completion record of one batch, trivial so that a data_task can queue it.
+         */
+        struct fd_bridge_completion
+        {
+            std::uint64_t bytes;           ///< Bytes moved by the batch.
+            std::int32_t error;            ///< errno of a failure that stopped the bridge, 0 otherwise.
+            fd_bridge_direction direction; ///< Direction of the bridge.
+            bool end_of_stream;            ///< The descriptor reached its end (fd_to_pipe), the bridge stopped.
+        };
+
+        /**
+         * @brief Runs batch transfers between a memory_pipe and a descriptor on a dedicated thread.
+         *
+         * Each batch is reported to the sink with `sink.submit(const fd_bridge_completion&)`, which matches
+         * data_task::submit(). The thread waits on the pipe (pipe_to_fd) or polls the descriptor (fd_to_pipe),
+         * and on the descriptor whenever it would block, checking for stop() every poll_interval. The bridge is
+         * the pipe consumer (pipe_to_fd) or producer (fd_to_pipe) while it runs. It stops by itself after an I/O
+         * error or, for fd_to_pipe, at end of stream.
+         *
+         * @tparam CompletionSink Type receiving the completion records.
+         */
+        template <typename CompletionSink>
+        class fd_pipe_bridge : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            static constexpr std::size_t default_batch_bytes = 65536U; ///< Largest transfer of one system call.
+            /** @brief Longest delay before the thread sees stop(). */
+            static constexpr std::chrono::duration<std::uint64_t, std::milli> poll_interval { 20U };
+
+            fd_pipe_bridge() = delete;
+
+            /**
+             * @brief Constructs a bridge, not started.
+             *
+             * @param pipe Pipe, outliving the bridge.
+             * @param descriptor Descriptor, left open by the bridge.
+             * @param direction Direction of the transfers.
+             * @param sink Completion sink outliving the bridge, or nullptr for none.
+             * @param batch_bytes Largest batch.
+             */
+            fd_pipe_bridge(memory_pipe& pipe, int descriptor, fd_bridge_direction direction, CompletionSink* sink,
+                std::size_t batch_bytes = default_batch_bytes)
+                : m_pipe(pipe)
+                , m_descriptor(descriptor)
+                , m_direction(direction)
+                , m_sink(sink)
+                , m_batch_bytes(std::max<std::size_t>(batch_bytes, 1U))
+            {
+            }
+
+            ~fd_pipe_bridge()
+            {
+                stop();
+            }
+
+            /**
+             * @brief Starts the transfer thread.
+             *
+             * @return false if it is already running.
+             */
+            bool start()
+            {
+                if (m_thread.joinable())
+                {
+                    if (m_running.load(std::memory_order_acquire))
+                    {
+                        return false;
+                    }
+                    m_thread.join(); // stopped by itself
+                }
+
+                m_stop.store(false, std::memory_order_release);
+                m_running.store(true, std::memory_order_release);
+                m_thread = std::thread([this]() { run_loop(); });
+                return true;
+            }
+
+            /**
+             * @brief Stops the transfer thread and waits for it; the batch in progress completes first.
+             */
+            void stop()
+            {
+                m_stop.store(true, std::memory_order_release);
+                if (m_thread.joinable())
+                {
+                    m_thread.join();
+                }
+            }
+
+            /**
+             * @brief Checks whether the transfer thread is running.
+             *
+             * @return false before start(), after stop() or once the bridge stopped by itself.
+             */
+            [[nodiscard]] bool running() const
+            {
+                return m_running.load(std::memory_order_acquire);
+            }
+
+            /**
+             * @brief Gets the number of bytes moved since construction.
+             *
+             * @return The byte count.
+             */
+            [[nodiscard]] std::uint64_t transferred() const
+            {
+                return m_transferred.load(std::memory_order_relaxed);
+            }
+
+        private:
+            void run_loop()
+            {
+                while (!m_stop.load(std::memory_order_acquire))
+                {
+                    fd_transfer_result result;
+                    if (fd_bridge_direction::pipe_to_fd == m_direction)
+                    {
+                        if (!m_pipe.wait_for_data(poll_interval))
+                        {
+                            continue;
+                        }
+                        result = drain_pipe_to_fd(m_pipe, m_descriptor, m_batch_bytes);
+                    }
+                    else
+                    {
+                        if (!wait_descriptor(POLLIN))
+                        {
+                            continue;
+                        }
+                        result = fill_pipe_from_fd(m_pipe, m_descriptor, m_batch_bytes);
+                    }
+
+                    if (EAGAIN == result.error)
+                    {
+                        // the descriptor would block: wait for it rather than spin
+                        static_cast<void>(wait_descriptor(
+                            (fd_bridge_direction::pipe_to_fd == m_direction) ? POLLOUT : POLLIN));
+                        continue;
+                    }
+                    if (ENOBUFS == result.error)
+                    {
+                        // the pipe is full: give its consumer time to drain it
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        continue;
+                    }
+
+                    const bool end_of_stream = (fd_bridge_direction::fd_to_pipe == m_direction)
+                        && (0U == result.bytes) && (0 == result.error);
+                    m_transferred.fetch_add(result.bytes, std::memory_order_relaxed);
+                    if (nullptr != m_sink)
+                    {
+                        static_cast<void>(m_sink->submit(fd_bridge_completion { result.bytes,
+                            static_cast<std::int32_t>(result.error), m_direction, end_of_stream }));
+                    }
+                    if (end_of_stream || (0 != result.error))
+                    {
+                        break;
+                    }
+                }
+                m_running.store(false, std::memory_order_release);
+            }
+
+            bool wait_descriptor(short events) const
+            {
+                pollfd entry = {};
+                entry.fd = m_descriptor;
+                entry.events = events;
+                const int ready = ::poll(&entry, 1, static_cast<int>(poll_interval.count()));
+                // an error or hang-up is reported by the next transfer
+                return (ready > 0);
+            }
+
+            memory_pipe& m_pipe;
+            const int m_descriptor;
+            const fd_bridge_direction m_direction;
+            CompletionSink* const m_sink;
+            const std::size_t m_batch_bytes;
+            std::atomic_bool m_stop = false;
+            std::atomic_bool m_running = false;
+            std::atomic<std::uint64_t> m_transferred = 0U;
+            std::thread m_thread;
+        };
+
+    } // namespace linux_os
+} // namespace tools
+
+#endif // __linux__
+
+#endif //  LINUX_FD_BRIDGE_HPP_
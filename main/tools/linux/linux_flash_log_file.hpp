@@ -0,0 +1,205 @@
+/**
+ * @file linux_flash_log_file.hpp
+ * @brief Preallocated file emulating a segmented flash as the storage of a flash event log on Linux.
+ *
+ * flash_log_file gives a flash_event_log the storage interface of a flash partition: a file of fixed size split
+ * into segments, erased to 0xFF, and written with pwrite() followed by fdatasync(), so that a sealed block is on
+ * the disk when flush() returns. An existing file of the right size is reopened as is: the log survives a restart.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_FLASH_LOG_FILE_HPP_)
+#define LINUX_FLASH_LOG_FILE_HPP_
+
+#if defined(__linux__)
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Segmented file storage of a flash_event_log (Linux specific).
+         */
+        class flash_log_file : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            /**
+             * @brief Opens the file, or creates it erased if it is missing or of another size.
+             *
+             * @param path The file path.
+             * @param segment_count The number of segments.
+             * @param segment_size The size of a segment in bytes.
+             * @param page_size The block size in bytes, dividing the segment size.
+             * @param durable Waits for the disk after every write with fdatasync().
+             */
+            flash_log_file(const std::string& path, std::size_t segment_count, std::size_t segment_size,
+                std::size_t page_size = 4096U, bool durable = true)
+                : m_segment_count(segment_count)
+                , m_segment_size(segment_size)
+                , m_page_size(page_size)
+                , m_durable(durable)
+            {
+                m_fd = open(path.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+                if (m_fd < 0)
+                {
+                    return;
+                }
+
+                const std::size_t file_size = segment_count * segment_size;
+                struct stat info = {};
+                const bool reusable
+                    = (0 == fstat(m_fd, &info)) && (static_cast<std::size_t>(info.st_size) == file_size);
+                if (reusable)
+                {
+                    return;
+                }
+
+                // the blocks are preallocated: a write never fails for lack of disk space
+                bool erased
+                    = (0 == ftruncate(m_fd, 0)) && (0 == posix_fallocate(m_fd, 0, static_cast<off_t>(file_size)));
+                for (std::size_t segment = 0U; erased && (segment < segment_count); ++segment)
+                {
+                    erased = erase(segment);
+                }
+                if (!erased)
+                {
+                    close_file();
+                }
+            }
+
+            ~flash_log_file()
+            {
+                close_file();
+            }
+
+            /**
+             * @brief Checks whether the file is open.
+             *
+             * @return True if the file is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return m_fd >= 0;
+            }
+
+            /** @brief Gets the number of segments, 0 if the file could not be opened. */
+            [[nodiscard]] std::size_t segment_count() const
+            {
+                return valid() ? m_segment_count : 0U;
+            }
+
+            /** @brief Gets the size of a segment in bytes. */
+            [[nodiscard]] std::size_t segment_size() const
+            {
+                return m_segment_size;
+            }
+
+            /** @brief Gets the size of a block in bytes. */
+            [[nodiscard]] std::size_t page_size() const
+            {
+                return m_page_size;
+            }
+
+            /** @brief Fills a segment with 0xFF, as a flash erasure. */
+            bool erase(std::size_t segment)
+            {
+                const std::vector<std::uint8_t> erased(m_segment_size, 0xFFU);
+                return write(segment, 0U, erased);
+            }
+
+            /** @brief Writes bytes at an offset of a segment. */
+            bool write(std::size_t segment, std::size_t offset, std::span<const std::uint8_t> bytes)
+            {
+                if (!in_range(segment, offset, bytes.size()))
+                {
+                    return false;
+                }
+
+                const auto position = static_cast<off_t>((segment * m_segment_size) + offset);
+                const bool written
+                    = static_cast<ssize_t>(bytes.size()) == pwrite(m_fd, bytes.data(), bytes.size(), position);
+                return written && (!m_durable || (0 == fdatasync(m_fd)));
+            }
+
+            /** @brief Reads bytes at an offset of a segment. */
+            bool read(std::size_t segment, std::size_t offset, std::span<std::uint8_t> bytes)
+            {
+                if (!in_range(segment, offset, bytes.size()))
+                {
+                    return false;
+                }
+
+                const auto position = static_cast<off_t>((segment * m_segment_size) + offset);
+                return static_cast<ssize_t>(bytes.size()) == pread(m_fd, bytes.data(), bytes.size(), position);
+            }
+
+        private:
+            [[nodiscard]] bool in_range(std::size_t segment, std::size_t offset, std::size_t size) const
+            {
+                return valid() && (segment < m_segment_count) && (offset <= m_segment_size)
+                    && (size <= (m_segment_size - offset));
+            }
+
+            void close_file()
+            {
+                if (m_fd >= 0)
+                {
+                    (void)close(m_fd);
+                    m_fd = -1;
+                }
+            }
+
+            int m_fd = -1;
+            std::size_t m_segment_count;
+            std::size_t m_segment_size;
+            std::size_t m_page_size;
+            bool m_durable;
+        };
+    }
+}
+
+#endif // C++20
+#endif
+
+#endif // LINUX_FLASH_LOG_FILE_HPP_
@@ -0,0 +1,147 @@
+/**
+ * @file linux_futex.hpp
+ * @brief Thin wrappers around the Linux futex system call on a 32-bit atomic word.
+ *
+ * futex_wait()/futex_wake() are process private: waiters and wakers must share the address space. The _shared
+ * variants work on words placed in memory shared between processes, such as a POSIX shared memory segment.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_FUTEX_HPP_)
+#define LINUX_FUTEX_HPP_
+
+#if defined(__linux__)
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace tools
+{
+    namespace linux_os
+    {
+        static_assert((sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t))
+                && std::atomic<std::uint32_t>::is_always_lock_free,
+            "futex words must be plain lock-free 32-bit atomics");
+
+        /**
+         * @brief Blocks while the word holds the expected value (Linux specific).
+         *
+         * The value check and the sleep are atomic with respect to futex_wake(), so a wake issued after the word
+         * changed cannot be missed. May return spuriously: callers re-check their condition.
+         *
+         * @param word The futex word.
+         * @param expected The value the word must hold for the caller to sleep.
+         * @param timeout Relative timeout, or nullptr to wait without limit.
+         * @return False on timeout, true otherwise (woken, value changed, interrupted).
+         */
+        inline bool futex_wait(
+            std::atomic<std::uint32_t>& word, std::uint32_t expected, const struct timespec* timeout = nullptr)
+        {
+            const long ret = syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), // NOLINT futex word address
+                FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+            return (0 == ret) || (ETIMEDOUT != errno);
+        }
+
+        /**
+         * @brief Wakes threads blocked in futex_wait() on the word (Linux specific).
+         *
+         * @param word The futex word.
+         * @param count The maximum number of threads to wake.
+         * @return The number of threads woken.
+         */
+        inline int futex_wake(std::atomic<std::uint32_t>& word, int count)
+        {
+            const long ret = syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), // NOLINT futex word address
+                FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+            return (ret > 0) ? static_cast<int>(ret) : 0;
+        }
+
+        /**
+         * @brief Blocks while a word in process-shared memory holds the expected value (Linux specific).
+         *
+         * Same as futex_wait(), for a word mapped by several processes, possibly at different addresses.
+         *
+         * @param word The futex word.
+         * @param expected The value the word must hold for the caller to sleep.
+         * @param timeout Relative timeout, or nullptr to wait without limit.
+         * @return False on timeout, true otherwise (woken, value changed, interrupted).
+         */
+        inline bool futex_wait_shared(
+            std::atomic<std::uint32_t>& word, std::uint32_t expected, const struct timespec* timeout = nullptr)
+        {
+            const long ret = syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), // NOLINT futex word address
+                FUTEX_WAIT, expected, timeout, nullptr, 0);
+            return (0 == ret) || (ETIMEDOUT != errno);
+        }
+
+        /**
+         * @brief Wakes threads of any process blocked in futex_wait_shared() on the word (Linux specific).
+         *
+         * @param word The futex word.
+         * @param count The maximum number of threads to wake.
+         * @return The number of threads woken.
+         */
+        inline int futex_wake_shared(std::atomic<std::uint32_t>& word, int count)
+        {
+            const long ret = syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), // NOLINT futex word address
+                FUTEX_WAKE, count, nullptr, nullptr, 0);
+            return (ret > 0) ? static_cast<int>(ret) : 0;
+        }
+
+        /**
+         * @brief Converts a duration into a relative futex timeout.
+         *
+         * @param duration The duration, clamped to zero when negative.
+         * @return The timespec.
+         */
+        inline struct timespec to_timespec(std::chrono::nanoseconds duration)
+        {
+            constexpr std::int64_t ns_per_sec = 1000000000;
+            const std::int64_t duration_ns = (duration.count() > 0) ? duration.count() : 0;
+
+            struct timespec spec = {};
+            spec.tv_sec = static_cast<time_t>(duration_ns / ns_per_sec);
+            spec.tv_nsec = static_cast<long>(duration_ns % ns_per_sec);
+            return spec;
+        }
+    }
+}
+
+#endif
+
+#endif // LINUX_FUTEX_HPP_
@@ -0,0 +1,417 @@
+/**
+ * @file linux_huge_pages.hpp
+ * @brief Huge page and locked memory backing of large buffers on Linux.
+ *
+ * A buffer mapped on huge pages covers megabytes with a single TLB entry, so hot pools, rings and pipe buffers
+ * stop thrashing the TLB at high message rates. Explicit pages come from the hugetlbfs pool reserved by the
+ * administrator (vm.nr_hugepages) and fall back to transparent huge pages when it is empty; transparent pages
+ * are requested with madvise(MADV_HUGEPAGE) on a huge page aligned mapping. Either kind can be mlock()ed, so
+ * that it is never swapped out.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_HUGE_PAGES_HPP_)
+#define LINUX_HUGE_PAGES_HPP_
+
+#if defined(__linux__)
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Kind of pages backing a mapping (Linux specific).
+         */
+        enum class huge_page_mode : std::uint8_t
+        {
+            none,          ///< regular pages
+            transparent,   ///< transparent huge pages, madvise(MADV_HUGEPAGE) on a huge page aligned mapping
+            explicit_pages ///< MAP_HUGETLB pages of the reserved pool, transparent pages when it is exhausted
+        };
+
+        /**
+         * @brief How a buffer is backed (Linux specific).
+         */
+        struct huge_page_options
+        {
+            huge_page_mode mode = huge_page_mode::transparent;
+            bool lock = false; ///< mlock() the pages, so that they are resident and never swapped out.
+        };
+
+        /**
+         * @brief What the kernel granted for a buffer (Linux specific).
+         */
+        struct huge_page_status
+        {
+            bool explicit_pages = false; ///< The buffer lives on pages of the reserved hugetlbfs pool.
+            bool advised = false;        ///< madvise(MADV_HUGEPAGE) was accepted on the huge page aligned part.
+            bool locked = false;         ///< mlock() succeeded, within RLIMIT_MEMLOCK.
+        };
+
+        /**
+         * @brief Gets the default huge page size, as reported by /proc/meminfo (Linux specific).
+         *
+         * @return The huge page size in bytes, 2 MiB when it cannot be read.
+         */
+        inline std::size_t huge_page_size()
+        {
+            static const std::size_t size = []()
+            {
+                constexpr std::size_t fallback_size = 2U * 1024U * 1024U;
+                constexpr std::size_t kilo = 1024U;
+                std::size_t result = fallback_size;
+
+                FILE* meminfo = std::fopen("/proc/meminfo", "r");
+                if (nullptr != meminfo)
+                {
+                    char line[128] = {}; // NOLINT C array handed to fgets
+                    unsigned long kilobytes = 0UL;
+                    while (nullptr != std::fgets(line, sizeof(line), meminfo))
+                    {
+                        if ((1 == std::sscanf(line, "Hugepagesize: %lu kB", &kilobytes)) && (0UL != kilobytes))
+                        {
+                            result = static_cast<std::size_t>(kilobytes) * kilo;
+                            break;
+                        }
+                    }
+                    std::fclose(meminfo);
+                }
+                return result;
+            }();
+            return size;
+        }
+
+        /**
+         * @brief Gets the length of the mapping backing a buffer (Linux specific).
+         *
+         * @param size The buffer size in bytes.
+         * @param mode The kind of pages.
+         * @return The size rounded up to a huge page, or to a regular page with huge_page_mode::none.
+         */
+        inline std::size_t huge_page_mapping_size(std::size_t size, huge_page_mode mode)
+        {
+            const long regular_page = sysconf(_SC_PAGESIZE);
+            constexpr std::size_t fallback_page_size = 4096U;
+            const std::size_t granule = (huge_page_mode::none == mode)
+                ? ((regular_page > 0) ? static_cast<std::size_t>(regular_page) : fallback_page_size)
+                : huge_page_size();
+            return ((size + granule - 1U) / granule) * granule;
+        }
+
+        /**
+         * @brief Asks for huge pages and locks an existing region, e.g. a static pool (Linux specific).
+         *
+         * Only the huge page aligned part of the region can be folded into transparent huge pages, a region
+         * aligned and sized on huge pages is entirely covered; explicit pages cannot back an existing region and
+         * are requested as transparent ones. The whole region is locked.
+         *
+         * @param region The region.
+         * @param size The region size in bytes.
+         * @param options The kind of pages and whether to lock them.
+         * @return What the kernel accepted, explicit_pages is always false.
+         */
+        inline huge_page_status advise_huge_pages(void* region, std::size_t size, const huge_page_options& options)
+        {
+            huge_page_status status;
+            if ((nullptr == region) || (0U == size))
+            {
+                return status;
+            }
+
+            const std::uintptr_t huge = huge_page_size();
+            const auto first = reinterpret_cast<std::uintptr_t>(region);
+            const std::uintptr_t aligned_first = ((first + huge - 1U) / huge) * huge;
+            const std::uintptr_t aligned_last = ((first + size) / huge) * huge;
+            if ((huge_page_mode::none != options.mode) && (aligned_last > aligned_first))
+            {
+                status.advised = (0
+                    == madvise(reinterpret_cast<void*>(aligned_first), aligned_last - aligned_first, MADV_HUGEPAGE));
+            }
+
+            if (options.lock)
+            {
+                status.locked = (0 == mlock(region, size));
+            }
+            return status;
+        }
+
+        /**
+         * @brief Maps a zero filled buffer on huge pages (Linux specific).
+         *
+         * The mapping is aligned on a huge page and huge_page_mapping_size() long, it is released with
+         * unmap_huge_pages() given the same size and mode.
+         *
+         * @param size The buffer size in bytes.
+         * @param options The kind of pages and whether to lock them.
+         * @param status Receives what the kernel granted, may be nullptr.
+         * @return The buffer, or nullptr when the mapping failed.
+         */
+        inline void* map_huge_pages(
+            std::size_t size, const huge_page_options& options, huge_page_status* status = nullptr)
+        {
+            huge_page_status granted;
+            const std::size_t length = huge_page_mapping_size(size, options.mode);
+            void* buffer = nullptr;
+
+            if (0U == length)
+            {
+                return nullptr;
+            }
+
+            if (huge_page_mode::explicit_pages == options.mode)
+            {
+                void* mapping
+                    = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (MAP_FAILED != mapping)
+                {
+                    buffer = mapping;
+                    granted.explicit_pages = true;
+                }
+            }
+
+            if (nullptr == buffer)
+            {
+                // over-map by one huge page, then trim both ends so that the buffer starts on a huge page
+                const std::size_t slack = (huge_page_mode::none == options.mode) ? 0U : huge_page_size();
+                void* mapping
+                    = mmap(nullptr, length + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (MAP_FAILED == mapping)
+                {
+                    return nullptr;
+                }
+
+                auto* bytes = static_cast<unsigned char*>(mapping);
+                if (0U != slack)
+                {
+                    const auto address = reinterpret_cast<std::uintptr_t>(mapping);
+                    const auto head = static_cast<std::size_t>((((address + slack - 1U) / slack) * slack) - address);
+                    if (0U != head)
+                    {
+                        munmap(bytes, head);
+                    }
+                    if (slack != head)
+                    {
+                        munmap(bytes + head + length, slack - head); // NOLINT pointer arithmetic
+                    }
+                    bytes += head; // NOLINT pointer arithmetic
+                    granted.advised = (0 == madvise(bytes, length, MADV_HUGEPAGE));
+                }
+                buffer = bytes;
+            }
+
+            if (options.lock)
+            {
+                granted.locked = (0 == mlock(buffer, length));
+            }
+
+            if (nullptr != status)
+            {
+                *status = granted;
+            }
+            return buffer;
+        }
+
+        /**
+         * @brief Releases a buffer of map_huge_pages() (Linux specific).
+         *
+         * @param buffer The buffer, nullptr is ignored.
+         * @param size The buffer size given to map_huge_pages().
+         * @param mode The mode given to map_huge_pages().
+         */
+        inline void unmap_huge_pages(void* buffer, std::size_t size, huge_page_mode mode) noexcept
+        {
+            if (nullptr != buffer)
+            {
+                munmap(buffer, huge_page_mapping_size(size, mode));
+            }
+        }
+
+        /**
+         * @brief Buffer owning a huge page mapping, e.g. the external buffer of a memory_pipe (Linux specific).
+         *
+         * @code
+         * tools::linux_os::huge_page_region region(8U * 1024U * 1024U, { huge_page_mode::explicit_pages, true });
+         * tools::memory_pipe pipe(region.size(), static_cast<std::uint8_t*>(region.data()), nullptr);
+         * @endcode
+         */
+        class huge_page_region : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            huge_page_region() = delete;
+
+            /**
+             * @brief Maps the region.
+             *
+             * @param size The region size in bytes.
+             * @param options The kind of pages and whether to lock them.
+             */
+            huge_page_region(std::size_t size, const huge_page_options& options)
+                : m_size(size)
+                , m_mode(options.mode)
+                , m_data(map_huge_pages(size, options, &m_status))
+            {
+            }
+
+            ~huge_page_region()
+            {
+                unmap_huge_pages(m_data, m_size, m_mode);
+            }
+
+            /**
+             * @brief Checks whether the mapping succeeded.
+             *
+             * @return true if data() can be used.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return nullptr != m_data;
+            }
+
+            [[nodiscard]] void* data() const
+            {
+                return m_data;
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return m_size;
+            }
+
+            /**
+             * @brief Gets what the kernel granted for the region.
+             *
+             * @return The page kind and lock status.
+             */
+            [[nodiscard]] huge_page_status status() const
+            {
+                return m_status;
+            }
+
+        private:
+            std::size_t m_size;
+            huge_page_mode m_mode;
+            huge_page_status m_status = {};
+            void* m_data;
+        };
+
+        /**
+         * @brief Standard allocator mapping each allocation on huge pages (Linux specific).
+         *
+         * Every allocation is its own mapping rounded up to a huge page, so it suits a few large and long lived
+         * buffers, e.g. tools::ring_vector<T, huge_page_allocator<T>>, not node based containers. Two allocators
+         * with the same options are equal.
+         *
+         * @tparam T Element type.
+         */
+        template <typename T>
+        class huge_page_allocator
+        {
+        public:
+            using value_type = T;
+
+            huge_page_allocator() noexcept = default;
+
+            /**
+             * @brief Constructs an allocator with the given options.
+             *
+             * @param options The kind of pages and whether to lock them.
+             */
+            explicit huge_page_allocator(const huge_page_options& options) noexcept
+                : m_options(options)
+            {
+            }
+
+            template <typename U>
+            huge_page_allocator(const huge_page_allocator<U>& other) noexcept // NOLINT implicit rebind conversion
+                : m_options(other.options())
+            {
+            }
+
+            /**
+             * @brief Allocates storage for count elements.
+             *
+             * @param count Number of elements.
+             * @return The storage; throws std::bad_alloc on failure when exceptions are enabled, nullptr otherwise.
+             */
+            [[nodiscard]] T* allocate(std::size_t count)
+            {
+                void* block = map_huge_pages(count * sizeof(T), m_options);
+#if defined(CPP_EXCEPTIONS_ENABLED)
+                if (nullptr == block)
+                {
+                    throw std::bad_alloc();
+                }
+#endif
+                return static_cast<T*>(block);
+            }
+
+            void deallocate(T* ptr, std::size_t count) noexcept
+            {
+                unmap_huge_pages(ptr, count * sizeof(T), m_options.mode);
+            }
+
+            [[nodiscard]] huge_page_options options() const noexcept
+            {
+                return m_options;
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator==(const huge_page_allocator<U>& other) const noexcept
+            {
+                return (m_options.mode == other.options().mode) && (m_options.lock == other.options().lock);
+            }
+
+            template <typename U>
+            [[nodiscard]] bool operator!=(const huge_page_allocator<U>& other) const noexcept
+            {
+                return !(*this == other);
+            }
+
+        private:
+            huge_page_options m_options = {};
+        };
+    }
+}
+
+#endif // __linux__
+
+#endif // LINUX_HUGE_PAGES_HPP_
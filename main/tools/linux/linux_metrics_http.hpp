@@ -0,0 +1,270 @@
+/**
+ * @file linux_metrics_http.hpp
+ * @brief Minimal HTTP endpoint serving a metrics_exporter in OpenMetrics text format (Linux specific).
+ *
+ * A single thread accepts scrape connections on a TCP port and answers GET /metrics with the rendering of the
+ * exporter, then closes the connection. There is no keep-alive, TLS or request body: enough for a Prometheus
+ * scraper on a trusted gateway network, without pulling an HTTP library into the build.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_METRICS_HTTP_HPP_)
+#define LINUX_METRICS_HTTP_HPP_
+
+#if defined(__linux__)
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "tools/metrics_exporter.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Serves GET /metrics from a metrics_exporter on a TCP port (Linux specific).
+         *
+         * The exporter is rendered on the server thread for each scrape, so scrapes never run on a publisher
+         * thread. The exporter must outlive the server.
+         */
+        class metrics_http_server : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            /**
+             * @brief Binds the server to an exporter; start() opens the socket.
+             *
+             * @param exporter The exporter rendered on each scrape.
+             */
+            explicit metrics_http_server(const metrics_exporter& exporter)
+                : m_exporter(exporter)
+            {
+            }
+
+            ~metrics_http_server()
+            {
+                stop();
+            }
+
+            /**
+             * @brief Listens on an address and port and starts the server thread.
+             *
+             * @param port The TCP port, 0 for an ephemeral one reported by port().
+             * @param address The IPv4 address to bind, loopback by default.
+             * @return false if the server is running or the socket could not be bound.
+             */
+            bool start(std::uint16_t port, const std::string& address = "127.0.0.1")
+            {
+                if (m_thread.joinable())
+                {
+                    return false;
+                }
+
+                sockaddr_in endpoint = {};
+                endpoint.sin_family = AF_INET;
+                endpoint.sin_port = htons(port);
+                if (1 != inet_pton(AF_INET, address.c_str(), &endpoint.sin_addr))
+                {
+                    return false;
+                }
+
+                m_listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                if (m_listen_fd < 0)
+                {
+                    return false;
+                }
+                const int reuse = 1;
+                static_cast<void>(setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)));
+
+                socklen_t length = sizeof(endpoint);
+                if ((0 != bind(m_listen_fd, reinterpret_cast<sockaddr*>(&endpoint), sizeof(endpoint))) // NOLINT
+                    || (0 != listen(m_listen_fd, listen_backlog))
+                    || (0 != getsockname(m_listen_fd, reinterpret_cast<sockaddr*>(&endpoint), &length))) // NOLINT
+                {
+                    close(m_listen_fd);
+                    m_listen_fd = -1;
+                    return false;
+                }
+
+                m_port = ntohs(endpoint.sin_port);
+                m_running.store(true, std::memory_order_release);
+                m_thread = std::thread([this]() { serve(); });
+                return true;
+            }
+
+            /**
+             * @brief Stops the server thread and closes the socket; in-flight responses are completed first.
+             */
+            void stop()
+            {
+                m_running.store(false, std::memory_order_release);
+                if (m_thread.joinable())
+                {
+                    m_thread.join();
+                }
+                if (m_listen_fd >= 0)
+                {
+                    close(m_listen_fd);
+                    m_listen_fd = -1;
+                }
+            }
+
+            /**
+             * @brief Gets the bound port, the ephemeral one when started with port 0.
+             *
+             * @return The port, 0 if not started.
+             */
+            [[nodiscard]] std::uint16_t port() const
+            {
+                return m_port;
+            }
+
+            /**
+             * @brief Gets the number of scrapes answered with the metrics.
+             *
+             * @return The scrape count.
+             */
+            [[nodiscard]] std::uint64_t scrapes() const
+            {
+                return m_scrapes.load(std::memory_order_relaxed);
+            }
+
+        private:
+            static constexpr int listen_backlog = 8;
+            static constexpr int poll_interval_ms = 100;
+            static constexpr int request_timeout_ms = 1000;
+            static constexpr std::size_t max_request_size = 4096U;
+
+            void serve()
+            {
+                while (m_running.load(std::memory_order_acquire))
+                {
+                    pollfd listen_poll = { m_listen_fd, POLLIN, 0 };
+                    if (poll(&listen_poll, 1U, poll_interval_ms) <= 0)
+                    {
+                        continue;
+                    }
+                    const int client_fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+                    if (client_fd >= 0)
+                    {
+                        answer(client_fd);
+                        close(client_fd);
+                    }
+                }
+            }
+
+            void answer(int client_fd)
+            {
+                std::string request;
+                if (!read_request_line(client_fd, request))
+                {
+                    return;
+                }
+
+                if ((0U == request.rfind("GET /metrics ", 0U)) || (0U == request.rfind("GET /metrics?", 0U)))
+                {
+                    const std::string body = m_exporter.render();
+                    send_all(client_fd,
+                        "HTTP/1.1 200 OK\r\n"
+                        "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+                        "Content-Length: "
+                            + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body);
+                    m_scrapes.fetch_add(1U, std::memory_order_relaxed);
+                }
+                else
+                {
+                    send_all(client_fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+                }
+            }
+
+            static bool read_request_line(int client_fd, std::string& request)
+            {
+                char buffer[512] = {};
+                while ((std::string::npos == request.find("\r\n")) && (request.size() < max_request_size))
+                {
+                    pollfd client_poll = { client_fd, POLLIN, 0 };
+                    if (poll(&client_poll, 1U, request_timeout_ms) <= 0)
+                    {
+                        return false;
+                    }
+                    const ssize_t received = recv(client_fd, buffer, sizeof(buffer), 0);
+                    if (received <= 0)
+                    {
+                        return false;
+                    }
+                    request.append(buffer, static_cast<std::size_t>(received));
+                }
+                return std::string::npos != request.find("\r\n");
+            }
+
+            static void send_all(int client_fd, const std::string& response)
+            {
+                std::size_t sent = 0U;
+                while (sent < response.size())
+                {
+                    const ssize_t written
+                        = send(client_fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL); // NOLINT
+                    if (written < 0)
+                    {
+                        if (EINTR == errno)
+                        {
+                            continue;
+                        }
+                        return;
+                    }
+                    sent += static_cast<std::size_t>(written);
+                }
+            }
+
+            const metrics_exporter& m_exporter;
+            int m_listen_fd = -1;
+            std::uint16_t m_port = 0U;
+            std::atomic_bool m_running { false };
+            std::atomic<std::uint64_t> m_scrapes { 0U };
+            std::thread m_thread;
+        };
+    }
+}
+
+#endif
+
+#endif // LINUX_METRICS_HTTP_HPP_
@@ -0,0 +1,206 @@
+/**
+ * @file linux_mmap_event_log.hpp
+ * @brief Memory-mapped file backing an event log on Linux.
+ *
+ * mmap_event_log_file maps a file of fixed capacity into memory: an event_log_recorder writes its records straight
+ * into the page cache, so recording costs a memory copy and the kernel writes the pages back in the background.
+ * Opened read-only, the file gives an event_log_replayer its log without reading it into a buffer first.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_MMAP_EVENT_LOG_HPP_)
+#define LINUX_MMAP_EVENT_LOG_HPP_
+
+#if defined(__linux__)
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief File mapped in memory as the storage of an event log (Linux specific).
+         */
+        class mmap_event_log_file : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            /**
+             * @brief Creates (or truncates) a file of the given capacity and maps it for writing.
+             *
+             * @param path The file path.
+             * @param capacity The file size, hence the largest log, in bytes.
+             */
+            mmap_event_log_file(const std::string& path, std::size_t capacity)
+                : m_path(path)
+            {
+                const int fd = open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                if ((0U != capacity) && (0 == ftruncate(fd, static_cast<off_t>(capacity))))
+                {
+                    m_writable = map(fd, capacity, PROT_READ | PROT_WRITE);
+                }
+
+                (void)close(fd);
+            }
+
+            /**
+             * @brief Maps an existing log file for reading.
+             *
+             * @param path The file path.
+             */
+            explicit mmap_event_log_file(const std::string& path)
+                : m_path(path)
+            {
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                struct stat info = {};
+                if ((0 == fstat(fd, &info)) && (info.st_size > 0))
+                {
+                    (void)map(fd, static_cast<std::size_t>(info.st_size), PROT_READ);
+                }
+
+                (void)close(fd);
+            }
+
+            ~mmap_event_log_file()
+            {
+                unmap();
+            }
+
+            /**
+             * @brief Checks whether the file is mapped.
+             *
+             * @return True if the file is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return nullptr != m_base;
+            }
+
+            /**
+             * @brief Gets the mapped bytes to record into.
+             *
+             * @return The writable region, empty for a file opened for reading.
+             */
+            [[nodiscard]] std::span<std::uint8_t> region()
+            {
+                return m_writable ? std::span<std::uint8_t>(m_base, m_size) : std::span<std::uint8_t> {};
+            }
+
+            /**
+             * @brief Gets the mapped bytes to replay.
+             *
+             * @return The file contents, empty if not mapped.
+             */
+            [[nodiscard]] std::span<const std::uint8_t> contents() const
+            {
+                return std::span<const std::uint8_t>(m_base, m_size);
+            }
+
+            /**
+             * @brief Writes the dirty pages back to the file and waits for the write.
+             *
+             * @return True on success.
+             */
+            bool sync()
+            {
+                return m_writable && (0 == msync(m_base, m_size, MS_SYNC));
+            }
+
+            /**
+             * @brief Unmaps the file and cuts it to the length of the recorded log.
+             *
+             * @param size The log size, for instance the size of event_log_recorder::log().
+             * @return True on success; the file is unmapped in any case.
+             */
+            bool close_at(std::size_t size)
+            {
+                const bool writable = m_writable && (size <= m_size);
+                unmap();
+                return writable && (0 == truncate(m_path.c_str(), static_cast<off_t>(size)));
+            }
+
+        private:
+            bool map(int fd, std::size_t size, int protection)
+            {
+                void* base = mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == base) // NOLINT MAP_FAILED is a C-style cast
+                {
+                    return false;
+                }
+                m_base = static_cast<std::uint8_t*>(base);
+                m_size = size;
+                return true;
+            }
+
+            void unmap()
+            {
+                if (nullptr != m_base)
+                {
+                    (void)munmap(m_base, m_size);
+                    m_base = nullptr;
+                    m_size = 0U;
+                }
+                m_writable = false;
+            }
+
+            std::string m_path;
+            std::uint8_t* m_base = nullptr;
+            std::size_t m_size = 0U;
+            bool m_writable = false;
+        };
+    }
+}
+
+#endif // C++20
+#endif
+
+#endif // LINUX_MMAP_EVENT_LOG_HPP_
@@ -0,0 +1,290 @@
+/**
+ * @file linux_realtime.hpp
+ * @brief Real-time scheduling of task threads and process startup preparation on Linux.
+ *
+ * apply_sched_policy() switches the calling thread to SCHED_FIFO, SCHED_RR or SCHED_DEADLINE from a
+ * task_sched_policy. realtime_startup() locks the process memory and prefaults the stack and a heap reserve,
+ * and prefault_memory() touches the buffers of the pools, so that first-touch page faults happen at startup
+ * rather than on the hot paths.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_REALTIME_HPP_)
+#define LINUX_REALTIME_HPP_
+
+#include <cstddef>
+
+#include "tools/base_task.hpp"
+
+#if defined(__linux__)
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include <alloca.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_sched_deadline.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Parameters of realtime_startup() (Linux specific).
+         */
+        struct realtime_startup_params
+        {
+            bool lock_memory = true;               ///< mlockall() the current and future pages.
+            std::size_t stack_bytes = 64U * 1024U; ///< Stack bytes of the calling thread to prefault.
+            std::size_t heap_bytes = 0U;           ///< Heap bytes to prefault and keep in the allocator.
+        };
+
+        /**
+         * @brief Outcome of realtime_startup() (Linux specific).
+         */
+        struct realtime_startup_report
+        {
+            bool memory_locked = false;        ///< mlockall() succeeded.
+            std::size_t stack_prefaulted = 0U; ///< Stack bytes touched.
+            std::size_t heap_prefaulted = 0U;  ///< Heap bytes touched and kept.
+        };
+
+        /**
+         * @brief Gets the page size (Linux specific).
+         *
+         * @return The page size in bytes.
+         */
+        inline std::size_t page_size()
+        {
+            const long size = sysconf(_SC_PAGESIZE);
+            constexpr std::size_t fallback_page_size = 4096U;
+            return (size > 0) ? static_cast<std::size_t>(size) : fallback_page_size;
+        }
+
+        /**
+         * @brief Touches every page of a buffer, keeping its content (Linux specific).
+         *
+         * @param buffer The buffer, e.g. the storage of a memory pool.
+         * @param size The buffer size in bytes.
+         */
+        inline void prefault_memory(void* buffer, std::size_t size)
+        {
+            auto* bytes = static_cast<volatile unsigned char*>(buffer);
+            if (nullptr == bytes)
+            {
+                return;
+            }
+
+            const std::size_t step = page_size();
+            for (std::size_t offset = 0U; offset < size; offset += step)
+            {
+                bytes[offset] = bytes[offset]; // NOLINT write access so that the page is private and present
+            }
+            if (0U != size)
+            {
+                bytes[size - 1U] = bytes[size - 1U];
+            }
+        }
+
+        /**
+         * @brief Touches the stack of the calling thread below the current frame (Linux specific).
+         *
+         * The size is capped to three quarters of the thread stack, as reported by pthread_getattr_np().
+         *
+         * @param bytes The stack bytes to touch.
+         * @return The number of bytes touched.
+         */
+        [[gnu::noinline]] inline std::size_t prefault_stack(std::size_t bytes)
+        {
+            pthread_attr_t attr;
+            if (0 == pthread_getattr_np(pthread_self(), &attr))
+            {
+                void* stack_addr = nullptr;
+                std::size_t stack_size = 0U;
+                if (0 == pthread_attr_getstack(&attr, &stack_addr, &stack_size))
+                {
+                    constexpr std::size_t usable_quarters = 3U;
+                    bytes = std::min(bytes, (stack_size / 4U) * usable_quarters);
+                }
+                pthread_attr_destroy(&attr);
+            }
+
+            if (0U != bytes)
+            {
+                auto* area = static_cast<volatile unsigned char*>(alloca(bytes)); // NOLINT bounded stack probe
+                const std::size_t step = page_size();
+                for (std::size_t offset = 0U; offset < bytes; offset += step)
+                {
+                    area[offset] = 0U; // NOLINT pointer arithmetic
+                }
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Prefaults heap pages and keeps them in the allocator for the next allocations (Linux specific).
+         *
+         * With glibc, trimming and mmap-backed allocations are disabled first, so the freed block stays in the
+         * heap instead of being returned to the kernel.
+         *
+         * @param bytes The heap bytes to reserve.
+         * @return The number of bytes touched.
+         */
+        inline std::size_t reserve_heap(std::size_t bytes)
+        {
+            if (0U == bytes)
+            {
+                return 0U;
+            }
+
+#if defined(__GLIBC__)
+            mallopt(M_TRIM_THRESHOLD, -1);
+            mallopt(M_MMAP_MAX, 0);
+#endif
+            void* block = std::malloc(bytes); // NOLINT raw block handed back to the allocator
+            if (nullptr == block)
+            {
+                return 0U;
+            }
+            prefault_memory(block, bytes);
+            std::free(block); // NOLINT allocated above
+            return bytes;
+        }
+
+        /**
+         * @brief Prepares the process for real-time work, to be called once at startup (Linux specific).
+         *
+         * @param params What to lock and prefault.
+         * @return What was actually done.
+         */
+        inline realtime_startup_report realtime_startup(const realtime_startup_params& params)
+        {
+            realtime_startup_report report;
+            if (params.lock_memory)
+            {
+                report.memory_locked = (0 == mlockall(MCL_CURRENT | MCL_FUTURE));
+            }
+            report.heap_prefaulted = reserve_heap(params.heap_bytes);
+            report.stack_prefaulted = prefault_stack(params.stack_bytes);
+            return report;
+        }
+
+        /**
+         * @brief Gets the scheduling policy of the calling thread (Linux specific).
+         *
+         * @return SCHED_OTHER, SCHED_FIFO, SCHED_RR, SCHED_DEADLINE, ...
+         */
+        inline int current_sched_policy()
+        {
+            return sched_getscheduler(0);
+        }
+    }
+
+    /**
+     * @brief Applies a task_sched_policy to the calling thread (Linux specific).
+     *
+     * @param policy The policy to apply.
+     * @param stack_size The stack bytes prefaulted when the policy asks for it.
+     * @return True if the thread now runs with the requested class (always true for inherit).
+     */
+    inline bool apply_sched_policy(const task_sched_policy& policy, std::size_t stack_size)
+    {
+        bool applied = false;
+
+        switch (policy.sched_class)
+        {
+            case task_sched_class::inherit:
+                applied = true;
+                break;
+
+            case task_sched_class::fifo:
+            case task_sched_class::round_robin:
+            {
+                const int sched_class = (task_sched_class::fifo == policy.sched_class) ? SCHED_FIFO : SCHED_RR;
+                struct sched_param param = {};
+                param.sched_priority = std::clamp(
+                    policy.rt_priority, sched_get_priority_min(sched_class), sched_get_priority_max(sched_class));
+                applied = (0 == pthread_setschedparam(pthread_self(), sched_class, &param));
+                break;
+            }
+
+            case task_sched_class::deadline:
+            {
+                constexpr std::uint64_t nano_sec_coeff = 1000ULL;
+                linux_os::sched_attr attr = {};
+                attr.size = sizeof(attr);
+                attr.sched_policy = SCHED_DEADLINE;
+                attr.sched_runtime = static_cast<std::uint64_t>(policy.runtime.count()) * nano_sec_coeff;
+                attr.sched_deadline = static_cast<std::uint64_t>(policy.deadline.count()) * nano_sec_coeff;
+                attr.sched_period = static_cast<std::uint64_t>(policy.period.count()) * nano_sec_coeff;
+                const auto tid = static_cast<pid_t>(syscall(static_cast<long>(SYS_gettid)));
+                applied = (linux_os::sched_setattr(tid, &attr, 0U) >= 0);
+                break;
+            }
+        }
+
+        if (policy.prefault_stack)
+        {
+            static_cast<void>(linux_os::prefault_stack(stack_size));
+        }
+
+        return applied;
+    }
+}
+
+#else // end if #defined __linux__
+
+namespace tools
+{
+    /**
+     * @brief Applies a task_sched_policy to the calling thread (no real-time classes outside Linux).
+     *
+     * @param policy The policy to apply.
+     * @param stack_size Unused.
+     * @return True only for inherit.
+     */
+    inline bool apply_sched_policy(const task_sched_policy& policy, std::size_t stack_size)
+    {
+        (void)stack_size;
+        return task_sched_class::inherit == policy.sched_class;
+    }
+}
+
+#endif
+
+#endif //  LINUX_REALTIME_HPP_
@@ -0,0 +1,580 @@
+/**
+ * @file linux_shm_pipe.hpp
+ * @brief memory_pipe byte stream between Linux processes, over a named POSIX shared memory segment or a mapped file.
+ *
+ * The ring storage and both indexes live in the mapped segment, so a capture process and an analysis process
+ * stream bytes through it with plain memory copies. A side waiting for data or space sleeps on a futex word of the
+ * segment instead of polling, and the other side only issues the wake system call when someone sleeps. The
+ * interface follows memory_pipe: bulk send/receive with timeouts, zero-copy reserve/commit and peek/consume.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_SHM_PIPE_HPP_)
+#define LINUX_SHM_PIPE_HPP_
+
+#if defined(__linux__)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tools/linux/linux_futex.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Where an shm_memory_pipe keeps its segment (Linux specific).
+         */
+        enum class shm_pipe_storage : std::uint8_t
+        {
+            posix_shm,  ///< Named POSIX shared memory object (name starting with '/'), unlinked by its creator.
+            mapped_file ///< Regular file (name is a path), left on disk.
+        };
+
+        /**
+         * @brief Single-producer, single-consumer byte pipe shared by two processes (Linux specific).
+         *
+         * The process constructing the pipe with a capacity creates the segment; the other process opens it by
+         * name. One thread of one process sends and one thread of one process receives, as with memory_pipe.
+         */
+        class shm_memory_pipe : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            static constexpr std::uint32_t layout_version = 1U;
+
+            /**
+             * @brief Contiguous writable area of the ring returned by reserve().
+             */
+            struct write_region
+            {
+                std::uint8_t* data = nullptr; ///< Start of the writable area.
+                std::size_t size = 0U;        ///< Number of writable bytes.
+            };
+
+            /**
+             * @brief Readable bytes of the ring returned by peek(), split at the wrap-around point.
+             */
+            struct read_regions
+            {
+                const std::uint8_t* first = nullptr;  ///< Oldest readable bytes.
+                std::size_t first_size = 0U;          ///< Number of bytes in the first part.
+                const std::uint8_t* second = nullptr; ///< Bytes following the wrap-around point.
+                std::size_t second_size = 0U;         ///< Number of bytes in the second part.
+
+                [[nodiscard]] std::size_t size() const
+                {
+                    return first_size + second_size;
+                }
+            };
+
+            shm_memory_pipe() = delete;
+
+            /**
+             * @brief Creates (or recreates) the segment.
+             *
+             * @param name The shared memory name, starting with '/', or the file path.
+             * @param capacity The ring size in bytes.
+             * @param storage The kind of segment.
+             */
+            shm_memory_pipe(
+                const std::string& name, std::size_t capacity, shm_pipe_storage storage = shm_pipe_storage::posix_shm)
+                : m_name(name)
+                , m_storage(storage)
+            {
+                const int fd = open_segment(O_CREAT | O_TRUNC | O_RDWR);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                const std::size_t size = sizeof(pipe_header) + capacity;
+                if ((0U != capacity) && (0 == ftruncate(fd, static_cast<off_t>(size))) && map(fd, size))
+                {
+                    m_owner = true;
+                    m_capacity = capacity;
+
+                    auto* header = new (m_base) pipe_header {}; // NOLINT placement in the zeroed segment
+                    header->capacity = capacity;
+                    header->version = layout_version;
+                    header->ready.store(ready_magic, std::memory_order_release);
+                }
+                else
+                {
+                    unlink_segment();
+                }
+
+                (void)close(fd);
+            }
+
+            /**
+             * @brief Opens a segment created by another pipe instance, possibly in another process.
+             *
+             * @param name The shared memory name, starting with '/', or the file path.
+             * @param storage The kind of segment.
+             */
+            explicit shm_memory_pipe(const std::string& name, shm_pipe_storage storage = shm_pipe_storage::posix_shm)
+                : m_name(name)
+                , m_storage(storage)
+            {
+                const int fd = open_segment(O_RDWR);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                struct stat info = {};
+                const bool mapped = (0 == fstat(fd, &info))
+                    && (static_cast<std::size_t>(info.st_size) > sizeof(pipe_header))
+                    && map(fd, static_cast<std::size_t>(info.st_size));
+                (void)close(fd);
+
+                if (mapped)
+                {
+                    const pipe_header& header = *header_ptr();
+                    const bool consistent = (ready_magic == header.ready.load(std::memory_order_acquire))
+                        && (layout_version == header.version) && (0U != header.capacity)
+                        && ((sizeof(pipe_header) + header.capacity) <= m_size);
+
+                    if (consistent)
+                    {
+                        m_capacity = static_cast<std::size_t>(header.capacity);
+                    }
+                    else
+                    {
+                        unmap();
+                    }
+                }
+            }
+
+            ~shm_memory_pipe()
+            {
+                unmap();
+                if (m_owner && (shm_pipe_storage::posix_shm == m_storage))
+                {
+                    unlink_segment();
+                }
+            }
+
+            /**
+             * @brief Checks whether the segment is created or opened, and mapped.
+             *
+             * @return True if the pipe is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return 0U != m_capacity;
+            }
+
+            /**
+             * @brief Gets the ring size.
+             *
+             * @return The capacity in bytes, or 0 when not valid.
+             */
+            [[nodiscard]] std::size_t capacity() const
+            {
+                return m_capacity;
+            }
+
+            /**
+             * @brief Gets the number of bytes sent and not yet received.
+             *
+             * @return The readable byte count.
+             */
+            [[nodiscard]] std::size_t size() const
+            {
+                if (!valid())
+                {
+                    return 0U;
+                }
+                const pipe_header& header = *header_ptr();
+                return static_cast<std::size_t>(header.push_index.load(std::memory_order_acquire)
+                    - header.pop_index.load(std::memory_order_acquire));
+            }
+
+            /**
+             * @brief Sends bytes, waiting for ring space as long as needed up to the timeout.
+             *
+             * @param data The bytes to send.
+             * @param send_bytes The number of bytes to send.
+             * @param timeout The maximum duration to wait for space.
+             * @return The number of bytes sent.
+             */
+            [[nodiscard]] std::size_t send(const std::uint8_t* data, std::size_t send_bytes,
+                const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+            {
+                std::size_t sent = 0U;
+                if ((nullptr == data) || !valid())
+                {
+                    return sent;
+                }
+
+                const auto deadline = std::chrono::steady_clock::now() + timeout;
+                while (sent < send_bytes)
+                {
+                    const auto region = reserve(send_bytes - sent);
+                    if (0U == region.size)
+                    {
+                        if (!wait_for_space(deadline))
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+                    std::memcpy(region.data, data + sent, region.size); // NOLINT pointer arithmetic
+                    sent += commit(region.size);
+                }
+
+                return sent;
+            }
+
+            /**
+             * @brief Receives bytes, waiting for them as long as needed up to the timeout.
+             *
+             * @param data The destination buffer.
+             * @param rcv_bytes The number of bytes to receive.
+             * @param timeout The maximum duration to wait for data.
+             * @return The number of bytes received.
+             */
+            [[nodiscard]] std::size_t receive(std::uint8_t* data, std::size_t rcv_bytes,
+                const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+            {
+                std::size_t received = 0U;
+                if ((nullptr == data) || !valid())
+                {
+                    return received;
+                }
+
+                const auto deadline = std::chrono::steady_clock::now() + timeout;
+                while (received < rcv_bytes)
+                {
+                    const auto regions = peek();
+                    if (0U == regions.size())
+                    {
+                        if (!wait_until_data(deadline))
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+                    const std::size_t head = std::min(regions.first_size, rcv_bytes - received);
+                    const std::size_t tail = std::min(regions.second_size, rcv_bytes - received - head);
+                    std::memcpy(data + received, regions.first, head);         // NOLINT pointer arithmetic
+                    std::memcpy(data + received + head, regions.second, tail); // NOLINT pointer arithmetic
+                    received += consume(head + tail);
+                }
+
+                return received;
+            }
+
+            /**
+             * @brief Reserves writable space directly in the shared ring (zero-copy producer path).
+             *
+             * The region is contiguous and can be smaller than asked when the free space wraps around the end of
+             * the ring; the remainder can be reserved again after commit().
+             *
+             * @param reserve_bytes Number of bytes wanted.
+             * @return The writable region, empty if the ring is full.
+             */
+            [[nodiscard]] write_region reserve(std::size_t reserve_bytes)
+            {
+                write_region region;
+                if (!valid())
+                {
+                    return region;
+                }
+
+                const pipe_header& header = *header_ptr();
+                const std::uint64_t snap_write_idx = header.push_index.load(std::memory_order_relaxed);
+                const std::uint64_t snap_read_idx = header.pop_index.load(std::memory_order_acquire);
+
+                const auto free_bytes = static_cast<std::size_t>(m_capacity - (snap_write_idx - snap_read_idx));
+                const auto offset = static_cast<std::size_t>(snap_write_idx % m_capacity);
+
+                region.size = std::min({ reserve_bytes, free_bytes, m_capacity - offset });
+                region.data = (region.size > 0U) ? (ring() + offset) : nullptr; // NOLINT pointer arithmetic
+                m_reserved_bytes = region.size;
+
+                return region;
+            }
+
+            /**
+             * @brief Publishes bytes written in the region returned by the last reserve() call.
+             *
+             * @param commit_bytes Number of bytes written, clamped to the reserved size.
+             * @return The number of bytes made visible to the consumer.
+             */
+            std::size_t commit(std::size_t commit_bytes)
+            {
+                const std::size_t committed = std::min(commit_bytes, m_reserved_bytes);
+                m_reserved_bytes = 0U;
+
+                if (committed > 0U)
+                {
+                    pipe_header& header = *header_ptr();
+                    const std::uint64_t snap_write_idx = header.push_index.load(std::memory_order_relaxed);
+                    header.push_index.store(snap_write_idx + committed, std::memory_order_seq_cst);
+                    wake(header.data_seq, header.data_sleepers);
+                }
+
+                return committed;
+            }
+
+            /**
+             * @brief Exposes the readable bytes in place (zero-copy consumer path).
+             *
+             * @return The readable regions, empty if the ring is empty.
+             */
+            [[nodiscard]] read_regions peek() const
+            {
+                read_regions regions;
+                if (!valid())
+                {
+                    return regions;
+                }
+
+                const pipe_header& header = *header_ptr();
+                const std::uint64_t snap_read_idx = header.pop_index.load(std::memory_order_relaxed);
+                const std::uint64_t snap_write_idx = header.push_index.load(std::memory_order_acquire);
+
+                const auto available = static_cast<std::size_t>(snap_write_idx - snap_read_idx);
+                const auto offset = static_cast<std::size_t>(snap_read_idx % m_capacity);
+
+                regions.first_size = std::min(available, m_capacity - offset);
+                regions.second_size = available - regions.first_size;
+                regions.first = (regions.first_size > 0U) ? (ring() + offset) : nullptr; // NOLINT pointer arithmetic
+                regions.second = (regions.second_size > 0U) ? ring() : nullptr;
+
+                return regions;
+            }
+
+            /**
+             * @brief Releases bytes previously exposed by peek().
+             *
+             * @param consume_bytes Number of bytes processed, clamped to the readable size.
+             * @return The number of bytes released.
+             */
+            std::size_t consume(std::size_t consume_bytes)
+            {
+                if (!valid())
+                {
+                    return 0U;
+                }
+
+                pipe_header& header = *header_ptr();
+                const std::uint64_t snap_read_idx = header.pop_index.load(std::memory_order_relaxed);
+                const std::uint64_t snap_write_idx = header.push_index.load(std::memory_order_acquire);
+
+                const std::size_t consumed
+                    = std::min(consume_bytes, static_cast<std::size_t>(snap_write_idx - snap_read_idx));
+
+                if (consumed > 0U)
+                {
+                    header.pop_index.store(snap_read_idx + consumed, std::memory_order_seq_cst);
+                    wake(header.space_seq, header.space_sleepers);
+                }
+
+                return consumed;
+            }
+
+            /**
+             * @brief Waits until bytes are readable, without consuming them (consumer side, before peek()).
+             *
+             * @param timeout Maximum duration to wait.
+             * @return true if bytes are readable.
+             */
+            bool wait_for_data(const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+            {
+                return valid() && wait_until_data(std::chrono::steady_clock::now() + timeout);
+            }
+
+        private:
+            static constexpr std::uint32_t ready_magic = 0x50534d50U; // "PSMP"
+
+            /**
+             * @brief Segment header, followed by the ring bytes; each side's index and futex word on its own line.
+             */
+            struct alignas(64) pipe_header
+            {
+                std::atomic<std::uint32_t> ready { 0U };
+                std::uint32_t version = 0U;
+                std::uint64_t capacity = 0U;
+                alignas(64) std::atomic<std::uint64_t> push_index { 0U };
+                std::atomic<std::uint32_t> data_seq { 0U };
+                std::atomic<std::uint32_t> data_sleepers { 0U };
+                alignas(64) std::atomic<std::uint64_t> pop_index { 0U };
+                std::atomic<std::uint32_t> space_seq { 0U };
+                std::atomic<std::uint32_t> space_sleepers { 0U };
+            };
+
+            static_assert(std::atomic<std::uint64_t>::is_always_lock_free
+                    && std::atomic<std::uint32_t>::is_always_lock_free,
+                "shared memory atomics must be lock free to be address free");
+
+            [[nodiscard]] int open_segment(int flags) const
+            {
+                return (shm_pipe_storage::posix_shm == m_storage)
+                    ? shm_open(m_name.c_str(), flags, S_IRUSR | S_IWUSR)
+                    : open(m_name.c_str(), flags, S_IRUSR | S_IWUSR); // NOLINT vararg POSIX call
+            }
+
+            void unlink_segment() const
+            {
+                if (shm_pipe_storage::posix_shm == m_storage)
+                {
+                    (void)shm_unlink(m_name.c_str());
+                }
+                else
+                {
+                    (void)unlink(m_name.c_str());
+                }
+            }
+
+            bool map(int fd, std::size_t size)
+            {
+                void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == base) // NOLINT MAP_FAILED is a C-style cast
+                {
+                    return false;
+                }
+                m_base = static_cast<std::uint8_t*>(base);
+                m_size = size;
+                return true;
+            }
+
+            void unmap()
+            {
+                if (nullptr != m_base)
+                {
+                    (void)munmap(m_base, m_size);
+                    m_base = nullptr;
+                    m_size = 0U;
+                }
+                m_capacity = 0U;
+            }
+
+            [[nodiscard]] pipe_header* header_ptr() const
+            {
+                return std::launder(reinterpret_cast<pipe_header*>(m_base)); // NOLINT segment layout
+            }
+
+            [[nodiscard]] std::uint8_t* ring() const
+            {
+                return m_base + sizeof(pipe_header); // NOLINT pointer arithmetic
+            }
+
+            static void wake(std::atomic<std::uint32_t>& seq, const std::atomic<std::uint32_t>& sleepers)
+            {
+                // the index store is seq_cst: a sleeper registered before it is seen here, a later one sees it
+                if (0U != sleepers.load(std::memory_order_seq_cst))
+                {
+                    seq.fetch_add(1U, std::memory_order_release);
+                    (void)futex_wake_shared(seq, INT_MAX);
+                }
+            }
+
+            template <typename Ready>
+            static bool sleep_until(std::atomic<std::uint32_t>& seq, std::atomic<std::uint32_t>& sleepers,
+                std::chrono::steady_clock::time_point deadline, const Ready& ready)
+            {
+                while (!ready())
+                {
+                    const auto current_time = std::chrono::steady_clock::now();
+                    if (current_time >= deadline)
+                    {
+                        return false;
+                    }
+
+                    // announce the sleeper before the last look, so that a concurrent index store either is seen
+                    // here or wakes this side
+                    sleepers.fetch_add(1U, std::memory_order_seq_cst);
+                    const std::uint32_t wake_seq = seq.load(std::memory_order_acquire);
+                    if (!ready())
+                    {
+                        const struct timespec spec = to_timespec(deadline - current_time);
+                        (void)futex_wait_shared(seq, wake_seq, &spec);
+                    }
+                    sleepers.fetch_sub(1U, std::memory_order_seq_cst);
+                }
+                return true;
+            }
+
+            bool wait_until_data(std::chrono::steady_clock::time_point deadline)
+            {
+                pipe_header& header = *header_ptr();
+                return sleep_until(header.data_seq, header.data_sleepers, deadline,
+                    [&header]()
+                    {
+                        return header.push_index.load(std::memory_order_seq_cst)
+                            != header.pop_index.load(std::memory_order_relaxed);
+                    });
+            }
+
+            bool wait_for_space(std::chrono::steady_clock::time_point deadline)
+            {
+                pipe_header& header = *header_ptr();
+                const std::uint64_t capacity = m_capacity;
+                return sleep_until(header.space_seq, header.space_sleepers, deadline,
+                    [&header, capacity]()
+                    {
+                        return (header.push_index.load(std::memory_order_relaxed)
+                                   - header.pop_index.load(std::memory_order_seq_cst))
+                            < capacity;
+                    });
+            }
+
+            std::string m_name;
+            shm_pipe_storage m_storage;
+            std::uint8_t* m_base = nullptr;
+            std::size_t m_size = 0U;
+            std::size_t m_capacity = 0U;
+            std::size_t m_reserved_bytes = 0U;
+            bool m_owner = false;
+        };
+    }
+}
+
+#endif
+
+#endif // LINUX_SHM_PIPE_HPP_
@@ -0,0 +1,702 @@
+/**
+ * @file linux_shm_transport.hpp
+ * @brief Publish/subscribe transport between Linux processes over a POSIX shared memory broadcast ring.
+ *
+ * A publishing process creates a named shm segment holding a ring of fixed-size slots; each slot is written once
+ * by the publisher and read by every subscribing process through its own cursor, with a per-slot sequence number
+ * (seqlock) detecting slots overwritten while being read. Subscribers sleep on a futex word of the segment and
+ * the publisher only issues the wake system call when one of them sleeps. The publisher never waits for the
+ * subscribers: a subscriber lagging by more than the ring size skips the overwritten events and counts them.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_SHM_TRANSPORT_HPP_)
+#define LINUX_SHM_TRANSPORT_HPP_
+
+#if defined(__linux__)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tools/critical_section.hpp"
+#include "tools/linux/linux_futex.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief Read position of one subscriber in a shm_broadcast_ring (Linux specific).
+         */
+        struct shm_ring_reader
+        {
+            std::uint64_t cursor = 0U; ///< Sequence number of the next record to read.
+            std::uint64_t lost = 0U;   ///< Records overwritten before being read, or not matching the read layout.
+        };
+
+        /**
+         * @brief Single-publisher, multi-subscriber ring of records in a named POSIX shared memory segment (Linux
+         * specific).
+         *
+         * A record is a head (e.g. the topic) and a body (the event, or bytepack-serialized bytes) copied into one
+         * slot. The process constructing the ring with a geometry creates the segment and unlinks it on
+         * destruction; other processes open it by name. Records are written by one thread at a time.
+         */
+        class shm_broadcast_ring : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            static constexpr std::uint32_t layout_version = 1U;
+
+            /**
+             * @brief Creates (or recreates) the named segment.
+             *
+             * @param name The segment name, starting with '/'.
+             * @param slot_count The number of slots, rounded up to a power of two.
+             * @param slot_payload The maximal head plus body size of a record in bytes.
+             */
+            shm_broadcast_ring(const std::string& name, std::size_t slot_count, std::size_t slot_payload)
+                : m_name(name)
+            {
+                std::size_t count = 1U;
+                while (count < slot_count)
+                {
+                    count <<= 1U;
+                }
+
+                const std::size_t stride = sizeof(slot_header) + round_up(slot_payload);
+                const std::size_t size = sizeof(ring_header) + (count * stride);
+
+                const int fd = shm_open(name.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                if ((0 == ftruncate(fd, static_cast<off_t>(size))) && map(fd, size))
+                {
+                    m_owner = true;
+                    m_slot_count = count;
+                    m_slot_stride = stride;
+
+                    auto* header = new (m_base) ring_header {}; // NOLINT placement in the zeroed segment
+                    header->slot_count = static_cast<std::uint32_t>(count);
+                    header->slot_stride = static_cast<std::uint32_t>(stride);
+                    header->version = layout_version;
+                    for (std::size_t i = 0U; i < count; ++i)
+                    {
+                        new (slot_at(i)) slot_header {}; // NOLINT placement in the zeroed segment
+                    }
+                    header->ready.store(ready_magic, std::memory_order_release);
+                }
+                else
+                {
+                    (void)shm_unlink(name.c_str());
+                }
+
+                (void)close(fd);
+            }
+
+            /**
+             * @brief Opens a segment created by another ring instance, possibly in another process.
+             *
+             * @param name The segment name, starting with '/'.
+             */
+            explicit shm_broadcast_ring(const std::string& name)
+                : m_name(name)
+            {
+                const int fd = shm_open(name.c_str(), O_RDWR, 0);
+                if (fd < 0)
+                {
+                    return;
+                }
+
+                struct stat info = {};
+                const bool mapped = (0 == fstat(fd, &info))
+                    && (static_cast<std::size_t>(info.st_size) >= sizeof(ring_header))
+                    && map(fd, static_cast<std::size_t>(info.st_size));
+                (void)close(fd);
+
+                if (mapped)
+                {
+                    const ring_header& header = *header_ptr();
+                    const std::size_t count = header.slot_count;
+                    const std::size_t stride = header.slot_stride;
+                    const bool consistent = (ready_magic == header.ready.load(std::memory_order_acquire))
+                        && (layout_version == header.version) && (0U != count) && (0U == (count & (count - 1U)))
+                        && (stride > sizeof(slot_header)) && ((sizeof(ring_header) + (count * stride)) <= m_size);
+
+                    if (consistent)
+                    {
+                        m_slot_count = count;
+                        m_slot_stride = stride;
+                    }
+                    else
+                    {
+                        unmap();
+                    }
+                }
+            }
+
+            ~shm_broadcast_ring()
+            {
+                unmap();
+                if (m_owner)
+                {
+                    (void)shm_unlink(m_name.c_str());
+                }
+            }
+
+            /**
+             * @brief Checks whether the segment is created or opened, and mapped.
+             *
+             * @return True if the ring is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return 0U != m_slot_count;
+            }
+
+            /**
+             * @brief Gets the number of slots.
+             *
+             * @return The slot count, a power of two, or 0 when not valid.
+             */
+            [[nodiscard]] std::size_t slot_count() const
+            {
+                return m_slot_count;
+            }
+
+            /**
+             * @brief Gets the maximal head plus body size of a record.
+             *
+             * @return The slot payload in bytes, or 0 when not valid.
+             */
+            [[nodiscard]] std::size_t slot_payload() const
+            {
+                return valid() ? (m_slot_stride - sizeof(slot_header)) : 0U;
+            }
+
+            /**
+             * @brief Gets the number of records written since the segment creation.
+             *
+             * @return The sequence number of the next record.
+             */
+            [[nodiscard]] std::uint64_t published() const
+            {
+                return valid() ? header_ptr()->head.load(std::memory_order_acquire) : 0U;
+            }
+
+            /**
+             * @brief Copies a record into the next slot, overwriting the oldest record when the ring is full.
+             *
+             * @param head The head bytes.
+             * @param head_size The head size.
+             * @param body The body bytes.
+             * @param body_size The body size.
+             * @return False if the ring is not valid or the record does not fit in a slot.
+             */
+            bool write(const void* head, std::size_t head_size, const void* body, std::size_t body_size)
+            {
+                if (!valid() || ((head_size + body_size) > slot_payload()))
+                {
+                    return false;
+                }
+
+                ring_header& header = *header_ptr();
+                const std::uint64_t sequence = header.head.load(std::memory_order_relaxed);
+                slot_header& slot = *slot_at(sequence & (m_slot_count - 1U));
+
+                // odd while writing: a reader overlapping the copy sees the sequence change and retries
+                slot.seq.store((2U * sequence) + 1U, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot.head_size.store(static_cast<std::uint32_t>(head_size), std::memory_order_relaxed);
+                slot.body_size.store(static_cast<std::uint32_t>(body_size), std::memory_order_relaxed);
+                std::memcpy(payload_of(slot), head, head_size);
+                std::memcpy(payload_of(slot) + head_size, body, body_size); // NOLINT pointer arithmetic
+                slot.seq.store((2U * sequence) + 2U, std::memory_order_release);
+
+                header.head.store(sequence + 1U, std::memory_order_seq_cst);
+                if (0U != header.sleepers.load(std::memory_order_seq_cst))
+                {
+                    header.wake_seq.fetch_add(1U, std::memory_order_release);
+                    (void)futex_wake_shared(header.wake_seq, INT_MAX);
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Creates a reader positioned after the last record written, so that it reads the next ones.
+             *
+             * @return The reader.
+             */
+            [[nodiscard]] shm_ring_reader make_reader() const
+            {
+                return shm_ring_reader { published(), 0U };
+            }
+
+            /**
+             * @brief Copies out the next record of a reader.
+             *
+             * Records overwritten before being copied out, and records whose head size differs from head_size or
+             * whose body exceeds body_capacity, are skipped and counted in reader.lost.
+             *
+             * @param reader The reader position, advanced past the records read or skipped.
+             * @param head Destination of the head bytes.
+             * @param head_size The expected head size.
+             * @param body Destination of the body bytes.
+             * @param body_capacity The body destination size.
+             * @param body_size Receives the body size.
+             * @return True if a record was copied out, false if no record is available.
+             */
+            bool read(shm_ring_reader& reader, void* head, std::size_t head_size, void* body, std::size_t body_capacity,
+                std::size_t& body_size)
+            {
+                if (!valid())
+                {
+                    return false;
+                }
+
+                const ring_header& header = *header_ptr();
+                for (;;)
+                {
+                    const std::uint64_t published_records = header.head.load(std::memory_order_acquire);
+                    if (reader.cursor >= published_records)
+                    {
+                        return false;
+                    }
+
+                    if ((published_records - reader.cursor) > m_slot_count)
+                    {
+                        // lapped: the oldest records still in the ring start one ring size behind the head
+                        reader.lost += (published_records - reader.cursor) - m_slot_count;
+                        reader.cursor = published_records - m_slot_count;
+                    }
+
+                    const slot_header& slot = *slot_at(reader.cursor & (m_slot_count - 1U));
+                    const std::uint64_t expected = (2U * reader.cursor) + 2U;
+                    if (expected != slot.seq.load(std::memory_order_acquire))
+                    {
+                        // being overwritten by a later record: resynchronize on the head
+                        ++reader.lost;
+                        ++reader.cursor;
+                        continue;
+                    }
+
+                    const std::size_t record_head = slot.head_size.load(std::memory_order_relaxed);
+                    const std::size_t record_body = slot.body_size.load(std::memory_order_relaxed);
+                    const bool fits = (record_head == head_size) && (record_body <= body_capacity)
+                        && ((record_head + record_body) <= slot_payload());
+                    if (fits)
+                    {
+                        std::memcpy(head, payload_of(slot), head_size);
+                        std::memcpy(body, payload_of(slot) + head_size, record_body); // NOLINT pointer arithmetic
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    const bool intact = (expected == slot.seq.load(std::memory_order_relaxed));
+                    ++reader.cursor;
+
+                    if (intact && fits)
+                    {
+                        body_size = record_body;
+                        return true;
+                    }
+                    ++reader.lost;
+                }
+            }
+
+            /**
+             * @brief Blocks until a record is available to a reader, or the timeout elapses.
+             *
+             * @param reader The reader position.
+             * @param timeout The maximal wait.
+             * @return True if a record is available.
+             */
+            bool wait(const shm_ring_reader& reader, std::chrono::nanoseconds timeout)
+            {
+                if (!valid())
+                {
+                    return false;
+                }
+
+                ring_header& header = *header_ptr();
+                if (header.head.load(std::memory_order_acquire) > reader.cursor)
+                {
+                    return true;
+                }
+
+                // announce the sleeper before the last look, so that a concurrent write either is seen here or
+                // wakes this reader
+                header.sleepers.fetch_add(1U, std::memory_order_seq_cst);
+                const std::uint32_t wake_seq = header.wake_seq.load(std::memory_order_acquire);
+                bool available = header.head.load(std::memory_order_seq_cst) > reader.cursor;
+                if (!available)
+                {
+                    const struct timespec spec = to_timespec(timeout);
+                    (void)futex_wait_shared(header.wake_seq, wake_seq, &spec);
+                    available = header.head.load(std::memory_order_acquire) > reader.cursor;
+                }
+                header.sleepers.fetch_sub(1U, std::memory_order_seq_cst);
+
+                return available;
+            }
+
+        private:
+            static constexpr std::uint32_t ready_magic = 0x50534d52U; // "PSMR"
+            static constexpr std::size_t payload_alignment = 8U;
+
+            /**
+             * @brief Segment header, followed by the slots.
+             */
+            struct alignas(64) ring_header
+            {
+                std::atomic<std::uint32_t> ready { 0U };
+                std::uint32_t version = 0U;
+                std::uint32_t slot_count = 0U;
+                std::uint32_t slot_stride = 0U;
+                std::atomic<std::uint64_t> head { 0U };
+                std::atomic<std::uint32_t> wake_seq { 0U };
+                std::atomic<std::uint32_t> sleepers { 0U };
+            };
+
+            /**
+             * @brief Slot header, followed by the record head and body bytes.
+             */
+            struct slot_header
+            {
+                std::atomic<std::uint64_t> seq { 0U };
+                std::atomic<std::uint32_t> head_size { 0U };
+                std::atomic<std::uint32_t> body_size { 0U };
+            };
+
+            static_assert(std::atomic<std::uint64_t>::is_always_lock_free
+                    && std::atomic<std::uint32_t>::is_always_lock_free,
+                "shared memory atomics must be lock free to be address free");
+            static_assert((sizeof(slot_header) % payload_alignment) == 0U, "slot payloads must stay aligned");
+
+            static std::size_t round_up(std::size_t size)
+            {
+                return (size + payload_alignment - 1U) & ~(payload_alignment - 1U);
+            }
+
+            bool map(int fd, std::size_t size)
+            {
+                void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == base) // NOLINT MAP_FAILED is a C-style cast
+                {
+                    return false;
+                }
+                m_base = static_cast<unsigned char*>(base);
+                m_size = size;
+                return true;
+            }
+
+            void unmap()
+            {
+                if (nullptr != m_base)
+                {
+                    (void)munmap(m_base, m_size);
+                    m_base = nullptr;
+                    m_size = 0U;
+                }
+                m_slot_count = 0U;
+            }
+
+            [[nodiscard]] ring_header* header_ptr() const
+            {
+                return std::launder(reinterpret_cast<ring_header*>(m_base)); // NOLINT segment layout
+            }
+
+            [[nodiscard]] slot_header* slot_at(std::size_t index) const
+            {
+                return std::launder(reinterpret_cast<slot_header*>( // NOLINT segment layout
+                    m_base + sizeof(ring_header) + (index * m_slot_stride))); // NOLINT pointer arithmetic
+            }
+
+            static unsigned char* payload_of(const slot_header& slot)
+            {
+                // NOLINTNEXTLINE the payload follows the slot header in the mapped segment
+                return const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(&slot) + sizeof(slot_header));
+            }
+
+            std::string m_name;
+            unsigned char* m_base = nullptr;
+            std::size_t m_size = 0U;
+            std::size_t m_slot_count = 0U;
+            std::size_t m_slot_stride = 0U;
+            bool m_owner = false;
+        };
+
+        /**
+         * @brief Observer exporting the events it is informed of to a shm_broadcast_ring it creates (Linux
+         * specific).
+         *
+         * Subscribe it to the topics of a local sync_subject that other processes need; each event is copied once,
+         * into the segment. Topic and event must be trivially copyable; a raw publish_bytes() carries
+         * bytepack-serialized payloads.
+         *
+         * @tparam Topic The type of the topic.
+         * @tparam Evt The type of the event.
+         * @tparam Origin The type of the origin, not transported.
+         */
+        template <typename Topic, typename Evt, typename Origin = std::string>
+        class shm_publisher : public sync_observer<Topic, Evt, Origin>
+        {
+        public:
+            static_assert(std::is_trivially_copyable_v<Topic>, "shared memory topics must be trivially copyable");
+            static_assert(std::is_trivially_copyable_v<Evt>, "shared memory events must be trivially copyable");
+
+            /**
+             * @brief Creates the named segment.
+             *
+             * @param segment_name The segment name, starting with '/'.
+             * @param slot_count The number of events the ring keeps for lagging subscribers.
+             * @param max_body_size The maximal body size, at least sizeof(Evt), for publish_bytes() payloads.
+             */
+            shm_publisher(const std::string& segment_name, std::size_t slot_count, std::size_t max_body_size = 0U)
+                : m_ring(segment_name, slot_count, sizeof(Topic) + std::max(max_body_size, sizeof(Evt)))
+            {
+            }
+
+            ~shm_publisher() override = default;
+
+            /**
+             * @brief Copies the event into the segment.
+             *
+             * @param topic The topic of the event.
+             * @param event The event.
+             * @param origin The origin, not transported.
+             */
+            void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+            {
+                (void)origin;
+                (void)publish_bytes(topic, &event, sizeof(Evt));
+            }
+
+            /**
+             * @brief Copies a serialized payload into the segment.
+             *
+             * @param topic The topic of the payload.
+             * @param data The payload bytes.
+             * @param size The payload size.
+             * @return False if the payload does not fit in a slot or the segment is not valid.
+             */
+            bool publish_bytes(const Topic& topic, const void* data, std::size_t size)
+            {
+                bool written = false;
+                {
+                    std::scoped_lock<tools::critical_section> guard(m_mutex);
+                    written = m_ring.write(&topic, sizeof(Topic), data, size);
+                }
+
+                if (!written)
+                {
+                    m_dropped.fetch_add(1U, std::memory_order_relaxed);
+                }
+                return written;
+            }
+
+            /**
+             * @brief Checks whether the segment could be created.
+             *
+             * @return True if the publisher is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return m_ring.valid();
+            }
+
+            /**
+             * @brief Gets the number of events not exported, because they did not fit or the segment is not valid.
+             *
+             * @return The dropped event count.
+             */
+            [[nodiscard]] std::size_t dropped_count() const
+            {
+                return m_dropped.load(std::memory_order_relaxed);
+            }
+
+        private:
+            tools::critical_section m_mutex;
+            shm_broadcast_ring m_ring;
+            std::atomic<std::size_t> m_dropped = 0U;
+        };
+
+        /**
+         * @brief Reader of the events exported by a shm_publisher of another process (Linux specific).
+         *
+         * Reads the events published after its construction and forwards them to callbacks or to a local
+         * sync_subject, whose observers (async_observer included) then receive them as local events. One
+         * thread at a time reads through a subscriber.
+         *
+         * @tparam Topic The type of the topic.
+         * @tparam Evt The type of the event.
+         * @tparam Origin The origin type of the local subject.
+         */
+        template <typename Topic, typename Evt, typename Origin = std::string>
+        class shm_subscriber : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            static_assert(std::is_trivially_copyable_v<Topic>, "shared memory topics must be trivially copyable");
+            static_assert(std::is_trivially_copyable_v<Evt>, "shared memory events must be trivially copyable");
+
+            /**
+             * @brief Opens the named segment.
+             *
+             * @param segment_name The segment name, starting with '/'.
+             */
+            explicit shm_subscriber(const std::string& segment_name)
+                : m_ring(segment_name)
+                , m_reader(m_ring.make_reader())
+                , m_buffer(m_ring.valid() ? (m_ring.slot_payload() - sizeof(Topic)) : 0U)
+            {
+            }
+
+            ~shm_subscriber() = default;
+
+            /**
+             * @brief Checks whether the segment could be opened.
+             *
+             * @return True if the subscriber is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return m_ring.valid();
+            }
+
+            /**
+             * @brief Blocks until an event is available, or the timeout elapses.
+             *
+             * @param timeout The maximal wait.
+             * @return True if an event is available.
+             */
+            bool wait_for_events(std::chrono::nanoseconds timeout)
+            {
+                return m_ring.wait(m_reader, timeout);
+            }
+
+            /**
+             * @brief Reads the available events and hands each one to a callback.
+             *
+             * @param on_event Called with (const Topic&, const Evt&); payloads of another size are skipped.
+             * @return The number of events handed.
+             */
+            template <typename EventFn>
+            std::size_t poll(EventFn&& on_event)
+            {
+                std::size_t count = 0U;
+                Topic topic {};
+                Evt event {};
+                std::size_t size = 0U;
+                while (m_ring.read(m_reader, &topic, sizeof(Topic), &event, sizeof(Evt), size))
+                {
+                    if (sizeof(Evt) != size)
+                    {
+                        ++m_reader.lost;
+                        continue;
+                    }
+                    on_event(topic, event);
+                    ++count;
+                }
+                return count;
+            }
+
+            /**
+             * @brief Reads the available payloads, e.g. bytepack-serialized, and hands each one to a callback.
+             *
+             * @param on_payload Called with (const Topic&, const std::uint8_t* data, std::size_t size).
+             * @return The number of payloads handed.
+             */
+            template <typename PayloadFn>
+            std::size_t poll_bytes(PayloadFn&& on_payload)
+            {
+                std::size_t count = 0U;
+                Topic topic {};
+                std::size_t size = 0U;
+                while (m_ring.read(m_reader, &topic, sizeof(Topic), m_buffer.data(), m_buffer.size(), size))
+                {
+                    on_payload(topic, m_buffer.data(), size);
+                    ++count;
+                }
+                return count;
+            }
+
+            /**
+             * @brief Republishes the available events into a local subject.
+             *
+             * @param subject The local subject.
+             * @return The number of events republished.
+             */
+            std::size_t forward_to(sync_subject<Topic, Evt, Origin>& subject)
+            {
+                return poll([&subject](const Topic& topic, const Evt& event) { subject.publish(topic, event); });
+            }
+
+            /**
+             * @brief Gets the number of events skipped because they were overwritten before being read.
+             *
+             * @return The lost event count.
+             */
+            [[nodiscard]] std::uint64_t lost_events() const
+            {
+                return m_reader.lost;
+            }
+
+        private:
+            shm_broadcast_ring m_ring;
+            shm_ring_reader m_reader;
+            std::vector<std::uint8_t> m_buffer;
+        };
+    }
+}
+
+#endif
+
+#endif // LINUX_SHM_TRANSPORT_HPP_
@@ -0,0 +1,158 @@
+/**
+ * @file linux_timerfd.hpp
+ * @brief RAII wrapper around a Linux timerfd on CLOCK_MONOTONIC.
+ *
+ * The wrapper arms, disarms and waits on a timer file descriptor, so that a thread can sleep until a deadline
+ * with the kernel high-resolution timers rather than the coarser condition variable timeouts.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LINUX_TIMERFD_HPP_)
+#define LINUX_TIMERFD_HPP_
+
+#if defined(__linux__)
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    namespace linux_os
+    {
+        /**
+         * @brief A one-shot CLOCK_MONOTONIC timerfd (Linux specific).
+         *
+         * arm() and disarm() may be called from any thread, including while another thread is blocked in wait().
+         */
+        class monotonic_timerfd : public non_copyable // NOLINT inherits from non copyable/non movable class
+        {
+        public:
+            monotonic_timerfd()
+                : m_fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC))
+            {
+            }
+
+            ~monotonic_timerfd()
+            {
+                if (valid())
+                {
+                    (void)close(m_fd);
+                }
+            }
+
+            /**
+             * @brief Checks whether the timer file descriptor could be created.
+             *
+             * @return True if the timerfd is usable.
+             */
+            [[nodiscard]] bool valid() const
+            {
+                return m_fd >= 0;
+            }
+
+            /**
+             * @brief Arms the timer to expire once after a delay (a null or negative delay expires at once).
+             *
+             * @param delay The delay before expiry.
+             * @return True on success.
+             */
+            bool arm(std::chrono::nanoseconds delay)
+            {
+                constexpr std::int64_t ns_per_sec = 1000000000;
+                // a zero it_value would disarm the timer, expire after 1 ns instead
+                const std::int64_t delay_ns = (delay.count() > 0) ? delay.count() : 1;
+
+                struct itimerspec spec = {};
+                spec.it_value.tv_sec = static_cast<time_t>(delay_ns / ns_per_sec);
+                spec.it_value.tv_nsec = static_cast<long>(delay_ns % ns_per_sec);
+                return 0 == timerfd_settime(m_fd, 0, &spec, nullptr);
+            }
+
+            /**
+             * @brief Disarms the timer; a thread blocked in wait() keeps waiting until the next arm().
+             *
+             * @return True on success.
+             */
+            bool disarm()
+            {
+                struct itimerspec spec = {};
+                return 0 == timerfd_settime(m_fd, 0, &spec, nullptr);
+            }
+
+            /**
+             * @brief Blocks until the timer expires.
+             *
+             * @return The number of expirations since the last wait, or 0 on error.
+             */
+            std::uint64_t wait()
+            {
+                std::uint64_t expirations = 0U;
+                ssize_t ret = -1;
+                do
+                {
+                    ret = read(m_fd, &expirations, sizeof(expirations));
+                } while ((ret < 0) && (EINTR == errno));
+
+                return (static_cast<ssize_t>(sizeof(expirations)) == ret) ? expirations : 0U;
+            }
+
+            /**
+             * @brief Gets the resolution of CLOCK_MONOTONIC as reported by the kernel.
+             *
+             * @return The clock resolution.
+             */
+            [[nodiscard]] static std::chrono::nanoseconds clock_resolution()
+            {
+                struct timespec res = {};
+                if (0 != clock_getres(CLOCK_MONOTONIC, &res))
+                {
+                    return std::chrono::nanoseconds(0);
+                }
+
+                return std::chrono::seconds(res.tv_sec) + std::chrono::nanoseconds(res.tv_nsec);
+            }
+
+        private:
+            int m_fd = -1;
+        };
+    }
+}
+
+#endif
+
+#endif // LINUX_TIMERFD_HPP_
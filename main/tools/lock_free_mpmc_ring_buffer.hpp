@@ -0,0 +1,392 @@
+/**
+ * @file lock_free_mpmc_ring_buffer.hpp
+ * @brief A bounded lock-free ring buffer for multiple producers and multiple consumers.
+ *
+ * This header file contains a bounded MPMC queue using one sequence number per slot
+ * (Dmitry Vyukov's design). Producers and consumers only contend on a single atomic
+ * index each and never block.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LOCK_FREE_MPMC_RING_BUFFER_HPP_)
+#define LOCK_FREE_MPMC_RING_BUFFER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#include <span>
+#endif
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    // https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+
+    /**
+     * @brief A lock-free ring buffer supporting multiple producers and multiple consumers.
+     *
+     * Each slot carries a sequence number telling whether it is ready to be written for the current lap or
+     * ready to be read. A push or pop claims its slot with a single compare-exchange on the shared index and
+     * then publishes the slot by a release store of its sequence. Unlike lock_free_ring_buffer, all
+     * 2^Pow2 slots are usable.
+     *
+     * No operation ever waits for another thread: a pop racing with a preempted producer whose slot is not
+     * published yet reports an empty buffer, and a push facing an unconsumed slot reports a full one.
+     * This keeps push/pop usable from an ISR without risk of spinning on the preempted task.
+     *
+     * Slot sequences are stored relative to the slot index, so a zero-initialized instance is a valid empty
+     * buffer: a global instance is constant-initialized and usable before dynamic initialization runs
+     * (e.g. from a replaced global operator new).
+     *
+     * @tparam T The type of elements stored in the ring buffer.
+     * @tparam Pow2 The power of 2 that determines the size of the ring buffer.
+     */
+    template <typename T, std::size_t Pow2>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        requires std::is_standard_layout_v<T> && std::is_trivial_v<T> && (std::is_scalar_v<T> || std::is_pointer_v<T>)
+#endif
+    class lock_free_mpmc_ring_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_standard_layout<T>::value, "T has to provide standard layout");
+        static_assert(std::is_trivial<T>::value, "T has to be trivial type");
+        static_assert(std::is_scalar<T>::value || std::is_pointer<T>::value, "T has to be scalar or pointer");
+
+        struct thread_safe
+        {
+            // Multiple Producers - Multiple Consumers
+            static constexpr bool value = true;
+        };
+
+        lock_free_mpmc_ring_buffer() = default;
+        ~lock_free_mpmc_ring_buffer() = default;
+
+        /**
+         * @brief Pushes a copy of an element into the ring buffer.
+         *
+         * @param elem The element to be pushed into the ring buffer.
+         * @return true if the element was successfully pushed, false if the buffer is full.
+         */
+        [[nodiscard]] bool push(const T& elem)
+        {
+            return push_val(elem);
+        }
+
+        /**
+         * @brief Pushes an rvalue element into the ring buffer.
+         *
+         * @param elem The rvalue element to be pushed into the ring buffer.
+         * @return true if the element was successfully pushed, false if the buffer is full.
+         */
+        [[nodiscard]] bool push(T&& elem)
+        {
+            return push_val(std::move(elem));
+        }
+
+        /**
+         * @brief Pushes an element into the ring buffer with perfect forwarding.
+         *
+         * In C++20, this method is constrained to only accept constructible types.
+         *
+         * @tparam U The type of the element (deduced, supports conversions).
+         * @param elem The element to be forwarded and pushed into the ring buffer.
+         * @return true if the element was successfully pushed, false if the buffer is full.
+         */
+        template <typename U>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, U>
+#endif
+        [[nodiscard]] auto push(U&& elem)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
+#endif
+        {
+            return push_val(T(std::forward<U>(elem)));
+        }
+
+        /**
+         * @brief Pops an element from the ring buffer.
+         *
+         * @param elem Reference to the element where the popped value will be stored.
+         * @return true if an element was successfully popped, false if the buffer is empty.
+         */
+        bool pop(T& elem)
+        {
+            std::size_t position = m_pop_index.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                const std::size_t slot_index = position & ring_buffer_mask;
+                auto& current_slot = m_slots.at(slot_index);
+                const std::size_t sequence = current_slot.sequence.load(std::memory_order_acquire) + slot_index;
+                const auto lag = static_cast<std::ptrdiff_t>(sequence - (position + 1U));
+
+                if (lag == 0)
+                {
+                    if (m_pop_index.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                    {
+                        elem = current_slot.value;
+                        // hand the slot over to the producers of the next lap
+                        current_slot.sequence.store(position + ring_buffer_size - slot_index, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    // slot not published yet: empty
+                    return false;
+                }
+                else
+                {
+                    position = m_pop_index.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Pops an element from the ring buffer and returns it wrapped in std::optional.
+         *
+         * @return An optional containing the popped element, or std::nullopt if empty.
+         */
+        [[nodiscard]] std::optional<T> pop_opt()
+        {
+            T elem {};
+            if (pop(elem))
+            {
+                return elem;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Pushes all elements from a range into the ring buffer.
+         *
+         * Returns the count of elements actually pushed; fewer may be pushed if
+         * the buffer becomes full before the range is exhausted.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param range The source range of elements to push.
+         * @return The number of elements successfully pushed.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange> && std::is_constructible_v<T, std::ranges::range_value_t<TRange>>
+#endif
+        [[nodiscard]] std::size_t push_range(TRange&& range)
+        {
+            std::size_t pushed_count = 0U;
+            for (auto&& elem : std::forward<TRange>(range))
+            {
+                if (push(T(std::forward<decltype(elem)>(elem))))
+                {
+                    ++pushed_count;
+                }
+            }
+            return pushed_count;
+        }
+
+        /**
+         * @brief Pushes all elements from an initializer-list into the ring buffer.
+         *
+         * @tparam U The initializer-list element type.
+         * @param range The source initializer-list.
+         * @return The number of elements successfully pushed.
+         */
+        template <typename U
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T, const U&>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, const U&>
+#endif
+        [[nodiscard]] std::size_t push_range(std::initializer_list<U> range)
+        {
+            std::size_t pushed_count = 0U;
+            for (const auto& elem : range)
+            {
+                if (push(T(elem)))
+                {
+                    ++pushed_count;
+                }
+            }
+            return pushed_count;
+        }
+
+        /**
+         * @brief Pops a batch of elements into an output range.
+         *
+         * Extracts up to the destination capacity, stopping early if the buffer becomes empty.
+         * With several consumers, the batch is not guaranteed to be contiguous in FIFO order.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The effective number of elements extracted.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            std::size_t popped_count = 0U;
+            while (first != last)
+            {
+                T elem {};
+                if (!pop(elem))
+                {
+                    break;
+                }
+                *first = elem;
+                ++first;
+                ++popped_count;
+            }
+            return popped_count;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch pop into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The effective number of elements extracted.
+         */
+        [[nodiscard]] std::size_t pop_range(std::span<T> destination)
+        {
+            return pop_range(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Tells whether the buffer looks empty; a snapshot while producers or consumers are active.
+         *
+         * @return true if no element is claimed by a producer and not yet claimed by a consumer.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == size();
+        }
+
+        /**
+         * @brief Returns the number of queued elements; a snapshot while producers or consumers are active.
+         *
+         * Counts the slots claimed by producers and not yet claimed by consumers, including pushes still
+         * being published.
+         *
+         * @return The number of elements in the buffer, at most capacity().
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            // pop index first: it never overtakes the push index read after it
+            const std::size_t pop_position = m_pop_index.load(std::memory_order_acquire);
+            const std::size_t push_position = m_push_index.load(std::memory_order_acquire);
+            return (std::min)(push_position - pop_position, ring_buffer_size);
+        }
+
+        /**
+         * @brief Returns the capacity of the ring buffer.
+         *
+         * @return The capacity of the ring buffer (2^Pow2, all usable).
+         */
+        [[nodiscard]] constexpr std::size_t capacity() const
+        {
+            return 1U << Pow2;
+        }
+
+    private:
+        static constexpr const std::size_t ring_buffer_size = (1U << Pow2);
+        static constexpr const std::size_t ring_buffer_mask = (ring_buffer_size - 1U);
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        struct slot
+        {
+            // sequence minus slot index, see class description
+            std::atomic<std::size_t> sequence { 0U };
+            T value {};
+        };
+
+        bool push_val(T elem)
+        {
+            std::size_t position = m_push_index.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                const std::size_t slot_index = position & ring_buffer_mask;
+                auto& current_slot = m_slots.at(slot_index);
+                const std::size_t sequence = current_slot.sequence.load(std::memory_order_acquire) + slot_index;
+                const auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+
+                if (lag == 0)
+                {
+                    if (m_push_index.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                    {
+                        current_slot.value = elem;
+                        // publish the slot to the consumers
+                        current_slot.sequence.store(position + 1U - slot_index, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    // slot of the previous lap not consumed yet: full
+                    return false;
+                }
+                else
+                {
+                    position = m_push_index.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::array<slot, ring_buffer_size> m_slots {};
+        // producers and consumers hammer distinct indices: keep them on distinct cache lines
+        alignas(cache_line_size) std::atomic<std::size_t> m_push_index = 0U;
+        alignas(cache_line_size) std::atomic<std::size_t> m_pop_index = 0U;
+    };
+}
+
+#endif //  LOCK_FREE_MPMC_RING_BUFFER_HPP_
@@ -0,0 +1,433 @@
+/**
+ * @file lock_free_object_ring_buffer.hpp
+ * @brief A lock-free single producer/single consumer ring buffer for arbitrary object types.
+ *
+ * This header file contains an SPSC ring buffer storing its elements in raw aligned slots, so move-only and
+ * large types (std::vector frames, std::unique_ptr, structures) can be queued by value without wrapping them
+ * in pointers. Batch operations publish a whole range with a single index store.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LOCK_FREE_OBJECT_RING_BUFFER_HPP_)
+#define LOCK_FREE_OBJECT_RING_BUFFER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#include <span>
+#endif
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A lock-free ring buffer for one producer and one consumer, holding any movable type.
+     *
+     * Unlike lock_free_ring_buffer, whose slots are std::atomic<T>, elements live in raw storage: the
+     * producer constructs an element in place and publishes it with a release store of its index, the consumer
+     * moves it out, destroys it and releases the slot the same way. All 2^Pow2 slots are usable. The producer
+     * and consumer indices sit on separate cache lines, each with a cached copy of the opposite index that is
+     * only reloaded when the buffer looks full (producer) or empty (consumer).
+     *
+     * push_range() and pop_range() construct or consume a whole batch and then publish it with one index
+     * store, so the other side sees the batch at once and pays a single cache line transfer. If a constructor
+     * or an assignment throws, the elements completed so far are still published and the exception propagates.
+     *
+     * Elements left in the buffer are destroyed with it.
+     *
+     * @tparam T The type of elements stored in the ring buffer, move constructible.
+     * @tparam Pow2 The power of 2 that determines the size of the ring buffer.
+     */
+    template <typename T, std::size_t Pow2>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        requires std::is_move_constructible_v<T> && std::is_destructible_v<T>
+#endif
+    class lock_free_object_ring_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_move_constructible<T>::value, "T has to be move constructible");
+
+        struct thread_safe
+        {
+            // Single Producer - Single Consumer only
+            static constexpr bool value = false;
+        };
+
+        lock_free_object_ring_buffer() = default;
+
+        /**
+         * @brief Destroys the elements still queued.
+         */
+        ~lock_free_object_ring_buffer()
+        {
+            const std::size_t write_idx = m_producer.index.load(std::memory_order_acquire);
+            for (std::size_t read_idx = m_consumer.index.load(std::memory_order_relaxed); read_idx != write_idx;
+                 ++read_idx)
+            {
+                element(read_idx)->~T();
+            }
+        }
+
+        /**
+         * @brief Pushes a copy of an element into the ring buffer.
+         *
+         * @param elem The element to be copied into the ring buffer.
+         * @return true if the element was pushed, false if the buffer is full.
+         */
+        [[nodiscard]] bool push(const T& elem)
+        {
+            return emplace(elem);
+        }
+
+        /**
+         * @brief Moves an element into the ring buffer.
+         *
+         * @param elem The element to be moved into the ring buffer.
+         * @return true if the element was pushed, false if the buffer is full (elem is left untouched).
+         */
+        [[nodiscard]] bool push(T&& elem)
+        {
+            return emplace(std::move(elem));
+        }
+
+        /**
+         * @brief Constructs an element in place at the back of the ring buffer.
+         *
+         * @tparam Args The constructor argument types.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return true if the element was constructed, false if the buffer is full (args are not consumed).
+         */
+        template <typename... Args>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, Args...>
+#endif
+        [[nodiscard]] bool emplace(Args&&... args)
+        {
+            const std::size_t write_idx = m_producer.index.load(std::memory_order_relaxed);
+            if (0U == writable(write_idx))
+            {
+                return false;
+            }
+
+            ::new (slot_address(write_idx)) T(std::forward<Args>(args)...);
+            m_producer.index.store(write_idx + 1U, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Moves the front element out of the ring buffer.
+         *
+         * @param elem Receives the popped element by move assignment.
+         * @return true if an element was popped, false if the buffer is empty.
+         */
+        bool pop(T& elem)
+        {
+            const std::size_t read_idx = m_consumer.index.load(std::memory_order_relaxed);
+            if (0U == readable(read_idx))
+            {
+                return false;
+            }
+
+            T* front = element(read_idx);
+            elem = std::move(*front);
+            front->~T();
+            m_consumer.index.store(read_idx + 1U, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Moves the front element out of the ring buffer.
+         *
+         * @return The popped element, or std::nullopt if the buffer is empty.
+         */
+        [[nodiscard]] std::optional<T> try_pop()
+        {
+            const std::size_t read_idx = m_consumer.index.load(std::memory_order_relaxed);
+            if (0U == readable(read_idx))
+            {
+                return std::nullopt;
+            }
+
+            T* front = element(read_idx);
+            std::optional<T> elem(std::move(*front));
+            front->~T();
+            m_consumer.index.store(read_idx + 1U, std::memory_order_release);
+
+            return elem;
+        }
+
+        /**
+         * @brief Pushes the elements of a range, publishing them with a single index store.
+         *
+         * Stops when the buffer is full. Elements are moved from rvalue ranges and copied otherwise.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param range The source range of elements to push.
+         * @return The number of elements pushed.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<T, std::ranges::range_reference_t<TRange>>
+#endif
+        [[nodiscard]] std::size_t push_range(TRange&& range)
+        {
+            batch_publisher batch(m_producer.index, m_producer.index.load(std::memory_order_relaxed));
+            const std::size_t first_idx = batch.position;
+            const std::size_t available = writable(first_idx, true);
+
+            auto itr = std::begin(range);
+            const auto range_end = std::end(range);
+            for (; (itr != range_end) && ((batch.position - first_idx) < available); ++itr)
+            {
+                if constexpr (std::is_rvalue_reference<TRange&&>::value)
+                {
+                    ::new (slot_address(batch.position)) T(std::move(*itr));
+                }
+                else
+                {
+                    ::new (slot_address(batch.position)) T(*itr);
+                }
+                ++batch.position;
+            }
+
+            return batch.position - first_idx;
+        }
+
+        /**
+         * @brief Pushes copies of the elements of an initializer-list, publishing them with a single index store.
+         *
+         * @param range The source initializer-list.
+         * @return The number of elements pushed.
+         */
+        [[nodiscard]] std::size_t push_range(std::initializer_list<T> range)
+        {
+            batch_publisher batch(m_producer.index, m_producer.index.load(std::memory_order_relaxed));
+            const std::size_t first_idx = batch.position;
+            const std::size_t available = writable(first_idx, true);
+
+            for (auto itr = range.begin(); (itr != range.end()) && ((batch.position - first_idx) < available); ++itr)
+            {
+                ::new (slot_address(batch.position)) T(*itr);
+                ++batch.position;
+            }
+
+            return batch.position - first_idx;
+        }
+
+        /**
+         * @brief Moves a batch of elements into an output range, releasing their slots with a single index store.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of elements popped.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            batch_publisher batch(m_consumer.index, m_consumer.index.load(std::memory_order_relaxed));
+            const std::size_t first_idx = batch.position;
+            const std::size_t available = readable(first_idx, true);
+
+            for (; (first != last) && ((batch.position - first_idx) < available); ++first)
+            {
+                T* front = element(batch.position);
+                *first = std::move(*front);
+                front->~T();
+                ++batch.position;
+            }
+
+            return batch.position - first_idx;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch pop into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of elements popped.
+         */
+        [[nodiscard]] std::size_t pop_range(std::span<T> destination)
+        {
+            return pop_range(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Tells whether the buffer looks empty; exact only from the consumer side.
+         *
+         * @return true if no element is queued.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == size();
+        }
+
+        /**
+         * @brief Returns the number of queued elements; a snapshot while the other side is active.
+         *
+         * @return The number of elements in the buffer.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            const std::size_t read_idx = m_consumer.index.load(std::memory_order_acquire);
+            const std::size_t write_idx = m_producer.index.load(std::memory_order_acquire);
+            return write_idx - read_idx;
+        }
+
+        /**
+         * @brief Returns the capacity of the ring buffer.
+         *
+         * @return The capacity of the ring buffer (2^Pow2, all usable).
+         */
+        [[nodiscard]] constexpr std::size_t capacity() const
+        {
+            return 1U << Pow2;
+        }
+
+    private:
+        static constexpr const std::size_t ring_buffer_size = (1U << Pow2);
+        static constexpr const std::size_t ring_buffer_mask = (ring_buffer_size - 1U);
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        /**
+         * @brief Raw storage for one element.
+         */
+        struct slot
+        {
+            alignas(T) std::array<std::byte, sizeof(T)> bytes;
+        };
+
+        /**
+         * @brief Index owned by one side, alone on its cache line with that side's copy of the opposite index.
+         */
+        struct alignas(cache_line_size) index_line
+        {
+            std::atomic<std::size_t> index = 0U;
+            std::size_t cached_opposite = 0U;
+        };
+
+        /**
+         * @brief Publishes the index reached by a batch when leaving scope, also when a constructor throws.
+         */
+        struct batch_publisher
+        {
+            batch_publisher(std::atomic<std::size_t>& published, std::size_t start)
+                : index(published)
+                , position(start)
+                , initial(start)
+            {
+            }
+
+            batch_publisher(const batch_publisher&) = delete;
+            batch_publisher& operator=(const batch_publisher&) = delete;
+            batch_publisher(batch_publisher&&) = delete;
+            batch_publisher& operator=(batch_publisher&&) = delete;
+
+            ~batch_publisher()
+            {
+                if (position != initial)
+                {
+                    index.store(position, std::memory_order_release);
+                }
+            }
+
+            std::atomic<std::size_t>& index; // NOLINT reference member, scoped helper
+            std::size_t position;
+            std::size_t initial;
+        };
+
+        /**
+         * @brief Returns the free slots seen by the producer, refreshing the cached consumer index when none is
+         *        left or when a batch asks for it.
+         */
+        std::size_t writable(std::size_t write_idx, bool refresh = false)
+        {
+            std::size_t free_slots = ring_buffer_size - (write_idx - m_producer.cached_opposite);
+            if (refresh || (0U == free_slots))
+            {
+                m_producer.cached_opposite = m_consumer.index.load(std::memory_order_acquire);
+                free_slots = ring_buffer_size - (write_idx - m_producer.cached_opposite);
+            }
+            return free_slots;
+        }
+
+        /**
+         * @brief Returns the queued elements seen by the consumer, refreshing the cached producer index when none
+         *        is left or when a batch asks for it.
+         */
+        std::size_t readable(std::size_t read_idx, bool refresh = false)
+        {
+            std::size_t queued = m_consumer.cached_opposite - read_idx;
+            if (refresh || (0U == queued))
+            {
+                m_consumer.cached_opposite = m_producer.index.load(std::memory_order_acquire);
+                queued = m_consumer.cached_opposite - read_idx;
+            }
+            return queued;
+        }
+
+        void* slot_address(std::size_t idx)
+        {
+            return static_cast<void*>(m_slots.at(idx & ring_buffer_mask).bytes.data());
+        }
+
+        T* element(std::size_t idx)
+        {
+            return std::launder(static_cast<T*>(slot_address(idx)));
+        }
+
+        alignas(cache_line_size) std::array<slot, ring_buffer_size> m_slots;
+        index_line m_producer;
+        index_line m_consumer;
+    };
+}
+
+#endif //  LOCK_FREE_OBJECT_RING_BUFFER_HPP_
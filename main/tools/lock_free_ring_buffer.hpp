@@ -57,6 +57,27 @@
 
 namespace tools
 {
+    /**
+     * @brief Selects the memory layout of a lock_free_ring_buffer.
+     */
+    enum class ring_buffer_layout : std::uint8_t
+    {
+        /**
+         * @brief Atomic slots next to the two indices, smallest footprint (default).
+         */
+        compact,
+
+        /**
+         * @brief Producer index, consumer index and slots each on their own cache line.
+         *
+         * Each side also caches the last index it read from the other side and only reloads it when the buffer
+         * looks full (producer) or empty (consumer), so the common case touches no cache line owned by the other
+         * core. Slots are plain T published by the release store of the index. Costs up to three cache lines of
+         * padding; pays off when producer and consumer run on different cores.
+         */
+        cache_padded
+    };
+
     /**
      * @brief A lock-free ring buffer implementation.
      *
@@ -65,8 +86,9 @@ namespace tools
      *
      * @tparam T The type of elements stored in the ring buffer.
      * @tparam Pow2 The power of 2 that determines the size of the ring buffer.
+     * @tparam Layout The memory layout, see ring_buffer_layout.
      */
-    template <typename T, std::size_t Pow2>
+    template <typename T, std::size_t Pow2, ring_buffer_layout Layout = ring_buffer_layout::compact>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
         requires std::is_standard_layout_v<T> && std::is_trivial_v<T> && (std::is_scalar_v<T> || std::is_pointer_v<T>)
 #endif
@@ -150,21 +172,43 @@ namespace tools
          */
         bool pop(T& elem)
         {
-            // Canonical SPSC consumer path: read producer index with acquire,
-            // then consume current slot and publish new read index with release.
-            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
-            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
-
-            // is empty ?
-            if ((snap_read_idx & ring_buffer_mask) == (snap_write_idx & ring_buffer_mask))
+            if constexpr (is_cache_padded)
             {
-                return false;
+                const std::size_t snap_read_idx = m_pop_index.index.load(std::memory_order_relaxed);
+
+                // looks empty: refresh the cached producer index (the only load of the producer cache line)
+                if (snap_read_idx == m_pop_index.cached_opposite)
+                {
+                    m_pop_index.cached_opposite = m_push_index.index.load(std::memory_order_acquire);
+                    if (snap_read_idx == m_pop_index.cached_opposite)
+                    {
+                        return false;
+                    }
+                }
+
+                elem = m_ring_buffer.at(snap_read_idx & ring_buffer_mask);
+                m_pop_index.index.store(snap_read_idx + 1U, std::memory_order_release);
+
+                return true;
             }
+            else
+            {
+                // Canonical SPSC consumer path: read producer index with acquire,
+                // then consume current slot and publish new read index with release.
+                const std::size_t snap_read_idx = m_pop_index.index.load(std::memory_order_relaxed);
+                const std::size_t snap_write_idx = m_push_index.index.load(std::memory_order_acquire);
+
+                // is empty ?
+                if ((snap_read_idx & ring_buffer_mask) == (snap_write_idx & ring_buffer_mask))
+                {
+                    return false;
+                }
 
-            elem = m_ring_buffer.at(snap_read_idx & ring_buffer_mask).load(std::memory_order_relaxed);
-            m_pop_index.store(snap_read_idx + 1U, std::memory_order_release);
+                elem = m_ring_buffer.at(snap_read_idx & ring_buffer_mask).load(std::memory_order_relaxed);
+                m_pop_index.index.store(snap_read_idx + 1U, std::memory_order_release);
 
-            return true;
+                return true;
+            }
         }
 
         /**
@@ -309,9 +353,62 @@ namespace tools
             return 1U << Pow2;
         }
 
+        /**
+         * @brief Tells whether the ring buffer holds no element.
+         *
+         * Exact from the consumer side, a snapshot from any other thread.
+         *
+         * @return true if the ring buffer is empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            const std::size_t snap_read_idx = m_pop_index.index.load(std::memory_order_relaxed);
+            const std::size_t snap_write_idx = m_push_index.index.load(std::memory_order_acquire);
+            return (snap_read_idx & ring_buffer_mask) == (snap_write_idx & ring_buffer_mask);
+        }
+
+        /**
+         * @brief Returns the number of elements in the ring buffer.
+         *
+         * Exact from the consumer side, a snapshot from any other thread.
+         *
+         * @return The number of queued elements.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            const std::size_t snap_read_idx = m_pop_index.index.load(std::memory_order_relaxed);
+            const std::size_t snap_write_idx = m_push_index.index.load(std::memory_order_acquire);
+            return (snap_write_idx - snap_read_idx) & ring_buffer_mask;
+        }
+
     private:
         static constexpr const std::size_t ring_buffer_size = (1U << Pow2);
         static constexpr const std::size_t ring_buffer_mask = (ring_buffer_size - 1U);
+        static constexpr const std::size_t cache_line_size = 64U;
+        static constexpr const bool is_cache_padded = (Layout == ring_buffer_layout::cache_padded);
+
+        /**
+         * @brief Index owned by one side of the buffer.
+         */
+        template <bool Padded, typename Dummy = void>
+        struct index_line
+        {
+            std::atomic<std::size_t> index = 0U;
+        };
+
+        /**
+         * @brief Index owned by one side, alone on its cache line with that side's copy of the opposite index.
+         */
+        template <typename Dummy>
+        struct alignas(cache_line_size) index_line<true, Dummy>
+        {
+            std::atomic<std::size_t> index = 0U;
+            std::size_t cached_opposite = 0U;
+        };
+
+        using slot_type = std::conditional_t<is_cache_padded, T, std::atomic<T>>;
+        static constexpr const std::size_t slots_alignment
+            = is_cache_padded ? cache_line_size : alignof(std::array<slot_type, ring_buffer_size>);
 
         /**
          * @brief Shared push implementation used by all public push overloads.
@@ -324,27 +421,58 @@ namespace tools
          */
         bool push_val(T elem)
         {
-            // Canonical SPSC producer path: read consumer index with acquire,
-            // then publish written element by advancing write index with release.
-            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_relaxed);
-            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_acquire);
-
-            // is full ?
-            if ((snap_read_idx & ring_buffer_mask) == ((snap_write_idx + 1U) & ring_buffer_mask))
+            if constexpr (is_cache_padded)
             {
-                return false;
+                const std::size_t snap_write_idx = m_push_index.index.load(std::memory_order_relaxed);
+
+                // looks full: refresh the cached consumer index (the only load of the consumer cache line)
+                if ((snap_write_idx - m_push_index.cached_opposite) >= ring_buffer_mask)
+                {
+                    m_push_index.cached_opposite = m_pop_index.index.load(std::memory_order_acquire);
+                    if ((snap_write_idx - m_push_index.cached_opposite) >= ring_buffer_mask)
+                    {
+                        return false;
+                    }
+                }
+
+                m_ring_buffer.at(snap_write_idx & ring_buffer_mask) = elem;
+                m_push_index.index.store(snap_write_idx + 1U, std::memory_order_release);
+
+                return true;
             }
+            else
+            {
+                // Canonical SPSC producer path: read consumer index with acquire,
+                // then publish written element by advancing write index with release.
+                const std::size_t snap_write_idx = m_push_index.index.load(std::memory_order_relaxed);
+                const std::size_t snap_read_idx = m_pop_index.index.load(std::memory_order_acquire);
+
+                // is full ?
+                if ((snap_read_idx & ring_buffer_mask) == ((snap_write_idx + 1U) & ring_buffer_mask))
+                {
+                    return false;
+                }
 
-            m_ring_buffer.at(snap_write_idx & ring_buffer_mask).store(elem, std::memory_order_relaxed);
-            m_push_index.store(snap_write_idx + 1U, std::memory_order_release);
+                m_ring_buffer.at(snap_write_idx & ring_buffer_mask).store(elem, std::memory_order_relaxed);
+                m_push_index.index.store(snap_write_idx + 1U, std::memory_order_release);
 
-            return true;
+                return true;
+            }
         }
 
-        std::array<std::atomic<T>, ring_buffer_size> m_ring_buffer;
-        std::atomic<std::size_t> m_push_index = 0U;
-        std::atomic<std::size_t> m_pop_index = 0U;
+        alignas(slots_alignment) std::array<slot_type, ring_buffer_size> m_ring_buffer;
+        index_line<is_cache_padded> m_push_index;
+        index_line<is_cache_padded> m_pop_index;
     };
+
+    /**
+     * @brief SPSC lock-free ring buffer with producer, consumer and slots on separate cache lines.
+     *
+     * @tparam T The type of elements stored in the ring buffer.
+     * @tparam Pow2 The power of 2 that determines the size of the ring buffer.
+     */
+    template <typename T, std::size_t Pow2>
+    using padded_lock_free_ring_buffer = lock_free_ring_buffer<T, Pow2, ring_buffer_layout::cache_padded>;
 }
 
 #endif //  LOCK_FREE_RING_BUFFER_HPP_
@@ -0,0 +1,220 @@
+/**
+ * @file log2_histogram.hpp
+ * @brief Fixed-bucket histogram with power-of-two buckets that never allocates.
+ *
+ * The histogram is meant for latency and duration statistics recorded from a real-time loop: one writer adds
+ * samples with relaxed atomic updates while any thread may take a snapshot.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(LOG2_HISTOGRAM_HPP_)
+#define LOG2_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Point-in-time copy of a log2_histogram.
+     *
+     * Bucket 0 counts the null samples and bucket i (i >= 1) the samples in [2^(i-1), 2^i); the last bucket
+     * also counts every larger sample.
+     *
+     * @tparam BucketCount The number of buckets.
+     */
+    template <std::size_t BucketCount>
+    struct log2_histogram_snapshot
+    {
+        std::array<std::uint32_t, BucketCount> buckets = {}; ///< Sample count per bucket.
+        std::uint32_t count = 0U;                             ///< Number of samples.
+        std::uint32_t min = 0U;                               ///< Smallest sample (0 if empty).
+        std::uint32_t max = 0U;                               ///< Largest sample.
+        std::uint64_t sum = 0U;                               ///< Sum of the samples.
+
+        /**
+         * @brief Gets the mean of the samples.
+         *
+         * @return The mean, or 0 if empty.
+         */
+        [[nodiscard]] double mean() const
+        {
+            return (0U == count) ? 0.0 : (static_cast<double>(sum) / static_cast<double>(count));
+        }
+
+        /**
+         * @brief Gets the exclusive upper bound of a bucket.
+         *
+         * @param bucket The bucket index.
+         * @return The first value above the bucket, or the maximum value for the last bucket.
+         */
+        [[nodiscard]] static constexpr std::uint64_t upper_bound(std::size_t bucket)
+        {
+            return (bucket + 1U >= BucketCount) ? std::numeric_limits<std::uint64_t>::max()
+                                                : (std::uint64_t { 1U } << bucket);
+        }
+
+        /**
+         * @brief Gets an upper estimate of a percentile, from the bucket bounds.
+         *
+         * @param fraction The percentile as a fraction in [0, 1] (e.g. 0.99).
+         * @return The upper bound of the bucket holding the percentile, capped by the largest sample.
+         */
+        [[nodiscard]] std::uint64_t percentile_upper_bound(double fraction) const
+        {
+            const auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(count));
+            std::uint64_t seen = 0U;
+            for (std::size_t bucket = 0U; bucket < BucketCount; ++bucket)
+            {
+                seen += buckets[bucket];
+                if ((seen > rank) || (seen == count))
+                {
+                    const auto bound = upper_bound(bucket) - ((0U == bucket) ? 0U : 1U);
+                    return (bound < max) ? bound : max;
+                }
+            }
+            return max;
+        }
+    };
+
+    /**
+     * @brief Histogram of unsigned samples in power-of-two buckets, with min/max/sum.
+     *
+     * Storage is a fixed array of atomic counters: add() never allocates nor locks. A single writer is assumed
+     * for the min/max/sum to be exact; snapshot() and reset() may be called from any thread.
+     *
+     * @tparam BucketCount The number of buckets (at least 2).
+     */
+    template <std::size_t BucketCount>
+    class log2_histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(BucketCount >= 2U, "at least two buckets are required");
+
+        using snapshot_type = log2_histogram_snapshot<BucketCount>;
+
+        log2_histogram() = default;
+        ~log2_histogram() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Gets the bucket of a sample.
+         *
+         * @param value The sample.
+         * @return The bucket index.
+         */
+        [[nodiscard]] static constexpr std::size_t bucket_of(std::uint32_t value)
+        {
+            std::size_t bucket = 0U;
+            while ((0U != value) && (bucket + 1U < BucketCount))
+            {
+                value >>= 1U;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        /**
+         * @brief Records a sample.
+         *
+         * @param value The sample.
+         */
+        void add(std::uint32_t value)
+        {
+            m_buckets[bucket_of(value)].fetch_add(1U, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+
+            if (value < m_min.load(std::memory_order_relaxed))
+            {
+                m_min.store(value, std::memory_order_relaxed);
+            }
+
+            if (value > m_max.load(std::memory_order_relaxed))
+            {
+                m_max.store(value, std::memory_order_relaxed);
+            }
+
+            m_count.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Takes a copy of the histogram.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] snapshot_type snapshot() const
+        {
+            snapshot_type copy;
+            for (std::size_t bucket = 0U; bucket < BucketCount; ++bucket)
+            {
+                copy.buckets[bucket] = m_buckets[bucket].load(std::memory_order_relaxed);
+            }
+            copy.count = m_count.load(std::memory_order_relaxed);
+            copy.sum = m_sum.load(std::memory_order_relaxed);
+            copy.max = m_max.load(std::memory_order_relaxed);
+            copy.min = (0U == copy.count) ? 0U : m_min.load(std::memory_order_relaxed);
+            return copy;
+        }
+
+        /**
+         * @brief Clears all the samples.
+         */
+        void reset()
+        {
+            for (auto& bucket : m_buckets)
+            {
+                bucket.store(0U, std::memory_order_relaxed);
+            }
+            m_count.store(0U, std::memory_order_relaxed);
+            m_sum.store(0U, std::memory_order_relaxed);
+            m_min.store(std::numeric_limits<std::uint32_t>::max(), std::memory_order_relaxed);
+            m_max.store(0U, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<std::uint32_t>, BucketCount> m_buckets = {};
+        std::atomic<std::uint32_t> m_count = 0U;
+        std::atomic<std::uint64_t> m_sum = 0U;
+        std::atomic<std::uint32_t> m_min = std::numeric_limits<std::uint32_t>::max();
+        std::atomic<std::uint32_t> m_max = 0U;
+    };
+}
+
+#endif //  LOG2_HISTOGRAM_HPP_
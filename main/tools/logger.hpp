@@ -5,6 +5,11 @@
  *
  * This header file provides macros for logging messages with different severity levels.
  * It supports both ESP32 platform using ESP-IDF logging and other platforms using standard C++ I/O functions.
+ * When USE_ASYNC_LOGGER is defined, the macros hand binary records to the async_logger drain task instead
+ * (see async_log_buffer.hpp and async_logger.hpp).
+ *
+ * Levels less severe than LOG_MIN_LEVEL are compiled out. The others are checked at runtime against the level of
+ * their module (LOG_MODULE, the source file name by default, see set_log_level()) before any argument is evaluated.
  *
  * @author Laurent Lardinois
  * @date January 2025
@@ -40,7 +45,11 @@
 #if !defined(LOGGER_HPP_)
 #define LOGGER_HPP_
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <string>
 #include <utility>
@@ -63,7 +72,6 @@
 #else
 #include <cstdio>
 #include <cstdlib>
-#include <map>
 #endif
 
 #if defined(__func__)
@@ -91,29 +99,212 @@
 #define FILE_ALIAS_ (FILE_ALIAS_STR).c_str()
 #endif
 
+// least severe level compiled in: 0 error, 1 warning, 2 info, 3 debug, 4 verbose
+#if !defined(LOG_MIN_LEVEL)
+#if defined(DEBUG)
+#define LOG_MIN_LEVEL 4
+#else
+#define LOG_MIN_LEVEL 2
+#endif
+#endif
 
-#if defined(ESP_PLATFORM)
+// runtime level module of the log calls of a file, a string literal (the file name by default)
+#if !defined(LOG_MODULE)
+#define LOG_MODULE tools::detail::log_file_name(__FILE__)
+#endif
+
+namespace tools
+{
+    /**
+     * @brief logging level
+     *
+     */
+    enum class log_level : std::uint8_t
+    {
+        error,
+        warning,
+        info,
+        debug,
+        verbose
+    };
+
+    /**
+     * @brief Number of runtime level slots shared by the log modules.
+     */
+    constexpr std::size_t log_module_slots = 32U;
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the tag printed before a log line of the given level (colored on Linux terminals).
+         */
+        constexpr const char* log_level_tag(log_level level)
+        {
+            // https://dev.to/tenry/terminal-colors-in-c-c-3dgc
+#if defined(__linux__)
+            // https://man7.org/linux/man-pages/man5/terminal-colors.d.5.html
+            switch (level)
+            {
+                case log_level::error:
+                    return "\033[31m[ERROR]";
+                case log_level::warning:
+                    return "\033[33m[WARNING]";
+                case log_level::info:
+                    return "\033[32m[INFO]";
+                case log_level::debug:
+                    return "\033[36m[DEBUG]";
+                default:
+                    return "\033[34m[VERBOSE]";
+            }
+#else
+            switch (level)
+            {
+                case log_level::error:
+                    return "[ERROR]";
+                case log_level::warning:
+                    return "[WARNING]";
+                case log_level::info:
+                    return "[INFO]";
+                case log_level::debug:
+                    return "[DEBUG]";
+                default:
+                    return "[VERBOSE]";
+            }
+#endif
+        }
+
+        /**
+         * @brief Returns the sequence restoring the terminal attributes at the end of a log line.
+         */
+        constexpr const char* log_level_end()
+        {
+#if defined(__linux__)
+            return "\033[0m";
+#else
+            return "";
+#endif
+        }
+
+        /**
+         * @brief Returns the file name part of a source path, at compile time for __FILE__.
+         */
+        constexpr const char* log_file_name(const char* path)
+        {
+            const char* name = path;
+            for (const char* cursor = path; '\0' != *cursor; ++cursor) // NOLINT pointer arithmetic
+            {
+                if (('/' == *cursor) || ('\\' == *cursor))
+                {
+                    name = cursor + 1; // NOLINT pointer arithmetic
+                }
+            }
+            return name;
+        }
+
+        /**
+         * @brief Maps a module name to its runtime level slot (FNV-1a hash).
+         */
+        constexpr std::size_t log_module_slot(const char* module)
+        {
+            std::uint32_t hash = 2166136261U;
+            for (const char* cursor = module; '\0' != *cursor; ++cursor) // NOLINT pointer arithmetic
+            {
+                hash = (hash ^ static_cast<std::uint8_t>(*cursor)) * 16777619U;
+            }
+            return static_cast<std::size_t>(hash % log_module_slots);
+        }
+
+        /**
+         * @brief Number of levels silenced at runtime in each slot, from verbose up (zero-initialized: none).
+         */
+        inline std::array<std::atomic<std::uint8_t>, log_module_slots> log_module_silenced = {};
+
+        /**
+         * @brief Tells whether a log call of a level goes through the runtime level of its module slot.
+         */
+        inline bool log_enabled(log_level level, std::size_t slot)
+        {
+            return (static_cast<unsigned int>(level) + log_module_silenced[slot].load(std::memory_order_relaxed))
+                <= static_cast<unsigned int>(log_level::verbose);
+        }
+    }
+
+    /**
+     * @brief Sets the least severe level still written by the log calls of a module.
+     *
+     * Modules are hashed into log_module_slots slots: two modules sharing a slot share their level.
+     *
+     * @param module The module name: the LOG_MODULE of its files, their file name by default (e.g. "main.cpp").
+     * @param level The least severe level written, log_level::verbose to write everything compiled in.
+     */
+    inline void set_log_level(const char* module, log_level level)
+    {
+        detail::log_module_silenced[detail::log_module_slot(module)].store(
+            static_cast<std::uint8_t>(static_cast<unsigned int>(log_level::verbose) - static_cast<unsigned int>(level)),
+            std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the least severe level written by the log calls of a module.
+     *
+     * @param module The module name.
+     * @return The runtime level of the module, log_level::verbose unless set_log_level() lowered it.
+     */
+    [[nodiscard]] inline log_level get_log_level(const char* module)
+    {
+        return static_cast<log_level>(static_cast<unsigned int>(log_level::verbose)
+            - detail::log_module_silenced[detail::log_module_slot(module)].load(std::memory_order_relaxed));
+    }
+}
+
+// compile-time file name and module slot, then one runtime branch before the arguments are evaluated
+#define TOOLS_LOG_AT_(level, ...)                                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        [[maybe_unused]] constexpr const char* tools_log_file_ = tools::detail::log_file_name(__FILE__);               \
+        constexpr std::size_t tools_log_slot_ = tools::detail::log_module_slot(LOG_MODULE);                            \
+        if (tools::detail::log_enabled(level, tools_log_slot_))                                                        \
+        {                                                                                                              \
+            TOOLS_LOG_WRITE_(level, tools_log_file_, __VA_ARGS__);                                                     \
+        }                                                                                                              \
+    } while (false)
+
+#if defined(USE_ASYNC_LOGGER)
+
+#include "tools/async_log_buffer.hpp"
+
+#define TOOLS_LOG_WRITE_(level, file, ...) tools::async_log(level, file, FUNCTION_ALIAS_, __LINE__, __VA_ARGS__)
+
+#elif defined(ESP_PLATFORM)
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/system/log.html
 // ESP_LOGE - Error (lowest)
 // ESP_LOGW - Warning
 // ESP_LOGI - Info
 // ESP_LOGD - Debug
 // ESP_LOGV - Verbose (highest)
-#define LOG_ERROR(...)                                                                                                 \
-    ESP_LOGE((FILE_ALIAS_STR + " [" + FUNCTION_ALIAS_ + ", line " + std::to_string(__LINE__) + "] ").c_str(),          \
-        __VA_ARGS__) // NOLINT
-#define LOG_WARNING(...)                                                                                               \
-    ESP_LOGW((FILE_ALIAS_STR + " [" + FUNCTION_ALIAS_ + ", line " + std::to_string(__LINE__) + " ]").c_str(),          \
-        __VA_ARGS__) // NOLINT
-#define LOG_INFO(...)                                                                                                  \
-    ESP_LOGI((FILE_ALIAS_STR + " [" + FUNCTION_ALIAS_ + ", line " + std::to_string(__LINE__) + "] ").c_str(),          \
-        __VA_ARGS__) // NOLINT
-#define LOG_DEBUG(...)                                                                                                 \
-    ESP_LOGD((FILE_ALIAS_STR + " [" + FUNCTION_ALIAS_ + ", line " + std::to_string(__LINE__) + "] ").c_str(),          \
-        __VA_ARGS__) // NOLINT
-#define LOG_VERBOSE(...)                                                                                               \
-    ESP_LOGV((FILE_ALIAS_STR + " [" + FUNCTION_ALIAS_ + ", line " + std::to_string(__LINE__) + "] ").c_str(),          \
-        __VA_ARGS__) // NOLINT
+
+// the file name is the ESP-IDF tag, the function and line lead the message
+#define TOOLS_ESP_LOG_(esp_log, file, format, ...)                                                                     \
+    esp_log(file, "[%s, line %d] " format, FUNCTION_ALIAS_, __LINE__, ##__VA_ARGS__) // NOLINT
+#define TOOLS_LOG_WRITE_(level, file, ...)                                                                             \
+    switch (level)                                                                                                     \
+    {                                                                                                                  \
+        case tools::log_level::error:                                                                                  \
+            TOOLS_ESP_LOG_(ESP_LOGE, file, __VA_ARGS__);                                                               \
+            break;                                                                                                     \
+        case tools::log_level::warning:                                                                                \
+            TOOLS_ESP_LOG_(ESP_LOGW, file, __VA_ARGS__);                                                               \
+            break;                                                                                                     \
+        case tools::log_level::info:                                                                                   \
+            TOOLS_ESP_LOG_(ESP_LOGI, file, __VA_ARGS__);                                                               \
+            break;                                                                                                     \
+        case tools::log_level::debug:                                                                                  \
+            TOOLS_ESP_LOG_(ESP_LOGD, file, __VA_ARGS__);                                                               \
+            break;                                                                                                     \
+        default:                                                                                                       \
+            TOOLS_ESP_LOG_(ESP_LOGV, file, __VA_ARGS__);                                                               \
+            break;                                                                                                     \
+    }
 
 // #elif defined(STM32_PLATFORM)
 //  TODO
@@ -135,19 +326,6 @@ namespace tools
     using source_location = std::experimental::source_location;
 #endif
 
-    /**
-     * @brief logging level
-     *
-     */
-    enum class log_level : std::uint8_t
-    {
-        error,
-        warning,
-        info,
-        debug,
-        verbose
-    };
-
     /**
      * @brief capture of source code location info
      *
@@ -166,81 +344,98 @@ namespace tools
     };
 
     /**
-     * @brief variadic templated logging function
+     * @brief variadic templated logging function, with a location resolved by the caller
      *
      * @tparam Args
      * @param level log level
-     * @param fmt C-like printf format string
+     * @param file source file name
+     * @param function source function name
+     * @param line source line
+     * @param format C-like printf format string
      * @param args variadic printf arguments
      */
     template <typename... Args>
-    void log(tools::log_level level, tools::format_with_location fmt, Args&&... args)
+    void log_at(tools::log_level level, const char* file, const char* function, int line, const char* format,
+        Args&&... args)
     {
-        // https://dev.to/tenry/terminal-colors-in-c-c-3dgc
-#if defined(__linux__)
-        // https://man7.org/linux/man-pages/man5/terminal-colors.d.5.html
-        static const std::map<log_level, std::string> lookup = { { log_level::error, "\033[31m[ERROR]" },
-            { log_level::warning, "\033[33m[WARNING]" }, { log_level::info, "\033[32m[INFO]" },
-            { log_level::debug, "\033[36m[DEBUG]" }, { log_level::verbose, "\033[34m[VERBOSE]" } };
-        static const std::string end_restore { "\033[0m" };
-#else
-        static const std::map<log_level, std::string> lookup
-            = { { log_level::error, "[ERROR]" }, { log_level::warning, "[WARNING]" }, { log_level::info, "[INFO]" },
-                  { log_level::debug, "[DEBUG]" }, { log_level::verbose, "[VERBOSE]" } };
-        static const std::string end_restore { "\0" };
-#endif
-
         FILE* output = (level >= log_level::error) && (level <= log_level::warning) ? stderr : stdout;
-        const std::string file_name = std::filesystem::path(fmt.loc.file_name()).filename().string();
 
-        std::fprintf(output, "%s %s [%s, line %d] ", lookup.at(level).c_str(), file_name.c_str(),
-            fmt.loc.function_name(), fmt.loc.line());
+        std::fprintf(output, "%s %s [%s, line %d] ", detail::log_level_tag(level), file, function, line);
         if constexpr (sizeof...(Args) == 0)
         {
-            std::fputs(fmt.value, output);
+            std::fputs(format, output);
         }
         else
         {
-            std::fprintf(output, fmt.value, std::forward<Args>(args)...); // NOLINT source_location returns const char*
+            std::fprintf(output, format, std::forward<Args>(args)...); // NOLINT format given by the log site
         }
-        std::fprintf(output, "%s\n", end_restore.c_str());
+        std::fprintf(output, "%s\n", detail::log_level_end());
         std::fflush(output);
     }
 
-}
+    /**
+     * @brief variadic templated logging function
+     *
+     * @tparam Args
+     * @param level log level
+     * @param fmt C-like printf format string
+     * @param args variadic printf arguments
+     */
+    template <typename... Args>
+    void log(tools::log_level level, tools::format_with_location fmt, Args&&... args)
+    {
+        log_at(level, detail::log_file_name(fmt.loc.file_name()), fmt.loc.function_name(),
+            static_cast<int>(fmt.loc.line()), fmt.value, std::forward<Args>(args)...);
+    }
 
-#define LOG_ERROR(...) tools::log(tools::log_level::error, __VA_ARGS__)     // NOLINT
-#define LOG_WARNING(...) tools::log(tools::log_level::warning, __VA_ARGS__) // NOLINT
-#define LOG_INFO(...) tools::log(tools::log_level::info, __VA_ARGS__)       // NOLINT
+}
 
-#if defined(DEBUG)
-#define LOG_DEBUG(...) tools::log(tools::log_level::debug, __VA_ARGS__)     // NOLINT
-#define LOG_VERBOSE(...) tools::log(tools::log_level::verbose, __VA_ARGS__) // NOLINT
-#else
-#define LOG_DEBUG(...)
-#define LOG_VERBOSE(...)
-#endif
+#define TOOLS_LOG_WRITE_(level, file, ...)                                                                             \
+    tools::log_at(level, file, tools::source_location::current().function_name(), __LINE__, __VA_ARGS__)
 
 #else
 
 // pre-C++20
 
-// clang-format off
-#define LOG_ERROR(...) do { std::fprintf(stderr, "[ERROR] %s [%s, line %d] ", FILE_ALIAS_, FUNCTION_ALIAS_, __LINE__); std::fprintf(stderr, __VA_ARGS__); std::fprintf(stderr, "\n"); std::fflush(stderr); } while(false)     // NOLINT
-#define LOG_WARNING(...) do { std::fprintf(stderr, "[WARNING] %s [%s, line %d] ", FILE_ALIAS_, FUNCTION_ALIAS_, __LINE__); std::fprintf(stderr, __VA_ARGS__); std::fprintf(stderr, "\n"); std::fflush(stderr); } while(false) // NOLINT
-#define LOG_INFO(...) do { std::printf("[INFO] %s [%s, line %d] ", FILE_ALIAS_, FUNCTION_ALIAS_, __LINE__); std::printf(__VA_ARGS__); std::printf("\n"); std::fflush(stdout); } while(false) // NOLINT
+#define TOOLS_LOG_WRITE_(level, file, ...)                                                                             \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        FILE* tools_log_output_ = ((level) <= tools::log_level::warning) ? stderr : stdout;                            \
+        std::fprintf(tools_log_output_, "%s %s [%s, line %d] ", tools::detail::log_level_tag(level), file,             \
+            FUNCTION_ALIAS_, __LINE__);                                                                                \
+        std::fprintf(tools_log_output_, __VA_ARGS__);                                                                  \
+        std::fprintf(tools_log_output_, "%s\n", tools::detail::log_level_end());                                       \
+        std::fflush(tools_log_output_);                                                                                \
+    } while (false)
 
-#if defined(DEBUG)
-#define LOG_DEBUG(...) do { std::printf("[DEBUG] %s [%s, line %d] ", FILE_ALIAS_, FUNCTION_ALIAS_, __LINE__); std::printf(__VA_ARGS__); std::printf("\n"); std::fflush(stdout); } while(false)     // NOLINT
-#define LOG_VERBOSE(...) do { std::printf("[VERBOSE] %s [%s, line %d] ", FILE_ALIAS_, FUNCTION_ALIAS_, __LINE__); std::printf(__VA_ARGS__); std::printf("\n"); std::fflush(stdout); } while(false) // NOLINT
+#endif // end pre-C++20
+
+#endif // end std implem
+
+#define LOG_ERROR(...) TOOLS_LOG_AT_(tools::log_level::error, __VA_ARGS__) // NOLINT
+
+#if LOG_MIN_LEVEL >= 1
+#define LOG_WARNING(...) TOOLS_LOG_AT_(tools::log_level::warning, __VA_ARGS__) // NOLINT
 #else
-#define LOG_DEBUG(...)
-#define LOG_VERBOSE(...)
+#define LOG_WARNING(...)
 #endif
-// clang-format on
 
-#endif // end pre-C++20
+#if LOG_MIN_LEVEL >= 2
+#define LOG_INFO(...) TOOLS_LOG_AT_(tools::log_level::info, __VA_ARGS__) // NOLINT
+#else
+#define LOG_INFO(...)
+#endif
 
-#endif // end std implem
+#if LOG_MIN_LEVEL >= 3
+#define LOG_DEBUG(...) TOOLS_LOG_AT_(tools::log_level::debug, __VA_ARGS__) // NOLINT
+#else
+#define LOG_DEBUG(...)
+#endif
+
+#if LOG_MIN_LEVEL >= 4
+#define LOG_VERBOSE(...) TOOLS_LOG_AT_(tools::log_level::verbose, __VA_ARGS__) // NOLINT
+#else
+#define LOG_VERBOSE(...)
+#endif
 
 #endif //  LOGGER_HPP_
@@ -30,163 +30,1008 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
-// USE_MEM_POOL_ALLOCATOR and USE_MEM_POOL_ALLOCATOR_WARMUP are configured via compile definitions.
+// USE_MEM_POOL_ALLOCATOR, USE_MEM_POOL_ALLOCATOR_WARMUP, USE_MEM_POOL_ALLOCATOR_STATS,
+// USE_MEM_POOL_ALLOCATOR_SLABS, USE_MEM_POOL_ALLOCATOR_TLSF and USE_MEM_POOL_ALLOCATOR_CAPS are configured via
+// compile definitions.
 
 #if defined(USE_MEM_POOL_ALLOCATOR)
 
-#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <exception>
-#include <mutex>
+#include <iterator>
+#include <limits>
 #include <new>
-#include <numeric>
+#include <optional>
+#include <tuple>
+#include <utility>
 
-#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-#include <bit>
+#include "tools/alloc_hint.hpp"
+#include "tools/lock_free_mpmc_ring_buffer.hpp"
+#include "tools/mem_pool_allocator.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF) && defined(ESP_PLATFORM)
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+
+#if !defined(MEM_POOL_TLSF_REGION_CAPS)
+#if defined(CONFIG_SPIRAM)
+#define MEM_POOL_TLSF_REGION_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#else
+#define MEM_POOL_TLSF_REGION_CAPS MALLOC_CAP_8BIT
+#endif
+#endif
+#endif
+
+// Linux server builds may back the slabs and the TLSF region with huge pages and lock them in RAM
+#if defined(__linux__) && (defined(USE_MEM_POOL_ALLOCATOR_HUGE_PAGES) || defined(USE_MEM_POOL_ALLOCATOR_MLOCK))
+#define MEM_POOL_LINUX_PAGE_BACKING
+#include "tools/linux/linux_huge_pages.hpp"
+
+#if !defined(MEM_POOL_HUGE_PAGE_SIZE)
+#define MEM_POOL_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+#endif
+#endif
+
+// Per-thread magazines need a way to flush the cached blocks when the owner thread ends:
+// C++ thread_local destructors on hosted platforms, FreeRTOS thread local storage pointers
+// with deletion callbacks otherwise. Without any of them, the global pools are used directly.
+#if defined(FREERTOS_PLATFORM)
+#if defined(configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS) && (configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS != 0)
+#define MEM_POOL_MAGAZINE_FREERTOS_TLSP
+#if !defined(MEM_POOL_MAGAZINE_TLS_INDEX)
+// last slot by default, ESP-IDF pthread layer uses the first one
+#define MEM_POOL_MAGAZINE_TLS_INDEX (configNUM_THREAD_LOCAL_STORAGE_POINTERS - 1)
+#endif
+#endif
+#else
+#define MEM_POOL_MAGAZINE_THREAD_LOCAL
+#endif
+
+namespace
+{
+    // Private structure in .bss segment (no heap allocation at all !)
+
+    // https://www.rastergrid.com/blog/sw-eng/2021/03/custom-memory-allocators/
+
+    // We cache and reuse small blocks of memory to prevent memory fragmentation
+    // with small frequent events messages.
+    //
+    // The structure relies on multi-producer/multi-consumer lock free ring buffers, so that
+    // concurrent allocations and releases of the same block size never serialize on a mutex.
+    //
+    // In front of these shared pools, each thread (or FreeRTOS task) owns a small magazine
+    // of cached blocks per size class. Allocations and releases are served from the magazine
+    // without touching any shared state, and the magazine is refilled from or flushed to the
+    // global pool in batches when it runs empty or full.
+    //
+    // Blocks are cached per size class. The classes are not restricted to powers of 2, so that
+    // payloads clustering around 24, 48 or 96 bytes do not waste a third of the block, and each
+    // class has its own pool capacity. The table can be replaced at compile time by defining
+    // MEM_POOL_SIZE_CLASSES as a list of { block size, log2 of the pool capacity } entries,
+    // for instance -DMEM_POOL_SIZE_CLASSES="{24U,9U},{48U,9U},{96U,8U},{4096U,3U}".
+    //
+    // Blocks that are greater than the last class will not be cached as we make the hypothesis
+    // that big chunks of memory will be pre-allocated and reused in dedicated pools
+    // if necessary. With USE_MEM_POOL_ALLOCATOR_TLSF, they are served in constant time by a
+    // TLSF heap over a dedicated region (internal RAM or PSRAM) once it is installed, which
+    // keeps their fragmentation away from the system heap.
+    //
+    // With USE_MEM_POOL_ALLOCATOR_SLABS, each size class also owns a slab: a contiguous region of
+    // 2^MEM_POOL_SLAB_BLOCKS_POW2 blocks in .bss, carved on cache misses before going to the heap.
+    // The size class of a slab block is derived from its address, so unsized deletes (which cannot
+    // know the block size otherwise) recycle slab blocks too, without any per-block header.
+    //
+    // With USE_MEM_POOL_ALLOCATOR_WARMUP, init_mem_pool_allocator() fills the pools with blocks carved
+    // from one contiguous heap allocation, MEM_POOL_WARMUP_TARGETS blocks per class (the pool capacity
+    // by default). The targets are typically the peak_in_use statistics of a profiling run, e.g.
+    // -DMEM_POOL_WARMUP_TARGETS="64U,32U,0U,8U,...", one entry per size class. Warmup blocks never
+    // return to the heap: the ones that overflow the cache go to a per-class free list.
+
+    struct size_class
+    {
+        std::size_t block_size;
+        std::size_t capacity_pow2;
+    };
+
+#if !defined(MEM_POOL_SIZE_CLASSES)
+#define MEM_POOL_SIZE_CLASSES                                                                                          \
+    { 16U, 9U }, { 24U, 9U }, { 32U, 9U }, { 48U, 9U }, { 64U, 9U }, { 96U, 9U }, { 128U, 9U }, { 192U, 8U },          \
+        { 256U, 8U }, { 384U, 7U }, { 512U, 7U }
+#endif
+
+    // C array so that the number of classes is deduced from the configurable list
+    constexpr size_class SIZE_CLASSES[] = { MEM_POOL_SIZE_CLASSES }; // NOLINT size deduced from the initializer
+
+    constexpr std::size_t NB_CACHED_BLOCK_CLASSES = std::size(SIZE_CLASSES);
+
+    // size classes are multiples of this granularity, it is also the lookup table step
+    constexpr std::size_t SIZE_CLASS_GRANULARITY = 8U;
+    constexpr std::size_t MAX_CACHED_BLOCK_SIZE_LIMIT = 4096U;
+    constexpr std::size_t MAX_CACHED_BLOCKS_POW2_LIMIT = 12U;
+
+    constexpr std::size_t MAX_CACHED_BLOCK_SIZE = SIZE_CLASSES[NB_CACHED_BLOCK_CLASSES - 1U].block_size;
+
+    constexpr bool valid_size_classes()
+    {
+        std::size_t previous_size = 0U;
+        for (const auto& entry : SIZE_CLASSES)
+        {
+            if ((entry.block_size <= previous_size) || ((entry.block_size % SIZE_CLASS_GRANULARITY) != 0U)
+                || (entry.capacity_pow2 == 0U) || (entry.capacity_pow2 > MAX_CACHED_BLOCKS_POW2_LIMIT))
+            {
+                return false;
+            }
+            previous_size = entry.block_size;
+        }
+        return true;
+    }
+
+    static_assert(NB_CACHED_BLOCK_CLASSES <= std::numeric_limits<std::uint8_t>::max(), "too many size classes");
+    static_assert(valid_size_classes(),
+        "size classes must be strictly increasing multiples of SIZE_CLASS_GRANULARITY with a valid capacity");
+    static_assert(MAX_CACHED_BLOCK_SIZE <= MAX_CACHED_BLOCK_SIZE_LIMIT, "largest cached block size is above 4 KB");
+
+    // size -> class index, one entry per granularity step, so the lookup is a single table load
+    constexpr std::size_t SIZE_LOOKUP_ENTRIES = (MAX_CACHED_BLOCK_SIZE / SIZE_CLASS_GRANULARITY) + 1U;
+
+    constexpr std::array<std::uint8_t, SIZE_LOOKUP_ENTRIES> make_size_lookup()
+    {
+        std::array<std::uint8_t, SIZE_LOOKUP_ENTRIES> lookup = {};
+        std::size_t class_idx = 0U;
+        for (std::size_t step = 0U; step < SIZE_LOOKUP_ENTRIES; ++step)
+        {
+            while (SIZE_CLASSES[class_idx].block_size < (step * SIZE_CLASS_GRANULARITY))
+            {
+                ++class_idx;
+            }
+            lookup[step] = static_cast<std::uint8_t>(class_idx);
+        }
+        return lookup;
+    }
+
+    constexpr auto SIZE_LOOKUP = make_size_lookup();
+
+    // valid for size <= MAX_CACHED_BLOCK_SIZE
+    constexpr int cache_index(std::size_t size)
+    {
+        return SIZE_LOOKUP[(size + SIZE_CLASS_GRANULARITY - 1U) / SIZE_CLASS_GRANULARITY]; // NOLINT bounded
+    }
+
+    template <std::size_t Idx>
+    struct block_pool
+    {
+        tools::lock_free_mpmc_ring_buffer<void*, SIZE_CLASSES[Idx].capacity_pow2> m_pool;
+    };
+
+    template <typename Seq>
+    struct make_blocks_cache;
+
+    template <std::size_t... Idx>
+    struct make_blocks_cache<std::index_sequence<Idx...>>
+    {
+        using type = std::tuple<block_pool<Idx>...>;
+    };
+
+    using blocks_cache = make_blocks_cache<std::make_index_sequence<NB_CACHED_BLOCK_CLASSES>>::type;
+
+    // data structure statically allocated in .bss region
+    blocks_cache g_mem_cache = {}; // NOLINT this is the purpose to have a statically allocated cache
+
+    // the pools have different capacities (hence types), they are reached through a constexpr
+    // table of accessors indexed by size class instead of a switch
+    struct pool_accessors
+    {
+        bool (*pop)(void*& block);
+        bool (*push)(void* block);
+    };
+
+    template <std::size_t Idx>
+    bool pool_pop(void*& block)
+    {
+        return std::get<Idx>(g_mem_cache).m_pool.pop(block);
+    }
+
+    template <std::size_t Idx>
+    bool pool_push(void* block)
+    {
+        return std::get<Idx>(g_mem_cache).m_pool.push(block);
+    }
+
+    template <std::size_t... Idx>
+    constexpr std::array<pool_accessors, NB_CACHED_BLOCK_CLASSES> make_pool_accessors(std::index_sequence<Idx...>)
+    {
+        return { { { &pool_pop<Idx>, &pool_push<Idx> }... } };
+    }
+
+    constexpr auto POOL_ACCESSORS = make_pool_accessors(std::make_index_sequence<NB_CACHED_BLOCK_CLASSES>{});
+
+    // carved blocks must honour the alignment guaranteed by operator new, e.g. 24 byte blocks use a 32 byte stride
+    constexpr std::size_t BLOCK_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    constexpr std::size_t block_stride(std::size_t idx)
+    {
+        return ((SIZE_CLASSES[idx].block_size + BLOCK_ALIGNMENT - 1U) / BLOCK_ALIGNMENT) * BLOCK_ALIGNMENT; // NOLINT
+    }
+
+#if defined(MEM_POOL_LINUX_PAGE_BACKING)
+    // backing of the static slabs and of the TLSF region, the explicit pages falling back to transparent ones
+    constexpr tools::linux_os::huge_page_options REGION_PAGE_OPTIONS = {
+#if defined(USE_MEM_POOL_ALLOCATOR_HUGE_PAGES)
+        tools::linux_os::huge_page_mode::explicit_pages,
+#else
+        tools::linux_os::huge_page_mode::none,
+#endif
+#if defined(USE_MEM_POOL_ALLOCATOR_MLOCK)
+        true,
+#else
+        false,
+#endif
+    };
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+
+#if !defined(MEM_POOL_SLAB_BLOCKS_POW2)
+#define MEM_POOL_SLAB_BLOCKS_POW2 5U
+#endif
+
+    constexpr std::size_t SLAB_BLOCKS_POW2 = MEM_POOL_SLAB_BLOCKS_POW2;
+    constexpr std::size_t SLAB_BLOCKS = (static_cast<std::size_t>(1U) << SLAB_BLOCKS_POW2);
+
+    static_assert((SLAB_BLOCKS_POW2 > 0U) && (SLAB_BLOCKS_POW2 <= MAX_CACHED_BLOCKS_POW2_LIMIT),
+        "MEM_POOL_SLAB_BLOCKS_POW2 out of range");
+
+    // byte offset of each class slab in the slabs region, the last entry is the region size
+    constexpr std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> make_slab_offsets()
+    {
+        std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> offsets = {};
+        for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
+        {
+            offsets[idx + 1U] = offsets[idx] + (SLAB_BLOCKS * block_stride(idx));
+        }
+        return offsets;
+    }
+
+    constexpr auto SLAB_OFFSETS = make_slab_offsets();
+    constexpr std::size_t SLABS_REGION_SIZE = SLAB_OFFSETS[NB_CACHED_BLOCK_CLASSES];
+
+#if defined(MEM_POOL_LINUX_PAGE_BACKING) && defined(USE_MEM_POOL_ALLOCATOR_HUGE_PAGES)
+    // aligned and padded to huge pages, so that madvise() folds the whole region into huge pages
+    constexpr std::size_t SLABS_REGION_ALIGNMENT = MEM_POOL_HUGE_PAGE_SIZE;
+#else
+    constexpr std::size_t SLABS_REGION_ALIGNMENT = BLOCK_ALIGNMENT;
+#endif
+    constexpr std::size_t SLABS_REGION_STORAGE
+        = ((SLABS_REGION_SIZE + SLABS_REGION_ALIGNMENT - 1U) / SLABS_REGION_ALIGNMENT) * SLABS_REGION_ALIGNMENT;
+
+    // slabs of all classes in one contiguous .bss region, so "is it a slab block" is a single range check
+    alignas(SLABS_REGION_ALIGNMENT) std::array<unsigned char, SLABS_REGION_STORAGE> g_slabs_region = {}; // NOLINT .bss
+
+    // Released slab blocks that did not fit in the cache. Twice the slab size, so that a push never reports
+    // a full ring because of a concurrent pop still releasing its slot, blocks are never lost.
+    template <std::size_t Idx>
+    struct slab_state
+    {
+        tools::lock_free_mpmc_ring_buffer<void*, SLAB_BLOCKS_POW2 + 1U> m_free_blocks;
+        std::atomic<std::size_t> m_carved; // blocks carved so far, the slab is exhausted past SLAB_BLOCKS
+    };
+
+    template <typename Seq>
+    struct make_slabs;
+
+    template <std::size_t... Idx>
+    struct make_slabs<std::index_sequence<Idx...>>
+    {
+        using type = std::tuple<slab_state<Idx>...>;
+    };
+
+    using slabs = make_slabs<std::make_index_sequence<NB_CACHED_BLOCK_CLASSES>>::type;
+
+    slabs g_slabs = {}; // NOLINT statically allocated slabs bookkeeping
+
+    template <std::size_t Idx>
+    void* slab_carve()
+    {
+        auto& slab = std::get<Idx>(g_slabs);
+        void* block = nullptr;
+
+        if (slab.m_free_blocks.pop(block))
+        {
+            return block;
+        }
+
+        // load first, so that an exhausted slab does not keep incrementing the counter
+        if (slab.m_carved.load(std::memory_order_relaxed) >= SLAB_BLOCKS)
+        {
+            return nullptr;
+        }
+
+        const std::size_t index = slab.m_carved.fetch_add(1U, std::memory_order_relaxed);
+        if (index >= SLAB_BLOCKS)
+        {
+            return nullptr;
+        }
+
+        return g_slabs_region.data() + SLAB_OFFSETS[Idx] + (index * block_stride(Idx)); // NOLINT bounded
+    }
+
+    template <std::size_t Idx>
+    void slab_release(void* block)
+    {
+        // at most SLAB_BLOCKS blocks for twice as many slots: only a transient race can make it fail
+        while (!std::get<Idx>(g_slabs).m_free_blocks.push(block))
+        {
+        }
+    }
+
+    struct slab_accessors
+    {
+        void* (*carve)();
+        void (*release)(void* block);
+    };
+
+    template <std::size_t... Idx>
+    constexpr std::array<slab_accessors, NB_CACHED_BLOCK_CLASSES> make_slab_accessors(std::index_sequence<Idx...>)
+    {
+        return { { { &slab_carve<Idx>, &slab_release<Idx> }... } };
+    }
+
+    constexpr auto SLAB_ACCESSORS = make_slab_accessors(std::make_index_sequence<NB_CACHED_BLOCK_CLASSES>{});
+
+    // size class of a slab block, -1 for any other pointer (heap block, nullptr)
+    int slab_class(const void* ptr)
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        const auto first = reinterpret_cast<std::uintptr_t>(g_slabs_region.data());
+
+        if ((address < first) || (address >= (first + SLABS_REGION_SIZE)))
+        {
+            return -1;
+        }
+
+        // few classes and increasing offsets: a linear scan is cheaper than a search
+        const std::size_t offset = address - first;
+        int idx = 0;
+        while (offset >= SLAB_OFFSETS[idx + 1]) // NOLINT bounded by the range check above
+        {
+            ++idx;
+        }
+        return idx;
+    }
+
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
+
+#if defined(MEM_POOL_WARMUP_TARGETS)
+    // warmup blocks of each size class, in class order
+    constexpr std::size_t WARMUP_TARGETS[] = { MEM_POOL_WARMUP_TARGETS }; // NOLINT size checked below
+#endif
+
+    // without a target table every pool is filled to capacity
+    constexpr std::size_t warmup_target(std::size_t idx)
+    {
+#if defined(MEM_POOL_WARMUP_TARGETS)
+        return WARMUP_TARGETS[idx]; // NOLINT size checked below
+#else
+        return (static_cast<std::size_t>(1U) << SIZE_CLASSES[idx].capacity_pow2); // NOLINT bounded by the caller
+#endif
+    }
+
+    constexpr bool valid_warmup_targets()
+    {
+        for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
+        {
+            if (warmup_target(idx) > (static_cast<std::size_t>(1U) << SIZE_CLASSES[idx].capacity_pow2)) // NOLINT
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+#if defined(MEM_POOL_WARMUP_TARGETS)
+    static_assert(std::size(WARMUP_TARGETS) == NB_CACHED_BLOCK_CLASSES,
+        "MEM_POOL_WARMUP_TARGETS needs one entry per size class");
+#endif
+    static_assert(valid_warmup_targets(), "a warmup target is above the pool capacity of its size class");
+
+    // first free list link of each class and byte offset of each class in the blocks area, the last entries
+    // are the totals
+    constexpr std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> make_warmup_links()
+    {
+        std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> links = {};
+        for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
+        {
+            links[idx + 1U] = links[idx] + warmup_target(idx);
+        }
+        return links;
+    }
+
+    constexpr std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> make_warmup_offsets()
+    {
+        std::array<std::size_t, NB_CACHED_BLOCK_CLASSES + 1U> offsets = {};
+        for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
+        {
+            offsets[idx + 1U] = offsets[idx] + (warmup_target(idx) * block_stride(idx));
+        }
+        return offsets;
+    }
+
+    constexpr auto WARMUP_LINKS = make_warmup_links();
+    constexpr auto WARMUP_OFFSETS = make_warmup_offsets();
+    constexpr std::size_t WARMUP_BLOCKS_SIZE = WARMUP_OFFSETS[NB_CACHED_BLOCK_CLASSES];
+
+    using warmup_link = std::atomic<std::uint16_t>;
+
+    // the region starts with the free list links, the blocks follow on a block boundary; the slack covers
+    // a heap returning less aligned blocks than operator new
+    constexpr std::size_t WARMUP_LINKS_SIZE
+        = (((WARMUP_LINKS[NB_CACHED_BLOCK_CLASSES] * sizeof(warmup_link)) + BLOCK_ALIGNMENT - 1U) / BLOCK_ALIGNMENT)
+        * BLOCK_ALIGNMENT;
+    constexpr std::size_t WARMUP_REGION_SIZE = BLOCK_ALIGNMENT + WARMUP_LINKS_SIZE + WARMUP_BLOCKS_SIZE;
+
+    // free list heads: 16 bit tag against ABA, 16 bit index + 1 of the block in its class (0 when empty)
+    constexpr std::uint32_t WARMUP_INDEX_MASK = 0xFFFFU;
+    constexpr std::uint32_t WARMUP_TAG_INCREMENT = 0x10000U;
+
+    static_assert((static_cast<std::size_t>(1U) << MAX_CACHED_BLOCKS_POW2_LIMIT) < WARMUP_INDEX_MASK,
+        "warmup block indexes do not fit in the free list links");
+
+    // the region is taken once and never released, late deletes from static destructors may still reach it
+    std::atomic<unsigned char*> g_warmup_blocks = { nullptr }; // NOLINT first warmup block, published last
+    warmup_link* g_warmup_links = nullptr;                     // NOLINT free list links, set before the blocks
+    std::array<std::atomic<std::uint32_t>, NB_CACHED_BLOCK_CLASSES> g_warmup_free = {}; // NOLINT list heads
+
+    // size class of a warmup block, -1 for any other pointer (heap block, nullptr)
+    int warmup_class(const void* ptr)
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        const auto first = reinterpret_cast<std::uintptr_t>(g_warmup_blocks.load(std::memory_order_acquire));
+
+        if ((first == 0U) || (address < first) || (address >= (first + WARMUP_BLOCKS_SIZE)))
+        {
+            return -1;
+        }
+
+        // classes without warmup blocks have an empty range and are skipped
+        const std::size_t offset = address - first;
+        int idx = 0;
+        while (offset >= WARMUP_OFFSETS[idx + 1]) // NOLINT bounded by the range check above
+        {
+            ++idx;
+        }
+        return idx;
+    }
+
+    constexpr std::uint32_t warmup_next_tag(std::uint32_t head)
+    {
+        return (head & ~WARMUP_INDEX_MASK) + WARMUP_TAG_INCREMENT;
+    }
+
+    // a warmup block that did not fit in the cache, kept on the free list of its class
+    void warmup_release(void* block, int idx)
+    {
+        unsigned char* blocks = g_warmup_blocks.load(std::memory_order_acquire);
+        const auto offset = static_cast<std::size_t>(static_cast<unsigned char*>(block) - blocks);
+        const auto slot = static_cast<std::uint32_t>((offset - WARMUP_OFFSETS[idx]) / block_stride(idx)); // NOLINT
+        warmup_link& link = g_warmup_links[WARMUP_LINKS[idx] + slot]; // NOLINT bounded by the class target
+
+        auto& head = g_warmup_free[idx]; // NOLINT no bounds checking and no except
+        std::uint32_t current = head.load(std::memory_order_relaxed);
+        do
+        {
+            link.store(static_cast<std::uint16_t>(current & WARMUP_INDEX_MASK), std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(current, warmup_next_tag(current) | (slot + 1U),
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // reuse a warmup block of the free list, nullptr when it is empty
+    void* warmup_take(int idx)
+    {
+        auto& head = g_warmup_free[idx]; // NOLINT no bounds checking and no except
+        std::uint32_t current = head.load(std::memory_order_acquire);
+
+        while ((current & WARMUP_INDEX_MASK) != 0U)
+        {
+            const std::uint32_t slot = (current & WARMUP_INDEX_MASK) - 1U;
+            const std::uint32_t next
+                = g_warmup_links[WARMUP_LINKS[idx] + slot].load(std::memory_order_relaxed); // NOLINT bounded
+
+            if (head.compare_exchange_weak(
+                    current, warmup_next_tag(current) | next, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return g_warmup_blocks.load(std::memory_order_relaxed) + WARMUP_OFFSETS[idx] // NOLINT bounded
+                    + (slot * block_stride(idx));
+            }
+        }
+
+        return nullptr;
+    }
+
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+
+    // the heap is built in place once its region is known and is never destroyed, late releases
+    // from static destructors may still reach it
+    alignas(tools::tlsf_heap) unsigned char g_tlsf_storage[sizeof(tools::tlsf_heap)]; // NOLINT in place storage
+    std::atomic<tools::tlsf_heap*> g_tlsf_heap = { nullptr };                      // NOLINT installed heap
+    std::atomic_bool g_tlsf_claimed = { false };                                    // NOLINT one installation
+
+    // block of the TLSF heap released, false for any other pointer
+    bool tlsf_release(void* ptr)
+    {
+        auto* heap = g_tlsf_heap.load(std::memory_order_acquire);
+
+        if ((heap != nullptr) && heap->owns(ptr))
+        {
+            heap->deallocate(ptr);
+            return true;
+        }
+
+        return false;
+    }
+
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+
+    constexpr std::size_t STATS_CACHE_LINE_SIZE = 64U;
+
+    // relaxed counters, one cache line per size class to avoid false sharing between classes
+    struct alignas(STATS_CACHE_LINE_SIZE) class_counters
+    {
+        std::atomic<std::size_t> hits;
+        std::atomic<std::size_t> misses;
+        std::atomic<std::size_t> slab_allocations;
+        std::atomic<std::size_t> overflows;
+        std::atomic<std::size_t> occupancy;
+        std::atomic<std::size_t> high_water_mark;
+        std::atomic<std::size_t> in_use;
+        std::atomic<std::size_t> peak_in_use;
+    };
+
+    std::array<class_counters, NB_CACHED_BLOCK_CLASSES> g_mem_stats = {}; // NOLINT statically allocated counters
+
+    class_counters& counters(int idx)
+    {
+        return g_mem_stats[idx]; // NOLINT no bounds checking and no except
+    }
+
+#endif
+
+    void stats_on_hit(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).hits.fetch_add(1U, std::memory_order_relaxed);
+        counters(idx).occupancy.fetch_sub(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
+
+    void stats_on_miss(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).misses.fetch_add(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
+
+    // a cache miss served by a warmup block of the free list, outside the cache occupancy
+    void stats_on_reuse(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).hits.fetch_add(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
+
+#endif
+
+    // a block of the class handed out, the peak is the number of blocks a warmup needs for this workload
+    void stats_on_acquire(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        auto& entry = counters(idx);
+        const std::size_t in_use = entry.in_use.fetch_add(1U, std::memory_order_relaxed) + 1U;
+        std::size_t peak = entry.peak_in_use.load(std::memory_order_relaxed);
+
+        while ((in_use > peak) && !entry.peak_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+        {
+        }
+#else
+        (void)idx;
+#endif
+    }
+
+    // a block of the class given back (unsized deletes of heap blocks cannot be attributed to a class)
+    void stats_on_release(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        // relaxed counters, a release may be seen before its acquire: never wrap around
+        auto& in_use = counters(idx).in_use;
+        std::size_t current = in_use.load(std::memory_order_relaxed);
+        while ((current > 0U) && !in_use.compare_exchange_weak(current, current - 1U, std::memory_order_relaxed))
+        {
+        }
+#else
+        (void)idx;
+#endif
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+
+    // a cache miss served by the slab of the class instead of the heap
+    void stats_on_slab(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).slab_allocations.fetch_add(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
+
+#endif
+
+    void stats_on_cached(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        auto& entry = counters(idx);
+        const std::size_t occupancy = entry.occupancy.fetch_add(1U, std::memory_order_relaxed) + 1U;
+        std::size_t high_water_mark = entry.high_water_mark.load(std::memory_order_relaxed);
+
+        while ((occupancy > high_water_mark)
+            && !entry.high_water_mark.compare_exchange_weak(high_water_mark, occupancy, std::memory_order_relaxed))
+        {
+        }
+#else
+        (void)idx;
 #endif
+    }
 
-#include "tools/critical_section.hpp"
-#include "tools/lock_free_ring_buffer.hpp"
-#include "tools/platform_detection.hpp"
+    // a released block did not fit in the cache and went back to the heap
+    void stats_on_overflow(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).overflows.fetch_add(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
 
-namespace
-{
-    // Private structure in .bss segment (no heap allocation at all !)
+    // a cached block left the cache without being handed out (flush overflow, teardown)
+    void stats_on_evicted(int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+        counters(idx).occupancy.fetch_sub(1U, std::memory_order_relaxed);
+#else
+        (void)idx;
+#endif
+    }
 
-    // https://www.rastergrid.com/blog/sw-eng/2021/03/custom-memory-allocators/
+    // a new block from the system heap; with USE_MEM_POOL_ALLOCATOR_CAPS the size class blocks stay in internal
+    // RAM and the larger ones are routed by size (PSRAM from ALLOC_HINT_EXTERNAL_THRESHOLD bytes when available),
+    // free() releases both kinds
+    void* heap_alloc(std::size_t size) noexcept
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_CAPS)
+        return tools::hinted_malloc(
+            size, (size <= MAX_CACHED_BLOCK_SIZE) ? tools::alloc_hint::internal : tools::alloc_hint::automatic);
+#else
+        return std::malloc(size); // NOLINT we want to use libc malloc as we overload new operator
+#endif
+    }
 
-    // We cache and reuse small blocks of memory to prevent memory fragmentation
-    // with small frequent events messages.
-    //
-    // The structure relies on lock free ring buffers and a pair of writer/reader mutexes
-    // for the situation where multiple writers or multiple readers request the same size of block
-    //
-    // The idea is to allocate and cache only blocks with a power of 2 granularity
-    // (typically from 16-bytes to 512-bytes or 1024-bytes).
-    //
-    // Blocks that are greater will not be cached as we make the hypothesis
-    // that big chunks of memory will be pre-allocated and reused in dedicated pools
-    // if necessary.
+    // a block leaving the cache for good: back to the warmup free list or its slab, or to the heap
+    void release_block(void* block, int idx)
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
+        if (warmup_class(block) >= 0)
+        {
+            warmup_release(block, idx);
+            return;
+        }
+#endif
 
-    constexpr int MIN_CACHED_BLOCK_POW2_SIZE = 4; // 2^4 = 16 bytes
-    constexpr int MAX_CACHED_BLOCK_POW2_SIZE = 9; // 2^9 = 512 bytes
+#if defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+        if (slab_class(block) >= 0)
+        {
+            SLAB_ACCESSORS[idx].release(block); // NOLINT no bounds checking and no except
+            return;
+        }
+#else
+        (void)idx;
+#endif
+        std::free(block); // NOLINT we want to use libc free as we overload delete operator
+    }
+
+    bool global_pool_pop(int idx, void*& block)
+    {
+        return POOL_ACCESSORS[idx].pop(block); // NOLINT no bounds checking and no except
+    }
 
-    constexpr std::size_t MIN_CACHED_BLOCK_SIZE = (1U << MIN_CACHED_BLOCK_POW2_SIZE);
-    constexpr std::size_t MAX_CACHED_BLOCK_SIZE = (1U << MAX_CACHED_BLOCK_POW2_SIZE);
+    bool global_pool_push(int idx, void* block)
+    {
+        return POOL_ACCESSORS[idx].push(block); // NOLINT no bounds checking and no except
+    }
 
-    constexpr std::size_t MAX_CACHED_BLOCKS_POW2 = 9; // 2^9 = 512 per pool
+#if defined(MEM_POOL_MAGAZINE_THREAD_LOCAL) || defined(MEM_POOL_MAGAZINE_FREERTOS_TLSP)
 
-    struct block_pool
+    constexpr std::size_t MAGAZINE_CAPACITY = 16U; // cached blocks per size class and per thread
+    constexpr std::size_t MAGAZINE_BATCH = MAGAZINE_CAPACITY / 2U; // blocks moved per refill/flush
+
+    static_assert((MAGAZINE_BATCH > 0U) && (MAGAZINE_BATCH <= MAGAZINE_CAPACITY), "invalid magazine batch size");
+
+    struct magazine
     {
-        tools::critical_section m_push_mtx;
-        tools::critical_section m_pop_mtx;
-        tools::lock_free_ring_buffer<void*, MAX_CACHED_BLOCKS_POW2> m_pool;
+        std::array<void*, MAGAZINE_CAPACITY> m_blocks;
+        std::size_t m_count;
     };
 
-    using blocks_cache = std::array<block_pool, MAX_CACHED_BLOCK_POW2_SIZE - MIN_CACHED_BLOCK_POW2_SIZE + 1>;
-
-    // data structure statically allocated in .bss region
-    blocks_cache g_mem_cache = {}; // NOLINT this is the purpose to have a statically allocated cache
+    // trivial aggregate: zero-initialized storage is an empty set of magazines
+    struct thread_magazines
+    {
+        std::array<magazine, NB_CACHED_BLOCK_CLASSES> m_classes;
+    };
 
-    // Round up to the next power-of-two with a C++17 fallback.
-    constexpr std::size_t bit_ceil_size(std::size_t value)
+    void refill_magazine(magazine& entry, int idx)
     {
-#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-        return std::bit_ceil(value);
-#else
-        if (value <= 1U)
+        while ((entry.m_count < MAGAZINE_BATCH) && global_pool_pop(idx, entry.m_blocks[entry.m_count])) // NOLINT bounded
         {
-            return 1U;
+            ++entry.m_count;
         }
+    }
 
-        --value;
-        for (std::size_t shift = 1U; shift < (sizeof(std::size_t) * 8U); shift <<= 1U)
+    void flush_magazine(magazine& entry, int idx, std::size_t keep)
+    {
+        while (entry.m_count > keep)
         {
-            value |= (value >> shift);
+            --entry.m_count;
+            void* block = entry.m_blocks[entry.m_count]; // NOLINT bounded by m_count
+
+            if (!global_pool_push(idx, block))
+            {
+                stats_on_evicted(idx);
+                stats_on_overflow(idx);
+                release_block(block, idx);
+            }
         }
-        return value + 1U;
-#endif
     }
 
-    // Compute log2(value) for a non-zero power-of-two value.
-    constexpr int log2_pow2(std::size_t value)
+    void flush_thread_magazines(thread_magazines& magazines)
     {
-#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-        return std::countr_zero(value);
-#else
-        int log2_value = 0;
-        while ((value >>= 1U) != 0U)
+        int idx = 0;
+        for (auto& entry : magazines.m_classes)
         {
-            ++log2_value;
+            flush_magazine(entry, idx, 0U);
+            ++idx;
         }
-        return log2_value;
+    }
+
 #endif
+
+#if defined(MEM_POOL_MAGAZINE_THREAD_LOCAL)
+
+    enum class magazines_state : std::uint8_t
+    {
+        unused,
+        active,
+        retired
+    };
+
+    // one instance per thread, returns its blocks to the global pools when the thread ends
+    struct thread_magazines_owner
+    {
+        thread_magazines m_magazines;
+        magazines_state m_state;
+
+        constexpr thread_magazines_owner()
+            : m_magazines {}
+            , m_state { magazines_state::unused }
+        {
+        }
+
+        thread_magazines_owner(const thread_magazines_owner&) = delete;
+        thread_magazines_owner(thread_magazines_owner&&) = delete;
+        thread_magazines_owner& operator=(const thread_magazines_owner&) = delete;
+        thread_magazines_owner& operator=(thread_magazines_owner&&) = delete;
+
+        ~thread_magazines_owner()
+        {
+            flush_thread_magazines(m_magazines);
+            // late releases from other thread local destructors go to the global pools
+            m_state = magazines_state::retired;
+        }
+    };
+
+    thread_local thread_magazines_owner t_magazines_owner; // NOLINT per-thread cache is the purpose
+
+    thread_magazines* current_magazines()
+    {
+        auto& owner = t_magazines_owner;
+
+        if (owner.m_state == magazines_state::retired)
+        {
+            return nullptr;
+        }
+
+        owner.m_state = magazines_state::active;
+        return &owner.m_magazines;
     }
 
-    constexpr std::size_t pow2_blocksize(std::size_t orig_size)
+#elif defined(MEM_POOL_MAGAZINE_FREERTOS_TLSP)
+
+    static_assert((MEM_POOL_MAGAZINE_TLS_INDEX >= 0)
+            && (MEM_POOL_MAGAZINE_TLS_INDEX < configNUM_THREAD_LOCAL_STORAGE_POINTERS),
+        "MEM_POOL_MAGAZINE_TLS_INDEX out of the thread local storage pointers range");
+
+    void release_task_magazines(int index, void* tls_pointer)
     {
-        return std::max(bit_ceil_size(orig_size), static_cast<std::size_t>(MIN_CACHED_BLOCK_SIZE));
+        (void)index;
+
+        if (auto* magazines = static_cast<thread_magazines*>(tls_pointer))
+        {
+            flush_thread_magazines(*magazines);
+            std::free(magazines); // NOLINT allocated with libc calloc, see current_magazines()
+        }
     }
 
-    constexpr int log2int(std::size_t pow2_size)
+    thread_magazines* current_magazines()
     {
-        // input is non-zero and is a pow of 2 (computed previously with pow2_blocksize)
-        return log2_pow2(pow2_size) + 1;
+        // no task context before the scheduler starts
+        if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+        {
+            return nullptr;
+        }
+
+        auto* magazines
+            = static_cast<thread_magazines*>(pvTaskGetThreadLocalStoragePointer(nullptr, MEM_POOL_MAGAZINE_TLS_INDEX));
+
+        if (magazines == nullptr)
+        {
+            // libc calloc: zero-filled storage is a valid empty set of magazines
+            magazines = static_cast<thread_magazines*>(std::calloc(1U, sizeof(thread_magazines))); // NOLINT libc
+
+            if (magazines != nullptr)
+            {
+                vTaskSetThreadLocalStoragePointerAndDelCallback(
+                    nullptr, MEM_POOL_MAGAZINE_TLS_INDEX, magazines, release_task_magazines);
+            }
+        }
+
+        return magazines;
     }
 
-    void* cache_alloc(std::size_t size_pow2)
+#endif
+
+    void* cache_alloc(int idx)
     {
         // reuse a block if possible
-        const int idx = log2int(size_pow2) - MIN_CACHED_BLOCK_POW2_SIZE - 1;
+#if defined(MEM_POOL_MAGAZINE_THREAD_LOCAL) || defined(MEM_POOL_MAGAZINE_FREERTOS_TLSP)
+        if (auto* magazines = current_magazines())
+        {
+            auto& entry = magazines->m_classes[idx]; // NOLINT no bounds checking and no except
 
-        auto& cache_entry = g_mem_cache[idx]; // NOLINT no bounds checking and no except
-        void* cached_ptr = nullptr;
+            if (entry.m_count == 0U)
+            {
+                refill_magazine(entry, idx);
+            }
 
-        {
-            // reader
-            std::scoped_lock<tools::critical_section> guard(cache_entry.m_pop_mtx);
-            cache_entry.m_pool.pop(cached_ptr);
+            if (entry.m_count > 0U)
+            {
+                --entry.m_count;
+                return entry.m_blocks[entry.m_count]; // NOLINT bounded by m_count
+            }
+
+            return nullptr;
         }
+#endif
+
+        void* cached_ptr = nullptr;
+        global_pool_pop(idx, cached_ptr);
 
         // reused block or nullptr
         return cached_ptr;
     }
 
-    bool cache_recycle(void* ptr, std::size_t size_pow2)
+    bool cache_recycle(void* ptr, int idx)
     {
         // recycle the block if possible
-        const int idx = log2int(size_pow2) - MIN_CACHED_BLOCK_POW2_SIZE - 1;
+#if defined(MEM_POOL_MAGAZINE_THREAD_LOCAL) || defined(MEM_POOL_MAGAZINE_FREERTOS_TLSP)
+        if (auto* magazines = current_magazines())
+        {
+            auto& entry = magazines->m_classes[idx]; // NOLINT no bounds checking and no except
 
-        auto& cache_entry = g_mem_cache[idx]; // NOLINT no bounds checking and no except
+            if (entry.m_count == MAGAZINE_CAPACITY)
+            {
+                flush_magazine(entry, idx, MAGAZINE_CAPACITY - MAGAZINE_BATCH);
+            }
 
-        // writer
-        std::scoped_lock<tools::critical_section> guard(cache_entry.m_push_mtx);
+            entry.m_blocks[entry.m_count] = ptr; // NOLINT bounded by MAGAZINE_CAPACITY
+            ++entry.m_count;
+            return true;
+        }
+#endif
 
-        return cache_entry.m_pool.push(ptr);
+        return global_pool_push(idx, ptr);
     }
 
     void* cached_new(std::size_t size)
     {
-        const auto size_pow2 = pow2_blocksize(size);
+        int class_idx = -1; // size class of a heap block
 
-        if (size_pow2 <= MAX_CACHED_BLOCK_SIZE)
+        if (size <= MAX_CACHED_BLOCK_SIZE)
         {
-            if (void* cached_ptr = cache_alloc(size_pow2))
+            const int idx = cache_index(size);
+
+            if (void* cached_ptr = cache_alloc(idx))
             {
-                // std::printf("[reuse] %d bytes\n", static_cast<int>(size_pow2));
+                stats_on_hit(idx);
+                stats_on_acquire(idx);
+                // std::printf("[reuse] %d bytes\n", static_cast<int>(SIZE_CLASSES[idx].block_size));
                 return cached_ptr;
             }
 
-            // allocate a pow of 2 block from the heap
-            size = size_pow2;
+#if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
+            // warmup blocks that overflowed the cache earlier
+            if (void* warmup_ptr = warmup_take(idx))
+            {
+                stats_on_reuse(idx);
+                stats_on_acquire(idx);
+                return warmup_ptr;
+            }
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+            // carve a block from the slab of the size class
+            if (void* slab_ptr = SLAB_ACCESSORS[idx].carve()) // NOLINT bounded by the lookup table
+            {
+                stats_on_slab(idx);
+                stats_on_acquire(idx);
+                return slab_ptr;
+            }
+#endif
+
+            // allocate a block of the size class from the heap
+            stats_on_miss(idx);
+            size = SIZE_CLASSES[idx].block_size; // NOLINT bounded by the lookup table
+            class_idx = idx;
+        }
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+        else if (auto* heap = g_tlsf_heap.load(std::memory_order_acquire))
+        {
+            // medium and large blocks, the system heap is only used once the TLSF region is exhausted
+            if (void* tlsf_ptr = heap->allocate(size))
+            {
+                return tlsf_ptr;
+            }
         }
+#endif
 
         // fallback - allocate a new block on the heap
-        if (void* ptr = std::malloc(size)) // NOLINT we want to use libc malloc as we overload new operator
+        if (void* ptr = heap_alloc(size))
         {
+            if (class_idx >= 0)
+            {
+                stats_on_acquire(class_idx);
+            }
             // std::printf("[alloc] %d bytes\n", static_cast<int>(size));
             return ptr;
         }
@@ -198,92 +1043,324 @@ namespace
         return nullptr;
     }
 
-    void cached_delete(void* ptr, std::size_t size) noexcept
+    void recycle_block(void* ptr, int idx) noexcept
     {
+        stats_on_release(idx);
+
         // check opportunity to give the released block to the pool
-        const auto size_pow2 = pow2_blocksize(size);
+        const bool recycled = cache_recycle(ptr, idx);
 
-        if (size_pow2 <= MAX_CACHED_BLOCK_SIZE)
+        if (recycled)
         {
-            const bool recycled = cache_recycle(ptr, size_pow2);
+            stats_on_cached(idx);
+            // std::printf("[recycle] %d bytes", static_cast<int>(SIZE_CLASSES[idx].block_size));
+            // block recycled
+            return;
+        }
 
-            if (recycled)
-            {
-                // std::printf("[recycle] %d bytes", static_cast<int>(size_pow2));
-                // block recycled
-                return;
-            }
+        // fallback on regular heap deallocation (or slab release)
+        stats_on_overflow(idx);
+        release_block(ptr, idx);
+    }
+
+    void cached_delete(void* ptr, std::size_t size) noexcept
+    {
+        if (size <= MAX_CACHED_BLOCK_SIZE)
+        {
+            recycle_block(ptr, cache_index(size));
+            return;
+        }
 
-            // fallback on regular heap deallocation
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+        if (tlsf_release(ptr))
+        {
+            return;
         }
+#endif
 
         // std::printf("[free] sized: %d bytes\n", static_cast<int>(size));
         std::free(ptr); // NOLINT we want to use libc free as we overload delete operator
     }
+
+    void cached_delete(void* ptr) noexcept
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
+        // as for slab blocks, the address of a warmup block tells its size class
+        const int warmup_idx = warmup_class(ptr);
+
+        if (warmup_idx >= 0)
+        {
+            recycle_block(ptr, warmup_idx);
+            return;
+        }
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+        // the address of a slab block tells its size class
+        const int idx = slab_class(ptr);
+
+        if (idx >= 0)
+        {
+            recycle_block(ptr, idx);
+            return;
+        }
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+        if (tlsf_release(ptr))
+        {
+            return;
+        }
+#endif
+
+        // heap block of unknown size, it cannot be cached
+        // std::printf("[free] unsized\n");
+        std::free(ptr); // NOLINT we want to use libc free as we overload delete operator
+    }
+
+#if defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+    // constant initialized and trivially destructible: no TLS guard nor allocation on first use
+    thread_local tools::mem_pool_thread_counters g_thread_counters = {}; // NOLINT per thread counters
+#endif
+
+    inline void count_thread_new(std::size_t size) noexcept
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+        ++g_thread_counters.allocations;
+        g_thread_counters.bytes += size;
+#else
+        static_cast<void>(size);
+#endif
+    }
+
+    inline void count_thread_delete(const void* ptr) noexcept
+    {
+#if defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+        if (ptr != nullptr)
+        {
+            ++g_thread_counters.deallocations;
+        }
+#else
+        static_cast<void>(ptr);
+#endif
+    }
 }
 
 void init_mem_pool_allocator()
 {
+#if defined(MEM_POOL_LINUX_PAGE_BACKING) && defined(USE_MEM_POOL_ALLOCATOR_SLABS)
+    // the slabs are static: huge pages and locking only need to be requested once
+    static const bool slabs_backed = []()
+    {
+        static_cast<void>(
+            tools::linux_os::advise_huge_pages(g_slabs_region.data(), g_slabs_region.size(), REGION_PAGE_OPTIONS));
+        return true;
+    }();
+    static_cast<void>(slabs_backed);
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF) && defined(MEM_POOL_TLSF_REGION_SIZE)
+    // TLSF region taken from the system heap (PSRAM when available on ESP32), unless one is already installed
+    if (g_tlsf_heap.load(std::memory_order_acquire) == nullptr)
+    {
+        constexpr std::size_t region_size = MEM_POOL_TLSF_REGION_SIZE;
+#if defined(ESP_PLATFORM)
+        void* region = heap_caps_malloc(region_size, MEM_POOL_TLSF_REGION_CAPS);
+#elif defined(MEM_POOL_LINUX_PAGE_BACKING)
+        void* region = tools::linux_os::map_huge_pages(region_size, REGION_PAGE_OPTIONS);
+#else
+        void* region = std::malloc(region_size); // NOLINT we want to use libc malloc as we overload new operator
+#endif
+
+        if ((region != nullptr) && !init_mem_pool_tlsf_heap(region, region_size))
+        {
+#if defined(ESP_PLATFORM)
+            heap_caps_free(region);
+#elif defined(MEM_POOL_LINUX_PAGE_BACKING)
+            tools::linux_os::unmap_huge_pages(region, region_size, REGION_PAGE_OPTIONS.mode);
+#else
+            std::free(region); // NOLINT allocated with libc malloc above
+#endif
+        }
+    }
+#endif
+
 #if defined(USE_MEM_POOL_ALLOCATOR_WARMUP)
 
-    // warm up
+    // warm up: one allocation carved into the warmup blocks of every class, done once
+    if ((WARMUP_BLOCKS_SIZE == 0U) || (g_warmup_blocks.load(std::memory_order_acquire) != nullptr))
+    {
+        return;
+    }
+
+    // the warmup blocks are small hot blocks, kept in internal RAM when the heap is routed by capability
+#if defined(USE_MEM_POOL_ALLOCATOR_CAPS)
+    void* region = tools::hinted_malloc(WARMUP_REGION_SIZE, tools::alloc_hint::internal);
+#else
+    void* region = std::malloc(WARMUP_REGION_SIZE); // NOLINT we want to use libc malloc as we overload new operator
+#endif
+
+    if (region == nullptr)
+    {
+        return;
+    }
 
-    std::size_t block_size = MIN_CACHED_BLOCK_SIZE;
-    // std::size_t total_mem = 0U;
+    const auto region_address = reinterpret_cast<std::uintptr_t>(region);
+    auto* base = static_cast<unsigned char*>(region) // NOLINT pointer arithmetic within the region
+        + (((region_address + BLOCK_ALIGNMENT - 1U) & ~(BLOCK_ALIGNMENT - 1U)) - region_address);
 
-    for (auto& entry : g_mem_cache)
+    auto* links = reinterpret_cast<warmup_link*>(base); // NOLINT links constructed in place below
+    for (std::size_t link = 0U; link < WARMUP_LINKS[NB_CACHED_BLOCK_CLASSES]; ++link)
     {
-        std::scoped_lock lock(entry.m_pop_mtx, entry.m_push_mtx);
+        new (static_cast<void*>(links + link)) warmup_link(0U); // NOLINT pointer arithmetic within the region
+    }
 
-        for (int i = 0; i < (1 << MAX_CACHED_BLOCKS_POW2) - 1; ++i)
-        {
-            if (void* ptr = std::malloc(block_size)) // NOLINT we want to use libc malloc as we overload new operator
-            {
-                // std::printf("[pre-alloc] %d bytes", static_cast<int>(block_size));
+    unsigned char* blocks = base + WARMUP_LINKS_SIZE; // NOLINT pointer arithmetic within the region
+    g_warmup_links = links;
+    g_warmup_blocks.store(blocks, std::memory_order_release);
 
-                // total_mem += block_size;
+    for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
+    {
+        for (std::size_t i = 0U; i < warmup_target(idx); ++i)
+        {
+            void* block = blocks + WARMUP_OFFSETS[idx] + (i * block_stride(idx)); // NOLINT bounded by the target
 
-                if (!entry.m_pool.push(ptr))
-                {
-                    // std::fprintf(stderr, "[pre-alloc] %d bytes failed !\n", block_size);
-                    std::free(ptr); // NOLINT avoid warmup leak if pool push fails
-                }
+            if (global_pool_push(static_cast<int>(idx), block))
+            {
+                stats_on_cached(static_cast<int>(idx));
             }
             else
             {
-                return;
+                warmup_release(block, static_cast<int>(idx));
             }
         }
-
-        block_size <<= 1;
     } // end fill memory cache
-
-    // std::printf("[total mem] %d bytes pre-allocated in memory pool\n", static_cast<int>(total_mem));
 #endif
 }
 
 void destroy_mem_pool_allocator()
 {
+#if defined(MEM_POOL_MAGAZINE_THREAD_LOCAL) || defined(MEM_POOL_MAGAZINE_FREERTOS_TLSP)
+    // give back the blocks cached by the calling thread, other threads flush when they end
+    if (auto* magazines = current_magazines())
+    {
+        flush_thread_magazines(*magazines);
+    }
+#endif
+
     // release all blocks from the pool
 
-    for (auto& entry : g_mem_cache)
+    for (std::size_t idx = 0U; idx < NB_CACHED_BLOCK_CLASSES; ++idx)
     {
-        std::scoped_lock lock(entry.m_pop_mtx, entry.m_push_mtx);
-
         void* block = nullptr;
-        while (entry.m_pool.pop(block))
+        while (global_pool_pop(static_cast<int>(idx), block))
+        {
+            stats_on_evicted(static_cast<int>(idx));
+            release_block(block, static_cast<int>(idx));
+        }
+    }
+}
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+
+bool init_mem_pool_tlsf_heap(void* region, std::size_t size)
+{
+    if ((region == nullptr) || g_tlsf_claimed.exchange(true, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    // placement new does not go through the replaced operator new
+    auto* heap = new (static_cast<void*>(g_tlsf_storage)) tools::tlsf_heap(region, size);
+    g_tlsf_heap.store(heap, std::memory_order_release);
+
+    return true;
+}
+
+namespace tools
+{
+    std::optional<tlsf_heap_stats> mem_pool_tlsf_stats()
+    {
+        if (auto* heap = g_tlsf_heap.load(std::memory_order_acquire))
+        {
+            return heap->stats();
+        }
+
+        return std::nullopt;
+    }
+}
+
+#endif // USE_MEM_POOL_ALLOCATOR_TLSF
+
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+
+namespace tools
+{
+    std::size_t mem_pool_size_classes() noexcept
+    {
+        return NB_CACHED_BLOCK_CLASSES;
+    }
+
+    std::optional<mem_pool_class_stats> mem_pool_stats(std::size_t class_index) noexcept
+    {
+        if (class_index >= NB_CACHED_BLOCK_CLASSES)
         {
-            std::free(block); // NOLINT we want to use libc free as we overload delete operator
+            return std::nullopt;
+        }
+
+        const auto& entry = g_mem_stats[class_index]; // NOLINT bounds checked above
+        const auto& config = SIZE_CLASSES[class_index]; // NOLINT bounds checked above
+
+        mem_pool_class_stats stats;
+        stats.block_size = config.block_size;
+        stats.capacity = (static_cast<std::size_t>(1U) << config.capacity_pow2);
+        stats.hits = entry.hits.load(std::memory_order_relaxed);
+        stats.misses = entry.misses.load(std::memory_order_relaxed);
+        stats.slab_allocations = entry.slab_allocations.load(std::memory_order_relaxed);
+        stats.overflows = entry.overflows.load(std::memory_order_relaxed);
+        stats.occupancy = entry.occupancy.load(std::memory_order_relaxed);
+        stats.high_water_mark = entry.high_water_mark.load(std::memory_order_relaxed);
+        stats.in_use = entry.in_use.load(std::memory_order_relaxed);
+        stats.peak_in_use = entry.peak_in_use.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    void reset_mem_pool_stats() noexcept
+    {
+        for (auto& entry : g_mem_stats)
+        {
+            entry.hits.store(0U, std::memory_order_relaxed);
+            entry.misses.store(0U, std::memory_order_relaxed);
+            entry.slab_allocations.store(0U, std::memory_order_relaxed);
+            entry.overflows.store(0U, std::memory_order_relaxed);
+            entry.high_water_mark.store(entry.occupancy.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            entry.peak_in_use.store(entry.in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
         }
     }
 }
 
+#endif // USE_MEM_POOL_ALLOCATOR_STATS
+
+#if defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+
+namespace tools
+{
+    mem_pool_thread_counters mem_pool_thread_allocations() noexcept
+    {
+        return g_thread_counters;
+    }
+}
+
+#endif // USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS
+
 // ------------------------------------------------------------
 //  Global operator new (scalar)
 // ------------------------------------------------------------
 void* operator new(std::size_t size)
 {
     // std::printf("[new] %d bytes\n", static_cast<int>(size));
+    count_thread_new(size);
     if (void* ptr = cached_new(size))
     {
         return ptr;
@@ -298,10 +1375,11 @@ void* operator new(std::size_t size)
 // ------------------------------------------------------------
 void operator delete(void* ptr) noexcept
 {
-    // Intentionally bypass cache for unsized delete: we rely on modern toolchains
+    // Slab blocks are recycled, heap blocks bypass the cache: we rely on modern toolchains
     // emitting sized delete for most deallocations.
     // std::printf("[delete] unsized\n");
-    std::free(ptr); // NOLINT we want to use libc free as we overload delete operator
+    count_thread_delete(ptr);
+    cached_delete(ptr);
 }
 
 // ------------------------------------------------------------
@@ -311,6 +1389,7 @@ void operator delete(void* ptr) noexcept
 void operator delete(void* ptr, std::size_t size) noexcept
 {
     // std::printf("[delete] sized: %d bytes\n", size);
+    count_thread_delete(ptr);
     cached_delete(ptr, size);
 }
 
@@ -320,6 +1399,7 @@ void operator delete(void* ptr, std::size_t size) noexcept
 void* operator new[](std::size_t size)
 {
     // std::printf("[new[]] %d bytes\n", static_cast<int>(size));
+    count_thread_new(size);
     if (void* ptr = cached_new(size))
     {
         return ptr;
@@ -331,15 +1411,17 @@ void* operator new[](std::size_t size)
 
 void operator delete[](void* ptr) noexcept
 {
-    // Intentionally bypass cache for unsized delete[]: we rely on modern toolchains
+    // Slab blocks are recycled, heap blocks bypass the cache: we rely on modern toolchains
     // emitting sized delete[] for most deallocations.
     // std::printf("[delete[]] unsized\n");
-    std::free(ptr); // NOLINT we want to use libc free as we overload delete operator
+    count_thread_delete(ptr);
+    cached_delete(ptr);
 }
 
 void operator delete[](void* ptr, std::size_t size) noexcept
 {
     // std::printf("[delete[]] sized: %d bytes\n", size);
+    count_thread_delete(ptr);
     cached_delete(ptr, size);
 }
 
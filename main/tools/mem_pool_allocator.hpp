@@ -0,0 +1,168 @@
+/**
+ * @file mem_pool_allocator.hpp
+ * @brief Entry points and optional statistics of the caching mem pool allocator.
+ *
+ * The allocator itself overrides the global new/delete operators in mem_pool_allocator.cpp when
+ * USE_MEM_POOL_ALLOCATOR is defined. With USE_MEM_POOL_ALLOCATOR_STATS, it also maintains per size class
+ * counters that are exposed here to help sizing the pools.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(MEM_POOL_ALLOCATOR_HPP_)
+#define MEM_POOL_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#if defined(USE_MEM_POOL_ALLOCATOR) && defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+#include "tools/tlsf_heap.hpp"
+#endif
+
+#if defined(USE_MEM_POOL_ALLOCATOR)
+
+/**
+ * @brief Prepare the mem pool allocator.
+ *
+ * With USE_MEM_POOL_ALLOCATOR_WARMUP, the pools are filled with blocks carved from one heap allocation: the
+ * MEM_POOL_WARMUP_TARGETS blocks of each size class (a comma separated list in class order, e.g. the peak_in_use
+ * values of a profiling run), or every pool to capacity without a target table.
+ */
+void init_mem_pool_allocator();
+
+/**
+ * @brief Release the blocks cached by the global pools and by the calling thread.
+ */
+void destroy_mem_pool_allocator();
+
+#if defined(USE_MEM_POOL_ALLOCATOR_TLSF)
+
+/**
+ * @brief Serve the allocations above the cached size classes from a TLSF heap over a memory region.
+ *
+ * Only the first installation succeeds, and the region (e.g. a PSRAM buffer from heap_caps_malloc) is used until the
+ * end of the program. Requests the heap cannot satisfy fall back to the system heap. When MEM_POOL_TLSF_REGION_SIZE
+ * is defined, init_mem_pool_allocator() installs a region of that size taken from the system heap (with the
+ * MEM_POOL_TLSF_REGION_CAPS capabilities on ESP32, PSRAM when available).
+ *
+ * @param region Start of the memory region.
+ * @param size Size of the region in bytes.
+ * @return true if the heap was installed, false if one already was or region is nullptr.
+ */
+bool init_mem_pool_tlsf_heap(void* region, std::size_t size);
+
+namespace tools
+{
+    /**
+     * @brief Read the occupancy and fragmentation counters of the TLSF heap.
+     *
+     * @return The counters, or std::nullopt until a heap is installed.
+     */
+    std::optional<tlsf_heap_stats> mem_pool_tlsf_stats();
+}
+
+#endif // USE_MEM_POOL_ALLOCATOR_TLSF
+
+#if defined(USE_MEM_POOL_ALLOCATOR_STATS)
+
+namespace tools
+{
+    /**
+     * @brief Snapshot of the counters of one size class of the mem pool allocator.
+     */
+    struct mem_pool_class_stats
+    {
+        std::size_t block_size = 0U;       ///< Size in bytes of the blocks of this class.
+        std::size_t capacity = 0U;         ///< Number of blocks the global pool of this class can hold.
+        std::size_t hits = 0U;             ///< Allocations served from cached blocks.
+        std::size_t misses = 0U;           ///< Allocations that fell back to the heap.
+        std::size_t slab_allocations = 0U; ///< Cache misses carved from the class slab (USE_MEM_POOL_ALLOCATOR_SLABS).
+        std::size_t overflows = 0U;        ///< Releases that left the cache because it was full.
+        std::size_t occupancy = 0U;        ///< Blocks currently cached (global pool and per-thread magazines).
+        std::size_t high_water_mark = 0U;  ///< Highest occupancy observed since start or last reset.
+        std::size_t in_use = 0U;           ///< Blocks currently handed out (sized deletes and slab/warmup blocks).
+        std::size_t peak_in_use = 0U;      ///< Highest in_use since start or last reset, the class warmup target.
+    };
+
+    /**
+     * @brief Get the number of size classes of the mem pool allocator.
+     *
+     * @return Number of size classes.
+     */
+    std::size_t mem_pool_size_classes() noexcept;
+
+    /**
+     * @brief Read the counters of a size class.
+     *
+     * Counters are updated with relaxed atomics, so the fields of a snapshot taken while other threads
+     * allocate are individually exact but not mutually consistent.
+     *
+     * @param class_index Index of the size class, smaller than mem_pool_size_classes().
+     * @return The counters, or std::nullopt if the index is out of range.
+     */
+    std::optional<mem_pool_class_stats> mem_pool_stats(std::size_t class_index) noexcept;
+
+    /**
+     * @brief Reset hit/miss/overflow counters and set the high-water marks and peaks to the current values.
+     */
+    void reset_mem_pool_stats() noexcept;
+}
+
+#endif // USE_MEM_POOL_ALLOCATOR_STATS
+
+#if defined(USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS)
+
+namespace tools
+{
+    /**
+     * @brief Allocations made and released by one thread through the global operator new/delete.
+     */
+    struct mem_pool_thread_counters
+    {
+        std::uint64_t allocations = 0U;   ///< operator new and new[] calls.
+        std::uint64_t deallocations = 0U; ///< operator delete and delete[] calls on a non null pointer.
+        std::uint64_t bytes = 0U;         ///< Bytes requested by the allocations.
+    };
+
+    /**
+     * @brief Read the allocation counters of the calling thread, e.g. to assert that a hot path does not allocate.
+     *
+     * @return The counters accumulated since the thread started.
+     */
+    mem_pool_thread_counters mem_pool_thread_allocations() noexcept;
+}
+
+#endif // USE_MEM_POOL_ALLOCATOR_THREAD_COUNTERS
+
+#endif // USE_MEM_POOL_ALLOCATOR
+
+#endif //  MEM_POOL_ALLOCATOR_HPP_
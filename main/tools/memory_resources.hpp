@@ -0,0 +1,355 @@
+/**
+ * @file memory_resources.hpp
+ * @brief std::pmr memory resources over the framework allocators, and pmr flavours of the tools containers.
+ *
+ * mem_pool_resource forwards to the global operator new and sized operator delete, so with
+ * USE_MEM_POOL_ALLOCATOR a pmr container is served by the size class caches (and their slabs and TLSF heap).
+ * static_arena_resource carves allocations out of an in-object buffer for containers whose contents are released
+ * all at once, and tlsf_resource serves them from a TLSF heap over a caller-provided region. The tools::pmr aliases
+ * name the containers taking a std::pmr::memory_resource* at construction.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(MEMORY_RESOURCES_HPP_)
+#define MEMORY_RESOURCES_HPP_
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#endif
+
+#if defined(__cpp_lib_memory_resource)
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <new>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "tools/critical_section.hpp"
+#include "tools/histogram.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/ring_vector.hpp"
+#include "tools/sync_dictionary.hpp"
+#include "tools/sync_queue.hpp"
+#include "tools/time_list.hpp"
+#include "tools/tlsf_heap.hpp"
+
+namespace tools
+{
+    inline std::pmr::memory_resource* get_mem_pool_resource() noexcept;
+
+    /**
+     * @brief Memory resource forwarding to the global operator new and sized operator delete.
+     *
+     * Unlike std::pmr::new_delete_resource(), the size is always handed back to operator delete, which lets the
+     * mem pool allocator recycle the block in its size class without looking it up. Over-aligned requests use the
+     * aligned operators. Every instance compares equal to the shared one, which can release its blocks.
+     */
+    class mem_pool_resource : public std::pmr::memory_resource
+    {
+    public:
+        mem_pool_resource() = default;
+        ~mem_pool_resource() override = default;
+
+        mem_pool_resource(const mem_pool_resource&) = delete;
+        mem_pool_resource& operator=(const mem_pool_resource&) = delete;
+        mem_pool_resource(mem_pool_resource&&) = delete;
+        mem_pool_resource& operator=(mem_pool_resource&&) = delete;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(bytes, std::align_val_t { alignment });
+            }
+            return ::operator new(bytes);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(ptr, bytes, std::align_val_t { alignment });
+                return;
+            }
+            ::operator delete(ptr, bytes);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            // identity plus the shared singleton, no dynamic_cast since ESP32 builds may disable RTTI
+            return (this == &other) || (&other == get_mem_pool_resource());
+        }
+    };
+
+    /**
+     * @brief Returns the process wide mem_pool_resource.
+     *
+     * @return Pointer to a resource living for the whole program.
+     */
+    inline std::pmr::memory_resource* get_mem_pool_resource() noexcept
+    {
+        static mem_pool_resource resource;
+        return &resource;
+    }
+
+    /**
+     * @brief Monotonic memory resource over an in-object buffer of Size bytes.
+     *
+     * Deallocation is a no-op and memory is only reclaimed by release() or destruction; once the buffer is
+     * exhausted, further chunks come from the upstream resource. Declared as a global or a member of a long lived
+     * object, the arena keeps a container entirely off the heap as long as it stays within Size bytes. Not thread
+     * safe, like std::pmr::monotonic_buffer_resource.
+     *
+     * @tparam Size Size of the in-object buffer in bytes.
+     */
+    template <std::size_t Size>
+    class static_arena_resource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Builds an arena over the in-object buffer.
+         *
+         * @param upstream Resource serving the requests beyond the buffer, the mem pool resource by default.
+         */
+        explicit static_arena_resource(std::pmr::memory_resource* upstream = get_mem_pool_resource())
+            : m_monotonic(m_buffer.data(), m_buffer.size(), upstream)
+        {
+        }
+
+        ~static_arena_resource() override = default;
+
+        static_arena_resource(const static_arena_resource&) = delete;
+        static_arena_resource& operator=(const static_arena_resource&) = delete;
+        static_arena_resource(static_arena_resource&&) = delete;
+        static_arena_resource& operator=(static_arena_resource&&) = delete;
+
+        /**
+         * @brief Releases every allocation at once and rewinds to the start of the buffer.
+         *
+         * All the containers allocated from the arena must be gone or cleared beforehand.
+         */
+        void release()
+        {
+            m_monotonic.release();
+        }
+
+        /**
+         * @brief Returns the size of the in-object buffer.
+         *
+         * @return Size in bytes.
+         */
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept
+        {
+            return Size;
+        }
+
+        /**
+         * @brief Tells whether a pointer lies in the in-object buffer.
+         *
+         * @param ptr Pointer to test.
+         * @return True if ptr was carved from the buffer rather than from upstream.
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept
+        {
+            const auto* byte = static_cast<const std::byte*>(ptr);
+            return (byte >= m_buffer.data()) && (byte < (m_buffer.data() + Size)); // NOLINT pointer arithmetic
+        }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            return m_monotonic.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            m_monotonic.deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        alignas(std::max_align_t) std::array<std::byte, Size> m_buffer = {};
+        std::pmr::monotonic_buffer_resource m_monotonic;
+    };
+
+    /**
+     * @brief Memory resource serving allocations from a TLSF heap over a fixed region.
+     *
+     * Allocation and deallocation run in bounded time. Over-aligned requests, and requests the heap cannot
+     * satisfy, go to the upstream resource; deallocation tells them apart by address.
+     *
+     * @tparam Lock Lock type protecting the heap, critical_section by default.
+     */
+    template <typename Lock = critical_section>
+    class basic_tlsf_resource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Builds a TLSF heap over the region.
+         *
+         * @param region Start of the memory region, not owned, outliving the resource.
+         * @param size Size of the region in bytes.
+         * @param upstream Fallback resource, the mem pool resource by default; std::pmr::null_memory_resource()
+         *        makes exhaustion throw std::bad_alloc.
+         */
+        basic_tlsf_resource(
+            void* region, std::size_t size, std::pmr::memory_resource* upstream = get_mem_pool_resource())
+            : m_heap(region, size)
+            , m_upstream(upstream)
+        {
+        }
+
+        ~basic_tlsf_resource() override = default;
+
+        basic_tlsf_resource(const basic_tlsf_resource&) = delete;
+        basic_tlsf_resource& operator=(const basic_tlsf_resource&) = delete;
+        basic_tlsf_resource(basic_tlsf_resource&&) = delete;
+        basic_tlsf_resource& operator=(basic_tlsf_resource&&) = delete;
+
+        /**
+         * @brief Returns the underlying heap, for its statistics.
+         *
+         * @return Reference to the heap.
+         */
+        [[nodiscard]] basic_tlsf_heap<Lock>& heap() noexcept
+        {
+            return m_heap;
+        }
+
+        /**
+         * @brief Returns the fallback resource.
+         *
+         * @return Pointer to the upstream resource.
+         */
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+        {
+            return m_upstream;
+        }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if (alignment <= basic_tlsf_heap<Lock>::alignment)
+            {
+                void* block = m_heap.allocate(bytes);
+                if (block != nullptr)
+                {
+                    return block;
+                }
+            }
+            return m_upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            if (m_heap.owns(ptr))
+            {
+                m_heap.deallocate(ptr);
+                return;
+            }
+            m_upstream->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        basic_tlsf_heap<Lock> m_heap;
+        std::pmr::memory_resource* m_upstream;
+    };
+
+    /**
+     * @brief TLSF memory resource guarded by a critical_section.
+     */
+    using tlsf_resource = basic_tlsf_resource<>;
+
+    namespace pmr
+    {
+        /**
+         * @brief Thread-safe queue whose deque allocates from a memory resource given at construction.
+         *
+         * @tparam T Element type.
+         */
+        template <typename T>
+        using sync_queue = basic_sync_queue<T, critical_section, std::queue<T, std::pmr::deque<T>>>;
+
+        /**
+         * @brief Thread-safe dictionary whose map allocates from a memory resource given at construction.
+         *
+         * @tparam K Key type.
+         * @tparam T Value type.
+         */
+        template <typename K, typename T>
+        using sync_dictionary = tools::sync_dictionary<K, T, std::pmr::map<K, T>>;
+
+        /**
+         * @brief Ring vector whose storage is allocated from a memory resource given at construction.
+         *
+         * @tparam T Element type.
+         */
+        template <typename T>
+        using ring_vector = tools::ring_vector<T, std::pmr::polymorphic_allocator<T>>;
+
+        /**
+         * @brief Time list whose entries are allocated from a memory resource given at construction.
+         *
+         * @tparam TTimestamp Timestamp type.
+         * @tparam TValue Value type.
+         */
+        template <typename TTimestamp, typename TValue>
+        using time_list
+            = tools::time_list<TTimestamp, TValue, std::pmr::polymorphic_allocator<std::pair<TTimestamp, TValue>>>;
+
+        /**
+         * @brief Histogram whose counters are allocated from a memory resource given at construction.
+         *
+         * @tparam T Value type.
+         */
+        template <typename T>
+        using histogram = tools::histogram<T, std::pmr::unordered_map<T, int>>;
+    }
+}
+
+#endif // defined(__cpp_lib_memory_resource)
+
+#endif //  MEMORY_RESOURCES_HPP_
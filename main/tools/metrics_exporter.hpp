@@ -0,0 +1,494 @@
+/**
+ * @file metrics_exporter.hpp
+ * @brief OpenMetrics text rendering of the statistics surfaces, for a scraper or a file dump.
+ *
+ * metrics_exporter holds collectors, callables that read the snapshots of a statistics surface (sync
+ * containers, periodic tasks, delivery latencies, TLSF heap, task monitor) and write them as metric families
+ * through an openmetrics_writer. Rendering runs on the scraping thread and only reads snapshots, which are
+ * relaxed atomic loads or copies taken under the short locks of the surfaces, so scrapes never hold a lock
+ * a publisher waits on for longer than a snapshot.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(METRICS_EXPORTER_HPP_)
+#define METRICS_EXPORTER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/latency_clock.hpp"
+#include "tools/log2_histogram.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/periodic_task_stats.hpp"
+#include "tools/sync_container_stats.hpp"
+#include "tools/task_monitor.hpp"
+#include "tools/tlsf_heap.hpp"
+
+namespace tools
+{
+    /**
+     * @brief OpenMetrics type of a metric family.
+     */
+    enum class metric_type : std::uint8_t
+    {
+        counter,  ///< Monotonic total, rendered with the _total suffix.
+        gauge,    ///< Current value.
+        histogram ///< Cumulative buckets with _bucket, _count and _sum samples.
+    };
+
+    /**
+     * @brief Name and value of one label of a sample.
+     */
+    struct metric_label
+    {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    /**
+     * @brief Metric family under construction: its metadata and the text of its samples.
+     */
+    class metric_family
+    {
+    public:
+        metric_family(std::string_view name, metric_type type, std::string_view help)
+            : m_name(name)
+            , m_type(type)
+            , m_help(help)
+        {
+        }
+
+        [[nodiscard]] const std::string& name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Adds a counter or gauge sample.
+         *
+         * @param labels The labels of the sample.
+         * @param value The value.
+         * @return The family, to chain samples.
+         */
+        metric_family& add(std::initializer_list<metric_label> labels, std::uint64_t value)
+        {
+            append_sample((metric_type::counter == m_type) ? "_total" : "", labels, {}, std::to_string(value));
+            return *this;
+        }
+
+        metric_family& add(std::initializer_list<metric_label> labels, double value)
+        {
+            append_sample((metric_type::counter == m_type) ? "_total" : "", labels, {}, format_double(value));
+            return *this;
+        }
+
+        /**
+         * @brief Adds the samples of a log2 histogram: one cumulative bucket per power of two, then count and sum.
+         *
+         * @tparam BucketCount The number of buckets of the histogram.
+         * @param labels The labels of the histogram.
+         * @param histogram The histogram snapshot.
+         * @return The family, to chain samples.
+         */
+        template <std::size_t BucketCount>
+        metric_family& add(
+            std::initializer_list<metric_label> labels, const log2_histogram_snapshot<BucketCount>& histogram)
+        {
+            std::uint64_t cumulated = 0U;
+            for (std::size_t bucket = 0U; bucket < BucketCount; ++bucket)
+            {
+                cumulated += histogram.buckets[bucket];
+                // bucket b holds the samples below 2^b, so its inclusive integer bound is 2^b - 1
+                const std::string bound = ((bucket + 1U) < BucketCount)
+                    ? std::to_string(log2_histogram_snapshot<BucketCount>::upper_bound(bucket) - 1U)
+                    : std::string("+Inf");
+                append_sample("_bucket", labels, bound, std::to_string(cumulated));
+            }
+            append_sample("_count", labels, {}, std::to_string(histogram.count));
+            append_sample("_sum", labels, {}, std::to_string(histogram.sum));
+            return *this;
+        }
+
+        /**
+         * @brief Appends the metadata and the samples of the family to a text.
+         *
+         * @param output The text.
+         */
+        void render(std::string& output) const
+        {
+            static constexpr const char* type_names[] = { "counter", "gauge", "histogram" };
+            output.append("# TYPE ").append(m_name).append(" ").append(type_names[static_cast<std::size_t>(m_type)]);
+            output.append("\n# HELP ").append(m_name).append(" ");
+            append_escaped(output, m_help, false);
+            output.append("\n").append(m_samples);
+        }
+
+    private:
+        void append_sample(const char* suffix, std::initializer_list<metric_label> labels, std::string_view bound,
+            const std::string& value)
+        {
+            m_samples.append(m_name).append(suffix);
+            if ((0U != labels.size()) || !bound.empty())
+            {
+                char separator = '{';
+                for (const auto& label : labels)
+                {
+                    m_samples.push_back(separator);
+                    m_samples.append(label.name).append("=\"");
+                    append_escaped(m_samples, label.value, true);
+                    m_samples.push_back('"');
+                    separator = ',';
+                }
+                if (!bound.empty())
+                {
+                    m_samples.push_back(separator);
+                    m_samples.append("le=\"").append(bound).append("\"");
+                }
+                m_samples.push_back('}');
+            }
+            m_samples.append(" ").append(value).append("\n");
+        }
+
+        static void append_escaped(std::string& output, std::string_view text, bool escape_quotes)
+        {
+            for (const char character : text)
+            {
+                if ('\\' == character)
+                {
+                    output.append("\\\\");
+                }
+                else if ('\n' == character)
+                {
+                    output.append("\\n");
+                }
+                else if (escape_quotes && ('"' == character))
+                {
+                    output.append("\\\"");
+                }
+                else
+                {
+                    output.push_back(character);
+                }
+            }
+        }
+
+        static std::string format_double(double value)
+        {
+            char buffer[32] = {};
+            static_cast<void>(std::snprintf(buffer, sizeof(buffer), "%.9g", value));
+            return std::string(buffer);
+        }
+
+        std::string m_name;
+        metric_type m_type;
+        std::string m_help;
+        std::string m_samples;
+    };
+
+    /**
+     * @brief Collects metric families and renders them as one OpenMetrics exposition.
+     *
+     * Asking twice for a family returns the same one, so that several collectors can add samples to a shared
+     * family (one sample per container, per task, ...) and each family is still rendered in one block.
+     */
+    class openmetrics_writer
+    {
+    public:
+        /**
+         * @brief Gets a metric family, declaring it on first use.
+         *
+         * @param name The family name, e.g. pubsub_container_pushes.
+         * @param type The type, fixed by the first declaration.
+         * @param help The description, fixed by the first declaration.
+         * @return The family.
+         */
+        metric_family& family(std::string_view name, metric_type type, std::string_view help)
+        {
+            for (auto& existing : m_families)
+            {
+                if (existing.name() == name)
+                {
+                    return existing;
+                }
+            }
+            return m_families.emplace_back(name, type, help);
+        }
+
+        /**
+         * @brief Renders the families in declaration order, terminated by the # EOF marker.
+         *
+         * @return The exposition text.
+         */
+        [[nodiscard]] std::string finish() const
+        {
+            std::string output;
+            for (const auto& family : m_families)
+            {
+                family.render(output);
+            }
+            output.append("# EOF\n");
+            return output;
+        }
+
+    private:
+        std::deque<metric_family> m_families;
+    };
+
+    /**
+     * @brief Registry of metric collectors rendered together on demand.
+     *
+     * Collectors run on the rendering thread, in registration order, under the registry lock; they must only
+     * read snapshots and return quickly.
+     */
+    class metrics_exporter : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Callable writing the current samples of one statistics surface.
+         */
+        using collector = std::function<void(openmetrics_writer& writer)>;
+
+        metrics_exporter() = default;
+        ~metrics_exporter() = default;
+
+        /**
+         * @brief Registers a collector.
+         *
+         * @param collect The collector.
+         * @return The handle given to remove_collector().
+         */
+        std::size_t add_collector(collector collect)
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            const std::size_t handle = m_next_handle++;
+            m_collectors.emplace_back(handle, std::move(collect));
+            return handle;
+        }
+
+        /**
+         * @brief Unregisters a collector, e.g. before the surface it reads is destroyed.
+         *
+         * @param handle The handle returned by add_collector().
+         * @return false if no collector has this handle.
+         */
+        bool remove_collector(std::size_t handle)
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            for (auto it = m_collectors.begin(); it != m_collectors.end(); ++it)
+            {
+                if (it->first == handle)
+                {
+                    m_collectors.erase(it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Runs every collector and renders their samples.
+         *
+         * @return The OpenMetrics exposition text.
+         */
+        [[nodiscard]] std::string render() const
+        {
+            openmetrics_writer writer;
+            {
+                std::scoped_lock<critical_section> guard(m_mutex);
+                for (const auto& entry : m_collectors)
+                {
+                    entry.second(writer);
+                }
+            }
+            return writer.finish();
+        }
+
+        /**
+         * @brief Renders the metrics into a file, replaced atomically (written aside, then renamed) so that a
+         * textfile collector never reads a partial exposition.
+         *
+         * @param path The file path.
+         * @return false if the file could not be written.
+         */
+        [[nodiscard]] bool dump_to_file(const std::string& path) const
+        {
+            const std::string text = render();
+            const std::string temporary_path = path + ".tmp";
+            FILE* file = std::fopen(temporary_path.c_str(), "wb");
+            if (nullptr == file)
+            {
+                return false;
+            }
+            const bool written = (text.size() == std::fwrite(text.data(), 1U, text.size(), file));
+            const bool closed = (0 == std::fclose(file));
+            if (!written || !closed || (0 != std::rename(temporary_path.c_str(), path.c_str())))
+            {
+                static_cast<void>(std::remove(temporary_path.c_str()));
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        mutable critical_section m_mutex;
+        std::vector<std::pair<std::size_t, collector>> m_collectors;
+        std::size_t m_next_handle = 0U;
+    };
+
+    /**
+     * @brief Writes the counters of every container instrumented with sync_container_stats, labelled by name.
+     *
+     * @param writer The writer.
+     */
+    inline void write_sync_container_metrics(openmetrics_writer& writer)
+    {
+        for (const auto& stats : sync_container_registry::instance().snapshot())
+        {
+            const std::initializer_list<metric_label> labels = { { "container", stats.name } };
+            writer.family("pubsub_container_pushes", metric_type::counter, "Elements pushed").add(labels, stats.pushes);
+            writer.family("pubsub_container_pops", metric_type::counter, "Elements popped").add(labels, stats.pops);
+            writer.family("pubsub_container_high_water_mark", metric_type::gauge, "Largest element count")
+                .add(labels, static_cast<std::uint64_t>(stats.high_water_mark));
+            writer.family("pubsub_container_overflows", metric_type::counter, "Elements refused by a full container")
+                .add(labels, stats.overflows);
+            writer.family("pubsub_container_overwrites", metric_type::counter, "Oldest elements overwritten")
+                .add(labels, stats.overwrites);
+            writer.family("pubsub_container_contended_locks", metric_type::counter, "Lock acquisitions that waited")
+                .add(labels, stats.contended_locks);
+            writer.family("pubsub_container_lock_wait_nanoseconds", metric_type::counter, "Time waiting for the lock")
+                .add(labels, stats.lock_wait.count());
+        }
+    }
+
+    /**
+     * @brief Writes the lateness and execution time histograms and the overrun counters of a periodic task.
+     *
+     * @param writer The writer.
+     * @param task_name The task label.
+     * @param stats The snapshot of the task statistics.
+     */
+    inline void write_periodic_task_metrics(
+        openmetrics_writer& writer, std::string_view task_name, const periodic_task_stats& stats)
+    {
+        const std::initializer_list<metric_label> labels = { { "task", task_name } };
+        writer.family("pubsub_task_wakeup_lateness_microseconds", metric_type::histogram, "Wakeup time minus deadline")
+            .add(labels, stats.wakeup_lateness);
+        writer.family("pubsub_task_execution_microseconds", metric_type::histogram, "Periodic routine duration")
+            .add(labels, stats.execution_time);
+        writer.family("pubsub_task_overruns", metric_type::counter, "Iterations ended past the next deadline")
+            .add(labels, stats.overruns);
+        writer.family("pubsub_task_skipped_periods", metric_type::counter, "Periods dropped to catch up")
+            .add(labels, stats.skipped_periods);
+    }
+
+    /**
+     * @brief Writes the enqueue and delivery latency histograms of an observer.
+     *
+     * @param writer The writer.
+     * @param observer_name The observer label.
+     * @param stats The snapshot of the observer latencies.
+     */
+    inline void write_delivery_latency_metrics(
+        openmetrics_writer& writer, std::string_view observer_name, const delivery_latency_stats& stats)
+    {
+        const std::initializer_list<metric_label> labels = { { "observer", observer_name } };
+        writer.family("pubsub_enqueue_latency_nanoseconds", metric_type::histogram, "Publish to enqueue latency")
+            .add(labels, stats.enqueued);
+        writer.family("pubsub_delivery_latency_nanoseconds", metric_type::histogram, "Publish to dequeue latency")
+            .add(labels, stats.delivered);
+    }
+
+    /**
+     * @brief Writes the occupancy and fragmentation gauges of a TLSF heap.
+     *
+     * @param writer The writer.
+     * @param heap_name The heap label.
+     * @param stats The snapshot of the heap counters.
+     */
+    inline void write_tlsf_heap_metrics(
+        openmetrics_writer& writer, std::string_view heap_name, const tlsf_heap_stats& stats)
+    {
+        const std::initializer_list<metric_label> labels = { { "heap", heap_name } };
+        writer.family("pubsub_heap_used_bytes", metric_type::gauge, "Bytes of the allocated blocks")
+            .add(labels, static_cast<std::uint64_t>(stats.used_bytes));
+        writer.family("pubsub_heap_free_bytes", metric_type::gauge, "Bytes of the free blocks")
+            .add(labels, static_cast<std::uint64_t>(stats.free_bytes));
+        writer.family("pubsub_heap_high_water_bytes", metric_type::gauge, "Highest used bytes")
+            .add(labels, static_cast<std::uint64_t>(stats.high_water_mark));
+        writer.family("pubsub_heap_largest_free_block_bytes", metric_type::gauge, "Size of the largest free block")
+            .add(labels, static_cast<std::uint64_t>(stats.largest_free_block));
+        writer.family("pubsub_heap_fragmentation_percent", metric_type::gauge, "100 * (1 - largest free / free)")
+            .add(labels, static_cast<std::uint64_t>(stats.fragmentation_percent));
+        writer.family("pubsub_heap_allocations", metric_type::counter, "Successful allocations")
+            .add(labels, static_cast<std::uint64_t>(stats.allocations));
+        writer.family("pubsub_heap_failed_allocations", metric_type::counter, "Allocations no free block satisfied")
+            .add(labels, static_cast<std::uint64_t>(stats.failed_allocations));
+    }
+
+    /**
+     * @brief Writes the CPU share, stack high-water mark and queue depth of the tasks of a task_monitor sample.
+     *
+     * @param writer The writer.
+     * @param snapshot The snapshot returned by task_monitor::sample().
+     */
+    inline void write_task_monitor_metrics(openmetrics_writer& writer, const task_monitor_snapshot& snapshot)
+    {
+        for (const auto& task : snapshot.tasks)
+        {
+            const std::initializer_list<metric_label> labels = { { "task", task.task_name } };
+            writer.family("pubsub_task_cpu_share", metric_type::gauge, "Share of one core over the last interval")
+                .add(labels, task.cpu_share);
+            if (task.stack_high_water.has_value())
+            {
+                writer.family("pubsub_task_stack_free_words", metric_type::gauge, "Minimum free stack")
+                    .add(labels, static_cast<std::uint64_t>(*task.stack_high_water));
+            }
+            if (task.queue_depth.has_value())
+            {
+                writer.family("pubsub_task_queue_depth", metric_type::gauge, "Items waiting in the task queue")
+                    .add(labels, static_cast<std::uint64_t>(*task.queue_depth));
+            }
+        }
+    }
+}
+
+#endif // METRICS_EXPORTER_HPP_
@@ -0,0 +1,361 @@
+/**
+ * @file mpsc_queue.hpp
+ * @brief Node-based multi-producer single-consumer queue with a wait-free push, nodes taken from an object pool.
+ *
+ * Dmitry Vyukov's intrusive MPSC queue: a producer links its node with one atomic exchange on the tail and one
+ * store, so producers on different cores never wait for each other nor for the consumer, which pops lock-free.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(MPSC_QUEUE_HPP_)
+#define MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/non_copyable.hpp"
+#include "tools/object_pool.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Default number of nodes of the object pool of an mpsc_queue.
+     */
+    inline constexpr std::size_t default_mpsc_pool_size = 32U;
+
+    /**
+     * @brief Unbounded multi-producer single-consumer FIFO queue.
+     *
+     * Every element lives in a node linked through an atomic next pointer. push() takes a node, then publishes it
+     * with an exchange on the tail followed by a store into the previous node: it never loops nor blocks once the
+     * node is taken. Nodes come from an object_pool of PoolSize nodes embedded in the queue (a lock-free pop), and
+     * from the heap only while the pool is exhausted. The consumer pops from the head without any atomic
+     * read-modify-write and gives the nodes back.
+     *
+     * Only one thread at a time may call the consumer methods (front_pop(), pop(), pop_range()); any thread may
+     * push. An element whose producer was interrupted between its exchange and its store is not visible yet, and
+     * neither are the elements pushed after it until that producer resumes, so consumers must treat an empty pop
+     * as "nothing for now" rather than spin on size(). Same interface as sync_queue for these operations, so that
+     * it plugs into async_observer.
+     *
+     * @tparam T The type of the elements.
+     * @tparam PoolSize Number of pooled nodes, the usual maximum depth of the queue.
+     */
+    template <typename T, std::size_t PoolSize = default_mpsc_pool_size>
+    class mpsc_queue : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        mpsc_queue()
+            : m_head(make_node())
+            , m_tail(m_head)
+        {
+        }
+
+        ~mpsc_queue()
+        {
+            while (pop_node())
+            {
+            }
+            free_node(m_head);
+        }
+
+        /**
+         * @brief Pushes a copy of an element at the back of the queue.
+         *
+         * @param elem The element.
+         */
+        void push(const T& elem)
+        {
+            emplace(elem);
+        }
+
+        /**
+         * @brief Moves an element at the back of the queue.
+         *
+         * @param elem The element.
+         */
+        void push(T&& elem)
+        {
+            emplace(std::move(elem));
+        }
+
+        /**
+         * @brief Constructs an element at the back of the queue.
+         *
+         * @param args Constructor arguments of T.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args)
+        {
+            node* item = make_node(std::in_place, std::forward<Args>(args)...);
+            link(item, item, 1);
+        }
+
+        /**
+         * @brief Pushes the elements of a range, contiguous in the queue, with a single exchange on the tail.
+         *
+         * @param range The elements, front first.
+         */
+        template <typename Range>
+        auto push_range(const Range& range) -> decltype(std::begin(range), std::end(range), void())
+        {
+            push_range(std::begin(range), std::end(range));
+        }
+
+        /**
+         * @brief Pushes the elements of an iterator range, contiguous in the queue, with a single exchange on the
+         * tail.
+         *
+         * @param first_elem Begin iterator, dereferenced once per element (a move iterator moves them).
+         * @param last_elem End iterator.
+         */
+        template <typename InputIt>
+        void push_range(InputIt first_elem, InputIt last_elem)
+        {
+            node* first = nullptr;
+            node* last = nullptr;
+            std::ptrdiff_t count = 0;
+
+            for (; first_elem != last_elem; ++first_elem)
+            {
+                node* item = make_node(std::in_place, *first_elem);
+                if (last == nullptr)
+                {
+                    first = item;
+                }
+                else
+                {
+                    last->next.store(item, std::memory_order_relaxed);
+                }
+                last = item;
+                ++count;
+            }
+
+            if (first != nullptr)
+            {
+                link(first, last, count);
+            }
+        }
+
+        /**
+         * @brief Removes and returns the front element (consumer only).
+         *
+         * @return The element, or nothing if no element is visible.
+         */
+        [[nodiscard]] std::optional<T> front_pop()
+        {
+            std::optional<T> elem;
+            node* next = m_head->next.load(std::memory_order_acquire);
+
+            if (next != nullptr)
+            {
+                elem.emplace(std::move(next->value.value()));
+                advance(next);
+            }
+
+            return elem;
+        }
+
+        /**
+         * @brief Removes the front element, if any (consumer only).
+         */
+        void pop()
+        {
+            static_cast<void>(pop_node());
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of front elements into an output range (consumer only).
+         *
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of elements moved.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            std::size_t count = 0U;
+
+            for (; first != last; ++first)
+            {
+                node* next = m_head->next.load(std::memory_order_acquire);
+                if (next == nullptr)
+                {
+                    break;
+                }
+
+                *first = std::move(next->value.value());
+                advance(next);
+                ++count;
+            }
+
+            return count;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch pop into contiguous storage (consumer only).
+         *
+         * @param destination Span over writable destination storage.
+         * @return The number of elements moved.
+         */
+        [[nodiscard]] std::size_t pop_range(std::span<T> destination)
+        {
+            return pop_range(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Tells whether the queue holds no element.
+         *
+         * @return true if empty (relaxed read, exact once producers are quiescent).
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return m_size.load(std::memory_order_relaxed) <= 0;
+        }
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         *
+         * @return The element count (relaxed read, exact once producers are quiescent).
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            const std::ptrdiff_t size = m_size.load(std::memory_order_relaxed);
+            return (size > 0) ? static_cast<std::size_t>(size) : 0U;
+        }
+
+        /**
+         * @brief Returns the number of nodes the queue took from the heap because its pool was exhausted.
+         *
+         * @return The heap node count since construction (relaxed read).
+         */
+        [[nodiscard]] std::size_t heap_node_count() const
+        {
+            return m_heap_nodes.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct node
+        {
+            node() = default;
+
+            template <typename... Args>
+            explicit node(std::in_place_t tag, Args&&... args)
+                : value(tag, std::forward<Args>(args)...)
+            {
+            }
+
+            std::atomic<node*> next { nullptr };
+            std::optional<T> value; // empty in the node serving as head
+        };
+
+        template <typename... Args>
+        node* make_node(Args&&... args)
+        {
+            node* item = m_pool.create(std::forward<Args>(args)...);
+            if (item == nullptr)
+            {
+                m_heap_nodes.fetch_add(1U, std::memory_order_relaxed);
+                item = new node(std::forward<Args>(args)...); // NOLINT owned by the queue until popped
+            }
+            return item;
+        }
+
+        void free_node(node* item)
+        {
+            if (m_pool.owns(item))
+            {
+                m_pool.destroy(item);
+            }
+            else
+            {
+                delete item; // NOLINT taken from the heap by make_node
+            }
+        }
+
+        /**
+         * @brief Appends a chain of nodes: the only point where producers meet.
+         */
+        void link(node* first, node* last, std::ptrdiff_t count)
+        {
+            node* previous = m_tail.exchange(last, std::memory_order_acq_rel);
+            previous->next.store(first, std::memory_order_release);
+            m_size.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Makes the popped node the new head, its value gone, and frees the old head.
+         */
+        void advance(node* next)
+        {
+            next->value.reset();
+            node* old_head = m_head;
+            m_head = next;
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            free_node(old_head);
+        }
+
+        bool pop_node()
+        {
+            node* next = m_head->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return false;
+            }
+            advance(next);
+            return true;
+        }
+
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        object_pool<node, PoolSize> m_pool;
+        node* m_head; // consumer side, next of the head is the front element
+        alignas(cache_line_size) std::atomic<node*> m_tail;
+        std::atomic<std::ptrdiff_t> m_size { 0 };
+        std::atomic<std::size_t> m_heap_nodes { 0U };
+    };
+}
+
+#endif // MPSC_QUEUE_HPP_
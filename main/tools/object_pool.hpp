@@ -0,0 +1,515 @@
+/**
+ * @file object_pool.hpp
+ * @brief Typed fixed-capacity object pools with in-object storage and lock-free acquire/release.
+ *
+ * A pool declared as a global or a static lives in .bss: its constructor only zero-initializes the slots, which
+ * are handed out in index order the first time and then recycled most recently released first, so hot objects
+ * stay in cache. object_pool hands out unique pooled_ptr handles, shared_object_pool std::shared_ptr handles
+ * whose control block shares the slot of the object; neither goes through the global operator new.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(OBJECT_POOL_HPP_)
+#define OBJECT_POOL_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        /**
+         * @brief Lock-free pool of N raw blocks of a fixed size.
+         *
+         * Released blocks go on a Treiber stack of slot indexes whose head carries a 16 bit tag against ABA;
+         * slots never handed out yet are taken with a bump counter, so no initialization pass is needed.
+         *
+         * @tparam BlockSize Size of a block in bytes.
+         * @tparam BlockAlign Alignment of the blocks.
+         * @tparam N Number of blocks, at most 65535.
+         */
+        template <std::size_t BlockSize, std::size_t BlockAlign, std::size_t N>
+        class fixed_block_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            static_assert((N > 0U) && (N < 0xFFFFU), "fixed_block_pool holds 1 to 65534 blocks");
+
+            static constexpr std::size_t block_size = BlockSize;
+            static constexpr std::size_t block_alignment = BlockAlign;
+
+            fixed_block_pool() = default;
+            ~fixed_block_pool() = default;
+
+            /**
+             * @brief Takes a free block.
+             *
+             * @return The block, or nullptr if all blocks are in use.
+             */
+            [[nodiscard]] void* allocate() noexcept
+            {
+                std::uint32_t head = m_free_head.load(std::memory_order_acquire);
+
+                while ((head & index_mask) != 0U)
+                {
+                    const std::uint32_t slot = (head & index_mask) - 1U;
+                    const std::uint32_t next = m_next[slot].load(std::memory_order_relaxed); // NOLINT bounded
+                    const std::uint32_t new_head = (next_tag(head)) | next;
+
+                    if (m_free_head.compare_exchange_weak(
+                            head, new_head, std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        return taken(slot);
+                    }
+                }
+
+                // load first, so that an exhausted pool does not keep incrementing the counter
+                if (m_fresh.load(std::memory_order_relaxed) >= N)
+                {
+                    return nullptr;
+                }
+
+                const std::size_t slot = m_fresh.fetch_add(1U, std::memory_order_relaxed);
+                if (slot >= N)
+                {
+                    return nullptr;
+                }
+
+                return taken(static_cast<std::uint32_t>(slot));
+            }
+
+            /**
+             * @brief Gives a block back to the pool.
+             *
+             * @param block Block returned by allocate() on this pool.
+             */
+            void deallocate(void* block) noexcept
+            {
+                const auto slot = static_cast<std::uint32_t>(
+                    (reinterpret_cast<std::uintptr_t>(block) - reinterpret_cast<std::uintptr_t>(m_blocks.data()))
+                    / sizeof(block_storage));
+
+                m_in_use.fetch_sub(1U, std::memory_order_relaxed);
+
+                std::uint32_t head = m_free_head.load(std::memory_order_relaxed);
+                do
+                {
+                    m_next[slot].store(head & index_mask, std::memory_order_relaxed); // NOLINT bounded
+                } while (!m_free_head.compare_exchange_weak(
+                    head, next_tag(head) | (slot + 1U), std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            /**
+             * @brief Tells whether a pointer lies in the blocks of the pool.
+             *
+             * @param ptr Pointer to test.
+             * @return true if ptr is inside one of the blocks.
+             */
+            [[nodiscard]] bool owns(const void* ptr) const noexcept
+            {
+                const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+                const auto first = reinterpret_cast<std::uintptr_t>(m_blocks.data());
+                return (address >= first) && (address < (first + sizeof(m_blocks)));
+            }
+
+            /**
+             * @brief Gets the number of blocks currently handed out.
+             *
+             * @return The blocks in use (relaxed read).
+             */
+            [[nodiscard]] std::size_t in_use() const noexcept
+            {
+                return m_in_use.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Gets the highest number of blocks simultaneously handed out.
+             *
+             * @return The high-water mark (relaxed read).
+             */
+            [[nodiscard]] std::size_t high_water_mark() const noexcept
+            {
+                return m_high_water_mark.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct block_storage
+            {
+                alignas(BlockAlign) unsigned char m_bytes[BlockSize]; // NOLINT raw object storage
+            };
+
+            static constexpr std::uint32_t index_mask = 0xFFFFU;
+            static constexpr std::uint32_t tag_increment = 0x10000U;
+
+            static constexpr std::uint32_t next_tag(std::uint32_t head) noexcept
+            {
+                return (head & ~index_mask) + tag_increment;
+            }
+
+            void* taken(std::uint32_t slot) noexcept
+            {
+                const std::size_t in_use = m_in_use.fetch_add(1U, std::memory_order_relaxed) + 1U;
+                std::size_t high_water_mark = m_high_water_mark.load(std::memory_order_relaxed);
+
+                while ((in_use > high_water_mark)
+                    && !m_high_water_mark.compare_exchange_weak(high_water_mark, in_use, std::memory_order_relaxed))
+                {
+                }
+
+                return m_blocks[slot].m_bytes; // NOLINT bounded by N
+            }
+
+            std::array<block_storage, N> m_blocks = {};
+            std::array<std::atomic<std::uint32_t>, N> m_next = {}; // next free slot + 1, 0 ends the stack
+            std::atomic<std::uint32_t> m_free_head = { 0U };       // tag << 16 | (slot + 1), 0 when empty
+            std::atomic<std::size_t> m_fresh = { 0U };
+            std::atomic<std::size_t> m_in_use = { 0U };
+            std::atomic<std::size_t> m_high_water_mark = { 0U };
+        };
+    }
+
+    /**
+     * @brief Deleter destroying an object and returning its slot to the pool it came from.
+     *
+     * The pool type is erased behind a function pointer, so pooled_ptr<T> does not depend on the pool capacity.
+     *
+     * @tparam T The object type.
+     */
+    template <typename T>
+    class pool_deleter
+    {
+    public:
+        using release_fn = void (*)(void* pool, T* object) noexcept;
+
+        constexpr pool_deleter() noexcept = default;
+
+        constexpr pool_deleter(void* pool, release_fn release) noexcept
+            : m_pool(pool)
+            , m_release(release)
+        {
+        }
+
+        void operator()(T* object) const noexcept
+        {
+            if (m_release != nullptr)
+            {
+                m_release(m_pool, object);
+            }
+        }
+
+    private:
+        void* m_pool = nullptr;
+        release_fn m_release = nullptr;
+    };
+
+    /**
+     * @brief Unique handle of a pooled object, returning it to its pool when reset or destroyed.
+     *
+     * @tparam T The object type.
+     */
+    template <typename T>
+    using pooled_ptr = std::unique_ptr<T, pool_deleter<T>>;
+
+    /**
+     * @brief Fixed-capacity pool of T objects with in-object storage.
+     *
+     * Besides pooled_ptr handles, raw objects from create() fit the trivially copyable payloads of data_task:
+     * submit the pointer and destroy() it at the end of the processing routine.
+     *
+     * @tparam T The object type.
+     * @tparam N Number of objects, at most 65534.
+     */
+    template <typename T, std::size_t N>
+    class object_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        object_pool() = default;
+        ~object_pool() = default;
+
+        /**
+         * @brief Constructs an object in a free slot.
+         *
+         * @param args Constructor arguments of T.
+         * @return The object, or nullptr if the pool is exhausted. Give it back with destroy().
+         */
+        template <typename... Args>
+        [[nodiscard]] T* create(Args&&... args)
+        {
+            void* block = m_blocks.allocate();
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            try
+            {
+                return new (block) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                m_blocks.deallocate(block);
+                throw;
+            }
+#else
+            return new (block) T(std::forward<Args>(args)...);
+#endif
+        }
+
+        /**
+         * @brief Destroys an object and releases its slot.
+         *
+         * @param object Object returned by create() on this pool, or nullptr.
+         */
+        void destroy(T* object) noexcept
+        {
+            if (object != nullptr)
+            {
+                object->~T();
+                m_blocks.deallocate(object);
+            }
+        }
+
+        /**
+         * @brief Constructs an object in a free slot, owned by a unique handle.
+         *
+         * @param args Constructor arguments of T.
+         * @return The handle, empty if the pool is exhausted.
+         */
+        template <typename... Args>
+        [[nodiscard]] pooled_ptr<T> make_unique(Args&&... args)
+        {
+            return pooled_ptr<T>(create(std::forward<Args>(args)...), pool_deleter<T>(this, &release));
+        }
+
+        /**
+         * @brief Tells whether an object comes from this pool.
+         *
+         * @param object Pointer to test.
+         * @return true if object lies in the storage of the pool.
+         */
+        [[nodiscard]] bool owns(const T* object) const noexcept
+        {
+            return m_blocks.owns(object);
+        }
+
+        /**
+         * @brief Gets the capacity of the pool.
+         *
+         * @return N.
+         */
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept
+        {
+            return N;
+        }
+
+        /**
+         * @brief Gets the number of live objects.
+         *
+         * @return The objects in use (relaxed read).
+         */
+        [[nodiscard]] std::size_t in_use() const noexcept
+        {
+            return m_blocks.in_use();
+        }
+
+        /**
+         * @brief Gets the highest number of simultaneously live objects.
+         *
+         * @return The high-water mark (relaxed read).
+         */
+        [[nodiscard]] std::size_t high_water_mark() const noexcept
+        {
+            return m_blocks.high_water_mark();
+        }
+
+    private:
+        static void release(void* pool, T* object) noexcept
+        {
+            static_cast<object_pool*>(pool)->destroy(object);
+        }
+
+        detail::fixed_block_pool<sizeof(T), alignof(T), N> m_blocks;
+    };
+
+    /**
+     * @brief Fixed-capacity pool of T objects handed out as std::shared_ptr.
+     *
+     * make_shared() uses std::allocate_shared with an allocator serving one pre-reserved slot, so the control
+     * block and the object share the slot. Slots are sized for T plus shared_block_overhead bytes; a standard
+     * library with a larger control block fails to compile rather than overflowing the slot. The handles are
+     * plain std::shared_ptr (convertible to std::shared_ptr<const T>), e.g. the shared_event_envelope values of
+     * sync_subject::publish_pooled; the pool must outlive them.
+     *
+     * @tparam T The object type.
+     * @tparam N Number of objects, at most 65534.
+     */
+    template <typename T, std::size_t N>
+    class shared_object_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /** @brief Room reserved in each slot for the shared_ptr control block (vtable, counters, allocator). */
+        static constexpr std::size_t shared_block_overhead = 5U * sizeof(void*);
+
+        shared_object_pool() = default;
+        ~shared_object_pool() = default;
+
+        /**
+         * @brief Constructs a shared object in a free slot.
+         *
+         * @param args Constructor arguments of T.
+         * @return The handle, empty if the pool is exhausted.
+         */
+        template <typename... Args>
+        [[nodiscard]] std::shared_ptr<T> make_shared(Args&&... args)
+        {
+            void* block = m_blocks.allocate();
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+
+            // should the constructor of T throw, allocate_shared gives the slot back through the allocator
+            return std::allocate_shared<T>(slot_allocator<T>(this, block), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Gets the capacity of the pool.
+         *
+         * @return N.
+         */
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept
+        {
+            return N;
+        }
+
+        /**
+         * @brief Gets the number of live objects.
+         *
+         * @return The objects in use (relaxed read).
+         */
+        [[nodiscard]] std::size_t in_use() const noexcept
+        {
+            return m_blocks.in_use();
+        }
+
+        /**
+         * @brief Gets the highest number of simultaneously live objects.
+         *
+         * @return The high-water mark (relaxed read).
+         */
+        [[nodiscard]] std::size_t high_water_mark() const noexcept
+        {
+            return m_blocks.high_water_mark();
+        }
+
+    private:
+        static constexpr std::size_t slot_alignment
+            = (alignof(T) > alignof(std::max_align_t)) ? alignof(T) : alignof(std::max_align_t);
+
+        static constexpr std::size_t slot_size
+            = (((sizeof(T) + slot_alignment - 1U) / slot_alignment) * slot_alignment) + shared_block_overhead;
+
+        using blocks_type = detail::fixed_block_pool<slot_size, slot_alignment, N>;
+
+        // hands out the slot reserved by make_shared() once, then releases blocks to the pool
+        template <typename U>
+        class slot_allocator
+        {
+        public:
+            using value_type = U;
+
+            slot_allocator(shared_object_pool* pool, void* block) noexcept
+                : m_pool(pool)
+                , m_block(block)
+            {
+            }
+
+            template <typename V>
+            slot_allocator(const slot_allocator<V>& other) noexcept // NOLINT implicit rebind conversion
+                : m_pool(other.m_pool)
+                , m_block(other.m_block)
+            {
+            }
+
+            U* allocate(std::size_t count) noexcept
+            {
+                static_assert(sizeof(U) <= blocks_type::block_size, "shared_ptr control block larger than the slot");
+                static_assert(alignof(U) <= blocks_type::block_alignment, "shared_ptr control block over-aligned");
+                (void)count; // allocate_shared asks for a single control block
+
+                void* block = m_block;
+                m_block = nullptr;
+                return static_cast<U*>(block);
+            }
+
+            void deallocate(U* block, std::size_t count) noexcept
+            {
+                (void)count;
+                m_pool->m_blocks.deallocate(block);
+            }
+
+            template <typename V>
+            bool operator==(const slot_allocator<V>& other) const noexcept
+            {
+                return m_pool == other.m_pool;
+            }
+
+            template <typename V>
+            bool operator!=(const slot_allocator<V>& other) const noexcept
+            {
+                return m_pool != other.m_pool;
+            }
+
+        private:
+            template <typename V>
+            friend class slot_allocator;
+
+            shared_object_pool* m_pool;
+            void* m_block;
+        };
+
+        blocks_type m_blocks;
+    };
+}
+
+#endif //  OBJECT_POOL_HPP_
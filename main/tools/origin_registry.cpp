@@ -0,0 +1,90 @@
+/**
+ * @file origin_registry.cpp
+ * @brief Implementation - Registry interning subject names into compact origin identifiers.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/expected.hpp"
+#include "tools/origin_registry.hpp"
+
+namespace tools
+{
+    expected<origin_id, origin_registry_error> origin_registry::intern(const std::string& name)
+    {
+        constexpr std::size_t max_origins = static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()) + 1U;
+
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+        const auto found = m_ids.find(name);
+        if (found != m_ids.cend())
+        {
+            return found->second;
+        }
+
+        if (m_names.size() >= max_origins)
+        {
+            return unexpected<origin_registry_error>(origin_registry_error::capacity_exhausted);
+        }
+
+        const auto origin = static_cast<origin_id>(m_names.size());
+        m_names.push_back(name);
+        m_ids.emplace(name, origin);
+        return origin;
+    }
+
+    expected<std::string, origin_registry_error> origin_registry::name_of(origin_id origin) const
+    {
+        const auto index = static_cast<std::size_t>(origin);
+
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+        if (index >= m_names.size())
+        {
+            return unexpected<origin_registry_error>(origin_registry_error::unknown_id);
+        }
+
+        return m_names[index];
+    }
+
+    std::size_t origin_registry::size() const
+    {
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+        return m_names.size();
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file origin_registry.hpp
+ * @brief Registry interning subject names into compact origin identifiers.
+ *
+ * This file contains the definition of the origin_id handle and the origin_registry class, which let
+ * sync_subject/async_observer carry a small integer origin instead of a std::string on the publish path.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ORIGIN_REGISTRY_HPP_)
+#define ORIGIN_REGISTRY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/expected.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Compact handle identifying an interned origin name.
+     *
+     * Meant to be used as the Origin template argument of sync_subject, sync_observer and async_observer.
+     */
+    enum class origin_id : std::uint16_t
+    {
+    };
+
+    /**
+     * @brief Errors reported by origin_registry operations.
+     */
+    enum class origin_registry_error : std::uint8_t
+    {
+        capacity_exhausted,
+        unknown_id
+    };
+
+    /**
+     * @brief Thread-safe registry mapping subject names to origin_id handles and back.
+     *
+     * Interning is done once, typically when a subject is created; resolving an id back to its name is only needed
+     * off the hot path (logging, diagnostics). Ids are dense, stable for the registry lifetime and never recycled.
+     */
+    class origin_registry : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        origin_registry() = default;
+        ~origin_registry() = default;
+
+        /**
+         * @brief Returns the id of a name, registering it first if needed.
+         *
+         * @param name The origin name to intern.
+         * @return The origin_id associated to the name, or origin_registry_error::capacity_exhausted.
+         */
+        [[nodiscard]] expected<origin_id, origin_registry_error> intern(const std::string& name);
+
+        /**
+         * @brief Resolves an origin_id back to its name.
+         *
+         * @param origin The origin_id to resolve.
+         * @return The interned name, or origin_registry_error::unknown_id.
+         */
+        [[nodiscard]] expected<std::string, origin_registry_error> name_of(origin_id origin) const;
+
+        /**
+         * @brief Returns the number of interned names.
+         *
+         * @return The number of distinct origins registered so far.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        mutable critical_section m_mutex;
+        std::unordered_map<std::string, origin_id> m_ids;
+        std::vector<std::string> m_names;
+    };
+}
+
+#endif //  ORIGIN_REGISTRY_HPP_
@@ -0,0 +1,404 @@
+/**
+ * @file parallel_algorithms.hpp
+ * @brief Fork-join parallel_for, parallel_transform, parallel_reduce and parallel_sort over any tools/pco executor.
+ *
+ * The range is cut into chunks sized from the concurrency and a minimum grain; the caller posts one helper per
+ * extra worker to the executor (pco::static_thread_pool, worker_pool, worker_task, ...) and works alongside them.
+ * Every participant claims the next chunk from one atomic index, so a worker that gets ahead keeps taking chunks
+ * from the others, and the caller waits on a single atomic completion counter: no future, promise or allocation per
+ * chunk, one shared join state per call.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(PARALLEL_ALGORITHMS_HPP_)
+#define PARALLEL_ALGORITHMS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+#include "tools/critical_section.hpp"
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief How a parallel algorithm splits its range.
+     */
+    struct parallel_params
+    {
+        std::size_t concurrency = 0U;      ///< participants including the caller, 0 for cpu_core_count()
+        std::size_t min_grain = 1024U;     ///< smallest number of elements per chunk
+        std::size_t chunks_per_worker = 4U; ///< chunks per participant, so that faster workers can take more
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Join state shared by the caller and its helpers for one parallel call.
+         */
+        class parallel_join_state : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            using chunk_runner = void (*)(void* body, std::size_t chunk);
+
+            parallel_join_state(std::size_t chunk_count, chunk_runner runner, void* body)
+                : m_chunk_count(chunk_count)
+                , m_runner(runner)
+                , m_body(body)
+            {
+            }
+
+            /**
+             * @brief Runs chunks until none is left; the body is only touched while a claimed chunk is pending.
+             */
+            void work()
+            {
+                for (;;)
+                {
+                    const std::size_t chunk = m_next_chunk.fetch_add(1U, std::memory_order_relaxed);
+                    if (chunk >= m_chunk_count)
+                    {
+                        return;
+                    }
+
+                    run(chunk);
+
+                    if ((m_completed.fetch_add(1U, std::memory_order_acq_rel) + 1U) == m_chunk_count)
+                    {
+                        m_done.signal();
+                    }
+                }
+            }
+
+            /**
+             * @brief Waits until every chunk completed, then rethrows the first exception a chunk raised.
+             */
+            void join()
+            {
+                while (m_completed.load(std::memory_order_acquire) < m_chunk_count)
+                {
+                    m_done.wait_for_signal();
+                }
+
+#if defined(CPP_EXCEPTIONS_ENABLED)
+                if (m_error)
+                {
+                    std::rethrow_exception(m_error);
+                }
+#endif
+            }
+
+        private:
+            void run(std::size_t chunk)
+            {
+#if defined(CPP_EXCEPTIONS_ENABLED)
+                try
+                {
+                    m_runner(m_body, chunk);
+                }
+                catch (...)
+                {
+                    std::scoped_lock<tools::critical_section> guard(m_error_mutex);
+                    if (!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+#else
+                m_runner(m_body, chunk);
+#endif
+            }
+
+            std::atomic<std::size_t> m_next_chunk { 0U };
+            std::atomic<std::size_t> m_completed { 0U };
+            std::size_t m_chunk_count;
+            chunk_runner m_runner;
+            void* m_body;
+            light_event m_done;
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            tools::critical_section m_error_mutex;
+            std::exception_ptr m_error;
+#endif
+        };
+
+        /**
+         * @brief Number of participants of a parallel call.
+         */
+        inline std::size_t parallel_workers(const parallel_params& params)
+        {
+            return (0U != params.concurrency) ? params.concurrency : static_cast<std::size_t>(cpu_core_count());
+        }
+
+        /**
+         * @brief Elements per chunk: at least min_grain, at most what gives chunks_per_worker chunks per participant.
+         */
+        inline std::size_t parallel_grain(std::size_t count, const parallel_params& params)
+        {
+            const std::size_t target_chunks
+                = parallel_workers(params) * std::max<std::size_t>(params.chunks_per_worker, 1U);
+            const std::size_t balanced = (count + target_chunks - 1U) / target_chunks;
+            return std::max<std::size_t>({ params.min_grain, balanced, 1U });
+        }
+
+        /**
+         * @brief Runs body(chunk) for every chunk in [0, chunk_count) on the caller and up to workers - 1 helpers.
+         */
+        template <typename Executor, typename Body>
+        void run_chunks(Executor exec, std::size_t chunk_count, const parallel_params& params, Body& body)
+        {
+            const std::size_t helpers = std::min(parallel_workers(params), chunk_count) - 1U;
+            if ((0U == chunk_count) || (0U == helpers))
+            {
+                for (std::size_t chunk = 0U; chunk < chunk_count; ++chunk)
+                {
+                    body(chunk);
+                }
+                return;
+            }
+
+            // shared so that a helper starting after the join finds no chunk left instead of a dangling state
+            auto state = std::make_shared<parallel_join_state>(
+                chunk_count, [](void* erased, std::size_t chunk) { (*static_cast<Body*>(erased))(chunk); }, &body);
+
+            for (std::size_t helper = 0U; helper < helpers; ++helper)
+            {
+                post(exec, [state]() { state->work(); });
+            }
+
+            state->work();
+            state->join();
+        }
+
+        /**
+         * @brief Runs fn(chunk_first, chunk_last) over the grain-sized chunks of [first, last).
+         */
+        template <typename Executor, typename RandomIt, typename ChunkFunction>
+        void for_each_chunk(Executor exec, RandomIt first, RandomIt last, const parallel_params& params,
+            ChunkFunction&& chunk_function)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            if (0U == count)
+            {
+                return;
+            }
+
+            const std::size_t grain = parallel_grain(count, params);
+            const std::size_t chunk_count = (count + grain - 1U) / grain;
+            auto body = [&](std::size_t chunk)
+            {
+                const std::size_t begin = chunk * grain;
+                const std::size_t end = std::min(begin + grain, count);
+                chunk_function(
+                    chunk, first + static_cast<std::ptrdiff_t>(begin), first + static_cast<std::ptrdiff_t>(end));
+            };
+            run_chunks(exec, chunk_count, params, body);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Calls fn on every element of [first, last) in parallel.
+     *
+     * @param exec Executor running the helpers (post(exec, task) found by ADL).
+     * @param first Start of the range (random access).
+     * @param last End of the range.
+     * @param function Callable invoked with each element (as a reference), from any participant.
+     * @param params Concurrency and grain of the split.
+     */
+    template <typename Executor, typename RandomIt, typename Function>
+    void parallel_for(
+        Executor exec, RandomIt first, RandomIt last, Function&& function, const parallel_params& params = {})
+    {
+        detail::for_each_chunk(exec, first, last, params,
+            [&function](std::size_t, RandomIt chunk_first, RandomIt chunk_last)
+            {
+                for (; chunk_first != chunk_last; ++chunk_first)
+                {
+                    function(*chunk_first);
+                }
+            });
+    }
+
+    /**
+     * @brief Writes fn(element) for every element of [first, last) to the range starting at d_first, in parallel.
+     *
+     * @param exec Executor running the helpers.
+     * @param first Start of the source range (random access).
+     * @param last End of the source range.
+     * @param d_first Start of the destination range (random access), may be first.
+     * @param function Unary callable producing each destination element.
+     * @param params Concurrency and grain of the split.
+     * @return The end of the destination range.
+     */
+    template <typename Executor, typename RandomIt, typename OutputIt, typename Function>
+    OutputIt parallel_transform(Executor exec, RandomIt first, RandomIt last, OutputIt d_first, Function&& function,
+        const parallel_params& params = {})
+    {
+        detail::for_each_chunk(exec, first, last, params,
+            [first, d_first, &function](std::size_t, RandomIt chunk_first, RandomIt chunk_last)
+            { std::transform(chunk_first, chunk_last, d_first + std::distance(first, chunk_first), function); });
+        return d_first + std::distance(first, last);
+    }
+
+    /**
+     * @brief Folds [first, last) with an associative operation, chunks in parallel and partial results in order.
+     *
+     * @param exec Executor running the helpers.
+     * @param first Start of the range (random access).
+     * @param last End of the range.
+     * @param init Initial value, folded first.
+     * @param operation Associative binary operation (need not be commutative).
+     * @param params Concurrency and grain of the split.
+     * @return operation(...operation(init, first[0])..., last[-1]).
+     */
+    template <typename Executor, typename RandomIt, typename T, typename BinaryOperation>
+    T parallel_reduce(Executor exec, RandomIt first, RandomIt last, T init, BinaryOperation&& operation,
+        const parallel_params& params = {})
+    {
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (0U == count)
+        {
+            return init;
+        }
+
+        const std::size_t grain = detail::parallel_grain(count, params);
+        std::vector<std::optional<T>> partials((count + grain - 1U) / grain);
+
+        detail::for_each_chunk(exec, first, last, params,
+            [&partials, &operation](std::size_t chunk, RandomIt chunk_first, RandomIt chunk_last)
+            {
+                T partial = *chunk_first;
+                for (++chunk_first; chunk_first != chunk_last; ++chunk_first)
+                {
+                    partial = operation(std::move(partial), *chunk_first);
+                }
+                partials[chunk].emplace(std::move(partial));
+            });
+
+        for (auto& partial : partials)
+        {
+            init = operation(std::move(init), std::move(*partial));
+        }
+        return init;
+    }
+
+    /**
+     * @brief Sorts [first, last): chunks sorted in parallel, then merged pairwise in parallel rounds.
+     *
+     * @param exec Executor running the helpers.
+     * @param first Start of the range (random access).
+     * @param last End of the range.
+     * @param compare Strict weak ordering.
+     * @param params Concurrency and grain of the split.
+     */
+    template <typename Executor, typename RandomIt, typename Compare = std::less<>>
+    void parallel_sort(
+        Executor exec, RandomIt first, RandomIt last, Compare compare = {}, const parallel_params& params = {})
+    {
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (count < 2U)
+        {
+            return;
+        }
+
+        const std::size_t grain = detail::parallel_grain(count, params);
+        detail::for_each_chunk(exec, first, last, params,
+            [&compare](std::size_t, RandomIt chunk_first, RandomIt chunk_last)
+            { std::sort(chunk_first, chunk_last, compare); });
+
+        for (std::size_t width = grain; width < count; width *= 2U)
+        {
+            const std::size_t merge_count = (count + (2U * width) - 1U) / (2U * width);
+            auto merge = [&](std::size_t pair)
+            {
+                const std::size_t begin = pair * 2U * width;
+                const std::size_t middle = std::min(begin + width, count);
+                const std::size_t end = std::min(begin + (2U * width), count);
+                std::inplace_merge(first + static_cast<std::ptrdiff_t>(begin),
+                    first + static_cast<std::ptrdiff_t>(middle), first + static_cast<std::ptrdiff_t>(end), compare);
+            };
+            detail::run_chunks(exec, merge_count, params, merge);
+        }
+    }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    /** @brief parallel_for over a span. */
+    template <typename Executor, typename T, std::size_t Extent, typename Function>
+    void parallel_for(
+        Executor exec, std::span<T, Extent> values, Function&& function, const parallel_params& params = {})
+    {
+        parallel_for(exec, values.begin(), values.end(), std::forward<Function>(function), params);
+    }
+
+    /** @brief parallel_transform from a span into a span of at least the same size. */
+    template <typename Executor, typename T, std::size_t Extent, typename U, std::size_t DExtent, typename Function>
+    void parallel_transform(Executor exec, std::span<T, Extent> values, std::span<U, DExtent> destination,
+        Function&& function, const parallel_params& params = {})
+    {
+        parallel_transform(
+            exec, values.begin(), values.end(), destination.begin(), std::forward<Function>(function), params);
+    }
+
+    /** @brief parallel_reduce over a span. */
+    template <typename Executor, typename T, std::size_t Extent, typename R, typename BinaryOperation>
+    R parallel_reduce(Executor exec, std::span<T, Extent> values, R init, BinaryOperation&& operation,
+        const parallel_params& params = {})
+    {
+        return parallel_reduce(
+            exec, values.begin(), values.end(), std::move(init), std::forward<BinaryOperation>(operation), params);
+    }
+
+    /** @brief parallel_sort of a span. */
+    template <typename Executor, typename T, std::size_t Extent, typename Compare = std::less<>>
+    void parallel_sort(
+        Executor exec, std::span<T, Extent> values, Compare compare = {}, const parallel_params& params = {})
+    {
+        parallel_sort(exec, values.begin(), values.end(), std::move(compare), params);
+    }
+#endif
+}
+
+#endif //  PARALLEL_ALGORITHMS_HPP_
@@ -0,0 +1,148 @@
+/**
+ * @file periodic_task_stats.hpp
+ * @brief Wakeup lateness, execution time and overrun statistics of a periodic_task.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(PERIODIC_TASK_STATS_HPP_)
+#define PERIODIC_TASK_STATS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "tools/log2_histogram.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Number of buckets of the periodic_task histograms (the last one counts samples of 2^22 us and more).
+     */
+    constexpr std::size_t periodic_task_histogram_buckets = 24U;
+
+    /**
+     * @brief Snapshot of the statistics of a periodic_task, all the durations being in microseconds.
+     */
+    struct periodic_task_stats
+    {
+        log2_histogram_snapshot<periodic_task_histogram_buckets> wakeup_lateness; ///< Wakeup time minus deadline.
+        log2_histogram_snapshot<periodic_task_histogram_buckets> execution_time;  ///< Periodic routine duration.
+        std::uint64_t overruns = 0U;        ///< Iterations that ended past the next deadline.
+        std::uint64_t skipped_periods = 0U; ///< Periods dropped to catch up after the overruns.
+    };
+
+    /**
+     * @brief Recorder written by the periodic_task loop and read through periodic_task::stats().
+     *
+     * Recording is allocation-free and lock-free, so it can stay enabled in production builds.
+     */
+    class periodic_task_stats_recorder : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        periodic_task_stats_recorder() = default;
+        ~periodic_task_stats_recorder() = default;
+
+        /**
+         * @brief Records how late the task woke up after its deadline.
+         *
+         * @param lateness_us The wakeup lateness in microseconds.
+         */
+        void record_wakeup(std::uint64_t lateness_us)
+        {
+            m_wakeup_lateness.add(clamp(lateness_us));
+        }
+
+        /**
+         * @brief Records the duration of one periodic routine call.
+         *
+         * @param duration_us The execution time in microseconds.
+         */
+        void record_execution(std::uint64_t duration_us)
+        {
+            m_execution_time.add(clamp(duration_us));
+        }
+
+        /**
+         * @brief Records an iteration that ended past its next deadline.
+         *
+         * @param skipped_periods The number of periods dropped to realign the deadline.
+         */
+        void record_overrun(std::uint64_t skipped_periods)
+        {
+            m_overruns.fetch_add(1U, std::memory_order_relaxed);
+            m_skipped_periods.fetch_add(skipped_periods, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Takes a snapshot of the statistics.
+         *
+         * @return The statistics.
+         */
+        [[nodiscard]] periodic_task_stats snapshot() const
+        {
+            periodic_task_stats stats;
+            stats.wakeup_lateness = m_wakeup_lateness.snapshot();
+            stats.execution_time = m_execution_time.snapshot();
+            stats.overruns = m_overruns.load(std::memory_order_relaxed);
+            stats.skipped_periods = m_skipped_periods.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        /**
+         * @brief Clears the statistics.
+         */
+        void reset()
+        {
+            m_wakeup_lateness.reset();
+            m_execution_time.reset();
+            m_overruns.store(0U, std::memory_order_relaxed);
+            m_skipped_periods.store(0U, std::memory_order_relaxed);
+        }
+
+    private:
+        static std::uint32_t clamp(std::uint64_t value)
+        {
+            return static_cast<std::uint32_t>(
+                std::min<std::uint64_t>(value, std::numeric_limits<std::uint32_t>::max()));
+        }
+
+        log2_histogram<periodic_task_histogram_buckets> m_wakeup_lateness;
+        log2_histogram<periodic_task_histogram_buckets> m_execution_time;
+        std::atomic<std::uint64_t> m_overruns = 0U;
+        std::atomic<std::uint64_t> m_skipped_periods = 0U;
+    };
+}
+
+#endif //  PERIODIC_TASK_STATS_HPP_
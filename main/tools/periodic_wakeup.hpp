@@ -0,0 +1,143 @@
+/**
+ * @file periodic_wakeup.hpp
+ * @brief High-precision wakeup settings of periodic_task and the calibration of its sleep-then-spin guard.
+ *
+ * A sleep ends late by the timer slack of the OS (tens of microseconds to a millisecond on Linux, up to a tick
+ * on FreeRTOS). The hybrid wakeup sleeps until a guard interval before the deadline and spins for the rest; the
+ * guard follows the oversleep measured at run time, so that the spin stays as short as the slack allows.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(PERIODIC_WAKEUP_HPP_)
+#define PERIODIC_WAKEUP_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace tools
+{
+    /**
+     * @brief Wakeup mode of a periodic_task, set with periodic_task::set_precision().
+     */
+    struct periodic_precision
+    {
+        /** @brief Sleeps until a calibrated guard before each deadline, then spins (ESP32 and desktop). */
+        bool hybrid_wakeup = false;
+        /** @brief Aims each wakeup earlier by the mean lateness measured at the previous ones. */
+        bool compensate_lateness = false;
+        /** @brief Longest spin per period: the calibrated guard never exceeds it. */
+        std::chrono::duration<std::uint64_t, std::micro> max_spin { 2000U };
+    };
+
+    /**
+     * @brief Estimates the sleep guard and the lateness bias of a periodic loop, in the unit of its clock.
+     *
+     * The guard is the mean oversleep plus four mean deviations, as in the TCP retransmission timer, kept in
+     * fixed point (mean scaled by 8, deviation by 4) so that one outlier widens it quickly and quiet periods
+     * narrow it again. The lateness bias is the mean time between the spin target and the observed wakeup.
+     * Used by the periodic_task loop alone, so nothing is atomic.
+     */
+    class wakeup_calibrator
+    {
+    public:
+        /**
+         * @brief Constructs a calibrator returning initial_guard until the first oversleep is recorded.
+         * @param initial_guard The guard before calibration.
+         */
+        explicit wakeup_calibrator(std::int64_t initial_guard)
+            : m_initial_guard(initial_guard)
+        {
+        }
+
+        /**
+         * @brief Records how much later than requested a sleep ended.
+         * @param oversleep Wakeup time minus requested end of the sleep, negative when it ended early.
+         */
+        void record_oversleep(std::int64_t oversleep)
+        {
+            if (!m_calibrated)
+            {
+                m_scaled_mean = oversleep * mean_scale;
+                m_scaled_deviation = (oversleep < 0) ? -oversleep * 2 : oversleep * 2; // deviation of half
+                m_calibrated = true;
+                return;
+            }
+
+            const std::int64_t error = oversleep - (m_scaled_mean / mean_scale);
+            m_scaled_mean += error;
+            m_scaled_deviation += ((error < 0) ? -error : error) - (m_scaled_deviation / deviation_scale);
+        }
+
+        /**
+         * @brief Gets the guard to leave between the end of the sleep and the deadline.
+         * @param max_guard The upper bound of the guard.
+         * @return The guard, between 0 and max_guard.
+         */
+        [[nodiscard]] std::int64_t guard(std::int64_t max_guard) const
+        {
+            const std::int64_t guard
+                = m_calibrated ? ((m_scaled_mean / mean_scale) + m_scaled_deviation) : m_initial_guard;
+            return std::clamp<std::int64_t>(guard, 0, max_guard);
+        }
+
+        /**
+         * @brief Records how late the loop observed the spin target.
+         * @param lateness Observed wakeup time minus the spin target.
+         */
+        void record_lateness(std::int64_t lateness)
+        {
+            m_scaled_bias += lateness - (m_scaled_bias / mean_scale);
+        }
+
+        /**
+         * @brief Gets the mean lateness to subtract from the next spin target.
+         * @return The bias, 0 or more.
+         */
+        [[nodiscard]] std::int64_t lateness_bias() const
+        {
+            return std::max<std::int64_t>(0, m_scaled_bias / mean_scale);
+        }
+
+    private:
+        static constexpr std::int64_t mean_scale = 8;
+        static constexpr std::int64_t deviation_scale = 4;
+
+        std::int64_t m_initial_guard;
+        std::int64_t m_scaled_mean = 0;
+        std::int64_t m_scaled_deviation = 0;
+        std::int64_t m_scaled_bias = 0;
+        bool m_calibrated = false;
+    };
+}
+
+#endif //  PERIODIC_WAKEUP_HPP_
@@ -0,0 +1,378 @@
+/**
+ * @file pipe_binary_stream.hpp
+ * @brief bytepack::binary_stream adapters serializing into and deserializing from memory_pipe windows in place.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(PIPE_BINARY_STREAM_HPP_)
+#define PIPE_BINARY_STREAM_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Counters of a pipe_stream_writer or a pipe_stream_reader.
+     */
+    struct pipe_stream_stats
+    {
+        std::uint64_t frames_in_place = 0U; ///< Frames serialized or deserialized directly in the pipe window.
+        std::uint64_t frames_staged = 0U;   ///< Frames that went through the staging buffer.
+        std::uint64_t frames_dropped = 0U;  ///< Frames not sent in time, or received larger than the staging buffer.
+    };
+
+    /** @brief Size of the frame header written by pipe_stream_writer: a 32-bit little endian payload length. */
+    inline constexpr std::size_t pipe_stream_header_size = 4U;
+
+    /**
+     * @brief Serializes frames with bytepack::binary_stream directly into the reserve/commit window of a memory_pipe.
+     *
+     * begin_frame() reserves room for the largest frame and returns a binary_stream over it; commit_frame()
+     * prefixes the bytes written with their length and publishes them, so each frame is written exactly once.
+     * When the contiguous free space is too short (wrap-around point, slow consumer) the frame is serialized
+     * into a staging buffer allocated once at construction and sent with memory_pipe::send() instead.
+     *
+     * Only the producer thread of the pipe may use the writer, and no other write may reach the pipe between
+     * begin_frame() and commit_frame().
+     *
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <std::endian BufferEndian = std::endian::big>
+    class pipe_stream_writer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using stream_type = bytepack::binary_stream<BufferEndian>;
+
+        pipe_stream_writer() = delete;
+
+        /**
+         * @brief Constructs a writer on a pipe.
+         *
+         * @param pipe Pipe receiving the frames, outliving the writer.
+         * @param max_frame_bytes Largest payload of one frame, header excluded.
+         * @param timeout Maximum time a staged frame waits for room in the pipe.
+         */
+        pipe_stream_writer(memory_pipe& pipe, std::size_t max_frame_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+            : m_pipe(pipe)
+            , m_staging(pipe_stream_header_size + max_frame_bytes)
+            , m_timeout(timeout)
+        {
+        }
+
+        ~pipe_stream_writer()
+        {
+            abort_frame();
+        }
+
+        /**
+         * @brief Starts a frame, dropping the previous one if it was not committed.
+         *
+         * @return The stream to serialize the frame with, valid until commit_frame() or abort_frame().
+         */
+        [[nodiscard]] stream_type& begin_frame()
+        {
+            abort_frame();
+
+            const auto region = m_pipe.reserve(m_staging.size());
+            m_in_place = (region.size >= m_staging.size());
+            if (m_in_place)
+            {
+                m_window = region.data;
+            }
+            else
+            {
+                static_cast<void>(m_pipe.commit(0U));
+                m_window = m_staging.data();
+            }
+
+            m_stream.emplace(bytepack::buffer_view(
+                m_window + pipe_stream_header_size, m_staging.size() - pipe_stream_header_size)); // NOLINT
+            return *m_stream;
+        }
+
+        /**
+         * @brief Publishes the frame started by begin_frame().
+         *
+         * @return The payload size sent, 0 if no frame was started or if it could not be sent before the timeout.
+         */
+        std::size_t commit_frame()
+        {
+            if (!m_stream.has_value())
+            {
+                return 0U;
+            }
+
+            const std::size_t payload = m_stream->data().size();
+            m_stream.reset();
+
+            for (std::size_t i = 0U; i < pipe_stream_header_size; ++i)
+            {
+                m_window[i] = static_cast<std::uint8_t>((payload >> (i * 8U)) & 0xffU); // NOLINT little endian
+            }
+
+            const std::size_t total = pipe_stream_header_size + payload;
+            std::size_t sent = 0U;
+            if (m_in_place)
+            {
+                sent = m_pipe.commit(total);
+                if (0U == sent)
+                {
+                    // message buffer full: the reserved window still holds the frame, block on it as a staged one
+                    sent = m_pipe.send(m_window, total, m_timeout);
+                }
+                ++m_stats.frames_in_place;
+            }
+            else
+            {
+                sent = m_pipe.send(m_window, total, m_timeout);
+                ++m_stats.frames_staged;
+            }
+
+            m_window = nullptr;
+            if (sent != total)
+            {
+                ++m_stats.frames_dropped;
+                return 0U;
+            }
+
+            return payload;
+        }
+
+        /**
+         * @brief Drops the frame started by begin_frame(), releasing its reservation.
+         */
+        void abort_frame()
+        {
+            if (m_stream.has_value())
+            {
+                m_stream.reset();
+                if (m_in_place)
+                {
+                    static_cast<void>(m_pipe.commit(0U));
+                }
+                m_window = nullptr;
+            }
+        }
+
+        /**
+         * @brief Largest payload of one frame.
+         *
+         * @return The payload capacity in bytes.
+         */
+        [[nodiscard]] std::size_t max_frame_bytes() const
+        {
+            return m_staging.size() - pipe_stream_header_size;
+        }
+
+        /**
+         * @brief Gets the counters of the writer.
+         *
+         * @return The counters.
+         */
+        [[nodiscard]] pipe_stream_stats stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        memory_pipe& m_pipe;
+        std::vector<std::uint8_t> m_staging;
+        std::chrono::duration<std::uint64_t, std::milli> m_timeout;
+        std::optional<stream_type> m_stream;
+        std::uint8_t* m_window = nullptr;
+        bool m_in_place = false;
+        pipe_stream_stats m_stats;
+    };
+
+    /**
+     * @brief Deserializes frames written by pipe_stream_writer with bytepack::binary_stream straight from
+     * the peek/consume window of a memory_pipe.
+     *
+     * next_frame() returns a binary_stream over the payload of the next complete frame; the bytes stay in the
+     * pipe until release_frame() (or the next call to next_frame()). A frame wrapping around the end of the
+     * pipe storage is copied into a staging buffer allocated once at construction. Frames larger than that
+     * buffer are skipped and counted as dropped.
+     *
+     * Only the consumer thread of the pipe may use the reader, and no other read may reach the pipe while a
+     * frame is held.
+     *
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <std::endian BufferEndian = std::endian::big>
+    class pipe_stream_reader : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using stream_type = bytepack::binary_stream<BufferEndian>;
+
+        pipe_stream_reader() = delete;
+        ~pipe_stream_reader() = default;
+
+        /**
+         * @brief Constructs a reader on a pipe.
+         *
+         * @param pipe Pipe carrying the frames, outliving the reader.
+         * @param max_frame_bytes Largest payload accepted, header excluded.
+         */
+        pipe_stream_reader(memory_pipe& pipe, std::size_t max_frame_bytes)
+            : m_pipe(pipe)
+            , m_staging(max_frame_bytes)
+        {
+        }
+
+        /**
+         * @brief Releases the current frame and exposes the next one, without blocking.
+         *
+         * @return The stream over the payload of the next frame, nullptr when no complete frame is available.
+         */
+        [[nodiscard]] stream_type* next_frame()
+        {
+            release_frame();
+
+            const auto regions = m_pipe.peek();
+            if (regions.size() < pipe_stream_header_size)
+            {
+                return nullptr;
+            }
+
+            std::array<std::uint8_t, pipe_stream_header_size> header {};
+            copy_out(regions, 0U, header.data(), header.size());
+            std::size_t payload = 0U;
+            for (std::size_t i = 0U; i < pipe_stream_header_size; ++i)
+            {
+                payload |= static_cast<std::size_t>(header[i]) << (i * 8U); // NOLINT little endian
+            }
+
+            const std::size_t total = pipe_stream_header_size + payload;
+            if (regions.size() < total)
+            {
+                return nullptr;
+            }
+
+            if (payload > m_staging.size())
+            {
+                static_cast<void>(m_pipe.consume(total));
+                ++m_stats.frames_dropped;
+                return nullptr;
+            }
+
+            std::uint8_t* window = nullptr;
+            if (regions.first_size >= total)
+            {
+                // binary_stream needs a mutable view, the reader only reads through it
+                window = const_cast<std::uint8_t*>(regions.first) + pipe_stream_header_size; // NOLINT
+                ++m_stats.frames_in_place;
+            }
+            else
+            {
+                copy_out(regions, pipe_stream_header_size, m_staging.data(), payload);
+                window = m_staging.data();
+                ++m_stats.frames_staged;
+            }
+
+            m_frame_bytes = total;
+            m_stream.emplace(bytepack::buffer_view(window, payload));
+            return &m_stream.value();
+        }
+
+        /**
+         * @brief Consumes the frame returned by the last next_frame() call, if any.
+         */
+        void release_frame()
+        {
+            if (m_stream.has_value())
+            {
+                m_stream.reset();
+                static_cast<void>(m_pipe.consume(m_frame_bytes));
+                m_frame_bytes = 0U;
+            }
+        }
+
+        /**
+         * @brief Gets the counters of the reader.
+         *
+         * @return The counters.
+         */
+        [[nodiscard]] pipe_stream_stats stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        /**
+         * @brief Copies bytes of the peeked regions, starting at offset, across the wrap-around point.
+         */
+        static void copy_out(
+            const memory_pipe::read_regions& regions, std::size_t offset, std::uint8_t* destination, std::size_t count)
+        {
+            if (offset < regions.first_size)
+            {
+                const std::size_t head = std::min(count, regions.first_size - offset);
+                std::memcpy(destination, regions.first + offset, head); // NOLINT pointer arithmetic
+                if (count > head)
+                {
+                    std::memcpy(destination + head, regions.second, count - head); // NOLINT pointer arithmetic
+                }
+            }
+            else
+            {
+                std::memcpy(destination, regions.second + (offset - regions.first_size), count); // NOLINT
+            }
+        }
+
+        memory_pipe& m_pipe;
+        std::vector<std::uint8_t> m_staging;
+        std::optional<stream_type> m_stream;
+        std::size_t m_frame_bytes = 0U;
+        pipe_stream_stats m_stats;
+    };
+
+} // namespace tools
+
+#endif // C++20
+
+#endif //  PIPE_BINARY_STREAM_HPP_
@@ -0,0 +1,67 @@
+/**
+ * @file pipe_error.hpp
+ * @brief Error codes of the expected-returning memory_pipe transfers.
+ *
+ * send_result() and receive_result() report a short transfer as an error value carrying the byte count, so that
+ * a hot path branches on a small code instead of comparing counts or logging.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(PIPE_ERROR_HPP_)
+#define PIPE_ERROR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tools
+{
+    /**
+     * @brief Reasons a memory_pipe transfer fell short.
+     */
+    enum class pipe_error : std::uint8_t
+    {
+        invalid_argument, ///< Null data buffer.
+        not_created,      ///< The underlying buffer could not be created (FreeRTOS).
+        timed_out         ///< The timeout expired before the whole transfer completed.
+    };
+
+    /**
+     * @brief Error of a memory_pipe send_result() or receive_result().
+     */
+    struct pipe_transfer_error
+    {
+        pipe_error code = pipe_error::timed_out; ///< Why the transfer fell short.
+        std::size_t transferred = 0U;            ///< Bytes moved anyway before the transfer stopped.
+    };
+}
+
+#endif // PIPE_ERROR_HPP_
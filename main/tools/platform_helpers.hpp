@@ -53,7 +53,7 @@ namespace tools
 #elif defined(FREERTOS_PLATFORM)
         return 1; // default to single core on other FreeRTOS platform
 #else
-        return 2; // assume we have a PC with at least two cores
+        return static_cast<int>(cpu_core_count());
 #endif
     }
 }
@@ -0,0 +1,496 @@
+/**
+ * @file rcu_sync_dictionary.hpp
+ * @brief A read-copy-update dictionary: lock-free readers over immutable versions, copy-and-publish writers.
+ *
+ * This file contains the definition of the rcu_sync_dictionary class, the snapshot mode counterpart of
+ * sync_dictionary for tables queried on every message and updated rarely.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(RCU_SYNC_DICTIONARY_HPP_)
+#define RCU_SYNC_DICTIONARY_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#endif
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A thread-safe dictionary whose readers never lock.
+     *
+     * The content lives in immutable, reference-counted versions. get_view(), find() and contains() pin the current
+     * version with atomic counters only; writers serialize on a critical_section, copy the current dictionary,
+     * apply their change and publish the copy with an atomic pointer swap. A batch (add_collection(),
+     * remove_collection(), update()) publishes a single version.
+     *
+     * Retired versions are deleted by the writers (or reclaim()) once no view references them and no reader is
+     * between loading the pointer and pinning it, so a task holding a view, even preempted for long, keeps a valid
+     * dictionary. The versions still pinned are kept apart and retried at the next write.
+     *
+     * @tparam K The type of the keys in the dictionary.
+     * @tparam T The type of the values in the dictionary.
+     * @tparam TDictionary The associative container type of every version, std::map<K, T> by default.
+     */
+    template <typename K, typename T, typename TDictionary = std::map<K, T>>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        requires(requires {
+            typename TDictionary::key_type;
+            typename TDictionary::mapped_type;
+        } && std::is_same_v<typename TDictionary::key_type, K> && std::is_same_v<typename TDictionary::mapped_type, T>)
+#endif
+    class rcu_sync_dictionary : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using dictionary_type = TDictionary;
+
+        static_assert(std::is_same<typename dictionary_type::key_type, K>::value,
+            "rcu_sync_dictionary: dictionary key_type must match K");
+        static_assert(std::is_same<typename dictionary_type::mapped_type, T>::value,
+            "rcu_sync_dictionary: dictionary mapped_type must match T");
+
+    private:
+        struct version
+        {
+            dictionary_type m_dictionary;
+            std::uint64_t m_generation = 0U;
+            std::atomic<std::size_t> m_pins = 0U;
+        };
+
+    public:
+        /**
+         * @brief A pinned, immutable version of the dictionary; move-only, releases its pin when destroyed.
+         *
+         * A view must not outlive the rcu_sync_dictionary it comes from.
+         */
+        class view
+        {
+        public:
+            view() = default;
+
+            ~view()
+            {
+                release();
+            }
+
+            view(const view&) = delete;
+            view& operator=(const view&) = delete;
+
+            view(view&& other) noexcept
+                : m_version(std::exchange(other.m_version, nullptr))
+            {
+            }
+
+            view& operator=(view&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_version = std::exchange(other.m_version, nullptr);
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Accesses the pinned dictionary.
+             *
+             * @return A const reference valid as long as the view lives.
+             */
+            [[nodiscard]] const dictionary_type& operator*() const
+            {
+                return m_version->m_dictionary;
+            }
+
+            [[nodiscard]] const dictionary_type* operator->() const
+            {
+                return &m_version->m_dictionary;
+            }
+
+            /**
+             * @brief Retrieves the generation of the pinned version, incremented by every published update.
+             *
+             * @return The version generation.
+             */
+            [[nodiscard]] std::uint64_t generation() const
+            {
+                return m_version->m_generation;
+            }
+
+            /**
+             * @brief Checks whether the view pins a version (false once moved from).
+             *
+             * @return true if the view can be dereferenced.
+             */
+            explicit operator bool() const
+            {
+                return nullptr != m_version;
+            }
+
+        private:
+            friend class rcu_sync_dictionary;
+
+            explicit view(version* pinned)
+                : m_version(pinned)
+            {
+            }
+
+            void release()
+            {
+                if (nullptr != m_version)
+                {
+                    m_version->m_pins.fetch_sub(1U);
+                    m_version = nullptr;
+                }
+            }
+
+            version* m_version = nullptr;
+        };
+
+        rcu_sync_dictionary()
+            : m_current(new version())
+        {
+        }
+
+        ~rcu_sync_dictionary()
+        {
+            delete m_current.load(); // NOLINT owning raw pointer published atomically
+            for (version* retired : m_retired)
+            {
+                delete retired; // NOLINT owning raw pointer
+            }
+        }
+
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Pins the current version without locking.
+         *
+         * @return A view on the dictionary as of now, unaffected by later updates.
+         */
+        [[nodiscard]] view get_view() const
+        {
+            // seq_cst throughout: a writer reading m_acquiring == 0 after its swap has seen every pin taken on the
+            // version it retired
+            m_acquiring.fetch_add(1U);
+            version* current = m_current.load();
+            current->m_pins.fetch_add(1U);
+            m_acquiring.fetch_sub(1U);
+
+            return view(current);
+        }
+
+        /**
+         * @brief Finds the value associated with the given key, without locking.
+         *
+         * @param key The key to search for in the dictionary.
+         * @return std::optional<T> The value associated with the key if found, otherwise an empty std::optional.
+         */
+        [[nodiscard]] std::optional<T> find(const K& key) const
+        {
+            std::optional<T> result;
+            const view pinned = get_view();
+            const auto& itr = pinned->find(key);
+            if (pinned->cend() != itr)
+            {
+                result = itr->second;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Checks whether a key exists in the dictionary, without locking.
+         *
+         * @param key The key to check.
+         * @return true when the key exists, otherwise false.
+         */
+        [[nodiscard]] bool contains(const K& key) const
+        {
+            const view pinned = get_view();
+            return pinned->find(key) != pinned->cend();
+        }
+
+        /**
+         * @brief Retrieves a copy of the current dictionary.
+         *
+         * @return A copy of the current version.
+         */
+        [[nodiscard]] dictionary_type snapshot() const
+        {
+            return *get_view();
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return get_view()->empty();
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return get_view()->size();
+        }
+
+        /**
+         * @brief Adds a key-value pair, or updates the value of an existing key, and publishes a new version.
+         *
+         * @param key The key to be added or updated in the dictionary.
+         * @param value The value associated with the key.
+         */
+        void add(const K& key, const T& value)
+        {
+            update([&](dictionary_type& dictionary) { dictionary.insert_or_assign(key, value); });
+        }
+
+        /**
+         * @brief Adds a key-value pair with perfect forwarding and publishes a new version.
+         *
+         * @tparam KU The deduced key type.
+         * @tparam TU The deduced value type.
+         * @param key The key to be forwarded into the dictionary.
+         * @param value The value to be forwarded into the dictionary.
+         */
+        template <typename KU, typename TU>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<K, KU> && std::is_constructible_v<T, TU>
+#endif
+        auto add(KU&& key, TU&& value)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<K, KU>::value && std::is_constructible<T, TU>::value,
+                void>::type
+#endif
+        {
+            update([&](dictionary_type& dictionary)
+                { dictionary.insert_or_assign(std::forward<KU>(key), std::forward<TU>(value)); });
+        }
+
+        /**
+         * @brief Removes the element with the specified key and publishes a new version.
+         *
+         * @param key The key of the element to be removed.
+         */
+        void remove(const K& key)
+        {
+            update([&](dictionary_type& dictionary) { dictionary.erase(key); });
+        }
+
+        /**
+         * @brief Adds key-value pairs from a range-like source as one published version.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param collection The source range of key-value entries.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<
+                std::is_constructible<K,
+                    decltype(std::get<0>(*std::begin(std::declval<typename std::decay<TRange>::type&>())))>::value
+                && std::is_constructible<T,
+                    decltype(std::get<1>(*std::begin(std::declval<typename std::decay<TRange>::type&>())))>::value>::
+                type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<K, decltype(std::get<0>(*std::begin(std::declval<TRange&>())))>
+            && std::is_constructible_v<T, decltype(std::get<1>(*std::begin(std::declval<TRange&>())))>
+#endif
+        void add_collection(TRange&& collection)
+        {
+            update(
+                [&](dictionary_type& dictionary)
+                {
+                    for (auto&& entry : std::forward<TRange>(collection))
+                    {
+                        dictionary.insert_or_assign(K(std::get<0>(entry)), T(std::get<1>(entry)));
+                    }
+                });
+        }
+
+        /**
+         * @brief Adds key-value pairs from an initializer-list as one published version.
+         *
+         * @param collection The source initializer-list of key-value pairs.
+         */
+        void add_collection(std::initializer_list<std::pair<K, T>> collection)
+        {
+            update(
+                [&](dictionary_type& dictionary)
+                {
+                    for (const auto& [key, value] : collection)
+                    {
+                        dictionary.insert_or_assign(key, value);
+                    }
+                });
+        }
+
+        /**
+         * @brief Removes keys from a range-like collection as one published version.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param keys The source collection of keys to remove.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<K,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<K, decltype(*std::begin(std::declval<TRange&>()))>
+#endif
+        void remove_collection(TRange&& keys)
+        {
+            update(
+                [&](dictionary_type& dictionary)
+                {
+                    for (auto&& key : std::forward<TRange>(keys))
+                    {
+                        dictionary.erase(K(std::forward<decltype(key)>(key)));
+                    }
+                });
+        }
+
+        /**
+         * @brief Removes keys from an initializer-list as one published version.
+         *
+         * @param keys The source initializer-list of keys to remove.
+         */
+        void remove_collection(std::initializer_list<K> keys)
+        {
+            update(
+                [&](dictionary_type& dictionary)
+                {
+                    for (const auto& key : keys)
+                    {
+                        dictionary.erase(key);
+                    }
+                });
+        }
+
+        /**
+         * @brief Removes all the elements and publishes an empty version.
+         */
+        void clear()
+        {
+            update([](dictionary_type& dictionary) { dictionary.clear(); });
+        }
+
+        /**
+         * @brief Applies an arbitrary batch of changes to a private copy, then publishes it as one version.
+         *
+         * @tparam Mutator Callable taking a dictionary_type reference.
+         * @param mutator The changes to apply; readers see all of them or none.
+         */
+        template <typename Mutator>
+        void update(Mutator&& mutator)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_write_mutex);
+
+            version* previous = m_current.load();
+            auto* next = new version(); // NOLINT owning raw pointer published atomically
+            next->m_dictionary = previous->m_dictionary;
+            next->m_generation = previous->m_generation + 1U;
+            std::forward<Mutator>(mutator)(next->m_dictionary);
+
+            m_current.store(next);
+            m_retired.push_back(previous);
+            reclaim_locked();
+        }
+
+        /**
+         * @brief Deletes the retired versions no reader pins anymore.
+         *
+         * Writers call it after each publication; call it explicitly to release memory sooner after the last
+         * update, e.g. from a periodic task.
+         *
+         * @return The number of retired versions still pinned.
+         */
+        std::size_t reclaim()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_write_mutex);
+            reclaim_locked();
+            return m_retired.size();
+        }
+
+    private:
+        void reclaim_locked()
+        {
+            // a reader in the middle of get_view() may still pin a retired version it has loaded
+            if (0U != m_acquiring.load())
+            {
+                return;
+            }
+
+            m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                [](version* retired)
+                                {
+                                    if (0U != retired->m_pins.load())
+                                    {
+                                        return false;
+                                    }
+
+                                    delete retired; // NOLINT owning raw pointer
+                                    return true;
+                                }),
+                m_retired.end());
+        }
+
+        std::atomic<version*> m_current;
+        mutable std::atomic<std::size_t> m_acquiring = 0U;
+        std::vector<version*> m_retired;
+        critical_section m_write_mutex;
+    };
+}
+
+#endif //  RCU_SYNC_DICTIONARY_HPP_
@@ -41,8 +41,10 @@
 #if !defined(RING_BUFFER_HPP_)
 #define RING_BUFFER_HPP_
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <optional>
@@ -77,33 +79,39 @@ namespace tools
             static constexpr bool value = false;
         };
 
-        ring_buffer() = default;
+        ring_buffer()
+            : m_ring_buffer {}
+        {
+        }
+
         ~ring_buffer() = default;
 
         /**
          * @brief Copy constructor for the ring_buffer class.
          *
          * This constructor initializes a new ring_buffer object by copying the state
-         * from another ring_buffer object.
+         * from another ring_buffer object. For a trivially copyable T, only the occupied
+         * slots are copied, with at most two memcpy, and the backing array is left
+         * uninitialized rather than value-initialized first.
          *
          * @param other The ring_buffer object to copy from.
          */
-        ring_buffer(const ring_buffer& other) = default;
+        ring_buffer(const ring_buffer& other)
+            : ring_buffer(other, std::is_trivially_copyable<T> {})
+        {
+        }
 
         /**
          * @brief Move constructor for the ring_buffer class.
          *
          * This constructor initializes a ring_buffer object by transferring ownership
-         * of the resources from another ring_buffer object.
+         * of the resources from another ring_buffer object. A trivially copyable T is
+         * copied as by the copy constructor, occupied slots only.
          *
          * @param other The ring_buffer object to move from.
          */
         ring_buffer(ring_buffer&& other) noexcept
-            : m_ring_buffer { std::move(other.m_ring_buffer) }
-            , m_push_index { other.m_push_index }
-            , m_pop_index { other.m_pop_index }
-            , m_last_index { other.m_last_index }
-            , m_size { other.m_size }
+            : ring_buffer(std::move(other), std::is_trivially_copyable<T> {})
         {
         }
 
@@ -111,7 +119,8 @@ namespace tools
          * @brief Copy assignment operator for the ring_buffer class.
          *
          * This operator assigns the contents of another ring_buffer instance to this instance.
-         * It performs a deep copy of the internal buffer and indices.
+         * It performs a deep copy of the internal buffer and indices; for a trivially copyable T,
+         * only the occupied slots are copied, with at most two memcpy.
          *
          * @param other The ring_buffer instance to copy from.
          * @return A reference to this ring_buffer instance.
@@ -120,11 +129,18 @@ namespace tools
         {
             if (this != &other)
             {
-                m_ring_buffer = other.m_ring_buffer;
-                m_push_index = other.m_push_index;
-                m_pop_index = other.m_pop_index;
-                m_last_index = other.m_last_index;
-                m_size = other.m_size;
+                if constexpr (std::is_trivially_copyable<T>::value)
+                {
+                    copy_occupied(other);
+                }
+                else
+                {
+                    m_ring_buffer = other.m_ring_buffer;
+                    m_push_index = other.m_push_index;
+                    m_pop_index = other.m_pop_index;
+                    m_last_index = other.m_last_index;
+                    m_size = other.m_size;
+                }
             }
 
             return *this;
@@ -144,11 +160,18 @@ namespace tools
         {
             if (this != &other)
             {
-                m_ring_buffer = std::move(other.m_ring_buffer);
-                m_push_index = other.m_push_index;
-                m_pop_index = other.m_pop_index;
-                m_last_index = other.m_last_index;
-                m_size = other.m_size;
+                if constexpr (std::is_trivially_copyable<T>::value)
+                {
+                    copy_occupied(other);
+                }
+                else
+                {
+                    m_ring_buffer = std::move(other.m_ring_buffer);
+                    m_push_index = other.m_push_index;
+                    m_pop_index = other.m_pop_index;
+                    m_last_index = other.m_last_index;
+                    m_size = other.m_size;
+                }
             }
 
             return *this;
@@ -261,21 +284,22 @@ namespace tools
          * This method returns the element at the front of the ring buffer
          * without removing it.
          *
-         * @return The element at the front of the ring buffer.
+         * @return The element at the front of the ring buffer, or T{} if it is empty.
          */
         [[nodiscard]] T front() const
         {
-            return m_ring_buffer.at(m_pop_index);
+            // the unoccupied slots of a trivially copyable T are neither copied nor reset, so they are never read
+            return empty() ? T {} : m_ring_buffer.at(m_pop_index);
         }
 
         /**
          * @brief Retrieves the last element in the ring buffer.
          *
-         * @return The last element of type T in the ring buffer.
+         * @return The last element of type T in the ring buffer, or T{} if it is empty.
          */
         [[nodiscard]] T back() const
         {
-            return m_ring_buffer.at(m_last_index);
+            return empty() ? T {} : m_ring_buffer.at(m_last_index);
         }
 
         /**
@@ -303,6 +327,9 @@ namespace tools
 
         /**
          * @brief Clears the ring buffer, resetting all indices and size to zero.
+         *
+         * The elements are reset to T{} so that they release their resources, except for a trivially copyable T,
+         * whose slots are simply left to be overwritten.
          */
         void clear()
         {
@@ -310,7 +337,10 @@ namespace tools
             m_pop_index = 0U;
             m_last_index = 0U;
             m_size = 0U;
-            m_ring_buffer = {};
+            if constexpr (!std::is_trivially_copyable<T>::value)
+            {
+                m_ring_buffer = {};
+            }
         }
 
         /**
@@ -550,6 +580,164 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Contiguous views over the stored elements, oldest first.
+         *
+         * The second view is empty unless the elements wrap around the end of the storage. The views stay valid
+         * until the ring buffer is modified.
+         */
+        struct span_pair
+        {
+            const T* first_data = nullptr;
+            std::size_t first_size = 0U;
+            const T* second_data = nullptr;
+            std::size_t second_size = 0U;
+        };
+
+        /**
+         * @brief Appends a block of elements, copied with at most two bulk copies (memcpy for trivially copyable T).
+         *
+         * Stops when the ring buffer is full; existing elements are never overwritten.
+         *
+         * @param data The elements to append.
+         * @param count The number of elements at data.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(const T* data, std::size_t count)
+        {
+            const std::size_t to_push = (std::min)(count, Capacity - m_size);
+            if (0U == to_push)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_push, Capacity - m_push_index);
+            T* storage = m_ring_buffer.data();
+            copy_elements(data, first_part, storage + m_push_index);         // NOLINT pointer arithmetic
+            copy_elements(data + first_part, to_push - first_part, storage); // NOLINT pointer arithmetic
+
+            m_last_index = next_step_index(m_push_index, to_push - 1U);
+            m_push_index = next_step_index(m_push_index, to_push);
+            m_size += to_push;
+
+            return to_push;
+        }
+
+        /**
+         * @brief Removes the oldest elements into a block, moved with at most two bulk moves (memcpy for trivially
+         *        copyable T).
+         *
+         * @param destination Storage receiving the elements.
+         * @param count The number of elements destination can hold.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(T* destination, std::size_t count)
+        {
+            const std::size_t to_pop = (std::min)(count, m_size);
+            if (0U == to_pop)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_pop, Capacity - m_pop_index);
+            T* storage = m_ring_buffer.data();
+            move_elements(storage + m_pop_index, first_part, destination);         // NOLINT pointer arithmetic
+            move_elements(storage, to_pop - first_part, destination + first_part); // NOLINT pointer arithmetic
+
+            return consume(to_pop);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push_span().
+         *
+         * @param source The elements to append.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(std::span<const T> source)
+        {
+            return push_span(source.data(), source.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pop_span().
+         *
+         * @param destination Storage receiving the elements.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(std::span<T> destination)
+        {
+            return pop_span(destination.data(), destination.size());
+        }
+#endif
+
+        /**
+         * @brief Exposes the stored elements in place as at most two contiguous views, without removing them.
+         *
+         * Pair it with consume() to process a block, e.g. hand it to a DMA or a checksum, then drop it.
+         *
+         * @return The views, oldest elements first.
+         */
+        [[nodiscard]] span_pair peek_spans() const
+        {
+            span_pair spans;
+            if (0U == m_size)
+            {
+                return spans;
+            }
+
+            spans.first_data = m_ring_buffer.data() + m_pop_index; // NOLINT pointer arithmetic
+            spans.first_size = (std::min)(m_size, Capacity - m_pop_index);
+            if (spans.first_size < m_size)
+            {
+                spans.second_data = m_ring_buffer.data();
+                spans.second_size = m_size - spans.first_size;
+            }
+            return spans;
+        }
+
+        /**
+         * @brief Calls a visitor on the oldest elements in place, oldest first, without copying nor removing them.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must not modify the ring buffer.
+         * @return The number of elements visited, at most size().
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            const span_pair spans = peek_spans();
+            const std::size_t first_count = (std::min)(count, spans.first_size);
+            for (std::size_t index = 0U; index < first_count; ++index)
+            {
+                visitor(spans.first_data[index]); // NOLINT pointer arithmetic
+            }
+            const std::size_t second_count = (std::min)(count - first_count, spans.second_size);
+            for (std::size_t index = 0U; index < second_count; ++index)
+            {
+                visitor(spans.second_data[index]); // NOLINT pointer arithmetic
+            }
+            return first_count + second_count;
+        }
+
+        /**
+         * @brief Drops the oldest elements, typically after processing them through peek_spans().
+         *
+         * @param count The number of elements to drop.
+         * @return The number of elements dropped, at most size().
+         */
+        std::size_t consume(std::size_t count)
+        {
+            const std::size_t to_drop = (std::min)(count, m_size);
+            if (0U != to_drop)
+            {
+                m_pop_index = next_step_index(m_pop_index, to_drop);
+                m_size -= to_drop;
+            }
+            return to_drop;
+        }
+
         /**
          * @brief Get the capacity of the ring buffer.
          *
@@ -572,6 +760,8 @@ namespace tools
         };
 
     private:
+        static constexpr bool capacity_is_power_of_two = (0U != Capacity) && (0U == (Capacity & (Capacity - 1U)));
+
         enum class overflow_policy : unsigned char
         {
             reject,
@@ -610,6 +800,85 @@ namespace tools
             return is_full ? write_status::overwritten : write_status::inserted;
         }
 
+        ring_buffer(const ring_buffer& other, std::false_type /*trivially_copyable*/)
+            : m_ring_buffer { other.m_ring_buffer }
+            , m_push_index { other.m_push_index }
+            , m_pop_index { other.m_pop_index }
+            , m_last_index { other.m_last_index }
+            , m_size { other.m_size }
+        {
+        }
+
+        ring_buffer(ring_buffer&& other, std::false_type /*trivially_copyable*/) noexcept
+            : m_ring_buffer { std::move(other.m_ring_buffer) }
+            , m_push_index { other.m_push_index }
+            , m_pop_index { other.m_pop_index }
+            , m_last_index { other.m_last_index }
+            , m_size { other.m_size }
+        {
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init) only the occupied slots are ever read
+        ring_buffer(const ring_buffer& other, std::true_type /*trivially_copyable*/) noexcept
+        {
+            copy_occupied(other);
+        }
+
+        /**
+         * @brief Copies the indices and the occupied slots of another ring buffer, at their same positions.
+         *
+         * Only used for a trivially copyable T: the unoccupied slots are never read, so they are not copied.
+         */
+        void copy_occupied(const ring_buffer& other) noexcept
+        {
+            const std::size_t first_part = (std::min)(other.m_size, Capacity - other.m_pop_index);
+            const T* source = other.m_ring_buffer.data();
+            T* storage = m_ring_buffer.data();
+            copy_elements(source + other.m_pop_index, first_part, storage + other.m_pop_index); // NOLINT
+            copy_elements(source, other.m_size - first_part, storage);
+
+            m_push_index = other.m_push_index;
+            m_pop_index = other.m_pop_index;
+            m_last_index = other.m_last_index;
+            m_size = other.m_size;
+        }
+
+        /**
+         * @brief Copies a block of elements, with memcpy when T is trivially copyable.
+         */
+        static void copy_elements(const T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::copy(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
+        /**
+         * @brief Moves a block of elements, with memcpy when T is trivially copyable.
+         */
+        static void move_elements(T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::move(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
         /**
          * @brief Computes the next index in a circular buffer.
          *
@@ -621,14 +890,14 @@ namespace tools
          */
         static constexpr std::size_t next_index(std::size_t index)
         {
-            return ((index + 1U) % Capacity);
+            return next_step_index(index, 1U);
         }
 
         /**
          * @brief Calculates the next index in the ring buffer given a current index and a step.
          *
          * This function computes the next index by adding the step to the current index
-         * and taking the result modulo the buffer capacity.
+         * and taking the result modulo the buffer capacity, a mask when the capacity is a power of two.
          *
          * @param index The current index in the ring buffer.
          * @param step The number of steps to move forward in the ring buffer.
@@ -636,10 +905,17 @@ namespace tools
          */
         static constexpr std::size_t next_step_index(std::size_t index, std::size_t step)
         {
-            return ((index + step) % Capacity);
+            if constexpr (capacity_is_power_of_two)
+            {
+                return ((index + step) & (Capacity - 1U));
+            }
+            else
+            {
+                return ((index + step) % Capacity);
+            }
         }
 
-        std::array<T, Capacity> m_ring_buffer = {};
+        std::array<T, Capacity> m_ring_buffer; // value-initialized by the default constructor
         std::size_t m_push_index = 0U;
         std::size_t m_pop_index = 0U;
         std::size_t m_last_index = 0U;
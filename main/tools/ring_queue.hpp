@@ -0,0 +1,435 @@
+/**
+ * @file ring_queue.hpp
+ * @brief A FIFO queue over one preallocated ring, with a configurable behaviour when full.
+ *
+ * This file contains the definition of the ring_queue class, a drop-in alternative to std::queue for the
+ * sync_queue and sync_lane_queue containers. std::queue is backed by a deque that allocates and releases chunks
+ * as it grows and shrinks; ring_queue keeps all its elements in a single buffer that is never released, so once
+ * reserved it no longer touches the heap.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(RING_QUEUE_HPP_)
+#define RING_QUEUE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace tools
+{
+    /**
+     * @brief What a ring_queue does when an element is pushed while it is full.
+     */
+    enum class queue_full_policy : unsigned char
+    {
+        grow,            ///< Double the ring, like an unbounded std::queue (the storage is kept when drained).
+        reject,          ///< Discard the pushed element.
+        overwrite_oldest ///< Discard the oldest queued element to make room.
+    };
+
+    /**
+     * @brief A thread-unsafe FIFO queue stored in one ring buffer, with the std::queue interface.
+     *
+     * Elements live in raw slots constructed on push and destroyed on pop, so T does not need to be default
+     * constructible. A default constructed ring_queue is empty and grows on demand; a queue constructed with a
+     * capacity (or given one by reserve()) allocates it once, and with the reject or overwrite_oldest policy never
+     * allocates again. Every element discarded by these policies is counted by dropped_count().
+     *
+     * @tparam T The type of elements stored in the queue.
+     */
+    template <typename T>
+    class ring_queue
+    {
+    public:
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief Constructs an empty queue without storage, growing on demand.
+         */
+        ring_queue() = default;
+
+        /**
+         * @brief Constructs a queue with preallocated storage.
+         *
+         * @param capacity The number of elements the ring holds.
+         * @param policy What a push does once the ring is full.
+         */
+        explicit ring_queue(std::size_t capacity, queue_full_policy policy = queue_full_policy::reject)
+            : m_policy(policy)
+        {
+            reallocate(capacity);
+        }
+
+        /**
+         * @brief Copy constructor, the copy gets the same capacity and policy.
+         *
+         * @param other The queue to copy from.
+         */
+        ring_queue(const ring_queue& other)
+            : m_slots(allocate_slots(other.m_capacity))
+            , m_capacity(other.m_capacity)
+            , m_policy(other.m_policy)
+            , m_dropped(other.m_dropped)
+        {
+            for (; m_size < other.m_size; ++m_size)
+            {
+                ::new (raw_slot(m_size)) T(other.element(m_size));
+            }
+        }
+
+        /**
+         * @brief Move constructor, steals the storage of the other queue and leaves it empty without storage.
+         *
+         * @param other The queue to move from.
+         */
+        ring_queue(ring_queue&& other) noexcept
+        {
+            swap(other);
+        }
+
+        /**
+         * @brief Copy and move assignment operator.
+         *
+         * @param other The queue to copy or move from.
+         * @return A reference to this queue.
+         */
+        ring_queue& operator=(ring_queue other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        ~ring_queue()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Pushes a copy of an element at the back of the queue.
+         *
+         * @param elem The element to be copied into the queue.
+         * @return true if the element was queued, false if it was discarded by the reject policy.
+         */
+        bool push(const T& elem)
+        {
+            return emplace(elem);
+        }
+
+        /**
+         * @brief Moves an element at the back of the queue.
+         *
+         * @param elem The element to be moved into the queue.
+         * @return true if the element was queued, false if it was discarded by the reject policy.
+         */
+        bool push(T&& elem)
+        {
+            return emplace(std::move(elem));
+        }
+
+        /**
+         * @brief Constructs an element in place at the back of the queue.
+         *
+         * With the overwrite_oldest policy, the oldest element is destroyed before the new one is constructed.
+         *
+         * @tparam Args The types of arguments for in-place construction.
+         * @param args The arguments to be forwarded to the element constructor.
+         * @return true if the element was queued, false if it was discarded by the reject policy.
+         */
+        template <typename... Args>
+        bool emplace(Args&&... args)
+        {
+            if ((m_size == m_capacity) && !make_room())
+            {
+                return false;
+            }
+
+            ::new (raw_slot(m_size)) T(std::forward<Args>(args)...);
+            ++m_size;
+            return true;
+        }
+
+        /**
+         * @brief Removes the front element, if any.
+         */
+        void pop()
+        {
+            if (0U != m_size)
+            {
+                element(0U).~T();
+                m_head = wrap(m_head + 1U);
+                --m_size;
+            }
+        }
+
+        /**
+         * @brief Accesses the front (oldest) element, the queue must not be empty.
+         *
+         * @return A reference to the front element.
+         */
+        [[nodiscard]] T& front()
+        {
+            return element(0U);
+        }
+
+        /**
+         * @brief Accesses the front (oldest) element, the queue must not be empty.
+         *
+         * @return A const reference to the front element.
+         */
+        [[nodiscard]] const T& front() const
+        {
+            return element(0U);
+        }
+
+        /**
+         * @brief Accesses the back (newest) element, the queue must not be empty.
+         *
+         * @return A reference to the back element.
+         */
+        [[nodiscard]] T& back()
+        {
+            return element(m_size - 1U);
+        }
+
+        /**
+         * @brief Accesses the back (newest) element, the queue must not be empty.
+         *
+         * @return A const reference to the back element.
+         */
+        [[nodiscard]] const T& back() const
+        {
+            return element(m_size - 1U);
+        }
+
+        /**
+         * @brief Calls a visitor on the oldest elements in place, front first, without copying nor removing them.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must not modify the queue.
+         * @return The number of elements visited, at most size().
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            const std::size_t visit_count = (std::min)(count, m_size);
+            for (std::size_t offset = 0U; offset < visit_count; ++offset)
+            {
+                visitor(static_cast<const T&>(element(offset)));
+            }
+            return visit_count;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @return true if the queue is empty, false otherwise.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        /**
+         * @brief Checks if the ring is full, the next push then grows, rejects or overwrites.
+         *
+         * @return true if the queue holds capacity() elements.
+         */
+        [[nodiscard]] bool full() const
+        {
+            return m_size == m_capacity;
+        }
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         *
+         * @return The number of elements.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the number of elements the ring holds without growing.
+         *
+         * @return The capacity.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Returns what a push does once the ring is full.
+         *
+         * @return The full policy.
+         */
+        [[nodiscard]] queue_full_policy full_policy() const
+        {
+            return m_policy;
+        }
+
+        /**
+         * @brief Returns the number of elements discarded by the reject and overwrite_oldest policies.
+         *
+         * @return The dropped element count since construction.
+         */
+        [[nodiscard]] std::size_t dropped_count() const
+        {
+            return m_dropped;
+        }
+
+        /**
+         * @brief Grows the storage to at least a capacity and sets the full policy.
+         *
+         * The storage never shrinks and the queued elements are kept.
+         *
+         * @param capacity The minimum number of elements the ring holds.
+         * @param policy What a push does once the ring is full.
+         */
+        void reserve(std::size_t capacity, queue_full_policy policy)
+        {
+            m_policy = policy;
+            if (capacity > m_capacity)
+            {
+                reallocate(capacity);
+            }
+        }
+
+        /**
+         * @brief Destroys all the elements, the storage is kept.
+         */
+        void clear()
+        {
+            while (0U != m_size)
+            {
+                pop();
+            }
+            m_head = 0U;
+        }
+
+        /**
+         * @brief Exchanges the contents, storage, policy and counters of two queues.
+         *
+         * @param other The queue to swap with.
+         */
+        void swap(ring_queue& other) noexcept
+        {
+            std::swap(m_slots, other.m_slots);
+            std::swap(m_capacity, other.m_capacity);
+            std::swap(m_head, other.m_head);
+            std::swap(m_size, other.m_size);
+            std::swap(m_policy, other.m_policy);
+            std::swap(m_dropped, other.m_dropped);
+        }
+
+    private:
+        struct slot
+        {
+            alignas(T) unsigned char bytes[sizeof(T)]; // NOLINT raw storage of one element
+        };
+
+        static std::unique_ptr<slot[]> allocate_slots(std::size_t capacity) // NOLINT raw slot array
+        {
+            return (0U == capacity) ? nullptr : std::make_unique<slot[]>(capacity); // NOLINT raw slot array
+        }
+
+        [[nodiscard]] std::size_t wrap(std::size_t index) const
+        {
+            return (index >= m_capacity) ? (index - m_capacity) : index;
+        }
+
+        [[nodiscard]] void* raw_slot(std::size_t offset) const
+        {
+            return m_slots[wrap(m_head + offset)].bytes;
+        }
+
+        [[nodiscard]] T& element(std::size_t offset) const
+        {
+            return *std::launder(reinterpret_cast<T*>(raw_slot(offset))); // NOLINT slot holds a live T
+        }
+
+        /**
+         * @brief Applies the full policy before a push on a full ring.
+         *
+         * @return true if there is room for the pushed element.
+         */
+        bool make_room()
+        {
+            if (queue_full_policy::grow == m_policy)
+            {
+                reallocate((0U == m_capacity) ? 1U : (m_capacity * 2U));
+                return true;
+            }
+
+            ++m_dropped;
+            if ((queue_full_policy::overwrite_oldest == m_policy) && (0U != m_size))
+            {
+                pop();
+                return true;
+            }
+
+            return false;
+        }
+
+        void reallocate(std::size_t capacity)
+        {
+            auto slots = allocate_slots(capacity);
+            for (std::size_t offset = 0U; offset < m_size; ++offset)
+            {
+                T& moved = element(offset);
+                ::new (slots[offset].bytes) T(std::move(moved));
+                moved.~T();
+            }
+
+            m_slots = std::move(slots);
+            m_capacity = capacity;
+            m_head = 0U;
+        }
+
+        std::unique_ptr<slot[]> m_slots; // NOLINT raw slot array
+        std::size_t m_capacity = 0U;
+        std::size_t m_head = 0U;
+        std::size_t m_size = 0U;
+        queue_full_policy m_policy = queue_full_policy::grow;
+        std::size_t m_dropped = 0U;
+    };
+}
+
+#endif //  RING_QUEUE_HPP_
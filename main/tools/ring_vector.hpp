@@ -42,8 +42,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -63,11 +65,14 @@ namespace tools
      * It supports basic operations such as push, pop, front, back, and resizing.
      *
      * @tparam T The type of elements stored in the ring buffer.
+     * @tparam Allocator The allocator of the underlying vector, e.g. std::pmr::polymorphic_allocator<T>.
      */
-    template <typename T>
+    template <typename T, typename Allocator = std::allocator<T>>
     class ring_vector
     {
     public:
+        using allocator_type = Allocator;
+
         struct thread_safe
         {
             static constexpr bool value = false;
@@ -87,6 +92,18 @@ namespace tools
         {
         }
 
+        /**
+         * @brief Constructs a ring vector whose storage is allocated through the given allocator.
+         *
+         * @param capacity The number of elements the ring holds.
+         * @param alloc The allocator of the storage.
+         */
+        ring_vector(std::size_t capacity, const Allocator& alloc)
+            : m_ring_vector(capacity, alloc)
+            , m_capacity(capacity)
+        {
+        }
+
         /**
          * @brief Copy constructor for the ring_vector class.
          *
@@ -120,23 +137,37 @@ namespace tools
          * @brief Assignment operator for the ring_vector class.
          *
          * This operator assigns the contents of another ring_vector instance to this instance.
-         * It performs a deep copy of the internal state of the ring_vector.
+         * It performs a deep copy of the internal state of the ring_vector. For a trivially
+         * copyable T and rings of the same capacity, the storage is kept and only the occupied
+         * slots are copied, with at most two memcpy.
          *
          * @param other The ring_vector instance to be copied.
          * @return A reference to this ring_vector instance.
          */
         ring_vector& operator=(const ring_vector& other)
         {
-            if (this != &other)
+            if (this == &other)
             {
-                m_ring_vector = other.m_ring_vector;
-                m_push_index = other.m_push_index;
-                m_pop_index = other.m_pop_index;
-                m_last_index = other.m_last_index;
-                m_size = other.m_size;
-                m_capacity = other.m_capacity;
+                return *this;
+            }
+
+            if constexpr (std::is_trivially_copyable<T>::value
+                && !std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+            {
+                if (m_capacity == other.m_capacity)
+                {
+                    copy_occupied(other);
+                    return *this;
+                }
             }
 
+            m_ring_vector = other.m_ring_vector;
+            m_push_index = other.m_push_index;
+            m_pop_index = other.m_pop_index;
+            m_last_index = other.m_last_index;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+
             return *this;
         }
 
@@ -313,7 +344,8 @@ namespace tools
          * @brief Clears the ring vector, resetting all indices and size to zero.
          *
          * This function resets the push, pop, and last indices to zero, sets the size to zero,
-         * clears the internal ring vector, and resizes it to its capacity.
+         * clears the internal ring vector, and resizes it to its capacity. The slots of a trivially
+         * copyable T are not reset, only overwritten by later pushes.
          */
         void clear()
         {
@@ -321,8 +353,11 @@ namespace tools
             m_pop_index = 0U;
             m_last_index = 0U;
             m_size = 0U;
-            m_ring_vector.clear();
-            m_ring_vector.resize(m_capacity);
+            if constexpr (!std::is_trivially_copyable<T>::value)
+            {
+                m_ring_vector.clear();
+                m_ring_vector.resize(m_capacity);
+            }
         }
 
         /**
@@ -572,6 +607,164 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Contiguous views over the stored elements, oldest first.
+         *
+         * The second view is empty unless the elements wrap around the end of the storage. The views stay valid
+         * until the ring vector is modified.
+         */
+        struct span_pair
+        {
+            const T* first_data = nullptr;
+            std::size_t first_size = 0U;
+            const T* second_data = nullptr;
+            std::size_t second_size = 0U;
+        };
+
+        /**
+         * @brief Appends a block of elements, copied with at most two bulk copies (memcpy for trivially copyable T).
+         *
+         * Stops when the ring vector is full; existing elements are never overwritten.
+         *
+         * @param data The elements to append.
+         * @param count The number of elements at data.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(const T* data, std::size_t count)
+        {
+            const std::size_t to_push = (std::min)(count, m_capacity - m_size);
+            if (0U == to_push)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_push, m_capacity - m_push_index);
+            T* storage = m_ring_vector.data();
+            copy_elements(data, first_part, storage + m_push_index);         // NOLINT pointer arithmetic
+            copy_elements(data + first_part, to_push - first_part, storage); // NOLINT pointer arithmetic
+
+            m_last_index = next_step_index(m_push_index, to_push - 1U);
+            m_push_index = next_step_index(m_push_index, to_push);
+            m_size += to_push;
+
+            return to_push;
+        }
+
+        /**
+         * @brief Removes the oldest elements into a block, moved with at most two bulk moves (memcpy for trivially
+         *        copyable T).
+         *
+         * @param destination Storage receiving the elements.
+         * @param count The number of elements destination can hold.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(T* destination, std::size_t count)
+        {
+            const std::size_t to_pop = (std::min)(count, m_size);
+            if (0U == to_pop)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_pop, m_capacity - m_pop_index);
+            T* storage = m_ring_vector.data();
+            move_elements(storage + m_pop_index, first_part, destination);         // NOLINT pointer arithmetic
+            move_elements(storage, to_pop - first_part, destination + first_part); // NOLINT pointer arithmetic
+
+            return consume(to_pop);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push_span().
+         *
+         * @param source The elements to append.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(std::span<const T> source)
+        {
+            return push_span(source.data(), source.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pop_span().
+         *
+         * @param destination Storage receiving the elements.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(std::span<T> destination)
+        {
+            return pop_span(destination.data(), destination.size());
+        }
+#endif
+
+        /**
+         * @brief Exposes the stored elements in place as at most two contiguous views, without removing them.
+         *
+         * Pair it with consume() to process a block, e.g. hand it to a DMA or a checksum, then drop it.
+         *
+         * @return The views, oldest elements first.
+         */
+        [[nodiscard]] span_pair peek_spans() const
+        {
+            span_pair spans;
+            if (0U == m_size)
+            {
+                return spans;
+            }
+
+            spans.first_data = m_ring_vector.data() + m_pop_index; // NOLINT pointer arithmetic
+            spans.first_size = (std::min)(m_size, m_capacity - m_pop_index);
+            if (spans.first_size < m_size)
+            {
+                spans.second_data = m_ring_vector.data();
+                spans.second_size = m_size - spans.first_size;
+            }
+            return spans;
+        }
+
+        /**
+         * @brief Calls a visitor on the oldest elements in place, oldest first, without copying nor removing them.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must not modify the ring vector.
+         * @return The number of elements visited, at most size().
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            const span_pair spans = peek_spans();
+            const std::size_t first_count = (std::min)(count, spans.first_size);
+            for (std::size_t index = 0U; index < first_count; ++index)
+            {
+                visitor(spans.first_data[index]); // NOLINT pointer arithmetic
+            }
+            const std::size_t second_count = (std::min)(count - first_count, spans.second_size);
+            for (std::size_t index = 0U; index < second_count; ++index)
+            {
+                visitor(spans.second_data[index]); // NOLINT pointer arithmetic
+            }
+            return first_count + second_count;
+        }
+
+        /**
+         * @brief Drops the oldest elements, typically after processing them through peek_spans().
+         *
+         * @param count The number of elements to drop.
+         * @return The number of elements dropped, at most size().
+         */
+        std::size_t consume(std::size_t count)
+        {
+            const std::size_t to_drop = (std::min)(count, m_size);
+            if (0U != to_drop)
+            {
+                m_pop_index = next_step_index(m_pop_index, to_drop);
+                m_size -= to_drop;
+            }
+            return to_drop;
+        }
+
         /**
          * @brief Accesses the element at the specified index in the ring vector.
          *
@@ -590,52 +783,31 @@ namespace tools
          * current size, the oldest elements will be discarded. If the new capacity is larger, the ring vector will be
          * expanded to accommodate the new capacity.
          *
+         * The elements are relocated in place, without temporary buffer: growing only moves the shorter side of
+         * the wrap point, shrinking rotates the live elements to the front of the storage and then truncates it.
+         * Shrinking never allocates, and growing does not allocate either as long as the storage reserved with
+         * reserve() (or left by an earlier shrink) is large enough.
+         *
          * @param new_capacity The new capacity for the ring vector.
          */
         void resize(std::size_t new_capacity)
         {
-            if (m_size == new_capacity)
+            if (m_capacity == new_capacity)
             {
                 return;
             }
 
-            std::vector<T> tmp;
-            tmp.reserve(m_size);
-
-            // vector filled from first to last pushed
-            std::size_t idx = m_pop_index;
-            for (std::size_t i = 0; i < m_size; ++i)
-            {
-                tmp.emplace_back(std::move(m_ring_vector[idx]));
-                idx = next_index(idx);
-            }
-
-            m_ring_vector.clear();
-            m_ring_vector.resize(new_capacity);
-
-            if (m_size > new_capacity)
+            if (new_capacity > m_capacity)
             {
-                // shrink
-                // skip first pushed elements if we resize with a lower capacity
-                auto to_skip = (m_size - new_capacity);
-                for (std::size_t i = to_skip; i < tmp.size(); ++i)
-                {
-                    m_ring_vector[i - to_skip] = std::move(tmp[i]);
-                }
-                m_size -= to_skip;
+                grow_in_place(new_capacity);
             }
             else
             {
-                for (std::size_t i = 0; i < m_size; ++i)
-                {
-                    m_ring_vector[i] = std::move(tmp[i]);
-                }
+                shrink_in_place(new_capacity);
             }
 
             m_capacity = new_capacity;
 
-            m_pop_index = 0U;
-
             if (m_size > 0U)
             {
                 m_push_index = next_step_index(m_pop_index, m_size);
@@ -643,11 +815,36 @@ namespace tools
             }
             else
             {
+                m_pop_index = 0U;
                 m_push_index = 0U;
                 m_last_index = 0U;
             }
         }
 
+        /**
+         * @brief Reserves storage for a later growth of the ring vector.
+         *
+         * The capacity and the elements are unchanged; a following resize() up to storage_capacity then grows in
+         * place without allocating. Reserving beyond the current storage reallocates it once, moving each element
+         * to the new storage at the same position.
+         *
+         * @param storage_capacity The capacity the storage must be able to reach without reallocation.
+         */
+        void reserve(std::size_t storage_capacity)
+        {
+            m_ring_vector.reserve(storage_capacity);
+        }
+
+        /**
+         * @brief Returns the capacity the ring vector can be resized to without allocating.
+         *
+         * @return The storage capacity.
+         */
+        [[nodiscard]] std::size_t storage_capacity() const
+        {
+            return m_ring_vector.capacity();
+        }
+
     private:
         enum class overflow_policy : unsigned char
         {
@@ -687,6 +884,139 @@ namespace tools
             return is_full ? write_status::overwritten : write_status::inserted;
         }
 
+        /**
+         * @brief Grows the storage and closes the gap opened at the wrap point, moving the shorter side only.
+         *
+         * @param new_capacity The new capacity, larger than the current one.
+         */
+        void grow_in_place(std::size_t new_capacity)
+        {
+            const std::size_t old_capacity = m_capacity;
+            const std::size_t extra = new_capacity - old_capacity;
+            m_ring_vector.resize(new_capacity);
+
+            const std::size_t end_position = m_pop_index + m_size;
+            if ((0U == m_size) || (end_position <= old_capacity))
+            {
+                // contiguous: the new slots simply follow the elements
+                return;
+            }
+
+            const auto storage = m_ring_vector.begin();
+            const std::size_t wrapped = end_position - old_capacity; // elements at [0, wrapped)
+            const std::size_t tail = old_capacity - m_pop_index;     // elements at [m_pop_index, old_capacity)
+
+            if ((wrapped <= extra) && (wrapped <= tail))
+            {
+                // append the wrapped head after the tail: the elements become contiguous
+                std::move(storage, storage + static_cast<std::ptrdiff_t>(wrapped),
+                    storage + static_cast<std::ptrdiff_t>(old_capacity));
+            }
+            else
+            {
+                // slide the tail to the end of the storage: the wrap point stays at index 0
+                std::move_backward(storage + static_cast<std::ptrdiff_t>(m_pop_index),
+                    storage + static_cast<std::ptrdiff_t>(old_capacity),
+                    storage + static_cast<std::ptrdiff_t>(new_capacity));
+                m_pop_index += extra;
+            }
+        }
+
+        /**
+         * @brief Drops the oldest elements that do not fit, gathers the others at the front, truncates the storage.
+         *
+         * @param new_capacity The new capacity, smaller than the current one.
+         */
+        void shrink_in_place(std::size_t new_capacity)
+        {
+            if (m_size > new_capacity)
+            {
+                // skip first pushed elements if we resize with a lower capacity
+                const std::size_t to_skip = m_size - new_capacity;
+                for (std::size_t i = 0U; i < to_skip; ++i)
+                {
+                    m_ring_vector[m_pop_index] = T {};
+                    m_pop_index = next_index(m_pop_index);
+                }
+                m_size = new_capacity;
+            }
+
+            if ((m_size > 0U) && ((m_pop_index + m_size) > new_capacity))
+            {
+                const auto storage = m_ring_vector.begin();
+                const auto first = storage + static_cast<std::ptrdiff_t>(m_pop_index);
+                if ((m_pop_index + m_size) <= m_capacity)
+                {
+                    // contiguous but past the new end: move the kept elements to the front
+                    std::move(first, first + static_cast<std::ptrdiff_t>(m_size), storage);
+                }
+                else
+                {
+                    // wrapped: rotate the oldest element to the front
+                    std::rotate(storage, first, storage + static_cast<std::ptrdiff_t>(m_capacity));
+                }
+                m_pop_index = 0U;
+            }
+
+            // truncating keeps the storage: a later growth back to the old capacity does not allocate
+            m_ring_vector.resize(new_capacity);
+        }
+
+        /**
+         * @brief Copies the indices and the occupied slots of a ring of the same capacity, at their same positions.
+         *
+         * Only used for a trivially copyable T: the unoccupied slots are never read, so they are not copied.
+         */
+        void copy_occupied(const ring_vector& other) noexcept
+        {
+            const std::size_t first_part = (std::min)(other.m_size, m_capacity - other.m_pop_index);
+            const T* source = other.m_ring_vector.data();
+            T* storage = m_ring_vector.data();
+            copy_elements(source + other.m_pop_index, first_part, storage + other.m_pop_index); // NOLINT
+            copy_elements(source, other.m_size - first_part, storage);
+
+            m_push_index = other.m_push_index;
+            m_pop_index = other.m_pop_index;
+            m_last_index = other.m_last_index;
+            m_size = other.m_size;
+        }
+
+        /**
+         * @brief Copies a block of elements, with memcpy when T is trivially copyable.
+         */
+        static void copy_elements(const T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::copy(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
+        /**
+         * @brief Moves a block of elements, with memcpy when T is trivially copyable.
+         */
+        static void move_elements(T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::move(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
         /**
          * @brief Calculates the next index in a circular buffer.
          *
@@ -698,7 +1028,9 @@ namespace tools
          */
         [[nodiscard]] std::size_t next_index(std::size_t index) const
         {
-            return ((index + 1U) % m_capacity);
+            // the capacity is only known at run time: wrap with a compare rather than a division
+            const std::size_t next = index + 1U;
+            return (next < m_capacity) ? next : 0U;
         }
 
         /**
@@ -713,10 +1045,16 @@ namespace tools
          */
         [[nodiscard]] std::size_t next_step_index(std::size_t index, std::size_t step) const
         {
-            return ((index + step) % m_capacity);
+            const std::size_t next = index + step;
+            if (next < m_capacity)
+            {
+                return next;
+            }
+            // steps never exceed the capacity on the internal paths: one subtraction is enough there
+            return ((next - m_capacity) < m_capacity) ? (next - m_capacity) : (next % m_capacity);
         }
 
-        std::vector<T> m_ring_vector = {};
+        std::vector<T, Allocator> m_ring_vector = {};
         std::size_t m_push_index = 0U;
         std::size_t m_pop_index = 0U;
         std::size_t m_last_index = 0U;
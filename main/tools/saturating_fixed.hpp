@@ -0,0 +1,428 @@
+/**
+ * @file saturating_fixed.hpp
+ * @brief Saturating wrapper over fpm::fixed and division by constants through a precomputed reciprocal.
+ *
+ * saturating_fixed clamps every result to the range of the fixed type instead of wrapping, with a branch-free
+ * min/max on a wide intermediate. fixed_reciprocal turns a division by a constant into a multiply and a shift,
+ * its multiplier computed at compile time when the reciprocal is constexpr.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SATURATING_FIXED_HPP_)
+#define SATURATING_FIXED_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "fpm/fixed.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        template <typename Fixed>
+        struct saturating_traits;
+
+        template <typename B, typename I, unsigned int F, bool R>
+        struct saturating_traits<fpm::fixed<B, I, F, R>>
+        {
+            using base_type = B;
+            static constexpr unsigned int fraction_bits = F;
+            static constexpr bool rounding = R;
+        };
+
+        /**
+         * @brief Clamps a wide value to the range of B; min/max lower to conditional moves (MIN/MAX on Xtensa).
+         */
+        template <typename B>
+        constexpr B saturate(std::int64_t value) noexcept
+        {
+            constexpr std::int64_t lowest = std::numeric_limits<B>::min();
+            constexpr std::int64_t highest = std::numeric_limits<B>::max();
+            return static_cast<B>(std::min(std::max(value, lowest), highest));
+        }
+    } // namespace detail
+
+    /**
+     * @brief Division by a fixed divisor as a multiply and a shift.
+     *
+     * The constructor normalizes 2^K / |divisor| into a multiplier of 32 significant bits; divide() then costs
+     * one 32 x 32 -> 64 multiply, a rounding add and a shift instead of a 64-bit division. Built in a constexpr
+     * context, the multiplier is a compile-time constant. The quotient is within one unit in the last place of
+     * the rounded fpm division (the multiplier error is below 2^-32 relative) and saturates when it overflows,
+     * which only happens for divisors below one.
+     *
+     * @code
+     * constexpr tools::fixed_reciprocal<fpm::fixed_16_16> per_sample(fpm::fixed_16_16(48));
+     * const auto mean = sum / per_sample;
+     * @endcode
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     */
+    template <typename Fixed>
+    class fixed_reciprocal
+    {
+        using base_type = typename detail::saturating_traits<Fixed>::base_type;
+        static constexpr unsigned int fraction_bits = detail::saturating_traits<Fixed>::fraction_bits;
+
+        static_assert(std::is_signed_v<base_type> && (sizeof(base_type) <= sizeof(std::int32_t)),
+            "fixed_reciprocal needs a signed base type of at most 32 bits");
+
+    public:
+        /**
+         * @brief Precomputes the reciprocal of a divisor.
+         * @param divisor The divisor, not zero.
+         */
+        constexpr explicit fixed_reciprocal(Fixed divisor) noexcept
+            : m_divisor(divisor)
+        {
+            const std::int64_t raw = divisor.raw_value();
+            const auto magnitude = static_cast<std::uint64_t>((raw < 0) ? -raw : raw);
+            unsigned int width = 0U;
+            while ((width < 64U) && ((magnitude >> width) > 1U))
+            {
+                ++width;
+            }
+            // magnitude in [2^width, 2^(width + 1)): 2^(32 + width) / magnitude lies in (2^31, 2^32]
+            const unsigned int exponent = 32U + width;
+            m_multiplier
+                = ((std::uint64_t { 1U } << exponent) + (magnitude / 2U)) / ((0U == magnitude) ? 1U : magnitude);
+            m_shift = exponent - fraction_bits;
+            m_negative = raw < 0;
+        }
+
+        /**
+         * @brief Gets the divisor.
+         * @return The divisor.
+         */
+        [[nodiscard]] constexpr Fixed divisor() const noexcept
+        {
+            return m_divisor;
+        }
+
+        /**
+         * @brief Divides by the divisor, rounding half away from zero like fpm.
+         * @param dividend The dividend.
+         * @return dividend / divisor, saturated to the range of Fixed.
+         */
+        [[nodiscard]] constexpr Fixed divide(Fixed dividend) const noexcept
+        {
+            const std::int64_t raw = dividend.raw_value();
+            // at most 2^31 * 2^32: the product fits in 64 unsigned bits
+            const auto magnitude = static_cast<std::uint64_t>((raw < 0) ? -raw : raw);
+            const std::uint64_t half = std::uint64_t { 1U } << (m_shift - 1U);
+            const auto quotient = static_cast<std::int64_t>(((magnitude * m_multiplier) + half) >> m_shift);
+            const bool negative = (raw < 0) != m_negative;
+            return Fixed::from_raw_value(detail::saturate<base_type>(negative ? -quotient : quotient));
+        }
+
+        /**
+         * @brief Divides by the divisor.
+         * @param dividend The dividend.
+         * @param reciprocal The reciprocal of the divisor.
+         * @return dividend / divisor, saturated to the range of Fixed.
+         */
+        [[nodiscard]] friend constexpr Fixed operator/(Fixed dividend, const fixed_reciprocal& reciprocal) noexcept
+        {
+            return reciprocal.divide(dividend);
+        }
+
+    private:
+        Fixed m_divisor;
+        std::uint64_t m_multiplier = 0U;
+        unsigned int m_shift = 1U;
+        bool m_negative = false;
+    };
+
+    /**
+     * @brief fpm::fixed value whose arithmetic saturates to the range of the type instead of wrapping.
+     *
+     * Every operation is computed on a 64-bit intermediate with the rounding of the underlying fpm type, then
+     * clamped with a branch-free min/max, so that results in range are bit-exact with fpm and results out of
+     * range stick to the nearest bound. Division by zero gives the bound of the sign of the dividend (0 for 0).
+     * Values convert implicitly from Fixed, so that saturating and plain operands mix.
+     *
+     * @tparam Fixed fpm::fixed type with a signed base type of at most 32 bits.
+     */
+    template <typename Fixed>
+    class saturating_fixed
+    {
+        using traits = detail::saturating_traits<Fixed>;
+        using base_type = typename traits::base_type;
+        static constexpr unsigned int fraction_bits = traits::fraction_bits;
+        static constexpr std::int64_t fraction_mult = std::int64_t { 1 } << fraction_bits;
+
+        static_assert(std::is_signed_v<base_type> && (sizeof(base_type) <= sizeof(std::int32_t)),
+            "saturating_fixed needs a signed base type of at most 32 bits");
+
+    public:
+        using fixed_type = Fixed;
+
+        constexpr saturating_fixed() noexcept = default;
+
+        /**
+         * @brief Wraps a fixed value.
+         * @param value The value.
+         */
+        constexpr saturating_fixed(Fixed value) noexcept // NOLINT implicit on purpose, to mix with Fixed operands
+            : m_value(value)
+        {
+        }
+
+        /**
+         * @brief Converts an integer, saturating to the range of the type.
+         * @tparam T Integral type.
+         * @param value The integer.
+         */
+        template <typename T, typename std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+        constexpr explicit saturating_fixed(T value) noexcept
+        {
+            constexpr std::int64_t lowest = std::numeric_limits<base_type>::min() >> fraction_bits;
+            constexpr std::int64_t highest = std::numeric_limits<base_type>::max() >> fraction_bits;
+            std::int64_t clamped = 0;
+            if constexpr (std::is_signed_v<T>)
+            {
+                clamped = std::min(std::max(static_cast<std::int64_t>(value), lowest - 1), highest + 1);
+            }
+            else
+            {
+                clamped = static_cast<std::int64_t>(std::min(static_cast<std::uint64_t>(value),
+                    static_cast<std::uint64_t>(highest + 1)));
+            }
+            m_value = Fixed::from_raw_value(detail::saturate<base_type>(clamped * fraction_mult));
+        }
+
+        /**
+         * @brief Converts a floating-point value, saturating to the range of the type.
+         * @tparam T Floating-point type.
+         * @param value The value.
+         */
+        template <typename T, typename std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+        constexpr explicit saturating_fixed(T value) noexcept
+        {
+            const T lowest = static_cast<T>(std::numeric_limits<base_type>::min()) / static_cast<T>(fraction_mult);
+            const T highest = static_cast<T>(std::numeric_limits<base_type>::max()) / static_cast<T>(fraction_mult);
+            m_value = (value <= lowest) ? lowest_fixed() : ((value >= highest) ? highest_fixed() : Fixed(value));
+        }
+
+        /**
+         * @brief Creates a value from its raw representation.
+         * @param value The raw value.
+         * @return The value.
+         */
+        [[nodiscard]] static constexpr saturating_fixed from_raw_value(base_type value) noexcept
+        {
+            return saturating_fixed(Fixed::from_raw_value(value));
+        }
+
+        /**
+         * @brief Gets the wrapped fixed value.
+         * @return The value.
+         */
+        [[nodiscard]] constexpr Fixed value() const noexcept
+        {
+            return m_value;
+        }
+
+        /**
+         * @brief Gets the raw representation.
+         * @return The raw value.
+         */
+        [[nodiscard]] constexpr base_type raw_value() const noexcept
+        {
+            return m_value.raw_value();
+        }
+
+        /**
+         * @brief Converts to an arithmetic type, like the wrapped fixed value.
+         * @tparam T Arithmetic type.
+         */
+        template <typename T, typename std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
+        constexpr explicit operator T() const noexcept
+        {
+            return static_cast<T>(m_value);
+        }
+
+        /** @brief Negates, the lowest value giving the highest. */
+        [[nodiscard]] constexpr saturating_fixed operator-() const noexcept
+        {
+            return from_wide(-static_cast<std::int64_t>(raw_value()));
+        }
+
+        /** @brief Adds in place, saturating. */
+        constexpr saturating_fixed& operator+=(const saturating_fixed& rhs) noexcept
+        {
+            *this = from_wide(static_cast<std::int64_t>(raw_value()) + rhs.raw_value());
+            return *this;
+        }
+
+        /** @brief Subtracts in place, saturating. */
+        constexpr saturating_fixed& operator-=(const saturating_fixed& rhs) noexcept
+        {
+            *this = from_wide(static_cast<std::int64_t>(raw_value()) - rhs.raw_value());
+            return *this;
+        }
+
+        /** @brief Multiplies in place, saturating, with the rounding of Fixed. */
+        constexpr saturating_fixed& operator*=(const saturating_fixed& rhs) noexcept
+        {
+            const std::int64_t product = static_cast<std::int64_t>(raw_value()) * rhs.raw_value();
+            if constexpr (traits::rounding)
+            {
+                const std::int64_t doubled = product / (fraction_mult / 2);
+                *this = from_wide((doubled / 2) + (doubled % 2));
+            }
+            else
+            {
+                *this = from_wide(product / fraction_mult);
+            }
+            return *this;
+        }
+
+        /** @brief Divides in place, saturating, with the rounding of Fixed. */
+        constexpr saturating_fixed& operator/=(const saturating_fixed& rhs) noexcept
+        {
+            const std::int64_t numerator = static_cast<std::int64_t>(raw_value()) * fraction_mult;
+            if (0 == rhs.raw_value())
+            {
+                *this = from_wide((numerator < 0) ? std::numeric_limits<std::int64_t>::min()
+                                                  : ((numerator > 0) ? std::numeric_limits<std::int64_t>::max() : 0));
+            }
+            else if constexpr (traits::rounding)
+            {
+                const std::int64_t doubled = (numerator * 2) / rhs.raw_value();
+                *this = from_wide((doubled / 2) + (doubled % 2));
+            }
+            else
+            {
+                *this = from_wide(numerator / rhs.raw_value());
+            }
+            return *this;
+        }
+
+        /** @brief Sum, saturating. */
+        [[nodiscard]] friend constexpr saturating_fixed operator+(saturating_fixed lhs, const saturating_fixed& rhs)
+        {
+            return lhs += rhs;
+        }
+
+        /** @brief Difference, saturating. */
+        [[nodiscard]] friend constexpr saturating_fixed operator-(saturating_fixed lhs, const saturating_fixed& rhs)
+        {
+            return lhs -= rhs;
+        }
+
+        /** @brief Product, saturating. */
+        [[nodiscard]] friend constexpr saturating_fixed operator*(saturating_fixed lhs, const saturating_fixed& rhs)
+        {
+            return lhs *= rhs;
+        }
+
+        /** @brief Quotient, saturating. */
+        [[nodiscard]] friend constexpr saturating_fixed operator/(saturating_fixed lhs, const saturating_fixed& rhs)
+        {
+            return lhs /= rhs;
+        }
+
+        /** @brief Quotient by a precomputed reciprocal, saturating. */
+        [[nodiscard]] friend constexpr saturating_fixed operator/(
+            const saturating_fixed& lhs, const fixed_reciprocal<Fixed>& rhs)
+        {
+            return saturating_fixed(rhs.divide(lhs.m_value));
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() == rhs.raw_value();
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() != rhs.raw_value();
+        }
+
+        [[nodiscard]] friend constexpr bool operator<(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() < rhs.raw_value();
+        }
+
+        [[nodiscard]] friend constexpr bool operator>(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() > rhs.raw_value();
+        }
+
+        [[nodiscard]] friend constexpr bool operator<=(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() <= rhs.raw_value();
+        }
+
+        [[nodiscard]] friend constexpr bool operator>=(const saturating_fixed& lhs, const saturating_fixed& rhs)
+        {
+            return lhs.raw_value() >= rhs.raw_value();
+        }
+
+        /** @brief Lowest value of the type. */
+        [[nodiscard]] static constexpr saturating_fixed lowest() noexcept
+        {
+            return saturating_fixed(lowest_fixed());
+        }
+
+        /** @brief Highest value of the type. */
+        [[nodiscard]] static constexpr saturating_fixed highest() noexcept
+        {
+            return saturating_fixed(highest_fixed());
+        }
+
+    private:
+        static constexpr Fixed lowest_fixed() noexcept
+        {
+            return Fixed::from_raw_value(std::numeric_limits<base_type>::min());
+        }
+
+        static constexpr Fixed highest_fixed() noexcept
+        {
+            return Fixed::from_raw_value(std::numeric_limits<base_type>::max());
+        }
+
+        static constexpr saturating_fixed from_wide(std::int64_t value) noexcept
+        {
+            return saturating_fixed(Fixed::from_raw_value(detail::saturate<base_type>(value)));
+        }
+
+        Fixed m_value;
+    };
+
+} // namespace tools
+
+#endif // SATURATING_FIXED_HPP_
@@ -0,0 +1,322 @@
+/**
+ * @file seqlock.hpp
+ * @brief Latest-value cells shared without locks: a sequence lock for small values and a triple buffer for large ones.
+ *
+ * tools::seqlock<T> lets one writer (a task or an ISR) publish a trivially copyable value that any number of readers
+ * copy out, retrying when a write raced their copy; the writer never waits. tools::triple_buffer<T> hands whole
+ * buffers between one writer and one reader instead, so neither side copies under contention nor retries. Both
+ * replace a queue when readers only care about the newest state.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SEQLOCK_HPP_)
+#define SEQLOCK_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "tools/non_copyable.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Single-writer, multi-reader latest-value cell guarded by a sequence counter.
+     *
+     * The writer makes the counter odd, stores the value and makes it even again; a reader copies the value between
+     * two reads of the counter and retries if they differ or were odd. The value is kept in relaxed atomic words, so
+     * a torn copy is discarded rather than undefined. store() is wait-free and may run in an ISR; load() spins while a
+     * write is in progress, so a task reader must not preempt a task writer on the same core forever (the usual
+     * writer is an ISR, which cannot be preempted by tasks). isr_load() gives up instead of spinning.
+     *
+     * @tparam T Trivially copyable value type, best a few words long (see triple_buffer for large values).
+     */
+    template <typename T>
+    class seqlock : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "seqlock copies its value word by word");
+
+    public:
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Constructs a cell holding a value-initialized T.
+         */
+        seqlock()
+        {
+            write_words(T {});
+        }
+
+        /**
+         * @brief Constructs a cell holding an initial value.
+         *
+         * @param initial The initial value.
+         */
+        explicit seqlock(const T& initial)
+        {
+            write_words(initial);
+        }
+
+        ~seqlock() = default;
+
+        /**
+         * @brief Publishes a new value, never blocking. Only one writer at a time.
+         *
+         * @param value The value to publish.
+         */
+        void store(const T& value)
+        {
+            const std::uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+            m_sequence.store(sequence + 1U, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            write_words(value);
+            m_sequence.store(sequence + 2U, std::memory_order_release);
+        }
+
+        /**
+         * @brief Publishes a new value from an ISR (same wait-free path as store()).
+         *
+         * @param value The value to publish.
+         */
+        void isr_store(const T& value)
+        {
+            store(value);
+        }
+
+        /**
+         * @brief Copies the latest published value, retrying while a write races the copy.
+         *
+         * @return The latest value.
+         */
+        [[nodiscard]] T load() const
+        {
+            T value {};
+            for (std::uint32_t attempt = 1U; !try_load(value); ++attempt)
+            {
+                if (0U == (attempt % yield_interval))
+                {
+                    tools::yield();
+                }
+                else
+                {
+                    tools::cpu_relax();
+                }
+            }
+            return value;
+        }
+
+        /**
+         * @brief Copies the latest published value in one attempt.
+         *
+         * @param value Receives the value on success, left in an unspecified state otherwise.
+         * @return False if a write was in progress or raced the copy.
+         */
+        [[nodiscard]] bool try_load(T& value) const
+        {
+            const std::uint32_t before = m_sequence.load(std::memory_order_acquire);
+            if (0U != (before & 1U))
+            {
+                return false;
+            }
+
+            read_words(value);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return before == m_sequence.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Copies the latest published value from an ISR, with a bounded number of attempts.
+         *
+         * An ISR interrupting the writer on its own core would wait forever for the write to complete, hence the bound.
+         *
+         * @param value Receives the value on success.
+         * @return False if every attempt raced a write.
+         */
+        [[nodiscard]] bool isr_load(T& value) const
+        {
+            for (std::uint32_t attempt = 0U; attempt < isr_attempts; ++attempt)
+            {
+                if (try_load(value))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Gets the number of completed stores, e.g. to skip a value already seen.
+         *
+         * @return The publication count (wraps around).
+         */
+        [[nodiscard]] std::uint32_t version() const
+        {
+            return m_sequence.load(std::memory_order_acquire) >> 1U;
+        }
+
+    private:
+        using word_type = std::uint32_t;
+        static constexpr std::size_t word_count = (sizeof(T) + sizeof(word_type) - 1U) / sizeof(word_type);
+        static constexpr std::uint32_t yield_interval = 64U;
+        static constexpr std::uint32_t isr_attempts = 4U;
+
+        void write_words(const T& value)
+        {
+            std::array<word_type, word_count> words = {};
+            std::memcpy(words.data(), &value, sizeof(T));
+            for (std::size_t index = 0U; index < word_count; ++index)
+            {
+                m_words[index].store(words[index], std::memory_order_relaxed);
+            }
+        }
+
+        void read_words(T& value) const
+        {
+            std::array<word_type, word_count> words = {};
+            for (std::size_t index = 0U; index < word_count; ++index)
+            {
+                words[index] = m_words[index].load(std::memory_order_relaxed);
+            }
+            std::memcpy(&value, words.data(), sizeof(T));
+        }
+
+        std::atomic<std::uint32_t> m_sequence { 0U };
+        std::array<std::atomic<word_type>, word_count> m_words {};
+    };
+
+    /**
+     * @brief Single-writer, single-reader latest-value exchange over three buffers.
+     *
+     * The writer fills its back buffer in place and publishes it by swapping it with the middle buffer; the reader
+     * swaps the middle buffer with its front buffer when a newer one was published. Both sides are wait-free and
+     * never copy the value, so it suits large or non-trivial T (the three buffers are allocated in the object). The
+     * writer side may run in an ISR.
+     *
+     * @tparam T Value type, default constructible.
+     */
+    template <typename T>
+    class triple_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        triple_buffer() = default;
+        ~triple_buffer() = default;
+
+        /**
+         * @brief Gets the writer buffer, to fill in place before publish().
+         *
+         * @return The back buffer, owned by the writer until publish().
+         */
+        [[nodiscard]] T& write_buffer()
+        {
+            return m_buffers[m_back];
+        }
+
+        /**
+         * @brief Publishes the writer buffer as the newest value, recycling the previous middle buffer.
+         */
+        void publish()
+        {
+            const std::uint8_t previous = m_middle.exchange(
+                static_cast<std::uint8_t>(m_back | fresh_flag), std::memory_order_acq_rel);
+            m_back = static_cast<std::uint8_t>(previous & index_mask);
+        }
+
+        /**
+         * @brief Copies a value into the writer buffer and publishes it.
+         *
+         * @param value The value to publish.
+         */
+        void store(const T& value)
+        {
+            write_buffer() = value;
+            publish();
+        }
+
+        /**
+         * @brief Publishes a value from an ISR (same wait-free path as store()).
+         *
+         * @param value The value to publish.
+         */
+        void isr_store(const T& value)
+        {
+            store(value);
+        }
+
+        /**
+         * @brief Takes the newest published buffer if there is one, then gives access to the reader buffer.
+         *
+         * @return The front buffer, owned by the reader until the next read(); the previous value if nothing new.
+         */
+        [[nodiscard]] const T& read()
+        {
+            if (0U != (m_middle.load(std::memory_order_relaxed) & fresh_flag))
+            {
+                const std::uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+                m_front = static_cast<std::uint8_t>(previous & index_mask);
+            }
+            return m_buffers[m_front];
+        }
+
+        /**
+         * @brief Checks whether a value was published since the last read().
+         *
+         * @return True if read() will return a newer value.
+         */
+        [[nodiscard]] bool has_new_value() const
+        {
+            return 0U != (m_middle.load(std::memory_order_acquire) & fresh_flag);
+        }
+
+    private:
+        static constexpr std::uint8_t index_mask = 0x03U;
+        static constexpr std::uint8_t fresh_flag = 0x04U;
+
+        std::array<T, 3U> m_buffers {};
+        std::uint8_t m_back = 0U;  ///< writer side only
+        std::uint8_t m_front = 1U; ///< reader side only
+        std::atomic<std::uint8_t> m_middle { 2U };
+    };
+}
+
+#endif //  SEQLOCK_HPP_
@@ -0,0 +1,208 @@
+/**
+ * @file sharded_counter.hpp
+ * @brief Relaxed event counter split into per-core cache-line slots, for hot-path statistics.
+ *
+ * Incrementing one shared atomic from every core bounces its cache line between the cores. A sharded_counter
+ * gives each core its own padded slot, incremented with a relaxed atomic add from tasks and ISRs alike, and sums
+ * the slots only when the value is read.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SHARDED_COUNTER_HPP_)
+#define SHARDED_COUNTER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Default number of slots of a sharded_counter: one per core on ESP32, 8 elsewhere.
+     */
+#if defined(ESP_PLATFORM)
+    inline constexpr std::size_t default_counter_shards = portNUM_PROCESSORS;
+#elif defined(FREERTOS_PLATFORM)
+    inline constexpr std::size_t default_counter_shards = 1U;
+#else
+    inline constexpr std::size_t default_counter_shards = 8U;
+#endif
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the slot hint of the caller: its core on ESP32 and Linux, a per-thread slot elsewhere.
+         */
+        inline std::size_t counter_shard_hint()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::size_t>(xPortGetCoreID());
+#elif defined(FREERTOS_PLATFORM)
+            return 0U;
+#else
+            static std::atomic<std::size_t> next_hint { 0U };
+            thread_local const std::size_t hint = next_hint.fetch_add(1U, std::memory_order_relaxed);
+#if defined(__linux__)
+            // served from the vDSO (or rseq) without a system call on current kernels
+            const int cpu = sched_getcpu();
+            return (cpu >= 0) ? static_cast<std::size_t>(cpu) : hint;
+#else
+            return hint;
+#endif
+#endif
+        }
+    }
+
+    /**
+     * @brief Monotonic event counter with one cache-line-padded slot per core.
+     *
+     * add() and isr_add() are one relaxed atomic add on the slot of the calling core, so concurrent writers on
+     * different cores never share a cache line; on desktop, where threads outnumber the slots, the slot follows
+     * the CPU the thread runs on and the add stays correct when two threads meet on one slot. value() sums the
+     * slots: it is exact once writers are quiescent, and otherwise a value the counter held during the call.
+     * Counts wrap modulo the range of T.
+     *
+     * @tparam T Unsigned count type, lock-free as an atomic (std::size_t: 32 bits on ESP32, 64 on desktop).
+     * @tparam ShardCount Number of slots, a power of two; cores beyond it share slots.
+     */
+    template <typename T = std::size_t, std::size_t ShardCount = default_counter_shards>
+    class sharded_counter : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_unsigned_v<T>, "counts are unsigned");
+        static_assert(std::atomic<T>::is_always_lock_free, "the count type must be lock-free, also for ISRs");
+        static_assert((ShardCount >= 1U) && (0U == (ShardCount & (ShardCount - 1U))), "ShardCount is a power of 2");
+
+        sharded_counter() = default;
+        ~sharded_counter() = default;
+
+        /**
+         * @brief Adds to the slot of the calling core.
+         * @param amount The amount to add.
+         */
+        void add(T amount = 1U) noexcept
+        {
+            m_slots[detail::counter_shard_hint() & (ShardCount - 1U)].count.fetch_add(
+                amount, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Adds to the slot of the calling core, from an ISR.
+         * @param amount The amount to add.
+         */
+        void isr_add(T amount = 1U) noexcept
+        {
+            add(amount);
+        }
+
+        /**
+         * @brief Adds one to the slot of the calling core.
+         * @return *this.
+         */
+        sharded_counter& operator++() noexcept
+        {
+            add(1U);
+            return *this;
+        }
+
+        /**
+         * @brief Sums the slots.
+         * @return The count.
+         */
+        [[nodiscard]] T value() const noexcept
+        {
+            T total = 0U;
+            for (const auto& slot : m_slots)
+            {
+                total += slot.count.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /**
+         * @brief Takes the count and restarts from zero, for rate reporting: no concurrent add is lost.
+         * @return The count since the previous exchange() or reset().
+         */
+        T exchange() noexcept
+        {
+            T total = 0U;
+            for (auto& slot : m_slots)
+            {
+                total += slot.count.exchange(0U, std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /**
+         * @brief Restarts from zero.
+         */
+        void reset() noexcept
+        {
+            for (auto& slot : m_slots)
+            {
+                slot.count.store(0U, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Gets the number of slots.
+         * @return ShardCount.
+         */
+        [[nodiscard]] static constexpr std::size_t shard_count() noexcept
+        {
+            return ShardCount;
+        }
+
+    private:
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        struct alignas(cache_line_size) slot
+        {
+            std::atomic<T> count { 0U };
+        };
+
+        std::array<slot, ShardCount> m_slots = {};
+    };
+}
+
+#endif // SHARDED_COUNTER_HPP_
@@ -0,0 +1,410 @@
+/**
+ * @file sharded_sync_dictionary.hpp
+ * @brief A thread-safe dictionary split into hash-partitioned shards with reader/writer locks.
+ *
+ * This file contains the definition of the sharded_sync_dictionary class, the read-mostly counterpart of
+ * sync_dictionary: lookups on different shards never contend, and lookups on the same shard run in parallel.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SHARDED_SYNC_DICTIONARY_HPP_)
+#define SHARDED_SYNC_DICTIONARY_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#endif
+
+#include "tools/non_copyable.hpp"
+#include "tools/shared_critical_section.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A thread-safe dictionary made of ShardCount independently locked dictionaries.
+     *
+     * A key always lives in the shard picked by its mixed hash. find() and contains() take their shard lock
+     * shared, add() and remove() take it exclusive, so readers only wait for a writer on the same shard.
+     * Whole-dictionary queries (size(), empty(), snapshot()) visit the shards one after the other and are not a
+     * single atomic view while writers are active.
+     *
+     * @tparam K The type of the keys in the dictionary.
+     * @tparam T The type of the values in the dictionary.
+     * @tparam TDictionary The associative container type of every shard, std::unordered_map<K, T> by default;
+     *         tools::flat_hash_map<K, T> or std::map<K, T> work as well.
+     * @tparam ShardCount The number of shards, a power of two.
+     * @tparam Hash The hash function object used to pick the shard.
+     */
+    template <typename K, typename T, typename TDictionary = std::unordered_map<K, T>, std::size_t ShardCount = 8U,
+        typename Hash = std::hash<K>>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        requires(requires {
+            typename TDictionary::key_type;
+            typename TDictionary::mapped_type;
+        } && std::is_same_v<typename TDictionary::key_type, K> && std::is_same_v<typename TDictionary::mapped_type, T>)
+#endif
+    class sharded_sync_dictionary : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using dictionary_type = TDictionary;
+
+        static_assert(std::is_same<typename dictionary_type::key_type, K>::value,
+            "sharded_sync_dictionary: dictionary key_type must match K");
+        static_assert(std::is_same<typename dictionary_type::mapped_type, T>::value,
+            "sharded_sync_dictionary: dictionary mapped_type must match T");
+        static_assert((ShardCount > 0U) && ((ShardCount & (ShardCount - 1U)) == 0U),
+            "sharded_sync_dictionary: ShardCount must be a power of two");
+
+        sharded_sync_dictionary() = default;
+        ~sharded_sync_dictionary() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Retrieves the number of shards.
+         *
+         * @return ShardCount.
+         */
+        [[nodiscard]] static constexpr std::size_t shard_count()
+        {
+            return ShardCount;
+        }
+
+        /**
+         * @brief Retrieves the shard a key belongs to.
+         *
+         * @param key The key.
+         * @return The shard index, lower than shard_count().
+         */
+        [[nodiscard]] static std::size_t shard_of(const K& key)
+        {
+            // murmur3 finalizer, so that sequential or strided hashes spread over the shards
+            constexpr const std::uint64_t mix1 = 0xff51afd7ed558ccdULL;
+            constexpr const std::uint64_t mix2 = 0xc4ceb9fe1a85ec53ULL;
+            constexpr const unsigned int shift = 33U;
+
+            auto mixed = static_cast<std::uint64_t>(Hash{}(key));
+            mixed ^= mixed >> shift;
+            mixed *= mix1;
+            mixed ^= mixed >> shift;
+            mixed *= mix2;
+            mixed ^= mixed >> shift;
+
+            return static_cast<std::size_t>(mixed & (ShardCount - 1U));
+        }
+
+        /**
+         * @brief Adds a key-value pair to the dictionary, or updates the value of an existing key.
+         *
+         * @param key The key to be added or updated in the dictionary.
+         * @param value The value associated with the key.
+         */
+        void add(const K& key, const T& value)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<tools::shared_critical_section> guard(target.m_mutex);
+            target.m_dictionary.insert_or_assign(key, value);
+        }
+
+        /**
+         * @brief Adds a key-value pair to the dictionary using rvalue references.
+         *
+         * @param key The key to be added or updated in the dictionary.
+         * @param value The value associated with the key.
+         */
+        void add(K&& key, T&& value)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<tools::shared_critical_section> guard(target.m_mutex);
+            target.m_dictionary.insert_or_assign(std::move(key), std::move(value));
+        }
+
+        /**
+         * @brief Adds a key-value pair to the dictionary with perfect forwarding.
+         *
+         * The key is converted to K first, since the shard is picked from its hash.
+         *
+         * @tparam KU The deduced key type.
+         * @tparam TU The deduced value type.
+         * @param key The key to be converted into K.
+         * @param value The value to be forwarded into the dictionary.
+         */
+        template <typename KU, typename TU>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<K, KU> && std::is_constructible_v<T, TU>
+#endif
+        auto add(KU&& key, TU&& value)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<K, KU>::value && std::is_constructible<T, TU>::value,
+                void>::type
+#endif
+        {
+            K key_value(std::forward<KU>(key));
+            auto& target = m_shards[shard_of(key_value)];
+            std::scoped_lock<tools::shared_critical_section> guard(target.m_mutex);
+            target.m_dictionary.insert_or_assign(std::move(key_value), std::forward<TU>(value));
+        }
+
+        /**
+         * @brief Removes the element with the specified key from the dictionary.
+         *
+         * @param key The key of the element to be removed.
+         */
+        void remove(const K& key)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<tools::shared_critical_section> guard(target.m_mutex);
+            target.m_dictionary.erase(key);
+        }
+
+        /**
+         * @brief Adds key-value pairs from a generic range-like source.
+         *
+         * In C++20, accepts any std::ranges::input_range of pair-like entries.
+         * In C++17, accepts any iterable of pair-like entries whose key/value are constructible to K/T.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param values The source range of key-value entries.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<
+                std::is_constructible<K,
+                    decltype(std::get<0>(*std::begin(std::declval<typename std::decay<TRange>::type&>())))>::value
+                && std::is_constructible<T,
+                    decltype(std::get<1>(*std::begin(std::declval<typename std::decay<TRange>::type&>())))>::value>::
+                type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<K, decltype(std::get<0>(*std::begin(std::declval<TRange&>())))>
+            && std::is_constructible_v<T, decltype(std::get<1>(*std::begin(std::declval<TRange&>())))>
+#endif
+        void add_range(TRange&& values)
+        {
+            for (auto&& entry : std::forward<TRange>(values))
+            {
+                add(K(std::get<0>(entry)), T(std::get<1>(entry)));
+            }
+        }
+
+        /**
+         * @brief Adds key-value pairs from an initializer-list range.
+         *
+         * @param values The source initializer-list of key-value pairs.
+         */
+        void add_range(std::initializer_list<std::pair<K, T>> values)
+        {
+            for (const auto& [key, value] : values)
+            {
+                add(key, value);
+            }
+        }
+
+        /**
+         * @brief Retrieves a copy of all the entries, merged in one dictionary.
+         *
+         * Each shard is copied under its shared lock, one shard at a time.
+         *
+         * @return A dictionary holding the entries of every shard.
+         */
+        [[nodiscard]] dictionary_type snapshot() const
+        {
+            dictionary_type result;
+
+            for (const auto& source : m_shards)
+            {
+                std::shared_lock<tools::shared_critical_section> guard(source.m_mutex);
+                for (const auto& [key, value] : source.m_dictionary)
+                {
+                    result.insert_or_assign(key, value);
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Finds the value associated with the given key in the dictionary.
+         *
+         * @param key The key to search for in the dictionary.
+         * @return std::optional<T> The value associated with the key if found, otherwise an empty std::optional.
+         */
+        [[nodiscard]] std::optional<T> find(const K& key) const
+        {
+            std::optional<T> result;
+            const auto& source = m_shards[shard_of(key)];
+            std::shared_lock<tools::shared_critical_section> guard(source.m_mutex);
+            const auto& itr = source.m_dictionary.find(key);
+            if (source.m_dictionary.cend() != itr)
+            {
+                result = itr->second;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Checks whether a key exists in the dictionary.
+         *
+         * @param key The key to check.
+         * @return true when the key exists, otherwise false.
+         */
+        [[nodiscard]] bool contains(const K& key) const
+        {
+            const auto& source = m_shards[shard_of(key)];
+            std::shared_lock<tools::shared_critical_section> guard(source.m_mutex);
+            return source.m_dictionary.find(key) != source.m_dictionary.cend();
+        }
+
+        /**
+         * @brief Removes keys from a generic range-like collection.
+         *
+         * In C++20, accepts any std::ranges::input_range whose elements are constructible to K.
+         * In C++17, accepts any iterable whose elements are constructible to K.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param keys The source collection of keys to remove.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<K,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<K, decltype(*std::begin(std::declval<TRange&>()))>
+#endif
+        void remove_collection(TRange&& keys)
+        {
+            for (auto&& key : std::forward<TRange>(keys))
+            {
+                remove(K(std::forward<decltype(key)>(key)));
+            }
+        }
+
+        /**
+         * @brief Removes keys from an initializer-list.
+         *
+         * @param keys The source initializer-list of keys to remove.
+         */
+        void remove_collection(std::initializer_list<K> keys)
+        {
+            for (const auto& key : keys)
+            {
+                remove(key);
+            }
+        }
+
+        /**
+         * @brief Checks if every shard is empty.
+         *
+         * @return true if the dictionary is empty, false otherwise.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            for (const auto& source : m_shards)
+            {
+                std::shared_lock<tools::shared_critical_section> guard(source.m_mutex);
+                if (!source.m_dictionary.empty())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Returns the number of elements in the dictionary, summed shard by shard.
+         *
+         * @return The number of elements in the dictionary.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t total = 0U;
+
+            for (const auto& source : m_shards)
+            {
+                std::shared_lock<tools::shared_critical_section> guard(source.m_mutex);
+                total += source.m_dictionary.size();
+            }
+
+            return total;
+        }
+
+        /**
+         * @brief Clears all elements from the dictionary, shard by shard.
+         */
+        void clear()
+        {
+            for (auto& target : m_shards)
+            {
+                std::scoped_lock<tools::shared_critical_section> guard(target.m_mutex);
+                target.m_dictionary.clear();
+            }
+        }
+
+    private:
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        /**
+         * @brief One partition and its lock, on its own cache lines to avoid false sharing between shards.
+         */
+        struct alignas(cache_line_size) shard
+        {
+            dictionary_type m_dictionary;
+            mutable shared_critical_section m_mutex;
+        };
+
+        std::array<shard, ShardCount> m_shards;
+    };
+}
+
+#endif //  SHARDED_SYNC_DICTIONARY_HPP_
@@ -0,0 +1,75 @@
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SHARED_CRITICAL_SECTION_HPP_)
+#define SHARED_CRITICAL_SECTION_HPP_
+
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include "tools/freertos/shared_critical_section_freertos.inl"
+#else
+#include "tools/standard/shared_critical_section_std.inl"
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Tells whether a lock type provides the lock_shared()/unlock_shared() pair.
+     *
+     * @tparam Lock The lock type to inspect.
+     */
+    template <typename Lock, typename = void>
+    struct is_shared_lockable : std::false_type
+    {
+    };
+
+    template <typename Lock>
+    struct is_shared_lockable<Lock,
+        std::void_t<decltype(std::declval<Lock&>().lock_shared()), decltype(std::declval<Lock&>().unlock_shared())>>
+        : std::true_type
+    {
+    };
+
+    /**
+     * @brief RAII guard for read-only sections: shared when the lock supports it, exclusive otherwise.
+     *
+     * Containers templated on their lock use it so their const accessors run concurrently with a
+     * shared_critical_section and keep working unchanged with a plain critical_section.
+     *
+     * @tparam Lock The lock type guarded.
+     */
+    template <typename Lock>
+    using read_lock_guard
+        = std::conditional_t<is_shared_lockable<Lock>::value, std::shared_lock<Lock>, std::unique_lock<Lock>>;
+}
+
+#endif //  SHARED_CRITICAL_SECTION_HPP_
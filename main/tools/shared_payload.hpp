@@ -0,0 +1,374 @@
+/**
+ * @file shared_payload.hpp
+ * @brief Immutable, reference-counted buffer for large event payloads, copied by reference with copy-on-write.
+ *
+ * A std::vector frame or JSON text published to several observers is deep-copied into every async_observer tuple,
+ * every container slot and every snapshot on its way. shared_payload keeps the elements and an atomic reference
+ * count in one block allocated through the global operator new, hence from the mem pool size classes with
+ * USE_MEM_POOL_ALLOCATOR: copying a payload only increments the count, and mutate() copies the elements first when
+ * the block is shared.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SHARED_PAYLOAD_HPP_)
+#define SHARED_PAYLOAD_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Immutable array of trivially copyable elements shared between its copies.
+     *
+     * Copies share the block and are safe to read, copy and destroy from different tasks at once; the count uses
+     * the same release/acquire protocol as std::shared_ptr. A default constructed or moved-from payload is empty
+     * and owns nothing. Elements are only written through mutate(), which first gives the payload a block of its
+     * own when another copy shares it, so a payload handed to other tasks is never changed under their feet.
+     *
+     * @tparam T Element type, trivially copyable, for instance std::uint8_t for frames or char for JSON text.
+     */
+    template <typename T>
+    class shared_payload
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "shared_payload elements are trivially copyable");
+        static_assert(std::is_trivially_default_constructible<T>::value, "shared_payload elements are trivial");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "shared_payload elements are not over-aligned");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_iterator = const T*;
+
+        shared_payload() noexcept = default;
+
+        /**
+         * @brief Allocates a payload of zero-initialized elements, to be filled through mutate().
+         *
+         * @param size Number of elements.
+         */
+        explicit shared_payload(std::size_t size)
+            : m_block(allocate(size))
+        {
+            if (nullptr != m_block)
+            {
+                std::uninitialized_value_construct_n(elements(m_block), size);
+            }
+        }
+
+        /**
+         * @brief Allocates a payload whose elements are left uninitialized, for a producer that writes them all.
+         *
+         * @param size Number of elements.
+         * @return The payload, to be filled through mutate() before it is shared.
+         */
+        [[nodiscard]] static shared_payload uninitialized(std::size_t size)
+        {
+            shared_payload payload;
+            payload.m_block = allocate(size);
+            return payload;
+        }
+
+        /**
+         * @brief Allocates a payload holding a copy of the given elements.
+         *
+         * @param data First element, may be nullptr when size is 0.
+         * @param size Number of elements.
+         */
+        shared_payload(const T* data, std::size_t size)
+            : m_block(allocate(size))
+        {
+            if (nullptr != m_block)
+            {
+                std::memcpy(elements(m_block), data, size * sizeof(T));
+            }
+        }
+
+        /**
+         * @brief Allocates a payload holding a copy of a vector.
+         *
+         * @param data Source elements.
+         */
+        explicit shared_payload(const std::vector<T>& data)
+            : shared_payload(data.data(), data.size())
+        {
+        }
+
+        /**
+         * @brief Allocates a payload holding a copy of a text, for char payloads.
+         *
+         * @param text Source characters, without a terminating null.
+         */
+        template <typename U = T, typename = std::enable_if_t<std::is_same<U, char>::value>>
+        explicit shared_payload(std::string_view text)
+            : shared_payload(text.data(), text.size())
+        {
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Allocates a payload holding a copy of a span, e.g. a view read in place from a stream.
+         *
+         * @param data Source elements.
+         */
+        explicit shared_payload(std::span<const T> data)
+            : shared_payload(data.data(), data.size())
+        {
+        }
+#endif
+
+        shared_payload(const shared_payload& other) noexcept
+            : m_block(other.m_block)
+        {
+            retain();
+        }
+
+        shared_payload(shared_payload&& other) noexcept
+            : m_block(std::exchange(other.m_block, nullptr))
+        {
+        }
+
+        shared_payload& operator=(const shared_payload& other) noexcept
+        {
+            if (m_block != other.m_block)
+            {
+                release();
+                m_block = other.m_block;
+                retain();
+            }
+            return *this;
+        }
+
+        shared_payload& operator=(shared_payload&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_block = std::exchange(other.m_block, nullptr);
+            }
+            return *this;
+        }
+
+        ~shared_payload()
+        {
+            release();
+        }
+
+        [[nodiscard]] const T* data() const noexcept
+        {
+            return (nullptr != m_block) ? elements(m_block) : nullptr;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return (nullptr != m_block) ? m_block->size : 0U;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return 0U == size();
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return data() + size(); // NOLINT pointer arithmetic
+        }
+
+        [[nodiscard]] const T& operator[](std::size_t index) const noexcept
+        {
+            return data()[index]; // NOLINT pointer arithmetic
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Gets a read-only view of the elements, valid as long as this payload is neither changed nor destroyed.
+         *
+         * @return The elements.
+         */
+        [[nodiscard]] std::span<const T> view() const noexcept
+        {
+            return std::span<const T>(data(), size());
+        }
+#endif
+
+        /**
+         * @brief Gets the number of payloads sharing the block.
+         *
+         * @return Reference count, 0 for an empty payload.
+         */
+        [[nodiscard]] std::size_t use_count() const noexcept
+        {
+            return (nullptr != m_block) ? m_block->references.load(std::memory_order_relaxed) : 0U;
+        }
+
+        /**
+         * @brief Tells whether two payloads share the same block, i.e. no copy of the elements was made.
+         *
+         * @param other Payload to compare with.
+         * @return true when both refer to the same block.
+         */
+        [[nodiscard]] bool shares_with(const shared_payload& other) const noexcept
+        {
+            return (nullptr != m_block) && (m_block == other.m_block);
+        }
+
+        /**
+         * @brief Gets write access to the elements, copying them first into a block of its own if shared.
+         *
+         * The pointer is valid until this payload is copied, assigned or destroyed; writing through it after a copy
+         * was made would change the copy too.
+         *
+         * @return The elements, nullptr for an empty payload.
+         */
+        [[nodiscard]] T* mutate()
+        {
+            if ((nullptr != m_block) && (1U != m_block->references.load(std::memory_order_acquire)))
+            {
+                shared_payload own(data(), size());
+                *this = std::move(own);
+            }
+            return (nullptr != m_block) ? elements(m_block) : nullptr;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Span flavour of mutate().
+         *
+         * @return The elements, copied first if shared.
+         */
+        [[nodiscard]] std::span<T> mutable_view()
+        {
+            T* elements_data = mutate();
+            return std::span<T>(elements_data, size());
+        }
+#endif
+
+        /**
+         * @brief Copies the elements into a vector.
+         *
+         * @return The elements.
+         */
+        [[nodiscard]] std::vector<T> to_vector() const
+        {
+            return std::vector<T>(begin(), end());
+        }
+
+        /**
+         * @brief Compares the elements of two payloads.
+         */
+        friend bool operator==(const shared_payload& lhs, const shared_payload& rhs) noexcept
+        {
+            return (lhs.m_block == rhs.m_block)
+                || ((lhs.size() == rhs.size()) && (0 == std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T))));
+        }
+
+        friend bool operator!=(const shared_payload& lhs, const shared_payload& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        struct control_block
+        {
+            std::atomic<std::uint32_t> references;
+            std::size_t size;
+        };
+
+        // elements start right after the header, at their own alignment
+        static constexpr std::size_t header_size = ((sizeof(control_block) + alignof(T) - 1U) / alignof(T)) * alignof(T);
+
+        static std::size_t block_bytes(std::size_t size) noexcept
+        {
+            return header_size + (size * sizeof(T));
+        }
+
+        static T* elements(control_block* block) noexcept
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<std::uint8_t*>(block) + header_size); // NOLINT block layout
+        }
+
+        static control_block* allocate(std::size_t size)
+        {
+            if (0U == size)
+            {
+                return nullptr;
+            }
+
+            // sized operator new/delete pairs let the mem pool allocator recycle the block in its size class
+            void* memory = ::operator new(block_bytes(size));
+            auto* block = ::new (memory) control_block;
+            block->references.store(1U, std::memory_order_relaxed);
+            block->size = size;
+            return block;
+        }
+
+        void retain() noexcept
+        {
+            if (nullptr != m_block)
+            {
+                m_block->references.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+
+        void release() noexcept
+        {
+            if ((nullptr != m_block) && (1U == m_block->references.fetch_sub(1U, std::memory_order_acq_rel)))
+            {
+                const std::size_t bytes = block_bytes(m_block->size);
+                m_block->~control_block();
+                ::operator delete(static_cast<void*>(m_block), bytes);
+            }
+            m_block = nullptr;
+        }
+
+        control_block* m_block = nullptr;
+    };
+}
+
+#endif //  SHARED_PAYLOAD_HPP_
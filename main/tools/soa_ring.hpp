@@ -0,0 +1,579 @@
+/**
+ * @file soa_ring.hpp
+ * @brief A thread-unsafe ring container storing each field of its rows in its own contiguous ring.
+ *
+ * A ring_vector of multi-channel samples interleaves the channels, so processing one channel strides across
+ * whole samples. soa_ring keeps one array per field (structure of arrays), all sharing the push and pop
+ * indices, offers the push/pop interface of ring_vector on whole rows, and exposes each field as at most two
+ * contiguous spans that vectorize well.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SOA_RING_HPP_)
+#define SOA_RING_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief A thread-unsafe ring container of rows stored as one ring per field (structure of arrays).
+     *
+     * A row is a std::tuple<Fields...>; pushing a row writes one slot in every field ring at the shared push
+     * index, so the rings always hold the same rows in the same slots. Per-field views (peek_spans(),
+     * field_data()) give the analytics code plain arrays of one field.
+     *
+     * @code
+     * tools::soa_ring<float, float, float, std::uint32_t> imu(256U); // x, y, z, timestamp
+     * imu.push(ax, ay, az, now);
+     * const auto x = imu.peek_spans<0U>(); // contiguous x values, oldest first
+     * @endcode
+     *
+     * @tparam Fields The types of the fields of a row.
+     */
+    template <typename... Fields>
+    class soa_ring
+    {
+        static_assert(sizeof...(Fields) > 0U, "soa_ring needs at least one field");
+
+    public:
+        using value_type = std::tuple<Fields...>;
+
+        template <std::size_t I>
+        using field_type = typename std::tuple_element<I, value_type>::type;
+
+        static constexpr std::size_t field_count = sizeof...(Fields);
+
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief The stored values of one field as at most two contiguous views, oldest first.
+         *
+         * @tparam T The type of the field.
+         */
+        template <typename T>
+        struct span_pair
+        {
+            const T* first_data = nullptr;
+            std::size_t first_size = 0U;
+            const T* second_data = nullptr;
+            std::size_t second_size = 0U;
+        };
+
+        soa_ring() = delete;
+        ~soa_ring() = default;
+        soa_ring(const soa_ring& other) = default;
+        soa_ring(soa_ring&& other) noexcept = default;
+        soa_ring& operator=(const soa_ring& other) = default;
+        soa_ring& operator=(soa_ring&& other) noexcept = default;
+
+        /**
+         * @brief Constructs a ring holding up to capacity rows.
+         *
+         * @param capacity The number of rows the ring holds.
+         */
+        explicit soa_ring(std::size_t capacity)
+            : m_columns(std::vector<Fields>(capacity)...)
+            , m_capacity(capacity)
+        {
+        }
+
+        /**
+         * @brief Pushes a row given field by field; a full ring refuses it.
+         *
+         * @param values The fields of the row.
+         * @return true if the row was pushed.
+         */
+        bool push(const Fields&... values)
+        {
+            return write_row(overflow_policy::reject, values...) != write_status::rejected;
+        }
+
+        /**
+         * @brief Pushes a row given field by field, moving the values in; a full ring refuses it.
+         *
+         * @param values The fields of the row.
+         * @return true if the row was pushed.
+         */
+        bool push(Fields&&... values)
+        {
+            return write_row(overflow_policy::reject, std::move(values)...) != write_status::rejected;
+        }
+
+        /**
+         * @brief Pushes a row given as a tuple; a full ring refuses it.
+         *
+         * @param row The row.
+         * @return true if the row was pushed.
+         */
+        bool push(const value_type& row)
+        {
+            return std::apply([this](const Fields&... values) { return push(values...); }, row);
+        }
+
+        /**
+         * @brief Pushes a row given field by field, overwriting the oldest row when the ring is full.
+         *
+         * @param values The fields of the row.
+         * @return true if the oldest row was overwritten.
+         */
+        bool push_overwrite(const Fields&... values)
+        {
+            return write_row(overflow_policy::overwrite, values...) == write_status::overwritten;
+        }
+
+        /**
+         * @brief Pushes a row given as a tuple, overwriting the oldest row when the ring is full.
+         *
+         * @param row The row.
+         * @return true if the oldest row was overwritten.
+         */
+        bool push_overwrite(const value_type& row)
+        {
+            return std::apply([this](const Fields&... values) { return push_overwrite(values...); }, row);
+        }
+
+        /**
+         * @brief Removes the oldest row.
+         */
+        void pop()
+        {
+            static_cast<void>(consume(1U));
+        }
+
+        /**
+         * @brief Retrieves and removes the oldest row using move semantics.
+         *
+         * @return The moved oldest row, or none if the ring is empty.
+         */
+        std::optional<value_type> pop_move()
+        {
+            std::optional<value_type> row;
+            if (!empty())
+            {
+                row.emplace(move_row(m_pop_index, std::index_sequence_for<Fields...> {}));
+                static_cast<void>(consume(1U));
+            }
+            return row;
+        }
+
+        /**
+         * @brief Returns a copy of the oldest row, without removing it.
+         *
+         * @return The oldest row.
+         */
+        [[nodiscard]] value_type front() const
+        {
+            return copy_row(m_pop_index, std::index_sequence_for<Fields...> {});
+        }
+
+        /**
+         * @brief Returns a copy of the newest row.
+         *
+         * @return The newest row.
+         */
+        [[nodiscard]] value_type back() const
+        {
+            return copy_row(m_last_index, std::index_sequence_for<Fields...> {});
+        }
+
+        /**
+         * @brief Accesses one field of a stored row.
+         *
+         * @tparam I The index of the field.
+         * @param index The position of the row, 0 being the oldest.
+         * @return Reference to the field.
+         */
+        template <std::size_t I>
+        [[nodiscard]] field_type<I>& field(std::size_t index)
+        {
+            return std::get<I>(m_columns)[next_step_index(m_pop_index, index)];
+        }
+
+        /**
+         * @brief Accesses one field of a stored row.
+         *
+         * @tparam I The index of the field.
+         * @param index The position of the row, 0 being the oldest.
+         * @return Reference to the field.
+         */
+        template <std::size_t I>
+        [[nodiscard]] const field_type<I>& field(std::size_t index) const
+        {
+            return std::get<I>(m_columns)[next_step_index(m_pop_index, index)];
+        }
+
+        /**
+         * @brief Checks if the ring is empty.
+         *
+         * @return true if no row is stored.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        /**
+         * @brief Checks if the ring is full.
+         *
+         * @return true if capacity() rows are stored.
+         */
+        [[nodiscard]] bool full() const
+        {
+            return m_capacity <= m_size;
+        }
+
+        /**
+         * @brief Drops every row and resets the indices; the storage is kept.
+         */
+        void clear()
+        {
+            m_push_index = 0U;
+            m_pop_index = 0U;
+            m_last_index = 0U;
+            m_size = 0U;
+        }
+
+        /**
+         * @brief Returns the number of stored rows.
+         *
+         * @return The row count.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the number of rows the ring holds.
+         *
+         * @return The capacity.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Appends a block of rows given as one array per field, with at most two bulk copies per field
+         *        (memcpy for trivially copyable fields).
+         *
+         * Stops when the ring is full; existing rows are never overwritten.
+         *
+         * @param count The number of rows in each array.
+         * @param data One array per field, in field order.
+         * @return The number of rows appended.
+         */
+        std::size_t push_span(std::size_t count, const Fields*... data)
+        {
+            const std::size_t to_push = (std::min)(count, m_capacity - m_size);
+            if (0U == to_push)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_push, m_capacity - m_push_index);
+            push_columns(std::index_sequence_for<Fields...> {}, first_part, to_push, data...);
+
+            m_last_index = next_step_index(m_push_index, to_push - 1U);
+            m_push_index = next_step_index(m_push_index, to_push);
+            m_size += to_push;
+
+            return to_push;
+        }
+
+        /**
+         * @brief Removes the oldest rows into one array per field, with at most two bulk moves per field
+         *        (memcpy for trivially copyable fields).
+         *
+         * @param count The number of rows each array can hold.
+         * @param destination One array per field, in field order.
+         * @return The number of rows removed.
+         */
+        std::size_t pop_span(std::size_t count, Fields*... destination)
+        {
+            const std::size_t to_pop = (std::min)(count, m_size);
+            if (0U == to_pop)
+            {
+                return 0U;
+            }
+
+            const std::size_t first_part = (std::min)(to_pop, m_capacity - m_pop_index);
+            pop_columns(std::index_sequence_for<Fields...> {}, first_part, to_pop, destination...);
+
+            return consume(to_pop);
+        }
+
+        /**
+         * @brief Exposes the stored values of one field in place as at most two contiguous views.
+         *
+         * Pair it with consume() to process a block of rows, e.g. filter one channel, then drop the rows.
+         *
+         * @tparam I The index of the field.
+         * @return The views, oldest values first.
+         */
+        template <std::size_t I>
+        [[nodiscard]] span_pair<field_type<I>> peek_spans() const
+        {
+            span_pair<field_type<I>> spans;
+            if (0U == m_size)
+            {
+                return spans;
+            }
+
+            const auto& column = std::get<I>(m_columns);
+            spans.first_data = column.data() + m_pop_index; // NOLINT pointer arithmetic
+            spans.first_size = (std::min)(m_size, m_capacity - m_pop_index);
+            if (spans.first_size < m_size)
+            {
+                spans.second_data = column.data();
+                spans.second_size = m_size - spans.first_size;
+            }
+            return spans;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Gets the stored values of one field as a single span, available once the rows do not wrap.
+         *
+         * @tparam I The index of the field.
+         * @return The values, oldest first, or an empty span if the rows wrap (see linearize()).
+         */
+        template <std::size_t I>
+        [[nodiscard]] std::span<const field_type<I>> field_span() const
+        {
+            const auto spans = peek_spans<I>();
+            if (0U != spans.second_size)
+            {
+                return {};
+            }
+            return std::span<const field_type<I>>(spans.first_data, spans.first_size);
+        }
+#endif
+
+        /**
+         * @brief Rotates every field ring so that the oldest row sits in slot 0: each field is then one
+         *        contiguous array of size() values.
+         *
+         * Costs one in-place rotation per field when the rows wrap, nothing otherwise.
+         */
+        void linearize()
+        {
+            if ((0U != m_pop_index) && (0U != m_size))
+            {
+                rotate_columns(std::index_sequence_for<Fields...> {});
+            }
+            m_pop_index = 0U;
+            m_last_index = (0U == m_size) ? 0U : (m_size - 1U);
+            m_push_index = (m_size < m_capacity) ? m_size : 0U;
+        }
+
+        /**
+         * @brief Drops the oldest rows, typically after processing them through peek_spans().
+         *
+         * @param count The number of rows to drop.
+         * @return The number of rows dropped, at most size().
+         */
+        std::size_t consume(std::size_t count)
+        {
+            const std::size_t to_drop = (std::min)(count, m_size);
+            if (0U != to_drop)
+            {
+                m_pop_index = next_step_index(m_pop_index, to_drop);
+                m_size -= to_drop;
+            }
+            return to_drop;
+        }
+
+    private:
+        enum class overflow_policy : unsigned char
+        {
+            reject,
+            overwrite
+        };
+
+        enum class write_status : unsigned char
+        {
+            rejected,
+            inserted,
+            overwritten
+        };
+
+        template <typename... Values>
+        write_status write_row(overflow_policy policy, Values&&... values)
+        {
+            const bool is_full = (m_size >= m_capacity);
+            if ((0U == m_capacity) || (is_full && (policy == overflow_policy::reject)))
+            {
+                return write_status::rejected;
+            }
+
+            if (is_full)
+            {
+                m_pop_index = next_index(m_pop_index);
+            }
+            else
+            {
+                ++m_size;
+            }
+
+            store_row(std::index_sequence_for<Fields...> {}, std::forward<Values>(values)...);
+            m_last_index = m_push_index;
+            m_push_index = next_index(m_push_index);
+
+            return is_full ? write_status::overwritten : write_status::inserted;
+        }
+
+        template <std::size_t... I, typename... Values>
+        void store_row(std::index_sequence<I...> /*fields*/, Values&&... values)
+        {
+            ((std::get<I>(m_columns)[m_push_index] = std::forward<Values>(values)), ...);
+        }
+
+        template <std::size_t... I>
+        [[nodiscard]] value_type copy_row(std::size_t slot, std::index_sequence<I...> /*fields*/) const
+        {
+            return value_type(std::get<I>(m_columns)[slot]...);
+        }
+
+        template <std::size_t... I>
+        value_type move_row(std::size_t slot, std::index_sequence<I...> /*fields*/)
+        {
+            return value_type(std::move(std::get<I>(m_columns)[slot])...);
+        }
+
+        template <std::size_t... I>
+        void push_columns(std::index_sequence<I...> /*fields*/, std::size_t first_part, std::size_t to_push,
+            const Fields*... data)
+        {
+            (copy_elements(data, first_part, std::get<I>(m_columns).data() + m_push_index), // NOLINT pointer arithmetic
+                ...);
+            (copy_elements(data + first_part, to_push - first_part, std::get<I>(m_columns).data()), // NOLINT
+                ...);
+        }
+
+        template <std::size_t... I>
+        void pop_columns(
+            std::index_sequence<I...> /*fields*/, std::size_t first_part, std::size_t to_pop, Fields*... destination)
+        {
+            (move_elements(std::get<I>(m_columns).data() + m_pop_index, first_part, destination), // NOLINT
+                ...);
+            (move_elements(std::get<I>(m_columns).data(), to_pop - first_part, destination + first_part), // NOLINT
+                ...);
+        }
+
+        template <std::size_t... I>
+        void rotate_columns(std::index_sequence<I...> /*fields*/)
+        {
+            (std::rotate(std::get<I>(m_columns).begin(),
+                 std::get<I>(m_columns).begin() + static_cast<std::ptrdiff_t>(m_pop_index),
+                 std::get<I>(m_columns).end()),
+                ...);
+        }
+
+        /**
+         * @brief Copies a block of values, with memcpy when T is trivially copyable.
+         */
+        template <typename T>
+        static void copy_elements(const T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::copy(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
+        /**
+         * @brief Moves a block of values, with memcpy when T is trivially copyable.
+         */
+        template <typename T>
+        static void move_elements(T* source, std::size_t count, T* destination)
+        {
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (0U != count)
+                {
+                    std::memcpy(destination, source, count * sizeof(T));
+                }
+            }
+            else
+            {
+                std::move(source, source + count, destination); // NOLINT pointer arithmetic
+            }
+        }
+
+        [[nodiscard]] std::size_t next_index(std::size_t index) const
+        {
+            const std::size_t next = index + 1U;
+            return (next < m_capacity) ? next : 0U;
+        }
+
+        [[nodiscard]] std::size_t next_step_index(std::size_t index, std::size_t step) const
+        {
+            const std::size_t next = index + step;
+            if (next < m_capacity)
+            {
+                return next;
+            }
+            return ((next - m_capacity) < m_capacity) ? (next - m_capacity) : (next % m_capacity);
+        }
+
+        std::tuple<std::vector<Fields>...> m_columns;
+        std::size_t m_push_index = 0U;
+        std::size_t m_pop_index = 0U;
+        std::size_t m_last_index = 0U;
+        std::size_t m_size = 0U;
+        std::size_t m_capacity = 0U;
+    };
+}
+
+#endif // SOA_RING_HPP_
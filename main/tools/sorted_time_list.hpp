@@ -0,0 +1,340 @@
+/**
+ * @file sorted_time_list.hpp
+ * @brief Chronological timestamp/value container kept sorted in a ring, for in-order iteration.
+ *
+ * This file defines tools::sorted_time_list, a non-thread-safe alternative to tools::time_list that keeps its
+ * <timestamp, value> pairs sorted in a double-ended ring. Mostly-monotonic timestamps append in O(1), and the
+ * history can be walked in order or by time window without copying it.
+ *
+ * Supported timestamp types:
+ * - std::chrono::time_point<Clock, Duration>
+ * - integral types (signed/unsigned)
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SORTED_TIME_LIST_HPP_)
+#define SORTED_TIME_LIST_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <concepts>
+#endif
+
+#include "tools/time_list.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Non-thread-safe chronological list kept sorted in a std::deque ring.
+     *
+     * Same interface as tools::time_list (earliest entry at the top), plus in-order visits:
+     * - a push at or after the latest timestamp is an O(1) append, an out-of-order push a binary search plus a
+     *   shift of the later entries, so the container suits sample histories with mostly-monotonic timestamps;
+     * - entries of equal timestamp keep their insertion order;
+     * - visit_range() walks a time window in place and pop_until() drains the head in one batch;
+     * - snapshot_sorted() is a single linear copy.
+     *
+     * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
+     * @tparam TValue Value type.
+     */
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    template <typename TTimestamp, typename TValue>
+        requires detail::is_valid_timestamp<TTimestamp>::value
+    class sorted_time_list
+    {
+#else
+    template <typename TTimestamp, typename TValue>
+    class sorted_time_list
+    {
+        static_assert(detail::is_valid_timestamp<TTimestamp>::value,
+            "TTimestamp must be std::chrono::time_point<...> or an integral type");
+#endif
+
+    public:
+        using timestamp_type = TTimestamp;
+        using value_type = TValue;
+        using entry_type = std::pair<timestamp_type, value_type>;
+        using container_type = std::deque<entry_type>;
+
+        /**
+         * @brief Push an entry by copy.
+         *
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        void push(const timestamp_type& timestamp_value, const value_type& payload_value)
+        {
+            insert(timestamp_value, payload_value);
+        }
+
+        /**
+         * @brief Push an entry by move.
+         *
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        void push(timestamp_type&& timestamp_value, value_type&& payload_value)
+        {
+            insert(std::move(timestamp_value), std::move(payload_value));
+        }
+
+        /**
+         * @brief Push an entry with forwarding support.
+         *
+         * @tparam TT Deduce-able timestamp input type.
+         * @tparam TV Deduce-able value input type.
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        template <typename TT, typename TV>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::constructible_from<timestamp_type, TT> && std::constructible_from<value_type, TV>
+#endif
+        auto push(TT&& timestamp_value, TV&& payload_value)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<timestamp_type, TT>::value
+                    && std::is_constructible<value_type, TV>::value,
+                void>::type
+#endif
+        {
+            insert(timestamp_type(std::forward<TT>(timestamp_value)), std::forward<TV>(payload_value));
+        }
+
+        /**
+         * @brief Emplace a value with explicit timestamp.
+         *
+         * @tparam TArgs Value constructor argument types.
+         * @param timestamp_value Timestamp associated with value.
+         * @param value_args Arguments forwarded to value_type constructor.
+         */
+        template <typename... TArgs>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::constructible_from<value_type, TArgs...>
+#endif
+        auto emplace(const timestamp_type& timestamp_value, TArgs&&... value_args)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<value_type, TArgs...>::value, void>::type
+#endif
+        {
+            insert(timestamp_value, value_type(std::forward<TArgs>(value_args)...));
+        }
+
+        /**
+         * @brief Access the earliest entry.
+         *
+         * @return Earliest entry when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<entry_type> top() const
+        {
+            if (m_entries.empty())
+            {
+                return std::nullopt;
+            }
+            return m_entries.front();
+        }
+
+        /**
+         * @brief Remove the earliest entry if present.
+         */
+        void pop()
+        {
+            if (!m_entries.empty())
+            {
+                m_entries.pop_front();
+            }
+        }
+
+        /**
+         * @brief Fetch and remove the earliest entry.
+         *
+         * @return Earliest entry when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<entry_type> top_pop()
+        {
+            if (m_entries.empty())
+            {
+                return std::nullopt;
+            }
+
+            entry_type first_entry = std::move(m_entries.front());
+            m_entries.pop_front();
+            return first_entry;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp, earliest first.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @param consumer Callable invoked with each removed entry (as an rvalue), in chronological order.
+         * @return Number of removed entries.
+         */
+        template <typename TConsumer>
+        std::size_t pop_until(const timestamp_type& timestamp_value, TConsumer&& consumer)
+        {
+            std::size_t removed = 0U;
+
+            while (!m_entries.empty() && !(timestamp_value < m_entries.front().first))
+            {
+                consumer(std::move(m_entries.front()));
+                m_entries.pop_front();
+                ++removed;
+            }
+
+            return removed;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @return Number of removed entries.
+         */
+        std::size_t pop_until(const timestamp_type& timestamp_value)
+        {
+            const auto last = upper_bound(timestamp_value);
+            const auto removed = static_cast<std::size_t>(std::distance(m_entries.cbegin(), last));
+            m_entries.erase(m_entries.cbegin(), last);
+            return removed;
+        }
+
+        /**
+         * @brief Visit in chronological order the entries of a time window, without copying them.
+         *
+         * @param from Inclusive lower bound of the visited timestamps.
+         * @param until Exclusive upper bound of the visited timestamps.
+         * @param visitor Callable invoked with each entry as a const reference.
+         * @return Number of visited entries.
+         */
+        template <typename TVisitor>
+        std::size_t visit_range(const timestamp_type& from, const timestamp_type& until, TVisitor&& visitor) const
+        {
+            std::size_t visited = 0U;
+
+            for (auto itr = lower_bound(from); (itr != m_entries.end()) && (itr->first < until); ++itr)
+            {
+                visitor(*itr);
+                ++visited;
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Visit every entry in chronological order, without copying them.
+         *
+         * @param visitor Callable invoked with each entry as a const reference.
+         */
+        template <typename TVisitor>
+        void for_each(TVisitor&& visitor) const
+        {
+            for (const auto& entry : m_entries)
+            {
+                visitor(entry);
+            }
+        }
+
+        /**
+         * @brief Check whether the list is empty.
+         * @return True when empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return m_entries.empty();
+        }
+
+        /**
+         * @brief Get the number of entries.
+         * @return Number of stored entries.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+        /**
+         * @brief Remove all entries.
+         */
+        void clear()
+        {
+            m_entries.clear();
+        }
+
+        /**
+         * @brief Return a chronological snapshot (earliest to latest).
+         *
+         * @return Vector copy sorted by timestamp ascending.
+         */
+        [[nodiscard]] std::vector<entry_type> snapshot_sorted() const
+        {
+            return std::vector<entry_type>(m_entries.cbegin(), m_entries.cend());
+        }
+
+    private:
+        template <typename TT, typename TV>
+        void insert(TT&& timestamp_value, TV&& payload_value)
+        {
+            if (m_entries.empty() || !(timestamp_value < m_entries.back().first))
+            {
+                // monotonic fast path
+                m_entries.emplace_back(std::forward<TT>(timestamp_value), std::forward<TV>(payload_value));
+                return;
+            }
+
+            const auto position = upper_bound(timestamp_value);
+            m_entries.emplace(position, std::forward<TT>(timestamp_value), std::forward<TV>(payload_value));
+        }
+
+        [[nodiscard]] typename container_type::const_iterator lower_bound(const timestamp_type& timestamp_value) const
+        {
+            return std::lower_bound(m_entries.cbegin(), m_entries.cend(), timestamp_value,
+                [](const entry_type& entry, const timestamp_type& value) { return entry.first < value; });
+        }
+
+        [[nodiscard]] typename container_type::const_iterator upper_bound(const timestamp_type& timestamp_value) const
+        {
+            return std::upper_bound(m_entries.cbegin(), m_entries.cend(), timestamp_value,
+                [](const timestamp_type& value, const entry_type& entry) { return value < entry.first; });
+        }
+
+        container_type m_entries;
+    };
+
+} // namespace tools
+
+#endif // SORTED_TIME_LIST_HPP_
@@ -35,20 +35,30 @@
 //-----------------------------------------------------------------------------//
 
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
 #include "tools/base_task.hpp"
+#include "tools/data_task_queue.hpp"
+#include "tools/light_event.hpp"
+#include "tools/linux/linux_realtime.hpp"
 #include "tools/platform_detection.hpp"
 #include "tools/platform_helpers.hpp"
 #include "tools/sync_object.hpp"
 #include "tools/sync_ring_vector.hpp"
+#include "tools/trace_ring.hpp"
 
 namespace tools
 {
@@ -60,8 +70,10 @@ namespace tools
      *
      * @tparam Context The type of the context object.
      * @tparam DataType The type of the data to be processed.
+     * @tparam QueuePolicy data_task_default_queue (mutex protected, any number of producers) or
+     *                     data_task_spsc_queue<Pow2> (lock-free, single producer).
      */
-    template <typename Context, typename DataType>
+    template <typename Context, typename DataType, typename QueuePolicy = data_task_default_queue>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
         requires std::is_standard_layout_v<DataType> && std::is_trivial_v<DataType>
 #endif
@@ -95,6 +107,21 @@ namespace tools
         using data_call_back = std::function<void(
             const std::shared_ptr<Context>& context, const DataType& data, const std::string& task_name)>;
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Alias for a callback function that processes a batch of data.
+         *
+         * The batch holds every item drained from the queue under a single lock (up to the configured maximum
+         * batch size). The span is only valid during the call.
+         *
+         * @param context A shared pointer to the Context object.
+         * @param batch The data to be processed, oldest first.
+         * @param task_name The name of the task associated with this callback.
+         */
+        using batch_call_back = std::function<void(
+            const std::shared_ptr<Context>& context, std::span<const DataType> batch, const std::string& task_name)>;
+#endif
+
         /**
          * @brief Constructs a data_task object.
          *
@@ -112,22 +139,75 @@ namespace tools
             const std::shared_ptr<Context>& context, std::size_t data_queue_depth, const std::string& task_name,
             std::size_t stack_size, int cpu_affinity, int priority,
             const std::chrono::duration<std::uint64_t, std::micro>& data_timeout)
+            : data_task(std::move(startup_routine), std::move(process_routine), context, data_queue_depth, task_name,
+                  stack_size, cpu_affinity, priority, data_timeout, task_sched_policy {})
+        {
+        }
+
+        /**
+         * @brief Constructs a data_task object whose thread switches to a real-time scheduling policy.
+         *
+         * The thread applies the policy before the startup routine; sched_policy_applied() tells whether the
+         * system accepted it.
+         *
+         * @param startup_routine The routine to be called during startup.
+         * @param process_routine The routine to process data.
+         * @param context Shared pointer to the context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The stack size for the task.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param sched_policy The SCHED_FIFO, SCHED_RR or SCHED_DEADLINE policy of the thread.
+         */
+        data_task(call_back&& startup_routine, data_call_back&& process_routine,
+            const std::shared_ptr<Context>& context, std::size_t data_queue_depth, const std::string& task_name,
+            std::size_t stack_size, int cpu_affinity, int priority,
+            const std::chrono::duration<std::uint64_t, std::micro>& data_timeout, const task_sched_policy& sched_policy)
             : base_task(task_name, stack_size, cpu_affinity, priority)
             , m_startup_routine(std::move(startup_routine))
             , m_process_routine(std::move(process_routine))
             , m_data_queue(data_queue_depth)
             , m_context(context)
             , m_data_timeout(data_timeout)
+            , m_sched_policy(sched_policy)
         {
             m_task = std::make_unique<std::thread>(
                 [this]()
                 {
                     set_current_thread_params(this->task_name(), this->cpu_affinity(), this->priority());
+                    m_sched_policy_applied.store(apply_sched_policy(m_sched_policy, this->stack_size()));
 
                     run_loop();
                 });
         }
 
+        /**
+         * @brief Constructor for a data_task running in caller-provided task storage.
+         *
+         * The thread keeps its own stack, so only the stack size of storage is used; the buffers serve the
+         * FreeRTOS build.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param process_routine The process routine callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         */
+        data_task(call_back&& startup_routine, data_call_back&& process_routine,
+            const std::shared_ptr<Context>& context, std::size_t data_queue_depth, const std::string& task_name,
+            const task_storage& storage, int cpu_affinity, int priority,
+            const std::chrono::duration<std::uint64_t, std::micro>& data_timeout)
+            : data_task(std::move(startup_routine), std::move(process_routine), context, data_queue_depth, task_name,
+                  storage.stack_size, cpu_affinity, priority, data_timeout)
+        {
+        }
+
         /**
          * @brief Constructs a data_task object using perfect forwarding.
          *
@@ -162,6 +242,7 @@ namespace tools
                 [this]()
                 {
                     set_current_thread_params(this->task_name(), this->cpu_affinity(), this->priority());
+                    m_sched_policy_applied.store(apply_sched_policy(m_sched_policy, this->stack_size()));
 
                     run_loop();
                 });
@@ -215,17 +296,143 @@ namespace tools
         {
         }
 
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Constructs a data_task object processing data in batches.
+         *
+         * @param startup_routine The routine to be called during startup.
+         * @param batch_routine The routine to process a batch of data.
+         * @param context Shared pointer to the context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The stack size for the task.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         * @param batch_linger How long to wait for more data to fill a partial batch in us (0 to flush at once).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, std::size_t stack_size, int cpu_affinity,
+            int priority, const std::chrono::duration<std::uint64_t, std::micro>& data_timeout,
+            std::size_t max_batch_size, const std::chrono::duration<std::uint64_t, std::micro>& batch_linger)
+            : base_task(task_name, stack_size, cpu_affinity, priority)
+            , m_startup_routine(std::move(startup_routine))
+            , m_batch_routine(std::move(batch_routine))
+            , m_batch_buffer(std::max<std::size_t>(max_batch_size, 1U))
+            , m_batch_linger(batch_linger)
+            , m_data_queue(data_queue_depth)
+            , m_context(context)
+            , m_data_timeout(data_timeout)
+        {
+            m_task = std::make_unique<std::thread>(
+                [this]()
+                {
+                    set_current_thread_params(this->task_name(), this->cpu_affinity(), this->priority());
+                    m_sched_policy_applied.store(apply_sched_policy(m_sched_policy, this->stack_size()));
+
+                    run_loop();
+                });
+        }
+
+        /**
+         * @brief Constructor for a data_task processing data in batches, running in caller-provided task storage.
+         *
+         * The thread keeps its own stack, so only the stack size of storage is used; the buffers serve the
+         * FreeRTOS build.
+         *
+         * @param startup_routine The startup routine callback function.
+         * @param batch_routine The batch processing callback function.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         * @param data_timeout The timeout duration for data waiting in us.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         * @param batch_linger How long to wait for more data to fill a partial batch in us (0 to flush at once).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, const task_storage& storage, int cpu_affinity,
+            int priority, const std::chrono::duration<std::uint64_t, std::micro>& data_timeout,
+            std::size_t max_batch_size, const std::chrono::duration<std::uint64_t, std::micro>& batch_linger)
+            : data_task(std::move(startup_routine), std::move(batch_routine), context, data_queue_depth, task_name,
+                  storage.stack_size, cpu_affinity, priority, data_timeout, max_batch_size, batch_linger)
+        {
+        }
+
+        /**
+         * @brief Constructs a data_task object processing data in batches, with default priority, default cpu
+         * affinity and no linger time.
+         *
+         * @param startup_routine The callback function to be executed during startup.
+         * @param batch_routine The callback function to process a batch of data.
+         * @param context Shared pointer to the Context object.
+         * @param data_queue_depth The depth of the data queue.
+         * @param task_name The name of the task.
+         * @param stack_size The size of the stack for the task.
+         * @param max_batch_size The maximum number of items passed to one batch_routine call (at least 1).
+         */
+        data_task(call_back&& startup_routine, batch_call_back&& batch_routine, const std::shared_ptr<Context>& context,
+            std::size_t data_queue_depth, const std::string& task_name, std::size_t stack_size,
+            std::size_t max_batch_size)
+            : data_task(std::move(startup_routine), std::move(batch_routine), context, data_queue_depth, task_name,
+                  stack_size, base_task::run_on_all_cores, base_task::default_priority,
+                  // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
+                  (std::chrono::duration<std::uint64_t, std::micro>::max)(), max_batch_size,
+                  std::chrono::duration<std::uint64_t, std::micro>::zero())
+        {
+        }
+#endif
+
         /**
          * @brief Destructor for the data_task class.
          *
-         * This destructor sets the m_stop_task flag to true, signals the m_data_sync condition,
-         * and waits for the task thread to complete by calling join on m_task.
+         * This destructor stops the task if stop() was not called, processing all the queued data first, and
+         * waits for the task thread to complete by calling join on m_task.
          */
         ~data_task() override
         {
+            static_cast<void>(stop(task_drain_policy::drain_all));
+        }
+
+        /**
+         * @brief Stops the task and hands back the data it did not process.
+         *
+         * The task finishes the data in progress, then drains the queue according to the policy and exits.
+         * Submissions are rejected from then on. Calling stop() again returns an empty vector.
+         *
+         * @param policy Whether the queued data is processed (all, or until the timeout) or left unprocessed.
+         * @param drain_timeout How long the task may drain with the drain_deadline policy in us.
+         * @return The unprocessed data, oldest first, to be resubmitted elsewhere or dropped.
+         */
+        std::vector<DataType> stop(task_drain_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& drain_timeout
+            = std::chrono::duration<std::uint64_t, std::micro>::zero())
+        {
+            std::vector<DataType> unprocessed;
+
+            if (!m_task || !m_task->joinable())
+            {
+                return unprocessed;
+            }
+
+            m_drain_policy = policy;
+            m_drain_timeout = drain_timeout;
+            m_drain_start = std::chrono::steady_clock::now();
+            // publishes the drain settings to the task
             m_stop_task.store(true);
             m_data_sync.signal();
+            m_space_sync.signal();
             m_task->join();
+
+            for (auto data = m_data_queue.front_pop(); data.has_value(); data = m_data_queue.front_pop())
+            {
+                unprocessed.push_back(data.value());
+            }
+
+            return unprocessed;
         }
 
         // note: native handle allows specific OS calls like setting scheduling policy or setting priority
@@ -242,18 +449,49 @@ namespace tools
             return reinterpret_cast<void*>(m_task->native_handle()); // NOLINT native handler wrapping as a void*
         }
 
+        /**
+         * @brief Tells whether the thread runs with the scheduling policy given at construction.
+         *
+         * Valid once the startup routine was called, the thread applying the policy just before it.
+         *
+         * @return True if the policy was applied (always true without real-time policy).
+         */
+        [[nodiscard]] bool sched_policy_applied() const
+        {
+            return m_sched_policy_applied.load();
+        }
+
         /**
          * @brief Submits data to the queue and signals the data synchronization.
          *
          * This method pushes the provided data into the data queue and then signals
          * the data synchronization mechanism to indicate that new data is available.
+         * If the queue is full, the overflow policy decides what happens (see set_overflow_policy()).
          *
          * @param data The data to be submitted to the queue.
+         * @return true if the data has been queued, false if it has been dropped or rejected.
          */
-        void submit(const DataType& data)
+        bool submit(const DataType& data)
         {
-            m_data_queue.push(data);
-            m_data_sync.signal();
+            if (m_stop_task.load(std::memory_order_relaxed))
+            {
+                // stopping: nobody would process the data
+                return false;
+            }
+
+            bool queued = m_data_queue.push(data);
+
+            if (!queued)
+            {
+                queued = on_queue_full(data);
+            }
+
+            if (queued)
+            {
+                m_data_sync.signal();
+            }
+
+            return queued;
         }
 
         /**
@@ -264,11 +502,106 @@ namespace tools
          * back to a standard call to submit the data.
          *
          * @param data The data to be submitted.
+         * @return true if the data has been queued, false if it has been dropped or rejected.
          */
-        void isr_submit(const DataType& data)
+        bool isr_submit(const DataType& data)
         {
             // no calls from ISRs in standard C++ platform, fallback to standard call
-            submit(data);
+            return submit(data);
+        }
+
+        /**
+         * @brief Selects what submit() does when the data queue is full (drop_newest by default).
+         *
+         * @param policy The overflow policy.
+         * @param block_timeout How long a producer may wait for room with the block policy in us (max for ever).
+         */
+        void set_overflow_policy(data_task_overflow_policy policy,
+            // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
+            const std::chrono::duration<std::uint64_t, std::micro>& block_timeout
+            = (std::chrono::duration<std::uint64_t, std::micro>::max)())
+        {
+            m_block_timeout_us.store(block_timeout.count(), std::memory_order_relaxed);
+            m_overflow_policy.store(policy, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the current overflow policy.
+         *
+         * @return The overflow policy applied when the data queue is full.
+         */
+        [[nodiscard]] data_task_overflow_policy overflow_policy() const
+        {
+            return m_overflow_policy.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the drop/reject/blocking counters, so that producers can adapt their rate.
+         *
+         * @return A snapshot of the overflow counters.
+         */
+        [[nodiscard]] data_task_overflow_stats overflow_stats() const
+        {
+            return m_overflow_counters.snapshot();
+        }
+
+        /**
+         * @brief Resets the overflow counters to zero.
+         */
+        void reset_overflow_stats()
+        {
+            m_overflow_counters.reset();
+        }
+
+        /**
+         * @brief Makes the task poll for data during a spin window before blocking (0, the default, blocks at once).
+         *
+         * Data submitted within the window is picked up with no wake-up and no context switch, at the price of a
+         * busy core: meant for a task owning a dedicated core. Ignored on single-core targets.
+         *
+         * @param spin_window How long the task spins, with a CPU pause hint, before waiting for a signal in us.
+         */
+        void set_busy_poll(const std::chrono::duration<std::uint64_t, std::micro>& spin_window)
+        {
+            m_busy_poll_us.store((cpu_core_count() > 1U) ? spin_window.count() : 0U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves the busy-poll spin window.
+         *
+         * @return The spin window in us, 0 when the task blocks at once.
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> busy_poll() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_busy_poll_us.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Retrieves how many waits ended while spinning or after parking, and the time spent spinning.
+         *
+         * @return A snapshot of the busy-poll counters.
+         */
+        [[nodiscard]] data_task_busy_poll_stats busy_poll_stats() const
+        {
+            return m_busy_poll_counters.snapshot();
+        }
+
+        /**
+         * @brief Resets the busy-poll counters to zero.
+         */
+        void reset_busy_poll_stats()
+        {
+            m_busy_poll_counters.reset();
+        }
+
+        /**
+         * @brief Retrieves the number of data items waiting in the queue.
+         *
+         * @return The queue depth, a snapshot taken from any thread.
+         */
+        [[nodiscard]] std::size_t queue_depth() const
+        {
+            return m_data_queue.size();
         }
 
     private:
@@ -284,38 +617,305 @@ namespace tools
             m_startup_routine(m_context, this->task_name());
 
             while (!m_stop_task.load())
+            {
+                // data picked up while spinning needs no wake-up
+                if (!spin_for_data())
+                {
+                    // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
+                    if ((std::chrono::duration<std::uint64_t, std::micro>::max)() == m_data_timeout)
+                    {
+                        // wait indefinitely for data
+                        m_data_sync.wait_for_signal();
+                    }
+                    else
+                    {
+                        // wait for data with timeout
+                        m_data_sync.wait_for_signal(m_data_timeout);
+                    }
+                }
+                TOOLS_TRACE(task_switch, "data_task::resume", this, 0U);
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+                if (m_batch_routine)
+                {
+                    TOOLS_TRACE(process_begin, "data_task::process_batches", this, 0U);
+                    process_batches();
+                    TOOLS_TRACE(process_end, "data_task::process_batches", this, 0U);
+                    continue;
+                }
+#endif
+
+                process_queued();
+            } // run loop
+
+            // submissions that raced with the stop request
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            if (m_batch_routine)
+            {
+                process_batches();
+                return;
+            }
+#endif
+            process_queued();
+        }
+
+        /**
+         * @brief Processes the queued data one by one until the queue is empty or the drain policy says stop.
+         */
+        void process_queued()
+        {
+            while (may_process())
+            {
+                auto data = m_data_queue.front_pop();
+
+                if (!data.has_value())
+                {
+                    break;
+                }
+
+                TOOLS_TRACE(dequeue, "data_task::dequeue", this, 0U);
+                notify_space();
+                TOOLS_TRACE(process_begin, "data_task::process", this, 0U);
+                m_process_routine(m_context, data.value(), this->task_name());
+                TOOLS_TRACE(process_end, "data_task::process", this, 0U);
+            }
+        }
+
+        /**
+         * @brief Tells whether queued data may still be processed, according to the drain policy once stopping.
+         *
+         * @return true if the task runs, or drains and the drain policy allows more.
+         */
+        [[nodiscard]] bool may_process() const
+        {
+            if (!m_stop_task.load())
+            {
+                return true;
+            }
+
+            switch (m_drain_policy)
+            {
+                case task_drain_policy::drain_all:
+                    return true;
+                case task_drain_policy::drain_deadline:
+                    return (std::chrono::steady_clock::now() - m_drain_start) < m_drain_timeout;
+                case task_drain_policy::discard:
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * @brief Polls the data signal during the busy-poll spin window.
+         *
+         * @return true if data was signaled within the window (the signal is consumed), false if the task has to
+         *         block.
+         */
+        bool spin_for_data()
+        {
+            const std::uint64_t spin_window_us = m_busy_poll_us.load(std::memory_order_relaxed);
+
+            if (0U == spin_window_us)
+            {
+                return false;
+            }
+
+            const auto start_time = std::chrono::steady_clock::now();
+            std::uint64_t spin_us = 0U;
+            bool found_data = false;
+
+            while (!found_data && (spin_us < spin_window_us))
+            {
+                // read the state first, only a signaled event is worth the exchange
+                found_data = m_data_sync.is_signaled() && m_data_sync.try_wait_for_signal();
+
+                if (!found_data)
+                {
+                    cpu_relax();
+                    spin_us = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start_time)
+                            .count());
+                }
+            }
+
+            m_busy_poll_counters.on_spin(found_data, spin_us);
+            return found_data;
+        }
+
+        /**
+         * @brief Applies the overflow policy to data that did not fit in the queue.
+         *
+         * @param data The submitted data.
+         * @return true if the data has been queued after all.
+         */
+        bool on_queue_full(const DataType& data)
+        {
+            const auto policy = m_overflow_policy.load(std::memory_order_relaxed);
+
+            if (data_task_overflow_policy::block == policy)
+            {
+                return push_blocking(data);
+            }
+
+            if constexpr (!QueuePolicy::lock_free)
+            {
+                // only the consumer may pop a lock-free SPSC queue, drop_oldest falls back to drop_newest there
+                if (data_task_overflow_policy::drop_oldest == policy)
+                {
+                    if (m_data_queue.push_overwrite(data))
+                    {
+                        m_overflow_counters.on_dropped_oldest();
+                    }
+                    return true;
+                }
+            }
+
+            if (data_task_overflow_policy::fail == policy)
+            {
+                m_overflow_counters.on_rejected();
+            }
+            else
+            {
+                m_overflow_counters.on_dropped_newest();
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Waits for the task to free some room in the queue, up to the block timeout.
+         *
+         * @param data The submitted data.
+         * @return true if the data has been queued before the timeout expired.
+         */
+        bool push_blocking(const DataType& data)
+        {
+            using duration_us = std::chrono::duration<std::uint64_t, std::micro>;
+            const auto timeout = duration_us(m_block_timeout_us.load(std::memory_order_relaxed));
+            const auto start_time = std::chrono::steady_clock::now();
+            auto elapsed = duration_us::zero();
+            bool queued = false;
+
+            while (!queued && !m_stop_task.load() && (elapsed < timeout))
             {
                 // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
-                if ((std::chrono::duration<std::uint64_t, std::micro>::max)() == m_data_timeout)
+                if ((duration_us::max)() == timeout)
                 {
-                    // wait indefinitely for data
-                    m_data_sync.wait_for_signal();
+                    m_space_sync.wait_for_signal();
                 }
                 else
                 {
-                    // wait for data with timeout
-                    m_data_sync.wait_for_signal(m_data_timeout);
+                    m_space_sync.wait_for_signal(timeout - elapsed);
+                }
+
+                queued = m_data_queue.push(data);
+                elapsed = std::chrono::duration_cast<duration_us>(std::chrono::steady_clock::now() - start_time);
+            }
+
+            m_overflow_counters.on_blocked(elapsed.count());
+
+            if (!queued)
+            {
+                m_overflow_counters.on_rejected();
+            }
+
+            return queued;
+        }
+
+        /**
+         * @brief Wakes up a producer blocked on a full queue, if the block policy is selected.
+         */
+        void notify_space()
+        {
+            if (data_task_overflow_policy::block == m_overflow_policy.load(std::memory_order_relaxed))
+            {
+                m_space_sync.signal();
+            }
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Drains the queue in batches of at most the configured size and hands them to the batch routine.
+         */
+        void process_batches()
+        {
+            const std::size_t max_batch_size = m_batch_buffer.size();
+
+            while (may_process())
+            {
+                // one lock per batch
+                std::size_t batch_size = m_data_queue.pop_range(m_batch_buffer.begin(), m_batch_buffer.end());
+
+                if (0U == batch_size)
+                {
+                    break;
                 }
+                notify_space();
 
-                while (!m_data_queue.empty())
+                if ((batch_size < max_batch_size) && (m_batch_linger.count() > 0U))
                 {
-                    auto data = m_data_queue.front_pop();
+                    // coalesce: give producers a chance to complete the batch
+                    const auto deadline = std::chrono::steady_clock::now() + m_batch_linger;
 
-                    if (data.has_value())
+                    while ((batch_size < max_batch_size) && !m_stop_task.load())
                     {
-                        m_process_routine(m_context, data.value(), this->task_name());
+                        const auto current_time = std::chrono::steady_clock::now();
+
+                        if (current_time >= deadline)
+                        {
+                            break;
+                        }
+
+                        m_data_sync.wait_for_signal(
+                            std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                                deadline - current_time));
+
+                        const auto offset = static_cast<std::ptrdiff_t>(batch_size);
+                        batch_size += m_data_queue.pop_range(m_batch_buffer.begin() + offset, m_batch_buffer.end());
+                        notify_space();
                     }
                 }
-            } // run loop
+
+                m_batch_routine(
+                    m_context, std::span<const DataType>(m_batch_buffer.data(), batch_size), this->task_name());
+
+                if (batch_size < max_batch_size)
+                {
+                    // queue drained, later submissions signal m_data_sync
+                    break;
+                }
+            }
         }
+#endif
 
         call_back m_startup_routine;
         data_call_back m_process_routine;
-        tools::sync_object m_data_sync;
-        tools::sync_ring_vector<DataType> m_data_queue;
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        batch_call_back m_batch_routine;
+        std::vector<DataType> m_batch_buffer;
+        std::chrono::duration<std::uint64_t, std::micro> m_batch_linger = {};
+#endif
+        tools::light_event m_data_sync;
+        using queue_type =
+            typename detail::data_task_queue_selector<QueuePolicy, DataType, tools::sync_ring_vector<DataType>>::type;
+
+        queue_type m_data_queue;
+        tools::sync_object m_space_sync; // signaled when room is freed, with the block overflow policy
+        std::atomic<data_task_overflow_policy> m_overflow_policy = data_task_overflow_policy::drop_newest;
+        // Parenthesized max avoids Windows max macro expansion if NOMINMAX is missing in a TU.
+        std::atomic<std::uint64_t> m_block_timeout_us = (std::numeric_limits<std::uint64_t>::max)();
+        detail::data_task_overflow_counters m_overflow_counters;
+        std::atomic<std::uint64_t> m_busy_poll_us = 0U;
+        detail::data_task_busy_poll_counters m_busy_poll_counters;
         std::shared_ptr<Context> m_context;
         std::atomic_bool m_stop_task = false;
         std::unique_ptr<std::thread> m_task;
         std::chrono::duration<std::uint64_t, std::micro> m_data_timeout;
+        task_sched_policy m_sched_policy = {};
+        std::atomic_bool m_sched_policy_applied = false;
+        // written by stop() before m_stop_task, read by the task once it sees m_stop_task
+        task_drain_policy m_drain_policy = task_drain_policy::drain_all;
+        std::chrono::duration<std::uint64_t, std::micro> m_drain_timeout = {};
+        std::chrono::steady_clock::time_point m_drain_start = {};
     };
 }
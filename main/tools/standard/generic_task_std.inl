@@ -104,6 +104,25 @@ namespace tools
                 });
         }
 
+        /**
+         * @brief Constructs a generic_task object with caller-provided task storage.
+         *
+         * The thread keeps its own stack, so only the stack size of storage is used; the buffers serve the
+         * FreeRTOS build.
+         *
+         * @param routine The callback function to be executed by the task.
+         * @param context A shared pointer to the Context object associated with the task.
+         * @param task_name The name of the task.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity for the task.
+         * @param priority The priority of the task.
+         */
+        generic_task(call_back&& routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            const task_storage& storage, int cpu_affinity, int priority)
+            : generic_task(std::move(routine), context, task_name, storage.stack_size, cpu_affinity, priority)
+        {
+        }
+
         /**
          * @brief Constructs a generic_task object using perfect forwarding.
          *
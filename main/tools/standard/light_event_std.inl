@@ -0,0 +1,239 @@
+/**
+ * @file light_event_std.inl
+ * @brief Lightweight auto-reset event using standard C++ constructs, with a futex backend on Linux.
+ *
+ * The event keeps its state in an atomic word and only enters the kernel when a waiter is parked: a signal()
+ * nobody waits for is a single atomic exchange. Linux waiters sleep on a futex; other platforms fall back to a
+ * mutex and condition variable that the signaling side only touches when a waiter is registered.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#if defined(__linux__)
+#include "tools/linux/linux_futex.hpp"
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Auto-reset event with the sync_object interface and an uncontended fast path.
+     *
+     * Signals do not accumulate: several signals before a wait are consumed by one wait. Any number of threads
+     * may signal and wait.
+     */
+    class light_event : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        /**
+         * @brief Constructor for the light_event class, initially not signaled.
+         */
+        light_event() = default;
+
+        /**
+         * @brief Destructor for the light_event class, sets the signal and wakes every parked waiter.
+         */
+        ~light_event()
+        {
+            m_state.store(signaled_state, std::memory_order_seq_cst);
+            if (0U != m_waiters.load(std::memory_order_seq_cst))
+            {
+                wake(true);
+            }
+        }
+
+        /**
+         * @brief Signals the event, waking one parked waiter if there is one.
+         */
+        void signal()
+        {
+            // seq_cst pairs the state exchange with the waiter count increment of wait_for_signal()
+            if ((signaled_state != m_state.exchange(signaled_state, std::memory_order_seq_cst))
+                && (0U != m_waiters.load(std::memory_order_seq_cst)))
+            {
+                wake(false);
+            }
+        }
+
+        /**
+         * @brief Signals the event from an ISR context.
+         *
+         * Since standard C++ does not support ISR-specific calls, this function falls back to signal().
+         */
+        void isr_signal()
+        {
+            signal();
+        }
+
+        /**
+         * @brief Checks if the event is signaled.
+         *
+         * @return true if the event is signaled, false otherwise.
+         */
+        [[nodiscard]] bool is_signaled() const
+        {
+            return signaled_state == m_state.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Consumes the signal if it is set, without waiting.
+         *
+         * @return true if the event was signaled (the signal is then cleared), false otherwise.
+         */
+        [[nodiscard]] bool try_wait_for_signal()
+        {
+            std::uint32_t expected = signaled_state;
+            return m_state.compare_exchange_strong(expected, idle_state, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Waits for the signal to be set, then consumes it.
+         */
+        void wait_for_signal()
+        {
+            if (try_wait_for_signal())
+            {
+                return;
+            }
+
+            m_waiters.fetch_add(1U, std::memory_order_seq_cst);
+            while (!try_wait_for_signal())
+            {
+                park(nullptr);
+            }
+            m_waiters.fetch_sub(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Waits for the signal with a specified timeout, and consumes it if it was set.
+         *
+         * @param timeout The maximum duration to wait for the signal, specified as a std::chrono::duration.
+         */
+        void wait_for_signal(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            if (try_wait_for_signal() || (0U == timeout.count()))
+            {
+                return;
+            }
+
+            // each sleep is capped so that huge timeouts (e.g. duration::max) do not overflow the conversions
+            constexpr std::uint64_t max_sleep_us = std::uint64_t { 1U } << 40U;
+            const auto start = std::chrono::steady_clock::now();
+
+            m_waiters.fetch_add(1U, std::memory_order_seq_cst);
+            while (!try_wait_for_signal())
+            {
+                const auto elapsed_us = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                        .count());
+                if (elapsed_us >= timeout.count())
+                {
+                    break;
+                }
+
+                const std::uint64_t remaining_us = timeout.count() - elapsed_us;
+                const std::chrono::microseconds sleep_us(
+                    static_cast<std::int64_t>((remaining_us < max_sleep_us) ? remaining_us : max_sleep_us));
+                park(&sleep_us);
+            }
+            m_waiters.fetch_sub(1U, std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::uint32_t idle_state = 0U;
+        static constexpr std::uint32_t signaled_state = 1U;
+
+        /**
+         * @brief Sleeps until woken while the event is not signaled, or for at most the given duration.
+         */
+        void park(const std::chrono::microseconds* duration)
+        {
+#if defined(__linux__)
+            if (nullptr == duration)
+            {
+                (void)linux_os::futex_wait(m_state, idle_state);
+            }
+            else
+            {
+                const struct timespec spec = linux_os::to_timespec(*duration);
+                (void)linux_os::futex_wait(m_state, idle_state, &spec);
+            }
+#else
+            std::unique_lock<std::mutex> lock(m_mutex);
+            const auto is_set = [this]() { return signaled_state == m_state.load(std::memory_order_seq_cst); };
+            if (nullptr == duration)
+            {
+                m_cond.wait(lock, is_set);
+            }
+            else
+            {
+                (void)m_cond.wait_for(lock, *duration, is_set);
+            }
+#endif
+        }
+
+        /**
+         * @brief Wakes one or all parked waiters.
+         */
+        void wake(bool all)
+        {
+#if defined(__linux__)
+            (void)linux_os::futex_wake(m_state, all ? (std::numeric_limits<int>::max)() : 1);
+#else
+            {
+                // a waiter between its state check and its sleep holds the mutex: the notification cannot be lost
+                std::scoped_lock<std::mutex> guard(m_mutex);
+            }
+            if (all)
+            {
+                m_cond.notify_all();
+            }
+            else
+            {
+                m_cond.notify_one();
+            }
+#endif
+        }
+
+        std::atomic<std::uint32_t> m_state = idle_state;
+        std::atomic<std::uint32_t> m_waiters = 0U;
+#if !defined(__linux__)
+        std::mutex m_mutex;
+        std::condition_variable m_cond;
+#endif
+    };
+}
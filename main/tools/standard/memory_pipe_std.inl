@@ -34,11 +34,13 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <type_traits>
@@ -49,16 +51,22 @@
 #include <span>
 #endif
 
+#include "tools/alloc_hint.hpp"
+#include "tools/expected.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/pipe_error.hpp"
 #include "tools/platform_helpers.hpp"
+#include "tools/shared_payload.hpp"
 #include "tools/sync_object.hpp"
+#include "tools/wait_set.hpp"
 
 namespace tools
 {
     /**
      * @brief A class representing a memory pipe for inter-thread communication.
      *
-     * This class provides a lock-free ring buffer for sending and receiving data between threads.
+     * This class provides a lock-free ring buffer for sending and receiving data between threads. Bytes are
+     * copied in contiguous blocks and blocked senders/receivers wait on sync objects instead of polling.
      * It supports both standard and ISR (Interrupt Service Routine) contexts.
      */
     class memory_pipe : public non_copyable // NOLINT inherits from non copyable/non movable class
@@ -69,6 +77,50 @@ namespace tools
             int dummy;
         };
 
+        /**
+         * @brief Contiguous writable area of the pipe returned by reserve().
+         */
+        struct write_region
+        {
+            std::uint8_t* data = nullptr; ///< First writable byte, nullptr when nothing could be reserved.
+            std::size_t size = 0U;        ///< Number of writable bytes.
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            [[nodiscard]] std::span<std::uint8_t> as_span() const
+            {
+                return std::span<std::uint8_t>(data, size);
+            }
+#endif
+        };
+
+        /**
+         * @brief Readable area of the pipe returned by peek(), split in two parts when it wraps around.
+         */
+        struct read_regions
+        {
+            const std::uint8_t* first = nullptr;  ///< Oldest readable bytes.
+            std::size_t first_size = 0U;          ///< Number of bytes in the first part.
+            const std::uint8_t* second = nullptr; ///< Continuation after the wrap-around point, if any.
+            std::size_t second_size = 0U;         ///< Number of bytes in the second part.
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return first_size + second_size;
+            }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            [[nodiscard]] std::span<const std::uint8_t> first_span() const
+            {
+                return std::span<const std::uint8_t>(first, first_size);
+            }
+
+            [[nodiscard]] std::span<const std::uint8_t> second_span() const
+            {
+                return std::span<const std::uint8_t>(second, second_size);
+            }
+#endif
+        };
+
         memory_pipe() = delete;
         ~memory_pipe() = default;
 
@@ -104,6 +156,21 @@ namespace tools
         {
         }
 
+        /**
+         * @brief Constructs a memory_pipe object using an internal buffer allocated from the memory matching a hint.
+         *
+         * @param buffer_size The size of the buffer.
+         * @param buffer_hint Memory the buffer is allocated from.
+         */
+        memory_pipe(std::size_t buffer_size, alloc_hint buffer_hint)
+            : m_capacity(buffer_size)
+            , m_internal_buffer(buffer_size, hinted_allocator<std::uint8_t>(buffer_hint))
+        {
+            m_push_index.store(0U);
+            m_pop_index.store(0U);
+            m_active_buffer = m_internal_buffer.data();
+        }
+
         /**
          * @brief Get the capacity of the memory pipe.
          *
@@ -114,6 +181,16 @@ namespace tools
             return m_capacity;
         }
 
+        /**
+         * @brief Gets the hook registering the reader side of the pipe with a wait_set.
+         *
+         * @return The hook, notified whenever bytes are sent.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_ready_hook;
+        }
+
         /**
          * @brief Sends data through the memory pipe with a specified timeout.
          *
@@ -135,21 +212,22 @@ namespace tools
                 return sent;
             }
 
-            auto start_time = std::chrono::high_resolution_clock::now();
-            auto deadline = start_time + timeout;
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
 
             for (; sent < send_bytes;)
             {
-                bool success = push(data[sent]);
+                const std::size_t pushed = push_bytes(data + sent, send_bytes - sent);
 
-                if (success)
+                if (pushed > 0U)
                 {
-                    ++sent;
+                    sent += pushed;
+                    m_sync.signal();
+                    m_ready_hook.notify();
                 }
                 else
                 {
-                    // wait and retry
-                    auto current_time = std::chrono::high_resolution_clock::now();
+                    // wait until the consumer frees some space or the timeout expires
+                    const auto current_time = std::chrono::steady_clock::now();
 
                     if (current_time >= deadline)
                     {
@@ -157,15 +235,35 @@ namespace tools
                         break;
                     }
 
-                    tools::sleep_for(1);
+                    m_space_sync.wait_for_signal(
+                        std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                            deadline - current_time));
                 }
             } // end sending loop
 
-            if (sent > 0U)
+            return sent;
+        }
+
+        /**
+         * @brief Sends data as send() does, reporting a short transfer as an error value.
+         *
+         * @param data Pointer to the data buffer to be sent.
+         * @param send_bytes Number of bytes to send from the data buffer.
+         * @param timeout Maximum duration to keep trying to send the data before giving up.
+         * @return send_bytes, or the error with the number of bytes sent before it.
+         */
+        [[nodiscard]] expected<std::size_t, pipe_transfer_error> send_result(const std::uint8_t* data,
+            std::size_t send_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            if (nullptr == data)
             {
-                m_sync.signal();
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::invalid_argument, 0U });
+            }
+            const std::size_t sent = send(data, send_bytes, timeout);
+            if (sent < send_bytes)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::timed_out, sent });
             }
-
             return sent;
         }
 
@@ -295,21 +393,21 @@ namespace tools
                 return received;
             }
 
-            auto start_time = std::chrono::high_resolution_clock::now();
-            auto deadline = start_time + timeout;
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
 
             for (; received < rcv_bytes;)
             {
-                bool success = pop(data[received]);
+                const std::size_t popped = pop_bytes(data + received, rcv_bytes - received);
 
-                if (success)
+                if (popped > 0U)
                 {
-                    ++received;
+                    received += popped;
+                    m_space_sync.signal();
                 }
                 else
                 {
-                    // wait and retry
-                    auto current_time = std::chrono::high_resolution_clock::now();
+                    // wait until the producer sends some data or the timeout expires
+                    const auto current_time = std::chrono::steady_clock::now();
 
                     if (current_time >= deadline)
                     {
@@ -317,13 +415,37 @@ namespace tools
                         break;
                     }
 
-                    m_sync.wait_for_signal(std::chrono::duration<std::uint64_t, std::milli>(1));
+                    m_sync.wait_for_signal(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                        deadline - current_time));
                 }
             } // end receiving loop
 
             return received;
         }
 
+        /**
+         * @brief Receives data as receive() does, reporting a short transfer as an error value.
+         *
+         * @param data Pointer to the buffer where the received data will be stored.
+         * @param rcv_bytes The number of bytes to receive.
+         * @param timeout The maximum duration to wait for the data.
+         * @return rcv_bytes, or the error with the number of bytes received before it.
+         */
+        [[nodiscard]] expected<std::size_t, pipe_transfer_error> receive_result(
+            std::uint8_t* data, std::size_t rcv_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            if (nullptr == data)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::invalid_argument, 0U });
+            }
+            const std::size_t received = receive(data, rcv_bytes, timeout);
+            if (received < rcv_bytes)
+            {
+                return unexpected<pipe_transfer_error>(pipe_transfer_error { pipe_error::timed_out, received });
+            }
+            return received;
+        }
+
         /**
          * @brief Receives data from the memory pipe with a specified timeout.
          *
@@ -556,71 +678,414 @@ namespace tools
         }
 #endif
 
-    private:
         /**
-         * @brief Pushes a value into the internal lock-free ring buffer.
+         * @brief Reserves writable space directly in the pipe storage (zero-copy producer path).
          *
-         * This function attempts to push a given value into the ring buffer. It first checks if the buffer is full.
-         * If the buffer is not full, it handles potential race conditions by checking the distance between the write
-         * and read indices. If necessary, it waits until the reading operation is complete before proceeding.
-         * Finally, it stores the value in the buffer and updates the write index.
+         * The returned region is contiguous and holds at most reserve_bytes bytes. It can be smaller when the
+         * pipe is short of space or when the free space wraps around the end of the storage; the remainder
+         * can be reserved again after commit(). Only the producer thread may call reserve() and commit().
          *
-         * @param value The value to be pushed into the buffer.
-         * @return true if the value was successfully pushed into the buffer, false if the buffer is full.
+         * @param reserve_bytes Number of bytes wanted.
+         * @return The writable region, empty if the pipe is full.
          */
-        bool push(std::uint8_t value)
+        [[nodiscard]] write_region reserve(std::size_t reserve_bytes)
         {
-            // push on an internal lock free ring buffer
             const std::size_t snap_write_idx = m_push_index.load(std::memory_order_relaxed);
             const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_acquire);
 
-            // is full ?
-            if ((snap_read_idx % m_capacity) == ((snap_write_idx + 1U) % m_capacity))
+            const std::size_t free_bytes = (m_capacity - 1U) - (snap_write_idx - snap_read_idx);
+            const std::size_t offset = snap_write_idx % m_capacity;
+
+            write_region region;
+            region.size = std::min({ reserve_bytes, free_bytes, m_capacity - offset });
+            region.data = (region.size > 0U) ? (m_active_buffer + offset) : nullptr; // NOLINT raw buffer access
+            m_reserved_bytes = region.size;
+
+            return region;
+        }
+
+        /**
+         * @brief Publishes bytes written in the region returned by the last reserve() call.
+         *
+         * @param commit_bytes Number of bytes written, clamped to the reserved size.
+         * @return The number of bytes made visible to the consumer.
+         */
+        std::size_t commit(std::size_t commit_bytes)
+        {
+            const std::size_t committed = std::min(commit_bytes, m_reserved_bytes);
+            m_reserved_bytes = 0U;
+
+            if (committed > 0U)
             {
-                return false;
+                const std::size_t snap_write_idx = m_push_index.load(std::memory_order_relaxed);
+                m_push_index.store(snap_write_idx + committed, std::memory_order_release);
+                m_sync.signal();
+                m_ready_hook.notify();
             }
 
-            m_active_buffer[snap_write_idx % m_capacity] = value;
-            m_push_index.store(snap_write_idx + 1U, std::memory_order_release);
+            return committed;
+        }
 
+        /**
+         * @brief Exposes the readable bytes in place (zero-copy consumer path).
+         *
+         * The bytes stay in the pipe until consume() is called. Only the consumer thread may call peek()
+         * and consume().
+         *
+         * @return The readable regions, empty if the pipe is empty.
+         */
+        [[nodiscard]] read_regions peek() const
+        {
+            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
+            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
+
+            const std::size_t available = snap_write_idx - snap_read_idx;
+            const std::size_t offset = snap_read_idx % m_capacity;
+
+            read_regions regions;
+            regions.first_size = std::min(available, m_capacity - offset);
+            regions.second_size = available - regions.first_size;
+            regions.first = (regions.first_size > 0U) ? (m_active_buffer + offset) : nullptr; // NOLINT raw access
+            regions.second = (regions.second_size > 0U) ? m_active_buffer : nullptr;
+
+            return regions;
+        }
+
+        /**
+         * @brief Waits until bytes are readable, without consuming them (consumer side, before peek()).
+         *
+         * @param timeout Maximum duration to wait.
+         * @return true if bytes are readable.
+         */
+        bool wait_for_data(const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            while (m_push_index.load(std::memory_order_acquire) == m_pop_index.load(std::memory_order_relaxed))
+            {
+                const auto current_time = std::chrono::steady_clock::now();
+                if (current_time >= deadline)
+                {
+                    return false;
+                }
+                m_sync.wait_for_signal(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                    deadline - current_time));
+            }
             return true;
         }
 
         /**
-         * @brief Pops an element from the internal lock-free ring buffer.
+         * @brief Releases bytes previously exposed by peek().
+         *
+         * @param consume_bytes Number of bytes processed, clamped to the readable size.
+         * @return The number of bytes released.
+         */
+        std::size_t consume(std::size_t consume_bytes)
+        {
+            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
+            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
+
+            const std::size_t consumed = std::min(consume_bytes, snap_write_idx - snap_read_idx);
+
+            if (consumed > 0U)
+            {
+                m_pop_index.store(snap_read_idx + consumed, std::memory_order_release);
+                m_space_sync.signal();
+            }
+
+            return consumed;
+        }
+
+        /**
+         * @brief Sends one message, kept whole and separate from the others like a FreeRTOS message buffer.
          *
-         * This function attempts to pop an element from the ring buffer and store it in the provided variable.
-         * It handles potential race conditions by checking the indices and waiting if necessary.
+         * The message is written after an inline 32-bit length header and published with one release store,
+         * so the consumer sees all of it or nothing. Messages and plain byte sends must not be mixed on a pipe.
          *
-         * @param variable Reference to a std::uint8_t where the popped element will be stored.
-         * @return true if an element was successfully popped, false if the buffer is empty.
+         * @param data Pointer to the message bytes.
+         * @param send_bytes Message size, at most the capacity minus 5 bytes (header and the empty slot).
+         * @param timeout Maximum duration to wait for room for the whole message.
+         * @return send_bytes if the message was sent, 0 otherwise.
          */
-        bool pop(std::uint8_t& variable)
+        [[nodiscard]] std::size_t send_message(const std::uint8_t* data, std::size_t send_bytes,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
         {
-            // pop from an internal lock free ring buffer
+            const std::size_t frame_bytes = message_header_size + send_bytes;
+            if (((nullptr == data) && (send_bytes > 0U)) || (frame_bytes > (m_capacity - 1U))
+                || (static_cast<std::uint64_t>(send_bytes) > UINT32_MAX))
+            {
+                return 0U;
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            for (;;)
+            {
+                const std::size_t snap_write_idx = m_push_index.load(std::memory_order_relaxed);
+                const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_acquire);
+                if (((m_capacity - 1U) - (snap_write_idx - snap_read_idx)) >= frame_bytes)
+                {
+                    const auto header = static_cast<std::uint32_t>(send_bytes);
+                    copy_to_ring(snap_write_idx, reinterpret_cast<const std::uint8_t*>(&header), // NOLINT header bytes
+                        message_header_size);
+                    copy_to_ring(snap_write_idx + message_header_size, data, send_bytes);
+                    m_push_index.store(snap_write_idx + frame_bytes, std::memory_order_release);
+                    m_sync.signal();
+                    m_ready_hook.notify();
+                    return send_bytes;
+                }
+
+                // wait until the consumer frees enough space or the timeout expires
+                const auto current_time = std::chrono::steady_clock::now();
+                if (current_time >= deadline)
+                {
+                    return 0U;
+                }
+                m_space_sync.wait_for_signal(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                    deadline - current_time));
+            }
+        }
+
+        /**
+         * @brief Receives the next message sent with send_message() into a caller buffer.
+         *
+         * @param data Destination buffer.
+         * @param capacity Destination capacity; a larger message stays in the pipe and 0 is returned.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time or it does not fit.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::uint8_t* data, std::size_t capacity, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t message_bytes = 0U;
+            if (!wait_message(message_bytes, timeout) || (message_bytes > capacity)
+                || ((nullptr == data) && (message_bytes > 0U)))
+            {
+                return 0U;
+            }
 
             const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
-            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
+            copy_from_ring(snap_read_idx + message_header_size, data, message_bytes);
+            m_pop_index.store(snap_read_idx + message_header_size + message_bytes, std::memory_order_release);
+            m_space_sync.signal();
+            return message_bytes;
+        }
 
-            // is empty ?
-            if ((snap_read_idx % m_capacity) == (snap_write_idx % m_capacity))
+        /**
+         * @brief Receives the next message into a reused vector, resized to the message size.
+         *
+         * Once the vector has grown to the largest message, receiving allocates nothing.
+         *
+         * @param data Destination vector, cleared when no message arrived in time.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::vector<std::uint8_t>& data, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t message_bytes = 0U;
+            if (!wait_message(message_bytes, timeout))
             {
-                return false;
+                data.clear();
+                return 0U;
             }
 
-            variable = m_active_buffer[snap_read_idx % m_capacity];
-            m_pop_index.store(snap_read_idx + 1U, std::memory_order_release);
+            data.resize(message_bytes);
+            return receive_message(data.data(), data.size(), std::chrono::duration<std::uint64_t, std::milli>(0));
+        }
 
-            return true;
+        /**
+         * @brief Sends a shared payload as one message, copied into the pipe straight from its block.
+         *
+         * @param payload Message bytes.
+         * @param timeout Maximum duration to wait for room for the whole message.
+         * @return The payload size if the message was sent, 0 otherwise.
+         */
+        [[nodiscard]] std::size_t send_message(const shared_payload<std::uint8_t>& payload,
+            const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send_message(payload.data(), payload.size(), timeout);
+        }
+
+        /**
+         * @brief Receives the next message into a new shared payload of exactly the message size.
+         *
+         * The bytes are copied once, from the ring into the payload block that observers and queues then share.
+         *
+         * @param payload Destination, emptied when no message arrived in time.
+         * @param timeout Maximum duration to wait for a message.
+         * @return The message size, 0 if no message arrived in time.
+         */
+        [[nodiscard]] std::size_t receive_message(
+            shared_payload<std::uint8_t>& payload, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            std::size_t message_bytes = 0U;
+            if (!wait_message(message_bytes, timeout))
+            {
+                payload = shared_payload<std::uint8_t>();
+                return 0U;
+            }
+
+            payload = shared_payload<std::uint8_t>::uninitialized(message_bytes);
+            return receive_message(
+                payload.mutate(), payload.size(), std::chrono::duration<std::uint64_t, std::milli>(0));
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of send_message().
+         */
+        [[nodiscard]] std::size_t send_message(
+            std::span<const std::uint8_t> data, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return send_message(data.data(), data.size(), timeout);
+        }
+
+        /**
+         * @brief C++20 span overload of receive_message().
+         */
+        [[nodiscard]] std::size_t receive_message(
+            std::span<std::uint8_t> destination, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            return receive_message(destination.data(), destination.size(), timeout);
+        }
+#endif
+
+    private:
+        static constexpr std::size_t message_header_size = sizeof(std::uint32_t);
+
+        /**
+         * @brief Waits for a message header and reads the message size without consuming anything.
+         */
+        bool wait_message(std::size_t& message_bytes, const std::chrono::duration<std::uint64_t, std::milli>& timeout)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            for (;;)
+            {
+                const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
+                const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
+                if ((snap_write_idx - snap_read_idx) >= message_header_size)
+                {
+                    // the whole message was published with its header
+                    std::uint32_t header = 0U;
+                    copy_from_ring(snap_read_idx, reinterpret_cast<std::uint8_t*>(&header), // NOLINT header bytes
+                        message_header_size);
+                    message_bytes = header;
+                    return true;
+                }
+
+                const auto current_time = std::chrono::steady_clock::now();
+                if (current_time >= deadline)
+                {
+                    return false;
+                }
+                m_sync.wait_for_signal(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(
+                    deadline - current_time));
+            }
+        }
+
+        /**
+         * @brief Copies bytes into the ring at a stream index, across the wrap-around point.
+         */
+        void copy_to_ring(std::size_t index, const std::uint8_t* data, std::size_t count)
+        {
+            const std::size_t offset = index % m_capacity;
+            const std::size_t first_chunk = std::min(count, m_capacity - offset);
+            if (count > 0U)
+            {
+                std::memcpy(m_active_buffer + offset, data, first_chunk); // NOLINT raw buffer access
+                std::memcpy(m_active_buffer, data + first_chunk, count - first_chunk); // NOLINT raw buffer access
+            }
+        }
+
+        /**
+         * @brief Copies bytes out of the ring from a stream index, across the wrap-around point.
+         */
+        void copy_from_ring(std::size_t index, std::uint8_t* data, std::size_t count) const
+        {
+            const std::size_t offset = index % m_capacity;
+            const std::size_t first_chunk = std::min(count, m_capacity - offset);
+            if (count > 0U)
+            {
+                std::memcpy(data, m_active_buffer + offset, first_chunk); // NOLINT raw buffer access
+                std::memcpy(data + first_chunk, m_active_buffer, count - first_chunk); // NOLINT raw buffer access
+            }
+        }
+
+        /**
+         * @brief Pushes a block of bytes into the internal lock-free ring buffer.
+         *
+         * Copies as many bytes as the free space allows with at most two memcpy calls (before and after the
+         * wrap-around point), then publishes them with a single release store of the write index.
+         * One slot is kept empty to tell a full buffer from an empty one.
+         *
+         * @param data Pointer to the bytes to push.
+         * @param count Number of bytes to push.
+         * @return The number of bytes pushed, 0 if the buffer is full.
+         */
+        std::size_t push_bytes(const std::uint8_t* data, std::size_t count)
+        {
+            // push on an internal lock free ring buffer
+            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_relaxed);
+            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_acquire);
+
+            const std::size_t free_bytes = (m_capacity - 1U) - (snap_write_idx - snap_read_idx);
+            const std::size_t to_copy = std::min(count, free_bytes);
+
+            if (to_copy > 0U)
+            {
+                const std::size_t offset = snap_write_idx % m_capacity;
+                const std::size_t first_chunk = std::min(to_copy, m_capacity - offset);
+
+                std::memcpy(m_active_buffer + offset, data, first_chunk); // NOLINT raw buffer access
+                std::memcpy(m_active_buffer, data + first_chunk, to_copy - first_chunk); // NOLINT raw buffer access
+
+                m_push_index.store(snap_write_idx + to_copy, std::memory_order_release);
+            }
+
+            return to_copy;
+        }
+
+        /**
+         * @brief Pops a block of bytes from the internal lock-free ring buffer.
+         *
+         * Copies as many bytes as available with at most two memcpy calls (before and after the wrap-around
+         * point), then releases the space with a single release store of the read index.
+         *
+         * @param data Pointer to the destination buffer.
+         * @param count Maximum number of bytes to pop.
+         * @return The number of bytes popped, 0 if the buffer is empty.
+         */
+        std::size_t pop_bytes(std::uint8_t* data, std::size_t count)
+        {
+            // pop from an internal lock free ring buffer
+            const std::size_t snap_read_idx = m_pop_index.load(std::memory_order_relaxed);
+            const std::size_t snap_write_idx = m_push_index.load(std::memory_order_acquire);
+
+            const std::size_t to_copy = std::min(count, snap_write_idx - snap_read_idx);
+
+            if (to_copy > 0U)
+            {
+                const std::size_t offset = snap_read_idx % m_capacity;
+                const std::size_t first_chunk = std::min(to_copy, m_capacity - offset);
+
+                std::memcpy(data, m_active_buffer + offset, first_chunk); // NOLINT raw buffer access
+                std::memcpy(data + first_chunk, m_active_buffer, to_copy - first_chunk); // NOLINT raw buffer access
+
+                m_pop_index.store(snap_read_idx + to_copy, std::memory_order_release);
+            }
+
+            return to_copy;
         }
 
         std::size_t m_capacity = 0;
         std::uint8_t* m_active_buffer = nullptr;
-        std::vector<std::uint8_t> m_internal_buffer;
+        std::vector<std::uint8_t, hinted_allocator<std::uint8_t>> m_internal_buffer;
 
         std::atomic<std::size_t> m_push_index;
         std::atomic<std::size_t> m_pop_index;
+        std::size_t m_reserved_bytes = 0U; // producer side only
 
-        tools::sync_object m_sync;
+        tools::sync_object m_sync;       // signaled when data is pushed
+        tools::sync_object m_space_sync; // signaled when space is freed
+        wait_set_hook m_ready_hook;      // notified when data is pushed
     };
 }
@@ -48,6 +48,8 @@
 #include "tools/base_task.hpp"
 #include "tools/linux/linux_sched_deadline.hpp"
 #include "tools/platform_detection.hpp"
+#include "tools/periodic_task_stats.hpp"
+#include "tools/periodic_wakeup.hpp"
 #include "tools/platform_helpers.hpp"
 
 namespace tools
@@ -110,6 +112,30 @@ namespace tools
                 });
         }
 
+        /**
+         * @brief Constructs a periodic_task object running in caller-provided task storage.
+         *
+         * The thread keeps its own stack, so only the stack size of storage is used; the buffers serve the
+         * FreeRTOS build.
+         *
+         * @param startup_routine The callback function to be executed at startup.
+         * @param periodic_routine The callback function to be executed periodically.
+         * @param context Shared pointer to the context object.
+         * @param task_name The name of the task.
+         * @param period The period of the task in microseconds.
+         * @param storage The stack and control block of the task, its stack_size giving the stack size.
+         * @param cpu_affinity The CPU affinity of the task.
+         * @param priority The priority of the task.
+         */
+        periodic_task(call_back&& startup_routine, call_back&& periodic_routine,
+            const std::shared_ptr<Context>& context, const std::string& task_name,
+            const std::chrono::duration<std::uint64_t, std::micro>& period, const task_storage& storage,
+            int cpu_affinity, int priority)
+            : periodic_task(std::move(startup_routine), std::move(periodic_routine), context, task_name, period,
+                  storage.stack_size, cpu_affinity, priority)
+        {
+        }
+
         /**
          * @brief Constructs a periodic_task object using perfect forwarding.
          *
@@ -231,6 +257,54 @@ namespace tools
             return reinterpret_cast<void*>(m_task->native_handle()); // NOLINT native handler wrapping as a void*
         }
 
+        /**
+         * @brief Retrieves the timing statistics of the task.
+         *
+         * Wakeup lateness (wakeup time minus deadline) and execution time of the periodic routine are recorded in
+         * microseconds at every iteration, together with the overruns (iterations ending past the next deadline)
+         * and the periods skipped to catch up.
+         *
+         * @return A snapshot of the statistics.
+         */
+        [[nodiscard]] periodic_task_stats stats() const
+        {
+            return m_stats.snapshot();
+        }
+
+        /**
+         * @brief Clears the timing statistics of the task.
+         */
+        void reset_stats()
+        {
+            m_stats.reset();
+        }
+
+        /**
+         * @brief Selects how the task waits for its deadlines, from the next period on.
+         *
+         * By default the task sleeps for 90% of the time left (96% under SCHED_DEADLINE) and spins for the
+         * rest. The hybrid wakeup sleeps until a guard before the deadline instead, the guard following the
+         * oversleep measured at every period, for a spin bounded by the timer slack rather than by the period.
+         *
+         * @param precision The wakeup settings.
+         */
+        void set_precision(const periodic_precision& precision)
+        {
+            m_max_spin_us.store(precision.max_spin.count(), std::memory_order_relaxed);
+            m_compensate_lateness.store(precision.compensate_lateness, std::memory_order_relaxed);
+            m_hybrid_wakeup.store(precision.hybrid_wakeup, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the guard the hybrid wakeup leaves between the end of its sleep and the deadline.
+         *
+         * @return The calibrated guard, 0 until a hybrid period ran.
+         */
+        [[nodiscard]] std::chrono::duration<std::uint64_t, std::micro> spin_guard() const
+        {
+            return std::chrono::duration<std::uint64_t, std::micro>(m_spin_guard_us.load(std::memory_order_relaxed));
+        }
+
     private:
         /**
          * @brief Executes a periodic task with a specified period.
@@ -249,18 +323,31 @@ namespace tools
             auto deadline = start_time + m_period;
 
             bool earliest_deadline_enabled = set_earliest_deadline_scheduling(start_time, m_period);
+            wakeup_calibrator calibrator(std::chrono::nanoseconds(initial_spin_guard).count());
 
             // execute given startup function
             m_startup_routine(m_context, this->task_name());
 
             while (!m_stop_task.load())
             {
+                const auto spin_target = deadline
+                    - std::chrono::nanoseconds(
+                        m_compensate_lateness.load(std::memory_order_relaxed) ? calibrator.lateness_bias() : 0);
+
                 // active wait loop
-                std::chrono::high_resolution_clock::time_point current_time;
-                do
+                auto current_time = std::chrono::high_resolution_clock::now();
+                const bool spinning = spin_target > current_time;
+                while (spin_target > current_time)
                 {
                     current_time = std::chrono::high_resolution_clock::now();
-                } while (deadline > current_time);
+                }
+
+                // a late sleep says nothing about the spin exit, only a spin teaches the lateness bias
+                if (spinning)
+                {
+                    calibrator.record_lateness(elapsed_ns(spin_target, current_time));
+                }
+                m_stats.record_wakeup(elapsed_us(deadline, current_time));
 
                 // execute given periodic function
                 m_periodic_routine(m_context, this->task_name());
@@ -268,10 +355,16 @@ namespace tools
                 // compute next deadline
                 deadline += m_period;
 
+                const auto wakeup_time = current_time;
                 current_time = std::chrono::high_resolution_clock::now();
+                m_stats.record_execution(elapsed_us(wakeup_time, current_time));
 
                 // wait period
-                if (deadline > current_time)
+                if ((deadline > current_time) && m_hybrid_wakeup.load(std::memory_order_relaxed))
+                {
+                    sleep_before(deadline, current_time, calibrator);
+                }
+                else if (deadline > current_time)
                 {
                     const auto remaining_time
                         = std::chrono::duration_cast<std::chrono::microseconds>(deadline - current_time);
@@ -287,19 +380,66 @@ namespace tools
                 else
                 {
                     // missed deadline, setup the next deadline in the future and multiple of the period
+                    std::uint64_t skipped_periods = 0U;
                     do
                     {
                         deadline += m_period;
+                        ++skipped_periods;
                     } while (deadline < current_time);
+
+                    m_stats.record_overrun(skipped_periods);
                 }
             } // periodic task loop
         }
 
+        /**
+         * @brief Sleeps until the calibrated guard before the deadline, then measures the oversleep.
+         */
+        void sleep_before(const std::chrono::high_resolution_clock::time_point& deadline,
+            const std::chrono::high_resolution_clock::time_point& current_time, wakeup_calibrator& calibrator)
+        {
+            const auto max_spin = std::chrono::microseconds(m_max_spin_us.load(std::memory_order_relaxed));
+            const auto guard
+                = std::chrono::nanoseconds(calibrator.guard(std::chrono::nanoseconds(max_spin).count()));
+            m_spin_guard_us.store(static_cast<std::uint64_t>(
+                                      std::chrono::duration_cast<std::chrono::microseconds>(guard).count()),
+                std::memory_order_relaxed);
+
+            const auto wake_time = deadline - guard;
+            if (wake_time > current_time)
+            {
+                std::this_thread::sleep_until(wake_time);
+                calibrator.record_oversleep(elapsed_ns(wake_time, std::chrono::high_resolution_clock::now()));
+            }
+        }
+
+        static std::int64_t elapsed_ns(const std::chrono::high_resolution_clock::time_point& from,
+            const std::chrono::high_resolution_clock::time_point& to)
+        {
+            return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+        }
+
+        static std::uint64_t elapsed_us(const std::chrono::high_resolution_clock::time_point& from,
+            const std::chrono::high_resolution_clock::time_point& to)
+        {
+            return (to > from)
+                ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count())
+                : 0U;
+        }
+
         call_back m_startup_routine;
         call_back m_periodic_routine;
         std::shared_ptr<Context> m_context;
         std::chrono::duration<std::uint64_t, std::micro> m_period;
         std::atomic_bool m_stop_task = false;
         std::unique_ptr<std::thread> m_task;
+        periodic_task_stats_recorder m_stats;
+
+        // guard of the first hybrid sleep, before any oversleep was measured
+        static constexpr std::chrono::microseconds initial_spin_guard { 200 };
+        std::atomic_bool m_hybrid_wakeup = false;
+        std::atomic_bool m_compensate_lateness = false;
+        std::atomic<std::uint64_t> m_max_spin_us = periodic_precision {}.max_spin.count();
+        std::atomic<std::uint64_t> m_spin_guard_us = 0U;
     };
 }
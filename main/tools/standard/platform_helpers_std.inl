@@ -36,6 +36,7 @@
 //-----------------------------------------------------------------------------//
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <thread>
@@ -49,6 +50,10 @@
 #include <windows.h>
 #endif
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #include "tools/logger.hpp"
 
 namespace tools
@@ -81,6 +86,49 @@ namespace tools
         std::this_thread::yield();
     }
 
+    /**
+     * @brief Hints the CPU that the caller is spinning on a shared variable (pause on x86, yield on ARM).
+     */
+    inline void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @brief Gets the number of hardware threads the process may run on, computed once.
+     *
+     * On Linux the CPUs of the affinity mask are counted, so that a process confined by taskset or a container
+     * does not size itself for the whole machine.
+     *
+     * @return The hardware thread count, at least 1.
+     */
+    inline unsigned int cpu_core_count()
+    {
+        static const unsigned int count = []()
+        {
+#if defined(__linux__)
+            cpu_set_t cpu_set = {};
+            CPU_ZERO(&cpu_set);
+            if ((0 == sched_getaffinity(0, sizeof(cpu_set), &cpu_set)) && (CPU_COUNT(&cpu_set) > 0))
+            {
+                return static_cast<unsigned int>(CPU_COUNT(&cpu_set));
+            }
+#endif
+            return (std::max)(1U, std::thread::hardware_concurrency());
+        }();
+        return count;
+    }
+
     // -- specific posix and win32 task helper --
 
     /**
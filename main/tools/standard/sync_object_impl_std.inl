@@ -82,6 +82,14 @@ namespace tools
         m_signaled = false; // consume the signal after waking
     }
 
+    bool sync_object::try_wait_for_signal()
+    {
+        std::scoped_lock<std::mutex> guard(m_mutex);
+        const bool signaled = m_signaled;
+        m_signaled = false;
+        return signaled;
+    }
+
     void sync_object::wait_for_signal(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
     {
         std::unique_lock<std::mutex> lock(m_mutex);
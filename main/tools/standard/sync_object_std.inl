@@ -91,6 +91,13 @@ namespace tools
          */
         void wait_for_signal(const std::chrono::duration<std::uint64_t, std::micro>& timeout);
 
+        /**
+         * @brief Consumes the signal if it is set, without waiting.
+         *
+         * @return true if the sync_object was signaled (the signal is then cleared), false otherwise.
+         */
+        [[nodiscard]] bool try_wait_for_signal();
+
         /**
          * @brief Signals the synchronization object from an ISR context.
          *
@@ -34,20 +34,88 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "cpptime/cpptime.hpp"
 #include "tools/timer_scheduler.hpp"
 
 namespace tools
 {
+    namespace
+    {
+        constexpr std::uint64_t wheel_tick_us = 1000U;
+
+        // wheel handles have the most significant bit set, cpptime handles (id + 1) never reach it
+        constexpr timer_handle wheel_handle_tag = timer_handle { 1U }
+            << (std::numeric_limits<timer_handle>::digits - 1);
+
+        constexpr std::uint64_t to_wheel_ticks(std::uint64_t duration_us)
+        {
+            return (duration_us + wheel_tick_us - 1U) / wheel_tick_us;
+        }
+
+        std::uint64_t elapsed_us_since(std::chrono::steady_clock::time_point epoch)
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch)
+                    .count());
+        }
+
+        std::uint64_t lateness_us(
+            std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point now)
+        {
+            if (now <= deadline)
+            {
+                return 0U;
+            }
+
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - deadline).count());
+        }
+    }
+
+    timer_scheduler::~timer_scheduler()
+    {
+#if defined(__linux__)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+            m_high_resolution_stop.store(true);
+            if (m_high_resolution_fd.valid())
+            {
+                (void)m_high_resolution_fd.arm(std::chrono::nanoseconds(0));
+            }
+        }
+        m_high_resolution_wake.signal();
+
+        if (m_high_resolution_thread && m_high_resolution_thread->joinable())
+        {
+            m_high_resolution_thread->join();
+        }
+#endif
+
+        m_wheel_stop.store(true);
+        m_wheel_wake.signal();
+
+        if (m_wheel_thread && m_wheel_thread->joinable())
+        {
+            m_wheel_thread->join();
+        }
+    }
+
     timer_handle timer_scheduler::add(const std::string& timer_name, std::uint64_t period,
         std::function<void(timer_handle)>&& handler, timer_type type)
     {
@@ -57,18 +125,10 @@ namespace tools
     timer_handle timer_scheduler::add(const std::string& timer_name, std::uint64_t period,
         std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy)
     {
-        (void)timer_name;
-        (void)policy;
-        // inputs are in us
-        // auto-reload true:  start after period and then repeat every period
-        // auto-reload false: start once after period
-        const bool auto_reload = (timer_type::periodic == type);
+        // inputs are in ms
         constexpr const std::uint64_t micro_sec_coeff = 1000U;
-        auto user_handler = std::move(handler);
-        auto hnd = m_timer_scheduler.add(
-            period * micro_sec_coeff, [user_handler = std::move(user_handler)](CppTime::timer_id internal_id) mutable
-            { user_handler(internal_id + 1U); }, auto_reload ? (period * micro_sec_coeff) : 0U);
-        return hnd + 1U; // valid handle is non zero
+        return add(timer_name, std::chrono::duration<std::uint64_t, std::micro>(period * micro_sec_coeff),
+            std::move(handler), type, policy);
     }
 
     timer_handle timer_scheduler::add(const std::string& timer_name,
@@ -81,19 +141,623 @@ namespace tools
     timer_handle timer_scheduler::add(const std::string& timer_name,
         const std::chrono::duration<std::uint64_t, std::micro>& period, std::function<void(timer_handle)>&& handler,
         timer_type type, timer_resolution_policy policy)
+    {
+        return add(
+            timer_name, period, std::move(handler), type, policy, std::chrono::duration<std::uint64_t, std::micro>(0U));
+    }
+
+    timer_handle timer_scheduler::add(const std::string& timer_name,
+        const std::chrono::duration<std::uint64_t, std::micro>& period, std::function<void(timer_handle)>&& handler,
+        timer_type type, timer_resolution_policy policy, const std::chrono::duration<std::uint64_t, std::micro>& slack)
     {
         (void)timer_name;
-        (void)policy;
+        if (timer_resolution_policy::low_resolution == policy)
+        {
+            return add_to_wheel(period.count(), std::move(handler), type, slack.count());
+        }
+
+#if defined(__linux__)
+        return add_high_resolution(period.count(), std::move(handler), type);
+#else
+        return add_deadline_queue(period.count(), std::move(handler), type);
+#endif
+    }
+
+    bool timer_scheduler::remove(timer_handle hnd)
+    {
+        if (0U != (hnd & wheel_handle_tag))
+        {
+            std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+            return m_wheel.cancel(hnd & ~wheel_handle_tag);
+        }
+
+#if defined(__linux__)
+        return remove_high_resolution(hnd);
+#else
+        return m_timer_scheduler.remove(hnd - 1U); // valid handle minus 1 for the cpptime api
+#endif
+    }
+
+    std::vector<timer_handle> timer_scheduler::add_range(std::vector<timer_request> requests)
+    {
+        std::vector<timer_handle> handles(requests.size(), 0U);
+
+        bool wheel_wake = false;
+        {
+            const auto elapsed_us = elapsed_us_since(m_wheel_epoch);
+            std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+            for (std::size_t index = 0U; index < requests.size(); ++index)
+            {
+                auto& request = requests[index];
+                if (timer_resolution_policy::low_resolution == request.policy)
+                {
+                    handles[index] = insert_in_wheel(elapsed_us, request.period.count(), std::move(request.handler),
+                        request.type, request.slack.count(), wheel_wake);
+                }
+            }
+        }
+
+        if (wheel_wake)
+        {
+            m_wheel_wake.signal();
+        }
+
+#if defined(__linux__)
+        std::vector<std::pair<std::size_t, std::shared_ptr<high_resolution_timer>>> high_resolution_timers;
+        for (std::size_t index = 0U; index < requests.size(); ++index)
+        {
+            auto& request = requests[index];
+            if (timer_resolution_policy::high_resolution == request.policy)
+            {
+                high_resolution_timers.emplace_back(index,
+                    make_high_resolution_timer(request.period.count(), std::move(request.handler), request.type));
+            }
+        }
+
+        bool high_resolution_wake = false;
+        if (!high_resolution_timers.empty())
+        {
+            std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+            for (auto& [index, timer] : high_resolution_timers)
+            {
+                handles[index] = insert_high_resolution(std::move(timer), high_resolution_wake);
+            }
+        }
+
+        if (high_resolution_wake && !m_high_resolution_fd.valid())
+        {
+            m_high_resolution_wake.signal();
+        }
+#else
+        // the cpptime fallback has no batch insertion, each timer takes its lock
+        for (std::size_t index = 0U; index < requests.size(); ++index)
+        {
+            auto& request = requests[index];
+            if (timer_resolution_policy::high_resolution == request.policy)
+            {
+                handles[index] = add_deadline_queue(request.period.count(), std::move(request.handler), request.type);
+            }
+        }
+#endif
+
+        return handles;
+    }
+
+    std::size_t timer_scheduler::remove_range(const std::vector<timer_handle>& handles)
+    {
+        std::size_t removed = 0U;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+            for (const auto hnd : handles)
+            {
+                if ((0U != (hnd & wheel_handle_tag)) && m_wheel.cancel(hnd & ~wheel_handle_tag))
+                {
+                    ++removed;
+                }
+            }
+        }
+
+#if defined(__linux__)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+            const auto listed = [&handles](const auto& timer) -> bool
+            { return (std::find(handles.begin(), handles.end(), timer->m_handle) != handles.end()); };
+            const auto first_removed
+                = std::remove_if(m_high_resolution_timers.begin(), m_high_resolution_timers.end(), listed);
+            removed += static_cast<std::size_t>(std::distance(first_removed, m_high_resolution_timers.end()));
+            m_high_resolution_timers.erase(first_removed, m_high_resolution_timers.end());
+        }
+#else
+        for (const auto hnd : handles)
+        {
+            if ((0U != hnd) && (0U == (hnd & wheel_handle_tag)) && m_timer_scheduler.remove(hnd - 1U))
+            {
+                ++removed;
+            }
+        }
+#endif
+
+        return removed;
+    }
+
+    bool timer_scheduler::restart(timer_handle hnd)
+    {
+        if (0U != (hnd & wheel_handle_tag))
+        {
+            return restart_in_wheel(hnd, std::nullopt);
+        }
+
+#if defined(__linux__)
+        return restart_high_resolution(hnd, std::nullopt);
+#else
+        return restart_deadline_queue(hnd, std::nullopt);
+#endif
+    }
+
+    bool timer_scheduler::reschedule(timer_handle hnd, const std::chrono::duration<std::uint64_t, std::micro>& period)
+    {
+        if (0U != (hnd & wheel_handle_tag))
+        {
+            return restart_in_wheel(hnd, period.count());
+        }
+
+#if defined(__linux__)
+        return restart_high_resolution(hnd, period.count());
+#else
+        return restart_deadline_queue(hnd, period.count());
+#endif
+    }
+
+    timer_resolution_report timer_scheduler::resolution(timer_resolution_policy policy) const
+    {
+        timer_resolution_report report = {};
+        const lateness_stats* stats = &m_wheel_stats;
+
+        if (timer_resolution_policy::low_resolution == policy)
+        {
+            report.backend = timer_backend_kind::timing_wheel;
+            report.granularity = std::chrono::duration<std::uint64_t, std::micro>(wheel_tick_us);
+        }
+        else
+        {
+            stats = &m_high_resolution_stats;
+#if defined(__linux__)
+            report.backend
+                = m_high_resolution_fd.valid() ? timer_backend_kind::timerfd : timer_backend_kind::deadline_queue;
+            const auto clock_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                tools::linux_os::monotonic_timerfd::clock_resolution());
+            report.granularity
+                = std::chrono::duration<std::uint64_t, std::micro>(std::max<std::uint64_t>(clock_us.count(), 1U));
+#else
+            report.backend = timer_backend_kind::deadline_queue;
+            report.granularity = std::chrono::duration<std::uint64_t, std::micro>(1U);
+#endif
+        }
+
+        report.max_lateness = std::chrono::duration<std::uint64_t, std::micro>(
+            stats->m_max_lateness_us.load(std::memory_order_relaxed));
+        report.expirations = stats->m_expirations.load(std::memory_order_relaxed);
+        return report;
+    }
+
+    void timer_scheduler::set_high_resolution_spin(const std::chrono::duration<std::uint64_t, std::micro>& slice)
+    {
+        m_spin_us.store(slice.count());
+    }
+
+    timer_handle timer_scheduler::add_to_wheel(std::uint64_t period_us, std::function<void(timer_handle)>&& handler,
+        timer_type type, std::uint64_t slack_us)
+    {
+        const auto elapsed_us = elapsed_us_since(m_wheel_epoch);
+
+        bool wake = false;
+        timer_handle hnd = 0U;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+            hnd = insert_in_wheel(elapsed_us, period_us, std::move(handler), type, slack_us, wake);
+        }
+
+        if (wake)
+        {
+            m_wheel_wake.signal();
+        }
+
+        return hnd;
+    }
+
+    timer_handle timer_scheduler::insert_in_wheel(std::uint64_t elapsed_us, std::uint64_t period_us,
+        std::function<void(timer_handle)>&& handler, timer_type type, std::uint64_t slack_us, bool& wake)
+    {
+        // round up so that the timer never fires before the requested delay
+        const auto expiry = to_wheel_ticks(elapsed_us + period_us);
+        const auto interval = std::max<std::uint64_t>(to_wheel_ticks(period_us), 1U);
+        const auto reload = (timer_type::periodic == type) ? interval : 0U;
+
+        // round down so that the slack is never exceeded
+        const auto id = m_wheel.insert(expiry, reload, std::move(handler), slack_us / wheel_tick_us, interval);
+        if (!id.has_value())
+        {
+            return 0U;
+        }
+
+        wake = wake || (expiry < m_wheel_wake_tick);
+
+        if (!m_wheel_thread)
+        {
+            m_wheel_thread = std::make_unique<std::thread>([this]() { wheel_loop(); });
+        }
+
+        return wheel_handle_tag | *id;
+    }
+
+    bool timer_scheduler::restart_in_wheel(timer_handle hnd, std::optional<std::uint64_t> period_us)
+    {
+        // rounded up like add_to_wheel(), the restarted timer never fires early
+        const auto now = to_wheel_ticks(elapsed_us_since(m_wheel_epoch));
+
+        bool wake = false;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+            const auto id = hnd & ~wheel_handle_tag;
+            const auto expiry = period_us.has_value() ? m_wheel.reschedule(id, now, to_wheel_ticks(*period_us))
+                                                      : m_wheel.restart(id, now);
+            if (!expiry.has_value())
+            {
+                return false;
+            }
+
+            wake = (*expiry < m_wheel_wake_tick);
+        }
+
+        if (wake)
+        {
+            m_wheel_wake.signal();
+        }
+
+        return true;
+    }
+
+    void timer_scheduler::wheel_loop()
+    {
+        while (!m_wheel_stop.load())
+        {
+            const auto now = std::chrono::steady_clock::now();
+            const auto elapsed_us = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - m_wheel_epoch).count());
+
+            {
+                std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+                m_wheel.advance(elapsed_us / wheel_tick_us, m_wheel_expired);
+            }
+
+            // handlers run unlocked so that they may add or remove timers
+            for (auto& expired : m_wheel_expired)
+            {
+                const auto deadline = m_wheel_epoch + std::chrono::microseconds(expired.expiry * wheel_tick_us);
+                m_wheel_stats.record(lateness_us(deadline, std::chrono::steady_clock::now()));
+                expired.handler(wheel_handle_tag | expired.id);
+            }
+
+            std::optional<wheel_type::tick_type> hint;
+            {
+                std::scoped_lock<tools::critical_section> guard(m_wheel_mutex);
+                for (auto& expired : m_wheel_expired)
+                {
+                    m_wheel.rearm(std::move(expired));
+                }
+                m_wheel_expired.clear();
+
+                hint = m_wheel.next_expiry_hint();
+                m_wheel_wake_tick
+                    = hint.has_value() ? (m_wheel.now() + *hint) : std::numeric_limits<wheel_type::tick_type>::max();
+            }
+
+            if (!hint.has_value())
+            {
+                m_wheel_wake.wait_for_signal();
+                continue;
+            }
+
+            const auto deadline = m_wheel_epoch + std::chrono::microseconds(m_wheel_wake_tick * wheel_tick_us);
+            const auto remaining
+                = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+            if (remaining.count() > 0)
+            {
+                m_wheel_wake.wait_for_signal(
+                    std::chrono::duration<std::uint64_t, std::micro>(static_cast<std::uint64_t>(remaining.count())));
+            }
+        }
+    }
+
+#if defined(__linux__)
+    timer_handle timer_scheduler::add_high_resolution(
+        std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type)
+    {
+        auto timer = make_high_resolution_timer(period_us, std::move(handler), type);
+
+        bool wake = false;
+        timer_handle hnd = 0U;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+            hnd = insert_high_resolution(std::move(timer), wake);
+        }
+
+        if (wake && !m_high_resolution_fd.valid())
+        {
+            m_high_resolution_wake.signal();
+        }
+
+        return hnd;
+    }
+
+    std::shared_ptr<timer_scheduler::high_resolution_timer> timer_scheduler::make_high_resolution_timer(
+        std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type)
+    {
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<std::uint64_t, std::micro>(period_us));
+
+        auto timer = std::make_shared<high_resolution_timer>();
+        timer->m_handler = std::move(handler);
+        timer->m_deadline = std::chrono::steady_clock::now() + period;
+        timer->m_period = (timer_type::periodic == type) ? period : std::chrono::steady_clock::duration::zero();
+        timer->m_interval = period;
+        return timer;
+    }
+
+    timer_handle timer_scheduler::insert_high_resolution(std::shared_ptr<high_resolution_timer>&& timer, bool& wake)
+    {
+        const timer_handle hnd = m_high_resolution_next++;
+        timer->m_handle = hnd;
+        wake = kick_high_resolution(timer->m_deadline) || wake;
+
+        m_high_resolution_timers.emplace_back(std::move(timer));
+
+        if (!m_high_resolution_thread)
+        {
+            m_high_resolution_thread = std::make_unique<std::thread>([this]() { high_resolution_loop(); });
+        }
+
+        return hnd;
+    }
+
+    bool timer_scheduler::remove_high_resolution(timer_handle hnd)
+    {
+        std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+        auto itr = std::find_if(m_high_resolution_timers.begin(), m_high_resolution_timers.end(),
+            [&hnd](const auto& timer) -> bool { return (timer->m_handle == hnd); });
+
+        if (itr == m_high_resolution_timers.end())
+        {
+            return false;
+        }
+
+        m_high_resolution_timers.erase(itr);
+        return true;
+    }
+
+    bool timer_scheduler::restart_high_resolution(timer_handle hnd, std::optional<std::uint64_t> period_us)
+    {
+        bool wake = false;
+        {
+            std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+            auto itr = std::find_if(m_high_resolution_timers.begin(), m_high_resolution_timers.end(),
+                [&hnd](const auto& timer) -> bool { return (timer->m_handle == hnd); });
+
+            if (itr == m_high_resolution_timers.end())
+            {
+                return false;
+            }
+
+            auto& timer = **itr;
+            if (period_us.has_value())
+            {
+                timer.m_interval = std::max(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                std::chrono::duration<std::uint64_t, std::micro>(*period_us)),
+                    std::chrono::steady_clock::duration(1));
+                if (std::chrono::steady_clock::duration::zero() != timer.m_period)
+                {
+                    timer.m_period = timer.m_interval;
+                }
+            }
+
+            timer.m_deadline = std::chrono::steady_clock::now() + timer.m_interval;
+            wake = kick_high_resolution(timer.m_deadline);
+        }
+
+        if (wake && !m_high_resolution_fd.valid())
+        {
+            m_high_resolution_wake.signal();
+        }
+
+        return true;
+    }
+
+    bool timer_scheduler::kick_high_resolution(std::chrono::steady_clock::time_point deadline)
+    {
+        if (deadline >= m_high_resolution_armed)
+        {
+            return false;
+        }
+
+        // kick the timer thread so that it re-arms for the earlier deadline
+        m_high_resolution_armed = deadline;
+        if (m_high_resolution_fd.valid())
+        {
+            (void)m_high_resolution_fd.arm(std::chrono::nanoseconds(0));
+        }
+        return true;
+    }
+
+    void timer_scheduler::high_resolution_loop()
+    {
+        using clock = std::chrono::steady_clock;
+        std::vector<std::pair<std::shared_ptr<high_resolution_timer>, clock::time_point>> due;
+
+        while (!m_high_resolution_stop.load())
+        {
+            const auto spin = std::chrono::duration_cast<clock::duration>(
+                std::chrono::duration<std::uint64_t, std::micro>(m_spin_us.load()));
+            auto next = clock::time_point::max();
+            {
+                std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+                if (m_high_resolution_stop.load())
+                {
+                    return; // the destructor kick may precede this re-arm
+                }
+
+                for (const auto& timer : m_high_resolution_timers)
+                {
+                    next = std::min(next, timer->m_deadline);
+                }
+                m_high_resolution_armed = next;
+
+                if (m_high_resolution_fd.valid())
+                {
+                    if (clock::time_point::max() == next)
+                    {
+                        (void)m_high_resolution_fd.disarm();
+                    }
+                    else
+                    {
+                        (void)m_high_resolution_fd.arm(next - spin - clock::now());
+                    }
+                }
+            }
+
+            if (m_high_resolution_fd.valid())
+            {
+                (void)m_high_resolution_fd.wait();
+            }
+            else if (clock::time_point::max() == next)
+            {
+                m_high_resolution_wake.wait_for_signal();
+            }
+            else
+            {
+                const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(next - clock::now());
+                if (remaining.count() > 0)
+                {
+                    m_high_resolution_wake.wait_for_signal(std::chrono::duration<std::uint64_t, std::micro>(
+                        static_cast<std::uint64_t>(remaining.count())));
+                }
+            }
+
+            if (m_high_resolution_stop.load() || (clock::time_point::max() == next) || ((next - clock::now()) > spin))
+            {
+                continue; // stopping, kicked by add() or woken early: re-arm for the earliest deadline
+            }
+
+            while (clock::now() < next)
+            {
+                // busy-spin the final slice
+            }
+
+            {
+                std::scoped_lock<tools::critical_section> guard(m_high_resolution_mutex);
+                const auto now = clock::now();
+                for (auto itr = m_high_resolution_timers.begin(); itr != m_high_resolution_timers.end();)
+                {
+                    auto& timer = *itr;
+                    if (timer->m_deadline > now)
+                    {
+                        ++itr;
+                        continue;
+                    }
+
+                    due.emplace_back(timer, timer->m_deadline);
+                    if (clock::duration::zero() == timer->m_period)
+                    {
+                        itr = m_high_resolution_timers.erase(itr);
+                        continue;
+                    }
+
+                    // skip the periods missed by an overrun, keeping the original phase
+                    timer->m_deadline += timer->m_period;
+                    if (timer->m_deadline <= now)
+                    {
+                        timer->m_deadline += (((now - timer->m_deadline) / timer->m_period) + 1) * timer->m_period;
+                    }
+                    ++itr;
+                }
+            }
+
+            // handlers run unlocked so that they may add or remove timers
+            for (const auto& [timer, deadline] : due)
+            {
+                m_high_resolution_stats.record(lateness_us(deadline, clock::now()));
+                timer->m_handler(timer->m_handle);
+            }
+            due.clear();
+        }
+    }
+#else
+    timer_handle timer_scheduler::add_deadline_queue(
+        std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type)
+    {
+        // auto-reload true:  start after period and then repeat every period
+        // auto-reload false: start once after period
         const bool auto_reload = (timer_type::periodic == type);
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<std::uint64_t, std::micro>(period_us));
         auto user_handler = std::move(handler);
+
+        // held across add() so that an early expiry finds its bookkeeping entry
+        std::scoped_lock<tools::critical_section> guard(m_deadline_queue_mutex);
+        const auto deadline = std::chrono::steady_clock::now() + period;
         auto hnd = m_timer_scheduler.add(
-            period.count(), [user_handler = std::move(user_handler)](CppTime::timer_id internal_id) mutable
-            { user_handler(internal_id + 1U); }, auto_reload ? period.count() : 0U);
+            period_us,
+            [this, user_handler = std::move(user_handler)](CppTime::timer_id internal_id) mutable
+            {
+                {
+                    std::scoped_lock<tools::critical_section> timer_guard(m_deadline_queue_mutex);
+                    auto& timer = m_deadline_queue_timers[internal_id];
+                    m_high_resolution_stats.record(lateness_us(timer.m_deadline, std::chrono::steady_clock::now()));
+                    timer.m_deadline += timer.m_period;
+                }
+                user_handler(internal_id + 1U);
+            },
+            auto_reload ? period_us : 0U);
+
+        if (m_deadline_queue_timers.size() <= hnd)
+        {
+            m_deadline_queue_timers.resize(hnd + 1U);
+        }
+        m_deadline_queue_timers[hnd]
+            = deadline_queue_timer { deadline, auto_reload ? period : std::chrono::steady_clock::duration::zero(), period };
         return hnd + 1U; // valid handle is non zero
     }
 
-    bool timer_scheduler::remove(timer_handle hnd)
+    bool timer_scheduler::restart_deadline_queue(timer_handle hnd, std::optional<std::uint64_t> period_us)
     {
-        return m_timer_scheduler.remove(hnd - 1U); // valid handle minus 1 for the cpptime api
+        const CppTime::timer_id internal_id = hnd - 1U; // valid handle minus 1 for the cpptime api
+
+        std::scoped_lock<tools::critical_section> guard(m_deadline_queue_mutex);
+        if ((0U == hnd) || (m_deadline_queue_timers.size() <= internal_id))
+        {
+            return false;
+        }
+
+        auto timer = m_deadline_queue_timers[internal_id];
+        if (period_us.has_value())
+        {
+            // cpptime counts in us and takes a zero period for a one-shot timer
+            timer.m_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<std::uint64_t, std::micro>(std::max<std::uint64_t>(*period_us, 1U)));
+            if (std::chrono::steady_clock::duration::zero() != timer.m_period)
+            {
+                timer.m_period = timer.m_interval;
+            }
+        }
+
+        timer.m_deadline = std::chrono::steady_clock::now() + timer.m_interval;
+        if (!m_timer_scheduler.reschedule(internal_id, timer.m_deadline,
+                std::chrono::duration_cast<CppTime::duration>(timer.m_period)))
+        {
+            return false;
+        }
+
+        m_deadline_queue_timers[internal_id] = timer;
+        return true;
     }
+#endif
 }
@@ -39,10 +39,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "cpptime/cpptime.hpp"
+#include "tools/critical_section.hpp"
+#if defined(__linux__)
+#include "tools/linux/linux_timerfd.hpp"
+#endif
 #include "tools/non_copyable.hpp"
+#include "tools/sync_object.hpp"
+#include "tools/timer_wheel.hpp"
 
 namespace tools
 {
@@ -58,6 +68,10 @@ namespace tools
 
     /**
      * @brief Timer resolution policy.
+     *
+     * On the standard backend, low_resolution timers run on a hierarchical timing wheel with a 1 ms tick (O(1)
+     * add/remove, no per-timer allocation), high_resolution timers on a CLOCK_MONOTONIC timerfd on Linux (with an
+     * optional busy-spin for the final slice) or on an exact deadline queue elsewhere.
      */
     enum class timer_resolution_policy
     {
@@ -65,6 +79,27 @@ namespace tools
         high_resolution
     };
 
+    /**
+     * @brief Backend serving a timer resolution policy.
+     */
+    enum class timer_backend_kind
+    {
+        timing_wheel,  ///< Hierarchical timing wheel on a 1 ms tick.
+        timerfd,       ///< Linux timerfd on CLOCK_MONOTONIC, optionally finished by a busy-spin.
+        deadline_queue ///< Condition variable timed waits on an ordered deadline queue (cpptime).
+    };
+
+    /**
+     * @brief Resolution achieved by the timers of one resolution policy.
+     */
+    struct timer_resolution_report
+    {
+        timer_backend_kind backend;                                    ///< The backend serving the policy.
+        std::chrono::duration<std::uint64_t, std::micro> granularity;  ///< Finest expiry step of the backend.
+        std::chrono::duration<std::uint64_t, std::micro> max_lateness; ///< Worst observed dispatch delay.
+        std::uint64_t expirations;                                     ///< Number of expirations observed.
+    };
+
     /**
      * @brief Alias for a timer handle type.
      *
@@ -72,6 +107,24 @@ namespace tools
      */
     using timer_handle = std::size_t;
 
+    /**
+     * @brief Callable posting a timer expiration to another execution context.
+     */
+    using timer_dispatcher = std::function<void(std::function<void()>&&)>;
+
+    /**
+     * @brief Description of one timer of a batch given to timer_scheduler::add_range().
+     */
+    struct timer_request
+    {
+        std::string name;                                         ///< The name of the timer.
+        std::chrono::duration<std::uint64_t, std::micro> period;  ///< The period, or the delay of a one-shot timer.
+        std::function<void(timer_handle)> handler;                ///< The callable invoked when the timer fires.
+        timer_type type = timer_type::one_shot;                   ///< One-shot or periodic.
+        timer_resolution_policy policy = timer_resolution_policy::low_resolution; ///< The resolution policy.
+        std::chrono::duration<std::uint64_t, std::micro> slack {}; ///< Tolerated delay (low resolution only).
+    };
+
     /**
      * @brief A class that manages the scheduling of timers.
      */
@@ -79,7 +132,7 @@ namespace tools
     {
     public:
         timer_scheduler() = default;
-        ~timer_scheduler() = default;
+        ~timer_scheduler();
 
         /**
          * @brief Add a new timer.
@@ -136,6 +189,45 @@ namespace tools
         timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
             std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy);
 
+        /**
+         * @brief Add a new timer whose expirations may be deferred by a slack to be coalesced with other timers.
+         *
+         * Low-resolution timers with overlapping tolerance windows are served by a single wakeup, which saves
+         * power for periodic work whose exact firing time does not matter. High-resolution timers ignore the slack.
+         *
+         * @param timer_name The name of the timer.
+         * @param period The period as std::chrono duration.
+         * @param handler The callable that is invoked when the timer fires.
+         * @param type If periodic, then the timer will expire repeatedly with a frequency set by the period
+         * parameter. If set to one_shot, then the timer will be a one-shot timer.
+         * @param policy The requested timer resolution policy.
+         * @param slack The maximum delay tolerated on each expiry (0 disables the coalescing).
+         * @return A handle to the added timer.
+         */
+        timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
+            std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy,
+            const std::chrono::duration<std::uint64_t, std::micro>& slack);
+
+        /**
+         * @brief Add a new timer whose expirations are handed to a dispatcher instead of running on the timer thread.
+         *
+         * The timer thread (or FreeRTOS timer service task) only does the bookkeeping and posts each expiration,
+         * so a slow handler no longer delays the other timers. The handler stays alive while a posted expiration
+         * is pending, even if the timer is removed meanwhile.
+         *
+         * @param timer_name The name of the timer.
+         * @param period The period as std::chrono duration.
+         * @param handler The callable that is invoked, through the dispatcher, when the timer fires.
+         * @param type If periodic, then the timer will expire repeatedly with a frequency set by the period
+         * parameter. If set to one_shot, then the timer will be a one-shot timer.
+         * @param policy The requested timer resolution policy.
+         * @param dispatcher Runs each expiration, e.g. make_timer_dispatcher() over a worker_task executor.
+         * @return A handle to the added timer.
+         */
+        timer_handle add(const std::string& timer_name, const std::chrono::duration<std::uint64_t, std::micro>& period,
+            std::function<void(timer_handle)>&& handler, timer_type type, timer_resolution_policy policy,
+            timer_dispatcher&& dispatcher);
+
 
         /**
          * @brief Removes the timer with the given id.
@@ -145,7 +237,150 @@ namespace tools
          */
         bool remove(timer_handle hnd);
 
+        /**
+         * @brief Adds a batch of timers, taking each backend lock once and waking its timer thread at most once.
+         *
+         * @param requests The timers to add; their handlers are moved out.
+         * @return The handles of the added timers, in request order (0 for a timer that could not be added).
+         */
+        std::vector<timer_handle> add_range(std::vector<timer_request> requests);
+
+        /**
+         * @brief Removes a batch of timers, taking each backend lock once.
+         *
+         * @param handles The handles of the timers to remove.
+         * @return The number of timers removed.
+         */
+        std::size_t remove_range(const std::vector<timer_handle>& handles);
+
+        /**
+         * @brief Re-arms a timer one interval from now, keeping its handle and its handler.
+         *
+         * The interval is the period of a periodic timer and the delay of a one-shot timer that has not fired yet.
+         * Wheel timers move in O(1) with no allocation, which suits watchdog-style timeouts pushed back on every
+         * message.
+         *
+         * @param hnd The handle of the timer to restart.
+         * @return True if the timer was found and re-armed, false otherwise.
+         */
+        bool restart(timer_handle hnd);
+
+        /**
+         * @brief Changes the interval of a timer and re-arms it one new interval from now, keeping its handle.
+         *
+         * @param hnd The handle of the timer to reschedule.
+         * @param period The new period of a periodic timer, or the new delay of a one-shot timer.
+         * @return True if the timer was found and re-armed, false otherwise.
+         */
+        bool reschedule(timer_handle hnd, const std::chrono::duration<std::uint64_t, std::micro>& period);
+
+        /**
+         * @brief Reports the resolution achieved by the timers of a policy.
+         *
+         * The granularity is the finest step the backend can expire on; the lateness is measured between each
+         * deadline and the dispatch of its handler, so it also covers the scheduling jitter of the timer thread.
+         *
+         * @param policy The timer resolution policy.
+         * @return The backend, granularity and observed lateness of the policy.
+         */
+        [[nodiscard]] timer_resolution_report resolution(timer_resolution_policy policy) const;
+
+        /**
+         * @brief Sets the final slice of each high-resolution wait that is busy-spun instead of slept (0, the
+         * default, disables the spin).
+         *
+         * Spinning trades a core for the wake-up latency of the kernel; only the Linux timerfd backend spins.
+         *
+         * @param slice The busy-spin slice.
+         */
+        void set_high_resolution_spin(const std::chrono::duration<std::uint64_t, std::micro>& slice);
+
     private:
+        /**
+         * @brief Lock-free lateness statistics of one policy.
+         */
+        struct lateness_stats
+        {
+            std::atomic<std::uint64_t> m_max_lateness_us = 0U;
+            std::atomic<std::uint64_t> m_expirations = 0U;
+
+            void record(std::uint64_t lateness_us)
+            {
+                m_expirations.fetch_add(1U, std::memory_order_relaxed);
+                auto current = m_max_lateness_us.load(std::memory_order_relaxed);
+                while ((lateness_us > current)
+                    && !m_max_lateness_us.compare_exchange_weak(current, lateness_us, std::memory_order_relaxed))
+                {
+                }
+            }
+        };
+
+#if defined(__linux__)
+        struct high_resolution_timer
+        {
+            std::function<void(timer_handle)> m_handler;
+            std::chrono::steady_clock::time_point m_deadline;
+            std::chrono::steady_clock::duration m_period;
+            std::chrono::steady_clock::duration m_interval; ///< Delay re-applied by restart().
+            timer_handle m_handle;
+        };
+
+        timer_handle add_high_resolution(
+            std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type);
+        static std::shared_ptr<high_resolution_timer> make_high_resolution_timer(
+            std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type);
+        timer_handle insert_high_resolution(std::shared_ptr<high_resolution_timer>&& timer, bool& wake);
+        bool remove_high_resolution(timer_handle hnd);
+        bool restart_high_resolution(timer_handle hnd, std::optional<std::uint64_t> period_us);
+        bool kick_high_resolution(std::chrono::steady_clock::time_point deadline);
+        void high_resolution_loop();
+#else
+        struct deadline_queue_timer
+        {
+            std::chrono::steady_clock::time_point m_deadline; ///< Next expected expiry, for the statistics.
+            std::chrono::steady_clock::duration m_period;
+            std::chrono::steady_clock::duration m_interval; ///< Delay re-applied by restart().
+        };
+
+        timer_handle add_deadline_queue(
+            std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type);
+        bool restart_deadline_queue(timer_handle hnd, std::optional<std::uint64_t> period_us);
+#endif
+
+        using wheel_type = tools::timer_wheel<std::function<void(timer_handle)>>;
+
+        timer_handle add_to_wheel(std::uint64_t period_us, std::function<void(timer_handle)>&& handler, timer_type type,
+            std::uint64_t slack_us);
+        timer_handle insert_in_wheel(std::uint64_t elapsed_us, std::uint64_t period_us,
+            std::function<void(timer_handle)>&& handler, timer_type type, std::uint64_t slack_us, bool& wake);
+        bool restart_in_wheel(timer_handle hnd, std::optional<std::uint64_t> period_us);
+        void wheel_loop();
+
+#if defined(__linux__)
+        tools::critical_section m_high_resolution_mutex;
+        tools::linux_os::monotonic_timerfd m_high_resolution_fd;
+        tools::sync_object m_high_resolution_wake; ///< Fallback when no timerfd could be created.
+        std::vector<std::shared_ptr<high_resolution_timer>> m_high_resolution_timers;
+        std::chrono::steady_clock::time_point m_high_resolution_armed = std::chrono::steady_clock::time_point::max();
+        timer_handle m_high_resolution_next = 1U;
+        std::atomic<bool> m_high_resolution_stop = false;
+        std::unique_ptr<std::thread> m_high_resolution_thread; ///< Started with the first high-resolution timer.
+#else
+        tools::critical_section m_deadline_queue_mutex;
+        std::vector<deadline_queue_timer> m_deadline_queue_timers; ///< Indexed by cpptime timer id.
         CppTime::Timer m_timer_scheduler;
+#endif
+        std::atomic<std::uint64_t> m_spin_us = 0U;
+        lateness_stats m_high_resolution_stats;
+        lateness_stats m_wheel_stats;
+
+        tools::critical_section m_wheel_mutex;
+        tools::sync_object m_wheel_wake;
+        wheel_type m_wheel;
+        std::vector<wheel_type::expired_timer> m_wheel_expired;
+        std::chrono::steady_clock::time_point m_wheel_epoch = std::chrono::steady_clock::now();
+        wheel_type::tick_type m_wheel_wake_tick = 0U;
+        std::atomic<bool> m_wheel_stop = false;
+        std::unique_ptr<std::thread> m_wheel_thread; ///< Started with the first low-resolution timer.
     };
 }
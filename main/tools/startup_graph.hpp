@@ -0,0 +1,539 @@
+/**
+ * @file startup_graph.hpp
+ * @brief Dependency graph of the subsystems to bring up at boot, initialized in parallel or on first use.
+ *
+ * Bringing up the allocator, codecs, subjects, tasks and timers one after the other makes the time to first publish
+ * the sum of every init routine. startup_graph takes each component with its dependencies: start() runs the eager
+ * ones on a few short-lived tasks as soon as their dependencies are ready, lazy ones are only initialized by the
+ * first require(), and the profile tells when and where each routine ran and for how long.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(STARTUP_GRAPH_HPP_)
+#define STARTUP_GRAPH_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/cond_var.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief When a component of a startup_graph is initialized.
+     */
+    enum class startup_mode : std::uint8_t
+    {
+        eager, ///< By start(), as soon as its dependencies are ready.
+        lazy   ///< By the first require(), unless an eager component depends on it.
+    };
+
+    /**
+     * @brief Progress of a component of a startup_graph.
+     */
+    enum class startup_state : std::uint8_t
+    {
+        pending, ///< Not initialized yet.
+        running, ///< Init routine in progress.
+        ready,   ///< Init routine succeeded.
+        failed   ///< Init routine failed, or one of the dependencies did.
+    };
+
+    /**
+     * @brief Profile entry of one component of a startup_graph, all times in microseconds.
+     */
+    struct startup_record
+    {
+        std::string name;                             ///< Component name.
+        startup_state state = startup_state::pending; ///< Progress of the component.
+        bool on_demand = false;                       ///< Initialized by require() rather than by start().
+        std::string runner;                           ///< Task that ran the init routine.
+        std::uint64_t start_us = 0U;                  ///< Start of the routine, from the construction of the graph.
+        std::uint64_t duration_us = 0U;               ///< Duration of the routine.
+    };
+
+    /**
+     * @brief Dependency graph of init routines, run in parallel by start() or on first use by require().
+     *
+     * Components are added before start() and require() are called, each one after its dependencies, so that the
+     * graph cannot have a cycle. A routine returns false (or throws, with exceptions enabled) when its component
+     * cannot be brought up; the components depending on it are then failed without running. start() and require()
+     * may be called from any task, and a routine may itself require() another component. The helper tasks of
+     * start() are created for the call and deleted before it returns.
+     */
+    class startup_graph : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using component_id = std::size_t;
+        using init_routine = std::function<bool()>;
+
+        static constexpr component_id invalid_component = std::numeric_limits<component_id>::max();
+        static constexpr std::size_t default_stack_size = 4096U;
+
+        /**
+         * @brief Constructs an empty graph, the origin of the profile times.
+         *
+         * @param stack_size Stack size of the helper tasks of start(), large enough for every init routine.
+         */
+        explicit startup_graph(std::size_t stack_size = default_stack_size)
+            : m_stack_size(stack_size)
+            , m_origin(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~startup_graph() = default;
+
+        /**
+         * @brief Adds a component, to be called before start() and require().
+         *
+         * @param name Component name, used by find() and in the profile.
+         * @param routine Init routine, returning false on failure.
+         * @param dependencies Components to initialize first, all added before this one.
+         * @param mode Whether start() initializes the component or waits for a require().
+         * @return The component identifier, or invalid_component when a dependency is unknown.
+         */
+        component_id add(std::string name, init_routine routine, const std::vector<component_id>& dependencies = {},
+            startup_mode mode = startup_mode::eager)
+        {
+            const component_id id = m_components.size();
+            for (const component_id dependency : dependencies)
+            {
+                if (dependency >= id)
+                {
+                    return invalid_component;
+                }
+            }
+
+            component item;
+            item.record.name = std::move(name);
+            item.routine = std::move(routine);
+            item.dependencies = dependencies;
+            item.mode = mode;
+            m_components.push_back(std::move(item));
+
+            for (const component_id dependency : dependencies)
+            {
+                m_components[dependency].dependents.push_back(id);
+            }
+            return id;
+        }
+
+        /**
+         * @brief Initializes the eager components and their dependencies, in parallel, then returns.
+         *
+         * The caller runs routines alongside concurrency - 1 helper tasks; each participant takes the next component
+         * whose dependencies are ready. Lazy components that no eager component depends on are left pending.
+         *
+         * @param concurrency Participants including the caller, 0 for one per cpu core.
+         * @return true when every initialized component is ready.
+         */
+        bool start(std::size_t concurrency = 0U)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            std::size_t scheduled = 0U;
+            {
+                std::scoped_lock<critical_section> guard(m_mutex);
+                scheduled = schedule();
+            }
+
+            if (0U == concurrency)
+            {
+                concurrency = static_cast<std::size_t>((std::max)(get_nb_of_cpu_cores(), 1));
+            }
+            const std::size_t helpers = (std::min)(concurrency, scheduled) - ((0U == scheduled) ? 0U : 1U);
+
+            std::vector<std::unique_ptr<generic_task<startup_graph>>> tasks;
+            tasks.reserve(helpers);
+            for (std::size_t index = 0U; index < helpers; ++index)
+            {
+                tasks.emplace_back(std::make_unique<generic_task<startup_graph>>(
+                    [this](const std::shared_ptr<startup_graph>&, const std::string& task_name) { work(task_name); },
+                    std::shared_ptr<startup_graph>(), "startup_" + std::to_string(index), m_stack_size));
+            }
+
+            work("caller");
+            tasks.clear(); // generic_task destructors wait for the helpers to return
+
+            std::scoped_lock<critical_section> guard(m_mutex);
+            m_start_duration_us = elapsed_us(begin, std::chrono::steady_clock::now());
+            return (0U == m_failed);
+        }
+
+        /**
+         * @brief Initializes a component and its dependencies now, unless done already, and waits for it.
+         *
+         * A component already being initialized by another task is waited for rather than run twice.
+         *
+         * @param id Component identifier.
+         * @return true when the component is ready.
+         */
+        bool require(component_id id)
+        {
+            if (id >= m_components.size())
+            {
+                return false;
+            }
+
+            bool dependencies_ready = true;
+            for (const component_id dependency : m_components[id].dependencies)
+            {
+                dependencies_ready = require(dependency) && dependencies_ready;
+            }
+
+            std::unique_lock<critical_section> guard(m_mutex);
+            component& item = m_components[id];
+            if (!dependencies_ready && (startup_state::pending == item.record.state))
+            {
+                fail(id);
+                m_changed.notify_all();
+            }
+
+            if (startup_state::pending == item.record.state)
+            {
+                run(id, "on_demand", true, guard);
+            }
+
+            m_changed.wait(guard, [&item]() { return startup_state::running != item.record.state; });
+            return (startup_state::ready == item.record.state);
+        }
+
+        /**
+         * @brief Finds a component by name.
+         *
+         * @param name Component name.
+         * @return The component identifier, or invalid_component when no component has this name.
+         */
+        [[nodiscard]] component_id find(std::string_view name) const
+        {
+            for (component_id id = 0U; id < m_components.size(); ++id)
+            {
+                if (name == m_components[id].record.name)
+                {
+                    return id;
+                }
+            }
+            return invalid_component;
+        }
+
+        /**
+         * @brief Gets the progress of a component.
+         *
+         * @param id Component identifier.
+         * @return The state, failed for an unknown identifier.
+         */
+        [[nodiscard]] startup_state state(component_id id) const
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            return (id < m_components.size()) ? m_components[id].record.state : startup_state::failed;
+        }
+
+        /**
+         * @brief Gets the duration of the last start() call, from its entry until every eager component settled.
+         *
+         * @return Duration in microseconds.
+         */
+        [[nodiscard]] std::uint64_t start_duration_us() const
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            return m_start_duration_us;
+        }
+
+        /**
+         * @brief Gets the profile of every component, in the order they were added.
+         *
+         * @return One record per component.
+         */
+        [[nodiscard]] std::vector<startup_record> profile() const
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            std::vector<startup_record> records;
+            records.reserve(m_components.size());
+            for (const auto& item : m_components)
+            {
+                records.push_back(item.record);
+            }
+            return records;
+        }
+
+        /**
+         * @brief Prints the profile as a table sorted by start time, the pending components last.
+         *
+         * @param output Destination stream.
+         */
+        void print_profile(std::FILE* output) const
+        {
+            std::vector<startup_record> records = profile();
+            std::stable_sort(records.begin(), records.end(),
+                [](const startup_record& lhs, const startup_record& rhs)
+                {
+                    const bool lhs_pending = (startup_state::pending == lhs.state);
+                    const bool rhs_pending = (startup_state::pending == rhs.state);
+                    return (lhs_pending != rhs_pending) ? rhs_pending : (lhs.start_us < rhs.start_us);
+                });
+
+            std::fprintf(output, "Startup profile: %zu components, start() took %llu us\n", records.size(),
+                static_cast<unsigned long long>(start_duration_us()));
+            for (const auto& record : records)
+            {
+                std::fprintf(output, "%10llu us %10llu us  %-8s %-12s %s\n",
+                    static_cast<unsigned long long>(record.start_us),
+                    static_cast<unsigned long long>(record.duration_us), state_name(record.state),
+                    record.runner.c_str(), record.name.c_str());
+            }
+        }
+
+        /**
+         * @brief Gets the name of a state, as printed in the profile.
+         *
+         * @param value The state.
+         * @return A static string.
+         */
+        [[nodiscard]] static const char* state_name(startup_state value) noexcept
+        {
+            switch (value)
+            {
+                case startup_state::running:
+                    return "running";
+                case startup_state::ready:
+                    return "ready";
+                case startup_state::failed:
+                    return "failed";
+                case startup_state::pending:
+                default:
+                    return "pending";
+            }
+        }
+
+    private:
+        struct component
+        {
+            startup_record record;
+            init_routine routine;
+            std::vector<component_id> dependencies;
+            std::vector<component_id> dependents;
+            startup_mode mode = startup_mode::eager;
+            bool scheduled = false;   ///< Part of the current start() call.
+            std::size_t missing = 0U; ///< Dependencies not ready yet, for a scheduled component.
+        };
+
+        static std::uint64_t elapsed_us(
+            std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+        }
+
+        /**
+         * @brief Marks the eager components and their dependencies, and queues those already runnable.
+         * @return Number of scheduled components.
+         */
+        std::size_t schedule()
+        {
+            // dependencies always have a lower identifier: one backward pass closes the set
+            for (component_id id = m_components.size(); id-- > 0U;)
+            {
+                component& item = m_components[id];
+                item.scheduled = item.scheduled || (startup_mode::eager == item.mode);
+                if (item.scheduled)
+                {
+                    for (const component_id dependency : item.dependencies)
+                    {
+                        m_components[dependency].scheduled = true;
+                    }
+                }
+            }
+
+            m_remaining = 0U;
+            m_failed = 0U;
+            std::size_t scheduled = 0U;
+            for (component_id id = 0U; id < m_components.size(); ++id)
+            {
+                component& item = m_components[id];
+                item.scheduled = item.scheduled && (startup_state::pending == item.record.state);
+                if (!item.scheduled)
+                {
+                    continue;
+                }
+
+                ++scheduled;
+                ++m_remaining;
+                item.missing = 0U;
+                bool dependency_failed = false;
+                for (const component_id dependency : item.dependencies)
+                {
+                    const startup_state dependency_state = m_components[dependency].record.state;
+                    dependency_failed = dependency_failed || (startup_state::failed == dependency_state);
+                    item.missing += (startup_state::ready == dependency_state) ? 0U : 1U;
+                }
+
+                if (dependency_failed)
+                {
+                    fail(id);
+                }
+                else if (0U == item.missing)
+                {
+                    m_ready.push_back(id);
+                }
+            }
+            return scheduled;
+        }
+
+        /**
+         * @brief Runs the queued components until every scheduled one settled.
+         */
+        void work(const std::string& runner)
+        {
+            std::unique_lock<critical_section> guard(m_mutex);
+            for (;;)
+            {
+                m_changed.wait(guard, [this]() { return !m_ready.empty() || (0U == m_remaining); });
+                if (m_ready.empty())
+                {
+                    return;
+                }
+
+                const component_id id = m_ready.front();
+                m_ready.erase(m_ready.begin());
+                if (startup_state::pending == m_components[id].record.state) // else taken by a require()
+                {
+                    run(id, runner, false, guard);
+                }
+            }
+        }
+
+        /**
+         * @brief Runs the init routine of a pending component, the lock being released meanwhile.
+         */
+        void run(component_id id, const std::string& runner, bool on_demand, std::unique_lock<critical_section>& guard)
+        {
+            component& item = m_components[id];
+            item.record.state = startup_state::running;
+            item.record.on_demand = on_demand;
+            item.record.runner = runner;
+            const auto begin = std::chrono::steady_clock::now();
+            item.record.start_us = elapsed_us(m_origin, begin);
+
+            guard.unlock();
+            bool succeeded = false;
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            try
+            {
+                succeeded = !item.routine || item.routine();
+            }
+            catch (...)
+            {
+                succeeded = false;
+            }
+#else
+            succeeded = !item.routine || item.routine();
+#endif
+            const auto end = std::chrono::steady_clock::now();
+            guard.lock();
+
+            item.record.duration_us = elapsed_us(begin, end);
+            if (succeeded)
+            {
+                item.record.state = startup_state::ready;
+                settle(id);
+                for (const component_id dependent : item.dependents)
+                {
+                    component& next = m_components[dependent];
+                    if (next.scheduled && (startup_state::pending == next.record.state) && (0U == --next.missing))
+                    {
+                        m_ready.push_back(dependent);
+                    }
+                }
+            }
+            else
+            {
+                fail(id);
+            }
+            m_changed.notify_all();
+        }
+
+        /**
+         * @brief Fails a component and, transitively, the pending components depending on it.
+         */
+        void fail(component_id id)
+        {
+            component& item = m_components[id];
+            item.record.state = startup_state::failed;
+            settle(id);
+            for (const component_id dependent : item.dependents)
+            {
+                if (startup_state::pending == m_components[dependent].record.state)
+                {
+                    fail(dependent);
+                }
+            }
+        }
+
+        void settle(component_id id)
+        {
+            component& item = m_components[id];
+            if (item.scheduled)
+            {
+                item.scheduled = false;
+                --m_remaining;
+                m_failed += (startup_state::failed == item.record.state) ? 1U : 0U;
+            }
+        }
+
+        std::size_t m_stack_size;
+        std::chrono::steady_clock::time_point m_origin;
+        mutable critical_section m_mutex;
+        cond_var m_changed;
+        std::vector<component> m_components;
+        std::vector<component_id> m_ready;
+        std::size_t m_remaining = 0U;
+        std::size_t m_failed = 0U;
+        std::uint64_t m_start_duration_us = 0U;
+    };
+}
+
+#endif //  STARTUP_GRAPH_HPP_
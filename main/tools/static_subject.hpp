@@ -0,0 +1,246 @@
+/**
+ * @file static_subject.hpp
+ * @brief A subject whose observers are wired at compile time and informed without virtual dispatch.
+ *
+ * For topologies fixed at build time, static_subject keeps references to its observers in a tuple typed by
+ * the observer pack: publishing is a fold over direct, inlinable calls, with no shared_ptr, std::function,
+ * lock, allocation nor topic lookup, which suits ISR-adjacent paths. An observer only has to provide
+ * inform(const Topic&, const Evt&), and may restrict the topics it receives with a constexpr static
+ * subscribes(const Topic&) predicate.
+ *
+ * With publish<topic>(event) the topic is a template argument and the receivers are selected at compile time.
+ * When Topic is an enum with a trailing count enumerator, the runtime publish(topic, event) indexes a constexpr
+ * table of those per-topic dispatchers instead of testing every observer.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(STATIC_SUBJECT_HPP_)
+#define STATIC_SUBJECT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace tools
+{
+    /**
+     * @brief Number of topics of an enum Topic ending with a count enumerator, 0 for any other topic type.
+     *
+     * @tparam Topic The topic type.
+     */
+    template <typename Topic, typename = void>
+    struct static_topic_count : std::integral_constant<std::size_t, 0U>
+    {
+    };
+
+    template <typename Topic>
+    struct static_topic_count<Topic, std::enable_if_t<std::is_enum_v<Topic>, std::void_t<decltype(Topic::count)>>>
+        : std::integral_constant<std::size_t, static_cast<std::size_t>(Topic::count)>
+    {
+    };
+
+    /**
+     * @brief Detects an observer restricting its topics with a static subscribes(const Topic&) predicate.
+     *
+     * @tparam Observer The observer type.
+     * @tparam Topic The topic type.
+     */
+    template <typename Observer, typename Topic, typename = void>
+    struct has_static_subscribes : std::false_type
+    {
+    };
+
+    template <typename Observer, typename Topic>
+    struct has_static_subscribes<Observer, Topic,
+        std::void_t<decltype(Observer::subscribes(std::declval<const Topic&>()))>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief A subject dispatching to a compile-time list of observers.
+     *
+     * The observers are referenced, not owned, and must outlive the subject. They are informed in the order of
+     * the pack; the subject adds no synchronization, so an observer informed from an ISR must itself be ISR-safe
+     * (e.g. forward the event with isr_submit or into a ring buffer).
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Observers The observer types, each providing inform(const Topic&, const Evt&).
+     */
+    template <typename Topic, typename Evt, typename... Observers>
+    class static_subject
+    {
+    public:
+        static constexpr std::size_t number_of_observers = sizeof...(Observers);
+
+        /**
+         * @brief Wires the observers to the subject.
+         *
+         * @param observers The observers, outliving the subject.
+         */
+        constexpr explicit static_subject(Observers&... observers) noexcept
+            : m_observers(observers...)
+        {
+        }
+
+        /**
+         * @brief Tells whether an observer type receives a topic.
+         *
+         * @tparam Observer The observer type.
+         * @param topic The topic.
+         * @return The result of Observer::subscribes(topic), or true if the observer does not restrict its topics.
+         */
+        template <typename Observer>
+        [[nodiscard]] static constexpr bool receives(const Topic& topic)
+        {
+            if constexpr (has_static_subscribes<Observer, Topic>::value)
+            {
+                return Observer::subscribes(topic);
+            }
+            else
+            {
+                static_cast<void>(topic);
+                return true;
+            }
+        }
+
+        /**
+         * @brief Counts the observers receiving a topic, e.g. to static_assert that a topic is wired.
+         *
+         * @param topic The topic.
+         * @return The number of observers informed when the topic is published.
+         */
+        [[nodiscard]] static constexpr std::size_t number_of_receivers(const Topic& topic)
+        {
+            return (static_cast<std::size_t>(0U) + ... + static_cast<std::size_t>(receives<Observers>(topic)));
+        }
+
+        /**
+         * @brief Publishes an event to a topic known at compile time.
+         *
+         * Only the observers receiving the topic are called, the others are compiled out.
+         *
+         * @tparam TopicValue The topic, of type Topic (an enum or an integral type).
+         * @param event The event to be published.
+         */
+        template <auto TopicValue>
+        void publish(const Evt& event)
+        {
+            static_assert(std::is_same_v<std::decay_t<decltype(TopicValue)>, Topic>, "the topic must be a Topic");
+            publish_to<TopicValue>(event, std::index_sequence_for<Observers...> {});
+        }
+
+        /**
+         * @brief Publishes an event to a topic known at run time.
+         *
+         * For an enum Topic with a count enumerator, the topic indexes a table of compile-time dispatchers and
+         * topics outside [0, count) are ignored; otherwise each observer subscription is tested in turn.
+         *
+         * @param topic The topic to publish the event to.
+         * @param event The event to be published.
+         */
+        void publish(const Topic& topic, const Evt& event)
+        {
+            if constexpr (0U != static_topic_count<Topic>::value)
+            {
+                static constexpr auto dispatch_table
+                    = make_dispatch_table(std::make_index_sequence<static_topic_count<Topic>::value> {});
+                const auto index = static_cast<std::size_t>(topic);
+
+                if (index < dispatch_table.size())
+                {
+                    dispatch_table[index](*this, event); // NOLINT bounds checked above
+                }
+            }
+            else
+            {
+                publish_by_test(topic, event, std::index_sequence_for<Observers...> {});
+            }
+        }
+
+    private:
+        using dispatcher = void (*)(static_subject&, const Evt&);
+
+        template <auto TopicValue, std::size_t... Indexes>
+        void publish_to(const Evt& event, std::index_sequence<Indexes...> /*indexes*/)
+        {
+            static_cast<void>(event);
+            (inform_if<Indexes, receives<Observers>(TopicValue)>(TopicValue, event), ...);
+        }
+
+        template <std::size_t Index, bool Receives>
+        void inform_if(const Topic& topic, const Evt& event)
+        {
+            if constexpr (Receives)
+            {
+                std::get<Index>(m_observers).inform(topic, event);
+            }
+        }
+
+        template <std::size_t... Indexes>
+        void publish_by_test(const Topic& topic, const Evt& event, std::index_sequence<Indexes...> /*indexes*/)
+        {
+            static_cast<void>(topic);
+            static_cast<void>(event);
+            (inform_when<Indexes>(receives<Observers>(topic), topic, event), ...);
+        }
+
+        template <std::size_t Index>
+        void inform_when(bool receives_topic, const Topic& topic, const Evt& event)
+        {
+            if (receives_topic)
+            {
+                std::get<Index>(m_observers).inform(topic, event);
+            }
+        }
+
+        template <std::size_t TopicIndex>
+        static void dispatch_topic(static_subject& subject, const Evt& event)
+        {
+            subject.publish<static_cast<Topic>(TopicIndex)>(event);
+        }
+
+        template <std::size_t... TopicIndexes>
+        static constexpr std::array<dispatcher, sizeof...(TopicIndexes)> make_dispatch_table(
+            std::index_sequence<TopicIndexes...> /*indexes*/)
+        {
+            return { { &static_subject::dispatch_topic<TopicIndexes>... } };
+        }
+
+        std::tuple<Observers&...> m_observers;
+    };
+
+}
+
+#endif //  STATIC_SUBJECT_HPP_
@@ -0,0 +1,562 @@
+/**
+ * @file sync_cache.hpp
+ * @brief Bounded, sharded, thread-safe cache with LRU or CLOCK eviction, optional time to live and miss collapsing.
+ *
+ * A sync_dictionary in front of a slow source needs hand-written eviction and lets concurrent misses on one key
+ * all hit the source. sync_cache bounds the entry count, evicts with LRU or CLOCK from preallocated entries
+ * linked in intrusive lists, expires entries after a time to live, counts hits, misses and evictions, and runs
+ * a single computation per missing key in get_or_compute().
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SYNC_CACHE_HPP_)
+#define SYNC_CACHE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/cond_var.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/flat_hash_map.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Entry chosen for eviction when a sync_cache shard is full.
+     */
+    enum class cache_eviction : std::uint8_t
+    {
+        lru,  ///< Least recently used: every hit moves the entry to the front of the shard list.
+        clock ///< CLOCK (second chance): a hit only sets a reference bit, cleared by the eviction sweep.
+    };
+
+    /**
+     * @brief Snapshot of the sync_cache counters, summed over the shards.
+     */
+    struct cache_stats
+    {
+        std::uint64_t hits = 0U;        ///< Lookups finding a live entry.
+        std::uint64_t misses = 0U;      ///< Lookups finding no live entry.
+        std::uint64_t evictions = 0U;   ///< Live entries dropped to make room.
+        std::uint64_t expirations = 0U; ///< Entries found past their time to live and dropped.
+        std::uint64_t collapsed = 0U;   ///< get_or_compute calls that waited for the computation of another caller.
+    };
+
+    /**
+     * @brief Bounded thread-safe cache with LRU or CLOCK eviction and an optional time to live.
+     *
+     * The capacity is split over ShardCount independently locked shards picked by the key hash. Each shard
+     * preallocates its entries and its index at construction: entries are linked by index in intrusive lists
+     * (recency list, free list), so hits and replacements do not allocate. get_or_compute() collapses
+     * concurrent misses on one key into a single computation, the other callers waiting for its result.
+     *
+     * @tparam K The key type, default constructible and copyable.
+     * @tparam T The value type, default constructible and copy assignable.
+     * @tparam ShardCount The number of shards, a power of two.
+     * @tparam Hash The hash function object of the keys.
+     */
+    template <typename K, typename T, std::size_t ShardCount = 8U, typename Hash = std::hash<K>>
+    class sync_cache : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+        static_assert((ShardCount > 0U) && ((ShardCount & (ShardCount - 1U)) == 0U),
+            "sync_cache: ShardCount must be a power of two");
+        static_assert(std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value,
+            "sync_cache: values are stored in preallocated entries");
+
+    public:
+        using ttl_duration = std::chrono::duration<std::uint64_t, std::milli>;
+
+        sync_cache() = delete;
+        ~sync_cache() = default;
+
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Constructs an empty cache.
+         *
+         * @param capacity The maximum number of entries, rounded up to a multiple of ShardCount.
+         * @param eviction The eviction policy.
+         * @param ttl The time to live of an entry after it is stored, 0 for no expiry.
+         */
+        explicit sync_cache(std::size_t capacity, cache_eviction eviction = cache_eviction::lru, ttl_duration ttl = {})
+            : m_eviction(eviction)
+            , m_ttl(ttl)
+        {
+            const std::size_t per_shard = std::max<std::size_t>(1U, (capacity + ShardCount - 1U) / ShardCount);
+            for (auto& target : m_shards)
+            {
+                target.init(per_shard);
+            }
+        }
+
+        /**
+         * @brief Retrieves the maximum number of entries.
+         *
+         * @return The capacity, a multiple of ShardCount.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_shards[0].m_entries.size() * ShardCount;
+        }
+
+        /**
+         * @brief Retrieves the number of stored entries, expired ones included until they are found.
+         *
+         * @return The entry count, visiting the shards one after the other.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t count = 0U;
+            for (const auto& source : m_shards)
+            {
+                std::scoped_lock<critical_section> guard(source.m_mutex);
+                count += source.m_index.size();
+            }
+            return count;
+        }
+
+        /**
+         * @brief Looks up a key, refreshing its recency.
+         *
+         * @param key The key.
+         * @return A copy of the value, or an empty std::optional on a miss or an expired entry.
+         */
+        [[nodiscard]] std::optional<T> find(const K& key)
+        {
+            std::optional<T> result;
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<critical_section> guard(target.m_mutex);
+            if (const T* value = target.lookup(key, m_eviction, now()))
+            {
+                result = *value;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Stores a value, replacing the value of an existing key and restarting its time to live.
+         *
+         * @param key The key.
+         * @param value The value.
+         */
+        void add(const K& key, const T& value)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<critical_section> guard(target.m_mutex);
+            target.store(key, value, m_eviction, expiry_from(now()));
+        }
+
+        /**
+         * @brief Removes a key.
+         *
+         * @param key The key.
+         * @return true if the key was stored.
+         */
+        bool remove(const K& key)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::scoped_lock<critical_section> guard(target.m_mutex);
+            return target.erase(key);
+        }
+
+        /**
+         * @brief Returns the cached value of a key, computing and storing it on a miss.
+         *
+         * The computation runs outside the shard lock. Callers missing on a key whose computation is in progress
+         * wait for it and return its result instead of computing again; if it throws, one of them computes.
+         *
+         * @param key The key.
+         * @param compute Callable returning the T of the key.
+         * @return The cached or computed value.
+         */
+        template <typename Compute>
+        T get_or_compute(const K& key, Compute&& compute)
+        {
+            auto& target = m_shards[shard_of(key)];
+            std::unique_lock<critical_section> guard(target.m_mutex);
+            bool waited = false;
+            for (;;)
+            {
+                if (const T* value = target.lookup(key, m_eviction, now()))
+                {
+                    return *value;
+                }
+                if (!target.is_computing(key))
+                {
+                    break;
+                }
+                if (!waited)
+                {
+                    waited = true;
+                    ++target.m_stats.collapsed;
+                }
+                target.m_computed.wait(guard, [&target, &key]() { return !target.is_computing(key); });
+            }
+
+            target.m_computing.push_back(key);
+            guard.unlock();
+#if defined(CPP_EXCEPTIONS_ENABLED)
+            std::optional<T> value;
+            try
+            {
+                value.emplace(std::forward<Compute>(compute)());
+            }
+            catch (...)
+            {
+                guard.lock();
+                target.end_computing(key);
+                target.m_computed.notify_all();
+                throw;
+            }
+#else
+            std::optional<T> value(std::forward<Compute>(compute)());
+#endif
+            guard.lock();
+            target.end_computing(key);
+            target.store(key, *value, m_eviction, expiry_from(now()));
+            target.m_computed.notify_all();
+            return std::move(*value);
+        }
+
+        /**
+         * @brief Removes every entry; the counters are kept.
+         */
+        void clear()
+        {
+            for (auto& target : m_shards)
+            {
+                std::scoped_lock<critical_section> guard(target.m_mutex);
+                target.clear();
+            }
+        }
+
+        /**
+         * @brief Retrieves the counters summed over the shards.
+         *
+         * @return The counter snapshot.
+         */
+        [[nodiscard]] cache_stats stats() const
+        {
+            cache_stats total;
+            for (const auto& source : m_shards)
+            {
+                std::scoped_lock<critical_section> guard(source.m_mutex);
+                total.hits += source.m_stats.hits;
+                total.misses += source.m_stats.misses;
+                total.evictions += source.m_stats.evictions;
+                total.expirations += source.m_stats.expirations;
+                total.collapsed += source.m_stats.collapsed;
+            }
+            return total;
+        }
+
+        /**
+         * @brief Resets the counters to zero.
+         */
+        void reset_stats()
+        {
+            for (auto& target : m_shards)
+            {
+                std::scoped_lock<critical_section> guard(target.m_mutex);
+                target.m_stats = cache_stats {};
+            }
+        }
+
+    private:
+        using clock_type = std::chrono::steady_clock;
+        using index_type = std::uint32_t;
+
+        static constexpr const std::size_t cache_line_size = 64U;
+        static constexpr const index_type npos = ~index_type { 0U };
+
+        /**
+         * @brief Preallocated entry, linked by index in the recency list or the free list.
+         */
+        struct entry
+        {
+            K key {};
+            T value {};
+            clock_type::time_point expiry {};
+            index_type prev = npos;
+            index_type next = npos;
+            bool referenced = false;
+            bool used = false;
+        };
+
+        /**
+         * @brief One partition with its lock, its entries and its index, on its own cache lines.
+         */
+        struct alignas(cache_line_size) shard
+        {
+            void init(std::size_t entry_count)
+            {
+                m_entries.resize(entry_count);
+                m_computing.reserve(4U);
+                clear();
+            }
+
+            void clear()
+            {
+                m_index = flat_hash_map<K, index_type, Hash>(m_entries.size());
+                m_head = npos;
+                m_tail = npos;
+                m_hand = 0U;
+                m_free = npos;
+                for (std::size_t index = m_entries.size(); index > 0U; --index)
+                {
+                    entry& item = m_entries[index - 1U];
+                    item = entry {};
+                    item.next = m_free;
+                    m_free = static_cast<index_type>(index - 1U);
+                }
+            }
+
+            const T* lookup(const K& key, cache_eviction eviction, clock_type::time_point current_time)
+            {
+                const auto itr = m_index.find(key);
+                if (m_index.end() == itr)
+                {
+                    ++m_stats.misses;
+                    return nullptr;
+                }
+
+                const index_type index = itr->second;
+                entry& item = m_entries[index];
+                if ((clock_type::time_point::max() != item.expiry) && (current_time >= item.expiry))
+                {
+                    ++m_stats.expirations;
+                    ++m_stats.misses;
+                    release(index);
+                    return nullptr;
+                }
+
+                ++m_stats.hits;
+                if (cache_eviction::lru == eviction)
+                {
+                    unlink(index);
+                    push_front(index);
+                }
+                else
+                {
+                    item.referenced = true;
+                }
+                return &item.value;
+            }
+
+            void store(const K& key, const T& value, cache_eviction eviction, clock_type::time_point expiry)
+            {
+                const auto itr = m_index.find(key);
+                index_type index = npos;
+                if (m_index.end() != itr)
+                {
+                    index = itr->second;
+                    unlink(index);
+                }
+                else
+                {
+                    if (npos == m_free)
+                    {
+                        ++m_stats.evictions;
+                        release((cache_eviction::lru == eviction) ? m_tail : sweep());
+                    }
+                    index = m_free;
+                    m_free = m_entries[index].next;
+                    m_entries[index].key = key;
+                    m_entries[index].used = true;
+                    m_index.insert_or_assign(key, index);
+                }
+
+                entry& item = m_entries[index];
+                item.value = value;
+                item.expiry = expiry;
+                item.referenced = false;
+                push_front(index);
+            }
+
+            bool erase(const K& key)
+            {
+                const auto itr = m_index.find(key);
+                if (m_index.end() == itr)
+                {
+                    return false;
+                }
+                release(itr->second);
+                return true;
+            }
+
+            [[nodiscard]] bool is_computing(const K& key) const
+            {
+                return m_computing.cend() != std::find(m_computing.cbegin(), m_computing.cend(), key);
+            }
+
+            void end_computing(const K& key)
+            {
+                const auto itr = std::find(m_computing.begin(), m_computing.end(), key);
+                if (m_computing.end() != itr)
+                {
+                    *itr = m_computing.back();
+                    m_computing.pop_back();
+                }
+            }
+
+            /**
+             * @brief Advances the CLOCK hand to the first entry without a reference bit, clearing the bits met.
+             */
+            index_type sweep()
+            {
+                for (;;)
+                {
+                    entry& item = m_entries[m_hand];
+                    const auto index = static_cast<index_type>(m_hand);
+                    m_hand = (m_hand + 1U) % m_entries.size();
+                    if (item.used && !item.referenced)
+                    {
+                        return index;
+                    }
+                    item.referenced = false;
+                }
+            }
+
+            void release(index_type index)
+            {
+                entry& item = m_entries[index];
+                m_index.erase(item.key);
+                unlink(index);
+                item.key = K {};
+                item.value = T {};
+                item.used = false;
+                item.referenced = false;
+                item.next = m_free;
+                m_free = index;
+            }
+
+            void unlink(index_type index)
+            {
+                entry& item = m_entries[index];
+                if (npos != item.prev)
+                {
+                    m_entries[item.prev].next = item.next;
+                }
+                else
+                {
+                    m_head = item.next;
+                }
+                if (npos != item.next)
+                {
+                    m_entries[item.next].prev = item.prev;
+                }
+                else
+                {
+                    m_tail = item.prev;
+                }
+                item.prev = npos;
+                item.next = npos;
+            }
+
+            void push_front(index_type index)
+            {
+                entry& item = m_entries[index];
+                item.prev = npos;
+                item.next = m_head;
+                if (npos != m_head)
+                {
+                    m_entries[m_head].prev = index;
+                }
+                m_head = index;
+                if (npos == m_tail)
+                {
+                    m_tail = index;
+                }
+            }
+
+            std::vector<entry> m_entries;
+            flat_hash_map<K, index_type, Hash> m_index;
+            std::vector<K> m_computing;
+            index_type m_head = npos;
+            index_type m_tail = npos;
+            index_type m_free = npos;
+            std::size_t m_hand = 0U;
+            cache_stats m_stats;
+            mutable critical_section m_mutex;
+            cond_var m_computed;
+        };
+
+        [[nodiscard]] static std::size_t shard_of(const K& key)
+        {
+            // murmur3 finalizer, so that sequential or strided hashes spread over the shards
+            constexpr const std::uint64_t mix1 = 0xff51afd7ed558ccdULL;
+            constexpr const std::uint64_t mix2 = 0xc4ceb9fe1a85ec53ULL;
+            constexpr const unsigned int shift = 33U;
+
+            auto mixed = static_cast<std::uint64_t>(Hash {}(key));
+            mixed ^= mixed >> shift;
+            mixed *= mix1;
+            mixed ^= mixed >> shift;
+            mixed *= mix2;
+            mixed ^= mixed >> shift;
+
+            return static_cast<std::size_t>(mixed & (ShardCount - 1U));
+        }
+
+        [[nodiscard]] clock_type::time_point now() const
+        {
+            // without a time to live the entries never expire: spare the clock read
+            return (0U == m_ttl.count()) ? clock_type::time_point {} : clock_type::now();
+        }
+
+        [[nodiscard]] clock_type::time_point expiry_from(clock_type::time_point current_time) const
+        {
+            return (0U == m_ttl.count()) ? clock_type::time_point::max()
+                                         : (current_time + std::chrono::duration_cast<clock_type::duration>(m_ttl));
+        }
+
+        cache_eviction m_eviction;
+        ttl_duration m_ttl;
+        std::array<shard, ShardCount> m_shards;
+    };
+}
+
+#endif //  SYNC_CACHE_HPP_
@@ -0,0 +1,330 @@
+/**
+ * @file sync_container_stats.hpp
+ * @brief Opt-in statistics policy for the locked containers, and a registry enumerating instrumented ones.
+ *
+ * sync_queue, sync_ring_vector, sync_ring_buffer and sync_priority_queue take a Stats policy as their last
+ * template parameter. The default no_sync_container_stats compiles to nothing; sync_container_stats counts
+ * pushes and pops, tracks the high-water mark, overflow and overwrite events and the time spent waiting for the
+ * container lock, and registers itself so that every instrumented container can be listed at runtime.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SYNC_CONTAINER_STATS_HPP_)
+#define SYNC_CONTAINER_STATS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Snapshot of the counters of one instrumented container.
+     */
+    struct sync_container_stats_snapshot
+    {
+        std::string name;                    ///< Name given with sync_container_stats::set_name(), may be empty.
+        std::uint64_t pushes = 0U;           ///< Elements added, overwriting pushes included.
+        std::uint64_t pops = 0U;             ///< Elements removed by consumers.
+        std::size_t high_water_mark = 0U;    ///< Largest element count observed after a push.
+        std::uint64_t overflows = 0U;        ///< Elements refused because the container was full.
+        std::uint64_t overwrites = 0U;       ///< Oldest elements dropped by overwriting pushes.
+        std::uint64_t contended_locks = 0U;  ///< Lock acquisitions that found the lock taken.
+        std::chrono::duration<std::uint64_t, std::nano> lock_wait = {}; ///< Total time spent on contended locks.
+    };
+
+    /**
+     * @brief Default statistics policy of the sync containers: every hook is an empty inline function.
+     */
+    struct no_sync_container_stats
+    {
+        static constexpr bool enabled = false;
+
+        void on_push(std::size_t /*count*/, std::size_t /*size*/) noexcept
+        {
+        }
+
+        void on_pop(std::size_t /*count*/) noexcept
+        {
+        }
+
+        void on_overflow(std::size_t /*count*/) noexcept
+        {
+        }
+
+        void on_overwrite(std::size_t /*count*/) noexcept
+        {
+        }
+
+        void on_lock_wait(std::chrono::duration<std::uint64_t, std::nano> /*wait*/) noexcept
+        {
+        }
+    };
+
+    class sync_container_stats;
+
+    /**
+     * @brief Process-wide list of the live sync_container_stats instances.
+     *
+     * Instances register on construction and unregister on destruction; snapshot() reads all of them, so that
+     * the fullest or most contended container can be found at runtime.
+     */
+    class sync_container_registry : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Gets the registry of the process.
+         *
+         * @return The registry.
+         */
+        static sync_container_registry& instance()
+        {
+            static sync_container_registry registry;
+            return registry;
+        }
+
+        /**
+         * @brief Gets the number of live instrumented containers.
+         *
+         * @return The container count.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            return m_entries.size();
+        }
+
+        /**
+         * @brief Takes a snapshot of the counters of every live instrumented container, in registration order.
+         *
+         * @return The snapshots.
+         */
+        [[nodiscard]] std::vector<sync_container_stats_snapshot> snapshot() const;
+
+    private:
+        friend class sync_container_stats;
+
+        sync_container_registry() = default;
+        ~sync_container_registry() = default;
+
+        void add(const sync_container_stats* entry)
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            m_entries.push_back(entry);
+        }
+
+        void remove(const sync_container_stats* entry)
+        {
+            std::scoped_lock<critical_section> guard(m_mutex);
+            m_entries.erase(std::remove(m_entries.begin(), m_entries.end(), entry), m_entries.end());
+        }
+
+        mutable critical_section m_mutex;
+        std::vector<const sync_container_stats*> m_entries;
+    };
+
+    /**
+     * @brief Counting statistics policy of the sync containers, registered in sync_container_registry.
+     *
+     * The hooks are called by the container under its own lock, or from its isr_* functions, and only update
+     * relaxed atomics; the counters can be read from any task at any time.
+     */
+    class sync_container_stats : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static constexpr bool enabled = true;
+
+        sync_container_stats()
+        {
+            sync_container_registry::instance().add(this);
+        }
+
+        ~sync_container_stats()
+        {
+            sync_container_registry::instance().remove(this);
+        }
+
+        /**
+         * @brief Names the container in the registry snapshots.
+         *
+         * @param name The name.
+         */
+        void set_name(const std::string& name)
+        {
+            std::scoped_lock<critical_section> guard(m_name_mutex);
+            m_name = name;
+        }
+
+        void on_push(std::size_t count, std::size_t size) noexcept
+        {
+            m_pushes.fetch_add(count, std::memory_order_relaxed);
+            std::size_t high_water = m_high_water_mark.load(std::memory_order_relaxed);
+            while ((size > high_water)
+                && !m_high_water_mark.compare_exchange_weak(high_water, size, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void on_pop(std::size_t count) noexcept
+        {
+            m_pops.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void on_overflow(std::size_t count) noexcept
+        {
+            m_overflows.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void on_overwrite(std::size_t count) noexcept
+        {
+            m_overwrites.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void on_lock_wait(std::chrono::duration<std::uint64_t, std::nano> wait) noexcept
+        {
+            m_contended_locks.fetch_add(1U, std::memory_order_relaxed);
+            m_lock_wait_ns.fetch_add(wait.count(), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Reads the counters.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] sync_container_stats_snapshot snapshot() const
+        {
+            sync_container_stats_snapshot stats;
+            {
+                std::scoped_lock<critical_section> guard(m_name_mutex);
+                stats.name = m_name;
+            }
+            stats.pushes = m_pushes.load(std::memory_order_relaxed);
+            stats.pops = m_pops.load(std::memory_order_relaxed);
+            stats.high_water_mark = m_high_water_mark.load(std::memory_order_relaxed);
+            stats.overflows = m_overflows.load(std::memory_order_relaxed);
+            stats.overwrites = m_overwrites.load(std::memory_order_relaxed);
+            stats.contended_locks = m_contended_locks.load(std::memory_order_relaxed);
+            stats.lock_wait = std::chrono::duration<std::uint64_t, std::nano>(
+                m_lock_wait_ns.load(std::memory_order_relaxed));
+            return stats;
+        }
+
+        /**
+         * @brief Clears the counters and the high-water mark, keeping the name.
+         */
+        void reset() noexcept
+        {
+            m_pushes.store(0U, std::memory_order_relaxed);
+            m_pops.store(0U, std::memory_order_relaxed);
+            m_high_water_mark.store(0U, std::memory_order_relaxed);
+            m_overflows.store(0U, std::memory_order_relaxed);
+            m_overwrites.store(0U, std::memory_order_relaxed);
+            m_contended_locks.store(0U, std::memory_order_relaxed);
+            m_lock_wait_ns.store(0U, std::memory_order_relaxed);
+        }
+
+    private:
+        mutable critical_section m_name_mutex;
+        std::string m_name;
+        std::atomic<std::uint64_t> m_pushes { 0U };
+        std::atomic<std::uint64_t> m_pops { 0U };
+        std::atomic<std::size_t> m_high_water_mark { 0U };
+        std::atomic<std::uint64_t> m_overflows { 0U };
+        std::atomic<std::uint64_t> m_overwrites { 0U };
+        std::atomic<std::uint64_t> m_contended_locks { 0U };
+        std::atomic<std::uint64_t> m_lock_wait_ns { 0U };
+    };
+
+    inline std::vector<sync_container_stats_snapshot> sync_container_registry::snapshot() const
+    {
+        std::scoped_lock<critical_section> guard(m_mutex);
+        std::vector<sync_container_stats_snapshot> all_stats;
+        all_stats.reserve(m_entries.size());
+        for (const auto* entry : m_entries)
+        {
+            all_stats.push_back(entry->snapshot());
+        }
+        return all_stats;
+    }
+
+    /**
+     * @brief Scoped lock of a sync container that reports contention to its statistics policy.
+     *
+     * With an enabled policy the lock is first tried, and only a failed try pays for the two clock reads around
+     * the blocking lock(); with no_sync_container_stats it is a plain scoped lock.
+     *
+     * @tparam Lock The lock type, with lock(), try_lock() and unlock().
+     * @tparam Stats The statistics policy.
+     */
+    template <typename Lock, typename Stats>
+    class sync_stats_lock_guard : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        sync_stats_lock_guard(Lock& lock, Stats& stats)
+            : m_lock(lock)
+        {
+            if constexpr (Stats::enabled)
+            {
+                if (!m_lock.try_lock())
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    m_lock.lock();
+                    stats.on_lock_wait(std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::nano>>(
+                        std::chrono::steady_clock::now() - start));
+                }
+            }
+            else
+            {
+                static_cast<void>(stats);
+                m_lock.lock();
+            }
+        }
+
+        ~sync_stats_lock_guard()
+        {
+            m_lock.unlock();
+        }
+
+    private:
+        Lock& m_lock;
+    };
+}
+
+#endif // SYNC_CONTAINER_STATS_HPP_
@@ -40,16 +40,20 @@
 #if !defined(SYNC_DICTIONARY_HPP_)
 #define SYNC_DICTIONARY_HPP_
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #if ((__cplusplus >= 202302L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202302L))) && defined(__has_include)
 #if __has_include(<flat_map>)
 #include <flat_map>
@@ -57,26 +61,66 @@
 #endif
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
 #include <ranges>
+#include <span>
 #endif
 
-#include "tools/critical_section.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/shared_critical_section.hpp"
 
 namespace tools
 {
+    namespace detail
+    {
+        /** @brief Detects the containers kept sorted by key (std::map, std::flat_map), through their key_compare. */
+        template <typename D, typename = void>
+        struct is_ordered_dictionary : std::false_type
+        {
+        };
+
+        template <typename D>
+        struct is_ordered_dictionary<D, std::void_t<typename D::key_compare>> : std::true_type
+        {
+        };
+
+        template <typename D, typename = void>
+        struct has_dictionary_reserve : std::false_type
+        {
+        };
+
+        template <typename D>
+        struct has_dictionary_reserve<D,
+            std::void_t<decltype(std::declval<D&>().reserve(std::declval<typename D::size_type>()))>>
+            : std::true_type
+        {
+        };
+
+        template <typename D>
+        struct is_std_flat_map : std::false_type
+        {
+        };
+
+#if defined(__cpp_lib_flat_map) && (__cpp_lib_flat_map >= 202207L)
+        template <typename K, typename T, typename Compare, typename KeyContainer, typename MappedContainer>
+        struct is_std_flat_map<std::flat_map<K, T, Compare, KeyContainer, MappedContainer>> : std::true_type
+        {
+        };
+#endif
+    }
     /**
      * @brief A thread-safe dictionary class.
      *
-     * This class provides a thread-safe dictionary implementation using a mutex
-     * to protect access to the internal dictionary. It supports adding, removing,
+     * This class provides a thread-safe dictionary implementation using a reader/writer
+     * lock to protect access to the internal dictionary. It supports adding, removing,
      * and retrieving key-value pairs, as well as checking the size and emptiness
-     * of the dictionary.
+     * of the dictionary. Lookups (find, contains, snapshot, size, empty) take the lock
+     * shared, so concurrent readers do not serialize; mutations take it exclusively.
      *
      * @tparam K The type of the keys in the dictionary.
      * @tparam T The type of the values in the dictionary.
      * @tparam TDictionary The associative container type used internally.
-     *         Defaults to std::map<K, T>. Can also be std::unordered_map<K, T>
-     *         or std::flat_map<K, T> (C++23).
+     *         Defaults to std::map<K, T>. Can also be std::unordered_map<K, T>,
+     *         std::flat_map<K, T> (C++23), tools::flat_hash_map<K, T> or the
+     *         heap-free tools::fixed_flat_hash_map<K, T, N>.
      */
     template <typename K, typename T, typename TDictionary = std::map<K, T>>
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -97,6 +141,18 @@ namespace tools
 
         sync_dictionary() = default;
         ~sync_dictionary() = default;
+
+        /**
+         * @brief Constructs an empty dictionary whose container allocates through the given allocator.
+         *
+         * @param alloc The allocator, e.g. a std::pmr::memory_resource* for a std::pmr container.
+         */
+        template <typename Alloc, typename D = TDictionary,
+            typename = std::enable_if_t<std::uses_allocator<D, Alloc>::value>>
+        explicit sync_dictionary(const Alloc& alloc)
+            : m_dictionary(alloc)
+        {
+        }
         struct thread_safe
         {
             static constexpr bool value = true;
@@ -113,7 +169,7 @@ namespace tools
          */
         void add(const K& key, const T& value)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_dictionary.insert_or_assign(key, value);
         }
 
@@ -128,7 +184,7 @@ namespace tools
          */
         void add(K&& key, T&& value)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_dictionary.insert_or_assign(std::move(key), std::move(value));
         }
 
@@ -153,7 +209,7 @@ namespace tools
                 void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_dictionary.insert_or_assign(std::forward<KU>(key), std::forward<TU>(value));
         }
 
@@ -167,7 +223,7 @@ namespace tools
          */
         void remove(const K& key)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_dictionary.erase(key);
         }
 
@@ -178,7 +234,7 @@ namespace tools
          */
         void add_range(const std::map<K, T>& collection)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (const auto& [key, value] : collection)
             {
                 m_dictionary.insert_or_assign(key, value);
@@ -192,7 +248,7 @@ namespace tools
          */
         void add_range(const std::unordered_map<K, T>& collection)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (const auto& [key, value] : collection)
             {
                 m_dictionary.insert_or_assign(key, value);
@@ -207,7 +263,7 @@ namespace tools
          */
         void add_range(const std::flat_map<K, T>& collection)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (const auto& [key, value] : collection)
             {
                 m_dictionary.insert_or_assign(key, value);
@@ -242,7 +298,7 @@ namespace tools
 #endif
         void add_range(TRange&& values)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (auto&& entry : std::forward<TRange>(values))
             {
                 K key_value(std::get<0>(entry));
@@ -258,7 +314,7 @@ namespace tools
          */
         void add_range(std::initializer_list<std::pair<K, T>> values)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (const auto& [key, value] : values)
             {
                 m_dictionary.insert_or_assign(key, value);
@@ -333,10 +389,112 @@ namespace tools
          */
         [[nodiscard]] dictionary_type snapshot() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
             return m_dictionary;
         }
 
+        /**
+         * @brief Calls a visitor on every entry in place, in container order, under the shared lock.
+         *
+         * Unlike snapshot(), nothing is copied nor allocated. The visitor must be short and must not call the
+         * dictionary.
+         *
+         * @param visitor Callable taking a const K& and a const T&.
+         * @return The number of entries visited.
+         */
+        template <typename Visitor>
+        std::size_t for_each(Visitor&& visitor) const
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            for (const auto& [key, value] : m_dictionary)
+            {
+                visitor(key, value);
+            }
+            return m_dictionary.size();
+        }
+
+        /**
+         * @brief Calls a visitor on every entry in ascending key order, under the shared lock.
+         *
+         * Ordered containers are walked in place; hashed ones are sorted through an array of entry pointers, K
+         * providing operator<. The visitor must not call the dictionary.
+         *
+         * @param visitor Callable taking a const K& and a const T&.
+         */
+        template <typename Visitor>
+        void for_each_sorted(Visitor&& visitor) const
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            if constexpr (detail::is_ordered_dictionary<dictionary_type>::value)
+            {
+                for (const auto& [key, value] : m_dictionary)
+                {
+                    visitor(key, value);
+                }
+            }
+            else
+            {
+                std::vector<std::pair<const K*, const T*>> entries;
+                entries.reserve(m_dictionary.size());
+                for (const auto& [key, value] : m_dictionary)
+                {
+                    entries.emplace_back(&key, &value);
+                }
+                std::sort(entries.begin(), entries.end(),
+                    [](const auto& lhs, const auto& rhs) { return *lhs.first < *rhs.first; });
+                for (const auto& entry : entries)
+                {
+                    visitor(*entry.first, *entry.second);
+                }
+            }
+        }
+
+        /**
+         * @brief Replaces the contents with entries sorted by strictly ascending key, in linear time.
+         *
+         * A std::flat_map adopts the sorted keys and values as they are, a tree map appends every entry at its end
+         * hint, a hashed map reserves its final size once: no per-entry search and rebalancing as with add().
+         * Unsorted input breaks the flat map invariant; restore_dictionary_snapshot() checks the order first.
+         *
+         * @param sorted_entries The entries, sorted by strictly ascending key.
+         */
+        void bulk_load(std::vector<std::pair<K, T>> sorted_entries)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            m_dictionary.clear();
+            if constexpr (detail::is_std_flat_map<dictionary_type>::value)
+            {
+                typename dictionary_type::key_container_type keys;
+                typename dictionary_type::mapped_container_type values;
+                keys.reserve(sorted_entries.size());
+                values.reserve(sorted_entries.size());
+                for (auto& entry : sorted_entries)
+                {
+                    keys.push_back(std::move(entry.first));
+                    values.push_back(std::move(entry.second));
+                }
+                m_dictionary.replace(std::move(keys), std::move(values));
+            }
+            else if constexpr (detail::is_ordered_dictionary<dictionary_type>::value)
+            {
+                for (auto& entry : sorted_entries)
+                {
+                    m_dictionary.emplace_hint(m_dictionary.end(), std::move(entry.first), std::move(entry.second));
+                }
+            }
+            else
+            {
+                if constexpr (detail::has_dictionary_reserve<dictionary_type>::value)
+                {
+                    m_dictionary.reserve(sorted_entries.size());
+                }
+                for (auto& entry : sorted_entries)
+                {
+                    m_dictionary.insert_or_assign(std::move(entry.first), std::move(entry.second));
+                }
+            }
+        }
+
         /**
          * @brief Finds the value associated with the given key in the dictionary.
          *
@@ -351,7 +509,7 @@ namespace tools
         [[nodiscard]] std::optional<T> find(const K& key) const
         {
             std::optional<T> result;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
             const auto& itr = m_dictionary.find(key);
             if (m_dictionary.cend() != itr)
             {
@@ -370,7 +528,7 @@ namespace tools
          */
         [[nodiscard]] bool contains(const K& key) const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
             return m_dictionary.contains(key);
 #else
@@ -378,6 +536,99 @@ namespace tools
 #endif
         }
 
+        /**
+         * @brief Looks up a batch of keys under a single shared lock.
+         *
+         * @param keys The keys to look up.
+         * @param count The number of keys.
+         * @param results Receives, for each key, its value or an empty std::optional; holds count entries.
+         * @return The number of keys found.
+         */
+        std::size_t find_many(const K* keys, std::size_t count, std::optional<T>* results) const
+        {
+            std::size_t found = 0U;
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            for (std::size_t index = 0U; index < count; ++index)
+            {
+                const auto& itr = m_dictionary.find(keys[index]); // NOLINT pointer arithmetic
+                if (m_dictionary.cend() != itr)
+                {
+                    results[index] = itr->second; // NOLINT pointer arithmetic
+                    ++found;
+                }
+                else
+                {
+                    results[index].reset(); // NOLINT pointer arithmetic
+                }
+            }
+            return found;
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief Looks up a batch of keys under a single shared lock.
+         *
+         * @param keys The keys to look up.
+         * @param results Receives, for each key, its value or an empty std::optional; only the first
+         *        min(keys.size(), results.size()) keys are looked up.
+         * @return The number of keys found.
+         */
+        std::size_t find_many(std::span<const K> keys, std::span<std::optional<T>> results) const
+        {
+            return find_many(keys.data(), (std::min)(keys.size(), results.size()), results.data());
+        }
+#endif
+
+        /**
+         * @brief Calls a visitor on the value of a key in place, under the exclusive lock.
+         *
+         * The visitor can modify the value without copying it out and adding it back. It must not call the
+         * dictionary.
+         *
+         * @param key The key to look up.
+         * @param visitor Callable taking a T&.
+         * @return true if the key was found and the visitor called.
+         */
+        template <typename Visitor>
+        bool visit(const K& key, Visitor&& visitor)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            auto itr = m_dictionary.find(key);
+            if (m_dictionary.end() == itr)
+            {
+                return false;
+            }
+            std::forward<Visitor>(visitor)(itr->second);
+            return true;
+        }
+
+        /**
+         * @brief Calls an updater on the value of a key in place, inserting a value-initialized T first if the key
+         * is missing, under the exclusive lock.
+         *
+         * The updater must not call the dictionary.
+         *
+         * @param key The key to update or insert.
+         * @param updater Callable taking a T&.
+         * @return true if the updater was called, false only when a fixed capacity container is full.
+         */
+        template <typename Updater>
+        bool upsert(const K& key, Updater&& updater)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            auto itr = m_dictionary.find(key);
+            if (m_dictionary.end() == itr)
+            {
+                itr = m_dictionary.insert_or_assign(key, T {}).first;
+                if (m_dictionary.end() == itr)
+                {
+                    return false;
+                }
+            }
+            std::forward<Updater>(updater)(itr->second);
+            return true;
+        }
+
         /**
          * @brief Removes keys from a generic range-like collection.
          *
@@ -400,7 +651,7 @@ namespace tools
 #endif
         void remove_collection(TRange&& keys)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (auto&& key : std::forward<TRange>(keys))
             {
                 m_dictionary.erase(K(std::forward<decltype(key)>(key)));
@@ -414,7 +665,7 @@ namespace tools
          */
         void remove_collection(std::initializer_list<K> keys)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             for (const auto& key : keys)
             {
                 m_dictionary.erase(key);
@@ -431,7 +682,7 @@ namespace tools
          */
         [[nodiscard]] bool empty() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
             return m_dictionary.empty();
         }
 
@@ -445,7 +696,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t size() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
             return m_dictionary.size();
         }
 
@@ -457,13 +708,13 @@ namespace tools
          */
         void clear()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_dictionary.clear();
         }
 
     private:
         dictionary_type m_dictionary;
-        mutable critical_section m_mutex;
+        mutable shared_critical_section m_mutex;
     };
 }
 
@@ -0,0 +1,350 @@
+/**
+ * @file sync_lane_queue.hpp
+ * @brief A thread-safe multi-lane FIFO queue drained highest lane first.
+ *
+ * This file contains the definition of the sync_lane_queue class, a fixed number of FIFO lanes behind one lock,
+ * popped highest priority lane first with an anti-starvation quota, and the work_priority lanes used by
+ * worker_task.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SYNC_LANE_QUEUE_HPP_)
+#define SYNC_LANE_QUEUE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <type_traits>
+#include <utility>
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/ring_queue.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Priority lanes of a worker_task, highest first.
+     */
+    enum class work_priority : unsigned char
+    {
+        high = 0U,   ///< Control traffic, served first.
+        normal = 1U, ///< Default lane of delegate().
+        low = 2U     ///< Bulk work, served when nothing more urgent is pending (or by the anti-starvation quota).
+    };
+
+    /**
+     * @brief Number of work_priority lanes.
+     */
+    constexpr std::size_t work_priority_lanes = 3U;
+
+    /**
+     * @brief A thread-safe queue made of LaneCount FIFO lanes, lane 0 being the most urgent.
+     *
+     * pop() serves the highest non-empty lane, but once a lane has been served quota times in a row while a lower
+     * lane is waiting, the next pop() serves the lower lane, so that bulk work cannot starve.
+     *
+     * @tparam T The type of elements stored in the queue.
+     * @tparam LaneCount The number of lanes.
+     * @tparam Lane The FIFO of each lane: std::queue, or ring_queue to give the lanes a fixed footprint with
+     *              reserve().
+     */
+    template <typename T, std::size_t LaneCount, typename Lane = std::queue<T>>
+    class sync_lane_queue : public non_copyable // NOLINT inherits from non copyable/non movable
+    {
+    public:
+        static_assert(LaneCount > 0U, "at least one lane is required");
+
+        /**
+         * @brief Default number of consecutive pops a lane may get while a lower lane waits.
+         */
+        static constexpr std::size_t default_quota = 8U;
+
+        sync_lane_queue() = default;
+        ~sync_lane_queue() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Pushes a copy of an element at the back of a lane.
+         *
+         * @param lane The lane index (clamped to LaneCount - 1).
+         * @param elem The element to be copied into the lane.
+         */
+        void push(std::size_t lane, const T& elem)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_lanes[clamp_lane(lane)].push(elem);
+        }
+
+        /**
+         * @brief Moves an element at the back of a lane.
+         *
+         * @param lane The lane index (clamped to LaneCount - 1).
+         * @param elem The element to be moved into the lane.
+         */
+        void push(std::size_t lane, T&& elem)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_lanes[clamp_lane(lane)].push(std::move(elem));
+        }
+
+        /**
+         * @brief Constructs an element in place at the back of a lane.
+         *
+         * @param lane The lane index (clamped to LaneCount - 1).
+         * @param args Arguments forwarded to T's constructor.
+         */
+        template <typename... Args>
+        void emplace(std::size_t lane, Args&&... args)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_lanes[clamp_lane(lane)].emplace(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Moves a batch of elements at the back of a lane, under a single lock.
+         *
+         * @param lane The lane index (clamped to LaneCount - 1).
+         * @param first Begin iterator, dereferenced once per element (a move iterator moves them).
+         * @param last End iterator.
+         */
+        template <typename InputIt>
+        void push_range(std::size_t lane, InputIt first, InputIt last)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            auto& queue = m_lanes[clamp_lane(lane)];
+            for (; first != last; ++first)
+            {
+                queue.push(*first);
+            }
+        }
+
+        /**
+         * @brief Removes and returns the next element, highest lane first within the anti-starvation quota.
+         *
+         * @return The next element, or none if all the lanes are empty.
+         */
+        [[nodiscard]] std::optional<T> pop()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return pop_locked();
+        }
+
+        /**
+         * @brief Moves up to the destination capacity of next elements into an output range, under a single lock.
+         *
+         * The elements come in the order successive pop() calls would give, anti-starvation quota included.
+         *
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of elements moved.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            std::size_t count = 0U;
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            for (; first != last; ++first)
+            {
+                auto item = pop_locked();
+                if (!item.has_value())
+                {
+                    break;
+                }
+                *first = std::move(item.value());
+                ++count;
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Checks if all the lanes are empty.
+         *
+         * @return true if nothing is queued.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            for (const auto& queue : m_lanes)
+            {
+                if (!queue.empty())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Retrieves the number of elements queued in all the lanes.
+         *
+         * @return The number of queued elements.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            std::size_t count = 0U;
+            for (const auto& queue : m_lanes)
+            {
+                count += queue.size();
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Retrieves the number of elements queued in one lane.
+         *
+         * @param lane The lane index (clamped to LaneCount - 1).
+         * @return The number of elements in the lane.
+         */
+        [[nodiscard]] std::size_t size(std::size_t lane) const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_lanes[clamp_lane(lane)].size();
+        }
+
+        /**
+         * @brief Sets how many elements in a row a lane may get while a lower lane waits.
+         *
+         * @param quota The anti-starvation quota (at least 1).
+         */
+        void set_quota(std::size_t quota)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            m_quota = (0U == quota) ? 1U : quota;
+        }
+
+        /**
+         * @brief Preallocates every lane and sets what a push does once a lane is full (ring_queue lanes).
+         *
+         * Lanes never shrink and the queued elements are kept.
+         *
+         * @param lane_capacity The minimum number of elements each lane holds.
+         * @param policy The full policy of every lane.
+         */
+        template <typename L = Lane>
+        auto reserve(std::size_t lane_capacity, queue_full_policy policy)
+            -> decltype(std::declval<L&>().reserve(lane_capacity, policy))
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            for (auto& queue : m_lanes)
+            {
+                queue.reserve(lane_capacity, policy);
+            }
+        }
+
+        /**
+         * @brief Returns the number of elements rejected or overwritten because their lane was full (ring_queue
+         * lanes).
+         *
+         * @return The dropped element count, all lanes together.
+         */
+        template <typename L = Lane>
+        [[nodiscard]] auto dropped_count() const -> decltype(std::declval<const L&>().dropped_count())
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            decltype(std::declval<const L&>().dropped_count()) dropped = 0U;
+            for (const auto& queue : m_lanes)
+            {
+                dropped += queue.dropped_count();
+            }
+            return dropped;
+        }
+
+    private:
+        [[nodiscard]] std::optional<T> pop_locked()
+        {
+            std::optional<T> item;
+
+            for (std::size_t lane = 0U; lane < LaneCount; ++lane)
+            {
+                auto& queue = m_lanes[lane];
+
+                if (queue.empty())
+                {
+                    m_bursts[lane] = 0U;
+                    continue;
+                }
+
+                if ((m_bursts[lane] >= m_quota) && lower_lane_pending(lane))
+                {
+                    // let a lower lane through once
+                    m_bursts[lane] = 0U;
+                    continue;
+                }
+
+                ++m_bursts[lane];
+                item = std::move(queue.front());
+                queue.pop();
+                break;
+            }
+
+            return item;
+        }
+
+        static constexpr std::size_t clamp_lane(std::size_t lane)
+        {
+            return (lane < LaneCount) ? lane : (LaneCount - 1U);
+        }
+
+        [[nodiscard]] bool lower_lane_pending(std::size_t lane) const
+        {
+            for (std::size_t lower = lane + 1U; lower < LaneCount; ++lower)
+            {
+                if (!m_lanes[lower].empty())
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        std::array<Lane, LaneCount> m_lanes;
+        std::array<std::size_t, LaneCount> m_bursts = {};
+        std::size_t m_quota = default_quota;
+        mutable critical_section m_mutex;
+    };
+}
+
+#endif //  SYNC_LANE_QUEUE_HPP_
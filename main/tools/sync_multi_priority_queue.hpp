@@ -0,0 +1,347 @@
+/**
+ * @file sync_multi_priority_queue.hpp
+ * @brief A relaxed concurrent priority queue made of independently locked d-ary heaps.
+ *
+ * This file contains the definition of the sync_multi_priority_queue class, a MultiQueue: pushes land in a
+ * random shard, pops take the better top of two random shards. Threads rarely meet on the same lock, at the
+ * price of a global order that is only approximate.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(SYNC_MULTI_PRIORITY_QUEUE_HPP_)
+#define SYNC_MULTI_PRIORITY_QUEUE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tools/critical_section.hpp"
+#include "tools/dary_heap.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A relaxed thread-safe priority queue for throughput-oriented producers and consumers.
+     *
+     * The elements are spread over ShardCount dary_heap shards, each behind its own lock. A push tries the
+     * locks starting from a per-thread random shard and uses the first one it gets without waiting; a pop locks
+     * two random shards and takes the better of their tops, falling back to a scan when both are empty. The
+     * element returned is thus among the best of the queue with high probability, but not always the best:
+     * use sync_priority_queue when strict priority order matters.
+     *
+     * size() and empty() read per-shard counters without locking and are snapshots while the queue is in use.
+     *
+     * @tparam T The type of elements stored in the priority queue.
+     * @tparam Compare The comparison function to use for ordering elements (default: std::greater<T>).
+     * @tparam ShardCount The number of shards, a power of two, typically twice the number of cores.
+     * @tparam Arity The number of children per heap node.
+     */
+    template <typename T, typename Compare = std::greater<T>, std::size_t ShardCount = 8U, std::size_t Arity = 4U>
+    class sync_multi_priority_queue : public non_copyable // NOLINT inherits from non copyable/non movable
+    {
+    public:
+        static_assert((ShardCount > 0U) && ((ShardCount & (ShardCount - 1U)) == 0U),
+            "sync_multi_priority_queue: ShardCount must be a power of two");
+
+        sync_multi_priority_queue() = default;
+        ~sync_multi_priority_queue() = default;
+
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        /**
+         * @brief Retrieves the number of shards.
+         *
+         * @return ShardCount.
+         */
+        [[nodiscard]] static constexpr std::size_t shard_count()
+        {
+            return ShardCount;
+        }
+
+        /**
+         * @brief Pushes a copy of an element into the priority queue.
+         *
+         * @param elem The element to be copied into the priority queue.
+         */
+        void push(const T& elem)
+        {
+            emplace(elem);
+        }
+
+        /**
+         * @brief Pushes an rvalue element into the priority queue.
+         *
+         * @param elem The element to be moved into the priority queue.
+         */
+        void push(T&& elem)
+        {
+            emplace(std::move(elem));
+        }
+
+        /**
+         * @brief Constructs an element in place in one of the shards.
+         *
+         * @tparam Args The constructor argument types.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, Args...>
+#endif
+        void emplace(Args&&... args)
+        {
+            shard& target = lock_any_shard();
+            std::scoped_lock<tools::critical_section> guard(std::adopt_lock, target.mutex);
+            target.heap.emplace(std::forward<Args>(args)...);
+            target.count.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Pushes a batch of elements into a single shard, under one lock and one heapify.
+         *
+         * @tparam InputIt Input iterator type.
+         * @param first Begin iterator.
+         * @param last End iterator.
+         */
+        template <typename InputIt>
+        void push_range(InputIt first, InputIt last)
+        {
+            shard& target = lock_any_shard();
+            std::scoped_lock<tools::critical_section> guard(std::adopt_lock, target.mutex);
+            const std::size_t old_size = target.heap.size();
+            target.heap.push_range(first, last);
+            target.count.fetch_add(target.heap.size() - old_size, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Pushes all elements from an initializer-list into a single shard.
+         *
+         * @param range The source initializer-list.
+         */
+        void push_range(std::initializer_list<T> range)
+        {
+            push_range(range.begin(), range.end());
+        }
+
+        /**
+         * @brief Retrieves and removes a top element: the better top of two random shards.
+         *
+         * @return The element, or none if every shard was empty.
+         */
+        [[nodiscard]] std::optional<T> top_pop()
+        {
+            return top_pop_move();
+        }
+
+        /**
+         * @brief Retrieves and removes a top element with move semantics.
+         *
+         * @return The moved element, or none if every shard was empty.
+         */
+        [[nodiscard]] std::optional<T> top_pop_move()
+        {
+            std::optional<T> item;
+            const auto has_room = [&item]() { return !item.has_value(); };
+            const auto store = [&item](T&& elem) { item = std::move(elem); };
+            static_cast<void>(pop_some(has_room, store));
+            return item;
+        }
+
+        /**
+         * @brief Pops a batch of elements, merging the tops of two random shards under their locks.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The number of elements extracted, fewer than requested only if the queue ran empty.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            const auto has_room = [&first, &last]() { return first != last; };
+            const auto store = [&first](T&& elem)
+            {
+                *first = std::move(elem);
+                ++first;
+            };
+
+            std::size_t popped_count = 0U;
+            while (has_room())
+            {
+                const std::size_t popped = pop_some(has_room, store);
+                if (0U == popped)
+                {
+                    break;
+                }
+                popped_count += popped;
+            }
+            return popped_count;
+        }
+
+        /**
+         * @brief Checks if every shard looks empty.
+         *
+         * @return true if no element is queued.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == size();
+        }
+
+        /**
+         * @brief Returns the number of queued elements, summed over the shards.
+         *
+         * @return The number of elements.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t total = 0U;
+            for (const auto& current : m_shards)
+            {
+                total += current.count.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+    private:
+        static constexpr const std::size_t cache_line_size = 64U;
+
+        struct alignas(cache_line_size) shard
+        {
+            tools::critical_section mutex;
+            dary_heap<T, Compare, Arity> heap;
+            std::atomic<std::size_t> count { 0U };
+        };
+
+        static std::size_t random_shard()
+        {
+            // xorshift32, one stream per thread seeded from the address of its state
+            static thread_local std::uint32_t state = 0U;
+            if (0U == state)
+            {
+                state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state)) | 1U;
+            }
+            state ^= state << 13U;
+            state ^= state >> 17U;
+            state ^= state << 5U;
+            return static_cast<std::size_t>(state) & (ShardCount - 1U);
+        }
+
+        /**
+         * @brief Locks the first shard available without waiting from a random start, or waits on the start.
+         */
+        shard& lock_any_shard()
+        {
+            const std::size_t start = random_shard();
+            for (std::size_t attempt = 0U; attempt < ShardCount; ++attempt)
+            {
+                shard& candidate = m_shards[(start + attempt) & (ShardCount - 1U)];
+                if (candidate.mutex.try_lock())
+                {
+                    return candidate;
+                }
+            }
+            shard& fallback = m_shards[start];
+            fallback.mutex.lock();
+            return fallback;
+        }
+
+        /**
+         * @brief Moves elements out of the better of two random shards, or else of any shard, while has_room().
+         */
+        template <typename HasRoom, typename Store>
+        std::size_t pop_some(const HasRoom& has_room, const Store& store)
+        {
+            const std::size_t first_index = random_shard();
+            const std::size_t second_index = (ShardCount > 1U)
+                ? ((first_index + 1U + (random_shard() % (ShardCount - 1U))) & (ShardCount - 1U))
+                : first_index;
+
+            std::size_t popped = 0U;
+            if (first_index != second_index)
+            {
+                shard& first_shard = m_shards[first_index];
+                shard& second_shard = m_shards[second_index];
+                std::scoped_lock<tools::critical_section, tools::critical_section> guard(
+                    first_shard.mutex, second_shard.mutex);
+                while (has_room() && !(first_shard.heap.empty() && second_shard.heap.empty()))
+                {
+                    const bool take_second = first_shard.heap.empty()
+                        || (!second_shard.heap.empty()
+                            && m_compare(first_shard.heap.top(), second_shard.heap.top()));
+                    shard& source = take_second ? second_shard : first_shard;
+                    store(source.heap.pop_move());
+                    source.count.fetch_sub(1U, std::memory_order_relaxed);
+                    ++popped;
+                }
+            }
+            if (0U != popped)
+            {
+                return popped;
+            }
+
+            // both samples empty: scan so that pops never miss queued elements
+            for (std::size_t offset = 0U; (offset < ShardCount) && (0U == popped); ++offset)
+            {
+                shard& current = m_shards[(first_index + offset) & (ShardCount - 1U)];
+                if (0U == current.count.load(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+                std::scoped_lock<tools::critical_section> guard(current.mutex);
+                while (has_room() && !current.heap.empty())
+                {
+                    store(current.heap.pop_move());
+                    current.count.fetch_sub(1U, std::memory_order_relaxed);
+                    ++popped;
+                }
+            }
+            return popped;
+        }
+
+        std::array<shard, ShardCount> m_shards {};
+        Compare m_compare {};
+    };
+}
+
+#endif //  SYNC_MULTI_PRIORITY_QUEUE_HPP_
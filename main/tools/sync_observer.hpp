@@ -39,24 +39,76 @@
 #if !defined(SYNC_OBSERVER_HPP_)
 #define SYNC_OBSERVER_HPP_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <span>
+#endif
 
+#include "tools/cond_var.hpp"
 #include "tools/critical_section.hpp"
+#include "tools/epoch_domain.hpp"
+#include "tools/fast_clock.hpp"
+#include "tools/latency_clock.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/object_pool.hpp"
+#include "tools/shared_critical_section.hpp"
+#include "tools/token_bucket.hpp"
+#include "tools/trace_ring.hpp"
 
 namespace tools
 {
     // https://juanchopanzacpp.wordpress.com/2013/02/24/simple-observer-pattern-implementation-c11/
     // http://www.codeproject.com/Articles/328365/Understanding-and-Implementing-Observer-Pattern
 
+    /**
+     * @brief Immutable event record shared by every observer of a single fan-out publish.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string>
+    struct event_envelope
+    {
+        Topic topic;
+        Evt event;
+        Origin origin;
+        latency_stamp published = 0U; //!< publish time when the subject stamps latencies, 0 otherwise
+    };
+
+    /**
+     * @brief Alias template for a shared, immutable event envelope handle.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string>
+    using shared_event_envelope = std::shared_ptr<const event_envelope<Topic, Evt, Origin>>;
+
+    /**
+     * @brief Backlog counters of an observer, as reported to the subjects it is subscribed to.
+     */
+    struct observer_backlog
+    {
+        std::size_t pending = 0U;      //!< events received and not yet taken by the consumer (the lag)
+        std::size_t peak_pending = 0U; //!< largest pending value observed, 0 when not tracked
+        std::size_t capacity = 0U;     //!< maximum number of pending events, 0 when unbounded
+        std::size_t dropped = 0U;      //!< events lost to the overflow policy (dropped, overwritten or timed out)
+    };
+
     /**
      * @brief A template class for synchronous observers.
      *
@@ -65,8 +117,9 @@ namespace tools
      *
      * @tparam Topic The type of the topic.
      * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
      */
-    template <typename Topic, typename Evt>
+    template <typename Topic, typename Evt, typename Origin = std::string>
     class sync_observer : public non_copyable // NOLINT inherits from a non copyable and non movable class
     {
     public:
@@ -89,7 +142,52 @@ namespace tools
          * @param event The event data.
          * @param origin The origin of the event.
          */
-        virtual void inform(const Topic& topic, const Evt& event, const std::string& origin) = 0;
+        virtual void inform(const Topic& topic, const Evt& event, const Origin& origin) = 0;
+
+        /**
+         * @brief Inform the observer about an event carried by a shared envelope.
+         *
+         * Called by sync_subject::publish_shared. The default implementation forwards the envelope fields to
+         * inform(); observers that queue events can override it to keep the handle instead of copying.
+         *
+         * @param envelope The shared, immutable event envelope.
+         */
+        virtual void inform_shared(const shared_event_envelope<Topic, Evt, Origin>& envelope)
+        {
+            inform(envelope->topic, envelope->event, envelope->origin);
+        }
+
+        /**
+         * @brief Inform the observer about a batch of events of the same topic.
+         *
+         * Called by sync_subject::publish_range. The default implementation calls inform() for each event;
+         * queueing observers can override it to enqueue the whole batch at once.
+         *
+         * @param topic The topic of the events.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         * @param origin The origin of the events.
+         */
+        virtual void inform_range(const Topic& topic, const Evt* events, std::size_t count, const Origin& origin)
+        {
+            for (std::size_t i = 0U; i < count; ++i)
+            {
+                inform(topic, events[i], origin); // NOLINT pointer arithmetic
+            }
+        }
+
+        /**
+         * @brief Reports the backlog of the observer.
+         *
+         * Synchronous observers handle the event inside inform() and have no backlog; queueing observers override
+         * this so that subjects can detect slow consumers.
+         *
+         * @return The backlog counters.
+         */
+        virtual observer_backlog backlog()
+        {
+            return {};
+        }
     };
 
     /**
@@ -100,21 +198,64 @@ namespace tools
      *
      * @tparam Topic The type of the topic.
      * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
      */
-    template <typename Topic, typename Evt>
-    using sync_subscription = std::pair<Topic, std::shared_ptr<sync_observer<Topic, Evt>>>;
+    template <typename Topic, typename Evt, typename Origin = std::string>
+    using sync_subscription = std::pair<Topic, std::shared_ptr<sync_observer<Topic, Evt, Origin>>>;
 
     /**
      * @brief Alias template for a loosely coupled event handler.
      *
      * This alias template defines a type for a function that handles events in a loosely coupled manner.
-     * The handler function takes three parameters: a reference to a Topic, a reference to an Evt, and a string.
+     * The handler function takes three parameters: a reference to a Topic, a reference to an Evt, and an Origin.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string>
+    using loose_coupled_handler = std::function<void(const Topic&, const Evt&, const Origin&)>;
+
+    /**
+     * @brief Alias template for a content filter evaluated by the subject before informing an observer.
+     *
+     * The predicate runs on the publisher side, under the subscription lock: it should be cheap, must not block
+     * and must not (un)subscribe on the same subject.
      *
      * @tparam Topic The type of the topic.
      * @tparam Evt The type of the event.
      */
     template <typename Topic, typename Evt>
-    using loose_coupled_handler = std::function<void(const Topic&, const Evt&, const std::string&)>;
+    using event_predicate = std::function<bool(const Topic&, const Evt&)>;
+
+    /**
+     * @brief Selects how a sync_subject resolves the receivers of a published event.
+     */
+    enum class subject_dispatch_policy : std::uint8_t
+    {
+        /**
+         * @brief Scan the subscription tables under lock and copy the receivers on every publish (default).
+         */
+        copy_on_publish,
+
+        /**
+         * @brief Publish from an immutable per-topic dispatch table rebuilt on subscribe/unsubscribe.
+         *
+         * Publishing only copies the current table pointer under lock, then walks the topic receivers without
+         * any heap allocation. Subscription changes pay the table rebuild cost.
+         */
+        snapshot,
+
+        /**
+         * @brief Publish from an immutable dispatch table reclaimed through an epoch_domain.
+         *
+         * Like snapshot, but publishing takes no lock and touches no reference count: the table pointer is read
+         * inside an epoch guard and the receivers are informed through the references held by the table. A table
+         * replaced by a subscription change, and the observers only it still references, are released once the
+         * publishes that could use it have returned.
+         */
+        epoch
+    };
 
     /**
      * @brief A class that represents a synchronous subject in the publish-subscribe pattern.
@@ -124,27 +265,60 @@ namespace tools
      *
      * @tparam Topic The type of the topic.
      * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
      */
-    template <typename Topic, typename Evt>
+    template <typename Topic, typename Evt, typename Origin = std::string>
     class sync_subject : public non_copyable // NOLINT inherits from non copyable and non movable class
     {
     public:
-        using sync_observer_shared_ptr = std::shared_ptr<sync_observer<Topic, Evt>>;
-        using handler = loose_coupled_handler<Topic, Evt>;
+        using sync_observer_shared_ptr = std::shared_ptr<sync_observer<Topic, Evt, Origin>>;
+        using handler = loose_coupled_handler<Topic, Evt, Origin>;
+        using predicate = event_predicate<Topic, Evt>;
+        using envelope_type = event_envelope<Topic, Evt, Origin>;
+        using envelope_ptr = shared_event_envelope<Topic, Evt, Origin>;
 
         sync_subject() = delete;
 
         /**
-         * @brief Constructs a sync_subject with the given name.
+         * @brief Constructs a sync_subject with the given name, also used as origin when Origin is a string type.
+         *
+         * @param name The name of the sync_subject.
+         * @param policy The dispatch policy used by publish.
+         */
+        template <typename UOrigin = Origin,
+            typename = std::enable_if_t<std::is_constructible_v<UOrigin, const std::string&>>>
+        explicit sync_subject(
+            std::string name, subject_dispatch_policy policy = subject_dispatch_policy::copy_on_publish)
+            : m_name { std::move(name) }
+            , m_origin(m_name)
+            , m_dispatch_policy { policy }
+            , m_epoch((policy == subject_dispatch_policy::epoch) ? std::make_unique<epoch_domain<>>() : nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructs a sync_subject with the given name and an explicit origin value.
+         *
+         * Used with compact origin types such as an origin_id interned in an origin_registry, so that
+         * observers receive the handle rather than a copy of the name.
          *
          * @param name The name of the sync_subject.
+         * @param origin The origin value handed to observers and handlers on publish.
+         * @param policy The dispatch policy used by publish.
          */
-        explicit sync_subject(std::string name)
+        sync_subject(std::string name, Origin origin,
+            subject_dispatch_policy policy = subject_dispatch_policy::copy_on_publish)
             : m_name { std::move(name) }
+            , m_origin(std::move(origin))
+            , m_dispatch_policy { policy }
+            , m_epoch((policy == subject_dispatch_policy::epoch) ? std::make_unique<epoch_domain<>>() : nullptr)
         {
         }
 
-        virtual ~sync_subject() = default;
+        virtual ~sync_subject()
+        {
+            delete m_epoch_table.load(std::memory_order_relaxed); // NOLINT owning raw pointer of the epoch policy
+        }
 
         /**
          * @brief Get the name of the observer.
@@ -156,6 +330,26 @@ namespace tools
             return m_name;
         }
 
+        /**
+         * @brief Get the origin value handed to observers on publish.
+         *
+         * @return const Origin& The origin of the events published by this subject.
+         */
+        [[nodiscard]] const Origin& origin() const
+        {
+            return m_origin;
+        }
+
+        /**
+         * @brief Get the dispatch policy selected at construction.
+         *
+         * @return subject_dispatch_policy The dispatch policy used by publish.
+         */
+        [[nodiscard]] subject_dispatch_policy dispatch_policy() const
+        {
+            return m_dispatch_policy;
+        }
+
         /**
          * @brief Subscribes an observer to a specific topic.
          *
@@ -164,8 +358,9 @@ namespace tools
          */
         void subscribe(const Topic& topic, sync_observer_shared_ptr observer)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            m_subscribers.insert({ topic, observer });
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            m_subscribers.insert({ topic, subscription { std::move(observer), nullptr } });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -178,8 +373,9 @@ namespace tools
          */
         void subscribe(Topic&& topic, sync_observer_shared_ptr observer)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            m_subscribers.insert({ std::move(topic), std::move(observer) });
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            m_subscribers.insert({ std::move(topic), subscription { std::move(observer), nullptr } });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -201,8 +397,27 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<Topic, UTopic>::value, void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            m_subscribers.insert({ Topic(std::forward<UTopic>(topic)), std::move(observer) });
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            m_subscribers.insert({ Topic(std::forward<UTopic>(topic)), subscription { std::move(observer), nullptr } });
+            refresh_dispatch_snapshot();
+        }
+
+        /**
+         * @brief Subscribes an observer to the events of a topic accepted by a content filter.
+         *
+         * The filter is evaluated by publish before informing the observer: a rejected event is neither copied
+         * into the observer nor wakes it up, and is counted by filtered_informs().
+         *
+         * @param topic The topic to which the observer wants to subscribe.
+         * @param observer The observer that wants to subscribe to the topic.
+         * @param filter The predicate selecting the events to inform the observer of; empty to accept them all.
+         */
+        void subscribe(const Topic& topic, sync_observer_shared_ptr observer, predicate filter)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            auto shared_filter = filter ? std::make_shared<const predicate>(std::move(filter)) : nullptr;
+            m_subscribers.insert({ topic, subscription { std::move(observer), std::move(shared_filter) } });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -217,8 +432,9 @@ namespace tools
          */
         void subscribe(const Topic& topic, const std::string& handler_name, handler handler)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_handlers.insert({ topic, std::make_pair(handler_name, handler) });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -232,8 +448,9 @@ namespace tools
          */
         void subscribe(Topic&& topic, std::string&& handler_name, handler&& handler_fn)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_handlers.insert({ std::move(topic), std::make_pair(std::move(handler_name), std::move(handler_fn)) });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -262,10 +479,11 @@ namespace tools
                 void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
             m_handlers.insert({ Topic(std::forward<UTopic>(topic)),
                 std::make_pair(
                     std::string(std::forward<UName>(handler_name)), handler(std::forward<UHandler>(handler_fn))) });
+            refresh_dispatch_snapshot();
         }
 
         /**
@@ -278,13 +496,14 @@ namespace tools
          */
         void unsubscribe(const Topic& topic, sync_observer_shared_ptr observer)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
 
             for (auto [itr, range_end] = m_subscribers.equal_range(topic); itr != range_end; ++itr)
             {
-                if (itr->second == observer)
+                if (itr->second.observer == observer)
                 {
                     m_subscribers.erase(itr);
+                    refresh_dispatch_snapshot();
                     break;
                 }
             }
@@ -301,13 +520,14 @@ namespace tools
          */
         void unsubscribe(const Topic& topic, const std::string& handler_name)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
 
             for (auto [itr, range_end] = m_handlers.equal_range(topic); itr != range_end; ++itr)
             {
                 if (itr->second.first == handler_name)
                 {
                     m_handlers.erase(itr);
+                    refresh_dispatch_snapshot();
                     break;
                 }
             }
@@ -353,18 +573,698 @@ namespace tools
             do_publish(converted_topic, converted_event);
         }
 
+        /**
+         * @brief Publishes an event through a single shared envelope to all subscribers of the given topic.
+         *
+         * One immutable envelope holding the topic, event and subject name is allocated per call (through the
+         * global allocator, hence the mem pool allocator when enabled) and handed to every observer via
+         * sync_observer::inform_shared, so queueing observers can store the handle instead of copying the payload.
+         * Handlers receive the envelope fields.
+         *
+         * @tparam UTopic The deduced topic type.
+         * @tparam UEvt The deduced event type.
+         * @param topic The topic to publish the event to.
+         * @param event The event to be published.
+         */
+        template <typename UTopic, typename UEvt>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<Topic, UTopic> && std::is_constructible_v<Evt, UEvt>
+#endif
+        auto publish_shared(UTopic&& topic, UEvt&& event)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<
+                std::is_constructible<Topic, UTopic>::value && std::is_constructible<Evt, UEvt>::value, void>::type
+#endif
+        {
+            const envelope_ptr envelope = std::make_shared<envelope_type>(envelope_type {
+                Topic(std::forward<UTopic>(topic)), Evt(std::forward<UEvt>(event)), m_origin, publish_stamp() });
+            do_publish_shared(envelope);
+        }
+
+        /**
+         * @brief Publishes an event through a single shared envelope taken from an envelope pool.
+         *
+         * Same as publish_shared, except that the envelope and its reference counts live in a slot of the pool,
+         * without going through the global allocator; the envelope is heap allocated when the pool is exhausted.
+         * The pool must outlive the envelopes, including those still queued by async observers.
+         *
+         * @tparam N The capacity of the pool.
+         * @tparam UTopic The deduced topic type.
+         * @tparam UEvt The deduced event type.
+         * @param pool The envelope pool.
+         * @param topic The topic to publish the event to.
+         * @param event The event to be published.
+         */
+        template <std::size_t N, typename UTopic, typename UEvt>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<Topic, UTopic> && std::is_constructible_v<Evt, UEvt>
+#endif
+        auto publish_pooled(shared_object_pool<envelope_type, N>& pool, UTopic&& topic, UEvt&& event)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<
+                std::is_constructible<Topic, UTopic>::value && std::is_constructible<Evt, UEvt>::value, void>::type
+#endif
+        {
+            envelope_type fields { Topic(std::forward<UTopic>(topic)), Evt(std::forward<UEvt>(event)), m_origin,
+                publish_stamp() };
+            envelope_ptr envelope = pool.make_shared(std::move(fields));
+
+            if (!envelope)
+            {
+                // an exhausted pool did not construct anything, the fields are intact
+                envelope = std::make_shared<envelope_type>(std::move(fields)); // NOLINT(bugprone-use-after-move)
+            }
+
+            do_publish_shared(envelope);
+        }
+
+        /**
+         * @brief Publishes a batch of events to the subscribers and handlers of the given topic.
+         *
+         * The receivers are resolved once for the whole batch, and each observer gets the batch through a single
+         * sync_observer::inform_range call. Observers subscribed with a content filter are informed one event at
+         * a time of the accepted events, lagging observers skip the whole batch, and handlers are invoked once
+         * per event.
+         *
+         * @param topic The topic to publish the events to.
+         * @param events The events, oldest first.
+         * @param count The number of events.
+         */
+        void publish_range(const Topic& topic, const Evt* events, std::size_t count)
+        {
+            if (0U == count)
+            {
+                return;
+            }
+
+            if (!admitted(topic, events[count - 1U], count)) // NOLINT pointer arithmetic
+            {
+                return;
+            }
+
+            TOOLS_TRACE(publish, "sync_subject::publish_range", this, 0U);
+            const std::size_t max_lag = m_max_subscriber_lag.load(std::memory_order_relaxed);
+
+            auto on_receiver = [&](const subscription& receiver)
+            {
+                if ((0U != max_lag) && (receiver.observer->backlog().pending >= max_lag))
+                {
+                    m_skipped_informs.fetch_add(count, std::memory_order_relaxed);
+                    return;
+                }
+
+                if (!receiver.filter)
+                {
+                    receiver.observer->inform_range(topic, events, count, m_origin);
+                    return;
+                }
+
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    if (accepts(receiver, topic, events[i])) // NOLINT pointer arithmetic
+                    {
+                        receiver.observer->inform(topic, events[i], m_origin); // NOLINT pointer arithmetic
+                    }
+                }
+            };
+
+            auto on_handler = [&](const handler& handler_fn)
+            {
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    handler_fn(topic, events[i], m_origin); // NOLINT pointer arithmetic
+                }
+            };
+
+            visit_receivers(topic, on_receiver, on_handler);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch publish.
+         *
+         * @param topic The topic to publish the events to.
+         * @param events The events, oldest first.
+         */
+        void publish_range(const Topic& topic, std::span<const Evt> events)
+        {
+            publish_range(topic, events.data(), events.size());
+        }
+#endif
+
+        /**
+         * @brief Subscriber of the subject together with its backlog, as returned by slow_subscribers().
+         */
+        struct subscriber_backlog
+        {
+            Topic topic;
+            sync_observer_shared_ptr observer;
+            observer_backlog backlog;
+        };
+
+        /**
+         * @brief Skips the observers lagging behind when publishing.
+         *
+         * While set, an observer whose pending backlog reached max_pending is not informed of new events, so
+         * that one stuck consumer cannot make the others pay for it; skipped informs are counted by
+         * skipped_informs(). Handlers are always invoked.
+         *
+         * @param max_pending The backlog from which observers are skipped, 0 (the default) to inform all of them.
+         */
+        void set_max_subscriber_lag(std::size_t max_pending)
+        {
+            m_max_subscriber_lag.store(max_pending, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Stamps the envelopes of publish_shared and publish_pooled with their publish time.
+         *
+         * Stamping costs one latency_clock read per publish. Observers recording delivery latencies, such as
+         * async_envelope_observer, ignore unstamped envelopes.
+         *
+         * @param enabled true to stamp the envelopes, false (the default) to leave them unstamped.
+         */
+        void set_latency_stamping(bool enabled)
+        {
+            m_latency_stamping.store(enabled, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of informs skipped because the observer was lagging behind.
+         *
+         * @return The skipped inform count since construction.
+         */
+        [[nodiscard]] std::size_t skipped_informs() const
+        {
+            return m_skipped_informs.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of informs avoided because the subscription filter rejected the event.
+         *
+         * @return The filtered inform count since construction.
+         */
+        [[nodiscard]] std::size_t filtered_informs() const
+        {
+            return m_filtered_informs.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Limits the publish rate of a topic, replacing any previous limit of the topic.
+         *
+         * Publishes of the topic take tokens from a lock-free token bucket; once it is empty, the events are shed
+         * according to the policy of the limit: dropped, sampled one in sample_every, or conflated, that is held
+         * as the latest event of the topic until flush_conflated() delivers it. A batch publish takes one token
+         * per event and is shed as a whole, keeping its last event when conflated.
+         *
+         * @param topic The topic to limit.
+         * @param limit The rate, burst and shed policy.
+         */
+        void set_rate_limit(const Topic& topic, const rate_limit& limit)
+        {
+            std::unique_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            m_topic_limits.insert_or_assign(topic, std::make_unique<load_shedder>(limit));
+            m_rate_limited.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Removes the rate limit of a topic.
+         *
+         * @param topic The topic to release.
+         */
+        void clear_rate_limit(const Topic& topic)
+        {
+            std::unique_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            m_topic_limits.erase(topic);
+            m_rate_limited.store(!m_topic_limits.empty() || m_publisher_limit, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Limits the publish rate of the whole subject, all topics together.
+         *
+         * Checked after the limit of the topic, if any: an event shed by its topic takes no publisher token. When
+         * conflating, the latest event of each topic is held, and flushed only once both limits have a token.
+         *
+         * @param limit The rate, burst and shed policy.
+         */
+        void set_publisher_rate_limit(const rate_limit& limit)
+        {
+            std::unique_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            m_publisher_limit = std::make_unique<load_shedder>(limit);
+            m_rate_limited.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Removes the rate limit of the whole subject.
+         */
+        void clear_publisher_rate_limit()
+        {
+            std::unique_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            m_publisher_limit.reset();
+            m_rate_limited.store(!m_topic_limits.empty(), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the counters of the rate limit of a topic.
+         *
+         * @param topic The topic.
+         * @return The counters since the limit was set, or std::nullopt if the topic is not limited.
+         */
+        [[nodiscard]] std::optional<rate_limit_counters> rate_limit_stats(const Topic& topic) const
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            const auto limiter = m_topic_limits.find(topic);
+            if (limiter == m_topic_limits.end())
+            {
+                return std::nullopt;
+            }
+
+            return limiter->second->counters();
+        }
+
+        /**
+         * @brief Returns the counters of the rate limit of the whole subject.
+         *
+         * @return The counters since the limit was set, or std::nullopt if the subject is not limited.
+         */
+        [[nodiscard]] std::optional<rate_limit_counters> publisher_rate_limit_stats() const
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            if (!m_publisher_limit)
+            {
+                return std::nullopt;
+            }
+
+            return m_publisher_limit->counters();
+        }
+
+        /**
+         * @brief Delivers the conflated events whose limits have tokens again.
+         *
+         * Meant to be called periodically, for instance from a periodic_task, so that the latest state of a
+         * throttled topic is eventually delivered even if its publisher went quiet. Events that still exceed
+         * their limits stay held. An event is taken from its slot only once its tokens are granted, and while it
+         * is delivered a newer event of its topic waits for it, so the held event never overtakes a newer one.
+         *
+         * @return The number of events delivered.
+         */
+        std::size_t flush_conflated()
+        {
+            if (0U == m_conflated_pending.load(std::memory_order_relaxed))
+            {
+                return 0U;
+            }
+
+            const auto now = fast_clock::now();
+            std::size_t delivered = 0U;
+            std::unique_lock<critical_section> guard(m_conflated_mutex);
+            auto held = m_conflated.begin();
+
+            while (held != m_conflated.end())
+            {
+                // a topic already delivered by another flush keeps its newer held event for the next one
+                if ((m_flushing.count(held->first) != 0U) || !released(held->first, now))
+                {
+                    ++held;
+                    continue;
+                }
+
+                const Topic topic = held->first;
+                const Evt event = std::move(held->second);
+                m_conflated.erase(held);
+                m_flushing.emplace(topic, detail::current_trace_task());
+                guard.unlock();
+#if defined(CPP_EXCEPTIONS_ENABLED)
+                try
+                {
+                    deliver(topic, event);
+                }
+                catch (...)
+                {
+                    guard.lock();
+                    end_flushing(topic);
+                    throw;
+                }
+#else
+                deliver(topic, event);
+#endif
+                guard.lock();
+                end_flushing(topic);
+                ++delivered;
+                held = m_conflated.upper_bound(topic);
+            }
+
+            return delivered;
+        }
+
+        /**
+         * @brief Returns the number of topics holding a conflated event, including those being flushed.
+         *
+         * @return The held event count.
+         */
+        [[nodiscard]] std::size_t conflated_pending() const
+        {
+            return m_conflated_pending.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Lists the subscribed observers that lag behind or lost events.
+         *
+         * @param min_pending The backlog from which an observer is reported; observers that dropped events are
+         * always reported.
+         * @return One entry per slow (topic, observer) subscription, in topic order.
+         */
+        std::vector<subscriber_backlog> slow_subscribers(std::size_t min_pending)
+        {
+            std::vector<subscriber_backlog> slow;
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+
+            for (const auto& [topic, receiver] : m_subscribers)
+            {
+                const observer_backlog counters = receiver.observer->backlog();
+                if ((counters.pending >= min_pending) || (0U != counters.dropped))
+                {
+                    slow.push_back(subscriber_backlog { topic, receiver.observer, counters });
+                }
+            }
+
+            return slow;
+        }
+
     private:
+        /**
+         * @brief A subscribed observer and its optional content filter, shared so that batches can copy it.
+         */
+        struct subscription
+        {
+            sync_observer_shared_ptr observer;
+            std::shared_ptr<const predicate> filter;
+        };
+
+        /**
+         * @brief Receivers of a single topic, in subscription order.
+         */
+        struct topic_receivers
+        {
+            std::vector<subscription> observers;
+            std::vector<handler> handlers;
+        };
+
+        using dispatch_table = std::map<Topic, topic_receivers>;
+
         void do_publish(const Topic& topic, const Evt& event)
+        {
+            if (admitted(topic, event, 1U))
+            {
+                deliver(topic, event);
+            }
+        }
+
+        void deliver(const Topic& topic, const Evt& event)
+        {
+            TOOLS_TRACE(publish, "sync_subject::publish", this, 0U);
+            dispatch(
+                topic, event,
+                [&](const sync_observer_shared_ptr& observer) { observer->inform(topic, event, m_origin); },
+                [&](const handler& handler_fn) { handler_fn(topic, event, m_origin); });
+        }
+
+        latency_stamp publish_stamp() const
+        {
+            return m_latency_stamping.load(std::memory_order_relaxed) ? latency_clock::now() : latency_stamp { 0U };
+        }
+
+        void do_publish_shared(const envelope_ptr& envelope)
+        {
+            if (!admitted(envelope->topic, envelope->event, 1U))
+            {
+                return;
+            }
+
+            TOOLS_TRACE(publish, "sync_subject::publish_shared", this, 0U);
+            dispatch(
+                envelope->topic, envelope->event,
+                [&](const sync_observer_shared_ptr& observer) { observer->inform_shared(envelope); },
+                [&](const handler& handler_fn) { handler_fn(envelope->topic, envelope->event, envelope->origin); });
+        }
+
+        /**
+         * @brief Applies the rate limits of the topic and of the subject to events about to be published.
+         *
+         * @return true if the events are to be delivered; otherwise they were dropped or their latest was held.
+         */
+        bool admitted(const Topic& topic, const Evt& latest, std::size_t count)
+        {
+            if (!m_rate_limited.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+
+            const auto now = fast_clock::now();
+            shed_verdict verdict = shed_verdict::deliver;
+
+            {
+                std::shared_lock<tools::shared_critical_section> guard(m_limit_mutex);
+                const auto limiter = m_topic_limits.find(topic);
+                if (limiter != m_topic_limits.end())
+                {
+                    verdict = limiter->second->admit(count, now);
+                }
+
+                if ((shed_verdict::deliver == verdict) && m_publisher_limit)
+                {
+                    verdict = m_publisher_limit->admit(count, now);
+                }
+            }
+
+            if ((shed_verdict::drop == verdict)
+                || ((shed_verdict::deliver == verdict) && (0U == m_conflated_pending.load(std::memory_order_relaxed))))
+            {
+                return shed_verdict::deliver == verdict;
+            }
+
+            // a delivered event supersedes the held one, a conflated event replaces it
+            std::unique_lock<critical_section> guard(m_conflated_mutex);
+            if (shed_verdict::deliver == verdict)
+            {
+                // the held event of the topic being flushed goes first, unless this publish comes from its delivery
+                m_flushed.wait(guard,
+                    [this, &topic]()
+                    {
+                        const auto flushing = m_flushing.find(topic);
+                        return (flushing == m_flushing.end()) || (flushing->second == detail::current_trace_task());
+                    });
+            }
+            m_conflated.erase(topic);
+            if (shed_verdict::conflate == verdict)
+            {
+                m_conflated.emplace(topic, latest);
+            }
+            m_conflated_pending.store(m_conflated.size() + m_flushing.size(), std::memory_order_relaxed);
+
+            return shed_verdict::deliver == verdict;
+        }
+
+        /**
+         * @brief Ends the delivery of a flushed event; must be called with m_conflated_mutex held.
+         */
+        void end_flushing(const Topic& topic)
+        {
+            m_flushing.erase(topic);
+            m_conflated_pending.store(m_conflated.size() + m_flushing.size(), std::memory_order_relaxed);
+            m_flushed.notify_all();
+        }
+
+        /**
+         * @brief Takes the tokens needed to deliver a conflated event of a topic, from both limits or from neither.
+         */
+        bool released(const Topic& topic, fast_clock::time_point now)
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_limit_mutex);
+            const auto limiter = m_topic_limits.find(topic);
+            load_shedder* topic_limit = (limiter != m_topic_limits.end()) ? limiter->second.get() : nullptr;
+            load_shedder* publisher_limit = m_publisher_limit.get();
+
+            if (((nullptr != topic_limit) && !topic_limit->can_release(now))
+                || ((nullptr != publisher_limit) && !publisher_limit->can_release(now)))
+            {
+                return false;
+            }
+
+            if ((nullptr != topic_limit) && !topic_limit->try_release(now))
+            {
+                return false;
+            }
+
+            if ((nullptr != publisher_limit) && !publisher_limit->try_release(now))
+            {
+                // a concurrent publish took the last publisher token meanwhile
+                if (nullptr != topic_limit)
+                {
+                    topic_limit->cancel_release();
+                }
+                return false;
+            }
+
+            return true;
+        }
+
+        template <typename ObserverFn, typename HandlerFn>
+        void dispatch(const Topic& topic, const Evt& event, ObserverFn&& on_observer, HandlerFn&& on_handler)
+        {
+            const std::size_t max_lag = m_max_subscriber_lag.load(std::memory_order_relaxed);
+
+            if (0U != max_lag)
+            {
+                auto unless_lagging = [&](const sync_observer_shared_ptr& observer)
+                {
+                    if (observer->backlog().pending >= max_lag)
+                    {
+                        m_skipped_informs.fetch_add(1U, std::memory_order_relaxed);
+                        return;
+                    }
+                    on_observer(observer);
+                };
+                dispatch_by_policy(topic, event, unless_lagging, on_handler);
+            }
+            else
+            {
+                dispatch_by_policy(topic, event, on_observer, on_handler);
+            }
+        }
+
+        template <typename ObserverFn, typename HandlerFn>
+        void dispatch_by_policy(const Topic& topic, const Evt& event, ObserverFn& on_observer, HandlerFn& on_handler)
+        {
+            if (m_dispatch_policy == subject_dispatch_policy::snapshot)
+            {
+                dispatch_from_snapshot(topic, event, on_observer, on_handler);
+            }
+            else if (m_dispatch_policy == subject_dispatch_policy::epoch)
+            {
+                dispatch_from_epoch(topic, event, on_observer, on_handler);
+            }
+            else
+            {
+                dispatch_from_copies(topic, event, on_observer, on_handler);
+            }
+        }
+
+        /**
+         * @brief Evaluates the content filter of a subscription, counting the rejected events.
+         */
+        bool accepts(const subscription& receiver, const Topic& topic, const Evt& event)
+        {
+            if (!receiver.filter || (*receiver.filter)(topic, event))
+            {
+                return true;
+            }
+
+            m_filtered_informs.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+
+        /**
+         * @brief Calls the functions for every subscription and handler of a topic, outside of the lock.
+         *
+         * Used by the batch publish: the subscriptions are copied with their shared filter, which is then
+         * evaluated outside of the lock, once per event.
+         */
+        template <typename ReceiverFn, typename HandlerFn>
+        void visit_receivers(const Topic& topic, ReceiverFn& on_receiver, HandlerFn& on_handler)
+        {
+            if (m_dispatch_policy == subject_dispatch_policy::epoch)
+            {
+                const epoch_domain<>::guard reader(*m_epoch);
+                const dispatch_table* current = m_epoch_table.load(std::memory_order_seq_cst);
+                if (nullptr != current)
+                {
+                    visit_table(*current, topic, on_receiver, on_handler);
+                }
+                return;
+            }
+
+            std::shared_ptr<const dispatch_table> table;
+            std::vector<subscription> to_inform;
+            std::vector<handler> to_invoke;
+
+            {
+                std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+
+                if (m_dispatch_policy == subject_dispatch_policy::snapshot)
+                {
+                    table = m_dispatch_snapshot;
+                }
+                else
+                {
+                    for (auto [itr, range_end] = m_subscribers.equal_range(topic); itr != range_end; ++itr)
+                    {
+                        to_inform.push_back(itr->second);
+                    }
+
+                    for (auto [itr, range_end] = m_handlers.equal_range(topic); itr != range_end; ++itr)
+                    {
+                        to_invoke.emplace_back(itr->second.second);
+                    }
+                }
+            }
+
+            if (table)
+            {
+                visit_table(*table, topic, on_receiver, on_handler);
+                return;
+            }
+
+            for (const auto& receiver : to_inform)
+            {
+                on_receiver(receiver);
+            }
+
+            for (const auto& handler_fn : to_invoke)
+            {
+                on_handler(handler_fn);
+            }
+        }
+
+        /**
+         * @brief Calls the functions for every subscription and handler of a topic in an immutable dispatch table.
+         */
+        template <typename ReceiverFn, typename HandlerFn>
+        static void visit_table(
+            const dispatch_table& table, const Topic& topic, ReceiverFn& on_receiver, HandlerFn& on_handler)
+        {
+            const auto receivers = table.find(topic);
+            if (receivers == table.end())
+            {
+                return;
+            }
+
+            for (const auto& receiver : receivers->second.observers)
+            {
+                on_receiver(receiver);
+            }
+
+            for (const auto& handler_fn : receivers->second.handlers)
+            {
+                on_handler(handler_fn);
+            }
+        }
+
+        template <typename ObserverFn, typename HandlerFn>
+        void dispatch_from_copies(const Topic& topic, const Evt& event, ObserverFn& on_observer, HandlerFn& on_handler)
         {
             std::vector<sync_observer_shared_ptr> to_inform;
             std::vector<handler> to_invoke;
 
             {
-                std::scoped_lock<tools::critical_section> guard(m_mutex);
+                std::shared_lock<tools::shared_critical_section> guard(m_mutex);
 
                 for (auto [itr, range_end] = m_subscribers.equal_range(topic); itr != range_end; ++itr)
                 {
-                    to_inform.push_back(itr->second);
+                    if (accepts(itr->second, topic, event))
+                    {
+                        to_inform.push_back(itr->second.observer);
+                    }
                 }
 
                 for (auto [itr, range_end] = m_handlers.equal_range(topic); itr != range_end; ++itr)
@@ -373,21 +1273,121 @@ namespace tools
                 }
             }
 
-            for (auto& observer : to_inform)
+            for (const auto& observer : to_inform)
+            {
+                on_observer(observer);
+            }
+
+            for (const auto& handler_fn : to_invoke)
+            {
+                on_handler(handler_fn);
+            }
+        }
+
+        template <typename ObserverFn, typename HandlerFn>
+        void dispatch_from_snapshot(
+            const Topic& topic, const Evt& event, ObserverFn& on_observer, HandlerFn& on_handler)
+        {
+            std::shared_ptr<const dispatch_table> table;
+
+            {
+                std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+                table = m_dispatch_snapshot;
+            }
+
+            if (!table)
+            {
+                return;
+            }
+
+            // The table is immutable and kept alive by the local reference, so receivers may (un)subscribe safely.
+            auto when_accepted = [&](const subscription& receiver)
+            {
+                if (accepts(receiver, topic, event))
+                {
+                    on_observer(receiver.observer);
+                }
+            };
+            visit_table(*table, topic, when_accepted, on_handler);
+        }
+
+        template <typename ObserverFn, typename HandlerFn>
+        void dispatch_from_epoch(const Topic& topic, const Evt& event, ObserverFn& on_observer, HandlerFn& on_handler)
+        {
+            // The guard keeps the table, hence its observers, alive without touching their reference counts.
+            const epoch_domain<>::guard reader(*m_epoch);
+            const dispatch_table* table = m_epoch_table.load(std::memory_order_seq_cst);
+
+            if (nullptr == table)
+            {
+                return;
+            }
+
+            auto when_accepted = [&](const subscription& receiver)
+            {
+                if (accepts(receiver, topic, event))
+                {
+                    on_observer(receiver.observer);
+                }
+            };
+            visit_table(*table, topic, when_accepted, on_handler);
+        }
+
+        /**
+         * @brief Rebuilds the immutable dispatch table in snapshot and epoch modes; must be called with m_mutex held.
+         */
+        void refresh_dispatch_snapshot()
+        {
+            if (m_dispatch_policy == subject_dispatch_policy::snapshot)
+            {
+                auto table = std::make_shared<dispatch_table>();
+                fill_dispatch_table(*table);
+                m_dispatch_snapshot = std::move(table);
+            }
+            else if (m_dispatch_policy == subject_dispatch_policy::epoch)
+            {
+                auto table = std::make_unique<dispatch_table>();
+                fill_dispatch_table(*table);
+                // publishes entering after the exchange only see the new table, the others delay the reclaim
+                m_epoch->retire(m_epoch_table.exchange(table.release(), std::memory_order_seq_cst));
+            }
+        }
+
+        void fill_dispatch_table(dispatch_table& table) const
+        {
+            for (const auto& [topic, receiver] : m_subscribers)
             {
-                observer->inform(topic, event, m_name);
+                table[topic].observers.push_back(receiver);
             }
 
-            for (auto& handler : to_invoke)
+            for (const auto& [topic, named_handler] : m_handlers)
             {
-                handler(topic, event, m_name);
+                table[topic].handlers.push_back(named_handler.second);
             }
         }
 
-        critical_section m_mutex;
-        std::multimap<Topic, sync_observer_shared_ptr> m_subscribers;
+        shared_critical_section m_mutex;
+        std::multimap<Topic, subscription> m_subscribers;
         std::multimap<Topic, std::pair<std::string, handler>> m_handlers;
         std::string m_name;
+        Origin m_origin;
+        subject_dispatch_policy m_dispatch_policy;
+        std::shared_ptr<const dispatch_table> m_dispatch_snapshot;
+        std::unique_ptr<epoch_domain<>> m_epoch; // only allocated by the epoch policy
+        std::atomic<const dispatch_table*> m_epoch_table { nullptr };
+        std::atomic<std::size_t> m_max_subscriber_lag { 0U };
+        std::atomic<std::size_t> m_skipped_informs { 0U };
+        std::atomic<std::size_t> m_filtered_informs { 0U };
+        std::atomic<bool> m_latency_stamping { false };
+        mutable shared_critical_section m_limit_mutex;
+        std::map<Topic, std::unique_ptr<load_shedder>> m_topic_limits;
+        std::unique_ptr<load_shedder> m_publisher_limit;
+        std::atomic<bool> m_rate_limited { false };
+        critical_section m_conflated_mutex;
+        std::map<Topic, Evt> m_conflated;
+        std::map<Topic, const void*> m_flushing; // topics whose held event is being delivered, and the flushing task
+        cond_var m_flushed;                      // notified when a flushed event was delivered
+        std::atomic<std::size_t> m_conflated_pending { 0U };
     };
 
 }
@@ -41,6 +41,9 @@
 #define SYNC_PRIORITY_QUEUE_HPP_
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
@@ -57,10 +60,30 @@
 #endif
 
 #include "tools/critical_section.hpp"
+#include "tools/dary_heap.hpp"
+#include "tools/data_waiters.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/sync_container_stats.hpp"
 
 namespace tools
 {
+    namespace detail
+    {
+        /**
+         * @brief Tells whether a heap provides dary_heap's push_range/pop_range/pop_move bulk operations.
+         */
+        template <typename Heap, typename = void>
+        struct has_bulk_heap_operations : std::false_type
+        {
+        };
+
+        template <typename Heap>
+        struct has_bulk_heap_operations<Heap, std::void_t<decltype(std::declval<Heap&>().pop_move())>>
+            : std::true_type
+        {
+        };
+    } // namespace detail
+
     /**
      * @brief A thread-safe priority queue implementation.
      *
@@ -74,10 +97,18 @@ namespace tools
      * - async_observer<Topic, Evt, sync_priority_queue> uses default std::greater<T>
      * - For custom comparators, create a template alias or wrapper.
      *
+     * The heap is std::priority_queue by default. With tools::dary_heap (see sync_dary_priority_queue) pushes
+     * sift through fewer levels, push_range() merges large batches with one heapify and pop_range() extracts
+     * the batch without reentering the lock.
+     *
      * @tparam T The type of elements stored in the priority queue.
      * @tparam Compare The comparison function to use for ordering elements (default: std::greater<T>).
+     * @tparam Heap The underlying heap, std::priority_queue<T, std::vector<T>, Compare> or dary_heap<T, Compare>.
+     * @tparam Stats The statistics policy: no_sync_container_stats (no cost), or sync_container_stats to count
+     *               pushes, pops and lock contention (the queue is unbounded: no overflow nor overwrite).
      */
-    template <typename T, typename Compare = std::greater<T>>
+    template <typename T, typename Compare = std::greater<T>,
+        typename Heap = std::priority_queue<T, std::vector<T>, Compare>, typename Stats = no_sync_container_stats>
     class sync_priority_queue : public non_copyable // NOLINT inherits from non copyable/non movable
     {
     public:
@@ -99,7 +130,9 @@ namespace tools
          */
         void push(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_priority_queue.push(elem);
         }
 
@@ -112,7 +145,9 @@ namespace tools
          */
         void push(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_priority_queue.push(std::move(elem));
         }
 
@@ -135,7 +170,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_priority_queue.push(std::forward<U>(elem));
         }
 
@@ -157,7 +194,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_priority_queue.emplace(std::forward<Args>(args)...);
         }
 
@@ -169,10 +208,11 @@ namespace tools
          */
         void pop()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
             if (!m_priority_queue.empty())
             {
                 m_priority_queue.pop();
+                m_stats.on_pop(1U);
             }
         }
 
@@ -205,11 +245,12 @@ namespace tools
         [[nodiscard]] std::optional<T> top_pop()
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
             if (!m_priority_queue.empty())
             {
                 item = m_priority_queue.top();
                 m_priority_queue.pop();
+                m_stats.on_pop(1U);
             }
             return item;
         }
@@ -224,14 +265,8 @@ namespace tools
          */
         [[nodiscard]] std::optional<T> top_pop_move()
         {
-            std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            if (!m_priority_queue.empty())
-            {
-                item = std::move(const_cast<T&>(m_priority_queue.top())); // NOLINT const_cast for move
-                m_priority_queue.pop();
-            }
-            return item;
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return pop_top_unlocked();
         }
 
         /**
@@ -299,11 +334,10 @@ namespace tools
         template <typename InputIt>
         void push_range(InputIt first, InputIt last)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            for (; first != last; ++first)
-            {
-                m_priority_queue.push(T(*first));
-            }
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
+            push_range_unlocked(first, last);
         }
 
         /**
@@ -327,11 +361,10 @@ namespace tools
 #endif
         void push_range(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            for (auto&& elem : std::forward<TRange>(range))
-            {
-                m_priority_queue.push(T(std::forward<decltype(elem)>(elem)));
-            }
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
+            push_range_unlocked(std::begin(range), std::end(range));
         }
 
         /**
@@ -354,11 +387,10 @@ namespace tools
 #endif
         void push_range(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            for (const auto& elem : range)
-            {
-                m_priority_queue.push(T(elem));
-            }
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
+            push_range_unlocked(range.begin(), range.end());
         }
 
         /**
@@ -374,16 +406,8 @@ namespace tools
         template <typename OutputIt>
         [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
         {
-            std::size_t popped_count = 0U;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            while ((first != last) && !m_priority_queue.empty())
-            {
-                *first = std::move(const_cast<T&>(m_priority_queue.top())); // NOLINT const_cast for move
-                ++first;
-                m_priority_queue.pop();
-                ++popped_count;
-            }
-            return popped_count;
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return pop_range_unlocked(first, last);
         }
 
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -399,6 +423,68 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Gets the hook registering the priority queue with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified by every push.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_data_waiters.ready_hook();
+        }
+
+        /**
+         * @brief Removes the top element, waiting up to a timeout for one to be pushed.
+         *
+         * The consumer sleeps on the priority queue's own event, signaled by pushes only while a consumer waits.
+         *
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The moved top element, or none if the priority queue stayed empty.
+         */
+        [[nodiscard]] std::optional<T> wait_pop(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            const auto take = [this]() { return pop_top_unlocked(); };
+            const auto has_data = [this]() { return !m_priority_queue.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+        /**
+         * @brief Removes a batch of elements, waiting up to a timeout for at least one to be pushed.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted, 0 if the priority queue stayed empty.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t wait_pop_range(
+            OutputIt first, OutputIt last, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            if (first == last)
+            {
+                return 0U;
+            }
+            const auto take = [this, first, last]() { return pop_range_unlocked(first, last); };
+            const auto has_data = [this]() { return !m_priority_queue.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based wait_pop_range() into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted.
+         */
+        [[nodiscard]] std::size_t wait_pop_range(
+            std::span<T> destination, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            return wait_pop_range(destination.begin(), destination.end(), timeout);
+        }
+#endif
+
         /**
          * @brief Pushes a copy of an element into the priority queue in an ISR-safe manner.
          *
@@ -408,7 +494,9 @@ namespace tools
          */
         void isr_push(const T& elem)
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_priority_queue.push(elem);
         }
 
@@ -421,7 +509,9 @@ namespace tools
          */
         void isr_push(T&& elem)
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_priority_queue.push(std::move(elem));
         }
 
@@ -444,7 +534,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
 #endif
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_priority_queue.push(std::forward<U>(elem));
         }
 
@@ -466,7 +558,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
 #endif
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_priority_queue.emplace(std::forward<Args>(args)...);
         }
 
@@ -494,11 +588,10 @@ namespace tools
         template <typename InputIt>
         void isr_push_range(InputIt first, InputIt last)
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            for (; first != last; ++first)
-            {
-                m_priority_queue.push(T(*first));
-            }
+            const counted_push counted(*this);
+            push_range_unlocked(first, last);
         }
 
         /**
@@ -522,11 +615,10 @@ namespace tools
 #endif
         void isr_push_range(TRange&& range)
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            for (auto&& elem : std::forward<TRange>(range))
-            {
-                m_priority_queue.push(T(std::forward<decltype(elem)>(elem)));
-            }
+            const counted_push counted(*this);
+            push_range_unlocked(std::begin(range), std::end(range));
         }
 
         /**
@@ -549,16 +641,123 @@ namespace tools
 #endif
         void isr_push_range(std::initializer_list<U> range)
         {
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            for (const auto& elem : range)
+            const counted_push counted(*this);
+            push_range_unlocked(range.begin(), range.end());
+        }
+
+        /**
+         * @brief Gets the statistics policy of the queue, e.g. to name or read a sync_container_stats.
+         *
+         * @return The statistics policy.
+         */
+        [[nodiscard]] Stats& stats()
+        {
+            return m_stats;
+        }
+
+        [[nodiscard]] const Stats& stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        /**
+         * @brief Reports a push to the statistics policy from the size of the heap before and after it; declared
+         * after the lock guard so that it reports under the lock.
+         */
+        class counted_push : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            explicit counted_push(sync_priority_queue& owner)
+                : m_owner(owner)
+            {
+                if constexpr (Stats::enabled)
+                {
+                    m_size = owner.m_priority_queue.size();
+                }
+            }
+
+            ~counted_push()
+            {
+                if constexpr (Stats::enabled)
+                {
+                    const std::size_t size = m_owner.m_priority_queue.size();
+                    m_owner.m_stats.on_push(size - m_size, size);
+                }
+            }
+
+        private:
+            sync_priority_queue& m_owner;
+            std::size_t m_size = 0U;
+        };
+
+        static constexpr const bool has_bulk_operations = detail::has_bulk_heap_operations<Heap>::value;
+
+        template <typename InputIt, typename Sentinel>
+        void push_range_unlocked(InputIt first, Sentinel last)
+        {
+            if constexpr (has_bulk_operations)
+            {
+                m_priority_queue.push_range(first, last);
+            }
+            else
             {
-                m_priority_queue.push(T(elem));
+                for (; first != last; ++first)
+                {
+                    m_priority_queue.push(T(*first));
+                }
             }
         }
 
-    private:
-        std::priority_queue<T, std::vector<T>, Compare> m_priority_queue;
+        std::optional<T> pop_top_unlocked()
+        {
+            std::optional<T> item;
+            if (!m_priority_queue.empty())
+            {
+                if constexpr (has_bulk_operations)
+                {
+                    item = m_priority_queue.pop_move();
+                }
+                else
+                {
+                    item = std::move(const_cast<T&>(m_priority_queue.top())); // NOLINT const_cast for move
+                    m_priority_queue.pop();
+                }
+                m_stats.on_pop(1U);
+            }
+            return item;
+        }
+
+        template <typename OutputIt>
+        std::size_t pop_range_unlocked(OutputIt first, OutputIt last)
+        {
+            if constexpr (has_bulk_operations)
+            {
+                const std::size_t popped_count = m_priority_queue.pop_range(first, last);
+                m_stats.on_pop(popped_count);
+                return popped_count;
+            }
+            else
+            {
+                std::size_t popped_count = 0U;
+                while ((first != last) && !m_priority_queue.empty())
+                {
+                    *first = std::move(const_cast<T&>(m_priority_queue.top())); // NOLINT const_cast for move
+                    ++first;
+                    m_priority_queue.pop();
+                    ++popped_count;
+                }
+                m_stats.on_pop(popped_count);
+                return popped_count;
+            }
+        }
+
+        Heap m_priority_queue;
         mutable critical_section m_mutex;
+        data_waiters m_data_waiters;
+        Stats m_stats;
     };
 
     /**
@@ -577,6 +776,16 @@ namespace tools
     template <typename T>
     using sync_max_priority_queue = sync_priority_queue<T, std::less<T>>;
 
+    /**
+     * @brief Template alias for a sync_priority_queue over a dary_heap.
+     *
+     * @tparam T The type of elements stored in the priority queue.
+     * @tparam Compare The comparison function to use for ordering elements (default: std::greater<T>).
+     * @tparam Arity The number of children per heap node.
+     */
+    template <typename T, typename Compare = std::greater<T>, std::size_t Arity = 4U>
+    using sync_dary_priority_queue = sync_priority_queue<T, Compare, dary_heap<T, Compare, Arity>>;
+
 }
 
 #endif //  SYNC_PRIORITY_QUEUE_HPP_
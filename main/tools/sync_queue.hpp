@@ -41,8 +41,12 @@
 #define SYNC_QUEUE_HPP_
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
@@ -54,11 +58,68 @@
 #include <span>
 #endif
 
+#include "tools/adaptive_critical_section.hpp"
 #include "tools/critical_section.hpp"
+#include "tools/data_waiters.hpp"
 #include "tools/non_copyable.hpp"
+#include "tools/ring_queue.hpp"
+#include "tools/sync_container_stats.hpp"
 
 namespace tools
 {
+    namespace detail
+    {
+        template <typename Container, typename Visitor, typename = void>
+        struct has_visit_range : std::false_type
+        {
+        };
+
+        template <typename Container, typename Visitor>
+        struct has_visit_range<Container, Visitor,
+            std::void_t<decltype(std::declval<const Container&>().visit_range(
+                std::size_t {}, std::declval<Visitor&>()))>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Reaches the sequence wrapped by a std::queue, a protected member of the adaptor.
+         */
+        template <typename Queue>
+        struct queue_sequence_access : Queue
+        {
+            static const typename Queue::container_type& of(const Queue& queue)
+            {
+                return queue.*(&queue_sequence_access::c);
+            }
+        };
+
+        /**
+         * @brief Visits the front elements of a FIFO in place: its own visit_range(), else the std::queue sequence.
+         */
+        template <typename Container, typename Visitor>
+        std::size_t visit_fifo(const Container& fifo, std::size_t count, Visitor& visitor)
+        {
+            if constexpr (has_visit_range<Container, Visitor>::value)
+            {
+                return fifo.visit_range(count, visitor);
+            }
+            else
+            {
+                std::size_t visited = 0U;
+                for (const auto& item : queue_sequence_access<Container>::of(fifo))
+                {
+                    if (visited == count)
+                    {
+                        break;
+                    }
+                    visitor(item);
+                    ++visited;
+                }
+                return visited;
+            }
+        }
+    }
+
     /**
      * @brief A thread-safe queue implementation.
      *
@@ -66,13 +127,47 @@ namespace tools
      * It inherits from non_copyable to prevent copying and moving.
      *
      * @tparam T The type of elements stored in the queue.
+     * @tparam Lock The lock guarding the queue: critical_section, or adaptive_critical_section to spin briefly
+     *              before blocking under contention.
+     * @tparam Container The underlying FIFO: std::queue, or ring_queue for preallocated storage with a bounded
+     *                   capacity.
+     * @tparam Stats The statistics policy: no_sync_container_stats (no cost), or sync_container_stats to count
+     *               pushes, pops, drops and lock contention.
      */
-    template <typename T>
-    class sync_queue : public non_copyable // NOLINT inherits from non copyable/non movable
+    template <typename T, typename Lock = critical_section, typename Container = std::queue<T>,
+        typename Stats = no_sync_container_stats>
+    class basic_sync_queue : public non_copyable // NOLINT inherits from non copyable/non movable
     {
     public:
-        sync_queue() = default;
-        ~sync_queue() = default;
+        basic_sync_queue() = default;
+        ~basic_sync_queue() = default;
+
+        /**
+         * @brief Constructs a queue over preallocated storage (ring_queue container).
+         *
+         * @param capacity The number of elements the queue holds.
+         * @param policy What a push does once the queue is full: reject the element, overwrite the oldest one, or
+         *               grow the storage.
+         */
+        template <typename C = Container,
+            typename = typename std::enable_if<std::is_constructible<C, std::size_t, queue_full_policy>::value>::type>
+        explicit basic_sync_queue(std::size_t capacity, queue_full_policy policy = queue_full_policy::reject)
+            : m_queue(capacity, policy)
+        {
+        }
+
+        /**
+         * @brief Constructs an empty queue whose container allocates through the given allocator.
+         *
+         * @param alloc The allocator, e.g. a std::pmr::memory_resource* for a std::pmr container.
+         */
+        template <typename Alloc, typename C = Container,
+            typename = typename std::enable_if<std::uses_allocator<C, Alloc>::value>::type>
+        explicit basic_sync_queue(const Alloc& alloc)
+            : m_queue(alloc)
+        {
+        }
+
         struct thread_safe
         {
             static constexpr bool value = true;
@@ -88,7 +183,9 @@ namespace tools
          */
         void push(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_queue.push(elem);
         }
 
@@ -101,7 +198,9 @@ namespace tools
          */
         void push(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_queue.push(std::move(elem));
         }
 
@@ -124,7 +223,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_queue.push(std::forward<U>(elem));
         }
 
@@ -146,7 +247,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             m_queue.emplace(std::forward<Args>(args)...);
         }
 
@@ -157,10 +260,11 @@ namespace tools
          */
         void pop()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
             if (!m_queue.empty())
             {
                 m_queue.pop();
+                m_stats.on_pop(1U);
             }
         }
 
@@ -174,7 +278,7 @@ namespace tools
         [[nodiscard]] std::optional<T> front() const
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<Lock> guard(m_mutex);
             if (!m_queue.empty())
             {
                 item = m_queue.front();
@@ -192,11 +296,12 @@ namespace tools
         [[nodiscard]] std::optional<T> front_pop()
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
             if (!m_queue.empty())
             {
                 item = m_queue.front();
                 m_queue.pop();
+                m_stats.on_pop(1U);
             }
             return item;
         }
@@ -211,14 +316,8 @@ namespace tools
          */
         [[nodiscard]] std::optional<T> front_pop_move()
         {
-            std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            if (!m_queue.empty())
-            {
-                item = std::move(m_queue.front());
-                m_queue.pop();
-            }
-            return item;
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return pop_front_unlocked();
         }
 
         /**
@@ -232,7 +331,7 @@ namespace tools
         [[nodiscard]] std::optional<T> back() const
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<Lock> guard(m_mutex);
             if (!m_queue.empty())
             {
                 item = m_queue.back();
@@ -248,12 +347,44 @@ namespace tools
          *
          * @return A copy of the internal queue
          */
-        [[nodiscard]] std::queue<T> snapshot() const
+        [[nodiscard]] Container snapshot() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<Lock> guard(m_mutex);
             return m_queue;
         }
 
+        /**
+         * @brief Calls a visitor on every element in place, front first, under the lock.
+         *
+         * Unlike snapshot(), nothing is copied nor allocated. The visitor runs with the lock held: it must be
+         * short and must not call the queue.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param visitor The visitor.
+         * @return The number of elements visited.
+         */
+        template <typename Visitor>
+        std::size_t visit(Visitor&& visitor) const
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return detail::visit_fifo(m_queue, m_queue.size(), visitor);
+        }
+
+        /**
+         * @brief Calls a visitor on the front elements in place, under the lock.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must be short and must not call the queue.
+         * @return The number of elements visited, at most count.
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return detail::visit_fifo(m_queue, count, visitor);
+        }
+
         /**
          * @brief Checks if the queue is empty.
          *
@@ -264,7 +395,7 @@ namespace tools
          */
         [[nodiscard]] bool empty() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<Lock> guard(m_mutex);
             return m_queue.empty();
         }
 
@@ -278,10 +409,36 @@ namespace tools
          */
         [[nodiscard]] std::size_t size() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            std::scoped_lock<Lock> guard(m_mutex);
             return m_queue.size();
         }
 
+        /**
+         * @brief Returns the number of elements the queue holds before its full policy applies (ring_queue
+         * container).
+         *
+         * @return The capacity.
+         */
+        template <typename C = Container>
+        [[nodiscard]] auto capacity() const -> decltype(std::declval<const C&>().capacity())
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_queue.capacity();
+        }
+
+        /**
+         * @brief Returns the number of elements rejected or overwritten because the queue was full (ring_queue
+         * container).
+         *
+         * @return The dropped element count.
+         */
+        template <typename C = Container>
+        [[nodiscard]] auto dropped_count() const -> decltype(std::declval<const C&>().dropped_count())
+        {
+            std::scoped_lock<Lock> guard(m_mutex);
+            return m_queue.dropped_count();
+        }
+
         /**
          * @brief Pushes all elements from an iterator pair into the queue.
          *
@@ -292,7 +449,9 @@ namespace tools
         template <typename InputIt>
         void push_range(InputIt first, InputIt last)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             for (; first != last; ++first)
             {
                 m_queue.push(T(*first));
@@ -320,7 +479,9 @@ namespace tools
 #endif
         void push_range(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             for (auto&& elem : std::forward<TRange>(range))
             {
                 m_queue.push(T(std::forward<decltype(elem)>(elem)));
@@ -347,7 +508,9 @@ namespace tools
 #endif
         void push_range(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            const counted_push counted(*this);
             for (const auto& elem : range)
             {
                 m_queue.push(T(elem));
@@ -367,16 +530,8 @@ namespace tools
         template <typename OutputIt>
         [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
         {
-            std::size_t popped_count = 0U;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            while ((first != last) && !m_queue.empty())
-            {
-                *first = std::move(m_queue.front());
-                ++first;
-                m_queue.pop();
-                ++popped_count;
-            }
-            return popped_count;
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return pop_range_unlocked(first, last);
         }
 
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -392,6 +547,68 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Gets the hook registering the queue with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified by every push.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_data_waiters.ready_hook();
+        }
+
+        /**
+         * @brief Removes the front element, waiting up to a timeout for one to be pushed.
+         *
+         * The consumer sleeps on the queue's own event, signaled by pushes only while a consumer waits.
+         *
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The moved front element, or none if the queue stayed empty.
+         */
+        [[nodiscard]] std::optional<T> wait_pop(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            const auto take = [this]() { return pop_front_unlocked(); };
+            const auto has_data = [this]() { return !m_queue.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+        /**
+         * @brief Removes a batch of elements, waiting up to a timeout for at least one to be pushed.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted, 0 if the queue stayed empty.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t wait_pop_range(
+            OutputIt first, OutputIt last, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            if (first == last)
+            {
+                return 0U;
+            }
+            const auto take = [this, first, last]() { return pop_range_unlocked(first, last); };
+            const auto has_data = [this]() { return !m_queue.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based wait_pop_range() into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted.
+         */
+        [[nodiscard]] std::size_t wait_pop_range(
+            std::span<T> destination, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            return wait_pop_range(destination.begin(), destination.end(), timeout);
+        }
+#endif
+
         /**
          * @brief Pushes a copy of an element into the queue in an ISR-safe manner.
          *
@@ -401,7 +618,9 @@ namespace tools
          */
         void isr_push(const T& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_queue.push(elem);
         }
 
@@ -414,7 +633,9 @@ namespace tools
          */
         void isr_push(T&& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_queue.push(std::move(elem));
         }
 
@@ -437,7 +658,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_queue.push(std::forward<U>(elem));
         }
 
@@ -459,7 +682,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             m_queue.emplace(std::forward<Args>(args)...);
         }
 
@@ -473,7 +698,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t isr_size() const
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
             return m_queue.size();
         }
 
@@ -487,7 +712,9 @@ namespace tools
         template <typename InputIt>
         void isr_push_range(InputIt first, InputIt last)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             for (; first != last; ++first)
             {
                 m_queue.push(T(*first));
@@ -515,7 +742,9 @@ namespace tools
 #endif
         void isr_push_range(TRange&& range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             for (auto&& elem : std::forward<TRange>(range))
             {
                 m_queue.push(T(std::forward<decltype(elem)>(elem)));
@@ -542,17 +771,156 @@ namespace tools
 #endif
         void isr_push_range(std::initializer_list<U> range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            const counted_push counted(*this);
             for (const auto& elem : range)
             {
                 m_queue.push(T(elem));
             }
         }
 
+        /**
+         * @brief Gets the statistics policy of the queue, e.g. to name or read a sync_container_stats.
+         *
+         * @return The statistics policy.
+         */
+        [[nodiscard]] Stats& stats()
+        {
+            return m_stats;
+        }
+
+        [[nodiscard]] const Stats& stats() const
+        {
+            return m_stats;
+        }
+
     private:
-        std::queue<T> m_queue;
-        mutable critical_section m_mutex;
+        /**
+         * @brief Reports a push to the statistics policy from the size and drop count of the container before and
+         * after it; declared after the lock guard so that it reports under the lock.
+         */
+        class counted_push : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+        public:
+            explicit counted_push(basic_sync_queue& owner)
+                : m_owner(owner)
+            {
+                if constexpr (Stats::enabled)
+                {
+                    m_size = owner.m_queue.size();
+                    m_dropped = dropped_of(owner.m_queue, 0);
+                }
+            }
+
+            ~counted_push()
+            {
+                if constexpr (Stats::enabled)
+                {
+                    const std::size_t size = m_owner.m_queue.size();
+                    const std::size_t dropped = dropped_of(m_owner.m_queue, 0) - m_dropped;
+                    const bool overwrites = overwrites_oldest(m_owner.m_queue, 0);
+                    m_owner.m_stats.on_push((size - m_size) + (overwrites ? dropped : 0U), size);
+                    if (0U != dropped)
+                    {
+                        if (overwrites)
+                        {
+                            m_owner.m_stats.on_overwrite(dropped);
+                        }
+                        else
+                        {
+                            m_owner.m_stats.on_overflow(dropped);
+                        }
+                    }
+                }
+            }
+
+        private:
+            basic_sync_queue& m_owner;
+            std::size_t m_size = 0U;
+            std::size_t m_dropped = 0U;
+        };
+
+        template <typename C>
+        static auto dropped_of(const C& queue, int /*preferred*/) -> decltype(queue.dropped_count())
+        {
+            return queue.dropped_count();
+        }
+
+        template <typename C>
+        static std::size_t dropped_of(const C& /*queue*/, long /*fallback*/)
+        {
+            return 0U;
+        }
+
+        template <typename C>
+        static auto overwrites_oldest(const C& queue, int /*preferred*/) -> decltype(queue.full_policy(), bool())
+        {
+            return queue_full_policy::overwrite_oldest == queue.full_policy();
+        }
+
+        template <typename C>
+        static bool overwrites_oldest(const C& /*queue*/, long /*fallback*/)
+        {
+            return false;
+        }
+
+        std::optional<T> pop_front_unlocked()
+        {
+            std::optional<T> item;
+            if (!m_queue.empty())
+            {
+                item = std::move(m_queue.front());
+                m_queue.pop();
+                m_stats.on_pop(1U);
+            }
+            return item;
+        }
+
+        template <typename OutputIt>
+        std::size_t pop_range_unlocked(OutputIt first, OutputIt last)
+        {
+            std::size_t popped_count = 0U;
+            while ((first != last) && !m_queue.empty())
+            {
+                *first = std::move(m_queue.front());
+                ++first;
+                m_queue.pop();
+                ++popped_count;
+            }
+            m_stats.on_pop(popped_count);
+            return popped_count;
+        }
+
+        Container m_queue;
+        mutable Lock m_mutex;
+        data_waiters m_data_waiters;
+        Stats m_stats;
     };
+
+    /**
+     * @brief Thread-safe queue guarded by a critical_section.
+     *
+     * @tparam T The type of elements stored in the queue.
+     */
+    template <typename T>
+    using sync_queue = basic_sync_queue<T, critical_section>;
+
+    /**
+     * @brief Thread-safe queue guarded by an adaptive_critical_section (spin, then block).
+     *
+     * @tparam T The type of elements stored in the queue.
+     */
+    template <typename T>
+    using adaptive_sync_queue = basic_sync_queue<T, adaptive_critical_section>;
+
+    /**
+     * @brief Thread-safe queue over a preallocated ring_queue, constructed with its capacity and full policy.
+     *
+     * @tparam T The type of elements stored in the queue.
+     */
+    template <typename T>
+    using bounded_sync_queue = basic_sync_queue<T, critical_section, ring_queue<T>>;
 }
 
 #endif //  SYNC_QUEUE_HPP_
@@ -42,6 +42,7 @@
 #define SYNC_RING_BUFFER_HPP_
 
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <mutex>
@@ -54,11 +55,40 @@
 #endif
 
 #include "tools/critical_section.hpp"
+#include "tools/lock_free_mpmc_ring_buffer.hpp"
+#include "tools/lock_free_object_ring_buffer.hpp"
 #include "tools/non_copyable.hpp"
 #include "tools/ring_buffer.hpp"
+#include "tools/sync_container_stats.hpp"
 
 namespace tools
 {
+    /**
+     * @brief Concurrency policy of a sync_ring_buffer.
+     */
+    enum class ring_concurrency : std::uint8_t
+    {
+        /** @brief ring_buffer under a critical_section: full API, any number of producers and consumers. */
+        locked,
+        /** @brief lock_free_object_ring_buffer: one producer and one consumer, any movable type. */
+        spsc_lock_free,
+        /** @brief lock_free_mpmc_ring_buffer: any number of producers and consumers, scalar or pointer types. */
+        mpmc_lock_free
+    };
+
+    /**
+     * @brief A thread-safe ring buffer whose synchronization is selected at compile time.
+     *
+     * @tparam T The type of elements stored in the ring buffer.
+     * @tparam Capacity The maximum number of elements the ring buffer can hold.
+     * @tparam Concurrency The concurrency policy, locked by default.
+     * @tparam Stats The statistics policy: no_sync_container_stats (no cost), or sync_container_stats to count
+     *               pushes, pops, overflows, overwrites and, with the locked policy, lock contention.
+     */
+    template <typename T, std::size_t Capacity, ring_concurrency Concurrency = ring_concurrency::locked,
+        typename Stats = no_sync_container_stats>
+    class sync_ring_buffer;
+
     /**
      * @brief A thread-safe ring buffer implementation.
      *
@@ -68,9 +98,11 @@ namespace tools
      *
      * @tparam T The type of elements stored in the ring buffer.
      * @tparam Capacity The maximum number of elements the ring buffer can hold.
+     * @tparam Stats The statistics policy.
      */
-    template <typename T, std::size_t Capacity>
-    class sync_ring_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    template <typename T, std::size_t Capacity, typename Stats>
+    class sync_ring_buffer<T, Capacity, ring_concurrency::locked, Stats>
+        : public non_copyable // NOLINT inherits from non copyable and non movable class
     {
     public:
         struct thread_safe
@@ -91,8 +123,8 @@ namespace tools
          */
         bool push(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push(elem);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_buffer.push(elem));
         }
 
         /**
@@ -104,8 +136,8 @@ namespace tools
          */
         bool push(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push(std::move(elem));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_buffer.push(std::move(elem)));
         }
 
         /**
@@ -126,8 +158,8 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push(std::forward<U>(elem));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_buffer.push(std::forward<U>(elem)));
         }
 
         /**
@@ -148,8 +180,8 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.emplace(std::forward<Args>(args)...);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_buffer.emplace(std::forward<Args>(args)...));
         }
 
         /**
@@ -157,10 +189,11 @@ namespace tools
          */
         void pop()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
             if (!m_ring_buffer.empty())
             {
                 m_ring_buffer.pop();
+                m_stats.on_pop(1U);
             }
         }
 
@@ -193,11 +226,12 @@ namespace tools
         [[nodiscard]] std::optional<T> front_pop()
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
             if (!m_ring_buffer.empty())
             {
                 item = m_ring_buffer.front();
                 m_ring_buffer.pop();
+                m_stats.on_pop(1U);
             }
             return item;
         }
@@ -212,8 +246,8 @@ namespace tools
          */
         [[nodiscard]] std::optional<T> front_pop_move()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.pop_move();
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_pop(m_ring_buffer.pop_move());
         }
 
         /**
@@ -249,6 +283,38 @@ namespace tools
             return m_ring_buffer;
         }
 
+        /**
+         * @brief Calls a visitor on every element in place, oldest first, under the lock.
+         *
+         * Unlike snapshot(), nothing is copied nor allocated. The visitor runs with the lock held: it must be
+         * short and must not call the ring buffer.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param visitor The visitor.
+         * @return The number of elements visited.
+         */
+        template <typename Visitor>
+        std::size_t visit(Visitor&& visitor) const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_ring_buffer.visit_range(m_ring_buffer.size(), visitor);
+        }
+
+        /**
+         * @brief Calls a visitor on the oldest elements in place, under the lock.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must be short and must not call the ring buffer.
+         * @return The number of elements visited, at most count.
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_ring_buffer.visit_range(count, visitor);
+        }
+
         /**
          * @brief Checks if the ring buffer is empty.
          *
@@ -321,8 +387,8 @@ namespace tools
 #endif
         std::size_t push_range(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_range(std::forward<TRange>(range));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push_range(m_ring_buffer.push_range(std::forward<TRange>(range)));
         }
 
         /**
@@ -342,8 +408,8 @@ namespace tools
 #endif
         std::size_t push_range(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_range(range);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push_span(m_ring_buffer.push_range(range), range.size());
         }
 
         /**
@@ -358,8 +424,8 @@ namespace tools
          */
         bool push_overwrite(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_overwrite(elem);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.push_overwrite(elem));
         }
 
         /**
@@ -369,8 +435,8 @@ namespace tools
          */
         bool push_overwrite(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_overwrite(std::move(elem));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.push_overwrite(std::move(elem)));
         }
 
         /**
@@ -389,8 +455,8 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_overwrite(std::forward<U>(elem));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.push_overwrite(std::forward<U>(elem)));
         }
 
         /**
@@ -408,8 +474,8 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.emplace_overwrite(std::forward<Args>(args)...);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.emplace_overwrite(std::forward<Args>(args)...));
         }
 
         /**
@@ -431,8 +497,8 @@ namespace tools
 #endif
         push_range_overwrite_result push_range_overwrite(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_range_overwrite(std::forward<TRange>(range));
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.push_range_overwrite(std::forward<TRange>(range)));
         }
 
         /**
@@ -454,8 +520,8 @@ namespace tools
 #endif
         push_range_overwrite_result push_range_overwrite(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.push_range_overwrite(range);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_buffer.push_range_overwrite(range));
         }
 
         /**
@@ -469,8 +535,8 @@ namespace tools
         template <typename OutputIt>
         [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_buffer.pop_range(first, last);
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_pop_range(m_ring_buffer.pop_range(first, last));
         }
 
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -486,6 +552,56 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Appends a block of elements under a single lock, with bulk copies of the contiguous parts.
+         *
+         * @param data The elements to append.
+         * @param count The number of elements at data.
+         * @return The number of elements appended, fewer when the ring buffer fills up.
+         */
+        std::size_t push_span(const T* data, std::size_t count)
+        {
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_push_span(m_ring_buffer.push_span(data, count), count);
+        }
+
+        /**
+         * @brief Removes the oldest elements into a block under a single lock, with bulk moves.
+         *
+         * @param destination Storage receiving the elements.
+         * @param count The number of elements destination can hold.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(T* destination, std::size_t count)
+        {
+            const sync_stats_lock_guard<tools::critical_section, Stats> guard(m_mutex, m_stats);
+            return counted_pop_range(m_ring_buffer.pop_span(destination, count));
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push_span().
+         *
+         * @param source The elements to append.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(std::span<const T> source)
+        {
+            return push_span(source.data(), source.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pop_span().
+         *
+         * @param destination Storage receiving the elements.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(std::span<T> destination)
+        {
+            return pop_span(destination.data(), destination.size());
+        }
+#endif
+
         /**
          * @brief Pushes a copy of an element into the ring buffer in an ISR-safe manner.
          *
@@ -497,7 +613,7 @@ namespace tools
         void isr_push(const T& elem)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_buffer.push(elem);
+            counted_push(m_ring_buffer.push(elem));
         }
 
         /**
@@ -510,7 +626,7 @@ namespace tools
         void isr_push(T&& elem)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_buffer.push(std::move(elem));
+            counted_push(m_ring_buffer.push(std::move(elem)));
         }
 
         /**
@@ -533,7 +649,7 @@ namespace tools
 #endif
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_buffer.push(std::forward<U>(elem));
+            counted_push(m_ring_buffer.push(std::forward<U>(elem)));
         }
 
         /**
@@ -556,7 +672,7 @@ namespace tools
 #endif
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_buffer.emplace(std::forward<Args>(args)...);
+            counted_push(m_ring_buffer.emplace(std::forward<Args>(args)...));
         }
 
         /**
@@ -581,7 +697,7 @@ namespace tools
         std::size_t isr_push_range(TRange&& range)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_range(std::forward<TRange>(range));
+            return counted_push_range(m_ring_buffer.push_range(std::forward<TRange>(range)));
         }
 
         /**
@@ -602,7 +718,7 @@ namespace tools
         std::size_t isr_push_range(std::initializer_list<U> range)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_range(range);
+            return counted_push_span(m_ring_buffer.push_range(range), range.size());
         }
 
         /**
@@ -613,7 +729,7 @@ namespace tools
         bool isr_push_overwrite(const T& elem)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_overwrite(elem);
+            return counted_overwrite(m_ring_buffer.push_overwrite(elem));
         }
 
         /**
@@ -624,7 +740,7 @@ namespace tools
         bool isr_push_overwrite(T&& elem)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_overwrite(std::move(elem));
+            return counted_overwrite(m_ring_buffer.push_overwrite(std::move(elem)));
         }
 
         /**
@@ -644,7 +760,7 @@ namespace tools
 #endif
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_overwrite(std::forward<U>(elem));
+            return counted_overwrite(m_ring_buffer.push_overwrite(std::forward<U>(elem)));
         }
 
         /**
@@ -663,7 +779,7 @@ namespace tools
 #endif
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.emplace_overwrite(std::forward<Args>(args)...);
+            return counted_overwrite(m_ring_buffer.emplace_overwrite(std::forward<Args>(args)...));
         }
 
         /**
@@ -686,7 +802,7 @@ namespace tools
         push_range_overwrite_result isr_push_range_overwrite(TRange&& range)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_range_overwrite(std::forward<TRange>(range));
+            return counted_overwrite(m_ring_buffer.push_range_overwrite(std::forward<TRange>(range)));
         }
 
         /**
@@ -709,7 +825,7 @@ namespace tools
         push_range_overwrite_result isr_push_range_overwrite(std::initializer_list<U> range)
         {
             tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_buffer.push_range_overwrite(range);
+            return counted_overwrite(m_ring_buffer.push_range_overwrite(range));
         }
 
         /**
@@ -739,9 +855,613 @@ namespace tools
             return m_ring_buffer.size();
         }
 
+        /**
+         * @brief Gets the statistics policy of the ring buffer, e.g. to name or read a sync_container_stats.
+         *
+         * @return The statistics policy.
+         */
+        [[nodiscard]] Stats& stats()
+        {
+            return m_stats;
+        }
+
+        [[nodiscard]] const Stats& stats() const
+        {
+            return m_stats;
+        }
+
     private:
+        // the counted_* helpers run under the lock and report the outcome of a ring operation to m_stats
+
+        bool counted_push(bool pushed)
+        {
+            if constexpr (Stats::enabled)
+            {
+                if (pushed)
+                {
+                    m_stats.on_push(1U, m_ring_buffer.size());
+                }
+                else
+                {
+                    m_stats.on_overflow(1U);
+                }
+            }
+            return pushed;
+        }
+
+        std::size_t counted_push_range(std::size_t pushed)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(pushed, m_ring_buffer.size());
+            }
+            return pushed;
+        }
+
+        std::size_t counted_push_span(std::size_t pushed, std::size_t requested)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(pushed, m_ring_buffer.size());
+                if (pushed < requested)
+                {
+                    m_stats.on_overflow(requested - pushed);
+                }
+            }
+            return pushed;
+        }
+
+        bool counted_overwrite(bool overwritten)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(1U, m_ring_buffer.size());
+                if (overwritten)
+                {
+                    m_stats.on_overwrite(1U);
+                }
+            }
+            return overwritten;
+        }
+
+        push_range_overwrite_result counted_overwrite(const push_range_overwrite_result& result)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(result.inserted + result.overwritten, m_ring_buffer.size());
+                if (0U != result.overwritten)
+                {
+                    m_stats.on_overwrite(result.overwritten);
+                }
+            }
+            return result;
+        }
+
+        std::optional<T> counted_pop(std::optional<T>&& item)
+        {
+            if (item.has_value())
+            {
+                m_stats.on_pop(1U);
+            }
+            return std::move(item);
+        }
+
+        std::size_t counted_pop_range(std::size_t popped)
+        {
+            m_stats.on_pop(popped);
+            return popped;
+        }
+
         ring_buffer<T, Capacity> m_ring_buffer;
         mutable critical_section m_mutex;
+        Stats m_stats;
+    };
+
+    namespace detail
+    {
+        constexpr std::size_t ring_capacity_log2(std::size_t capacity)
+        {
+            std::size_t pow2 = 0U;
+            while ((std::size_t { 1U } << pow2) < capacity)
+            {
+                ++pow2;
+            }
+            return pow2;
+        }
+
+        template <typename T, std::size_t Pow2, ring_concurrency Concurrency>
+        struct lock_free_ring_of;
+
+        template <typename T, std::size_t Pow2>
+        struct lock_free_ring_of<T, Pow2, ring_concurrency::spsc_lock_free>
+        {
+            using type = lock_free_object_ring_buffer<T, Pow2>;
+        };
+
+        template <typename T, std::size_t Pow2>
+        struct lock_free_ring_of<T, Pow2, ring_concurrency::mpmc_lock_free>
+        {
+            using type = lock_free_mpmc_ring_buffer<T, Pow2>;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Lock-free sync_ring_buffer, for the spsc_lock_free and mpmc_lock_free policies.
+     *
+     * Keeps the push/emplace/pop/front_pop/front_pop_move/size/range/span API and the ISR variants of the
+     * locked ring buffer, so switching policy is a change of template argument. Everything returns without
+     * waiting for another thread, hence the isr_ functions are the plain ones; with spsc_lock_free an ISR
+     * may be the producer as long as no task pushes too. Peeking (front, back, snapshot) and overwriting
+     * would have to touch the other side's index and only exist on the locked policy.
+     *
+     * Capacity has to be a power of two, and all Capacity slots are usable. size(), empty() and full() are
+     * snapshots while the other side is active.
+     *
+     * @tparam T The type of elements stored in the ring buffer (movable for spsc, scalar or pointer for mpmc).
+     * @tparam Capacity The maximum number of elements the ring buffer can hold, a power of two.
+     * @tparam Concurrency ring_concurrency::spsc_lock_free or ring_concurrency::mpmc_lock_free.
+     * @tparam Stats The statistics policy; there is no lock, hence no contention to report, and the high-water
+     *               mark is taken from the size() snapshot after each push.
+     */
+    template <typename T, std::size_t Capacity, ring_concurrency Concurrency, typename Stats>
+    class sync_ring_buffer : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert((Capacity > 0U) && (0U == (Capacity & (Capacity - 1U))),
+            "lock-free sync_ring_buffer capacity has to be a power of two");
+
+        struct thread_safe
+        {
+            // any number of producers and consumers only with the mpmc policy
+            static constexpr bool value = (ring_concurrency::mpmc_lock_free == Concurrency);
+        };
+
+        sync_ring_buffer() = default;
+        ~sync_ring_buffer() = default;
+
+        /**
+         * @brief Pushes a copy of an element into the ring buffer.
+         *
+         * @param elem The element to be copied into the ring buffer.
+         * @return true if the element was pushed, false if the buffer is full.
+         */
+        bool push(const T& elem)
+        {
+            return emplace_val(elem);
+        }
+
+        /**
+         * @brief Pushes an rvalue element into the ring buffer.
+         *
+         * @param elem The element to be moved into the ring buffer.
+         * @return true if the element was pushed, false if the buffer is full.
+         */
+        bool push(T&& elem)
+        {
+            return emplace_val(std::move(elem));
+        }
+
+        /**
+         * @brief Pushes an element into the ring buffer using perfect forwarding.
+         *
+         * @tparam U The deduced element type.
+         * @param elem The element to be pushed into the ring buffer.
+         * @return true if the element was pushed, false if the buffer is full.
+         */
+        template <typename U>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, U>
+#endif
+        auto push(U&& elem)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
+#endif
+        {
+            return emplace_val(std::forward<U>(elem));
+        }
+
+        /**
+         * @brief Constructs an element at the back of the ring buffer.
+         *
+         * @tparam Args The deduced constructor argument types.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return true if the element was pushed, false if the buffer is full.
+         */
+        template <typename... Args>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, Args...>
+#endif
+        auto emplace(Args&&... args)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
+#endif
+        {
+            return emplace_val(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes the oldest element from the ring buffer, if any.
+         */
+        void pop()
+        {
+            static_cast<void>(pop_val());
+        }
+
+        /**
+         * @brief Retrieves and removes the front element of the ring buffer.
+         *
+         * @return The front element of the ring buffer, or none if the buffer is empty.
+         */
+        [[nodiscard]] std::optional<T> front_pop()
+        {
+            return pop_val();
+        }
+
+        /**
+         * @brief Retrieves and removes the front element using move semantics.
+         *
+         * @return The moved front element, or none if the ring buffer is empty.
+         */
+        [[nodiscard]] std::optional<T> front_pop_move()
+        {
+            return pop_val();
+        }
+
+        /**
+         * @brief Checks if the ring buffer is empty.
+         *
+         * @return true if the ring buffer is empty, false otherwise.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return m_ring_buffer.empty();
+        }
+
+        /**
+         * @brief Checks if the ring buffer is full.
+         *
+         * @return true if the ring buffer is full, false otherwise.
+         */
+        [[nodiscard]] bool full() const
+        {
+            return Capacity == m_ring_buffer.size();
+        }
+
+        /**
+         * @brief Returns the size of the ring buffer.
+         *
+         * @return The number of elements in the ring buffer.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_ring_buffer.size();
+        }
+
+        /**
+         * @brief Returns the capacity of the ring buffer.
+         * @return The capacity of the ring buffer.
+         */
+        [[nodiscard]] constexpr std::size_t capacity() const
+        {
+            return Capacity;
+        }
+
+        /**
+         * @brief Pushes all elements from a range into the ring buffer.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param range The source range of elements to push.
+         * @return The number of elements pushed, fewer when the ring buffer fills up.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange> && std::is_constructible_v<T, std::ranges::range_value_t<TRange>>
+#endif
+        std::size_t push_range(TRange&& range)
+        {
+            return counted_push(m_ring_buffer.push_range(std::forward<TRange>(range)), 0U);
+        }
+
+        /**
+         * @brief Pushes all elements from an initializer-list into the ring buffer.
+         *
+         * @tparam U The initializer-list element type.
+         * @param range The source initializer-list.
+         * @return The number of elements pushed, fewer when the ring buffer fills up.
+         */
+        template <typename U
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T, const U&>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, const U&>
+#endif
+        std::size_t push_range(std::initializer_list<U> range)
+        {
+            return counted_push(m_ring_buffer.push_range(range), range.size());
+        }
+
+        /**
+         * @brief Pops a batch of elements into an output range.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @return The effective number of elements extracted.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
+        {
+            return counted_pop(m_ring_buffer.pop_range(first, last));
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based batch pop into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @return The effective number of elements extracted.
+         */
+        [[nodiscard]] std::size_t pop_range(std::span<T> destination)
+        {
+            return pop_range(destination.begin(), destination.end());
+        }
+#endif
+
+        /**
+         * @brief Appends a block of elements, published as one batch by the spsc policy.
+         *
+         * @param data The elements to append.
+         * @param count The number of elements at data.
+         * @return The number of elements appended, fewer when the ring buffer fills up.
+         */
+        std::size_t push_span(const T* data, std::size_t count)
+        {
+            // NOLINTNEXTLINE pointer arithmetic
+            return counted_push(m_ring_buffer.push_range(pointer_range { data, data + count }), count);
+        }
+
+        /**
+         * @brief Removes the oldest elements into a block.
+         *
+         * @param destination Storage receiving the elements.
+         * @param count The number of elements destination can hold.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(T* destination, std::size_t count)
+        {
+            return counted_pop(m_ring_buffer.pop_range(destination, destination + count)); // NOLINT pointer arithmetic
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push_span().
+         *
+         * @param source The elements to append.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(std::span<const T> source)
+        {
+            return push_span(source.data(), source.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pop_span().
+         *
+         * @param destination Storage receiving the elements.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(std::span<T> destination)
+        {
+            return pop_span(destination.data(), destination.size());
+        }
+#endif
+
+        /**
+         * @brief Pushes an element from an ISR, dropping it if the buffer is full.
+         *
+         * @tparam U The deduced element type.
+         * @param elem The element to be pushed into the ring buffer.
+         */
+        template <typename U>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, U>
+#endif
+        auto isr_push(U&& elem)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
+#endif
+        {
+            static_cast<void>(emplace_val(std::forward<U>(elem)));
+        }
+
+        /**
+         * @brief Constructs an element at the back of the ring buffer from an ISR, dropping it if full.
+         *
+         * @tparam Args The deduced constructor argument types.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, Args...>
+#endif
+        auto isr_emplace(Args&&... args)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
+#endif
+        {
+            static_cast<void>(emplace_val(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Pushes all elements from a range into the ring buffer from an ISR.
+         *
+         * @tparam TRange The range type (deduced).
+         * @param range The source range of elements to push.
+         * @return The number of elements pushed.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange> && std::is_constructible_v<T, std::ranges::range_value_t<TRange>>
+#endif
+        std::size_t isr_push_range(TRange&& range)
+        {
+            return push_range(std::forward<TRange>(range));
+        }
+
+        /**
+         * @brief Pushes all elements from an initializer-list into the ring buffer from an ISR.
+         *
+         * @tparam U The initializer-list element type.
+         * @param range The source initializer-list.
+         * @return The number of elements pushed.
+         */
+        template <typename U
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<T, const U&>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<T, const U&>
+#endif
+        std::size_t isr_push_range(std::initializer_list<U> range)
+        {
+            return push_range(range);
+        }
+
+        /**
+         * @brief Checks if the ring buffer is full from an ISR.
+         *
+         * @return true if the ring buffer is full, false otherwise.
+         */
+        [[nodiscard]] bool isr_full() const
+        {
+            return full();
+        }
+
+        /**
+         * @brief Returns the size of the ring buffer from an ISR.
+         *
+         * @return The size of the ring buffer.
+         */
+        [[nodiscard]] std::size_t isr_size() const
+        {
+            return size();
+        }
+
+        /**
+         * @brief Gets the statistics policy of the ring buffer, e.g. to name or read a sync_container_stats.
+         *
+         * @return The statistics policy.
+         */
+        [[nodiscard]] Stats& stats()
+        {
+            return m_stats;
+        }
+
+        [[nodiscard]] const Stats& stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        static constexpr const bool is_spsc = (ring_concurrency::spsc_lock_free == Concurrency);
+
+        using ring_type =
+            typename detail::lock_free_ring_of<T, detail::ring_capacity_log2(Capacity), Concurrency>::type;
+
+        struct pointer_range
+        {
+            const T* first;
+            const T* last;
+
+            [[nodiscard]] const T* begin() const
+            {
+                return first;
+            }
+
+            [[nodiscard]] const T* end() const
+            {
+                return last;
+            }
+        };
+
+        template <typename... Args>
+        bool emplace_val(Args&&... args)
+        {
+            bool pushed = false;
+            if constexpr (is_spsc)
+            {
+                pushed = m_ring_buffer.emplace(std::forward<Args>(args)...);
+            }
+            else
+            {
+                pushed = m_ring_buffer.push(T(std::forward<Args>(args)...));
+            }
+            return 0U != counted_push(pushed ? 1U : 0U, 1U);
+        }
+
+        std::optional<T> pop_val()
+        {
+            std::optional<T> item;
+            if constexpr (is_spsc)
+            {
+                item = m_ring_buffer.try_pop();
+            }
+            else
+            {
+                item = m_ring_buffer.pop_opt();
+            }
+            static_cast<void>(counted_pop(item.has_value() ? 1U : 0U));
+            return item;
+        }
+
+        /**
+         * @brief Reports pushed elements to the statistics policy, and the shortfall on requested ones as
+         * overflows (0 when the request size is unknown).
+         */
+        std::size_t counted_push(std::size_t pushed, std::size_t requested)
+        {
+            if constexpr (Stats::enabled)
+            {
+                if (0U != pushed)
+                {
+                    m_stats.on_push(pushed, m_ring_buffer.size());
+                }
+                if (pushed < requested)
+                {
+                    m_stats.on_overflow(requested - pushed);
+                }
+            }
+            return pushed;
+        }
+
+        std::size_t counted_pop(std::size_t popped)
+        {
+            if (0U != popped)
+            {
+                m_stats.on_pop(popped);
+            }
+            return popped;
+        }
+
+        ring_type m_ring_buffer;
+        Stats m_stats;
     };
 }
 
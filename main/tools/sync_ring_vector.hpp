@@ -42,7 +42,9 @@
 #if !defined(SYNC_RING_VECTOR_HPP_)
 #define SYNC_RING_VECTOR_HPP_
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <mutex>
@@ -54,9 +56,13 @@
 #include <span>
 #endif
 
+#include "tools/adaptive_critical_section.hpp"
 #include "tools/critical_section.hpp"
+#include "tools/data_waiters.hpp"
 #include "tools/non_copyable.hpp"
 #include "tools/ring_vector.hpp"
+#include "tools/shared_critical_section.hpp"
+#include "tools/sync_container_stats.hpp"
 
 namespace tools
 {
@@ -68,9 +74,13 @@ namespace tools
      * and provides interrupt-safe methods for use in interrupt service routines (ISRs).
      *
      * @tparam T The type of elements stored in the ring vector.
+     * @tparam Lock The lock guarding the ring vector: critical_section, adaptive_critical_section to spin briefly
+     *              before blocking under contention, or shared_critical_section to let const peeks run concurrently.
+     * @tparam Stats The statistics policy: no_sync_container_stats (no cost), or sync_container_stats to count
+     *               pushes, pops, overflows, overwrites and lock contention.
      */
-    template <typename T>
-    class sync_ring_vector : public non_copyable // NOLINT inherits from non copyable and non movable class
+    template <typename T, typename Lock = critical_section, typename Stats = no_sync_container_stats>
+    class basic_sync_ring_vector : public non_copyable // NOLINT inherits from non copyable and non movable class
     {
     public:
         struct thread_safe
@@ -78,15 +88,15 @@ namespace tools
             static constexpr bool value = true;
         };
 
-        sync_ring_vector() = delete;
-        ~sync_ring_vector() = default;
+        basic_sync_ring_vector() = delete;
+        ~basic_sync_ring_vector() = default;
 
         /**
          * @brief Constructs a sync_ring_vector with the specified capacity.
          *
          * @param capacity The maximum number of elements the ring vector can hold.
          */
-        explicit sync_ring_vector(std::size_t capacity)
+        explicit basic_sync_ring_vector(std::size_t capacity)
             : m_ring_vector(capacity)
         {
         }
@@ -101,8 +111,9 @@ namespace tools
          */
         bool push(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push(elem);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_vector.push(elem));
         }
 
         /**
@@ -114,8 +125,9 @@ namespace tools
          */
         bool push(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push(std::move(elem));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_vector.push(std::move(elem)));
         }
 
         /**
@@ -135,8 +147,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push(std::forward<U>(elem));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_vector.push(std::forward<U>(elem)));
         }
 
         /**
@@ -156,8 +169,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.emplace(std::forward<Args>(args)...);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push(m_ring_vector.emplace(std::forward<Args>(args)...));
         }
 
         /**
@@ -165,10 +179,11 @@ namespace tools
          */
         void pop()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
             if (!m_ring_vector.empty())
             {
                 m_ring_vector.pop();
+                m_stats.on_pop(1U);
             }
         }
 
@@ -183,7 +198,7 @@ namespace tools
         [[nodiscard]] std::optional<T> front() const
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             if (!m_ring_vector.empty())
             {
                 item = m_ring_vector.front();
@@ -202,11 +217,12 @@ namespace tools
         [[nodiscard]] std::optional<T> front_pop()
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
             if (!m_ring_vector.empty())
             {
                 item = m_ring_vector.front();
                 m_ring_vector.pop();
+                m_stats.on_pop(1U);
             }
             return item;
         }
@@ -220,8 +236,8 @@ namespace tools
          */
         [[nodiscard]] std::optional<T> front_pop_move()
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.pop_move();
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_pop(m_ring_vector.pop_move());
         }
 
         /**
@@ -235,7 +251,7 @@ namespace tools
         [[nodiscard]] std::optional<T> back() const
         {
             std::optional<T> item;
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             if (!m_ring_vector.empty())
             {
                 item = m_ring_vector.back();
@@ -253,10 +269,42 @@ namespace tools
          */
         [[nodiscard]] tools::ring_vector<T> snapshot() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             return m_ring_vector;
         }
 
+        /**
+         * @brief Calls a visitor on every element in place, oldest first, under the lock.
+         *
+         * Unlike snapshot(), nothing is copied nor allocated. The visitor runs with the lock held: it must be
+         * short and must not call the ring vector.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param visitor The visitor.
+         * @return The number of elements visited.
+         */
+        template <typename Visitor>
+        std::size_t visit(Visitor&& visitor) const
+        {
+            tools::read_lock_guard<Lock> guard(m_mutex);
+            return m_ring_vector.visit_range(m_ring_vector.size(), visitor);
+        }
+
+        /**
+         * @brief Calls a visitor on the oldest elements in place, under the lock.
+         *
+         * @tparam Visitor Callable taking a const T&.
+         * @param count The maximum number of elements to visit.
+         * @param visitor The visitor, which must be short and must not call the ring vector.
+         * @return The number of elements visited, at most count.
+         */
+        template <typename Visitor>
+        std::size_t visit_range(std::size_t count, Visitor&& visitor) const
+        {
+            tools::read_lock_guard<Lock> guard(m_mutex);
+            return m_ring_vector.visit_range(count, visitor);
+        }
+
         /**
          * @brief Checks if the ring vector is empty.
          *
@@ -267,7 +315,7 @@ namespace tools
          */
         [[nodiscard]] bool empty() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             return m_ring_vector.empty();
         }
 
@@ -281,7 +329,7 @@ namespace tools
          */
         [[nodiscard]] bool full() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             return m_ring_vector.full();
         }
 
@@ -294,7 +342,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t size() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             return m_ring_vector.size();
         }
 
@@ -305,7 +353,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t capacity() const
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            tools::read_lock_guard<Lock> guard(m_mutex);
             return m_ring_vector.capacity();
         }
 
@@ -330,8 +378,9 @@ namespace tools
 #endif
         std::size_t push_range(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_range(std::forward<TRange>(range));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push_range(m_ring_vector.push_range(std::forward<TRange>(range)));
         }
 
         /**
@@ -351,8 +400,9 @@ namespace tools
 #endif
         std::size_t push_range(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_range(range);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push_span(m_ring_vector.push_range(range), range.size());
         }
 
         /**
@@ -367,8 +417,9 @@ namespace tools
          */
         bool push_overwrite(const T& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_overwrite(elem);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.push_overwrite(elem));
         }
 
         /**
@@ -378,8 +429,9 @@ namespace tools
          */
         bool push_overwrite(T&& elem)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_overwrite(std::move(elem));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.push_overwrite(std::move(elem)));
         }
 
         /**
@@ -398,8 +450,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_overwrite(std::forward<U>(elem));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.push_overwrite(std::forward<U>(elem)));
         }
 
         /**
@@ -417,8 +470,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
 #endif
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.emplace_overwrite(std::forward<Args>(args)...);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.emplace_overwrite(std::forward<Args>(args)...));
         }
 
         /**
@@ -440,8 +494,9 @@ namespace tools
 #endif
         push_range_overwrite_result push_range_overwrite(TRange&& range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_range_overwrite(std::forward<TRange>(range));
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.push_range_overwrite(std::forward<TRange>(range)));
         }
 
         /**
@@ -463,8 +518,9 @@ namespace tools
 #endif
         push_range_overwrite_result push_range_overwrite(std::initializer_list<U> range)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.push_range_overwrite(range);
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_overwrite(m_ring_vector.push_range_overwrite(range));
         }
 
         /**
@@ -478,8 +534,8 @@ namespace tools
         template <typename OutputIt>
         [[nodiscard]] std::size_t pop_range(OutputIt first, OutputIt last)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            return m_ring_vector.pop_range(first, last);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_pop_range(m_ring_vector.pop_range(first, last));
         }
 
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
@@ -495,21 +551,145 @@ namespace tools
         }
 #endif
 
+        /**
+         * @brief Gets the hook registering the ring vector with a wait_set, to wait on several sources at once.
+         *
+         * @return The hook, notified by every push.
+         */
+        wait_set_hook& ready_hook()
+        {
+            return m_data_waiters.ready_hook();
+        }
+
+        /**
+         * @brief Removes the front element, waiting up to a timeout for one to be pushed.
+         *
+         * The consumer sleeps on the ring vector's own event, signaled by pushes only while a consumer waits.
+         *
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The moved front element, or none if the ring vector stayed empty.
+         */
+        [[nodiscard]] std::optional<T> wait_pop(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            const auto take = [this]() { return counted_pop(m_ring_vector.pop_move()); };
+            const auto has_data = [this]() { return !m_ring_vector.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+        /**
+         * @brief Removes a batch of elements, waiting up to a timeout for at least one to be pushed.
+         *
+         * @tparam OutputIt Output iterator type.
+         * @param first Destination begin iterator.
+         * @param last Destination end iterator.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted, 0 if the ring vector stayed empty.
+         */
+        template <typename OutputIt>
+        [[nodiscard]] std::size_t wait_pop_range(
+            OutputIt first, OutputIt last, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            if (first == last)
+            {
+                return 0U;
+            }
+            const auto take
+                = [this, first, last]() { return counted_pop_range(m_ring_vector.pop_range(first, last)); };
+            const auto has_data = [this]() { return !m_ring_vector.empty(); };
+            return m_data_waiters.wait_take(m_mutex, timeout, take, has_data);
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span-based wait_pop_range() into contiguous storage.
+         *
+         * @param destination Span over writable destination storage.
+         * @param timeout The maximum duration to wait, zero to only try.
+         * @return The effective number of elements extracted.
+         */
+        [[nodiscard]] std::size_t wait_pop_range(
+            std::span<T> destination, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            return wait_pop_range(destination.begin(), destination.end(), timeout);
+        }
+#endif
+
+        /**
+         * @brief Appends a block of elements under a single lock, with bulk copies of the contiguous parts.
+         *
+         * @param data The elements to append.
+         * @param count The number of elements at data.
+         * @return The number of elements appended, fewer when the ring vector fills up.
+         */
+        std::size_t push_span(const T* data, std::size_t count)
+        {
+            const data_waiters::scoped_notify notify(m_data_waiters);
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_push_span(m_ring_vector.push_span(data, count), count);
+        }
+
+        /**
+         * @brief Removes the oldest elements into a block under a single lock, with bulk moves.
+         *
+         * @param destination Storage receiving the elements.
+         * @param count The number of elements destination can hold.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(T* destination, std::size_t count)
+        {
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            return counted_pop_range(m_ring_vector.pop_span(destination, count));
+        }
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+        /**
+         * @brief C++20 span overload of push_span().
+         *
+         * @param source The elements to append.
+         * @return The number of elements appended.
+         */
+        std::size_t push_span(std::span<const T> source)
+        {
+            return push_span(source.data(), source.size());
+        }
+
+        /**
+         * @brief C++20 span overload of pop_span().
+         *
+         * @param destination Storage receiving the elements.
+         * @return The number of elements removed.
+         */
+        std::size_t pop_span(std::span<T> destination)
+        {
+            return pop_span(destination.data(), destination.size());
+        }
+#endif
+
         /**
          * @brief Resizes the ring vector to the specified new size.
          *
          * This function changes the size of the ring vector to the new size specified by the parameter.
-         * It uses a mutex to ensure thread safety during the resizing operation.
+         * It uses a mutex to ensure thread safety during the resizing operation. The elements are relocated in
+         * place, so the lock is held for at most one pass over them, and without allocation when the storage was
+         * reserved beforehand.
          *
          * @param new_size The new size to which the ring vector should be resized.
          */
         void resize(std::size_t new_size)
         {
-            std::scoped_lock<tools::critical_section> guard(m_mutex);
-            if (new_size != m_ring_vector.size())
-            {
-                m_ring_vector.resize(new_size);
-            }
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            m_ring_vector.resize(new_size);
+        }
+
+        /**
+         * @brief Reserves storage so that a later resize() up to storage_capacity does not allocate.
+         *
+         * @param storage_capacity The capacity the storage must be able to reach without reallocation.
+         */
+        void reserve(std::size_t storage_capacity)
+        {
+            const sync_stats_lock_guard<Lock, Stats> guard(m_mutex, m_stats);
+            m_ring_vector.reserve(storage_capacity);
         }
 
         /**
@@ -522,8 +702,9 @@ namespace tools
          */
         void isr_push(const T& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_vector.push(elem);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            counted_push(m_ring_vector.push(elem));
         }
 
         /**
@@ -535,8 +716,9 @@ namespace tools
          */
         void isr_push(T&& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_vector.push(std::move(elem));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            counted_push(m_ring_vector.push(std::move(elem)));
         }
 
         /**
@@ -556,8 +738,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, void>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_vector.push(std::forward<U>(elem));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            counted_push(m_ring_vector.push(std::forward<U>(elem)));
         }
 
         /**
@@ -577,8 +760,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, void>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            m_ring_vector.emplace(std::forward<Args>(args)...);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            counted_push(m_ring_vector.emplace(std::forward<Args>(args)...));
         }
 
         /**
@@ -602,8 +786,9 @@ namespace tools
 #endif
         std::size_t isr_push_range(TRange&& range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_range(std::forward<TRange>(range));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_push_range(m_ring_vector.push_range(std::forward<TRange>(range)));
         }
 
         /**
@@ -623,8 +808,9 @@ namespace tools
 #endif
         std::size_t isr_push_range(std::initializer_list<U> range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_range(range);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_push_span(m_ring_vector.push_range(range), range.size());
         }
 
         /**
@@ -634,8 +820,9 @@ namespace tools
          */
         bool isr_push_overwrite(const T& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_overwrite(elem);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.push_overwrite(elem));
         }
 
         /**
@@ -645,8 +832,9 @@ namespace tools
          */
         bool isr_push_overwrite(T&& elem)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_overwrite(std::move(elem));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.push_overwrite(std::move(elem)));
         }
 
         /**
@@ -665,8 +853,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, U>::value, bool>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_overwrite(std::forward<U>(elem));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.push_overwrite(std::forward<U>(elem)));
         }
 
         /**
@@ -684,8 +873,9 @@ namespace tools
             -> typename std::enable_if<std::is_constructible<T, Args...>::value, bool>::type
 #endif
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.emplace_overwrite(std::forward<Args>(args)...);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.emplace_overwrite(std::forward<Args>(args)...));
         }
 
         /**
@@ -707,8 +897,9 @@ namespace tools
 #endif
         push_range_overwrite_result isr_push_range_overwrite(TRange&& range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_range_overwrite(std::forward<TRange>(range));
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.push_range_overwrite(std::forward<TRange>(range)));
         }
 
         /**
@@ -730,8 +921,9 @@ namespace tools
 #endif
         push_range_overwrite_result isr_push_range_overwrite(std::initializer_list<U> range)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            return m_ring_vector.push_range_overwrite(range);
+            const data_waiters::scoped_isr_notify notify(m_data_waiters);
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            return counted_overwrite(m_ring_vector.push_range_overwrite(range));
         }
 
         /**
@@ -743,7 +935,7 @@ namespace tools
          */
         [[nodiscard]] bool isr_full() const
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
             return m_ring_vector.full();
         }
 
@@ -758,7 +950,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t isr_size() const
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
             return m_ring_vector.size();
         }
 
@@ -769,7 +961,7 @@ namespace tools
          */
         [[nodiscard]] std::size_t isr_capacity() const
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
             return m_ring_vector.capacity();
         }
 
@@ -783,17 +975,140 @@ namespace tools
          */
         void isr_resize(std::size_t new_size)
         {
-            tools::isr_lock_guard<tools::critical_section> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
-            if (new_size != m_ring_vector.size())
+            tools::isr_lock_guard<Lock> guard(m_mutex); // NOLINT(modernize-use-scoped-lock)
+            m_ring_vector.resize(new_size);
+        }
+
+        /**
+         * @brief Gets the statistics policy of the ring vector, e.g. to name or read a sync_container_stats.
+         *
+         * @return The statistics policy.
+         */
+        [[nodiscard]] Stats& stats()
+        {
+            return m_stats;
+        }
+
+        [[nodiscard]] const Stats& stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        // the counted_* helpers run under the lock and report the outcome of a ring operation to m_stats
+
+        bool counted_push(bool pushed)
+        {
+            if constexpr (Stats::enabled)
             {
-                m_ring_vector.resize(new_size);
+                if (pushed)
+                {
+                    m_stats.on_push(1U, m_ring_vector.size());
+                }
+                else
+                {
+                    m_stats.on_overflow(1U);
+                }
             }
+            return pushed;
+        }
+
+        std::size_t counted_push_range(std::size_t pushed)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(pushed, m_ring_vector.size());
+            }
+            return pushed;
+        }
+
+        std::size_t counted_push_span(std::size_t pushed, std::size_t requested)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(pushed, m_ring_vector.size());
+                if (pushed < requested)
+                {
+                    m_stats.on_overflow(requested - pushed);
+                }
+            }
+            return pushed;
+        }
+
+        bool counted_overwrite(bool overwritten)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(1U, m_ring_vector.size());
+                if (overwritten)
+                {
+                    m_stats.on_overwrite(1U);
+                }
+            }
+            return overwritten;
+        }
+
+        push_range_overwrite_result counted_overwrite(const push_range_overwrite_result& result)
+        {
+            if constexpr (Stats::enabled)
+            {
+                m_stats.on_push(result.inserted + result.overwritten, m_ring_vector.size());
+                if (0U != result.overwritten)
+                {
+                    m_stats.on_overwrite(result.overwritten);
+                }
+            }
+            return result;
+        }
+
+        std::optional<T> counted_pop(std::optional<T>&& item)
+        {
+            if (item.has_value())
+            {
+                m_stats.on_pop(1U);
+            }
+            return std::move(item);
+        }
+
+        std::size_t counted_pop_range(std::size_t popped)
+        {
+            m_stats.on_pop(popped);
+            return popped;
         }
 
-    private:
         ring_vector<T> m_ring_vector;
-        mutable critical_section m_mutex;
+        mutable Lock m_mutex;
+        data_waiters m_data_waiters;
+        Stats m_stats;
     };
+
+    /**
+     * @brief Thread-safe ring vector guarded by a critical_section.
+     *
+     * @tparam T The type of elements stored in the ring vector.
+     */
+    template <typename T>
+    using sync_ring_vector = basic_sync_ring_vector<T, critical_section>;
+
+    /**
+     * @brief Thread-safe ring vector guarded by an adaptive_critical_section (spin, then block).
+     *
+     * @tparam T The type of elements stored in the ring vector.
+     */
+    template <typename T>
+    using adaptive_sync_ring_vector = basic_sync_ring_vector<T, adaptive_critical_section>;
+
+    /**
+     * @brief Thread-safe ring vector guarded by a shared_critical_section, for read-mostly rings.
+     *
+     * Peeks (front, back, snapshot, empty, full, size, capacity) run concurrently; every mutation takes the
+     * lock exclusively. Pays off when consumers mostly inspect the ring, e.g. a history buffer polled by several
+     * tasks, and the isr_* accessors follow the shared_critical_section ISR rules.
+     *
+     * @tparam T The type of elements stored in the ring vector.
+     */
+    template <typename T>
+    using shared_sync_ring_vector = basic_sync_ring_vector<T, shared_critical_section>;
 }
 
 #endif //  SYNC_RING_VECTOR_HPP_
@@ -3,7 +3,8 @@
  * @brief Thread-safe chronological timestamp/value helper based on tools::time_list.
  *
  * This file defines tools::sync_time_list, a thread-safe adapter that derives from
- * tools::time_list and protects all public operations with tools::critical_section.
+ * tools::time_list (or tools::sorted_time_list) and protects all public operations
+ * with tools::critical_section.
  *
  * @author Laurent Lardinois (with the help of Github Copilot)
  * @date May 2026
@@ -39,6 +40,7 @@
 #if !defined(SYNC_TIME_LIST_HPP_)
 #define SYNC_TIME_LIST_HPP_
 
+#include <cstddef>
 #include <mutex>
 #include <optional>
 #include <type_traits>
@@ -62,12 +64,14 @@ namespace tools
      *
      * @tparam TTimestamp Timestamp type accepted by tools::time_list.
      * @tparam TValue Value type associated with each timestamp.
+     * @tparam TList Underlying list, tools::time_list, tools::sorted_time_list (which adds visit_range/for_each) or
+     *               tools::windowed_time_list (which adds the horizon eviction and expire).
      */
-    template <typename TTimestamp, typename TValue>
-    class sync_time_list : public time_list<TTimestamp, TValue>, public non_copyable // NOLINT non-copyable by design
+    template <typename TTimestamp, typename TValue, typename TList = time_list<TTimestamp, TValue>>
+    class sync_time_list : public TList, public non_copyable // NOLINT non-copyable by design
     {
     public:
-        using base_type = time_list<TTimestamp, TValue>;
+        using base_type = TList;
         using timestamp_type = typename base_type::timestamp_type;
         using value_type = typename base_type::value_type;
         using entry_type = typename base_type::entry_type;
@@ -80,6 +84,15 @@ namespace tools
         sync_time_list() = default;
         ~sync_time_list() = default;
 
+        /** @brief Constructs the underlying list from arguments, e.g. the capacity and horizon of a windowed_time_list. */
+        template <typename... TArgs,
+            typename = typename std::enable_if<(sizeof...(TArgs) > 0U)
+                && std::is_constructible<base_type, TArgs...>::value>::type>
+        explicit sync_time_list(TArgs&&... args)
+            : base_type(std::forward<TArgs>(args)...)
+        {
+        }
+
         /** @brief Pushes an entry by copy in a thread-safe manner. */
         void push(const timestamp_type& timestamp_value, const value_type& payload_value)
         {
@@ -145,6 +158,58 @@ namespace tools
             return base_type::top_pop();
         }
 
+        /** @brief Removes every entry up to a timestamp, in one critical section (consumer runs under the lock). */
+        template <typename TConsumer>
+        std::size_t pop_until(const timestamp_type& timestamp_value, TConsumer&& consumer)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::pop_until(timestamp_value, std::forward<TConsumer>(consumer));
+        }
+
+        /** @brief Removes every entry up to a timestamp in a thread-safe manner. */
+        std::size_t pop_until(const timestamp_type& timestamp_value)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::pop_until(timestamp_value);
+        }
+
+        /** @brief Evicts the entries older than the horizon before a given time (windowed_time_list only). */
+        std::size_t expire(const timestamp_type& now_value)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::expire(now_value);
+        }
+
+        /** @brief Returns the horizon eviction count in a thread-safe manner (windowed_time_list only). */
+        [[nodiscard]] std::size_t evicted_count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::evicted_count();
+        }
+
+        /** @brief Returns the full ring drop count in a thread-safe manner (windowed_time_list only). */
+        [[nodiscard]] std::size_t dropped_count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::dropped_count();
+        }
+
+        /** @brief Visits a [from, until) time window in place (sorted_time_list only; visitor runs under the lock). */
+        template <typename TVisitor>
+        std::size_t visit_range(const timestamp_type& from, const timestamp_type& until, TVisitor&& visitor) const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::visit_range(from, until, std::forward<TVisitor>(visitor));
+        }
+
+        /** @brief Visits every entry in order in place (sorted_time_list only; visitor runs under the lock). */
+        template <typename TVisitor>
+        void for_each(TVisitor&& visitor) const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            base_type::for_each(std::forward<TVisitor>(visitor));
+        }
+
         /** @brief Returns true when empty in a thread-safe manner. */
         [[nodiscard]] bool empty() const
         {
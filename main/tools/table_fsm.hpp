@@ -0,0 +1,380 @@
+/**
+ * @file table_fsm.hpp
+ * @brief Finite state machine driven by a constexpr transition table indexed by state and event ids.
+ *
+ * States and events are enums closed by a count enumerator. The table is built at compile time from a list of
+ * transitions into a dense state x event grid, so that dispatching an event is one array lookup, with no variant
+ * visitation, no allocation and a compile time that grows with the number of transitions only.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TABLE_FSM_HPP_)
+#define TABLE_FSM_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Payload of the events of a table_fsm whose events carry no data.
+     */
+    struct fsm_no_payload
+    {
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Not constexpr on purpose: reaching it while building a table at compile time is a compile error.
+         */
+        inline void fsm_duplicate_transition()
+        {
+        }
+
+        /**
+         * @brief Not constexpr on purpose: reaching it while building a table at compile time is a compile error.
+         */
+        inline void fsm_id_out_of_range()
+        {
+        }
+    }
+
+    /**
+     * @brief Finite state machine dispatching events through a constexpr state x event transition table.
+     *
+     * A transition runs the exit action of the source state, the transition action, then the entry action of the
+     * target state; a self transition runs both state actions, like any other. Events without a transition in the
+     * current state are counted and otherwise ignored. Actions are plain function pointers taking the context of
+     * the machine, so that the table is a literal living in read-only memory.
+     *
+     * Dispatch is run to completion: actions must not dispatch to their own machine. Events raised by actions, like
+     * events from other tasks, are published to the async_observer feeding the machine, which queues them for the
+     * next process_events() round.
+     *
+     * @code
+     * enum class door_state : std::uint8_t { closed, open, locked, count };
+     * enum class door_event : std::uint8_t { push, pull, lock, unlock, count };
+     * void open_door(door& context, const tools::fsm_no_payload& payload);
+     * using door_fsm = tools::table_fsm<door_state, door_event, door>;
+     *
+     * static constexpr auto door_table = door_fsm::make_table(std::array {
+     *     door_fsm::transition { door_state::closed, door_event::push, door_state::open, open_door },
+     *     door_fsm::transition { door_state::open, door_event::pull, door_state::closed },
+     *     door_fsm::transition { door_state::closed, door_event::lock, door_state::locked },
+     *     door_fsm::transition { door_state::locked, door_event::unlock, door_state::closed } });
+     *
+     * door_fsm fsm(door_table, my_door, door_state::closed);
+     * fsm.start();
+     * fsm.dispatch(door_event::push);
+     * @endcode
+     *
+     * @tparam State Enum of the states, closed by a count enumerator.
+     * @tparam Event Enum of the events, closed by a count enumerator.
+     * @tparam Context Type the actions operate on, referenced by the machine.
+     * @tparam Payload Data carried by every event, handed to the transition actions.
+     */
+    template <typename State, typename Event, typename Context, typename Payload = fsm_no_payload>
+    class table_fsm : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_enum_v<State> && std::is_enum_v<Event>, "states and events are enums");
+
+        static constexpr std::size_t state_count = static_cast<std::size_t>(State::count);
+        static constexpr std::size_t event_count = static_cast<std::size_t>(Event::count);
+        static_assert(state_count < std::numeric_limits<std::uint8_t>::max(), "at most 254 states");
+
+        using transition_action = void (*)(Context& context, const Payload& payload);
+        using state_action = void (*)(Context& context);
+
+        /**
+         * @brief One row of the transition list given to make_table.
+         */
+        struct transition
+        {
+            State from;                                ///< Source state.
+            Event event;                               ///< Triggering event.
+            State to;                                  ///< Target state.
+            transition_action on_transition = nullptr; ///< Action run between the exit and the entry actions.
+        };
+
+        /**
+         * @brief Entry and exit actions of one state.
+         */
+        struct state_actions
+        {
+            state_action on_entry = nullptr; ///< Run when the state is entered, and by start() for the initial state.
+            state_action on_exit = nullptr;  ///< Run when the state is left.
+        };
+
+        /**
+         * @brief One cell of the state x event grid.
+         */
+        struct cell
+        {
+            transition_action on_transition = nullptr;
+            std::uint8_t target = no_target; ///< Index of the target state, no_target when the event is not handled.
+        };
+
+        static constexpr std::uint8_t no_target = std::numeric_limits<std::uint8_t>::max();
+
+        /**
+         * @brief Dense transition table, built by make_table.
+         */
+        struct table
+        {
+            std::array<cell, state_count * event_count> cells = {};
+            std::array<state_actions, state_count> states = {};
+        };
+
+        /**
+         * @brief Builds the dense table from a transition list, at compile time when used in a constexpr context.
+         *
+         * A (state, event) pair listed twice, or an id at or past count, is a compile error in a constexpr context.
+         *
+         * @tparam TransitionCount The number of transitions.
+         * @param transitions The transitions.
+         * @param states The entry and exit actions, indexed by state.
+         * @return The table.
+         */
+        template <std::size_t TransitionCount>
+        [[nodiscard]] static constexpr table make_table(const std::array<transition, TransitionCount>& transitions,
+            const std::array<state_actions, state_count>& states = {})
+        {
+            table result;
+            result.states = states;
+            for (const auto& row : transitions)
+            {
+                const auto from = static_cast<std::size_t>(row.from);
+                const auto event = static_cast<std::size_t>(row.event);
+                const auto to = static_cast<std::size_t>(row.to);
+                if ((from >= state_count) || (event >= event_count) || (to >= state_count))
+                {
+                    detail::fsm_id_out_of_range();
+                    continue;
+                }
+
+                cell& slot = result.cells[(from * event_count) + event];
+                if (no_target != slot.target)
+                {
+                    detail::fsm_duplicate_transition();
+                }
+                slot.target = static_cast<std::uint8_t>(to);
+                slot.on_transition = row.on_transition;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Constructs a machine in its initial state; start() runs the entry action of that state.
+         *
+         * @param fsm_table The transition table, which must outlive the machine (a static constexpr one does).
+         * @param context The context handed to the actions, which must outlive the machine.
+         * @param initial The initial state.
+         */
+        table_fsm(const table& fsm_table, Context& context, State initial)
+            : m_table(fsm_table)
+            , m_context(context)
+            , m_initial(initial)
+            , m_state(initial)
+        {
+        }
+
+        ~table_fsm() = default;
+
+        /**
+         * @brief Puts the machine back in its initial state and runs the entry action of that state.
+         */
+        void start()
+        {
+            m_state = m_initial;
+            run(m_table.states[static_cast<std::size_t>(m_state)].on_entry);
+        }
+
+        /**
+         * @brief Dispatches an event to the current state.
+         *
+         * @param event The event.
+         * @param payload The data of the event, handed to the transition action.
+         * @return true if the current state handles the event, false if it was ignored.
+         */
+        bool dispatch(Event event, const Payload& payload = {})
+        {
+            const auto event_index = static_cast<std::size_t>(event);
+            const auto from = static_cast<std::size_t>(m_state);
+            if (event_index >= event_count)
+            {
+                ++m_unhandled;
+                return false;
+            }
+
+            const cell& slot = m_table.cells[(from * event_count) + event_index];
+            if (no_target == slot.target)
+            {
+                ++m_unhandled;
+                return false;
+            }
+
+            run(m_table.states[from].on_exit);
+            if (nullptr != slot.on_transition)
+            {
+                slot.on_transition(m_context, payload);
+            }
+            m_state = static_cast<State>(slot.target);
+            run(m_table.states[slot.target].on_entry);
+            ++m_transitions;
+            return true;
+        }
+
+        /**
+         * @brief Dispatches the events queued in an async_observer, in FIFO order, until the queue is empty.
+         *
+         * The observer carries fsm events: its Evt type is either Event, or a type with `event` and `payload`
+         * members. Events are moved out in batches of BatchSize under one container lock each, into a buffer on the
+         * stack; with an interned origin_id as Origin, draining does not allocate.
+         *
+         * @tparam BatchSize The number of events moved out of the observer per batch.
+         * @tparam Observer The async_observer type.
+         * @param observer The observer.
+         * @return The number of events dispatched, handled or not.
+         */
+        template <std::size_t BatchSize = 16U, typename Observer>
+        std::size_t process_events(Observer& observer)
+        {
+            std::array<typename Observer::event_entry, BatchSize> batch = {};
+            std::size_t processed = 0U;
+            std::size_t popped = 0U;
+            do
+            {
+                popped = observer.pop_events_into(batch.begin(), batch.end());
+                for (std::size_t index = 0U; index < popped; ++index)
+                {
+                    dispatch_entry(std::get<1>(batch[index]));
+                }
+                processed += popped;
+            } while (BatchSize == popped);
+            return processed;
+        }
+
+        /**
+         * @brief Checks whether the current state handles an event, without dispatching it.
+         *
+         * @param event The event.
+         * @return true if dispatching the event would run a transition.
+         */
+        [[nodiscard]] bool handles(Event event) const
+        {
+            const auto event_index = static_cast<std::size_t>(event);
+            return (event_index < event_count)
+                && (no_target
+                    != m_table.cells[(static_cast<std::size_t>(m_state) * event_count) + event_index].target);
+        }
+
+        /**
+         * @brief Gets the current state.
+         *
+         * @return The state.
+         */
+        [[nodiscard]] State state() const
+        {
+            return m_state;
+        }
+
+        /**
+         * @brief Gets the number of transitions run since construction.
+         *
+         * @return The transition count.
+         */
+        [[nodiscard]] std::uint32_t transition_count() const
+        {
+            return m_transitions;
+        }
+
+        /**
+         * @brief Gets the number of events ignored because the state they reached had no transition for them.
+         *
+         * @return The unhandled event count.
+         */
+        [[nodiscard]] std::uint32_t unhandled_count() const
+        {
+            return m_unhandled;
+        }
+
+    private:
+        void run(state_action action)
+        {
+            if (nullptr != action)
+            {
+                action(m_context);
+            }
+        }
+
+        void dispatch_entry(Event event)
+        {
+            static_cast<void>(dispatch(event));
+        }
+
+        template <typename Entry>
+        auto dispatch_entry(const Entry& entry) -> decltype(static_cast<void>(entry.event), void())
+        {
+            static_cast<void>(dispatch(entry.event, entry.payload));
+        }
+
+        const table& m_table;
+        Context& m_context;
+        State m_initial;
+        State m_state;
+        std::uint32_t m_transitions = 0U;
+        std::uint32_t m_unhandled = 0U;
+    };
+
+    /**
+     * @brief Event carrying a payload, to publish to the async_observer feeding a table_fsm.
+     *
+     * @tparam Event Enum of the events.
+     * @tparam Payload Data carried by the event.
+     */
+    template <typename Event, typename Payload>
+    struct fsm_event
+    {
+        Event event;     ///< Event id.
+        Payload payload; ///< Data handed to the transition action.
+    };
+}
+
+#endif // TABLE_FSM_HPP_
@@ -0,0 +1,780 @@
+/**
+ * @file task.hpp
+ * @brief A lazy coroutine task type with symmetric transfer and awaitables over the framework primitives.
+ *
+ * This file contains the definition of the task class template, a move-only lazily started coroutine whose
+ * frames come from a small pooled allocator, and of awaitables for delays (timer_scheduler), memory_pipe
+ * receptions, sync_object signals and data_task submissions. A suspended coroutine is resumed by posting it to
+ * an executor (a worker_task or any portable_concurrency executor), so that many sequential protocol handlers
+ * can share one worker thread instead of owning one task stack each.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TASK_HPP_)
+#define TASK_HPP_
+
+#if defined(__cpp_impl_coroutine)
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tools/critical_section.hpp"
+#include "tools/memory_pipe.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/sync_object.hpp"
+#include "tools/timer_scheduler.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Snapshot of the counters of the coroutine frame pool.
+     */
+    struct coro_frame_stats
+    {
+        std::size_t allocations = 0U; ///< Frames allocated so far.
+        std::size_t reuses = 0U;      ///< Allocations served by a cached frame.
+        std::size_t oversized = 0U;   ///< Frames bigger than the largest size class, always from the heap.
+        std::size_t cached = 0U;      ///< Frames currently cached for reuse.
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Size-class cache of released coroutine frames.
+         *
+         * Frames are rounded up to a power-of-two size class and up to max_cached released frames are kept per
+         * class, so that short-lived awaiting coroutines (one per request or per connection) do not go back to
+         * the heap each time. Frames above the largest class are plain heap allocations.
+         */
+        class coro_frame_pool : public non_copyable // NOLINT inherits from non copyable/non movable
+        {
+        public:
+            /** @brief Smallest size class in bytes. */
+            static constexpr std::size_t min_block_size = 64U;
+
+            /** @brief Number of size classes (64 to 2048 bytes). */
+            static constexpr std::size_t class_count = 6U;
+
+            /** @brief Maximum number of frames cached per size class. */
+            static constexpr std::size_t max_cached = 8U;
+
+            coro_frame_pool() = default;
+            ~coro_frame_pool() = default;
+
+            /**
+             * @brief Allocates a frame, reusing a cached one of the same size class when available.
+             *
+             * @param size The frame size requested by the compiler.
+             * @return Pointer to the frame storage.
+             */
+            void* allocate(std::size_t size)
+            {
+                const std::size_t class_index = size_class(size);
+
+                {
+                    std::scoped_lock<tools::critical_section> guard(m_mutex);
+                    ++m_stats.allocations;
+
+                    if (class_index >= class_count)
+                    {
+                        ++m_stats.oversized;
+                    }
+                    else if (nullptr != m_free[class_index])
+                    {
+                        free_block* block = m_free[class_index];
+                        m_free[class_index] = block->next;
+                        --m_counts[class_index];
+                        --m_stats.cached;
+                        ++m_stats.reuses;
+                        return block;
+                    }
+                }
+
+                return ::operator new((class_index >= class_count) ? size : (min_block_size << class_index));
+            }
+
+            /**
+             * @brief Releases a frame, caching it if its size class is not full.
+             *
+             * @param ptr Pointer returned by allocate().
+             * @param size The size passed to allocate().
+             */
+            void deallocate(void* ptr, std::size_t size) noexcept
+            {
+                const std::size_t class_index = size_class(size);
+
+                if (class_index < class_count)
+                {
+                    std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+                    if (m_counts[class_index] < max_cached)
+                    {
+                        auto* block = ::new (ptr) free_block { m_free[class_index] };
+                        m_free[class_index] = block;
+                        ++m_counts[class_index];
+                        ++m_stats.cached;
+                        return;
+                    }
+                }
+
+                ::operator delete(ptr);
+            }
+
+            /**
+             * @brief Retrieves the pool counters.
+             *
+             * @return A snapshot of the counters.
+             */
+            [[nodiscard]] coro_frame_stats stats() const
+            {
+                std::scoped_lock<tools::critical_section> guard(m_mutex);
+                return m_stats;
+            }
+
+        private:
+            struct free_block
+            {
+                free_block* next;
+            };
+
+            static constexpr std::size_t size_class(std::size_t size)
+            {
+                std::size_t class_index = 0U;
+                while ((class_index < class_count) && ((min_block_size << class_index) < size))
+                {
+                    ++class_index;
+                }
+                return class_index;
+            }
+
+            std::array<free_block*, class_count> m_free = {};
+            std::array<std::size_t, class_count> m_counts = {};
+            coro_frame_stats m_stats;
+            mutable critical_section m_mutex;
+        };
+
+        /**
+         * @brief Returns the process-wide coroutine frame pool.
+         *
+         * The pool is never destroyed, so that frames of coroutines still suspended at exit can be released.
+         *
+         * @return The pool.
+         */
+        inline coro_frame_pool& coro_frames()
+        {
+            static auto* pool = new coro_frame_pool(); // NOLINT intentionally leaked, outlives every frame
+            return *pool;
+        }
+
+        /**
+         * @brief Promise part shared by every task<T>: frame allocation, lazy start and symmetric transfer.
+         */
+        class task_promise_base
+        {
+        public:
+            /**
+             * @brief Final awaiter transferring control to the awaiting coroutine, if any.
+             */
+            struct final_awaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    task_promise_base& promise = handle.promise();
+
+                    if (promise.m_continuation)
+                    {
+                        return promise.m_continuation;
+                    }
+
+                    if (promise.m_detached)
+                    {
+                        handle.destroy();
+                    }
+
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            static void* operator new(std::size_t size)
+            {
+                return coro_frames().allocate(size);
+            }
+
+            static void operator delete(void* ptr, std::size_t size) noexcept
+            {
+                coro_frames().deallocate(ptr, size);
+            }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            [[nodiscard]] final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                // the framework is exception-free, a throwing coroutine body is a programming error
+                std::terminate();
+            }
+
+            std::coroutine_handle<> m_continuation;
+            bool m_detached = false;
+        };
+
+        /**
+         * @brief Promise of a task producing a value.
+         *
+         * @tparam T The value type.
+         */
+        template <typename T>
+        class task_promise : public task_promise_base
+        {
+        public:
+            template <typename U>
+            void return_value(U&& value)
+            {
+                m_value.emplace(std::forward<U>(value));
+            }
+
+            std::optional<T> m_value;
+        };
+
+        /**
+         * @brief Promise of a task producing no value.
+         */
+        template <>
+        class task_promise<void> : public task_promise_base
+        {
+        public:
+            void return_void() const noexcept
+            {
+            }
+        };
+    }
+
+    /**
+     * @brief Retrieves the counters of the coroutine frame pool.
+     *
+     * @return A snapshot of the counters.
+     */
+    inline coro_frame_stats coro_frame_pool_stats()
+    {
+        return detail::coro_frames().stats();
+    }
+
+    /**
+     * @brief A lazily started, move-only coroutine producing a T.
+     *
+     * The body runs on co_await (the awaiting coroutine is resumed by symmetric transfer once it completes, so
+     * deep await chains do not grow the stack), on start() for a root task owned by the caller, or on detach() /
+     * spawn() for a root task owning itself. Frames come from the coroutine frame pool.
+     *
+     * @tparam T The type of the produced value, void for none.
+     */
+    template <typename T = void>
+    class task
+    {
+    public:
+        /**
+         * @brief Coroutine promise type.
+         */
+        class promise_type : public detail::task_promise<T>
+        {
+        public:
+            task get_return_object() noexcept
+            {
+                return task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+        };
+
+        task() noexcept = default;
+
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+
+        task(task&& other) noexcept
+            : m_handle(std::exchange(other.m_handle, nullptr))
+        {
+        }
+
+        task& operator=(task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~task()
+        {
+            release();
+        }
+
+        /**
+         * @brief Checks if the task owns a coroutine.
+         *
+         * @return true if the task has a coroutine frame.
+         */
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return static_cast<bool>(m_handle);
+        }
+
+        /**
+         * @brief Checks if the coroutine ran to completion.
+         *
+         * @return true if the coroutine is finished.
+         */
+        [[nodiscard]] bool done() const noexcept
+        {
+            return m_handle && m_handle.done();
+        }
+
+        /**
+         * @brief Runs a root task in the calling thread until its first suspension or its completion.
+         *
+         * Call it once, on a task that is not awaited; the task object must outlive the coroutine.
+         */
+        void start()
+        {
+            if (m_handle && !m_handle.done())
+            {
+                m_handle.resume();
+            }
+        }
+
+        /**
+         * @brief Starts a root task in the calling thread and gives the coroutine ownership of its frame.
+         *
+         * The frame is released when the coroutine completes; the task object becomes empty.
+         */
+        void detach()
+        {
+            if (m_handle)
+            {
+                auto handle = std::exchange(m_handle, nullptr);
+                handle.promise().m_detached = true;
+                handle.resume();
+            }
+        }
+
+        /**
+         * @brief Takes the value produced by a completed task.
+         *
+         * @return The value, or none if the task is not done (or the value was already taken).
+         */
+        template <typename U = T>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires(!std::is_void_v<U>)
+#endif
+        [[nodiscard]] std::optional<U> get()
+        {
+            std::optional<U> value;
+            if (done())
+            {
+                value = std::move(m_handle.promise().m_value);
+                m_handle.promise().m_value.reset();
+            }
+            return value;
+        }
+
+        /**
+         * @brief Awaiter starting the task and resuming the awaiting coroutine once it completes.
+         */
+        class awaiter
+        {
+        public:
+            explicit awaiter(std::coroutine_handle<promise_type> handle) noexcept
+                : m_handle(handle)
+            {
+            }
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return !m_handle || m_handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                m_handle.promise().m_continuation = awaiting;
+                return m_handle;
+            }
+
+            T await_resume()
+            {
+                if constexpr (!std::is_void_v<T>)
+                {
+                    // a completed coroutine always returned its value, the framework being exception-free
+                    return std::move(*m_handle.promise().m_value);
+                }
+            }
+
+        private:
+            std::coroutine_handle<promise_type> m_handle;
+        };
+
+        /**
+         * @brief Awaits the task from another coroutine.
+         *
+         * @return The awaiter.
+         */
+        awaiter operator co_await() && noexcept
+        {
+            return awaiter { m_handle };
+        }
+
+    private:
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle)
+        {
+        }
+
+        void release() noexcept
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+                m_handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    /**
+     * @brief Starts a root task on an executor, the coroutine owning its frame.
+     *
+     * @tparam Exec Executor type (worker_task::executor_type or any portable_concurrency executor).
+     * @param exec Executor running the task until its first suspension.
+     * @param root_task The task, left empty.
+     */
+    template <typename Exec>
+    void spawn(Exec exec, task<void>&& root_task)
+    {
+        auto owned = std::make_shared<task<void>>(std::move(root_task));
+        post(exec, [owned]() mutable { owned->detach(); });
+    }
+
+    /**
+     * @brief Where and when awaitables resume a suspended coroutine.
+     *
+     * Resumptions are posted to the executor from the timer_scheduler thread. Awaitables over primitives that
+     * have no completion callback (memory_pipe, sync_object, data_task) re-check their condition every
+     * poll_period while suspended, on the executor, instead of blocking a thread.
+     *
+     * @tparam Exec Executor type (worker_task::executor_type or any portable_concurrency executor).
+     */
+    template <typename Exec>
+    struct await_context
+    {
+        timer_scheduler* timers = nullptr; ///< Timer service arming the wakeups.
+        Exec executor;                     ///< Executor resuming the coroutines.
+        std::chrono::duration<std::uint64_t, std::micro> poll_period
+            = std::chrono::duration<std::uint64_t, std::micro>(1000U); ///< Re-check period of polled awaitables.
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Posts the resumption of a coroutine to an executor once a delay has elapsed.
+         *
+         * @tparam Exec Executor type.
+         * @tparam Fn Copyable callable type.
+         * @param context The await context.
+         * @param delay The delay.
+         * @param fn Callable run on the executor.
+         */
+        template <typename Exec, typename Fn>
+        void post_after(
+            const await_context<Exec>& context, const std::chrono::duration<std::uint64_t, std::micro>& delay, Fn fn)
+        {
+            context.timers->add(
+                "coro_wakeup", delay,
+                [exec = context.executor, fn](timer_handle) mutable { post(exec, fn); }, timer_type::one_shot);
+        }
+
+        /**
+         * @brief Awaitable re-checking a non-blocking operation until it completes or its timeout expires.
+         *
+         * @tparam Exec Executor type.
+         * @tparam Operation Type with bool try_complete() and result().
+         */
+        template <typename Exec, typename Operation>
+        class polling_awaitable
+        {
+        public:
+            polling_awaitable(const await_context<Exec>& context, Operation&& operation,
+                const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+                : m_context(context)
+                , m_operation(std::move(operation))
+                , m_deadline(std::chrono::steady_clock::now()
+                      + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout))
+            {
+            }
+
+            [[nodiscard]] bool await_ready()
+            {
+                return m_operation.try_complete() || expired();
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                m_handle = handle;
+                arm();
+            }
+
+            auto await_resume()
+            {
+                return m_operation.result();
+            }
+
+        private:
+            [[nodiscard]] bool expired() const
+            {
+                return std::chrono::steady_clock::now() >= m_deadline;
+            }
+
+            void arm()
+            {
+                post_after(m_context, m_context.poll_period,
+                    [this]()
+                    {
+                        if (m_operation.try_complete() || expired())
+                        {
+                            m_handle.resume();
+                        }
+                        else
+                        {
+                            arm();
+                        }
+                    });
+            }
+
+            await_context<Exec> m_context;
+            Operation m_operation;
+            std::chrono::steady_clock::time_point m_deadline;
+            std::coroutine_handle<> m_handle;
+        };
+
+        /** @brief Non-blocking memory_pipe reception, accumulating until the requested size is reached. */
+        struct receive_operation
+        {
+            memory_pipe* pipe;
+            std::uint8_t* data;
+            std::size_t rcv_bytes;
+            std::size_t received = 0U;
+
+            bool try_complete()
+            {
+                received += pipe->receive(
+                    data + received, rcv_bytes - received, std::chrono::duration<std::uint64_t, std::milli>(0U));
+                return received >= rcv_bytes;
+            }
+
+            [[nodiscard]] std::size_t result() const
+            {
+                return received;
+            }
+        };
+
+        /** @brief Non-blocking consumption of a sync_object signal. */
+        struct signal_operation
+        {
+            sync_object* object;
+            bool signaled = false;
+
+            bool try_complete()
+            {
+                signaled = object->try_wait_for_signal();
+                return signaled;
+            }
+
+            [[nodiscard]] bool result() const
+            {
+                return signaled;
+            }
+        };
+
+        /** @brief data_task submission retried until accepted. */
+        template <typename DataTask, typename DataType>
+        struct submit_operation
+        {
+            DataTask* target;
+            DataType data;
+            bool queued = false;
+
+            bool try_complete()
+            {
+                queued = target->submit(data);
+                return queued;
+            }
+
+            [[nodiscard]] bool result() const
+            {
+                return queued;
+            }
+        };
+    }
+
+    /**
+     * @brief Awaitable resuming the coroutine on the executor once a delay has elapsed.
+     *
+     * @tparam Exec Executor type.
+     */
+    template <typename Exec>
+    class delay_awaitable
+    {
+    public:
+        delay_awaitable(
+            const await_context<Exec>& context, const std::chrono::duration<std::uint64_t, std::micro>& delay)
+            : m_context(context)
+            , m_delay(delay)
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return 0U == m_delay.count();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            detail::post_after(m_context, m_delay, [handle]() { handle.resume(); });
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        await_context<Exec> m_context;
+        std::chrono::duration<std::uint64_t, std::micro> m_delay;
+    };
+
+    /**
+     * @brief Suspends the coroutine for a delay, without blocking the executor thread.
+     *
+     * @param context The await context.
+     * @param delay The delay.
+     * @return The awaitable.
+     */
+    template <typename Exec>
+    [[nodiscard]] delay_awaitable<Exec> async_delay(
+        const await_context<Exec>& context, const std::chrono::duration<std::uint64_t, std::micro>& delay)
+    {
+        return delay_awaitable<Exec>(context, delay);
+    }
+
+    /**
+     * @brief Receives bytes from a memory_pipe, suspending while the pipe is empty.
+     *
+     * @param context The await context.
+     * @param pipe The memory pipe.
+     * @param data Destination buffer of at least rcv_bytes bytes.
+     * @param rcv_bytes Number of bytes to receive.
+     * @param timeout How long to wait for all the bytes.
+     * @return An awaitable yielding the number of bytes received (less than rcv_bytes on timeout).
+     */
+    template <typename Exec>
+    [[nodiscard]] auto async_receive(const await_context<Exec>& context, memory_pipe& pipe, std::uint8_t* data,
+        std::size_t rcv_bytes, const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+    {
+        return detail::polling_awaitable<Exec, detail::receive_operation>(
+            context, detail::receive_operation { &pipe, data, rcv_bytes }, timeout);
+    }
+
+    /**
+     * @brief Waits for a sync_object signal, suspending while it is not set, and consumes it.
+     *
+     * @param context The await context.
+     * @param object The synchronization object.
+     * @param timeout How long to wait for the signal.
+     * @return An awaitable yielding true if the signal was consumed, false on timeout.
+     */
+    template <typename Exec>
+    [[nodiscard]] auto async_wait_for_signal(const await_context<Exec>& context, sync_object& object,
+        const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+    {
+        return detail::polling_awaitable<Exec, detail::signal_operation>(
+            context, detail::signal_operation { &object }, timeout);
+    }
+
+    /**
+     * @brief Submits data to a data_task, suspending while its queue rejects it.
+     *
+     * Use it with the drop_newest or fail overflow policies: each rejected attempt is counted by the task
+     * overflow_stats(), and the block policy would block the executor thread.
+     *
+     * @param context The await context.
+     * @param target The data task.
+     * @param data The data to submit.
+     * @param timeout How long to retry.
+     * @return An awaitable yielding true once the data is queued, false on timeout.
+     */
+    template <typename Exec, typename DataTask, typename DataType>
+    [[nodiscard]] auto async_submit(const await_context<Exec>& context, DataTask& target, const DataType& data,
+        const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+    {
+        return detail::polling_awaitable<Exec, detail::submit_operation<DataTask, DataType>>(
+            context, detail::submit_operation<DataTask, DataType> { &target, data }, timeout);
+    }
+}
+
+#endif // __cpp_impl_coroutine
+
+#endif //  TASK_HPP_
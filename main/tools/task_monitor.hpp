@@ -0,0 +1,403 @@
+/**
+ * @file task_monitor.hpp
+ * @brief Periodic snapshots of the CPU load, stack high-water mark and queue depth of watched tasks.
+ *
+ * task_monitor samples the tasks it watches on demand, typically from a low priority periodic_task: the CPU time
+ * each task used since the previous sample (FreeRTOS run-time stats, the thread CPU clock on Linux), the
+ * minimum free stack ever seen (FreeRTOS only) and the depth of the queue of data_task and worker_task
+ * instances. The snapshots give the data needed to trim stack sizes and to move hot tasks to another core.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TASK_MONITOR_HPP_)
+#define TASK_MONITOR_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+#elif defined(__linux__)
+#include <pthread.h>
+#include <time.h>
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Measurements of one watched task.
+     */
+    struct task_monitor_sample
+    {
+        std::string task_name;                          ///< Name of the task.
+        int cpu_affinity = base_task::run_on_all_cores; ///< Configured CPU affinity.
+        int priority = base_task::default_priority;     ///< Configured priority.
+        std::size_t stack_size = 0U;                    ///< Configured stack size, in task_stack_word units.
+
+        /**
+         * @brief CPU time used since the task is watched, empty once the OS no longer knows the task (a generic_task
+         * whose routine returned) or when the platform cannot measure it; in run-time stats clock units on FreeRTOS
+         * (microseconds with the default esp_timer clock of ESP-IDF).
+         */
+        std::optional<std::chrono::duration<std::uint64_t, std::micro>> cpu_time;
+
+        double cpu_share = 0.0; ///< Share of one core used since the previous sample (1.0 for a whole core).
+
+        /**
+         * @brief Minimum free stack since the task started, in task_stack_word units (bytes on ESP-IDF), FreeRTOS
+         * only.
+         */
+        std::optional<std::size_t> stack_high_water;
+
+        std::optional<std::size_t> queue_depth; ///< Items waiting in the queue of the task, if it has a probe.
+    };
+
+    /**
+     * @brief Measurements of all the watched tasks, in watch() order.
+     */
+    struct task_monitor_snapshot
+    {
+        std::chrono::duration<std::uint64_t, std::micro> interval = {}; ///< Time elapsed since the previous sample.
+        std::vector<task_monitor_sample> tasks;                         ///< One entry per watched task.
+
+        /**
+         * @brief Finds the sample of a task.
+         *
+         * @param task_name The name of the task.
+         * @return The first sample with that name, nullptr if none.
+         */
+        [[nodiscard]] const task_monitor_sample* find(const std::string& task_name) const
+        {
+            const auto found = std::find_if(tasks.cbegin(), tasks.cend(),
+                [&task_name](const task_monitor_sample& sample) { return sample.task_name == task_name; });
+            return (tasks.cend() != found) ? &(*found) : nullptr;
+        }
+    };
+
+    /**
+     * @brief Samples the CPU load, stack high-water mark and queue depth of a set of tasks.
+     *
+     * Tasks are watched by reference and must be unwatched before they are destroyed. On FreeRTOS the load and
+     * stack figures need configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS
+     * (CONFIG_FREERTOS_USE_TRACE_FACILITY and CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS on ESP-IDF); without them,
+     * or on desktop platforms other than Linux, only the configuration and the queue depths are reported.
+     * All the member functions may be called from any task.
+     */
+    class task_monitor : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Callable returning the depth of the queue of a task.
+         */
+        using queue_depth_probe = std::function<std::size_t()>;
+
+        task_monitor()
+            : m_last_sample_us(now_us())
+        {
+        }
+
+        ~task_monitor() = default;
+
+        /**
+         * @brief Starts watching a task, or replaces the probe of a task already watched.
+         *
+         * @param task The task, to be unwatched before it is destroyed.
+         * @param probe Optional queue depth probe, called by sample().
+         */
+        void watch(base_task& task, queue_depth_probe probe = {})
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            auto found = find_entry(task);
+            if (m_entries.end() == found)
+            {
+                m_entries.push_back(watched_task { &task, {}, {}, 0U });
+                found = std::prev(m_entries.end());
+                refresh_system_state();
+                found->last = read_task(task);
+            }
+            found->probe = std::move(probe);
+        }
+
+        /**
+         * @brief Starts watching a task exposing queue_depth(), as data_task and worker_task do.
+         *
+         * @tparam Task The task type.
+         * @param task The task, to be unwatched before it is destroyed.
+         */
+        template <typename Task>
+        auto watch_queue(Task& task) -> decltype(static_cast<void>(task.queue_depth()))
+        {
+            watch(task, [&task]() { return task.queue_depth(); });
+        }
+
+        /**
+         * @brief Stops watching a task.
+         *
+         * @param task The task.
+         * @return true if the task was watched.
+         */
+        bool unwatch(const base_task& task)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            const auto found = find_entry(task);
+            if (m_entries.end() == found)
+            {
+                return false;
+            }
+            m_entries.erase(found);
+            return true;
+        }
+
+        /**
+         * @brief Retrieves the number of watched tasks.
+         *
+         * @return The watched task count.
+         */
+        [[nodiscard]] std::size_t watched_count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_entries.size();
+        }
+
+        /**
+         * @brief Measures all the watched tasks and keeps the result as the last snapshot.
+         *
+         * @return The snapshot, the CPU shares covering the time since the previous sample (or since watch()).
+         */
+        task_monitor_snapshot sample()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            const std::uint64_t sample_us = now_us();
+            refresh_system_state();
+
+            task_monitor_snapshot snapshot;
+            snapshot.interval = std::chrono::duration<std::uint64_t, std::micro>(sample_us - m_last_sample_us);
+            snapshot.tasks.reserve(m_entries.size());
+
+            for (auto& entry : m_entries)
+            {
+                task_monitor_sample result;
+                result.task_name = entry.task->task_name();
+                result.cpu_affinity = entry.task->cpu_affinity();
+                result.priority = entry.task->priority();
+                result.stack_size = entry.task->stack_size();
+
+                const task_reading current = read_task(*entry.task);
+                if (current.valid)
+                {
+                    const run_time_counter cpu_delta = entry.last.valid ? (current.cpu - entry.last.cpu) : 0U;
+                    const run_time_counter reference_delta = current.reference - entry.last.reference;
+                    entry.cpu_total += cpu_delta;
+                    result.cpu_time = std::chrono::duration<std::uint64_t, std::micro>(entry.cpu_total);
+                    result.cpu_share
+                        = (0U != reference_delta) ? (static_cast<double>(cpu_delta) / reference_delta) : 0.0;
+                }
+                if (current.has_stack_high_water)
+                {
+                    result.stack_high_water = current.stack_high_water;
+                }
+                if (entry.probe)
+                {
+                    result.queue_depth = entry.probe();
+                }
+
+                entry.last = current;
+                snapshot.tasks.push_back(std::move(result));
+            }
+
+            m_last_sample_us = sample_us;
+            m_last_snapshot = snapshot;
+            return snapshot;
+        }
+
+        /**
+         * @brief Retrieves the snapshot taken by the last sample().
+         *
+         * @return The last snapshot, empty before the first sample().
+         */
+        [[nodiscard]] task_monitor_snapshot last_snapshot() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_last_snapshot;
+        }
+
+    private:
+#if defined(FREERTOS_PLATFORM) && (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+        using run_time_counter = decltype(TaskStatus_t::ulRunTimeCounter); // deltas wrap with the counter
+#else
+        using run_time_counter = std::uint64_t;
+#endif
+
+        /**
+         * @brief CPU counter of one task, and the reference clock its share is computed against.
+         */
+        struct task_reading
+        {
+            bool valid = false;
+            run_time_counter cpu = 0U;
+            run_time_counter reference = 0U;
+            bool has_stack_high_water = false;
+            std::size_t stack_high_water = 0U;
+        };
+
+        struct watched_task
+        {
+            base_task* task;
+            queue_depth_probe probe;
+            task_reading last;
+            std::uint64_t cpu_total;
+        };
+
+        std::vector<watched_task>::iterator find_entry(const base_task& task)
+        {
+            return std::find_if(m_entries.begin(), m_entries.end(),
+                [&task](const watched_task& entry) { return &task == entry.task; });
+        }
+
+        static std::uint64_t now_us()
+        {
+#if defined(FREERTOS_PLATFORM)
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#else
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#endif
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+#endif
+        }
+
+#if defined(FREERTOS_PLATFORM) && (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+        /**
+         * @brief Captures the state of all the tasks; a deleted task simply no longer appears in it.
+         */
+        void refresh_system_state()
+        {
+            constexpr UBaseType_t spare_entries = 4U;
+            m_system_state.resize(static_cast<std::size_t>(uxTaskGetNumberOfTasks() + spare_entries));
+            m_system_state.resize(static_cast<std::size_t>(uxTaskGetSystemState(
+                m_system_state.data(), static_cast<UBaseType_t>(m_system_state.size()), &m_total_run_time)));
+        }
+
+        /**
+         * @brief Finds a task in the last captured system state.
+         *
+         * @param task The task.
+         * @return Its reading, invalid if the task is not in the system state.
+         */
+        task_reading read_task(base_task& task)
+        {
+            task_reading reading;
+            const TaskHandle_t handle = *static_cast<TaskHandle_t*>(task.native_handle());
+            for (const auto& status : m_system_state)
+            {
+                if ((nullptr != handle) && (handle == status.xHandle))
+                {
+                    reading.valid = true;
+                    reading.cpu = status.ulRunTimeCounter;
+                    reading.reference = m_total_run_time;
+                    reading.has_stack_high_water = true;
+                    reading.stack_high_water = static_cast<std::size_t>(status.usStackHighWaterMark);
+                    break;
+                }
+            }
+            return reading;
+        }
+
+        std::vector<TaskStatus_t> m_system_state;
+        run_time_counter m_total_run_time = 0U;
+#else
+        void refresh_system_state()
+        {
+        }
+
+        /**
+         * @brief Reads the CPU clock of the thread of a task.
+         *
+         * @param task The task.
+         * @return Its reading, invalid once the thread has returned or without a thread CPU clock.
+         */
+        static task_reading read_task(base_task& task)
+        {
+            task_reading reading;
+#if defined(__linux__) && !defined(FREERTOS_PLATFORM)
+            // a thread that returned but is not joined yet reports ESRCH
+            const auto thread = reinterpret_cast<pthread_t>(task.native_handle()); // NOLINT native handle unwrapping
+            clockid_t clock_id = {};
+            timespec cpu_time = {};
+            if ((0 == pthread_getcpuclockid(thread, &clock_id)) && (0 == clock_gettime(clock_id, &cpu_time)))
+            {
+                constexpr std::uint64_t us_per_s = 1000000U;
+                constexpr std::uint64_t ns_per_us = 1000U;
+                reading.valid = true;
+                reading.cpu = (static_cast<std::uint64_t>(cpu_time.tv_sec) * us_per_s)
+                    + (static_cast<std::uint64_t>(cpu_time.tv_nsec) / ns_per_us);
+                reading.reference = now_us();
+            }
+#else
+            static_cast<void>(task);
+#endif
+            return reading;
+        }
+#endif
+
+        mutable tools::critical_section m_mutex;
+        std::vector<watched_task> m_entries;
+        std::uint64_t m_last_sample_us;
+        task_monitor_snapshot m_last_snapshot;
+    };
+}
+
+#endif //  TASK_MONITOR_HPP_
@@ -0,0 +1,343 @@
+/**
+ * @file task_runner_pool.hpp
+ * @brief A pool of parked task runners, launching short-lived routines without creating a task.
+ *
+ * This file contains the definition of the task_runner_pool class template. Each runner is a generic_task created
+ * once with its own stack size, cpu affinity and priority, then parked on an event. launch() hands a routine to an
+ * idle runner matching the requested stack size and core, so that short jobs such as OTA chunk verification no
+ * longer pay for a task creation and a stack allocation each time.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TASK_RUNNER_POOL_HPP_)
+#define TASK_RUNNER_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tools/base_task.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Stack size, cpu affinity and priority of one runner of a task_runner_pool.
+     */
+    struct task_runner_params
+    {
+        std::size_t stack_size = 0U;                    ///< Stack size of the runner, as given to generic_task.
+        int cpu_affinity = base_task::run_on_all_cores; ///< CPU affinity of the runner.
+        int priority = base_task::default_priority;     ///< Priority of the runner.
+    };
+
+    /**
+     * @brief A pool of parked generic_task runners, each running one launched routine at a time.
+     *
+     * The runners are created by the constructor and live as long as the pool. launch() claims an idle runner
+     * and wakes it up with the routine; the runner parks again once the routine returns. Nothing is queued: when
+     * no suitable runner is idle, launch() fails and the caller decides whether to retry, wait_idle() or run the
+     * job elsewhere.
+     *
+     * @tparam Context The type of the context object given to the routines.
+     */
+    template <typename Context>
+    class task_runner_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        task_runner_pool() = delete;
+
+        /**
+         * @brief Type alias for a launched routine, the same signature as a generic_task routine.
+         *
+         * This callback function takes a shared pointer to a Context object and the name of the runner
+         * running it as parameters.
+         */
+        using call_back = std::function<void(const std::shared_ptr<Context>& context, const std::string& task_name)>;
+
+        /**
+         * @brief Constructs a task_runner_pool with one runner per entry of runner_params.
+         *
+         * @param task_name The name prefix of the runners, suffixed with "_<index>".
+         * @param runner_params The stack size, cpu affinity and priority of each runner.
+         */
+        task_runner_pool(const std::string& task_name, const std::vector<task_runner_params>& runner_params)
+            : m_params(runner_params)
+        {
+            m_runners.reserve(m_params.size());
+            for (std::size_t i = 0U; i < m_params.size(); ++i)
+            {
+                m_runners.emplace_back(std::make_unique<runner_slot>());
+            }
+
+            m_tasks.reserve(m_params.size());
+            for (std::size_t i = 0U; i < m_params.size(); ++i)
+            {
+                m_tasks.emplace_back(std::make_unique<tools::generic_task<Context>>(
+                    [this, i](const std::shared_ptr<Context>&, const std::string& name) { run_loop(i, name); },
+                    std::shared_ptr<Context>(), task_name + "_" + std::to_string(i), m_params[i].stack_size,
+                    m_params[i].cpu_affinity, m_params[i].priority));
+            }
+        }
+
+        /**
+         * @brief Constructs a task_runner_pool of nb_runners identical runners.
+         *
+         * @param task_name The name prefix of the runners, suffixed with "_<index>".
+         * @param nb_runners The number of runners.
+         * @param params The stack size, cpu affinity and priority of every runner.
+         */
+        task_runner_pool(const std::string& task_name, std::size_t nb_runners, const task_runner_params& params)
+            : task_runner_pool(task_name, std::vector<task_runner_params>(nb_runners, params))
+        {
+        }
+
+        /**
+         * @brief Destructor for the task_runner_pool class.
+         *
+         * Waits for the routines in progress to return, then stops the runners.
+         */
+        ~task_runner_pool()
+        {
+            m_stop_pool.store(true);
+
+            for (auto& runner : m_runners)
+            {
+                runner->m_work_sync.signal();
+            }
+
+            // generic_task destructors wait for the runners to complete
+            m_tasks.clear();
+        }
+
+        /**
+         * @brief Hands a routine to an idle runner.
+         *
+         * Among the idle runners with at least min_stack_size of stack, and pinned to cpu_affinity unless it is
+         * base_task::run_on_all_cores, the one with the smallest stack is chosen so that large runners stay
+         * available for the jobs needing them.
+         *
+         * @param routine The routine to run.
+         * @param context A shared pointer to the context given to the routine, released once it returns.
+         * @param min_stack_size The stack size the routine needs.
+         * @param cpu_affinity The core to run on, or base_task::run_on_all_cores for any runner.
+         * @return true if a runner took the routine, false if no suitable runner is idle.
+         */
+        bool launch(call_back&& routine, const std::shared_ptr<Context>& context, std::size_t min_stack_size = 0U,
+            int cpu_affinity = base_task::run_on_all_cores)
+        {
+            if (m_stop_pool.load())
+            {
+                return false;
+            }
+
+            const std::size_t index = claim_runner(min_stack_size, cpu_affinity);
+            if (m_runners.size() == index)
+            {
+                return false;
+            }
+
+            auto& runner = *m_runners[index];
+            {
+                std::scoped_lock<tools::critical_section> guard(runner.m_mutex);
+                runner.m_routine = std::move(routine);
+                runner.m_context = context;
+            }
+            runner.m_work_sync.signal();
+
+            return true;
+        }
+
+        /**
+         * @brief Waits until every runner is idle; a single task may wait at a time.
+         */
+        void wait_idle()
+        {
+            while (idle_count() != m_runners.size())
+            {
+                m_idle_sync.wait_for_signal();
+            }
+        }
+
+        /**
+         * @brief Retrieves the number of runners.
+         *
+         * @return The runner count.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_runners.size();
+        }
+
+        /**
+         * @brief Retrieves the number of runners parked and ready for a launch.
+         *
+         * @return The idle runner count.
+         */
+        [[nodiscard]] std::size_t idle_count() const
+        {
+            std::size_t count = 0U;
+            for (const auto& runner : m_runners)
+            {
+                count += runner->m_busy.load() ? 0U : 1U;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Retrieves the number of routines the runners have run to completion.
+         *
+         * @return The completed launch count.
+         */
+        [[nodiscard]] std::size_t completed_count() const noexcept
+        {
+            return m_completed_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gives access to the task of a runner, for its name or its native handle.
+         *
+         * @param index The runner index.
+         * @return The runner task.
+         */
+        [[nodiscard]] const base_task& runner_task(std::size_t index) const
+        {
+            return *m_tasks.at(index);
+        }
+
+    private:
+        /**
+         * @brief Per-runner state: the routine handed over and the wake-up signal.
+         */
+        struct runner_slot : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+            tools::critical_section m_mutex;
+            call_back m_routine;
+            std::shared_ptr<Context> m_context;
+            tools::light_event m_work_sync;
+            std::atomic_bool m_busy = false;
+        };
+
+        /**
+         * @brief Marks the best matching idle runner busy.
+         *
+         * @return The runner index, m_runners.size() if none is idle.
+         */
+        std::size_t claim_runner(std::size_t min_stack_size, int cpu_affinity)
+        {
+            while (true)
+            {
+                std::size_t best = m_runners.size();
+                for (std::size_t i = 0U; i < m_runners.size(); ++i)
+                {
+                    const auto& params = m_params[i];
+                    const bool fits = (params.stack_size >= min_stack_size)
+                        && ((base_task::run_on_all_cores == cpu_affinity) || (params.cpu_affinity == cpu_affinity));
+
+                    if (fits && !m_runners[i]->m_busy.load()
+                        && ((m_runners.size() == best) || (params.stack_size < m_params[best].stack_size)))
+                    {
+                        best = i;
+                    }
+                }
+
+                if (m_runners.size() == best)
+                {
+                    return best;
+                }
+
+                // another launcher may have claimed it meanwhile, look again
+                bool expected = false;
+                if (m_runners[best]->m_busy.compare_exchange_strong(expected, true))
+                {
+                    return best;
+                }
+            }
+        }
+
+        /**
+         * @brief Main loop of a runner: parks until a routine is handed over, runs it and parks again.
+         */
+        void run_loop(std::size_t index, const std::string& task_name)
+        {
+            auto& runner = *m_runners[index];
+
+            while (true)
+            {
+                call_back routine;
+                std::shared_ptr<Context> context;
+                {
+                    std::scoped_lock<tools::critical_section> guard(runner.m_mutex);
+                    routine = std::move(runner.m_routine);
+                    context = std::move(runner.m_context);
+                    runner.m_routine = nullptr;
+                }
+
+                if (routine)
+                {
+                    routine(context, task_name);
+                    routine = nullptr;
+                    context.reset();
+                    m_completed_count.fetch_add(1U, std::memory_order_relaxed);
+                    runner.m_busy.store(false);
+                    m_idle_sync.signal();
+                    continue;
+                }
+
+                if (m_stop_pool.load())
+                {
+                    break;
+                }
+
+                // a signal sent before this wait is latched by the event
+                runner.m_work_sync.wait_for_signal();
+            } // run loop
+        }
+
+        std::vector<task_runner_params> m_params;
+        std::vector<std::unique_ptr<runner_slot>> m_runners;
+        std::vector<std::unique_ptr<tools::generic_task<Context>>> m_tasks;
+        tools::light_event m_idle_sync;
+        std::atomic<std::size_t> m_completed_count = 0U;
+        std::atomic_bool m_stop_pool = false;
+    };
+}
+
+#endif //  TASK_RUNNER_POOL_HPP_
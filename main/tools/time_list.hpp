@@ -45,6 +45,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <queue>
 #include <type_traits>
@@ -80,18 +81,20 @@ namespace tools
      * @brief Non-thread-safe chronological list based on std::priority_queue.
      *
      * Stores entries as <timestamp, value>. The earliest timestamp is always at
-     * the top of the queue.
+     * the top of the queue. See tools::sorted_time_list for in-order iteration and
+     * time window visits without copies.
      *
      * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
      * @tparam TValue Value type.
+     * @tparam Allocator Allocator of the entries, e.g. std::pmr::polymorphic_allocator<std::pair<TTimestamp, TValue>>.
      */
 #if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
-    template <typename TTimestamp, typename TValue>
+    template <typename TTimestamp, typename TValue, typename Allocator = std::allocator<std::pair<TTimestamp, TValue>>>
         requires detail::is_valid_timestamp<TTimestamp>::value
     class time_list
     {
 #else
-    template <typename TTimestamp, typename TValue>
+    template <typename TTimestamp, typename TValue, typename Allocator = std::allocator<std::pair<TTimestamp, TValue>>>
     class time_list
     {
         static_assert(detail::is_valid_timestamp<TTimestamp>::value,
@@ -120,7 +123,19 @@ namespace tools
             }
         };
 
-        using queue_type = std::priority_queue<entry_type, std::vector<entry_type>, entry_compare>;
+        using queue_type = std::priority_queue<entry_type, std::vector<entry_type, Allocator>, entry_compare>;
+
+        time_list() = default;
+
+        /**
+         * @brief Constructs an empty list whose entries are allocated through the given allocator.
+         *
+         * @param alloc The allocator of the entries.
+         */
+        explicit time_list(const Allocator& alloc)
+            : m_queue(entry_compare {}, alloc)
+        {
+        }
 
         /**
          * @brief Push an entry by copy.
@@ -227,6 +242,39 @@ namespace tools
             return first_entry;
         }
 
+        /**
+         * @brief Remove every entry up to a timestamp, earliest first.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @param consumer Callable invoked with each removed entry, in chronological order.
+         * @return Number of removed entries.
+         */
+        template <typename TConsumer>
+        std::size_t pop_until(const timestamp_type& timestamp_value, TConsumer&& consumer)
+        {
+            std::size_t removed = 0U;
+
+            while (!m_queue.empty() && !(timestamp_value < m_queue.top().first))
+            {
+                consumer(m_queue.top());
+                m_queue.pop();
+                ++removed;
+            }
+
+            return removed;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @return Number of removed entries.
+         */
+        std::size_t pop_until(const timestamp_type& timestamp_value)
+        {
+            return pop_until(timestamp_value, [](const entry_type&) {});
+        }
+
         /**
          * @brief Check whether the list is empty.
          * @return True when empty.
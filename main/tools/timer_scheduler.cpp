@@ -23,6 +23,14 @@
 // 3. This notice may not be removed or altered from any source distribution.  //
 //-----------------------------------------------------------------------------//
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "tools/platform_detection.hpp"
 
 #if defined(FREERTOS_PLATFORM)
@@ -30,3 +38,35 @@
 #else
 #include "tools/standard/timer_scheduler_impl_std.inl"
 #endif
+
+namespace tools
+{
+    namespace
+    {
+        /**
+         * @brief Handler of a dispatched timer, shared with the expirations posted but not yet run.
+         */
+        struct dispatched_timer
+        {
+            std::function<void(timer_handle)> m_handler;
+            std::atomic<timer_handle> m_handle = 0U; ///< Known once the timer fired, before any post.
+        };
+    }
+
+    timer_handle timer_scheduler::add(const std::string& timer_name,
+        const std::chrono::duration<std::uint64_t, std::micro>& period, std::function<void(timer_handle)>&& handler,
+        timer_type type, timer_resolution_policy policy, timer_dispatcher&& dispatcher)
+    {
+        auto timer = std::make_shared<dispatched_timer>();
+        timer->m_handler = std::move(handler);
+
+        // the posted task only holds the shared pointer, small enough for the std::function inline buffer
+        auto post_expiration = [timer, dispatcher = std::move(dispatcher)](timer_handle hnd)
+        {
+            timer->m_handle.store(hnd, std::memory_order_relaxed);
+            dispatcher([timer]() { timer->m_handler(timer->m_handle.load(std::memory_order_relaxed)); });
+        };
+
+        return add(timer_name, period, std::move(post_expiration), type, policy);
+    }
+}
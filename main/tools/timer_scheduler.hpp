@@ -28,6 +28,9 @@
 #if !defined(TIMER_SCHEDULER_HPP_)
 #define TIMER_SCHEDULER_HPP_
 
+#include <functional>
+#include <utility>
+
 #include "tools/platform_detection.hpp"
 
 #if defined(FREERTOS_PLATFORM)
@@ -36,4 +39,23 @@
 #include "tools/standard/timer_scheduler_std.inl"
 #endif
 
+namespace tools
+{
+    /**
+     * @brief Builds a timer dispatcher posting the expirations to an executor.
+     *
+     * Works with any executor reachable by an unqualified post(exec, task): worker_task_executor,
+     * worker_pool_executor or a portable_concurrency executor.
+     *
+     * @tparam Executor The executor type, copied into the dispatcher.
+     * @param exec The executor running the timer handlers.
+     * @return The dispatcher to give to timer_scheduler::add().
+     */
+    template <typename Executor>
+    timer_dispatcher make_timer_dispatcher(Executor exec)
+    {
+        return [exec](std::function<void()>&& task) mutable { post(exec, std::move(task)); };
+    }
+}
+
 #endif //  TIMER_SCHEDULER_HPP_
@@ -0,0 +1,559 @@
+/**
+ * @file timer_wheel.hpp
+ * @brief Hierarchical timing wheel with O(1) insertion and cancellation.
+ *
+ * The wheel keeps its timers in a pooled node array linked into per-slot intrusive lists, so arming and
+ * cancelling a timer neither allocates nor searches. It is not thread-safe: the owner serializes the calls.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TIMER_WHEEL_HPP_)
+#define TIMER_WHEEL_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A timer expired by timer_wheel::advance(), to be invoked by the owner and given back to rearm().
+     *
+     * @tparam Handler The callable type stored for each timer.
+     */
+    template <typename Handler>
+    struct timer_wheel_expired
+    {
+        std::size_t id;       ///< Identifier returned by timer_wheel::insert().
+        std::uint64_t expiry; ///< Nominal expiry tick, before any coalescing slack.
+        Handler handler;      ///< The handler, moved out of the wheel while it runs.
+    };
+
+    /**
+     * @brief Hierarchical timing wheel of 4 levels of 64 slots, counted in abstract ticks.
+     *
+     * Level 0 holds the timers due within 64 ticks, one slot per tick; each upper level covers 64 times the span
+     * of the level below and is cascaded down as the lower level wraps around. Timers further than 64^4 ticks
+     * away park in the last level and are re-cascaded until they come in range. Nodes are recycled through a
+     * free list and identified by an index plus a generation count, so a stale identifier never cancels a
+     * recycled timer.
+     *
+     * @tparam Handler The callable type stored for each timer (moved, never copied).
+     */
+    template <typename Handler>
+    class timer_wheel : public non_copyable // NOLINT inherits from non copyable/non movable class
+    {
+    public:
+        using tick_type = std::uint64_t;
+        using expired_timer = timer_wheel_expired<Handler>;
+
+        static constexpr std::size_t slot_bits = 6U;
+        static constexpr std::size_t slots_per_level = std::size_t { 1U } << slot_bits;
+        static constexpr std::size_t levels = 4U;
+
+        /**
+         * @brief Constructs an empty wheel whose node pool is reserved for a number of timers.
+         *
+         * @param initial_capacity Number of timers that can be armed before the node pool has to grow.
+         */
+        explicit timer_wheel(std::size_t initial_capacity = 64U)
+        {
+            m_heads.fill(npos);
+            m_nodes.reserve(initial_capacity);
+        }
+
+        ~timer_wheel() = default;
+
+        /**
+         * @brief Arms a timer.
+         *
+         * With a slack, each expiry is deferred to the next multiple of the largest power of two not above the
+         * slack, so that timers with overlapping tolerance windows expire on the same tick.
+         *
+         * @param expiry Absolute tick at which the timer fires (clamped to the next tick if already past).
+         * @param period Reload period in ticks for a periodic timer, 0 for a one-shot timer.
+         * @param handler The handler to store.
+         * @param slack Number of ticks each expiry may be deferred by to be coalesced with other timers.
+         * @param interval Delay re-applied by restart(); 0 takes the period, or for a one-shot timer the distance
+         * from the current tick to the expiry.
+         * @return The timer identifier (its most significant bit is always clear), or none if the node pool
+         * reached the maximum index.
+         */
+        [[nodiscard]] std::optional<std::size_t> insert(
+            tick_type expiry, tick_type period, Handler&& handler, tick_type slack = 0U, tick_type interval = 0U)
+        {
+            std::optional<std::size_t> id;
+            index_type index = m_free;
+
+            if (npos != index)
+            {
+                m_free = m_nodes[index].next;
+            }
+            else if (m_nodes.size() < max_nodes)
+            {
+                index = static_cast<index_type>(m_nodes.size());
+                m_nodes.emplace_back();
+            }
+
+            if (npos != index)
+            {
+                auto& node = m_nodes[index];
+                node.handler = std::move(handler);
+                node.expiry = (expiry > m_now) ? expiry : (m_now + 1U);
+                node.period = period;
+                node.slack = slack;
+                node.interval = (0U != interval) ? interval : ((0U != period) ? period : (node.expiry - m_now));
+                node.state = node_state::armed;
+                link(index);
+                ++m_active;
+                id = make_id(index, node.generation);
+            }
+
+            return id;
+        }
+
+        /**
+         * @brief Cancels a timer in O(1).
+         *
+         * A periodic timer whose handler is currently running (between advance() and rearm()) is flagged so that
+         * rearm() releases it instead of re-arming it.
+         *
+         * @param id The timer identifier.
+         * @return True if the timer was armed or running and is now cancelled, false otherwise.
+         */
+        bool cancel(std::size_t id)
+        {
+            const auto index = find(id);
+            if (!index.has_value())
+            {
+                return false;
+            }
+
+            auto& node = m_nodes[*index];
+            if (node_state::cancelled == node.state)
+            {
+                return false;
+            }
+
+            if (node_state::firing == node.state)
+            {
+                node.state = node_state::cancelled;
+                return true;
+            }
+
+            unlink(*index);
+            release(*index);
+            return true;
+        }
+
+        /**
+         * @brief Re-arms a timer one interval after a tick in O(1), keeping its identifier and its handler.
+         *
+         * Meant for watchdog-style timeouts pushed back on every message: the node is moved to its new slot, no
+         * handler is reallocated. A periodic timer whose handler is currently running is re-armed by rearm().
+         *
+         * @param id The timer identifier.
+         * @param now The tick the interval counts from.
+         * @return The new expiry tick, or none if the timer is neither armed nor running.
+         */
+        std::optional<tick_type> restart(std::size_t id, tick_type now)
+        {
+            const auto index = find(id);
+            if (!index.has_value() || (node_state::cancelled == m_nodes[*index].state))
+            {
+                return std::nullopt;
+            }
+
+            return move_to(*index, now + m_nodes[*index].interval);
+        }
+
+        /**
+         * @brief Changes the interval of a timer and re-arms it one new interval after a tick, in O(1).
+         *
+         * The interval becomes the period of a periodic timer and the delay of a one-shot timer.
+         *
+         * @param id The timer identifier.
+         * @param now The tick the interval counts from.
+         * @param interval The new interval in ticks (at least 1).
+         * @return The new expiry tick, or none if the timer is neither armed nor running.
+         */
+        std::optional<tick_type> reschedule(std::size_t id, tick_type now, tick_type interval)
+        {
+            const auto index = find(id);
+            if (!index.has_value() || (node_state::cancelled == m_nodes[*index].state))
+            {
+                return std::nullopt;
+            }
+
+            auto& node = m_nodes[*index];
+            node.interval = (0U != interval) ? interval : 1U;
+            if (0U != node.period)
+            {
+                node.period = node.interval;
+            }
+
+            return move_to(*index, now + node.interval);
+        }
+
+        /**
+         * @brief Advances the wheel up to a tick, collecting the expired timers.
+         *
+         * One-shot timers are released as they expire; periodic timers stay reserved until rearm() is called.
+         *
+         * @param now The current absolute tick.
+         * @param expired Receives the expired timers, in expiry order (appended, the container is not cleared).
+         */
+        void advance(tick_type now, std::vector<expired_timer>& expired)
+        {
+            if (0U == m_active)
+            {
+                m_now = (now > m_now) ? now : m_now;
+                return;
+            }
+
+            while (m_now < now)
+            {
+                ++m_now;
+                cascade();
+                expire_slot(expired);
+            }
+        }
+
+        /**
+         * @brief Gives back a timer expired by advance() once its handler ran.
+         *
+         * A periodic timer is re-armed one period after its previous expiry, skipping the periods already past if
+         * the handler overran, unless it was cancelled meanwhile. One-shot timers are simply dropped.
+         *
+         * @param timer The expired timer.
+         */
+        void rearm(expired_timer&& timer)
+        {
+            const auto index = find(timer.id);
+            if (!index.has_value())
+            {
+                return;
+            }
+
+            auto& node = m_nodes[*index];
+            if (node_state::firing != node.state)
+            {
+                release(*index);
+                return;
+            }
+
+            node.handler = std::move(timer.handler);
+            node.expiry += node.period;
+            if (node.expiry <= m_now)
+            {
+                // skip the periods missed while the handler overran, keeping the original phase
+                node.expiry += (((m_now - node.expiry) / node.period) + 1U) * node.period;
+            }
+            node.state = node_state::armed;
+            link(*index);
+        }
+
+        /**
+         * @brief Number of ticks after the current one until advance() has work to do.
+         *
+         * The hint is either the next occupied level 0 slot or the next wrap-around of level 0 (where upper levels
+         * cascade), so it never exceeds 64 ticks.
+         *
+         * @return The number of ticks to wait, or none if no timer is armed.
+         */
+        [[nodiscard]] std::optional<tick_type> next_expiry_hint() const
+        {
+            std::optional<tick_type> hint;
+
+            if (0U != m_active)
+            {
+                const std::size_t current = static_cast<std::size_t>(m_now & slot_mask);
+                tick_type delta = 1U;
+                for (std::size_t slot = current + 1U; slot < slots_per_level; ++slot, ++delta)
+                {
+                    if (npos != m_heads[slot])
+                    {
+                        break;
+                    }
+                }
+                hint = delta;
+            }
+
+            return hint;
+        }
+
+        /**
+         * @brief Gets the last tick the wheel advanced to.
+         *
+         * @return The current absolute tick.
+         */
+        [[nodiscard]] tick_type now() const
+        {
+            return m_now;
+        }
+
+        /**
+         * @brief Gets the number of armed or running timers.
+         *
+         * @return The number of timers.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_active;
+        }
+
+        /**
+         * @brief Checks whether no timer is armed or running.
+         *
+         * @return True if the wheel is empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_active;
+        }
+
+    private:
+        using index_type = std::uint32_t;
+
+        enum class node_state : unsigned char
+        {
+            free,
+            armed,
+            firing,
+            cancelled
+        };
+
+        struct wheel_node
+        {
+            Handler handler {};
+            tick_type expiry = 0U;
+            tick_type period = 0U;
+            tick_type slack = 0U;
+            tick_type interval = 0U;
+            std::size_t generation = 0U;
+            index_type prev = npos;
+            index_type next = npos;
+            std::uint16_t slot = 0U;
+            node_state state = node_state::free;
+        };
+
+        static constexpr index_type npos = std::numeric_limits<index_type>::max();
+        static constexpr tick_type slot_mask = slots_per_level - 1U;
+        static constexpr std::size_t index_bits = std::numeric_limits<std::size_t>::digits / 2;
+        static constexpr std::size_t generation_bits = std::numeric_limits<std::size_t>::digits - 1U - index_bits;
+        static constexpr std::size_t index_mask = (std::size_t { 1U } << index_bits) - 1U;
+        static constexpr std::size_t generation_mask = (std::size_t { 1U } << generation_bits) - 1U;
+        static constexpr std::size_t max_nodes = (index_mask < npos) ? index_mask : (npos - 1U);
+        static constexpr tick_type max_delta = (tick_type { 1U } << (slot_bits * levels)) - 1U;
+
+        static std::size_t make_id(index_type index, std::size_t generation)
+        {
+            return ((generation & generation_mask) << index_bits) | static_cast<std::size_t>(index);
+        }
+
+        [[nodiscard]] std::optional<index_type> find(std::size_t id) const
+        {
+            std::optional<index_type> index;
+            const std::size_t candidate = id & index_mask;
+
+            if (candidate < m_nodes.size())
+            {
+                const auto& node = m_nodes[candidate];
+                if ((node_state::free != node.state)
+                    && (make_id(static_cast<index_type>(candidate), node.generation) == id))
+                {
+                    index = static_cast<index_type>(candidate);
+                }
+            }
+
+            return index;
+        }
+
+        static tick_type coalesce(tick_type expiry, tick_type slack)
+        {
+            if (slack < 2U)
+            {
+                return expiry;
+            }
+
+            tick_type quantum = 1U;
+            while ((quantum << 1U) <= slack)
+            {
+                quantum <<= 1U;
+            }
+
+            return ((expiry + quantum - 1U) / quantum) * quantum;
+        }
+
+        void link(index_type index)
+        {
+            auto& node = m_nodes[index];
+            const tick_type expiry = coalesce(node.expiry, node.slack);
+            const tick_type delta = (expiry > m_now) ? (expiry - m_now) : 0U;
+            const tick_type target = m_now + ((delta > max_delta) ? max_delta : delta);
+
+            std::size_t level = 0U;
+            while ((level + 1U < levels) && ((delta >> (slot_bits * (level + 1U))) != 0U))
+            {
+                ++level;
+            }
+
+            const std::size_t slot
+                = (level * slots_per_level) + static_cast<std::size_t>((target >> (slot_bits * level)) & slot_mask);
+
+            node.slot = static_cast<std::uint16_t>(slot);
+            node.prev = npos;
+            node.next = m_heads[slot];
+            if (npos != node.next)
+            {
+                m_nodes[node.next].prev = index;
+            }
+            m_heads[slot] = index;
+        }
+
+        void unlink(index_type index)
+        {
+            auto& node = m_nodes[index];
+
+            if (npos != node.prev)
+            {
+                m_nodes[node.prev].next = node.next;
+            }
+            else
+            {
+                m_heads[node.slot] = node.next;
+            }
+
+            if (npos != node.next)
+            {
+                m_nodes[node.next].prev = node.prev;
+            }
+
+            node.prev = npos;
+            node.next = npos;
+        }
+
+        tick_type move_to(index_type index, tick_type expiry)
+        {
+            auto& node = m_nodes[index];
+            const tick_type target = (expiry > m_now) ? expiry : (m_now + 1U);
+
+            if (node_state::firing == node.state)
+            {
+                // rearm() adds the period back once the handler returns
+                node.expiry = (target > node.period) ? (target - node.period) : 0U;
+                return target;
+            }
+
+            unlink(index);
+            node.expiry = target;
+            link(index);
+            return target;
+        }
+
+        void release(index_type index)
+        {
+            auto& node = m_nodes[index];
+            node.handler = Handler {};
+            node.state = node_state::free;
+            ++node.generation;
+            node.next = m_free;
+            m_free = index;
+            --m_active;
+        }
+
+        void cascade()
+        {
+            for (std::size_t level = 1U; level < levels; ++level)
+            {
+                if (0U != ((m_now >> (slot_bits * (level - 1U))) & slot_mask))
+                {
+                    break;
+                }
+
+                const std::size_t slot
+                    = (level * slots_per_level) + static_cast<std::size_t>((m_now >> (slot_bits * level)) & slot_mask);
+                index_type index = m_heads[slot];
+                m_heads[slot] = npos;
+
+                while (npos != index)
+                {
+                    const index_type next = m_nodes[index].next;
+                    link(index);
+                    index = next;
+                }
+            }
+        }
+
+        void expire_slot(std::vector<expired_timer>& expired)
+        {
+            const std::size_t slot = static_cast<std::size_t>(m_now & slot_mask);
+            index_type index = m_heads[slot];
+            m_heads[slot] = npos;
+
+            while (npos != index)
+            {
+                auto& node = m_nodes[index];
+                const index_type next = node.next;
+                node.prev = npos;
+                node.next = npos;
+
+                expired.push_back(
+                    expired_timer { make_id(index, node.generation), node.expiry, std::move(node.handler) });
+                if (0U != node.period)
+                {
+                    node.state = node_state::firing;
+                }
+                else
+                {
+                    release(index);
+                }
+
+                index = next;
+            }
+        }
+
+        std::vector<wheel_node> m_nodes;
+        std::array<index_type, levels * slots_per_level> m_heads {};
+        index_type m_free = npos;
+        std::size_t m_active = 0U;
+        tick_type m_now = 0U;
+    };
+}
+
+#endif //  TIMER_WHEEL_HPP_
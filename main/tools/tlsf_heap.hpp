@@ -0,0 +1,560 @@
+/**
+ * @file tlsf_heap.hpp
+ * @brief Two-level segregated fit (TLSF) heap over a caller-provided memory region.
+ *
+ * Allocation and release run in constant time whatever the heap state: free blocks are kept in segregated lists
+ * indexed by a first level (power of two) and a second level (linear subdivision), found with two bitmap scans,
+ * and neighbours are coalesced on release through boundary tags. The region can be any memory, e.g. PSRAM.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TLSF_HEAP_HPP_)
+#define TLSF_HEAP_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <bit>
+#endif
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Point-in-time counters of a TLSF heap.
+     *
+     * Byte counts include the block headers, so used_bytes + free_bytes is always managed_bytes.
+     */
+    struct tlsf_heap_stats
+    {
+        std::size_t managed_bytes = 0U;         ///< Bytes of the region handed to the blocks.
+        std::size_t used_bytes = 0U;            ///< Bytes of the allocated blocks.
+        std::size_t free_bytes = 0U;            ///< Bytes of the free blocks.
+        std::size_t largest_free_block = 0U;    ///< Size of the largest free block.
+        std::size_t used_blocks = 0U;           ///< Allocated blocks.
+        std::size_t free_blocks = 0U;           ///< Free blocks, one when the heap is not fragmented.
+        std::size_t high_water_mark = 0U;       ///< Highest used_bytes observed.
+        std::size_t allocations = 0U;           ///< Successful allocations.
+        std::size_t failed_allocations = 0U;    ///< Allocations no free block could satisfy.
+        std::size_t fragmentation_percent = 0U; ///< 100 * (1 - largest_free_block / free_bytes).
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Index of the most significant set bit.
+         *
+         * @param value Non-null value.
+         * @return floor(log2(value)).
+         */
+        constexpr unsigned int tlsf_fls(std::size_t value)
+        {
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            return static_cast<unsigned int>(std::bit_width(value)) - 1U;
+#elif defined(__GNUC__)
+            return static_cast<unsigned int>((sizeof(unsigned long long) * 8U) - 1U)
+                - static_cast<unsigned int>(__builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+            unsigned int index = 0U;
+            while ((value >>= 1U) != 0U)
+            {
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        /**
+         * @brief Rounds a value up to a power of two alignment.
+         *
+         * @param value Value to round.
+         * @param alignment Power of two.
+         * @return The smallest multiple of alignment not below value.
+         */
+        constexpr std::size_t tlsf_align_up(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1U) & ~(alignment - 1U);
+        }
+
+        /**
+         * @brief Index of the least significant set bit.
+         *
+         * @param value Non-null bitmap.
+         * @return Index of its lowest set bit.
+         */
+        constexpr unsigned int tlsf_ffs(std::uint32_t value)
+        {
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            return static_cast<unsigned int>(std::countr_zero(value));
+#elif defined(__GNUC__)
+            return static_cast<unsigned int>(__builtin_ctz(value));
+#else
+            unsigned int index = 0U;
+            while ((value & 1U) == 0U)
+            {
+                value >>= 1U;
+                ++index;
+            }
+            return index;
+#endif
+        }
+    }
+
+    /**
+     * @brief Constant time heap over a fixed memory region.
+     *
+     * Blocks carry a two-word header (size with the free flag, previous physical block); free blocks also store
+     * their free list links in the payload. Payloads are aligned on __STDCPP_DEFAULT_NEW_ALIGNMENT__. A request is
+     * served from the first non-empty list whose blocks are all large enough (good fit, no list walk), and the
+     * remainder of the block is split off when it can hold a block of its own.
+     *
+     * All operations take the lock, whose critical section is bounded by a few bitmap operations.
+     *
+     * @tparam Lock Lock type protecting the heap, critical_section by default.
+     */
+    template <typename Lock = critical_section>
+    class basic_tlsf_heap : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /** @brief Alignment of the returned blocks. */
+        static constexpr std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        /**
+         * @brief Builds a heap managing one free block spanning the region.
+         *
+         * The region is not owned and must outlive every block. Its unaligned edges are left unused, as is the
+         * part beyond the largest block size (1 GB).
+         *
+         * @param region Start of the memory region.
+         * @param size Size of the region in bytes.
+         */
+        basic_tlsf_heap(void* region, std::size_t size)
+        {
+            const auto first = detail::tlsf_align_up(reinterpret_cast<std::uintptr_t>(region), alignment);
+            const auto last = (reinterpret_cast<std::uintptr_t>(region) + size) & ~(alignment - 1U);
+
+            if ((region == nullptr) || (last <= first) || ((last - first) < (min_block_size + header_size)))
+            {
+                return;
+            }
+
+            std::size_t block_bytes = (last - first) - header_size; // room for the end sentinel
+            block_bytes = (block_bytes > max_block_size) ? max_block_size : block_bytes;
+
+            m_region_begin = first;
+            m_region_end = first + block_bytes + header_size;
+            m_managed_bytes = block_bytes;
+
+            auto* block = block_at(first);
+            block->m_size = block_bytes | free_flag;
+            block->m_prev_phys = nullptr;
+
+            // zero-sized used block closing the region, next_phys() of the last block never leaves the region
+            auto* sentinel = next_phys(block);
+            sentinel->m_size = 0U;
+            sentinel->m_prev_phys = block;
+
+            insert_free(block);
+        }
+
+        ~basic_tlsf_heap() = default;
+
+        /**
+         * @brief Allocates a block.
+         *
+         * @param size Requested payload size in bytes.
+         * @return The payload, or nullptr if no free block is large enough.
+         */
+        [[nodiscard]] void* allocate(std::size_t size)
+        {
+            std::lock_guard<Lock> guard(m_lock);
+
+            if (size > max_request_size)
+            {
+                ++m_failed_allocations;
+                return nullptr;
+            }
+
+            const std::size_t needed = block_size_for(size);
+            block_header* block = find_free(needed);
+
+            if (block == nullptr)
+            {
+                ++m_failed_allocations;
+                return nullptr;
+            }
+
+            remove_free(block);
+            split(block, needed);
+            block->m_size &= ~free_flag;
+
+            m_used_bytes += block->size();
+            m_high_water_mark = (m_used_bytes > m_high_water_mark) ? m_used_bytes : m_high_water_mark;
+            ++m_used_blocks;
+            ++m_allocations;
+
+            return payload_of(block);
+        }
+
+        /**
+         * @brief Releases a block, merging it with its free neighbours.
+         *
+         * @param ptr Payload returned by allocate() on this heap, or nullptr.
+         */
+        void deallocate(void* ptr)
+        {
+            if (ptr == nullptr)
+            {
+                return;
+            }
+
+            std::lock_guard<Lock> guard(m_lock);
+
+            block_header* block = header_of(ptr);
+            m_used_bytes -= block->size();
+            --m_used_blocks;
+            block->m_size |= free_flag;
+
+            block_header* prev = block->m_prev_phys;
+            if ((prev != nullptr) && prev->is_free())
+            {
+                remove_free(prev);
+                prev->m_size += block->size();
+                block = prev;
+                next_phys(block)->m_prev_phys = block;
+            }
+
+            block_header* next = next_phys(block);
+            if (next->is_free())
+            {
+                remove_free(next);
+                block->m_size += next->size();
+                next_phys(block)->m_prev_phys = block;
+            }
+
+            insert_free(block);
+        }
+
+        /**
+         * @brief Tells whether a pointer lies in the region managed by the heap.
+         *
+         * @param ptr Pointer to test.
+         * @return true if ptr may have been returned by allocate().
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+            return (address >= m_region_begin) && (address < m_region_end);
+        }
+
+        /**
+         * @brief Gets the usable size of an allocated block.
+         *
+         * @param ptr Payload returned by allocate() on this heap.
+         * @return The payload capacity in bytes, at least the requested size.
+         */
+        [[nodiscard]] std::size_t usable_size(const void* ptr) const noexcept
+        {
+            const auto* block = reinterpret_cast<const block_header*>( // NOLINT blocks are carved in the region
+                reinterpret_cast<std::uintptr_t>(ptr) - header_size);
+            return block->size() - header_size;
+        }
+
+        /**
+         * @brief Takes a snapshot of the counters.
+         *
+         * The largest free block is read from the highest non-empty list, which is walked: the cost grows with
+         * the number of free blocks of that list, so keep this off the real-time paths.
+         *
+         * @return The counters.
+         */
+        [[nodiscard]] tlsf_heap_stats stats()
+        {
+            std::lock_guard<Lock> guard(m_lock);
+
+            tlsf_heap_stats result;
+            result.managed_bytes = m_managed_bytes;
+            result.used_bytes = m_used_bytes;
+            result.free_bytes = m_managed_bytes - m_used_bytes;
+            result.used_blocks = m_used_blocks;
+            result.free_blocks = m_free_blocks;
+            result.high_water_mark = m_high_water_mark;
+            result.allocations = m_allocations;
+            result.failed_allocations = m_failed_allocations;
+
+            if (m_fl_bitmap != 0U)
+            {
+                const unsigned int fl = detail::tlsf_fls(m_fl_bitmap);
+                const unsigned int sl = detail::tlsf_fls(m_sl_bitmap[fl]); // NOLINT bounded by the bitmap
+                for (const block_header* block = m_free_lists[fl][sl]; block != nullptr; block = block->m_next_free)
+                {
+                    result.largest_free_block
+                        = (block->size() > result.largest_free_block) ? block->size() : result.largest_free_block;
+                }
+            }
+
+            if (result.free_bytes > 0U)
+            {
+                result.fragmentation_percent = 100U - ((result.largest_free_block * 100U) / result.free_bytes);
+            }
+
+            return result;
+        }
+
+    private:
+        struct block_header
+        {
+            std::size_t m_size;        // block size including the header, bit 0 set when free
+            block_header* m_prev_phys; // previous block in the region, nullptr for the first one
+            block_header* m_next_free; // free list links, only valid for free blocks (payload area)
+            block_header* m_prev_free;
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return m_size & ~free_flag;
+            }
+
+            [[nodiscard]] bool is_free() const noexcept
+            {
+                return (m_size & free_flag) != 0U;
+            }
+        };
+
+        static constexpr std::size_t free_flag = 1U;
+
+        static_assert((alignment & (alignment - 1U)) == 0U, "alignment must be a power of 2");
+        static_assert(alignment >= alignof(block_header), "alignment below the block header alignment");
+
+        // the payload starts right after the size and previous block words
+        static constexpr std::size_t header_size = detail::tlsf_align_up(2U * sizeof(void*), alignment);
+        // a free block must hold its list links
+        static constexpr std::size_t min_block_size
+            = (detail::tlsf_align_up(sizeof(block_header), alignment) > (header_size + alignment))
+            ? detail::tlsf_align_up(sizeof(block_header), alignment)
+            : (header_size + alignment);
+
+        // second level: 2^sl_log2 linear subdivisions of each power of two range
+        static constexpr unsigned int sl_log2 = 4U;
+        static constexpr unsigned int sl_count = 1U << sl_log2;
+        static constexpr unsigned int alignment_log2 = detail::tlsf_fls(alignment);
+        // sizes below 2^fl_shift all map to the first level, in alignment steps
+        static constexpr unsigned int fl_shift = sl_log2 + alignment_log2;
+        static constexpr unsigned int fl_max_log2 = 30U;
+        static constexpr unsigned int fl_count = fl_max_log2 - fl_shift + 2U;
+        static constexpr std::size_t small_block_size = static_cast<std::size_t>(1U) << fl_shift;
+
+        static constexpr std::size_t max_block_size
+            = ((static_cast<std::size_t>(1U) << fl_max_log2) - 1U) & ~(alignment - 1U);
+        static constexpr std::size_t max_request_size = max_block_size - header_size;
+
+        static_assert(fl_count <= 32U, "first level bitmap is 32 bits wide");
+        static_assert(sl_count <= 32U, "second level bitmaps are 32 bits wide");
+        static_assert(max_block_size <= (std::numeric_limits<std::size_t>::max() / 2U), "size_t too narrow");
+
+        static block_header* block_at(std::uintptr_t address) noexcept
+        {
+            return reinterpret_cast<block_header*>(address); // NOLINT blocks are carved in the region
+        }
+
+        static block_header* next_phys(block_header* block) noexcept
+        {
+            return block_at(reinterpret_cast<std::uintptr_t>(block) + block->size());
+        }
+
+        static void* payload_of(block_header* block) noexcept
+        {
+            return reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(block) + header_size); // NOLINT
+        }
+
+        static block_header* header_of(void* ptr) noexcept
+        {
+            return block_at(reinterpret_cast<std::uintptr_t>(ptr) - header_size);
+        }
+
+        static constexpr std::size_t block_size_for(std::size_t size)
+        {
+            const std::size_t needed = detail::tlsf_align_up(((size == 0U) ? 1U : size) + header_size, alignment);
+            return (needed < min_block_size) ? min_block_size : needed;
+        }
+
+        // list of a block size
+        static void mapping_insert(std::size_t size, unsigned int& fl, unsigned int& sl) noexcept
+        {
+            if (size < small_block_size)
+            {
+                fl = 0U;
+                sl = static_cast<unsigned int>(size >> alignment_log2);
+            }
+            else
+            {
+                const unsigned int log2 = detail::tlsf_fls(size);
+                sl = static_cast<unsigned int>(size >> (log2 - sl_log2)) ^ sl_count;
+                fl = log2 - fl_shift + 1U;
+            }
+        }
+
+        // first list whose blocks are all at least size bytes
+        static void mapping_search(std::size_t size, unsigned int& fl, unsigned int& sl) noexcept
+        {
+            if (size >= small_block_size)
+            {
+                size += (static_cast<std::size_t>(1U) << (detail::tlsf_fls(size) - sl_log2)) - 1U;
+            }
+            mapping_insert(size, fl, sl);
+        }
+
+        block_header* find_free(std::size_t size) noexcept
+        {
+            unsigned int fl = 0U;
+            unsigned int sl = 0U;
+            mapping_search(size, fl, sl);
+
+            if (fl >= fl_count)
+            {
+                return nullptr;
+            }
+
+            std::uint32_t sl_map = m_sl_bitmap[fl] & (~static_cast<std::uint32_t>(0U) << sl); // NOLINT bounded
+            if (sl_map == 0U)
+            {
+                // fl + 1 may be 32 for a full first level, where a 32 bit shift is undefined
+                const std::uint32_t fl_mask = ((fl + 1U) < 32U) ? (~static_cast<std::uint32_t>(0U) << (fl + 1U)) : 0U;
+                const std::uint32_t fl_map = m_fl_bitmap & fl_mask;
+                if (fl_map == 0U)
+                {
+                    return nullptr;
+                }
+
+                fl = detail::tlsf_ffs(fl_map);
+                sl_map = m_sl_bitmap[fl]; // NOLINT bounded by the bitmap
+            }
+
+            sl = detail::tlsf_ffs(sl_map);
+            return m_free_lists[fl][sl]; // NOLINT bounded by the bitmaps
+        }
+
+        void insert_free(block_header* block) noexcept
+        {
+            unsigned int fl = 0U;
+            unsigned int sl = 0U;
+            mapping_insert(block->size(), fl, sl);
+
+            block_header*& head = m_free_lists[fl][sl]; // NOLINT bounded by max_block_size
+            block->m_prev_free = nullptr;
+            block->m_next_free = head;
+            if (head != nullptr)
+            {
+                head->m_prev_free = block;
+            }
+            head = block;
+
+            m_fl_bitmap |= (static_cast<std::uint32_t>(1U) << fl);
+            m_sl_bitmap[fl] |= (static_cast<std::uint32_t>(1U) << sl); // NOLINT bounded by max_block_size
+            ++m_free_blocks;
+        }
+
+        void remove_free(block_header* block) noexcept
+        {
+            unsigned int fl = 0U;
+            unsigned int sl = 0U;
+            mapping_insert(block->size(), fl, sl);
+
+            if (block->m_next_free != nullptr)
+            {
+                block->m_next_free->m_prev_free = block->m_prev_free;
+            }
+
+            if (block->m_prev_free != nullptr)
+            {
+                block->m_prev_free->m_next_free = block->m_next_free;
+            }
+            else
+            {
+                m_free_lists[fl][sl] = block->m_next_free; // NOLINT bounded by max_block_size
+                if (block->m_next_free == nullptr)
+                {
+                    m_sl_bitmap[fl] &= ~(static_cast<std::uint32_t>(1U) << sl); // NOLINT bounded
+                    if (m_sl_bitmap[fl] == 0U) // NOLINT bounded
+                    {
+                        m_fl_bitmap &= ~(static_cast<std::uint32_t>(1U) << fl);
+                    }
+                }
+            }
+
+            --m_free_blocks;
+        }
+
+        // give the tail of a free block back to the lists when it can hold a block of its own
+        void split(block_header* block, std::size_t size) noexcept
+        {
+            const std::size_t remainder = block->size() - size;
+            if (remainder < min_block_size)
+            {
+                return;
+            }
+
+            block->m_size = size | free_flag;
+
+            auto* rest = next_phys(block);
+            rest->m_size = remainder | free_flag;
+            rest->m_prev_phys = block;
+            next_phys(rest)->m_prev_phys = rest;
+
+            insert_free(rest);
+        }
+
+        Lock m_lock;
+        std::uintptr_t m_region_begin = 0U;
+        std::uintptr_t m_region_end = 0U;
+        std::uint32_t m_fl_bitmap = 0U;
+        std::array<std::uint32_t, fl_count> m_sl_bitmap = {};
+        std::array<std::array<block_header*, sl_count>, fl_count> m_free_lists = {};
+        std::size_t m_managed_bytes = 0U;
+        std::size_t m_used_bytes = 0U;
+        std::size_t m_used_blocks = 0U;
+        std::size_t m_free_blocks = 0U;
+        std::size_t m_high_water_mark = 0U;
+        std::size_t m_allocations = 0U;
+        std::size_t m_failed_allocations = 0U;
+    };
+
+    /** @brief TLSF heap protected by a critical_section. */
+    using tlsf_heap = basic_tlsf_heap<>;
+}
+
+#endif //  TLSF_HEAP_HPP_
@@ -0,0 +1,370 @@
+/**
+ * @file token_bucket.hpp
+ * @brief Lock-free token bucket and the load shedding policy applied by sync_subject when it overflows.
+ *
+ * This file defines tools::token_bucket, a rate limiter refilled at a fixed rate up to a burst size whose whole
+ * state is one atomic 64-bit "theoretical arrival time" (the GCRA formulation of a token bucket), so that
+ * concurrent publishers and ISR-free fast paths admit or reject an event with a single compare-and-swap. It also
+ * defines tools::load_shedder, which pairs a bucket with a shed policy (drop, sample 1-in-N, conflate) and
+ * counters; sync_subject applies one per rate-limited topic and one for the whole subject.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TOKEN_BUCKET_HPP_)
+#define TOKEN_BUCKET_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "tools/fast_clock.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Rate limiter refilled at a fixed rate up to a burst size, lock-free.
+     *
+     * Instead of a token count and a refill time, the bucket keeps the time at which it would be full again if
+     * nothing else were taken (the theoretical arrival time): taking n tokens pushes it n emission intervals
+     * further, and is refused when that would land more than burst intervals after now. This is equivalent to a
+     * token bucket, needs no background refill, and is updated with one compare-and-swap.
+     */
+    class token_bucket : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using time_point = fast_clock::time_point;
+
+        token_bucket() = delete;
+
+        /**
+         * @brief Constructs a full bucket.
+         *
+         * @param rate_per_second The number of tokens refilled per second, at least 1.
+         * @param burst The capacity of the bucket, at least 1.
+         */
+        token_bucket(std::uint32_t rate_per_second, std::uint32_t burst)
+            : m_interval_ns(interval_of(rate_per_second))
+            , m_tolerance_ns(m_interval_ns * static_cast<std::int64_t>((0U == burst) ? 1U : burst))
+        {
+        }
+
+        ~token_bucket() = default;
+
+        /**
+         * @brief Takes tokens from the bucket if enough are available.
+         *
+         * @param count The number of tokens to take; a request larger than the burst is always refused.
+         * @param now The current time.
+         * @return true if the tokens were taken, false if the bucket was left untouched.
+         */
+        bool try_acquire(std::size_t count, time_point now)
+        {
+            const std::int64_t now_ns = now.time_since_epoch().count();
+            const std::int64_t cost = m_interval_ns * static_cast<std::int64_t>(count);
+            std::int64_t tat = m_tat_ns.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                const std::int64_t next = ((tat > now_ns) ? tat : now_ns) + cost;
+                if ((next - now_ns) > m_tolerance_ns)
+                {
+                    return false;
+                }
+
+                if (m_tat_ns.compare_exchange_weak(tat, next, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * @brief Takes one token from the bucket if available, at the current time.
+         *
+         * @return true if the token was taken.
+         */
+        bool try_acquire()
+        {
+            return try_acquire(1U, fast_clock::now());
+        }
+
+        /**
+         * @brief Puts back tokens taken by try_acquire but left unused.
+         *
+         * @param count The number of tokens to return; the bucket never holds more than its burst.
+         */
+        void give_back(std::size_t count)
+        {
+            const std::int64_t cost = m_interval_ns * static_cast<std::int64_t>(count);
+            m_tat_ns.fetch_sub(cost, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of tokens that could be taken.
+         *
+         * @param now The current time.
+         * @return The available tokens, between 0 and the burst.
+         */
+        [[nodiscard]] std::size_t available(time_point now) const
+        {
+            const std::int64_t now_ns = now.time_since_epoch().count();
+            const std::int64_t tat = m_tat_ns.load(std::memory_order_relaxed);
+            const std::int64_t used = (tat > now_ns) ? (tat - now_ns) : 0;
+            return static_cast<std::size_t>((m_tolerance_ns - used) / m_interval_ns);
+        }
+
+        /**
+         * @brief Returns the capacity of the bucket.
+         *
+         * @return The burst size.
+         */
+        [[nodiscard]] std::size_t burst() const
+        {
+            return static_cast<std::size_t>(m_tolerance_ns / m_interval_ns);
+        }
+
+    private:
+        static constexpr std::int64_t nanoseconds_per_second = 1000000000;
+
+        static std::int64_t interval_of(std::uint32_t rate_per_second)
+        {
+            const std::int64_t rate = (0U == rate_per_second) ? 1 : static_cast<std::int64_t>(rate_per_second);
+            const std::int64_t interval = nanoseconds_per_second / rate;
+            return (0 == interval) ? 1 : interval;
+        }
+
+        const std::int64_t m_interval_ns;
+        const std::int64_t m_tolerance_ns;
+        std::atomic<std::int64_t> m_tat_ns { 0 };
+    };
+
+    /**
+     * @brief What happens to the events exceeding a rate limit.
+     */
+    enum class shed_policy : std::uint8_t
+    {
+        drop,    ///< Discard them.
+        sample,  ///< Discard them, except one in every sample_every that is delivered anyway.
+        conflate ///< Keep the latest of them per topic, delivered once tokens are available again.
+    };
+
+    /**
+     * @brief Configuration of a rate limit.
+     */
+    struct rate_limit
+    {
+        std::uint32_t rate_per_second = 0U;      ///< Sustained event rate.
+        std::uint32_t burst = 1U;                ///< Events accepted back to back before the rate applies.
+        shed_policy policy = shed_policy::drop;  ///< Fate of the events exceeding the limit.
+        std::uint32_t sample_every = 1U;         ///< N of the sample policy: one exceeding event in N is delivered.
+    };
+
+    /**
+     * @brief Counters of a load_shedder, as returned by load_shedder::counters().
+     */
+    struct rate_limit_counters
+    {
+        std::size_t passed = 0U;    ///< Events admitted within the rate.
+        std::size_t sampled = 0U;   ///< Exceeding events delivered by the sample policy.
+        std::size_t dropped = 0U;   ///< Exceeding events discarded.
+        std::size_t conflated = 0U; ///< Exceeding events held by the conflate policy, each replacing the previous.
+        std::size_t flushed = 0U;   ///< Held events delivered later, once tokens were available again.
+    };
+
+    /**
+     * @brief Outcome of load_shedder::admit.
+     */
+    enum class shed_verdict : std::uint8_t
+    {
+        deliver,  ///< Within the rate, or sampled: deliver the events.
+        drop,     ///< Discard the events.
+        conflate  ///< Hold the latest event in place of any previously held one.
+    };
+
+    /**
+     * @brief A token bucket, the policy applied when it is empty, and the counters of both.
+     *
+     * The shedder only decides: holding conflated events is up to the caller, which knows their topic, and which
+     * delivers them later through try_release.
+     */
+    class load_shedder : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using time_point = fast_clock::time_point;
+
+        load_shedder() = delete;
+
+        /**
+         * @brief Constructs a shedder with a full bucket.
+         *
+         * @param limit The rate, burst and policy.
+         */
+        explicit load_shedder(const rate_limit& limit)
+            : m_limit(limit)
+            , m_bucket(limit.rate_per_second, limit.burst)
+        {
+        }
+
+        ~load_shedder() = default;
+
+        /**
+         * @brief Decides the fate of a batch of events.
+         *
+         * A batch is admitted as a whole (when count tokens are available) or shed as a whole, and is one
+         * event for the sample policy.
+         *
+         * @param count The number of events.
+         * @param now The current time.
+         * @return The verdict.
+         */
+        shed_verdict admit(std::size_t count, time_point now)
+        {
+            if (m_bucket.try_acquire(count, now))
+            {
+                m_passed.fetch_add(count, std::memory_order_relaxed);
+                return shed_verdict::deliver;
+            }
+
+            switch (m_limit.policy)
+            {
+                case shed_policy::sample:
+                    if (0U == (m_shed_sequence.fetch_add(1U, std::memory_order_relaxed) + 1U) % sample_period())
+                    {
+                        m_sampled.fetch_add(count, std::memory_order_relaxed);
+                        return shed_verdict::deliver;
+                    }
+                    break;
+
+                case shed_policy::conflate:
+                    m_conflated.fetch_add(count, std::memory_order_relaxed);
+                    return shed_verdict::conflate;
+
+                default:
+                    break;
+            }
+
+            m_dropped.fetch_add(count, std::memory_order_relaxed);
+            return shed_verdict::drop;
+        }
+
+        /**
+         * @brief Takes the token needed to deliver a held event.
+         *
+         * @param now The current time.
+         * @return true if the held event can be delivered now.
+         */
+        bool try_release(time_point now)
+        {
+            if (m_bucket.try_acquire(1U, now))
+            {
+                m_flushed.fetch_add(1U, std::memory_order_relaxed);
+                return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Tells whether try_release would currently succeed, without taking the token.
+         *
+         * @param now The current time.
+         * @return true if a token is available.
+         */
+        [[nodiscard]] bool can_release(time_point now) const
+        {
+            return m_bucket.available(now) > 0U;
+        }
+
+        /**
+         * @brief Returns the token of a successful try_release whose event was not delivered after all.
+         */
+        void cancel_release()
+        {
+            m_bucket.give_back(1U);
+            m_flushed.fetch_sub(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the configuration of the shedder.
+         *
+         * @return The rate limit.
+         */
+        [[nodiscard]] const rate_limit& limit() const
+        {
+            return m_limit;
+        }
+
+        /**
+         * @brief Returns the token bucket of the shedder.
+         *
+         * @return The bucket.
+         */
+        [[nodiscard]] const token_bucket& bucket() const
+        {
+            return m_bucket;
+        }
+
+        /**
+         * @brief Returns the counters since construction.
+         *
+         * @return The counters, each read independently.
+         */
+        [[nodiscard]] rate_limit_counters counters() const
+        {
+            rate_limit_counters result;
+            result.passed = m_passed.load(std::memory_order_relaxed);
+            result.sampled = m_sampled.load(std::memory_order_relaxed);
+            result.dropped = m_dropped.load(std::memory_order_relaxed);
+            result.conflated = m_conflated.load(std::memory_order_relaxed);
+            result.flushed = m_flushed.load(std::memory_order_relaxed);
+            return result;
+        }
+
+    private:
+        [[nodiscard]] std::size_t sample_period() const
+        {
+            return (0U == m_limit.sample_every) ? 1U : m_limit.sample_every;
+        }
+
+        const rate_limit m_limit;
+        token_bucket m_bucket;
+        std::atomic<std::size_t> m_shed_sequence { 0U };
+        std::atomic<std::size_t> m_passed { 0U };
+        std::atomic<std::size_t> m_sampled { 0U };
+        std::atomic<std::size_t> m_dropped { 0U };
+        std::atomic<std::size_t> m_conflated { 0U };
+        std::atomic<std::size_t> m_flushed { 0U };
+    };
+}
+
+#endif //  TOKEN_BUCKET_HPP_
@@ -0,0 +1,459 @@
+/**
+ * @file topic_bridge.hpp
+ * @brief Bridge republishing local topics on a remote node from MTU-sized batches of serialized events.
+ *
+ * topic_bridge_sender is an observer: subscribed to the local topics to export, it serializes each event with
+ * bytepack straight into the datagram being filled, and hands the datagram to a transport sink (UDP socket,
+ * ESP-NOW peer) when the next event would not fit, when the first queued event is older than the linger, or on
+ * flush(). Batches are optionally gzip compressed, and sent compressed only when that makes them smaller.
+ * topic_bridge_receiver decodes the datagrams and republishes their events into a local sync_subject.
+ *
+ * Datagram layout: a magic byte, a flags byte (bit 0: gzip), then the body, gzip compressed or not: a 16-bit
+ * event count followed by the events, each serialized by the codec as its topic and its event.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TOPIC_BRIDGE_HPP_)
+#define TOPIC_BRIDGE_HPP_
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bytepack/bytepack.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/gzip_wrapper.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/sync_observer.hpp"
+
+namespace tools
+{
+    /** @brief Largest ESP-NOW payload. */
+    inline constexpr std::size_t esp_now_mtu = 250U;
+
+    /** @brief Largest UDP payload of an unfragmented IPv4 datagram on Ethernet. */
+    inline constexpr std::size_t udp_ethernet_mtu = 1472U;
+
+    /** @brief First byte of every bridge datagram. */
+    inline constexpr std::uint8_t topic_bridge_magic = 0xB5U;
+
+    /** @brief Flags byte bit set when the body is gzip compressed. */
+    inline constexpr std::uint8_t topic_bridge_gzip_flag = 0x01U;
+
+    /** @brief Size of the magic and flags bytes opening every bridge datagram. */
+    inline constexpr std::size_t topic_bridge_header_size = 2U;
+
+    /**
+     * @brief Default topic/event codec: both written with bytepack::binary_stream::write and read back with read.
+     *
+     * Suits arithmetic types, strings and vectors of arithmetic types; structured events provide a codec with
+     * the same static encode()/decode() members.
+     */
+    struct bytepack_bridge_codec
+    {
+        template <typename Stream, typename Topic, typename Evt>
+        static bool encode(Stream& stream, const Topic& topic, const Evt& event)
+        {
+            return stream.write(topic, event);
+        }
+
+        template <typename Stream, typename Topic, typename Evt>
+        static bool decode(Stream& stream, Topic& topic, Evt& event)
+        {
+            return stream.read(topic, event);
+        }
+    };
+
+    /**
+     * @brief Batching parameters of a topic_bridge_sender.
+     */
+    struct topic_bridge_config
+    {
+        std::size_t mtu = udp_ethernet_mtu; ///< Largest datagram handed to the sink.
+        std::chrono::duration<std::uint64_t, std::micro> linger { 5000U }; ///< Maximal age of a queued event.
+        bool compress = false; ///< Gzip the batches that shrink when compressed.
+    };
+
+    /**
+     * @brief Counters of a topic_bridge_sender or a topic_bridge_receiver.
+     */
+    struct topic_bridge_stats
+    {
+        std::uint64_t events = 0U;             ///< Events sent, or received and republished.
+        std::uint64_t datagrams = 0U;          ///< Datagrams handed to the sink, or received.
+        std::uint64_t bytes = 0U;              ///< Datagram bytes handed to the sink, or received.
+        std::uint64_t compressed_datagrams = 0U; ///< Datagrams with a gzip compressed body.
+        std::uint64_t dropped_events = 0U;     ///< Events too large for a datagram, or in a datagram the sink refused.
+        std::uint64_t malformed_datagrams = 0U; ///< Received datagrams that could not be decoded (receiver only).
+    };
+
+    /**
+     * @brief Observer exporting the events of its subscribed topics in MTU-sized datagrams.
+     *
+     * Informs may come from several tasks; the sink runs under the bridge lock and must not inform the bridge.
+     * The linger is checked on each inform and by flush_expired(), to be called periodically (periodic_task,
+     * timer_scheduler) so that a quiet topic does not keep its last events queued. Call flush() before
+     * destroying the sender to send the last batch.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type of the origin, not transported.
+     * @tparam Codec The topic/event serializer, see bytepack_bridge_codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Codec = bytepack_bridge_codec,
+        std::endian BufferEndian = std::endian::big>
+    class topic_bridge_sender : public sync_observer<Topic, Evt, Origin>
+    {
+    public:
+        using datagram_sink = std::function<bool(const std::uint8_t* datagram, std::size_t size)>;
+        using clock = std::chrono::steady_clock;
+
+        topic_bridge_sender() = delete;
+
+        /**
+         * @brief Constructs a sender handing its datagrams to a transport sink.
+         *
+         * @param sink Sends one datagram, returns false when it could not be sent.
+         * @param config The MTU, linger and compression settings.
+         */
+        topic_bridge_sender(datagram_sink sink, const topic_bridge_config& config)
+            : m_sink(std::move(sink))
+            , m_config(config)
+            , m_batch(std::max(config.mtu, body_offset + 1U))
+        {
+            if (m_config.compress)
+            {
+                m_gzip = std::make_unique<gzip_wrapper>();
+            }
+        }
+
+        ~topic_bridge_sender() override = default;
+
+        /**
+         * @brief Serializes the event into the current batch, sending the batch first if the event does not fit.
+         *
+         * @param topic The topic of the event.
+         * @param event The event.
+         * @param origin The origin, not transported.
+         */
+        void inform(const Topic& topic, const Evt& event, const Origin& origin) override
+        {
+            (void)origin;
+            const auto now = clock::now();
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+            if (!append(topic, event))
+            {
+                send_batch();
+                if (!append(topic, event))
+                {
+                    ++m_stats.dropped_events;
+                    return;
+                }
+            }
+
+            if (1U == m_batch_events)
+            {
+                m_first_event = now;
+            }
+
+            if (((now - m_first_event) >= m_config.linger) || (max_batch_events == m_batch_events))
+            {
+                send_batch();
+            }
+        }
+
+        /**
+         * @brief Sends the current batch if its first event is older than the linger.
+         *
+         * @return True if a batch was sent.
+         */
+        bool flush_expired()
+        {
+            const auto now = clock::now();
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            if ((0U == m_batch_events) || ((now - m_first_event) < m_config.linger))
+            {
+                return false;
+            }
+            send_batch();
+            return true;
+        }
+
+        /**
+         * @brief Sends the current batch, if any.
+         *
+         * @return True if a batch was sent.
+         */
+        bool flush()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            if (0U == m_batch_events)
+            {
+                return false;
+            }
+            send_batch();
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of events queued in the current batch.
+         *
+         * @return The pending event count.
+         */
+        std::size_t pending_events()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_batch_events;
+        }
+
+        /**
+         * @brief Gets the counters of the sender.
+         *
+         * @return A copy of the counters.
+         */
+        topic_bridge_stats stats()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return m_stats;
+        }
+
+    private:
+        static constexpr std::size_t max_batch_events = 0xFFFFU;
+        static constexpr std::size_t body_offset = topic_bridge_header_size + sizeof(std::uint16_t);
+
+        /**
+         * @brief Serializes an event in place after the last one; bytes of a failed attempt are left unused.
+         */
+        bool append(const Topic& topic, const Evt& event)
+        {
+            bytepack::binary_stream<BufferEndian> stream(
+                bytepack::buffer_view(m_batch.data() + m_batch_size, m_batch.size() - m_batch_size)); // NOLINT
+            if (!Codec::encode(stream, topic, event))
+            {
+                return false;
+            }
+
+            m_batch_size += stream.data().size();
+            ++m_batch_events;
+            return true;
+        }
+
+        void send_batch()
+        {
+            if (0U == m_batch_events)
+            {
+                return;
+            }
+
+            m_batch[0] = topic_bridge_magic;
+            m_batch[1] = 0U;
+            m_batch[2] = static_cast<std::uint8_t>((m_batch_events >> 8U) & 0xFFU); // big endian event count
+            m_batch[3] = static_cast<std::uint8_t>(m_batch_events & 0xFFU);
+
+            bool sent = false;
+            bool compressed = false;
+            std::size_t size = m_batch_size;
+            if (m_gzip)
+            {
+                const auto body_begin = m_batch.begin() + static_cast<std::ptrdiff_t>(topic_bridge_header_size);
+                const auto body_end = m_batch.begin() + static_cast<std::ptrdiff_t>(m_batch_size);
+                std::vector<std::uint8_t> packed = m_gzip->pack(std::vector<std::uint8_t>(body_begin, body_end));
+                compressed = !packed.empty() && ((topic_bridge_header_size + packed.size()) < m_batch_size);
+                if (compressed)
+                {
+                    packed.insert(packed.begin(), { topic_bridge_magic, topic_bridge_gzip_flag });
+                    size = packed.size();
+                    sent = m_sink(packed.data(), size);
+                    ++m_stats.compressed_datagrams;
+                }
+            }
+
+            if (!compressed)
+            {
+                sent = m_sink(m_batch.data(), size);
+            }
+
+            if (sent)
+            {
+                m_stats.events += m_batch_events;
+                ++m_stats.datagrams;
+                m_stats.bytes += size;
+            }
+            else
+            {
+                m_stats.dropped_events += m_batch_events;
+            }
+
+            m_batch_size = body_offset;
+            m_batch_events = 0U;
+        }
+
+        tools::critical_section m_mutex;
+        datagram_sink m_sink;
+        topic_bridge_config m_config;
+        std::vector<std::uint8_t> m_batch;
+        std::size_t m_batch_size = body_offset;
+        std::size_t m_batch_events = 0U;
+        clock::time_point m_first_event {};
+        std::unique_ptr<gzip_wrapper> m_gzip;
+        topic_bridge_stats m_stats;
+    };
+
+    /**
+     * @brief Decodes bridge datagrams and republishes their events into a local subject.
+     *
+     * One task at a time feeds a receiver, typically the task reading the UDP socket or the ESP-NOW receive
+     * queue (not the ESP-NOW callback itself, which runs in the Wi-Fi task).
+     *
+     * @tparam Topic The type of the topic, default constructible.
+     * @tparam Evt The type of the event, default constructible.
+     * @tparam Origin The origin type of the local subject.
+     * @tparam Codec The topic/event deserializer, matching the sender codec.
+     * @tparam BufferEndian Endianness of the serialized values.
+     */
+    template <typename Topic, typename Evt, typename Origin = std::string, typename Codec = bytepack_bridge_codec,
+        std::endian BufferEndian = std::endian::big>
+    class topic_bridge_receiver : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        topic_bridge_receiver() = delete;
+
+        /**
+         * @brief Constructs a receiver republishing into a subject.
+         *
+         * @param subject The local subject, outliving the receiver.
+         */
+        explicit topic_bridge_receiver(sync_subject<Topic, Evt, Origin>& subject)
+            : m_subject(subject)
+        {
+        }
+
+        ~topic_bridge_receiver() = default;
+
+        /**
+         * @brief Decodes a datagram and publishes its events, in order.
+         *
+         * The events decoded before a malformed one are published.
+         *
+         * @param datagram The received bytes.
+         * @param size The datagram size.
+         * @return The number of events published, 0 for a datagram that is not a bridge batch.
+         */
+        std::size_t receive(const std::uint8_t* datagram, std::size_t size)
+        {
+            ++m_stats.datagrams;
+            m_stats.bytes += size;
+
+            if ((nullptr == datagram) || (size <= topic_bridge_header_size) || (topic_bridge_magic != datagram[0]))
+            {
+                ++m_stats.malformed_datagrams;
+                return 0U;
+            }
+
+            std::vector<std::uint8_t> unpacked;
+            const std::uint8_t* body = datagram + topic_bridge_header_size; // NOLINT pointer arithmetic
+            std::size_t body_size = size - topic_bridge_header_size;
+            if (0U != (datagram[1] & topic_bridge_gzip_flag))
+            {
+                if (!m_gzip)
+                {
+                    m_gzip = std::make_unique<gzip_wrapper>();
+                }
+                unpacked = m_gzip->unpack(std::vector<std::uint8_t>(body, body + body_size)); // NOLINT
+                body = unpacked.data();
+                body_size = unpacked.size();
+                ++m_stats.compressed_datagrams;
+            }
+
+            bytepack::binary_stream<std::endian::big> count_stream(
+                bytepack::buffer_view(const_cast<std::uint8_t*>(body), body_size)); // NOLINT read only
+            std::uint16_t count = 0U;
+            if (!count_stream.read(count))
+            {
+                ++m_stats.malformed_datagrams;
+                return 0U;
+            }
+
+            bytepack::binary_stream<BufferEndian> stream(bytepack::buffer_view(
+                const_cast<std::uint8_t*>(body) + sizeof(count), body_size - sizeof(count))); // NOLINT read only
+            std::size_t published = 0U;
+            for (std::size_t i = 0U; i < count; ++i)
+            {
+                Topic topic {};
+                Evt event {};
+                if (!Codec::decode(stream, topic, event))
+                {
+                    ++m_stats.malformed_datagrams;
+                    m_stats.dropped_events += count - i;
+                    break;
+                }
+                m_subject.publish(topic, event);
+                ++published;
+            }
+
+            m_stats.events += published;
+            return published;
+        }
+
+        /**
+         * @brief Gets the counters of the receiver.
+         *
+         * @return A copy of the counters.
+         */
+        [[nodiscard]] topic_bridge_stats stats() const
+        {
+            return m_stats;
+        }
+
+    private:
+        sync_subject<Topic, Evt, Origin>& m_subject;
+        std::unique_ptr<gzip_wrapper> m_gzip;
+        topic_bridge_stats m_stats;
+    };
+
+} // namespace tools
+
+#endif // C++20
+
+#endif //  TOPIC_BRIDGE_HPP_
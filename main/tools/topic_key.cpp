@@ -0,0 +1,85 @@
+/**
+ * @file topic_key.cpp
+ * @brief Implementation - Registry of the topic names behind topic_key digests.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "tools/critical_section.hpp"
+#include "tools/expected.hpp"
+#include "tools/topic_key.hpp"
+
+namespace tools
+{
+    expected<topic_key, topic_registry_error> topic_registry::intern(std::string_view name)
+    {
+        const topic_key key = topic_key::from(name);
+
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+        const auto found = m_names.find(key.value());
+        if (found != m_names.cend())
+        {
+            if (found->second != name)
+            {
+                return unexpected<topic_registry_error>(topic_registry_error::digest_collision);
+            }
+            return key;
+        }
+
+        m_names.emplace(key.value(), std::string(name));
+        return key;
+    }
+
+    expected<std::string, topic_registry_error> topic_registry::name_of(topic_key key) const
+    {
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+
+        const auto found = m_names.find(key.value());
+        if (found == m_names.cend())
+        {
+            return unexpected<topic_registry_error>(topic_registry_error::unknown_key);
+        }
+
+        return found->second;
+    }
+
+    std::size_t topic_registry::size() const
+    {
+        std::scoped_lock<tools::critical_section> guard(m_mutex);
+        return m_names.size();
+    }
+}
@@ -0,0 +1,234 @@
+/**
+ * @file topic_key.hpp
+ * @brief Hashed topic keys with precomputed digests, and a registry interning topic names.
+ *
+ * This file contains the definition of the topic_key handle and the topic_registry class, which let subjects and
+ * observers route on an integer compare and queue an 8-byte key instead of a std::string topic.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TOPIC_KEY_HPP_)
+#define TOPIC_KEY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "tools/critical_section.hpp"
+#include "tools/expected.hpp"
+#include "tools/non_copyable.hpp"
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#define TOOLS_TOPIC_KEY_CONSTEVAL consteval
+#else
+#define TOOLS_TOPIC_KEY_CONSTEVAL constexpr
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Topic identified by the 64-bit FNV-1a digest of its name.
+     *
+     * Meant to be used as the Topic template argument of sync_subject, sync_observer and async_observer: routing
+     * compares one integer instead of a string, and every queued event carries 8 bytes instead of a std::string.
+     * The digest is both the identity and the hash, so a key built from a literal at compile time equals the key
+     * built at run time from the same name, without any registry lookup on the publish path.
+     *
+     * Two names sharing a digest would be the same topic: intern the names once with topic_registry, typically at
+     * startup, to have such a collision reported instead.
+     *
+     * In C++20 the literal constructor is consteval: pass topic_key values (or "name"_topic) to templated
+     * functions such as subscribe(), not the bare literal.
+     */
+    class topic_key
+    {
+    public:
+        /**
+         * @brief Builds the key of the empty name.
+         */
+        constexpr topic_key() noexcept = default;
+
+        /**
+         * @brief Builds the key of a string literal, hashed at compile time.
+         *
+         * @param literal The topic name.
+         */
+        template <std::size_t N>
+        TOOLS_TOPIC_KEY_CONSTEVAL topic_key(const char (&literal)[N]) noexcept // NOLINT implicit on purpose
+            : m_digest(digest_of(std::string_view(literal, N - 1U)))
+        {
+        }
+
+        /**
+         * @brief Builds the key of a name known at run time.
+         *
+         * @param name The topic name.
+         * @return The key.
+         */
+        [[nodiscard]] static constexpr topic_key from(std::string_view name) noexcept
+        {
+            topic_key key;
+            key.m_digest = digest_of(name);
+            return key;
+        }
+
+        /**
+         * @brief Returns the digest identifying the topic.
+         *
+         * @return The 64-bit FNV-1a digest of the name.
+         */
+        [[nodiscard]] constexpr std::uint64_t value() const noexcept
+        {
+            return m_digest;
+        }
+
+        friend constexpr bool operator==(const topic_key& lhs, const topic_key& rhs) noexcept
+        {
+            return lhs.m_digest == rhs.m_digest;
+        }
+
+        friend constexpr bool operator!=(const topic_key& lhs, const topic_key& rhs) noexcept
+        {
+            return lhs.m_digest != rhs.m_digest;
+        }
+
+        friend constexpr bool operator<(const topic_key& lhs, const topic_key& rhs) noexcept
+        {
+            return lhs.m_digest < rhs.m_digest;
+        }
+
+        /**
+         * @brief Computes the 64-bit FNV-1a digest of a name.
+         *
+         * @param name The topic name.
+         * @return The digest.
+         */
+        [[nodiscard]] static constexpr std::uint64_t digest_of(std::string_view name) noexcept
+        {
+            std::uint64_t digest = fnv_offset_basis;
+            for (const char character : name)
+            {
+                digest ^= static_cast<std::uint8_t>(character);
+                digest *= fnv_prime;
+            }
+            return digest;
+        }
+
+    private:
+        static constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ULL;
+        static constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+        std::uint64_t m_digest = fnv_offset_basis;
+    };
+
+    namespace topic_literals
+    {
+        /**
+         * @brief Builds a topic_key from a literal at compile time: "temperature"_topic.
+         */
+        TOOLS_TOPIC_KEY_CONSTEVAL topic_key operator""_topic(const char* name, std::size_t length) noexcept
+        {
+            return topic_key::from(std::string_view(name, length));
+        }
+    }
+
+    /**
+     * @brief Errors reported by topic_registry operations.
+     */
+    enum class topic_registry_error : std::uint8_t
+    {
+        digest_collision,
+        unknown_key
+    };
+
+    /**
+     * @brief Thread-safe registry of the topic names behind topic_key digests.
+     *
+     * Interning checks that no other name owns the same digest, and keeps the name so that a key can be resolved
+     * back off the hot path (logging, diagnostics). Publishing never needs the registry.
+     */
+    class topic_registry : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        topic_registry() = default;
+        ~topic_registry() = default;
+
+        /**
+         * @brief Returns the key of a name, registering the name first if needed.
+         *
+         * @param name The topic name to intern.
+         * @return The topic_key of the name, or topic_registry_error::digest_collision when another interned name
+         * has the same digest.
+         */
+        [[nodiscard]] expected<topic_key, topic_registry_error> intern(std::string_view name);
+
+        /**
+         * @brief Resolves a topic_key back to its name.
+         *
+         * @param key The key to resolve.
+         * @return The interned name, or topic_registry_error::unknown_key.
+         */
+        [[nodiscard]] expected<std::string, topic_registry_error> name_of(topic_key key) const;
+
+        /**
+         * @brief Returns the number of interned names.
+         *
+         * @return The number of distinct topics registered so far.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        mutable critical_section m_mutex;
+        std::unordered_map<std::uint64_t, std::string> m_names;
+    };
+}
+
+namespace std
+{
+    /**
+     * @brief Hashes a topic_key with its precomputed digest, folded to the width of std::size_t.
+     */
+    template <>
+    struct hash<tools::topic_key>
+    {
+        std::size_t operator()(const tools::topic_key& key) const noexcept
+        {
+            const std::uint64_t digest = key.value();
+            return static_cast<std::size_t>(digest ^ (digest >> 32U));
+        }
+    };
+}
+
+#endif //  TOPIC_KEY_HPP_
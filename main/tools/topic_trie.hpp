@@ -0,0 +1,636 @@
+/**
+ * @file topic_trie.hpp
+ * @brief Hierarchical topics with single-level and multi-level wildcard subscriptions.
+ *
+ * A topic_path is a '/' separated topic split once into its levels, e.g. "sensors/kitchen/temperature". Topic
+ * filters use MQTT wildcards: '+' matches exactly one level and '#', as the last level, matches the remaining
+ * levels including none ("sensors/#" matches "sensors"). A topic_trie indexes the filters level by level, so
+ * matching a topic walks the trie along the levels of the topic instead of testing every subscription, and
+ * hierarchical_subject publishes to the observers and handlers of every filter matching a topic.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TOPIC_TRIE_HPP_)
+#define TOPIC_TRIE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tools/non_copyable.hpp"
+#include "tools/shared_critical_section.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/trace_ring.hpp"
+
+namespace tools
+{
+    /**
+     * @brief A hierarchical topic, split into its levels once at construction.
+     *
+     * Publishing a prebuilt topic_path avoids splitting the topic string on every publish.
+     */
+    class topic_path
+    {
+    public:
+        static constexpr char separator = '/';
+        static constexpr char single_level_wildcard = '+';
+        static constexpr char multi_level_wildcard = '#';
+
+        topic_path()
+            : topic_path(std::string_view {})
+        {
+        }
+
+        /**
+         * @brief Splits a topic or a topic filter into its levels.
+         *
+         * @param text The '/' separated topic; an empty text is a topic of one empty level.
+         */
+        explicit topic_path(std::string_view text)
+            : m_text(text)
+        {
+            m_starts.push_back(0U);
+            for (std::size_t pos = m_text.find(separator); pos != std::string::npos;
+                pos = m_text.find(separator, pos + 1U))
+            {
+                m_starts.push_back(pos + 1U);
+            }
+        }
+
+        /**
+         * @brief Returns the topic text.
+         *
+         * @return The '/' separated topic.
+         */
+        [[nodiscard]] const std::string& str() const
+        {
+            return m_text;
+        }
+
+        /**
+         * @brief Returns the number of levels of the topic.
+         *
+         * @return The level count, at least 1.
+         */
+        [[nodiscard]] std::size_t depth() const
+        {
+            return m_starts.size();
+        }
+
+        /**
+         * @brief Returns one level of the topic.
+         *
+         * @param level The level index, lower than depth().
+         * @return A view of the level text, valid as long as the topic_path.
+         */
+        [[nodiscard]] std::string_view segment(std::size_t level) const
+        {
+            const std::size_t start = m_starts[level];
+            const std::size_t end = ((level + 1U) < m_starts.size()) ? (m_starts[level + 1U] - 1U) : m_text.size();
+            return std::string_view(m_text).substr(start, end - start);
+        }
+
+        /**
+         * @brief Checks that the topic is a valid filter: wildcards fill whole levels and '#' is the last level.
+         *
+         * @return true if the topic can be subscribed to.
+         */
+        [[nodiscard]] bool is_valid_filter() const
+        {
+            for (std::size_t level = 0U; level < depth(); ++level)
+            {
+                const std::string_view name = segment(level);
+                const bool is_wildcard = (name.size() == 1U)
+                    && ((name[0] == single_level_wildcard) || (name[0] == multi_level_wildcard));
+
+                if (!is_wildcard && (std::string_view::npos != name.find_first_of("+#")))
+                {
+                    return false;
+                }
+
+                if (is_wildcard && (name[0] == multi_level_wildcard) && ((level + 1U) != depth()))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Checks that the topic can be published: it holds no wildcard.
+         *
+         * @return true if the topic has no wildcard character.
+         */
+        [[nodiscard]] bool is_valid_name() const
+        {
+            return std::string::npos == m_text.find_first_of("+#");
+        }
+
+    private:
+        std::string m_text;
+        std::vector<std::size_t> m_starts; // start offset of each level in m_text
+    };
+
+    /**
+     * @brief An index of values subscribed under topic filters, matched against concrete topics.
+     *
+     * Each trie node is one level of the filters: named children for the literal levels, a dedicated child for
+     * '+', and the values of the filters ending on the node, with or without a trailing '#'. Matching a topic of
+     * depth d visits at most the nodes on the literal and '+' paths of its d levels, whatever the number of
+     * subscriptions. Nodes emptied by erase are pruned.
+     *
+     * The trie is not thread-safe.
+     *
+     * @tparam Value The type of the subscribed values, e.g. observer pointers.
+     */
+    template <typename Value>
+    class topic_trie
+    {
+    public:
+        topic_trie() = default;
+
+        /**
+         * @brief Subscribes a value under a topic filter.
+         *
+         * @param filter The topic filter, possibly with wildcards.
+         * @param value The value reported for the topics matching the filter.
+         * @return true on success, false if the filter is not valid.
+         */
+        bool insert(const topic_path& filter, Value value)
+        {
+            if (!filter.is_valid_filter())
+            {
+                return false;
+            }
+
+            node* current = &m_root;
+            for (std::size_t level = 0U; level < filter.depth(); ++level)
+            {
+                const std::string_view name = filter.segment(level);
+
+                if (is_multi_level(name))
+                {
+                    current->multi_level_values.push_back(std::move(value));
+                    ++m_size;
+                    return true;
+                }
+
+                current = &child_for(*current, name);
+            }
+
+            current->values.push_back(std::move(value));
+            ++m_size;
+            return true;
+        }
+
+        /**
+         * @brief Removes the first value satisfying a predicate under a topic filter.
+         *
+         * @tparam Pred Predicate type, called with const Value&.
+         * @param filter The topic filter the value was inserted with.
+         * @param pred The predicate selecting the value.
+         * @return true if a value was removed.
+         */
+        template <typename Pred>
+        bool erase_if(const topic_path& filter, Pred pred)
+        {
+            if (!filter.is_valid_filter() || !erase_at(m_root, filter, 0U, pred))
+            {
+                return false;
+            }
+
+            --m_size;
+            return true;
+        }
+
+        /**
+         * @brief Removes the first value equal to value under a topic filter.
+         *
+         * @param filter The topic filter the value was inserted with.
+         * @param value The value to remove.
+         * @return true if a value was removed.
+         */
+        bool erase(const topic_path& filter, const Value& value)
+        {
+            return erase_if(filter, [&value](const Value& candidate) { return candidate == value; });
+        }
+
+        /**
+         * @brief Calls a function with every value whose filter matches a topic.
+         *
+         * A value subscribed under several matching filters is reported once per filter.
+         *
+         * @tparam Fn Function type, called with const Value&.
+         * @param topic The concrete topic.
+         * @param fn The function.
+         */
+        template <typename Fn>
+        void match(const topic_path& topic, Fn&& fn) const
+        {
+            match_at(m_root, topic, 0U, fn);
+        }
+
+        /**
+         * @brief Returns the number of subscribed values.
+         *
+         * @return The value count.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Checks if the trie holds no value.
+         *
+         * @return true if nothing is subscribed.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        /**
+         * @brief Removes every value.
+         */
+        void clear()
+        {
+            m_root = node {};
+            m_size = 0U;
+        }
+
+    private:
+        struct node
+        {
+            std::map<std::string, std::unique_ptr<node>, std::less<>> children;
+            std::unique_ptr<node> single_level_child;
+            std::vector<Value> values;             // filters ending on this level
+            std::vector<Value> multi_level_values; // filters ending with '#' after this level
+
+            [[nodiscard]] bool is_empty() const
+            {
+                return children.empty() && !single_level_child && values.empty() && multi_level_values.empty();
+            }
+        };
+
+        static bool is_single_level(std::string_view name)
+        {
+            return (name.size() == 1U) && (name[0] == topic_path::single_level_wildcard);
+        }
+
+        static bool is_multi_level(std::string_view name)
+        {
+            return (name.size() == 1U) && (name[0] == topic_path::multi_level_wildcard);
+        }
+
+        static node& child_for(node& parent, std::string_view name)
+        {
+            if (is_single_level(name))
+            {
+                if (!parent.single_level_child)
+                {
+                    parent.single_level_child = std::make_unique<node>();
+                }
+                return *parent.single_level_child;
+            }
+
+            auto found = parent.children.find(name);
+            if (found == parent.children.end())
+            {
+                found = parent.children.emplace(std::string(name), std::make_unique<node>()).first;
+            }
+            return *found->second;
+        }
+
+        template <typename Pred>
+        static bool erase_from(std::vector<Value>& values, Pred& pred)
+        {
+            for (auto itr = values.begin(); itr != values.end(); ++itr)
+            {
+                if (pred(static_cast<const Value&>(*itr)))
+                {
+                    values.erase(itr);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Pred>
+        static bool erase_at(node& current, const topic_path& filter, std::size_t level, Pred& pred)
+        {
+            if (level == filter.depth())
+            {
+                return erase_from(current.values, pred);
+            }
+
+            const std::string_view name = filter.segment(level);
+
+            if (is_multi_level(name))
+            {
+                return erase_from(current.multi_level_values, pred);
+            }
+
+            if (is_single_level(name))
+            {
+                if (!current.single_level_child || !erase_at(*current.single_level_child, filter, level + 1U, pred))
+                {
+                    return false;
+                }
+
+                if (current.single_level_child->is_empty())
+                {
+                    current.single_level_child.reset();
+                }
+                return true;
+            }
+
+            const auto found = current.children.find(name);
+            if ((found == current.children.end()) || !erase_at(*found->second, filter, level + 1U, pred))
+            {
+                return false;
+            }
+
+            if (found->second->is_empty())
+            {
+                current.children.erase(found);
+            }
+            return true;
+        }
+
+        template <typename Fn>
+        static void match_at(const node& current, const topic_path& topic, std::size_t level, Fn& fn)
+        {
+            for (const auto& value : current.multi_level_values)
+            {
+                fn(value);
+            }
+
+            if (level == topic.depth())
+            {
+                for (const auto& value : current.values)
+                {
+                    fn(value);
+                }
+                return;
+            }
+
+            const auto found = current.children.find(topic.segment(level));
+            if (found != current.children.end())
+            {
+                match_at(*found->second, topic, level + 1U, fn);
+            }
+
+            if (current.single_level_child)
+            {
+                match_at(*current.single_level_child, topic, level + 1U, fn);
+            }
+        }
+
+        node m_root;
+        std::size_t m_size = 0U;
+    };
+
+    /**
+     * @brief A subject publishing hierarchical topics to the observers and handlers of matching topic filters.
+     *
+     * The counterpart of sync_subject for std::string topics subscribed with wildcards: one subscription to
+     * "sensors/+/temperature" replaces one subscription per sensor, and publishing costs a trie walk along the
+     * levels of the topic. Observers are the regular sync_observer<std::string, Evt, Origin>, hence
+     * async_observer and its variants, and receive the concrete published topic.
+     *
+     * Receivers are collected under a shared lock and informed outside of it, so they may (un)subscribe while
+     * informed.
+     *
+     * @tparam Evt The type of the event.
+     * @tparam Origin The type identifying the publishing subject (its name by default, or an interned origin_id).
+     */
+    template <typename Evt, typename Origin = std::string>
+    class hierarchical_subject : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using sync_observer_shared_ptr = std::shared_ptr<sync_observer<std::string, Evt, Origin>>;
+        using handler = loose_coupled_handler<std::string, Evt, Origin>;
+
+        hierarchical_subject() = delete;
+
+        /**
+         * @brief Constructs the subject with the given name, also used as origin when Origin is a string type.
+         *
+         * @param name The name of the subject.
+         */
+        template <typename UOrigin = Origin,
+            typename = std::enable_if_t<std::is_constructible_v<UOrigin, const std::string&>>>
+        explicit hierarchical_subject(std::string name)
+            : m_name { std::move(name) }
+            , m_origin(m_name)
+        {
+        }
+
+        /**
+         * @brief Constructs the subject with the given name and an explicit origin value.
+         *
+         * @param name The name of the subject.
+         * @param origin The origin value handed to observers and handlers on publish.
+         */
+        hierarchical_subject(std::string name, Origin origin)
+            : m_name { std::move(name) }
+            , m_origin(std::move(origin))
+        {
+        }
+
+        ~hierarchical_subject() = default;
+
+        /**
+         * @brief Subscribes an observer to the topics matching a filter.
+         *
+         * @param filter The topic filter, e.g. "sensors/+/temperature" or "sensors/#".
+         * @param observer The observer to subscribe.
+         * @return true on success, false if the filter is not valid.
+         */
+        bool subscribe(const topic_path& filter, sync_observer_shared_ptr observer)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            return m_subscribers.insert(filter, std::move(observer));
+        }
+
+        /**
+         * @brief Subscribes an observer to the topics matching a filter given as text.
+         *
+         * @param filter The topic filter.
+         * @param observer The observer to subscribe.
+         * @return true on success, false if the filter is not valid.
+         */
+        bool subscribe(std::string_view filter, sync_observer_shared_ptr observer)
+        {
+            return subscribe(topic_path(filter), std::move(observer));
+        }
+
+        /**
+         * @brief Subscribes a named handler to the topics matching a filter.
+         *
+         * @param filter The topic filter.
+         * @param handler_name The name identifying the handler for unsubscription.
+         * @param handler_fn The handler function.
+         * @return true on success, false if the filter is not valid.
+         */
+        bool subscribe(const topic_path& filter, std::string handler_name, handler handler_fn)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            return m_handlers.insert(filter, std::make_pair(std::move(handler_name), std::move(handler_fn)));
+        }
+
+        /**
+         * @brief Subscribes a named handler to the topics matching a filter given as text.
+         *
+         * @param filter The topic filter.
+         * @param handler_name The name identifying the handler for unsubscription.
+         * @param handler_fn The handler function.
+         * @return true on success, false if the filter is not valid.
+         */
+        bool subscribe(std::string_view filter, std::string handler_name, handler handler_fn)
+        {
+            return subscribe(topic_path(filter), std::move(handler_name), std::move(handler_fn));
+        }
+
+        /**
+         * @brief Unsubscribes an observer from a filter it was subscribed with.
+         *
+         * @param filter The topic filter.
+         * @param observer The observer to unsubscribe.
+         * @return true if the subscription existed.
+         */
+        bool unsubscribe(const topic_path& filter, const sync_observer_shared_ptr& observer)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            return m_subscribers.erase(filter, observer);
+        }
+
+        /**
+         * @brief Unsubscribes a named handler from a filter it was subscribed with.
+         *
+         * @param filter The topic filter.
+         * @param handler_name The name of the handler.
+         * @return true if the subscription existed.
+         */
+        bool unsubscribe(const topic_path& filter, const std::string& handler_name)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            return m_handlers.erase_if(
+                filter, [&handler_name](const named_handler& candidate) { return candidate.first == handler_name; });
+        }
+
+        /**
+         * @brief Publishes an event to every observer and handler whose filter matches the topic.
+         *
+         * @param topic The concrete topic, built once and reusable across publishes.
+         * @param event The event to be published.
+         */
+        void publish(const topic_path& topic, const Evt& event)
+        {
+            TOOLS_TRACE(publish, "hierarchical_subject::publish", this, 0U);
+            std::vector<sync_observer_shared_ptr> to_inform;
+            std::vector<handler> to_invoke;
+
+            {
+                std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+                m_subscribers.match(
+                    topic, [&to_inform](const sync_observer_shared_ptr& observer) { to_inform.push_back(observer); });
+                m_handlers.match(
+                    topic, [&to_invoke](const named_handler& entry) { to_invoke.push_back(entry.second); });
+            }
+
+            for (const auto& observer : to_inform)
+            {
+                observer->inform(topic.str(), event, m_origin);
+            }
+
+            for (const auto& handler_fn : to_invoke)
+            {
+                handler_fn(topic.str(), event, m_origin);
+            }
+        }
+
+        /**
+         * @brief Publishes an event to a topic given as text.
+         *
+         * @param topic The concrete topic.
+         * @param event The event to be published.
+         */
+        void publish(std::string_view topic, const Evt& event)
+        {
+            publish(topic_path(topic), event);
+        }
+
+        /**
+         * @brief Returns the number of observer and handler subscriptions.
+         *
+         * @return The subscription count.
+         */
+        std::size_t number_of_subscriptions()
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            return m_subscribers.size() + m_handlers.size();
+        }
+
+        /**
+         * @brief Retrieves the name of the subject.
+         *
+         * @return The name given at construction.
+         */
+        [[nodiscard]] const std::string& name() const
+        {
+            return m_name;
+        }
+
+    private:
+        using named_handler = std::pair<std::string, handler>;
+
+        shared_critical_section m_mutex;
+        topic_trie<sync_observer_shared_ptr> m_subscribers;
+        topic_trie<named_handler> m_handlers;
+        std::string m_name;
+        Origin m_origin;
+    };
+
+}
+
+#endif //  TOPIC_TRIE_HPP_
@@ -0,0 +1,567 @@
+/**
+ * @file trace_ring.hpp
+ * @brief Per-core binary rings of timestamped trace events, and their Chrome trace / Perfetto JSON exporter.
+ *
+ * This file contains the definition of the trace_event and trace_ring classes, of tools::trace_record(), which the
+ * TOOLS_TRACE hooks of the subjects, observers and tasks call when USE_TRACE_RING is defined, and of
+ * write_chrome_trace(). Recording an event only stores a few words into the ring of the current core: nothing is
+ * formatted until the rings are exported.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(TRACE_RING_HPP_)
+#define TRACE_RING_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "tools/non_copyable.hpp"
+#include "tools/platform_detection.hpp"
+#include "tools/platform_helpers.hpp"
+
+#if defined(FREERTOS_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#endif
+#endif
+
+namespace tools
+{
+    /**
+     * @brief Kind of a trace event.
+     */
+    enum class trace_event_type : std::uint8_t
+    {
+        /** @brief A task resumed after waiting for work. */
+        task_switch,
+        /** @brief A subject published an event. */
+        publish,
+        /** @brief An asynchronous observer queued an event. */
+        inform,
+        /** @brief A task took an item from its queue. */
+        dequeue,
+        /** @brief A task starts processing an item. */
+        process_begin,
+        /** @brief A task is done processing an item. */
+        process_end,
+        /** @brief An application-defined point in time. */
+        instant
+    };
+
+    /**
+     * @brief A trace event read back from a trace_ring.
+     */
+    struct trace_event
+    {
+        /** @brief Time of the event in microseconds, from a monotonic clock. */
+        std::uint64_t timestamp_us = 0U;
+        /** @brief Name of the event, with static storage. */
+        const char* name = "";
+        /** @brief The task or thread recording the event. */
+        const void* task = nullptr;
+        /** @brief The object the event is about (subject, observer, task). */
+        const void* object = nullptr;
+        /** @brief Application-defined value. */
+        std::uint32_t value = 0U;
+        /** @brief Index of the ring (core) the event was recorded in. */
+        std::uint16_t channel = 0U;
+        /** @brief Kind of the event. */
+        trace_event_type type = trace_event_type::instant;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the current time of the trace clock in microseconds.
+         */
+        inline std::uint64_t trace_now_us()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::uint64_t>(esp_timer_get_time());
+#elif defined(FREERTOS_PLATFORM)
+            constexpr std::uint64_t us_per_ms = 1000U;
+            return static_cast<std::uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * us_per_ms;
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+#endif
+        }
+
+        /**
+         * @brief Returns an identifier of the calling task or thread.
+         */
+        inline const void* current_trace_task()
+        {
+#if defined(FREERTOS_PLATFORM)
+            return xTaskGetCurrentTaskHandle();
+#else
+            thread_local const char task_marker = 0;
+            return &task_marker;
+#endif
+        }
+
+        /**
+         * @brief Returns the ring index of the calling task: its core on ESP32, one ring per thread elsewhere.
+         */
+        inline std::size_t current_trace_channel()
+        {
+#if defined(ESP_PLATFORM)
+            return static_cast<std::size_t>(xPortGetCoreID());
+#elif defined(FREERTOS_PLATFORM)
+            return 0U;
+#else
+            static std::atomic<std::size_t> next_channel { 0U };
+            thread_local const std::size_t channel = next_channel.fetch_add(1U, std::memory_order_relaxed);
+            return channel;
+#endif
+        }
+    }
+
+    /**
+     * @brief One overwriting ring of trace events, written by the tasks of one core.
+     *
+     * A writer claims the next position with a single fetch_add and fills the slot between two stores of its
+     * sequence: a per-slot seqlock, with release stores and acquire loads of the fields instead of fences. Recording
+     * never blocks, even when a task is preempted on the same core by another writer, and the oldest events are
+     * overwritten once the ring is full. A reader discards the slots being written or overwritten while it reads them.
+     */
+    class trace_channel : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Allocates a ring of 2^capacity_pow2 events.
+         *
+         * @param capacity_pow2 The power of 2 of the number of events kept.
+         */
+        explicit trace_channel(std::size_t capacity_pow2)
+            : m_mask((std::size_t { 1U } << capacity_pow2) - 1U)
+            , m_slots(std::make_unique<slot[]>(m_mask + 1U)) // NOLINT fixed array of slots
+        {
+        }
+
+        trace_channel()
+            : trace_channel(default_capacity_pow2)
+        {
+        }
+
+        ~trace_channel() = default;
+
+        /** @brief Default power of 2 of the number of events of each ring. */
+        static constexpr std::size_t default_capacity_pow2 = 10U;
+
+        /**
+         * @brief Records an event, overwriting the oldest one if the ring is full.
+         *
+         * @param type The kind of event.
+         * @param name The event name, with static storage.
+         * @param object The object the event is about.
+         * @param value An application-defined value.
+         */
+        void record(trace_event_type type, const char* name, const void* object, std::uint32_t value)
+        {
+            const std::uint64_t timestamp = detail::trace_now_us();
+            const std::size_t position = m_head.fetch_add(1U, std::memory_order_relaxed);
+            slot& target = m_slots[position & m_mask];
+
+            target.sequence.store((position << 1U) + 1U, std::memory_order_relaxed);
+            // release stores: no field can become visible before the odd sequence
+            target.timestamp_low.store(static_cast<std::uint32_t>(timestamp), std::memory_order_release);
+            target.timestamp_high.store(static_cast<std::uint32_t>(timestamp >> 32U), std::memory_order_release);
+            target.name.store(name, std::memory_order_release);
+            target.task.store(detail::current_trace_task(), std::memory_order_release);
+            target.object.store(object, std::memory_order_release);
+            target.value.store(value, std::memory_order_release);
+            target.type.store(type, std::memory_order_release);
+            target.sequence.store((position << 1U) + 2U, std::memory_order_release);
+        }
+
+        /**
+         * @brief Appends the events still held by the ring, oldest first.
+         *
+         * @param events The vector receiving the events.
+         * @param channel_index The channel index stored into the events.
+         */
+        void collect(std::vector<trace_event>& events, std::size_t channel_index) const
+        {
+            const std::size_t head = m_head.load(std::memory_order_acquire);
+            const std::size_t capacity = m_mask + 1U;
+            const std::size_t first = (head > capacity) ? (head - capacity) : 0U;
+
+            for (std::size_t position = first; position != head; ++position)
+            {
+                const slot& source = m_slots[position & m_mask];
+                const std::size_t sequence = source.sequence.load(std::memory_order_acquire);
+                if (((position << 1U) + 2U) != sequence)
+                {
+                    // being written, or already overwritten by a later lap
+                    continue;
+                }
+
+                // acquire loads: the second read of the sequence cannot move before the fields
+                trace_event event;
+                event.timestamp_us = static_cast<std::uint64_t>(source.timestamp_low.load(std::memory_order_acquire))
+                    | (static_cast<std::uint64_t>(source.timestamp_high.load(std::memory_order_acquire)) << 32U);
+                event.name = source.name.load(std::memory_order_acquire);
+                event.task = source.task.load(std::memory_order_acquire);
+                event.object = source.object.load(std::memory_order_acquire);
+                event.value = source.value.load(std::memory_order_acquire);
+                event.type = source.type.load(std::memory_order_acquire);
+                event.channel = static_cast<std::uint16_t>(channel_index);
+
+                if (source.sequence.load(std::memory_order_relaxed) == sequence)
+                {
+                    events.push_back(event);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of events recorded since construction, overwritten ones included.
+         *
+         * @return The recorded count.
+         */
+        [[nodiscard]] std::size_t recorded_count() const
+        {
+            return m_head.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of events the ring keeps.
+         *
+         * @return The capacity.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_mask + 1U;
+        }
+
+    private:
+        /**
+         * @brief An event slot: every field is a relaxed atomic guarded by the sequence.
+         */
+        struct slot
+        {
+            std::atomic<std::size_t> sequence { 0U };
+            std::atomic<std::uint32_t> timestamp_low { 0U };
+            std::atomic<std::uint32_t> timestamp_high { 0U };
+            std::atomic<const char*> name { nullptr };
+            std::atomic<const void*> task { nullptr };
+            std::atomic<const void*> object { nullptr };
+            std::atomic<std::uint32_t> value { 0U };
+            std::atomic<trace_event_type> type { trace_event_type::instant };
+        };
+
+        std::size_t m_mask;
+        std::unique_ptr<slot[]> m_slots; // NOLINT fixed array of slots
+        std::atomic<std::size_t> m_head { 0U };
+    };
+
+    /**
+     * @brief The trace rings of all cores.
+     *
+     * Install a trace_ring with set_trace_target() to have tools::trace_record() and the TOOLS_TRACE hooks write to
+     * it, then read it back with snapshot() or write_chrome_trace().
+     */
+    class trace_ring : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /**
+         * @brief Allocates one ring per channel.
+         *
+         * @param capacity_pow2 The power of 2 of the number of events kept by each ring.
+         * @param channel_count The number of rings, one per core by default.
+         */
+        explicit trace_ring(std::size_t capacity_pow2 = trace_channel::default_capacity_pow2,
+            std::size_t channel_count = static_cast<std::size_t>(cpu_core_count()))
+            : m_channel_count((0U == channel_count) ? 1U : channel_count)
+            , m_channels(std::make_unique<std::unique_ptr<trace_channel>[]>(m_channel_count)) // NOLINT fixed array
+        {
+            for (std::size_t index = 0U; index < m_channel_count; ++index)
+            {
+                m_channels[index] = std::make_unique<trace_channel>(capacity_pow2);
+            }
+        }
+
+        ~trace_ring() = default;
+
+        /**
+         * @brief Records an event into the ring of the calling task.
+         *
+         * @param type The kind of event.
+         * @param name The event name, with static storage.
+         * @param object The object the event is about.
+         * @param value An application-defined value.
+         */
+        void record(trace_event_type type, const char* name, const void* object, std::uint32_t value)
+        {
+            m_channels[detail::current_trace_channel() % m_channel_count]->record(type, name, object, value);
+        }
+
+        /**
+         * @brief Returns the events held by all rings, ordered by time.
+         *
+         * @return The events.
+         */
+        [[nodiscard]] std::vector<trace_event> snapshot() const
+        {
+            std::vector<trace_event> events;
+            for (std::size_t index = 0U; index < m_channel_count; ++index)
+            {
+                m_channels[index]->collect(events, index);
+            }
+            std::stable_sort(events.begin(), events.end(),
+                [](const trace_event& lhs, const trace_event& rhs) { return lhs.timestamp_us < rhs.timestamp_us; });
+            return events;
+        }
+
+        /**
+         * @brief Accesses a ring.
+         *
+         * @param index The ring index, below channel_count().
+         * @return The ring.
+         */
+        [[nodiscard]] const trace_channel& channel(std::size_t index) const
+        {
+            return *m_channels[index];
+        }
+
+        /**
+         * @brief Returns the number of rings.
+         *
+         * @return The channel count.
+         */
+        [[nodiscard]] std::size_t channel_count() const
+        {
+            return m_channel_count;
+        }
+
+    private:
+        std::size_t m_channel_count;
+        std::unique_ptr<std::unique_ptr<trace_channel>[]> m_channels; // NOLINT fixed array of rings
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief The ring the trace_record() calls are routed to, and the number of calls using it.
+         */
+        struct trace_route
+        {
+            std::atomic<trace_ring*> target { nullptr };
+            std::atomic<std::uint32_t> writers { 0U };
+        };
+
+        inline trace_route& trace_routing()
+        {
+            static trace_route route;
+            return route;
+        }
+
+        /**
+         * @brief Returns the Chrome trace phase of an event type.
+         */
+        constexpr const char* trace_phase(trace_event_type type)
+        {
+            switch (type)
+            {
+                case trace_event_type::process_begin:
+                    return "B";
+                case trace_event_type::process_end:
+                    return "E";
+                default:
+                    return "i";
+            }
+        }
+
+        /**
+         * @brief Returns the Chrome trace category of an event type.
+         */
+        constexpr const char* trace_category(trace_event_type type)
+        {
+            switch (type)
+            {
+                case trace_event_type::task_switch:
+                    return "task_switch";
+                case trace_event_type::publish:
+                    return "publish";
+                case trace_event_type::inform:
+                    return "inform";
+                case trace_event_type::dequeue:
+                    return "dequeue";
+                case trace_event_type::process_begin:
+                case trace_event_type::process_end:
+                    return "process";
+                default:
+                    return "instant";
+            }
+        }
+    }
+
+    /**
+     * @brief Routes the trace_record() calls to a ring, or stops recording.
+     *
+     * Returns once no call records into the previous ring anymore.
+     *
+     * @param ring The ring to record to, nullptr to stop recording.
+     * @return The previous ring.
+     */
+    inline trace_ring* set_trace_target(trace_ring* ring)
+    {
+        auto& route = detail::trace_routing();
+        trace_ring* previous = route.target.exchange(ring);
+        while (0U != route.writers.load())
+        {
+            // a trace call holds the route for a few instructions only
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        return previous;
+    }
+
+    /**
+     * @brief Records an event into the installed trace_ring, if any.
+     *
+     * Without a ring, the call costs a relaxed load and a branch.
+     *
+     * @param type The kind of event.
+     * @param name The event name, with static storage.
+     * @param object The object the event is about.
+     * @param value An application-defined value.
+     */
+    inline void trace_record(trace_event_type type, const char* name, const void* object, std::uint32_t value = 0U)
+    {
+        auto& route = detail::trace_routing();
+        if (nullptr == route.target.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        route.writers.fetch_add(1U);
+        trace_ring* ring = route.target.load();
+        if (nullptr != ring)
+        {
+            ring->record(type, name, object, value);
+        }
+        route.writers.fetch_sub(1U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Writes events as a Chrome trace / Perfetto JSON document.
+     *
+     * The document is produced in small chunks handed to the sink, so no text buffer proportional to the trace
+     * is needed: on ESP32 the sink may write to the console or to a UART driver (uart_write_bytes()). Each ring is
+     * a process (pid) and each task a thread (tid); process_begin/process_end are duration events, the others are
+     * thread-scoped instant events carrying the object address and the value.
+     *
+     * @tparam Sink A callable taking (const char* data, std::size_t size).
+     * @param events The events, typically trace_ring::snapshot().
+     * @param sink The output.
+     */
+    template <typename Sink>
+    void write_chrome_trace(const std::vector<trace_event>& events, Sink&& sink)
+    {
+        constexpr const char header[] = "{\"traceEvents\":[";
+        constexpr const char footer[] = "\n]}\n";
+        sink(header, sizeof(header) - 1U);
+
+        std::vector<const void*> tasks;
+        std::array<char, 256U> line = {};
+        bool first = true;
+
+        for (const auto& event : events)
+        {
+            auto task_itr = std::find(tasks.begin(), tasks.end(), event.task);
+            if (task_itr == tasks.end())
+            {
+                task_itr = tasks.insert(tasks.end(), event.task);
+            }
+            const auto tid = static_cast<unsigned long>(task_itr - tasks.begin()) + 1UL;
+
+            // names have static storage and no characters to escape: string literals of the hooks or application
+            int length = std::snprintf(line.data(), line.size(),
+                "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"ts\":%llu,\"pid\":%u,\"tid\":%lu",
+                first ? "" : ",", event.name, detail::trace_category(event.type), detail::trace_phase(event.type),
+                static_cast<unsigned long long>(event.timestamp_us), static_cast<unsigned int>(event.channel), tid);
+            if ((length > 0) && (static_cast<std::size_t>(length) < line.size()))
+            {
+                const std::size_t prefix = static_cast<std::size_t>(length);
+                length = (trace_event_type::process_end == event.type)
+                    ? std::snprintf(line.data() + prefix, line.size() - prefix, "}") // NOLINT pointer arithmetic
+                    : std::snprintf(line.data() + prefix, line.size() - prefix,      // NOLINT pointer arithmetic
+                        "%s,\"args\":{\"object\":\"%p\",\"value\":%lu}}",
+                        (trace_event_type::process_begin == event.type) ? "" : ",\"s\":\"t\"", event.object,
+                        static_cast<unsigned long>(event.value));
+                if ((length > 0) && ((prefix + static_cast<std::size_t>(length)) < line.size()))
+                {
+                    sink(line.data(), prefix + static_cast<std::size_t>(length));
+                    first = false;
+                }
+            }
+        }
+
+        sink(footer, sizeof(footer) - 1U);
+    }
+
+    /**
+     * @brief Writes the events of a trace_ring as a Chrome trace / Perfetto JSON document to a C stream.
+     *
+     * On ESP32, stdout is the console UART.
+     *
+     * @param ring The ring.
+     * @param output The stream, stdout by default.
+     */
+    inline void write_chrome_trace(const trace_ring& ring, std::FILE* output = stdout)
+    {
+        write_chrome_trace(ring.snapshot(),
+            [output](const char* data, std::size_t size) { static_cast<void>(std::fwrite(data, 1U, size, output)); });
+        std::fflush(output);
+    }
+}
+
+// hooks of the subjects, observers and tasks, compiled in with USE_TRACE_RING
+#if defined(USE_TRACE_RING)
+#define TOOLS_TRACE(type, name, object, value)                                                                         \
+    tools::trace_record(tools::trace_event_type::type, name, object, value)
+#else
+#define TOOLS_TRACE(type, name, object, value) static_cast<void>(0)
+#endif
+
+#endif //  TRACE_RING_HPP_
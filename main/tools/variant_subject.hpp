@@ -0,0 +1,415 @@
+/**
+ * @file variant_subject.hpp
+ * @brief A subject publishing the alternatives of a std::variant to per-type subscriber tables.
+ *
+ * A sync_subject carrying a std::variant payload informs every observer of every alternative, each observer
+ * then visiting the variant to keep the events it handles. variant_subject keeps one subscriber table per
+ * alternative type instead: observers subscribe through the sync_observer<Topic, Evt> bases they implement,
+ * handlers register for one alternative, and publishing a variant indexes a constexpr dispatcher table with
+ * variant::index(). Subscribers of the other alternatives are neither informed nor traversed.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(VARIANT_SUBJECT_HPP_)
+#define VARIANT_SUBJECT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "tools/non_copyable.hpp"
+#include "tools/shared_critical_section.hpp"
+#include "tools/sync_observer.hpp"
+#include "tools/trace_ring.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        /**
+         * @brief Index of the first occurrence of T in Ts, or sizeof...(Ts) when T is not one of them.
+         */
+        template <typename T, typename... Ts>
+        constexpr std::size_t type_pack_index()
+        {
+            constexpr std::array<bool, sizeof...(Ts)> matches = { std::is_same_v<T, Ts>... };
+            std::size_t index = 0U;
+            while ((index < matches.size()) && !matches[index]) // NOLINT bounds checked
+            {
+                ++index;
+            }
+            return index;
+        }
+    }
+
+    /**
+     * @brief Primary template, only defined for a std::variant of event types.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Variant The std::variant of the event types.
+     * @tparam Origin The type of the origin handed to observers and handlers.
+     */
+    template <typename Topic, typename Variant, typename Origin = std::string>
+    class variant_subject;
+
+    /**
+     * @brief A synchronous subject dispatching each alternative of an event variant to its own subscribers.
+     *
+     * An observer deriving from sync_observer<Topic, Evt, Origin> for several alternatives is registered in
+     * the table of each of them by a single subscribe and receives the unwrapped alternative. The alternative
+     * types are expected to be distinct.
+     *
+     * @tparam Topic The type of the topic.
+     * @tparam Evts The event types, alternatives of the variant.
+     * @tparam Origin The type of the origin handed to observers and handlers.
+     */
+    template <typename Topic, typename... Evts, typename Origin>
+    class variant_subject<Topic, std::variant<Evts...>, Origin>
+        : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using event_variant = std::variant<Evts...>;
+
+        template <typename Evt>
+        using observer_type = sync_observer<Topic, Evt, Origin>;
+
+        template <typename Evt>
+        using sync_observer_shared_ptr = std::shared_ptr<observer_type<Evt>>;
+
+        template <typename Evt>
+        using handler = loose_coupled_handler<Topic, Evt, Origin>;
+
+        static constexpr std::size_t number_of_alternatives = sizeof...(Evts);
+
+        /**
+         * @brief Index of an event type among the alternatives, number_of_alternatives if it is not one.
+         */
+        template <typename Evt>
+        static constexpr std::size_t alternative_index = detail::type_pack_index<Evt, Evts...>();
+
+        /**
+         * @brief Tells whether an event type is one of the alternatives.
+         */
+        template <typename Evt>
+        static constexpr bool has_alternative = (alternative_index<Evt> < number_of_alternatives);
+
+        /**
+         * @brief Tells whether an observer type implements the sync_observer of at least one alternative.
+         */
+        template <typename Observer>
+        static constexpr bool observes_any = (std::is_base_of_v<observer_type<Evts>, Observer> || ...);
+
+        variant_subject() = delete;
+
+        /**
+         * @brief Constructs the subject with the given name, also used as origin when Origin is a string type.
+         *
+         * @param name The name of the subject.
+         */
+        template <typename UOrigin = Origin,
+            typename = std::enable_if_t<std::is_constructible_v<UOrigin, const std::string&>>>
+        explicit variant_subject(std::string name)
+            : m_name { std::move(name) }
+            , m_origin(m_name)
+        {
+        }
+
+        /**
+         * @brief Constructs the subject with the given name and an explicit origin value.
+         *
+         * @param name The name of the subject.
+         * @param origin The origin value handed to observers and handlers on publish.
+         */
+        variant_subject(std::string name, Origin origin)
+            : m_name { std::move(name) }
+            , m_origin(std::move(origin))
+        {
+        }
+
+        ~variant_subject() = default;
+
+        /**
+         * @brief Subscribes an observer to a topic for every alternative it has a sync_observer base for.
+         *
+         * @tparam Observer The concrete observer type.
+         * @param topic The topic to subscribe to.
+         * @param observer The observer to subscribe.
+         */
+        template <typename Observer>
+        void subscribe(const Topic& topic, const std::shared_ptr<Observer>& observer)
+        {
+            static_assert(observes_any<Observer>, "the observer must implement the sync_observer of an alternative");
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            subscribe_observer(topic, observer, std::index_sequence_for<Evts...> {});
+        }
+
+        /**
+         * @brief Subscribes a named handler to a topic for one alternative.
+         *
+         * @tparam Evt The alternative the handler receives.
+         * @param topic The topic to subscribe to.
+         * @param handler_name The name identifying the handler for unsubscription.
+         * @param handler_fn The handler function.
+         */
+        template <typename Evt>
+        void subscribe(const Topic& topic, std::string handler_name, handler<Evt> handler_fn)
+        {
+            static_assert(has_alternative<Evt>, "the event type must be an alternative of the variant");
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            std::get<alternative_index<Evt>>(m_tables).handlers.emplace(
+                topic, std::make_pair(std::move(handler_name), std::move(handler_fn)));
+        }
+
+        /**
+         * @brief Unsubscribes an observer from a topic for every alternative it was subscribed for.
+         *
+         * @tparam Observer The concrete observer type.
+         * @param topic The topic to unsubscribe from.
+         * @param observer The observer to unsubscribe.
+         */
+        template <typename Observer>
+        void unsubscribe(const Topic& topic, const std::shared_ptr<Observer>& observer)
+        {
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            unsubscribe_observer(topic, observer, std::index_sequence_for<Evts...> {});
+        }
+
+        /**
+         * @brief Unsubscribes a named handler from a topic for one alternative.
+         *
+         * @tparam Evt The alternative the handler was subscribed for.
+         * @param topic The topic to unsubscribe from.
+         * @param handler_name The name of the handler.
+         */
+        template <typename Evt>
+        void unsubscribe(const Topic& topic, const std::string& handler_name)
+        {
+            static_assert(has_alternative<Evt>, "the event type must be an alternative of the variant");
+            std::scoped_lock<tools::shared_critical_section> guard(m_mutex);
+            auto& handlers = std::get<alternative_index<Evt>>(m_tables).handlers;
+            auto range = handlers.equal_range(topic);
+            for (auto it = range.first; it != range.second;)
+            {
+                it = (it->second.first == handler_name) ? handlers.erase(it) : std::next(it);
+            }
+        }
+
+        /**
+         * @brief Publishes an event variant to the subscribers of its active alternative.
+         *
+         * A valueless variant is not delivered.
+         *
+         * @param topic The topic of the event.
+         * @param event The event to be published.
+         */
+        void publish(const Topic& topic, const event_variant& event)
+        {
+            TOOLS_TRACE(publish, "variant_subject::publish", this, 0U);
+            static constexpr auto dispatchers = make_dispatchers(std::index_sequence_for<Evts...> {});
+            if (!event.valueless_by_exception())
+            {
+                (this->*dispatchers[event.index()])(topic, event); // NOLINT index() is in range when not valueless
+            }
+        }
+
+        /**
+         * @brief Publishes an alternative to its subscribers without wrapping it in a variant.
+         *
+         * @tparam Evt The alternative type.
+         * @param topic The topic of the event.
+         * @param event The event to be published.
+         */
+        template <typename Evt, typename = std::enable_if_t<has_alternative<Evt>>>
+        void publish(const Topic& topic, const Evt& event)
+        {
+            TOOLS_TRACE(publish, "variant_subject::publish", this, 0U);
+            deliver<alternative_index<Evt>>(topic, event);
+        }
+
+        /**
+         * @brief Returns the number of observer and handler subscriptions over all alternatives.
+         *
+         * @return The subscription count.
+         */
+        std::size_t number_of_subscriptions()
+        {
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            return std::apply([](const auto&... tables) { return (0U + ... + tables.size()); }, m_tables);
+        }
+
+        /**
+         * @brief Returns the number of observer and handler subscriptions of one alternative.
+         *
+         * @tparam Evt The alternative type.
+         * @return The subscription count.
+         */
+        template <typename Evt>
+        std::size_t number_of_subscriptions()
+        {
+            static_assert(has_alternative<Evt>, "the event type must be an alternative of the variant");
+            std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+            return std::get<alternative_index<Evt>>(m_tables).size();
+        }
+
+        /**
+         * @brief Retrieves the name of the subject.
+         *
+         * @return The name given at construction.
+         */
+        [[nodiscard]] const std::string& name() const
+        {
+            return m_name;
+        }
+
+    private:
+        /**
+         * @brief Observers and named handlers of one alternative, keyed by topic.
+         */
+        template <typename Evt>
+        struct subscriber_table
+        {
+            std::multimap<Topic, sync_observer_shared_ptr<Evt>> observers;
+            std::multimap<Topic, std::pair<std::string, handler<Evt>>> handlers;
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return observers.size() + handlers.size();
+            }
+        };
+
+        using dispatcher = void (variant_subject::*)(const Topic&, const event_variant&);
+
+        template <std::size_t... Indices>
+        static constexpr std::array<dispatcher, sizeof...(Indices)> make_dispatchers(
+            std::index_sequence<Indices...> /*unused*/)
+        {
+            return { &variant_subject::deliver_alternative<Indices>... };
+        }
+
+        template <std::size_t Index>
+        void deliver_alternative(const Topic& topic, const event_variant& event)
+        {
+            deliver<Index>(topic, *std::get_if<Index>(&event));
+        }
+
+        template <std::size_t Index>
+        void deliver(const Topic& topic, const std::variant_alternative_t<Index, event_variant>& event)
+        {
+            using evt_type = std::variant_alternative_t<Index, event_variant>;
+            std::vector<sync_observer_shared_ptr<evt_type>> to_inform;
+            std::vector<handler<evt_type>> to_invoke;
+
+            {
+                std::shared_lock<tools::shared_critical_section> guard(m_mutex);
+                const auto& table = std::get<Index>(m_tables);
+                auto observers = table.observers.equal_range(topic);
+                for (auto it = observers.first; it != observers.second; ++it)
+                {
+                    to_inform.push_back(it->second);
+                }
+                auto handlers = table.handlers.equal_range(topic);
+                for (auto it = handlers.first; it != handlers.second; ++it)
+                {
+                    to_invoke.push_back(it->second.second);
+                }
+            }
+
+            for (const auto& observer : to_inform)
+            {
+                observer->inform(topic, event, m_origin);
+            }
+
+            for (const auto& handler_fn : to_invoke)
+            {
+                handler_fn(topic, event, m_origin);
+            }
+        }
+
+        template <typename Observer, std::size_t... Indices>
+        void subscribe_observer(
+            const Topic& topic, const std::shared_ptr<Observer>& observer, std::index_sequence<Indices...> /*unused*/)
+        {
+            (subscribe_alternative<Indices>(topic, observer), ...);
+        }
+
+        template <std::size_t Index, typename Observer>
+        void subscribe_alternative(const Topic& topic, const std::shared_ptr<Observer>& observer)
+        {
+            using base_type = observer_type<std::variant_alternative_t<Index, event_variant>>;
+            if constexpr (std::is_base_of_v<base_type, Observer>)
+            {
+                std::get<Index>(m_tables).observers.emplace(topic, std::static_pointer_cast<base_type>(observer));
+            }
+        }
+
+        template <typename Observer, std::size_t... Indices>
+        void unsubscribe_observer(
+            const Topic& topic, const std::shared_ptr<Observer>& observer, std::index_sequence<Indices...> /*unused*/)
+        {
+            (unsubscribe_alternative<Indices>(topic, observer), ...);
+        }
+
+        template <std::size_t Index, typename Observer>
+        void unsubscribe_alternative(const Topic& topic, const std::shared_ptr<Observer>& observer)
+        {
+            using base_type = observer_type<std::variant_alternative_t<Index, event_variant>>;
+            if constexpr (std::is_base_of_v<base_type, Observer>)
+            {
+                const base_type* target = observer.get();
+                auto& observers = std::get<Index>(m_tables).observers;
+                auto range = observers.equal_range(topic);
+                for (auto it = range.first; it != range.second;)
+                {
+                    it = (it->second.get() == target) ? observers.erase(it) : std::next(it);
+                }
+            }
+        }
+
+        shared_critical_section m_mutex;
+        std::tuple<subscriber_table<Evts>...> m_tables;
+        std::string m_name;
+        Origin m_origin;
+    };
+
+}
+
+#endif //  VARIANT_SUBJECT_HPP_
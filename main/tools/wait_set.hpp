@@ -0,0 +1,240 @@
+/**
+ * @file wait_set.hpp
+ * @brief Wait-on-many for a task consuming several async observers, sync queues and memory pipes.
+ *
+ * A wait_set owns one light_event and a word of ready bits. Each source registered with it sets its bit and
+ * signals the event when it receives data, so one task sleeps on all its sources at once and learns on wakeup
+ * which of them to drain, instead of polling each with its own timeout.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WAIT_SET_HPP_)
+#define WAIT_SET_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Bits of the sources of a wait_set that received data, bit n for the source registered as n.
+     */
+    using wait_set_mask = std::uint32_t;
+
+    /**
+     * @brief One wakeup primitive shared by up to 32 sources, for a single consuming task.
+     *
+     * Sources are registered with attach() under an index of 0 to 31. wait() returns the mask of the sources
+     * notified since the previous call and clears it: a source reported ready must be drained (until its pop
+     * fails), since its next notification only comes with new data. Notifications coalesce, and a spurious
+     * ready bit costs one empty pop. Any number of tasks and ISRs may notify; one task waits.
+     */
+    class wait_set : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        /** @brief Number of sources a wait_set can tell apart. */
+        static constexpr std::size_t max_sources = 32U;
+
+        wait_set() = default;
+        ~wait_set() = default;
+
+        /**
+         * @brief Registers a source exposing ready_hook(): an async observer, a sync queue or a memory pipe.
+         *
+         * Detach it (source.ready_hook().detach()) before the wait_set is destroyed.
+         *
+         * @tparam Source The source type.
+         * @param source The source.
+         * @param index The bit of the source in the ready masks, below max_sources.
+         * @return false if index is out of range, the source then staying detached.
+         */
+        template <typename Source>
+        bool attach(Source& source, std::size_t index);
+
+        /**
+         * @brief Marks a source ready and wakes the waiting task.
+         * @param ready The bits of the sources.
+         */
+        void notify(wait_set_mask ready)
+        {
+            m_ready.fetch_or(ready, std::memory_order_release);
+            m_event.signal();
+        }
+
+        /**
+         * @brief Marks a source ready and wakes the waiting task, from an ISR.
+         * @param ready The bits of the sources.
+         */
+        void isr_notify(wait_set_mask ready)
+        {
+            m_ready.fetch_or(ready, std::memory_order_release);
+            m_event.isr_signal();
+        }
+
+        /**
+         * @brief Takes the ready sources without waiting.
+         * @return The ready mask, 0 if no source was notified.
+         */
+        [[nodiscard]] wait_set_mask poll()
+        {
+            return m_ready.exchange(0U, std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Waits until at least one source is ready.
+         * @return The ready mask, never 0.
+         */
+        [[nodiscard]] wait_set_mask wait()
+        {
+            wait_set_mask ready = poll();
+            while (0U == ready)
+            {
+                m_event.wait_for_signal();
+                ready = poll();
+            }
+            return ready;
+        }
+
+        /**
+         * @brief Waits up to a timeout for at least one source to be ready.
+         * @param timeout The maximum duration to wait.
+         * @return The ready mask, 0 if the timeout expired first.
+         */
+        [[nodiscard]] wait_set_mask wait(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            wait_set_mask ready = poll();
+
+            while (0U == ready)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                {
+                    break;
+                }
+
+                // a signal left by bits already taken wakes the wait early: it then goes on with the time left
+                m_event.wait_for_signal(
+                    std::chrono::duration_cast<std::chrono::duration<std::uint64_t, std::micro>>(deadline - now));
+                ready = poll();
+            }
+
+            return ready;
+        }
+
+    private:
+        std::atomic<wait_set_mask> m_ready { 0U };
+        light_event m_event;
+    };
+
+    /**
+     * @brief Link from a source to the wait_set it is registered with, embedded in the source.
+     *
+     * notify() costs one acquire load while detached. attach() and detach() may run while the source is being
+     * fed; the wait_set must outlive the attachment.
+     */
+    class wait_set_hook : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        wait_set_hook() = default;
+        ~wait_set_hook() = default;
+
+        /**
+         * @brief Registers the source with a wait_set, replacing any previous registration.
+         * @param set The wait_set.
+         * @param index The bit of the source, below wait_set::max_sources.
+         * @return false if index is out of range.
+         */
+        bool attach(wait_set& set, std::size_t index)
+        {
+            if (index >= wait_set::max_sources)
+            {
+                return false;
+            }
+
+            m_mask.store(wait_set_mask { 1U } << index, std::memory_order_relaxed);
+            m_set.store(&set, std::memory_order_release);
+            // data received before the registration would otherwise go unnoticed
+            set.notify(m_mask.load(std::memory_order_relaxed));
+            return true;
+        }
+
+        /**
+         * @brief Unregisters the source.
+         */
+        void detach()
+        {
+            m_set.store(nullptr, std::memory_order_release);
+        }
+
+        /**
+         * @brief Tells the wait_set, if any, that the source received data.
+         */
+        void notify() const
+        {
+            wait_set* set = m_set.load(std::memory_order_acquire);
+            if (nullptr != set)
+            {
+                set->notify(m_mask.load(std::memory_order_relaxed));
+            }
+        }
+
+        /**
+         * @brief Tells the wait_set, if any, that the source received data, from an ISR.
+         */
+        void isr_notify() const
+        {
+            wait_set* set = m_set.load(std::memory_order_acquire);
+            if (nullptr != set)
+            {
+                set->isr_notify(m_mask.load(std::memory_order_relaxed));
+            }
+        }
+
+    private:
+        std::atomic<wait_set*> m_set { nullptr };
+        std::atomic<wait_set_mask> m_mask { 0U };
+    };
+
+    template <typename Source>
+    bool wait_set::attach(Source& source, std::size_t index)
+    {
+        return source.ready_hook().attach(*this, index);
+    }
+}
+
+#endif // WAIT_SET_HPP_
@@ -0,0 +1,421 @@
+/**
+ * @file windowed_aggregate.hpp
+ * @brief Incremental min/max/mean/variance/count over sliding or tumbling time windows.
+ *
+ * This file defines tools::windowed_aggregate and its thread-safe adapter tools::sync_windowed_aggregate. Instead
+ * of re-walking snapshot_sorted() of a time list on every query, the aggregate is updated as samples arrive, in
+ * amortized O(1) per sample: monotonic deques keep the window minimum and maximum at their front, and Welford
+ * running moments, updated on insertion and on eviction, keep the mean and the variance.
+ *
+ * Supported timestamp types are those of tools::time_list: std::chrono::time_point (window length is its
+ * Duration) or integral types (window length of the same type).
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WINDOWED_AGGREGATE_HPP_)
+#define WINDOWED_AGGREGATE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+#include "tools/critical_section.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/time_list.hpp"
+#include "tools/windowed_time_list.hpp"
+
+namespace tools
+{
+    /**
+     * @brief How samples are grouped into windows.
+     */
+    enum class aggregate_window : std::uint8_t
+    {
+        sliding, ///< The samples of the last window length, up to the latest timestamp.
+        tumbling ///< Consecutive non-overlapping windows, each reported once when the next sample falls past it.
+    };
+
+    /**
+     * @brief Aggregates of the samples of one window.
+     *
+     * @tparam TTimestamp Timestamp type.
+     * @tparam TValue Sample type.
+     */
+    template <typename TTimestamp, typename TValue>
+    struct window_summary
+    {
+        TTimestamp first;  ///< Timestamp of the oldest sample in the window.
+        TTimestamp last;   ///< Timestamp of the latest sample in the window.
+        std::size_t count; ///< Number of samples.
+        TValue min;        ///< Smallest sample.
+        TValue max;        ///< Largest sample.
+        double mean;       ///< Arithmetic mean.
+        double variance;   ///< Population variance.
+    };
+
+    /**
+     * @brief Non-thread-safe incremental aggregator of a timestamped stream over time windows.
+     *
+     * Feed it from the code pushing into a time list, or from a data_task routine. Timestamps must not go
+     * backward: a sample older than the latest one is ignored and counted by late_count().
+     *
+     * - sliding: the window holds the samples newer than the latest timestamp minus the window length; push() and
+     *   expire(now) evict the older ones, summary() is the current window.
+     * - tumbling: windows of the given length follow each other from the first sample timestamp; the push that
+     *   falls past the current window returns its summary and starts the next one (empty windows are skipped),
+     *   summary() is the window in progress.
+     *
+     * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
+     * @tparam TValue Arithmetic sample type.
+     */
+    template <typename TTimestamp, typename TValue>
+    class windowed_aggregate
+    {
+        static_assert(detail::is_valid_timestamp<TTimestamp>::value,
+            "TTimestamp must be std::chrono::time_point<...> or an integral type");
+        static_assert(std::is_arithmetic<TValue>::value, "TValue must be an arithmetic type");
+
+    public:
+        using timestamp_type = TTimestamp;
+        using value_type = TValue;
+        using length_type = typename detail::timestamp_horizon<timestamp_type>::type;
+        using summary_type = window_summary<timestamp_type, value_type>;
+
+        /**
+         * @brief Constructs an empty aggregator.
+         *
+         * @param length The window length.
+         * @param kind Sliding or tumbling windows.
+         */
+        explicit windowed_aggregate(const length_type& length, aggregate_window kind = aggregate_window::sliding)
+            : m_length(length)
+            , m_kind(kind)
+        {
+        }
+
+        windowed_aggregate(const windowed_aggregate&) = delete;
+        windowed_aggregate(windowed_aggregate&&) = delete;
+        windowed_aggregate& operator=(const windowed_aggregate&) = delete;
+        windowed_aggregate& operator=(windowed_aggregate&&) = delete;
+        ~windowed_aggregate() = default;
+
+        /**
+         * @brief Adds a sample, evicting or closing windows as needed; amortized O(1).
+         *
+         * @param timestamp_value The sample timestamp, not older than the latest one.
+         * @param sample The sample value.
+         * @return With tumbling windows, the summary of the window this sample closed; nothing otherwise.
+         */
+        std::optional<summary_type> push(const timestamp_type& timestamp_value, const value_type& sample)
+        {
+            std::optional<summary_type> closed;
+
+            if (m_latest.has_value() && (timestamp_value < *m_latest))
+            {
+                ++m_late_count;
+                return closed;
+            }
+            m_latest = timestamp_value;
+
+            if (aggregate_window::sliding == m_kind)
+            {
+                evict_until(timestamp_value);
+            }
+            else if (!m_samples.empty() && !(timestamp_value < (*m_window_start + m_length)))
+            {
+                closed = summary();
+                reset_window();
+                // skip the empty windows between the closed one and this sample
+                const auto elapsed = timestamp_value - *m_window_start;
+                m_window_start = *m_window_start + (m_length * (elapsed / m_length));
+            }
+
+            if (m_samples.empty() && (aggregate_window::tumbling == m_kind) && !m_window_start.has_value())
+            {
+                m_window_start = timestamp_value;
+            }
+
+            insert(timestamp_value, sample);
+            return closed;
+        }
+
+        /**
+         * @brief Evicts the samples that left a sliding window by a caller clock; no-op for tumbling windows.
+         *
+         * @param now_value The current time.
+         * @return The number of samples evicted.
+         */
+        std::size_t expire(const timestamp_type& now_value)
+        {
+            if (aggregate_window::sliding != m_kind)
+            {
+                return 0U;
+            }
+            const std::size_t before = m_samples.size();
+            evict_until(now_value);
+            return before - m_samples.size();
+        }
+
+        /**
+         * @brief Returns the aggregates of the current window; O(1).
+         *
+         * @return The summary, or nothing when the window holds no sample.
+         */
+        [[nodiscard]] std::optional<summary_type> summary() const
+        {
+            if (m_samples.empty())
+            {
+                return std::nullopt;
+            }
+
+            const double variance = (m_samples.size() > 1U) ? (m_m2 / static_cast<double>(m_samples.size())) : 0.;
+            return summary_type { m_samples.front().timestamp, m_samples.back().timestamp, m_samples.size(),
+                m_min_candidates.front().value, m_max_candidates.front().value, m_mean,
+                (variance > 0.) ? variance : 0. };
+        }
+
+        /** @brief Returns the number of samples in the current window. */
+        [[nodiscard]] std::size_t count() const
+        {
+            return m_samples.size();
+        }
+
+        /** @brief Returns true when the current window holds no sample. */
+        [[nodiscard]] bool empty() const
+        {
+            return m_samples.empty();
+        }
+
+        /** @brief Returns the window length. */
+        [[nodiscard]] length_type length() const
+        {
+            return m_length;
+        }
+
+        /** @brief Returns the window kind. */
+        [[nodiscard]] aggregate_window kind() const
+        {
+            return m_kind;
+        }
+
+        /** @brief Returns the number of samples ignored because they were older than the latest one. */
+        [[nodiscard]] std::size_t late_count() const
+        {
+            return m_late_count;
+        }
+
+        /** @brief Drops every sample and the latest timestamp; the next tumbling window starts at the next sample. */
+        void clear()
+        {
+            reset_window();
+            m_window_start.reset();
+            m_latest.reset();
+        }
+
+    private:
+        struct sample_entry
+        {
+            timestamp_type timestamp;
+            value_type value;
+            std::uint64_t sequence;
+        };
+
+        struct candidate
+        {
+            value_type value;
+            std::uint64_t sequence;
+        };
+
+        void insert(const timestamp_type& timestamp_value, const value_type& sample)
+        {
+            const std::uint64_t sequence = m_next_sequence++;
+            m_samples.push_back(sample_entry { timestamp_value, sample, sequence });
+
+            // a candidate dominated by the new sample can never be the extremum again
+            while (!m_min_candidates.empty() && !(m_min_candidates.back().value < sample))
+            {
+                m_min_candidates.pop_back();
+            }
+            m_min_candidates.push_back(candidate { sample, sequence });
+            while (!m_max_candidates.empty() && !(sample < m_max_candidates.back().value))
+            {
+                m_max_candidates.pop_back();
+            }
+            m_max_candidates.push_back(candidate { sample, sequence });
+
+            const double value = static_cast<double>(sample);
+            const double delta = value - m_mean;
+            m_mean += delta / static_cast<double>(m_samples.size());
+            m_m2 += delta * (value - m_mean);
+        }
+
+        void evict_until(const timestamp_type& now_value)
+        {
+            while (!m_samples.empty() && !(now_value < (m_samples.front().timestamp + m_length)))
+            {
+                const sample_entry& oldest = m_samples.front();
+                if (m_min_candidates.front().sequence == oldest.sequence)
+                {
+                    m_min_candidates.pop_front();
+                }
+                if (m_max_candidates.front().sequence == oldest.sequence)
+                {
+                    m_max_candidates.pop_front();
+                }
+
+                const std::size_t remaining = m_samples.size() - 1U;
+                if (0U == remaining)
+                {
+                    m_mean = 0.;
+                    m_m2 = 0.;
+                }
+                else
+                {
+                    // Welford update run backward
+                    const double value = static_cast<double>(oldest.value);
+                    const double previous_mean = m_mean;
+                    m_mean = ((previous_mean * static_cast<double>(m_samples.size())) - value)
+                        / static_cast<double>(remaining);
+                    m_m2 -= (value - previous_mean) * (value - m_mean);
+                }
+                m_samples.pop_front();
+            }
+        }
+
+        void reset_window()
+        {
+            m_samples.clear();
+            m_min_candidates.clear();
+            m_max_candidates.clear();
+            m_mean = 0.;
+            m_m2 = 0.;
+        }
+
+        length_type m_length;
+        aggregate_window m_kind;
+        std::deque<sample_entry> m_samples;
+        std::deque<candidate> m_min_candidates; // increasing values, front is the minimum
+        std::deque<candidate> m_max_candidates; // decreasing values, front is the maximum
+        double m_mean = 0.;
+        double m_m2 = 0.; // sum of squared deviations from the mean
+        std::uint64_t m_next_sequence = 0U;
+        std::optional<timestamp_type> m_window_start; // tumbling windows only
+        std::optional<timestamp_type> m_latest;
+        std::size_t m_late_count = 0U;
+    };
+
+    /**
+     * @brief Thread-safe adapter over tools::windowed_aggregate, each operation under a critical_section.
+     *
+     * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
+     * @tparam TValue Arithmetic sample type.
+     */
+    template <typename TTimestamp, typename TValue>
+    class sync_windowed_aggregate : public windowed_aggregate<TTimestamp, TValue>,
+                                    public non_copyable // NOLINT non-copyable by design
+    {
+    public:
+        using base_type = windowed_aggregate<TTimestamp, TValue>;
+        using timestamp_type = typename base_type::timestamp_type;
+        using value_type = typename base_type::value_type;
+        using length_type = typename base_type::length_type;
+        using summary_type = typename base_type::summary_type;
+
+        struct thread_safe
+        {
+            static constexpr bool value = true;
+        };
+
+        explicit sync_windowed_aggregate(const length_type& length, aggregate_window kind = aggregate_window::sliding)
+            : base_type(length, kind)
+        {
+        }
+
+        /** @brief Adds a sample in a thread-safe manner. */
+        std::optional<summary_type> push(const timestamp_type& timestamp_value, const value_type& sample)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::push(timestamp_value, sample);
+        }
+
+        /** @brief Evicts the samples that left a sliding window in a thread-safe manner. */
+        std::size_t expire(const timestamp_type& now_value)
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::expire(now_value);
+        }
+
+        /** @brief Returns the aggregates of the current window in a thread-safe manner. */
+        [[nodiscard]] std::optional<summary_type> summary() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::summary();
+        }
+
+        /** @brief Returns the number of samples in the current window in a thread-safe manner. */
+        [[nodiscard]] std::size_t count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::count();
+        }
+
+        /** @brief Returns true when the current window is empty, in a thread-safe manner. */
+        [[nodiscard]] bool empty() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::empty();
+        }
+
+        /** @brief Returns the number of late samples ignored, in a thread-safe manner. */
+        [[nodiscard]] std::size_t late_count() const
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            return base_type::late_count();
+        }
+
+        /** @brief Drops every sample in a thread-safe manner. */
+        void clear()
+        {
+            std::scoped_lock<tools::critical_section> guard(m_mutex);
+            base_type::clear();
+        }
+
+    private:
+        mutable tools::critical_section m_mutex;
+    };
+
+} // namespace tools
+
+#endif // WINDOWED_AGGREGATE_HPP_
@@ -0,0 +1,409 @@
+/**
+ * @file windowed_histogram.hpp
+ * @brief Recent-window histograms: a ring of per-interval hdr_histograms and an exponentially decaying variant.
+ *
+ * This file defines tools::sliding_window_histogram, which keeps the samples of the last IntervalCount intervals
+ * in one hdr_histogram each and merges them on query, and tools::decaying_histogram, which weighs every sample by
+ * how many intervals ago it was recorded. Both answer recent-window percentiles in O(buckets) without replaying raw
+ * samples; the caller ticks the intervals (rotate() / decay()), e.g. from a periodic_task.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WINDOWED_HISTOGRAM_HPP_)
+#define WINDOWED_HISTOGRAM_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "tools/hdr_histogram.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Histogram of the samples recorded over the last IntervalCount intervals, not thread-safe.
+     *
+     * add() records into the current interval; rotate() closes it and recycles the oldest one, so the window slides
+     * by one interval without touching the other samples. merged() sums the intervals into a cached hdr_histogram
+     * (recomputed only after a change), which then gives the window percentiles, average and variance. Storage is
+     * inline: IntervalCount + 1 hdr_histograms.
+     *
+     * @tparam IntervalCount Number of intervals covered by the window.
+     * @tparam PrecisionBits log2 of the hdr_histogram sub-buckets per power of two.
+     * @tparam ValueBits Width of the largest recordable sample.
+     */
+    template <std::size_t IntervalCount, unsigned int PrecisionBits = 5U, unsigned int ValueBits = 32U>
+    class sliding_window_histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(IntervalCount >= 1U, "the window covers at least one interval");
+
+        using histogram_type = hdr_histogram<PrecisionBits, ValueBits>;
+
+        sliding_window_histogram() = default;
+        ~sliding_window_histogram() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief Records a sample in the current interval.
+         *
+         * @param value The sample (clamped to histogram_type::max_value).
+         */
+        void add(std::uint64_t value)
+        {
+            m_intervals[m_current].add(value);
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Records the same sample several times in the current interval.
+         *
+         * @param value The sample (clamped to histogram_type::max_value).
+         * @param occurrences The number of times it occurred.
+         */
+        void add(std::uint64_t value, std::uint64_t occurrences)
+        {
+            m_intervals[m_current].add(value, occurrences);
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Starts a new interval, forgetting the samples of the oldest one.
+         *
+         * @param intervals Number of elapsed intervals (a tick missed for a while clears as many intervals).
+         */
+        void rotate(std::size_t intervals = 1U)
+        {
+            for (std::size_t step = 0U; (step < intervals) && (step < IntervalCount); ++step)
+            {
+                m_current = ((m_current + 1U) == IntervalCount) ? 0U : (m_current + 1U);
+                m_intervals[m_current].reset();
+            }
+
+            m_dirty = m_dirty || (0U != intervals);
+        }
+
+        /**
+         * @brief Gets the samples of the current, still open, interval.
+         *
+         * @return The current interval histogram.
+         */
+        [[nodiscard]] const histogram_type& current() const
+        {
+            return m_intervals[m_current];
+        }
+
+        /**
+         * @brief Gets the samples of the whole window, merging the intervals if they changed since the last call.
+         *
+         * @return The window histogram, valid until the next non-const call.
+         */
+        [[nodiscard]] const histogram_type& merged()
+        {
+            if (m_dirty)
+            {
+                m_merged.reset();
+                for (const auto& interval : m_intervals)
+                {
+                    m_merged.merge(interval);
+                }
+                m_dirty = false;
+            }
+
+            return m_merged;
+        }
+
+        /**
+         * @brief Gets the value below or at which a fraction of the window samples fall.
+         *
+         * @param fraction The percentile as a fraction in [0, 1].
+         * @return The percentile, 0 if the window is empty.
+         */
+        [[nodiscard]] std::uint64_t percentile(double fraction)
+        {
+            return merged().percentile(fraction);
+        }
+
+        /**
+         * @brief Gets the number of samples in the window.
+         *
+         * @return The total count over all intervals.
+         */
+        [[nodiscard]] std::uint64_t total_count() const
+        {
+            std::uint64_t total = 0U;
+            for (const auto& interval : m_intervals)
+            {
+                total += interval.total_count();
+            }
+            return total;
+        }
+
+        /**
+         * @brief Forgets every sample of every interval.
+         */
+        void reset()
+        {
+            for (auto& interval : m_intervals)
+            {
+                interval.reset();
+            }
+            m_merged.reset();
+            m_dirty = false;
+        }
+
+    private:
+        std::array<histogram_type, IntervalCount> m_intervals = {};
+        histogram_type m_merged;
+        std::size_t m_current = 0U;
+        bool m_dirty = false;
+    };
+
+    /**
+     * @brief Log-linear histogram whose samples lose weight exponentially with age, not thread-safe.
+     *
+     * Same bucket layout as hdr_histogram. Each decay() multiplies the weight of everything recorded so far by the
+     * decay factor; it is applied lazily by growing the weight of future samples instead, with a renormalization
+     * of the buckets when that weight gets large, so both add() and decay() are O(1) amortized. Percentiles,
+     * average and variance are the weighted ones, e.g. with a factor 0.5 a sample recorded one interval ago counts
+     * half as much as a fresh one.
+     *
+     * @tparam PrecisionBits log2 of the sub-buckets per power of two.
+     * @tparam ValueBits Width of the largest recordable sample.
+     */
+    template <unsigned int PrecisionBits = 5U, unsigned int ValueBits = 32U>
+    class decaying_histogram : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        using layout_type = hdr_histogram<PrecisionBits, ValueBits>;
+        static constexpr std::size_t bucket_count = layout_type::bucket_count;
+
+        /**
+         * @brief Constructs an empty histogram.
+         *
+         * @param decay_factor Weight kept by past samples at each decay(), in (0, 1].
+         */
+        explicit decaying_histogram(double decay_factor)
+            : m_growth((decay_factor > 0.0) && (decay_factor <= 1.0) ? (1.0 / decay_factor) : 1.0)
+        {
+        }
+
+        ~decaying_histogram() = default;
+        struct thread_safe
+        {
+            static constexpr bool value = false;
+        };
+
+        /**
+         * @brief Records a sample with the current weight.
+         *
+         * @param value The sample (clamped to layout_type::max_value).
+         */
+        void add(std::uint64_t value)
+        {
+            add(value, 1U);
+        }
+
+        /**
+         * @brief Records the same sample several times with the current weight.
+         *
+         * @param value The sample (clamped to layout_type::max_value).
+         * @param occurrences The number of times it occurred.
+         */
+        void add(std::uint64_t value, std::uint64_t occurrences)
+        {
+            value = (value > layout_type::max_value) ? layout_type::max_value : value;
+            const double weight = m_weight * static_cast<double>(occurrences);
+            const auto sample = static_cast<double>(value);
+
+            m_buckets[layout_type::bucket_of(value)] += weight;
+            m_total_weight += weight;
+            m_sum += sample * weight;
+            m_sum_of_squares += sample * sample * weight;
+        }
+
+        /**
+         * @brief Ages every recorded sample by one or more intervals.
+         *
+         * @param intervals Number of elapsed intervals.
+         */
+        void decay(std::size_t intervals = 1U)
+        {
+            for (std::size_t step = 0U; step < intervals; ++step)
+            {
+                m_weight *= m_growth;
+
+                if (m_weight > renormalize_threshold)
+                {
+                    renormalize();
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the value below or at which a weighted fraction of the samples fall.
+         *
+         * @param fraction The percentile as a fraction in [0, 1].
+         * @return The highest value of the bucket holding the percentile, 0 if empty.
+         */
+        [[nodiscard]] std::uint64_t percentile(double fraction) const
+        {
+            if (!(m_total_weight > 0.0))
+            {
+                return 0U;
+            }
+
+            fraction = (fraction < 0.0) ? 0.0 : ((fraction > 1.0) ? 1.0 : fraction);
+            const double rank = fraction * m_total_weight;
+
+            double seen = 0.0;
+            std::size_t last_populated = 0U;
+            for (std::size_t bucket = 0U; bucket < bucket_count; ++bucket)
+            {
+                if (m_buckets[bucket] > 0.0)
+                {
+                    seen += m_buckets[bucket];
+                    last_populated = bucket;
+
+                    if (seen >= rank)
+                    {
+                        return layout_type::highest_equivalent(bucket);
+                    }
+                }
+            }
+
+            // rounding left the rank a hair above the cumulated weight
+            return layout_type::highest_equivalent(last_populated);
+        }
+
+        /**
+         * @brief Gets the weighted median, percentile(0.5).
+         *
+         * @return The median value.
+         */
+        [[nodiscard]] double median() const
+        {
+            return static_cast<double>(percentile(0.5)); // NOLINT half
+        }
+
+        /**
+         * @brief Gets the weight of the recorded samples, in fresh-sample units.
+         *
+         * @return The sum of the current sample weights.
+         */
+        [[nodiscard]] double total_weight() const
+        {
+            return m_total_weight / m_weight;
+        }
+
+        /**
+         * @brief Calculates the weighted average of the samples.
+         *
+         * @return The average, 0 if empty.
+         */
+        [[nodiscard]] double average() const
+        {
+            return (m_total_weight > 0.0) ? (m_sum / m_total_weight) : 0.0;
+        }
+
+        /**
+         * @brief Calculates the weighted variance of the samples around a given average.
+         *
+         * @param average The average value of the data set.
+         * @return The variance, 0 if empty.
+         */
+        [[nodiscard]] double variance(double average) const
+        {
+            if (!(m_total_weight > 0.0))
+            {
+                return 0.0;
+            }
+
+            const double result = (m_sum_of_squares / m_total_weight) - (2.0 * average * (m_sum / m_total_weight))
+                + (average * average); // NOLINT math formula
+            return (result > 0.0) ? result : 0.0;
+        }
+
+        /**
+         * @brief Calculates the standard deviation from a variance.
+         *
+         * @param variance The variance value of the data set.
+         * @return The standard deviation.
+         */
+        [[nodiscard]] double standard_deviation(double variance) const
+        {
+            return std::sqrt(variance);
+        }
+
+        /**
+         * @brief Forgets every sample.
+         */
+        void reset()
+        {
+            m_buckets = {};
+            m_weight = 1.0;
+            m_total_weight = 0.0;
+            m_sum = 0.0;
+            m_sum_of_squares = 0.0;
+        }
+
+    private:
+        static constexpr double renormalize_threshold = 1e100;
+
+        void renormalize()
+        {
+            const double scale = 1.0 / m_weight;
+            for (auto& bucket : m_buckets)
+            {
+                bucket *= scale;
+            }
+            m_total_weight *= scale;
+            m_sum *= scale;
+            m_sum_of_squares *= scale;
+            m_weight = 1.0;
+        }
+
+        std::array<double, bucket_count> m_buckets = {};
+        double m_growth;
+        double m_weight = 1.0;
+        double m_total_weight = 0.0;
+        double m_sum = 0.0;
+        double m_sum_of_squares = 0.0;
+    };
+}
+
+#endif //  WINDOWED_HISTOGRAM_HPP_
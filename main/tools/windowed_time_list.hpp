@@ -0,0 +1,518 @@
+/**
+ * @file windowed_time_list.hpp
+ * @brief Bounded chronological timestamp/value container that forgets entries older than a time horizon.
+ *
+ * This file defines tools::windowed_time_list, a non-thread-safe alternative to tools::sorted_time_list for
+ * retention windows: the <timestamp, value> pairs live sorted in one ring preallocated at construction, a push
+ * evicts from the head every entry older than the configured horizon (measured back from the latest timestamp),
+ * and a full ring drops its oldest entry, so memory stays fixed whatever the sample rate.
+ *
+ * Supported timestamp types:
+ * - std::chrono::time_point<Clock, Duration> (horizon is a Duration)
+ * - integral types (signed/unsigned, horizon of the same type)
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WINDOWED_TIME_LIST_HPP_)
+#define WINDOWED_TIME_LIST_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <concepts>
+#endif
+
+#include "tools/time_list.hpp"
+
+namespace tools
+{
+    namespace detail
+    {
+        template <typename TTimestamp, bool IsTimePoint = is_std_time_point<TTimestamp>::value>
+        struct timestamp_horizon
+        {
+            using type = TTimestamp;
+        };
+
+        template <typename TTimestamp>
+        struct timestamp_horizon<TTimestamp, true>
+        {
+            using type = typename TTimestamp::duration;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Non-thread-safe chronological list bounded in time and in size, kept sorted in a fixed ring.
+     *
+     * Same interface as tools::sorted_time_list, plus retention:
+     * - entries older than horizon() before the latest timestamp are evicted from the head on each push, in
+     *   amortized O(1) since every entry is evicted at most once; expire(now) does the same against a caller clock;
+     * - the ring is allocated once with capacity() slots, and a push on a full ring drops the oldest entry (or the
+     *   pushed one when it is older than everything kept), counted by dropped_count();
+     * - a push at or after the latest timestamp is an O(1) append, a late one shifts the later entries by one slot.
+     *
+     * @tparam TTimestamp Timestamp type (chrono::time_point or integral).
+     * @tparam TValue Value type, need not be default constructible.
+     */
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+    template <typename TTimestamp, typename TValue>
+        requires detail::is_valid_timestamp<TTimestamp>::value
+    class windowed_time_list
+    {
+#else
+    template <typename TTimestamp, typename TValue>
+    class windowed_time_list
+    {
+        static_assert(detail::is_valid_timestamp<TTimestamp>::value,
+            "TTimestamp must be std::chrono::time_point<...> or an integral type");
+#endif
+
+    public:
+        using timestamp_type = TTimestamp;
+        using value_type = TValue;
+        using entry_type = std::pair<timestamp_type, value_type>;
+        using horizon_type = typename detail::timestamp_horizon<timestamp_type>::type;
+
+        /**
+         * @brief Constructs an empty list and preallocates its ring.
+         *
+         * @param capacity Maximum number of kept entries (at least one).
+         * @param horizon Age, relative to the latest timestamp, beyond which entries are evicted.
+         */
+        windowed_time_list(std::size_t capacity, const horizon_type& horizon)
+            : m_slots(std::make_unique<slot[]>((0U == capacity) ? 1U : capacity)) // NOLINT raw slot array
+            , m_capacity((0U == capacity) ? 1U : capacity)
+            , m_horizon(horizon)
+        {
+        }
+
+        windowed_time_list(const windowed_time_list&) = delete;
+        windowed_time_list(windowed_time_list&&) = delete;
+        windowed_time_list& operator=(const windowed_time_list&) = delete;
+        windowed_time_list& operator=(windowed_time_list&&) = delete;
+
+        ~windowed_time_list()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Push an entry by copy.
+         *
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        void push(const timestamp_type& timestamp_value, const value_type& payload_value)
+        {
+            insert(timestamp_value, payload_value);
+        }
+
+        /**
+         * @brief Push an entry by move.
+         *
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        void push(timestamp_type&& timestamp_value, value_type&& payload_value)
+        {
+            insert(std::move(timestamp_value), std::move(payload_value));
+        }
+
+        /**
+         * @brief Push an entry with forwarding support.
+         *
+         * @tparam TT Deduce-able timestamp input type.
+         * @tparam TV Deduce-able value input type.
+         * @param timestamp_value Timestamp associated with value.
+         * @param payload_value Value to store.
+         */
+        template <typename TT, typename TV>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::constructible_from<timestamp_type, TT> && std::constructible_from<value_type, TV>
+#endif
+        auto push(TT&& timestamp_value, TV&& payload_value)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<timestamp_type, TT>::value
+                    && std::is_constructible<value_type, TV>::value,
+                void>::type
+#endif
+        {
+            insert(timestamp_type(std::forward<TT>(timestamp_value)), std::forward<TV>(payload_value));
+        }
+
+        /**
+         * @brief Emplace a value with explicit timestamp.
+         *
+         * @tparam TArgs Value constructor argument types.
+         * @param timestamp_value Timestamp associated with value.
+         * @param value_args Arguments forwarded to value_type constructor.
+         */
+        template <typename... TArgs>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::constructible_from<value_type, TArgs...>
+#endif
+        auto emplace(const timestamp_type& timestamp_value, TArgs&&... value_args)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<std::is_constructible<value_type, TArgs...>::value, void>::type
+#endif
+        {
+            insert(timestamp_value, value_type(std::forward<TArgs>(value_args)...));
+        }
+
+        /**
+         * @brief Access the earliest entry.
+         *
+         * @return Earliest entry when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<entry_type> top() const
+        {
+            if (0U == m_size)
+            {
+                return std::nullopt;
+            }
+            return element(0U);
+        }
+
+        /**
+         * @brief Remove the earliest entry if present.
+         */
+        void pop()
+        {
+            if (0U != m_size)
+            {
+                pop_front();
+            }
+        }
+
+        /**
+         * @brief Fetch and remove the earliest entry.
+         *
+         * @return Earliest entry when non-empty; otherwise std::nullopt.
+         */
+        [[nodiscard]] std::optional<entry_type> top_pop()
+        {
+            if (0U == m_size)
+            {
+                return std::nullopt;
+            }
+
+            entry_type first_entry = std::move(element(0U));
+            pop_front();
+            return first_entry;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp, earliest first.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @param consumer Callable invoked with each removed entry (as an rvalue), in chronological order.
+         * @return Number of removed entries.
+         */
+        template <typename TConsumer>
+        std::size_t pop_until(const timestamp_type& timestamp_value, TConsumer&& consumer)
+        {
+            std::size_t removed = 0U;
+
+            while ((0U != m_size) && !(timestamp_value < element(0U).first))
+            {
+                consumer(std::move(element(0U)));
+                pop_front();
+                ++removed;
+            }
+
+            return removed;
+        }
+
+        /**
+         * @brief Remove every entry up to a timestamp.
+         *
+         * @param timestamp_value Inclusive upper bound of the removed timestamps.
+         * @return Number of removed entries.
+         */
+        std::size_t pop_until(const timestamp_type& timestamp_value)
+        {
+            return pop_until(timestamp_value, [](entry_type&&) {});
+        }
+
+        /**
+         * @brief Evict the entries older than horizon() before a given time, e.g. when no push came for a while.
+         *
+         * @param now_value Reference time, entries strictly older than now_value - horizon() are removed.
+         * @return Number of evicted entries.
+         */
+        std::size_t expire(const timestamp_type& now_value)
+        {
+            std::size_t removed = 0U;
+
+            while ((0U != m_size) && (element(0U).first < now_value) && (m_horizon < (now_value - element(0U).first)))
+            {
+                pop_front();
+                ++removed;
+            }
+
+            m_evicted += removed;
+            return removed;
+        }
+
+        /**
+         * @brief Visit in chronological order the entries of a time window, without copying them.
+         *
+         * @param from Inclusive lower bound of the visited timestamps.
+         * @param until Exclusive upper bound of the visited timestamps.
+         * @param visitor Callable invoked with each entry as a const reference.
+         * @return Number of visited entries.
+         */
+        template <typename TVisitor>
+        std::size_t visit_range(const timestamp_type& from, const timestamp_type& until, TVisitor&& visitor) const
+        {
+            std::size_t visited = 0U;
+
+            for (std::size_t offset = lower_bound(from); (offset < m_size) && (element(offset).first < until); ++offset)
+            {
+                visitor(static_cast<const entry_type&>(element(offset)));
+                ++visited;
+            }
+
+            return visited;
+        }
+
+        /**
+         * @brief Visit every entry in chronological order, without copying them.
+         *
+         * @param visitor Callable invoked with each entry as a const reference.
+         */
+        template <typename TVisitor>
+        void for_each(TVisitor&& visitor) const
+        {
+            for (std::size_t offset = 0U; offset < m_size; ++offset)
+            {
+                visitor(static_cast<const entry_type&>(element(offset)));
+            }
+        }
+
+        /**
+         * @brief Check whether the list is empty.
+         * @return True when empty.
+         */
+        [[nodiscard]] bool empty() const
+        {
+            return 0U == m_size;
+        }
+
+        /**
+         * @brief Get the number of entries.
+         * @return Number of stored entries.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Get the number of preallocated slots.
+         * @return Maximum number of kept entries.
+         */
+        [[nodiscard]] std::size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Get the retention horizon.
+         * @return Age beyond which entries are evicted.
+         */
+        [[nodiscard]] horizon_type horizon() const
+        {
+            return m_horizon;
+        }
+
+        /**
+         * @brief Count the entries evicted for being older than the horizon.
+         * @return Evictions since construction.
+         */
+        [[nodiscard]] std::size_t evicted_count() const
+        {
+            return m_evicted;
+        }
+
+        /**
+         * @brief Count the entries dropped because the ring was full.
+         * @return Drops since construction.
+         */
+        [[nodiscard]] std::size_t dropped_count() const
+        {
+            return m_dropped;
+        }
+
+        /**
+         * @brief Remove all entries, keeping the ring allocated.
+         */
+        void clear()
+        {
+            while (0U != m_size)
+            {
+                pop_front();
+            }
+        }
+
+        /**
+         * @brief Return a chronological snapshot (earliest to latest).
+         *
+         * @return Vector copy sorted by timestamp ascending.
+         */
+        [[nodiscard]] std::vector<entry_type> snapshot_sorted() const
+        {
+            std::vector<entry_type> snapshot_values;
+            snapshot_values.reserve(m_size);
+            for_each([&snapshot_values](const entry_type& entry) { snapshot_values.push_back(entry); });
+            return snapshot_values;
+        }
+
+    private:
+        struct slot
+        {
+            alignas(entry_type) unsigned char bytes[sizeof(entry_type)]; // NOLINT raw storage of one entry
+        };
+
+        [[nodiscard]] void* raw_slot(std::size_t offset) const
+        {
+            const std::size_t index = m_head + offset;
+            return m_slots[(index >= m_capacity) ? (index - m_capacity) : index].bytes;
+        }
+
+        [[nodiscard]] entry_type& element(std::size_t offset) const
+        {
+            return *std::launder(reinterpret_cast<entry_type*>(raw_slot(offset))); // NOLINT slot holds a live entry
+        }
+
+        void pop_front()
+        {
+            element(0U).~entry_type();
+            m_head = ((m_head + 1U) == m_capacity) ? 0U : (m_head + 1U);
+            --m_size;
+        }
+
+        template <typename TT, typename TV>
+        void insert(TT&& timestamp_value, TV&& payload_value)
+        {
+            if (m_size == m_capacity)
+            {
+                ++m_dropped;
+                if (timestamp_value < element(0U).first)
+                {
+                    // older than everything kept: the pushed entry is the one to drop
+                    return;
+                }
+                pop_front();
+            }
+
+            if ((0U == m_size) || !(timestamp_value < element(m_size - 1U).first))
+            {
+                // monotonic fast path
+                ::new (raw_slot(m_size)) entry_type(std::forward<TT>(timestamp_value), std::forward<TV>(payload_value));
+                ++m_size;
+            }
+            else
+            {
+                insert_late(entry_type(std::forward<TT>(timestamp_value), std::forward<TV>(payload_value)));
+            }
+
+            evict_beyond_horizon();
+        }
+
+        void insert_late(entry_type&& entry)
+        {
+            // scan back from the latest entry: late samples are usually only a few positions behind
+            std::size_t position = m_size;
+            while ((0U != position) && (entry.first < element(position - 1U).first))
+            {
+                --position;
+            }
+
+            ::new (raw_slot(m_size)) entry_type(std::move(element(m_size - 1U)));
+            ++m_size;
+            for (std::size_t offset = m_size - 2U; offset > position; --offset)
+            {
+                element(offset) = std::move(element(offset - 1U));
+            }
+            element(position) = std::move(entry);
+        }
+
+        void evict_beyond_horizon()
+        {
+            const timestamp_type& latest = element(m_size - 1U).first;
+            while (m_horizon < (latest - element(0U).first))
+            {
+                pop_front();
+                ++m_evicted;
+            }
+        }
+
+        [[nodiscard]] std::size_t lower_bound(const timestamp_type& timestamp_value) const
+        {
+            std::size_t first = 0U;
+            std::size_t count = m_size;
+
+            while (0U != count)
+            {
+                const std::size_t step = count / 2U;
+                if (element(first + step).first < timestamp_value)
+                {
+                    first += step + 1U;
+                    count -= step + 1U;
+                }
+                else
+                {
+                    count = step;
+                }
+            }
+
+            return first;
+        }
+
+        std::unique_ptr<slot[]> m_slots; // NOLINT raw slot array
+        std::size_t m_capacity;
+        std::size_t m_head = 0U;
+        std::size_t m_size = 0U;
+        horizon_type m_horizon;
+        std::size_t m_evicted = 0U;
+        std::size_t m_dropped = 0U;
+    };
+
+} // namespace tools
+
+#endif // WINDOWED_TIME_LIST_HPP_
@@ -0,0 +1,234 @@
+/**
+ * @file work_result.hpp
+ * @brief Caller-provided slot receiving the result of work delegated to a worker_task.
+ *
+ * worker_task::delegate_with_result() writes the value returned by the work into a work_result owned by the
+ * caller, then signals it: a request/response round trip costs one queue push and one signal, without the shared
+ * state a pco::packaged_task allocates.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WORK_RESULT_HPP_)
+#define WORK_RESULT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+#include "tools/platform_helpers.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Slot receiving the result of one delegated work at a time.
+     *
+     * The value is stored inline; reset() makes the slot reusable for the next request. The slot must outlive the
+     * work it is given to, and a single task may wait on it at a time.
+     *
+     * @tparam R The result type.
+     */
+    template <typename R>
+    class work_result : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+        static_assert(!std::is_void<R>::value, "use a completion callback for work without result");
+
+    public:
+        work_result() = default;
+        ~work_result() = default;
+
+        /**
+         * @brief Tells whether the result has been written.
+         *
+         * @return true once the worker is done with the slot.
+         */
+        [[nodiscard]] bool ready() const noexcept
+        {
+            return m_ready.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Waits until the result has been written.
+         */
+        void wait()
+        {
+            if (!ready())
+            {
+                m_ready_sync.wait_for_signal();
+                settle();
+            }
+        }
+
+        /**
+         * @brief Waits until the result has been written or the timeout expires.
+         *
+         * @param timeout The maximum waiting time.
+         * @return true if the result is ready.
+         */
+        bool wait_for(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            if (!ready())
+            {
+                m_ready_sync.wait_for_signal(timeout);
+                if (!m_written.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+                settle();
+            }
+            return ready();
+        }
+
+        /**
+         * @brief Gives access to the result.
+         *
+         * @return The result, ready() being true.
+         */
+        [[nodiscard]] R& value()
+        {
+            return m_value.value();
+        }
+
+        /**
+         * @brief Moves the result out, leaving the slot empty and ready for reset().
+         *
+         * @return The result, or nothing if it is not ready.
+         */
+        std::optional<R> take()
+        {
+            if (!ready())
+            {
+                return std::nullopt;
+            }
+            std::optional<R> result(std::move(m_value));
+            m_value.reset();
+            return result;
+        }
+
+        /**
+         * @brief Empties the slot so that it can receive the result of another work.
+         */
+        void reset()
+        {
+            m_value.reset();
+            static_cast<void>(m_ready_sync.try_wait_for_signal());
+            m_written.store(false, std::memory_order_relaxed);
+            m_ready.store(false, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Writes the result and wakes up the waiter, called by the worker.
+         *
+         * @param value The result.
+         */
+        template <typename UValue>
+        void set_value(UValue&& value)
+        {
+            m_value.emplace(std::forward<UValue>(value));
+            m_written.store(true, std::memory_order_release);
+            m_ready_sync.signal();
+            // last access of the worker: the slot may be destroyed as soon as it is seen ready
+            m_ready.store(true, std::memory_order_release);
+        }
+
+    private:
+        /**
+         * @brief Waits out the few instructions between the signal and the ready flag of set_value().
+         */
+        void settle() const
+        {
+            while (!ready())
+            {
+                tools::yield();
+            }
+        }
+
+        std::optional<R> m_value;
+        std::atomic_bool m_written = false;
+        std::atomic_bool m_ready = false;
+        tools::light_event m_ready_sync;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Inline storage of the value returned by a delegated work, nothing for work returning void.
+         *
+         * @tparam R The result type.
+         */
+        template <typename R>
+        class work_result_storage
+        {
+        public:
+            /**
+             * @brief Runs the work and keeps its result.
+             */
+            template <typename UWork, typename... Args>
+            void run(UWork& work, Args&&... args)
+            {
+                m_value.emplace(work(std::forward<Args>(args)...));
+            }
+
+            /**
+             * @brief Moves the kept result out.
+             */
+            R take()
+            {
+                return std::move(m_value.value());
+            }
+
+        private:
+            std::optional<R> m_value;
+        };
+
+        template <>
+        class work_result_storage<void>
+        {
+        public:
+            template <typename UWork, typename... Args>
+            void run(UWork& work, Args&&... args)
+            {
+                work(std::forward<Args>(args)...);
+            }
+
+            void take()
+            {
+            }
+        };
+    } // namespace detail
+}
+
+#endif //  WORK_RESULT_HPP_
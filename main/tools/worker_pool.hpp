@@ -0,0 +1,539 @@
+/**
+ * @file worker_pool.hpp
+ * @brief A pool of worker tasks sharing delegated work through work stealing.
+ *
+ * This file contains the definition of the worker_pool class template. Each worker owns a deque of callbacks;
+ * delegated work is dealt round-robin to the workers and idle workers steal from the busy ones, so that CPU heavy
+ * work spreads over all the cores.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(WORKER_POOL_HPP_)
+#define WORKER_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#endif
+
+#include "portable_concurrency/future.hpp"
+#include "tools/base_task.hpp"
+#include "tools/cpu_topology.hpp"
+#include "tools/critical_section.hpp"
+#include "tools/generic_task.hpp"
+#include "tools/inplace_function.hpp"
+#include "tools/light_event.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    template <typename Context>
+    class worker_pool;
+
+    template <typename Context>
+    class worker_pool_executor
+    {
+    public:
+        explicit worker_pool_executor(worker_pool<Context>* owner)
+            : m_owner(owner)
+        {
+        }
+
+    private:
+        worker_pool<Context>* m_owner = nullptr;
+
+        template <typename Ctx, typename Task>
+        friend void post(worker_pool_executor<Ctx> exec, Task&& task);
+    };
+
+    template <typename Context, typename Task>
+    void post(worker_pool_executor<Context> exec, Task&& task)
+    {
+        using work_item = typename worker_pool<Context>::work_item;
+
+        if constexpr (work_item::template is_storable<std::decay_t<Task>>)
+        {
+            // small tasks are moved into the work deque, no allocation
+            exec.m_owner->delegate([stored_task = std::decay_t<Task>(std::forward<Task>(task))](
+                                       const std::shared_ptr<Context>&, const std::string&) mutable { stored_task(); });
+        }
+        else
+        {
+            auto shared_task = std::make_shared<std::decay_t<Task>>(std::forward<Task>(task));
+            exec.m_owner->delegate(
+                [shared_task](const std::shared_ptr<Context>&, const std::string&) mutable { (*shared_task)(); });
+        }
+    }
+
+    /**
+     * @brief Scheduling parameters of one worker of a worker_pool.
+     */
+    struct worker_pool_params
+    {
+        int cpu_affinity = base_task::run_on_all_cores;
+        int priority = base_task::default_priority;
+    };
+
+    /**
+     * @brief Builds the parameters of workers pinned one per physical core first, alternating NUMA nodes.
+     *
+     * @param nb_workers The number of workers.
+     * @param priority The priority of every worker.
+     * @param topology The topology to place the workers on.
+     * @return The worker parameters, in cpu_topology::spread() order.
+     */
+    inline std::vector<worker_pool_params> spread_worker_params(std::size_t nb_workers,
+        int priority = base_task::default_priority, const cpu_topology& topology = cpu_topology::current())
+    {
+        std::vector<worker_pool_params> params;
+        params.reserve(nb_workers);
+
+        for (const int cpu : topology.spread(nb_workers))
+        {
+            params.push_back(worker_pool_params { cpu, priority });
+        }
+
+        return params;
+    }
+
+    /**
+     * @brief A pool of worker tasks with per-worker deques and work stealing.
+     *
+     * Delegated callbacks are dealt round-robin to the workers. A worker runs its own deque oldest first, and
+     * when it runs dry it steals the most recently queued callback of another worker. The pool offers the same
+     * delegate()/delegate_range()/as_executor() interface as worker_task, but callbacks may run concurrently and
+     * in any order.
+     *
+     * @tparam Context The type of the context object shared by the workers.
+     */
+    template <typename Context>
+    class worker_pool : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        worker_pool() = delete;
+
+        /**
+         * @brief Type alias for a callback function.
+         *
+         * This callback function takes a shared pointer to a Context object and the name of the worker
+         * running it as parameters.
+         */
+        using call_back = std::function<void(const std::shared_ptr<Context>& context, const std::string& task_name)>;
+        using executor_type = worker_pool_executor<Context>;
+
+        /**
+         * @brief Type alias for a queued work item, stored inline when the callable fits (see worker_task).
+         */
+        using work_item
+            = tools::inplace_function<void(const std::shared_ptr<Context>& context, const std::string& task_name)>;
+        static_assert(work_item::template is_storable<call_back>, "a call_back must fit in a work_item");
+
+        /**
+         * @brief Tells whether a callable can be delegated: copyable into a call_back, or small enough to be moved
+         * into a work_item.
+         */
+        template <typename UWork>
+        static constexpr bool is_delegable = std::is_constructible<call_back, UWork>::value
+            || (std::is_constructible<work_item, UWork>::value
+                && work_item::template is_storable<typename std::decay<UWork>::type>);
+
+        /**
+         * @brief Constructs a worker_pool with one worker per entry of worker_params.
+         *
+         * @param startup_routine Routine run once by each worker before it processes any work.
+         * @param context A shared pointer to the Context object.
+         * @param task_name The name prefix of the workers, suffixed with "_<index>".
+         * @param stack_size The stack size of each worker.
+         * @param worker_params The cpu affinity and priority of each worker (at least one worker is created).
+         */
+        worker_pool(call_back&& startup_routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            std::size_t stack_size, const std::vector<worker_pool_params>& worker_params)
+            : m_startup_routine(std::move(startup_routine))
+            , m_context(context)
+        {
+            const std::size_t nb_workers = worker_params.empty() ? 1U : worker_params.size();
+
+            m_workers.reserve(nb_workers);
+            for (std::size_t i = 0U; i < nb_workers; ++i)
+            {
+                m_workers.emplace_back(std::make_unique<worker_slot>());
+            }
+
+            m_tasks.reserve(nb_workers);
+            for (std::size_t i = 0U; i < nb_workers; ++i)
+            {
+                const worker_pool_params params = worker_params.empty() ? worker_pool_params {} : worker_params[i];
+
+                m_tasks.emplace_back(std::make_unique<tools::generic_task<Context>>(
+                    [this, i](const std::shared_ptr<Context>& ctx, const std::string& name) { run_loop(i, ctx, name); },
+                    m_context, task_name + "_" + std::to_string(i), stack_size, params.cpu_affinity,
+                    params.priority));
+            }
+        }
+
+        /**
+         * @brief Constructs a worker_pool of nb_workers workers with default priority and default cpu affinity.
+         *
+         * @param startup_routine Routine run once by each worker before it processes any work.
+         * @param context A shared pointer to the Context object.
+         * @param task_name The name prefix of the workers, suffixed with "_<index>".
+         * @param stack_size The stack size of each worker.
+         * @param nb_workers The number of workers (at least one worker is created).
+         */
+        worker_pool(call_back&& startup_routine, const std::shared_ptr<Context>& context, const std::string& task_name,
+            std::size_t stack_size, std::size_t nb_workers)
+            : worker_pool(std::move(startup_routine), context, task_name, stack_size,
+                  std::vector<worker_pool_params>(nb_workers))
+        {
+        }
+
+        /**
+         * @brief Destructor for the worker_pool class.
+         *
+         * Stops the workers once their current callback returns; work still queued is discarded.
+         */
+        ~worker_pool()
+        {
+            m_stop_pool.store(true);
+
+            for (auto& worker : m_workers)
+            {
+                worker->m_work_sync.signal();
+            }
+
+            // generic_task destructors wait for the workers to complete
+            m_tasks.clear();
+        }
+
+        /**
+         * @brief Delegates a task to the pool.
+         *
+         * @param work A callable object (e.g., lambda, function object) to be executed by one of the workers.
+         */
+        void delegate(call_back&& work)
+        {
+            do_delegate(work_item(std::move(work)));
+        }
+
+        void delegate(const call_back& work)
+        {
+            do_delegate(work_item(call_back(work)));
+        }
+
+        /**
+         * @brief Delegates a task using perfect forwarding.
+         *
+         * This template supports conversion-based callable arguments beyond exact-type overloads.
+         */
+        template <typename UWork>
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires is_delegable<UWork>
+#endif
+        auto delegate(UWork&& work)
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            -> typename std::enable_if<is_delegable<UWork>, void>::type
+#endif
+        {
+            do_delegate(make_work_item(std::forward<UWork>(work)));
+        }
+
+        /**
+         * @brief Delegates a batch of work callbacks from a generic range.
+         *
+         * In C++20, accepts any std::ranges::input_range whose value type can
+         * construct call_back. In C++17, accepts any iterable source whose
+         * dereferenced element can construct call_back.
+         */
+        template <typename TRange
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<call_back,
+                decltype(*std::begin(std::declval<typename std::decay<TRange>::type&>()))>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::ranges::input_range<TRange>
+            && std::is_constructible_v<call_back, std::ranges::range_value_t<TRange>>
+#endif
+        void delegate_range(TRange&& range)
+        {
+            for (auto&& work : std::forward<TRange>(range))
+            {
+                do_delegate(make_work_item(std::forward<decltype(work)>(work)));
+            }
+        }
+
+        template <typename InputIt>
+        void delegate_range(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                do_delegate(make_work_item(*first));
+            }
+        }
+
+        /**
+         * @brief Delegates a batch of work callbacks from an initializer-list.
+         */
+        template <typename U
+#if !((__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)))
+            ,
+            typename = typename std::enable_if<std::is_constructible<call_back, const U&>::value>::type
+#endif
+            >
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+            requires std::is_constructible_v<call_back, const U&>
+#endif
+        void delegate_range(std::initializer_list<U> range)
+        {
+            for (const auto& work : range)
+            {
+                do_delegate(make_work_item(work));
+            }
+        }
+
+        [[nodiscard]] executor_type as_executor()
+        {
+            return executor_type { this };
+        }
+
+        template <typename Callable, typename... Args>
+        auto delegate_async(
+            Callable&& work, Args&&... args) -> decltype(pco::async_result(std::declval<executor_type>(),
+                                                 std::forward<Callable>(work), std::declval<std::shared_ptr<Context>>(),
+                                                 std::declval<std::string>(), std::forward<Args>(args)...))
+        {
+            return pco::async_result(
+                as_executor(), std::forward<Callable>(work), m_context, m_tasks.front()->task_name(),
+                std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Retrieves the number of workers.
+         *
+         * @return The number of workers of the pool.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_workers.size();
+        }
+
+        /**
+         * @brief Retrieves how many callbacks have been stolen by idle workers so far.
+         *
+         * @return The number of stolen callbacks.
+         */
+        [[nodiscard]] std::size_t steal_count() const
+        {
+            return m_steal_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves one of the workers, e.g. to get its native handle.
+         *
+         * @param index The index of the worker, lower than size().
+         * @return The worker task.
+         */
+        [[nodiscard]] base_task& worker(std::size_t index)
+        {
+            return *m_tasks.at(index);
+        }
+
+    private:
+        /**
+         * @brief Per-worker state: the deque of callbacks and the wake-up signal.
+         */
+        struct worker_slot : public non_copyable // NOLINT inherits from non copyable and non movable class
+        {
+            tools::critical_section m_mutex;
+            std::deque<work_item> m_queue;
+            tools::light_event m_work_sync;
+            std::atomic_bool m_idle = false;
+        };
+
+        /**
+         * @brief Builds a work item, inline when the callable fits, through a call_back otherwise.
+         */
+        template <typename UWork>
+        static work_item make_work_item(UWork&& work)
+        {
+            if constexpr (work_item::template is_storable<typename std::decay<UWork>::type>
+                && std::is_constructible<work_item, UWork>::value)
+            {
+                return work_item(std::forward<UWork>(work));
+            }
+            else
+            {
+                return work_item(call_back(std::forward<UWork>(work)));
+            }
+        }
+
+        void do_delegate(work_item&& work)
+        {
+            const std::size_t target = m_next_worker.fetch_add(1U, std::memory_order_relaxed) % m_workers.size();
+            auto& worker = *m_workers[target];
+
+            {
+                std::scoped_lock<tools::critical_section> guard(worker.m_mutex);
+                worker.m_queue.emplace_back(std::move(work));
+            }
+
+            if (worker.m_idle.load())
+            {
+                worker.m_work_sync.signal();
+                return;
+            }
+
+            // the target is busy: wake up an idle worker so that it steals the work
+            for (std::size_t i = 1U; i < m_workers.size(); ++i)
+            {
+                auto& other = *m_workers[(target + i) % m_workers.size()];
+
+                if (other.m_idle.load())
+                {
+                    other.m_work_sync.signal();
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @brief Pops the oldest callback of the worker's own deque.
+         */
+        std::optional<work_item> pop_local(worker_slot& worker)
+        {
+            std::scoped_lock<tools::critical_section> guard(worker.m_mutex);
+
+            if (worker.m_queue.empty())
+            {
+                return std::nullopt;
+            }
+
+            std::optional<work_item> work(std::move(worker.m_queue.front()));
+            worker.m_queue.pop_front();
+            return work;
+        }
+
+        /**
+         * @brief Steals the most recent callback of another worker.
+         */
+        std::optional<work_item> steal(std::size_t thief_index)
+        {
+            for (std::size_t i = 1U; i < m_workers.size(); ++i)
+            {
+                auto& victim = *m_workers[(thief_index + i) % m_workers.size()];
+                std::scoped_lock<tools::critical_section> guard(victim.m_mutex);
+
+                if (!victim.m_queue.empty())
+                {
+                    std::optional<work_item> work(std::move(victim.m_queue.back()));
+                    victim.m_queue.pop_back();
+                    m_steal_count.fetch_add(1U, std::memory_order_relaxed);
+                    return work;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        std::optional<work_item> next_work(std::size_t index)
+        {
+            auto work = pop_local(*m_workers[index]);
+            return work.has_value() ? std::move(work) : steal(index);
+        }
+
+        /**
+         * @brief Main loop of a worker: runs its own work first, then steals, then sleeps until signaled.
+         */
+        void run_loop(std::size_t index, const std::shared_ptr<Context>& context, const std::string& task_name)
+        {
+            auto& worker = *m_workers[index];
+
+            // execute given startup function
+            m_startup_routine(context, task_name);
+
+            while (!m_stop_pool.load())
+            {
+                auto work = next_work(index);
+
+                if (!work.has_value())
+                {
+                    // publish idleness before the last look, so that a concurrent delegate() either is seen
+                    // here or signals this worker
+                    worker.m_idle.store(true);
+                    work = next_work(index);
+
+                    if (!work.has_value())
+                    {
+                        worker.m_work_sync.wait_for_signal();
+                    }
+                    worker.m_idle.store(false);
+                }
+
+                if (work.has_value() && !m_stop_pool.load())
+                {
+                    work.value()(context, task_name);
+                }
+            } // run loop
+        }
+
+        call_back m_startup_routine;
+        std::shared_ptr<Context> m_context;
+        std::vector<std::unique_ptr<worker_slot>> m_workers;
+        std::vector<std::unique_ptr<tools::generic_task<Context>>> m_tasks;
+        std::atomic<std::size_t> m_next_worker = 0U;
+        std::atomic<std::size_t> m_steal_count = 0U;
+        std::atomic_bool m_stop_pool = false;
+    };
+}
+
+namespace pco
+{
+    template <typename Context>
+    struct is_executor<tools::worker_pool_executor<Context>> : std::true_type
+    {
+    };
+}
+
+#endif //  WORKER_POOL_HPP_
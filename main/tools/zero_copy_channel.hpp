@@ -0,0 +1,319 @@
+/**
+ * @file zero_copy_channel.hpp
+ * @brief Inter-core channel passing ownership of pooled message blocks instead of copying messages.
+ *
+ * A zero_copy_channel owns a fixed pool of message blocks. The producer (a task, or an ISR) fills a block in
+ * place and sends its pointer through a lock-free SPSC ring; the consumer, typically pinned to the other core,
+ * reads the block where it was written and hands it back through a second ring when done. No message byte is
+ * ever copied, whatever the block size.
+ *
+ * @author Laurent Lardinois
+ * @date October 2026
+ */
+
+//-----------------------------------------------------------------------------//
+// C++ Publish/Subscribe Pattern - Spare time development for fun              //
+// (c) 2025-2026 Laurent Lardinois https://be.linkedin.com/in/laurentlardinois //
+//                                                                             //
+// https://github.com/type-one/PublishSubscribeESP32                           //
+//                                                                             //
+// MIT License                                                                 //
+//                                                                             //
+// This software is provided 'as-is', without any express or implied           //
+// warranty.In no event will the authors be held liable for any damages        //
+// arising from the use of this software.                                      //
+//                                                                             //
+// Permission is granted to anyone to use this software for any purpose,       //
+// including commercial applications, and to alter itand redistribute it       //
+// freely, subject to the following restrictions :                             //
+//                                                                             //
+// 1. The origin of this software must not be misrepresented; you must not     //
+// claim that you wrote the original software.If you use this software         //
+// in a product, an acknowledgment in the product documentation would be       //
+// appreciated but is not required.                                            //
+// 2. Altered source versions must be plainly marked as such, and must not be  //
+// misrepresented as being the original software.                              //
+// 3. This notice may not be removed or altered from any source distribution.  //
+//-----------------------------------------------------------------------------//
+
+#pragma once
+
+#if !defined(ZERO_COPY_CHANNEL_HPP_)
+#define ZERO_COPY_CHANNEL_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "tools/light_event.hpp"
+#include "tools/lock_free_ring_buffer.hpp"
+#include "tools/non_copyable.hpp"
+
+namespace tools
+{
+    /**
+     * @brief Single-producer/single-consumer channel moving pooled message blocks between cores without copy.
+     *
+     * The pool holds 2^Pow2 blocks of T, default-constructed once with the channel and reused forever, so T is
+     * typically a fixed-size frame (e.g. std::array<std::uint8_t, 4096> plus a length). Ownership travels with
+     * the block:
+     * - the producer acquire()s a message_ptr from its core-local free list, fills it and send()s it;
+     * - the consumer receive()s a received_ptr and reads it in place; destroying the received_ptr returns the
+     *   block to the producer through the return ring;
+     * - a message_ptr destroyed without being sent goes straight back to the free list.
+     *
+     * The free list is only touched by the producer: it is refilled from the return ring when it runs dry, so
+     * neither side ever takes a lock. Both rings can hold every block, so send() and the block return never
+     * fail.
+     *
+     * All producer calls (acquire, send, destroying a message_ptr) must come from one context, either a task
+     * or an ISR using isr_send(); all consumer calls (receive, destroying a received_ptr) from one other task.
+     * The channel must outlive every handle it gave out.
+     *
+     * @tparam T The type of a message block, default constructible.
+     * @tparam Pow2 The power of 2 that determines the number of blocks in the pool.
+     */
+    template <typename T, std::size_t Pow2>
+    class zero_copy_channel : public non_copyable // NOLINT inherits from non copyable and non movable class
+    {
+    public:
+        static_assert(std::is_default_constructible<T>::value, "T has to be default constructible");
+
+        /** @brief Number of message blocks in the pool. */
+        static constexpr const std::size_t block_count = (1U << Pow2);
+
+        /**
+         * @brief Returns an unsent block to the producer free list.
+         */
+        class producer_deleter
+        {
+        public:
+            producer_deleter() = default;
+
+            explicit producer_deleter(zero_copy_channel* channel)
+                : m_channel(channel)
+            {
+            }
+
+            void operator()(T* block) const
+            {
+                m_channel->recycle(block);
+            }
+
+        private:
+            zero_copy_channel* m_channel = nullptr;
+        };
+
+        /**
+         * @brief Hands a consumed block back to the producer through the return ring.
+         */
+        class consumer_deleter
+        {
+        public:
+            consumer_deleter() = default;
+
+            explicit consumer_deleter(zero_copy_channel* channel)
+                : m_channel(channel)
+            {
+            }
+
+            void operator()(T* block) const
+            {
+                m_channel->give_back(block);
+            }
+
+        private:
+            zero_copy_channel* m_channel = nullptr;
+        };
+
+        /** @brief Block owned by the producer until it is sent. */
+        using message_ptr = std::unique_ptr<T, producer_deleter>;
+
+        /** @brief Block owned by the consumer until it is released. */
+        using received_ptr = std::unique_ptr<T, consumer_deleter>;
+
+        /**
+         * @brief Constructs the pool and puts every block in the producer free list.
+         */
+        zero_copy_channel()
+        {
+            for (std::size_t idx = 0U; idx < block_count; ++idx)
+            {
+                m_free_list.at(idx) = &m_blocks.at(idx);
+            }
+            m_free_count = block_count;
+        }
+
+        ~zero_copy_channel() = default;
+
+        /**
+         * @brief Takes a free block for the producer to fill; ISR safe.
+         *
+         * @return The block, or an empty message_ptr when every block is in flight or held by the consumer.
+         */
+        [[nodiscard]] message_ptr acquire()
+        {
+            if (0U == m_free_count)
+            {
+                refill_free_list();
+                if (0U == m_free_count)
+                {
+                    return message_ptr(nullptr, producer_deleter(this));
+                }
+            }
+
+            --m_free_count;
+            return message_ptr(m_free_list.at(m_free_count), producer_deleter(this));
+        }
+
+        /**
+         * @brief Passes a filled block to the consumer and wakes it.
+         *
+         * @param message The block, as returned by acquire().
+         * @return true if the block was sent, false if message was empty.
+         */
+        bool send(message_ptr&& message)
+        {
+            if (!enqueue(std::move(message)))
+            {
+                return false;
+            }
+
+            m_data_ready.signal();
+            return true;
+        }
+
+        /**
+         * @brief Passes a filled block to the consumer from an ISR and wakes it.
+         *
+         * @param message The block, as returned by acquire() from the same ISR.
+         * @return true if the block was sent, false if message was empty.
+         */
+        bool isr_send(message_ptr&& message)
+        {
+            if (!enqueue(std::move(message)))
+            {
+                return false;
+            }
+
+            m_data_ready.isr_signal();
+            return true;
+        }
+
+        /**
+         * @brief Takes the oldest sent block without waiting.
+         *
+         * @return The block, or an empty received_ptr if none is pending.
+         */
+        [[nodiscard]] received_ptr try_receive()
+        {
+            T* block = nullptr;
+            if (!m_sent.pop(block))
+            {
+                block = nullptr;
+            }
+            return received_ptr(block, consumer_deleter(this));
+        }
+
+        /**
+         * @brief Waits for the next sent block.
+         *
+         * @return The block.
+         */
+        [[nodiscard]] received_ptr receive()
+        {
+            auto message = try_receive();
+            while (!message)
+            {
+                m_data_ready.wait_for_signal();
+                message = try_receive();
+            }
+            return message;
+        }
+
+        /**
+         * @brief Waits for the next sent block, at most for a timeout.
+         *
+         * @param timeout The maximum duration to wait.
+         * @return The block, or an empty received_ptr if none arrived in time.
+         */
+        [[nodiscard]] received_ptr receive(const std::chrono::duration<std::uint64_t, std::micro>& timeout)
+        {
+            auto message = try_receive();
+            if (message)
+            {
+                return message;
+            }
+
+            // drop a wake-up left by a block already received, then look again before sleeping
+            (void)m_data_ready.try_wait_for_signal();
+            message = try_receive();
+            if (!message)
+            {
+                m_data_ready.wait_for_signal(timeout);
+                message = try_receive();
+            }
+            return message;
+        }
+
+        /**
+         * @brief Returns the number of blocks in the producer free list; producer side only.
+         *
+         * Blocks released by the consumer are only counted once the free list has been refilled from them.
+         *
+         * @return The number of blocks acquire() can hand out without refilling.
+         */
+        [[nodiscard]] std::size_t free_blocks() const
+        {
+            return m_free_count;
+        }
+
+    private:
+        bool enqueue(message_ptr&& message)
+        {
+            if (!message)
+            {
+                return false;
+            }
+
+            // the ring holds every block of the pool: it cannot be full
+            (void)m_sent.push(message.release());
+            return true;
+        }
+
+        void recycle(T* block)
+        {
+            m_free_list.at(m_free_count) = block;
+            ++m_free_count;
+        }
+
+        void give_back(T* block)
+        {
+            (void)m_returned.push(block);
+        }
+
+        void refill_free_list()
+        {
+            T* block = nullptr;
+            while ((m_free_count < block_count) && m_returned.pop(block))
+            {
+                m_free_list.at(m_free_count) = block;
+                ++m_free_count;
+            }
+        }
+
+        // both rings have 2^(Pow2 + 1) - 1 usable slots, more than the pool size
+        std::array<T, block_count> m_blocks {};
+        std::array<T*, block_count> m_free_list {};
+        std::size_t m_free_count = 0U;
+        padded_lock_free_ring_buffer<T*, Pow2 + 1U> m_sent;
+        padded_lock_free_ring_buffer<T*, Pow2 + 1U> m_returned;
+        light_event m_data_ready;
+    };
+}
+
+#endif //  ZERO_COPY_CHANNEL_HPP_
@@ -0,0 +1,497 @@
+/*
+ * uzlib  -  tiny deflate/inflate library (deflate, gzip, zlib)
+ *
+ * Whole-buffer fast inflate path.
+ *
+ * Copyright (c) 2026 by Laurent Lardinois
+ *
+ * This software is provided 'as-is', without any express
+ * or implied warranty.  In no event will the authors be
+ * held liable for any damages arising from the use of
+ * this software.
+ *
+ * Permission is granted to anyone to use this software
+ * for any purpose, including commercial applications,
+ * and to alter it and redistribute it freely, subject to
+ * the following restrictions:
+ *
+ * 1. The origin of this software must not be
+ *    misrepresented; you must not claim that you
+ *    wrote the original software. If you use this
+ *    software in a product, an acknowledgment in
+ *    the product documentation would be appreciated
+ *    but is not required.
+ *
+ * 2. Altered source versions must be plainly marked
+ *    as such, and must not be misrepresented as
+ *    being the original software.
+ *
+ * 3. This notice may not be removed or altered from
+ *    any source distribution.
+ */
+
+/* Unlike uzlib_uncompress(), which pulls one bit and one output byte at a
+   time so that it can be suspended anywhere, this decoder assumes the whole
+   compressed stream and the whole output buffer are available:
+   - a 64-bit bit buffer is refilled with one unaligned 8-byte load, so that
+     a length/distance pair (at most 48 bits) is decoded between two refills;
+   - Huffman symbols are looked up UZLIB_CONF_FAST_BITS bits at a time, longer
+     codes fall back to a canonical search;
+   - match copies go a chunk at a time when the distance allows it (16 bytes
+     with SSE2/NEON, 8 bytes on other 64-bit targets, 4 bytes elsewhere),
+     since the output buffer itself is the LZ77 window. */
+
+#include "tinf.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define UZLIB_FAST_CHUNK 16
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define UZLIB_FAST_CHUNK 16
+#elif defined(__x86_64__) || defined(__aarch64__) || defined(_M_ARM64)
+#define UZLIB_FAST_CHUNK 8
+#else
+#define UZLIB_FAST_CHUNK 4
+#endif
+
+#define UZLIB_FAST_MASK ((1U << UZLIB_CONF_FAST_BITS) - 1U)
+
+/* more zero bytes past the end than this means the stream is truncated */
+#define UZLIB_FAST_MAX_OVERRUN 8U
+
+extern const unsigned char length_bits[30];
+extern const unsigned short length_base[30];
+extern const unsigned char dist_bits[30];
+extern const unsigned short dist_base[30];
+extern const unsigned char clcidx[];
+
+/* bit reader over the whole source buffer */
+typedef struct
+{
+    const unsigned char* in;
+    const unsigned char* in_end;
+    uint64_t bitbuf;
+    unsigned int bitcnt;
+    unsigned int overrun;
+} fast_bits;
+
+static uint64_t fast_load_le64(const unsigned char* p)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    uint64_t v = 0;
+    int i;
+    for (i = 7; i >= 0; --i)
+        v = (v << 8) | p[i];
+    return v;
+#else
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#endif
+}
+
+/* top the bit buffer up to at least 56 bits */
+static void fast_refill(fast_bits* b)
+{
+    if (b->in_end - b->in >= 8)
+    {
+        /* bits above bitcnt get the same next bytes again on the following refill */
+        b->bitbuf |= fast_load_le64(b->in) << b->bitcnt;
+        b->in += (63 - b->bitcnt) >> 3;
+        b->bitcnt |= 56;
+        return;
+    }
+
+    while (b->bitcnt <= 56)
+    {
+        if (b->in < b->in_end)
+        {
+            b->bitbuf |= (uint64_t)*b->in++ << b->bitcnt;
+        }
+        else
+        {
+            /* pad with zeros; the caller checks the real stream was not overrun */
+            ++b->overrun;
+        }
+        b->bitcnt += 8;
+    }
+}
+
+static unsigned int fast_peek(const fast_bits* b, unsigned int num)
+{
+    return (unsigned int)(b->bitbuf & ((1U << num) - 1U));
+}
+
+static void fast_consume(fast_bits* b, unsigned int num)
+{
+    b->bitbuf >>= num;
+    b->bitcnt -= num;
+}
+
+static unsigned int fast_read_bits(fast_bits* b, unsigned int num)
+{
+    unsigned int val = fast_peek(b, num);
+    fast_consume(b, num);
+    return val;
+}
+
+static unsigned int fast_bit_reverse16(unsigned int v)
+{
+    v = ((v & 0xAAAAU) >> 1) | ((v & 0x5555U) << 1);
+    v = ((v & 0xCCCCU) >> 2) | ((v & 0x3333U) << 2);
+    v = ((v & 0xF0F0U) >> 4) | ((v & 0x0F0FU) << 4);
+    v = ((v & 0xFF00U) >> 8) | ((v & 0x00FFU) << 8);
+    return v;
+}
+
+/* given an array of code lengths, build the lookup tables; 0 on an oversubscribed code */
+static int fast_build_tree(UZLIB_FAST_TREE* t, const unsigned char* lengths, unsigned int num)
+{
+    unsigned int counts[16];
+    unsigned int next_code[16];
+    unsigned int i, code, sym;
+
+    memset(counts, 0, sizeof(counts));
+    memset(t->fast, 0, sizeof(t->fast));
+
+    for (i = 0; i < num; ++i)
+        counts[lengths[i]]++;
+    counts[0] = 0;
+
+    /* canonical codes, and the code limit of each length left-aligned on 16 bits */
+    for (code = 0, sym = 0, i = 1; i < 16; ++i)
+    {
+        next_code[i] = code;
+        t->first_code[i] = (unsigned short)code;
+        t->first_symbol[i] = (unsigned short)sym;
+        code += counts[i];
+        if (counts[i] && (code > (1U << i)))
+            return 0;
+        t->max_code[i] = code << (16 - i);
+        code <<= 1;
+        sym += counts[i];
+    }
+    t->max_code[16] = 0x10000U;
+
+    for (i = 0; i < num; ++i)
+    {
+        unsigned int len = lengths[i];
+        if (len)
+        {
+            unsigned int slot = next_code[len] - t->first_code[len] + t->first_symbol[len];
+            t->size[slot] = (unsigned char)len;
+            t->value[slot] = (unsigned short)i;
+            if (len <= UZLIB_CONF_FAST_BITS)
+            {
+                /* deflate sends codes MSB first: index the table by the reversed code */
+                unsigned int j = fast_bit_reverse16(next_code[len]) >> (16 - len);
+                for (; j <= UZLIB_FAST_MASK; j += 1U << len)
+                    t->fast[j] = (unsigned short)((len << 9) | i);
+            }
+            ++next_code[len];
+        }
+    }
+
+    return 1;
+}
+
+/* decode one symbol; the bit buffer must hold at least 15 bits */
+static int fast_decode_symbol(fast_bits* b, const UZLIB_FAST_TREE* t)
+{
+    unsigned int entry = t->fast[b->bitbuf & UZLIB_FAST_MASK];
+    unsigned int k, len, slot;
+
+    if (entry)
+    {
+        fast_consume(b, entry >> 9);
+        return (int)(entry & 0x1FFU);
+    }
+
+    k = fast_bit_reverse16((unsigned int)(b->bitbuf & 0xFFFFU));
+    for (len = UZLIB_CONF_FAST_BITS + 1; k >= t->max_code[len]; ++len)
+        ;
+    if (len >= 16)
+        return TINF_DATA_ERROR;
+
+    slot = (k >> (16 - len)) - t->first_code[len] + t->first_symbol[len];
+    if ((slot >= TINF_ARRAY_SIZE(t->size)) || (t->size[slot] != len))
+        return TINF_DATA_ERROR;
+
+    fast_consume(b, len);
+    return t->value[slot];
+}
+
+static void fast_build_fixed_trees(UZLIB_FAST_TREES* trees)
+{
+    unsigned char lengths[288];
+    unsigned int i;
+
+    for (i = 0; i < 144; ++i)
+        lengths[i] = 8;
+    for (; i < 256; ++i)
+        lengths[i] = 9;
+    for (; i < 280; ++i)
+        lengths[i] = 7;
+    for (; i < 288; ++i)
+        lengths[i] = 8;
+    (void)fast_build_tree(&trees->ltree, lengths, 288);
+
+    for (i = 0; i < 30; ++i)
+        lengths[i] = 5;
+    (void)fast_build_tree(&trees->dtree, lengths, 30);
+}
+
+static int fast_decode_trees(fast_bits* b, UZLIB_FAST_TREES* trees)
+{
+    /* code lengths for 288 literal/len symbols and 32 dist symbols */
+    unsigned char lengths[288 + 32];
+    unsigned int hlit, hdist, hclen, hlimit;
+    unsigned int i, num;
+
+    fast_refill(b);
+    hlit = fast_read_bits(b, 5) + 257;
+    hdist = fast_read_bits(b, 5) + 1;
+    hclen = fast_read_bits(b, 4) + 4;
+
+    memset(lengths, 0, 19);
+    for (i = 0; i < hclen; ++i)
+    {
+        if (b->bitcnt < 3)
+            fast_refill(b);
+        lengths[clcidx[i]] = (unsigned char)fast_read_bits(b, 3);
+    }
+
+    /* code length tree, temporarily in the length tree */
+    if (!fast_build_tree(&trees->ltree, lengths, 19))
+        return TINF_DATA_ERROR;
+
+    hlimit = hlit + hdist;
+    for (num = 0; num < hlimit;)
+    {
+        unsigned int length;
+        unsigned char fill_value = 0;
+        int sym;
+
+        if (b->bitcnt < 16 + 7)
+            fast_refill(b);
+
+        sym = fast_decode_symbol(b, &trees->ltree);
+        if (sym < 0)
+            return sym;
+
+        switch (sym)
+        {
+            case 16:
+                if (num == 0)
+                    return TINF_DATA_ERROR;
+                fill_value = lengths[num - 1];
+                length = fast_read_bits(b, 2) + 3;
+                break;
+            case 17:
+                length = fast_read_bits(b, 3) + 3;
+                break;
+            case 18:
+                length = fast_read_bits(b, 7) + 11;
+                break;
+            default:
+                lengths[num++] = (unsigned char)sym;
+                continue;
+        }
+
+        if (num + length > hlimit)
+            return TINF_DATA_ERROR;
+        memset(lengths + num, fill_value, length);
+        num += length;
+    }
+
+    if (!fast_build_tree(&trees->ltree, lengths, hlit) || !fast_build_tree(&trees->dtree, lengths + hlit, hdist))
+        return TINF_DATA_ERROR;
+
+    return TINF_OK;
+}
+
+static void fast_copy_chunk(unsigned char* out, const unsigned char* from)
+{
+#if (UZLIB_FAST_CHUNK == 16) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    vst1q_u8(out, vld1q_u8(from));
+#elif UZLIB_FAST_CHUNK == 16
+    _mm_storeu_si128((__m128i*)out, _mm_loadu_si128((const __m128i*)from));
+#else
+    memcpy(out, from, UZLIB_FAST_CHUNK);
+#endif
+}
+
+/* copy an LZ77 match inside the output buffer, possibly overlapping itself */
+static void fast_copy_match(unsigned char* out, unsigned int dist, unsigned int len, size_t room)
+{
+    const unsigned char* from = out - dist;
+
+    if ((dist >= UZLIB_FAST_CHUNK) && (room >= (size_t)len + UZLIB_FAST_CHUNK))
+    {
+        /* each chunk only reads bytes written before it: may write past len, never past room */
+        unsigned char* end = out + len;
+        do
+        {
+            fast_copy_chunk(out, from);
+            out += UZLIB_FAST_CHUNK;
+            from += UZLIB_FAST_CHUNK;
+        } while (out < end);
+    }
+    else if (dist == 1)
+    {
+        memset(out, *from, len);
+    }
+    else
+    {
+        while (len--)
+            *out++ = *from++;
+    }
+}
+
+static int fast_inflate_block_data(fast_bits* b, UZLIB_FAST_TREES* trees, TINF_DATA* d)
+{
+    unsigned char* out = d->dest;
+    unsigned char* const out_end = d->dest_limit;
+    const unsigned char* const out_start = d->dest_start;
+
+    for (;;)
+    {
+        int sym;
+
+        if (b->bitcnt < 48)
+        {
+            fast_refill(b);
+            if (b->overrun > UZLIB_FAST_MAX_OVERRUN)
+                return TINF_DATA_ERROR;
+        }
+
+        sym = fast_decode_symbol(b, &trees->ltree);
+        if (sym < 256)
+        {
+            if (sym < 0)
+                return sym;
+            if (out == out_end)
+                return TINF_DATA_ERROR;
+            *out++ = (unsigned char)sym;
+        }
+        else if (sym == 256)
+        {
+            d->dest = out;
+            return TINF_OK;
+        }
+        else
+        {
+            unsigned int len, dist;
+            int dsym;
+
+            sym -= 257;
+            if (sym >= 29)
+                return TINF_DATA_ERROR;
+            len = fast_read_bits(b, length_bits[sym]) + length_base[sym];
+
+            dsym = fast_decode_symbol(b, &trees->dtree);
+            if ((dsym < 0) || (dsym >= 30))
+                return TINF_DATA_ERROR;
+            dist = fast_read_bits(b, dist_bits[dsym]) + dist_base[dsym];
+
+            if ((dist > (size_t)(out - out_start)) || (len > (size_t)(out_end - out)))
+                return TINF_DATA_ERROR;
+
+            fast_copy_match(out, dist, len, (size_t)(out_end - out));
+            out += len;
+        }
+    }
+}
+
+static int fast_inflate_uncompressed_block(fast_bits* b, TINF_DATA* d)
+{
+    const unsigned char* block;
+    unsigned int length, invlength;
+    size_t loaded;
+
+    /* skip to the byte boundary, then rewind the reader to the first byte not yet consumed */
+    fast_consume(b, b->bitcnt & 7U);
+    loaded = (size_t)(b->in - d->source) + b->overrun;
+    if ((b->bitcnt >> 3) > loaded)
+        return TINF_DATA_ERROR;
+    block = d->source + (loaded - (b->bitcnt >> 3));
+    if ((block > b->in_end) || (b->in_end - block < 4))
+        return TINF_DATA_ERROR;
+
+    length = block[0] | (block[1] << 8);
+    invlength = block[2] | (block[3] << 8);
+    if (length != (~invlength & 0x0000FFFFU))
+        return TINF_DATA_ERROR;
+    block += 4;
+
+    if (((size_t)(b->in_end - block) < length) || ((size_t)(d->dest_limit - d->dest) < length))
+        return TINF_DATA_ERROR;
+
+    memcpy(d->dest, block, length);
+    d->dest += length;
+
+    b->in = block + length;
+    b->bitbuf = 0;
+    b->bitcnt = 0;
+    b->overrun = 0;
+
+    /* the reader now starts at this block end: keep the rewind arithmetic relative to it */
+    d->source = b->in;
+    return TINF_OK;
+}
+
+int TINFCC uzlib_uncompress_fast(TINF_DATA* d, UZLIB_FAST_TREES* trees)
+{
+    fast_bits b;
+    int bfinal;
+    size_t consumed_bits;
+
+    b.in = d->source;
+    b.in_end = d->source_limit;
+    b.bitbuf = 0;
+    b.bitcnt = 0;
+    b.overrun = 0;
+
+    do
+    {
+        int btype, res;
+
+        if (b.bitcnt < 3)
+            fast_refill(&b);
+        bfinal = (int)fast_read_bits(&b, 1);
+        btype = (int)fast_read_bits(&b, 2);
+
+        switch (btype)
+        {
+            case 0:
+                res = fast_inflate_uncompressed_block(&b, d);
+                break;
+            case 1:
+                fast_build_fixed_trees(trees);
+                res = fast_inflate_block_data(&b, trees, d);
+                break;
+            case 2:
+                res = fast_decode_trees(&b, trees);
+                if (res == TINF_OK)
+                    res = fast_inflate_block_data(&b, trees, d);
+                break;
+            default:
+                res = TINF_DATA_ERROR;
+                break;
+        }
+
+        if (res != TINF_OK)
+            return res;
+    } while (!bfinal);
+
+    /* hand the unused whole bytes back, so the caller can read a trailer */
+    consumed_bits = ((size_t)(b.in - d->source) + b.overrun) * 8U - b.bitcnt;
+    if (consumed_bits > (size_t)(b.in_end - d->source) * 8U)
+        return TINF_DATA_ERROR;
+    d->source += (consumed_bits + 7U) / 8U;
+    d->eof = true;
+
+    return TINF_DONE;
+}
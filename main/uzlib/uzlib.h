@@ -146,6 +146,29 @@ extern "C"
     int TINFCC uzlib_uncompress(TINF_DATA* d);
     int TINFCC uzlib_uncompress_chksum(TINF_DATA* d);
 
+    typedef struct
+    {
+        unsigned short fast[1U << UZLIB_CONF_FAST_BITS]; /* (length << 9) | symbol, by reversed code prefix, 0 if longer */
+        unsigned short first_code[16];              /* first canonical code of each length */
+        unsigned short first_symbol[16];            /* index in size/value of the first code of each length */
+        unsigned int max_code[17];                  /* code limit of each length, left-aligned on 16 bits */
+        unsigned char size[288];                    /* code length of each symbol, sorted by code */
+        unsigned short value[288];                  /* symbol, sorted by code */
+    } UZLIB_FAST_TREE;
+
+    typedef struct
+    {
+        UZLIB_FAST_TREE ltree; /* length/symbol tree */
+        UZLIB_FAST_TREE dtree; /* distance tree */
+    } UZLIB_FAST_TREES;
+
+    /* Whole-buffer decompression: source..source_limit holds the complete
+       raw deflate stream and dest..dest_limit has room for all of the output.
+       Returns TINF_DONE with source just past the deflate stream, or
+       TINF_DATA_ERROR. No checksum is accumulated and no dictionary ring is
+       kept; trees is scratch memory (a few KB, better not on a small stack). */
+    int TINFCC uzlib_uncompress_fast(TINF_DATA* d, UZLIB_FAST_TREES* trees);
+
     int TINFCC uzlib_zlib_parse_header(TINF_DATA* d);
     int TINFCC uzlib_gzip_parse_header(TINF_DATA* d);
 
@@ -29,4 +29,11 @@
 #define UZLIB_CONF_USE_MEMCPY 0
 #endif
 
+#ifndef UZLIB_CONF_FAST_BITS
+/* Width of the direct lookup table of uzlib_uncompress_fast(): codes up to
+   this many bits decode in one lookup, longer ones take a slower search.
+   The table takes 2 << UZLIB_CONF_FAST_BITS bytes per tree (1 to 15). */
+#define UZLIB_CONF_FAST_BITS 9
+#endif
+
 #endif /* UZLIB_CONF_H_INCLUDED */